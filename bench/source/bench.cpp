@@ -0,0 +1,504 @@
+// bench.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#define ZARG_IMPLEMENTATION
+#include <zarg.h>
+
+#include <new>
+#include <random>
+#include <atomic>
+#include <chrono>
+
+#include "util.h"
+
+#include "misc/dijkstra.h"
+
+#include "pdf/font.h"
+#include "font/handle.h"
+#include "font/font_file.h"
+
+#include "sap/style.h"
+#include "sap/font_family.h"
+
+#include "tree/paragraph.h"
+#include "interp/interp.h"
+#include "layout/linebreak.h"
+
+/*
+    A benchmark for text shaping (ie. `PdfFont::getGlyphInfosForString` and `PdfFont::getWordSize`).
+
+    usage: sap-bench [--tokens N] [--font-size PT] [--seed S]
+                     [--linebreak [--paragraph-words N] [--line-width MM]] <font dir> <corpus>
+
+    Every .otf and .ttf file in <font dir> is loaded, and for each font we shape a stream of words drawn
+    from the corpus. The corpus is a word-frequency list, with one `word [count]` per line (the count
+    defaults to 1); the stream contains `--tokens` words, sampled according to those counts with a fixed
+    seed, so that consecutive runs shape exactly the same text.
+
+    Each font is measured twice over the same stream: "cold", on a freshly-loaded font (so this includes
+    lazily parsing the GSUB/GPOS tables and filling the shaping cache), and "warm", immediately afterwards
+    on the same font. The results are printed as JSON on stdout.
+
+    With `--linebreak`, line breaking is measured instead of shaping: for each font, the stream is split
+    into paragraphs of `--paragraph-words` words (default 5000) separated by spaces, and each paragraph is
+    broken into lines of `--line-width` mm (default 150) twice; once with `layout::linebreak::breakLines`,
+    and once with a shortest-path search (`util::dijkstra_shortest_path`) over the same cost model, which
+    is how the line breaker used to work. No microtype configs are loaded, so there is no protrusion.
+*/
+
+namespace
+{
+	std::atomic<size_t> g_alloc_count = 0;
+	std::atomic<size_t> g_alloc_bytes = 0;
+
+	struct AllocCounts
+	{
+		size_t count;
+		size_t bytes;
+
+		static AllocCounts now() { return { g_alloc_count.load(), g_alloc_bytes.load() }; }
+		AllocCounts operator-(const AllocCounts& other) const { return { count - other.count, bytes - other.bytes }; }
+	};
+}
+
+void* operator new(size_t size)
+{
+	g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+	g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	if(auto ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr)
+		return ptr;
+
+	std::abort();
+}
+
+void* operator new(size_t size, std::align_val_t align)
+{
+	g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+	g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	auto alignment = static_cast<size_t>(align);
+	if(auto ptr = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1)); ptr != nullptr)
+		return ptr;
+
+	std::abort();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+namespace sap
+{
+	// normally defined in main.cpp
+	stdfs::path getInvocationCWD()
+	{
+		return stdfs::current_path();
+	}
+}
+
+namespace bench
+{
+	struct Corpus
+	{
+		std::vector<std::u32string> words;
+		std::vector<size_t> stream;
+	};
+
+	struct RunResult
+	{
+		double seconds;
+		size_t words;
+		size_t glyphs;
+
+		pdf::ShapingCache::Stats cache;
+		AllocCounts allocs;
+	};
+
+	static std::optional<Corpus> load_corpus(const std::string& path, size_t num_tokens, uint32_t seed)
+	{
+		auto file = util::readEntireFile(path);
+		auto contents = zst::str_view(reinterpret_cast<const char*>(file.get()), file.size());
+
+		Corpus corpus {};
+		std::vector<double> weights {};
+
+		auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+
+		while(not contents.empty())
+		{
+			auto line = contents.take_until('\n');
+			contents.remove_prefix(std::min(contents.size(), line.size() + 1));
+
+			while(not line.empty() && is_space(line[0]))
+				line.remove_prefix(1);
+
+			size_t word_len = 0;
+			while(word_len < line.size() && not is_space(line[word_len]))
+				word_len++;
+
+			if(word_len == 0)
+				continue;
+
+			auto word = line.take(word_len);
+			auto count = line.size() > word_len ? std::strtod(line.drop(word_len).str().c_str(), nullptr) : 1.0;
+
+			corpus.words.push_back(unicode::u32StringFromUtf8(word.sv()));
+			weights.push_back(std::max(count, 0.0));
+		}
+
+		if(corpus.words.empty())
+			return std::nullopt;
+
+		auto rng = std::mt19937(seed);
+		auto dist = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+
+		corpus.stream.reserve(num_tokens);
+		for(size_t i = 0; i < num_tokens; i++)
+			corpus.stream.push_back(dist(rng));
+
+		return corpus;
+	}
+
+	static pdf::ShapingCache::Stats operator-(const pdf::ShapingCache::Stats& a, const pdf::ShapingCache::Stats& b)
+	{
+		return pdf::ShapingCache::Stats {
+			.hits = a.hits - b.hits,
+			.misses = a.misses - b.misses,
+			.evictions = a.evictions - b.evictions,
+			.entries = a.entries,
+			.bytes = a.bytes,
+		};
+	}
+
+	static volatile double g_sink = 0;
+
+	static RunResult run_stream(const pdf::PdfFont& font, const Corpus& corpus, pdf::PdfScalar font_size)
+	{
+		const auto cache_before = font.shapingCacheStats();
+		const auto allocs_before = AllocCounts::now();
+		const auto start = std::chrono::steady_clock::now();
+
+		size_t glyphs = 0;
+		double total_width = 0;
+
+		for(auto idx : corpus.stream)
+		{
+			auto& word = corpus.words[idx];
+			glyphs += font.getGlyphInfosForString(word, font::DEFAULT_FEATURE_SET)->size();
+			total_width += font.getWordSize(word, font_size, font::DEFAULT_FEATURE_SET).x().value();
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		// make sure the compiler can't get rid of the loop.
+		g_sink = total_width;
+
+		return RunResult {
+			.seconds = std::chrono::duration<double>(end - start).count(),
+			.words = corpus.stream.size(),
+			.glyphs = glyphs,
+			.cache = font.shapingCacheStats() - cache_before,
+			.allocs = AllocCounts::now() - allocs_before,
+		};
+	}
+
+	static std::string result_to_json(const RunResult& r)
+	{
+		auto lookups = r.cache.hits + r.cache.misses;
+		auto hit_rate = lookups == 0 ? 0.0 : static_cast<double>(r.cache.hits) / static_cast<double>(lookups);
+
+		return zpr::sprint("{{ \"seconds\": {.6f}, \"words\": {}, \"glyphs\": {}, \"words_per_sec\": {.1f}, "
+		                   "\"glyphs_per_sec\": {.1f}, \"cache_hits\": {}, \"cache_misses\": {}, "
+		                   "\"cache_hit_rate\": {.4f}, \"cache_evictions\": {}, \"cache_entries\": {}, "
+		                   "\"cache_bytes\": {}, \"allocations\": {}, \"allocated_bytes\": {} }}",
+		    r.seconds, r.words, r.glyphs, static_cast<double>(r.words) / r.seconds,
+		    static_cast<double>(r.glyphs) / r.seconds, r.cache.hits, r.cache.misses, hit_rate, r.cache.evictions,
+		    r.cache.entries, r.cache.bytes, r.allocs.count, r.allocs.bytes);
+	}
+
+	struct LineBreakResult
+	{
+		double seconds;
+		size_t paragraphs;
+		size_t lines;
+		std::vector<size_t> line_parts;
+	};
+
+	using InlineObjVec = std::vector<zst::SharedPtr<sap::tree::InlineObject>>;
+
+	/*
+	    The line breaker as it used to be: a node is a breakpoint, and its neighbours are all the breakpoints
+	    that a line starting there could end at. Every edge carries its own copy of the line.
+	*/
+	struct DijkstraLineBreakNode
+	{
+		using Distance = double;
+		using LineCandidate = sap::layout::linebreak::LineCandidate;
+
+		sap::interp::Interpreter* cs;
+		const sap::Style* parent_style;
+		const InlineObjVec* contents;
+		const sap::layout::linebreak::ParagraphWidths* widths;
+		sap::Length preferred_line_length;
+
+		size_t position;
+		std::optional<sap::layout::linebreak::BrokenLine> line;
+
+		std::vector<std::pair<DijkstraLineBreakNode, Distance>> neighbours() const
+		{
+			std::vector<std::pair<DijkstraLineBreakNode, Distance>> ret {};
+
+			auto candidate = LineCandidate(cs, *parent_style, *contents, *widths, position, preferred_line_length);
+			while(not candidate.finished())
+			{
+				if(auto brk = candidate.advance(); brk.has_value())
+				{
+					auto node = *this;
+					node.position = brk->end;
+					node.line = candidate.line();
+
+					ret.emplace_back(std::move(node), brk->cost);
+				}
+			}
+
+			return ret;
+		}
+
+		size_t hash() const { return position; }
+		bool operator==(const DijkstraLineBreakNode& other) const { return position == other.position; }
+	};
+
+	static std::vector<sap::layout::linebreak::BrokenLine> break_lines_with_dijkstra(sap::interp::Interpreter* cs,
+	    const sap::Style& parent_style,
+	    const InlineObjVec& contents,
+	    const sap::layout::linebreak::ParagraphWidths& widths,
+	    sap::Length preferred_line_length)
+	{
+		auto start = DijkstraLineBreakNode {
+			.cs = cs,
+			.parent_style = &parent_style,
+			.contents = &contents,
+			.widths = &widths,
+			.preferred_line_length = preferred_line_length,
+			.position = 0,
+			.line = std::nullopt,
+		};
+
+		auto end = start;
+		end.position = contents.size();
+
+		std::vector<sap::layout::linebreak::BrokenLine> ret {};
+		for(auto& node : util::dijkstra_shortest_path(start, end))
+			ret.push_back(std::move(*node.line));
+
+		return ret;
+	}
+
+	template <typename BreakFn>
+	static LineBreakResult run_linebreak(sap::interp::Interpreter* cs,
+	    const sap::Style& style,
+	    const std::vector<InlineObjVec>& paragraphs,
+	    sap::Length line_width,
+	    BreakFn&& break_fn)
+	{
+		LineBreakResult result {};
+		result.paragraphs = paragraphs.size();
+
+		const auto start = std::chrono::steady_clock::now();
+		for(auto& para : paragraphs)
+		{
+			auto widths = sap::layout::linebreak::ParagraphWidths(style, para);
+			for(auto& line : break_fn(cs, style, para, widths, line_width))
+				result.line_parts.push_back(line.numParts());
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		result.seconds = std::chrono::duration<double>(end - start).count();
+		result.lines = result.line_parts.size();
+		return result;
+	}
+
+	static std::string linebreak_result_to_json(const LineBreakResult& r)
+	{
+		return zpr::sprint("{{ \"seconds\": {.6f}, \"paragraphs\": {}, \"lines\": {}, \"paragraphs_per_sec\": {.2f} }}",
+		    r.seconds, r.paragraphs, r.lines, static_cast<double>(r.paragraphs) / r.seconds);
+	}
+
+	static std::string json_escape(const std::string& s)
+	{
+		std::string ret {};
+		for(char c : s)
+		{
+			if(c == '"' || c == '\\')
+				ret += '\\';
+
+			ret += c;
+		}
+		return ret;
+	}
+
+	static std::vector<stdfs::path> find_fonts(const stdfs::path& dir)
+	{
+		std::vector<stdfs::path> ret {};
+		for(auto& ent : stdfs::directory_iterator(dir))
+		{
+			if(not ent.is_regular_file())
+				continue;
+
+			auto ext = ent.path().extension().string();
+			std::transform(ext.begin(), ext.end(), ext.begin(),
+			    [](char c) { return static_cast<char>(std::tolower(c)); });
+
+			if(ext == ".otf" || ext == ".ttf")
+				ret.push_back(ent.path());
+		}
+
+		std::sort(ret.begin(), ret.end());
+		return ret;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	auto args = zarg::Parser()
+	                .add_option("tokens", true, "number of words to shape per run (default: 200000)")
+	                .add_option("font-size", true, "font size in points (default: 10)")
+	                .add_option("seed", true, "seed for sampling the corpus (default: 1)")
+	                .add_option("linebreak", false, "measure line breaking instead of shaping")
+	                .add_option("paragraph-words", true, "words per paragraph for --linebreak (default: 5000)")
+	                .add_option("line-width", true, "line width in mm for --linebreak (default: 150)")
+	                .allow_options_after_positionals(true)
+	                .parse(argc, argv)
+	                .set();
+
+	if(args.positional.size() != 2)
+	{
+		zpr::fprintln(stderr, "usage: sap-bench [--tokens N] [--font-size PT] [--seed S] [--linebreak "
+		                      "[--paragraph-words N] [--line-width MM]] <font dir> <corpus>");
+		return 1;
+	}
+
+	auto get_option = [&args](const char* name, const char* default_value) -> std::string {
+		return args.options[name].value.value_or(default_value);
+	};
+
+	const auto num_tokens = std::strtoull(get_option("tokens", "200000").c_str(), nullptr, 10);
+	const auto font_size = pdf::PdfScalar(std::strtod(get_option("font-size", "10").c_str(), nullptr));
+	const auto seed = static_cast<uint32_t>(std::strtoul(get_option("seed", "1").c_str(), nullptr, 10));
+
+	const bool measure_linebreak = args.options.contains("linebreak");
+	const auto paragraph_words = std::max(size_t(1),
+	    static_cast<size_t>(std::strtoull(get_option("paragraph-words", "5000").c_str(), nullptr, 10)));
+	const auto line_width = sap::Length(std::strtod(get_option("line-width", "150").c_str(), nullptr));
+
+	const auto font_dir = stdfs::path(args.positional[0]);
+	if(not stdfs::is_directory(font_dir))
+	{
+		zpr::fprintln(stderr, "'{}' is not a directory", font_dir.string());
+		return 1;
+	}
+
+	auto corpus = bench::load_corpus(args.positional[1], num_tokens, seed);
+	if(not corpus.has_value())
+	{
+		zpr::fprintln(stderr, "corpus '{}' contains no words", args.positional[1]);
+		return 1;
+	}
+
+	auto font_paths = bench::find_fonts(font_dir);
+	if(font_paths.empty())
+	{
+		zpr::fprintln(stderr, "no fonts found in '{}'", font_dir.string());
+		return 1;
+	}
+
+	std::string results {};
+	for(auto& path : font_paths)
+	{
+		auto handle = font::FontHandle { .path = path };
+
+		auto font_file = font::FontFile::fromHandle(handle);
+		if(not font_file.has_value())
+		{
+			zpr::fprintln(stderr, "failed to load font '{}'", path.string());
+			continue;
+		}
+
+		auto font_name = (*font_file)->name();
+		auto font = pdf::PdfFont::fromSource(std::move(*font_file));
+
+		if(measure_linebreak)
+		{
+			auto cs = sap::interp::Interpreter();
+
+			auto style = sap::Style();
+			style.set_font_family(sap::FontFamily(font.get(), font.get(), font.get(), font.get()))
+			    .set_font_style(sap::FontStyle::Regular)
+			    .set_font_features(font::DEFAULT_FEATURE_SET)
+			    .set_font_size(font_size.into())
+			    .set_root_font_size(font_size.into())
+			    .set_line_spacing(1.0)
+			    .set_sentence_space_stretch(1.5);
+
+			std::vector<bench::InlineObjVec> paragraphs {};
+			for(size_t i = 0; i < corpus->stream.size(); i++)
+			{
+				if(i % paragraph_words == 0)
+					paragraphs.emplace_back();
+				else
+					paragraphs.back().push_back(zst::make_shared<sap::tree::Separator>(sap::tree::Separator::SPACE));
+
+				paragraphs.back().push_back(zst::make_shared<sap::tree::Text>(corpus->words[corpus->stream[i]]));
+			}
+
+			auto active_list = bench::run_linebreak(&cs, style, paragraphs, line_width,
+			    sap::layout::linebreak::breakLines);
+			auto dijkstra = bench::run_linebreak(&cs, style, paragraphs, line_width,
+			    bench::break_lines_with_dijkstra);
+
+			if(not results.empty())
+				results += ",\n";
+
+			results += zpr::sprint("    {{ \"font\": \"{}\", \"file\": \"{}\", \"same_breaks\": {},\n      "
+			                       "\"active_list\": {},\n      \"dijkstra\": {} }}",
+			    bench::json_escape(font_name), bench::json_escape(path.filename().string()),
+			    active_list.line_parts == dijkstra.line_parts, bench::linebreak_result_to_json(active_list),
+			    bench::linebreak_result_to_json(dijkstra));
+
+			continue;
+		}
+
+		auto cold = bench::run_stream(*font, *corpus, font_size);
+		auto warm = bench::run_stream(*font, *corpus, font_size);
+
+		if(not results.empty())
+			results += ",\n";
+
+		results += (zpr::sprint("    {{ \"font\": \"{}\", \"file\": \"{}\",\n      \"cold\": {},\n      "
+		                              "\"warm\": {} }}",
+		    bench::json_escape(font_name), bench::json_escape(path.filename().string()),
+		    bench::result_to_json(cold), bench::result_to_json(warm)));
+	}
+
+	zpr::println("{{\n  \"tokens\": {}, \"distinct_words\": {}, \"font_size\": {},\n  \"fonts\": [\n{}\n  ]\n}}",
+	    corpus->stream.size(), corpus->words.size(), font_size.value(), results);
+}
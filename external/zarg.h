@@ -75,6 +75,9 @@ namespace zarg
 		Parser& add_option(std::string long_opt, bool needs_value, std::string description = "");
 		Parser& add_option(char short_opt, std::string long_opt, bool needs_value, std::string description = "");
 
+		// a long option that may be given a value with '=' (eg. `--opt=value`), but does not need one.
+		Parser& add_option_with_optional_value(std::string long_opt, std::string description = "");
+
 		Parser& allow_options_after_positionals(bool x = true);
 		Parser& ignore_unknown_flags(bool x = true);
 
@@ -86,6 +89,7 @@ namespace zarg
 
 			bool needs_value;
 			bool is_flag;
+			bool optional_value = false;
 
 			std::string description;
 		};
@@ -325,13 +329,13 @@ namespace zarg
 					}
 					else
 					{
-						if(not option_value.empty())
+						if(not option_value.empty() && not opt.optional_value)
 							error_and_exit("option '--%s' does not accept a value\n", option_name.c_str());
 
 						ret.options.push_back(Arg {
 						    .short_name = opt.flag_or_short_opt,
 						    .long_name = std::move(option_name),
-						    .value = std::nullopt,
+						    .value = option_value.empty() ? std::nullopt : std::optional(std::string(option_value)),
 						});
 					}
 				}
@@ -447,5 +451,13 @@ namespace zarg
 
 		return *this;
 	}
+
+	Parser& Parser::add_option_with_optional_value(std::string long_opt, std::string description)
+	{
+		this->add_option(std::move(long_opt), /* needs_value: */ false, std::move(description));
+
+		m_all_options.back().optional_value = true;
+		return *this;
+	}
 }
 #endif
@@ -0,0 +1,55 @@
+// hyphc.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util.h"
+
+#include "misc/hyphenator.h"
+
+/*
+    The hyphenation pattern compiler.
+
+    usage: sap-hyphc <patterns> <bundle>
+
+    Reads a TeX hyphenation pattern file (with \patterns{} and, optionally, \hyphenation{}), compiles the
+    patterns, and writes the result as a bundle that sap can map and use directly (see `Hyphenator::loadBundle`),
+    instead of parsing and compiling the patterns again in every process. Bundles are native-endian, so they
+    should be made on the machine that uses them; the build does this for every pattern file in
+    `lib/sap/data/hyphenation`, putting the bundles in the same place under the build directory.
+*/
+
+namespace sap
+{
+	// normally defined in main.cpp
+	stdfs::path getInvocationCWD()
+	{
+		return stdfs::current_path();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if(argc != 3)
+	{
+		zpr::fprintln(stderr, "usage: sap-hyphc <patterns> <bundle>");
+		return 1;
+	}
+
+	auto patterns = std::string(argv[1]);
+	auto bundle = std::string(argv[2]);
+
+	if(not stdfs::is_regular_file(patterns))
+	{
+		zpr::fprintln(stderr, "'{}' does not exist", patterns);
+		return 1;
+	}
+
+	auto hyph = sap::hyph::Hyphenator::parseFromFile(patterns);
+	if(not hyph.writeBundle(bundle))
+	{
+		zpr::fprintln(stderr, "failed to write '{}': {}", bundle, strerror(errno));
+		return 1;
+	}
+
+	return 0;
+}
@@ -9,20 +9,91 @@
 
 #include "tree/document.h"
 #include "tree/container.h"
+#include "tree/paragraph.h"
 
 #include "layout/document.h"
 
+#include "font/font_file.h"
+
 #include "pdf/font.h"
 #include "pdf/writer.h"
 
+#include "misc/timings.h"
+
 namespace sap
 {
-	bool compile(zst::str_view input_file, zst::str_view output_file)
+	static bool g_print_cache_stats = false;
+	static bool g_incremental_layout = false;
+	static std::optional<bool> g_print_timings_as_json = std::nullopt;
+
+	static void print_shaping_cache_stats(const interp::Interpreter& interp)
+	{
+		for(auto& [_, font] : interp.loadedFonts())
+		{
+			auto stats = font->shapingCacheStats();
+			if(stats.hits + stats.misses == 0)
+				continue;
+
+			auto hit_rate = 100.0 * static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses);
+			sap::log("font", "shaping cache for '{}': {} hits, {} misses ({.1f}% hit rate), {} evictions, "
+			                 "{} entries ({} kB)",
+			    font->source().name(), stats.hits, stats.misses, hit_rate, stats.evictions, stats.entries,
+			    stats.bytes / 1024);
+
+			if(auto [p_hits, p_misses] = font->persistentShapingCacheStats(); p_hits + p_misses > 0)
+			{
+				sap::log("font", "persistent shaping cache for '{}': {} hits, {} misses", font->source().name(),
+				    p_hits, p_misses);
+			}
+		}
+	}
+
+	static void set_timing_counters(const interp::Interpreter& interp, const layout::Document& layout_doc)
+	{
+		using namespace util::timings;
+		setCounter("pages", layout_doc.pageLayout().pageCount());
+
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t persistent_hits = 0;
+		for(auto& [_, font] : interp.loadedFonts())
+		{
+			auto stats = font->shapingCacheStats();
+			hits += stats.hits;
+			misses += stats.misses;
+			persistent_hits += font->persistentShapingCacheStats().first;
+		}
+
+		// every word that is measured goes through the shaping cache; only the misses are actually shaped.
+		setCounter("words measured", hits + misses);
+		setCounter("words shaped", misses - std::min(misses, persistent_hits));
+		if(hits + misses > 0)
+			setCounter("shaping cache hit rate (%)", (100 * hits + (hits + misses) / 2) / (hits + misses));
+
+		if(g_incremental_layout)
+		{
+			auto [reused, total] = tree::Paragraph::lineBreakReuseStats();
+			setCounter("paragraph line breaks reused", reused);
+		}
+	}
+
+	static bool compile_document(zst::str_view input_file, zst::str_view output_file)
 	{
+		// everything from the last compile (in watch mode) is gone by now, including the fonts its styles use.
+		Style::forgetInternedStyles();
+
+		if(g_incremental_layout)
+			tree::Paragraph::startNewCompile();
+
 		auto interp = interp::Interpreter();
-		auto file = interp.loadFile(input_file);
 
-		auto document = frontend::parse(input_file, file.chars());
+		auto document = [&]() {
+			auto _ = util::timings::Phase("parse");
+
+			auto file = interp.loadFile(input_file);
+			return frontend::parse(input_file, file.chars());
+		}();
+
 		if(document.is_err())
 			return document.error().display(), false;
 
@@ -37,7 +108,12 @@ namespace sap
 			return true;
 		}
 
-		// load microtype configs
+		// load microtype configs; like everything else in the library, a config in an earlier search path
+		// overrides one with the same name in a later one.
+		auto microtype_phase = std::optional<util::timings::Phase>();
+		microtype_phase.emplace("load microtype configs");
+
+		util::hashset<std::string> loaded_cfgs {};
 		for(auto& lib_path : paths::librarySearchPaths())
 		{
 			auto tmp = stdfs::path(lib_path) / "data" / "microtype";
@@ -49,6 +125,9 @@ namespace sap
 				if(not de.is_regular_file() || de.path().extension() != ".cfg")
 					continue;
 
+				if(not loaded_cfgs.insert(de.path().filename().string()).second)
+					continue;
+
 				util::log("loading microtype cfg '{}'", de.path().filename().string());
 
 				auto cfg = interp.loadFile(de.path().string()).chars();
@@ -68,19 +147,55 @@ namespace sap
 			}
 		}
 
+		microtype_phase.reset();
+
 		auto layout_doc = document.unwrap().layout(&interp);
 		if(layout_doc.is_err())
 			return layout_doc.error().display(), false;
 
+		if(g_incremental_layout)
+		{
+			auto [reused, total] = tree::Paragraph::lineBreakReuseStats();
+			util::log("reused line breaks for {} of {} paragraphs", reused, total);
+		}
+
 		interp.setCurrentPhase(ProcessingPhase::Render);
 
 		auto writer = pdf::Writer(output_file);
 		layout_doc.unwrap()->write(&writer);
 		writer.close();
 
+		{
+			auto _ = util::timings::Phase("save shaping caches");
+			for(auto& [_, font] : interp.loadedFonts())
+				font->savePersistentShapingCaches();
+		}
+
+		if(g_print_cache_stats)
+			print_shaping_cache_stats(interp);
+
+		set_timing_counters(interp, *layout_doc.unwrap());
+		util::timings::setCounter("bytes written", writer.bytes_written);
+
 		return true;
 	}
 
+	bool compile(zst::str_view input_file, zst::str_view output_file)
+	{
+		util::timings::reset();
+
+		bool ok = false;
+		{
+			auto _ = util::timings::Phase("compile");
+			ok = compile_document(input_file, output_file);
+		}
+
+		if(g_print_timings_as_json.has_value())
+			zpr::print("{}", util::timings::report(*g_print_timings_as_json));
+
+		return ok;
+	}
+
 	static bool g_draft_mode = false;
 	bool isDraftMode()
 	{
@@ -91,4 +206,31 @@ namespace sap
 	{
 		g_draft_mode = draft;
 	}
+
+	void set_print_cache_stats(bool print)
+	{
+		g_print_cache_stats = print;
+	}
+
+	void set_print_timings(std::optional<bool> as_json)
+	{
+		g_print_timings_as_json = as_json;
+		util::timings::setEnabled(as_json.has_value());
+	}
+
+	void set_incremental_layout(bool incremental)
+	{
+		g_incremental_layout = incremental;
+		tree::Paragraph::setKeepLineBreaksAcrossCompiles(incremental);
+	}
+
+	void set_shaping_cache_dir(std::optional<std::string> dir)
+	{
+		pdf::PersistentShapingCache::setDirectory(std::move(dir));
+	}
+
+	void set_subset_cff_fonts(bool subset)
+	{
+		font::FontFile::setSubsetCFFFonts(subset);
+	}
 }
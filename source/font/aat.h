@@ -34,12 +34,119 @@ namespace font::aat
 		constexpr bool operator!=(Feature f) const { return !(*this == f); }
 	};
 
+	/*
+	    A mapping from glyphs to values, built once when the table is parsed. If the glyphs are close enough
+	    together, this is a flat array indexed by glyph id (offset by the first glyph); otherwise, it is a
+	    sorted list of runs of consecutive glyphs (with their values stored contiguously), which is binary
+	    searched.
+	*/
+	template <typename T>
+	struct GlyphMap
+	{
+		std::optional<T> get(GlyphId glyph) const
+		{
+			auto gid = static_cast<uint32_t>(glyph);
+			if(not m_runs.empty())
+			{
+				auto it = std::upper_bound(m_runs.begin(), m_runs.end(), gid,
+				    [](uint32_t g, const Run& run) { return g < run.first; });
+
+				if(it == m_runs.begin() || gid > (--it)->last)
+					return std::nullopt;
+
+				return m_values[it->offset + (gid - it->first)];
+			}
+
+			if(gid < m_first || gid - m_first >= m_dense.size())
+				return std::nullopt;
+
+			return m_dense[gid - m_first];
+		}
+
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+
+		// if a glyph appears more than once, the last one wins
+		static GlyphMap build(std::vector<std::pair<GlyphId, T>> entries)
+		{
+			std::stable_sort(entries.begin(), entries.end(),
+			    [](const auto& a, const auto& b) { return a.first < b.first; });
+
+			std::vector<std::pair<GlyphId, T>> unique {};
+			unique.reserve(entries.size());
+
+			for(auto& e : entries)
+			{
+				if(not unique.empty() && unique.back().first == e.first)
+					unique.back().second = e.second;
+				else
+					unique.push_back(e);
+			}
+
+			GlyphMap ret {};
+			ret.m_size = unique.size();
+			if(unique.empty())
+				return ret;
+
+			auto first = static_cast<uint32_t>(unique.front().first);
+			auto span = static_cast<uint32_t>(unique.back().first) - first + 1;
+
+			if(span <= std::max(size_t(64), 4 * unique.size()))
+			{
+				ret.m_first = first;
+				ret.m_dense.resize(span);
+				for(auto& [gid, value] : unique)
+					ret.m_dense[static_cast<uint32_t>(gid) - first] = value;
+			}
+			else
+			{
+				ret.m_values.reserve(unique.size());
+				for(auto& [gid, value] : unique)
+				{
+					auto g = static_cast<uint32_t>(gid);
+					if(ret.m_runs.empty() || ret.m_runs.back().last + 1 != g)
+					{
+						ret.m_runs.push_back(Run {
+						    .first = g,
+						    .last = g,
+						    .offset = static_cast<uint32_t>(ret.m_values.size()),
+						});
+					}
+					else
+					{
+						ret.m_runs.back().last = g;
+					}
+
+					ret.m_values.push_back(value);
+				}
+			}
+
+			return ret;
+		}
+
+	private:
+		struct Run
+		{
+			uint32_t first;
+			uint32_t last;
+			uint32_t offset;
+		};
+
+		size_t m_size = 0;
+
+		uint32_t m_first = 0;
+		std::vector<std::optional<T>> m_dense {};
+
+		std::vector<Run> m_runs {};
+		std::vector<T> m_values {};
+	};
+
 	/*
 	    lookup tables
 	*/
 	struct Lookup
 	{
-		util::hashmap<GlyphId, uint64_t> map;
+		GlyphMap<uint64_t> map;
 	};
 
 	std::optional<Lookup> parseLookupTable(zst::byte_span buf, size_t num_font_glyphs);
@@ -51,7 +158,7 @@ namespace font::aat
 	struct StateTable
 	{
 		size_t num_classes;
-		util::hashmap<GlyphId, uint16_t> glyph_classes;
+		GlyphMap<uint16_t> glyph_classes;
 
 		zst::byte_span state_array;
 		size_t state_row_size;
@@ -102,8 +209,8 @@ namespace font::aat
 	{
 		KernSubTableCoverage coverage;
 
-		util::hashmap<GlyphId, uint16_t> left_glyph_classes;
-		util::hashmap<GlyphId, uint16_t> right_glyph_classes;
+		GlyphMap<uint16_t> left_glyph_classes;
+		GlyphMap<uint16_t> right_glyph_classes;
 
 		zst::byte_span lookup_array;
 	};
@@ -122,7 +229,7 @@ namespace font::aat
 		std::vector<KernSubTable3> subtables_f3;
 	};
 
-	util::hashmap<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const KernTable& font,
+	std::vector<GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const KernTable& font,
 	    zst::span<GlyphId> glyphs,
 	    const FeatureSet& features);
 
@@ -159,6 +266,9 @@ namespace font::aat
 		StateTable state_table;
 
 		zst::byte_span substitution_tables;
+
+		// keyed by the index of the substitution table; compiled the first time each one is used
+		mutable util::hashmap<uint16_t, Lookup> compiled_substitutions {};
 	};
 
 	struct MorxLigatureSubtable
@@ -175,7 +285,7 @@ namespace font::aat
 	{
 		MorxSubtableCommon common;
 
-		zst::byte_span lookup;
+		Lookup lookup;
 	};
 
 	struct MorxInsertionSubtable
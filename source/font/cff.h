@@ -106,7 +106,16 @@ namespace font::cff
 	struct Subroutine
 	{
 		zst::byte_span charstring {};
-		bool used = false;
+	};
+
+	/*
+	    The subroutines that a glyph's charstring calls, directly or indirectly, as indices into
+	    the global subrs and the local subrs of its Font DICT. Both lists are sorted, without duplicates.
+	*/
+	struct SubrClosure
+	{
+		std::vector<uint32_t> global_subrs;
+		std::vector<uint32_t> local_subrs;
 	};
 
 
@@ -129,6 +138,14 @@ namespace font::cff
 		std::vector<Subroutine> local_subrs {};
 	};
 
+	struct CFFSubset
+	{
+		zst::byte_buffer cff;
+		zst::byte_buffer cmap;
+	};
+
+	struct SubsetState;
+
 	/*
 	    Note: this in-memory representation is only suitable for CFF fonts embedded in OTF files,
 	    and *NOT* for general-purpose CFF files.
@@ -163,6 +180,9 @@ namespace font::cff
 		// one FD in here, referencing the top-level Private and local_subrs data.
 		std::vector<FontDict> font_dicts {};
 
+		// the subsetting state for this CFF data; shared between every CFFData with the same bytes (see subset.cpp).
+		std::shared_ptr<SubsetState> subset_state {};
+
 		uint16_t get_or_add_string(zst::str_view str);
 		zst::str_view get_string(uint16_t sid) const;
 	};
@@ -233,21 +253,15 @@ namespace font::cff
 	std::map<uint16_t, uint16_t> getPredefinedCharset(int num);
 
 	/*
-	    Interpret the given charstring, and mark any used subroutines.
+	    Interpret the given charstring, and return the subroutines that it uses.
 	*/
-	void interpretCharStringAndMarkSubrs(zst::byte_span charstring,
-	    std::vector<Subroutine>& global_subrs,
-	    std::vector<Subroutine>& local_subrs);
+	SubrClosure computeSubrClosure(zst::byte_span charstring,
+	    const std::vector<Subroutine>& global_subrs,
+	    const std::vector<Subroutine>& local_subrs);
 }
 
 namespace font::cff
 {
-	struct CFFSubset
-	{
-		zst::byte_buffer cff;
-		zst::byte_buffer cmap;
-	};
-
 	/*
 	    Build an INDEX by appending the following data items.
 	*/
@@ -79,7 +79,6 @@ namespace font::cff
 
 			Subroutine subr {};
 			subr.charstring = data;
-			subr.used = false;
 			subrs.push_back(std::move(subr));
 		}
 		return subrs;
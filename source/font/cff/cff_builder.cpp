@@ -77,23 +77,24 @@ namespace font::cff
 			}
 			else if(!force_4byte && 108 <= foo && foo <= 1131)
 			{
-				buf.append(static_cast<uint8_t>((foo / 256) + 247));
-				buf.append(static_cast<uint8_t>((foo % 256) - 108));
+				buf.append(static_cast<uint8_t>(((foo - 108) / 256) + 247));
+				buf.append(static_cast<uint8_t>((foo - 108) % 256));
 			}
 			else if(!force_4byte && -1131 <= foo && foo <= -108)
 			{
-				buf.append(static_cast<uint8_t>((-foo / 256) + 251));
-				buf.append(static_cast<uint8_t>((-foo % 256) - 108));
+				buf.append(static_cast<uint8_t>(((-foo - 108) / 256) + 251));
+				buf.append(static_cast<uint8_t>((-foo - 108) % 256));
 			}
 			else if(!force_4byte && -32768 <= foo && foo <= 32767)
 			{
+				// negative numbers are two's complement
 				buf.append(28);
-				buf.append_bytes(util::convertBEU16(util::checked_cast<uint16_t>(foo)));
+				buf.append_bytes(util::convertBEU16(static_cast<uint16_t>(static_cast<int16_t>(foo))));
 			}
 			else
 			{
 				buf.append(29);
-				buf.append_bytes(util::convertBEU32(util::checked_cast<uint32_t>(foo)));
+				buf.append_bytes(util::convertBEU32(static_cast<uint32_t>(foo)));
 			}
 		}
 		else if(op.type == Operand::TYPE_DECIMAL)
@@ -131,7 +132,7 @@ namespace font::cff
 				{
 					assert(i + 1 < tmp.size());
 					if(tmp[i + 1] == '-')
-						add_nibble(0xC);
+						add_nibble(0xC), i++;
 					else
 						add_nibble(0xB);
 				}
@@ -166,9 +167,10 @@ namespace font::cff
 		}
 		else if(op.type == Operand::TYPE_DECIMAL)
 		{
-			// let's just do it the 3head way.
-			auto tmp = zpr::sprint("{}", op._decimal).size();
-			return 2 + (tmp / 2);
+			// the exponent sign doesn't take a nibble of its own, so just write it out.
+			zst::byte_buffer tmp {};
+			write_operand(op, tmp);
+			return tmp.size();
 		}
 		return 0;
 	}
@@ -238,7 +240,9 @@ namespace font::cff
 		size_t total_size = 0;
 		for(auto& [key, values] : m_values)
 		{
-			if(auto def = getDefaultValueForDictKey(key); def.has_value() && def == values)
+			// offsets are always written, so that a placeholder of 0 (the default for charset) still reserves space.
+			auto def = getDefaultValueForDictKey(key);
+			if(not is_absolute_offset_key(key) && def.has_value() && def == values)
 				continue;
 
 			if(static_cast<uint16_t>(key) >= 0x0C00)
@@ -257,7 +261,8 @@ namespace font::cff
 		auto write_key_value = [&](DictKey key) {
 			if(auto it = m_values.find(key); it != m_values.end())
 			{
-				if(auto def = getDefaultValueForDictKey(key); def.has_value() && def == it->second)
+				auto def = getDefaultValueForDictKey(key);
+				if(not is_absolute_offset_key(key) && def.has_value() && def == it->second)
 					return;
 
 				for(auto& value : it->second)
@@ -66,6 +66,9 @@ namespace font::cff
 		int num_vstems = 0;
 		bool in_header = false;
 
+		// the subrs called so far (possibly with duplicates)
+		SubrClosure subrs {};
+
 		inline void ensure(size_t n)
 		{
 			if(stack.size() < n)
@@ -91,8 +94,8 @@ namespace font::cff
 	};
 
 	static bool run_charstring(zst::byte_span instrs,
-	    std::vector<Subroutine>& global_subrs,
-	    std::vector<Subroutine>& local_subrs,
+	    const std::vector<Subroutine>& global_subrs,
+	    const std::vector<Subroutine>& local_subrs,
 	    InterpState& interp)
 	{
 		auto calculate_bias = [](const std::vector<Subroutine>& subrs) {
@@ -161,7 +164,7 @@ namespace font::cff
 							    local_subrs.size());
 
 						subr_cs = local_subrs[util::checked_cast<size_t>(subr_num)].charstring;
-						local_subrs[util::checked_cast<size_t>(subr_num)].used = true;
+						interp.subrs.local_subrs.push_back(util::checked_cast<uint32_t>(subr_num));
 					}
 					else
 					{
@@ -171,7 +174,7 @@ namespace font::cff
 							    global_subrs.size());
 
 						subr_cs = global_subrs[util::checked_cast<size_t>(subr_num)].charstring;
-						global_subrs[util::checked_cast<size_t>(subr_num)].used = true;
+						interp.subrs.global_subrs.push_back(util::checked_cast<uint32_t>(subr_num));
 					}
 
 					auto finish = run_charstring(subr_cs, global_subrs, local_subrs, interp);
@@ -347,11 +350,22 @@ namespace font::cff
 		return true;
 	}
 
-	void interpretCharStringAndMarkSubrs(zst::byte_span instrs,
-	    std::vector<Subroutine>& global_subrs,
-	    std::vector<Subroutine>& local_subrs)
+	SubrClosure computeSubrClosure(zst::byte_span instrs,
+	    const std::vector<Subroutine>& global_subrs,
+	    const std::vector<Subroutine>& local_subrs)
 	{
 		InterpState interp {};
 		run_charstring(instrs, global_subrs, local_subrs, interp);
+
+		auto sort_and_dedup = [](std::vector<uint32_t>& xs) {
+			std::sort(xs.begin(), xs.end());
+			xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+			xs.shrink_to_fit();
+		};
+
+		sort_and_dedup(interp.subrs.global_subrs);
+		sort_and_dedup(interp.subrs.local_subrs);
+
+		return std::move(interp.subrs);
 	}
 }
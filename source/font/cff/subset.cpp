@@ -2,6 +2,8 @@
 // Copyright (c) 2022, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
+
 #include "util.h"
 #include "types.h"
 
@@ -11,89 +13,210 @@
 
 namespace font::cff
 {
-	static void write_charset_table(CFFData* cff, zst::byte_buffer& buffer, const util::hashset<GlyphId>& used_glyphs)
+	static size_t get_index_offset_size(size_t data_size)
 	{
-		// format 0
-		buffer.append(0);
+		// don't wanna support 3 byte offsets
+		if(data_size < 255)
+			return 1;
+		else if(data_size < 65535)
+			return 2;
+		else
+			return 4;
+	}
 
-		for(auto& g : cff->glyphs)
-		{
-			// don't add notdef
-			if(g.gid == 0)
-				continue;
+	static size_t get_index_table_size(size_t count, size_t data_size)
+	{
+		if(count == 0)
+			return 2;
+
+		return 2 + 1 + (count + 1) * get_index_offset_size(data_size) + data_size;
+	}
 
-			if(cff->is_cidfont)
-				buffer.append_bytes(util::convertBEU16(g.cid));
+	template <typename GetItem>
+	static size_t get_index_data_size(size_t count, GetItem&& get_item)
+	{
+		size_t data_size = 0;
+		for(size_t i = 0; i < count; i++)
+			data_size += get_item(i).size();
+
+		return data_size;
+	}
+
+	/*
+	    Write an INDEX with `count` items (where `get_item(i)` returns the i-th one) straight into the buffer.
+	    Unlike IndexTableBuilder, the items are not first copied into a separate data buffer.
+	*/
+	template <typename GetItem>
+	static void write_index_table(zst::byte_buffer& buf, size_t count, GetItem&& get_item)
+	{
+		if(count > 65535)
+			sap::error("font/cff", "too many entries in CFF INDEX");
+
+		buf.append_bytes(util::convertBEU16(static_cast<uint16_t>(count)));
+		if(count == 0)
+			return;
+
+		const auto off_size = get_index_offset_size(get_index_data_size(count, get_item));
+		buf.append(static_cast<uint8_t>(off_size));
+
+		auto write_offset = [&off_size, &buf](uint32_t offset) {
+			if(off_size == 1)
+				buf.append_bytes(static_cast<uint8_t>(offset));
+			else if(off_size == 2)
+				buf.append_bytes(util::convertBEU16(static_cast<uint16_t>(offset)));
 			else
-				buffer.append_bytes(util::convertBEU16(g.gid));
+				buf.append_bytes(util::convertBEU32(offset));
+		};
+
+		// the offsets are biased by 1 (so the first entry has an offset of 1, not 0)
+		uint32_t offset = 1;
+		write_offset(offset);
+
+		for(size_t i = 0; i < count; i++)
+		{
+			offset += util::checked_cast<uint32_t>(get_item(i).size());
+			write_offset(offset);
 		}
+
+		for(size_t i = 0; i < count; i++)
+			buf.append(get_item(i));
 	}
 
-	static void perform_glyph_pruning(CFFData* cff, const util::hashset<GlyphId>& used_glyphs)
+	/*
+	    Subsetting state that outlives the CFFData it was made for. In watch mode every compile loads its fonts
+	    afresh, so anything kept on the CFFData itself is thrown away between compiles; instead, this is shared
+	    between all CFFData with the same bytes, and a small registry keeps the most recently used ones alive.
+	*/
+	struct SubsetState
 	{
-		std::set<uint8_t> used_font_dicts {};
+		std::mutex mutex {};
 
-		auto foo = std::remove_if(cff->glyphs.begin(), cff->glyphs.end(), [&](auto& glyph) -> bool {
-			if(!cff->is_cidfont)
-			{
-				// for non-CID fonts, the glyph we get from sap/pdf is already the gid.
-				return glyph.gid != 0 && used_glyphs.find(GlyphId { glyph.gid }) == used_glyphs.end();
-			}
-			else
-			{
-				/*
-				    for CID fonts, see PDF 1.7, 9.7.4.2 Glyph Selection in CIDFonts:
+		// the index into `glyphs` for each glyph id (or for CID fonts, each CID); -1 if there is no such glyph.
+		std::vector<int32_t> glyph_index_for_id {};
 
-				    The CIDs shall be used to determine the GID value for the glyph procedure using
-				    the charset table in the CFF program. The GID value shall then be used to look up
-				    the glyph procedure using the CharStrings INDEX table.
+		// the subr closure of each glyph (indexed like `glyphs`), computed the first time the glyph is subset.
+		std::vector<std::optional<SubrClosure>> subr_closures {};
 
-				    this seems to imply that glyph ids gotten from the PDF layer are actually CIDs to
-				    the CFF font; thus, we match against CIDs instead.
-				*/
-				bool unused = glyph.gid != 0 && used_glyphs.find(GlyphId { glyph.cid }) == used_glyphs.end();
+		// the last subset that we made, the glyphs (indices into `glyphs`) that it contained, and the offsets
+		// at which its name was written. subset names are random, so only the length needs to match for reuse.
+		std::optional<CFFSubset> last_subset {};
+		std::vector<uint32_t> last_subset_glyphs {};
+		size_t last_subset_name_size = 0;
+		std::vector<size_t> last_subset_name_offsets {};
+	};
 
-				// also, mark the fontdict as used if the glyph was used.
-				if(!unused)
-					used_font_dicts.insert(glyph.font_dict_idx);
+	static std::shared_ptr<SubsetState> get_subset_state(CFFData* cff)
+	{
+		static constexpr size_t MAX_STATES = 16;
 
-				return unused;
-			}
-		});
+		static std::mutex mtx;
+		static std::vector<std::pair<uint64_t, std::shared_ptr<SubsetState>>> states; // most recently used last
 
-		cff->glyphs.erase(foo, cff->glyphs.end());
+		if(cff->subset_state != nullptr)
+			return cff->subset_state;
 
-		// if there were any unused font dicts, we can prune them
-		if(used_font_dicts.size() != cff->font_dicts.size())
+		auto hash = XXH64(cff->bytes.data(), cff->bytes.size(), 0);
+
+		auto lk = std::unique_lock(mtx);
+		auto it = std::find_if(states.begin(), states.end(), [hash](auto& x) { return x.first == hash; });
+
+		std::shared_ptr<SubsetState> state {};
+		if(it != states.end())
 		{
-			std::map<uint8_t, uint8_t> fd_mapping {};
-			std::vector<FontDict> new_font_dicts {};
+			state = std::move(it->second);
+			states.erase(it);
+		}
+		else
+		{
+			state = std::make_shared<SubsetState>();
+			if(states.size() == MAX_STATES)
+				states.erase(states.begin());
+		}
+
+		states.emplace_back(hash, state);
+		return (cff->subset_state = std::move(state));
+	}
+
+	/*
+	    Returns the indices (into `cff->glyphs`) of the glyphs to include in the subset, in ascending order.
+	    The notdef glyph is always included.
+	*/
+	static std::vector<uint32_t> get_glyphs_for_subset(CFFData* cff, SubsetState& state, const GlyphSet& used_glyphs)
+	{
+		/*
+		    for non-CID fonts, the glyph we get from sap/pdf is already the gid. for CID fonts, see
+		    PDF 1.7, 9.7.4.2 Glyph Selection in CIDFonts:
+
+		    The CIDs shall be used to determine the GID value for the glyph procedure using
+		    the charset table in the CFF program. The GID value shall then be used to look up
+		    the glyph procedure using the CharStrings INDEX table.
 
-			// use the `used_font_dicts` as a "not visited" array
+		    this seems to imply that glyph ids gotten from the PDF layer are actually CIDs to
+		    the CFF font; thus, we match against CIDs instead.
+		*/
+		auto glyph_id = [cff](const Glyph& glyph) -> uint16_t { return cff->is_cidfont ? glyph.cid : glyph.gid; };
+
+		if(state.glyph_index_for_id.empty())
+		{
+			uint16_t max_id = 0;
 			for(auto& glyph : cff->glyphs)
-			{
-				if(fd_mapping.find(glyph.font_dict_idx) == fd_mapping.end())
-				{
-					fd_mapping[glyph.font_dict_idx] = util::checked_cast<uint8_t>(new_font_dicts.size());
-					new_font_dicts.push_back(std::move(cff->font_dicts[glyph.font_dict_idx]));
-				}
+				max_id = std::max(max_id, glyph_id(glyph));
+
+			state.glyph_index_for_id.resize(size_t(max_id) + 1, -1);
+			for(size_t i = 0; i < cff->glyphs.size(); i++)
+				state.glyph_index_for_id[glyph_id(cff->glyphs[i])] = util::checked_cast<int32_t>(i);
+		}
+
+		std::vector<uint32_t> glyphs {};
+		glyphs.reserve(used_glyphs.size() + 1);
 
-				glyph.font_dict_idx = fd_mapping[glyph.font_dict_idx];
+		for(size_t i = 0; i < cff->glyphs.size(); i++)
+		{
+			if(cff->glyphs[i].gid == 0)
+			{
+				glyphs.push_back(static_cast<uint32_t>(i));
+				break;
 			}
+		}
 
-			cff->font_dicts = std::move(new_font_dicts);
+		for(auto gid : used_glyphs)
+		{
+			auto id = static_cast<uint32_t>(gid);
+			if(id >= state.glyph_index_for_id.size() || state.glyph_index_for_id[id] < 0)
+				continue;
+
+			auto idx = static_cast<uint32_t>(state.glyph_index_for_id[id]);
+			if(cff->glyphs[idx].gid != 0)
+				glyphs.push_back(idx);
 		}
 
+		// for CID fonts, the order of the CIDs need not match the order of the glyphs.
+		if(cff->is_cidfont)
+			std::sort(glyphs.begin(), glyphs.end());
+
+		return glyphs;
+	}
+
+	/*
+	    Returns the subrs used by the glyph, interpreting its charstring only the first time.
+	*/
+	static const SubrClosure& get_subr_closure(CFFData* cff, SubsetState& state, uint32_t glyph_idx)
+	{
+		if(state.subr_closures.size() != cff->glyphs.size())
+			state.subr_closures.resize(cff->glyphs.size());
 
-		// finally, interpret the charstrings of all used glyphs, and mark used subrs for elimination.
-		for(auto& glyph : cff->glyphs)
+		auto& closure = state.subr_closures[glyph_idx];
+		if(not closure.has_value())
 		{
-			interpretCharStringAndMarkSubrs(glyph.charstring, cff->global_subrs,
+			auto& glyph = cff->glyphs[glyph_idx];
+			closure = computeSubrClosure(glyph.charstring, cff->global_subrs,
 			    cff->font_dicts[glyph.font_dict_idx].local_subrs);
 		}
+
+		return *closure;
 	}
 
-	static zst::byte_buffer create_cmap_for_cff_subset(CFFData* cff)
+	static zst::byte_buffer create_cmap_for_cff_subset(CFFData* cff, const std::vector<uint32_t>& glyphs)
 	{
 		/*
 		    i guess what we want to do is just map the cid to the gid...
@@ -117,10 +240,10 @@ namespace font::cff
 		cmap.append_bytes(util::convertBEU32(util::checked_cast<uint32_t>(subtable_offset)));
 
 		std::map<uint16_t, uint16_t> mapping {};
-		for(auto& glyph : cff->glyphs)
-			mapping[glyph.gid] = glyph.cid;
+		for(auto idx : glyphs)
+			mapping[cff->glyphs[idx].gid] = cff->glyphs[idx].cid;
 
-		auto seg_count = cff->glyphs.size() + 1;
+		auto seg_count = glyphs.size() + 1;
 
 		// format 4
 		append16(cmap, 4);
@@ -166,23 +289,26 @@ namespace font::cff
 namespace font
 {
 	using namespace cff;
+
+	static bool g_subset_cff_fonts = false;
+	void FontFile::setSubsetCFFFonts(bool subset)
+	{
+		g_subset_cff_fonts = subset;
+	}
+
 	CFFSubset FontFile::createCFFSubset(zst::str_view subset_name)
 	{
 		auto& cff = m_cff_data;
 		assert(cff != nullptr);
 
-		zst::byte_buffer buffer {};
-
 		// we only support subsetting CFF1 data for now.
 
 		// TODO: CFF subsetting doesn't display properly in all PDF viewers
-		// it breaks on firefox (and apparently adobe acrobat...?)
-		if(true || cff->cff2)
+		// it breaks on firefox (and apparently adobe acrobat...?), so it is only done with --subset-cff.
+		if(cff->cff2 || not g_subset_cff_fonts)
 		{
-			buffer.append(cff->bytes);
-
 			CFFSubset ret {};
-			ret.cff = std::move(buffer);
+			ret.cff.append(cff->bytes);
 
 			auto orig_cmap_table = m_tables.at(Tag("cmap"));
 			ret.cmap.append(this->bytes().drop(orig_cmap_table.offset).take(orig_cmap_table.length));
@@ -215,22 +341,97 @@ namespace font
 		        this allows us to not need to modify the charstring data for glyphs and re-number the subrs.
 		        once the CFF is compressed, any decent compression algorithm should be able to reduce the
 		        repeated values.
+
+		    We don't modify the CFFData while doing this (the strings that we need are appended to the
+		    String INDEX of the subset only), so the font can be subset again later. The subr closure of each
+		    glyph and the last subset are kept in the shared SubsetState, so they survive recompiles in watch
+		    mode; if the glyphs are the same as last time, we reuse the last subset with the new name.
 		*/
+		auto state_ptr = get_subset_state(cff.get());
+		auto& state = *state_ptr;
+		auto state_lk = std::unique_lock(state.mutex);
 
-		// first, figure out which glyphs we don't use.
-		perform_glyph_pruning(cff.get(), m_used_glyphs);
+		// first, figure out which glyphs we use.
+		auto glyphs = get_glyphs_for_subset(cff.get(), state, m_used_glyphs);
 
+		if(state.last_subset.has_value() && state.last_subset_glyphs == glyphs
+		    && state.last_subset_name_size == subset_name.size())
+		{
+			auto ret = CFFSubset {};
+			ret.cff.append(state.last_subset->cff.span());
+			ret.cmap.append(state.last_subset->cmap.span());
 
-		// write the header
-		buffer.append(1); // major
-		buffer.append(0); // minor
-		buffer.append(4); // hdrSize
-		buffer.append(4); // offSize (for now, always 4. I don't even know what this field is used for)
+			for(auto ofs : state.last_subset_name_offsets)
+				memcpy(ret.cff.data() + ofs, subset_name.data(), subset_name.size());
 
-		// Name INDEX (there is only 1)
-		IndexTableBuilder().add(subset_name.bytes()).writeInto(buffer);
+			return ret;
+		}
+
+		// then, figure out which font dicts are used, and number them in order of first use. if they
+		// are all used, just keep the original numbering.
+		std::vector<int> fd_mapping(cff->font_dicts.size(), -1);
+		std::vector<uint8_t> used_font_dicts {};
+		if(cff->is_cidfont)
+		{
+			for(auto idx : glyphs)
+			{
+				if(auto fd = cff->glyphs[idx].font_dict_idx; fd_mapping[fd] == -1)
+				{
+					fd_mapping[fd] = static_cast<int>(used_font_dicts.size());
+					used_font_dicts.push_back(fd);
+				}
+			}
+
+			if(used_font_dicts.size() == cff->font_dicts.size())
+			{
+				for(size_t i = 0; i < cff->font_dicts.size(); i++)
+					used_font_dicts[i] = static_cast<uint8_t>(i), fd_mapping[i] = static_cast<int>(i);
+			}
+		}
+		else
+		{
+			used_font_dicts.push_back(0);
+		}
+
+		// finally, mark the subrs used by the glyphs that we're keeping.
+		std::vector<bool> used_global_subrs(cff->global_subrs.size());
+		std::vector<std::vector<bool>> used_local_subrs(cff->font_dicts.size());
+		for(auto fd : used_font_dicts)
+			used_local_subrs[fd].resize(cff->font_dicts[fd].local_subrs.size());
+
+		uint16_t max_cid = 0;
+		for(auto idx : glyphs)
+		{
+			auto& closure = get_subr_closure(cff.get(), state, idx);
+			auto& local_used = used_local_subrs[cff->glyphs[idx].font_dict_idx];
+
+			for(auto subr : closure.global_subrs)
+				used_global_subrs[subr] = true;
+
+			for(auto subr : closure.local_subrs)
+				local_used[subr] = true;
 
-		auto subset_name_sid = cff->get_or_add_string(subset_name);
+			max_cid = std::max(max_cid, cff->is_cidfont ? cff->glyphs[idx].cid : cff->glyphs[idx].gid);
+		}
+
+		// strings that the font doesn't already have go after its own strings. the subset name always goes
+		// last (even if the font has the same string), so that it is at a predictable place.
+		std::vector<zst::str_view> extra_strings {};
+		auto get_string_id = [&](zst::str_view str) -> uint16_t {
+			if(auto it = cff->known_strings.find(str.str()); it != cff->known_strings.end())
+				return it->second;
+
+			extra_strings.push_back(str);
+			return util::checked_cast<uint16_t>(NUM_STANDARD_STRINGS + cff->string_ids.size() + extra_strings.size()
+			                                    - 1);
+		};
+
+		auto registry_sid = get_string_id("Adobe");
+		auto ordering_sid = get_string_id("Identity");
+
+		extra_strings.push_back(subset_name);
+		auto subset_name_sid = util::checked_cast<uint16_t>(NUM_STANDARD_STRINGS + cff->string_ids.size()
+		                                                    + extra_strings.size() - 1);
 
 		/*
 		    Top DICT (INDEX + Data)
@@ -246,196 +447,175 @@ namespace font
 		    out (we just call computeSize()) and so it's fine. probably.
 
 		    The Private DICT only has relative offsets, so that's fine.
+
+		    Since the size of every table is known up front, we first lay out the whole file, and
+		    then write it out in one go into a buffer of the right size.
 		*/
 		auto top_dict = DictBuilder(cff->top_dict);
 		top_dict.set(DictKey::ROS,
 		    {
-		        Operand().string_id(cff->get_or_add_string("Adobe")),    // registry
-		        Operand().string_id(cff->get_or_add_string("Identity")), // ordering
-		        Operand().integer(0)                                     // supplement
+		        Operand().string_id(registry_sid), // registry
+		        Operand().string_id(ordering_sid), // ordering
+		        Operand().integer(0)               // supplement
 		    });
 
 		// pre-set these to reserve space for them
 		top_dict.setInteger(DictKey::FDArray, 0);
 		top_dict.setInteger(DictKey::FDSelect, 0);
+		top_dict.setInteger(DictKey::charset, 0);
+		top_dict.setInteger(DictKey::CharStrings, 0);
 		top_dict.setStringId(DictKey::FontName, subset_name_sid);
-		top_dict.setInteger(DictKey::CIDCount, util::checked_cast<int32_t>(cff->glyphs.size()));
+		top_dict.setInteger(DictKey::CIDCount, int32_t(max_cid) + 1);
 
 		// Encoding can't be present for CID fonts, and Private will come from
 		// the FDArray/FDSelect Font DICT instead of the Top one.
 		top_dict.erase(DictKey::Encoding);
 		top_dict.erase(DictKey::Private);
 
-		auto top_dict_size = top_dict.computeSize();
-
-		/*
-		    the Top DICT also has an INDEX before it, so we need to calculate the amount of space
-		    for the INDEX table as well.
-		*/
-		{
-			int off_size = 0;
-			if(top_dict_size < 255)
-				off_size = 1;
-			else if(top_dict_size < 65535)
-				off_size = 2;
+		const auto num_strings = cff->string_ids.size() + extra_strings.size();
+		auto get_string_item = [&](size_t i) {
+			if(i < cff->string_ids.size())
+				return zst::str_view(cff->string_ids[i]).cast<uint8_t>();
 			else
-				off_size = 4;
+				return extra_strings[i - cff->string_ids.size()].cast<uint8_t>();
+		};
+
+		auto get_global_subr_item = [&](size_t i) {
+			return used_global_subrs[i] ? cff->global_subrs[i].charstring : zst::byte_span {};
+		};
+
+		auto get_charstring_item = [&](size_t i) { return cff->glyphs[glyphs[i]].charstring; };
+
+		size_t file_size = 4;
+		file_size += get_index_table_size(1, subset_name.size());
+		file_size += get_index_table_size(1, top_dict.computeSize());
+		file_size += get_index_table_size(num_strings, get_index_data_size(num_strings, get_string_item));
+		file_size += get_index_table_size(cff->global_subrs.size(),
+		    get_index_data_size(cff->global_subrs.size(), get_global_subr_item));
+
+		// the private dicts (each followed by its local subrs), in the order of the new font dicts.
+		std::vector<DictBuilder> private_dicts {};
+		std::vector<zst::byte_buffer> font_dicts {};
+		for(auto fd : used_font_dicts)
+		{
+			auto& local_subrs = cff->font_dicts[fd].local_subrs;
+			auto& priv_builder = private_dicts.emplace_back(cff->font_dicts[fd].private_dict);
 
-			top_dict_size += util::checked_cast<unsigned long>(2 + 1 + (2 * off_size));
-		}
+			// make the local subrs start immediately after the private dict.
+			if(local_subrs.size() > 0)
+				priv_builder.setInteger(DictKey::Subrs, 0);
 
-		// String INDEX
-		zst::byte_buffer string_table {};
-		{
-			auto builder = IndexTableBuilder();
-			for(auto& str : cff->string_ids)
-				builder.add(zst::str_view(str).cast<uint8_t>());
+			auto priv_size = priv_builder.computeSize();
+			auto priv_ofs = file_size;
 
-			builder.writeInto(string_table);
-		}
+			if(local_subrs.size() > 0)
+				priv_builder.setInteger(DictKey::Subrs, util::checked_cast<int32_t>(priv_size));
 
+			font_dicts.push_back(DictBuilder()
+			                         .setStringId(DictKey::FontName, subset_name_sid)
+			                         .setIntegerPair(DictKey::Private, util::checked_cast<int32_t>(priv_size),
+			                             util::checked_cast<int32_t>(priv_ofs))
+			                         .serialise());
 
-		// Global Subrs INDEX
-		zst::byte_buffer global_subrs_table {};
-		{
-			auto builder = IndexTableBuilder();
-			for(auto& subr : cff->global_subrs)
+			auto& local_used = used_local_subrs[fd];
+			file_size += priv_size;
+			if(local_subrs.size() > 0)
 			{
-				if(subr.used)
-					builder.add(subr.charstring);
-				else
-					builder.add(zst::byte_span {});
+				file_size += get_index_table_size(local_subrs.size(),
+				    get_index_data_size(local_subrs.size(), [&](size_t i) {
+					    return local_used[i] ? local_subrs[i].charstring : zst::byte_span {};
+				    }));
 			}
-
-			builder.writeInto(global_subrs_table);
 		}
 
+		auto get_font_dict_item = [&](size_t i) { return font_dicts[i].span(); };
 
-		// all the other stuff that comes after the Top DICT
-		{
-			zst::byte_buffer tmp_buffer {};
-			const auto initial_abs_offset = buffer.size() + top_dict_size + string_table.size()
-			                              + global_subrs_table.size();
-
-			const auto current_abs_ofs = [&]() { return initial_abs_offset + tmp_buffer.size(); };
-
-			// call this *BEFORE* writing the data!!!
-			auto copy_kv_pair_with_abs_offset = [&](DictKey key, size_t size = 0) {
-				// Private needs special treatment (since it needs both a size and offset)
-				if(key == DictKey::Private)
-					top_dict.setIntegerPair(key, util::checked_cast<int32_t>(size),
-					    util::checked_cast<int32_t>(current_abs_ofs()));
-				else
-					top_dict.setInteger(key, util::checked_cast<int32_t>(current_abs_ofs()));
-			};
-
-			// returns the absolute offset to the private dict
-			auto serialise_fontdict = [&](FontDict& fd) -> std::pair<size_t, size_t> {
-				auto priv_builder = DictBuilder(fd.private_dict);
-				auto priv_size = priv_builder.computeSize();
-				auto priv_ofs = current_abs_ofs();
-
-				// make the local subrs start immediately after the private dict.
-				if(fd.local_subrs.size() > 0)
-					priv_builder.setInteger(DictKey::Subrs, util::checked_cast<int32_t>(priv_size));
-
-				priv_builder.writeInto(tmp_buffer);
-
-				if(fd.local_subrs.size() > 0)
-				{
-					auto builder = IndexTableBuilder();
-					for(auto& subr : fd.local_subrs)
-					{
-						if(subr.used)
-							builder.add(subr.charstring);
-						else
-							builder.add(zst::byte_span {});
-					}
-
-					builder.writeInto(tmp_buffer);
-				}
-
-				return { priv_size, priv_ofs };
-			};
-
+		top_dict.setInteger(DictKey::FDArray, util::checked_cast<int32_t>(file_size));
+		file_size += get_index_table_size(font_dicts.size(),
+		    get_index_data_size(font_dicts.size(), get_font_dict_item));
 
-			std::vector<std::pair<size_t, size_t>> private_dicts {};
-
-			// if the original font was not a CIDFont, then we just create new ones, easy.
-			if(!cff->is_cidfont)
-			{
-				private_dicts.push_back(serialise_fontdict(cff->font_dicts[0]));
-			}
-			else
-			{
-				for(auto& fd : cff->font_dicts)
-					private_dicts.push_back(serialise_fontdict(fd));
-			}
+		// for non-cid fonts, we use a format 3 fdselect with a single range; for CID fonts, format 0.
+		top_dict.setInteger(DictKey::FDSelect, util::checked_cast<int32_t>(file_size));
+		file_size += cff->is_cidfont ? (1 + glyphs.size()) : (1 + 2 + 3 + 2);
 
-			{
-				copy_kv_pair_with_abs_offset(DictKey::FDArray);
+		// the charset (format 0) doesn't include notdef
+		top_dict.setInteger(DictKey::charset, util::checked_cast<int32_t>(file_size));
+		file_size += 1 + 2 * (glyphs.size() - 1);
 
-				auto fdarray_builder = IndexTableBuilder();
-				for(auto& [priv_size, priv_ofs] : private_dicts)
-				{
-					auto builder = DictBuilder()
-					                   .setStringId(DictKey::FontName, subset_name_sid)
-					                   .setIntegerPair(DictKey::Private, util::checked_cast<int32_t>(priv_size),
-					                       util::checked_cast<int32_t>(priv_ofs));
+		top_dict.setInteger(DictKey::CharStrings, util::checked_cast<int32_t>(file_size));
+		file_size += get_index_table_size(glyphs.size(), get_index_data_size(glyphs.size(), get_charstring_item));
 
-					fdarray_builder.add(builder.serialise().span());
-				}
 
-				fdarray_builder.writeInto(tmp_buffer);
+		// now, actually write everything.
+		auto buffer = zst::byte_buffer(file_size);
 
+		// the header
+		buffer.append(1); // major
+		buffer.append(0); // minor
+		buffer.append(4); // hdrSize
+		buffer.append(4); // offSize (for now, always 4. I don't even know what this field is used for)
 
-				// finally, the fdselect...
-				copy_kv_pair_with_abs_offset(DictKey::FDSelect);
+		// Name INDEX (there is only 1)
+		write_index_table(buffer, 1, [&](size_t) { return subset_name.bytes(); });
+		std::vector<size_t> name_offsets { buffer.size() - subset_name.size() };
 
-				if(!cff->is_cidfont)
-				{
-					// for non-cid fonts, we just use the same FD for all glyphs, easy.
-					tmp_buffer.append(3);
-					tmp_buffer.append_bytes(util::convertBEU16(1));
-					tmp_buffer.append_bytes(util::convertBEU16(0));
-					tmp_buffer.append(0);
-					tmp_buffer.append_bytes(util::convertBEU16(util::checked_cast<uint16_t>(cff->glyphs.size() + 1)));
-				}
-				else
-				{
-					// for CID fonts, we just use whatever the font tells us to use.
-					// format 0, because idgaf
-					tmp_buffer.append(0);
-					for(auto& glyph : cff->glyphs)
-						tmp_buffer.append(glyph.font_dict_idx);
-				}
-			}
+		// Top DICT INDEX (also only 1)
+		{
+			auto top_dict_data = top_dict.serialise();
+			write_index_table(buffer, 1, [&](size_t) { return top_dict_data.span(); });
+		}
 
+		write_index_table(buffer, num_strings, get_string_item);
+		name_offsets.push_back(buffer.size() - subset_name.size());
 
-			copy_kv_pair_with_abs_offset(DictKey::charset);
-			write_charset_table(cff.get(), tmp_buffer, m_used_glyphs);
+		write_index_table(buffer, cff->global_subrs.size(), get_global_subr_item);
 
+		for(size_t i = 0; i < used_font_dicts.size(); i++)
+		{
+			private_dicts[i].writeInto(buffer);
 
+			auto& local_subrs = cff->font_dicts[used_font_dicts[i]].local_subrs;
+			auto& local_used = used_local_subrs[used_font_dicts[i]];
+			if(local_subrs.size() > 0)
 			{
-				copy_kv_pair_with_abs_offset(DictKey::CharStrings);
-
-				auto builder = IndexTableBuilder();
-				for(auto& glyph : cff->glyphs)
-					builder.add(glyph.charstring);
-
-				builder.writeInto(tmp_buffer);
+				write_index_table(buffer, local_subrs.size(), [&](size_t k) {
+					return local_used[k] ? local_subrs[k].charstring : zst::byte_span {};
+				});
 			}
+		}
 
+		write_index_table(buffer, font_dicts.size(), get_font_dict_item);
 
-			// finally, we write the top dict (with the new offsets) to the main buffer,
-			// followed by the tmp buffer.
-			IndexTableBuilder().add(top_dict.serialise().span()).writeInto(buffer);
+		if(not cff->is_cidfont)
+		{
+			// for non-cid fonts, we just use the same FD for all glyphs, easy.
+			buffer.append(3);
+			buffer.append_bytes(util::convertBEU16(1));
+			buffer.append_bytes(util::convertBEU16(0));
+			buffer.append(0);
+			buffer.append_bytes(util::convertBEU16(util::checked_cast<uint16_t>(glyphs.size())));
+		}
+		else
+		{
+			// for CID fonts, we just use whatever the font tells us to use.
+			// format 0, because idgaf
+			buffer.append(0);
+			for(auto idx : glyphs)
+				buffer.append(static_cast<uint8_t>(fd_mapping[cff->glyphs[idx].font_dict_idx]));
+		}
 
-			buffer.append(string_table.span());
-			buffer.append(global_subrs_table.span());
-			buffer.append(tmp_buffer.span());
+		// charset, format 0
+		buffer.append(0);
+		for(auto idx : glyphs)
+		{
+			// don't add notdef
+			if(auto& g = cff->glyphs[idx]; g.gid != 0)
+				buffer.append_bytes(util::convertBEU16(cff->is_cidfont ? g.cid : g.gid));
 		}
 
+		write_index_table(buffer, glyphs.size(), get_charstring_item);
+
+		assert(buffer.size() == file_size);
 
 #if 0
 		auto f = fopen("kekw.cff", "wb");
@@ -445,7 +625,14 @@ namespace font
 
 		CFFSubset ret {};
 		ret.cff = std::move(buffer);
-		ret.cmap = cff::create_cmap_for_cff_subset(cff.get());
+		ret.cmap = cff::create_cmap_for_cff_subset(cff.get(), glyphs);
+
+		state.last_subset = CFFSubset {};
+		state.last_subset->cff.append(ret.cff.span());
+		state.last_subset->cmap.append(ret.cmap.span());
+		state.last_subset_glyphs = std::move(glyphs);
+		state.last_subset_name_size = subset_name.size();
+		state.last_subset_name_offsets = std::move(name_offsets);
 
 		return ret;
 	}
@@ -24,8 +24,7 @@ namespace font
 		for(char32_t cp = 0; cp < 256; cp++)
 		{
 			auto gid = GlyphId { subtable[cp] };
-			mapping.forward[cp] = gid;
-			mapping.reverse[gid] = cp;
+			mapping.add(cp, gid);
 		}
 
 		return mapping;
@@ -67,14 +66,12 @@ namespace font
 				{
 					auto idx = util::convertBEU16(*(id_range_offsets.data() + i + range_ofs / 2 + (cp - start)));
 					auto gid = GlyphId { static_cast<uint32_t>((delta + idx) & 0xffff) };
-					mapping.forward[cp] = gid;
-					mapping.reverse[gid] = cp;
+					mapping.add(cp, gid);
 				}
 				else
 				{
 					auto gid = GlyphId { static_cast<uint32_t>((delta + cp) & 0xffff) };
-					mapping.forward[cp] = gid;
-					mapping.reverse[gid] = cp;
+					mapping.add(cp, gid);
 				}
 			}
 		}
@@ -99,8 +96,7 @@ namespace font
 			auto cp = static_cast<char32_t>(first + i);
 			auto gid = GlyphId { subtable.cast<uint16_t>()[i] };
 
-			mapping.forward[cp] = gid;
-			mapping.reverse[gid] = cp;
+			mapping.add(cp, gid);
 		}
 		return mapping;
 	}
@@ -123,8 +119,7 @@ namespace font
 			auto cp = static_cast<char32_t>(first + i);
 			auto gid = GlyphId { subtable.cast<uint32_t>()[i] };
 
-			mapping.forward[cp] = gid;
-			mapping.reverse[gid] = cp;
+			mapping.add(cp, gid);
 		}
 
 		return mapping;
@@ -158,8 +153,7 @@ namespace font
 				else
 					gid = GlyphId { g };
 
-				mapping.forward[cp] = gid;
-				mapping.reverse[gid] = cp;
+				mapping.add(cp, gid);
 			}
 		}
 
@@ -0,0 +1,73 @@
+// features.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include <deque>
+#include <mutex>
+
+#include "font/features.h"
+
+namespace font
+{
+	namespace
+	{
+		struct FeatureSetRegistry
+		{
+			FeatureSetRegistry() { this->intern(defaultFeatureSet()); }
+
+			FeatureSetId intern(FeatureSet features)
+			{
+				auto lk = std::unique_lock(mtx);
+				if(auto it = ids.find(features); it != ids.end())
+					return it->second;
+
+				auto id = FeatureSetId { checked_cast<uint32_t>(sets.size()) };
+				ids.emplace(features, id);
+				sets.push_back(std::move(features));
+
+				return id;
+			}
+
+			const FeatureSet& get(FeatureSetId id)
+			{
+				auto lk = std::unique_lock(mtx);
+				if(id.value >= sets.size())
+					sap::internal_error("invalid feature set id {}", id.value);
+
+				return sets[id.value];
+			}
+
+			std::mutex mtx;
+
+			// a deque, so that references to the sets stay valid as new ones are interned.
+			std::deque<FeatureSet> sets {};
+			util::hashmap<FeatureSet, FeatureSetId> ids {};
+		};
+
+		FeatureSetRegistry& registry()
+		{
+			static FeatureSetRegistry reg {};
+			return reg;
+		}
+	}
+
+	FeatureSet defaultFeatureSet()
+	{
+		return FeatureSet {
+			.script = Tag("latn"),
+			.language = Tag("dflt"),
+			.enabled_features = { feature::kern, feature::liga, Tag("locl") },
+			.disabled_features = {},
+		};
+	}
+
+	FeatureSetId internFeatureSet(FeatureSet features)
+	{
+		return registry().intern(std::move(features));
+	}
+
+	const FeatureSet& getFeatureSet(FeatureSetId id)
+	{
+		return registry().get(id);
+	}
+}
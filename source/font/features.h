@@ -25,8 +25,46 @@ namespace font
 		{
 			return enabled_features.contains(feat) && not disabled_features.contains(feat);
 		}
+
+		bool operator==(const FeatureSet&) const = default;
+
+		size_t hash() const
+		{
+			// the feature sets are unordered, so their hashes need to be combined in an order-independent way
+			size_t enabled = 0;
+			for(auto& f : enabled_features)
+				enabled += f.hash();
+
+			size_t disabled = 0;
+			for(auto& f : disabled_features)
+				disabled += f.hash();
+
+			return util::hasher::combine(script.hash(), language.hash(), enabled, disabled);
+		}
 	};
 
+	/*
+	    Feature sets are interned, so that a style can refer to one cheaply, and so that caches (eg. of shaped
+	    strings) can be keyed on the id instead of the whole set. Ids are only meaningful within one run, and
+	    the id of a given set depends on the order in which sets were interned -- except for the default set,
+	    which is always `DEFAULT_FEATURE_SET`.
+	*/
+	struct FeatureSetId
+	{
+		uint32_t value;
+
+		bool operator==(const FeatureSetId&) const = default;
+		size_t hash() const { return std::hash<uint32_t>()(value); }
+	};
+
+	inline constexpr auto DEFAULT_FEATURE_SET = FeatureSetId { 0 };
+
+	FeatureSetId internFeatureSet(FeatureSet features);
+	const FeatureSet& getFeatureSet(FeatureSetId id);
+
+	// the features that are used when a style does not ask for anything else.
+	FeatureSet defaultFeatureSet();
+
 #define DECLARE_FEATURE(name) inline constexpr auto name = Tag(#name)
 	namespace feature
 	{
@@ -12,6 +12,48 @@ namespace font
 	{
 	}
 
+	const CharacterMapping& FontSource::characterMapping() const
+	{
+		if(not m_did_load_character_mapping)
+		{
+			m_did_load_character_mapping = true;
+			this->load_character_mapping();
+		}
+
+		return m_character_mapping;
+	}
+
+	const CodepointCoverage& FontSource::coverage() const
+	{
+		if(not m_coverage.has_value())
+			m_coverage = CodepointCoverage::fromMapping(this->characterMapping());
+
+		return *m_coverage;
+	}
+
+
+	void CharacterMapping::add(char32_t codepoint, GlyphId glyph)
+	{
+		auto cp = static_cast<uint32_t>(codepoint);
+		if(cp / PAGE_SIZE >= m_pages.size())
+			m_pages.resize(cp / PAGE_SIZE + 1);
+
+		auto& page = m_pages[cp / PAGE_SIZE];
+		if(page == nullptr)
+		{
+			page = std::make_unique<std::array<GlyphId, PAGE_SIZE>>();
+			page->fill(NO_GLYPH);
+		}
+
+		(*page)[cp % PAGE_SIZE] = glyph;
+
+		auto gid = static_cast<uint32_t>(glyph);
+		if(gid >= m_reverse.size())
+			m_reverse.resize(gid + 1, NO_CODEPOINT);
+
+		m_reverse[gid] = codepoint;
+	}
+
 
 	bool FontSource::isGlyphUsed(GlyphId glyph_id) const
 	{
@@ -23,17 +65,17 @@ namespace font
 		m_used_glyphs.insert(glyph_id);
 	}
 
-	const util::hashset<GlyphId>& FontSource::usedGlyphs() const
+	const GlyphSet& FontSource::usedGlyphs() const
 	{
 		return m_used_glyphs;
 	}
 
 	GlyphId FontSource::getGlyphIndexForCodepoint(char32_t codepoint) const
 	{
-		if(auto it = m_character_mapping.forward.find(codepoint); it != m_character_mapping.forward.end())
+		if(auto gid = this->characterMapping().glyphForCodepoint(codepoint); gid.has_value())
 		{
-			m_used_glyphs.insert(it->second);
-			return it->second;
+			m_used_glyphs.insert(*gid);
+			return *gid;
 		}
 		else
 		{
@@ -72,7 +114,7 @@ namespace font
 		// now, figure out xmin and xmax
 		if(this->hasTrueTypeOutlines())
 		{
-			auto bb = truetype::getGlyphBoundingBox(m_truetype_data.get(), glyph_id);
+			auto bb = truetype::getGlyphBoundingBox(this->truetype_data(), glyph_id);
 			ret.xmin = FontScalar(bb.xmin);
 			ret.ymin = FontScalar(bb.ymin);
 			ret.xmax = FontScalar(bb.xmax);
@@ -101,11 +143,105 @@ namespace font
 	}
 
 
-	util::hashmap<size_t, GlyphAdjustment> FontFile::
+	const Table* FontFile::find_table(Tag tag) const
+	{
+		if(auto it = m_tables.find(tag); it != m_tables.end())
+			return &it->second;
+
+		return nullptr;
+	}
+
+	const FontNames& FontFile::names() const
+	{
+		if(not m_names.has_value())
+		{
+			if(auto tbl = this->find_table(Tag("name")); tbl != nullptr)
+				this->parse_name_table(*tbl);
+			else
+				m_names = FontNames {};
+		}
+
+		return *m_names;
+	}
+
+	void FontFile::load_character_mapping() const
+	{
+		if(auto tbl = this->find_table(Tag("cmap")); tbl != nullptr)
+			this->parse_cmap_table(*tbl);
+	}
+
+	truetype::TTData* FontFile::truetype_data() const
+	{
+		assert(m_truetype_data != nullptr);
+		if(not m_did_load_glyf_table)
+		{
+			m_did_load_glyf_table = true;
+
+			// glyf must come before loca, since loca slices the glyf data.
+			if(auto glyf = this->find_table(Tag("glyf")); glyf != nullptr)
+				this->parse_glyf_table(*glyf);
+
+			if(auto loca = this->find_table(Tag("loca")); loca != nullptr)
+				this->parse_loca_table(*loca);
+		}
+
+		return m_truetype_data.get();
+	}
+
+	void FontFile::load_positioning_tables() const
+	{
+		if(m_did_load_positioning_tables)
+			return;
+
+		m_did_load_positioning_tables = true;
+		if(auto gpos = this->find_table(Tag("GPOS")); gpos != nullptr)
+			this->parse_gpos_table(*gpos);
+
+		// only bother with the kern table if there's no GPOS
+		if(auto kern = this->find_table(Tag("kern")); kern != nullptr && not m_gpos_table.has_value())
+			this->parse_kern_table(*kern);
+	}
+
+	void FontFile::load_substitution_tables() const
+	{
+		if(m_did_load_substitution_tables)
+			return;
+
+		m_did_load_substitution_tables = true;
+		if(auto gsub = this->find_table(Tag("GSUB")); gsub != nullptr)
+			this->parse_gsub_table(*gsub);
+
+		// same thing; morx is only used if there's no GSUB
+		if(auto morx = this->find_table(Tag("morx")); morx != nullptr && not m_gsub_table.has_value())
+			this->parse_morx_table(*morx);
+	}
+
+
+	const off::ShapingPlan& FontFile::getShapingPlan(const FeatureSet& features) const
+	{
+		if(auto it = m_shaping_plans.find(features); it != m_shaping_plans.end())
+			return it->second;
+
+		// the plan holds pointers into both tables, so make sure they are both loaded.
+		this->load_substitution_tables();
+		this->load_positioning_tables();
+
+		auto plan = off::compileShapingPlan(m_gsub_table.has_value() ? &*m_gsub_table : nullptr,
+		    m_gpos_table.has_value() ? &*m_gpos_table : nullptr, features);
+
+		return m_shaping_plans.emplace(features, std::move(plan)).first->second;
+	}
+
+	std::vector<GlyphAdjustment> FontFile::
 	    getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId> glyphs, const FeatureSet& features) const
 	{
+		this->load_positioning_tables();
+
 		if(m_gpos_table.has_value())
-			return off::getPositioningAdjustmentsForGlyphSequence(*m_gpos_table, glyphs, features);
+		{
+			auto& plan = this->getShapingPlan(features);
+			return off::getPositioningAdjustmentsForGlyphSequence(*m_gpos_table, glyphs, plan);
+		}
 		else if(m_kern_table.has_value())
 			return aat::getPositioningAdjustmentsForGlyphSequence(*m_kern_table, glyphs, features);
 		else
@@ -115,8 +251,13 @@ namespace font
 	std::optional<SubstitutedGlyphString> FontFile::performSubstitutionsForGlyphSequence(zst::span<GlyphId> glyphs,
 	    const FeatureSet& features) const
 	{
+		this->load_substitution_tables();
+
 		if(m_gsub_table.has_value())
-			return off::performSubstitutionsForGlyphSequence(*m_gsub_table, glyphs, features);
+		{
+			auto& plan = this->getShapingPlan(features);
+			return off::performSubstitutionsForGlyphSequence(*m_gsub_table, glyphs, plan);
+		}
 		else if(m_morx_table.has_value())
 			return aat::performSubstitutionsForGlyphSequence(*m_morx_table, glyphs, features);
 		else
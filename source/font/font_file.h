@@ -73,11 +73,11 @@ namespace font
 		// declare this out of line so we can have std::unique_ptr to incomplete types
 		~FontFile();
 
-		const FontNames& names() const { return m_names; }
+		const FontNames& names() const;
 
 		const std::map<Tag, Table>& sfntTables() const { return m_tables; }
 
-		zst::byte_span bytes() const { return zst::byte_span(m_file.get(), m_file.size()); }
+		zst::byte_span bytes() const { return zst::byte_span(m_file->get(), m_file->size()); }
 
 		bool hasCffOutlines() const { return m_outline_type == OUTLINES_CFF; }
 		bool hasTrueTypeOutlines() const { return m_outline_type == OUTLINES_TRUETYPE; }
@@ -85,41 +85,75 @@ namespace font
 		void writeSubset(zst::str_view subset_name, pdf::Stream* stream);
 
 		virtual bool isBuiltin() const override { return false; }
-		virtual std::string name() const override { return m_names.postscript_name; }
+		virtual std::string name() const override { return this->names().postscript_name; }
 
-		virtual util::hashmap<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId>
+		virtual std::vector<GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId>
 		                                                                                             glyphs,
 		    const font::FeatureSet& features) const override;
 
 		virtual std::optional<SubstitutedGlyphString> performSubstitutionsForGlyphSequence(zst::span<GlyphId> glyphs,
 		    const font::FeatureSet& features) const override;
 
+		/*
+		    Get the (cached) shaping plan for the given feature set; it is compiled the first time
+		    a particular feature set is seen.
+		*/
+		const off::ShapingPlan& getShapingPlan(const font::FeatureSet& features) const;
+
 		static std::optional<std::unique_ptr<FontFile>> fromHandle(FontHandle handle);
 
+		/*
+		    Whether to subset embedded CFF fonts. This is off by default, since some PDF viewers don't display
+		    the subsets properly; the whole CFF data is embedded instead.
+		*/
+		static void setSubsetCFFFonts(bool subset);
+
 	private:
-		FontFile(zst::unique_span<uint8_t[]> bytes);
+		/*
+		    The contents of a font file on disk. This is shared between all FontFiles loaded from the same path,
+		    which (mostly) matters for collections -- each face refers to the same mapping of the whole file,
+		    instead of reading the file once per face.
+		*/
+		using Blob = std::shared_ptr<const zst::unique_span<uint8_t[]>>;
+
+		FontFile(Blob blob);
+
+		static Blob get_blob_for_path(const stdfs::path& path);
 
 		friend struct FontSource;
 		virtual GlyphMetrics get_glyph_metrics_impl(GlyphId glyphId) const override;
+		virtual void load_character_mapping() const override;
 
-		void parse_gpos_table(const Table& gpos);
-		void parse_gsub_table(const Table& gsub);
+		/*
+		    These tables are only parsed on first use (eg. GSUB when we first perform substitutions,
+		    GPOS when we first look for positioning adjustments), since a font that is loaded may only
+		    ever be used for a handful of words -- or not at all.
+		*/
+		void parse_gpos_table(const Table& gpos) const;
+		void parse_gsub_table(const Table& gsub) const;
 
-		void parse_kern_table(const Table& kern);
-		void parse_morx_table(const Table& morx);
+		void parse_kern_table(const Table& kern) const;
+		void parse_morx_table(const Table& morx) const;
+
+		void parse_name_table(const Table& table) const;
+		void parse_cmap_table(const Table& table) const;
+		void parse_loca_table(const Table& table) const;
+		void parse_glyf_table(const Table& table) const;
 
-		void parse_name_table(const Table& table);
-		void parse_cmap_table(const Table& table);
 		void parse_head_table(const Table& table);
 		void parse_post_table(const Table& table);
 		void parse_hhea_table(const Table& table);
 		void parse_os2_table(const Table& table);
 		void parse_hmtx_table(const Table& table);
 		void parse_maxp_table(const Table& table);
-		void parse_loca_table(const Table& table);
-		void parse_glyf_table(const Table& table);
 		void parse_cff_table(const Table& table);
 
+		const Table* find_table(Tag tag) const;
+
+		void load_positioning_tables() const;
+		void load_substitution_tables() const;
+		truetype::TTData* truetype_data() const;
+
 		/*
 		    Subset the CFF font (given in `file`), including only the used_glyphs. Returns a new CFF and cmap table
 		    for embedding into the OTF font.
@@ -127,13 +161,11 @@ namespace font
 		cff::CFFSubset createCFFSubset(zst::str_view subset_name);
 		truetype::TTSubset createTTSubset();
 
-		static std::unique_ptr<FontFile> from_offset_table(zst::unique_span<uint8_t[]> bytes, //
-		    size_t start_of_offset_table);
-		static std::optional<std::unique_ptr<FontFile>> from_postscript_name_in_collection(zst::unique_span<uint8_t[]>
-		                                                                                       bytes,
+		static std::unique_ptr<FontFile> from_offset_table(Blob blob, size_t start_of_offset_table);
+		static std::optional<std::unique_ptr<FontFile>> from_postscript_name_in_collection(Blob blob,
 		    zst::str_view postscript_name);
 
-		FontNames m_names;
+		mutable std::optional<FontNames> m_names {};
 
 		// note: this *MUST* be a std::map (ie. ordered) because the tables must be sorted by Tag.
 		std::map<Tag, Table> m_tables {};
@@ -148,18 +180,26 @@ namespace font
 		// only valid if outline_type == OUTLINES_TRUETYPE
 		std::unique_ptr<truetype::TTData> m_truetype_data {};
 
-		// optional feature tables
-		std::optional<off::GPosTable> m_gpos_table {};
-		std::optional<off::GSubTable> m_gsub_table {};
-		std::optional<aat::KernTable> m_kern_table {};
-		std::optional<aat::MorxTable> m_morx_table {};
+		// only valid if outline_type == OUTLINES_TRUETYPE, *and* truetype_data() was called
+		mutable bool m_did_load_glyf_table = false;
+
+		// optional feature tables, loaded lazily
+		mutable std::optional<off::GPosTable> m_gpos_table {};
+		mutable std::optional<off::GSubTable> m_gsub_table {};
+		mutable std::optional<aat::KernTable> m_kern_table {};
+		mutable std::optional<aat::MorxTable> m_morx_table {};
+
+		mutable bool m_did_load_positioning_tables = false;
+		mutable bool m_did_load_substitution_tables = false;
+
+		mutable util::hashmap<FeatureSet, off::ShapingPlan> m_shaping_plans {};
 
 		static constexpr int OUTLINES_TRUETYPE = 1;
 		static constexpr int OUTLINES_CFF = 2;
 
 		int m_outline_type = 0;
 
-		zst::unique_span<uint8_t[]> m_file;
+		Blob m_file;
 	};
 
 	CharacterMapping readCMapTable(zst::byte_span table);
@@ -11,10 +11,180 @@
 
 namespace font
 {
+	/*
+	    A set of glyph ids, stored as a bitset indexed by glyph id. Fonts have at most 65536 glyphs,
+	    so this never gets very large. Iteration is in ascending order of glyph id.
+	*/
+	struct GlyphSet
+	{
+		bool contains(GlyphId glyph) const
+		{
+			auto gid = static_cast<uint32_t>(glyph);
+			return gid / 64 < m_bits.size() && (m_bits[gid / 64] & (uint64_t(1) << (gid % 64)));
+		}
+
+		void insert(GlyphId glyph)
+		{
+			auto gid = static_cast<uint32_t>(glyph);
+			if(gid / 64 >= m_bits.size())
+				m_bits.resize(gid / 64 + 1);
+
+			auto& word = m_bits[gid / 64];
+			if(auto bit = uint64_t(1) << (gid % 64); not(word & bit))
+				word |= bit, m_count++;
+		}
+
+		size_t size() const { return m_count; }
+		bool empty() const { return m_count == 0; }
+
+		struct iterator
+		{
+			GlyphId operator*() const { return GlyphId(m_gid); }
+			iterator& operator++()
+			{
+				m_gid = m_set->next_glyph(m_gid + 1);
+				return *this;
+			}
+
+			bool operator==(const iterator& other) const { return m_gid == other.m_gid; }
+
+		private:
+			friend struct GlyphSet;
+			iterator(const GlyphSet* set, uint32_t gid) : m_set(set), m_gid(gid) { }
+
+			const GlyphSet* m_set;
+			uint32_t m_gid;
+		};
+
+		iterator begin() const { return iterator(this, this->next_glyph(0)); }
+		iterator end() const { return iterator(this, this->limit()); }
+
+	private:
+		uint32_t limit() const { return static_cast<uint32_t>(m_bits.size() * 64); }
+		uint32_t next_glyph(uint32_t from) const
+		{
+			for(auto i = from / 64; i < m_bits.size(); i++)
+			{
+				auto word = m_bits[i];
+				if(i == from / 64)
+					word &= ~uint64_t(0) << (from % 64);
+
+				if(word != 0)
+					return i * 64 + static_cast<uint32_t>(std::countr_zero(word));
+			}
+
+			return this->limit();
+		}
+
+		std::vector<uint64_t> m_bits {};
+		size_t m_count = 0;
+	};
+
+	/*
+	    The mapping between codepoints and glyph ids. This is looked up for every character that we
+	    shape, so the forward mapping is a two-level page table indexed by codepoint (only pages that
+	    actually contain a mapping are allocated), and the reverse mapping is a flat array indexed by
+	    glyph id.
+
+	    Note that many codepoints can map to the same glyph; in that case the reverse mapping of the
+	    glyph is the codepoint that was added last.
+	*/
 	struct CharacterMapping
 	{
-		util::hashmap<char32_t, GlyphId> forward;
-		util::hashmap<GlyphId, char32_t> reverse;
+		void add(char32_t codepoint, GlyphId glyph);
+
+		std::optional<GlyphId> glyphForCodepoint(char32_t codepoint) const
+		{
+			auto cp = static_cast<uint32_t>(codepoint);
+			if(cp / PAGE_SIZE >= m_pages.size() || m_pages[cp / PAGE_SIZE] == nullptr)
+				return std::nullopt;
+
+			if(auto gid = (*m_pages[cp / PAGE_SIZE])[cp % PAGE_SIZE]; gid != NO_GLYPH)
+				return gid;
+
+			return std::nullopt;
+		}
+
+		std::optional<char32_t> codepointForGlyph(GlyphId glyph) const
+		{
+			auto gid = static_cast<uint32_t>(glyph);
+			if(gid < m_reverse.size() && m_reverse[gid] != NO_CODEPOINT)
+				return m_reverse[gid];
+
+			return std::nullopt;
+		}
+
+		// calls `cb(codepoint, glyph)` for every mapped codepoint, in ascending codepoint order
+		template <typename Cb>
+		void forEachMapping(Cb&& cb) const
+		{
+			for(size_t i = 0; i < m_pages.size(); i++)
+			{
+				if(m_pages[i] == nullptr)
+					continue;
+
+				for(size_t k = 0; k < PAGE_SIZE; k++)
+				{
+					if(auto gid = (*m_pages[i])[k]; gid != NO_GLYPH)
+						cb(static_cast<char32_t>(i * PAGE_SIZE + k), gid);
+				}
+			}
+		}
+
+	private:
+		static constexpr size_t PAGE_SIZE = 256;
+		static constexpr auto NO_GLYPH = GlyphId(0xFFFF'FFFF);
+		static constexpr auto NO_CODEPOINT = static_cast<char32_t>(0xFFFF'FFFF);
+
+		std::vector<std::unique_ptr<std::array<GlyphId, PAGE_SIZE>>> m_pages {};
+		std::vector<char32_t> m_reverse {};
+	};
+
+	/*
+	    The set of codepoints that a font has glyphs for, as a flat bitmap indexed by codepoint; this is
+	    compiled once from the character mapping. It is used to pick fallback fonts, which means it gets
+	    queried for every character of every word, so it is kept as simple as possible.
+	*/
+	struct CodepointCoverage
+	{
+		bool contains(char32_t codepoint) const
+		{
+			auto cp = static_cast<uint32_t>(codepoint);
+			return cp / 64 < m_bits.size() && (m_bits[cp / 64] & (uint64_t(1) << (cp % 64)));
+		}
+
+		// returns the number of characters at the start of `text` that are covered
+		size_t coveredPrefixLength(zst::wstr_view text) const
+		{
+			const auto num_words = m_bits.size();
+			const auto bits = m_bits.data();
+
+			for(size_t i = 0; i < text.size(); i++)
+			{
+				auto cp = static_cast<uint32_t>(text[i]);
+				if(cp / 64 >= num_words || not(bits[cp / 64] & (uint64_t(1) << (cp % 64))))
+					return i;
+			}
+
+			return text.size();
+		}
+
+		static CodepointCoverage fromMapping(const CharacterMapping& mapping)
+		{
+			CodepointCoverage ret {};
+			mapping.forEachMapping([&ret](char32_t codepoint, GlyphId) {
+				auto cp = static_cast<uint32_t>(codepoint);
+				if(cp / 64 >= ret.m_bits.size())
+					ret.m_bits.resize(cp / 64 + 1);
+
+				ret.m_bits[cp / 64] |= uint64_t(1) << (cp % 64);
+			});
+
+			return ret;
+		}
+
+	private:
+		std::vector<uint64_t> m_bits {};
 	};
 
 	struct FontSource
@@ -25,18 +195,20 @@ namespace font
 
 		size_t numGlyphs() const { return m_num_glyphs; }
 		const FontMetrics& metrics() const { return m_metrics; }
-		const CharacterMapping& characterMapping() const { return m_character_mapping; }
+		const CharacterMapping& characterMapping() const;
+		const CodepointCoverage& coverage() const;
 
 		GlyphId getGlyphIndexForCodepoint(char32_t codepoint) const;
 		GlyphMetrics getGlyphMetrics(GlyphId glyphId) const;
 
 		bool isGlyphUsed(GlyphId glyph_id) const;
 		void markGlyphAsUsed(GlyphId glyph_id) const;
-		const util::hashset<GlyphId>& usedGlyphs() const;
+		const GlyphSet& usedGlyphs() const;
 
 		virtual bool isBuiltin() const = 0;
 
-		virtual util::hashmap<size_t, GlyphAdjustment>
+		// returns one adjustment per input glyph, or an empty vector if there are no adjustments at all.
+		virtual std::vector<GlyphAdjustment>
 		getPositioningAdjustmentsForGlyphSequence(zst::span<GlyphId> glyphs, const font::FeatureSet& features) const = 0;
 
 		virtual std::optional<SubstitutedGlyphString>
@@ -45,12 +217,20 @@ namespace font
 	protected:
 		virtual GlyphMetrics get_glyph_metrics_impl(GlyphId glyphid) const = 0;
 
+		// called (once) before the character mapping is first used, for sources that load it lazily
+		virtual void load_character_mapping() const { }
+
 		size_t m_num_glyphs = 0;
 		FontMetrics m_metrics {};
 
-		CharacterMapping m_character_mapping {};
+		mutable CharacterMapping m_character_mapping {};
+		mutable bool m_did_load_character_mapping = false;
+
+		mutable std::optional<CodepointCoverage> m_coverage {};
+
+		mutable GlyphSet m_used_glyphs {};
 
-		mutable util::hashset<GlyphId> m_used_glyphs {};
-		mutable util::hashmap<GlyphId, GlyphMetrics> m_glyph_metrics {};
+		// indexed by glyph id; grows as needed.
+		mutable std::vector<std::optional<GlyphMetrics>> m_glyph_metrics {};
 	};
 }
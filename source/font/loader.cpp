@@ -2,6 +2,8 @@
 // Copyright (c) 2021, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
+
 #include "util.h"
 
 #include "font/cff.h"
@@ -217,13 +219,13 @@ namespace font
 		return names;
 	}
 
-	void FontFile::parse_name_table(const Table& name_table)
+	void FontFile::parse_name_table(const Table& name_table) const
 	{
 		m_names = ::font::parse_name_table(this->bytes(), name_table);
 	}
 
 
-	void FontFile::parse_cmap_table(const Table& cmap_table)
+	void FontFile::parse_cmap_table(const Table& cmap_table) const
 	{
 		auto buf = this->bytes();
 		buf.remove_prefix(cmap_table.offset);
@@ -481,11 +483,10 @@ namespace font
 		return tables;
 	}
 
-	std::unique_ptr<FontFile> FontFile::from_offset_table(zst::unique_span<uint8_t[]> file_buf,
-	    size_t start_of_offset_table)
+	std::unique_ptr<FontFile> FontFile::from_offset_table(Blob blob, size_t start_of_offset_table)
 	{
-		// this is perfectly fine, because we own the data referred to by 'buf'.
-		auto font = std::unique_ptr<FontFile>(new FontFile(std::move(file_buf)));
+		// this is perfectly fine, because we (share) ownership of the data referred to by 'blob'.
+		auto font = std::unique_ptr<FontFile>(new FontFile(std::move(blob)));
 		auto file_bytes = font->bytes();
 
 		font->m_tables = get_table_offsets(file_bytes.drop(start_of_offset_table));
@@ -501,23 +502,16 @@ namespace font
 			sap::internal_error("unsupported ttf/otf file; unknown header bytes '{}'", sfnt_version.str());
 
 
-		// there is an order that we want to use:
+		// there is an order that we want to use. note that we only parse the tables that we need up-front
+		// here; the rest (name, cmap, glyf/loca, and the GPOS/GSUB/kern/morx tables) are parsed on first use.
 		constexpr Tag table_processing_order[] = {
 			Tag("head"),
-			Tag("name"),
 			Tag("hhea"),
 			Tag("hmtx"),
 			Tag("maxp"),
 			Tag("post"),
 			Tag("CFF "),
 			Tag("CFF2"),
-			Tag("glyf"),
-			Tag("loca"),
-			Tag("cmap"),
-			Tag("GPOS"),
-			Tag("GSUB"),
-			Tag("kern"),
-			Tag("morx"),
 			Tag("OS/2"),
 		};
 
@@ -535,47 +529,30 @@ namespace font
 					font->parse_cff_table(tbl);
 				else if(tag == Tag("CFF2"))
 					font->parse_cff_table(tbl);
-				else if(tag == Tag("GPOS"))
-					font->parse_gpos_table(tbl);
-				else if(tag == Tag("GSUB"))
-					font->parse_gsub_table(tbl);
 				else if(tag == Tag("OS/2"))
 					font->parse_os2_table(tbl);
-				else if(tag == Tag("cmap"))
-					font->parse_cmap_table(tbl);
-				else if(tag == Tag("glyf"))
-					font->parse_glyf_table(tbl);
 				else if(tag == Tag("head"))
 					font->parse_head_table(tbl);
 				else if(tag == Tag("hhea"))
 					font->parse_hhea_table(tbl);
 				else if(tag == Tag("hmtx"))
 					font->parse_hmtx_table(tbl);
-				else if(tag == Tag("loca"))
-					font->parse_loca_table(tbl);
 				else if(tag == Tag("maxp"))
 					font->parse_maxp_table(tbl);
-				else if(tag == Tag("name"))
-					font->parse_name_table(tbl);
 				else if(tag == Tag("post"))
 					font->parse_post_table(tbl);
-				else if(tag == Tag("kern"))
-					font->parse_kern_table(tbl);
-				else if(tag == Tag("morx"))
-					font->parse_morx_table(tbl);
 			}
 		}
 
 		return font;
 	}
 
-	std::optional<std::unique_ptr<FontFile>> FontFile::from_postscript_name_in_collection( //
-	    zst::unique_span<uint8_t[]> file_buf,
+	std::optional<std::unique_ptr<FontFile>> FontFile::from_postscript_name_in_collection(Blob blob,
 	    zst::str_view postscript_name)
 	{
-		assert(memcmp(file_buf.get(), "ttcf", 4) == 0);
+		assert(memcmp(blob->get(), "ttcf", 4) == 0);
 
-		auto file_span = zst::byte_span(file_buf.get(), file_buf.size());
+		auto file_span = zst::byte_span(blob->get(), blob->size());
 
 		// copy the thing
 		auto ttc_span = file_span;
@@ -593,28 +570,52 @@ namespace font
 			auto font_names = ::font::parse_name_table(file_span, name_table);
 
 			if(font_names.postscript_name == postscript_name)
-				return FontFile::from_offset_table(std::move(file_buf), offset);
+				return FontFile::from_offset_table(std::move(blob), offset);
 		}
 
 		return std::nullopt;
 	}
 
+	FontFile::Blob FontFile::get_blob_for_path(const stdfs::path& path)
+	{
+		// the cache only holds weak references, so the file is unmapped once the last face using it goes away.
+		static std::mutex mtx;
+		static util::hashmap<std::string, std::weak_ptr<const zst::unique_span<uint8_t[]>>> blobs;
+
+		std::error_code ec {};
+		auto key = stdfs::weakly_canonical(path, ec).string();
+		if(ec)
+			key = path.string();
+
+		auto lk = std::unique_lock(mtx);
+		if(auto it = blobs.find(key); it != blobs.end())
+		{
+			if(auto blob = it->second.lock(); blob != nullptr)
+				return blob;
+		}
+
+		auto blob = std::make_shared<const zst::unique_span<uint8_t[]>>(util::readEntireFile(path.string()));
+		blobs[key] = blob;
+
+		return blob;
+	}
+
 	std::optional<std::unique_ptr<FontFile>> FontFile::fromHandle(FontHandle handle)
 	{
-		auto file = util::readEntireFile(handle.path.string());
-		if(file.size() < 4)
+		auto blob = FontFile::get_blob_for_path(handle.path);
+		if(blob->size() < 4)
 			sap::internal_error("font file too short");
 
-		auto span = zst::byte_span(file.get(), file.size());
+		auto span = zst::byte_span(blob->get(), blob->size());
 
 		if(memcmp(span.data(), "OTTO", 4) == 0 || memcmp(span.data(), "true", 4) == 0
 		    || memcmp(span.data(), "\x00\x01\x00\x00", 4) == 0)
 		{
-			return FontFile::from_offset_table(std::move(file), /* offset: */ 0);
+			return FontFile::from_offset_table(std::move(blob), /* offset: */ 0);
 		}
 		else if(memcmp(span.data(), "ttcf", 4) == 0)
 		{
-			return FontFile::from_postscript_name_in_collection(std::move(file), handle.postscript_name);
+			return FontFile::from_postscript_name_in_collection(std::move(blob), handle.postscript_name);
 		}
 		else
 		{
@@ -624,7 +625,7 @@ namespace font
 		return std::nullopt;
 	}
 
-	FontFile::FontFile(zst::unique_span<uint8_t[]> bytes) : m_file(std::move(bytes))
+	FontFile::FontFile(Blob blob) : m_file(std::move(blob))
 	{
 	}
 }
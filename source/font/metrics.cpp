@@ -13,11 +13,17 @@ namespace font
 {
 	GlyphMetrics FontSource::getGlyphMetrics(GlyphId glyph_id) const
 	{
-		if(auto it = m_glyph_metrics.find(glyph_id); it != m_glyph_metrics.end())
-			return it->second;
+		auto gid = static_cast<uint32_t>(glyph_id);
+		if(gid < m_glyph_metrics.size() && m_glyph_metrics[gid].has_value())
+			return *m_glyph_metrics[gid];
+
+		if(gid >= m_glyph_metrics.size())
+			m_glyph_metrics.resize(std::max(size_t(gid) + 1, m_num_glyphs));
 
 		auto metrics = this->get_glyph_metrics_impl(glyph_id);
-		return m_glyph_metrics.emplace(glyph_id, std::move(metrics)).first->second;
+		m_glyph_metrics[gid] = metrics;
+
+		return metrics;
 	}
 
 }
@@ -57,12 +57,102 @@ namespace font::off
 		std::vector<uint16_t> lookups;
 	};
 
+	/*
+	    Coverage and ClassDef tables are stored as big-endian arrays that need to be binary searched, and
+	    the same few tables are consulted for every glyph of every glyph string that we shape. So, they are
+	    compiled (on first use) into one of these, and cached on the LookupTable whose subtables use them.
+
+	    If the glyphs in the table are reasonably contiguous, we use a dense array indexed by (glyph - first_glyph);
+	    otherwise (eg. for huge fonts with scattered glyphs), we fall back to a sorted vector.
+	*/
+	struct CompiledGlyphMap
+	{
+		std::optional<uint16_t> lookup(GlyphId glyph) const;
+
+		/*
+		    Build the map from (glyph, value) pairs, in any order. The value 0xFFFF is reserved to mark
+		    glyphs that are absent from the dense array, so it cannot be stored.
+		*/
+		static CompiledGlyphMap compile(std::vector<std::pair<uint16_t, uint16_t>> entries);
+
+		uint32_t first_glyph = 0;
+		std::vector<uint16_t> dense;                      // ABSENT if the glyph is not in the table
+		std::vector<std::pair<uint16_t, uint16_t>> sparse; // (glyph, value), sorted by glyph
+
+		static constexpr uint16_t ABSENT = 0xFFFF;
+	};
+
+	struct CompiledCoverage
+	{
+		std::optional<size_t> lookup(GlyphId glyph) const;
+
+		CompiledGlyphMap map; // glyph -> coverage index
+	};
+
+	struct CompiledClassDef
+	{
+		uint16_t lookup(GlyphId glyph) const;
+
+		CompiledGlyphMap map; // glyph -> class, without glyphs in class 0 (the default)
+	};
+
+	/*
+	    A GPOS PairPos subtable, compiled (on first use) so that kerning a pair doesn't need to touch the
+	    font data at all. Format 1 subtables (specific glyph pairs) become a sparse map keyed by the pair,
+	    and format 2 subtables (class pairs) become a dense class1 x class2 matrix.
+
+	    Only the placement and advance values are kept (device tables are ignored anyway), as 16-bit integers
+	    to keep the matrix small.
+	*/
+	struct CompiledPairAdjustment
+	{
+		struct ValueRecord
+		{
+			int16_t horz_placement;
+			int16_t vert_placement;
+			int16_t horz_advance;
+			int16_t vert_advance;
+		};
+
+		struct PairValue
+		{
+			ValueRecord first;
+			ValueRecord second;
+		};
+
+		const PairValue* lookup(GlyphId gid1, GlyphId gid2) const;
+
+		uint16_t format = 0;
+
+		// if the value format for a glyph is 0, there is no adjustment for it (as opposed to a zero one)
+		bool has_first = false;
+		bool has_second = false;
+
+		// format 1: keyed by (first << 16) | second
+		util::hashmap<uint32_t, PairValue> pairs;
+
+		// format 2
+		CompiledCoverage coverage;
+		CompiledClassDef class1;
+		CompiledClassDef class2;
+		uint16_t num_class1 = 0;
+		uint16_t num_class2 = 0;
+		std::vector<PairValue> matrix; // indexed by (class1 * num_class2 + class2)
+	};
+
 	struct LookupTable
 	{
 		uint16_t type;
 		uint16_t flags;
 		uint16_t mark_filtering_set;
 		std::vector<zst::byte_span> subtables;
+
+		// keyed by the start of the coverage/classdef table in the font file
+		mutable util::hashmap<const uint8_t*, CompiledCoverage> compiled_coverages {};
+		mutable util::hashmap<const uint8_t*, CompiledClassDef> compiled_classdefs {};
+
+		// only for GPOS pair lookups; one for each subtable (in order)
+		mutable std::optional<std::vector<CompiledPairAdjustment>> compiled_pair_adjustments {};
 	};
 
 	struct GPosTable
@@ -85,31 +175,50 @@ namespace font::off
 	};
 
 
+	/*
+	    The list of lookups (in the order that they should be applied) from the GSUB and GPOS tables
+	    for a particular FeatureSet. Resolving this requires walking the script, language and feature
+	    lists, so it should be compiled once per unique FeatureSet (see FontFile::getShapingPlan), and
+	    then reused for every glyph string that is shaped with that feature set.
+
+	    The pointers point into the `lookups` of the GSubTable and GPosTable that the plan was compiled
+	    from, so the plan must not outlive them.
+	*/
+	struct ShapingPlan
+	{
+		std::vector<const LookupTable*> gsub_lookups;
+		std::vector<const LookupTable*> gpos_lookups;
+	};
+
+	/*
+	    Compile a shaping plan for the given feature set. Either table can be null, in which case the
+	    corresponding list of lookups in the plan is empty.
+	*/
+	ShapingPlan compileShapingPlan(const GSubTable* gsub, const GPosTable* gpos, const FeatureSet& features);
 
 
 
 	/*
 	    Using the GPOS table, try to look for positioning adjustments for the input glyph
-	    sequence, using the enabled features in the `feature_set`.
+	    sequence, applying the GPOS lookups in the given shaping plan.
 
-	    The return type is a map of glyph index (of the input sequence) to a GlyphAdjustment,
-	    if that particular glyph needs to be adjusted. Only glyphs that need to be adjusted
-	    will be part of the map.
+	    The returned vector has one GlyphAdjustment for each glyph in the input sequence (glyphs
+	    that are not adjusted have an all-zero adjustment), or is empty if there are no lookups.
 	*/
-	util::hashmap<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const GPosTable& font,
+	std::vector<GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const GPosTable& font,
 	    zst::span<GlyphId> glyphs,
-	    const FeatureSet& features);
+	    const ShapingPlan& plan);
 
 
 	/*
-	    Using the GSUB table, perform glyph substitutions using the enabled features in the feature set.
+	    Using the GSUB table, perform glyph substitutions by applying the GSUB lookups in the given shaping plan.
 
 	    For simplicity of use, this API returns a vector of glyphs, which *wholesale* replace the
 	    input glyph sequence -- even if no substitutions took place.
 	*/
 	SubstitutedGlyphString performSubstitutionsForGlyphSequence(const GSubTable& gsub,
 	    zst::span<GlyphId> glyphs,
-	    const FeatureSet& features);
+	    const ShapingPlan& plan);
 
 
 	/*
@@ -180,6 +289,17 @@ namespace font::off
 	*/
 	uint16_t getGlyphClass(zst::byte_span classdef_table, GlyphId glyphId);
 
+	/*
+	    Same as above, but using (and caching) the compiled form of the classdef table on the given lookup;
+	    the classdef table should be one that is used by a subtable of the lookup.
+	*/
+	uint16_t getGlyphClass(const LookupTable& lookup, zst::byte_span classdef_table, GlyphId glyphId);
+
+	/*
+	    Compile a ClassDef table; see CompiledClassDef.
+	*/
+	CompiledClassDef compileClassDefTable(zst::byte_span classdef_table);
+
 	/*
 	    Returns a mapping from classid to a set of glyph ids. Note that class 0 (the default class)
 	    is not included, because it would otherwise contain every other glyph (potentially a lot)
@@ -199,6 +319,18 @@ namespace font::off
 	*/
 	std::optional<size_t> getGlyphCoverageIndex(zst::byte_span coverage_table, GlyphId glyphId);
 
+	/*
+	    Same as above, but using (and caching) the compiled form of the coverage table on the given lookup.
+	*/
+	std::optional<size_t> getGlyphCoverageIndex(const LookupTable& lookup,
+	    zst::byte_span coverage_table,
+	    GlyphId glyphId);
+
+	/*
+	    Compile a Coverage table; see CompiledCoverage.
+	*/
+	CompiledCoverage compileCoverageTable(zst::byte_span coverage_table);
+
 	/*
 	    Returns a map from coverageIndex -> glyphId, for every glyph in the coverage table.
 	*/
@@ -212,7 +344,8 @@ namespace font::off
 
 	/*
 	    Parse and match the input glyphstring with the lookup *subtable* provided. Again, this should be a
-	    lookup *subtable*, not the LookupTable itself.
+	    lookup *subtable*, not the LookupTable itself; the lookup is only used to cache the compiled coverage
+	    and classdef tables.
 
 	    Returns value:
 	        (first)  the list of lookup records, PosLookupRecord / SubstLookupRecord
@@ -221,16 +354,18 @@ namespace font::off
 	    The data layouts for GPOS and GSUB are identical, so this is a common implementation. Use for GPOS type 7
 	    and GSUB type 5.
 	*/
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(zst::byte_span
-	                                                                                                  subtable,
+	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(const LookupTable&
+	                                                                                                  lookup,
+	    zst::byte_span subtable,
 	    zst::span<GlyphId> glyphs);
 
 	/*
 	    Parse and match the input glyphstring (where the current glyph is at glyphs[position], using the provided
 	   *subtable*. The same caveats apply as for `performContextualLookup`. Use for GPOS type 8 and GSUB type 6.
 	*/
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(zst::byte_span
-	                                                                                                      subtable,
+	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(const LookupTable&
+	                                                                                                      lookup,
+	    zst::byte_span subtable,
 	    zst::span<GlyphId> glyphs,
 	    size_t position);
 }
@@ -270,6 +405,11 @@ namespace font::off::gpos
 	*/
 	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const LookupTable& lookup, GlyphId gid1, GlyphId gid2);
 
+	/*
+	    Compile all the subtables of a pair lookup; see CompiledPairAdjustment.
+	*/
+	std::vector<CompiledPairAdjustment> compilePairAdjustmentLookup(const LookupTable& lookup);
+
 
 	struct AdjustmentResult
 	{
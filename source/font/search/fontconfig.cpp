@@ -271,6 +271,8 @@ namespace font::fontconfig
 				break;
 			}
 
+			// FcFontSetAdd takes ownership of the pattern, but `list` also owns it.
+			FcPatternReference(list->fonts[i]);
 			FcFontSetAdd(actual_matches, list->fonts[i]);
 		}
 
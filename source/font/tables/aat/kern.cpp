@@ -49,11 +49,11 @@ namespace font::aat
 			auto first_glyph = consume_u16(table);
 			auto num_glyphs = consume_u16(table);
 
-			util::hashmap<GlyphId, uint16_t> glyphs {};
+			std::vector<std::pair<GlyphId, uint16_t>> glyphs {};
 			for(auto i = 0u; i < num_glyphs; i++)
-				glyphs[GlyphId(first_glyph + i)] = consume_u16(table);
+				glyphs.emplace_back(GlyphId(first_glyph + i), consume_u16(table));
 
-			return glyphs;
+			return GlyphMap<uint16_t>::build(std::move(glyphs));
 		};
 
 		ret.left_glyph_classes = parse_class_table(left_class_table);
@@ -239,20 +239,15 @@ namespace font::aat
 		{
 			for(auto& sub : table.subtables_f2)
 			{
-				uint16_t left_class = 0;
-				uint16_t right_class = 0;
-
-				if(auto it = sub.left_glyph_classes.find(left); it != sub.left_glyph_classes.end())
-					left_class = it->second;
-				else
+				auto left_class = sub.left_glyph_classes.get(left);
+				if(not left_class.has_value())
 					continue;
 
-				if(auto it = sub.right_glyph_classes.find(right); it != sub.right_glyph_classes.end())
-					right_class = it->second;
-				else
+				auto right_class = sub.right_glyph_classes.get(right);
+				if(not right_class.has_value())
 					continue;
 
-				auto shift = FontScalar(peek_i16(sub.lookup_array.drop(left_class + right_class)));
+				auto shift = FontScalar(peek_i16(sub.lookup_array.drop(*left_class + *right_class)));
 				add_adjustment(shift, sub.coverage);
 			}
 		}
@@ -263,14 +258,14 @@ namespace font::aat
 			return std::nullopt;
 	}
 
-	util::hashmap<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const KernTable& table,
+	std::vector<GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const KernTable& table,
 	    zst::span<GlyphId> glyphs,
 	    const FeatureSet& features)
 	{
 		if(glyphs.size() < 2 || features.is_disabled(feature::kern))
 			return {};
 
-		util::hashmap<size_t, GlyphAdjustment> adjustments {};
+		std::vector<GlyphAdjustment> adjustments(glyphs.size());
 
 		// kern table only has pairs, so this is easy.
 		for(size_t i = 0; i < glyphs.size() - 1; i++)
@@ -286,7 +281,7 @@ namespace font::aat
 
 namespace font
 {
-	void FontFile::parse_kern_table(const Table& table)
+	void FontFile::parse_kern_table(const Table& table) const
 	{
 		auto buf = this->bytes().drop(table.offset);
 		auto version = consume_u16(buf);
@@ -43,29 +43,34 @@ namespace font::aat
 
 	static Lookup read_lookup_f0(zst::byte_span buf, size_t num_glyphs)
 	{
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(size_t i = 0; i < num_glyphs; i++)
-			ret.map[GlyphId(i)] = consume_u16(buf);
+			entries.emplace_back(GlyphId(i), consume_u16(buf));
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	static Lookup read_lookup_f2(zst::byte_span buf)
 	{
 		auto [num_elems, lookup_size] = parse_binsearch_header(buf, 2 * sizeof(uint16_t));
 
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(auto i = 0u; i < num_elems; i++)
 		{
 			auto last_glyph = consume_u16(buf);
 			auto first_glyph = consume_u16(buf);
 
 			auto lookup_value = read_lookup(buf, lookup_size);
-			for(uint16_t g = first_glyph; g <= last_glyph; g++)
-				ret.map[GlyphId(g)] = lookup_value;
+
+			// skip the terminating segment
+			if(first_glyph == 0xFFFF && last_glyph == 0xFFFF)
+				continue;
+
+			for(uint32_t g = first_glyph; g <= last_glyph; g++)
+				entries.emplace_back(GlyphId(g), lookup_value);
 		}
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	static Lookup read_lookup_f4(zst::byte_span buf, zst::byte_span table_start)
@@ -74,35 +79,38 @@ namespace font::aat
 		auto [num_elems, lookup_size] = parse_binsearch_header(buf, 2 * sizeof(uint16_t));
 		assert(lookup_size == sizeof(uint16_t));
 
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(auto i = 0u; i < num_elems; i++)
 		{
 			auto last_glyph = consume_u16(buf);
 			auto first_glyph = consume_u16(buf);
 
 			auto offset = consume_u16(buf);
-			auto data = table_start.drop(offset);
+			if(first_glyph == 0xFFFF && last_glyph == 0xFFFF)
+				continue;
 
-			for(uint16_t g = first_glyph; g <= last_glyph; g++)
-				ret.map[GlyphId(g)] = consume_u16(data);
+			auto data = table_start.drop(offset);
+			for(uint32_t g = first_glyph; g <= last_glyph; g++)
+				entries.emplace_back(GlyphId(g), consume_u16(data));
 		}
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	static Lookup read_lookup_f6(zst::byte_span buf)
 	{
 		auto [num_elems, lookup_size] = parse_binsearch_header(buf, sizeof(uint16_t));
 
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(auto i = 0u; i < num_elems; i++)
 		{
 			auto gid = consume_u16(buf);
 			auto val = read_lookup(buf, lookup_size);
-			ret.map[GlyphId(gid)] = val;
+			if(gid != 0xFFFF)
+				entries.emplace_back(GlyphId(gid), val);
 		}
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	static Lookup read_lookup_f8(zst::byte_span buf)
@@ -110,11 +118,11 @@ namespace font::aat
 		auto first_glyph = consume_u16(buf);
 		auto num_glyphs = consume_u16(buf);
 
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(auto i = 0u; i < num_glyphs; i++)
-			ret.map[GlyphId(first_glyph + i)] = consume_u16(buf);
+			entries.emplace_back(GlyphId(first_glyph + i), consume_u16(buf));
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	static Lookup read_lookup_f10(zst::byte_span buf)
@@ -125,11 +133,11 @@ namespace font::aat
 		auto first_glyph = consume_u16(buf);
 		auto num_glyphs = consume_u16(buf);
 
-		Lookup ret {};
+		std::vector<std::pair<GlyphId, uint64_t>> entries {};
 		for(auto i = 0u; i < num_glyphs; i++)
-			ret.map[GlyphId(first_glyph + i)] = read_lookup(buf, elem_size);
+			entries.emplace_back(GlyphId(first_glyph + i), read_lookup(buf, elem_size));
 
-		return ret;
+		return Lookup { .map = GlyphMap<uint64_t>::build(std::move(entries)) };
 	}
 
 	std::optional<Lookup> parseLookupTable(zst::byte_span buf, size_t num_glyphs)
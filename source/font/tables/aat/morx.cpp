@@ -64,7 +64,7 @@ namespace font::aat
 
 	static MorxNonContextualSubtable parse_non_contextual_subtable(zst::byte_span buf, size_t num_glyphs)
 	{
-		return MorxNonContextualSubtable { .lookup = buf };
+		return MorxNonContextualSubtable { .lookup = parseLookupTable(buf, num_glyphs).value_or(Lookup {}) };
 	}
 
 	static MorxInsertionSubtable parse_insertion_subtable(zst::byte_span buf, size_t num_glyphs)
@@ -183,11 +183,7 @@ namespace font::aat
 
 		while(i < glyphs.size())
 		{
-			uint16_t glyph_class = 0;
-			if(auto it = machine.glyph_classes.find(glyphs[i]); it != machine.glyph_classes.end())
-				glyph_class = it->second;
-			else
-				glyph_class = CLASS_CODE_OUT_OF_BOUNDS;
+			auto glyph_class = machine.glyph_classes.get(glyphs[i]).value_or(CLASS_CODE_OUT_OF_BOUNDS);
 
 			auto entry_idx = get_entry_index_for_state(machine, current_state, glyph_class);
 			auto entry_start = machine.entry_array.drop(entry_idx * EntrySize);
@@ -513,6 +509,19 @@ namespace font::aat
 		return ret;
 	}
 
+	static const Lookup& get_substitution_table(const MorxContextualSubtable& table,
+	    uint16_t index,
+	    size_t num_font_glyphs)
+	{
+		if(auto it = table.compiled_substitutions.find(index); it != table.compiled_substitutions.end())
+			return it->second;
+
+		auto subst_offsets = table.substitution_tables.cast<uint32_t, std::endian::big>();
+		auto lookup = parseLookupTable(table.substitution_tables.drop(subst_offsets[index]), num_font_glyphs);
+
+		return table.compiled_substitutions.emplace(index, std::move(lookup).value_or(Lookup {})).first->second;
+	}
+
 	std::optional<SubstitutedGlyphString> apply_table(const MorxContextualSubtable& table,
 	    zst::span<GlyphId> glyphs,
 	    bool is_reverse,
@@ -530,26 +539,21 @@ namespace font::aat
 			auto mark_idx = consume_u16(extra);
 			auto curr_idx = consume_u16(extra);
 
-			auto subst_offsets = table.substitution_tables.cast<uint32_t, std::endian::big>();
-
 			if(mark_idx != 0xffff)
 			{
 				did_substitute = true;
-				auto offset = subst_offsets[mark_idx];
-				auto lookup_table = table.substitution_tables.drop(offset);
+				auto& lookup = get_substitution_table(table, mark_idx, num_font_glyphs);
 
-				if(auto rep = searchLookupTable(lookup_table, num_font_glyphs, glyphs[marked_glyph_idx]);
-				    rep.has_value())
+				if(auto rep = lookup.map.get(glyphs[marked_glyph_idx]); rep.has_value())
 					replacements[marked_glyph_idx] = GlyphId(*rep);
 			}
 
 			if(curr_idx != 0xffff)
 			{
 				did_substitute = true;
-				auto offset = subst_offsets[curr_idx];
-				auto lookup_table = table.substitution_tables.drop(offset);
+				auto& lookup = get_substitution_table(table, curr_idx, num_font_glyphs);
 
-				if(auto rep = searchLookupTable(lookup_table, num_font_glyphs, glyphs[idx]); rep.has_value())
+				if(auto rep = lookup.map.get(glyphs[idx]); rep.has_value())
 					replacements[idx] = GlyphId(*rep);
 			}
 
@@ -585,7 +589,7 @@ namespace font::aat
 		util::hashmap<size_t, GlyphId> replacements {};
 		for(size_t i = 0; i < glyphs.size(); i++)
 		{
-			if(auto ret = searchLookupTable(table.lookup, num_font_glyphs, glyphs[i]); ret.has_value())
+			if(auto ret = table.lookup.map.get(glyphs[i]); ret.has_value())
 				replacements[i] = GlyphId(*ret);
 		}
 
@@ -769,7 +773,7 @@ namespace font::aat
 
 namespace font
 {
-	void FontFile::parse_morx_table(const Table& morx)
+	void FontFile::parse_morx_table(const Table& morx) const
 	{
 		auto buf = this->bytes().drop(morx.offset);
 		auto version = consume_u16(buf);
@@ -9,9 +9,19 @@ namespace font::aat
 {
 	static void parse_class_subtable_stx(StateTable& state_table, zst::byte_span buf, size_t num_glyphs)
 	{
-		auto lookup = *parseLookupTable(buf, num_glyphs);
-		for(auto& [a, b] : lookup.map)
-			state_table.glyph_classes[a] = static_cast<uint16_t>(b);
+		auto lookup = parseLookupTable(buf, num_glyphs);
+		if(not lookup.has_value())
+			return;
+
+		// the classes are only 16 bits, so don't keep them as u64s.
+		std::vector<std::pair<GlyphId, uint16_t>> classes {};
+		for(auto i = 0u; i < num_glyphs; i++)
+		{
+			if(auto cls = lookup->map.get(GlyphId(i)); cls.has_value())
+				classes.emplace_back(GlyphId(i), static_cast<uint16_t>(*cls));
+		}
+
+		state_table.glyph_classes = GlyphMap<uint16_t>::build(std::move(classes));
 	}
 
 	static void parse_class_subtable(StateTable& state_table, zst::byte_span buf)
@@ -19,8 +29,11 @@ namespace font::aat
 		auto first_glyph = consume_u16(buf);
 		auto num_glyphs = consume_u16(buf);
 
+		std::vector<std::pair<GlyphId, uint16_t>> classes {};
 		for(auto i = 0u; i < num_glyphs; i++)
-			state_table.glyph_classes[GlyphId(first_glyph + i)] = consume_u8(buf);
+			classes.emplace_back(GlyphId(first_glyph + i), consume_u8(buf));
+
+		state_table.glyph_classes = GlyphMap<uint16_t>::build(std::move(classes));
 	}
 
 	static StateTable parse_state_table(zst::byte_span& buf, bool is_stx, size_t num_font_glyphs)
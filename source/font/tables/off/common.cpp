@@ -61,6 +61,30 @@ namespace font::off
 	template std::vector<uint16_t> getLookupTablesForFeatures<GSubTable>(const GSubTable& table,
 	    const FeatureSet& features);
 
+	ShapingPlan compileShapingPlan(const GSubTable* gsub, const GPosTable* gpos, const FeatureSet& features)
+	{
+		ShapingPlan plan {};
+		if(gsub != nullptr)
+		{
+			for(auto lookup_idx : getLookupTablesForFeatures(*gsub, features))
+			{
+				assert(lookup_idx < gsub->lookups.size());
+				plan.gsub_lookups.push_back(&gsub->lookups[lookup_idx]);
+			}
+		}
+
+		if(gpos != nullptr)
+		{
+			for(auto lookup_idx : getLookupTablesForFeatures(*gpos, features))
+			{
+				assert(lookup_idx < gpos->lookups.size());
+				plan.gpos_lookups.push_back(&gpos->lookups[lookup_idx]);
+			}
+		}
+
+		return plan;
+	}
+
 	static Language parse_one_language(Tag tag, zst::byte_span buf)
 	{
 		Language lang {};
@@ -245,12 +269,12 @@ namespace font::off
 
 namespace font
 {
-	void FontFile::parse_gsub_table(const Table& table)
+	void FontFile::parse_gsub_table(const Table& table) const
 	{
 		m_gsub_table = off::parse_gpos_or_gsub_table<off::GSubTable>(this->bytes().drop(table.offset));
 	}
 
-	void FontFile::parse_gpos_table(const Table& table)
+	void FontFile::parse_gpos_table(const Table& table) const
 	{
 		m_gpos_table = off::parse_gpos_or_gsub_table<off::GPosTable>(this->bytes().drop(table.offset));
 	}
@@ -26,8 +26,9 @@ namespace font::off
 		return ret;
 	}
 
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(zst::byte_span
-	                                                                                                  subtable,
+	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performContextualLookup(const LookupTable&
+	                                                                                                  lookup,
+	    zst::byte_span subtable,
 	    zst::span<GlyphId> glyphs)
 	{
 		auto subtable_start = subtable;
@@ -52,7 +53,7 @@ namespace font::off
 			{
 				// basically, the idea is that for glyph[i], it must appear in coverage[i].
 				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[i]).has_value())
+				if(!getGlyphCoverageIndex(lookup, coverage, glyphs[i]).has_value())
 					return std::nullopt;
 			}
 
@@ -65,7 +66,7 @@ namespace font::off
 
 			// both formats 1 and 2 uses a coverage table to gate the first glyph. If the first
 			// glyph in our sequence is not covered, skip this subtable.
-			auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), glyphs[0]);
+			auto cov_idx = off::getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), glyphs[0]);
 			if(!cov_idx.has_value())
 				return std::nullopt;
 
@@ -123,16 +124,13 @@ namespace font::off
 				auto classdef_ofs = consume_u16(subtable);
 
 				/*
-				    Here, we don't parse the entire table at once, but rather lookup the classdef table
-				    separately. We can perform a binary search on the table, so it's not too slow.
-
-				    Building a datastructure (ie. parsing the whole table) is probably not a good idea,
-				    since it won't (and can't, for now...) be cached between lookups.
+				    The classdef table is compiled on first use and cached on the lookup, so each
+				    class lookup after that is just an array access.
 				*/
 				auto classdef_table = subtable_start.drop(classdef_ofs);
 				auto num_class_sets = consume_u16(subtable);
 
-				auto first_class_id = getGlyphClass(classdef_table, glyphs[0]);
+				auto first_class_id = getGlyphClass(lookup, classdef_table, glyphs[0]);
 				assert(first_class_id < num_class_sets);
 
 				auto classset = subtable_start.drop(peek_u16(subtable
@@ -143,9 +141,8 @@ namespace font::off
 				for(size_t i = 0; i < num_rules; i++)
 				{
 					auto rule = classset_start.drop(consume_u16(classset));
-					auto [matched, num_glyphs, num_records] = try_match_rule(rule, [&classdef_table](auto gid) {
-						return getGlyphClass(classdef_table, gid);
-					});
+					auto [matched, num_glyphs, num_records] = try_match_rule(rule,
+					    [&lookup, &classdef_table](auto gid) { return getGlyphClass(lookup, classdef_table, gid); });
 
 					if(matched)
 						return std::pair(parse_records(num_records, rule), num_glyphs);
@@ -157,8 +154,9 @@ namespace font::off
 	}
 
 
-	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(zst::byte_span
-	                                                                                                      subtable,
+	std::optional<std::pair<std::vector<ContextualLookupRecord>, size_t>> performChainedContextLookup(const LookupTable&
+	                                                                                                      lookup,
+	    zst::byte_span subtable,
 	    zst::span<GlyphId> glyphs,
 	    size_t position)
 	{
@@ -189,7 +187,7 @@ namespace font::off
 			for(size_t k = 0; k < num_lookbehind; k++)
 			{
 				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position - k - 1]).has_value())
+				if(!getGlyphCoverageIndex(lookup, coverage, glyphs[position - k - 1]).has_value())
 					return std::nullopt;
 			}
 
@@ -197,7 +195,7 @@ namespace font::off
 			for(size_t k = 0; k < num_glyphs; k++)
 			{
 				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position + k]).has_value())
+				if(!getGlyphCoverageIndex(lookup, coverage, glyphs[position + k]).has_value())
 					return std::nullopt;
 			}
 
@@ -205,7 +203,7 @@ namespace font::off
 			for(size_t k = 0; k < num_lookahead; k++)
 			{
 				auto coverage = subtable_start.drop(consume_u16(subtable));
-				if(!getGlyphCoverageIndex(coverage, glyphs[position + num_glyphs + k]).has_value())
+				if(!getGlyphCoverageIndex(lookup, coverage, glyphs[position + num_glyphs + k]).has_value())
 					return std::nullopt;
 			}
 
@@ -220,7 +218,7 @@ namespace font::off
 
 			// both formats 1 and 2 uses a coverage table to gate the first glyph. If the first
 			// glyph in our sequence is not covered, skip this subtable.
-			auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), glyphs[position]);
+			auto cov_idx = off::getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), glyphs[position]);
 			if(!cov_idx.has_value())
 				return std::nullopt;
 
@@ -300,7 +298,7 @@ namespace font::off
 
 				auto num_class_sets = consume_u16(subtable);
 
-				auto first_class_id = getGlyphClass(input_classdefs, glyphs[position]);
+				auto first_class_id = getGlyphClass(lookup, input_classdefs, glyphs[position]);
 				assert(first_class_id < num_class_sets);
 
 				auto classset = subtable_start.drop(peek_u16(subtable
@@ -311,14 +309,16 @@ namespace font::off
 				for(size_t i = 0; i < num_rules; i++)
 				{
 					auto rule = classset_start.drop(consume_u16(classset));
-					auto lookbehind_trf = [&lookbehind_classdefs](GlyphId gid) {
-						return getGlyphClass(lookbehind_classdefs, gid);
+					auto lookbehind_trf = [&lookup, &lookbehind_classdefs](GlyphId gid) {
+						return getGlyphClass(lookup, lookbehind_classdefs, gid);
 					};
 
-					auto input_trf = [&input_classdefs](GlyphId gid) { return getGlyphClass(input_classdefs, gid); };
+					auto input_trf = [&lookup, &input_classdefs](GlyphId gid) {
+						return getGlyphClass(lookup, input_classdefs, gid);
+					};
 
-					auto lookahead_trf = [&lookahead_classdefs](GlyphId gid) {
-						return getGlyphClass(lookahead_classdefs, gid);
+					auto lookahead_trf = [&lookup, &lookahead_classdefs](GlyphId gid) {
+						return getGlyphClass(lookup, lookahead_classdefs, gid);
 					};
 
 					if(auto [match, num_glyphs] = try_match_rule(rule, lookbehind_trf, input_trf, lookahead_trf); match)
@@ -114,3 +114,81 @@ namespace font::off
 		}
 	}
 }
+
+namespace font::off
+{
+	CompiledGlyphMap CompiledGlyphMap::compile(std::vector<std::pair<uint16_t, uint16_t>> entries)
+	{
+		CompiledGlyphMap ret {};
+		if(entries.empty())
+			return ret;
+
+		std::sort(entries.begin(), entries.end());
+
+		auto first = entries.front().first;
+		auto span = size_t(entries.back().first - first) + 1;
+
+		// if most of the glyphs in the range are present, just use a dense array.
+		if(span <= std::max(size_t(64), 4 * entries.size()))
+		{
+			ret.first_glyph = first;
+			ret.dense.resize(span, ABSENT);
+
+			for(auto& [gid, value] : entries)
+				ret.dense[gid - first] = value;
+		}
+		else
+		{
+			ret.sparse = std::move(entries);
+		}
+
+		return ret;
+	}
+
+	std::optional<uint16_t> CompiledGlyphMap::lookup(GlyphId glyph) const
+	{
+		auto gid = static_cast<uint32_t>(glyph);
+		if(not this->dense.empty())
+		{
+			if(gid < this->first_glyph || gid - this->first_glyph >= this->dense.size())
+				return std::nullopt;
+
+			if(auto value = this->dense[gid - this->first_glyph]; value != ABSENT)
+				return value;
+
+			return std::nullopt;
+		}
+
+		auto it = std::lower_bound(this->sparse.begin(), this->sparse.end(), gid,
+		    [](const auto& pair, uint32_t g) { return pair.first < g; });
+
+		if(it != this->sparse.end() && it->first == gid)
+			return it->second;
+
+		return std::nullopt;
+	}
+
+	CompiledCoverage compileCoverageTable(zst::byte_span cov_table)
+	{
+		// parseCoverageTable gives us coverage index -> glyph; we want the reverse.
+		std::vector<std::pair<uint16_t, uint16_t>> entries {};
+		for(auto& [cov_idx, gid] : parseCoverageTable(cov_table))
+			entries.emplace_back(static_cast<uint16_t>(gid), static_cast<uint16_t>(cov_idx));
+
+		return CompiledCoverage { .map = CompiledGlyphMap::compile(std::move(entries)) };
+	}
+
+	std::optional<size_t> CompiledCoverage::lookup(GlyphId glyph) const
+	{
+		return this->map.lookup(glyph);
+	}
+
+	std::optional<size_t> getGlyphCoverageIndex(const LookupTable& lookup, zst::byte_span cov_table, GlyphId glyphId)
+	{
+		auto it = lookup.compiled_coverages.find(cov_table.data());
+		if(it == lookup.compiled_coverages.end())
+			it = lookup.compiled_coverages.emplace(cov_table.data(), compileCoverageTable(cov_table)).first;
+
+		return it->second.lookup(glyphId);
+	}
+}
@@ -120,3 +120,32 @@ namespace font::off
 		return class_ids;
 	}
 }
+
+namespace font::off
+{
+	CompiledClassDef compileClassDefTable(zst::byte_span table)
+	{
+		std::vector<std::pair<uint16_t, uint16_t>> entries {};
+		parse_classdef_table(table, [&](uint16_t cls, GlyphId gid) {
+			// class 0 is the default anyway, so there's no need to store it.
+			if(cls != 0)
+				entries.emplace_back(static_cast<uint16_t>(gid), cls);
+		});
+
+		return CompiledClassDef { .map = CompiledGlyphMap::compile(std::move(entries)) };
+	}
+
+	uint16_t CompiledClassDef::lookup(GlyphId glyph) const
+	{
+		return this->map.lookup(glyph).value_or(0);
+	}
+
+	uint16_t getGlyphClass(const LookupTable& lookup, zst::byte_span table, GlyphId glyphId)
+	{
+		auto it = lookup.compiled_classdefs.find(table.data());
+		if(it == lookup.compiled_classdefs.end())
+			it = lookup.compiled_classdefs.emplace(table.data(), compileClassDefTable(table)).first;
+
+		return it->second.lookup(glyphId);
+	}
+}
@@ -180,7 +180,8 @@ namespace font::off::gpos
 				continue;
 			}
 
-			if(auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), gid); cov_idx.has_value())
+			auto cov_idx = off::getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), gid);
+			if(cov_idx.has_value())
 			{
 				if(format == 1)
 				{
@@ -200,9 +201,37 @@ namespace font::off::gpos
 		return std::nullopt;
 	}
 
-	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const LookupTable& lookup, GlyphId gid1, GlyphId gid2)
+	static CompiledPairAdjustment::ValueRecord compile_value_record(const OptionalGA& adj)
+	{
+		if(not adj.has_value())
+			return {};
+
+		return CompiledPairAdjustment::ValueRecord {
+			.horz_placement = static_cast<int16_t>(adj->horz_placement.value()),
+			.vert_placement = static_cast<int16_t>(adj->vert_placement.value()),
+			.horz_advance = static_cast<int16_t>(adj->horz_advance.value()),
+			.vert_advance = static_cast<int16_t>(adj->vert_advance.value()),
+		};
+	}
+
+	static OptionalGA to_adjustment(const CompiledPairAdjustment::ValueRecord& rec, bool present)
+	{
+		if(not present)
+			return std::nullopt;
+
+		return GlyphAdjustment {
+			.horz_placement = FontScalar(rec.horz_placement),
+			.vert_placement = FontScalar(rec.vert_placement),
+			.horz_advance = FontScalar(rec.horz_advance),
+			.vert_advance = FontScalar(rec.vert_advance),
+		};
+	}
+
+	std::vector<CompiledPairAdjustment> compilePairAdjustmentLookup(const LookupTable& lookup)
 	{
 		assert(lookup.type == LOOKUP_PAIR);
+
+		std::vector<CompiledPairAdjustment> ret {};
 		for(auto subtable : lookup.subtables)
 		{
 			auto subtable_start = subtable;
@@ -218,87 +247,91 @@ namespace font::off::gpos
 				continue;
 			}
 
-			// the coverage table only lists the first glyph id.
-			if(auto cov_idx = off::getGlyphCoverageIndex(subtable_start.drop(cov_ofs), gid1); cov_idx.has_value())
+			auto& compiled = ret.emplace_back();
+			compiled.format = format;
+			compiled.has_first = (value_fmt1 != 0);
+			compiled.has_second = (value_fmt2 != 0);
+
+			auto read_pair_value = [value_fmt1, value_fmt2](zst::byte_span& buf) {
+				auto a1 = parse_value_record(buf, value_fmt1);
+				auto a2 = parse_value_record(buf, value_fmt2);
+
+				return CompiledPairAdjustment::PairValue {
+					.first = compile_value_record(a1),
+					.second = compile_value_record(a2),
+				};
+			};
+
+			if(format == 1)
 			{
-				if(format == 1)
-				{
-					auto num_pair_sets = consume_u16(subtable);
-					assert(*cov_idx < num_pair_sets);
+				auto num_pair_sets = consume_u16(subtable);
+				const auto PairRecordSize = sizeof(uint16_t) + get_value_record_size(value_fmt1)
+				                          + get_value_record_size(value_fmt2);
 
-					const auto PairRecordSize = sizeof(uint16_t) + get_value_record_size(value_fmt1)
-					                          + get_value_record_size(value_fmt2);
+				// the coverage table only lists the first glyph id.
+				for(auto& [cov_idx, gid1] : parseCoverageTable(subtable_start.drop(cov_ofs)))
+				{
+					if(cov_idx >= num_pair_sets)
+						continue;
 
-					auto pairset_offset = peek_u16(subtable.drop(*cov_idx * sizeof(uint16_t)));
+					auto pairset_offset = peek_u16(subtable.drop(static_cast<size_t>(cov_idx) * sizeof(uint16_t)));
 					auto pairset_table = subtable_start.drop(pairset_offset);
 
 					auto num_pairs = consume_u16(pairset_table);
-
-					// now, binary search the second set.
-					size_t low = 0;
-					size_t high = num_pairs;
-
-					while(low < high)
+					for(size_t i = 0; i < num_pairs; i++)
 					{
-						auto mid = (low + high) / 2u;
-						auto glyph = GlyphId { peek_u16(pairset_table.drop(mid * PairRecordSize)) };
-
-						if(glyph == gid2)
-						{
-							// we need to drop the glyph id itself to get to the actual data
-							auto tmp = pairset_table.drop(mid * PairRecordSize).drop(sizeof(uint16_t));
-
-							auto a1 = parse_value_record(tmp, value_fmt1);
-							auto a2 = parse_value_record(tmp, value_fmt2);
-
-							return std::make_pair(a1, a2);
-						}
-						else if(glyph < gid2)
-						{
-							low = mid + 1;
-						}
-						else
-						{
-							high = mid;
-						}
+						auto tmp = pairset_table.drop(i * PairRecordSize);
+						auto gid2 = consume_u16(tmp);
+
+						auto key = (static_cast<uint32_t>(gid1) << 16) | gid2;
+						compiled.pairs.emplace(key, read_pair_value(tmp));
 					}
 				}
-				else
-				{
-					auto cls_ofs1 = consume_u16(subtable);
-					auto cls_ofs2 = consume_u16(subtable);
-
-					auto num_cls1 = consume_u16(subtable);
-					auto num_cls2 = consume_u16(subtable);
-
-					auto g1_class = off::getGlyphClass(subtable_start.drop(cls_ofs1), gid1);
-					auto g2_class = off::getGlyphClass(subtable_start.drop(cls_ofs2), gid2);
+			}
+			else
+			{
+				auto cls_ofs1 = consume_u16(subtable);
+				auto cls_ofs2 = consume_u16(subtable);
 
-					// note that num_cls1/2 include class 0
-					if(g1_class < num_cls1 && g2_class < num_cls2)
-					{
-						const auto RecordSize = get_value_record_size(value_fmt1) + get_value_record_size(value_fmt2);
+				compiled.num_class1 = consume_u16(subtable);
+				compiled.num_class2 = consume_u16(subtable);
 
-						// skip all the way to the correct Class2Record
-						auto cls2_start = subtable.drop(g1_class * num_cls2 * RecordSize);
-						auto pair_start = cls2_start.drop(g2_class * RecordSize);
+				compiled.coverage = compileCoverageTable(subtable_start.drop(cov_ofs));
+				compiled.class1 = compileClassDefTable(subtable_start.drop(cls_ofs1));
+				compiled.class2 = compileClassDefTable(subtable_start.drop(cls_ofs2));
 
-						auto a1 = parse_value_record(pair_start, value_fmt1);
-						auto a2 = parse_value_record(pair_start, value_fmt2);
+				// the Class1Records are laid out row-major, so we can just read them in order.
+				auto num_records = size_t(compiled.num_class1) * compiled.num_class2;
+				compiled.matrix.reserve(num_records);
 
-						return std::make_pair(a1, a2);
-					}
-				}
+				for(size_t i = 0; i < num_records; i++)
+					compiled.matrix.push_back(read_pair_value(subtable));
 			}
 		}
 
-		return { std::nullopt, std::nullopt };
+		return ret;
 	}
 
+	std::pair<OptionalGA, OptionalGA> lookupPairAdjustment(const LookupTable& lookup, GlyphId gid1, GlyphId gid2)
+	{
+		assert(lookup.type == LOOKUP_PAIR);
 
+		if(not lookup.compiled_pair_adjustments.has_value())
+			lookup.compiled_pair_adjustments = compilePairAdjustmentLookup(lookup);
 
+		for(auto& subtable : *lookup.compiled_pair_adjustments)
+		{
+			if(auto value = subtable.lookup(gid1, gid2); value != nullptr)
+			{
+				return {
+					to_adjustment(value->first, subtable.has_first),
+					to_adjustment(value->second, subtable.has_second),
+				};
+			}
+		}
 
-
+		return { std::nullopt, std::nullopt };
+	}
 
 	using PosLookupRecord = ContextualLookupRecord;
 	static std::optional<AdjustmentResult> apply_lookup_records(const GPosTable& gpos,
@@ -332,7 +365,7 @@ namespace font::off::gpos
 		assert(lookup.type == LOOKUP_CONTEXTUAL);
 		for(auto subtable : lookup.subtables)
 		{
-			if(auto records = performContextualLookup(subtable, glyphs); records.has_value())
+			if(auto records = performContextualLookup(lookup, subtable, glyphs); records.has_value())
 				return apply_lookup_records(gpos, *records, glyphs, /* pos: */ 0);
 		}
 
@@ -349,7 +382,7 @@ namespace font::off::gpos
 
 		for(auto subtable : lookup.subtables)
 		{
-			if(auto records = performChainedContextLookup(subtable, glyphs, position); records.has_value())
+			if(auto records = performChainedContextLookup(lookup, subtable, glyphs, position); records.has_value())
 				return apply_lookup_records(gpos, *records, glyphs, /* pos: */ position);
 		}
 
@@ -360,9 +393,38 @@ namespace font::off::gpos
 
 namespace font::off
 {
-	util::hashmap<size_t, GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const GPosTable& gpos,
+	const CompiledPairAdjustment::PairValue* CompiledPairAdjustment::lookup(GlyphId gid1, GlyphId gid2) const
+	{
+		if(this->format == 1)
+		{
+			if(static_cast<uint32_t>(gid1) > 0xFFFF || static_cast<uint32_t>(gid2) > 0xFFFF)
+				return nullptr;
+
+			auto key = (static_cast<uint32_t>(gid1) << 16) | static_cast<uint32_t>(gid2);
+			if(auto it = this->pairs.find(key); it != this->pairs.end())
+				return &it->second;
+
+			return nullptr;
+		}
+
+		// the coverage table only lists the first glyph id; note that once the first glyph is covered,
+		// the pair matches even if the second glyph is in class 0.
+		if(not this->coverage.lookup(gid1).has_value())
+			return nullptr;
+
+		auto c1 = this->class1.lookup(gid1);
+		auto c2 = this->class2.lookup(gid2);
+
+		// note that num_class1/2 include class 0
+		if(c1 >= this->num_class1 || c2 >= this->num_class2)
+			return nullptr;
+
+		return &this->matrix[size_t(c1) * this->num_class2 + c2];
+	}
+
+	std::vector<GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(const GPosTable& gpos,
 	    zst::span<GlyphId> glyphs,
-	    const FeatureSet& features)
+	    const ShapingPlan& plan)
 	{
 		/*
 		    OFF 1.9, page 217
@@ -375,18 +437,40 @@ namespace font::off
 		    TL;DR: for(lookups) { for(glyphs) { ... } }, and *NOT* the transposed.
 		*/
 
-		util::hashmap<size_t, GlyphAdjustment> adjustments {};
-		auto lookups = getLookupTablesForFeatures(gpos, features);
+		if(plan.gpos_lookups.empty())
+			return {};
 
-		for(auto& lookup_idx : lookups)
+		std::vector<GlyphAdjustment> adjustments(glyphs.size());
+		for(auto lookup : plan.gpos_lookups)
 		{
-			assert(lookup_idx < gpos.lookups.size());
-			auto& lookup = gpos.lookups[lookup_idx];
+			// pair lookups (ie. kerning) are by far the most common, so do them directly instead of going
+			// through the general path (and its map). this is the same as what lookupForGlyphSequence does.
+			if(lookup->type == gpos::LOOKUP_PAIR)
+			{
+				for(size_t i = 0; i + 1 < glyphs.size(); i++)
+				{
+					auto [a1, a2] = gpos::lookupPairAdjustment(*lookup, glyphs[i], glyphs[i + 1]);
+					if(a1.has_value())
+						gpos::combine_adjustments(adjustments[i], *a1);
+
+					if(a2.has_value())
+					{
+						// if the second adjustment was not null, then we skip the second glyph
+						gpos::combine_adjustments(adjustments[i + 1], *a2);
+						i += 1;
+					}
+				}
+
+				continue;
+			}
 
 			// in this case, we want to lookup the entire sequence, so start at position 0.
-			auto new_adjs = gpos::lookupForGlyphSequence(gpos, lookup, glyphs, /* position: */ 0);
+			auto new_adjs = gpos::lookupForGlyphSequence(gpos, *lookup, glyphs, /* position: */ 0);
 			for(auto& [idx, adj] : new_adjs)
-				gpos::combine_adjustments(adjustments[idx], adj);
+			{
+				if(idx < adjustments.size())
+					gpos::combine_adjustments(adjustments[idx], adj);
+			}
 		}
 
 		return adjustments;
@@ -153,7 +153,7 @@ namespace font::off::gsub
 
 			// both of them have coverage tables.
 			auto cov_ofs = consume_u16(subtable);
-			auto cov_idx = getGlyphCoverageIndex(subtable_start.drop(cov_ofs), gid);
+			auto cov_idx = getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), gid);
 			if(!cov_idx.has_value())
 				continue;
 
@@ -190,7 +190,7 @@ namespace font::off::gsub
 			}
 
 			auto cov_ofs = consume_u16(subtable);
-			auto cov_idx = getGlyphCoverageIndex(subtable_start.drop(cov_ofs), gid);
+			auto cov_idx = getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), gid);
 			if(!cov_idx.has_value())
 				continue;
 
@@ -237,7 +237,7 @@ namespace font::off::gsub
 			}
 
 			auto cov_ofs = consume_u16(subtable);
-			auto cov_idx = getGlyphCoverageIndex(subtable_start.drop(cov_ofs), glyphs[0]);
+			auto cov_idx = getGlyphCoverageIndex(lookup, subtable_start.drop(cov_ofs), glyphs[0]);
 			if(!cov_idx.has_value())
 				continue;
 
@@ -337,7 +337,7 @@ namespace font::off::gsub
 		assert(lookup.type == LOOKUP_CONTEXTUAL);
 		for(auto subtable : lookup.subtables)
 		{
-			if(auto records = performContextualLookup(subtable, glyphs); records.has_value())
+			if(auto records = performContextualLookup(lookup, subtable, glyphs); records.has_value())
 				return apply_lookup_records(gsub, *records, glyphs, /* pos: */ 0);
 		}
 
@@ -354,7 +354,7 @@ namespace font::off::gsub
 
 		for(auto subtable : lookup.subtables)
 		{
-			if(auto records = performChainedContextLookup(subtable, glyphs, position); records.has_value())
+			if(auto records = performChainedContextLookup(lookup, subtable, glyphs, position); records.has_value())
 				return apply_lookup_records(gsub, *records, glyphs, /* pos: */ position);
 		}
 
@@ -368,10 +368,8 @@ namespace font::off
 {
 	SubstitutedGlyphString performSubstitutionsForGlyphSequence(const GSubTable& gsub_table,
 	    zst::span<GlyphId> input,
-	    const FeatureSet& features)
+	    const ShapingPlan& plan)
 	{
-		auto lookups = getLookupTablesForFeatures(gsub_table, features);
-
 		SubstitutedGlyphString result {};
 
 		result.glyphs = std::vector<GlyphId>(input.begin(), input.end());
@@ -379,13 +377,10 @@ namespace font::off
 
 		auto span = [](auto& g) { return zst::span<GlyphId>(g.data(), g.size()); };
 
-		for(auto& lookup_idx : lookups)
+		for(auto lookup : plan.gsub_lookups)
 		{
-			assert(lookup_idx < gsub_table.lookups.size());
-			auto& lookup = gsub_table.lookups[lookup_idx];
-
 			// in this case, we want to lookup the entire sequence, so start at position 0.
-			auto subst = gsub::lookupForGlyphSequence(gsub_table, lookup, span(glyphs), /* position: */ 0);
+			auto subst = gsub::lookupForGlyphSequence(gsub_table, *lookup, span(glyphs), /* position: */ 0);
 			if(subst.has_value())
 			{
 				glyphs.erase(glyphs.begin() + util::checked_cast<ssize_t>(subst->input_start),
@@ -12,15 +12,14 @@ namespace font
 {
 	truetype::TTSubset FontFile::createTTSubset()
 	{
-		auto& tt = m_truetype_data;
-		assert(tt != nullptr);
+		auto tt = this->truetype_data();
 
 		// needs to be sorted. always insert 0.
 		std::set<uint16_t> used_gids {};
 		used_gids.insert(0);
 		used_gids.insert(tt->glyphs[0].component_gids.begin(), tt->glyphs[0].component_gids.end());
 
-		for(auto& gid : m_used_glyphs)
+		for(auto gid : m_used_glyphs)
 		{
 			auto gid16 = util::checked_cast<uint16_t>(static_cast<uint32_t>(gid));
 			auto& comps = tt->glyphs[gid16].component_gids;
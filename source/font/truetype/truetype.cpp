@@ -77,7 +77,7 @@ namespace font::truetype
 
 namespace font
 {
-	void FontFile::parse_glyf_table(const Table& glyf_table)
+	void FontFile::parse_glyf_table(const Table& glyf_table) const
 	{
 		if(m_outline_type != OUTLINES_TRUETYPE)
 			sap::internal_error("found 'glyf' table in file with non-truetype outlines");
@@ -88,7 +88,7 @@ namespace font
 		m_truetype_data->glyf_data = data;
 	}
 
-	void FontFile::parse_loca_table(const Table& tbl)
+	void FontFile::parse_loca_table(const Table& tbl) const
 	{
 		if(m_outline_type != OUTLINES_TRUETYPE)
 			sap::internal_error("found 'loca' table in file with non-truetype outlines");
@@ -203,7 +203,11 @@ namespace sap::interp::ast
 				return TCResult::ofRValue<cst::ArrayLit>(m_location, Type::makeArray(Type::makeVoid()),
 				    std::move(elms));
 
-			auto et = infer ? infer->arrayElement() : nullptr;
+			// allow inferring through optionals, eg. when initialising a `?[T]` field with a literal
+			if(infer != nullptr && infer->isOptional())
+				infer = infer->optionalElement();
+
+			auto et = (infer != nullptr && infer->isArray()) ? infer->arrayElement() : nullptr;
 			et = elms.emplace_back(TRY(this->elements[0]->typecheck(ts, et)).take_expr())->type();
 
 			for(size_t i = 1; i < this->elements.size(); i++)
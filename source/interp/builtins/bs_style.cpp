@@ -4,6 +4,7 @@
 
 #include "sap/style.h"
 #include "interp/value.h"
+#include "interp/interp.h"
 #include "interp/evaluator.h"
 #include "interp/builtin_types.h"
 
@@ -15,6 +16,7 @@ namespace sap::interp::builtin
 	static auto pt_bool = PT::named(frontend::TYPE_BOOL);
 	static auto pt_float = PT::named(frontend::TYPE_FLOAT);
 	static auto pt_length = PT::named(frontend::TYPE_LENGTH);
+	static auto pt_string = PT::named(frontend::TYPE_STRING);
 
 	static auto get_null()
 	{
@@ -25,27 +27,113 @@ namespace sap::interp::builtin
 	std::vector<Field> builtin::BS_Style::fields()
 	{
 		auto pt_font_family = ptype_for_builtin<BS_FontFamily>();
+		auto pt_fallbacks = PT::array(pt_font_family);
+		auto pt_features = PT::array(pt_string);
 		auto pt_alignment = ptype_for_builtin<BE_Alignment>();
 		auto pt_colour = ptype_for_builtin<BS_Colour>();
 
 		return util::vectorOf(                                                                                     //
 		    Field { .name = "font_family", .type = PT::optional(pt_font_family), .initialiser = get_null() },      //
+		    Field { .name = "font_fallbacks", .type = PT::optional(pt_fallbacks), .initialiser = get_null() },     //
+		    Field { .name = "font_features", .type = PT::optional(pt_features), .initialiser = get_null() },       //
 		    Field { .name = "font_size", .type = PT::optional(pt_length), .initialiser = get_null() },             //
 		    Field { .name = "line_spacing", .type = PT::optional(pt_float), .initialiser = get_null() },           //
 		    Field { .name = "sentence_space_stretch", .type = PT::optional(pt_float), .initialiser = get_null() }, //
 		    Field { .name = "paragraph_spacing", .type = PT::optional(pt_length), .initialiser = get_null() },     //
 		    Field { .name = "horz_alignment", .type = PT::optional(pt_alignment), .initialiser = get_null() },     //
 		    Field { .name = "colour", .type = PT::optional(pt_colour), .initialiser = get_null() },                //
-		    Field { .name = "enable_smart_quotes", .type = PT::optional(pt_bool), .initialiser = get_null() }      //
+		    Field { .name = "enable_smart_quotes", .type = PT::optional(pt_bool), .initialiser = get_null() },     //
+		    Field { .name = "language", .type = PT::optional(pt_string), .initialiser = get_null() }               //
 		);
 	}
 
+	/*
+	    Font features are given as a list of OpenType feature tags, relative to the default feature set; a tag
+	    on its own (or prefixed with '+') enables that feature, and a tag prefixed with '-' disables it. For
+	    example, `["smcp", "onum", "-liga"]`.
+	*/
+	static std::vector<std::string> feature_set_to_strings(const font::FeatureSet& features)
+	{
+		auto default_features = font::defaultFeatureSet();
+		auto tag_str = [](font::Tag tag) {
+			auto ret = tag.str();
+			while(not ret.empty() && ret.back() == ' ')
+				ret.pop_back();
+			return ret;
+		};
+
+		std::vector<std::string> ret {};
+		for(auto& tag : features.enabled_features)
+		{
+			if(not default_features.is_enabled(tag) && not features.is_disabled(tag))
+				ret.push_back(tag_str(tag));
+		}
+
+		for(auto& tag : default_features.enabled_features)
+		{
+			if(not features.is_enabled(tag))
+				ret.push_back("-" + tag_str(tag));
+		}
+
+		std::sort(ret.begin(), ret.end());
+		return ret;
+	}
+
+	static ErrorOr<font::FeatureSetId> feature_set_from_strings(Evaluator* ev, const std::vector<Value>& strs)
+	{
+		auto features = font::defaultFeatureSet();
+		for(auto& value : strs)
+		{
+			auto str = value.getUtf8String();
+			auto name = zst::str_view(str);
+
+			bool enable = not name.starts_with("-");
+			if(name.starts_with("-") || name.starts_with("+"))
+				name.remove_prefix(1);
+
+			if(name.empty() || name.size() > 4
+			    || std::any_of(name.begin(), name.end(), [](char c) { return c < 0x20 || c > 0x7e; }))
+				return ErrMsg(ev, "invalid font feature '{}'", str);
+
+			char buf[5] = { ' ', ' ', ' ', ' ', 0 };
+			std::copy(name.begin(), name.end(), &buf[0]);
+
+			auto tag = font::Tag(buf);
+			if(enable)
+			{
+				features.enabled_features.insert(tag);
+				features.disabled_features.erase(tag);
+			}
+			else
+			{
+				features.enabled_features.erase(tag);
+				features.disabled_features.insert(tag);
+			}
+		}
+
+		return Ok(font::internFeatureSet(std::move(features)));
+	}
+
 	Value builtin::BS_Style::make(Evaluator* ev, const Style& style)
 	{
 		auto maker = StructMaker(BS_Style::type->toStruct());
 
 		if(style.have_font_family())
 			maker.set("font_family", BS_FontFamily::make(ev, style.font_family()));
+		if(style.have_font_fallbacks())
+		{
+			maker.set("font_fallbacks",
+			    Value::array(BS_FontFamily::type, util::map(*style.font_fallbacks(), [ev](auto&& family) {
+				    return BS_FontFamily::make(ev, family);
+			    })));
+		}
+		if(style.have_font_features())
+		{
+			auto strs = feature_set_to_strings(font::getFeatureSet(style.font_features()));
+			maker.set("font_features", Value::array(Type::makeString(), util::map(strs, [](auto&& s) {
+				return Value::string(s);
+			})));
+		}
 		if(style.have_font_size())
 			maker.set("font_size", Value::length(DynLength(style.font_size())));
 		if(style.have_line_spacing())
@@ -60,6 +148,8 @@ namespace sap::interp::builtin
 			maker.set("colour", BS_Colour::make(ev, style.colour()));
 		if(style.have_smart_quotes_enablement())
 			maker.set("enable_smart_quotes", Value::boolean(style.smart_quotes_enabled()));
+		if(style.have_language())
+			maker.set("language", Value::string(style.language().name()));
 
 		return maker.make();
 	}
@@ -89,9 +179,30 @@ namespace sap::interp::builtin
 		if(auto& x = value.getStructField("font_family"); x.haveOptionalValue())
 			style.set_font_family(TRY(BS_FontFamily::unmake(ev, **x.getOptional())));
 
+		if(auto& x = value.getStructField("font_fallbacks"); x.haveOptionalValue())
+		{
+			FontFallbackChain chain {};
+			for(auto& family : (*x.getOptional())->getArray())
+				chain.push_back(TRY(BS_FontFamily::unmake(ev, family)));
+
+			style.set_font_fallbacks(ev->interpreter()->internFontFallbackChain(std::move(chain)));
+		}
+
+		if(auto& x = value.getStructField("font_features"); x.haveOptionalValue())
+			style.set_font_features(TRY(feature_set_from_strings(ev, (*x.getOptional())->getArray())));
+
 		if(auto& x = value.getStructField("colour"); x.haveOptionalValue())
 			style.set_colour(BS_Colour::unmake(ev, **x.getOptional()));
 
+		if(auto& x = value.getStructField("language"); x.haveOptionalValue())
+		{
+			auto name = (*x.getOptional())->getUtf8String();
+			if(name.empty())
+				return ErrMsg(ev, "language name cannot be empty");
+
+			style.set_language(Language::named(name));
+		}
+
 		return OkMove(style);
 	}
 }
@@ -10,24 +10,6 @@
 
 namespace sap::interp::builtin
 {
-	static const Style g_bold_style = []() {
-		Style style {};
-		style.set_font_style(FontStyle::Bold);
-		return style;
-	}();
-
-	static const Style g_italic_style = []() {
-		Style style {};
-		style.set_font_style(FontStyle::Italic);
-		return style;
-	}();
-
-	static const Style g_bold_italic_style = []() {
-		Style style {};
-		style.set_font_style(FontStyle::BoldItalic);
-		return style;
-	}();
-
 	static ErrorOr<EvalResult> do_apply_style(Evaluator* ev, Value& value, const Style& style)
 	{
 		if(value.isTreeInlineObj())
@@ -107,21 +89,21 @@ namespace sap::interp::builtin
 	{
 		// TODO: maybe don't assert?
 		assert(args.size() == 1);
-		return do_apply_style(ev, args[0], g_bold_style);
+		return do_apply_style(ev, args[0], Style().with_font_style(FontStyle::Bold));
 	}
 
 	ErrorOr<EvalResult> italic1(Evaluator* ev, std::vector<Value>& args)
 	{
 		// TODO: maybe don't assert?
 		assert(args.size() == 1);
-		return do_apply_style(ev, args[0], g_italic_style);
+		return do_apply_style(ev, args[0], Style().with_font_style(FontStyle::Italic));
 	}
 
 	ErrorOr<EvalResult> bold_italic1(Evaluator* ev, std::vector<Value>& args)
 	{
 		// TODO: maybe don't assert?
 		assert(args.size() == 1);
-		return do_apply_style(ev, args[0], g_bold_italic_style);
+		return do_apply_style(ev, args[0], Style().with_font_style(FontStyle::BoldItalic));
 	}
 
 
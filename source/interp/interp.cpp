@@ -77,6 +77,17 @@ namespace sap::interp
 		return *m_loaded_fonts.emplace(id, std::move(font)).first->second;
 	}
 
+	const FontFallbackChain* Interpreter::internFontFallbackChain(FontFallbackChain chain)
+	{
+		for(auto& existing : m_font_fallback_chains)
+		{
+			if(*existing == chain)
+				return existing.get();
+		}
+
+		return m_font_fallback_chains.emplace_back(std::make_unique<FontFallbackChain>(std::move(chain))).get();
+	}
+
 	ErrorOr<pdf::PdfFont*> Interpreter::getLoadedFontById(int64_t font_id)
 	{
 		if(auto it = m_loaded_fonts.find(font_id); it != m_loaded_fonts.end())
@@ -95,15 +106,51 @@ namespace sap::interp
 
 	void Interpreter::addMicrotypeConfig(config::MicrotypeConfig config)
 	{
+		// the configs are made of hash sets and maps, so sort everything to get a stable hash.
+		auto& hash = m_microtype_config_hash;
+		auto add = [&hash](const void* data, size_t size) { hash = XXH64(data, size, hash); };
+
+		std::vector<std::string_view> fonts(config.matched_fonts.begin(), config.matched_fonts.end());
+		std::sort(fonts.begin(), fonts.end());
+		for(auto font : fonts)
+			add(font.data(), font.size() + 1);
+
+		add(&config.enable_if_italic, sizeof(bool));
+
+		std::vector<std::pair<char32_t, CharacterProtrusion>> protrusions(config.protrusions.begin(),
+		    config.protrusions.end());
+		std::sort(protrusions.begin(), protrusions.end(),
+		    [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		for(auto& [ch, protrusion] : protrusions)
+		{
+			add(&ch, sizeof(char32_t));
+			add(&protrusion.left, sizeof(double));
+			add(&protrusion.right, sizeof(double));
+		}
+
 		m_microtype_configs.push_back(std::move(config));
 	}
 
 	std::optional<CharacterProtrusion> Interpreter::getMicrotypeProtrusionFor(char32_t ch, const Style& style) const
 	{
 		auto font = style.font();
-		auto font_name = font->source().name();
 		auto font_style = style.font_style();
 
+		auto& table = font->getProtrusionTable(font_style, [&]() {
+			return this->make_protrusion_table(font, font_style);
+		});
+
+		return table.get(ch);
+	}
+
+	ProtrusionTable Interpreter::make_protrusion_table(const pdf::PdfFont* font, FontStyle font_style) const
+	{
+		ProtrusionTable table {};
+		auto font_name = font->name();
+
+		// note: configs that were added first take precedence, since `ProtrusionTable::add` does not
+		// replace existing entries.
 		using enum FontStyle;
 		for(auto& config : m_microtype_configs)
 		{
@@ -116,11 +163,11 @@ namespace sap::interp
 			// ok, it should match. TODO: check features.
 			// TODO: maybe decompose the unicode, because i think we only
 			// declare protrusions for the 'base' character
-			if(auto it = config.protrusions.find(ch); it != config.protrusions.end())
-				return CharacterProtrusion { it->second.left, it->second.right };
+			for(auto& [ch, protrusion] : config.protrusions)
+				table.add(ch, protrusion);
 		}
 
-		return std::nullopt;
+		return table;
 	}
 
 
@@ -43,6 +43,9 @@ namespace sap::interp
 
 		pdf::PdfFont& addLoadedFont(std::unique_ptr<pdf::PdfFont> font);
 		ErrorOr<pdf::PdfFont*> getLoadedFontById(int64_t font_id);
+		const util::hashmap<int64_t, std::unique_ptr<pdf::PdfFont>>& loadedFonts() const { return m_loaded_fonts; }
+
+		const FontFallbackChain* internFontFallbackChain(FontFallbackChain chain);
 
 		// this is necessary to keep the strings around...
 		std::u32string& keepStringAlive(zst::wstr_view str);
@@ -61,10 +64,17 @@ namespace sap::interp
 
 		tree::BlockObject* retainBlockObject(zst::SharedPtr<tree::BlockObject> tbo);
 
+		// note: all the configs must be added before the first lookup, since each font resolves its protrusions
+		// from the configs only once.
 		void addMicrotypeConfig(config::MicrotypeConfig config);
 		std::optional<CharacterProtrusion> getMicrotypeProtrusionFor(char32_t ch, const Style& style) const;
 
+		// a hash of all the microtype configs that were added, which changes whenever the protrusions might.
+		uint64_t microtypeConfigHash() const { return m_microtype_config_hash; }
+
 	private:
+		ProtrusionTable make_protrusion_table(const pdf::PdfFont* font, FontStyle font_style) const;
+
 		std::unique_ptr<Typechecker> m_typechecker;
 		std::unique_ptr<Evaluator> m_evaluator;
 
@@ -74,6 +84,7 @@ namespace sap::interp
 		std::vector<zst::unique_span<uint8_t[]>> m_file_contents;
 
 		util::hashmap<int64_t, std::unique_ptr<pdf::PdfFont>> m_loaded_fonts;
+		std::vector<std::unique_ptr<FontFallbackChain>> m_font_fallback_chains;
 
 		std::vector<zst::SharedPtr<tree::BlockObject>> m_retained_tbos;
 
@@ -83,5 +94,6 @@ namespace sap::interp
 		std::vector<std::u32string> m_leaked_strings32;
 
 		std::vector<config::MicrotypeConfig> m_microtype_configs;
+		uint64_t m_microtype_config_hash = 0;
 	};
 }
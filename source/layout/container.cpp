@@ -505,7 +505,7 @@ namespace sap::layout
 		content_size.ascent = 0;
 		content_size.descent = m_layout_size.total_height();
 
-		auto spacing = m_override_obj_spacing.value_or(m_style.paragraph_spacing());
+		auto spacing = m_override_obj_spacing.value_or(m_style->paragraph_spacing());
 
 		// FIXME: no idea if `m_layout_size.width` below is correct, or it should be content_size?
 		// we use it as the content size to determine how much to move in the x-axis to align centre/right
@@ -514,12 +514,12 @@ namespace sap::layout
 		cursor = position_children_in_container(cursor,       //
 		    m_layout_size.width,                              //
 		    m_direction,                                      //
-		    m_style.horz_alignment(),                         //
+		    m_style->horz_alignment(),                        //
 		    spacing,                                          //
 		    /* shift_by_ascent_of_first_child */ true,        //
 		    /* shift_by_ascent_of_remaining_children */ true, //
 		    m_objects,                                        //
-		    m_style,                                          //
+		    *m_style,                                         //
 		    m_border_style,                                   //
 		    m_border_objects                                  //
 		);
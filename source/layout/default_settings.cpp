@@ -51,6 +51,7 @@ namespace sap::layout
 		auto font_size = DEFAULT_FONT_SIZE_PT;
 		default_style.set_font_family(default_serif_font_family(cs))
 		    .set_font_style(sap::FontStyle::Regular)
+		    .set_font_features(font::DEFAULT_FEATURE_SET)
 		    .set_font_size(font_size.into())
 		    .set_root_font_size(font_size.into())
 		    .set_line_spacing(DEFAULT_LINE_SPACING)
@@ -58,7 +59,8 @@ namespace sap::layout
 		    .set_paragraph_spacing(0_mm)
 		    .set_horz_alignment(Alignment::Justified)
 		    .set_colour(Colour::black())
-		    .enable_smart_quotes(true);
+		    .enable_smart_quotes(true)
+		    .set_language(DEFAULT_LANGUAGE);
 
 		return default_style;
 	}
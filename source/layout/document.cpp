@@ -29,6 +29,8 @@
 #include "layout/document.h"
 #include "layout/paragraph.h"
 
+#include "misc/timings.h"
+
 namespace sap::layout
 {
 	Style getDefaultStyle(interp::Interpreter* cs);
@@ -128,16 +130,21 @@ namespace sap::layout
 
 	void Document::write(pdf::Writer* stream)
 	{
-		auto pages = m_page_layout.render();
-		for(auto& page : pages)
-			m_pdf_document.addPage(page);
+		{
+			auto _ = util::timings::Phase("render");
 
-		for(auto& item : m_outline_items)
-			m_pdf_document.addOutlineItem(convert_outline_item(pages, std::move(item)));
+			auto pages = m_page_layout.render();
+			for(auto& page : pages)
+				m_pdf_document.addPage(page);
 
-		for(auto& annot : m_annotations)
-			convert_annotation(pages, std::move(annot));
+			for(auto& item : m_outline_items)
+				m_pdf_document.addOutlineItem(convert_outline_item(pages, std::move(item)));
 
+			for(auto& annot : m_annotations)
+				convert_annotation(pages, std::move(annot));
+		}
+
+		auto _ = util::timings::Phase("write pdf");
 		m_pdf_document.write(stream);
 	}
 
@@ -193,6 +200,9 @@ namespace sap::tree
 		if(not this->haveDocStart())
 			ErrorMessage(&cs->typechecker(), "cannot layout a document with no body").showAndExit();
 
+		auto preamble_phase = std::optional<util::timings::Phase>();
+		preamble_phase.emplace("preamble");
+
 		auto result = TRY(this->runPreamble(cs));
 		assert(not result.empty());
 		assert(result.back().second.hasValue());
@@ -207,6 +217,8 @@ namespace sap::tree
 		cs->evaluator().pushStyle(layout_doc->style());
 		cs->evaluator().setDocument(layout_doc.get());
 
+		preamble_phase.reset();
+
 		size_t layout_pass = 0;
 		while(true)
 		{
@@ -216,6 +228,12 @@ namespace sap::tree
 			};
 
 			cs->evaluator().commenceLayoutPass(++layout_pass);
+			auto pass_timer = util::timings::Phase(zpr::sprint("layout pass {}", layout_pass));
+
+			// each phase is timed separately; the optional lets us end one and start the next.
+			auto phase_timer = std::optional<util::timings::Phase>();
+
+			phase_timer.emplace("layout");
 			cs->setCurrentPhase(ProcessingPhase::Layout);
 			TRY(run_hooks_for_phase(cs));
 
@@ -226,18 +244,24 @@ namespace sap::tree
 			if(not maybe_container.object.has_value())
 				ErrorMessage(cs->evaluator().loc(), "empty document").showAndExit();
 
+			phase_timer.reset();
+			phase_timer.emplace("position");
 			cs->setCurrentPhase(ProcessingPhase::Position);
 			TRY(run_hooks_for_phase(cs));
 
 			auto container = std::move(*maybe_container.object);
 			container->computePosition(layout_doc->pageLayout().newCursor());
 
+			phase_timer.reset();
+			phase_timer.emplace("post-layout");
 			cs->setCurrentPhase(ProcessingPhase::PostLayout);
 			TRY(run_hooks_for_phase(cs));
 
 			if(cs->evaluator().layoutRequested())
 				continue;
 
+			phase_timer.reset();
+			phase_timer.emplace("finalise");
 			cs->setCurrentPhase(ProcessingPhase::Finalise);
 			TRY(run_hooks_for_phase(cs));
 
@@ -245,6 +269,8 @@ namespace sap::tree
 			break;
 		}
 
+		util::timings::setCounter("layout passes", layout_pass);
+
 		auto doc_proxy = interp::builtin::BS_DocumentProxy::unmake(&cs->evaluator(), cs->evaluator().documentProxy());
 		layout_doc->outlineItems() = std::move(doc_proxy.outline_items);
 		layout_doc->annotations() = std::move(doc_proxy.link_annotations);
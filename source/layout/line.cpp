@@ -21,9 +21,15 @@ namespace sap::layout
 		Length line_spacing;
 	};
 
-	static WordSize calculate_word_size(zst::wstr_view text, const Style& style)
+	static WordSize calculate_word_size(zst::wstr_view text,
+	    const Style& style,
+	    std::optional<Length> known_width = std::nullopt)
 	{
-		auto x = style.font()->getWordSize(text, style.font_size().into()).x();
+		Length width = 0;
+		if(known_width.has_value())
+			width = *known_width;
+		else
+			width = style.font()->getWordSize(text, style.font_size().into(), style.font_features()).x().into();
 
 		auto& fm = style.font()->getFontMetrics();
 		auto asc = style.font()->scaleMetricForFontSize(fm.hhea_ascent, style.font_size().into()).abs();
@@ -32,7 +38,7 @@ namespace sap::layout
 		auto ch = style.font()->scaleMetricForFontSize(fm.cap_height, style.font_size().into());
 
 		return {
-			.width = x.into(),
+			.width = width,
 			.ascent = asc.into(),
 			.descent = dsc.into(),
 			.cap_height = ch.into(),
@@ -45,7 +51,7 @@ namespace sap::layout
 		double multiplier = sep->isSentenceEnding() ? style.sentence_space_stretch() : 1.0;
 
 		auto sep_str = is_end_of_line ? sep->endOfLine() : sep->middleOfLine();
-		auto ret = style.font()->getWordSize(sep_str, style.font_size().into()).x();
+		auto ret = style.font()->getWordSize(sep_str, style.font_size().into(), style.font_features()).x();
 
 		return (ret * multiplier).into();
 	}
@@ -64,7 +70,7 @@ namespace sap::layout
 	static Length calculateRealSeparatorWidth(const tree::Separator* sep, const Style& style, bool is_end_of_line)
 	{
 		auto sep_str = is_end_of_line ? sep->endOfLine() : sep->middleOfLine();
-		return style.font()->getWordSize(sep_str, style.font_size().into()).x().into();
+		return style.font()->getWordSize(sep_str, style.font_size().into(), style.font_features()).x().into();
 	}
 
 	Line::Line(const Style& style, //
@@ -81,11 +87,16 @@ namespace sap::layout
 		std::u32string text;
 		size_t num_objs = 0;
 
-		Style style;
+		// note: styles here are all interned (see Style::extendWith), so they can be compared by address.
+		const Style* style = nullptr;
 		Length width = 0;
 		Length raise = 0;
 
 		const tree::InlineSpan* span = nullptr;
+
+		// the number of Texts in the chunk, and the index of the last one
+		size_t num_texts = 0;
+		size_t last_text_idx = 0;
 	};
 
 	struct NestedSpan;
@@ -104,7 +115,7 @@ namespace sap::layout
 			Length real_width;
 			Length preferred_width;
 
-			Style style;
+			const Style* style;
 			std::u32string text;
 		};
 
@@ -128,17 +139,22 @@ namespace sap::layout
 	{
 		std::span<const zst::SharedPtr<tree::InlineObject>> objs;
 		Length width;
-		Style style;
+		const Style* style;
 		LineMetrics metrics;
 		bool fixed_width = false;
 	};
 
 
 
+	/*
+	    If `paragraph_widths` is given, then `objs` must be part of the paragraph that it was computed for; the
+	    widths of separators and single words are taken from there instead of being measured again.
+	*/
 	static LineMetrics process_line_objects( //
 	    std::span<const zst::SharedPtr<tree::InlineObject>> objs,
 	    const Style& parent_style,
-	    bool is_last_span)
+	    bool is_last_span,
+	    const linebreak::ParagraphWidths* paragraph_widths)
 	{
 		WordChunk word_chunk {};
 		LineMetrics metrics {};
@@ -149,7 +165,7 @@ namespace sap::layout
 			if(auto obj = objs[cur_obj_idx];
 			    not force_flush
 			    && (cur_obj_idx == 0
-			        || (obj_style == word_chunk.style && obj->raiseHeight() == word_chunk.raise
+			        || (&obj_style == word_chunk.style && obj->raiseHeight() == word_chunk.raise
 			            && obj->parentSpan() == word_chunk.span)))
 			{
 				// not necessary; just return.
@@ -162,12 +178,16 @@ namespace sap::layout
 #if 0
 			zpr::println("flush word '{}' because {}", word_chunk.text,
 			    force_flush                     ? "forced"
-			    : obj_style != word_chunk.style ? "styles"
+			    : &obj_style != word_chunk.style ? "styles"
 			    : objs[cur_obj_idx]->raiseHeight() != word_chunk.raise
 			        ? "raise"
 			        : "span");
 #endif
-			auto word_size = calculate_word_size(word_chunk.text, word_chunk.style);
+			std::optional<Length> known_width {};
+			if(paragraph_widths != nullptr && word_chunk.num_texts == 1)
+				known_width = paragraph_widths->itemWidth(word_chunk.last_text_idx);
+
+			auto word_size = calculate_word_size(word_chunk.text, *word_chunk.style, known_width);
 			word_chunk.width = word_size.width;
 
 			metrics.total_word_width += word_size.width;
@@ -176,7 +196,7 @@ namespace sap::layout
 			metrics.ascent = std::max(metrics.ascent, word_size.ascent);
 			metrics.descent = std::max(metrics.descent, word_size.descent);
 			metrics.line_spacing = std::max(metrics.line_spacing,
-			    word_size.line_spacing * word_chunk.style.line_spacing());
+			    word_size.line_spacing * word_chunk.style->line_spacing());
 
 			metrics.item_types.push_back(LineMetrics::ITEM_WORD_CHUNK);
 			metrics.word_chunks.push_back(std::move(word_chunk));
@@ -188,18 +208,22 @@ namespace sap::layout
 		for(size_t obj_idx = 0; obj_idx < objs.size(); obj_idx++)
 		{
 			auto* obj = objs[obj_idx].get();
-			auto style = parent_style.extendWith(obj->style());
+			auto& style = parent_style.extendWith(obj->style());
 
 			if(auto tree_word = obj->castToText())
 			{
 				flush_word_chunk_if_necessary(obj_idx, style);
 
-				word_chunk.style = std::move(style);
+				word_chunk.style = &style;
 				word_chunk.raise = tree_word->raiseHeight();
 				word_chunk.span = tree_word->parentSpan();
 
 				word_chunk.text += tree_word->contents();
 				word_chunk.num_objs += 1;
+
+				word_chunk.num_texts += 1;
+				if(paragraph_widths != nullptr)
+					word_chunk.last_text_idx = paragraph_widths->indexOf(&objs[obj_idx]);
 			}
 			else if(auto tree_sep = obj->castToSeparator())
 			{
@@ -214,12 +238,29 @@ namespace sap::layout
 
 				flush_word_chunk_if_necessary(obj_idx, style, /* force: */ is_end_of_line || tree_sep->hasWhitespace());
 
-				auto real_sep_width = calculateRealSeparatorWidth(tree_sep, style, is_end_of_line);
+				Length real_sep_width = 0;
+				if(paragraph_widths != nullptr)
+				{
+					auto idx = paragraph_widths->indexOf(&objs[obj_idx]);
+					real_sep_width = paragraph_widths->realSeparatorWidth(idx, is_end_of_line);
+				}
+				else
+				{
+					real_sep_width = calculateRealSeparatorWidth(tree_sep, style, is_end_of_line);
+				}
 
 				auto preferred_sep_width = [&]() -> Length {
 					if(obj_idx == 0 && obj_idx + 1 == objs.size())
 						sap::internal_error("??? line with only separator");
 
+					// note: lines don't start with separators, so the paragraph's widths (which look at the
+					// neighbours in the paragraph) give the same answer as looking at the neighbours in the line.
+					if(paragraph_widths != nullptr && obj_idx > 0)
+					{
+						return paragraph_widths->preferredSeparatorWidth(paragraph_widths->indexOf(&objs[obj_idx]),
+						    is_end_of_line);
+					}
+
 					auto calc_one = [tree_sep, is_end_of_line, &parent_style, &objs](size_t k) {
 						return calculate_preferred_sep_width(tree_sep, parent_style.extendWith(objs[k]->style()),
 						    is_end_of_line);
@@ -231,8 +272,8 @@ namespace sap::layout
 					else if(obj_idx + 1 == objs.size())
 						return calc_one(obj_idx - 1);
 
-					auto left_style = parent_style.extendWith(objs[obj_idx - 1]->style());
-					auto right_style = parent_style.extendWith(objs[obj_idx + 1]->style());
+					auto& left_style = parent_style.extendWith(objs[obj_idx - 1]->style());
+					auto& right_style = parent_style.extendWith(objs[obj_idx + 1]->style());
 					return calculatePreferredSeparatorWidth(tree_sep, is_end_of_line, left_style, right_style);
 				}();
 
@@ -240,7 +281,7 @@ namespace sap::layout
 				metrics.separators.push_back(LineMetrics::Sep {
 				    .real_width = real_sep_width,
 				    .preferred_width = preferred_sep_width,
-				    .style = std::move(style),
+				    .style = &style,
 				    .text = sep_str.str(),
 				});
 
@@ -255,7 +296,7 @@ namespace sap::layout
 				flush_word_chunk_if_necessary(obj_idx, style, /* force flush: */ has_fixed_width);
 
 				auto span_metrics = process_line_objects(tree_span->objects(), style,
-				    /* is last span: */ obj_idx + 1 == objs.size());
+				    /* is last span: */ obj_idx + 1 == objs.size(), /* paragraph widths: */ nullptr);
 
 				metrics.cap_height = std::max(metrics.cap_height, span_metrics.cap_height);
 				metrics.ascent = std::max(metrics.ascent, span_metrics.ascent);
@@ -268,7 +309,7 @@ namespace sap::layout
 					metrics.spans.push_back({
 					    .objs = tree_span->objects(),
 					    .width = *tree_span->getOverriddenWidth(),
-					    .style = std::move(style),
+					    .style = &style,
 					    .metrics = std::move(span_metrics),
 					    .fixed_width = true,
 					});
@@ -284,7 +325,7 @@ namespace sap::layout
 					metrics.spans.push_back({
 					    .objs = tree_span->objects(),
 					    .width = 0,
-					    .style = std::move(style),
+					    .style = &style,
 					    .metrics = std::move(span_metrics),
 					    .fixed_width = false,
 					});
@@ -435,7 +476,7 @@ namespace sap::layout
 				auto word_chunk = std::move(metrics.word_chunks.back());
 				metrics.word_chunks.pop_back();
 
-				auto layout_word = std::make_unique<Word>(std::move(word_chunk.text), std::move(word_chunk.style),
+				auto layout_word = std::make_unique<Word>(std::move(word_chunk.text), *word_chunk.style,
 				    current_offset, word_chunk.raise,
 				    LayoutSize {
 				        .width = word_chunk.width,
@@ -482,7 +523,7 @@ namespace sap::layout
 				{
 					auto layout_sep = std::make_unique<Word>( //
 					    sep.text,                             //
-					    std::move(sep.style),                 //
+					    *sep.style,                           //
 					    current_offset,                       //
 					    tree_obj->raiseHeight(),              //
 					    LayoutSize {
@@ -517,7 +558,7 @@ namespace sap::layout
 					place_line_objects(nested_span.metrics,             //
 					    nested_span.objs,                               //
 					    span_width,                                     //
-					    std::move(nested_span.style),                   //
+					    *nested_span.style,                             //
 					    cur_ofs,                                        //
 					    is_last_line,                                   //
 					    /* is last span: */ obj_idx + 1 == objs.size(), //
@@ -538,7 +579,7 @@ namespace sap::layout
 					auto span_width = place_line_objects(nested_span.metrics, //
 					    nested_span.objs,                                     //
 					    line_width - current_offset,                          //
-					    std::move(nested_span.style),                         //
+					    *nested_span.style,                                   //
 					    current_offset,                                       //
 					    is_last_line,                                         //
 					    /* is last span: */ obj_idx + 1 == objs.size(),       //
@@ -579,12 +620,13 @@ namespace sap::layout
 	    Size2d available_space,
 	    bool is_first_line,
 	    bool is_last_line,
-	    std::optional<LineAdjustment> line_adjustment)
+	    std::optional<LineAdjustment> line_adjustment,
+	    const linebreak::ParagraphWidths* paragraph_widths)
 	{
 		std::vector<std::unique_ptr<LayoutObject>> layout_objects {};
 		Length current_offset = 0;
 
-		auto line_metrics = process_line_objects(objs, parent_style, /* is last span: */ true);
+		auto line_metrics = process_line_objects(objs, parent_style, /* is last span: */ true, paragraph_widths);
 
 		auto actual_width = place_line_objects(line_metrics, //
 		    objs,                                            //
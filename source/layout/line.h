@@ -20,6 +20,7 @@ namespace sap::layout
 	namespace linebreak
 	{
 		struct BrokenLine;
+		struct ParagraphWidths;
 	}
 
 	struct LineAdjustment
@@ -40,7 +41,8 @@ namespace sap::layout
 		    Size2d available_space,
 		    bool is_first_line,
 		    bool is_last_line,
-		    std::optional<LineAdjustment> adjustment = std::nullopt);
+		    std::optional<LineAdjustment> adjustment = std::nullopt,
+		    const linebreak::ParagraphWidths* paragraph_widths = nullptr);
 
 		sap::Length lineSpacing() const { return m_line_spacing; }
 		const std::vector<std::unique_ptr<LayoutObject>>& objects() const { return m_objects; }
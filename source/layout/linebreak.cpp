@@ -4,8 +4,6 @@
 
 #include <utf8proc/utf8proc.h>
 
-#include "misc/dijkstra.h"
-
 #include "sap/style.h"
 #include "sap/units.h"
 
@@ -20,239 +18,430 @@ namespace sap::layout::linebreak
 {
 	using InlineObjPtr = zst::SharedPtr<tree::InlineObject>;
 	using InlineObjVec = std::vector<InlineObjPtr>;
-	using VecIter = InlineObjVec::const_iterator;
 
-	struct LineBreakNode
+	static Length measure_text(zst::wstr_view text, const Style& style)
 	{
-		interp::Interpreter* m_interp;
-		const InlineObjVec* m_contents;
-		const Style* m_parent_style;
+		if(text.empty())
+			return 0;
 
-		// TODO: we should get the preferred line length from the layout and not fix it here
-		Length m_preferred_line_length;
-		VecIter m_broken_until;
-		VecIter m_end;
+		return style.font()->getWordSize(text, style.font_size().into(), style.font_features()).x().into();
+	}
 
-		std::optional<BrokenLine> m_line;
+	static Length measure_preferred_sep(const tree::Separator* sep, const Style& style, bool is_end_of_line)
+	{
+		double multiplier = sep->isSentenceEnding() ? style.sentence_space_stretch() : 1.0;
 
-		using Distance = double;
+		auto sep_str = is_end_of_line ? sep->endOfLine() : sep->middleOfLine();
+		auto width = style.font()->getWordSize(sep_str, style.font_size().into(), style.font_features()).x();
 
-		static LineBreakNode make_end(VecIter end)
-		{
-			return LineBreakNode {
-				.m_interp = nullptr,
-				.m_contents = nullptr,
-				.m_parent_style = nullptr,
-				.m_preferred_line_length = 0,
-				.m_broken_until = end,
-				.m_end = end,
-				.m_line = std::nullopt,
-			};
-		}
+		return (width * multiplier).into();
+	}
 
-		LineBreakNode make_neighbour(VecIter neighbour_broken_until, BrokenLine neighbour_line) const
+	// the natural width of the contents of a span that doesn't have a fixed width
+	static Length measure_span_contents(const Style& parent_style, const InlineObjVec& objs)
+	{
+		Length width = 0;
+		for(size_t i = 0; i < objs.size(); i++)
 		{
-			return LineBreakNode {
-				.m_interp = m_interp,
-				.m_contents = m_contents,
-				.m_parent_style = m_parent_style,
-				.m_preferred_line_length = m_preferred_line_length,
-				.m_broken_until = neighbour_broken_until,
-				.m_end = m_end,
-				.m_line = std::move(neighbour_line),
-			};
+			auto obj = objs[i].get();
+			if(auto txt = obj->castToText())
+			{
+				width += measure_text(txt->contents(), parent_style.extendWith(txt->style()));
+			}
+			else if(auto span = obj->castToSpan())
+			{
+				if(span->hasOverriddenWidth())
+					width += *span->getOverriddenWidth();
+				else
+					width += measure_span_contents(parent_style, span->objects());
+			}
+			else if(auto sep = obj->castToSeparator(); sep && i > 0 && i + 1 < objs.size())
+			{
+				auto& left = parent_style.extendWith(objs[i - 1]->style());
+				auto& right = parent_style.extendWith(objs[i + 1]->style());
+				width += calculatePreferredSeparatorWidth(sep, /* end of line: */ false, left, right);
+			}
 		}
 
-		std::vector<std::pair<LineBreakNode, Distance>> neighbours()
-		{
-			auto neighbour_broken_until = m_broken_until;
-			auto neighbour_line = BrokenLine(m_parent_style ? *m_parent_style : Style::empty());
-			std::vector<std::pair<LineBreakNode, Distance>> ret;
+		return width;
+	}
 
-			// adjust left-side protrusion once per line
-			Length left_protrusion = 0;
-			{
-				auto first_it = neighbour_broken_until - checked_cast<ptrdiff_t>(neighbour_line.numParts());
+	ParagraphWidths::ParagraphWidths(const Style& parent_style, const InlineObjVec& contents)
+	    : m_contents(contents.data())
+	{
+		const auto n = contents.size();
+
+		m_item_width.resize(n);
+		m_end_of_line_width.resize(n);
+		m_real_sep_width.resize(n);
+		m_real_sep_width_end_of_line.resize(n);
+
+		m_start_of_line_width.resize(n);
+
+		m_natural_prefix.resize(n + 1);
+		m_space_prefix.resize(n + 1);
+		m_num_spaces_prefix.resize(n + 1);
 
-				auto& first_item = *first_it;
-				if(auto txt = first_item->castToText())
+		// the word (ie. the texts since the last separator that takes up space) that we're in the middle of.
+		std::u32string word_text {};
+		const tree::Text* word_last_text = nullptr;
+		Length word_width = 0;
+
+		for(size_t i = 0; i < n; i++)
+		{
+			auto obj = contents[i].get();
+			if(auto txt = obj->castToText())
+			{
+				auto& style = parent_style.extendWith(txt->style());
+				m_start_of_line_width[i] = measure_text(txt->contents(), style);
+
+				// texts in the same style that are only separated by hyphenation points are drawn as one word, so
+				// measure them together; each one then adds however much longer it makes the word, which takes
+				// care of kerning and ligatures across the hyphenation point.
+				if(word_last_text != nullptr && &parent_style.extendWith(word_last_text->style()) == &style
+				    && word_last_text->raiseHeight() == txt->raiseHeight()
+				    && word_last_text->parentSpan() == txt->parentSpan())
 				{
-					assert(not txt->contents().empty());
-					auto sv = zst::wstr_view(txt->contents());
+					word_text += txt->contents();
 
-					auto sty = m_parent_style->extendWith(txt->style());
-					if(auto p = m_interp->getMicrotypeProtrusionFor(sv[0], sty))
-					{
-						// protrusion is defined as proportion of the glyph width.
-						// so, we must calculate that.
-						auto glyph_width = sty.font()->getWordSize(sv.take(1), sty.font_size().into()).x();
-						left_protrusion = (p->left * glyph_width).into();
-					}
+					auto new_width = measure_text(word_text, style);
+					m_item_width[i] = new_width - word_width;
+					word_width = new_width;
+				}
+				else
+				{
+					word_text = txt->contents();
+					word_width = m_start_of_line_width[i];
+					m_item_width[i] = word_width;
 				}
+
+				word_last_text = txt;
+				m_end_of_line_width[i] = m_item_width[i];
+			}
+			else if(auto span = obj->castToSpan())
+			{
+				if(span->hasOverriddenWidth())
+					m_item_width[i] = *span->getOverriddenWidth();
+				else
+					m_item_width[i] = measure_span_contents(parent_style, span->objects());
+
+				m_end_of_line_width[i] = m_item_width[i];
+				m_start_of_line_width[i] = m_item_width[i];
+				word_last_text = nullptr;
 			}
+			else if(auto sep = obj->castToSeparator())
+			{
+				if(not sep->middleOfLine().empty())
+					word_last_text = nullptr;
 
+				auto& sep_style = parent_style.extendWith(sep->style());
+				m_real_sep_width[i] = measure_text(sep->middleOfLine(), sep_style);
+				m_real_sep_width_end_of_line[i] = measure_text(sep->endOfLine(), sep_style);
 
-			while(true)
+				// in the middle of a line, a separator takes the average of the widths it would have in the
+				// styles on either side of it; at the end of a line, only the left side matters.
+				auto left = i > 0 ? &parent_style.extendWith(contents[i - 1]->style()) : nullptr;
+				auto right = i + 1 < n ? &parent_style.extendWith(contents[i + 1]->style()) : nullptr;
+
+				if(left != nullptr && right != nullptr)
+					m_item_width[i] = calculatePreferredSeparatorWidth(sep, /* end of line: */ false, *left, *right);
+				else
+					m_item_width[i] = measure_preferred_sep(sep, left != nullptr ? *left : *right, false);
+
+				m_end_of_line_width[i] = measure_preferred_sep(sep, left != nullptr ? *left : sep_style, true);
+				m_start_of_line_width[i] = m_item_width[i];
+			}
+			else
 			{
-				neighbour_line.setLeftProtrusion(left_protrusion);
+				sap::internal_error("unsupported: {}", typeid(*obj).name());
+			}
 
-				if(neighbour_broken_until == m_end)
-				{
-					// completely arbitrary. *BUT* the key goal is to have exponentially
-					// increasing costs for having a very very short last line.
-					auto ratio = neighbour_line.width() / m_preferred_line_length;
+			m_natural_prefix[i + 1] = m_natural_prefix[i] + m_item_width[i];
+			m_space_prefix[i + 1] = m_space_prefix[i];
+			m_num_spaces_prefix[i + 1] = m_num_spaces_prefix[i];
 
-					Distance cost = 2.0 / std::pow(ratio + 1, 1.3);
-					ret.emplace_back(this->make_neighbour(neighbour_broken_until, std::move(neighbour_line)), cost);
+			if(auto sep = obj->castToSeparator(); sep && sep->hasWhitespace())
+			{
+				m_space_prefix[i + 1] += m_item_width[i];
+				m_num_spaces_prefix[i + 1] += 1;
+			}
+		}
+	}
 
-					return ret;
-				}
 
-				auto& wordorsep = *neighbour_broken_until++;
-				neighbour_line.add(wordorsep.get());
 
-				auto neighbour_width = neighbour_line.width();
+	LineCandidate::LineCandidate(interp::Interpreter* cs,
+	    const Style& parent_style,
+	    const InlineObjVec& contents,
+	    const ParagraphWidths& widths,
+	    size_t start,
+	    Length preferred_line_length)
+	    : m_interp(cs)
+	    , m_parent_style(&parent_style)
+	    , m_contents(&contents)
+	    , m_widths(&widths)
+	    , m_preferred_line_length(preferred_line_length)
+	    , m_start(start)
+	    , m_end(start)
+	    , m_word_start(start)
+	    , m_line()
+	{
+		// adjust left-side protrusion once per line
+		if(start < contents.size())
+		{
+			auto& first_item = contents[start];
+			if(auto txt = first_item->castToText())
+			{
+				assert(not txt->contents().empty());
+				auto sv = zst::wstr_view(txt->contents());
 
-				if(neighbour_width >= m_preferred_line_length && ret.empty())
+				auto& sty = m_parent_style->extendWith(txt->style());
+				if(auto p = m_interp->getMicrotypeProtrusionFor(sv[0], sty))
 				{
-					sap::warn("line breaker", "ovErFUll \\hBOx, badNesS 10001!100!");
-					ret.emplace_back(this->make_neighbour(neighbour_broken_until, neighbour_line), 10000);
-					return ret;
+					// protrusion is defined as proportion of the glyph width.
+					// so, we must calculate that.
+					auto glyph_width = sty.font()
+					                       ->getWordSize(sv.take(1), sty.font_size().into(), sty.font_features())
+					                       .x();
+					m_left_protrusion = (p->left * glyph_width).into();
 				}
-				// don't allow shrinking more than 10%, otherwise it looks kinda bad
-				else if(neighbour_width / m_preferred_line_length > 1.03)
+			}
+		}
+	}
+
+	std::optional<LineCandidate::Break> LineCandidate::advance()
+	{
+		assert(not m_finished);
+
+		// any right protrusion belongs to the previous break, which the caller has seen by now.
+		m_line.resetAdjustments();
+		m_line.setLeftProtrusion(m_left_protrusion);
+
+		if(m_end == m_contents->size())
+		{
+			// completely arbitrary. *BUT* the key goal is to have exponentially
+			// increasing costs for having a very very short last line.
+			auto ratio = m_widths->lineWidth(m_start, m_end) / m_preferred_line_length;
+
+			m_finished = true;
+			return Break { .end = m_end, .cost = 2.0 / std::pow(ratio + 1, 1.3), .kind = BreakKind::EndOfParagraph };
+		}
+
+		auto& wordorsep = (*m_contents)[m_end++];
+		m_line.m_num_parts++;
+
+		// a word ends at anything that takes up space between words; hyphenation points are part of it.
+		if(auto s = wordorsep->castToSeparator(); (s && not s->middleOfLine().empty()) || wordorsep->castToSpan())
+			m_word_start = m_end;
+
+		auto line_width = m_widths->lineWidth(m_start, m_end);
+
+		if(line_width >= m_preferred_line_length && not m_found_break)
+		{
+			m_finished = true;
+			return Break { .end = m_end, .cost = 10000, .kind = BreakKind::Overfull };
+		}
+		// don't allow shrinking more than 10%, otherwise it looks kinda bad
+		else if(line_width / m_preferred_line_length > 1.03)
+		{
+			m_finished = true;
+			return std::nullopt;
+		}
+
+		auto sep = wordorsep->castToSeparator();
+		if(sep == nullptr)
+			return std::nullopt;
+
+		double cost_mult = 1;
+		auto space_diff = (m_preferred_line_length - line_width);
+		if(space_diff < 0)
+		{
+			space_diff = space_diff.abs();
+			cost_mult = 1.05;
+		}
+
+		double cost = 0;
+
+		// note that m_end is now *TWO* guys ahead of the last non-separator in the line.
+		const tree::InlineObject* last_item = m_end >= 2 ? (*m_contents)[m_end - 2].get() : nullptr;
+
+		// If there are no spaces we pretend there's half a space,
+		// so the cost is twice as high as having 1 space
+
+		// note: this is "extra mm per space character"
+		if(sep->isHyphenationPoint() || sep->isExplicitBreakPoint())
+		{
+			auto tmp = std::max((double) m_widths->numSpaces(m_start, m_end) - 1, 0.5);
+			auto avg_space_width = m_widths->spaceWidth(m_start, m_end).mm() / tmp;
+
+			double extra_space_size = space_diff.mm() / tmp;
+			cost += 3 * extra_space_size * extra_space_size;
+			cost += 0.2 * (1 + sep->hyphenationCost()) * (avg_space_width * avg_space_width);
+
+			// add a large cost for doing shit like e-ducational (ie. for the whole part of the word before the
+			// break being short, not just the last fragment of it)
+			if(last_item != nullptr && last_item->castToText())
+			{
+				size_t word_length = 0;
+				for(size_t i = m_word_start; i + 1 < m_end; i++)
 				{
-					return ret;
+					if(auto txt = (*m_contents)[i]->castToText())
+						word_length += txt->contents().size();
 				}
 
+				assert(word_length > 0);
+				cost += pow(2, 1.0 / static_cast<double>(word_length));
+			}
+
+			if(sep->isHyphenationPoint())
+			{
+				assert(not sep->endOfLine().empty());
 
-				double cost_mult = 1;
-				auto space_diff = (m_preferred_line_length - neighbour_width);
-				if(space_diff < 0)
+				auto& sty = m_parent_style->extendWith(sep->style());
+				if(auto p = m_interp->getMicrotypeProtrusionFor(sep->endOfLine()[0], sty))
 				{
-					space_diff = space_diff.abs();
-					cost_mult = 1.05;
+					auto w = sty.font()->getWordSize(sep->endOfLine(), sty.font_size().into(), sty.font_features()).x();
+					m_line.setRightProtrusion((p->right * w).into());
 				}
-
-				if(auto sep = wordorsep->castToSeparator())
+			}
+			else
+			{
+				assert(sep->isExplicitBreakPoint());
+				if(auto txt = last_item ? last_item->castToText() : nullptr)
 				{
-					Distance cost = 0;
-					// If there are no spaces we pretend there's half a space,
-					// so the cost is twice as high as having 1 space
+					assert(not txt->contents().empty());
+					auto frag = zst::wstr_view(txt->contents());
+					auto& sty = m_parent_style->extendWith(txt->style());
 
-					// note: this is "extra mm per space character"
-					if(sep->isHyphenationPoint() || sep->isExplicitBreakPoint())
-					{
-						auto tmp = std::max((double) neighbour_line.numSpaces() - 1, 0.5);
-						auto avg_space_width = neighbour_line.totalSpaceWidth().mm() / tmp;
-
-						double extra_space_size = space_diff.mm() / tmp;
-						cost += 3 * extra_space_size * extra_space_size;
-						cost += 0.2 * (1 + sep->hyphenationCost()) * (avg_space_width * avg_space_width);
-
-						// add a large cost for doing shit like e-ducational
-						auto last_it = neighbour_broken_until - 2;
-						auto& last_item = *last_it;
-						if(auto txt = last_item->castToText())
-						{
-							assert(not txt->contents().empty());
-							auto frag = neighbour_line.lastWordFragment();
-							cost += pow(2, 1.0 / static_cast<double>(frag.size()));
-						}
-
-						if(sep->isHyphenationPoint())
-						{
-							assert(not sep->endOfLine().empty());
-
-							auto sty = m_parent_style->extendWith(sep->style());
-							if(auto p = m_interp->getMicrotypeProtrusionFor(sep->endOfLine()[0], sty))
-							{
-								auto w = sty.font()->getWordSize(sep->endOfLine(), sty.font_size().into()).x();
-								neighbour_line.setRightProtrusion((p->right * w).into());
-							}
-						}
-						else
-						{
-							assert(sep->isExplicitBreakPoint());
-							if(auto txt = last_item->castToText())
-							{
-								assert(not txt->contents().empty());
-								auto frag = neighbour_line.lastWordFragment();
-								auto sty = m_parent_style->extendWith(txt->style());
-
-								if(auto p = m_interp->getMicrotypeProtrusionFor(frag.back(), sty))
-								{
-									auto w = sty.font()->getWordSize(frag.take_last(1), sty.font_size().into()).x();
-									neighbour_line.setRightProtrusion((p->right * w).into());
-								}
-							}
-						}
-					}
-					else if(sep->hasWhitespace())
+					if(auto p = m_interp->getMicrotypeProtrusionFor(frag.back(), sty))
 					{
-						auto tmp = std::max((double) neighbour_line.numSpaces(), 0.5);
-						double extra_space_size = space_diff.mm() / tmp;
-						cost += std::pow(extra_space_size, 3);
-
-						// see if we can adjust the right side of the line.
-						// note that *neighbour_broken_until is now *TWO* guys
-						// ahead of the last non-separator in the line.
-
-						auto last_it = neighbour_broken_until - 2;
-						auto& last_item = *last_it;
-
-						if(auto txt = last_item->castToText())
-						{
-							assert(not txt->contents().empty());
-							auto sv = zst::wstr_view(txt->contents());
-
-							auto sty = m_parent_style->extendWith(txt->style());
-							if(auto p = m_interp->getMicrotypeProtrusionFor(sv.back(), sty))
-							{
-								auto w = sty.font()->getWordSize(sv.take_last(1), sty.font_size().into()).x();
-								neighbour_line.setRightProtrusion((p->right * w).into());
-							}
-						}
-					}
-					else
-					{
-						sap::internal_error("handle other sep");
+						auto w = sty.font()
+						             ->getWordSize(frag.take_last(1), sty.font_size().into(), sty.font_features())
+						             .x();
+						m_line.setRightProtrusion((p->right * w).into());
 					}
+				}
+			}
+		}
+		else if(sep->hasWhitespace())
+		{
+			auto tmp = std::max((double) m_widths->numSpaces(m_start, m_end), 0.5);
+			double extra_space_size = space_diff.mm() / tmp;
+			cost += std::pow(extra_space_size, 3);
+
+			// see if we can adjust the right side of the line.
+			if(auto txt = last_item ? last_item->castToText() : nullptr)
+			{
+				assert(not txt->contents().empty());
+				auto sv = zst::wstr_view(txt->contents());
 
-					ret.emplace_back(this->make_neighbour(neighbour_broken_until, neighbour_line), cost * cost_mult);
-					neighbour_line.resetAdjustments();
+				auto& sty = m_parent_style->extendWith(txt->style());
+				if(auto p = m_interp->getMicrotypeProtrusionFor(sv.back(), sty))
+				{
+					auto w = sty.font()->getWordSize(sv.take_last(1), sty.font_size().into(), sty.font_features()).x();
+					m_line.setRightProtrusion((p->right * w).into());
 				}
 			}
 		}
+		else
+		{
+			sap::internal_error("handle other sep");
+		}
+
+		m_found_break = true;
+		return Break { .end = m_end, .cost = cost * cost_mult, .kind = BreakKind::Normal };
+	}
+
 
-		size_t hash() const { return static_cast<size_t>(m_broken_until - m_contents->begin()); }
-		bool operator==(const LineBreakNode& other) const { return m_broken_until == other.m_broken_until; }
-	};
 
 
+	/*
+	    This is basically Knuth-Plass: for every position in the paragraph, we keep the cheapest way to break
+	    the paragraph there (the total cost, and where the last line started). Since every line ends after
+	    it starts, we can just sweep through the paragraph once, keeping a list of "active" lines (those that
+	    started at a reachable breakpoint and aren't too long yet); each of them is extended by one item at each
+	    step. By the time we get to a position, every line that could end there has been seen, so its cost is
+	    final, and we can start a new active line from it.
 
+	    We only remember costs while searching; the lines themselves are rebuilt at the end, for the breakpoints
+	    that we actually chose.
+	*/
 	std::vector<BrokenLine> breakLines(interp::Interpreter* cs,
 	    const Style& parent_style,
 	    const InlineObjVec& contents,
+	    const ParagraphWidths& widths,
 	    Length preferred_line_length)
 	{
-		auto path = util::dijkstra_shortest_path(
-		    LineBreakNode {
-		        .m_interp = cs,
-		        .m_contents = &contents,
-		        .m_parent_style = &parent_style,
-		        .m_preferred_line_length = preferred_line_length,
-		        .m_broken_until = contents.begin(),
-		        .m_end = contents.end(),
-		        .m_line = BrokenLine(parent_style),
-		    },
-		    LineBreakNode::make_end(contents.end()));
-
-		std::vector<BrokenLine> ret;
-		ret.reserve(path.size());
-
-		for(auto& node : path)
-			ret.push_back(std::move(*node.m_line));
+		if(contents.empty())
+			return { BrokenLine() };
+
+		struct Breakpoint
+		{
+			double total_cost = 0;
+			size_t line_start = 0;
+			LineCandidate::BreakKind kind {};
+			bool reachable = false;
+		};
+
+		std::vector<Breakpoint> breakpoints(contents.size() + 1);
+		breakpoints[0].reachable = true;
+
+		std::vector<LineCandidate> active_lines {};
+		for(size_t pos = 0; pos <= contents.size(); pos++)
+		{
+			if(pos < contents.size() && breakpoints[pos].reachable)
+				active_lines.emplace_back(cs, parent_style, contents, widths, pos, preferred_line_length);
+
+			for(auto& line : active_lines)
+			{
+				auto brk = line.advance();
+				if(not brk.has_value())
+					continue;
+
+				auto total_cost = breakpoints[line.start()].total_cost + brk->cost;
+				if(auto& bp = breakpoints[brk->end]; not bp.reachable || total_cost < bp.total_cost)
+				{
+					bp = Breakpoint {
+						.total_cost = total_cost,
+						.line_start = line.start(),
+						.kind = brk->kind,
+						.reachable = true,
+					};
+				}
+			}
+
+			std::erase_if(active_lines, [](const LineCandidate& line) { return line.finished(); });
+		}
+
+		if(not breakpoints.back().reachable)
+			sap::internal_error("failed to break paragraph into lines");
+
+		std::vector<size_t> line_ends {};
+		for(size_t end = contents.size(); end != 0; end = breakpoints[end].line_start)
+			line_ends.push_back(end);
+
+		std::reverse(line_ends.begin(), line_ends.end());
+
+		std::vector<BrokenLine> ret {};
+		ret.reserve(line_ends.size());
+
+		for(auto end : line_ends)
+		{
+			auto& bp = breakpoints[end];
+			auto line = LineCandidate(cs, parent_style, contents, widths, bp.line_start, preferred_line_length);
+
+			while(true)
+			{
+				assert(not line.finished());
+				if(auto brk = line.advance(); brk.has_value() && brk->end == end && brk->kind == bp.kind)
+					break;
+			}
+
+			if(bp.kind == LineCandidate::BreakKind::Overfull)
+				sap::warn("line breaker", "ovErFUll \\hBOx, badNesS 10001!100!");
+
+			ret.push_back(std::move(line.line()));
+		}
 
 		return ret;
 	}
@@ -16,82 +16,107 @@
 
 namespace sap::layout::linebreak
 {
-	struct BrokenLine
+	/*
+	    The widths of everything in a (flattened) paragraph, measured once up front. Every word and span is
+	    measured once, and so is every separator, both in the middle of a line and at the end of one. These are
+	    kept as prefix sums (struct-of-arrays style), so that the width of any candidate line is just a
+	    subtraction.
+
+	    Besides the natural width, we keep the total width of the (whitespace) separators, which is the part of
+	    a line that gets stretched or shrunk when it is justified; spaces stretch and shrink in proportion to
+	    their preferred width, so the same sum serves for both.
+
+	    The fragments of a hyphenated word are measured together (each one is as wide as the amount it adds to
+	    the word so far), since that is how they are drawn; so a fragment that starts a line (after the word was
+	    broken) is measured by itself instead.
+	*/
+	struct ParagraphWidths
 	{
-		explicit BrokenLine(const Style& parent_style) : m_parent_style(parent_style) { }
-
-	private:
-		Style m_parent_style;
+		ParagraphWidths(const Style& parent_style, const std::vector<zst::SharedPtr<tree::InlineObject>>& contents);
 
-		enum
+		// the same widths, for another copy of the paragraph (with the same objects in the same styles)
+		ParagraphWidths(const ParagraphWidths& other, const std::vector<zst::SharedPtr<tree::InlineObject>>& contents)
+		    : ParagraphWidths(other)
 		{
-			NONE,
-			WORD,
-			SPAN,
-		} m_last_obj_kind
-		    = NONE;
+			assert(contents.size() == this->size());
+			m_contents = contents.data();
+		}
 
-		Length m_line_height = 0;
-		Length m_total_space_width = 0;
-		Length m_line_width_excluding_last_word = 0;
+		size_t size() const { return m_item_width.size(); }
 
-		std::u32string m_last_word {};
-		const tree::Separator* m_last_sep = nullptr;
-		const tree::InlineSpan* m_last_span = nullptr;
+		// the natural width of a line containing the items [begin, end)
+		Length lineWidth(size_t begin, size_t end) const
+		{
+			if(begin == end)
+				return 0;
 
-		Style m_current_style = Style::empty();
+			return m_natural_prefix[end - 1] - m_natural_prefix[begin] + m_end_of_line_width[end - 1]
+			     + (m_start_of_line_width[begin] - m_item_width[begin]);
+		}
 
-		util::hashmap<size_t, Length> m_adjustments {};
+		// the total preferred width of the spaces in the middle of a line containing the items [begin, end)
+		Length spaceWidth(size_t begin, size_t end) const
+		{
+			return begin == end ? 0 : m_space_prefix[end - 1] - m_space_prefix[begin];
+		}
 
-		Length m_left_protrusion = 0;
-		Length m_right_protrusion = 0;
+		// the number of spaces in the middle of a line containing the items [begin, end)
+		size_t numSpaces(size_t begin, size_t end) const
+		{
+			return begin == end ? 0 : m_num_spaces_prefix[end - 1] - m_num_spaces_prefix[begin];
+		}
 
-		size_t m_num_spaces = 0;
-		size_t m_num_parts = 0;
+		// the width of a word (fragment) or span by itself
+		Length itemWidth(size_t idx) const { return m_start_of_line_width[idx]; }
 
-		// Helper functions
-		static Size2d calc_word_size(zst::wstr_view text, const Style& style)
+		// the width that a separator would like to take up (ie. before justification)
+		Length preferredSeparatorWidth(size_t idx, bool is_end_of_line) const
 		{
-			return style.font()->getWordSize(text, style.font_size().into()).into();
+			return is_end_of_line ? m_end_of_line_width[idx] : m_item_width[idx];
 		}
 
-		static Size2d calc_span_size(const tree::InlineSpan* span)
+		// the width of the separator's text itself
+		Length realSeparatorWidth(size_t idx, bool is_end_of_line) const
 		{
-			// FIXME: span heights not calculated correctly
-			assert(span->hasOverriddenWidth());
-			return { *span->getOverriddenWidth(), 0 };
+			return is_end_of_line ? m_real_sep_width_end_of_line[idx] : m_real_sep_width[idx];
 		}
 
-	public:
-		Length totalSpaceWidth() const { return m_total_space_width; }
-		zst::wstr_view lastWordFragment() const { return m_last_word; }
-
-		Length width()
+		// the index of the given object, which must be one of the objects this was computed for.
+		size_t indexOf(const zst::SharedPtr<tree::InlineObject>* obj) const
 		{
-			auto last_word_style = m_current_style;
-			if(m_last_sep != nullptr)
-			{
-				m_last_word += m_last_sep->endOfLine().sv();
-
-				auto word_width = calc_word_size(m_last_word, last_word_style).x();
-				auto ret = m_line_width_excluding_last_word + word_width;
-
-				// if the previous thing wasn't even a word, we have to add its size as well,
-				// because it doesn't have text in m_last_word
-				if(m_last_obj_kind == SPAN)
-					ret += calc_span_size(m_last_span).x();
-
-				m_last_word.erase(m_last_word.size() - m_last_sep->endOfLine().size());
-				return ret;
-			}
-			else
-			{
-				return m_line_width_excluding_last_word + get_size_of_last_thing(last_word_style).x();
-			}
+			assert(m_contents <= obj && obj < m_contents + this->size());
+			return static_cast<size_t>(obj - m_contents);
 		}
 
+	private:
+		const zst::SharedPtr<tree::InlineObject>* m_contents;
+
+		// for words and spans, their width; for separators, their preferred width in the middle of a line.
+		std::vector<Length> m_item_width;
+
+		// the width of each item when it is the last one in a line. this only differs for separators.
+		std::vector<Length> m_end_of_line_width;
+
+		// the width of each item when it is the first one in a line. this only differs for word fragments.
+		std::vector<Length> m_start_of_line_width;
+
+		// only for separators
+		std::vector<Length> m_real_sep_width;
+		std::vector<Length> m_real_sep_width_end_of_line;
+
+		// prefix sums (one longer than the paragraph) of the above
+		std::vector<Length> m_natural_prefix;
+		std::vector<Length> m_space_prefix;
+		std::vector<uint32_t> m_num_spaces_prefix;
+	};
+
+	/*
+	    One line of a paragraph as decided by the line breaker: how many of the paragraph's (flattened)
+	    inline objects it contains, and how far it protrudes into the margins.
+	*/
+	struct BrokenLine
+	{
 		size_t numParts() const { return m_num_parts; }
-		size_t numSpaces() const { return m_num_spaces; }
 
 		Length leftProtrusion() const { return m_left_protrusion; }
 		Length rightProtrusion() const { return m_right_protrusion; }
@@ -109,126 +134,76 @@ namespace sap::layout::linebreak
 			m_right_protrusion = 0;
 		}
 
-		void add(const tree::InlineObject* obj)
-		{
-			this->_add(obj);
-			m_num_parts++;
-		}
+	private:
+		friend struct LineCandidate;
 
+		size_t m_num_parts = 0;
 
-	private:
-		void _add(const tree::InlineObject* obj)
-		{
-			assert(obj != nullptr);
-
-			if(auto t = obj->castToText())
-			{
-				// zpr::println("add word ({})", t->contents());
-				this->add_word(t);
-			}
-			else if(auto s = obj->castToSeparator())
-			{
-				// zpr::println("add sep");
-				this->add_sep(s);
-			}
-			else if(auto ss = obj->castToSpan())
-			{
-				// zpr::println("add span ({})", ss->canSplit());
-				this->add_span(ss);
-			}
-			else
-				sap::internal_error("unsupported: {}", typeid(*obj).name());
-		}
+		util::hashmap<size_t, Length> m_adjustments {};
+
+		Length m_left_protrusion = 0;
+		Length m_right_protrusion = 0;
+	};
 
-		Size2d get_size_of_last_thing(const Style& style)
+	/*
+	    A line starting at some breakpoint in the paragraph, which is extended one item at a time. This is where
+	    the cost model lives: after each item, `advance` says whether the line could be broken there, and how
+	    much that would cost. Once the line gets too long, it is `finished` and can't be extended any further.
+	*/
+	struct LineCandidate
+	{
+		enum class BreakKind
 		{
-			if(m_last_obj_kind == WORD)
-				return calc_word_size(m_last_word, style);
-			else if(m_last_obj_kind == SPAN)
-				return calc_span_size(m_last_span);
-			else
-				return { 0, 0 };
-		}
+			Normal,
+			Overfull,
+			EndOfParagraph,
+		};
 
-		void add_span(const tree::InlineSpan* span)
+		struct Break
 		{
-			// since we're adding one entire span here, "splittability" isn't the deciding factor.
-			if(span->hasOverriddenWidth())
-			{
-				this->add_span_or_word(span->style());
-
-				m_last_obj_kind = SPAN;
-				m_last_span = span;
-			}
-			else
-			{
-				for(const auto& obj : span->objects())
-					this->_add(obj.get());
-			}
-		}
+			size_t end;
+			double cost;
+			BreakKind kind;
+		};
 
-		void add_sep(const tree::Separator* sep) { m_last_sep = sep; }
+		LineCandidate(interp::Interpreter* cs,
+		    const Style& parent_style,
+		    const std::vector<zst::SharedPtr<tree::InlineObject>>& contents,
+		    const ParagraphWidths& widths,
+		    size_t start,
+		    Length preferred_line_length);
 
-		void add_word(const tree::Text* word)
-		{
-			auto word_style = m_parent_style.extendWith(word->style());
+		std::optional<Break> advance();
 
-			auto lh = calc_word_size(word->contents(), word_style).y() * word_style.line_spacing();
-			m_line_height = std::max(m_line_height, lh);
+		size_t start() const { return m_start; }
+		bool finished() const { return m_finished; }
 
-			if(bool replace_last_word = this->add_span_or_word(word->style()); replace_last_word)
-				m_last_word = word->contents();
-			else
-				m_last_word += word->contents();
+		BrokenLine& line() { return m_line; }
+		const BrokenLine& line() const { return m_line; }
 
-			m_last_obj_kind = WORD;
-		}
+	private:
+		interp::Interpreter* m_interp;
+		const Style* m_parent_style;
+		const std::vector<zst::SharedPtr<tree::InlineObject>>* m_contents;
+		const ParagraphWidths* m_widths;
+		Length m_preferred_line_length;
 
-		bool add_span_or_word(const Style& style)
-		{
-			auto prev_word_style = m_current_style;
-			auto word_style = m_parent_style.extendWith(style);
-
-			bool replace_last_word = false;
-			if(m_last_sep != nullptr && m_last_sep->hasWhitespace())
-			{
-				m_num_spaces++;
-
-				m_line_width_excluding_last_word += get_size_of_last_thing(prev_word_style).x();
-				replace_last_word = true;
-			}
-			else if(m_last_span != nullptr || m_current_style != style)
-			{
-				m_line_width_excluding_last_word += get_size_of_last_thing(prev_word_style).x();
-				replace_last_word = true;
-			}
-			else
-			{
-				// either there is no last separator, or the last separator was a hyphen
-				replace_last_word = false;
-			}
-
-			if(m_last_sep != nullptr)
-			{
-				auto sep_width = calculatePreferredSeparatorWidth(m_last_sep, /* end of line: */ false, //
-				    prev_word_style, word_style);
-
-				m_line_width_excluding_last_word += sep_width;
-
-				if(m_last_sep->hasWhitespace())
-					m_total_space_width += sep_width;
-			}
-
-			m_current_style = m_parent_style.extendWith(style);
-			m_last_span = nullptr;
-			m_last_sep = nullptr;
-
-			return replace_last_word;
-		}
+		size_t m_start;
+		size_t m_end;
+
+		// where the word that the line currently ends in starts, for hyphenation
+		size_t m_word_start;
+
+		BrokenLine m_line;
+		Length m_left_protrusion = 0;
+
+		bool m_found_break = false;
+		bool m_finished = false;
 	};
 
 	std::vector<BrokenLine> breakLines(interp::Interpreter* cs,
 	    const Style& parent_style,
 	    const std::vector<zst::SharedPtr<tree::InlineObject>>& contents,
+	    const ParagraphWidths& widths,
 	    Length preferred_line_length);
 }
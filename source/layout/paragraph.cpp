@@ -2,6 +2,7 @@
 // Copyright (c) 2021, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
 #include <variant>
 
 #include "util.h"
@@ -25,6 +26,9 @@
 #include "layout/paragraph.h"
 #include "layout/linebreak.h"
 
+#include "misc/hyphenator.h"
+#include "misc/timings.h"
+
 namespace sap::layout
 {
 	Paragraph::Paragraph(const Style& style,
@@ -66,7 +70,7 @@ namespace sap::layout
 			cursor = cursor.moveRight(initial_pos.x() - cursor.position().pos.x());
 
 			const auto space_width = std::max(Length(0), m_layout_size.width - line->layoutSize().width);
-			switch(m_style.horz_alignment())
+			switch(m_style->horz_alignment())
 			{
 				case Left:
 				case Justified: break;
@@ -116,11 +120,328 @@ namespace sap::tree
 		}
 	}
 
+	/*
+	    Everything about a paragraph's layout up to (and including) breaking it into lines. This only depends on
+	    the paragraph's contents, its style, and the available width, so for paragraphs without scripts, we keep
+	    it across layout passes; documents that need more than one pass (eg. for cross-references) then don't
+	    need to break every paragraph again. Making the actual lines is cheap, and needs to be redone every pass
+	    anyway, since it sets the generated layout objects of the inline objects.
+	*/
+	struct Paragraph::BrokenParagraph
+	{
+		// the (top-level) objects point to this as their parent span, so it needs to stay alive with them.
+		zst::SharedPtr<InlineSpan> wrapper;
+
+		std::vector<zst::SharedPtr<InlineObject>> para_objects;
+		std::vector<zst::SharedPtr<InlineObject>> flat;
+
+		// note: this points into `flat`, whose storage stays put when we are moved.
+		std::optional<layout::linebreak::ParagraphWidths> widths;
+		std::vector<layout::linebreak::BrokenLine> lines;
+
+		// what it was computed from
+		Style style;
+		Length available_width;
+		std::vector<zst::SharedPtr<InlineObject>> contents;
+		uint64_t contents_hash;
+	};
+
+	// the objects themselves are compared by identity, but texts can be edited in place (eg. by hooks).
+	static uint64_t hash_texts(const std::vector<zst::SharedPtr<InlineObject>>& contents)
+	{
+		uint64_t hash = 0;
+		for(auto& obj : contents)
+		{
+			if(auto text = obj->castToText(); text != nullptr)
+				hash = XXH64(text->contents().data(), text->contents().size() * sizeof(char32_t), hash);
+		}
+
+		return hash;
+	}
+
+
+	/*
+	    In watch mode, the document is parsed and laid out from scratch on every recompile, with a new
+	    interpreter (and new fonts), so none of the tree or layout objects survive. What we can keep is plain
+	    data: how each paragraph's objects came out of processing (see `ProcessedObject`), their widths, and
+	    where the paragraph was broken into lines. This is keyed by a fingerprint of the paragraph's contents,
+	    its style, the available width, and everything else that goes into breaking it (the microtype configs
+	    and the hyphenation patterns), so a paragraph that did not change between edits finds its old lines,
+	    even if it moved around in the document.
+
+	    Each compile only keeps the entries that it used (or made), so the cache follows the document as it is
+	    edited, and doesn't grow without bound.
+	*/
+	namespace
+	{
+		/*
+		    One object of a processed paragraph (ie. after splitting into words, hyphenation, replacements, and
+		    font fallbacks), in terms of the objects that went in, which are numbered in pre-order. The processed
+		    objects are also kept in pre-order, so this can be replayed on the objects of the same paragraph in a
+		    later compile -- which are new objects, in new styles, but otherwise the same.
+		*/
+		struct ProcessedObject
+		{
+			enum Kind : uint8_t
+			{
+				ORIGINAL,
+				TEXT,
+				SEPARATOR,
+			};
+
+			Kind kind;
+			uint32_t source;
+
+			// for texts: the contents, and which of the style's font fallbacks it uses (if any)
+			std::u32string text {};
+			std::optional<uint32_t> fallback {};
+
+			// for separators
+			Separator::SeparatorKind separator_kind {};
+			int hyphenation_cost = 0;
+
+			// for spans (which are always kept as they are): the number of objects in it, which come next.
+			uint32_t num_objects = 0;
+		};
+
+		struct CachedParagraph
+		{
+			// empty if the processing could not be recorded; then only the lines are reused.
+			std::vector<ProcessedObject> objects;
+			size_t num_para_objects = 0;
+
+			// note: these point to the (flattened) objects of the compile that made them, so they must be
+			// given new ones before they are used.
+			std::optional<layout::linebreak::ParagraphWidths> widths;
+			std::vector<layout::linebreak::BrokenLine> lines;
+		};
+
+		struct LineBreakCache
+		{
+			std::mutex mutex;
+			bool enabled = false;
+
+			util::hashmap<uint64_t, std::shared_ptr<const CachedParagraph>> previous;
+			util::hashmap<uint64_t, std::shared_ptr<const CachedParagraph>> current;
+
+			size_t num_reused = 0;
+			size_t num_broken = 0;
+		};
+
+		struct Fingerprint
+		{
+			template <typename T>
+			requires std::is_trivially_copyable_v<T>
+			void add(const T& value)
+			{
+				hash = XXH64(&value, sizeof(T), hash);
+			}
+
+			void add(Length len) { this->add(len.value()); }
+			void add(zst::wstr_view str) { hash = XXH64(str.data(), str.size() * sizeof(char32_t), hash); }
+			void add(std::string_view str) { hash = XXH64(str.data(), str.size(), hash); }
+
+			void add(const FontFamily& family)
+			{
+				for(auto font : { family.regular(), family.italic(), family.bold(), family.boldItalic() })
+					this->add(std::string_view(font->name()));
+			}
+
+			uint64_t hash = 0;
+		};
+	}
+
+	static LineBreakCache& line_break_cache()
+	{
+		static LineBreakCache cache {};
+		return cache;
+	}
+
+	void Paragraph::setKeepLineBreaksAcrossCompiles(bool keep)
+	{
+		auto& cache = line_break_cache();
+		auto lk = std::unique_lock(cache.mutex);
+
+		cache.enabled = keep;
+		if(not keep)
+		{
+			cache.previous.clear();
+			cache.current.clear();
+		}
+	}
+
+	void Paragraph::startNewCompile()
+	{
+		auto& cache = line_break_cache();
+		auto lk = std::unique_lock(cache.mutex);
+
+		cache.previous = std::move(cache.current);
+		cache.current.clear();
+		cache.num_reused = 0;
+		cache.num_broken = 0;
+	}
+
+	std::pair<size_t, size_t> Paragraph::lineBreakReuseStats()
+	{
+		auto& cache = line_break_cache();
+		auto lk = std::unique_lock(cache.mutex);
+
+		return { cache.num_reused, cache.num_reused + cache.num_broken };
+	}
+
+	static void fingerprint_style(Fingerprint& fp, const Style& style)
+	{
+		// fonts are compared by name, since the PdfFont objects themselves are new for every compile.
+		fp.add(style.have_font_family());
+		if(style.have_font_family())
+			fp.add(style.font_family());
+
+		fp.add(style.have_font_fallbacks());
+		if(style.have_font_fallbacks())
+		{
+			for(auto& family : *style.font_fallbacks())
+				fp.add(family);
+		}
+
+		fp.add(style.have_font_features());
+		if(style.have_font_features())
+			fp.add(style.font_features());
+
+		fp.add(style.have_font_style());
+		if(style.have_font_style())
+			fp.add(style.font_style());
+
+		fp.add(style.have_font_size());
+		if(style.have_font_size())
+			fp.add(style.font_size());
+
+		fp.add(style.have_root_font_size());
+		if(style.have_root_font_size())
+			fp.add(style.root_font_size());
+
+		fp.add(style.have_line_spacing());
+		if(style.have_line_spacing())
+			fp.add(style.line_spacing());
+
+		fp.add(style.have_sentence_space_stretch());
+		if(style.have_sentence_space_stretch())
+			fp.add(style.sentence_space_stretch());
+
+		fp.add(style.have_paragraph_spacing());
+		if(style.have_paragraph_spacing())
+			fp.add(style.paragraph_spacing());
+
+		fp.add(style.have_horz_alignment());
+		if(style.have_horz_alignment())
+			fp.add(style.horz_alignment());
+
+		fp.add(style.have_colour());
+		if(style.have_colour())
+		{
+			auto colour = style.colour();
+			fp.add(colour.type());
+			if(colour.isRGB())
+				fp.add(colour.rgb());
+			else
+				fp.add(colour.cmyk());
+		}
+
+		fp.add(style.have_smart_quotes_enablement());
+		if(style.have_smart_quotes_enablement())
+			fp.add(style.smart_quotes_enabled());
+
+		fp.add(style.have_language());
+		if(style.have_language())
+		{
+			fp.add(style.language());
+			if(auto hyphenator = hyph::Hyphenator::forLanguage(style.language()); hyphenator != nullptr)
+				fp.add(hyphenator->patternsHash());
+		}
+	}
+
+	// returns false if the objects can't be fingerprinted (ie. if there are scripts somewhere inside)
+	static bool fingerprint_objects(Fingerprint& fp, const std::vector<zst::SharedPtr<InlineObject>>& objs)
+	{
+		fp.add(objs.size());
+		for(auto& obj : objs)
+		{
+			fingerprint_style(fp, obj->style());
+			fp.add(obj->raiseHeight());
+
+			if(auto text = obj->castToText(); text != nullptr)
+			{
+				fp.add('t');
+				fp.add(zst::wstr_view(text->contents()));
+			}
+			else if(auto sep = obj->castToSeparator(); sep != nullptr)
+			{
+				fp.add('s');
+				fp.add(sep->kind());
+				fp.add(sep->hyphenationCost());
+			}
+			else if(auto span = obj->castToSpan(); span != nullptr)
+			{
+				fp.add('p');
+				fp.add(span->canSplit());
+				fp.add(span->getOverriddenWidth().value_or(Length(-1)));
+				if(not fingerprint_objects(fp, span->objects()))
+					return false;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 
 	auto Paragraph::create_layout_object_impl(interp::Interpreter* cs,
 	    const Style& parent_style,
 	    Size2d available_space) const -> ErrorOr<LayoutResult>
 	{
+		auto& style = parent_style.extendWith(this->style());
+
+		// without any scripts to run, we don't need the interpreter's block context (or anything else that is
+		// not thread-safe), so Container might be calling us from another thread.
+		if(not this->hasScriptCalls())
+		{
+			auto contents_hash = hash_texts(m_contents);
+			if(m_layout_cache == nullptr || m_layout_cache->available_width != available_space.x()
+			    || m_layout_cache->contents_hash != contents_hash || m_layout_cache->contents != m_contents
+			    || m_layout_cache->style != style)
+			{
+				auto inlines = zst::make_shared<InlineSpan>(/* glue: */ false);
+				inlines->addObjects(m_contents);
+
+				std::optional<uint64_t> fingerprint {};
+				if(line_break_cache().enabled)
+				{
+					auto fp = Fingerprint {};
+					fingerprint_style(fp, style);
+					fp.add(available_space.x());
+					fp.add(cs->microtypeConfigHash());
+
+					if(fingerprint_objects(fp, m_contents))
+						fingerprint = fp.hash;
+				}
+
+				auto tmp = std::move(inlines->objects());
+				auto broken = TRY(this->break_into_lines(cs, style, std::move(tmp), available_space.x(), fingerprint));
+
+				broken.wrapper = std::move(inlines);
+				broken.style = style;
+				broken.available_width = available_space.x();
+				broken.contents = m_contents;
+				broken.contents_hash = contents_hash;
+
+				m_layout_cache = std::make_shared<BrokenParagraph>(std::move(broken));
+			}
+
+			return this->make_lines(cs, style, *m_layout_cache, available_space);
+		}
+
 		auto _ = cs->evaluator().pushBlockContext(this);
 
 		auto objs = TRY(this->evaluate_scripts(cs, available_space));
@@ -130,16 +451,299 @@ namespace sap::tree
 		else if(objs->is_right())
 			return Ok(LayoutResult::make(objs->take_right()));
 
-		auto style = parent_style.extendWith(this->style());
-
 		// note: the InlineSpan must continue to live here, so don't `take` it;
 		// just steal its objects.
 		auto tmp = std::move(objs->left()->objects());
-		auto para_objects = TRY(tree::processWordSeparators(std::move(tmp)));
-		if(para_objects.empty())
-			return Ok(LayoutResult::empty());
+		auto broken = TRY(this->break_into_lines(cs, style, std::move(tmp), available_space.x(), std::nullopt));
+
+		return this->make_lines(cs, style, broken, available_space);
+	}
+
+
+	// the objects (including those in spans) in pre-order; this also forgets what they were copied from, so
+	// that the processed objects can be traced back to them.
+	static void collect_objects(const std::vector<zst::SharedPtr<InlineObject>>& objs,
+	    std::vector<zst::SharedPtr<InlineObject>>& collected)
+	{
+		for(auto& obj : objs)
+		{
+			obj->clearCopiedFrom();
+			collected.push_back(obj);
+
+			if(auto span = obj->castToSpan(); span != nullptr)
+				collect_objects(span->objects(), collected);
+		}
+	}
+
+	static bool record_processed_objects(const Style& parent_style,
+	    const std::vector<zst::SharedPtr<InlineObject>>& objs,
+	    const util::hashmap<const InlineObject*, uint32_t>& sources,
+	    std::vector<ProcessedObject>& recorded)
+	{
+		for(auto& obj : objs)
+		{
+			if(auto it = sources.find(obj.get()); it != sources.end())
+			{
+				recorded.push_back(ProcessedObject { .kind = ProcessedObject::ORIGINAL, .source = it->second });
+				if(auto span = obj->castToSpan(); span != nullptr)
+				{
+					recorded.back().num_objects = util::checked_cast<uint32_t>(span->objects().size());
+					if(not record_processed_objects(parent_style.extendWith(span->style()), span->objects(), sources,
+					       recorded))
+						return false;
+				}
+
+				continue;
+			}
+
+			auto src = obj->copiedFrom();
+			auto it = src != nullptr ? sources.find(src) : sources.end();
+			if(it == sources.end())
+				return false;
+
+			if(auto text = obj->castToText(); text != nullptr)
+			{
+				auto& rec = recorded.emplace_back(ProcessedObject {
+				    .kind = ProcessedObject::TEXT,
+				    .source = it->second,
+				    .text = text->contents(),
+				});
+
+				// the only thing that changes the style is falling back to another font.
+				if(&obj->style() != &src->style())
+				{
+					auto& style = parent_style.extendWith(src->style());
+					if(not style.have_font_fallbacks())
+						return false;
+
+					auto& fallbacks = *style.font_fallbacks();
+					for(uint32_t k = 0; k < fallbacks.size() && not rec.fallback.has_value(); k++)
+					{
+						if(&src->style().with_font_family(fallbacks[k]).interned() == &obj->style())
+							rec.fallback = k;
+					}
+
+					if(not rec.fallback.has_value())
+						return false;
+				}
+			}
+			else if(auto sep = obj->castToSeparator(); sep != nullptr)
+			{
+				recorded.push_back(ProcessedObject {
+				    .kind = ProcessedObject::SEPARATOR,
+				    .source = it->second,
+				    .separator_kind = sep->kind(),
+				    .hyphenation_cost = sep->hyphenationCost(),
+				});
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	using SpanObjects = std::vector<std::pair<InlineSpan*, std::vector<zst::SharedPtr<InlineObject>>>>;
+
+	// note: the objects of spans are only replaced (in `span_objects`) once everything was replayed successfully.
+	static bool replay_processed_objects(const Style& parent_style,
+	    const std::vector<ProcessedObject>& recorded,
+	    size_t& pos,
+	    size_t count,
+	    const std::vector<zst::SharedPtr<InlineObject>>& sources,
+	    std::vector<zst::SharedPtr<InlineObject>>& objs,
+	    SpanObjects& span_objects)
+	{
+		for(size_t i = 0; i < count; i++)
+		{
+			if(pos >= recorded.size() || recorded[pos].source >= sources.size())
+				return false;
+
+			auto& rec = recorded[pos++];
+			auto& src = sources[rec.source];
+
+			if(rec.kind == ProcessedObject::ORIGINAL)
+			{
+				if(auto span = src->castToSpan(); span != nullptr)
+				{
+					std::vector<zst::SharedPtr<InlineObject>> span_objs {};
+					if(not replay_processed_objects(parent_style.extendWith(span->style()), recorded, pos,
+					       rec.num_objects, sources, span_objs, span_objects))
+						return false;
+
+					span_objects.emplace_back(span, std::move(span_objs));
+				}
+				else if(rec.num_objects > 0)
+				{
+					return false;
+				}
+
+				objs.push_back(src);
+			}
+			else if(rec.kind == ProcessedObject::TEXT)
+			{
+				auto text = zst::make_shared<Text>(rec.text);
+				text->copyAttributesFrom(*src);
+
+				if(rec.fallback.has_value())
+				{
+					auto& style = parent_style.extendWith(src->style());
+					if(not style.have_font_fallbacks() || *rec.fallback >= style.font_fallbacks()->size())
+						return false;
+
+					text->setStyle(text->style().with_font_family((*style.font_fallbacks())[*rec.fallback]));
+				}
+
+				objs.push_back(std::move(text));
+			}
+			else
+			{
+				auto sep = zst::make_shared<Separator>(rec.separator_kind, rec.hyphenation_cost);
+				sep->copyAttributesFrom(*src);
+
+				objs.push_back(std::move(sep));
+			}
+		}
+
+		return true;
+	}
+
+	auto Paragraph::break_into_lines(interp::Interpreter* cs,
+	    const Style& style,
+	    std::vector<zst::SharedPtr<InlineObject>> objs,
+	    Length available_width,
+	    std::optional<uint64_t> fingerprint) const -> ErrorOr<BrokenParagraph>
+	{
+		BrokenParagraph ret {};
+		util::timings::addToCounter("paragraphs broken into lines", 1);
+
+		// see if we broke the same paragraph in the previous compile.
+		std::shared_ptr<const CachedParagraph> cached {};
+		std::vector<zst::SharedPtr<InlineObject>> sources {};
+		if(fingerprint.has_value())
+		{
+			auto& cache = line_break_cache();
+			auto lk = std::unique_lock(cache.mutex);
+
+			if(auto it = cache.current.find(*fingerprint); it != cache.current.end())
+				cached = it->second;
+			else if(auto prev = cache.previous.find(*fingerprint); prev != cache.previous.end())
+				cached = cache.current.emplace(*fingerprint, std::move(prev->second)).first->second;
+
+			collect_objects(objs, sources);
+		}
+
+		// a collision is quite unlikely, but at least make sure that the lines cover the paragraph.
+		auto lines_cover_paragraph = [&ret](const CachedParagraph& para) {
+			size_t num_parts = 0;
+			for(auto& line : para.lines)
+				num_parts += line.numParts();
+
+			return num_parts == ret.flat.size();
+		};
+
+		if(cached != nullptr && not cached->objects.empty())
+		{
+			size_t pos = 0;
+			SpanObjects span_objects {};
+			std::vector<zst::SharedPtr<InlineObject>> para_objects {};
+
+			if(replay_processed_objects(style, cached->objects, pos, cached->num_para_objects, sources, para_objects,
+			       span_objects)
+			    && pos == cached->objects.size())
+			{
+				for(auto& [span, span_objs] : span_objects)
+				{
+					span->objects().clear();
+					span->addObjects(std::move(span_objs));
+				}
+
+				ret.para_objects = std::move(para_objects);
+				flatten_para(ret.para_objects, ret.flat);
+
+				if(lines_cover_paragraph(*cached))
+				{
+					auto& cache = line_break_cache();
+					auto lk = std::unique_lock(cache.mutex);
+					cache.num_reused++;
+
+					ret.widths.emplace(*cached->widths, ret.flat);
+					ret.lines = cached->lines;
+					return OkMove(ret);
+				}
+			}
+			else
+			{
+				// nothing was changed yet, so just process the objects normally.
+				cached = nullptr;
+			}
+		}
+
+		if(ret.para_objects.empty())
+		{
+			auto para_objects = TRY(tree::processWordSeparators(std::move(objs)));
+			if(para_objects.empty())
+				return OkMove(ret);
+
+			para_objects = TRY(tree::insertHyphenationPoints(style, std::move(para_objects)));
+			para_objects = TRY(tree::performReplacements(style, std::move(para_objects)));
+			para_objects = TRY(tree::applyFontFallbacks(style, std::move(para_objects)));
+
+			ret.para_objects = std::move(para_objects);
+
+			// break after flattening.
+			flatten_para(ret.para_objects, ret.flat);
+		}
+
+		// if only the processing could not be recorded, we can still reuse the rest, since processing the same
+		// objects gives the same result.
+		if(cached != nullptr && cached->objects.empty() && lines_cover_paragraph(*cached))
+		{
+			auto& cache = line_break_cache();
+			auto lk = std::unique_lock(cache.mutex);
+			cache.num_reused++;
+
+			ret.widths.emplace(*cached->widths, ret.flat);
+			ret.lines = cached->lines;
+			return OkMove(ret);
+		}
+
+		ret.widths.emplace(style, ret.flat);
+		ret.lines = layout::linebreak::breakLines(cs, style, ret.flat, *ret.widths, available_width);
+
+		if(not fingerprint.has_value())
+			return OkMove(ret);
+
+		auto entry = std::make_shared<CachedParagraph>();
+		entry->widths = ret.widths;
+		entry->lines = ret.lines;
+		entry->num_para_objects = ret.para_objects.size();
+
+		util::hashmap<const InlineObject*, uint32_t> source_indices {};
+		for(size_t i = 0; i < sources.size(); i++)
+			source_indices.emplace(sources[i].get(), util::checked_cast<uint32_t>(i));
+
+		if(not record_processed_objects(style, ret.para_objects, source_indices, entry->objects))
+			entry->objects.clear();
+
+		auto& cache = line_break_cache();
+		auto lk = std::unique_lock(cache.mutex);
+		cache.num_broken++;
+		cache.current.insert_or_assign(*fingerprint, std::move(entry));
+
+		return OkMove(ret);
+	}
 
-		para_objects = TRY(tree::performReplacements(style, std::move(para_objects)));
+
+	auto Paragraph::make_lines(interp::Interpreter* cs,
+	    const Style& style,
+	    const BrokenParagraph& broken,
+	    Size2d available_space) const -> ErrorOr<LayoutResult>
+	{
+		if(broken.para_objects.empty())
+			return Ok(LayoutResult::empty());
 
 		std::vector<std::unique_ptr<layout::Line>> layout_lines {};
 		LayoutSize para_size {};
@@ -195,14 +799,10 @@ namespace sap::tree
 			});
 		};
 
-		// break after flattening.
-		std::vector<zst::SharedPtr<InlineObject>> flat {};
-		flatten_para(para_objects, flat);
-
-		auto broken_lines = layout::linebreak::breakLines(cs, style, flat, available_space.x());
+		const auto& flat = broken.flat;
 
 		size_t current_idx = 0;
-		for(auto line_it = broken_lines.begin(); line_it != broken_lines.end(); ++line_it)
+		for(auto line_it = broken.lines.begin(); line_it != broken.lines.end(); ++line_it)
 		{
 			auto& broken_line = *line_it;
 
@@ -222,7 +822,7 @@ namespace sap::tree
 			auto& [word_span, line_adj] = the_lines[i];
 
 			auto layout_line = layout::Line::fromInlineObjects(cs, style, word_span, available_space, is_first_line,
-			    is_last_line, line_adj);
+			    is_last_line, line_adj, broken.widths.has_value() ? &*broken.widths : nullptr);
 
 			auto line_size = layout_line->layoutSize();
 
@@ -241,7 +841,7 @@ namespace sap::tree
 		}
 
 		auto layout_para = std::unique_ptr<layout::Paragraph>(new layout::Paragraph(style, para_size,
-		    std::move(layout_lines), std::move(para_objects)));
+		    std::move(layout_lines), broken.para_objects));
 
 		return Ok(LayoutResult::make(std::move(layout_para)));
 	}
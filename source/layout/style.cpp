@@ -2,13 +2,201 @@
 // Copyright (c) 2022, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <deque>
+#include <mutex>
+#include <atomic>
+
 #include "sap/style.h"
 
 namespace sap
 {
+	namespace
+	{
+		struct StyleRegistry
+		{
+			// the empty style is always the first one, so that it can be kept when the others are forgotten.
+			StyleRegistry() { this->intern(Style()); }
+
+			const Style* intern(const Style& style)
+			{
+				auto lk = std::unique_lock(mtx);
+
+				auto& bucket = buckets[style.hash()];
+				for(auto s : bucket)
+				{
+					if(*s == style)
+						return s;
+				}
+
+				auto ret = &styles.emplace_back(style);
+				bucket.push_back(ret);
+
+				return ret;
+			}
+
+			void clear()
+			{
+				auto lk = std::unique_lock(mtx);
+
+				styles.resize(1);
+				buckets.clear();
+				buckets[styles.front().hash()].push_back(&styles.front());
+			}
+
+			std::mutex mtx;
+
+			// a deque, so that references to the styles stay valid as new ones are interned.
+			std::deque<Style> styles {};
+			util::hashmap<size_t, std::vector<const Style*>> buckets {};
+		};
+
+		StyleRegistry& registry()
+		{
+			static StyleRegistry reg {};
+			return reg;
+		}
+
+		// bumped whenever the interned styles are forgotten, so that each thread knows to clear its own cache.
+		std::atomic<uint64_t> g_generation = 0;
+
+		struct StylePair
+		{
+			const Style* main;
+			const Style* other;
+
+			bool operator==(const StylePair&) const = default;
+			size_t hash() const { return util::hasher::combine(0, main, other); }
+		};
+	}
+
 	const Style& Style::empty()
 	{
-		static Style ret {};
+		static const Style& ret = Style().interned();
 		return ret;
 	}
+
+	const Style& Style::interned() const
+	{
+		if(auto ret = m_interned.get(); ret != nullptr)
+			return *ret;
+
+		auto ret = registry().intern(*this);
+
+		// note: the copy in the registry doesn't know it is interned yet (since it was copied before it was),
+		// so comparing with it above went field-by-field; tell it now. it is fine if several threads race to
+		// do this, since they all set the same pointer.
+		ret->m_interned.set(ret);
+		m_interned.set(ret);
+
+		return *ret;
+	}
+
+	void Style::forgetInternedStyles()
+	{
+		registry().clear();
+		g_generation++;
+	}
+
+	size_t Style::hash() const
+	{
+		auto hash = util::hasher::combine(0, m_present_styles);
+
+		if(this->have_font_family())
+		{
+			auto& family = *m_font_family;
+			hash = util::hasher::combine(hash, family.regular(), family.italic(), family.bold(), family.boldItalic());
+		}
+
+		if(this->have_font_fallbacks())
+			hash = util::hasher::combine(hash, *m_font_fallbacks);
+		if(this->have_font_features())
+			hash = util::hasher::combine(hash, *m_font_features);
+		if(this->have_font_style())
+			hash = util::hasher::combine(hash, *m_font_style);
+		if(this->have_font_size())
+			hash = util::hasher::combine(hash, (*m_font_size).value());
+		if(this->have_root_font_size())
+			hash = util::hasher::combine(hash, (*m_root_font_size).value());
+		if(this->have_line_spacing())
+			hash = util::hasher::combine(hash, *m_line_spacing);
+		if(this->have_sentence_space_stretch())
+			hash = util::hasher::combine(hash, *m_sentence_space_stretch);
+		if(this->have_paragraph_spacing())
+			hash = util::hasher::combine(hash, (*m_paragraph_spacing).value());
+		if(this->have_horz_alignment())
+			hash = util::hasher::combine(hash, *m_horz_alignment);
+		if(this->have_smart_quotes_enablement())
+			hash = util::hasher::combine(hash, *m_enable_smart_quotes);
+		if(this->have_language())
+			hash = util::hasher::combine(hash, (*m_language).value);
+
+		if(this->have_colour())
+		{
+			auto& colour = *m_colour;
+			if(colour.isRGB())
+				hash = util::hasher::combine(hash, colour.rgb().r, colour.rgb().g, colour.rgb().b);
+			else
+				hash = util::hasher::combine(hash, colour.cmyk().c, colour.cmyk().m, colour.cmyk().y, colour.cmyk().k);
+		}
+
+		return hash;
+	}
+
+
+#define VALUE_OR_ELSE(field_name, left, right)                             \
+	[&]() {                                                                \
+		std::optional<typename decltype(field_name)::value_type> __ret {}; \
+		if((left).m_present_styles & (STY_##field_name))                   \
+			__ret = *(left).field_name;                                    \
+		else if((right).m_present_styles & (STY_##field_name))             \
+			__ret = *(right).field_name;                                   \
+		return __ret;                                                      \
+	}()
+
+	const Style& Style::extendWith(const Style& main_) const
+	{
+		auto& self = this->interned();
+		auto& main = main_.interned();
+
+		if(&main == &Style::empty())
+			return self;
+		else if(&self == &Style::empty())
+			return main;
+
+		// note: each thread has its own cache, so that laying out paragraphs in parallel doesn't need a lock
+		// here. interned styles stay until they are all forgotten, and then the cache is cleared too.
+		thread_local uint64_t cache_generation = 0;
+		thread_local util::hashmap<StylePair, const Style*> cache {};
+		if(auto gen = g_generation.load(); gen != cache_generation)
+		{
+			cache.clear();
+			cache_generation = gen;
+		}
+
+		if(auto it = cache.find(StylePair { &main, &self }); it != cache.end())
+			return *it->second;
+
+		auto style = Style();
+		style.set_font_family(VALUE_OR_ELSE(m_font_family, main, self))
+		    .set_font_fallbacks(VALUE_OR_ELSE(m_font_fallbacks, main, self))
+		    .set_font_features(VALUE_OR_ELSE(m_font_features, main, self))
+		    .set_font_style(VALUE_OR_ELSE(m_font_style, main, self))
+		    .set_font_size(VALUE_OR_ELSE(m_font_size, main, self))
+		    .set_line_spacing(VALUE_OR_ELSE(m_line_spacing, main, self))
+		    .set_sentence_space_stretch(VALUE_OR_ELSE(m_sentence_space_stretch, main, self))
+		    .set_paragraph_spacing(VALUE_OR_ELSE(m_paragraph_spacing, main, self))
+		    .set_horz_alignment(VALUE_OR_ELSE(m_horz_alignment, main, self))
+		    .set_root_font_size(VALUE_OR_ELSE(m_root_font_size, main, self))
+		    .set_colour(VALUE_OR_ELSE(m_colour, main, self))
+		    .enable_smart_quotes(VALUE_OR_ELSE(m_enable_smart_quotes, main, self))
+		    .set_language(VALUE_OR_ELSE(m_language, main, self)) //
+		    ;
+
+		auto& ret = style.interned();
+		cache.emplace(StylePair { &main, &self }, &ret);
+
+		return ret;
+	}
+
+#undef VALUE_OR_ELSE
 }
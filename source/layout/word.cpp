@@ -71,15 +71,16 @@ namespace sap::layout
 
 	void Word::render_to_text(pdf::Text* text) const
 	{
-		const auto font = m_style.font();
-		const auto font_size = m_style.font_size();
+		const auto font = m_style->font();
+		const auto font_size = m_style->font_size();
 		text->setFont(font, font_size.into<pdf::PdfScalar>());
-		text->setColour(m_style.colour());
+		text->setColour(m_style->colour());
 
 		if(m_raise_height != 0)
 			text->rise(m_raise_height.into());
 
-		for(auto& glyph : font->getGlyphInfosForString(m_text))
+		auto glyphs = font->getGlyphInfosForString(m_text, m_style->font_features());
+		for(auto& glyph : *glyphs)
 		{
 			auto placement = font->scaleMetricForPDFTextSpace(glyph.adjustments.horz_placement);
 
@@ -2,10 +2,13 @@
 // Copyright (c) 2021, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <charconv>
+
 #define ZARG_IMPLEMENTATION
 #include <zarg.h>
 
 #include "sap/config.h"
+#include "misc/thread_pool.h"
 
 #if !defined(SAP_PREFIX)
 #error SAP_PREFIX must be defined!
@@ -106,6 +109,11 @@ misc
 namespace sap
 {
 	extern void set_draft_mode(bool _);
+	extern void set_print_cache_stats(bool _);
+	extern void set_incremental_layout(bool _);
+	extern void set_print_timings(std::optional<bool> _);
+	extern void set_shaping_cache_dir(std::optional<std::string> _);
+	extern void set_subset_cff_fonts(bool _);
 
 	static stdfs::path s_invocation_cwd;
 	stdfs::path getInvocationCWD()
@@ -122,6 +130,11 @@ int main(int argc, char** argv)
 	                .add_option('L', true, "additional library search path")
 	                .add_option("watch", false, "watch mode: automatically recompile when files change")
 	                .add_option("draft", false, "draft mode")
+	                .add_option("cache-stats", false, "print shaping cache statistics after compiling")
+	                .add_option("shaping-cache", true, "directory to keep a persistent shaping cache in")
+	                .add_option("subset-cff", false, "subset embedded CFF fonts (which not all PDF viewers display)")
+	                .add_option_with_optional_value("timings", "print how long each phase took (or --timings=json)")
+	                .add_option('j', true, "number of threads to lay out paragraphs with (default: one per core)")
 	                .allow_options_after_positionals(true)
 	                .parse(argc, argv)
 	                .set();
@@ -133,6 +146,38 @@ int main(int argc, char** argv)
 	}
 
 	sap::set_draft_mode(args.options.contains("draft"));
+	sap::set_print_cache_stats(args.options.contains("cache-stats"));
+	sap::set_subset_cff_fonts(args.options.contains("subset-cff"));
+
+	if(args.options.contains("timings"))
+	{
+		auto format = args.options["timings"].value;
+		if(format.has_value() && *format != "json")
+		{
+			zpr::fprintln(stderr, "invalid timings format '{}' (expected 'json')", *format);
+			return 1;
+		}
+
+		sap::set_print_timings(/* as_json: */ format.has_value());
+	}
+
+	// note: make the path absolute now, since we change directories below.
+	if(auto dir = args.options["shaping-cache"].value; dir.has_value())
+		sap::set_shaping_cache_dir(stdfs::absolute(*dir).string());
+
+	if(auto jobs = args.options["j"].value; jobs.has_value())
+	{
+		size_t num_threads = 0;
+		auto [_, ec] = std::from_chars(jobs->data(), jobs->data() + jobs->size(), num_threads);
+		if(ec != std::errc() || num_threads == 0)
+		{
+			zpr::fprintln(stderr, "invalid number of threads '{}'", *jobs);
+			return 1;
+		}
+
+		util::ThreadPool::setNumThreads(num_threads);
+	}
+
 	bool is_watching = args.options.contains("watch");
 	if(is_watching && not sap::watch::isSupportedPlatform())
 	{
@@ -144,6 +189,15 @@ int main(int argc, char** argv)
 	sap::paths::addLibrarySearchPath((stdfs::path(SAP_PREFIX) / "lib" / "sap").string());
 	sap::paths::addIncludeSearchPath((stdfs::path(SAP_PREFIX) / "include" / "sap").string());
 
+	// sap is installed as <prefix>/bin/sap, with its library in <prefix>/lib/sap; the build directory has the same
+	// layout, so this also finds what the build makes for the library (eg. the hyphenation bundles).
+	if(auto exe = util::getExecutablePath(); exe.has_value())
+	{
+		auto prefix = exe->parent_path().parent_path();
+		sap::paths::addLibrarySearchPath((prefix / "lib" / "sap").string());
+		sap::paths::addIncludeSearchPath((prefix / "include" / "sap").string());
+	}
+
 	auto filename = args.positional[0];
 	auto abs_filename = stdfs::weakly_canonical(filename);
 
@@ -159,6 +213,7 @@ int main(int argc, char** argv)
 
 	if(is_watching)
 	{
+		sap::set_incremental_layout(true);
 		sap::watch::addFileToWatchList(input_file);
 		sap::watch::start(input_file, output_file);
 	}
@@ -2,6 +2,10 @@
 // Copyright (c) 2022, yuki
 // SPDX-License-Identifier: Apache-2.0
 
+#include <map>
+#include <deque>
+
+#include "sap/config.h"
 #include "misc/hyphenator.h"
 
 namespace sap::hyph
@@ -32,59 +36,185 @@ namespace sap::hyph
 		}
 	}
 
-	Hyphenator::Pats Hyphenator::Pats::parse(zst::wstr_view contents)
+	Hyphenator::Trie Hyphenator::Trie::compile(zst::wstr_view contents)
 	{
-		Pats ret;
+		struct BuildNode
+		{
+			std::map<char32_t, uint32_t> children;
+			std::optional<std::vector<uint8_t>> points;
+
+			uint32_t fail = 0;
+			uint32_t next_match = NONE;
+		};
+
+		std::vector<BuildNode> build(1);
 
-		auto parse_pat = [](zst::wstr_view line) {
-			size_t num_chars = 0;
-			util::ShortString<char32_t> pat {};
+		auto on_line = [&](zst::wstr_view line) {
+			uint32_t node = 0;
+			std::vector<uint8_t> points = { 0 };
 
-			HyphenationPoints hyphenation_points = { 0 };
 			for(char32_t c : line)
 			{
-				if(c == U'.')
+				if(U'0' <= c && c <= U'9')
 				{
+					points.back() = (uint8_t) (c - U'0');
 					continue;
 				}
-				else if(U'0' <= c && c <= U'9')
+				else if(c == U' ' || c == U'\t' || c == U'\r')
 				{
-					if(num_chars >= 16)
-					{
-						sap::internal_error("hyphenation point is too far right, change code to handle bigger "
-						                    "patterns");
-					}
-					hyphenation_points[num_chars] = (uint8_t) (c - '0');
+					continue;
+				}
+
+				// note: '.' is kept as a character, so that patterns starting or ending with one only match
+				// at the start or end of the word (we put a '.' on either side of it).
+				if(auto it = build[node].children.find(c); it != build[node].children.end())
+				{
+					node = it->second;
 				}
 				else
 				{
-					if(num_chars >= 16)
-						sap::internal_error("pattern string is too long, change code to handle bigger patterns");
+					auto child = checked_cast<uint32_t>(build.size());
+					build[node].children.emplace(c, child);
+					build.emplace_back();
 
-					pat.s[num_chars] = c;
-					++num_chars;
+					node = child;
 				}
+
+				points.push_back(0);
 			}
-			return std::make_pair(pat, hyphenation_points);
+
+			if(node != 0)
+				build[node].points = std::move(points);
 		};
 
-		auto on_line = [&](zst::wstr_view line) {
-			if(line.empty())
-				return;
+		iterateLines(on_line, contents);
 
-			auto pats_ptr = &ret.m_mid_pats;
-			if(line.front() == U'.')
-				pats_ptr = &ret.m_front_pats;
+		// compute the failure links breadth-first, so that the links of all shorter strings are done first.
+		std::deque<uint32_t> queue {};
+		for(auto& [_, child] : build[0].children)
+			queue.push_back(child);
 
-			else if(line.back() == U'.')
-				pats_ptr = &ret.m_front_pats;
+		while(not queue.empty())
+		{
+			auto node = queue.front();
+			queue.pop_front();
 
-			pats_ptr->emplace(parse_pat(line));
-		};
+			for(auto& [c, child] : build[node].children)
+			{
+				auto f = build[node].fail;
+				while(true)
+				{
+					if(auto it = build[f].children.find(c); it != build[f].children.end())
+					{
+						f = it->second;
+						break;
+					}
+					else if(f == 0)
+					{
+						break;
+					}
 
-		iterateLines(on_line, contents);
+					f = build[f].fail;
+				}
 
-		return ret;
+				build[child].fail = f;
+				build[child].next_match = build[f].points.has_value() ? f : build[f].next_match;
+
+				queue.push_back(child);
+			}
+		}
+
+		auto arrays = std::make_unique<Trie::Arrays>();
+		arrays->nodes.reserve(build.size());
+
+		for(auto& bn : build)
+		{
+			auto& node = arrays->nodes.emplace_back();
+			node.first_edge = checked_cast<uint32_t>(arrays->edge_chars.size());
+			node.num_edges = checked_cast<uint32_t>(bn.children.size());
+			node.fail = bn.fail;
+			node.next_match = bn.next_match;
+			node.pattern_len = 0;
+			node.points_idx = 0;
+
+			// std::map is ordered, so the edges come out sorted.
+			for(auto& [c, child] : bn.children)
+			{
+				arrays->edge_chars.push_back(c);
+				arrays->edge_targets.push_back(child);
+			}
+
+			if(bn.points.has_value())
+			{
+				node.pattern_len = checked_cast<uint32_t>(bn.points->size() - 1);
+				node.points_idx = checked_cast<uint32_t>(arrays->points.size());
+				arrays->points.insert(arrays->points.end(), bn.points->begin(), bn.points->end());
+			}
+		}
+
+		Trie trie {};
+		trie.nodes = arrays->nodes;
+		trie.edge_chars = arrays->edge_chars;
+		trie.edge_targets = arrays->edge_targets;
+		trie.points = arrays->points;
+		trie.owned_arrays = std::move(arrays);
+
+		return trie;
+	}
+
+	uint32_t Hyphenator::Trie::step(uint32_t node, char32_t ch) const
+	{
+		while(true)
+		{
+			auto& n = nodes[node];
+			auto begin = edge_chars.begin() + n.first_edge;
+			auto end = begin + n.num_edges;
+
+			if(auto it = std::lower_bound(begin, end, ch); it != end && *it == ch)
+				return edge_targets[(size_t) (it - edge_chars.begin())];
+
+			if(node == 0)
+				return 0;
+
+			node = n.fail;
+		}
+	}
+
+	void Hyphenator::Trie::addMatches(uint32_t node, size_t end_idx, std::vector<uint8_t>& word_points) const
+	{
+		auto match = nodes[node].pattern_len > 0 ? node : nodes[node].next_match;
+		for(; match != NONE; match = nodes[match].next_match)
+		{
+			auto& n = nodes[match];
+
+			// `end_idx` is the index of the last character of the match in the dotted word (".word."); the
+			// point before dotted character i is the point before character i - 1 of the word itself.
+			auto start = end_idx + 1 - n.pattern_len;
+			for(size_t k = 0; k <= n.pattern_len; k++)
+			{
+				auto p = points[n.points_idx + k];
+				if(p == 0 || start + k == 0 || start + k - 1 >= word_points.size())
+					continue;
+
+				word_points[start + k - 1] = std::max(word_points[start + k - 1], p);
+			}
+		}
+	}
+
+	bool Hyphenator::Trie::isValid() const
+	{
+		if(nodes.empty() || edge_chars.size() != edge_targets.size())
+			return false;
+
+		for(auto& n : nodes)
+		{
+			if(size_t(n.first_edge) + n.num_edges > edge_chars.size() || n.fail >= nodes.size()
+			    || (n.next_match != NONE && n.next_match >= nodes.size())
+			    || (n.pattern_len > 0 && size_t(n.points_idx) + n.pattern_len + 1 > points.size()))
+				return false;
+		}
+
+		return std::all_of(edge_targets.begin(), edge_targets.end(), [this](auto t) { return t < nodes.size(); });
 	}
 
 	void Hyphenator::parseAndAddExceptions(zst::wstr_view contents)
@@ -110,7 +240,7 @@ namespace sap::hyph
 			if(points.size() <= word.size())
 				points.push_back(0);
 
-			m_hyphenation_cache.emplace(word, points);
+			m_exceptions.emplace(word, points);
 		};
 
 		iterateLines(on_line, contents);
@@ -121,80 +251,403 @@ namespace sap::hyph
 		auto file = util::readEntireFile(path);
 
 		auto u32_string = unicode::u32StringFromUtf8({ file.get(), file.size() });
-		auto u32_contents = zst::wstr_view(u32_string);
 
-		auto pats_start = u32_contents.find(U"\\patterns{");
-		pats_start += u32_contents.drop(pats_start).find(U'\n');
+		// note: search with std::u32string_view; zst's views of char32_t literals include the null terminator.
+		auto contents = std::u32string_view(u32_string);
+		auto find_section = [&contents](std::u32string_view name) -> zst::wstr_view {
+			auto start = contents.find(name);
+			if(start == std::u32string_view::npos)
+				return {};
 
-		auto pats_size = u32_contents.drop(pats_start).find(U'}');
+			start = contents.find(U'\n', start);
+			if(start == std::u32string_view::npos)
+				return {};
 
-		auto exceptions_start = u32_contents.find(U"\\hyphenation{");
-		exceptions_start += u32_contents.drop(pats_start).find(U'\n');
+			auto end = contents.find(U'}', start);
+			if(end == std::u32string_view::npos)
+				end = contents.size();
 
-		auto exceptions_size = u32_contents.drop(exceptions_start).find(U'}');
+			return zst::wstr_view(contents.data() + start, end - start);
+		};
 
-		auto hyph = Hyphenator(Pats::parse(u32_contents.substr(pats_start, pats_size)));
-		hyph.parseAndAddExceptions(u32_contents.substr(exceptions_start, exceptions_size));
+		/*
+		    hyph-utf8 pattern files say (in the comments at the top) how short the parts of a hyphenated word may
+		    be, for typesetting in that language; like this:
+
+		        % hyphenmins:
+		        %     typesetting:
+		        %         left: 2
+		        %         right: 3
+		*/
+		auto header = contents.substr(0, contents.find(U"\\patterns{"));
+		auto find_hyphenmin = [&header](std::u32string_view key) -> std::optional<size_t> {
+			auto start = header.find(U"% hyphenmins:");
+			if(start == std::u32string_view::npos)
+				return std::nullopt;
+
+			start = header.find(U"typesetting:", start);
+			if(start == std::u32string_view::npos)
+				return std::nullopt;
+
+			start = header.find(key, start);
+			if(start == std::u32string_view::npos)
+				return std::nullopt;
+
+			size_t i = start + key.size();
+			while(i < header.size() && header[i] == U' ')
+				i++;
+
+			std::optional<size_t> ret {};
+			for(; i < header.size() && U'0' <= header[i] && header[i] <= U'9'; i++)
+				ret = 10 * ret.value_or(0) + static_cast<size_t>(header[i] - U'0');
+
+			return ret;
+		};
+
+		auto hyph = Hyphenator(Trie::compile(find_section(U"\\patterns{")));
+		hyph.parseAndAddExceptions(find_section(U"\\hyphenation{"));
+		hyph.m_left_hyphen_min = find_hyphenmin(U"left:").value_or(DEFAULT_LEFT_HYPHEN_MIN);
+		hyph.m_right_hyphen_min = find_hyphenmin(U"right:").value_or(DEFAULT_RIGHT_HYPHEN_MIN);
+		hyph.compute_patterns_hash();
 
 		return hyph;
 	}
 
-	const std::vector<uint8_t>& Hyphenator::computeHyphenationPoints(zst::wstr_view word)
+	void Hyphenator::compute_patterns_hash()
 	{
-		if(auto it = m_hyphenation_cache.find(word); it != m_hyphenation_cache.end())
-			return it->second;
+		uint64_t hash = 0;
+		auto add = [&hash](const void* data, size_t size) { hash = XXH64(data, size, hash); };
 
-		auto ret = std::vector<uint8_t>(word.size() + 1, (uint8_t) 0);
+		add(m_trie.nodes.data(), m_trie.nodes.size_bytes());
+		add(m_trie.edge_chars.data(), m_trie.edge_chars.size_bytes());
+		add(m_trie.edge_targets.data(), m_trie.edge_targets.size_bytes());
+		add(m_trie.points.data(), m_trie.points.size_bytes());
+
+		add(&m_left_hyphen_min, sizeof(size_t));
+		add(&m_right_hyphen_min, sizeof(size_t));
 
-		for(size_t j = 1; j <= 16 && j < word.size(); ++j)
+		// (a bundle keeps the exceptions in the same order as the pattern file)
+		for(auto& [word, points] : m_exceptions)
 		{
-			auto snip = util::ShortString<char32_t>(word.data(), j);
-			if(auto hit = m_pats.m_front_pats.find(snip); hit != m_pats.m_front_pats.end())
-			{
-				const auto& points = hit->second;
-				for(size_t k = 0; k < points.size(); ++k)
-				{
-					if(points[k] != 0)
-						ret[k] = std::max(ret[k], points[k]);
-				}
-			}
+			add(word.data(), word.size() * sizeof(char32_t));
+			add(points.data(), points.size());
+		}
+
+		m_patterns_hash = hash;
+	}
+
+	/*
+	    bundle layout (all integers are native-endian):
+
+	    header:
+	        char[8]     magic ("saphyphb")
+	        u32         format version
+	        u32         number of nodes
+	        u32         number of edges
+	        u32         number of points
+	        u32         number of exceptions
+	        u32         left hyphen min
+	        u32         right hyphen min
+	        u32         reserved (0)
+
+	    followed by:
+	        Node[]      the nodes (6 u32s each)
+	        u32[]       the edge characters
+	        u32[]       the edge targets
+	        u8[]        the points, padded to a multiple of 4 bytes
+	        (u32, u32[], u8[])[]
+	                    the exceptions: length of the word, the word, and its points (one more than the
+	                    length), padded to a multiple of 4 bytes
+
+	    since everything is a multiple of 4 bytes, the arrays are suitably aligned to be used directly from the
+	    mapped file.
+	*/
+	static constexpr char BUNDLE_MAGIC[8] = { 's', 'a', 'p', 'h', 'y', 'p', 'h', 'b' };
+	static constexpr uint32_t BUNDLE_FORMAT_VERSION = 2;
+	static constexpr size_t BUNDLE_HEADER_SIZE = 40;
+
+	static size_t pad_to_4(size_t n)
+	{
+		return (n + 3) & ~size_t(3);
+	}
+
+	bool Hyphenator::writeBundle(const std::string& path) const
+	{
+		static_assert(sizeof(Trie::Node) == 6 * sizeof(uint32_t));
+
+		std::vector<uint8_t> buf {};
+		auto write_bytes = [&buf](const void* p, size_t n) {
+			buf.insert(buf.end(), static_cast<const uint8_t*>(p), static_cast<const uint8_t*>(p) + n);
+		};
+
+		auto write_u32 = [&write_bytes](uint32_t x) { write_bytes(&x, sizeof(uint32_t)); };
+		auto pad = [&buf]() { buf.resize(pad_to_4(buf.size()), 0); };
+
+		write_bytes(&BUNDLE_MAGIC[0], sizeof(BUNDLE_MAGIC));
+		write_u32(BUNDLE_FORMAT_VERSION);
+		write_u32(checked_cast<uint32_t>(m_trie.nodes.size()));
+		write_u32(checked_cast<uint32_t>(m_trie.edge_chars.size()));
+		write_u32(checked_cast<uint32_t>(m_trie.points.size()));
+		write_u32(checked_cast<uint32_t>(m_exceptions.size()));
+		write_u32(checked_cast<uint32_t>(m_left_hyphen_min));
+		write_u32(checked_cast<uint32_t>(m_right_hyphen_min));
+		write_u32(0);
+
+		write_bytes(m_trie.nodes.data(), m_trie.nodes.size_bytes());
+		write_bytes(m_trie.edge_chars.data(), m_trie.edge_chars.size_bytes());
+		write_bytes(m_trie.edge_targets.data(), m_trie.edge_targets.size_bytes());
+		write_bytes(m_trie.points.data(), m_trie.points.size_bytes());
+		pad();
+
+		for(auto& [word, points] : m_exceptions)
+		{
+			write_u32(checked_cast<uint32_t>(word.size()));
+			write_bytes(word.data(), word.size() * sizeof(char32_t));
+			write_bytes(points.data(), points.size());
+			pad();
+		}
+
+		auto f = fopen(path.c_str(), "wb");
+		if(f == nullptr)
+			return false;
+
+		bool ok = fwrite(buf.data(), 1, buf.size(), f) == buf.size();
+		ok &= (fclose(f) == 0);
+		return ok;
+	}
+
+	std::optional<Hyphenator> Hyphenator::loadBundle(const std::string& path)
+	{
+		auto invalid = [&path]() -> std::optional<Hyphenator> {
+			sap::warn("hyph", "ignoring invalid hyphenation bundle '{}'", path);
+			return std::nullopt;
+		};
+
+		// (we can't map an empty file)
+		std::error_code ec {};
+		if(stdfs::file_size(path, ec) < BUNDLE_HEADER_SIZE || ec)
+			return invalid();
+
+		auto file = util::readEntireFile(path);
+		auto bytes = zst::byte_span(file.get(), file.size());
+
+		if(bytes.size() < BUNDLE_HEADER_SIZE || memcmp(bytes.data(), BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0)
+			return invalid();
+
+		uint32_t fields[8] {};
+		memcpy(&fields[0], bytes.data() + 8, sizeof(fields));
+
+		const auto [version, num_nodes, num_edges, num_points, num_exceptions, left_min, right_min, _] = fields;
+		if(version != BUNDLE_FORMAT_VERSION)
+			return invalid();
+
+		const size_t trie_size = sizeof(Trie::Node) * size_t(num_nodes) + 2 * sizeof(uint32_t) * size_t(num_edges)
+		                       + pad_to_4(num_points);
+		if(bytes.size() - BUNDLE_HEADER_SIZE < trie_size)
+			return invalid();
+
+		auto ptr = bytes.data() + BUNDLE_HEADER_SIZE;
+		auto take_array = [&ptr]<typename T>(T*, size_t n) {
+			auto ret = std::span<const T>(reinterpret_cast<const T*>(ptr), n);
+			ptr += n * sizeof(T);
+			return ret;
+		};
+
+		Trie trie {};
+		trie.nodes = take_array((Trie::Node*) nullptr, num_nodes);
+		trie.edge_chars = take_array((char32_t*) nullptr, num_edges);
+		trie.edge_targets = take_array((uint32_t*) nullptr, num_edges);
+		trie.points = take_array((uint8_t*) nullptr, num_points);
+		ptr = bytes.data() + BUNDLE_HEADER_SIZE + trie_size;
+
+		if(not trie.isValid())
+			return invalid();
+
+		// the exceptions are few, so just copy them into the map.
+		util::hashmap<std::u32string, std::vector<uint8_t>> exceptions {};
+		for(uint32_t i = 0; i < num_exceptions; i++)
+		{
+			if(bytes.end() - ptr < (ptrdiff_t) sizeof(uint32_t))
+				return invalid();
+
+			uint32_t len = 0;
+			memcpy(&len, ptr, sizeof(uint32_t));
+			ptr += sizeof(uint32_t);
+
+			const auto record_size = pad_to_4(sizeof(char32_t) * size_t(len) + len + 1);
+			if(bytes.end() - ptr < (ptrdiff_t) record_size)
+				return invalid();
+
+			auto word = std::u32string(reinterpret_cast<const char32_t*>(ptr), len);
+			ptr += sizeof(char32_t) * len;
+
+			exceptions.emplace(std::move(word), std::vector<uint8_t>(ptr, ptr + len + 1));
+			ptr = bytes.data() + pad_to_4(size_t(ptr - bytes.data()) + len + 1);
 		}
 
-		for(size_t i = 0; i < word.size() - 1; ++i)
+		trie.mapped_file = std::move(file);
+
+		auto hyph = Hyphenator(std::move(trie));
+		hyph.m_exceptions = std::move(exceptions);
+		hyph.m_left_hyphen_min = left_min;
+		hyph.m_right_hyphen_min = right_min;
+		hyph.compute_patterns_hash();
+
+		return hyph;
+	}
+
+	const Hyphenator* Hyphenator::forLanguage(Language language)
+	{
+		struct Registry
 		{
-			for(size_t j = 1; j <= 16 && i + j < word.size(); ++j)
+			std::mutex mtx;
+
+			// note: a language without any patterns gets a null entry, so that we only look (and warn) once.
+			util::hashmap<Language, std::unique_ptr<Hyphenator>> hyphenators;
+		};
+
+		static Registry registry {};
+
+		auto lk = std::unique_lock(registry.mtx);
+		if(auto it = registry.hyphenators.find(language); it != registry.hyphenators.end())
+			return it->second.get();
+
+		auto load = [&language]() -> std::unique_ptr<Hyphenator> {
+			auto resolve = [&language](const char* ext) {
+				return paths::resolveLibrary(Location::builtin(),
+				    zpr::sprint("data/hyphenation/hyph-{}.{}", language.name(), ext));
+			};
+
+			auto tex = resolve("tex");
+			auto bundle = resolve("hyb");
+
+			// if someone edited the patterns without recompiling them, use the patterns.
+			std::error_code ec {};
+			if(bundle.ok()
+			    && (tex.is_err()
+			        || stdfs::last_write_time(bundle.unwrap(), ec) >= stdfs::last_write_time(tex.unwrap(), ec)))
 			{
-				auto snip = util::ShortString<char32_t>(word.data() + i, j);
+				if(auto hyph = loadBundle(bundle.unwrap()); hyph.has_value())
+					return std::make_unique<Hyphenator>(std::move(*hyph));
+			}
 
-				if(auto hit = m_pats.m_mid_pats.find(snip); hit != m_pats.m_mid_pats.end())
-				{
-					const auto& points = hit->second;
-					for(size_t k = 0; k < points.size(); ++k)
-					{
-						if(points[k] != 0)
-							ret[i + k] = std::max(ret[i + k], points[k]);
-					}
-				}
+			if(tex.ok())
+				return std::make_unique<Hyphenator>(parseFromFile(tex.unwrap()));
+
+			sap::warn("hyph", "no hyphenation patterns for language '{}'", language.name());
+			return nullptr;
+		};
+
+		return registry.hyphenators.emplace(language, load()).first->second.get();
+	}
+
+	std::vector<uint8_t> Hyphenator::computeHyphenationPoints(zst::wstr_view word) const
+	{
+		// the patterns and exceptions are never modified after we're constructed, so only the cache needs to
+		// be locked.
+		if(auto it = m_exceptions.find(word); it != m_exceptions.end())
+			return it->second;
+
+		{
+			auto lk = std::unique_lock(m_cache_lock);
+			if(auto it = m_cache.find(word); it != m_cache.end())
+				return it->second;
+
+			if(auto it = m_old_cache.find(word); it != m_old_cache.end())
+			{
+				auto ret = it->second;
+				m_cache.emplace(word.str(), ret);
+				return ret;
 			}
 		}
 
-		for(size_t j = 1; j <= 16 && j < word.size(); ++j)
+		auto ret = std::vector<uint8_t>(word.size() + 1, (uint8_t) 0);
+
+		uint32_t node = m_trie.step(0, U'.');
+		m_trie.addMatches(node, 0, ret);
+
+		for(size_t i = 0; i < word.size(); i++)
 		{
-			auto start_idx = word.size() - j;
-			auto snip = util::ShortString<char32_t>(word.data() + start_idx, j);
+			node = m_trie.step(node, word[i]);
+			m_trie.addMatches(node, i + 1, ret);
+		}
+
+		node = m_trie.step(node, U'.');
+		m_trie.addMatches(node, word.size() + 1, ret);
 
-			if(auto hit = m_pats.m_back_pats.find(snip); hit != m_pats.m_back_pats.end())
+		for(size_t i = 0; i < ret.size(); i++)
+		{
+			if(i < m_left_hyphen_min || i + m_right_hyphen_min > word.size())
+				ret[i] = 0;
+		}
+
+		auto lk = std::unique_lock(m_cache_lock);
+		if(m_cache.size() >= CACHE_GENERATION_SIZE)
+		{
+			m_old_cache = std::move(m_cache);
+			m_cache.clear();
+		}
+
+		m_cache.emplace(word.str(), ret);
+		return ret;
+	}
+}
+
+namespace sap
+{
+	namespace
+	{
+		struct LanguageRegistry
+		{
+			LanguageRegistry() { this->intern("en-gb"); }
+
+			Language intern(std::string_view name)
 			{
-				const auto& points = hit->second;
-				for(size_t k = 0; k < points.size(); ++k)
-				{
-					if(points[k] != 0)
-						ret[start_idx + k] = std::max(ret[start_idx + k], points[k]);
-				}
+				auto normalised = std::string(name);
+				for(auto& c : normalised)
+					c = (c == '_' ? '-' : (char) tolower(c));
+
+				auto lk = std::unique_lock(mtx);
+				if(auto it = ids.find(normalised); it != ids.end())
+					return it->second;
+
+				auto id = Language { checked_cast<uint32_t>(names.size()) };
+				ids.emplace(normalised, id);
+				names.push_back(std::move(normalised));
+
+				return id;
+			}
+
+			const std::string& get(Language lang)
+			{
+				auto lk = std::unique_lock(mtx);
+				if(lang.value >= names.size())
+					sap::internal_error("invalid language id {}", lang.value);
+
+				return names[lang.value];
 			}
+
+			std::mutex mtx;
+
+			// a deque, so that references to the names stay valid as new ones are interned.
+			std::deque<std::string> names {};
+			util::hashmap<std::string, Language> ids {};
+		};
+
+		LanguageRegistry& registry()
+		{
+			static LanguageRegistry reg {};
+			return reg;
 		}
+	}
 
-		auto res = m_hyphenation_cache.emplace(word.str(), std::move(ret));
-		return res.first->second;
+	Language Language::named(std::string_view name)
+	{
+		return registry().intern(name);
+	}
+
+	const std::string& Language::name() const
+	{
+		return registry().get(*this);
 	}
 }
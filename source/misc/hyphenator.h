@@ -4,10 +4,12 @@
 
 #pragma once
 
-#include <array>
+#include <span>
+#include <mutex>
 
 #include "util.h"
-#include "misc/short_string.h"
+
+#include "sap/language.h"
 
 namespace sap::hyph
 {
@@ -15,23 +17,132 @@ namespace sap::hyph
 	{
 		static Hyphenator parseFromFile(const std::string& path);
 
-		const std::vector<uint8_t>& computeHyphenationPoints(zst::wstr_view word);
+		/*
+		    Load a bundle (made by `writeBundle`), which contains the patterns already compiled, laid out so that
+		    the automaton can be used directly from the mapped file. Returns nothing (with a warning) if the file
+		    is not a valid bundle, eg. if it was made by a different version of sap.
+		*/
+		static std::optional<Hyphenator> loadBundle(const std::string& path);
+		bool writeBundle(const std::string& path) const;
+
+		/*
+		    Get the hyphenator for the given language, loading its patterns the first time it is asked for: either
+		    from `data/hyphenation/hyph-<language>.hyb` in the library paths, or by parsing the TeX pattern file
+		    `hyph-<language>.tex` next to it, if there is no bundle (or it is older than the pattern file). If there
+		    are no patterns for the language at all, returns null (and warns, once).
+		*/
+		static const Hyphenator* forLanguage(Language language);
+
+		Hyphenator(Hyphenator&& other)
+		    : m_trie(std::move(other.m_trie))
+		    , m_exceptions(std::move(other.m_exceptions))
+		    , m_left_hyphen_min(other.m_left_hyphen_min)
+		    , m_right_hyphen_min(other.m_right_hyphen_min)
+		    , m_patterns_hash(other.m_patterns_hash)
+		    , m_cache(std::move(other.m_cache))
+		    , m_old_cache(std::move(other.m_old_cache))
+		{
+		}
+
+		// note: this is safe to call from multiple threads at once.
+		std::vector<uint8_t> computeHyphenationPoints(zst::wstr_view word) const;
+
+		// a hash of the patterns and exceptions, ie. of everything that decides where words are hyphenated.
+		uint64_t patternsHash() const { return m_patterns_hash; }
+
+		// like TeX's \lefthyphenmin and \righthyphenmin: the fewest characters that can be split off at the start
+		// and at the end of a word. these depend on the language, so they come with the patterns.
+		size_t leftHyphenMin() const { return m_left_hyphen_min; }
+		size_t rightHyphenMin() const { return m_right_hyphen_min; }
+
+		// TeX's defaults, for pattern files that don't say.
+		static constexpr size_t DEFAULT_LEFT_HYPHEN_MIN = 2;
+		static constexpr size_t DEFAULT_RIGHT_HYPHEN_MIN = 3;
+
+		// the cache keeps at most about twice this many words.
+		static constexpr size_t CACHE_GENERATION_SIZE = 16384;
 
 	private:
-		using HyphenationPoints = std::array<uint8_t, 16>;
-		struct Pats
+		/*
+		    The patterns, compiled into an Aho-Corasick automaton: a trie of all the patterns (with the '.'s
+		    that anchor them to the start or end of a word kept in), plus a failure link for every node, which
+		    points to the node for the longest proper suffix of its string that is also in the trie. With those,
+		    all the patterns that match anywhere in a word are found in a single left-to-right scan over it,
+		    instead of looking up every substring separately.
+
+		    The nodes are packed into flat arrays once the automaton is built; the edges of each node are sorted
+		    by character, so following one is a binary search (most nodes only have a couple of edges anyway).
+		    The arrays are either owned by the trie (if the patterns were compiled in this process), or they
+		    point into a mapped bundle file.
+		*/
+		struct Trie
 		{
-			util::hashmap<util::ShortString<char32_t>, HyphenationPoints> m_front_pats;
-			util::hashmap<util::ShortString<char32_t>, HyphenationPoints> m_mid_pats;
-			util::hashmap<util::ShortString<char32_t>, HyphenationPoints> m_back_pats;
+			struct Node
+			{
+				uint32_t first_edge;
+				uint32_t num_edges;
+
+				// the node to go to when there is no edge for the next character
+				uint32_t fail;
+
+				// the nearest node along the failure links (excluding this one) that ends a pattern, or NONE
+				uint32_t next_match;
 
-			static Pats parse(zst::wstr_view contents);
+				// if this node ends a pattern: its length (including any '.'), and where its points are.
+				uint32_t pattern_len;
+				uint32_t points_idx;
+			};
+
+			static constexpr uint32_t NONE = (uint32_t) -1;
+
+			std::span<const Node> nodes;
+			std::span<const char32_t> edge_chars;
+			std::span<const uint32_t> edge_targets;
+
+			// for a pattern of length n, there are n + 1 points, one before each character, and one at the end.
+			std::span<const uint8_t> points;
+
+			uint32_t step(uint32_t node, char32_t ch) const;
+			void addMatches(uint32_t node, size_t end_idx, std::vector<uint8_t>& word_points) const;
+
+			// checks that all the indices are in bounds, so a bad bundle can't make us read out of bounds.
+			bool isValid() const;
+
+			static Trie compile(zst::wstr_view patterns);
+
+			struct Arrays
+			{
+				std::vector<Node> nodes;
+				std::vector<char32_t> edge_chars;
+				std::vector<uint32_t> edge_targets;
+				std::vector<uint8_t> points;
+			};
+
+			std::unique_ptr<Arrays> owned_arrays;
+			zst::unique_span<uint8_t[]> mapped_file = zst::unique_span<uint8_t[]>();
 		};
 
-		Hyphenator(Pats pats) : m_pats(std::move(pats)) { }
+		Hyphenator(Trie trie) : m_trie(std::move(trie)) { }
 		void parseAndAddExceptions(zst::wstr_view contents);
+		void compute_patterns_hash();
+
+		Trie m_trie;
+
+		// words from the \hyphenation{} list, which are hyphenated exactly as given
+		util::hashmap<std::u32string, std::vector<uint8_t>> m_exceptions;
+
+		size_t m_left_hyphen_min = DEFAULT_LEFT_HYPHEN_MIN;
+		size_t m_right_hyphen_min = DEFAULT_RIGHT_HYPHEN_MIN;
+
+		uint64_t m_patterns_hash = 0;
 
-		Pats m_pats;
-		util::hashmap<std::u32string, std::vector<uint8_t>> m_hyphenation_cache;
+		/*
+		    A cache of hyphenated words, in two generations: once the current one is full, it becomes the old one,
+		    and the old one is thrown away. Words that were found in the old generation get moved back into the
+		    current one, so the ones in use stay cached, but the cache as a whole can't grow forever.
+		*/
+		mutable std::mutex m_cache_lock;
+		mutable util::hashmap<std::u32string, std::vector<uint8_t>> m_cache;
+		mutable util::hashmap<std::u32string, std::vector<uint8_t>> m_old_cache;
 	};
 }
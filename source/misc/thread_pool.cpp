@@ -0,0 +1,155 @@
+// thread_pool.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util.h"
+#include "misc/thread_pool.h"
+
+namespace util
+{
+	static size_t s_num_threads = 0;
+
+	void ThreadPool::setNumThreads(size_t num_threads)
+	{
+		s_num_threads = num_threads;
+	}
+
+	ThreadPool& ThreadPool::get()
+	{
+		static auto pool = ThreadPool(s_num_threads > 0 ? s_num_threads
+		                                                : size_t(std::max(1u, std::thread::hardware_concurrency())));
+		return pool;
+	}
+
+	ThreadPool::ThreadPool(size_t num_threads)
+	{
+		assert(num_threads > 0);
+		for(size_t i = 0; i < num_threads; i++)
+			m_queues.push_back(std::make_unique<Queue>());
+
+		for(size_t i = 1; i < num_threads; i++)
+			m_threads.emplace_back([this, i]() { this->worker_loop(i); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			auto lk = std::unique_lock(m_sleep_mutex);
+			m_stop = true;
+		}
+
+		m_wake_up.notify_all();
+		for(auto& t : m_threads)
+			t.join();
+	}
+
+	std::optional<ThreadPool::Task> ThreadPool::find_task(size_t queue_idx)
+	{
+		// our own queue first, from the back...
+		{
+			auto& q = *m_queues[queue_idx];
+			auto lk = std::unique_lock(q.mutex);
+			if(not q.tasks.empty())
+			{
+				auto task = q.tasks.back();
+				q.tasks.pop_back();
+				m_num_queued--;
+				return task;
+			}
+		}
+
+		// ...then steal from the front of everybody else's.
+		for(size_t k = 1; k < m_queues.size(); k++)
+		{
+			auto& q = *m_queues[(queue_idx + k) % m_queues.size()];
+			auto lk = std::unique_lock(q.mutex);
+			if(not q.tasks.empty())
+			{
+				auto task = q.tasks.front();
+				q.tasks.pop_front();
+				m_num_queued--;
+				return task;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	void ThreadPool::run_task(Task task)
+	{
+		auto batch = task.batch;
+		(*batch->fn)(task.index);
+
+		// note: decrement under the lock, so that `forEach` can't return (and destroy the batch) before we are
+		// completely done with it.
+		auto lk = std::unique_lock(batch->mutex);
+		if(--batch->remaining == 0)
+			batch->finished.notify_all();
+	}
+
+	void ThreadPool::worker_loop(size_t queue_idx)
+	{
+		while(true)
+		{
+			if(auto task = this->find_task(queue_idx); task.has_value())
+			{
+				this->run_task(*task);
+				continue;
+			}
+
+			auto lk = std::unique_lock(m_sleep_mutex);
+			m_wake_up.wait(lk, [this]() { return m_stop || m_num_queued > 0; });
+
+			if(m_stop)
+				return;
+		}
+	}
+
+	void ThreadPool::forEach(size_t count, const std::function<void(size_t)>& fn)
+	{
+		if(count == 0)
+			return;
+
+		if(count == 1 || m_threads.empty())
+		{
+			for(size_t i = 0; i < count; i++)
+				fn(i);
+
+			return;
+		}
+
+		Batch batch {};
+		batch.fn = &fn;
+		batch.remaining = count;
+
+		// deal the tasks out round-robin, so that everybody starts with something to do.
+		for(size_t i = 0; i < count; i++)
+		{
+			auto& q = *m_queues[i % m_queues.size()];
+			auto lk = std::unique_lock(q.mutex);
+			q.tasks.push_back(Task { .batch = &batch, .index = i });
+			m_num_queued++;
+		}
+
+		{
+			auto lk = std::unique_lock(m_sleep_mutex);
+			m_wake_up.notify_all();
+		}
+
+		while(batch.remaining > 0)
+		{
+			if(auto task = this->find_task(0); task.has_value())
+			{
+				this->run_task(*task);
+				continue;
+			}
+
+			// everything has been taken, so just wait for the other threads to finish.
+			auto lk = std::unique_lock(batch.mutex);
+			batch.finished.wait(lk, [&batch]() { return batch.remaining == 0; });
+		}
+
+		// wait for whoever finished the last task to let go of the batch.
+		auto lk = std::unique_lock(batch.mutex);
+	}
+}
@@ -0,0 +1,81 @@
+// thread_pool.h
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace util
+{
+	/*
+	    A small work-stealing thread pool. Each thread (including the one calling `forEach`) has its own queue of
+	    tasks; it takes work from the back of its own queue, and when that runs dry, steals from the front of
+	    somebody else's. This keeps things balanced when some tasks (eg. long paragraphs) take much longer than
+	    others.
+
+	    There is one global pool, which is created lazily on first use.
+	*/
+	struct ThreadPool
+	{
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// the total number of threads that work on a `forEach`, including the calling thread.
+		size_t numThreads() const { return m_threads.size() + 1; }
+
+		// calls fn(i) for every i in [0, count), spread out over the pool. the calling thread also does work,
+		// and this only returns once every call has finished. the calls can happen in any order.
+		void forEach(size_t count, const std::function<void(size_t)>& fn);
+
+		static ThreadPool& get();
+
+		// must be called before the first call to `get`; by default, we use one thread per core.
+		static void setNumThreads(size_t num_threads);
+
+	private:
+		explicit ThreadPool(size_t num_threads);
+
+		struct Batch
+		{
+			const std::function<void(size_t)>* fn;
+			std::atomic<size_t> remaining;
+
+			std::mutex mutex;
+			std::condition_variable finished;
+		};
+
+		struct Task
+		{
+			Batch* batch;
+			size_t index;
+		};
+
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::optional<Task> find_task(size_t queue_idx);
+		void run_task(Task task);
+		void worker_loop(size_t queue_idx);
+
+		// queue 0 belongs to whoever calls `forEach`; queue i belongs to thread i - 1.
+		std::vector<std::unique_ptr<Queue>> m_queues;
+		std::vector<std::thread> m_threads;
+
+		std::atomic<size_t> m_num_queued = 0;
+
+		std::mutex m_sleep_mutex;
+		std::condition_variable m_wake_up;
+		bool m_stop = false;
+	};
+}
@@ -0,0 +1,236 @@
+// timings.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include <ctime>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+#include "util.h"
+#include "misc/timings.h"
+
+namespace util::timings
+{
+	namespace
+	{
+		struct Node
+		{
+			std::string name;
+			Node* parent = nullptr;
+			std::vector<std::unique_ptr<Node>> children {};
+
+			size_t count = 0;
+			double wall_ms = 0;
+			double cpu_ms = 0;
+
+			std::chrono::steady_clock::time_point wall_start {};
+			std::clock_t cpu_start = 0;
+		};
+
+		struct State
+		{
+			std::mutex mtx;
+
+			Node root {};
+			Node* current = &root;
+
+			// a vector, so that the counters come out in the order they were first set.
+			std::vector<std::pair<std::string, uint64_t>> counters {};
+		};
+
+		std::atomic<bool> g_enabled = false;
+
+		State& state()
+		{
+			static State st {};
+			return st;
+		}
+
+		uint64_t& counter(State& st, std::string_view name)
+		{
+			for(auto& [k, v] : st.counters)
+			{
+				if(k == name)
+					return v;
+			}
+
+			return st.counters.emplace_back(std::string(name), 0).second;
+		}
+
+		std::string json_string(std::string_view str)
+		{
+			std::string ret = "\"";
+			for(char c : str)
+			{
+				if(c == '"' || c == '\\')
+					ret += '\\';
+				ret += c;
+			}
+
+			return ret + "\"";
+		}
+	}
+
+	void setEnabled(bool enabled)
+	{
+		g_enabled = enabled;
+	}
+
+	bool isEnabled()
+	{
+		return g_enabled;
+	}
+
+	void reset()
+	{
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+
+		st.root.children.clear();
+		st.current = &st.root;
+		st.counters.clear();
+	}
+
+	Phase::Phase(std::string_view name) : m_active(g_enabled)
+	{
+		if(not m_active)
+			return;
+
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+
+		Node* node = nullptr;
+		for(auto& child : st.current->children)
+		{
+			if(child->name == name)
+			{
+				node = child.get();
+				break;
+			}
+		}
+
+		if(node == nullptr)
+		{
+			node = st.current->children.emplace_back(std::make_unique<Node>()).get();
+			node->name = std::string(name);
+			node->parent = st.current;
+		}
+
+		st.current = node;
+		node->wall_start = std::chrono::steady_clock::now();
+		node->cpu_start = std::clock();
+	}
+
+	Phase::~Phase()
+	{
+		if(not m_active)
+			return;
+
+		auto wall_end = std::chrono::steady_clock::now();
+		auto cpu_end = std::clock();
+
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+
+		// (if the timings were reset while we were running, there's nothing to add to)
+		auto node = st.current;
+		if(node == &st.root)
+			return;
+
+		node->count++;
+		node->wall_ms += std::chrono::duration<double, std::milli>(wall_end - node->wall_start).count();
+		node->cpu_ms += 1000.0 * static_cast<double>(cpu_end - node->cpu_start) / CLOCKS_PER_SEC;
+
+		st.current = node->parent;
+	}
+
+	void setCounter(std::string_view name, uint64_t value)
+	{
+		if(not g_enabled)
+			return;
+
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+		counter(st, name) = value;
+	}
+
+	void addToCounter(std::string_view name, uint64_t amount)
+	{
+		if(not g_enabled)
+			return;
+
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+		counter(st, name) += amount;
+	}
+
+	static void report_text(std::string& out, const Node& node, size_t depth)
+	{
+		auto name = std::string(2 * depth, ' ') + node.name;
+		if(node.count > 1)
+			name += zpr::sprint(" (x{})", node.count);
+
+		out += zpr::sprint("{-40} {10.1f} {10.1f}\n", name, node.wall_ms, node.cpu_ms);
+
+		for(auto& child : node.children)
+			report_text(out, *child, depth + 1);
+	}
+
+	static void report_json(std::string& out, const Node& node)
+	{
+		out += zpr::sprint("{{\"name\":{},\"count\":{},\"wall_ms\":{.3f},\"cpu_ms\":{.3f},\"children\":[",
+		    json_string(node.name), node.count, node.wall_ms, node.cpu_ms);
+
+		for(size_t i = 0; i < node.children.size(); i++)
+		{
+			if(i > 0)
+				out += ",";
+			report_json(out, *node.children[i]);
+		}
+
+		out += "]}";
+	}
+
+	std::string report(bool json)
+	{
+		auto& st = state();
+		auto lk = std::unique_lock(st.mtx);
+
+		std::string out {};
+		if(json)
+		{
+			out += "{\"phases\":[";
+			for(size_t i = 0; i < st.root.children.size(); i++)
+			{
+				if(i > 0)
+					out += ",";
+				report_json(out, *st.root.children[i]);
+			}
+
+			out += "],\"counters\":{";
+			for(size_t i = 0; i < st.counters.size(); i++)
+			{
+				out += zpr::sprint("{}{}:{}", i > 0 ? "," : "", json_string(st.counters[i].first),
+				    st.counters[i].second);
+			}
+
+			out += "}}\n";
+		}
+		else
+		{
+			out += zpr::sprint("{-40} {10} {10}\n", "phase", "wall (ms)", "cpu (ms)");
+			for(auto& child : st.root.children)
+				report_text(out, *child, 0);
+
+			if(not st.counters.empty())
+			{
+				out += "\n";
+				for(auto& [name, value] : st.counters)
+					out += zpr::sprint("{-40} {10}\n", name, value);
+			}
+		}
+
+		return out;
+	}
+}
@@ -0,0 +1,46 @@
+// timings.h
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+namespace util::timings
+{
+	/*
+	    Timers for the phases of a compile (and counters of what was done), for `--timings`. Phases nest: a
+	    phase that starts while another is running becomes its child, and a phase that runs several times under
+	    the same parent (eg. laying out the document in every layout pass) is accumulated into one entry, with a
+	    count. Both wall-clock time and CPU time (of the whole process, so it includes the layout threads) are
+	    measured.
+
+	    Everything here does nothing unless timings are enabled. Phases must only be started on the thread that
+	    runs the compile; counters can be updated from anywhere.
+	*/
+	void setEnabled(bool enabled);
+	bool isEnabled();
+
+	// forget everything that was measured so far, eg. between compiles in watch mode.
+	void reset();
+
+	struct [[nodiscard]] Phase
+	{
+		explicit Phase(std::string_view name);
+		~Phase();
+
+		Phase(const Phase&) = delete;
+		Phase& operator=(const Phase&) = delete;
+
+	private:
+		bool m_active;
+	};
+
+	void setCounter(std::string_view name, uint64_t value);
+	void addToCounter(std::string_view name, uint64_t amount);
+
+	// a human-readable table, or (if `json` is true) a JSON object with "phases" and "counters".
+	std::string report(bool json);
+}
@@ -6,11 +6,21 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 
-#if !defined(_WIN32)
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN 1
+#define NOMINMAX 1
+#include <windows.h>
+#undef IN
+
+#else
 #include <unistd.h>
 #include <sys/mman.h>
 #endif
 
+#if defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
+
 #include "util.h"
 
 namespace util
@@ -56,6 +66,53 @@ namespace util
 		});
 	}
 #endif
+
+#if defined(_WIN32)
+	std::optional<stdfs::path> getExecutablePath()
+	{
+		std::wstring buf(MAX_PATH, L'\0');
+		while(true)
+		{
+			auto len = GetModuleFileNameW(nullptr, buf.data(), static_cast<DWORD>(buf.size()));
+			if(len == 0)
+				return std::nullopt;
+
+			if(len < buf.size())
+				return stdfs::path(buf.substr(0, len));
+
+			buf.resize(buf.size() * 2);
+		}
+	}
+
+#elif defined(__APPLE__)
+	std::optional<stdfs::path> getExecutablePath()
+	{
+		uint32_t size = 0;
+		_NSGetExecutablePath(nullptr, &size);
+
+		std::string buf(size, '\0');
+		if(_NSGetExecutablePath(buf.data(), &size) != 0)
+			return std::nullopt;
+
+		std::error_code ec {};
+		auto path = stdfs::canonical(buf.c_str(), ec);
+		if(ec)
+			return std::nullopt;
+
+		return path;
+	}
+
+#else
+	std::optional<stdfs::path> getExecutablePath()
+	{
+		std::error_code ec {};
+		auto path = stdfs::read_symlink("/proc/self/exe", ec);
+		if(ec)
+			return std::nullopt;
+
+		return path;
+	}
+#endif
 }
 
 namespace sap
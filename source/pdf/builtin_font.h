@@ -6,14 +6,64 @@
 
 #include "font/font_source.h"
 
-template <>
-struct std::hash<std::pair<GlyphId, GlyphId>>
+namespace pdf::core14
 {
-	size_t operator()(std::pair<GlyphId, GlyphId> p) const
+	/*
+	    The metrics of the standard 14 fonts, as compile-time tables. These are generated at build time from the
+	    AFM files in pdf/font/builtin_afms/ by tools/gen_core14_metrics.py, with glyph names already resolved --
+	    to codepoints for the glyphs, and to character codes for the kerning pairs and ligatures. Unencoded
+	    glyphs are dropped.
+
+	    The glyphs are sorted by code, and the kerning pairs and ligatures by (left, right).
+	*/
+	struct Glyph
 	{
-		return std::hash<uint64_t>()((static_cast<uint64_t>(p.first) << 32) | (static_cast<uint64_t>(p.second)));
-	}
-};
+		uint8_t code;
+		char32_t codepoint;
+		int16_t width;
+
+		int16_t xmin;
+		int16_t ymin;
+		int16_t xmax;
+		int16_t ymax;
+	};
+
+	struct KernPair
+	{
+		uint8_t left;
+		uint8_t right;
+		int16_t adjust;
+	};
+
+	struct Ligature
+	{
+		uint8_t left;
+		uint8_t right;
+		uint8_t ligature;
+	};
+
+	struct FontData
+	{
+		const char* name;
+
+		int16_t xmin;
+		int16_t ymin;
+		int16_t xmax;
+		int16_t ymax;
+
+		double italic_angle;
+		int16_t cap_height;
+		int16_t x_height;
+		int16_t ascent;
+		int16_t descent;
+		int16_t stem_v;
+		int16_t stem_h;
+
+		zst::span<Glyph> glyphs;
+		zst::span<KernPair> kerning_pairs;
+		zst::span<Ligature> ligatures;
+	};
+}
 
 namespace pdf
 {
@@ -40,7 +90,7 @@ namespace pdf
 			ZapfDingbats,
 		};
 
-		virtual std::string name() const override { return m_name; }
+		virtual std::string name() const override { return m_data->name; }
 		Core14 kind() const { return m_kind; }
 
 		GlyphId getFirstGlyphId() const { return m_first_glyph_id; }
@@ -48,7 +98,7 @@ namespace pdf
 
 		virtual bool isBuiltin() const override { return true; }
 
-		virtual util::hashmap<size_t, font::GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(
+		virtual std::vector<font::GlyphAdjustment> getPositioningAdjustmentsForGlyphSequence(
 		    zst::span<GlyphId> glyphs,
 		    const font::FeatureSet& features) const override;
 		virtual std::optional<font::SubstitutedGlyphString> performSubstitutionsForGlyphSequence(zst::span<GlyphId>
@@ -56,6 +106,7 @@ namespace pdf
 		    const font::FeatureSet& features) const override;
 
 		virtual font::GlyphMetrics get_glyph_metrics_impl(GlyphId glyphid) const override;
+		virtual void load_character_mapping() const override;
 
 		static std::unique_ptr<BuiltinFont> get(Core14 font);
 
@@ -63,14 +114,9 @@ namespace pdf
 		BuiltinFont(Core14 which);
 
 		Core14 m_kind;
+		const core14::FontData* m_data;
 
-		std::string m_name;
 		GlyphId m_first_glyph_id;
 		GlyphId m_last_glyph_id;
-
-		util::hashmap<std::pair<GlyphId, GlyphId>, font::GlyphAdjustment> m_kerning_pairs;
-
-		// note: we know that the ligatures are only in pairs... and they're only ever 'fi' and 'fl'
-		util::hashmap<std::pair<GlyphId, GlyphId>, GlyphId> m_ligature_pairs;
 	};
 }
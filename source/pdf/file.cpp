@@ -10,8 +10,12 @@
 #include "pdf/misc.h"
 #include "pdf/page.h"
 #include "pdf/object.h"
+#include "pdf/resource.h"
 #include "pdf/writer.h"
 
+#include "misc/thread_pool.h"
+#include "misc/timings.h"
+
 #if !defined(GIT_REVISION)
 #define GIT_REVISION "unknown"
 #endif
@@ -74,6 +78,7 @@ namespace pdf
 		info_dict->collectIndirectObjectsAndAssignIds(this);
 
 		// then write the indirect objects
+		auto write_phase = util::timings::Phase("write objects");
 		root->writeIndirectObjects(w);
 		info_dict->writeIndirectObjects(w);
 
@@ -115,6 +120,25 @@ namespace pdf
 	}
 
 
+	void File::prepare_resources_for_serialisation()
+	{
+		std::vector<const Resource*> resources {};
+		util::hashset<const Resource*> seen {};
+
+		for(auto page : m_pages)
+		{
+			for(auto res : page->resources())
+			{
+				if(seen.insert(res).second)
+					resources.push_back(res);
+			}
+		}
+
+		// each resource only touches its own state here (eg. fonts subset their own file and write their
+		// own streams), so they can all be done in parallel.
+		util::ThreadPool::get().forEach(resources.size(), [&](size_t i) { resources[i]->prepareForSerialisation(); });
+	}
+
 	Dictionary* File::create_page_tree()
 	{
 		// TODO: make this more efficient -- make some kind of balanced tree.
@@ -122,10 +146,21 @@ namespace pdf
 		auto pagetree = Dictionary::createIndirect(names::Pages,
 		    { { names::Count, Integer::create(util::checked_cast<int64_t>(m_pages.size())) } });
 
+		{
+			auto _ = util::timings::Phase("serialise pages");
+			for(auto page : m_pages)
+				page->serialise(this);
+		}
+
+		{
+			// (this is mostly subsetting and compressing fonts)
+			auto _ = util::timings::Phase("serialise resources");
+			this->prepare_resources_for_serialisation();
+		}
+
 		auto array = Array::create({});
 		for(auto page : m_pages)
 		{
-			page->serialise(this);
 			page->serialiseResources();
 
 			page->dictionary()->addOrReplace(names::Parent, pagetree);
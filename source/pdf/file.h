@@ -39,6 +39,7 @@ namespace pdf
 
 	private:
 		Dictionary* create_page_tree();
+		void prepare_resources_for_serialisation();
 
 	private:
 		size_t m_current_id = 0;
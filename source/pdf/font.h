@@ -4,12 +4,17 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "util.h"
 #include "types.h"
 
+#include "sap/font_family.h"
+
 #include "pdf/units.h"
 #include "pdf/resource.h"
 #include "pdf/builtin_font.h"
+#include "pdf/shaping_cache.h"
 
 #include "font/metrics.h"
 #include "font/features.h"
@@ -35,24 +40,67 @@ namespace pdf
 
 		virtual Object* resourceObject() const override;
 		virtual void serialise() const override;
+		virtual void prepareForSerialisation() const override;
 
 		Dictionary* dictionary() const { return m_font_dictionary; }
 		bool isCIDFont() const { return not m_source->isBuiltin(); }
 
+		/*
+		    Fonts can be used by several threads at once during layout, so everything here that might touch the
+		    (lazily loaded) state of the font or its source takes a lock. `source()` itself does not, so only use
+		    it for things that are never lazily loaded, or when nobody else can be using the font.
+		*/
 		const font::FontSource& source() const { return *m_source; }
 
+		std::string name() const;
+		const font::CodepointCoverage& coverage() const;
+
 		const font::FontMetrics& getFontMetrics() const { return m_source->metrics(); }
-		font::GlyphMetrics getMetricsForGlyph(GlyphId glyph) const { return m_source->getGlyphMetrics(glyph); }
+		font::GlyphMetrics getMetricsForGlyph(GlyphId glyph) const
+		{
+			auto lk = std::unique_lock(m_lock);
+			return m_source->getGlyphMetrics(glyph);
+		}
+
 		GlyphId getGlyphIdFromCodepoint(char32_t codepoint) const
 		{
+			auto lk = std::unique_lock(m_lock);
 			return m_source->getGlyphIndexForCodepoint(codepoint);
 		}
 
 		int64_t fontId() const { return m_font_id; }
 
-		const std::vector<font::GlyphInfo>& getGlyphInfosForString(zst::wstr_view text) const;
+		/*
+		    The microtype protrusions for this font when used in the given style (some configs only apply to
+		    italics). The table is only made (by calling `make`) the first time it is asked for, after which it
+		    never changes; see `Interpreter::getMicrotypeProtrusionFor`.
+		*/
+		template <typename Fn>
+		const sap::ProtrusionTable& getProtrusionTable(sap::FontStyle style, Fn&& make) const
+		{
+			auto idx = static_cast<size_t>(style);
+			std::call_once(m_protrusion_tables_made[idx], [&]() { m_protrusion_tables[idx] = make(); });
+
+			return m_protrusion_tables[idx];
+		}
+
+		ShapingCache::Stats shapingCacheStats() const
+		{
+			auto lk = std::unique_lock(m_lock);
+			return m_shaping_cache.stats();
+		}
+
+		// returns (hits, misses) for the persistent shaping caches of this font, if any.
+		std::pair<size_t, size_t> persistentShapingCacheStats() const;
+
+		// writes any new entries in the persistent shaping caches to disk.
+		void savePersistentShapingCaches() const;
 
-		Size2d_YDown getWordSize(zst::wstr_view text, PdfScalar font_size) const;
+		// note: this shares the glyphs with the shaping cache, and keeps them alive even if they are evicted.
+		std::shared_ptr<const std::vector<font::GlyphInfo>> getGlyphInfosForString(zst::wstr_view text,
+		    font::FeatureSetId features) const;
+
+		Size2d_YDown getWordSize(zst::wstr_view text, PdfScalar font_size, font::FeatureSetId features) const;
 
 		// returns the GlyphInfos for the given glyph string. note that this *DOES NOT* perform GSUB/morx, ie.
 		// ligatures and/or language-specific glyphs are not done -- hence 'substituted string'
@@ -100,15 +148,41 @@ namespace pdf
 		void writeUTF8CMap() const;
 		void writeCIDSet() const;
 
-		mutable util::hashmap<std::u32string, font::FontVector2d> m_word_size_cache {};
-		mutable util::hashmap<std::u32string, std::vector<font::GlyphInfo>> m_glyph_infos_cache {};
+		char32_t assign_private_use_codepoint(GlyphId glyph) const;
+		std::vector<GlyphId> sorted_extra_mapping_glyphs() const;
+
+		std::shared_ptr<const ShapingCache::Entry> get_shaped_string(zst::wstr_view text,
+		    font::FeatureSetId features) const;
+		PersistentShapingCache* get_persistent_shaping_cache(font::FeatureSetId features) const;
+
+		std::optional<std::vector<GlyphId>> perform_substitutions(zst::span<GlyphId> glyphs,
+		    const font::FeatureSet& features,
+		    PersistentShapingCache::Entry* record) const;
+
+		std::vector<font::GlyphInfo> make_glyph_infos(zst::span<GlyphId> glyphs,
+		    zst::span<font::GlyphAdjustment> gpos_adjustments) const;
+
+		// recursive, since the public methods call each other.
+		mutable std::recursive_mutex m_lock {};
+
+		mutable ShapingCache m_shaping_cache {};
+
+		// null if there is no persistent cache.
+		mutable util::hashmap<font::FeatureSetId, std::unique_ptr<PersistentShapingCache>>
+		    m_persistent_shaping_caches {};
+		mutable std::optional<uint64_t> m_font_hash {};
 
 		mutable util::hashmap<GlyphId, std::vector<char32_t>> m_extra_unicode_mappings {};
 
 		mutable util::hashmap<GlyphId, char32_t> m_extra_glyph_to_private_use_mapping {};
 		mutable char32_t m_cur_unicode_private_use_codepoint = 0;
 
+		// one for each sap::FontStyle
+		mutable std::once_flag m_protrusion_tables_made[4] {};
+		mutable sap::ProtrusionTable m_protrusion_tables[4] {};
+
 		mutable bool m_did_serialise = false;
+		mutable bool m_did_prepare_serialisation = false;
 
 		// map from the first character of the adjustment to the actual list of adjustments
 		util::hashmap<GlyphId, std::vector<std::pair<std::vector<GlyphId>, GlyphPosAdjMap>>>
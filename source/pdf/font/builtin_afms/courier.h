@@ -1,217 +0,0 @@
-// courier.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_COURIER[] = { 0x78, 0x9c, 0xbd, 0x5b, 0x59, 0x73, 0xdc, 0xc6, 0x11, 0x7e, 0x57, 0x15, 0xff, 0x03,
-	0x1e, 0x93, 0xaa, 0xac, 0x0b, 0xd7, 0x60, 0x00, 0xfb, 0x89, 0x12, 0x69, 0x9b, 0xb1, 0x0e, 0x47, 0x14, 0x25, 0x5b,
-	0x6f, 0xe0, 0xee, 0x70, 0x89, 0x08, 0x0b, 0xd0, 0x38, 0x24, 0x51, 0xbf, 0xde, 0x3d, 0x77, 0xa3, 0xb1, 0xb3, 0x62,
-	0x5e, 0x52, 0x29, 0x2b, 0x3a, 0xba, 0xe7, 0xe8, 0xaf, 0x8f, 0xaf, 0x7b, 0xc0, 0xeb, 0xa9, 0x1e, 0xa6, 0x9f, 0xfb,
-	0x6e, 0x7a, 0x25, 0xa6, 0xa1, 0xd9, 0x8e, 0x51, 0xfe, 0x43, 0x72, 0xf6, 0xec, 0x45, 0x7f, 0x38, 0x88, 0x6e, 0x8a,
-	0x5e, 0xf4, 0x0f, 0x8f, 0x43, 0xb3, 0xbf, 0x9f, 0xa2, 0x7f, 0x6c, 0xff, 0x19, 0x25, 0x55, 0x59, 0xfd, 0x0b, 0x7e,
-	0xad, 0x62, 0xf5, 0x6b, 0xa2, 0x7e, 0x4d, 0xd5, 0xaf, 0x99, 0xfa, 0x95, 0x47, 0xe7, 0xbb, 0xfe, 0x56, 0x44, 0xd7,
-	0x8f, 0xe3, 0x24, 0x0e, 0x63, 0x74, 0xd5, 0x6d, 0xfb, 0xe1, 0xa1, 0x1f, 0xea, 0x49, 0xec, 0x7e, 0x88, 0xa2, 0xf3,
-	0xb6, 0x8d, 0xde, 0xca, 0xd5, 0xc6, 0xe8, 0xad, 0x18, 0xc5, 0xf0, 0x19, 0xfe, 0x16, 0xed, 0x35, 0x88, 0x7a, 0x6a,
-	0xfa, 0x2e, 0xba, 0x00, 0xf1, 0x1f, 0xa3, 0x77, 0xf7, 0x73, 0xf4, 0xaa, 0x7e, 0x8c, 0xa2, 0x24, 0x4a, 0xf8, 0x8f,
-	0x29, 0xff, 0x31, 0xae, 0xd4, 0x16, 0x5e, 0xe1, 0xa6, 0x6b, 0xfe, 0x9a, 0xc5, 0xd5, 0x45, 0x94, 0x67, 0x31, 0x8b,
-	0xfd, 0xdf, 0xbf, 0x7f, 0x35, 0x8f, 0xf5, 0x5e, 0x44, 0x59, 0xc5, 0x59, 0x1e, 0xb1, 0x98, 0xf3, 0xea, 0xec, 0x99,
-	0xbc, 0xe2, 0xeb, 0xfa, 0x20, 0xe0, 0x4a, 0xf3, 0xd0, 0x88, 0x01, 0xfe, 0x66, 0x6e, 0x5b, 0xf2, 0x37, 0xf5, 0xa1,
-	0x69, 0x1f, 0x97, 0x7f, 0xf7, 0x41, 0xa8, 0xeb, 0xbf, 0x12, 0xbb, 0x66, 0x3e, 0x9c, 0x3d, 0xbb, 0x9a, 0xea, 0xb6,
-	0xd9, 0x9e, 0x77, 0xfb, 0x56, 0x44, 0xb0, 0xe5, 0xd5, 0xf8, 0x73, 0xf3, 0x55, 0xec, 0x7e, 0x6f, 0xa6, 0xed, 0x7d,
-	0x34, 0x0d, 0xb3, 0x80, 0x53, 0xdc, 0xd7, 0x43, 0xbd, 0x9d, 0xc4, 0x70, 0x2d, 0xa6, 0xe8, 0xf2, 0xeb, 0x24, 0xba,
-	0x9d, 0xd8, 0xbd, 0xed, 0x0f, 0x75, 0xa7, 0x0f, 0xf1, 0xfc, 0x79, 0xff, 0x35, 0xda, 0xa4, 0x19, 0xfc, 0xc7, 0xe2,
-	0x88, 0x27, 0x2c, 0x2a, 0x63, 0x16, 0x9d, 0x3d, 0xbb, 0x01, 0xb9, 0xa1, 0x6d, 0x3a, 0xf1, 0x7b, 0x3f, 0x36, 0xca,
-	0x0e, 0x9b, 0x24, 0x8e, 0xd1, 0xdf, 0xbf, 0xbb, 0x6f, 0xb6, 0x9f, 0x3a, 0x31, 0x8e, 0x91, 0xbc, 0xec, 0x7b, 0x31,
-	0x8c, 0x52, 0x28, 0x8e, 0xb3, 0x1f, 0x62, 0x29, 0xf7, 0xba, 0x9f, 0x9a, 0xad, 0xf8, 0xbf, 0x20, 0x76, 0x09, 0x42,
-	0xbb, 0xa6, 0xdb, 0x5f, 0x6f, 0xef, 0x05, 0xd8, 0x4a, 0xad, 0x70, 0x3d, 0xd5, 0xdd, 0xae, 0x1e, 0x76, 0xf6, 0xdf,
-	0xc0, 0x10, 0xf5, 0xc3, 0xaf, 0xda, 0x78, 0xac, 0x48, 0xcf, 0x9e, 0xfd, 0x61, 0xfe, 0x90, 0xa7, 0xc5, 0xd9, 0xb3,
-	0xf3, 0x71, 0x2b, 0xed, 0x32, 0x44, 0x45, 0x0a, 0xd8, 0x5c, 0x08, 0xfb, 0xc7, 0x4d, 0xc2, 0x00, 0xe0, 0xeb, 0x69,
-	0xf7, 0xeb, 0x87, 0x88, 0x25, 0xea, 0x77, 0xef, 0xed, 0xef, 0xc0, 0x4f, 0xa5, 0x6d, 0xad, 0x9f, 0x66, 0x09, 0x83,
-	0x3d, 0xa2, 0x2c, 0x8d, 0x7e, 0x8a, 0x3e, 0xfc, 0x11, 0x15, 0x71, 0x0c, 0xbf, 0x79, 0x1d, 0x8d, 0x0f, 0x35, 0x58,
-	0xe1, 0xa7, 0xe8, 0x79, 0x14, 0x9b, 0xff, 0xfd, 0xa4, 0xc4, 0xb2, 0xa5, 0x98, 0xf8, 0xba, 0x6d, 0xeb, 0x83, 0x92,
-	0x4b, 0xb3, 0x42, 0xee, 0x1b, 0x65, 0x05, 0x38, 0x0b, 0x4f, 0x8d, 0x7c, 0xbe, 0x94, 0xff, 0x6b, 0xee, 0xc1, 0x22,
-	0xb7, 0xad, 0xd2, 0x48, 0x4a, 0x0e, 0xfb, 0x96, 0x51, 0x9e, 0x64, 0xf2, 0x6e, 0x46, 0x83, 0x2d, 0x35, 0xba, 0xf9,
-	0x70, 0x2b, 0x31, 0xda, 0x77, 0x4a, 0xa7, 0x02, 0xc0, 0xe1, 0xac, 0xe0, 0x8d, 0x51, 0x91, 0x55, 0x46, 0xa5, 0x58,
-	0xaa, 0xec, 0xfa, 0xb6, 0xad, 0x07, 0xbd, 0x05, 0xf8, 0xc4, 0x26, 0x49, 0x8b, 0x28, 0xaf, 0x8a, 0xa8, 0x70, 0x7b,
-	0xf0, 0xa5, 0xc2, 0x83, 0x18, 0xb6, 0xd2, 0xe3, 0xa5, 0x46, 0x99, 0xa8, 0x5b, 0xb0, 0xa4, 0x04, 0xa3, 0x5a, 0xf9,
-	0x72, 0x29, 0x5f, 0x1f, 0x40, 0x63, 0x04, 0xa0, 0x94, 0x46, 0x91, 0x69, 0x0d, 0x90, 0x62, 0x79, 0x66, 0x34, 0xaa,
-	0x23, 0xf7, 0xd6, 0xfe, 0xa4, 0x6c, 0x05, 0x37, 0x96, 0x37, 0xcf, 0x78, 0xe1, 0x6f, 0x9e, 0xc7, 0xe4, 0x54, 0xf5,
-	0x20, 0xba, 0x56, 0xdc, 0x19, 0x95, 0xa2, 0x92, 0x9e, 0x0c, 0xd6, 0x02, 0x39, 0x77, 0xb2, 0x3c, 0x39, 0xa2, 0xe3,
-	0xf7, 0x49, 0x8a, 0x58, 0x2b, 0x65, 0x59, 0x82, 0x94, 0x08, 0xd6, 0xf5, 0x28, 0xcf, 0x36, 0x7e, 0xd2, 0x2a, 0x49,
-	0x11, 0xa5, 0x8c, 0x47, 0x79, 0x99, 0x83, 0x00, 0x37, 0x1a, 0x04, 0xf6, 0x87, 0x76, 0x1e, 0xb5, 0xb5, 0x62, 0x38,
-	0x4f, 0xc4, 0x52, 0xf8, 0x3f, 0x6e, 0x5c, 0x24, 0x27, 0x90, 0x6f, 0x21, 0x9d, 0xd4, 0x06, 0x6f, 0x69, 0xdb, 0x24,
-	0x05, 0xaf, 0xc8, 0xa3, 0xc4, 0x9d, 0x86, 0x00, 0x7e, 0xff, 0xf8, 0x70, 0x2f, 0x3a, 0x83, 0x5e, 0x06, 0x6e, 0x95,
-	0x00, 0x78, 0x3c, 0x4a, 0x4b, 0x66, 0xe4, 0x8b, 0x15, 0x78, 0x4d, 0xaf, 0x91, 0x48, 0xd3, 0x4a, 0xbb, 0x20, 0x87,
-	0x64, 0x17, 0x1b, 0xef, 0xc8, 0x09, 0xd8, 0x63, 0x5b, 0x8f, 0xf7, 0x7a, 0xf9, 0x14, 0x9c, 0x43, 0xde, 0x80, 0x33,
-	0x19, 0x40, 0x46, 0x9c, 0x60, 0xfd, 0x4d, 0x0c, 0xbd, 0x39, 0x8c, 0xf6, 0xef, 0xbc, 0xca, 0x91, 0x29, 0x09, 0xce,
-	0x7d, 0xa7, 0x83, 0x06, 0xbc, 0x2d, 0x06, 0x27, 0x65, 0x5e, 0x92, 0x11, 0x74, 0xa7, 0x2f, 0x7a, 0x59, 0x2e, 0x63,
-	0x2b, 0xe7, 0x08, 0x1e, 0x46, 0x30, 0x9d, 0xee, 0x07, 0xa1, 0x57, 0xe5, 0x4c, 0x9f, 0xa0, 0x28, 0x90, 0x34, 0x01,
-	0xf3, 0x0e, 0x32, 0xae, 0x16, 0x2e, 0xd5, 0x11, 0x90, 0xb3, 0x30, 0x82, 0xe2, 0x5d, 0xf3, 0xd9, 0x9c, 0x36, 0x35,
-	0x37, 0xe3, 0x1e, 0x72, 0x46, 0x60, 0x1c, 0x9b, 0xaf, 0xc6, 0x3f, 0x12, 0x2f, 0xec, 0x56, 0x26, 0x18, 0x8e, 0xe2,
-	0xb3, 0x81, 0xb0, 0x4c, 0xe5, 0xf5, 0xca, 0x0c, 0x2d, 0x4c, 0xf0, 0x13, 0xde, 0x5b, 0x63, 0x7b, 0x0e, 0x14, 0x7b,
-	0x8c, 0xc0, 0xd7, 0x35, 0xde, 0xc4, 0x4a, 0xb8, 0xac, 0x90, 0x30, 0x01, 0x6f, 0xdb, 0xb7, 0x7d, 0xb7, 0x72, 0x8d,
-	0xcc, 0xba, 0x12, 0xab, 0xe8, 0xb1, 0x0f, 0x8d, 0x57, 0xf1, 0xee, 0x8a, 0x75, 0x0a, 0x82, 0x63, 0x2b, 0x2b, 0x89,
-	0x14, 0x87, 0x50, 0x84, 0xc0, 0x62, 0x49, 0x05, 0x68, 0x9a, 0xe3, 0x14, 0x04, 0x49, 0xf1, 0xd7, 0x5c, 0xb7, 0x36,
-	0x6e, 0x12, 0x99, 0x2f, 0x20, 0x70, 0x64, 0x0e, 0xd0, 0xd2, 0x04, 0xc9, 0xbd, 0x2c, 0xe4, 0x42, 0x83, 0x09, 0x88,
-	0xcb, 0xc5, 0x21, 0x6e, 0xfc, 0xe2, 0x04, 0x4d, 0xa8, 0xe1, 0xa3, 0xaa, 0x77, 0xda, 0xb5, 0x2b, 0x63, 0xca, 0xd4,
-	0x27, 0xe3, 0x82, 0x40, 0x5a, 0x6b, 0xb3, 0x73, 0x6e, 0xf2, 0x57, 0xe6, 0x0d, 0x59, 0x10, 0x40, 0xcf, 0x95, 0x64,
-	0x26, 0x3d, 0x0a, 0x70, 0x77, 0x29, 0xab, 0x20, 0x58, 0x3e, 0xd7, 0x96, 0x50, 0x72, 0x60, 0x5c, 0x2f, 0x47, 0x40,
-	0x7c, 0x61, 0x2d, 0xb6, 0x49, 0x64, 0xd2, 0x04, 0xe9, 0xd2, 0x64, 0x8f, 0x82, 0x20, 0x78, 0x81, 0x56, 0xe4, 0x39,
-	0x5a, 0x91, 0x40, 0x77, 0xa9, 0xe4, 0x98, 0xde, 0x39, 0xf6, 0x72, 0x9c, 0xc0, 0xf5, 0x33, 0x92, 0x83, 0xcc, 0xe3,
-	0xe5, 0x08, 0x54, 0xbf, 0xe8, 0x0b, 0x9b, 0x13, 0x42, 0xe0, 0xb9, 0x13, 0x72, 0x02, 0xd3, 0xaf, 0x5a, 0x52, 0xfa,
-	0x39, 0x83, 0xd3, 0xfb, 0x15, 0x09, 0x3e, 0x57, 0x38, 0x31, 0xa0, 0x9b, 0x70, 0x82, 0xca, 0xbf, 0xf5, 0x7a, 0xb9,
-	0xde, 0xb9, 0x40, 0x05, 0x82, 0x13, 0x50, 0x7e, 0xd3, 0x92, 0x2a, 0xce, 0x21, 0xce, 0xbc, 0x1c, 0x41, 0xe5, 0xa5,
-	0xb6, 0x21, 0x57, 0xb6, 0xc1, 0x3b, 0x13, 0x54, 0x5e, 0x69, 0x39, 0x05, 0x32, 0xde, 0x96, 0x40, 0xf2, 0x5a, 0x7b,
-	0x0d, 0x9c, 0x0f, 0xca, 0x76, 0x85, 0x4a, 0x37, 0x27, 0x98, 0xbc, 0xb1, 0xd8, 0xa9, 0x9b, 0x40, 0x20, 0x3b, 0x1b,
-	0x96, 0x04, 0x95, 0xdf, 0xf5, 0x92, 0x95, 0x3a, 0x21, 0xb2, 0x61, 0x49, 0x50, 0xf9, 0x8f, 0x5f, 0x31, 0xa3, 0x4b,
-	0x12, 0x58, 0xde, 0x62, 0xe3, 0xe0, 0x25, 0x09, 0x2c, 0xd7, 0x7a, 0x6b, 0xc8, 0x3c, 0x10, 0x8b, 0x0c, 0xc2, 0xc6,
-	0xaf, 0x48, 0x80, 0x79, 0x87, 0x56, 0x2c, 0xd0, 0xb5, 0x4b, 0x02, 0xcb, 0x8d, 0x8e, 0x40, 0xae, 0xaf, 0x5d, 0x62,
-	0x49, 0x02, 0xcc, 0x7b, 0x25, 0xb9, 0xc9, 0x95, 0x29, 0x0b, 0xec, 0x14, 0x25, 0x81, 0xe6, 0x83, 0x96, 0xcc, 0x8c,
-	0x24, 0x5e, 0x93, 0xa0, 0xf3, 0x87, 0x4e, 0x77, 0x3a, 0x60, 0x50, 0xa8, 0x96, 0x04, 0x9c, 0x3f, 0xb5, 0x9c, 0x42,
-	0x1b, 0xb3, 0x90, 0x8a, 0x40, 0xf3, 0x51, 0xe7, 0x2b, 0xe5, 0xb6, 0x09, 0x3a, 0x61, 0x45, 0xa0, 0xb9, 0x05, 0xb6,
-	0xfe, 0x49, 0x4c, 0xc7, 0xf8, 0x4a, 0xea, 0xf3, 0x4a, 0x45, 0x50, 0xba, 0x05, 0x25, 0x54, 0x90, 0xc1, 0x60, 0xaa,
-	0x20, 0x97, 0xa9, 0x2f, 0xc8, 0x55, 0x76, 0x74, 0x23, 0x44, 0x72, 0xc0, 0x63, 0xd6, 0x24, 0xa7, 0xa2, 0xc9, 0x6e,
-	0xdc, 0x36, 0xcd, 0xb6, 0x19, 0xb6, 0xb3, 0xa6, 0xab, 0xf0, 0xef, 0x99, 0x6a, 0x6b, 0x50, 0x2d, 0xad, 0x08, 0x92,
-	0xb3, 0x24, 0xd3, 0x23, 0x30, 0x79, 0xcb, 0x84, 0x37, 0x92, 0x32, 0xc8, 0x7f, 0xdd, 0x70, 0x53, 0x0e, 0x2a, 0x02,
-	0xa9, 0x22, 0x7a, 0xde, 0x08, 0x60, 0x5f, 0xc5, 0xf3, 0x4a, 0x84, 0x44, 0x45, 0xb0, 0xad, 0x6d, 0x4a, 0x52, 0x59,
-	0x18, 0xd2, 0x66, 0x2e, 0x59, 0x9d, 0x92, 0x24, 0xd8, 0xde, 0xea, 0xfb, 0xe6, 0x5a, 0x12, 0xb3, 0x96, 0x8a, 0xa0,
-	0xbb, 0xb5, 0x55, 0x43, 0x49, 0xa6, 0x68, 0xcd, 0x24, 0x26, 0x00, 0x6b, 0xea, 0x94, 0x6b, 0x6a, 0xc1, 0xaa, 0xc4,
-	0x2f, 0x9a, 0xc4, 0xb4, 0x7e, 0x2d, 0x56, 0xcd, 0x4b, 0xbc, 0x2a, 0xa5, 0x21, 0x06, 0x50, 0xe5, 0x5f, 0x99, 0x59,
-	0x14, 0x32, 0x51, 0x03, 0xac, 0x43, 0xfd, 0xa6, 0x8d, 0xee, 0x5a, 0xab, 0x4b, 0x10, 0xde, 0xa3, 0x13, 0x71, 0x95,
-	0x02, 0xd1, 0x3e, 0x04, 0x56, 0xe3, 0x38, 0x36, 0x07, 0xa2, 0xb3, 0x13, 0x2c, 0x1b, 0x8d, 0x3a, 0xb3, 0xbc, 0x8c,
-	0x71, 0x2b, 0x48, 0x10, 0xfc, 0x6f, 0x64, 0x78, 0x8b, 0xda, 0x3d, 0x4f, 0x62, 0x2c, 0x4b, 0xa0, 0xfb, 0x84, 0xaa,
-	0x53, 0x19, 0xe3, 0xdd, 0x09, 0x72, 0x2d, 0xd9, 0xdd, 0x0b, 0x12, 0xe0, 0xb4, 0x73, 0x6e, 0xa4, 0x60, 0x01, 0x82,
-	0xfe, 0xe2, 0x09, 0x81, 0xcd, 0xd0, 0x1a, 0x15, 0x97, 0x7c, 0x21, 0x48, 0x40, 0xd3, 0x34, 0xb3, 0x48, 0x5d, 0x93,
-	0x82, 0x44, 0x09, 0x68, 0x0f, 0xfa, 0x94, 0xc6, 0xee, 0x6c, 0xb1, 0x2a, 0x65, 0x1b, 0x4b, 0x8c, 0xc0, 0x6d, 0x90,
-	0x2c, 0xc1, 0xc8, 0x50, 0x98, 0xd8, 0xb0, 0x02, 0x24, 0x48, 0x69, 0x63, 0x64, 0xb8, 0x91, 0xee, 0xc0, 0x32, 0x2c,
-	0x4a, 0x50, 0x32, 0xcd, 0x9a, 0xa5, 0x2e, 0x32, 0x25, 0x3b, 0x51, 0x02, 0xd2, 0xac, 0x2d, 0x65, 0xfa, 0x3a, 0x30,
-	0x04, 0xb4, 0xce, 0x56, 0x94, 0xc0, 0xf4, 0x59, 0x7b, 0x93, 0x6a, 0x9a, 0xe0, 0x52, 0x31, 0x16, 0x25, 0x40, 0x7d,
-	0xf1, 0xb9, 0x3b, 0x56, 0xb9, 0xdb, 0x8b, 0xa6, 0x04, 0x2a, 0x4d, 0x9c, 0xd3, 0xd8, 0x78, 0x09, 0x12, 0x24, 0x50,
-	0x3d, 0x46, 0xb6, 0xb2, 0x2a, 0x9b, 0xe2, 0x93, 0xa6, 0x04, 0xaa, 0x6f, 0x1a, 0x2a, 0x55, 0x31, 0xe3, 0x85, 0xe0,
-	0x91, 0x74, 0xe9, 0x13, 0x52, 0xa2, 0xfc, 0x5a, 0x66, 0xe5, 0x0c, 0xd1, 0xf7, 0x24, 0x25, 0x88, 0xdd, 0x9a, 0xf6,
-	0x39, 0x95, 0x1d, 0x87, 0x9c, 0xaf, 0x64, 0xb0, 0x3e, 0x67, 0xb1, 0x15, 0x67, 0x47, 0xf6, 0xc0, 0x5d, 0x67, 0x66,
-	0x36, 0xc1, 0x4d, 0xb4, 0xec, 0xc2, 0xd7, 0x19, 0x79, 0x6a, 0xda, 0x9d, 0x49, 0x2b, 0x59, 0x94, 0x48, 0x6e, 0x99,
-	0xcb, 0xdd, 0xec, 0x4e, 0x2b, 0x06, 0xad, 0xe6, 0x0d, 0xbb, 0xfe, 0x8b, 0x71, 0x7f, 0x3d, 0x73, 0xe0, 0x6a, 0xe8,
-	0x90, 0x67, 0x4e, 0x8b, 0x18, 0xcb, 0x35, 0xf7, 0xb2, 0x67, 0x80, 0x96, 0x4d, 0x75, 0x45, 0xd2, 0x4b, 0xb5, 0x34,
-	0xb1, 0x98, 0xec, 0x86, 0xdb, 0xa6, 0xd3, 0x59, 0x08, 0x48, 0xc0, 0x06, 0x60, 0x62, 0xf0, 0x5f, 0x91, 0x58, 0x0f,
-	0xa3, 0x44, 0xfa, 0x4e, 0x4e, 0xaa, 0x2c, 0xf5, 0x96, 0xcd, 0x94, 0x84, 0x0f, 0x22, 0xbb, 0x28, 0x98, 0xd5, 0x20,
-	0x16, 0x7b, 0x14, 0x8b, 0xf8, 0x45, 0x75, 0x35, 0xa1, 0x9c, 0xfa, 0xae, 0xed, 0x87, 0x46, 0x4b, 0x4b, 0x67, 0x83,
-	0x64, 0xc3, 0x32, 0xd4, 0xf2, 0x24, 0x94, 0x5b, 0x8f, 0xc2, 0x9f, 0x45, 0x86, 0xed, 0x06, 0xf8, 0x5b, 0x2e, 0x19,
-	0x50, 0xe9, 0xcc, 0x43, 0xbb, 0xa4, 0x79, 0x18, 0x44, 0xb7, 0x35, 0xde, 0x97, 0xc9, 0x2e, 0x8a, 0xa5, 0x5c, 0x95,
-	0x46, 0xa3, 0x70, 0x6c, 0x9a, 0x31, 0x36, 0x6a, 0x7a, 0xa7, 0x6e, 0x01, 0x51, 0xad, 0xca, 0x1c, 0x84, 0xab, 0xbf,
-	0x08, 0xa5, 0xde, 0x76, 0xf6, 0xe3, 0x9d, 0x31, 0xd7, 0x53, 0x10, 0xd9, 0xfd, 0x22, 0x35, 0x02, 0xf9, 0x7e, 0x6e,
-	0x40, 0xe5, 0xd0, 0x7b, 0x6a, 0x01, 0xae, 0xcb, 0x35, 0x07, 0xcb, 0x73, 0x7b, 0x44, 0xca, 0xca, 0xa5, 0x96, 0x3a,
-	0x21, 0xda, 0xad, 0x92, 0x6a, 0x39, 0x4b, 0xb0, 0x1a, 0x2d, 0x3d, 0x56, 0x0d, 0x79, 0xf3, 0x51, 0x3d, 0xea, 0x01,
-	0xba, 0xbc, 0xd8, 0x06, 0xc9, 0xe7, 0x77, 0xca, 0xd9, 0xef, 0xda, 0x90, 0x20, 0x81, 0x51, 0x74, 0x3b, 0x4b, 0x8b,
-	0x60, 0x0d, 0x39, 0x05, 0x61, 0x10, 0x76, 0x6e, 0x0a, 0x92, 0x50, 0x56, 0xbe, 0xab, 0xf7, 0x7b, 0xd3, 0x2c, 0x26,
-	0xb2, 0xb1, 0x92, 0xa8, 0x33, 0xc4, 0x66, 0x13, 0xca, 0xce, 0xb5, 0x82, 0x9b, 0xc5, 0x1d, 0xd5, 0xa1, 0x3c, 0x5d,
-	0xcf, 0x5a, 0x64, 0x38, 0x89, 0x41, 0xd8, 0x99, 0x4b, 0x0a, 0x72, 0x80, 0x3f, 0x28, 0x67, 0xa9, 0x2d, 0x94, 0x94,
-	0x8d, 0x3f, 0xd4, 0x43, 0xbd, 0x1f, 0xea, 0x07, 0x7d, 0x21, 0x16, 0xab, 0xbd, 0x58, 0x82, 0x71, 0xa7, 0xc4, 0xfc,
-	0x76, 0x06, 0xec, 0x0c, 0x04, 0x80, 0x6e, 0x92, 0xc9, 0xcc, 0x29, 0xa9, 0x54, 0x66, 0x15, 0x8e, 0xcd, 0x16, 0x15,
-	0x78, 0xb7, 0xf5, 0x68, 0x1c, 0x33, 0x51, 0x8c, 0x39, 0x57, 0x4d, 0xb6, 0x62, 0x3e, 0x5a, 0x93, 0x1d, 0xd1, 0x04,
-	0x4b, 0x38, 0xbd, 0x24, 0x37, 0x7a, 0x39, 0x44, 0x32, 0xd2, 0x3b, 0x46, 0xf6, 0x40, 0x0f, 0x3b, 0x8b, 0x71, 0x69,
-	0xc6, 0xf1, 0xd5, 0x08, 0xb6, 0xce, 0xa5, 0xbd, 0xe2, 0x31, 0x9f, 0xa6, 0xd4, 0x5e, 0xb4, 0x6d, 0xf3, 0x30, 0x36,
-	0xa3, 0x55, 0xd0, 0xf5, 0x2c, 0xd3, 0x25, 0x5f, 0x6b, 0x54, 0x2b, 0xbc, 0xa6, 0xfb, 0x7e, 0x76, 0xa3, 0x4a, 0xcd,
-	0x31, 0x0b, 0x3c, 0x14, 0x4a, 0x28, 0x91, 0xb7, 0x73, 0x04, 0x97, 0x64, 0x65, 0x26, 0xd7, 0x5c, 0x08, 0x42, 0xd3,
-	0x27, 0x59, 0xca, 0xcb, 0x01, 0x5e, 0x33, 0x4e, 0x4a, 0x98, 0x1e, 0xd9, 0x49, 0x97, 0x28, 0xb8, 0xdb, 0x87, 0x12,
-	0xf2, 0xed, 0x3c, 0x19, 0x94, 0xa0, 0x43, 0x90, 0xf2, 0x39, 0xe4, 0x19, 0x24, 0x4f, 0x40, 0xd2, 0xdc, 0xfd, 0xae,
-	0x15, 0x66, 0x0e, 0x95, 0xca, 0x59, 0x88, 0x3c, 0x14, 0x10, 0x78, 0x66, 0x73, 0x39, 0xa5, 0xe3, 0xbe, 0xbc, 0x48,
-	0x42, 0x28, 0x67, 0x45, 0x2c, 0x96, 0x0d, 0x94, 0x35, 0x31, 0xe5, 0xe2, 0x87, 0x7a, 0x3b, 0xb8, 0x11, 0x4a, 0xac,
-	0x42, 0x2e, 0x2f, 0x25, 0x2e, 0x36, 0xec, 0x56, 0x94, 0x7c, 0x10, 0xee, 0xd6, 0x90, 0x39, 0x63, 0x99, 0x24, 0xe4,
-	0x14, 0xcd, 0x86, 0x35, 0x25, 0xe6, 0xbb, 0x7e, 0xaa, 0xb7, 0xae, 0x1e, 0xa5, 0xb2, 0x18, 0x01, 0x92, 0x19, 0x03,
-	0xea, 0x9a, 0x1b, 0xcb, 0xa6, 0x2b, 0x86, 0xde, 0x40, 0xb4, 0x59, 0xdc, 0x13, 0xa0, 0xdd, 0x52, 0x25, 0x87, 0xed,
-	0x90, 0x0a, 0x89, 0xb7, 0xc1, 0xd6, 0xaf, 0x14, 0x4a, 0x70, 0x0e, 0x3e, 0x92, 0x29, 0x72, 0xcc, 0xad, 0x38, 0xc1,
-	0x6e, 0x2b, 0x76, 0xe0, 0x91, 0x75, 0x64, 0x7b, 0x96, 0x8d, 0x84, 0x30, 0x03, 0xff, 0x4d, 0xdc, 0x06, 0x74, 0x4a,
-	0x3b, 0x77, 0xfb, 0x7a, 0x98, 0x0f, 0x6d, 0x3d, 0x1b, 0xcf, 0xcf, 0x32, 0x05, 0xa2, 0xac, 0xdf, 0x0e, 0xc4, 0x94,
-	0x92, 0xeb, 0x7e, 0xdf, 0x77, 0xe2, 0x93, 0x39, 0x99, 0x64, 0x64, 0x20, 0x99, 0x03, 0xab, 0xce, 0xad, 0x3c, 0xc1,
-	0x63, 0x5b, 0x7b, 0x38, 0x72, 0x35, 0xcd, 0x52, 0x78, 0x17, 0x95, 0x95, 0xa7, 0x21, 0x72, 0x70, 0x59, 0x33, 0x56,
-	0x49, 0x53, 0xfe, 0x83, 0x4b, 0x9a, 0x29, 0x25, 0x2e, 0xe7, 0x97, 0x3e, 0x1b, 0xe3, 0xa9, 0x51, 0x9a, 0x92, 0x73,
-	0xf4, 0xc3, 0xee, 0x4e, 0x1c, 0x1a, 0x37, 0x7c, 0x4c, 0x58, 0xa1, 0xc0, 0x93, 0xcd, 0xad, 0x4b, 0x97, 0x29, 0x7d,
-	0x44, 0x79, 0xe9, 0x5b, 0xdb, 0xf5, 0xf4, 0x25, 0xa5, 0x6f, 0x29, 0x6f, 0x90, 0x74, 0xa6, 0xfa, 0x60, 0x39, 0xe0,
-	0x70, 0x15, 0x22, 0xa5, 0x6f, 0x29, 0x6f, 0xf4, 0xe1, 0xd5, 0xc2, 0x05, 0xc7, 0x0b, 0xb3, 0xd5, 0xe1, 0x0f, 0x40,
-	0xb6, 0xe6, 0xd6, 0x9f, 0x9e, 0x9b, 0xd3, 0x67, 0xe8, 0xf4, 0xf4, 0x2d, 0xa1, 0x36, 0xc2, 0x95, 0x69, 0x37, 0x63,
-	0x4f, 0xc7, 0x53, 0x3a, 0xb4, 0xdf, 0xc9, 0xf2, 0x3c, 0x8e, 0xa4, 0xc9, 0x72, 0xac, 0x34, 0xcd, 0x69, 0x3f, 0xe4,
-	0xef, 0xba, 0x6e, 0x8a, 0xd2, 0xd5, 0x54, 0xdd, 0x4b, 0xcb, 0x3e, 0x46, 0x5a, 0x46, 0x8e, 0x7f, 0x6c, 0x14, 0xa7,
-	0x74, 0xb6, 0xde, 0x2f, 0x4f, 0x8e, 0x7b, 0x8e, 0x94, 0x4e, 0xd7, 0xa1, 0x06, 0x1e, 0x20, 0x3d, 0xde, 0xb6, 0x66,
-	0x8a, 0x5b, 0x6a, 0x9d, 0xb2, 0xf4, 0xe7, 0xd9, 0x10, 0x95, 0xab, 0x45, 0x40, 0xba, 0x89, 0x1e, 0x67, 0xd9, 0x71,
-	0x79, 0xe1, 0x53, 0x1d, 0xea, 0x9d, 0x5d, 0x90, 0x50, 0xf1, 0xda, 0xe7, 0x14, 0x34, 0x14, 0x70, 0x29, 0x85, 0x8a,
-	0xcf, 0xab, 0x50, 0xb4, 0xad, 0x4e, 0x19, 0x87, 0x37, 0x11, 0x3e, 0xb2, 0xf0, 0x99, 0x8a, 0xc0, 0x26, 0x7f, 0x2e,
-	0xae, 0xec, 0xa6, 0x46, 0xc1, 0x2b, 0xef, 0x9a, 0xcf, 0x8d, 0x49, 0xbc, 0xa5, 0x7c, 0x4b, 0xd2, 0xdd, 0x5c, 0xc1,
-	0x03, 0xab, 0xe3, 0x5a, 0x60, 0x96, 0x96, 0xaf, 0xb9, 0x47, 0x85, 0xcf, 0x49, 0x21, 0xb0, 0x54, 0x8a, 0x97, 0x81,
-	0xd5, 0x6b, 0xbf, 0x3a, 0xb6, 0x67, 0xc8, 0x32, 0x37, 0xb4, 0xd0, 0xf8, 0x41, 0x5e, 0x70, 0x8b, 0x47, 0xbf, 0x05,
-	0xea, 0xde, 0x82, 0x5b, 0x8c, 0xea, 0x4d, 0x0c, 0xd5, 0x01, 0xd9, 0xf2, 0x4a, 0x2f, 0x5e, 0xf4, 0xbc, 0x6b, 0xc8,
-	0x96, 0x07, 0xc3, 0xb8, 0xd9, 0x02, 0xb8, 0xba, 0x8c, 0x2b, 0x04, 0xf8, 0x1a, 0x45, 0x1c, 0x90, 0x5e, 0x56, 0x1a,
-	0xa4, 0x11, 0xc2, 0xb9, 0x46, 0x09, 0x5d, 0x19, 0x97, 0xcb, 0x7c, 0xc8, 0xc3, 0x97, 0xb8, 0xf1, 0x96, 0x42, 0xeb,
-	0x07, 0xc1, 0x9e, 0x17, 0x05, 0xc3, 0xac, 0x8f, 0xfb, 0x72, 0xaa, 0x70, 0xb9, 0xb8, 0x82, 0x7b, 0x0f, 0x08, 0x5e,
-	0xe0, 0x02, 0xea, 0xbd, 0x79, 0x07, 0xc9, 0x62, 0xda, 0x8b, 0x51, 0x61, 0x0a, 0x9b, 0x64, 0x03, 0xba, 0x3d, 0x86,
-	0x94, 0xbb, 0x91, 0x8f, 0x4f, 0xc7, 0xb5, 0xec, 0xa7, 0x04, 0x76, 0x88, 0x58, 0xaa, 0x7f, 0x73, 0x99, 0x77, 0x75,
-	0x07, 0xc4, 0x42, 0xdc, 0x0d, 0x8a, 0x2a, 0xb4, 0xfc, 0x3a, 0x92, 0xd3, 0x2a, 0x1c, 0xc9, 0xb5, 0xf3, 0x08, 0x1c,
-	0x0c, 0x69, 0xc0, 0xb1, 0x5f, 0xd3, 0x2b, 0x73, 0xe3, 0xa8, 0x78, 0xee, 0x4f, 0x95, 0x5a, 0x8f, 0xb1, 0x4b, 0xee,
-	0x41, 0x84, 0x6b, 0xcf, 0x1b, 0x9f, 0x12, 0x9d, 0xef, 0xe8, 0x81, 0x32, 0x03, 0xc1, 0x62, 0x24, 0x4f, 0xb5, 0x5e,
-	0xf8, 0x13, 0xa1, 0x47, 0xa7, 0xf0, 0x99, 0x3c, 0x6d, 0x5c, 0x64, 0xe0, 0xa0, 0xcf, 0x2d, 0x48, 0xdd, 0xf7, 0x9d,
-	0x6e, 0xf4, 0x90, 0xa1, 0x61, 0x57, 0x10, 0xb2, 0x11, 0xd3, 0x33, 0xad, 0x90, 0x9c, 0x4e, 0x15, 0xcd, 0x11, 0x04,
-	0x82, 0x26, 0x6d, 0xfb, 0x6f, 0xa2, 0xdb, 0x9b, 0x98, 0x94, 0x83, 0x54, 0x49, 0x0b, 0x78, 0xe8, 0xb2, 0x6f, 0xfd,
-	0xd9, 0xdd, 0xe3, 0x4a, 0x19, 0x07, 0x96, 0xfe, 0x65, 0x85, 0x56, 0x62, 0xd0, 0xc2, 0x2f, 0x6a, 0xab, 0xa0, 0x27,
-	0x89, 0x0e, 0x8d, 0xee, 0x82, 0x89, 0xae, 0x26, 0x3a, 0x18, 0xb7, 0x90, 0xce, 0x39, 0x8a, 0x33, 0xd7, 0x90, 0x87,
-	0xc2, 0x6c, 0x40, 0x61, 0x66, 0x27, 0x99, 0x41, 0xc4, 0xb6, 0x18, 0x31, 0x1d, 0x95, 0xc9, 0x72, 0x0c, 0x4f, 0x35,
-	0x3e, 0x2e, 0x7d, 0xc8, 0xbd, 0xb7, 0x04, 0x7d, 0xe8, 0xdd, 0x7d, 0x3f, 0xe8, 0xe3, 0xe8, 0x67, 0xb3, 0xac, 0x0c,
-	0xbb, 0xff, 0x1b, 0x74, 0x51, 0xf4, 0x1c, 0x17, 0xbc, 0xeb, 0x5b, 0xef, 0x3e, 0x08, 0xe3, 0x40, 0xb0, 0x5c, 0xa3,
-	0xda, 0xe7, 0x5f, 0xd1, 0x82, 0xe2, 0x3b, 0x6f, 0x47, 0xf3, 0xe6, 0x20, 0xbf, 0xdd, 0x0a, 0x72, 0xad, 0x1b, 0xdc,
-	0x91, 0xf9, 0x82, 0x11, 0x3c, 0xfa, 0x8c, 0x3a, 0x1f, 0xef, 0x35, 0xa1, 0xf4, 0xa6, 0x3e, 0xad, 0x18, 0x67, 0x35,
-	0xd6, 0x30, 0xb3, 0x13, 0xc6, 0x80, 0x83, 0x40, 0x0c, 0xe0, 0x77, 0xa1, 0x95, 0x3d, 0x7d, 0xce, 0x42, 0xe6, 0x0c,
-	0x33, 0x16, 0x2f, 0x6e, 0xdd, 0x2c, 0x2c, 0xeb, 0xc9, 0x9f, 0x23, 0x36, 0x59, 0xe0, 0x18, 0x87, 0xb9, 0x9d, 0x9a,
-	0x87, 0x56, 0xcf, 0xed, 0x64, 0xd1, 0x85, 0x0c, 0x28, 0xdf, 0xfc, 0x79, 0x28, 0xae, 0x10, 0xcd, 0x42, 0xc6, 0x09,
-	0xa7, 0x5a, 0x12, 0xe9, 0x45, 0x16, 0x8e, 0xf4, 0x87, 0x7a, 0x98, 0x9a, 0xba, 0xdd, 0x35, 0x77, 0x77, 0x0e, 0xab,
-	0x4c, 0x8f, 0x93, 0x78, 0x12, 0x38, 0xcf, 0xe3, 0xa2, 0x56, 0x63, 0xe2, 0x94, 0x06, 0x34, 0x5e, 0x2f, 0x79, 0x96,
-	0x7e, 0x7f, 0x0e, 0xda, 0xb2, 0x21, 0x39, 0xa1, 0xca, 0xdd, 0xe3, 0x4f, 0x20, 0x23, 0x5c, 0xae, 0xb3, 0x88, 0x49,
-	0xe5, 0x41, 0x72, 0x49, 0xf9, 0x86, 0x2f, 0xa9, 0x81, 0x3b, 0x88, 0x85, 0x06, 0x26, 0x71, 0x21, 0x8d, 0xed, 0xba,
-	0x7f, 0x48, 0x4f, 0x94, 0xc8, 0x0e, 0xc1, 0x6c, 0x9f, 0x87, 0x82, 0xc2, 0x33, 0x8a, 0x2f, 0xe4, 0x14, 0x6e, 0xe0,
-	0xb1, 0x26, 0x04, 0xce, 0x29, 0x30, 0x02, 0x81, 0xd5, 0xaf, 0x50, 0x1d, 0xb2, 0x6d, 0x52, 0x10, 0x2e, 0xf9, 0x51,
-	0x19, 0xb4, 0xd8, 0xf6, 0xcb, 0x32, 0xae, 0xbe, 0x2c, 0x93, 0x3b, 0x84, 0x88, 0xd5, 0xed, 0xd0, 0x7f, 0x12, 0xdd,
-	0xe2, 0xad, 0x42, 0xce, 0x5b, 0xe5, 0x5b, 0x45, 0xc1, 0x03, 0x9b, 0x0c, 0x62, 0xdf, 0x8c, 0x7e, 0x7a, 0xf9, 0x04,
-	0x36, 0xf6, 0x0b, 0x8a, 0x48, 0xff, 0x39, 0x48, 0x30, 0x28, 0xaf, 0x96, 0x89, 0xfc, 0xfb, 0xdd, 0xe1, 0x38, 0x43,
-	0x89, 0xf4, 0x13, 0x7b, 0x79, 0x09, 0x79, 0x1a, 0x16, 0x2e, 0xc1, 0x97, 0x0b, 0xca, 0xa4, 0x1d, 0x34, 0x68, 0xd5,
-	0x01, 0x39, 0x8f, 0xab, 0x5b, 0x21, 0x6f, 0xe8, 0x91, 0x37, 0xa0, 0x17, 0xc3, 0xa0, 0x37, 0x7c, 0xf4, 0x8b, 0xbb,
-	0x8a, 0x15, 0x3c, 0xc9, 0x47, 0xc4, 0x7a, 0xbc, 0x70, 0xe0, 0x24, 0xe6, 0xe3, 0x27, 0xff, 0xc5, 0x54, 0x55, 0x9a,
-	0xa7, 0xae, 0x60, 0x3a, 0xb9, 0x9c, 0xf4, 0x88, 0xe0, 0xfb, 0x3c, 0xfe, 0x05, 0x2e, 0xcf, 0x8a, 0x10, 0xca, 0xf2,
-	0x9c, 0x9f, 0x70, 0x82, 0x96, 0x12, 0x99, 0xca, 0x3c, 0x8c, 0x2d, 0x06, 0x17, 0xab, 0xf2, 0x82, 0x6e, 0xec, 0x5f,
-	0x2a, 0x79, 0x12, 0xc8, 0x25, 0x02, 0x35, 0x3b, 0x2a, 0xd0, 0x65, 0xb3, 0x93, 0x97, 0x27, 0x9a, 0x29, 0xa4, 0xa0,
-	0x8a, 0xa3, 0xea, 0xbe, 0x4e, 0xf0, 0xe0, 0x73, 0x54, 0xd8, 0xbf, 0x5b, 0x89, 0x16, 0x79, 0xca, 0x15, 0xa3, 0xe0,
-	0x90, 0xc3, 0x3b, 0xe5, 0x53, 0x86, 0x1c, 0xdf, 0x50, 0x66, 0xb0, 0x8f, 0x98, 0x41, 0xe1, 0x06, 0xdd, 0xb3, 0x62,
-	0xe6, 0x9e, 0xf8, 0x11, 0x7f, 0x55, 0xa0, 0x11, 0xdf, 0x7f, 0x42, 0x81, 0xee, 0x51, 0x8c, 0x78, 0xaf, 0x0f, 0x0f,
-	0x68, 0x96, 0xfd, 0x99, 0xcd, 0xf8, 0xc1, 0x28, 0x19, 0x51, 0x94, 0x20, 0xba, 0x1f, 0xbc, 0xed, 0x72, 0xbc, 0xe4,
-	0xc7, 0x63, 0x01, 0xdf, 0x7c, 0x43, 0x8a, 0x16, 0xba, 0x71, 0xb0, 0x6c, 0xdd, 0xa0, 0x69, 0xfd, 0x13, 0xda, 0xf0,
-	0x0b, 0xd1, 0x4e, 0x86, 0xcc, 0x2a, 0x3f, 0x00, 0xe3, 0x94, 0x81, 0xa4, 0x3c, 0x39, 0x5e, 0xba, 0x31, 0x6f, 0xb3,
-	0xf2, 0x43, 0x82, 0x70, 0x88, 0x7c, 0xe9, 0x97, 0xfc, 0x8b, 0x9b, 0xd1, 0x64, 0x9a, 0x9f, 0xe0, 0x5f, 0x0b, 0x0b,
-	0xe1, 0xfb, 0x86, 0xbc, 0xf3, 0x80, 0x3f, 0x02, 0xe0, 0xcb, 0xaf, 0x00, 0x56, 0xf6, 0xf7, 0xb6, 0xf9, 0x7e, 0xf3,
-	0xd4, 0xaf, 0xa6, 0x6f, 0xd6, 0x83, 0x4e, 0x4d, 0xdf, 0x2e, 0x8f, 0x8d, 0x4d, 0x8a, 0x24, 0x1c, 0xb8, 0x3b, 0x3f,
-	0xa6, 0x38, 0xf6, 0xa5, 0xce, 0x51, 0x5e, 0x0b, 0xa9, 0x73, 0x80, 0x14, 0x6a, 0xca, 0x69, 0xb4, 0x61, 0x85, 0x2a,
-	0xd6, 0x45, 0x11, 0xb8, 0xf7, 0x35, 0xce, 0x8a, 0x3c, 0xf5, 0x4d, 0xcb, 0x89, 0xac, 0xe8, 0xf2, 0x9b, 0xb6, 0x94,
-	0xfa, 0x84, 0x34, 0x70, 0xa6, 0xdf, 0x82, 0x9d, 0x3b, 0xfe, 0x76, 0x91, 0x6a, 0xbd, 0x44, 0x91, 0x6c, 0x47, 0xe8,
-	0x41, 0x37, 0x9d, 0x86, 0x7a, 0x27, 0x0e, 0xf5, 0xa0, 0x0d, 0x2b, 0x7f, 0x38, 0x24, 0x2d, 0xe4, 0x89, 0x4e, 0x64,
-	0x44, 0xb1, 0x2c, 0xd7, 0x4f, 0xa1, 0x63, 0x57, 0xc8, 0x3f, 0xbe, 0x4b, 0x6a, 0xae, 0x50, 0xae, 0x70, 0xd2, 0xc1,
-	0xee, 0xe5, 0x25, 0x6a, 0x8e, 0x56, 0x0f, 0x06, 0x2b, 0xd7, 0xeb, 0xc4, 0x7d, 0xdd, 0x6a, 0xba, 0x1d, 0xab, 0x6f,
-	0x0e, 0xe4, 0x17, 0x0a, 0x45, 0x28, 0x0b, 0xc9, 0xf9, 0xfc, 0xff, 0x52, 0x4e, 0x7b, 0x3a, 0x6e, 0x44, 0x99, 0x31,
-	0xc4, 0x9f, 0x3b, 0x3f, 0x38, 0xf1, 0xd4, 0x33, 0x44, 0x63, 0x6e, 0xd6, 0x6f, 0x48, 0x26, 0x15, 0x55, 0x27, 0xf8,
-	0xcc, 0xe5, 0x62, 0x9a, 0xfb, 0x1d, 0xf2, 0x23, 0x30, 0x9f, 0xf1, 0xd0, 0x06, 0x33, 0xf5, 0xde, 0x73, 0x3d, 0xfc,
-	0xf9, 0x59, 0x70, 0xf6, 0x0e, 0x10, 0x98, 0x28, 0xc3, 0x28, 0xc0, 0x3f, 0x06, 0x51, 0xb8, 0x46, 0xfc, 0x19, 0x77,
-	0xcb, 0x01, 0x8c, 0xaf, 0x57, 0xf3, 0xb7, 0xd4, 0x04, 0xcd, 0xa9, 0xb8, 0x7c, 0xb3, 0xb2, 0xac, 0xcd, 0x91, 0xe5,
-	0x09, 0x63, 0xed, 0xa0, 0x84, 0x9b, 0x1f, 0x34, 0x48, 0x54, 0xe8, 0x54, 0xea, 0x81, 0x35, 0x98, 0x85, 0x7b, 0x54,
-	0xf1, 0x9f, 0x50, 0x35, 0x5f, 0x20, 0xdf, 0xc6, 0x33, 0xb8, 0x50, 0x63, 0xe2, 0x57, 0x7f, 0x4a, 0xb3, 0x0a, 0x91,
-	0xdf, 0x6c, 0x6b, 0xfb, 0x71, 0x85, 0x4e, 0x90, 0x50, 0x0f, 0xaa, 0x80, 0xf8, 0x05, 0x3a, 0x8c, 0xfd, 0xb6, 0x3c,
-	0x78, 0x94, 0x81, 0x82, 0x50, 0xd8, 0x71, 0x3d, 0x3b, 0x31, 0xd1, 0x79, 0xed, 0x63, 0xc1, 0x77, 0x4a, 0x3c, 0x94,
-	0x1d, 0x7b, 0xf4, 0x21, 0x14, 0x32, 0x66, 0x78, 0x0a, 0x17, 0x4c, 0xa6, 0x27, 0xe6, 0x40, 0x2f, 0xa9, 0x56, 0x6e,
-	0xc7, 0xb9, 0xa7, 0xf2, 0xcc, 0xb9, 0x3f, 0x9a, 0x63, 0x81, 0xa1, 0x6b, 0x9c, 0xa3, 0xc2, 0x66, 0xea, 0x5a, 0x11,
-	0x9f, 0x38, 0xd1, 0xb9, 0x1b, 0xd7, 0x78, 0x82, 0x19, 0x72, 0x6a, 0x7f, 0x0c, 0x5c, 0xf1, 0x43, 0x27, 0xf9, 0x46,
-	0xfa, 0x30, 0x47, 0x32, 0x43, 0x69, 0xfd, 0xd2, 0xbb, 0x04, 0x4a, 0x2c, 0xa1, 0x2e, 0x0f, 0x33, 0x52, 0x4b, 0xd5,
-	0xe3, 0x13, 0x46, 0xfc, 0xb4, 0x32, 0x7d, 0x66, 0x01, 0x8b, 0xc3, 0x35, 0x13, 0xb5, 0xc3, 0xb1, 0x7a, 0x5e, 0x96,
-	0x3f, 0x30, 0x92, 0x96, 0x01, 0x92, 0x73, 0x45, 0xe7, 0x1d, 0xae, 0xf7, 0x0c, 0xd1, 0xc0, 0xce, 0xdf, 0xd9, 0xe7,
-	0xeb, 0xd0, 0x50, 0x73, 0x5a, 0xbd, 0x5a, 0x59, 0xef, 0xc1, 0x9f, 0x5f, 0xae, 0xa7, 0xcb, 0x7b, 0x19, 0x98, 0x5d,
-	0xef, 0x74, 0xe4, 0xf7, 0x24, 0x92, 0x00, 0x67, 0xa1, 0x8d, 0xfa, 0xe5, 0x84, 0x04, 0x85, 0x43, 0x08, 0xbb, 0x79,
-	0xf9, 0x3c, 0x89, 0x27, 0x7f, 0x01, 0x0d, 0x38, 0x8f, 0x2f, 0x86, 0xaa, 0xe9, 0x2e, 0x74, 0x07, 0x18, 0x82, 0x62,
-	0xbf, 0x02, 0x10, 0x15, 0x08, 0x1e, 0x07, 0x0a, 0xba, 0x98, 0xee, 0xd7, 0x97, 0x08, 0x79, 0x2c, 0x62, 0x53, 0xce,
-	0x5b, 0x43, 0x36, 0xea, 0xe8, 0x71, 0x00, 0x3f, 0x37, 0x59, 0x0f, 0xe6, 0x24, 0xf0, 0x59, 0xc2, 0xb6, 0x53, 0xc3,
-	0xb6, 0xcb, 0x70, 0x9e, 0x6f, 0x30, 0x85, 0xb1, 0x84, 0x38, 0x58, 0x42, 0x2f, 0x67, 0xf3, 0xf3, 0x72, 0xe8, 0xe7,
-	0x46, 0x2f, 0xbb, 0x1d, 0xfa, 0x91, 0x53, 0xf5, 0x67, 0xf4, 0xa3, 0xd2, 0x67, 0xcf, 0xfe, 0x06, 0x1a, 0x47, 0x5c,
-	0x3e };
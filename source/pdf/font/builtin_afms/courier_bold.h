@@ -1,217 +0,0 @@
-// courier_bold.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_COURIER_BOLD[] = { 0x78, 0x9c, 0xb5, 0x5b, 0x59, 0x73, 0xdc, 0x46, 0x0e, 0x7e, 0x77, 0x95, 0xff,
-	0x03, 0x1f, 0x77, 0xab, 0x76, 0x52, 0x6c, 0xb2, 0x79, 0xc5, 0x4f, 0xb2, 0xad, 0x24, 0x4a, 0x7c, 0x64, 0x2d, 0x1f,
-	0x49, 0xde, 0xa8, 0x19, 0x6a, 0xc4, 0x35, 0x87, 0x54, 0x48, 0x8e, 0x6d, 0xf9, 0xd7, 0x2f, 0xd0, 0x27, 0x08, 0x4e,
-	0x4b, 0xda, 0x87, 0xad, 0x54, 0x39, 0xd2, 0x08, 0xdd, 0x44, 0xe3, 0xc3, 0xf1, 0x01, 0xcd, 0xb9, 0x9c, 0xeb, 0x71,
-	0xfe, 0x69, 0xe8, 0xe7, 0xd7, 0xcd, 0x3c, 0xb6, 0xdb, 0x29, 0x92, 0x3f, 0x88, 0xa7, 0x4f, 0x5e, 0x0c, 0x87, 0x43,
-	0xd3, 0xcf, 0xd1, 0x8b, 0xe1, 0xf6, 0x6e, 0x6c, 0xf7, 0x37, 0x73, 0xf4, 0x8f, 0xed, 0x3f, 0x23, 0x51, 0x95, 0xd5,
-	0xbf, 0xe0, 0xdf, 0x2a, 0x56, 0xff, 0x0a, 0xf5, 0x6f, 0xaa, 0xfe, 0x2d, 0xa2, 0xb3, 0xdd, 0x70, 0xd5, 0x44, 0x97,
-	0x77, 0xd3, 0xdc, 0x1c, 0xa6, 0xe8, 0xa2, 0xdf, 0x0e, 0xe3, 0xed, 0x30, 0xd6, 0x73, 0xb3, 0xfb, 0x21, 0x8a, 0xce,
-	0xba, 0x2e, 0x7a, 0x87, 0xfb, 0x4c, 0xd1, 0xbb, 0x66, 0x6a, 0xc6, 0x2f, 0xf0, 0x29, 0x79, 0xca, 0xd8, 0xd4, 0x73,
-	0x3b, 0xf4, 0xd1, 0x4b, 0x10, 0xff, 0x31, 0x7a, 0x0d, 0x3f, 0xfd, 0x7a, 0xec, 0xa3, 0x24, 0x8d, 0x44, 0xfe, 0x63,
-	0x52, 0xfe, 0x18, 0xc7, 0xea, 0x11, 0x7e, 0xc1, 0x87, 0xbe, 0xfd, 0xfb, 0xd8, 0x5c, 0xbc, 0x8c, 0x64, 0x1a, 0xcb,
-	0xd2, 0x7f, 0xfe, 0xf1, 0xf5, 0x71, 0xaa, 0xf7, 0x4d, 0x24, 0x85, 0x48, 0xab, 0x28, 0x4b, 0x44, 0x2e, 0x9f, 0x3e,
-	0xc1, 0xc3, 0xbd, 0xa9, 0x0f, 0x0d, 0x1c, 0xe6, 0x38, 0xb6, 0xcd, 0xb8, 0x79, 0x3e, 0x74, 0x3b, 0xf8, 0xf8, 0xd8,
-	0x75, 0xf4, 0xe3, 0xc8, 0x7c, 0x5c, 0x1f, 0xda, 0xee, 0x8e, 0xfe, 0xe1, 0xe9, 0x93, 0x4f, 0x8d, 0x32, 0x81, 0x16,
-	0xb8, 0x98, 0xeb, 0xae, 0xdd, 0x9e, 0xf5, 0xfb, 0xae, 0x89, 0x62, 0xf8, 0x75, 0xfa, 0xa9, 0xfd, 0xd6, 0xec, 0x7e,
-	0x6f, 0xe7, 0xed, 0x4d, 0x34, 0x8f, 0xc7, 0x06, 0xb4, 0xb9, 0xa9, 0xc7, 0x7a, 0x3b, 0x37, 0xe3, 0x65, 0x33, 0x47,
-	0xe7, 0xdf, 0xe6, 0xa6, 0xdf, 0x35, 0xbb, 0x77, 0xc3, 0xa1, 0xee, 0xb5, 0x32, 0xcf, 0x9f, 0x0f, 0xdf, 0xa2, 0x0d,
-	0xa8, 0x18, 0x6d, 0x92, 0x2c, 0x8e, 0x0a, 0x59, 0x45, 0x65, 0x2c, 0xa2, 0xa7, 0x4f, 0x3e, 0x80, 0xe0, 0xd8, 0xb5,
-	0x7d, 0xf3, 0xfb, 0x30, 0xb5, 0xca, 0x20, 0x1b, 0x11, 0xc7, 0xe4, 0xf3, 0xf7, 0x37, 0xed, 0xf6, 0x73, 0xdf, 0x4c,
-	0x53, 0x94, 0xc1, 0xc7, 0x1f, 0x9b, 0x71, 0x42, 0xa1, 0x38, 0x4e, 0x7f, 0x88, 0x51, 0xee, 0xcd, 0x30, 0xb7, 0xdb,
-	0xe6, 0xff, 0x0c, 0xda, 0x39, 0x08, 0xed, 0xda, 0x7e, 0x7f, 0xb9, 0xbd, 0x69, 0xc0, 0x48, 0x6a, 0x87, 0xcb, 0xb9,
-	0xee, 0x77, 0xf5, 0xb8, 0xb3, 0x7f, 0x03, 0x1b, 0xd4, 0xb7, 0xbf, 0x68, 0xab, 0x65, 0x79, 0xf2, 0xf4, 0xc9, 0x1f,
-	0xe6, 0x17, 0x99, 0x56, 0x4f, 0x9f, 0x9c, 0x4d, 0x5b, 0x34, 0xc9, 0x18, 0xe5, 0x09, 0xfc, 0xf6, 0xb2, 0xb1, 0xbf,
-	0x6e, 0x44, 0x06, 0x18, 0x5f, 0xce, 0xbb, 0x5f, 0x3e, 0x45, 0xa5, 0x54, 0x3f, 0x7d, 0xfc, 0x14, 0x89, 0x38, 0xc7,
-	0x1f, 0xc1, 0x4b, 0xd1, 0xae, 0xd6, 0x4b, 0x53, 0x91, 0xc1, 0x43, 0xa2, 0x34, 0x89, 0x9e, 0x45, 0x9f, 0xfe, 0x88,
-	0x72, 0x70, 0x91, 0x67, 0xd1, 0x9b, 0x68, 0xba, 0xad, 0xc1, 0x00, 0xcf, 0xa2, 0xe7, 0x51, 0x6c, 0xfe, 0x7b, 0xa6,
-	0xc4, 0xd2, 0xa5, 0x58, 0xf3, 0x6d, 0xdb, 0xd5, 0x07, 0x25, 0x97, 0xc4, 0x09, 0x3e, 0x38, 0x4a, 0xab, 0x32, 0xca,
-	0x8a, 0xc4, 0xc8, 0xcb, 0xa5, 0xfc, 0xdf, 0xc7, 0x01, 0x4c, 0x72, 0xd5, 0xa9, 0x15, 0x22, 0xcd, 0xa2, 0xa4, 0x28,
-	0x22, 0x99, 0x67, 0x78, 0x38, 0xb3, 0x22, 0x5b, 0xae, 0xe8, 0x8f, 0x87, 0x2b, 0x84, 0x67, 0xdf, 0xab, 0x35, 0x59,
-	0x1e, 0x6d, 0x24, 0x88, 0x4b, 0x19, 0xe5, 0x99, 0x30, 0x4b, 0xf2, 0xe5, 0x92, 0xdd, 0xd0, 0x75, 0xf5, 0xa8, 0xc4,
-	0x4b, 0xd4, 0x29, 0xc9, 0xa3, 0x4c, 0x54, 0x51, 0x9e, 0xe7, 0x46, 0xbe, 0x58, 0xca, 0xdf, 0x36, 0xe3, 0x16, 0x9d,
-	0x5e, 0xed, 0xaf, 0xce, 0x90, 0x55, 0x59, 0x94, 0x0b, 0x2b, 0x5e, 0x2e, 0xc5, 0xeb, 0x03, 0x2c, 0x98, 0x00, 0x27,
-	0xb5, 0x00, 0x1e, 0xae, 0x56, 0x48, 0x78, 0x88, 0x4c, 0xcd, 0x8a, 0xea, 0xc4, 0xa9, 0xb5, 0x23, 0xa9, 0x73, 0x17,
-	0x42, 0x9f, 0x1b, 0xe2, 0xd2, 0x9d, 0x5b, 0xc6, 0x4c, 0xa9, 0x7a, 0x6c, 0xfa, 0xae, 0xb9, 0xd6, 0x4b, 0x12, 0xd0,
-	0x1f, 0x5c, 0x38, 0x01, 0x5b, 0x09, 0xaf, 0x99, 0x14, 0x27, 0xd6, 0x90, 0xe7, 0xa4, 0x66, 0x51, 0x5a, 0xd2, 0x45,
-	0x0c, 0xe9, 0x7a, 0x42, 0xdd, 0xa6, 0xcf, 0x6a, 0x49, 0x25, 0xd4, 0xa3, 0xb2, 0x18, 0xcc, 0x15, 0x1b, 0xf3, 0x4a,
-	0x86, 0xf9, 0x6d, 0x77, 0x9c, 0x94, 0x30, 0x1c, 0x43, 0x25, 0x87, 0x2a, 0x92, 0x45, 0x69, 0x64, 0x19, 0xde, 0x5b,
-	0xc8, 0x27, 0xb5, 0x56, 0x06, 0x0e, 0x0b, 0xa1, 0x8a, 0x4b, 0x20, 0x1b, 0x15, 0xd2, 0xc8, 0x33, 0xb4, 0x6f, 0xee,
-	0x6e, 0x6f, 0x1a, 0x8d, 0x34, 0x04, 0x2c, 0xf8, 0x14, 0x58, 0x08, 0xfe, 0x9f, 0x0a, 0x63, 0x59, 0x99, 0xaf, 0xa0,
-	0x6b, 0x07, 0x0d, 0x84, 0xa8, 0xb4, 0xff, 0xc9, 0xb8, 0x54, 0x16, 0xd6, 0xf2, 0x0c, 0xea, 0xa9, 0xab, 0xa7, 0x1b,
-	0x7d, 0xd2, 0x32, 0xda, 0x00, 0x06, 0x19, 0x98, 0x27, 0x4f, 0xac, 0x69, 0x18, 0xd2, 0xdf, 0x9b, 0x71, 0xd0, 0x6e,
-	0x54, 0x68, 0x90, 0x41, 0x0d, 0x6f, 0x47, 0x06, 0xf2, 0xd0, 0xeb, 0x78, 0x01, 0x5b, 0xc7, 0x51, 0x06, 0x86, 0x71,
-	0x92, 0x19, 0x83, 0x76, 0xfe, 0xaa, 0x77, 0xcd, 0x51, 0x52, 0x56, 0x54, 0x92, 0x01, 0x3a, 0xdf, 0x8c, 0x8d, 0xde,
-	0x35, 0x4f, 0xb5, 0x06, 0x31, 0x41, 0x32, 0x63, 0x48, 0x5e, 0x43, 0x9a, 0xd5, 0x4e, 0x9c, 0xa2, 0x0a, 0x71, 0x41,
-	0x44, 0x19, 0x86, 0xd7, 0xed, 0x17, 0xbd, 0x6f, 0x11, 0xeb, 0x7d, 0x13, 0xe1, 0x01, 0xcf, 0x18, 0x88, 0x53, 0xfb,
-	0x4d, 0x9b, 0x8c, 0xc8, 0xba, 0x8d, 0x19, 0x80, 0x53, 0xf3, 0xc5, 0xe0, 0x07, 0x7f, 0xc1, 0xd3, 0x49, 0xb2, 0x2f,
-	0x03, 0xaf, 0x71, 0x9e, 0x5a, 0x9a, 0xd3, 0x09, 0xaa, 0x32, 0x83, 0xae, 0x6f, 0x8d, 0x81, 0x8b, 0xca, 0x08, 0xc7,
-	0x44, 0x98, 0x21, 0xb7, 0x1d, 0xba, 0xc1, 0xb8, 0x11, 0xb8, 0xb4, 0x76, 0x0b, 0x0c, 0xb8, 0xcc, 0x88, 0x57, 0x5c,
-	0xeb, 0x43, 0x4b, 0x96, 0x58, 0x57, 0x45, 0x57, 0x72, 0x6b, 0x72, 0x86, 0x62, 0x87, 0xd5, 0x43, 0x41, 0x93, 0x47,
-	0xca, 0x2a, 0xa9, 0x42, 0x47, 0xcb, 0x32, 0x1c, 0x9b, 0xbf, 0x8f, 0x75, 0x67, 0x63, 0x46, 0x88, 0x52, 0x05, 0x0d,
-	0x26, 0x4a, 0x2d, 0xcd, 0x70, 0xdc, 0x63, 0x15, 0x6f, 0x34, 0x94, 0xe0, 0xa2, 0xb8, 0x39, 0xe4, 0x51, 0xbf, 0x39,
-	0xc3, 0x12, 0x0a, 0xf8, 0xa4, 0x6a, 0x9c, 0x75, 0x6b, 0xa1, 0x85, 0xb3, 0xd2, 0x24, 0xed, 0x9c, 0xe1, 0x59, 0x9b,
-	0xf4, 0x60, 0x32, 0x57, 0x29, 0xbd, 0x1d, 0x73, 0x06, 0xe7, 0x99, 0x92, 0xdc, 0x54, 0x00, 0x65, 0x0e, 0x39, 0xc1,
-	0x65, 0xab, 0x9c, 0x41, 0xf9, 0x5c, 0xe7, 0x42, 0xac, 0x13, 0x59, 0x41, 0xb2, 0x5a, 0xce, 0x40, 0x7c, 0xa1, 0xb3,
-	0x19, 0x46, 0x2a, 0x18, 0x01, 0x4c, 0xea, 0x95, 0x64, 0x08, 0xbe, 0x24, 0x3b, 0x82, 0x13, 0xf9, 0x1d, 0x19, 0x74,
-	0xe7, 0x7a, 0x47, 0x74, 0x36, 0xb5, 0x9f, 0x95, 0x2b, 0x18, 0x5c, 0x3f, 0xe9, 0xfd, 0x2a, 0xa5, 0x21, 0x95, 0x63,
-	0x50, 0xfd, 0xbc, 0xd0, 0x10, 0x9f, 0x6c, 0x35, 0x2c, 0x18, 0x4c, 0xbf, 0x98, 0xb2, 0x17, 0xe9, 0x53, 0xf8, 0x1d,
-	0x19, 0x3e, 0x17, 0x16, 0xc8, 0x58, 0x3b, 0x89, 0x93, 0x63, 0xb0, 0xfc, 0xaa, 0x35, 0x2c, 0xd4, 0x93, 0x31, 0x68,
-	0xbc, 0x24, 0x43, 0xe5, 0x37, 0x53, 0x13, 0x94, 0x6d, 0x08, 0x2a, 0x05, 0x43, 0xe5, 0x15, 0x3d, 0x73, 0x49, 0xe4,
-	0x18, 0x2a, 0xaf, 0x35, 0xca, 0x89, 0x42, 0x39, 0x21, 0x72, 0x0c, 0x93, 0x37, 0x3a, 0x58, 0xb1, 0xa4, 0x82, 0xcb,
-	0xd0, 0x23, 0x33, 0x50, 0xde, 0x2e, 0x8c, 0x88, 0x8f, 0xb6, 0x46, 0x2c, 0x19, 0x2c, 0xbf, 0x2b, 0x49, 0x48, 0xbc,
-	0xb0, 0x5b, 0x46, 0x8e, 0x52, 0x32, 0x58, 0xfe, 0xad, 0x8f, 0x82, 0x3b, 0xa6, 0x7c, 0x4b, 0x86, 0xcb, 0x3b, 0xfd,
-	0x70, 0xc9, 0xad, 0x53, 0x32, 0x5c, 0x2e, 0xf5, 0xa3, 0xc1, 0xde, 0xa0, 0x68, 0x06, 0x19, 0x32, 0x2b, 0xad, 0x24,
-	0x43, 0xe6, 0x3d, 0xb1, 0x77, 0x41, 0x77, 0x64, 0xb8, 0x7c, 0xd0, 0x3b, 0x1a, 0xd7, 0xc9, 0x89, 0x20, 0x03, 0xe6,
-	0xa3, 0x36, 0xb8, 0xc0, 0x3c, 0x9d, 0x0b, 0xe2, 0x13, 0x25, 0x43, 0xe6, 0x93, 0x11, 0x2c, 0x95, 0x20, 0x81, 0xb0,
-	0x64, 0xd0, 0xfc, 0x61, 0x32, 0x97, 0x72, 0x46, 0x2a, 0xc7, 0x90, 0xf9, 0x93, 0xca, 0x91, 0xa3, 0x54, 0x0c, 0x97,
-	0xbf, 0x74, 0x6a, 0x4b, 0x4c, 0x2d, 0xf3, 0x72, 0x0c, 0x97, 0x2b, 0x20, 0xe8, 0x9f, 0x9b, 0xd9, 0x13, 0x15, 0x99,
-	0x19, 0xa2, 0x52, 0x10, 0x0a, 0x55, 0x31, 0x88, 0xae, 0x60, 0x11, 0x29, 0xc5, 0x95, 0x29, 0xc5, 0xa9, 0x2f, 0xc5,
-	0x55, 0x7a, 0xf2, 0x39, 0x84, 0xdc, 0x24, 0xe6, 0x41, 0x69, 0x46, 0x1f, 0xc4, 0x53, 0xdd, 0xb4, 0x6d, 0xdb, 0x6d,
-	0x3b, 0x6e, 0x8f, 0x9a, 0xa4, 0x0a, 0xc8, 0xe8, 0xd8, 0x2a, 0xc8, 0x2a, 0x21, 0x8b, 0x18, 0x8c, 0x47, 0x24, 0xd1,
-	0x13, 0x30, 0x78, 0x4b, 0x80, 0x37, 0xf8, 0x30, 0xfc, 0xeb, 0xa6, 0x30, 0xc5, 0xa0, 0x62, 0x80, 0x2a, 0x86, 0xe7,
-	0x8c, 0x20, 0xc0, 0x3d, 0x35, 0xc1, 0x23, 0x48, 0x54, 0x0c, 0x5a, 0x4d, 0x8b, 0x52, 0x43, 0x38, 0x21, 0x25, 0xc9,
-	0xcc, 0x90, 0xa2, 0x8a, 0x61, 0x7b, 0xe5, 0xd4, 0x30, 0xd9, 0xda, 0x19, 0x89, 0x81, 0xbb, 0xd5, 0xfe, 0x67, 0x24,
-	0x01, 0x09, 0x89, 0x85, 0x0e, 0x25, 0x45, 0xcc, 0xf0, 0xdd, 0xd9, 0xe4, 0xa5, 0xe9, 0xae, 0xf0, 0x9b, 0x8a, 0x98,
-	0x17, 0xaf, 0xc5, 0xae, 0x50, 0x7d, 0x9c, 0xa2, 0x68, 0xfe, 0x25, 0xad, 0x88, 0x4c, 0x35, 0x07, 0xaf, 0x81, 0xc0,
-	0x52, 0x7b, 0x42, 0x16, 0x6a, 0x81, 0x6f, 0xa8, 0x1f, 0xba, 0xe8, 0xba, 0xb3, 0x4b, 0x19, 0xc0, 0x7b, 0x9b, 0xef,
-	0xa1, 0x7c, 0xe5, 0x2a, 0xb8, 0xc9, 0x63, 0x18, 0xaa, 0xda, 0x6d, 0x54, 0xca, 0xaf, 0x12, 0xaa, 0x39, 0x03, 0xb2,
-	0x5d, 0x66, 0xde, 0x3c, 0x2b, 0xad, 0x20, 0x83, 0xef, 0x3f, 0x91, 0xe3, 0x58, 0xf0, 0x70, 0x09, 0x67, 0x25, 0xb2,
-	0x0c, 0xb7, 0xcf, 0x34, 0xed, 0x67, 0xf4, 0xe9, 0x0c, 0xb6, 0x8e, 0x3d, 0xdd, 0x0b, 0x32, 0xd8, 0x0e, 0x26, 0xfd,
-	0xaa, 0xfc, 0x0b, 0x52, 0xfe, 0xe0, 0x82, 0xa1, 0x66, 0xf8, 0x49, 0x69, 0x4e, 0x4e, 0x04, 0x19, 0x66, 0x83, 0xb7,
-	0x26, 0x73, 0x2e, 0x21, 0x18, 0x66, 0xb7, 0x26, 0xc5, 0xe0, 0xd9, 0x13, 0x2e, 0xcb, 0xa9, 0x86, 0xf7, 0x1a, 0x94,
-	0x05, 0xb7, 0x21, 0xb2, 0x0c, 0xa4, 0xd1, 0xa6, 0xd7, 0x98, 0xa1, 0x29, 0x38, 0x65, 0xd4, 0xc6, 0xc7, 0xb2, 0x02,
-	0x49, 0x20, 0xa5, 0x5e, 0x2b, 0x18, 0x4e, 0xb3, 0x4b, 0xd9, 0x8a, 0x14, 0x91, 0x52, 0x25, 0x04, 0x83, 0xe9, 0xe8,
-	0x8f, 0x85, 0x5e, 0x5b, 0x61, 0xc7, 0x6c, 0x45, 0x19, 0x50, 0x5f, 0xac, 0x68, 0xac, 0xca, 0x2e, 0x11, 0x64, 0x40,
-	0x7d, 0x65, 0xd9, 0xd8, 0x4b, 0x26, 0x0c, 0x28, 0x4d, 0x98, 0x73, 0x43, 0x5e, 0x88, 0x1c, 0xc3, 0xe9, 0x4e, 0xef,
-	0x28, 0xb5, 0x41, 0x97, 0x4f, 0x4f, 0x18, 0x50, 0xdf, 0x23, 0xdf, 0x5e, 0xc0, 0xf3, 0x88, 0xe0, 0x89, 0x5c, 0x49,
-	0x92, 0x51, 0x1e, 0xdb, 0xd6, 0x91, 0x10, 0x3d, 0x91, 0x30, 0xb8, 0xae, 0x4c, 0xc7, 0x9c, 0x40, 0x3a, 0x55, 0xd3,
-	0x94, 0x14, 0xf2, 0x47, 0x91, 0xc5, 0x56, 0x3c, 0x3b, 0xf1, 0x0c, 0xda, 0x6a, 0xe6, 0xe6, 0x21, 0x32, 0xa6, 0x0f,
-	0x61, 0xf8, 0xa9, 0x74, 0x3c, 0xb7, 0xdd, 0xce, 0x30, 0x79, 0x20, 0xc3, 0x58, 0x77, 0xc1, 0x4f, 0xd3, 0xcc, 0xae,
-	0x59, 0x71, 0x67, 0x35, 0x62, 0xd8, 0x0d, 0x5f, 0xfb, 0xc8, 0x8f, 0x19, 0x20, 0x4a, 0x91, 0x3e, 0x4b, 0x69, 0x6d,
-	0xc0, 0x39, 0xb4, 0x6b, 0xe8, 0x73, 0x1c, 0x18, 0x40, 0x01, 0x43, 0x4e, 0x25, 0xac, 0x0b, 0x72, 0x0a, 0x8d, 0x2d,
-	0x70, 0xd7, 0xf6, 0x3a, 0x07, 0x01, 0xcf, 0xdb, 0x60, 0xe2, 0xce, 0x70, 0x85, 0xb0, 0x2b, 0x98, 0xb9, 0xae, 0x71,
-	0x30, 0x65, 0x49, 0x37, 0x96, 0x22, 0xe4, 0x9e, 0xc0, 0xbf, 0xf2, 0xdc, 0xad, 0x60, 0x16, 0xbb, 0x73, 0x7d, 0xad,
-	0xf2, 0x0a, 0xc2, 0x9e, 0x04, 0x67, 0xd3, 0xd7, 0xdd, 0x30, 0xb6, 0x5a, 0x7a, 0xa3, 0x62, 0x38, 0x15, 0x6a, 0xa4,
-	0xe2, 0x0d, 0xcb, 0x79, 0xf5, 0xd4, 0x78, 0x6d, 0xb0, 0x99, 0x42, 0x86, 0x8b, 0xd1, 0x64, 0x39, 0x92, 0xe0, 0xf4,
-	0x7a, 0x7b, 0x1c, 0xc7, 0xa6, 0xdf, 0x6a, 0xff, 0x83, 0xd0, 0x44, 0x13, 0x61, 0xde, 0xc5, 0x30, 0xd2, 0x0b, 0x4e,
-	0xcd, 0x30, 0xa6, 0x56, 0x4d, 0xeb, 0x34, 0xb9, 0x2b, 0x54, 0x8d, 0x4b, 0x29, 0xdd, 0x17, 0x9c, 0x75, 0xdb, 0x79,
-	0x8f, 0xf3, 0x46, 0x33, 0xfa, 0xc0, 0x30, 0x27, 0xab, 0x18, 0xe4, 0xfb, 0x63, 0x0b, 0x2b, 0x0e, 0x83, 0xa7, 0x15,
-	0x25, 0xf2, 0x79, 0xe4, 0x68, 0x52, 0x5a, 0x13, 0x70, 0x3a, 0x8e, 0x8b, 0x94, 0x7e, 0xde, 0xf3, 0xa5, 0x88, 0x54,
-	0x3a, 0xab, 0xe8, 0x32, 0x5e, 0x77, 0xec, 0x32, 0xe2, 0xcc, 0x27, 0xd7, 0x71, 0x07, 0xd0, 0xc5, 0x45, 0x33, 0xa9,
-	0x8a, 0xa6, 0x77, 0xce, 0xd6, 0xaf, 0xbb, 0xa0, 0x24, 0x43, 0xb1, 0xe9, 0x77, 0x96, 0x13, 0x81, 0xf7, 0xa8, 0xe1,
-	0x07, 0xd8, 0xc9, 0x0d, 0x3f, 0x04, 0xe7, 0xe3, 0xbb, 0x7a, 0xbf, 0x37, 0x7d, 0x22, 0x96, 0x34, 0x44, 0x5d, 0xd2,
-	0x8e, 0x45, 0x70, 0x5e, 0xae, 0x17, 0xb8, 0xf9, 0xdb, 0xc9, 0x35, 0x9c, 0xa1, 0xeb, 0x11, 0x0b, 0xc6, 0x53, 0x33,
-	0x36, 0x76, 0xd4, 0x92, 0x2b, 0xff, 0x96, 0x50, 0x98, 0x53, 0x3b, 0x85, 0x13, 0x9c, 0x87, 0xdf, 0xd6, 0x63, 0xbd,
-	0x1f, 0xeb, 0x5b, 0x73, 0x20, 0xed, 0x94, 0x45, 0x4e, 0x1f, 0xc5, 0x13, 0xd7, 0x11, 0xc0, 0xb3, 0x18, 0xc4, 0x90,
-	0x54, 0x30, 0x69, 0x61, 0xa6, 0x73, 0x0b, 0x4e, 0x8d, 0x13, 0x15, 0x7a, 0x57, 0xf5, 0xa4, 0xfd, 0x12, 0xcd, 0xaf,
-	0x92, 0xa9, 0x04, 0x07, 0x15, 0x76, 0x22, 0x27, 0x38, 0x55, 0xb7, 0x8e, 0xe9, 0xd6, 0xe5, 0x66, 0x19, 0x76, 0xe6,
-	0x64, 0xd9, 0x29, 0x9e, 0x07, 0xcb, 0xbc, 0xb3, 0xe4, 0xc6, 0xa1, 0x13, 0xea, 0xd0, 0x9c, 0xc6, 0x3b, 0x87, 0xf6,
-	0xeb, 0xa0, 0x88, 0x15, 0xa6, 0x8a, 0x3b, 0x1f, 0xe3, 0xa4, 0xbe, 0xe9, 0xba, 0xf6, 0x76, 0x6a, 0x75, 0x81, 0x4c,
-	0x4c, 0xbb, 0x0e, 0x8e, 0x28, 0x5c, 0x1e, 0xe0, 0xf4, 0x1e, 0xc0, 0x9a, 0x6f, 0x86, 0xa3, 0x9b, 0x4e, 0xea, 0xe1,
-	0x38, 0x2c, 0x2b, 0xe8, 0xe8, 0x4a, 0x70, 0x16, 0x6f, 0x47, 0x08, 0x2e, 0xcb, 0x22, 0x25, 0x57, 0x3c, 0x4c, 0xa5,
-	0x74, 0x9b, 0x64, 0x39, 0x29, 0x07, 0x74, 0xcd, 0x18, 0x09, 0xa1, 0xca, 0x80, 0x00, 0xa5, 0x38, 0x38, 0x75, 0x29,
-	0x70, 0xc5, 0xc6, 0xb7, 0xc7, 0xd9, 0x64, 0x8f, 0x38, 0x53, 0xf2, 0x12, 0xf2, 0x12, 0x91, 0x67, 0x20, 0x69, 0xe2,
-	0x7e, 0xdd, 0x35, 0xdf, 0x8c, 0xbf, 0x42, 0xfc, 0x83, 0xcf, 0x48, 0xa0, 0xd2, 0x79, 0x66, 0x13, 0x15, 0xa7, 0xe2,
-	0xbe, 0xbc, 0x80, 0x71, 0x24, 0xa8, 0x9c, 0x61, 0xb7, 0x9a, 0xba, 0xa3, 0x33, 0x68, 0x0e, 0xf5, 0x76, 0xb4, 0x89,
-	0x13, 0x92, 0x3e, 0xea, 0x05, 0xf2, 0xc8, 0xec, 0x8c, 0x3c, 0x27, 0xe3, 0x63, 0x63, 0xce, 0x8c, 0x9a, 0x80, 0xfa,
-	0x6a, 0x68, 0x95, 0xba, 0x23, 0xf0, 0x88, 0x1b, 0xe6, 0x7a, 0xeb, 0x8a, 0x51, 0x92, 0x62, 0xb4, 0x81, 0x99, 0x00,
-	0xfa, 0x3c, 0x35, 0x0c, 0x33, 0x59, 0x71, 0xf3, 0x16, 0x22, 0xcd, 0xc2, 0x2e, 0xa0, 0x14, 0xe1, 0x12, 0x89, 0xf9,
-	0xdf, 0x2f, 0x61, 0xb1, 0x36, 0xda, 0xe2, 0x85, 0xfa, 0xca, 0x12, 0x47, 0x57, 0x20, 0x5e, 0x38, 0x71, 0x06, 0xdc,
-	0xb6, 0xd9, 0x81, 0x43, 0xd6, 0x0e, 0x8a, 0x4d, 0x02, 0xa9, 0x20, 0x2d, 0x0b, 0x3b, 0xe6, 0x4f, 0x38, 0x93, 0xbe,
-	0x39, 0xf6, 0xfb, 0x7a, 0x3c, 0x1e, 0xba, 0xfa, 0x68, 0xdc, 0x1e, 0x1f, 0x53, 0xaa, 0x5e, 0xd3, 0xe1, 0x97, 0x70,
-	0x5a, 0x3d, 0xec, 0x87, 0xbe, 0xd1, 0x7c, 0x19, 0xeb, 0xc9, 0x06, 0xad, 0x23, 0xe3, 0xd8, 0x3f, 0x85, 0x61, 0xb1,
-	0xad, 0x2d, 0x14, 0x0a, 0xea, 0xca, 0x40, 0x9d, 0x17, 0x56, 0x9e, 0xc7, 0xc7, 0xc1, 0xe5, 0x4b, 0x20, 0x1f, 0xea,
-	0x98, 0x38, 0x96, 0x70, 0x09, 0x33, 0xe1, 0xac, 0xe5, 0x4c, 0x4f, 0x8b, 0x36, 0x49, 0xc5, 0x47, 0x1d, 0x58, 0xce,
-	0x96, 0xba, 0x8f, 0xbb, 0xeb, 0xe6, 0xd0, 0xba, 0xa9, 0xa3, 0x80, 0x80, 0x45, 0x5f, 0x93, 0x6a, 0x50, 0x60, 0x4f,
-	0xc0, 0xaf, 0x4d, 0x5e, 0xf9, 0xae, 0x76, 0x3d, 0x76, 0x49, 0xf8, 0xed, 0xc9, 0x5b, 0x2f, 0x8d, 0xb3, 0x12, 0x1c,
-	0x43, 0xa8, 0xc1, 0x86, 0xb4, 0xf2, 0x2c, 0x7e, 0xde, 0x5a, 0xf5, 0x75, 0xeb, 0x93, 0xd1, 0xad, 0xb3, 0x95, 0xfa,
-	0x07, 0x60, 0x5b, 0xc7, 0xee, 0x7e, 0xfd, 0xf9, 0x0d, 0x42, 0xad, 0x85, 0x15, 0x21, 0xcd, 0x34, 0x1f, 0xb5, 0xbc,
-	0x3d, 0xe1, 0xb3, 0xfa, 0x1d, 0xd6, 0xe7, 0x69, 0x62, 0x4d, 0x96, 0xa3, 0xa5, 0x89, 0xe4, 0xfd, 0x90, 0x3f, 0xed,
-	0xba, 0x29, 0x4a, 0x56, 0xe3, 0x74, 0x62, 0x49, 0xa0, 0x40, 0x40, 0x57, 0x55, 0x6b, 0x92, 0x5b, 0x68, 0xf9, 0x50,
-	0x7d, 0x30, 0x9a, 0x8b, 0x52, 0xab, 0x2e, 0xa8, 0xea, 0x7c, 0xae, 0x0e, 0x45, 0xf0, 0x00, 0x29, 0xf2, 0xaa, 0x9b,
-	0x9c, 0xf1, 0x55, 0x1b, 0x9c, 0x7b, 0x85, 0x36, 0x6c, 0xc9, 0xc5, 0x22, 0x2a, 0xdd, 0x01, 0x0a, 0xeb, 0xfc, 0x5c,
-	0xbe, 0xf1, 0xc9, 0x8e, 0xb4, 0xce, 0x79, 0x48, 0xbc, 0xf6, 0x79, 0x85, 0x8c, 0x04, 0x82, 0xe2, 0xc7, 0x55, 0x40,
-	0x9a, 0x4e, 0x27, 0x4f, 0xca, 0xf0, 0xaa, 0xc6, 0x07, 0xd8, 0x42, 0xa7, 0xe2, 0xb4, 0xf8, 0x9f, 0x2c, 0x11, 0x99,
-	0x99, 0x51, 0xf0, 0xc8, 0xbb, 0xf6, 0x4b, 0x4b, 0x98, 0x7d, 0xae, 0x6a, 0x29, 0x5e, 0xdf, 0x9c, 0xde, 0xdd, 0x1b,
-	0xc8, 0x6f, 0x6d, 0x5d, 0x9f, 0x0b, 0x9f, 0xb1, 0x52, 0xe0, 0x26, 0xd2, 0x45, 0x19, 0xd8, 0xbe, 0xf6, 0xdb, 0x3f,
-	0xc6, 0xa0, 0x1f, 0xd8, 0x03, 0xfc, 0x10, 0x2f, 0xf8, 0x84, 0x3b, 0xff, 0x04, 0xda, 0xc0, 0x05, 0x1f, 0x31, 0xa9,
-	0xcb, 0x30, 0x52, 0x0d, 0xb0, 0xe5, 0x45, 0x3f, 0x5e, 0xf4, 0xbc, 0x6b, 0xcc, 0x98, 0x62, 0x04, 0xb8, 0x2c, 0x00,
-	0xdc, 0x07, 0x57, 0x0e, 0xfc, 0x31, 0xca, 0x38, 0x74, 0xf2, 0x05, 0xca, 0xe4, 0xdc, 0x41, 0x57, 0x25, 0x69, 0x5d,
-	0x99, 0x16, 0x87, 0xac, 0x25, 0x19, 0x5b, 0xac, 0x9e, 0x40, 0x42, 0x81, 0x98, 0x35, 0x20, 0x7d, 0x24, 0xdb, 0x2b,
-	0xa7, 0x56, 0xdb, 0x67, 0x3e, 0xb1, 0xf0, 0x05, 0xe7, 0x8b, 0x03, 0xb8, 0x9b, 0x80, 0xa0, 0xfe, 0x2f, 0xa1, 0xe0,
-	0x9b, 0x2b, 0x90, 0xf5, 0xf5, 0x02, 0x17, 0xe6, 0x98, 0xe9, 0x6a, 0x89, 0xed, 0x31, 0x54, 0xa6, 0x4d, 0x08, 0x80,
-	0xad, 0x7b, 0x71, 0xc0, 0x4e, 0xee, 0x4a, 0xf5, 0xb7, 0x2c, 0xe4, 0x4b, 0xe7, 0x84, 0x86, 0xf8, 0x13, 0xc4, 0x65,
-	0x60, 0xfb, 0x75, 0x1c, 0xcb, 0x2c, 0x1c, 0xc7, 0xb5, 0x73, 0x07, 0x1a, 0x09, 0x45, 0x60, 0xf3, 0x37, 0xfc, 0xc8,
-	0xc6, 0x4b, 0x17, 0x03, 0x7f, 0xbe, 0xa8, 0xf3, 0x10, 0xbb, 0xd4, 0x18, 0xf4, 0xb8, 0xda, 0xf3, 0xc6, 0xc7, 0x84,
-	0xe6, 0xfb, 0x15, 0x06, 0xc2, 0xc4, 0x0d, 0x9d, 0xc5, 0xf3, 0x55, 0x2f, 0x08, 0xd9, 0xf4, 0xd7, 0x4d, 0x41, 0xaf,
-	0xab, 0x3d, 0x6d, 0xa4, 0x3a, 0xa5, 0x81, 0x6a, 0x70, 0xce, 0x78, 0xdd, 0x83, 0x4e, 0x37, 0x79, 0xc8, 0xc8, 0xa4,
-	0x2b, 0x08, 0xd9, 0x44, 0x19, 0x9a, 0xca, 0x13, 0xc0, 0xad, 0xee, 0xcd, 0x13, 0xed, 0x09, 0x04, 0x82, 0x26, 0xed,
-	0x86, 0xef, 0x4d, 0xbf, 0x37, 0x8d, 0x8f, 0x9a, 0x52, 0x01, 0xd5, 0x28, 0x64, 0xc0, 0x39, 0xdf, 0x79, 0xdd, 0xdd,
-	0xad, 0x4a, 0x51, 0x05, 0x84, 0x7f, 0x5e, 0xa1, 0x95, 0x18, 0xb4, 0x68, 0x97, 0xb9, 0x0a, 0x7a, 0x9e, 0xdf, 0xfd,
-	0xdc, 0x2e, 0x98, 0xe5, 0x6a, 0xb6, 0x86, 0xe2, 0x16, 0x5a, 0x73, 0x46, 0xe2, 0xcc, 0xd7, 0x90, 0x50, 0x9c, 0x8d,
-	0x24, 0xce, 0xec, 0x1c, 0x33, 0x08, 0xd9, 0x96, 0x42, 0x86, 0x61, 0xa9, 0x20, 0x93, 0xf7, 0x40, 0xf6, 0xd7, 0xd2,
-	0x89, 0xdc, 0x65, 0x4b, 0xd0, 0x89, 0xde, 0xdf, 0x0c, 0xa3, 0x51, 0x47, 0x5f, 0x98, 0x15, 0x61, 0xff, 0x7f, 0x4b,
-	0x33, 0x8a, 0xbf, 0x88, 0x0b, 0x9e, 0xf5, 0x1d, 0x89, 0x17, 0x07, 0x72, 0x28, 0x5a, 0x2e, 0x49, 0x46, 0xf7, 0xf7,
-	0x67, 0x41, 0xf1, 0x1d, 0x71, 0x20, 0x9d, 0xaf, 0x8a, 0xa4, 0x08, 0x53, 0xad, 0x0f, 0x44, 0x75, 0x52, 0x30, 0x42,
-	0x9a, 0x1f, 0x5d, 0x7a, 0xa3, 0x5e, 0x13, 0x4a, 0x6f, 0xea, 0x95, 0x8a, 0xe9, 0xa8, 0xa6, 0x1a, 0x66, 0x74, 0x02,
-	0x5d, 0x55, 0x02, 0x47, 0x90, 0x29, 0x69, 0x91, 0x57, 0xe6, 0xf4, 0x39, 0x8b, 0x5a, 0x33, 0xc8, 0x57, 0xbc, 0x38,
-	0xa1, 0x2a, 0x21, 0x61, 0xcf, 0xfd, 0x1e, 0x16, 0x3e, 0x1c, 0xbb, 0xb9, 0xbd, 0xed, 0xf4, 0xe0, 0xae, 0x34, 0x6f,
-	0xe0, 0xc4, 0xfe, 0x0d, 0x9c, 0x95, 0x75, 0x08, 0x4b, 0x21, 0xe6, 0x09, 0x27, 0x5b, 0x0f, 0x95, 0xbd, 0xef, 0x0c,
-	0xc6, 0xfa, 0x6d, 0x3d, 0xce, 0x6d, 0xdd, 0xed, 0xda, 0x6b, 0x7d, 0xf1, 0x83, 0x17, 0x28, 0x78, 0x3b, 0x9b, 0x16,
-	0x00, 0x70, 0x40, 0x9f, 0xbb, 0x45, 0xb5, 0x5e, 0x10, 0xa7, 0x34, 0x54, 0x91, 0xfc, 0x11, 0xfc, 0xdd, 0x73, 0xd0,
-	0x40, 0x2d, 0x4b, 0x0b, 0x45, 0xea, 0xae, 0x7f, 0x02, 0x91, 0x7b, 0xce, 0x56, 0xf8, 0x6c, 0x1e, 0x24, 0x97, 0x8b,
-	0x43, 0x2c, 0x0a, 0x46, 0xe0, 0x0c, 0xcd, 0x92, 0x65, 0x11, 0x12, 0x17, 0x5a, 0xb1, 0x5d, 0x37, 0x10, 0x32, 0x0b,
-	0x03, 0xd7, 0x13, 0x3a, 0x6d, 0xef, 0x87, 0xc2, 0xed, 0x03, 0x4d, 0x83, 0xde, 0x2b, 0xdc, 0xd4, 0x63, 0xcd, 0x09,
-	0x9c, 0x57, 0x10, 0x04, 0x42, 0x6e, 0x71, 0x71, 0xa2, 0x14, 0x05, 0xe1, 0xc2, 0xb7, 0xc9, 0xa0, 0xcd, 0xf6, 0xaf,
-	0x94, 0x61, 0xa7, 0x87, 0x7d, 0x83, 0x08, 0xe8, 0x72, 0x35, 0x0e, 0x9f, 0x9b, 0x7e, 0x71, 0x5d, 0x81, 0x33, 0x3f,
-	0xbc, 0xae, 0xc8, 0x8b, 0xc0, 0x9a, 0xb1, 0xd9, 0xb7, 0x93, 0x9f, 0x5f, 0x3e, 0x82, 0x90, 0xfd, 0xec, 0x63, 0x92,
-	0xbc, 0x0b, 0x12, 0x3c, 0xc5, 0xc5, 0x32, 0x95, 0x3f, 0xdc, 0x1e, 0x4e, 0x47, 0xa8, 0x92, 0x6e, 0x64, 0x2f, 0xd4,
-	0x5d, 0xb6, 0x62, 0xd1, 0x45, 0x1c, 0xa2, 0x1c, 0x24, 0x03, 0x79, 0x07, 0x0d, 0xe8, 0x33, 0x2e, 0x12, 0xb4, 0xad,
-	0x5c, 0x01, 0x5d, 0x06, 0xe2, 0x0d, 0xe4, 0xca, 0x30, 0xe8, 0x0d, 0x7f, 0xf9, 0xcd, 0x7d, 0xcd, 0x0a, 0x69, 0xf2,
-	0x17, 0x21, 0x3e, 0x4e, 0x38, 0xe4, 0x39, 0xe6, 0xcd, 0x27, 0xff, 0xba, 0x54, 0x92, 0xdb, 0xe0, 0xad, 0x42, 0x66,
-	0x99, 0xdd, 0x90, 0xe0, 0x01, 0x2a, 0xff, 0x62, 0x31, 0xf5, 0x4a, 0x4c, 0x81, 0xce, 0xef, 0x71, 0x82, 0x8e, 0x73,
-	0x99, 0xa2, 0x30, 0x5c, 0x86, 0x8e, 0x2e, 0x56, 0x15, 0x66, 0xc1, 0x1a, 0xec, 0x4d, 0x65, 0x11, 0xa7, 0x81, 0xcc,
-	0x40, 0xfa, 0x1d, 0x15, 0xe8, 0xea, 0x9d, 0x95, 0xf4, 0x9e, 0x76, 0x8a, 0x2e, 0x30, 0xf2, 0xf4, 0x65, 0x93, 0x55,
-	0x79, 0x21, 0x15, 0xe0, 0xe1, 0x5a, 0xb4, 0x4c, 0xcf, 0x4e, 0x3e, 0x38, 0x52, 0xf0, 0x5e, 0xf9, 0x98, 0x31, 0xc7,
-	0x77, 0x92, 0xca, 0xed, 0x45, 0x66, 0x50, 0xb8, 0x25, 0x07, 0x45, 0xcb, 0xab, 0x93, 0xd2, 0x7b, 0xfc, 0x55, 0x91,
-	0x5e, 0x73, 0xfe, 0xfb, 0x8a, 0xf4, 0x40, 0x46, 0x04, 0xde, 0xed, 0xc3, 0x23, 0x1a, 0x1a, 0x26, 0xd9, 0xc3, 0x61,
-	0x32, 0x91, 0x30, 0xa1, 0x94, 0x3f, 0x74, 0xda, 0xd3, 0x03, 0x26, 0xbc, 0x67, 0x3e, 0x7d, 0x58, 0x5e, 0xb5, 0xe8,
-	0x89, 0x03, 0x0e, 0xfd, 0x81, 0xa0, 0xf5, 0x70, 0x27, 0xfe, 0xb2, 0xe9, 0x66, 0xd3, 0x81, 0x98, 0xd8, 0xca, 0xcb,
-	0x20, 0xab, 0xb2, 0xcc, 0x14, 0xdf, 0x3e, 0x74, 0x6f, 0x12, 0x84, 0x63, 0xe4, 0xeb, 0xb0, 0xe4, 0x60, 0x32, 0xd5,
-	0xc3, 0x71, 0x68, 0xb8, 0xc2, 0x1c, 0x6c, 0xd9, 0xe8, 0x93, 0xf3, 0x86, 0x6c, 0x7a, 0x20, 0x6f, 0x01, 0xa0, 0x4a,
-	0xf4, 0x35, 0x80, 0x95, 0xfd, 0xbd, 0x6d, 0x1e, 0x6e, 0xa0, 0x86, 0xd5, 0xfc, 0xcd, 0x78, 0x50, 0x4e, 0x2f, 0x34,
-	0x56, 0xb9, 0x8a, 0x38, 0x74, 0x62, 0x27, 0x27, 0xc5, 0x3d, 0xa1, 0xbb, 0xf3, 0xa3, 0x8a, 0x53, 0xaf, 0xea, 0x9c,
-	0xe4, 0xb6, 0x90, 0x3b, 0x47, 0xc8, 0xa1, 0x96, 0x5f, 0x15, 0xea, 0x6a, 0x3a, 0x97, 0xf7, 0xa8, 0x75, 0xb9, 0xe8,
-	0x5c, 0x0a, 0x93, 0x18, 0xe9, 0x0b, 0x71, 0xeb, 0xc4, 0xe8, 0x52, 0x9c, 0xb6, 0x55, 0x75, 0x0f, 0x9d, 0xff, 0x2d,
-	0xd8, 0xbf, 0x57, 0xf7, 0xf4, 0xef, 0xaf, 0x48, 0x70, 0xda, 0x49, 0x7a, 0xd0, 0x53, 0xe7, 0xb1, 0xde, 0x35, 0x87,
-	0x7a, 0xfc, 0x6c, 0xb3, 0x16, 0xfa, 0x12, 0x7e, 0x1d, 0x24, 0xb8, 0x7d, 0xb3, 0x2c, 0xd8, 0x8f, 0x21, 0x64, 0x17,
-	0x27, 0x1c, 0x24, 0x4c, 0x08, 0x48, 0xb2, 0xf0, 0xd2, 0xa1, 0x16, 0xe6, 0x95, 0xb7, 0xa7, 0x3a, 0x6c, 0x9e, 0xde,
-	0xd3, 0xd9, 0x81, 0x0b, 0xdd, 0xd4, 0xdd, 0xf5, 0xe3, 0xf1, 0xc5, 0x29, 0xfd, 0xff, 0x52, 0x52, 0x07, 0xde, 0x58,
-	0x93, 0xe4, 0x18, 0xe2, 0xd0, 0xbd, 0x9f, 0x9f, 0x78, 0xfa, 0x19, 0x9a, 0x9e, 0x7c, 0x58, 0x45, 0x8f, 0xce, 0x46,
-	0x68, 0xfa, 0xa0, 0x45, 0xcf, 0x49, 0x72, 0x7f, 0x90, 0xff, 0x34, 0xb4, 0x85, 0xf4, 0xd8, 0x06, 0x73, 0xf5, 0x9e,
-	0x8c, 0xdf, 0xc9, 0x2b, 0x68, 0xe1, 0xf8, 0xef, 0x6d, 0x9c, 0x69, 0x18, 0xf0, 0x6b, 0x29, 0x08, 0x43, 0x96, 0xdf,
-	0x17, 0x66, 0x0b, 0x5e, 0x60, 0x9b, 0xe6, 0x10, 0x17, 0xba, 0xe4, 0x61, 0x23, 0x2d, 0xf9, 0xb8, 0x2f, 0x32, 0xdf,
-	0xae, 0x4c, 0x6b, 0xf2, 0x24, 0x5e, 0x0c, 0x84, 0x1b, 0x74, 0x28, 0xe3, 0xe6, 0x8b, 0x06, 0x40, 0x41, 0x13, 0x48,
-	0xc6, 0xb2, 0x90, 0xe1, 0x44, 0x3c, 0x90, 0x01, 0xde, 0x23, 0x0a, 0xe7, 0x0b, 0xd2, 0x53, 0x92, 0x51, 0x5c, 0xe8,
-	0xe0, 0x47, 0xd2, 0x3b, 0x3f, 0xa2, 0x63, 0x85, 0xd0, 0x6f, 0xb7, 0xc6, 0xb7, 0x37, 0xfa, 0x6b, 0x32, 0x12, 0xd4,
-	0x07, 0xcb, 0x86, 0x5a, 0xe2, 0x97, 0x24, 0xda, 0x2c, 0x6b, 0x0c, 0x6a, 0x33, 0x06, 0x61, 0xa0, 0x2f, 0xb5, 0xad,
-	0x1a, 0x26, 0x72, 0x0b, 0xed, 0x1b, 0xa6, 0xd0, 0x20, 0x68, 0x20, 0xc3, 0x47, 0x62, 0xcf, 0x50, 0xf8, 0xbc, 0x5b,
-	0x25, 0x54, 0xf9, 0x98, 0x84, 0xca, 0x57, 0xe1, 0xb7, 0x83, 0xf4, 0x18, 0xb5, 0xbc, 0x87, 0x3c, 0x7a, 0xd5, 0x3c,
-	0x19, 0x0c, 0x9d, 0xe3, 0x8c, 0x8e, 0xee, 0xcd, 0x7d, 0x6f, 0x4e, 0x5f, 0x8c, 0x58, 0x2d, 0xf0, 0xa3, 0x1b, 0xbb,
-	0x79, 0x70, 0x6a, 0xfc, 0xd6, 0x6b, 0x42, 0x4b, 0x7f, 0x48, 0x97, 0xef, 0xcb, 0x04, 0xef, 0xd9, 0x66, 0x28, 0xbd,
-	0x9f, 0x13, 0x2f, 0x75, 0xf9, 0x25, 0xd8, 0xe2, 0x06, 0xa8, 0x69, 0xf0, 0xa4, 0x9f, 0xd7, 0x17, 0x09, 0xd6, 0x8d,
-	0xb2, 0x70, 0xe9, 0x5c, 0x36, 0xc6, 0xf8, 0x3e, 0x10, 0x7e, 0x6f, 0x44, 0x04, 0x3a, 0x89, 0x0b, 0x3e, 0xf9, 0xf0,
-	0x55, 0x2a, 0x70, 0x8c, 0x9e, 0xdc, 0xb8, 0xfb, 0xa1, 0x41, 0x20, 0xc5, 0xcf, 0xc1, 0x48, 0xa0, 0x2f, 0x62, 0xae,
-	0x47, 0xcd, 0x7b, 0x0c, 0xcf, 0x7e, 0x70, 0xef, 0x7f, 0x09, 0x73, 0x0e, 0x19, 0x3a, 0xc7, 0xb0, 0x9c, 0xae, 0xd0,
-	0x88, 0x08, 0x0d, 0xb9, 0x96, 0x5d, 0x0b, 0xc9, 0x1a, 0xa1, 0x15, 0xa0, 0x8f, 0x2f, 0x89, 0x10, 0x9f, 0x58, 0x48,
-	0x33, 0x55, 0x75, 0x03, 0x4a, 0xed, 0x57, 0xe1, 0x43, 0xea, 0x44, 0x21, 0x42, 0x75, 0xc8, 0x74, 0xa7, 0x19, 0x8e,
-	0xf0, 0x0b, 0xf5, 0x0d, 0xc1, 0x20, 0xd8, 0xdf, 0xc9, 0x90, 0xc5, 0xf7, 0x46, 0xa1, 0x7a, 0xcb, 0xd5, 0x11, 0xf6,
-	0x32, 0x91, 0xbe, 0x17, 0x7c, 0xa2, 0x6c, 0x2d, 0x69, 0x77, 0x66, 0x68, 0xb7, 0x2c, 0xc2, 0xd9, 0xbe, 0x3d, 0x45,
-	0x65, 0x82, 0x95, 0xf4, 0xfc, 0x68, 0xbe, 0x33, 0x47, 0xbe, 0x37, 0x7a, 0xde, 0xef, 0xc8, 0x57, 0x4e, 0xd5, 0xef,
-	0xe4, 0x8b, 0xd2, 0x4f, 0x9f, 0xfc, 0x17, 0x84, 0x72, 0x5c, 0x09 };
@@ -1,223 +0,0 @@
-// courier_bold_oblique.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_COURIER_BOLD_OBLIQUE[] = { 0x78, 0x9c, 0xb5, 0x5b, 0xc9, 0x72, 0xdc, 0x46, 0x12, 0xbd, 0x2b, 0x42,
-	0xff, 0x80, 0xe3, 0x4c, 0xc4, 0xb4, 0x02, 0x5b, 0x15, 0x00, 0xeb, 0x44, 0x49, 0xb4, 0x4d, 0x5b, 0x8b, 0x47, 0xd4,
-	0x62, 0xeb, 0x06, 0x76, 0x83, 0x4d, 0x8c, 0xd0, 0x00, 0x8d, 0x45, 0x12, 0xf5, 0xf5, 0x93, 0x59, 0x0b, 0x2a, 0x91,
-	0x60, 0x41, 0x9c, 0xc3, 0x84, 0xc3, 0x14, 0x97, 0xcc, 0x5a, 0xf2, 0xe5, 0xf2, 0x2a, 0xab, 0xfa, 0x72, 0x2c, 0xfb,
-	0xf1, 0xe7, 0xae, 0x1d, 0x5f, 0x55, 0x63, 0x5f, 0xef, 0x87, 0x20, 0x7d, 0x12, 0x3d, 0x7e, 0xf4, 0xbc, 0x3b, 0x9d,
-	0xaa, 0x76, 0x0c, 0x9e, 0x77, 0xb7, 0x77, 0x7d, 0x7d, 0xbc, 0x19, 0x83, 0x7f, 0xec, 0xff, 0x19, 0x44, 0x45, 0x5e,
-	0xfc, 0x0b, 0xbe, 0x16, 0xa1, 0xfa, 0x1a, 0xa9, 0xaf, 0x89, 0xfa, 0x9a, 0x05, 0x67, 0x87, 0xee, 0xaa, 0x0a, 0x2e,
-	0xef, 0x86, 0xb1, 0x3a, 0x0d, 0xc1, 0x45, 0xbb, 0xef, 0xfa, 0xdb, 0xae, 0x2f, 0xc7, 0xea, 0xf0, 0x24, 0x08, 0xce,
-	0x9a, 0x26, 0x78, 0x8b, 0xe3, 0x0c, 0xc1, 0xdb, 0x6a, 0xa8, 0xfa, 0x2f, 0xf0, 0x5b, 0x32, 0x4b, 0x5f, 0x95, 0x63,
-	0xdd, 0xb5, 0xc1, 0x0b, 0x10, 0xff, 0x29, 0x78, 0x05, 0xdf, 0xfd, 0x36, 0xb5, 0x41, 0x9c, 0x04, 0x91, 0xfc, 0x29,
-	0xce, 0x7f, 0x4a, 0xa5, 0x9a, 0xc2, 0x29, 0xbc, 0x6f, 0xeb, 0xbf, 0xa7, 0xea, 0xe2, 0x45, 0x90, 0x26, 0x61, 0x5a,
-	0xb8, 0xdf, 0x7f, 0x78, 0x35, 0x0d, 0xe5, 0xb1, 0x0a, 0xa2, 0x4c, 0xc4, 0x45, 0x90, 0x15, 0x71, 0x9a, 0x3e, 0x7e,
-	0x84, 0x9b, 0x7b, 0x5d, 0x9e, 0x2a, 0xd8, 0xcc, 0xd4, 0xd7, 0x55, 0xbf, 0x7b, 0xd6, 0x35, 0x87, 0x37, 0x57, 0x0d,
-	0x0e, 0x01, 0x7f, 0x9d, 0x9a, 0x86, 0xfe, 0x35, 0xc0, 0xbf, 0x06, 0xee, 0xcf, 0xe5, 0xa9, 0x6e, 0xee, 0xa8, 0xc0,
-	0xe3, 0x47, 0x1f, 0x2b, 0x65, 0x11, 0x14, 0x7c, 0xfc, 0xe8, 0x62, 0x2c, 0x9b, 0x7a, 0x7f, 0xd6, 0x1e, 0x9b, 0x2a,
-	0xd8, 0x45, 0x31, 0xfc, 0x62, 0xf8, 0xb9, 0xfe, 0x56, 0x1d, 0xfe, 0xa8, 0xc7, 0xfd, 0x4d, 0x30, 0xf6, 0x38, 0xc8,
-	0xf3, 0x9b, 0xb2, 0x2f, 0xf7, 0x63, 0xd5, 0x5f, 0x56, 0x63, 0x70, 0xfe, 0x6d, 0xac, 0xda, 0x43, 0x75, 0x78, 0xdb,
-	0x9d, 0xca, 0x56, 0xaf, 0xee, 0xd9, 0xb3, 0xee, 0x5b, 0xb0, 0x13, 0x59, 0xb0, 0x8b, 0x45, 0x18, 0xe4, 0xb2, 0x08,
-	0xf2, 0x30, 0x0a, 0x1e, 0x3f, 0x7a, 0x0f, 0x72, 0x7d, 0x53, 0xb7, 0xd5, 0x1f, 0xdd, 0x50, 0x2b, 0x03, 0xed, 0xa2,
-	0x30, 0x24, 0xbf, 0x7f, 0x77, 0x53, 0xef, 0x3f, 0xb7, 0xd5, 0x30, 0x04, 0x02, 0x7e, 0xfd, 0xa1, 0xea, 0x07, 0x14,
-	0x0a, 0xc3, 0xe4, 0x49, 0x88, 0x72, 0xaf, 0xbb, 0xb1, 0xde, 0x57, 0xff, 0x67, 0x10, 0xcf, 0x41, 0xe8, 0x50, 0xb7,
-	0xc7, 0xcb, 0xfd, 0x4d, 0x05, 0x56, 0x52, 0x23, 0x5c, 0x8e, 0x65, 0x7b, 0x28, 0xfb, 0x83, 0xfd, 0x1b, 0x98, 0xa0,
-	0xbc, 0xfd, 0x55, 0x9b, 0x4d, 0x48, 0x30, 0xd2, 0x9f, 0xe6, 0x87, 0x34, 0x01, 0xf4, 0xce, 0x86, 0x3d, 0x5a, 0xa4,
-	0x0f, 0x64, 0x0c, 0x3f, 0xbd, 0xa8, 0xec, 0x8f, 0xbb, 0x48, 0x00, 0xe6, 0x97, 0xe3, 0xe1, 0xd7, 0x8f, 0x41, 0x9e,
-	0xaa, 0xef, 0x3e, 0x7c, 0x0c, 0xa2, 0x50, 0xe2, 0xb7, 0xe0, 0xb5, 0x68, 0x56, 0xeb, 0xb5, 0x49, 0x24, 0x60, 0x92,
-	0x20, 0x89, 0x83, 0xa7, 0xc1, 0xc7, 0x3f, 0x03, 0x19, 0x86, 0xf0, 0xcd, 0xeb, 0x60, 0xb8, 0x2d, 0xc1, 0x00, 0x4f,
-	0x83, 0x67, 0x41, 0x68, 0xfe, 0x7b, 0xaa, 0xc4, 0x92, 0xa5, 0x58, 0xf5, 0x6d, 0xdf, 0x94, 0x27, 0x25, 0x17, 0x47,
-	0x02, 0x27, 0x0e, 0xd2, 0x42, 0x04, 0x22, 0x8b, 0x8d, 0x7c, 0xba, 0x94, 0xff, 0x7b, 0xea, 0xc0, 0x24, 0x57, 0x8d,
-	0xd1, 0x88, 0x82, 0x38, 0xcb, 0x02, 0x91, 0x0b, 0xdc, 0x9c, 0xd1, 0x10, 0x4b, 0x8d, 0x76, 0x3a, 0x5d, 0x21, 0x3c,
-	0xc7, 0x56, 0xe9, 0xe4, 0x79, 0xb0, 0x4b, 0x45, 0x20, 0xd3, 0x28, 0x90, 0x22, 0x32, 0x2a, 0x72, 0xa9, 0x72, 0xe8,
-	0x9a, 0xa6, 0xec, 0xb5, 0x78, 0x86, 0xbe, 0x25, 0x03, 0x99, 0x84, 0x81, 0x94, 0xd2, 0xc8, 0x67, 0x4b, 0xf9, 0xdb,
-	0xaa, 0xdf, 0x63, 0x10, 0xa0, 0x42, 0x04, 0xfe, 0x83, 0xbb, 0x90, 0x31, 0xfc, 0x1f, 0x59, 0x85, 0x7c, 0xa9, 0x50,
-	0x9e, 0x40, 0x65, 0x00, 0xa4, 0x94, 0x8a, 0xd4, 0x1a, 0x02, 0xf7, 0x9d, 0x26, 0x46, 0xa3, 0xb8, 0x67, 0xdf, 0xda,
-	0x95, 0xd4, 0xce, 0x21, 0xc8, 0xd4, 0xce, 0x41, 0x7e, 0xde, 0x79, 0x1a, 0xb2, 0x65, 0x95, 0x7d, 0xd5, 0x36, 0xd5,
-	0xb5, 0x51, 0x91, 0x68, 0xde, 0x30, 0x86, 0x79, 0x62, 0xb7, 0x32, 0x30, 0xc3, 0x5a, 0xc7, 0xcd, 0x13, 0x45, 0x99,
-	0x56, 0x4a, 0xd3, 0x94, 0x28, 0x31, 0xac, 0xcb, 0x01, 0xd7, 0x36, 0x7c, 0xd6, 0x2a, 0x19, 0x2c, 0x2d, 0x2a, 0x60,
-	0x9a, 0x1c, 0x04, 0x8c, 0x85, 0x53, 0x06, 0xfb, 0x6d, 0x33, 0x0d, 0x66, 0x82, 0x14, 0xf7, 0x2a, 0x0a, 0x19, 0xa4,
-	0x59, 0x6e, 0x84, 0x19, 0xe6, 0x7b, 0xc8, 0x31, 0xa5, 0x92, 0x2e, 0x0a, 0x58, 0x0d, 0x80, 0x0e, 0xc9, 0x07, 0xe6,
-	0x49, 0x8d, 0x38, 0x03, 0xfc, 0xe6, 0xee, 0xf6, 0xa6, 0xd2, 0x60, 0x47, 0x30, 0x6f, 0x1c, 0xa2, 0x89, 0x32, 0xf0,
-	0x53, 0x63, 0xda, 0x54, 0xae, 0xd0, 0xab, 0x3b, 0x8d, 0x44, 0x1c, 0x4a, 0xed, 0x82, 0x71, 0x06, 0xe3, 0xdb, 0xb5,
-	0x33, 0xb4, 0x87, 0xa6, 0x1c, 0x6e, 0xf4, 0x72, 0xc2, 0x60, 0x07, 0x20, 0x48, 0xf4, 0x8f, 0xd8, 0xda, 0x86, 0x41,
-	0xfd, 0xbd, 0xea, 0x3b, 0xbd, 0x96, 0x44, 0x18, 0x98, 0x13, 0x62, 0x49, 0x06, 0x73, 0xd7, 0xea, 0x98, 0x01, 0x99,
-	0x50, 0x01, 0x3b, 0x4b, 0x0a, 0x06, 0xee, 0xf8, 0xb5, 0xb3, 0xce, 0x03, 0x92, 0x05, 0x41, 0x47, 0x30, 0x48, 0xc7,
-	0x9b, 0xbe, 0xd2, 0xa3, 0x66, 0xc6, 0xd1, 0xe0, 0x5f, 0x27, 0xcd, 0xb0, 0xbc, 0x86, 0x5c, 0xab, 0x3d, 0x5f, 0x0d,
-	0x2c, 0x0a, 0x22, 0xca, 0x40, 0xbc, 0xae, 0xbf, 0x98, 0x71, 0x33, 0xe3, 0xf2, 0x91, 0x43, 0x5c, 0x30, 0x10, 0x87,
-	0xfa, 0xdb, 0xc2, 0x0c, 0x52, 0xd0, 0xcd, 0x31, 0x08, 0x87, 0xea, 0xcb, 0x8c, 0x60, 0x06, 0xcb, 0x90, 0x71, 0x4c,
-	0x46, 0x66, 0xf8, 0x55, 0xc4, 0x5b, 0xcd, 0xd8, 0x21, 0x35, 0x07, 0x83, 0xaf, 0xad, 0x8d, 0x8d, 0x33, 0x8b, 0x07,
-	0x5d, 0x08, 0x43, 0x6f, 0xdf, 0x35, 0x5d, 0x6b, 0x5c, 0xc3, 0x64, 0xa7, 0x3c, 0x04, 0xf7, 0x10, 0x46, 0xbc, 0xe0,
-	0xeb, 0x3e, 0xd5, 0x4e, 0x65, 0xf6, 0x56, 0x30, 0xe5, 0xac, 0x22, 0x19, 0x8e, 0x0d, 0xd6, 0x10, 0xb5, 0xf8, 0x18,
-	0x7c, 0x1a, 0x73, 0x06, 0xb8, 0xab, 0xdd, 0xaa, 0x64, 0x50, 0x56, 0x7f, 0x4f, 0xa5, 0x4e, 0x7d, 0x10, 0x2f, 0x51,
-	0x04, 0x01, 0xa6, 0xc2, 0xc7, 0xc4, 0x8d, 0x64, 0x50, 0x1e, 0xb1, 0xb8, 0x57, 0x1a, 0x4d, 0xa8, 0x30, 0xb8, 0xd7,
-	0xbc, 0x20, 0x83, 0x33, 0x38, 0xa1, 0xea, 0x0e, 0xaa, 0xd4, 0xa9, 0xd5, 0xe4, 0x09, 0x2c, 0x3e, 0x55, 0xd6, 0x11,
-	0xb9, 0x49, 0xde, 0x92, 0x61, 0x5a, 0x6a, 0xb3, 0x4b, 0x63, 0xf5, 0x94, 0x18, 0x52, 0x32, 0x44, 0xcf, 0x94, 0xe4,
-	0xae, 0x40, 0x30, 0xa1, 0x54, 0xcc, 0x39, 0x4b, 0x32, 0x30, 0x9f, 0x29, 0xb9, 0x24, 0x54, 0x72, 0x21, 0x91, 0x63,
-	0x28, 0x3e, 0xd7, 0x10, 0xa6, 0x30, 0x33, 0x58, 0x21, 0x13, 0x64, 0x91, 0x0c, 0xc2, 0x17, 0x64, 0x44, 0xd8, 0x80,
-	0x1b, 0x91, 0x61, 0x77, 0xae, 0x61, 0x16, 0x28, 0x97, 0x91, 0x99, 0x33, 0x06, 0xd8, 0xcf, 0x7a, 0x3c, 0xb5, 0x93,
-	0x9c, 0x8c, 0x97, 0x31, 0xac, 0x7e, 0xf1, 0xae, 0x30, 0x63, 0x38, 0xfd, 0x6a, 0x1c, 0x0c, 0x46, 0xcc, 0x42, 0x3a,
-	0x33, 0x03, 0xe8, 0xc2, 0x06, 0x1b, 0xcc, 0x4c, 0xf3, 0x7e, 0xc6, 0x60, 0xf9, 0x4d, 0xc9, 0x81, 0x2b, 0xe3, 0xcc,
-	0x19, 0x04, 0xa5, 0x93, 0x64, 0xa8, 0xfc, 0x6e, 0xca, 0x28, 0x8e, 0x58, 0x10, 0x54, 0x32, 0x86, 0xca, 0x4b, 0xb2,
-	0x67, 0x28, 0x96, 0x4e, 0x8e, 0xa1, 0xf2, 0x4a, 0xa3, 0x1c, 0xe3, 0x4e, 0x62, 0x3a, 0x1e, 0xc3, 0xe4, 0xb5, 0xce,
-	0x30, 0x58, 0x5a, 0x61, 0x97, 0x74, 0xcb, 0x0c, 0x94, 0x37, 0x0b, 0x23, 0xa6, 0xc4, 0x88, 0x39, 0x83, 0xe5, 0x0f,
-	0x25, 0x09, 0xd9, 0x97, 0x19, 0x27, 0x67, 0xb0, 0xfc, 0x5b, 0x4f, 0x8d, 0xde, 0x0d, 0x55, 0x59, 0xed, 0x66, 0x1e,
-	0x92, 0xe1, 0xf2, 0x56, 0x5b, 0x27, 0xc5, 0x21, 0xa1, 0x0e, 0xba, 0x21, 0x19, 0x2e, 0x97, 0xda, 0xde, 0xb0, 0x48,
-	0x4c, 0x53, 0x80, 0x9a, 0xc8, 0xad, 0x24, 0x43, 0xe6, 0x9d, 0x9e, 0x5c, 0x2a, 0x1f, 0x2b, 0xc8, 0x88, 0x0c, 0x97,
-	0xf7, 0x81, 0xa3, 0x12, 0x00, 0x61, 0x44, 0x4c, 0x9e, 0x33, 0x68, 0x3e, 0xe8, 0x21, 0x71, 0x91, 0x59, 0x42, 0xf7,
-	0xcd, 0xa0, 0xf9, 0xa8, 0x2d, 0x59, 0x28, 0xb9, 0x9c, 0xc8, 0x31, 0x68, 0xfe, 0x34, 0xc9, 0x48, 0xb9, 0x04, 0x41,
-	0x26, 0x67, 0xc8, 0xfc, 0x65, 0x96, 0xa8, 0x06, 0x0c, 0xc9, 0x5e, 0x0a, 0x06, 0xcc, 0x27, 0x9d, 0x23, 0xd4, 0x80,
-	0x09, 0xb1, 0x62, 0xc1, 0x80, 0xb9, 0x02, 0xa2, 0xfe, 0xb9, 0x1a, 0x1d, 0x5f, 0x89, 0x13, 0x4d, 0x3d, 0x24, 0x14,
-	0xe5, 0x39, 0xaf, 0x14, 0x0c, 0xa3, 0x2b, 0x50, 0x72, 0x05, 0x39, 0x06, 0x00, 0xb0, 0x22, 0xa7, 0x05, 0xa9, 0xc8,
-	0x45, 0x72, 0xef, 0x44, 0x84, 0xe4, 0x84, 0x66, 0xa6, 0x34, 0xa7, 0x33, 0xf1, 0x64, 0x37, 0xec, 0xeb, 0x7a, 0x5f,
-	0xf7, 0xfb, 0x49, 0xd3, 0x55, 0xe4, 0x07, 0x78, 0x68, 0x10, 0x82, 0x2a, 0x31, 0x20, 0x27, 0xa4, 0xd3, 0x03, 0x70,
-	0xf9, 0xca, 0x44, 0x86, 0xa2, 0x93, 0x42, 0x31, 0xd6, 0x5d, 0x66, 0x4a, 0x42, 0xc1, 0x20, 0x55, 0x5c, 0xcf, 0xd9,
-	0x01, 0x52, 0x37, 0x52, 0xbd, 0x34, 0xa7, 0xc6, 0x63, 0xe8, 0x6a, 0x7a, 0x34, 0x13, 0xc9, 0x04, 0x48, 0x91, 0x61,
-	0x47, 0x05, 0xc3, 0xf7, 0x4a, 0x2f, 0x3e, 0xd1, 0x29, 0x3b, 0xa1, 0x76, 0x62, 0x08, 0xef, 0x03, 0x43, 0x03, 0xb4,
-	0x24, 0xd4, 0x30, 0x2c, 0x77, 0x28, 0x19, 0x85, 0x0c, 0x63, 0xc3, 0x63, 0x43, 0x53, 0x07, 0x84, 0x1b, 0x14, 0x7d,
-	0x78, 0x59, 0xc2, 0x16, 0xa3, 0x42, 0x51, 0x9d, 0x57, 0x8a, 0x08, 0x2c, 0xf9, 0x85, 0x0d, 0x55, 0x8c, 0x16, 0x4d,
-	0xb3, 0x9e, 0x42, 0x2a, 0xaa, 0x81, 0x78, 0xa8, 0x6f, 0x9a, 0xe0, 0xba, 0xb1, 0xaa, 0x0c, 0xe3, 0xa3, 0xce, 0x06,
-	0xb8, 0x20, 0xa0, 0x7b, 0x12, 0x12, 0x08, 0x99, 0x86, 0x01, 0x7b, 0x63, 0x0a, 0x9e, 0x0a, 0xf3, 0xc5, 0xd2, 0x19,
-	0x98, 0xb5, 0xcb, 0xbf, 0x02, 0x47, 0x15, 0xb9, 0x15, 0x64, 0x00, 0xfe, 0x47, 0xa7, 0x4b, 0xa9, 0x67, 0xc7, 0xfc,
-	0x42, 0x64, 0x19, 0x72, 0x9a, 0x34, 0x27, 0x89, 0xc9, 0x5b, 0x64, 0x76, 0x06, 0x5c, 0xc3, 0x66, 0x77, 0x82, 0x0c,
-	0xb7, 0x93, 0x71, 0x35, 0x15, 0x71, 0x40, 0x30, 0xdd, 0xce, 0x23, 0x06, 0x5b, 0xbb, 0xdc, 0x39, 0x11, 0x64, 0xa0,
-	0x69, 0xaa, 0x99, 0xd9, 0x93, 0x4d, 0x4c, 0x45, 0x19, 0x68, 0xb7, 0x7a, 0x76, 0xa8, 0xf1, 0xb0, 0xf9, 0x98, 0x0b,
-	0x73, 0xca, 0xe1, 0xfc, 0x06, 0x65, 0xf3, 0xc5, 0x1a, 0x18, 0x4c, 0x9a, 0xc7, 0x68, 0x3a, 0x28, 0x16, 0x82, 0x9c,
-	0x3c, 0xea, 0x41, 0xd1, 0xfa, 0xe0, 0x34, 0x60, 0x46, 0xe7, 0xb7, 0x11, 0x03, 0xca, 0xd2, 0xc6, 0x5c, 0xc7, 0x8d,
-	0x24, 0x11, 0x86, 0x27, 0x9f, 0x65, 0x28, 0x6b, 0x1b, 0x84, 0x33, 0x69, 0x4c, 0x93, 0x79, 0x58, 0x06, 0xd5, 0x17,
-	0x2b, 0x8a, 0x39, 0x54, 0x50, 0x41, 0x06, 0xd5, 0x57, 0x5d, 0x39, 0x10, 0xfc, 0x2c, 0xa2, 0x23, 0xc6, 0x0c, 0x29,
-	0xcd, 0x9d, 0x75, 0xdd, 0x88, 0xa8, 0x1c, 0x03, 0xea, 0xce, 0x60, 0x1f, 0x19, 0x8b, 0x2e, 0x66, 0x8f, 0x19, 0x54,
-	0xdf, 0x6d, 0x28, 0x86, 0x8a, 0x47, 0x12, 0xc1, 0x7b, 0x32, 0x26, 0x49, 0x48, 0x36, 0x5d, 0xe2, 0x81, 0x75, 0xce,
-	0x7c, 0x51, 0xcc, 0xf0, 0xba, 0x32, 0x27, 0xe8, 0x18, 0xab, 0x98, 0x4a, 0x94, 0x10, 0x4f, 0x99, 0x08, 0xad, 0xb8,
-	0xb8, 0x67, 0x0e, 0x7a, 0xf0, 0x4c, 0xcd, 0x24, 0x34, 0xfb, 0x47, 0x31, 0x03, 0x50, 0x25, 0xe5, 0xb1, 0x6e, 0x0e,
-	0x55, 0xe0, 0x38, 0x34, 0x54, 0x41, 0x28, 0x42, 0x89, 0xb0, 0x4a, 0x2b, 0x16, 0xad, 0x7a, 0x0e, 0x87, 0xee, 0xab,
-	0xf1, 0xff, 0xc2, 0x04, 0x6a, 0x8a, 0x59, 0x36, 0xb5, 0x46, 0xe0, 0x6c, 0xda, 0x9d, 0xf0, 0xd1, 0xba, 0x20, 0x86,
-	0xc9, 0x0b, 0xed, 0x66, 0xc4, 0x99, 0xcd, 0xf0, 0x48, 0xdc, 0xd4, 0xed, 0xd1, 0x54, 0x18, 0x98, 0x22, 0x06, 0xba,
-	0x21, 0xd0, 0xd4, 0x91, 0x55, 0x61, 0x16, 0xbb, 0xc6, 0x56, 0x95, 0x25, 0xe0, 0x58, 0xc9, 0x24, 0x96, 0x56, 0xd0,
-	0x92, 0xb3, 0x06, 0x33, 0xda, 0x9d, 0x39, 0x25, 0x15, 0xb9, 0xf2, 0x20, 0x52, 0xae, 0x23, 0x4e, 0xac, 0xaf, 0x9b,
-	0xae, 0xaf, 0xb5, 0xb4, 0xea, 0x77, 0x45, 0x90, 0xd0, 0xb3, 0x90, 0x30, 0xf6, 0x88, 0x53, 0xec, 0xa1, 0x72, 0xab,
-	0x41, 0x06, 0x96, 0xe1, 0x39, 0x2c, 0x74, 0x74, 0x29, 0xe2, 0x4c, 0x7b, 0x3f, 0xf5, 0x7d, 0xd5, 0xee, 0xef, 0x6c,
-	0xa2, 0x42, 0x1b, 0xc1, 0x59, 0x5e, 0x60, 0x24, 0x69, 0x85, 0xfb, 0x9a, 0x1a, 0x43, 0xad, 0x3a, 0x78, 0x9a, 0xa4,
-	0x27, 0xba, 0xd4, 0x15, 0x84, 0xc8, 0x44, 0x9c, 0x80, 0xdb, 0x16, 0xd0, 0xec, 0x90, 0x11, 0xa0, 0xad, 0x9a, 0x21,
-	0x45, 0x4a, 0xd5, 0x18, 0xea, 0xc7, 0xa9, 0x06, 0x95, 0x53, 0xe7, 0x18, 0x06, 0x88, 0xe2, 0x9e, 0xc0, 0xed, 0xd3,
-	0xd4, 0x1a, 0x81, 0x73, 0x73, 0xd4, 0x52, 0x2b, 0x24, 0xb3, 0x09, 0x54, 0x13, 0x50, 0xe5, 0x88, 0x1a, 0xaf, 0x3f,
-	0x56, 0x8d, 0x78, 0xb4, 0xd4, 0x7a, 0x18, 0x69, 0x4e, 0x8f, 0xbb, 0x40, 0x1d, 0x38, 0xfa, 0x85, 0x2d, 0x97, 0x39,
-	0xcb, 0x73, 0xea, 0x7e, 0xdd, 0x78, 0x25, 0x19, 0x8e, 0x55, 0x7b, 0xb0, 0xfc, 0x08, 0x8b, 0x0a, 0x86, 0xaf, 0x04,
-	0xe0, 0xe7, 0x7e, 0x48, 0xc4, 0xd9, 0xf9, 0xa1, 0x3c, 0x1e, 0xcd, 0xb1, 0x11, 0xa7, 0x45, 0xe0, 0x45, 0x4e, 0x78,
-	0x72, 0xc4, 0x59, 0xba, 0x56, 0xb0, 0x5d, 0x39, 0x15, 0x1f, 0x4a, 0x27, 0x23, 0x3a, 0x9c, 0xaf, 0xeb, 0xae, 0x0b,
-	0x06, 0x55, 0xd5, 0x57, 0xa6, 0xfb, 0x02, 0xec, 0x1d, 0xad, 0x94, 0x82, 0xbf, 0x27, 0xb6, 0x37, 0x17, 0x71, 0x56,
-	0x7e, 0x5b, 0xf6, 0xe5, 0xb1, 0x2f, 0x6f, 0xf5, 0x8e, 0xa4, 0x9e, 0x4b, 0x9d, 0x9b, 0xdc, 0x5c, 0x3c, 0x7f, 0x4d,
-	0x00, 0x9f, 0x45, 0x0f, 0x0e, 0xce, 0x78, 0x00, 0x85, 0x1c, 0x87, 0x5d, 0x24, 0xa3, 0x70, 0x5f, 0x97, 0x51, 0xe1,
-	0x77, 0x55, 0x0e, 0x26, 0xb5, 0xa4, 0xa9, 0xce, 0xa9, 0x29, 0x94, 0xf2, 0xc8, 0xb6, 0xe9, 0x22, 0xce, 0xdc, 0xad,
-	0x73, 0xce, 0x7a, 0x89, 0x51, 0x13, 0x10, 0xcc, 0x44, 0xed, 0x3e, 0xca, 0x07, 0x6a, 0x34, 0x01, 0xea, 0x0e, 0x9f,
-	0x3a, 0xf4, 0xcc, 0x4e, 0xcd, 0x59, 0xfd, 0xec, 0xd4, 0x4e, 0x31, 0x8b, 0x94, 0x57, 0xa7, 0x19, 0x71, 0x33, 0x4e,
-	0xf2, 0xab, 0xa6, 0xa9, 0x6f, 0x87, 0x5a, 0x57, 0x4a, 0xdb, 0x97, 0x82, 0xb1, 0xa3, 0x39, 0x19, 0x70, 0xba, 0x0f,
-	0x70, 0x8d, 0x37, 0xdd, 0x34, 0xf7, 0x2c, 0xb1, 0x87, 0x8a, 0x5a, 0x59, 0x4a, 0xba, 0x59, 0x11, 0xe7, 0xf4, 0xb6,
-	0xa5, 0xe0, 0x72, 0x6d, 0x68, 0x28, 0x99, 0x08, 0x0b, 0x92, 0x6b, 0x39, 0x45, 0x07, 0x7c, 0x4d, 0x6b, 0x29, 0xce,
-	0xb0, 0x04, 0xc0, 0x79, 0x05, 0xbd, 0x76, 0xce, 0x83, 0x2b, 0x6e, 0xbe, 0x9f, 0x46, 0x63, 0xee, 0x48, 0xcb, 0x4b,
-	0x18, 0x9f, 0xc8, 0x33, 0x94, 0x34, 0x8d, 0xbf, 0x6e, 0x2a, 0x5d, 0x57, 0x63, 0xac, 0xbd, 0x39, 0x86, 0x05, 0xd8,
-	0x5b, 0xd8, 0x6c, 0xc5, 0x69, 0x39, 0x29, 0x33, 0x40, 0x95, 0x31, 0x47, 0x29, 0xc2, 0x96, 0xcc, 0x9b, 0x67, 0xd8,
-	0x9c, 0xca, 0x7d, 0x6f, 0xbb, 0x29, 0xd8, 0xda, 0xc5, 0x72, 0x91, 0xe8, 0x66, 0xb5, 0x51, 0xe0, 0xd4, 0xbc, 0xaf,
-	0xec, 0xae, 0x21, 0x65, 0xa6, 0x32, 0xd7, 0x4d, 0xb2, 0x64, 0xde, 0x05, 0x0f, 0xbb, 0x6e, 0x2c, 0xf7, 0x73, 0x59,
-	0x4a, 0x20, 0x7a, 0xd2, 0x22, 0xd7, 0x0b, 0x4b, 0x0c, 0xdd, 0x8c, 0x57, 0x4c, 0xbd, 0x86, 0x70, 0xb3, 0xc8, 0xc7,
-	0x58, 0xf4, 0x40, 0x45, 0x15, 0x72, 0xa7, 0xc2, 0x02, 0xae, 0xb7, 0x55, 0x2c, 0x01, 0x97, 0xc4, 0x5e, 0x96, 0xc0,
-	0x4a, 0x96, 0xcd, 0xe2, 0x0c, 0xbb, 0x7d, 0x75, 0x00, 0x9f, 0x2c, 0x4d, 0xce, 0x03, 0x66, 0x85, 0x4d, 0xd5, 0x44,
-	0xe6, 0xf6, 0x06, 0x20, 0xe6, 0xb4, 0xfa, 0x66, 0x6a, 0x8f, 0x65, 0x3f, 0x9d, 0x9a, 0x72, 0x32, 0xae, 0x8f, 0x14,
-	0x27, 0xc7, 0xd6, 0x05, 0xc1, 0x30, 0xe6, 0x24, 0xbb, 0x3b, 0x76, 0x6d, 0x65, 0x5a, 0xce, 0x29, 0x32, 0x12, 0x30,
-	0x4f, 0x22, 0x33, 0x37, 0x0d, 0x83, 0x63, 0x5f, 0x5a, 0x34, 0xe2, 0xc4, 0x5a, 0x09, 0x7d, 0x2a, 0xb3, 0xf2, 0x3c,
-	0x46, 0x4e, 0x73, 0xda, 0x4c, 0x74, 0x17, 0x19, 0x0f, 0x21, 0x73, 0xd6, 0x8c, 0x39, 0x81, 0x39, 0xd3, 0x0d, 0xa4,
-	0x5d, 0xac, 0x4f, 0xc4, 0xe4, 0x88, 0x1d, 0xc7, 0x6c, 0x29, 0x5d, 0x7f, 0xb8, 0xae, 0x4e, 0xf5, 0xdc, 0x89, 0xc4,
-	0xf8, 0x44, 0x77, 0x13, 0x31, 0xc9, 0xb2, 0x31, 0xbf, 0x51, 0x79, 0xe9, 0xce, 0xb9, 0xeb, 0x4e, 0x4c, 0xcc, 0x2f,
-	0x56, 0xde, 0x38, 0xe9, 0x34, 0x27, 0x9d, 0x89, 0xd4, 0xca, 0xb3, 0x10, 0x7a, 0x63, 0xfa, 0x5f, 0x52, 0xad, 0x3e,
-	0xa2, 0x23, 0x8b, 0xd5, 0xea, 0x4f, 0xc0, 0xbb, 0xa6, 0x66, 0xb5, 0x7c, 0xec, 0xbb, 0xcc, 0xcb, 0xe7, 0x37, 0x0b,
-	0xa5, 0x75, 0xed, 0xb9, 0xfd, 0x3b, 0x53, 0xf8, 0x98, 0xb7, 0xf0, 0x0f, 0x58, 0xa5, 0x87, 0x81, 0x1d, 0xb8, 0x66,
-	0x82, 0x8a, 0x85, 0x62, 0x79, 0x36, 0x72, 0x9b, 0xd5, 0xd2, 0x79, 0xe6, 0x0a, 0x62, 0xbc, 0x6a, 0xb2, 0x3b, 0x69,
-	0xd5, 0xb4, 0x49, 0x95, 0xf3, 0xa7, 0xd2, 0x22, 0xcb, 0x5b, 0xed, 0x9d, 0xdd, 0xa6, 0x5e, 0xb9, 0xa4, 0x2b, 0xe7,
-	0xcd, 0x76, 0xa8, 0x83, 0x27, 0xc8, 0x91, 0x57, 0x8d, 0x89, 0xb0, 0xd8, 0x1c, 0x99, 0x0a, 0xb7, 0x9e, 0x1d, 0x53,
-	0xb9, 0x58, 0xc4, 0xe4, 0xdc, 0xde, 0xcb, 0xac, 0xe7, 0x73, 0xf9, 0xca, 0x65, 0xbb, 0xf9, 0x18, 0x4d, 0x02, 0x85,
-	0x8b, 0x97, 0x2e, 0xad, 0x48, 0x6b, 0xfb, 0xdc, 0x2f, 0x3e, 0xad, 0xc2, 0xd1, 0x1c, 0x79, 0x32, 0xb9, 0x31, 0x49,
-	0xe5, 0xa2, 0x6b, 0x6e, 0x18, 0x90, 0xe0, 0xe2, 0xe2, 0x7f, 0x2d, 0xb6, 0xec, 0x9a, 0x48, 0xde, 0x3d, 0x1f, 0xea,
-	0x2f, 0xb5, 0x4d, 0xbe, 0x40, 0xa0, 0xb0, 0x21, 0x86, 0x0e, 0x17, 0x86, 0x9e, 0xf1, 0x9d, 0x89, 0xc8, 0xe0, 0xd6,
-	0xf7, 0xb9, 0xf4, 0x19, 0x2b, 0x07, 0x73, 0x97, 0x3a, 0xcb, 0x3d, 0xe3, 0x97, 0x6e, 0x7c, 0xf9, 0x00, 0x08, 0xde,
-	0xb3, 0x09, 0x68, 0x63, 0xcf, 0x3b, 0xc7, 0x9d, 0x9b, 0x63, 0x71, 0x9e, 0xf3, 0xce, 0x32, 0xa8, 0x7b, 0x32, 0x52,
-	0x11, 0xf0, 0x08, 0x8c, 0xce, 0xbc, 0x38, 0x03, 0xaf, 0x91, 0x5b, 0xae, 0x6d, 0x76, 0x29, 0x52, 0x0a, 0x57, 0xfb,
-	0xe9, 0xdd, 0xc1, 0xc6, 0xed, 0x24, 0x0f, 0x7d, 0xdb, 0x67, 0x68, 0x93, 0xcd, 0x7b, 0x9d, 0x96, 0x64, 0x77, 0x65,
-	0xe1, 0xa2, 0x58, 0xb6, 0xb5, 0x56, 0x73, 0x50, 0xc4, 0xa9, 0x75, 0x3d, 0xf2, 0x13, 0x99, 0x40, 0x39, 0xb8, 0x9a,
-	0x80, 0x1c, 0xc1, 0xb9, 0xc2, 0xf9, 0xb2, 0x72, 0xda, 0x6b, 0x02, 0xef, 0x0e, 0x5e, 0x40, 0xf1, 0x37, 0xf7, 0x23,
-	0xeb, 0xbb, 0x07, 0x2e, 0xcc, 0x91, 0x8b, 0x84, 0x39, 0x33, 0x27, 0xd8, 0x27, 0xf4, 0xc1, 0xb0, 0x9f, 0x5f, 0x17,
-	0x98, 0x2e, 0x82, 0x6a, 0x92, 0x4b, 0xc2, 0xba, 0x57, 0x9b, 0x20, 0x9c, 0xc4, 0x6d, 0x21, 0xcc, 0x3d, 0xe3, 0xff,
-	0x6f, 0x41, 0x5d, 0xce, 0x5e, 0x41, 0xfa, 0x90, 0x33, 0x4f, 0xe0, 0xd2, 0xaf, 0xf9, 0x9e, 0x73, 0xbd, 0xe3, 0xc5,
-	0x75, 0x00, 0x57, 0x6a, 0x1c, 0xca, 0x3a, 0x4f, 0x26, 0x85, 0xdf, 0xed, 0x4a, 0xc7, 0x22, 0xe9, 0x82, 0x7c, 0x80,
-	0xbd, 0x5b, 0x2d, 0xc8, 0x86, 0x0f, 0xed, 0xd4, 0x73, 0xad, 0xe7, 0x64, 0x45, 0xee, 0xaa, 0xc7, 0xeb, 0x76, 0xa5,
-	0x23, 0x91, 0x36, 0x71, 0x50, 0x0e, 0xb9, 0x76, 0xba, 0x05, 0xc5, 0xfb, 0xb1, 0xd7, 0x0d, 0x0e, 0x32, 0xdb, 0x00,
-	0xdb, 0x82, 0x6c, 0xa0, 0x64, 0x4d, 0xa5, 0x0b, 0xec, 0xb6, 0x6c, 0xa5, 0x8b, 0x9a, 0x23, 0xb0, 0x95, 0xf7, 0x9a,
-	0xee, 0x7b, 0xd5, 0x1e, 0xed, 0xf9, 0x49, 0x98, 0x3e, 0x53, 0x96, 0x7a, 0xbc, 0xf3, 0x2d, 0xa1, 0x68, 0xea, 0xd2,
-	0x45, 0xe0, 0x4b, 0x22, 0x8f, 0xf0, 0x2f, 0x1c, 0x2e, 0x34, 0xbf, 0x86, 0x4b, 0xf8, 0x03, 0x60, 0x62, 0xd9, 0x6e,
-	0x6e, 0xe7, 0x6d, 0x64, 0xbb, 0x92, 0xe9, 0xc8, 0x07, 0x64, 0xc8, 0x33, 0x12, 0x68, 0xa6, 0x9c, 0x24, 0xfe, 0x40,
-	0xeb, 0xdd, 0xc6, 0xe7, 0xfe, 0xa6, 0x17, 0xb3, 0x3d, 0xc5, 0x0c, 0xe3, 0x52, 0x61, 0x46, 0xdb, 0xf3, 0x5c, 0xe3,
-	0xd3, 0xd2, 0x8b, 0xe6, 0xab, 0x18, 0xaf, 0x17, 0xbd, 0xbb, 0xe9, 0x7a, 0xb3, 0x1c, 0xd5, 0x1b, 0x8e, 0x37, 0x42,
-	0xf2, 0x0d, 0xd9, 0xa9, 0x8d, 0x00, 0xb9, 0xb1, 0xd7, 0xb7, 0xce, 0x81, 0x34, 0xc8, 0x72, 0x23, 0x5c, 0x2e, 0x9d,
-	0x30, 0xb9, 0x5e, 0xf3, 0x8a, 0x1f, 0x88, 0xf7, 0x6b, 0x60, 0x73, 0xd8, 0xa2, 0x97, 0x78, 0xbd, 0xa7, 0x27, 0x34,
-	0x5a, 0x34, 0x7c, 0x6b, 0x9f, 0xe6, 0x0c, 0x47, 0xda, 0xc0, 0xde, 0x0c, 0xa7, 0xde, 0x5d, 0x0c, 0x93, 0x6a, 0x74,
-	0x98, 0x6e, 0x0a, 0xe4, 0x1f, 0xbc, 0xa2, 0x42, 0x9e, 0x3f, 0x1f, 0x9a, 0x57, 0x06, 0x75, 0x69, 0x8b, 0xdc, 0x7b,
-	0xfa, 0xc9, 0x8b, 0x13, 0x27, 0xbc, 0xc5, 0x27, 0xec, 0xb8, 0xe0, 0xce, 0x5e, 0x60, 0x7b, 0x85, 0x4f, 0x53, 0x33,
-	0xd6, 0xb7, 0xcd, 0x9d, 0xb1, 0x8f, 0x7a, 0xa7, 0x83, 0x77, 0x71, 0xa9, 0x6f, 0xc3, 0x13, 0xc9, 0x0d, 0xd6, 0x3e,
-	0x1b, 0xd9, 0xe1, 0x1d, 0x29, 0x2f, 0xf6, 0x46, 0xd4, 0x1b, 0xee, 0xb7, 0x65, 0x3f, 0xd6, 0x65, 0x73, 0xa8, 0xaf,
-	0xf5, 0xad, 0x50, 0x01, 0x70, 0xe1, 0xfd, 0x2d, 0x1c, 0xad, 0xb2, 0xd8, 0xb3, 0x9e, 0xbb, 0x45, 0xc9, 0x5e, 0x92,
-	0xa8, 0xc4, 0x57, 0x96, 0x08, 0xb9, 0x9e, 0xaf, 0xa7, 0xbd, 0x26, 0xaa, 0x79, 0x3a, 0x51, 0x87, 0x8f, 0x6c, 0x23,
-	0x31, 0x9c, 0xf3, 0xd6, 0xc3, 0x9c, 0xd2, 0xbd, 0x5c, 0x73, 0xb1, 0x0b, 0xf2, 0x56, 0xcc, 0xbb, 0x87, 0x6a, 0xa1,
-	0x41, 0xae, 0xda, 0xbc, 0x1a, 0xfb, 0xf5, 0x91, 0x22, 0xdd, 0x40, 0xae, 0x25, 0x64, 0x2b, 0x37, 0x65, 0xd8, 0x7f,
-	0xa0, 0xa0, 0x09, 0xc2, 0xdc, 0x10, 0xd2, 0x36, 0xc8, 0x9a, 0x18, 0x38, 0xb7, 0x70, 0x08, 0xf8, 0xfc, 0xe2, 0x82,
-	0xd7, 0xa3, 0x74, 0x23, 0x3f, 0xe0, 0xab, 0x33, 0x38, 0x76, 0x9b, 0xa7, 0x67, 0x99, 0xc4, 0x0c, 0x84, 0x15, 0x49,
-	0x44, 0x9e, 0xb5, 0x5c, 0xf5, 0xdd, 0xe7, 0xaa, 0x9d, 0x6f, 0x32, 0xd4, 0x63, 0xb8, 0x0c, 0xdf, 0x00, 0x15, 0xaa,
-	0xcc, 0xdc, 0x9f, 0xcc, 0xab, 0x63, 0x3d, 0xb8, 0xa6, 0xe6, 0x43, 0x68, 0xd9, 0x2f, 0x2e, 0x2c, 0x6d, 0xc8, 0x6f,
-	0x05, 0xe6, 0xc5, 0x32, 0x9f, 0xff, 0xf8, 0xc4, 0x38, 0x4c, 0x50, 0x2a, 0xdd, 0xd3, 0x1e, 0xf5, 0x0e, 0x10, 0x36,
-	0x80, 0xed, 0x6f, 0x1f, 0xf1, 0x20, 0x1d, 0x38, 0xe7, 0xa1, 0x9e, 0xf5, 0xf4, 0x0e, 0x03, 0x52, 0xbe, 0x3c, 0x6b,
-	0xe9, 0xa8, 0x3b, 0x44, 0x3f, 0x76, 0x87, 0x4f, 0xe4, 0xa8, 0x15, 0xff, 0xa8, 0x5e, 0x7c, 0x22, 0x05, 0x20, 0xfe,
-	0x11, 0x83, 0x30, 0xcf, 0xa3, 0xdc, 0x9b, 0x2a, 0xd5, 0xfb, 0xc0, 0x8c, 0x22, 0x0b, 0x9f, 0x59, 0x46, 0xd3, 0x7f,
-	0xf9, 0x21, 0xa3, 0x7f, 0x4e, 0xab, 0xb4, 0xa2, 0x26, 0x58, 0xa5, 0xb7, 0xa8, 0x49, 0xb3, 0x22, 0x34, 0xe6, 0x55,
-	0xf2, 0xe2, 0xb6, 0x77, 0x55, 0x64, 0xdc, 0x8e, 0xed, 0x35, 0xa6, 0xca, 0x89, 0x61, 0xe2, 0xc9, 0x0d, 0xe4, 0xdc,
-	0x93, 0x9b, 0x83, 0xd5, 0xe2, 0x16, 0x7e, 0x55, 0x24, 0x69, 0x9f, 0x2d, 0x34, 0x1a, 0x8b, 0x17, 0x29, 0xab, 0x22,
-	0x43, 0x0e, 0xae, 0x85, 0x71, 0x07, 0x7f, 0x45, 0x5a, 0xe6, 0xe8, 0xb9, 0x82, 0x79, 0x1b, 0x0d, 0xce, 0x31, 0x69,
-	0x62, 0xf3, 0x89, 0x7f, 0x5f, 0x24, 0x36, 0xcd, 0x3f, 0xbd, 0xc2, 0x35, 0x3d, 0x13, 0x66, 0xe6, 0x4c, 0x48, 0x2f,
-	0xfa, 0x57, 0xa5, 0x7a, 0x4d, 0xfe, 0xb7, 0x4a, 0x75, 0x47, 0xc4, 0x1f, 0x90, 0x65, 0x4b, 0x12, 0x29, 0xf2, 0x01,
-	0x91, 0x32, 0x90, 0x48, 0xb1, 0x97, 0xdf, 0x1b, 0xc3, 0xd7, 0xeb, 0xb6, 0x93, 0x40, 0xb6, 0x14, 0xf9, 0x36, 0xcb,
-	0x6b, 0x1d, 0xdd, 0xb1, 0xc7, 0xa7, 0xdf, 0x3b, 0xb4, 0x1e, 0x74, 0x2a, 0x7f, 0x51, 0x35, 0xa3, 0x39, 0x8c, 0xd8,
-	0x57, 0xad, 0xb9, 0x97, 0x5d, 0x59, 0x8e, 0xba, 0x78, 0x6b, 0xe0, 0x0f, 0x94, 0xaf, 0x1d, 0xe3, 0x62, 0x51, 0x10,
-	0xe3, 0x59, 0x93, 0xbe, 0x5a, 0x5c, 0xed, 0x79, 0x69, 0x23, 0xb2, 0x63, 0x9f, 0x55, 0x4f, 0xfa, 0x99, 0x40, 0x5a,
-	0xe8, 0x25, 0x6d, 0xb6, 0x14, 0x6a, 0xc2, 0xf4, 0xe6, 0x67, 0x1d, 0xde, 0xbc, 0xb9, 0xee, 0xcb, 0x69, 0x9f, 0xc8,
-	0xb7, 0x40, 0x3e, 0x27, 0x2e, 0x1d, 0x0b, 0x13, 0xee, 0xd9, 0x06, 0x9d, 0x3f, 0xb8, 0xb6, 0x85, 0xa1, 0xd0, 0xf8,
-	0x30, 0xc1, 0x6f, 0x55, 0xe4, 0xb8, 0x90, 0x40, 0x7b, 0x48, 0xa4, 0x83, 0xad, 0xd9, 0x12, 0x9f, 0x3d, 0x6c, 0x2c,
-	0xea, 0x92, 0xe6, 0x46, 0x31, 0xe7, 0x46, 0xf2, 0x6e, 0x6e, 0x9d, 0x1b, 0xe7, 0x2c, 0xa7, 0x2c, 0x95, 0x25, 0x1b,
-	0xb4, 0xfe, 0x77, 0x9e, 0x48, 0x63, 0xd3, 0x4c, 0x59, 0x3c, 0x71, 0xe4, 0x5a, 0x2f, 0xc9, 0x1d, 0x92, 0xed, 0xae,
-	0x7b, 0xfd, 0x74, 0xec, 0xcb, 0x43, 0x75, 0x2a, 0x7b, 0x93, 0x47, 0xa5, 0xf2, 0x24, 0xfc, 0xf4, 0x88, 0x77, 0xf8,
-	0x6a, 0x59, 0xb3, 0x1f, 0x42, 0xca, 0x2e, 0x98, 0x7b, 0x6c, 0x52, 0x9b, 0x0b, 0x5a, 0x56, 0x95, 0xf4, 0xd6, 0x21,
-	0xec, 0xa5, 0xb3, 0xa7, 0xda, 0x6c, 0x26, 0x32, 0xff, 0xd2, 0xc1, 0x81, 0x6e, 0xca, 0x46, 0xd3, 0x6e, 0xfb, 0x2a,
-	0x21, 0xda, 0xf0, 0x54, 0xec, 0xdc, 0xf3, 0xa2, 0x8a, 0x2f, 0xce, 0x7d, 0x45, 0xb5, 0xe3, 0x89, 0xc5, 0x3d, 0x33,
-	0xf2, 0xd2, 0xe8, 0x96, 0x5c, 0xc6, 0xd9, 0x27, 0x9f, 0xde, 0x2e, 0xca, 0xfb, 0xf5, 0x0d, 0x93, 0x49, 0x46, 0x79,
-	0xb8, 0x91, 0xae, 0xcf, 0xc9, 0x49, 0xf5, 0x87, 0x1c, 0xa8, 0x22, 0xf6, 0xcf, 0x1f, 0x90, 0xac, 0x8f, 0x8e, 0xf2,
-	0xd1, 0x57, 0x6a, 0xfe, 0xf0, 0x6f, 0x6d, 0x98, 0xe9, 0x0d, 0x24, 0xe6, 0x75, 0x48, 0xb6, 0x15, 0x66, 0x33, 0xc8,
-	0xf6, 0xf0, 0x9c, 0x6f, 0xd0, 0xa1, 0x4b, 0x1e, 0x36, 0x62, 0x6e, 0xa8, 0x6c, 0x44, 0xe6, 0x9b, 0x75, 0x5a, 0xd2,
-	0x59, 0x32, 0x2b, 0x36, 0x4c, 0x7b, 0x80, 0x32, 0x6e, 0x3e, 0x93, 0x80, 0x4f, 0x27, 0x62, 0xbc, 0x38, 0xc2, 0x4b,
-	0x6b, 0x5f, 0x1e, 0xee, 0x48, 0x28, 0x10, 0xef, 0xf0, 0xed, 0xfc, 0x39, 0x49, 0x17, 0x96, 0x4f, 0x6f, 0xec, 0x7c,
-	0x22, 0xa3, 0x93, 0x73, 0xbd, 0x6f, 0x74, 0x88, 0xfd, 0x7a, 0x6f, 0xbc, 0x5b, 0xaa, 0x8f, 0xc7, 0xe0, 0x05, 0x12,
-	0xec, 0xd6, 0x77, 0x2e, 0x7e, 0x41, 0xa2, 0xcd, 0x12, 0x47, 0xef, 0x62, 0x7a, 0x0e, 0x43, 0x6a, 0x68, 0xe0, 0xe2,
-	0xd1, 0xdb, 0xea, 0xd0, 0xe4, 0xe2, 0x81, 0x1c, 0x9a, 0x7c, 0x0d, 0xa1, 0xce, 0x49, 0x67, 0x0f, 0xe8, 0x42, 0xbe,
-	0x5d, 0x25, 0x54, 0xeb, 0x19, 0xd1, 0x46, 0xda, 0x78, 0xc9, 0xb5, 0x20, 0xd3, 0x68, 0xad, 0x64, 0x8b, 0x3c, 0xba,
-	0xa5, 0x69, 0x32, 0x08, 0x49, 0xd5, 0xbb, 0x8f, 0x33, 0x52, 0xdd, 0x76, 0x85, 0xa9, 0x6e, 0xc9, 0x46, 0x92, 0x3f,
-	0x9b, 0x1b, 0x38, 0x33, 0xd3, 0xf4, 0xb6, 0x8f, 0xdf, 0x10, 0x23, 0xd9, 0xbe, 0xd6, 0xc6, 0x5a, 0xbe, 0xaf, 0x12,
-	0xbc, 0x61, 0x9b, 0xbe, 0xf4, 0x7e, 0x4e, 0xba, 0x9d, 0x73, 0x7a, 0xf1, 0x1e, 0x73, 0xef, 0xa1, 0xa6, 0x8b, 0x67,
-	0xee, 0x5c, 0xe1, 0xf3, 0xca, 0xfa, 0x89, 0xb1, 0x3e, 0x7d, 0x64, 0xba, 0x62, 0x2f, 0xf3, 0xe1, 0x18, 0x6f, 0xd9,
-	0xd4, 0x27, 0xa7, 0x20, 0x6b, 0xcf, 0x77, 0xde, 0xab, 0x55, 0xdd, 0xd7, 0xfe, 0xd0, 0x65, 0xca, 0xb3, 0x8f, 0x96,
-	0x1c, 0x57, 0x72, 0xd3, 0x16, 0xf5, 0x76, 0x3a, 0xc7, 0xd5, 0xb5, 0x48, 0x64, 0x2e, 0x09, 0x16, 0x2f, 0x35, 0xd7,
-	0x5d, 0xe7, 0x23, 0xc6, 0x67, 0xdb, 0x19, 0x25, 0x08, 0x4d, 0x7c, 0x1f, 0x8c, 0xce, 0x9a, 0xfa, 0x76, 0xd2, 0x2d,
-	0x89, 0x1e, 0xc9, 0x31, 0x3e, 0xf8, 0xa6, 0xa5, 0x86, 0xcd, 0x1b, 0x1b, 0xf5, 0x1c, 0x16, 0xe4, 0xca, 0x22, 0x84,
-	0xe7, 0x2e, 0xd5, 0x97, 0xd4, 0x42, 0x7a, 0x16, 0x75, 0x5c, 0xa5, 0x02, 0x52, 0x29, 0xb2, 0xc8, 0x57, 0x89, 0xcc,
-	0x19, 0xb5, 0x48, 0xd4, 0x73, 0x73, 0xb9, 0xd5, 0x01, 0xfd, 0xbe, 0xb8, 0xe1, 0x31, 0xce, 0xe1, 0x83, 0xa3, 0x5d,
-	0xc1, 0x91, 0xdb, 0x34, 0xb0, 0x91, 0x99, 0xc0, 0x6d, 0x17, 0xbc, 0x1b, 0xdf, 0xda, 0x28, 0xde, 0x1d, 0xa5, 0xfe,
-	0x7c, 0x5f, 0x73, 0x36, 0x23, 0x32, 0xe1, 0xaf, 0xa5, 0xe7, 0x93, 0xf9, 0x88, 0x1d, 0xf9, 0xa4, 0xe9, 0x79, 0x7b,
-	0x20, 0x1f, 0x52, 0x55, 0x3f, 0x93, 0x8f, 0x5a, 0x3f, 0x7e, 0xf4, 0x5f, 0xd9, 0xc4, 0x6e, 0x35 };
@@ -1,223 +0,0 @@
-// courier_oblique.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_COURIER_OBLIQUE[] = { 0x78, 0x9c, 0xbd, 0x5b, 0x59, 0x73, 0xdc, 0x36, 0x12, 0x7e, 0x77, 0x95,
-	0xff, 0x03, 0x1f, 0x77, 0xab, 0x56, 0x29, 0x1e, 0x00, 0x48, 0x26, 0x4f, 0xb2, 0xad, 0x24, 0xda, 0xf8, 0xc8, 0x5a,
-	0x96, 0x9d, 0xf8, 0x8d, 0x9a, 0x81, 0x46, 0x5c, 0x73, 0x48, 0x85, 0x87, 0x6d, 0xf9, 0xd7, 0x6f, 0xe3, 0x22, 0x9a,
-	0xcd, 0x01, 0xe5, 0xbc, 0x6c, 0xb9, 0xac, 0xd2, 0xd1, 0x8d, 0xa3, 0xbf, 0x3e, 0x3e, 0x34, 0x30, 0x57, 0x63, 0xd5,
-	0x8f, 0x3f, 0x77, 0xed, 0xf8, 0x4a, 0x8e, 0x7d, 0xbd, 0x1b, 0x22, 0xf6, 0x43, 0xf2, 0xf4, 0xc9, 0xf3, 0xee, 0x78,
-	0x94, 0xed, 0x18, 0x3d, 0xef, 0xee, 0x1f, 0xfa, 0xfa, 0x70, 0x37, 0x46, 0xff, 0xd8, 0xfd, 0x33, 0x4a, 0xca, 0xa2,
-	0xfc, 0x17, 0x7c, 0x2d, 0x63, 0xfd, 0x35, 0xd1, 0x5f, 0x53, 0xfd, 0x35, 0xd3, 0x5f, 0xf3, 0xe8, 0x7c, 0xdf, 0xdd,
-	0xc8, 0xe8, 0xea, 0x61, 0x18, 0xe5, 0x71, 0x88, 0x2e, 0xdb, 0x5d, 0xd7, 0xdf, 0x77, 0x7d, 0x35, 0xca, 0xfd, 0x0f,
-	0x51, 0x74, 0xde, 0x34, 0xd1, 0x5b, 0x35, 0xda, 0x10, 0xbd, 0x95, 0x83, 0xec, 0x3f, 0xc3, 0x6f, 0xd1, 0x5c, 0xbd,
-	0xac, 0xc6, 0xba, 0x6b, 0xa3, 0x17, 0x20, 0xfe, 0x63, 0xf4, 0xee, 0x6e, 0x8a, 0x5e, 0x55, 0x0f, 0x51, 0x94, 0x44,
-	0x49, 0xfe, 0x63, 0x96, 0xff, 0xc8, 0x53, 0x3d, 0x85, 0x57, 0xb8, 0x6e, 0xeb, 0xbf, 0x26, 0x79, 0xf9, 0x22, 0x62,
-	0x59, 0xcc, 0xd1, 0xa2, 0xdf, 0xbf, 0x9a, 0x86, 0xea, 0x20, 0xa3, 0x44, 0xa4, 0xac, 0x88, 0x72, 0x5e, 0xa4, 0xe5,
-	0xd3, 0x27, 0x6a, 0x8b, 0xaf, 0xab, 0xa3, 0x84, 0x2d, 0x4d, 0x7d, 0x2d, 0xfb, 0xb3, 0x37, 0x37, 0x8d, 0x52, 0x87,
-	0xbf, 0x4c, 0x4d, 0x83, 0xff, 0x12, 0xf9, 0xbf, 0x54, 0xc7, 0xba, 0x79, 0xc0, 0x7f, 0x7b, 0xfa, 0xe4, 0x83, 0xd4,
-	0xe6, 0x78, 0x25, 0xf7, 0xf5, 0x74, 0x7c, 0xfa, 0xe4, 0x72, 0xac, 0x9a, 0x7a, 0x77, 0xde, 0x1e, 0x1a, 0x19, 0x9d,
-	0x25, 0x29, 0xfc, 0x62, 0xf8, 0xb9, 0xfe, 0x2a, 0xf7, 0xbf, 0xd7, 0xe3, 0xee, 0x2e, 0x1a, 0x7b, 0x35, 0xcc, 0xf3,
-	0xbb, 0xaa, 0xaf, 0x76, 0xa3, 0xec, 0xaf, 0xe4, 0x18, 0x5d, 0x7c, 0x1d, 0x65, 0xbb, 0x97, 0xfb, 0xb7, 0xdd, 0xb1,
-	0x6a, 0xcd, 0xb2, 0x9e, 0x3d, 0xeb, 0xbe, 0x46, 0x67, 0x69, 0x0e, 0xff, 0x79, 0x1c, 0x15, 0xac, 0x8c, 0x8a, 0x98,
-	0x47, 0x4f, 0x9f, 0x5c, 0x83, 0x5c, 0xdf, 0xd4, 0xad, 0xfc, 0xbd, 0x1b, 0x6a, 0x6d, 0x99, 0xb3, 0x24, 0x8e, 0xd1,
-	0xef, 0xdf, 0xdd, 0xd5, 0xbb, 0x4f, 0xad, 0x1c, 0x86, 0x88, 0xc3, 0xaf, 0xdf, 0xcb, 0x7e, 0x50, 0x42, 0x71, 0x9c,
-	0xfd, 0x10, 0x2b, 0xb9, 0xd7, 0xdd, 0x58, 0xef, 0xe4, 0xff, 0x05, 0xc3, 0x0b, 0x10, 0xda, 0xd7, 0xed, 0xe1, 0x6a,
-	0x77, 0x27, 0xc1, 0x5a, 0x7a, 0x84, 0xab, 0xb1, 0x6a, 0xf7, 0x55, 0xbf, 0x77, 0x7f, 0x03, 0x43, 0x54, 0xf7, 0xbf,
-	0x1a, 0xf3, 0x71, 0x01, 0xa6, 0xfa, 0xc3, 0xfe, 0xc0, 0x52, 0xf1, 0xf4, 0xc9, 0xf9, 0xb0, 0x53, 0x76, 0xe9, 0x23,
-	0xa1, 0xd0, 0x7a, 0x21, 0xdd, 0x8f, 0x67, 0x09, 0x07, 0xc8, 0xaf, 0xc6, 0xfd, 0xaf, 0x1f, 0x22, 0x05, 0x32, 0x7c,
-	0xf7, 0xde, 0x7d, 0x07, 0x9e, 0xab, 0x6c, 0xeb, 0x3c, 0x37, 0x4b, 0x38, 0xcc, 0x11, 0x65, 0x69, 0xf4, 0x53, 0xf4,
-	0xe1, 0x8f, 0x48, 0xc4, 0x31, 0x7c, 0xf3, 0x3a, 0x1a, 0xee, 0x2b, 0xb0, 0xc2, 0x4f, 0xd1, 0xb3, 0x28, 0xb6, 0xff,
-	0x7e, 0xd2, 0x62, 0xd9, 0x52, 0x4c, 0x7e, 0xdd, 0x35, 0xd5, 0x51, 0xcb, 0xa5, 0x2c, 0x53, 0xf3, 0x46, 0x4c, 0xb0,
-	0x88, 0xe7, 0xa9, 0x95, 0x67, 0x4b, 0xf9, 0xbf, 0xa6, 0x0e, 0x2c, 0x72, 0xd3, 0x18, 0x8d, 0x3c, 0x83, 0x79, 0x8b,
-	0x88, 0xc3, 0xe4, 0xb0, 0x37, 0xab, 0xc1, 0x97, 0x1a, 0xed, 0x74, 0xbc, 0x51, 0x18, 0x1d, 0x5a, 0xad, 0x93, 0xc0,
-	0x0a, 0xce, 0x94, 0x7c, 0x29, 0x22, 0x91, 0x95, 0x56, 0x47, 0x2c, 0x75, 0xf6, 0x5d, 0xd3, 0x54, 0xbd, 0x91, 0x8f,
-	0x0b, 0xe5, 0x62, 0xc2, 0x28, 0xcc, 0x93, 0xe4, 0x4b, 0x85, 0x7b, 0xd9, 0xef, 0x54, 0x10, 0x98, 0x19, 0x98, 0xde,
-	0x07, 0x2f, 0x4b, 0x30, 0xab, 0x53, 0x28, 0x96, 0x0a, 0xd5, 0x11, 0x54, 0x06, 0x80, 0x4a, 0xab, 0x14, 0xb9, 0xd1,
-	0x28, 0xe2, 0x88, 0x83, 0x15, 0x8c, 0x46, 0x79, 0x62, 0xe7, 0xc6, 0xa3, 0xf4, 0xde, 0x0b, 0xb3, 0x77, 0x56, 0x72,
-	0xbf, 0x77, 0x16, 0x93, 0x65, 0x55, 0xbd, 0x6c, 0x1b, 0x79, 0x6b, 0x54, 0xb2, 0x44, 0x19, 0x18, 0xf6, 0xa3, 0xac,
-	0x3b, 0xaf, 0x8c, 0x25, 0x27, 0x74, 0xfc, 0x3c, 0x49, 0x96, 0x1b, 0xa5, 0x4c, 0xed, 0x7f, 0x56, 0x22, 0x68, 0x57,
-	0x83, 0x5a, 0xdb, 0xf0, 0xc9, 0x2c, 0x2d, 0x49, 0xa3, 0x94, 0xe7, 0x7a, 0x3b, 0x22, 0xce, 0xad, 0x06, 0x01, 0xfe,
-	0xbe, 0x99, 0x06, 0x33, 0x41, 0x5a, 0x46, 0x8c, 0x69, 0x61, 0x96, 0x5b, 0x2f, 0x61, 0x04, 0xf5, 0x1d, 0xe4, 0x98,
-	0xca, 0x48, 0x73, 0xb5, 0x1c, 0x98, 0x20, 0x03, 0xd9, 0x64, 0x5e, 0x0e, 0xc1, 0xfc, 0xee, 0xe1, 0xfe, 0x4e, 0x5a,
-	0xbc, 0x21, 0x81, 0xa5, 0x59, 0x12, 0x71, 0x5e, 0x80, 0xcd, 0xb8, 0x95, 0x17, 0x2b, 0xf8, 0xea, 0xce, 0x40, 0x91,
-	0x66, 0x85, 0xc6, 0x22, 0x2b, 0x20, 0xf1, 0xc5, 0xd6, 0x3f, 0x18, 0x81, 0x7b, 0x68, 0xaa, 0xe1, 0xce, 0x0c, 0x0f,
-	0x4b, 0x39, 0xd3, 0xfb, 0x64, 0x2a, 0x86, 0xac, 0x38, 0x01, 0xfb, 0x9b, 0xec, 0x3b, 0xbb, 0x18, 0xeb, 0x1a, 0x39,
-	0x47, 0xb6, 0x24, 0x40, 0x77, 0xad, 0x89, 0x9b, 0xb2, 0x80, 0xa0, 0xe1, 0x09, 0x92, 0xe4, 0x04, 0xde, 0xf1, 0x8b,
-	0x19, 0x36, 0x57, 0xe1, 0xc5, 0x45, 0x81, 0x24, 0x09, 0xa8, 0xe3, 0x5d, 0x2f, 0xcd, 0xa8, 0xb0, 0x2d, 0xbd, 0x82,
-	0x0c, 0x4b, 0x13, 0x34, 0x6f, 0x21, 0xed, 0xce, 0xce, 0xaf, 0x5c, 0x32, 0x41, 0xb2, 0x04, 0xc7, 0xdb, 0xfa, 0xb3,
-	0x5d, 0x6e, 0x69, 0x7d, 0xb8, 0xf4, 0xa0, 0x73, 0x82, 0xe3, 0x50, 0x7f, 0xb5, 0x76, 0xe0, 0x5a, 0x58, 0x59, 0xcc,
-	0x8f, 0x4c, 0x40, 0x1c, 0xe4, 0x67, 0x87, 0x21, 0x2c, 0x1a, 0x4c, 0x0c, 0xa6, 0xf6, 0x23, 0x13, 0x04, 0x25, 0x72,
-	0x58, 0xbb, 0xc3, 0x02, 0xef, 0x90, 0x00, 0xd8, 0xd6, 0xce, 0xc8, 0x99, 0x05, 0x84, 0x21, 0x61, 0x02, 0xdf, 0xae,
-	0x6b, 0xba, 0x76, 0xe1, 0x1c, 0x0c, 0x2c, 0x92, 0x39, 0x67, 0xe2, 0x25, 0x5d, 0xf7, 0xb1, 0xf6, 0x2a, 0xb3, 0xc3,
-	0x2e, 0x74, 0x04, 0x41, 0xb2, 0x51, 0xe5, 0x44, 0xaf, 0x47, 0xa8, 0xd8, 0x12, 0x89, 0x0a, 0x06, 0xbb, 0x1c, 0x41,
-	0xb0, 0x94, 0x7f, 0x4d, 0x55, 0x63, 0xe1, 0x29, 0x61, 0xbb, 0x85, 0xfe, 0x4b, 0x96, 0x0b, 0x2b, 0x4e, 0xc0, 0x3c,
-	0xa8, 0x02, 0x2f, 0x0d, 0x9e, 0x30, 0x3d, 0x4b, 0x75, 0x62, 0xf2, 0xa3, 0x13, 0x3c, 0xa1, 0x04, 0x0f, 0xba, 0xea,
-	0xe9, 0xfd, 0xa6, 0xce, 0x96, 0x99, 0x4f, 0xc9, 0x82, 0x80, 0x5a, 0x59, 0xbb, 0xa7, 0x2e, 0x89, 0xa1, 0xe4, 0x22,
-	0x08, 0xa6, 0xe7, 0x26, 0x11, 0x45, 0x26, 0x31, 0xcc, 0x79, 0x4b, 0x10, 0x34, 0x9f, 0x69, 0x31, 0xa6, 0xe5, 0x12,
-	0x81, 0xe4, 0x08, 0x8c, 0xcf, 0x3d, 0x86, 0x60, 0x05, 0x6e, 0x32, 0xa8, 0x91, 0x24, 0x18, 0xbe, 0x40, 0x23, 0x32,
-	0x94, 0x31, 0x05, 0x01, 0xef, 0x42, 0xcb, 0x71, 0x2d, 0x27, 0x62, 0x2f, 0x97, 0x13, 0xc0, 0x7e, 0x0e, 0xc9, 0x11,
-	0xb0, 0x7e, 0x31, 0x76, 0xb7, 0x2b, 0x64, 0x68, 0x85, 0x39, 0xc1, 0xe9, 0x57, 0x63, 0x1a, 0xed, 0xe9, 0x05, 0xb2,
-	0x4d, 0x4e, 0x00, 0xba, 0x74, 0x7e, 0x02, 0x72, 0x69, 0x86, 0xe4, 0x08, 0x2c, 0xff, 0x36, 0x2b, 0x4c, 0xcd, 0xcc,
-	0x05, 0xda, 0x73, 0x4e, 0x40, 0xf9, 0xcd, 0xcc, 0xac, 0x42, 0x5d, 0xc0, 0xfa, 0xbd, 0x1c, 0x41, 0xe5, 0xa5, 0xb1,
-	0x61, 0x4e, 0xd1, 0xcb, 0x09, 0x2a, 0xaf, 0x8c, 0x1c, 0x88, 0xe5, 0x09, 0x9e, 0x96, 0x40, 0xf2, 0xda, 0xe4, 0x2e,
-	0x58, 0x5f, 0x06, 0x82, 0xa8, 0x82, 0xe7, 0x04, 0x93, 0x37, 0x66, 0xc7, 0xcc, 0xec, 0x24, 0x45, 0x36, 0x2c, 0x08,
-	0x2a, 0xbf, 0x9b, 0x21, 0x4b, 0x8d, 0x32, 0xf3, 0x23, 0x16, 0x04, 0x95, 0xff, 0x98, 0x11, 0x55, 0x12, 0xca, 0xe8,
-	0x90, 0x04, 0x96, 0xb7, 0xde, 0x38, 0x1c, 0x32, 0xb2, 0x1f, 0x92, 0xc0, 0x72, 0x65, 0xa6, 0x16, 0x40, 0x27, 0x61,
-	0x72, 0xc8, 0xd4, 0x7e, 0x44, 0x02, 0xcc, 0x3b, 0x94, 0x5a, 0x85, 0x40, 0x06, 0x2a, 0x08, 0x2e, 0xd7, 0x36, 0xae,
-	0xb8, 0xde, 0x78, 0x1e, 0x23, 0x13, 0x15, 0x04, 0x9a, 0xf7, 0x76, 0x4c, 0x6e, 0xac, 0x89, 0xfd, 0xa2, 0x20, 0xe8,
-	0x7c, 0xb0, 0xa2, 0xc2, 0x8a, 0xe2, 0x51, 0x09, 0x42, 0x7f, 0xd8, 0xa4, 0xa7, 0x1d, 0x03, 0x2f, 0x94, 0x00, 0xf4,
-	0x67, 0xe4, 0x98, 0x15, 0x08, 0x62, 0x3e, 0x52, 0x12, 0x7c, 0x3e, 0x9a, 0x68, 0xd0, 0xbe, 0x9b, 0xa0, 0xa8, 0x29,
-	0x09, 0x3e, 0x37, 0xc0, 0xdc, 0x3f, 0xc9, 0x71, 0x66, 0x2e, 0x29, 0x13, 0x8e, 0xb9, 0xa0, 0x3c, 0x5d, 0x12, 0xa8,
-	0x6e, 0x40, 0xc9, 0x57, 0xe6, 0x14, 0xea, 0xaa, 0xaa, 0xcc, 0x4c, 0xd7, 0x45, 0x5b, 0x99, 0xcb, 0xec, 0xe4, 0x44,
-	0x98, 0xee, 0x70, 0x33, 0x13, 0x83, 0xc4, 0xe8, 0x67, 0xa2, 0x29, 0x6f, 0xd8, 0xd5, 0xf5, 0xae, 0xee, 0x77, 0x93,
-	0xa1, 0xae, 0x09, 0x58, 0x27, 0xe3, 0x8a, 0xc4, 0xe4, 0x48, 0x89, 0xc0, 0x39, 0x29, 0x66, 0x3d, 0x00, 0xad, 0x37,
-	0x95, 0x47, 0x1f, 0x3d, 0x12, 0xed, 0x7a, 0xe0, 0xd9, 0xb9, 0x2d, 0x0c, 0x25, 0x01, 0x56, 0xb3, 0x3e, 0xcf, 0xe0,
-	0x98, 0x25, 0x7d, 0x1c, 0x85, 0x5f, 0x49, 0x00, 0xae, 0x66, 0x4f, 0xd4, 0xd1, 0x57, 0xea, 0xca, 0x63, 0x24, 0x09,
-	0xbe, 0x37, 0xc6, 0x50, 0xa5, 0xad, 0xc5, 0x1c, 0xd9, 0x89, 0x20, 0xbc, 0x43, 0x4e, 0x03, 0x62, 0xca, 0x3e, 0x6e,
-	0xd0, 0x24, 0x26, 0x20, 0xef, 0x5d, 0xa9, 0xd1, 0xa2, 0x2c, 0xf6, 0xa3, 0x26, 0x31, 0x2d, 0x65, 0x8b, 0x61, 0x55,
-	0x7c, 0xa1, 0x61, 0x29, 0x29, 0x31, 0xb2, 0x09, 0xd3, 0x61, 0x93, 0x9a, 0x51, 0x21, 0x27, 0xd5, 0x40, 0x41, 0xf4,
-	0x37, 0x4d, 0x74, 0xdb, 0x38, 0x5d, 0x02, 0xf3, 0x41, 0xeb, 0x42, 0x21, 0x55, 0xe7, 0x1a, 0x88, 0xce, 0x1c, 0xcf,
-	0x43, 0xb0, 0x35, 0xde, 0xa3, 0x7d, 0x99, 0x97, 0x29, 0x5e, 0x3c, 0xc1, 0xb3, 0x76, 0x49, 0xc4, 0xb2, 0x34, 0x9e,
-	0x3b, 0x41, 0x82, 0xe1, 0x7f, 0x7d, 0x26, 0x56, 0xb8, 0xf1, 0x18, 0xcb, 0x12, 0xf0, 0x0c, 0x83, 0xe6, 0x3a, 0x37,
-	0x64, 0x19, 0x9e, 0x9d, 0x60, 0xd7, 0x90, 0xd9, 0xbd, 0x20, 0x81, 0xce, 0x78, 0xe8, 0x19, 0xd7, 0x31, 0xc7, 0xd1,
-	0xc6, 0x13, 0x82, 0x9b, 0x2d, 0xf9, 0x2a, 0x38, 0x79, 0xb1, 0x10, 0x24, 0xa8, 0x59, 0x2e, 0x1b, 0x7b, 0x9e, 0x85,
-	0x64, 0x09, 0x6a, 0xf7, 0xd6, 0xd7, 0x99, 0x35, 0x7d, 0xbc, 0x18, 0x98, 0x72, 0x0f, 0xe4, 0x39, 0x20, 0x5b, 0xa4,
-	0x58, 0x96, 0xc0, 0x64, 0x08, 0x8d, 0x88, 0xb5, 0xa1, 0x04, 0x16, 0xa4, 0x34, 0xd2, 0x84, 0x43, 0x61, 0x17, 0xcb,
-	0xb0, 0x28, 0x01, 0xca, 0xa6, 0x00, 0x61, 0x89, 0x8c, 0x48, 0xf4, 0x7f, 0x2b, 0x4b, 0x80, 0x9a, 0xac, 0x11, 0x12,
-	0xcb, 0x1f, 0x53, 0x75, 0xa0, 0x76, 0xb2, 0x04, 0xab, 0xcf, 0x06, 0xab, 0x58, 0x65, 0x16, 0xd8, 0x56, 0x82, 0x45,
-	0x09, 0x5a, 0x5f, 0x7c, 0xf0, 0x9a, 0x5c, 0xea, 0x45, 0x53, 0x82, 0x97, 0xa1, 0xd2, 0xa9, 0xb6, 0x00, 0x5f, 0x08,
-	0x12, 0xbc, 0x1e, 0x0c, 0x06, 0x0e, 0x02, 0xa8, 0x5c, 0x48, 0x96, 0xe0, 0xf5, 0x2d, 0xb2, 0x5c, 0x5e, 0x79, 0xff,
-	0x42, 0xf0, 0x44, 0xe6, 0xf4, 0x89, 0x29, 0xcd, 0xdc, 0xd1, 0x52, 0x20, 0x46, 0x9f, 0xa4, 0x04, 0xb4, 0x1b, 0x7b,
-	0xa8, 0xd6, 0xbc, 0x52, 0xb5, 0x5d, 0x18, 0x80, 0x9d, 0xf3, 0xd8, 0x89, 0xf3, 0x13, 0x73, 0xa0, 0xdc, 0xcc, 0x62,
-	0x9b, 0x9b, 0xf3, 0x1c, 0x4f, 0x42, 0x50, 0xd4, 0xc9, 0x79, 0xac, 0x9b, 0xbd, 0xcd, 0x2e, 0x80, 0x72, 0x52, 0xe6,
-	0x86, 0x24, 0xa7, 0x6e, 0xaa, 0x15, 0xa9, 0xd6, 0x7d, 0x88, 0x7d, 0xf7, 0xc5, 0x11, 0x5f, 0xeb, 0x84, 0x0c, 0x28,
-	0x1b, 0xcb, 0x66, 0x2d, 0x62, 0x2d, 0x7f, 0xe6, 0x87, 0x03, 0xd7, 0x19, 0x14, 0x1c, 0x7d, 0xe8, 0x50, 0xae, 0x6a,
-	0xc4, 0x89, 0xcd, 0xd4, 0x21, 0xb9, 0xa9, 0x5b, 0x93, 0x8d, 0x94, 0x71, 0xce, 0x52, 0x75, 0xb2, 0x82, 0xff, 0x89,
-	0x73, 0x33, 0x4a, 0xae, 0x6f, 0x55, 0x0f, 0xcb, 0xd1, 0x71, 0x55, 0x28, 0x14, 0x82, 0x4c, 0x68, 0xe2, 0x60, 0x35,
-	0x88, 0xd1, 0x1e, 0xdc, 0xa1, 0xc9, 0x78, 0x46, 0x89, 0xa8, 0x40, 0x42, 0x79, 0xf6, 0x6d, 0xd3, 0xf5, 0x75, 0x6b,
-	0x43, 0x54, 0xf9, 0x1c, 0xd4, 0x17, 0x45, 0x01, 0xbd, 0x71, 0x29, 0xe3, 0x1e, 0xa4, 0x5f, 0x8e, 0x4a, 0x9d, 0x67,
-	0x10, 0x58, 0xbc, 0x44, 0x6c, 0x27, 0xa1, 0xcc, 0x7b, 0x37, 0xf5, 0xbd, 0x6c, 0x77, 0xc6, 0x09, 0x4b, 0x55, 0x23,
-	0x61, 0x78, 0x50, 0x8a, 0x9d, 0x67, 0x51, 0x0a, 0xae, 0x4b, 0xde, 0x50, 0xeb, 0xe6, 0x9e, 0x29, 0x7a, 0xdc, 0x14,
-	0x3d, 0xcc, 0xb3, 0x13, 0x4a, 0xc8, 0x5d, 0x63, 0xc8, 0xbb, 0x24, 0x88, 0xea, 0xe6, 0x10, 0x4b, 0xb0, 0x1a, 0xc1,
-	0xfd, 0x30, 0xd5, 0xa0, 0x72, 0xec, 0x3c, 0xd7, 0x80, 0x9c, 0x9f, 0xab, 0x88, 0x52, 0xc9, 0xc7, 0x2d, 0x91, 0x72,
-	0x75, 0xa5, 0xa5, 0x57, 0xe8, 0x67, 0x03, 0x5b, 0xe4, 0xea, 0xa8, 0x1c, 0x63, 0x35, 0x5a, 0x86, 0x9c, 0x1a, 0xf2,
-	0x69, 0x50, 0x52, 0x7a, 0xb1, 0xc0, 0x7a, 0xd4, 0x09, 0x4c, 0xa9, 0x31, 0xc7, 0xa1, 0x12, 0xe5, 0x7a, 0xca, 0xe4,
-	0x6f, 0x9b, 0x90, 0x20, 0x81, 0x51, 0xb6, 0xfb, 0xb9, 0x83, 0x01, 0x7e, 0xa8, 0x1b, 0x24, 0x40, 0xcb, 0xe6, 0x06,
-	0x49, 0x42, 0xc9, 0xfa, 0xbe, 0x3a, 0x1c, 0xec, 0x21, 0x32, 0x85, 0x54, 0xa8, 0x61, 0x87, 0xf5, 0x7a, 0xd8, 0x29,
-	0x69, 0x37, 0x0a, 0xae, 0x53, 0xa7, 0x42, 0x61, 0xad, 0x43, 0xe9, 0xbb, 0x69, 0xc3, 0xa8, 0xa0, 0x92, 0xbd, 0xb4,
-	0xed, 0x18, 0xd8, 0x62, 0x02, 0x7c, 0x93, 0x65, 0x0c, 0xd0, 0x74, 0x55, 0x93, 0x92, 0xf4, 0xfb, 0xaa, 0xaf, 0x0e,
-	0x7d, 0x75, 0x6f, 0x77, 0x04, 0xbf, 0x55, 0x93, 0x89, 0x0c, 0x3b, 0x0c, 0x25, 0xec, 0x37, 0x13, 0xa0, 0x67, 0xc1,
-	0x03, 0x13, 0x24, 0x99, 0xc9, 0x46, 0x59, 0x91, 0x39, 0x85, 0x53, 0xad, 0x47, 0x0d, 0xdf, 0x4d, 0x35, 0xd8, 0xdc,
-	0xa2, 0x6b, 0x95, 0x5a, 0x1a, 0x24, 0x18, 0x4d, 0x84, 0x8c, 0x26, 0x3f, 0xa1, 0x09, 0xa6, 0xf0, 0x7a, 0x89, 0xd5,
-	0x63, 0xb0, 0x4c, 0xa4, 0x77, 0x8a, 0xfc, 0x81, 0x1e, 0xea, 0xfa, 0x25, 0xb6, 0xe3, 0x99, 0x0b, 0xbc, 0x35, 0x82,
-	0xee, 0xec, 0xd4, 0x5e, 0x91, 0x17, 0xda, 0xab, 0x93, 0x02, 0xb9, 0x19, 0xa5, 0xfb, 0xb2, 0x69, 0xea, 0xfb, 0xa1,
-	0x36, 0x05, 0x93, 0x89, 0xb9, 0x53, 0x95, 0xcc, 0xd9, 0x89, 0x12, 0x7f, 0x00, 0x6c, 0xbc, 0xeb, 0xa6, 0xb9, 0x8f,
-	0xc9, 0x1d, 0x95, 0xc4, 0xf9, 0x99, 0x92, 0x7b, 0xd7, 0x61, 0x98, 0x93, 0xad, 0x39, 0xb6, 0xa8, 0x64, 0x0b, 0xf9,
-	0xc9, 0x27, 0x5b, 0xca, 0xd5, 0x01, 0x60, 0xdb, 0x6a, 0x4a, 0x21, 0x8d, 0x30, 0xb0, 0x38, 0x03, 0x88, 0x44, 0x3e,
-	0xcf, 0x43, 0x49, 0xfa, 0x6e, 0x1a, 0x5d, 0x06, 0x29, 0xb4, 0xbc, 0xee, 0x20, 0x79, 0x79, 0x82, 0x92, 0xe1, 0xf3,
-	0xb7, 0x8d, 0xb4, 0x85, 0x55, 0xf5, 0x25, 0x73, 0xd5, 0xc5, 0x84, 0x7c, 0xc8, 0x5d, 0x4a, 0xa7, 0xfc, 0xdc, 0xd7,
-	0x19, 0xd5, 0xf5, 0x64, 0x85, 0x09, 0x3a, 0x31, 0x27, 0x37, 0x4a, 0xce, 0x8f, 0xd5, 0xae, 0x9f, 0x9b, 0x49, 0x70,
-	0xf4, 0x52, 0xa4, 0x3b, 0x56, 0x6e, 0xea, 0x02, 0x6f, 0xc5, 0xd1, 0x7b, 0xe9, 0x76, 0x0d, 0x21, 0xc6, 0x81, 0x6f,
-	0x28, 0xec, 0x85, 0xeb, 0x4c, 0x26, 0x94, 0xa9, 0xef, 0xbb, 0xb1, 0xda, 0xcd, 0x75, 0x29, 0x83, 0x14, 0xc4, 0xb3,
-	0x5c, 0xfb, 0x99, 0xa2, 0xe2, 0x5a, 0x27, 0x5d, 0x31, 0xf6, 0x1a, 0xe2, 0xcd, 0x01, 0x9f, 0x82, 0x81, 0x94, 0x0a,
-	0x87, 0xe9, 0x90, 0x0a, 0x89, 0xb8, 0xde, 0x95, 0xb1, 0x0c, 0x76, 0xa1, 0xce, 0x4a, 0x3c, 0x8e, 0x35, 0xee, 0x56,
-	0x9c, 0x60, 0xb7, 0x93, 0x7b, 0x70, 0x49, 0xdb, 0xc2, 0x2d, 0x35, 0xbf, 0x4a, 0x00, 0x16, 0x08, 0xbb, 0x79, 0x02,
-	0xda, 0xc2, 0x9d, 0xda, 0x43, 0xd5, 0x4f, 0xc7, 0xa6, 0x9a, 0x1c, 0xc5, 0x28, 0x0d, 0x88, 0x45, 0xe6, 0x41, 0x4c,
-	0x29, 0xd7, 0xee, 0x0e, 0x5d, 0x2b, 0x3f, 0xd9, 0xe0, 0x54, 0xde, 0x98, 0xab, 0x56, 0x31, 0x18, 0xc0, 0xc9, 0x13,
-	0x3c, 0x76, 0xd5, 0x0c, 0x07, 0x84, 0x13, 0x53, 0x84, 0x1f, 0xca, 0xb7, 0x10, 0xa5, 0x93, 0xa7, 0x31, 0x72, 0x9c,
-	0x13, 0x27, 0x94, 0x7b, 0x95, 0x37, 0x05, 0x50, 0x89, 0x39, 0x6f, 0xa6, 0x94, 0xc2, 0x9c, 0x5f, 0xf8, 0x8c, 0xcc,
-	0xd1, 0xc9, 0x38, 0x4d, 0xc9, 0x42, 0xba, 0x7e, 0x7f, 0x2b, 0x8f, 0xf5, 0xdc, 0x98, 0x4c, 0x01, 0x61, 0x75, 0x84,
-	0xe5, 0xaa, 0x33, 0xe2, 0x32, 0x66, 0x4a, 0x6f, 0x59, 0x5e, 0xfa, 0xf3, 0xee, 0xba, 0x2f, 0x93, 0xd2, 0xcb, 0x96,
-	0x37, 0x5e, 0x5a, 0x75, 0x53, 0x54, 0xdb, 0x1a, 0x1f, 0xfa, 0x52, 0x7a, 0xd9, 0xf2, 0xe6, 0xc2, 0x45, 0x75, 0xac,
-	0x4d, 0x8e, 0x46, 0xe6, 0xab, 0xd5, 0x1f, 0x81, 0x77, 0x4d, 0xcd, 0xbc, 0x7c, 0x00, 0x56, 0x2f, 0x3f, 0x43, 0xbd,
-	0x95, 0x94, 0xde, 0x35, 0x54, 0x46, 0x98, 0x25, 0x36, 0x6d, 0x20, 0x1e, 0x9f, 0xd2, 0x9e, 0xfe, 0x5e, 0xd5, 0xe8,
-	0x61, 0x20, 0xa7, 0xae, 0x99, 0xa0, 0xaa, 0x4b, 0xc7, 0xe5, 0x01, 0x09, 0x6d, 0x56, 0x4b, 0xeb, 0xb3, 0xb9, 0xdb,
-	0xea, 0xaa, 0xe9, 0x8e, 0x5a, 0xfa, 0xb1, 0x69, 0xe9, 0x2b, 0x2e, 0x37, 0xb3, 0x94, 0x94, 0xf6, 0xde, 0x3b, 0xb3,
-	0x74, 0xdb, 0xd0, 0x5f, 0x9c, 0xac, 0x52, 0xda, 0x7d, 0x87, 0x42, 0x78, 0x84, 0x14, 0x79, 0xd3, 0xd8, 0xd4, 0x5a,
-	0x58, 0x1d, 0xb4, 0xa0, 0x33, 0xa2, 0x72, 0xb9, 0x88, 0xc9, 0xb9, 0xdb, 0x97, 0xf3, 0xec, 0xb4, 0xbc, 0xf4, 0xd9,
-	0x6e, 0x3e, 0xa5, 0xe3, 0x6c, 0x47, 0xe5, 0x2b, 0x9f, 0x57, 0x5c, 0xa7, 0x00, 0xa7, 0x15, 0x2a, 0x3e, 0xad, 0xc2,
-	0xd1, 0x9d, 0x7c, 0x54, 0xaf, 0x29, 0x38, 0x8b, 0xf4, 0xe1, 0xe5, 0x57, 0x85, 0xc2, 0x8b, 0xca, 0xff, 0xb9, 0xd8,
-	0xb5, 0x6f, 0x28, 0x05, 0xb7, 0xbd, 0xaf, 0x3f, 0xd7, 0x8e, 0xe7, 0xab, 0x53, 0xa0, 0xaa, 0x8c, 0x70, 0x6a, 0x11,
-	0x79, 0x60, 0x7c, 0x64, 0xa5, 0x79, 0x70, 0x75, 0xed, 0x7b, 0x52, 0xfa, 0x9c, 0x54, 0x04, 0xd7, 0xb6, 0xce, 0x8b,
-	0xc0, 0xf0, 0x95, 0x1f, 0x3e, 0xff, 0x0e, 0x0c, 0xae, 0xc9, 0xf8, 0xb8, 0xd3, 0x17, 0x9c, 0xe3, 0xc1, 0xcf, 0x81,
-	0x4f, 0x74, 0xc1, 0x49, 0x06, 0x7d, 0x77, 0x86, 0x4a, 0x82, 0x3a, 0x09, 0xa7, 0xba, 0x3f, 0x89, 0x8e, 0xc2, 0x6b,
-	0xe0, 0xc8, 0xd2, 0x50, 0x8b, 0x66, 0x2e, 0x86, 0xab, 0xfd, 0xf4, 0xfe, 0x6c, 0x83, 0x76, 0x22, 0xe2, 0x80, 0xf8,
-	0x12, 0x6c, 0xac, 0x12, 0x82, 0xbb, 0x42, 0xe9, 0x5d, 0x5b, 0x58, 0x27, 0xa5, 0x32, 0xbc, 0x8f, 0x6b, 0x04, 0x38,
-	0x9a, 0x20, 0x08, 0xf9, 0x84, 0xeb, 0x87, 0xf6, 0x70, 0x35, 0x03, 0x3e, 0xdc, 0x53, 0x8d, 0x8b, 0xc5, 0x2e, 0xe6,
-	0x0b, 0x81, 0xe0, 0x16, 0x5e, 0x40, 0xfd, 0xb7, 0x37, 0x26, 0xeb, 0xdb, 0x08, 0x2a, 0x4c, 0xb1, 0x4b, 0x40, 0x58,
-	0x83, 0x97, 0x41, 0xd4, 0x9d, 0xa9, 0x7b, 0xaa, 0xd3, 0x5a, 0xee, 0xe9, 0x81, 0x5d, 0x92, 0xee, 0x9b, 0x8b, 0xdc,
-	0x27, 0xe2, 0xd5, 0x26, 0x10, 0x2d, 0x99, 0xb7, 0x20, 0xca, 0xd0, 0xf8, 0x7f, 0x33, 0xaa, 0xab, 0xd9, 0x2f, 0x50,
-	0x53, 0x72, 0xe6, 0x0a, 0x54, 0xfa, 0xf5, 0xca, 0x61, 0xcd, 0x96, 0x17, 0x57, 0x04, 0x54, 0xa9, 0xf1, 0x38, 0xeb,
-	0x64, 0xaf, 0x88, 0x4b, 0x10, 0xe4, 0xca, 0x33, 0x49, 0xbc, 0xa0, 0x50, 0x04, 0xbd, 0x5b, 0xa1, 0x10, 0xdb, 0x10,
-	0x5a, 0x74, 0xef, 0xa9, 0xda, 0x73, 0xb4, 0x24, 0x7f, 0x41, 0x15, 0x5e, 0x94, 0x67, 0x92, 0x2e, 0x77, 0x60, 0x22,
-	0xb9, 0x76, 0xbb, 0x05, 0xcf, 0x7b, 0xdc, 0xef, 0x06, 0x0f, 0x5a, 0x5e, 0x3c, 0x8e, 0xd9, 0x80, 0x19, 0x9b, 0x51,
-	0x48, 0xb6, 0x53, 0x46, 0x4d, 0x21, 0xd8, 0x4a, 0x7d, 0x4d, 0xf7, 0x4d, 0xb6, 0x07, 0x2b, 0xcd, 0x74, 0x2d, 0x2f,
-	0x21, 0x32, 0x03, 0x9b, 0x7d, 0xeb, 0xd7, 0x6e, 0x6e, 0xa9, 0x98, 0x0a, 0xe1, 0xc0, 0xd0, 0xbf, 0x50, 0xb8, 0xd4,
-	0xe5, 0x9b, 0x46, 0x0b, 0xdf, 0xbe, 0xad, 0x02, 0x7f, 0x95, 0xf0, 0x7c, 0x63, 0x2f, 0x98, 0xf0, 0x2a, 0xa2, 0xe4,
-	0xbc, 0x09, 0x9f, 0x18, 0x56, 0x45, 0x05, 0x85, 0x9a, 0x2b, 0x28, 0xc1, 0x48, 0xeb, 0xfd, 0xc6, 0xe7, 0x4e, 0x67,
-	0x10, 0xb2, 0xdd, 0x82, 0x64, 0x9b, 0xc0, 0x4c, 0x34, 0xca, 0x41, 0xcc, 0x3e, 0x2e, 0xbd, 0x68, 0xbe, 0x98, 0x09,
-	0x7a, 0xd1, 0xbb, 0xbb, 0xae, 0xb7, 0x4e, 0xa4, 0x49, 0x61, 0x2c, 0xc2, 0x01, 0xf0, 0x06, 0xed, 0x74, 0xbe, 0xbc,
-	0x2b, 0xc2, 0x9b, 0x7d, 0x8b, 0x0e, 0x6c, 0xe6, 0x2e, 0x72, 0x23, 0x86, 0xaf, 0x96, 0xa5, 0xd6, 0xde, 0xb9, 0x05,
-	0xc5, 0xf7, 0xde, 0x90, 0xf6, 0x62, 0x42, 0x3d, 0xf8, 0x0a, 0xb2, 0xaf, 0x6b, 0xb4, 0x74, 0x5c, 0x37, 0x82, 0x6b,
-	0x9f, 0x7c, 0xe9, 0xc3, 0x8e, 0x13, 0xca, 0x71, 0xfa, 0x39, 0xc6, 0x30, 0xe9, 0x7e, 0x87, 0x6b, 0xaa, 0x64, 0x40,
-	0x4a, 0x63, 0x7d, 0xc0, 0x9b, 0x8f, 0xce, 0x2b, 0x8b, 0xfa, 0xc4, 0x85, 0x6e, 0x43, 0xc3, 0xfc, 0xc5, 0x8b, 0x3b,
-	0x4f, 0x0b, 0xcb, 0x7a, 0x3e, 0x38, 0xd3, 0x9c, 0x2c, 0xb0, 0x8c, 0xe3, 0xd4, 0x8c, 0xf5, 0x7d, 0xf3, 0x60, 0xf7,
-	0x9b, 0xa9, 0x42, 0xa6, 0x14, 0xe6, 0xe7, 0x3b, 0x2b, 0xeb, 0x60, 0x72, 0x6a, 0xb9, 0x7e, 0xbc, 0x91, 0x1d, 0xde,
-	0xe1, 0x02, 0xe3, 0xae, 0x49, 0x83, 0x01, 0x7f, 0x5f, 0xf5, 0x63, 0x5d, 0x35, 0xfb, 0xfa, 0xd6, 0x5c, 0x11, 0xa9,
-	0x1a, 0x99, 0x99, 0x56, 0x53, 0x9e, 0x04, 0x56, 0xf4, 0xb0, 0xa8, 0xda, 0x0b, 0x22, 0x95, 0x06, 0x54, 0x5e, 0x23,
-	0x8f, 0x8b, 0xdc, 0x9d, 0x75, 0xd0, 0x9e, 0x35, 0x49, 0x0d, 0xe6, 0x08, 0xc2, 0x37, 0x12, 0xc3, 0x05, 0xd1, 0xf0,
-	0x29, 0x3d, 0x48, 0x37, 0x17, 0x9b, 0xc8, 0x7d, 0xc3, 0x26, 0xb8, 0x07, 0xb9, 0xa4, 0x5c, 0x98, 0xd4, 0x85, 0x54,
-	0x76, 0x7f, 0xf3, 0x60, 0xd1, 0x7a, 0x79, 0x7d, 0x95, 0xb4, 0x09, 0xf4, 0x84, 0xe3, 0x6c, 0xf6, 0x0c, 0xd4, 0x0e,
-	0x59, 0x93, 0x03, 0x5f, 0xc5, 0x10, 0x08, 0x81, 0xe1, 0x2f, 0x51, 0x49, 0x12, 0x8f, 0xb1, 0x02, 0xf5, 0x20, 0x0d,
-	0xce, 0xdf, 0x93, 0x7f, 0x87, 0xc3, 0xc0, 0x32, 0x4c, 0x3f, 0x1c, 0x3b, 0xa9, 0x70, 0xd3, 0x77, 0x9f, 0x64, 0x3b,
-	0x5f, 0x69, 0xe8, 0xa7, 0x41, 0xb9, 0x7a, 0xbe, 0x58, 0xea, 0xdb, 0xf2, 0xd3, 0x09, 0x5d, 0x1e, 0xea, 0xc1, 0x77,
-	0x37, 0xbf, 0x87, 0x9b, 0xfd, 0xe2, 0x23, 0x13, 0x3d, 0x23, 0x09, 0x06, 0xe7, 0xe5, 0x32, 0xa5, 0x3f, 0x7e, 0x72,
-	0x1c, 0x26, 0x28, 0x97, 0xbe, 0xa7, 0xaf, 0xaf, 0xbf, 0x75, 0xee, 0x0d, 0x96, 0xe3, 0x0b, 0x9f, 0x57, 0x66, 0x27,
-	0x0d, 0x9a, 0xb5, 0xf7, 0x18, 0xf8, 0x12, 0x16, 0xf2, 0x87, 0x6e, 0xe1, 0x0f, 0xe9, 0xe3, 0xfe, 0xf0, 0xd1, 0x8f,
-	0x6e, 0x8a, 0xd7, 0x56, 0xcd, 0xf8, 0x88, 0x8a, 0x80, 0x78, 0x8c, 0x46, 0xd8, 0x67, 0x53, 0xfe, 0xb1, 0x95, 0x79,
-	0x8e, 0x07, 0x0e, 0x11, 0x4c, 0x2a, 0x17, 0xa3, 0xed, 0xc4, 0x3c, 0xca, 0xeb, 0x9f, 0xe3, 0x52, 0x6d, 0x9e, 0xa0,
-	0xa9, 0xcc, 0x50, 0x84, 0xbd, 0xa0, 0xa1, 0xac, 0xa6, 0xb4, 0x27, 0x81, 0xc5, 0xe5, 0xef, 0xaa, 0xce, 0xa0, 0x44,
-	0xea, 0x6e, 0x35, 0x21, 0x9b, 0xe4, 0x49, 0x20, 0xa3, 0xc8, 0xc5, 0xf1, 0xc7, 0x1d, 0xb0, 0xf0, 0xb5, 0xfc, 0xaa,
-	0x52, 0x62, 0x0d, 0x7d, 0xcb, 0x9b, 0xa7, 0xcb, 0xa7, 0x2a, 0xab, 0x4a, 0x83, 0xca, 0xfc, 0x63, 0xce, 0x73, 0xbe,
-	0xc8, 0x57, 0x73, 0x61, 0x0a, 0x36, 0x41, 0xbc, 0x63, 0x2e, 0x72, 0x5b, 0xc8, 0xdd, 0xbe, 0xa1, 0xfc, 0x50, 0x3e,
-	0x46, 0x59, 0x6b, 0xb4, 0x53, 0xfd, 0x72, 0x48, 0x99, 0x06, 0xdf, 0xfb, 0xaf, 0xaa, 0x35, 0x1a, 0xdd, 0x56, 0xeb,
-	0xad, 0xfc, 0xd3, 0xe1, 0x44, 0x9b, 0x3e, 0x9e, 0x68, 0x2b, 0x14, 0x2b, 0xee, 0xc4, 0xb0, 0x15, 0x2a, 0x03, 0xaa,
-	0x5f, 0xc5, 0xe3, 0xc3, 0xd7, 0xcb, 0x06, 0x94, 0x2e, 0x5f, 0x6c, 0xa3, 0xb4, 0xbc, 0xa1, 0x05, 0xcf, 0x13, 0x94,
-	0x60, 0x01, 0xbb, 0x46, 0x78, 0x7d, 0xcf, 0xe9, 0xfc, 0x85, 0x6c, 0x46, 0x13, 0x33, 0xc2, 0x3e, 0xc7, 0x12, 0x45,
-	0x20, 0x39, 0x8f, 0x33, 0x51, 0x5d, 0xbc, 0x3d, 0x08, 0x47, 0xca, 0x97, 0x6e, 0xc9, 0xc7, 0x32, 0xdf, 0xbf, 0x0c,
-	0xf3, 0xb1, 0xa5, 0x8d, 0xd0, 0x8e, 0x43, 0x1e, 0x7a, 0x34, 0xcf, 0x06, 0x72, 0xf7, 0x16, 0x64, 0xab, 0xb3, 0x50,
-	0x23, 0xb6, 0x37, 0x3f, 0xf3, 0x08, 0x66, 0xce, 0x13, 0x0d, 0x3a, 0xe3, 0x44, 0x9b, 0x0d, 0xba, 0x0b, 0xe4, 0xd4,
-	0xba, 0x18, 0x29, 0xd6, 0x8a, 0xef, 0x59, 0xd7, 0x44, 0x7a, 0x6e, 0x5f, 0x58, 0x22, 0x9d, 0xe3, 0x97, 0xcf, 0x27,
-	0x89, 0x2e, 0xa4, 0xd0, 0x1e, 0x52, 0xa9, 0xa5, 0x29, 0xaa, 0x71, 0x01, 0x25, 0x80, 0x43, 0x95, 0x14, 0x81, 0x9d,
-	0x5f, 0x2d, 0x0e, 0x9f, 0xee, 0x20, 0x83, 0xdf, 0xd4, 0xad, 0xd3, 0xe3, 0x9c, 0xe8, 0xcc, 0xe1, 0x53, 0x6c, 0xf4,
-	0x56, 0x7f, 0xa3, 0xb9, 0x34, 0x73, 0xe7, 0x79, 0xfc, 0xfa, 0x91, 0x6a, 0xbd, 0xf4, 0xf1, 0x33, 0xb7, 0xda, 0x83,
-	0x9e, 0x3a, 0xf6, 0xd5, 0x5e, 0x1e, 0xab, 0xde, 0xb6, 0xaa, 0x38, 0x70, 0x21, 0x28, 0xc1, 0x6c, 0x23, 0x2d, 0xca,
-	0x65, 0xdd, 0xfe, 0x2e, 0x6e, 0x76, 0x89, 0x3c, 0xc4, 0xd5, 0xf9, 0xe0, 0x92, 0x2e, 0xf1, 0x71, 0xcc, 0x48, 0x6f,
-	0x1c, 0xc6, 0x5e, 0x7a, 0x83, 0x9a, 0xdd, 0x66, 0x1b, 0x6b, 0x07, 0x17, 0xba, 0xab, 0x1a, 0xc3, 0xbe, 0x21, 0xfd,
-	0xe8, 0x37, 0x0a, 0x8a, 0x05, 0x85, 0x52, 0x91, 0xea, 0xe3, 0x93, 0xc2, 0xaa, 0x39, 0x4d, 0xa8, 0xb0, 0x76, 0xab,
-	0xc3, 0x39, 0x7a, 0xe2, 0x1d, 0xe2, 0xd3, 0x2d, 0xba, 0x9a, 0x33, 0xdb, 0xdd, 0x68, 0xa7, 0x5c, 0xaf, 0xc3, 0xc7,
-	0x25, 0x24, 0x91, 0x84, 0x6d, 0x7a, 0xe1, 0x7d, 0xc2, 0x30, 0xa1, 0x2d, 0xfa, 0x21, 0x17, 0xe4, 0xe6, 0x3b, 0x32,
-	0xf6, 0xc1, 0x33, 0x3f, 0xfc, 0x74, 0x2d, 0xd8, 0xa4, 0x07, 0x18, 0x6c, 0xa8, 0x2d, 0x90, 0x50, 0x4f, 0x26, 0x43,
-	0x53, 0x5c, 0x21, 0x3e, 0x6d, 0x8f, 0xd1, 0xf9, 0x06, 0x29, 0xba, 0x5a, 0xf5, 0xe6, 0x84, 0x8d, 0x9c, 0xad, 0xe0,
-	0x7c, 0xb3, 0x32, 0xae, 0x4d, 0x95, 0x39, 0xdf, 0xb0, 0xed, 0x1e, 0xaa, 0xb9, 0x74, 0x97, 0x49, 0x0c, 0x30, 0x2c,
-	0xcd, 0x15, 0x45, 0x28, 0x19, 0x77, 0xb8, 0xf8, 0x23, 0xff, 0x08, 0xa5, 0xbe, 0xe7, 0x28, 0x65, 0x58, 0x5e, 0xbd,
-	0xb5, 0xf5, 0x09, 0x0f, 0x8f, 0x8e, 0xf8, 0xa1, 0xe1, 0x21, 0x01, 0xd4, 0x3b, 0xeb, 0xe1, 0x2e, 0x53, 0x02, 0x0a,
-	0x79, 0x19, 0x90, 0x7f, 0x81, 0x02, 0xce, 0xf1, 0xc7, 0xe0, 0x62, 0x7a, 0x8a, 0x03, 0xa4, 0x6c, 0x83, 0x03, 0x7e,
-	0x0a, 0xb7, 0x3a, 0x3c, 0xa1, 0x16, 0xe3, 0x7c, 0x78, 0xca, 0x43, 0x59, 0xb2, 0x43, 0x4f, 0xa8, 0x1c, 0x1f, 0xd9,
-	0x0a, 0xa1, 0xb7, 0xa1, 0xac, 0xba, 0x78, 0x36, 0xbd, 0xce, 0x33, 0x44, 0x8b, 0xd9, 0x76, 0xef, 0xe2, 0x26, 0x73,
-	0xc5, 0x0b, 0xfd, 0xda, 0xdc, 0xcd, 0x6a, 0x70, 0x1f, 0xe7, 0xa8, 0xc4, 0xb9, 0x0a, 0xb7, 0x39, 0xb6, 0xbf, 0xda,
-	0x9e, 0xf9, 0x66, 0xc8, 0xb1, 0xfd, 0x32, 0x5c, 0xf1, 0xdf, 0x5a, 0xc9, 0x37, 0x72, 0x34, 0x73, 0x8f, 0xec, 0x82,
-	0xf9, 0xfd, 0xc2, 0xfb, 0x04, 0x3a, 0x68, 0x85, 0x0e, 0x7e, 0x98, 0x9f, 0x5a, 0xea, 0xbe, 0xf8, 0x80, 0x00, 0x55,
-	0xf8, 0x44, 0x4d, 0xcf, 0x5d, 0x19, 0xc4, 0x0f, 0x4f, 0x57, 0x0c, 0x66, 0x3e, 0x22, 0xab, 0x0f, 0x6e, 0xe9, 0x37,
-	0x0c, 0x10, 0xf7, 0x69, 0x11, 0x20, 0x3c, 0x97, 0x94, 0x16, 0xce, 0xe7, 0xd1, 0x10, 0x29, 0x6c, 0xf1, 0x95, 0xbc,
-	0x26, 0xe5, 0x1b, 0x6d, 0xea, 0x71, 0xd5, 0x9b, 0x17, 0xee, 0x5c, 0x84, 0x5f, 0x6f, 0xae, 0xdb, 0xcf, 0x07, 0x15,
-	0x9c, 0x6d, 0xe7, 0x5e, 0xef, 0x71, 0xdd, 0x68, 0xe2, 0x65, 0x12, 0x65, 0xa1, 0xa9, 0x3a, 0xd2, 0x3b, 0xc1, 0x9f,
-	0x32, 0x0a, 0xf5, 0xbd, 0x88, 0x8a, 0x4b, 0x1b, 0x1b, 0x34, 0x1a, 0x96, 0xe4, 0x2b, 0xa3, 0xfe, 0x40, 0xa4, 0xd0,
-	0x2f, 0x04, 0x79, 0x08, 0x8f, 0xc3, 0x2a, 0x15, 0xa0, 0x52, 0x91, 0xc7, 0x81, 0xf2, 0x2e, 0xc7, 0xbb, 0xc5, 0x36,
-	0xd4, 0x27, 0x21, 0x83, 0x90, 0x7f, 0x43, 0x99, 0x52, 0x1f, 0x93, 0xd2, 0x0d, 0x44, 0x5a, 0xba, 0x9e, 0x54, 0xb8,
-	0xfb, 0x46, 0x1e, 0x4e, 0x4d, 0xe0, 0xb9, 0x84, 0x7e, 0x27, 0x9a, 0x7e, 0xb3, 0x72, 0xa3, 0x1d, 0x5a, 0x63, 0x46,
-	0x63, 0x0e, 0x28, 0x59, 0xb8, 0x9a, 0x5e, 0x4c, 0xf6, 0x43, 0x78, 0xe8, 0xf3, 0xa8, 0x17, 0xed, 0x1e, 0x7d, 0x94,
-	0x55, 0xff, 0x8c, 0x3e, 0x94, 0xfd, 0xf4, 0xc9, 0xff, 0x00, 0x13, 0x96, 0x74, 0x3e };
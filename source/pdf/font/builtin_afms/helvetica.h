@@ -1,728 +0,0 @@
-// helvetica.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_HELVETICA[] = { 0x78, 0x9c, 0xb5, 0x7d, 0x5d, 0x73, 0x1b, 0xc9, 0xb1, 0xe5, 0xfb, 0x44, 0xcc,
-	0x7f, 0xc0, 0xe3, 0x6e, 0xc4, 0xd2, 0x8b, 0xef, 0x0f, 0xdf, 0x27, 0xd9, 0x33, 0x92, 0x6d, 0xce, 0x98, 0x92, 0x46,
-	0x22, 0xac, 0x7d, 0x03, 0xc9, 0xa6, 0x84, 0x2b, 0x10, 0x2d, 0x03, 0x6c, 0x92, 0xd0, 0xaf, 0xbf, 0xdd, 0x5d, 0x59,
-	0x95, 0xa7, 0xf2, 0x64, 0x41, 0x7e, 0xd9, 0x98, 0xb0, 0xcc, 0x3e, 0xa7, 0xba, 0xbb, 0x2a, 0x33, 0xeb, 0xd4, 0x77,
-	0xe3, 0x8f, 0xc7, 0xcd, 0xe1, 0xf1, 0x75, 0xbd, 0x7f, 0xfc, 0xbd, 0x7a, 0x3c, 0x6c, 0x6f, 0x8f, 0x83, 0xe9, 0x9f,
-	0x46, 0x3f, 0xff, 0xf4, 0xd7, 0xfa, 0xe1, 0xa1, 0xda, 0x3f, 0x0e, 0xfe, 0x5a, 0x7f, 0x3b, 0x1d, 0xb6, 0x9f, 0xbf,
-	0x3c, 0x0e, 0xfe, 0xd7, 0xed, 0xff, 0x1e, 0x8c, 0x56, 0xcb, 0xd9, 0xff, 0xe9, 0xfe, 0x5d, 0xf4, 0xff, 0xae, 0xba,
-	0x7f, 0x57, 0xc3, 0xfe, 0xdf, 0xc5, 0xe0, 0xd5, 0x5d, 0x7d, 0x53, 0x0d, 0xfe, 0x38, 0x1d, 0x1f, 0xab, 0x87, 0xe3,
-	0xe0, 0xef, 0xfb, 0xdb, 0xfa, 0xf0, 0xad, 0x3e, 0x6c, 0x1e, 0xab, 0xbb, 0x3f, 0x0d, 0x06, 0xaf, 0x76, 0xbb, 0xc1,
-	0xfb, 0xee, 0x39, 0xc7, 0xc1, 0xfb, 0xea, 0x58, 0x1d, 0x9e, 0x5a, 0x14, 0xde, 0x72, 0xa8, 0x36, 0x8f, 0xdb, 0x7a,
-	0x3f, 0xf8, 0xa5, 0x4d, 0xfe, 0xe7, 0xc1, 0x87, 0x2f, 0xcd, 0xe0, 0xf7, 0xcd, 0x69, 0x30, 0x18, 0x0d, 0x46, 0xe3,
-	0x3f, 0x4f, 0x96, 0x7f, 0x1e, 0x4f, 0xfa, 0x57, 0xe8, 0x0d, 0x1f, 0xf7, 0xdb, 0x7f, 0x37, 0xd5, 0xdf, 0x7f, 0x19,
-	0x4c, 0x27, 0xc3, 0xd9, 0x54, 0xf1, 0xeb, 0xdf, 0x9b, 0xe3, 0xe6, 0x73, 0x35, 0x98, 0x2c, 0x86, 0xf3, 0xd5, 0x60,
-	0xba, 0x1c, 0xae, 0x5a, 0xb2, 0x2b, 0xdc, 0x3f, 0x37, 0x0f, 0xd5, 0xe0, 0x6f, 0xd5, 0xee, 0xa9, 0x7a, 0xdc, 0xde,
-	0x6e, 0x5a, 0xac, 0xd9, 0xed, 0x08, 0xdb, 0x3c, 0x6c, 0x77, 0x27, 0x8b, 0xae, 0xab, 0xbe, 0xf8, 0xbf, 0x57, 0x77,
-	0xdb, 0xe6, 0xe1, 0xe7, 0x9f, 0xfe, 0xfe, 0xb8, 0xd9, 0x6d, 0x6f, 0x5f, 0xed, 0x3f, 0xef, 0xaa, 0xc1, 0xb0, 0xbd,
-	0x3c, 0xbe, 0xde, 0xbe, 0x54, 0x77, 0x6f, 0xb7, 0x8f, 0xb7, 0x5f, 0x06, 0xf7, 0x9b, 0xdd, 0xb1, 0x6a, 0x33, 0xf3,
-	0x65, 0x73, 0xd8, 0xdc, 0x3e, 0x56, 0x87, 0x3f, 0xaa, 0xc7, 0xc1, 0xaf, 0x2f, 0x8f, 0xd5, 0xfe, 0xae, 0xba, 0x7b,
-	0x5f, 0x3f, 0x6c, 0xf6, 0x21, 0x2f, 0x7f, 0xf9, 0x4b, 0xfd, 0x32, 0xb8, 0x18, 0xcd, 0xe7, 0x83, 0x8b, 0xf1, 0x78,
-	0x36, 0x18, 0x0d, 0x87, 0xc3, 0xc1, 0x6a, 0x32, 0x1a, 0xfc, 0xfc, 0xd3, 0xc7, 0x36, 0xe5, 0x61, 0xb7, 0xdd, 0x57,
-	0x6f, 0xeb, 0xe3, 0xb6, 0x37, 0xc8, 0x45, 0xcb, 0x02, 0xfe, 0xe1, 0xcb, 0xf6, 0xf6, 0xeb, 0xbe, 0x3a, 0x1e, 0x07,
-	0xb3, 0x16, 0xbe, 0xae, 0x0e, 0xc7, 0x2e, 0xd1, 0x70, 0x38, 0xfe, 0xd3, 0xb0, 0x4b, 0xf7, 0xcf, 0xba, 0xcd, 0x73,
-	0xf5, 0xff, 0xd5, 0x69, 0xc9, 0x32, 0x83, 0xed, 0x71, 0xb0, 0x19, 0x3c, 0x1e, 0x36, 0x77, 0xd5, 0xc3, 0xe6, 0xf0,
-	0x75, 0x50, 0xdf, 0x0f, 0x7e, 0xdb, 0xee, 0xeb, 0xc7, 0xd3, 0xb7, 0xea, 0xa2, 0x4d, 0xb4, 0x1b, 0xbc, 0x7a, 0x33,
-	0xd8, 0xec, 0xef, 0xfe, 0x6f, 0x7d, 0x18, 0x6c, 0xdb, 0x07, 0x1c, 0x9b, 0x9b, 0xe3, 0xf6, 0x6e, 0xbb, 0x39, 0x6c,
-	0xab, 0x63, 0xeb, 0xf9, 0x5f, 0xdb, 0x37, 0xdd, 0x6d, 0xf7, 0x9f, 0xff, 0xb8, 0xfd, 0x52, 0xb5, 0xf6, 0xee, 0xb3,
-	0xf1, 0xc7, 0x63, 0x9b, 0x7e, 0x73, 0xb8, 0x8b, 0x5c, 0x6b, 0xc9, 0xcd, 0xb7, 0xbf, 0x05, 0xf3, 0x2f, 0x46, 0xcb,
-	0x9f, 0x7f, 0xfa, 0x97, 0x5c, 0xcc, 0xc6, 0x93, 0x9f, 0x7f, 0x7a, 0x75, 0xbc, 0xed, 0x0c, 0x7b, 0x08, 0xd4, 0x2f,
-	0x55, 0xbc, 0xbc, 0x18, 0x0f, 0xdb, 0x40, 0xf9, 0xe3, 0xf1, 0xee, 0x6f, 0xeb, 0xc1, 0x62, 0xde, 0xff, 0x75, 0xbd,
-	0x1e, 0x2c, 0x97, 0xdd, 0x5f, 0x6d, 0xa4, 0x77, 0xce, 0x89, 0x91, 0x3e, 0x19, 0xcd, 0xda, 0x77, 0x0c, 0x26, 0xe3,
-	0xc1, 0x7f, 0x0d, 0xd6, 0xff, 0x1a, 0x8c, 0x17, 0xcb, 0xf6, 0x8f, 0x7f, 0x0e, 0x8e, 0xdf, 0x36, 0xad, 0x11, 0xff,
-	0x6b, 0xf0, 0x97, 0xc1, 0x50, 0xfe, 0xfb, 0xaf, 0x3e, 0xd9, 0x24, 0x4f, 0x56, 0xbd, 0xdc, 0xee, 0x36, 0x0f, 0x7d,
-	0xba, 0x55, 0x97, 0x68, 0xb4, 0x5c, 0x74, 0x79, 0x91, 0xc4, 0xd3, 0x90, 0x78, 0x32, 0x9b, 0xf5, 0x89, 0xff, 0xdd,
-	0xd4, 0xad, 0x4d, 0x6f, 0x76, 0x7d, 0xf2, 0xc5, 0x70, 0x30, 0x9d, 0x4f, 0x06, 0xe3, 0xe5, 0x0c, 0x6e, 0x98, 0x85,
-	0x1b, 0x66, 0xb3, 0x79, 0x7f, 0xc3, 0xbe, 0x79, 0xb8, 0xe9, 0xdc, 0xfb, 0x79, 0xdf, 0xdf, 0x32, 0x5e, 0xb6, 0x6f,
-	0x98, 0x8d, 0x57, 0x83, 0xf9, 0x32, 0xde, 0x30, 0xcf, 0x6f, 0xb8, 0xab, 0x77, 0xbb, 0xcd, 0xa1, 0x4f, 0xdc, 0x16,
-	0xe8, 0x62, 0x34, 0x9a, 0xb5, 0xe9, 0x87, 0x83, 0xc5, 0x62, 0x26, 0xe9, 0x17, 0x21, 0xfd, 0x72, 0xb9, 0xea, 0xd3,
-	0x7f, 0xab, 0x0e, 0xb7, 0x5d, 0x95, 0xe9, 0x6f, 0x58, 0xb5, 0x37, 0xac, 0x06, 0xcb, 0x59, 0x9b, 0x7e, 0x38, 0x91,
-	0xf4, 0xcb, 0x90, 0x7e, 0x3e, 0x5f, 0xf4, 0xe9, 0x37, 0x0f, 0xed, 0x1d, 0xc7, 0xd6, 0x43, 0xfd, 0x1d, 0xd3, 0x69,
-	0x7b, 0xc7, 0x6c, 0x30, 0x9f, 0x62, 0x11, 0x56, 0x62, 0xa0, 0xf1, 0x58, 0xcb, 0x1c, 0xe2, 0xb0, 0xbb, 0x65, 0x36,
-	0xe9, 0x4b, 0x3d, 0x9a, 0x81, 0x99, 0xa6, 0x43, 0x31, 0x53, 0x6f, 0xdc, 0x36, 0x53, 0x9b, 0x43, 0xb5, 0xdf, 0x55,
-	0xf7, 0xe1, 0x8e, 0xf9, 0xb2, 0xf7, 0xe6, 0x60, 0xbc, 0x5a, 0x0d, 0x16, 0x13, 0xc9, 0xd7, 0x74, 0xe4, 0xdc, 0xa2,
-	0x6f, 0x69, 0x0d, 0x1f, 0xee, 0x99, 0xcf, 0xe0, 0x1e, 0xf1, 0xf0, 0x44, 0xca, 0xbe, 0x39, 0x76, 0x19, 0x3b, 0x7e,
-	0x8d, 0x85, 0x9f, 0xb6, 0xb5, 0x6f, 0x32, 0x5d, 0x41, 0xbe, 0xc4, 0xd7, 0xb3, 0xe5, 0x34, 0xbc, 0x64, 0xd7, 0x1c,
-	0x63, 0xe2, 0xd6, 0x0f, 0x6d, 0xa9, 0x67, 0x43, 0xb1, 0xeb, 0x74, 0x9a, 0x87, 0xc5, 0x6d, 0x2b, 0x45, 0x9b, 0x3e,
-	0x6d, 0x1b, 0x0f, 0x17, 0xa3, 0xe9, 0xa2, 0xad, 0x68, 0xad, 0x8e, 0x0d, 0xe7, 0x92, 0x7c, 0x96, 0x67, 0xff, 0xcb,
-	0xe9, 0xdb, 0x97, 0x6a, 0x1f, 0x6d, 0x3a, 0x6e, 0x5d, 0x37, 0x6e, 0x33, 0x39, 0xe9, 0x4c, 0xd8, 0x27, 0x9f, 0xe7,
-	0x4f, 0x6f, 0x7d, 0xb0, 0xad, 0xef, 0xe2, 0xe3, 0x87, 0xe6, 0xd9, 0x0b, 0x13, 0xc8, 0xbb, 0xcd, 0xf1, 0x4b, 0x9f,
-	0xf6, 0x62, 0xb4, 0xe8, 0x3d, 0x3c, 0x5e, 0x75, 0x56, 0x59, 0x48, 0xf2, 0x65, 0x1e, 0x41, 0xdf, 0xab, 0x43, 0x1d,
-	0x0a, 0x19, 0x12, 0xcf, 0xda, 0xff, 0xa5, 0x70, 0x98, 0xae, 0xf2, 0xc4, 0xf5, 0x3e, 0x54, 0x91, 0xd1, 0x70, 0xd4,
-	0x66, 0x63, 0x32, 0x83, 0xa4, 0xb3, 0x61, 0x9e, 0xf4, 0xf1, 0x39, 0x3c, 0x76, 0x3c, 0xef, 0x6c, 0xd7, 0xfa, 0x46,
-	0x53, 0x8e, 0x4c, 0xca, 0x2f, 0x87, 0xaa, 0x4a, 0x6e, 0xec, 0xb2, 0xd0, 0xda, 0x41, 0x53, 0x8f, 0xf3, 0xd4, 0xf7,
-	0x75, 0x13, 0xe2, 0xbd, 0x15, 0xd1, 0xae, 0x72, 0x4c, 0x20, 0xe9, 0xc4, 0x24, 0xdd, 0x3e, 0x55, 0x5a, 0x35, 0xba,
-	0xa2, 0x4d, 0xb5, 0x26, 0xcd, 0xa6, 0x79, 0xe2, 0xe3, 0xf6, 0x25, 0xa4, 0x5d, 0x4a, 0xda, 0x25, 0x3c, 0xd8, 0x54,
-	0xd3, 0x63, 0xf5, 0x24, 0xde, 0x9b, 0x2c, 0x24, 0x13, 0xfa, 0x5c, 0x53, 0x43, 0x2b, 0x0d, 0xd2, 0xf8, 0x64, 0xb4,
-	0xc5, 0xc2, 0x08, 0xc0, 0x56, 0x2c, 0x3c, 0xd5, 0x2c, 0x6b, 0xe2, 0xa5, 0x0d, 0xba, 0x5d, 0xbd, 0xcf, 0xa3, 0x62,
-	0x36, 0x92, 0xa8, 0x98, 0xad, 0xf2, 0xb4, 0xc7, 0xea, 0x61, 0x9b, 0xa5, 0x4f, 0x41, 0x9a, 0x6e, 0x99, 0x47, 0x0f,
-	0x4a, 0xf8, 0xef, 0xba, 0x16, 0xa7, 0xcf, 0xcb, 0x72, 0x30, 0x6a, 0xd3, 0xb5, 0xda, 0x33, 0x5d, 0x49, 0xfc, 0xcf,
-	0x47, 0x79, 0xda, 0xea, 0xdf, 0xcd, 0x66, 0x17, 0xeb, 0x4a, 0xaf, 0x42, 0x6d, 0xc8, 0x4f, 0x56, 0x22, 0xa2, 0xf3,
-	0x71, 0x9e, 0xfa, 0x73, 0xd7, 0xf2, 0x57, 0x87, 0xe2, 0xc3, 0x8d, 0x1f, 0xdb, 0x46, 0xff, 0xd8, 0xb7, 0x8b, 0xbd,
-	0xa0, 0x74, 0xf1, 0x34, 0x5d, 0xb5, 0x11, 0x32, 0x96, 0x88, 0x9e, 0x8b, 0x27, 0xdb, 0xa0, 0x0c, 0xb2, 0xbb, 0x09,
-	0xf6, 0xee, 0x0a, 0xd8, 0x0b, 0x5c, 0xab, 0x28, 0x29, 0xfc, 0xe7, 0xb3, 0x5c, 0xe0, 0x5e, 0x49, 0xd2, 0xf6, 0xa1,
-	0xf3, 0x36, 0x24, 0x92, 0x16, 0xcc, 0xe7, 0x79, 0xba, 0xbf, 0x04, 0x0d, 0xef, 0xd3, 0x8d, 0x41, 0xcb, 0xe6, 0xe2,
-	0xc0, 0x85, 0xc8, 0xdf, 0x5f, 0x55, 0x28, 0x3b, 0xd9, 0x1e, 0xc1, 0x9b, 0x97, 0x79, 0xca, 0x5f, 0x82, 0x27, 0xba,
-	0x8a, 0x34, 0x5f, 0xe0, 0x9b, 0x57, 0xf9, 0x9b, 0x7f, 0x0d, 0xe9, 0xba, 0x62, 0xcf, 0x5b, 0x57, 0xa5, 0x74, 0x0b,
-	0x71, 0xd7, 0x7c, 0x34, 0xea, 0xd3, 0xbd, 0xd6, 0x74, 0xb3, 0xe5, 0x04, 0xd2, 0x89, 0xab, 0x16, 0x12, 0x09, 0x6f,
-	0xa2, 0xd9, 0x2f, 0xfa, 0x9a, 0x3e, 0xd5, 0x1c, 0x2e, 0xc6, 0x79, 0x0e, 0xff, 0x16, 0xca, 0xdc, 0xc5, 0xd6, 0x7c,
-	0x8a, 0x6f, 0x36, 0x6d, 0xe2, 0xdf, 0x43, 0x73, 0x38, 0xea, 0x9b, 0xc3, 0x25, 0xa4, 0x8b, 0x55, 0x6c, 0x38, 0xec,
-	0xd3, 0xfd, 0x23, 0xd8, 0x3a, 0x78, 0x65, 0x3a, 0xc6, 0x94, 0xc6, 0x2b, 0x97, 0xe1, 0xcd, 0x7d, 0x99, 0xe7, 0x58,
-	0x16, 0x53, 0xb9, 0x7e, 0xd3, 0x74, 0xb3, 0x09, 0x78, 0x65, 0x11, 0x9b, 0x3d, 0xd1, 0xdb, 0xdf, 0x43, 0xba, 0x49,
-	0x9b, 0x6e, 0xd1, 0x86, 0xae, 0xa6, 0x33, 0x3e, 0xf9, 0x27, 0xbc, 0x37, 0x2b, 0xf1, 0x2a, 0xb7, 0xe1, 0x15, 0x36,
-	0xa0, 0x8b, 0xc9, 0x4a, 0x6d, 0xb8, 0x1c, 0xe6, 0x25, 0x79, 0x0b, 0xde, 0xeb, 0x64, 0x2d, 0x3e, 0x71, 0x69, 0xbc,
-	0xf2, 0x2e, 0x3d, 0xb1, 0x2d, 0x5a, 0xfe, 0x44, 0xe3, 0x95, 0xf7, 0xe1, 0x89, 0x5d, 0xd7, 0x60, 0xbe, 0x84, 0xb8,
-	0x59, 0x4e, 0xf2, 0x37, 0xff, 0x11, 0xfc, 0x1c, 0xf2, 0x38, 0xef, 0x3a, 0x05, 0xe9, 0x89, 0xd3, 0x3c, 0x72, 0x3e,
-	0x68, 0x1d, 0x98, 0xad, 0xc0, 0x8a, 0xcb, 0x59, 0xfe, 0xe6, 0x8f, 0xc1, 0x3a, 0xf2, 0xc4, 0x29, 0xbe, 0xdb, 0xd4,
-	0x96, 0xeb, 0xa0, 0xd0, 0xc3, 0xde, 0x8e, 0xf8, 0x44, 0xf1, 0xcb, 0x6a, 0x1a, 0x84, 0x60, 0x1d, 0xde, 0xdc, 0x59,
-	0x67, 0x85, 0xf1, 0xb0, 0x34, 0xdd, 0x90, 0x7f, 0x85, 0x74, 0xab, 0xfe, 0x79, 0x98, 0xce, 0xd4, 0x95, 0x4f, 0x58,
-	0x9b, 0x21, 0x6e, 0x56, 0xa6, 0xae, 0xfc, 0xbf, 0x90, 0xbf, 0x49, 0x5f, 0x57, 0xe0, 0x79, 0xab, 0x51, 0x1e, 0xd9,
-	0x37, 0x6d, 0x97, 0xfe, 0x6b, 0xf5, 0xa8, 0x7d, 0x93, 0x49, 0x57, 0xf6, 0x79, 0xdb, 0xf6, 0x0c, 0x83, 0x55, 0xfa,
-	0x9b, 0x4c, 0x4f, 0xf2, 0xa6, 0xbd, 0xe7, 0x07, 0x8d, 0xf0, 0x6a, 0xe2, 0xbe, 0x47, 0x3b, 0x34, 0xe3, 0xa5, 0xbc,
-	0xa8, 0x95, 0x34, 0x7d, 0x91, 0xf8, 0x6d, 0x3a, 0x8f, 0x1d, 0x9a, 0xdb, 0xed, 0xf6, 0x76, 0x7b, 0xb8, 0x6d, 0x1e,
-	0xe4, 0x55, 0x6d, 0x5f, 0xa2, 0x55, 0xc3, 0xe9, 0x12, 0xda, 0xa3, 0x95, 0x69, 0xbb, 0x9a, 0xae, 0xbf, 0x7c, 0x6c,
-	0x7b, 0xfc, 0xb1, 0xb3, 0x7b, 0x31, 0x6a, 0x5b, 0xd2, 0x8e, 0xbd, 0x88, 0x9d, 0xc6, 0x55, 0xec, 0x7e, 0x60, 0x97,
-	0x4e, 0x6d, 0x30, 0x6b, 0xbb, 0x1c, 0x6d, 0x4d, 0x6f, 0x33, 0xb1, 0x18, 0xc7, 0x3b, 0x4c, 0x33, 0x16, 0xba, 0x42,
-	0xad, 0xa6, 0x77, 0xdd, 0xc5, 0xd9, 0xa4, 0xab, 0x9d, 0x31, 0x3b, 0xa6, 0xfb, 0x71, 0x13, 0x44, 0x7d, 0x19, 0x52,
-	0x8e, 0x20, 0x56, 0x56, 0xb1, 0xef, 0x21, 0xea, 0x71, 0x1b, 0x9e, 0x39, 0xec, 0x53, 0x4e, 0xdb, 0x1a, 0x9e, 0x9e,
-	0x39, 0x1a, 0x9a, 0xbe, 0x47, 0xe8, 0x2a, 0xb5, 0x9d, 0xeb, 0x3e, 0xe9, 0x0a, 0xba, 0x78, 0x5d, 0xc7, 0x25, 0x6f,
-	0x9e, 0x43, 0x2d, 0x19, 0xca, 0xfb, 0xe7, 0xf8, 0x54, 0xe3, 0xd7, 0x7b, 0x0d, 0xae, 0xf1, 0xbc, 0x6b, 0x7f, 0x3a,
-	0xf8, 0xb7, 0xc1, 0xb6, 0xed, 0x67, 0xf4, 0x7f, 0xec, 0x06, 0xf7, 0xbb, 0x78, 0xab, 0x69, 0xc1, 0x3e, 0xa7, 0xb7,
-	0x8c, 0xc7, 0xc3, 0x3e, 0x47, 0xf0, 0x1a, 0xd3, 0x11, 0xf9, 0x12, 0xad, 0xdc, 0x25, 0x1c, 0x61, 0xd6, 0x67, 0xb9,
-	0x5b, 0xb6, 0x21, 0x61, 0xdf, 0xf4, 0xcf, 0x66, 0x98, 0xd0, 0xf8, 0xef, 0xbf, 0x25, 0x3a, 0xba, 0xa1, 0xe7, 0x88,
-	0x12, 0x2f, 0x72, 0x33, 0x7f, 0xd5, 0xa7, 0xce, 0x86, 0xd9, 0xeb, 0x97, 0xf9, 0x53, 0x77, 0xc5, 0xd7, 0xaf, 0x72,
-	0xf1, 0x7d, 0xd0, 0x02, 0x2d, 0xe6, 0x58, 0xf2, 0x91, 0x71, 0xdb, 0x3e, 0x2f, 0x39, 0x24, 0x34, 0x4e, 0xab, 0xd5,
-	0xbf, 0xd3, 0xb6, 0xf7, 0x95, 0x25, 0x35, 0xdd, 0xc5, 0x6f, 0x29, 0xbe, 0xba, 0xf1, 0x41, 0x17, 0x60, 0x90, 0xd6,
-	0xf6, 0x33, 0xd2, 0x63, 0xbb, 0xb4, 0xd3, 0xb6, 0xba, 0x41, 0xda, 0x38, 0xb4, 0x93, 0x42, 0x1d, 0xb4, 0x6d, 0x9c,
-	0xb4, 0xdd, 0x4b, 0x48, 0x38, 0xcb, 0xed, 0x29, 0x23, 0x88, 0x71, 0x88, 0xc5, 0x79, 0xf6, 0x4c, 0xd3, 0xcd, 0x8f,
-	0xdd, 0x96, 0xb6, 0x26, 0xb6, 0x0a, 0xb3, 0x68, 0x55, 0x6d, 0x15, 0x53, 0x9a, 0xfa, 0xd5, 0x0c, 0xe2, 0x48, 0xa9,
-	0x7b, 0xe8, 0x72, 0xd5, 0x77, 0x41, 0x25, 0xe9, 0x32, 0x7f, 0xff, 0x53, 0x68, 0x2e, 0xa4, 0xd3, 0x04, 0xe9, 0x62,
-	0x93, 0x26, 0xee, 0x7c, 0xd6, 0xe8, 0x5e, 0x0c, 0xf1, 0x81, 0xe3, 0x61, 0xfe, 0xc0, 0xd0, 0x4d, 0x1e, 0x8d, 0xfa,
-	0x27, 0x0e, 0x31, 0xe1, 0x28, 0x4f, 0x78, 0x8a, 0x09, 0xdb, 0xa8, 0x9b, 0x9a, 0x5c, 0x8e, 0xc7, 0x79, 0xda, 0xef,
-	0xc1, 0x4a, 0xfd, 0x43, 0xe7, 0x59, 0xc2, 0x49, 0xb4, 0xfb, 0x34, 0x29, 0xa5, 0x6a, 0x51, 0xe8, 0x25, 0xb7, 0x32,
-	0xd9, 0xf7, 0x07, 0xc7, 0xf1, 0x9e, 0x38, 0x38, 0x9b, 0x0f, 0x45, 0x90, 0x83, 0xb7, 0x56, 0x53, 0x99, 0x7b, 0x69,
-	0x83, 0x36, 0x8d, 0x90, 0x3b, 0xf5, 0xe3, 0x37, 0xa8, 0x12, 0x17, 0x5e, 0x11, 0x3b, 0x22, 0xd2, 0xa3, 0xed, 0xa5,
-	0xf8, 0x71, 0xbb, 0xbb, 0x0b, 0x7a, 0xd2, 0xf6, 0x31, 0x46, 0xcb, 0x60, 0x9b, 0xc9, 0x58, 0xba, 0xd7, 0xa3, 0xb9,
-	0x19, 0xc3, 0x86, 0xa9, 0x84, 0xbb, 0xfa, 0x79, 0x2f, 0x86, 0xea, 0x35, 0x7f, 0xd6, 0x6b, 0xbe, 0x1a, 0x60, 0x6e,
-	0x02, 0x3a, 0x0d, 0xdf, 0xdb, 0x61, 0x54, 0x18, 0xef, 0xb7, 0x61, 0x3c, 0xd7, 0xe4, 0x26, 0xa6, 0xbb, 0x31, 0xef,
-	0x6e, 0xbb, 0x0f, 0x02, 0x34, 0x99, 0xf4, 0x2a, 0x30, 0x9b, 0xa0, 0x22, 0xa6, 0xee, 0xb3, 0xb4, 0xa1, 0xf7, 0xdd,
-	0x34, 0x56, 0xec, 0x6d, 0x87, 0x09, 0xab, 0x36, 0x56, 0xba, 0x4c, 0xa7, 0x81, 0xc8, 0x68, 0x6e, 0x1a, 0x95, 0x53,
-	0x1c, 0x0e, 0x75, 0xaa, 0x31, 0x83, 0xd6, 0x67, 0x34, 0x37, 0x3d, 0xb6, 0xfb, 0x5d, 0x7d, 0xd8, 0xc6, 0x67, 0x8f,
-	0xa4, 0x56, 0x0e, 0xa1, 0x9b, 0x3c, 0x9a, 0x9b, 0x58, 0x3f, 0x56, 0x9a, 0x9d, 0x69, 0xdf, 0xfe, 0x76, 0x63, 0x96,
-	0x31, 0xde, 0x61, 0xda, 0x94, 0xdb, 0xe6, 0x70, 0xa8, 0xf6, 0xb7, 0xa7, 0xd8, 0x92, 0x76, 0x72, 0xdb, 0xfe, 0xdf,
-	0x5c, 0xb3, 0x2f, 0xb1, 0x3f, 0x5a, 0x8d, 0xb4, 0x81, 0x3b, 0x6e, 0xfb, 0xe9, 0xbd, 0xde, 0xb4, 0xab, 0x30, 0x69,
-	0x31, 0x81, 0x0e, 0xdb, 0x68, 0x61, 0x66, 0x2d, 0xe2, 0xe4, 0x4e, 0x0a, 0xc6, 0xb6, 0x5e, 0x77, 0x0d, 0xe3, 0xa4,
-	0x1b, 0xeb, 0xc6, 0x86, 0x71, 0xb4, 0x30, 0xd2, 0xf5, 0xb9, 0xd9, 0xb6, 0x77, 0x3c, 0xd4, 0xda, 0xa7, 0x68, 0xdb,
-	0xce, 0x4e, 0x5b, 0xa7, 0xdd, 0x4b, 0xa7, 0x31, 0x56, 0x62, 0x57, 0x3c, 0xbe, 0xac, 0xbb, 0xad, 0xcf, 0x60, 0xba,
-	0xad, 0xb5, 0x70, 0x77, 0xdb, 0xb8, 0x1d, 0x67, 0xc1, 0x6d, 0x93, 0xc2, 0x6d, 0x1a, 0xcf, 0xfe, 0x7d, 0xa6, 0xa7,
-	0x7e, 0xbf, 0x55, 0x35, 0x98, 0xb6, 0xf5, 0xa2, 0x6f, 0xeb, 0x42, 0x4a, 0x23, 0x6f, 0xf7, 0x3b, 0x4c, 0x39, 0xc6,
-	0x94, 0xc6, 0x8f, 0xd5, 0xfe, 0x2e, 0xf6, 0x89, 0xda, 0x06, 0x74, 0x3a, 0xec, 0x89, 0xc9, 0x28, 0xfa, 0x64, 0x61,
-	0x9c, 0x78, 0xb7, 0xf9, 0xfc, 0x39, 0x0e, 0x11, 0x3b, 0xaf, 0xcf, 0x64, 0x30, 0xac, 0xfe, 0x58, 0x79, 0x37, 0xc4,
-	0xd9, 0x36, 0xff, 0x9e, 0xd8, 0x3b, 0xcf, 0x27, 0x56, 0xba, 0x2a, 0x55, 0x1d, 0xaa, 0xbb, 0x28, 0xe9, 0xa3, 0x56,
-	0xd6, 0xc6, 0x6d, 0xeb, 0x3f, 0x19, 0x45, 0x2f, 0xc6, 0x3e, 0xf8, 0x6c, 0x12, 0xea, 0xc8, 0xb7, 0xcd, 0x61, 0xf3,
-	0xf9, 0xb0, 0xf9, 0x16, 0x8a, 0xd3, 0x57, 0xdc, 0xd6, 0xf4, 0x53, 0xec, 0x3c, 0x8f, 0x62, 0x7f, 0x7c, 0x32, 0x13,
-	0x15, 0x6a, 0x5a, 0xe7, 0x3d, 0xc6, 0x1b, 0xfa, 0xe7, 0xb7, 0x5e, 0xea, 0x5a, 0x24, 0x49, 0x1f, 0x55, 0x0b, 0x7b,
-	0x5d, 0xbd, 0xf3, 0x6e, 0x36, 0x47, 0x89, 0xcb, 0xae, 0x50, 0x6d, 0x8f, 0xbe, 0x9b, 0x4d, 0x4b, 0xf3, 0x3f, 0xa3,
-	0xa5, 0x99, 0x5c, 0x8a, 0x81, 0x99, 0x6e, 0x1b, 0xcf, 0xc3, 0x6d, 0x5d, 0x17, 0x14, 0x6e, 0x9b, 0xfb, 0xb7, 0x41,
-	0x27, 0x74, 0x1e, 0x66, 0x2c, 0x57, 0xd8, 0xba, 0x2f, 0x8d, 0x5b, 0x53, 0x40, 0xeb, 0x7d, 0x6e, 0x44, 0xc7, 0x2e,
-	0x7d, 0x3f, 0xf1, 0xdd, 0xc7, 0xc3, 0x6e, 0xb7, 0xfd, 0x76, 0xdc, 0x1e, 0x45, 0xfc, 0xba, 0x56, 0x7f, 0xb9, 0xcc,
-	0x32, 0xb8, 0x32, 0x77, 0xb4, 0xde, 0x7a, 0xfc, 0x52, 0x37, 0x69, 0x3a, 0x32, 0x74, 0xac, 0x57, 0x2b, 0x98, 0x22,
-	0x19, 0xc5, 0x1e, 0x7c, 0xec, 0xe9, 0xc7, 0xb9, 0x83, 0x24, 0xb3, 0xab, 0x5e, 0x74, 0x5a, 0x09, 0x69, 0x47, 0xf1,
-	0xb3, 0x54, 0x4d, 0x57, 0xb6, 0xe2, 0x1c, 0x36, 0x32, 0x77, 0xd4, 0xf5, 0x30, 0x5a, 0x76, 0x3c, 0xea, 0x34, 0x6a,
-	0x1a, 0x93, 0x9b, 0xde, 0xc0, 0xe6, 0xb6, 0x79, 0x94, 0xe4, 0xad, 0xf7, 0xba, 0xf4, 0x93, 0x7e, 0x60, 0x98, 0xd2,
-	0x1b, 0x17, 0x85, 0x4e, 0xfb, 0xfd, 0xae, 0x0a, 0x8d, 0x69, 0xd7, 0x83, 0xe9, 0xef, 0x19, 0xe3, 0x3d, 0xc6, 0x3f,
-	0xda, 0xba, 0x5c, 0x4c, 0x5b, 0x2d, 0x6b, 0xeb, 0x4e, 0x37, 0xe2, 0x4d, 0x2d, 0x52, 0xec, 0x82, 0xc7, 0xe4, 0x0f,
-	0x9b, 0xdb, 0x83, 0xa8, 0xe6, 0x28, 0xcc, 0x59, 0x4c, 0xfa, 0x69, 0xaa, 0xf4, 0xf8, 0x65, 0x9e, 0xfe, 0xe6, 0x50,
-	0xc5, 0x12, 0xb7, 0x51, 0xd9, 0x66, 0x78, 0x32, 0xee, 0x4a, 0x3c, 0x8a, 0xc9, 0x57, 0x79, 0xf2, 0xbb, 0xfa, 0x71,
-	0x73, 0x9b, 0xda, 0xa2, 0xae, 0xed, 0x9f, 0xb7, 0x1d, 0xd9, 0x71, 0x57, 0x82, 0xe8, 0xc0, 0xf1, 0xd0, 0x28, 0xe6,
-	0xdd, 0xb6, 0xad, 0x65, 0xd1, 0xe3, 0xad, 0x00, 0xf4, 0x77, 0xac, 0x26, 0x78, 0x87, 0x91, 0xbd, 0x43, 0x6c, 0xb9,
-	0x5a, 0xd9, 0x99, 0xb5, 0x9a, 0x38, 0xee, 0x66, 0x1c, 0x67, 0x29, 0xb5, 0x71, 0xda, 0x6d, 0x75, 0xd7, 0xc6, 0x62,
-	0x18, 0x7b, 0x4c, 0x67, 0xa1, 0xad, 0xef, 0xee, 0x18, 0xc6, 0xf4, 0x76, 0x16, 0xb6, 0xd9, 0x7f, 0xde, 0x1c, 0x9a,
-	0x87, 0xdd, 0xa6, 0x11, 0x05, 0x0f, 0x7e, 0x98, 0x0e, 0xc1, 0x77, 0xe3, 0xa1, 0xf1, 0x43, 0xfd, 0xb9, 0xde, 0x57,
-	0xa1, 0x97, 0xdc, 0xd6, 0xf9, 0xf0, 0x92, 0x7e, 0xfe, 0x4d, 0x92, 0x1b, 0x3f, 0xdc, 0x6e, 0xa2, 0x1b, 0x3c, 0x2f,
-	0x8f, 0x87, 0x54, 0x2d, 0x1e, 0x8c, 0x4c, 0xf6, 0x4c, 0xd2, 0xc9, 0x71, 0xec, 0xae, 0xa4, 0x1b, 0x5e, 0xc9, 0x04,
-	0x51, 0x37, 0x86, 0x9e, 0x41, 0x87, 0x7d, 0x3c, 0x8e, 0x39, 0x59, 0x84, 0x84, 0xf5, 0xe1, 0xee, 0xbe, 0x7a, 0xd8,
-	0xa6, 0x29, 0xc6, 0xb6, 0x9b, 0x34, 0x6d, 0x4d, 0x32, 0xe9, 0x26, 0x3a, 0x62, 0x5b, 0x3a, 0x9e, 0x98, 0xee, 0xc6,
-	0x6f, 0x30, 0x92, 0xed, 0xc7, 0xf3, 0xd9, 0x3c, 0xcb, 0x38, 0x2e, 0x8f, 0xa4, 0x89, 0x11, 0x4d, 0x1e, 0x67, 0x47,
-	0xa6, 0x43, 0x7c, 0xfc, 0xd4, 0xe4, 0xfe, 0x2a, 0xe4, 0x7e, 0x12, 0x7a, 0x19, 0xab, 0xf9, 0x0c, 0x13, 0x47, 0x7f,
-	0xcd, 0x67, 0xb1, 0x00, 0x0f, 0x6d, 0x47, 0xab, 0xd9, 0xa5, 0x12, 0xcc, 0xa4, 0x04, 0xd0, 0x7f, 0x18, 0xc7, 0xa5,
-	0x82, 0xb8, 0xe4, 0xb1, 0xa9, 0xf4, 0x0d, 0xb3, 0xc1, 0x72, 0x0a, 0x23, 0x80, 0x71, 0x9c, 0x97, 0x8f, 0xed, 0xc1,
-	0x5d, 0xd7, 0x2e, 0x1f, 0x8f, 0xa1, 0xf5, 0x5b, 0xcd, 0xfa, 0x09, 0xad, 0x89, 0x76, 0xc6, 0xc6, 0x53, 0x3b, 0x06,
-	0xb2, 0xd6, 0x19, 0x4f, 0xa1, 0xcb, 0x30, 0x8e, 0xd3, 0xe7, 0x51, 0x8c, 0x6a, 0x4d, 0xde, 0x0d, 0xf0, 0x3b, 0xa9,
-	0x68, 0xb3, 0xdd, 0x4d, 0x95, 0x86, 0xf4, 0x71, 0x0e, 0x3d, 0x4e, 0x8f, 0xd4, 0x92, 0xf5, 0x30, 0x90, 0x5d, 0x0d,
-	0x61, 0x9c, 0x31, 0x9e, 0x19, 0xa1, 0x6b, 0xdb, 0xbe, 0x87, 0x56, 0x18, 0x6f, 0x76, 0xa1, 0x7a, 0xcd, 0x17, 0x61,
-	0x44, 0xdb, 0xf6, 0x3f, 0x52, 0x93, 0x7c, 0x61, 0x66, 0x37, 0xfe, 0x9e, 0x55, 0xc8, 0xd1, 0xa4, 0x1f, 0xd8, 0xce,
-	0xdb, 0xf7, 0x8c, 0xf2, 0xf4, 0xa9, 0x05, 0x57, 0x99, 0x83, 0x01, 0x73, 0x8a, 0x65, 0x9b, 0x7c, 0xa3, 0x92, 0x02,
-	0x33, 0x01, 0x49, 0x52, 0x6c, 0xf2, 0x86, 0xaa, 0xa3, 0x8c, 0x6f, 0x66, 0xe3, 0x51, 0xf9, 0x25, 0x95, 0xd6, 0xaf,
-	0x73, 0x79, 0x4a, 0x13, 0x44, 0x79, 0x91, 0xe3, 0x44, 0x11, 0x17, 0x59, 0xfa, 0xf5, 0x77, 0xdb, 0xa7, 0xad, 0xa8,
-	0xae, 0xc4, 0x73, 0xbf, 0x0c, 0x34, 0x2e, 0x3d, 0x1e, 0x1a, 0x82, 0xf4, 0xec, 0xf1, 0xca, 0x4f, 0xfc, 0xca, 0xb4,
-	0x02, 0x69, 0x12, 0x9a, 0xee, 0x48, 0x16, 0xd5, 0xc7, 0x67, 0x16, 0x35, 0xb9, 0x49, 0xf3, 0x75, 0xe6, 0x05, 0x30,
-	0x73, 0xc7, 0xaf, 0x88, 0x83, 0x36, 0x28, 0x01, 0x8c, 0xdc, 0xd8, 0xfe, 0x71, 0x78, 0xdb, 0xaf, 0x7c, 0x41, 0x53,
-	0xd0, 0x8d, 0x74, 0x3b, 0x91, 0xca, 0x86, 0xba, 0xec, 0xb5, 0x3c, 0x67, 0xe7, 0x5c, 0x97, 0x4a, 0xa3, 0x8d, 0x01,
-	0x94, 0xc3, 0x46, 0x53, 0x4a, 0x9d, 0x39, 0x1a, 0xef, 0x28, 0x45, 0xf7, 0x06, 0x84, 0x7d, 0x32, 0x0f, 0x33, 0x35,
-	0x33, 0x54, 0x0b, 0x7a, 0x85, 0x9a, 0xea, 0xac, 0x65, 0x63, 0x7c, 0xc3, 0xf3, 0xfb, 0x35, 0xce, 0x6e, 0xda, 0x6d,
-	0x04, 0x63, 0x5d, 0x1b, 0x1f, 0xbf, 0x66, 0x45, 0x48, 0x0b, 0x00, 0x54, 0x80, 0xb4, 0xa0, 0xd0, 0x36, 0xf8, 0xb2,
-	0xf4, 0x31, 0xb4, 0x8b, 0x0a, 0xa9, 0xea, 0x4b, 0x67, 0xd4, 0x7a, 0xad, 0x5b, 0x10, 0xea, 0x87, 0xc6, 0xcb, 0xd6,
-	0xe9, 0xd3, 0xa1, 0x79, 0x81, 0xf4, 0x7a, 0x6f, 0xd3, 0x0e, 0x83, 0x38, 0xdb, 0xd8, 0x0b, 0xfc, 0x0c, 0xc6, 0x62,
-	0x54, 0x06, 0xe8, 0x86, 0xa4, 0x12, 0x2c, 0x17, 0x85, 0xe0, 0xbb, 0xd5, 0xca, 0x0c, 0xf3, 0x7c, 0x65, 0x81, 0x49,
-	0x11, 0x81, 0xb5, 0x21, 0x76, 0x0f, 0xac, 0x79, 0xfe, 0x69, 0xcb, 0xbc, 0x90, 0xad, 0x18, 0xd9, 0x4c, 0x7f, 0x32,
-	0x54, 0x54, 0x78, 0x75, 0x72, 0x3f, 0xd5, 0xd5, 0xcd, 0xaf, 0x96, 0xeb, 0xa7, 0x76, 0x1b, 0xcf, 0xd5, 0xcf, 0x34,
-	0xef, 0x6e, 0x73, 0x34, 0x92, 0x09, 0x8a, 0x6c, 0x16, 0xde, 0x96, 0xe3, 0xaf, 0xa0, 0xc2, 0xba, 0xcc, 0x54, 0xce,
-	0x93, 0xf6, 0x1b, 0x31, 0x4f, 0xb1, 0xdf, 0xc8, 0x41, 0x97, 0x75, 0xec, 0xca, 0x51, 0xa7, 0x02, 0xa0, 0x3e, 0xd3,
-	0x49, 0xae, 0x33, 0x7a, 0x01, 0x9d, 0xb4, 0xb3, 0x5a, 0x11, 0x5b, 0xa9, 0xad, 0x96, 0xb7, 0x6f, 0x91, 0xfb, 0x89,
-	0x18, 0xfb, 0xf8, 0xe9, 0x22, 0x98, 0x74, 0x57, 0x7f, 0xaf, 0xf6, 0x9f, 0xe3, 0x22, 0x75, 0x3f, 0x9b, 0x34, 0xe6,
-	0x06, 0x30, 0x2d, 0xa5, 0x68, 0xde, 0xd3, 0x7a, 0x0a, 0x19, 0x32, 0xad, 0x9b, 0x59, 0x6f, 0x4d, 0xa5, 0x12, 0x67,
-	0x6b, 0x68, 0x54, 0xeb, 0x8d, 0xd2, 0xc1, 0x9c, 0x5d, 0x39, 0xae, 0xcd, 0x3d, 0x67, 0x63, 0x29, 0x36, 0x26, 0xd8,
-	0xdf, 0x8f, 0x0d, 0x09, 0x55, 0xb4, 0xd4, 0xaf, 0xd6, 0x82, 0xcf, 0xc3, 0x4a, 0xbe, 0x63, 0x53, 0xad, 0x95, 0xe8,
-	0xb2, 0xa1, 0xb8, 0x6c, 0xe1, 0x28, 0x63, 0x5a, 0x5e, 0xc9, 0x83, 0x28, 0xad, 0xb3, 0x50, 0x10, 0xc5, 0xdc, 0x7f,
-	0xf8, 0x52, 0x1f, 0x50, 0x24, 0x70, 0xa5, 0xcc, 0xfa, 0xe1, 0x0a, 0x4a, 0x0a, 0x2b, 0x70, 0x54, 0xd6, 0xe4, 0x64,
-	0x8d, 0x9f, 0xb2, 0x93, 0xd3, 0xa2, 0x19, 0x54, 0x2e, 0x5d, 0x39, 0xe3, 0xe4, 0x53, 0x19, 0xd1, 0x40, 0xf0, 0x87,
-	0x4e, 0xda, 0x1c, 0xa7, 0xc2, 0xa9, 0xc5, 0x80, 0xac, 0x43, 0x93, 0xc1, 0x7a, 0x18, 0x83, 0x27, 0x09, 0x1c, 0x86,
-	0x8d, 0x15, 0xb8, 0x34, 0x40, 0xec, 0xf6, 0x51, 0x1c, 0x9b, 0x7e, 0x4e, 0x23, 0x4c, 0x9c, 0xb4, 0x23, 0x93, 0x6e,
-	0x42, 0xaa, 0x8f, 0xd1, 0x49, 0xc1, 0x9a, 0x20, 0x59, 0x6a, 0xcc, 0x72, 0x9f, 0x25, 0x1b, 0x18, 0x17, 0xba, 0x2b,
-	0x29, 0x31, 0x8c, 0x29, 0x35, 0xb1, 0xc9, 0x7d, 0xec, 0x69, 0x3d, 0x34, 0xbb, 0xc7, 0xed, 0xb7, 0xdd, 0x29, 0x66,
-	0x25, 0x6e, 0xb8, 0xb1, 0xc9, 0xa3, 0x69, 0x40, 0x97, 0xcf, 0x54, 0x29, 0x95, 0xda, 0x4d, 0x56, 0x3b, 0x3a, 0x85,
-	0xa5, 0x7c, 0x4f, 0x17, 0xb2, 0x66, 0xb0, 0x39, 0x3c, 0x6e, 0x37, 0xbb, 0xbb, 0xed, 0xbd, 0x2c, 0xf9, 0xb4, 0xc3,
-	0xbc, 0x6e, 0x72, 0xaf, 0x5f, 0x89, 0x2e, 0x54, 0x92, 0x53, 0xde, 0xb1, 0xc4, 0xae, 0x93, 0x2d, 0x42, 0x6a, 0x90,
-	0xa0, 0xff, 0x10, 0x57, 0x9c, 0x29, 0x4f, 0x49, 0x05, 0x8d, 0x26, 0x5c, 0x74, 0x77, 0xf4, 0x7b, 0xc9, 0x4a, 0x8a,
-	0xf0, 0xab, 0xb9, 0x43, 0xa5, 0xbc, 0xd8, 0x54, 0x64, 0x65, 0x40, 0xd5, 0x29, 0x79, 0xa1, 0xb2, 0x43, 0xfa, 0xd4,
-	0x8b, 0xa3, 0x3b, 0xa2, 0x98, 0x40, 0x17, 0xf6, 0x3f, 0x68, 0xe2, 0xf7, 0xe0, 0xe6, 0xb4, 0x22, 0x56, 0x4a, 0xdc,
-	0x40, 0xf5, 0x82, 0xa0, 0x48, 0x73, 0x1e, 0xdc, 0x23, 0x48, 0x41, 0xf1, 0x63, 0x07, 0xfc, 0x1d, 0x9a, 0xa1, 0x91,
-	0x34, 0x43, 0x6c, 0x49, 0xd8, 0x39, 0xd6, 0x8e, 0xb4, 0x79, 0xfb, 0x98, 0xb1, 0x4a, 0x5a, 0xa1, 0x38, 0xd4, 0x5f,
-	0xab, 0x3d, 0xae, 0x53, 0x8c, 0x66, 0xc3, 0xb0, 0x4e, 0x31, 0x2c, 0x74, 0xc6, 0x0e, 0xd5, 0xe7, 0xed, 0x51, 0xa7,
-	0x2d, 0xcf, 0xf6, 0xc6, 0x52, 0x13, 0xa6, 0x15, 0x72, 0xaa, 0xfb, 0x3f, 0xa8, 0x4a, 0xea, 0xf8, 0x30, 0x93, 0xf1,
-	0xb4, 0xc1, 0x83, 0x65, 0x3c, 0x36, 0xee, 0x4d, 0xdb, 0x42, 0xa6, 0xc9, 0xfa, 0x51, 0xa7, 0x88, 0x9d, 0xf0, 0x3b,
-	0xe1, 0x90, 0x82, 0x54, 0xf5, 0xa4, 0x1c, 0x9f, 0xa9, 0xd5, 0x82, 0x0a, 0x13, 0x17, 0xde, 0x8a, 0xc1, 0x50, 0x63,
-	0x33, 0xa1, 0x2b, 0x85, 0x14, 0x0c, 0xa9, 0xcd, 0xd2, 0x87, 0x6b, 0x7b, 0x45, 0xca, 0x16, 0x13, 0xc3, 0xac, 0x4e,
-	0x31, 0xf1, 0x6c, 0x1a, 0x26, 0x20, 0x64, 0xb7, 0x93, 0x6e, 0x91, 0x0a, 0x5b, 0xe2, 0xba, 0xd9, 0xb8, 0x45, 0x21,
-	0x32, 0x7f, 0x7d, 0x8c, 0x33, 0x40, 0x85, 0x7e, 0x7c, 0xea, 0x0c, 0x66, 0x73, 0x5e, 0xd2, 0x7d, 0xcc, 0xb6, 0x1d,
-	0x51, 0x87, 0xd6, 0x76, 0x63, 0xe6, 0x0b, 0x58, 0x15, 0xb3, 0xef, 0x99, 0x8c, 0x82, 0x9f, 0x1e, 0x33, 0xfd, 0xbc,
-	0xe8, 0x26, 0x13, 0xdb, 0x26, 0x77, 0x58, 0x1a, 0xde, 0xc1, 0x50, 0x67, 0x3a, 0x8c, 0x43, 0x9d, 0xf9, 0x99, 0xa1,
-	0x14, 0x4e, 0xaa, 0xad, 0x62, 0xb7, 0xdc, 0x29, 0x77, 0x6a, 0x5a, 0x68, 0xa0, 0x7d, 0xae, 0x1d, 0xf2, 0x06, 0xfd,
-	0x67, 0x46, 0x82, 0x95, 0x06, 0xe5, 0xd9, 0x79, 0x8e, 0xb8, 0x76, 0x09, 0x92, 0x16, 0x17, 0x30, 0x29, 0x71, 0x5a,
-	0xb4, 0x87, 0x92, 0x5e, 0x4c, 0x46, 0x71, 0xd4, 0x35, 0x39, 0xd3, 0xdf, 0x81, 0xc7, 0x9f, 0x69, 0xa1, 0x53, 0xdc,
-	0x43, 0x72, 0x0d, 0xfb, 0x72, 0x5f, 0x13, 0xab, 0x89, 0x2a, 0x3e, 0x55, 0x93, 0xd4, 0x7f, 0x87, 0xc7, 0x9f, 0xe9,
-	0xee, 0xa7, 0x66, 0xcb, 0x9f, 0x62, 0xe2, 0x36, 0x31, 0x16, 0xd6, 0x76, 0x7d, 0xcf, 0x94, 0x38, 0x05, 0x8f, 0xba,
-	0xeb, 0xdc, 0x38, 0x7c, 0x3e, 0x92, 0x61, 0x72, 0xb5, 0x7b, 0x0c, 0xf5, 0xa5, 0x17, 0x9c, 0x36, 0x86, 0xd3, 0x6a,
-	0xa5, 0x35, 0xce, 0x63, 0xea, 0x96, 0xe2, 0x06, 0x02, 0xae, 0x24, 0xb1, 0x03, 0xf6, 0x5c, 0x67, 0xdd, 0xaf, 0x69,
-	0xdb, 0x40, 0x8f, 0xfa, 0x69, 0xf7, 0x72, 0xf7, 0x2b, 0x6f, 0x72, 0xa1, 0xb4, 0xa5, 0xe0, 0x7c, 0xd0, 0xb5, 0xff,
-	0x7e, 0x97, 0xc2, 0xd2, 0x99, 0x41, 0x48, 0xd6, 0x57, 0xcb, 0x5c, 0xf4, 0xb6, 0xef, 0x16, 0x99, 0xca, 0x8a, 0xc9,
-	0xf3, 0xe1, 0x67, 0x02, 0x28, 0x29, 0x38, 0x04, 0xf4, 0x52, 0xa6, 0x4d, 0xe6, 0x13, 0x27, 0x9e, 0xd3, 0x3a, 0x9d,
-	0x4e, 0x53, 0x48, 0x9f, 0x79, 0xd6, 0xed, 0xa6, 0xb2, 0xc9, 0x97, 0xb2, 0x1c, 0xdf, 0xf7, 0x6a, 0x5b, 0xe9, 0x3c,
-	0xb4, 0x12, 0x2a, 0xdd, 0x8c, 0x59, 0x6f, 0xa5, 0xe5, 0x68, 0xc8, 0x76, 0x4d, 0xfd, 0xf8, 0x4c, 0x17, 0xa3, 0xa2,
-	0xe0, 0x26, 0xb8, 0x64, 0xab, 0xd5, 0x4a, 0x74, 0x51, 0x87, 0x44, 0x7d, 0xe3, 0x32, 0x1a, 0x95, 0xe5, 0xe7, 0xb2,
-	0x38, 0x97, 0x30, 0x3f, 0x53, 0xf2, 0xdf, 0x4c, 0x87, 0xaf, 0x9b, 0xfc, 0xa5, 0x30, 0x4d, 0x33, 0xe3, 0x7a, 0xc8,
-	0xa2, 0x2f, 0xc3, 0xbc, 0xed, 0x2f, 0x75, 0xc3, 0xf0, 0x33, 0xcf, 0xaf, 0xf2, 0xf6, 0xfa, 0x5c, 0x77, 0x2c, 0x35,
-	0xf1, 0x1c, 0x21, 0x4e, 0x4b, 0x96, 0x52, 0x83, 0x58, 0x74, 0xfb, 0xda, 0xba, 0x5e, 0x90, 0x37, 0x9d, 0x13, 0xcb,
-	0x6b, 0xfa, 0x57, 0xd9, 0xd2, 0x81, 0xf5, 0x73, 0x1b, 0x44, 0x5f, 0x36, 0xbb, 0xd0, 0xe1, 0x0e, 0xcb, 0xfc, 0x6d,
-	0x25, 0x71, 0x6a, 0x4e, 0x6c, 0x55, 0xbb, 0x79, 0xfa, 0xff, 0xa4, 0x49, 0x4d, 0xd1, 0x6d, 0x95, 0xe5, 0x3f, 0x10,
-	0xc7, 0x3d, 0xec, 0xe8, 0x48, 0xbd, 0x4f, 0x3b, 0x73, 0x92, 0x64, 0x88, 0xaa, 0xcf, 0x59, 0x35, 0x8a, 0xd5, 0x07,
-	0x46, 0xa7, 0x3f, 0xec, 0xa0, 0x57, 0x60, 0x7f, 0xf0, 0x2e, 0x8b, 0x75, 0x5c, 0x9b, 0x85, 0xfe, 0x1e, 0xec, 0x3d,
-	0xa3, 0x29, 0x78, 0xf0, 0x81, 0xd4, 0xb4, 0x90, 0x7f, 0x71, 0x43, 0xb7, 0x23, 0xb5, 0x5c, 0xd1, 0x74, 0xfe, 0xfd,
-	0xdc, 0x80, 0x39, 0x25, 0xb7, 0x93, 0x28, 0xe7, 0xea, 0x66, 0x52, 0x49, 0x56, 0xa6, 0x33, 0xed, 0xc2, 0x54, 0x2a,
-	0xd0, 0x5d, 0xdb, 0x8e, 0xcb, 0xc1, 0x82, 0xb6, 0xb5, 0x9f, 0x8e, 0x46, 0x61, 0xa9, 0x8b, 0x02, 0x2a, 0x06, 0x08,
-	0x8c, 0x84, 0xcf, 0xc4, 0x86, 0xf6, 0xbc, 0xb4, 0xe0, 0xff, 0xc1, 0x34, 0x5c, 0xa3, 0x4f, 0x3f, 0x37, 0x5e, 0x9d,
-	0xce, 0x62, 0x57, 0xf7, 0x6e, 0x7b, 0x2b, 0xb1, 0x7d, 0xd1, 0x3e, 0x7e, 0xd9, 0x7a, 0xae, 0x6d, 0x83, 0x16, 0xf3,
-	0x42, 0xf0, 0xfd, 0x02, 0x33, 0x59, 0x71, 0x47, 0x79, 0xb9, 0x1f, 0x4d, 0xea, 0x25, 0x5d, 0xc0, 0x6c, 0x27, 0x1b,
-	0x8d, 0x96, 0xb4, 0x32, 0xe8, 0x68, 0x69, 0x54, 0x98, 0xf6, 0xaa, 0x61, 0xd6, 0x11, 0x8c, 0x59, 0xaa, 0x3b, 0xef,
-	0x69, 0x3e, 0x7a, 0x19, 0xbb, 0xb2, 0x4e, 0x27, 0x50, 0xf5, 0xa5, 0xa0, 0xc2, 0xae, 0xd0, 0xa4, 0xde, 0xa0, 0x66,
-	0x4d, 0xbb, 0x82, 0xb6, 0x1c, 0x29, 0x31, 0xb4, 0x6e, 0x71, 0x76, 0x36, 0x3b, 0x27, 0x40, 0x37, 0xa4, 0x29, 0x1b,
-	0x7d, 0x38, 0xad, 0x51, 0xc4, 0xb0, 0x06, 0x23, 0x41, 0x3c, 0x93, 0x4d, 0x63, 0x3f, 0x33, 0x97, 0x77, 0xed, 0x6b,
-	0x16, 0x07, 0x57, 0x10, 0x14, 0x45, 0x6d, 0x49, 0xda, 0x9e, 0x75, 0x4c, 0x65, 0x5d, 0xdb, 0x6b, 0x03, 0xd3, 0x46,
-	0xd1, 0xd2, 0x40, 0x22, 0xdb, 0x36, 0x4a, 0xd3, 0x3c, 0x38, 0x2a, 0x1e, 0x77, 0x63, 0x82, 0xe9, 0xac, 0x3f, 0xfc,
-	0xe4, 0x67, 0xaa, 0x34, 0xeb, 0x51, 0xac, 0x67, 0x7b, 0x68, 0xc6, 0x8b, 0x13, 0x06, 0x69, 0xc3, 0x65, 0x69, 0x02,
-	0x3e, 0xdb, 0x7d, 0x69, 0x8b, 0xb0, 0xab, 0x3f, 0x77, 0x75, 0x73, 0x5f, 0x27, 0x29, 0xea, 0x76, 0xbb, 0x64, 0x07,
-	0x5e, 0xa8, 0x3a, 0xe4, 0xdd, 0x3c, 0xa8, 0x11, 0xc5, 0xf9, 0xad, 0xec, 0x0e, 0x94, 0x0c, 0xba, 0x43, 0x1a, 0xc4,
-	0x36, 0x3f, 0xda, 0x1e, 0xb6, 0x7d, 0xdd, 0x8b, 0x49, 0xa8, 0x08, 0xb3, 0x59, 0xa1, 0x27, 0xf9, 0x99, 0xb4, 0x18,
-	0xda, 0x88, 0xa5, 0xad, 0xaa, 0xa9, 0x0d, 0x92, 0xa1, 0x69, 0xec, 0xbb, 0x8d, 0x9d, 0xf9, 0x86, 0x14, 0xb1, 0x30,
-	0x3d, 0x5a, 0x1c, 0x19, 0xa9, 0xe7, 0x6c, 0x3c, 0xc9, 0x16, 0x8e, 0x6c, 0x2f, 0xb0, 0xd5, 0xb2, 0x36, 0x66, 0xf3,
-	0x3e, 0xf7, 0xa4, 0xef, 0x74, 0x8f, 0xf1, 0x08, 0x19, 0x75, 0x8b, 0xa1, 0x19, 0xed, 0x57, 0x14, 0x16, 0xe3, 0x72,
-	0x1b, 0xfa, 0x6b, 0x23, 0xe7, 0xe3, 0xe0, 0x58, 0xe8, 0xaf, 0xfb, 0x3b, 0x38, 0x51, 0x2a, 0x67, 0x4c, 0x2f, 0xab,
-	0xc3, 0xfe, 0x97, 0xcd, 0xe3, 0x06, 0x2e, 0xdf, 0x6e, 0xb6, 0x6d, 0x9f, 0x75, 0xbc, 0x18, 0xce, 0x7e, 0xfe, 0xe9,
-	0xf2, 0xed, 0xbf, 0x06, 0xaf, 0x06, 0xed, 0xf3, 0x27, 0xc3, 0x74, 0x11, 0xda, 0x7e, 0x44, 0x82, 0xc1, 0x32, 0x44,
-	0x3a, 0xb2, 0x80, 0xbd, 0xc9, 0x2e, 0x42, 0x1b, 0x8f, 0x08, 0x1a, 0x12, 0xf0, 0xab, 0xec, 0x82, 0xde, 0x8d, 0x43,
-	0x2f, 0x84, 0x53, 0x20, 0x22, 0x18, 0x5a, 0x33, 0x44, 0xb2, 0x26, 0x1a, 0x09, 0x31, 0x36, 0x42, 0x61, 0x1b, 0x04,
-	0x22, 0x41, 0x09, 0x01, 0x79, 0x87, 0x17, 0x1f, 0x5a, 0xaf, 0x8c, 0xf5, 0x4a, 0x8c, 0x94, 0x41, 0x58, 0x64, 0x20,
-	0x3e, 0x0e, 0x2e, 0x66, 0x7a, 0x21, 0x65, 0x06, 0x04, 0xcb, 0x0c, 0xb0, 0x96, 0x19, 0x40, 0x29, 0x33, 0x20, 0x79,
-	0x99, 0x81, 0x88, 0x65, 0x06, 0x48, 0xe4, 0x15, 0xa1, 0xbe, 0xa9, 0x00, 0xe0, 0x7a, 0x70, 0xb1, 0x48, 0x17, 0x6b,
-	0x64, 0x3e, 0x0d, 0xc2, 0x91, 0x70, 0xb9, 0x92, 0x72, 0x20, 0xa4, 0x39, 0x06, 0xb4, 0x41, 0x23, 0x36, 0xe4, 0xf1,
-	0xc6, 0xf7, 0x78, 0xe3, 0x79, 0xbc, 0x21, 0x8f, 0x37, 0x25, 0x8f, 0x37, 0xec, 0xf1, 0xb8, 0xf6, 0x8d, 0x50, 0x28,
-	0xbd, 0x02, 0x4f, 0xdd, 0xc2, 0x73, 0xbc, 0x78, 0xc6, 0x8b, 0x53, 0x76, 0x21, 0xc5, 0x00, 0x44, 0xf3, 0x9b, 0xc0,
-	0x90, 0x08, 0x6b, 0x9b, 0x20, 0xd6, 0x08, 0x02, 0xdb, 0x7a, 0x17, 0x61, 0xaa, 0x7c, 0x81, 0x78, 0xc3, 0x88, 0xad,
-	0x86, 0x02, 0xfb, 0x75, 0x31, 0x90, 0x57, 0x8c, 0xf8, 0xd9, 0xf3, 0xab, 0xa6, 0x70, 0x8e, 0xb7, 0x84, 0xb1, 0x2e,
-	0x13, 0xb8, 0xe0, 0x37, 0x61, 0xc9, 0x79, 0x82, 0xdb, 0x3a, 0x2b, 0xb0, 0xad, 0xb8, 0x01, 0x7e, 0x47, 0x48, 0x56,
-	0x85, 0x05, 0xa2, 0x7a, 0x1c, 0x71, 0xbf, 0x32, 0x07, 0x16, 0x6b, 0xb4, 0x20, 0xb6, 0x5a, 0x0b, 0xec, 0xd6, 0x6d,
-	0xe1, 0x9c, 0x0a, 0x2e, 0x8c, 0xad, 0xe5, 0x02, 0x17, 0xaa, 0xba, 0xb0, 0x54, 0xdf, 0x05, 0xa7, 0x4a, 0x2f, 0xb8,
-	0xa9, 0xf9, 0x01, 0xc5, 0xea, 0x1f, 0x90, 0x35, 0xa5, 0xc9, 0x84, 0x40, 0x20, 0x52, 0x03, 0xc1, 0x3d, 0x49, 0x08,
-	0x54, 0x43, 0xee, 0x21, 0x71, 0x10, 0xf8, 0x4c, 0xe0, 0x79, 0x32, 0x21, 0x8c, 0x1f, 0x78, 0x25, 0xc1, 0x10, 0xb6,
-	0x10, 0x78, 0x2c, 0x1d, 0x82, 0x1b, 0xfd, 0x08, 0xe8, 0x13, 0x69, 0xc0, 0x33, 0x21, 0x27, 0x46, 0xac, 0xa6, 0x08,
-	0xec, 0x08, 0x4b, 0xa8, 0xe6, 0x28, 0x2c, 0x82, 0x58, 0x03, 0x0a, 0x6c, 0x85, 0x25, 0xc2, 0x24, 0x2c, 0x81, 0x78,
-	0xc3, 0x88, 0x15, 0x16, 0x81, 0x7d, 0x61, 0x09, 0xe4, 0x15, 0x23, 0x7e, 0xf6, 0x7c, 0x61, 0x11, 0xce, 0xf1, 0xaf,
-	0x30, 0xd6, 0xbf, 0x02, 0x17, 0xfc, 0x2b, 0x2c, 0xf9, 0x57, 0x70, 0x2b, 0x2c, 0x02, 0x5b, 0x61, 0x09, 0xf0, 0x3b,
-	0x42, 0x32, 0x61, 0x11, 0x88, 0x84, 0x25, 0xe2, 0xbe, 0xb0, 0x04, 0x16, 0x85, 0x45, 0x10, 0x2b, 0x2c, 0x02, 0xbb,
-	0xc2, 0x22, 0x9c, 0x23, 0x2c, 0xc2, 0x58, 0x61, 0x11, 0xb8, 0x20, 0x2c, 0xc2, 0x92, 0xb0, 0x08, 0x4e, 0xc2, 0x22,
-	0xb8, 0x11, 0x96, 0x80, 0xa2, 0xb0, 0x04, 0x64, 0x4d, 0x69, 0x32, 0x61, 0x11, 0x88, 0x84, 0x45, 0x70, 0x4f, 0x58,
-	0x02, 0xd5, 0x90, 0x7b, 0x48, 0x58, 0x04, 0x3e, 0x13, 0x78, 0x9e, 0xb0, 0x08, 0xe3, 0x07, 0x5e, 0x49, 0x58, 0x84,
-	0x2d, 0x04, 0x1e, 0x0b, 0x8b, 0xe0, 0x46, 0x58, 0x02, 0xfa, 0x44, 0x1a, 0xf0, 0x4c, 0xc8, 0x89, 0x11, 0x2b, 0x2c,
-	0x02, 0x3b, 0xc2, 0x02, 0x06, 0x41, 0x75, 0x41, 0xd8, 0x9a, 0x12, 0x39, 0xab, 0x33, 0x19, 0x47, 0x62, 0x03, 0xec,
-	0x9b, 0x02, 0x6c, 0x65, 0x07, 0x39, 0x5f, 0x7b, 0x20, 0xc5, 0x55, 0x01, 0x3e, 0x53, 0x02, 0x5f, 0x8a, 0x30, 0x81,
-	0x13, 0x16, 0x48, 0xdb, 0xd8, 0x40, 0xae, 0x10, 0x20, 0x98, 0x84, 0xa2, 0x04, 0x49, 0xab, 0x51, 0xc8, 0x59, 0xa1,
-	0x02, 0xee, 0x9d, 0x0f, 0x67, 0x92, 0x85, 0x38, 0xe9, 0x56, 0x46, 0xfa, 0xe2, 0x05, 0x49, 0x50, 0xc1, 0x10, 0xb6,
-	0x32, 0x86, 0x9c, 0xab, 0x65, 0x98, 0xc0, 0x11, 0x34, 0xa4, 0xad, 0xaa, 0x21, 0x57, 0x90, 0x36, 0x4c, 0x42, 0xfa,
-	0x86, 0x24, 0x89, 0x1c, 0x92, 0x46, 0xe9, 0x80, 0x42, 0xb9, 0x03, 0x78, 0xed, 0xa7, 0xce, 0x84, 0x0f, 0x71, 0x52,
-	0x3f, 0x24, 0x3d, 0x09, 0x04, 0xbe, 0xf1, 0x1d, 0x4f, 0x62, 0x88, 0xdc, 0x8f, 0xe2, 0xdf, 0x93, 0x45, 0xa4, 0xcf,
-	0xc4, 0x7f, 0x49, 0x20, 0x31, 0xc9, 0xb9, 0xf8, 0x67, 0xa9, 0x44, 0xd2, 0xe8, 0x25, 0x50, 0x4f, 0xbe, 0xbe, 0x3d,
-	0xfb, 0xf0, 0xa9, 0x00, 0x5b, 0x0d, 0x45, 0xce, 0x11, 0xd2, 0x04, 0xa1, 0x8c, 0x2a, 0x68, 0x5d, 0xa0, 0x8c, 0x95,
-	0x50, 0x60, 0x48, 0x40, 0x13, 0xf7, 0xc6, 0x05, 0xad, 0x78, 0x2a, 0xe3, 0x4b, 0x67, 0xe2, 0xaf, 0x5c, 0xb0, 0x98,
-	0x67, 0x5f, 0x34, 0x95, 0x76, 0x42, 0x46, 0x49, 0x1b, 0x30, 0xca, 0x14, 0xc2, 0x45, 0x13, 0x50, 0xb0, 0x28, 0x65,
-	0xa5, 0x52, 0x19, 0x2b, 0x94, 0x89, 0x79, 0xe7, 0x81, 0x99, 0x48, 0x2a, 0x4a, 0x12, 0x09, 0x94, 0x2f, 0x90, 0x29,
-	0x01, 0xca, 0xa3, 0x82, 0x56, 0x1c, 0x95, 0x71, 0xa5, 0x51, 0x69, 0x47, 0x18, 0x95, 0xb4, 0xb2, 0xa8, 0x4c, 0x41,
-	0x14, 0x35, 0x01, 0x49, 0xa2, 0x52, 0x24, 0x88, 0x4a, 0x19, 0x39, 0x4c, 0x04, 0x8a, 0x61, 0x02, 0xd7, 0x5e, 0xca,
-	0x4c, 0x08, 0x15, 0x25, 0x19, 0x54, 0xca, 0x13, 0xc1, 0x84, 0x35, 0x9e, 0x53, 0x49, 0x00, 0x95, 0x39, 0x1f, 0xc9,
-	0x9e, 0xf8, 0x29, 0x59, 0x8c, 0xe4, 0x92, 0xf0, 0x69, 0x82, 0x72, 0x24, 0xb3, 0xe8, 0x29, 0x65, 0x24, 0x2f, 0x11,
-	0x4f, 0x9e, 0x0e, 0x3d, 0x7b, 0xe0, 0xc9, 0x05, 0xad, 0xd4, 0x29, 0xe3, 0x08, 0x5d, 0x28, 0x35, 0xaa, 0x9c, 0x20,
-	0xd6, 0xc8, 0x02, 0x5b, 0x7d, 0x8b, 0x30, 0x89, 0x5b, 0x20, 0xde, 0x30, 0x62, 0x65, 0x4d, 0x60, 0x5f, 0xd3, 0x02,
-	0x79, 0xc5, 0x88, 0x9f, 0x3d, 0x5f, 0xca, 0x84, 0x73, 0xbc, 0x2f, 0x8c, 0x75, 0xbd, 0xc0, 0x05, 0xbf, 0x0b, 0x4b,
-	0x4e, 0x17, 0xdc, 0x6a, 0x97, 0xc0, 0x56, 0xb8, 0x02, 0xfc, 0x8e, 0x90, 0x4c, 0xb2, 0x04, 0x22, 0xbd, 0x8a, 0xb8,
-	0x2f, 0x56, 0x81, 0x45, 0xa5, 0x12, 0xc4, 0xca, 0x94, 0xc0, 0xae, 0x46, 0x09, 0xe7, 0x08, 0x94, 0x30, 0x56, 0x9d,
-	0x04, 0x2e, 0x48, 0x93, 0xb0, 0xa4, 0x4b, 0x82, 0x93, 0x28, 0x09, 0x6e, 0x14, 0x29, 0xa0, 0x28, 0x47, 0x01, 0x59,
-	0x53, 0x9a, 0x4c, 0x88, 0x04, 0x22, 0x15, 0x12, 0xdc, 0x93, 0xa0, 0x40, 0x35, 0xe4, 0x1e, 0x12, 0x1f, 0x81, 0xcf,
-	0x04, 0x9e, 0x27, 0x3b, 0xc2, 0xf8, 0x81, 0x57, 0x12, 0x1c, 0x61, 0x0b, 0x81, 0xc7, 0x52, 0x23, 0xb8, 0xd1, 0x99,
-	0x80, 0x3e, 0x91, 0x06, 0x3c, 0x13, 0x72, 0x62, 0xc4, 0x6a, 0x8b, 0xc0, 0x8e, 0xb0, 0x48, 0x2e, 0x51, 0x59, 0x22,
-	0x64, 0x4d, 0x18, 0x71, 0xab, 0x2d, 0x09, 0x27, 0x71, 0x11, 0xe6, 0x8d, 0x03, 0x59, 0x79, 0x89, 0xb8, 0xaf, 0x2f,
-	0xc2, 0x5e, 0x39, 0x50, 0x21, 0x97, 0xbe, 0xc4, 0x44, 0xd2, 0x71, 0x75, 0xa4, 0xac, 0xaf, 0x23, 0x5e, 0x70, 0x76,
-	0xa4, 0xc9, 0xdb, 0x91, 0xb0, 0x3a, 0x13, 0x71, 0x2b, 0x34, 0x82, 0xbf, 0x63, 0x28, 0x93, 0x9a, 0x88, 0x91, 0xd6,
-	0x24, 0xc2, 0x17, 0x1b, 0xa1, 0x51, 0x6d, 0x22, 0x64, 0xe5, 0x26, 0xe2, 0xae, 0xde, 0x44, 0xd2, 0x11, 0x9c, 0x48,
-	0x59, 0xc5, 0x89, 0x78, 0x41, 0x72, 0x22, 0x4d, 0x9a, 0x13, 0x09, 0x12, 0x9d, 0x48, 0x18, 0xd5, 0x11, 0x18, 0x65,
-	0x47, 0xa0, 0x35, 0xa7, 0xca, 0x84, 0x27, 0x62, 0xa4, 0x3c, 0x91, 0xf0, 0xa4, 0x47, 0xb8, 0x86, 0x1d, 0x46, 0xe2,
-	0x13, 0xf1, 0x73, 0x31, 0xe9, 0xc9, 0x4f, 0xa4, 0x0a, 0x31, 0x59, 0x12, 0xa0, 0x48, 0x97, 0x62, 0x92, 0x25, 0x28,
-	0x12, 0x46, 0x83, 0x04, 0x7e, 0x62, 0xbd, 0x78, 0x66, 0xe8, 0xe4, 0x40, 0x56, 0x87, 0x22, 0xee, 0x08, 0x91, 0xe4,
-	0x09, 0x85, 0x28, 0x42, 0xd6, 0x9c, 0x11, 0xb7, 0x42, 0x94, 0x70, 0x12, 0x22, 0x61, 0xde, 0x38, 0x90, 0x15, 0xa2,
-	0x88, 0xfb, 0x42, 0x24, 0xec, 0x95, 0x03, 0x15, 0x72, 0xe9, 0x0b, 0x51, 0x24, 0x1d, 0xa7, 0x47, 0xca, 0x3a, 0x3d,
-	0xe2, 0x05, 0xa7, 0x47, 0x9a, 0x9c, 0x1e, 0x09, 0x2b, 0x44, 0x11, 0xb7, 0x42, 0x24, 0xf8, 0x3b, 0x86, 0x32, 0x21,
-	0x8a, 0x18, 0x09, 0x51, 0x22, 0x7c, 0x21, 0x12, 0x1a, 0x85, 0x28, 0x42, 0x56, 0x88, 0x22, 0xee, 0x0a, 0x51, 0x24,
-	0x1d, 0x21, 0x8a, 0x94, 0x15, 0xa2, 0x88, 0x17, 0x84, 0x28, 0xd2, 0x24, 0x44, 0x91, 0x20, 0x21, 0x8a, 0x84, 0x11,
-	0x22, 0x81, 0x51, 0x88, 0x04, 0x5a, 0x73, 0xaa, 0x4c, 0x88, 0x22, 0x46, 0x42, 0x14, 0x09, 0x4f, 0x88, 0x84, 0x6b,
-	0xd8, 0x61, 0x24, 0x44, 0x11, 0x3f, 0x17, 0x93, 0x9e, 0x10, 0x45, 0xaa, 0x10, 0x93, 0x25, 0x21, 0x8a, 0x74, 0x29,
-	0x26, 0x59, 0x88, 0x22, 0x61, 0x84, 0x48, 0xe0, 0x27, 0xd6, 0x8b, 0x67, 0x86, 0x4e, 0x0e, 0x64, 0x85, 0x28, 0xe2,
-	0x8e, 0x10, 0xf5, 0xaf, 0x46, 0x19, 0x0a, 0x80, 0x35, 0x65, 0x40, 0xad, 0x04, 0x09, 0x4a, 0x02, 0xd4, 0xe3, 0x6f,
-	0x08, 0xb0, 0xe2, 0x13, 0x50, 0x5f, 0x7a, 0x7a, 0xee, 0x8a, 0x00, 0x37, 0x5f, 0xbe, 0xe8, 0x04, 0xca, 0x71, 0x6f,
-	0x20, 0xac, 0x73, 0x03, 0x5a, 0x70, 0x6d, 0x20, 0xc9, 0xb1, 0x01, 0xb6, 0x52, 0x13, 0x50, 0x2b, 0x34, 0x3d, 0xfa,
-	0xce, 0x02, 0x99, 0xc8, 0x04, 0x84, 0x24, 0x46, 0x60, 0x5f, 0x60, 0x7a, 0x12, 0xe5, 0x25, 0x00, 0x56, 0x5c, 0x02,
-	0xea, 0x4a, 0x4b, 0xa0, 0x1c, 0x61, 0x09, 0x84, 0x95, 0x95, 0x80, 0x16, 0x44, 0x25, 0x90, 0x24, 0x29, 0x01, 0x26,
-	0x41, 0x09, 0xb0, 0x91, 0x93, 0xfe, 0x12, 0xc5, 0xa4, 0x07, 0xd6, 0x36, 0x45, 0x26, 0x24, 0x01, 0x21, 0x19, 0x09,
-	0xb0, 0x27, 0x22, 0x3d, 0xd3, 0x58, 0x67, 0x90, 0x80, 0x04, 0xb4, 0x1c, 0x5d, 0x9e, 0x78, 0x04, 0xc2, 0x8d, 0xae,
-	0x92, 0x70, 0x04, 0xd2, 0x8f, 0x2e, 0x16, 0x8d, 0x00, 0x1b, 0xc9, 0xe8, 0x2f, 0x9f, 0x6c, 0xbd, 0x7e, 0xb6, 0xc0,
-	0x89, 0x00, 0x2b, 0x15, 0x01, 0x75, 0x84, 0x22, 0xc4, 0x33, 0x2a, 0x85, 0x20, 0xd6, 0x68, 0x02, 0x5b, 0xad, 0x88,
-	0x30, 0x89, 0x45, 0x20, 0xde, 0x30, 0x62, 0xe5, 0x42, 0x60, 0x5f, 0x2f, 0x02, 0x79, 0xc5, 0x88, 0x9f, 0x3d, 0x5f,
-	0x32, 0x84, 0x73, 0xbc, 0x2a, 0x8c, 0x75, 0xab, 0xc0, 0x05, 0xbf, 0x0a, 0x4b, 0x8e, 0x15, 0xdc, 0xea, 0x86, 0xc0,
-	0x56, 0x38, 0xc2, 0xf5, 0x3b, 0x42, 0x32, 0xe9, 0x10, 0x88, 0xb4, 0x23, 0xe2, 0xbe, 0x78, 0x04, 0x16, 0xd5, 0x43,
-	0x10, 0x2b, 0x1f, 0x02, 0xbb, 0xfa, 0x21, 0x9c, 0x23, 0x20, 0xc2, 0x58, 0x05, 0x11, 0xb8, 0x20, 0x21, 0xc2, 0x92,
-	0x86, 0x08, 0x4e, 0x22, 0x22, 0xb8, 0x51, 0x91, 0x80, 0xa2, 0x8c, 0x04, 0x64, 0x4d, 0x69, 0x32, 0x21, 0x11, 0x88,
-	0x94, 0x44, 0x70, 0x4f, 0x4a, 0x02, 0xd5, 0x90, 0x7b, 0x48, 0x4c, 0x04, 0x3e, 0x13, 0x78, 0x9e, 0x9c, 0x08, 0xe3,
-	0x07, 0x5e, 0x49, 0x50, 0x84, 0x2d, 0x04, 0x1e, 0x4b, 0x8a, 0xe0, 0x46, 0x53, 0x02, 0xfa, 0x44, 0x1a, 0xf0, 0x4c,
-	0xc8, 0x89, 0x11, 0xab, 0x2b, 0x02, 0xb3, 0xb0, 0xfc, 0xa5, 0x8b, 0xbf, 0x91, 0x5e, 0x24, 0xdb, 0x27, 0x04, 0x2d,
-	0x06, 0x30, 0x3a, 0x23, 0x81, 0x62, 0x27, 0x40, 0x72, 0x13, 0x01, 0x11, 0xad, 0x03, 0x50, 0x34, 0x0c, 0x40, 0xc1,
-	0x26, 0x0a, 0x84, 0x9f, 0x43, 0xb9, 0x18, 0x27, 0x40, 0x7e, 0xc1, 0x24, 0x21, 0x7f, 0x8d, 0x49, 0x26, 0x09, 0x88,
-	0x49, 0x12, 0x12, 0xca, 0x68, 0xd3, 0x05, 0x94, 0x12, 0x87, 0x3a, 0x6d, 0x13, 0x07, 0x94, 0x13, 0x8b, 0xbc, 0x52,
-	0x72, 0xc1, 0xed, 0x0d, 0xbf, 0x0c, 0x5e, 0xa9, 0x2b, 0x7e, 0x89, 0xdb, 0xc3, 0x10, 0x11, 0x15, 0x06, 0x04, 0xfd,
-	0x01, 0x30, 0xbb, 0xf6, 0x97, 0x38, 0x15, 0x87, 0x48, 0x34, 0x3b, 0x40, 0xd1, 0xec, 0x00, 0x05, 0xb3, 0x03, 0x20,
-	0xaa, 0xa8, 0x08, 0xd4, 0xed, 0x5f, 0xba, 0x6a, 0xad, 0x4c, 0x5b, 0xa3, 0x57, 0x7a, 0x21, 0x25, 0x02, 0x44, 0x33,
-	0xaa, 0xa0, 0xd8, 0x4b, 0x9f, 0x18, 0x0d, 0x95, 0x90, 0x60, 0x70, 0xb4, 0x96, 0x20, 0xd6, 0x64, 0x02, 0x5b, 0xbb,
-	0x09, 0xec, 0x1a, 0x4f, 0x38, 0xc7, 0x82, 0xc2, 0x58, 0x33, 0x0a, 0x4c, 0xb6, 0x14, 0x9c, 0x0c, 0x2a, 0xb8, 0xb1,
-	0xaa, 0xa0, 0xd6, 0xb4, 0x01, 0xbe, 0xa6, 0xb2, 0xaf, 0x29, 0x0d, 0x5a, 0x5a, 0x10, 0x6b, 0x6e, 0x81, 0x1d, 0x9b,
-	0x67, 0x71, 0x6d, 0x5e, 0xc5, 0xd6, 0xef, 0x4f, 0xd6, 0x66, 0xd6, 0x0f, 0x08, 0x59, 0x3f, 0xc0, 0x64, 0xfd, 0x00,
-	0xfb, 0xd6, 0x0f, 0x9c, 0x67, 0xfd, 0xc0, 0x90, 0xf5, 0x03, 0xcc, 0xd6, 0x0f, 0x38, 0x5b, 0x3f, 0xe0, 0xd6, 0xfa,
-	0x01, 0x25, 0xeb, 0xf7, 0xf0, 0x35, 0x95, 0x7d, 0x4d, 0x69, 0x32, 0xeb, 0x07, 0x84, 0xac, 0x1f, 0x60, 0xcf, 0xfa,
-	0x3d, 0x43, 0xd6, 0xef, 0x51, 0x6b, 0xfd, 0xd7, 0x9d, 0xe1, 0x97, 0x7a, 0x21, 0x6f, 0x01, 0x44, 0xcc, 0x0d, 0x08,
-	0x5a, 0x1a, 0x60, 0xcd, 0x09, 0x80, 0x62, 0x5f, 0x40, 0xa2, 0x69, 0x01, 0x8a, 0x56, 0x05, 0x28, 0x18, 0x14, 0x00,
-	0xb1, 0xa5, 0x22, 0x1b, 0x6d, 0xee, 0x5f, 0xc7, 0x6f, 0x0c, 0x22, 0x22, 0xf9, 0x06, 0xc4, 0xeb, 0xe2, 0xbc, 0x86,
-	0xef, 0xc7, 0x20, 0x68, 0x3a, 0x36, 0xaf, 0xd3, 0x27, 0x07, 0x10, 0xb2, 0x1d, 0x96, 0xd7, 0xf2, 0x71, 0x37, 0x04,
-	0x24, 0xdf, 0x8a, 0x88, 0x5f, 0x46, 0x8a, 0x40, 0xe3, 0xff, 0x3a, 0x7e, 0xae, 0x12, 0x11, 0xd3, 0xdd, 0x7e, 0x9d,
-	0x7d, 0x88, 0x10, 0x61, 0xee, 0x63, 0xbc, 0xc6, 0xe3, 0xd5, 0x88, 0x9a, 0x4e, 0xc7, 0xeb, 0x74, 0x4a, 0x17, 0x21,
-	0xdb, 0x99, 0x78, 0x3d, 0xa8, 0xb3, 0x0b, 0xca, 0x6a, 0xed, 0x67, 0xac, 0xf6, 0x32, 0x56, 0x53, 0x16, 0x6a, 0xbf,
-	0xcb, 0xf3, 0x3a, 0x7d, 0x15, 0x05, 0x21, 0xd3, 0xc3, 0x7e, 0x1d, 0x0f, 0x6f, 0x02, 0x12, 0x63, 0x1d, 0x4c, 0x7d,
-	0x68, 0x6b, 0xda, 0x2c, 0x5d, 0x44, 0x81, 0x51, 0x44, 0x4c, 0x8d, 0x08, 0x76, 0xaf, 0x23, 0xfe, 0x8f, 0xae, 0xd6,
-	0xc4, 0x5e, 0xc1, 0x3f, 0x52, 0xad, 0x01, 0x44, 0xa2, 0x0f, 0x10, 0x34, 0x0d, 0xc0, 0x6a, 0x1a, 0x00, 0xc5, 0x34,
-	0x80, 0x44, 0x0b, 0x00, 0x14, 0xbd, 0x03, 0x50, 0x88, 0x3e, 0x00, 0xc4, 0x26, 0x8a, 0x6c, 0xb2, 0x0b, 0xca, 0xf7,
-	0x86, 0xf2, 0xbd, 0xf1, 0xf3, 0xbd, 0xf1, 0xf2, 0xbd, 0xa1, 0x7c, 0x6f, 0x38, 0xdf, 0x1b, 0xce, 0xf7, 0xc6, 0xe6,
-	0x7b, 0x43, 0xf9, 0x36, 0x9d, 0x9e, 0x7f, 0x50, 0x6f, 0xe7, 0x1f, 0x5d, 0x3f, 0x5d, 0xd3, 0x37, 0x54, 0xb4, 0xc6,
-	0x2f, 0x48, 0xe3, 0x15, 0xa4, 0xa1, 0x82, 0x98, 0xee, 0x38, 0x10, 0x5c, 0xc2, 0x86, 0x4b, 0xd8, 0xe4, 0x25, 0xbc,
-	0xec, 0x46, 0xb3, 0x33, 0xbd, 0x30, 0xea, 0x75, 0x99, 0x8f, 0x61, 0x01, 0x66, 0xad, 0xba, 0x4c, 0x23, 0x57, 0x40,
-	0xfc, 0xf1, 0xd7, 0xa5, 0x8e, 0x57, 0x01, 0x92, 0x8a, 0x04, 0x88, 0x91, 0xac, 0xcb, 0x01, 0xb4, 0x61, 0x97, 0x49,
-	0xa0, 0x00, 0x89, 0xb5, 0x06, 0x10, 0xa7, 0x31, 0xbe, 0x44, 0x81, 0x42, 0x50, 0x05, 0x0a, 0x50, 0xd3, 0x30, 0x5f,
-	0xaa, 0x40, 0x01, 0x64, 0x9b, 0xe3, 0xcb, 0x4e, 0xa0, 0xe0, 0x82, 0xb2, 0x5a, 0xfb, 0x19, 0xab, 0xbd, 0x8c, 0xd5,
-	0x94, 0x05, 0x23, 0x50, 0x40, 0x70, 0xde, 0xa2, 0x40, 0x01, 0x62, 0xba, 0x03, 0x97, 0x38, 0xb2, 0xbc, 0xa4, 0x41,
-	0xe5, 0xa5, 0x3f, 0x9e, 0xbc, 0xf4, 0x86, 0x92, 0x97, 0x34, 0x8a, 0xbc, 0x2c, 0x0d, 0x20, 0x2f, 0x79, 0xec, 0x78,
-	0xc9, 0xc3, 0xc6, 0x4b, 0x3b, 0x62, 0xbc, 0xec, 0x06, 0x82, 0x1a, 0x11, 0x27, 0x8a, 0xd8, 0x93, 0x13, 0x9a, 0xa8,
-	0x9d, 0x57, 0x25, 0xdc, 0x3e, 0x29, 0x23, 0xdd, 0x6a, 0x90, 0xa5, 0xf8, 0xd1, 0x6b, 0x6d, 0xe5, 0xc8, 0xc8, 0x42,
-	0x3d, 0xc9, 0xd2, 0x50, 0x95, 0xc9, 0x58, 0x5b, 0x7b, 0x32, 0xd2, 0x56, 0x24, 0x24, 0x31, 0x10, 0x32, 0xdc, 0xc6,
-	0x6c, 0x46, 0xda, 0x9a, 0x96, 0x93, 0x5e, 0x6c, 0x67, 0x29, 0x9c, 0x30, 0xcf, 0x79, 0xa7, 0x2a, 0x66, 0x09, 0x6c,
-	0x95, 0xc8, 0x48, 0xaa, 0x04, 0x19, 0x4b, 0x75, 0x15, 0xd9, 0xba, 0x84, 0x9f, 0xb3, 0x86, 0x5f, 0x99, 0xb3, 0x14,
-	0x3f, 0x28, 0x30, 0x55, 0xf1, 0x8c, 0x2c, 0xd4, 0xf6, 0x2c, 0xcd, 0xd9, 0x32, 0x93, 0x06, 0x64, 0xa4, 0x95, 0x03,
-	0x24, 0x51, 0x19, 0x32, 0xdc, 0x8a, 0x44, 0x46, 0xba, 0x7a, 0x91, 0xa5, 0x70, 0xa4, 0x23, 0xe3, 0xad, 0x8a, 0x64,
-	0x64, 0x41, 0x50, 0xb2, 0x34, 0xa4, 0x2d, 0x19, 0x4b, 0x32, 0x93, 0xb1, 0x46, 0x71, 0x90, 0x3b, 0x15, 0x6a, 0x11,
-	0xe9, 0x50, 0x46, 0xb2, 0x36, 0xfc, 0xd6, 0x4f, 0xad, 0x8e, 0xf4, 0x2a, 0xce, 0xaa, 0x22, 0x94, 0x4d, 0xa8, 0x2a,
-	0x71, 0x9d, 0x5d, 0xad, 0x75, 0x0c, 0xf5, 0x5b, 0x3f, 0xd1, 0x38, 0xd5, 0xab, 0x38, 0xcf, 0x05, 0x10, 0xcc, 0x68,
-	0x29, 0x9a, 0xff, 0x78, 0x09, 0x31, 0x11, 0x9e, 0x27, 0xf8, 0xa4, 0xe6, 0xf9, 0x2d, 0x95, 0x1d, 0x10, 0x76, 0xef,
-	0x6f, 0x7a, 0x90, 0x75, 0x64, 0x20, 0x2a, 0xba, 0x7b, 0x90, 0xd5, 0xb0, 0xd7, 0x0c, 0xa1, 0x25, 0xf4, 0xbc, 0xe7,
-	0xd4, 0x40, 0x64, 0x13, 0x3e, 0xef, 0x69, 0xa8, 0xa2, 0x75, 0x80, 0x26, 0x13, 0xa5, 0xc3, 0x92, 0xc6, 0x00, 0x64,
-	0x2c, 0x3a, 0x2c, 0x99, 0x98, 0x60, 0x97, 0xcc, 0x62, 0x02, 0x91, 0xc5, 0x22, 0xee, 0x5b, 0x2c, 0x4d, 0xb6, 0x58,
-	0x08, 0x2d, 0x96, 0x66, 0x5b, 0xb4, 0x7c, 0xf9, 0x74, 0x0b, 0xe1, 0x9e, 0xc5, 0x02, 0x55, 0xb4, 0x18, 0xd0, 0x64,
-	0xb1, 0xc0, 0x9d, 0xc8, 0x00, 0x64, 0x31, 0x81, 0x3d, 0x8b, 0x41, 0xf9, 0x73, 0xbb, 0x21, 0xc1, 0xd6, 0xcb, 0xd8,
-	0x82, 0x0d, 0x01, 0xbe, 0x2e, 0x11, 0x99, 0x3d, 0x01, 0xcf, 0xad, 0x8a, 0x04, 0xdb, 0x16, 0x59, 0xd7, 0xc2, 0x90,
-	0xa0, 0x6c, 0x67, 0x9b, 0x88, 0xad, 0x9d, 0x8b, 0x9a, 0x6b, 0x42, 0xb6, 0xbc, 0x2f, 0x6a, 0x89, 0x0f, 0xcd, 0x4c,
-	0x66, 0x79, 0x81, 0xc8, 0xe6, 0x11, 0xf7, 0xad, 0x1d, 0xd8, 0x6b, 0x86, 0xd0, 0xc2, 0x01, 0xc9, 0x6c, 0x2b, 0x10,
-	0x59, 0x55, 0x70, 0xcf, 0x9e, 0x81, 0x2a, 0x5a, 0x12, 0x68, 0xb2, 0x61, 0xe0, 0x4e, 0x64, 0x00, 0xb2, 0x9b, 0xc0,
-	0x6c, 0xb1, 0x2b, 0x1c, 0xbf, 0x5f, 0xd1, 0xf8, 0xfd, 0x8a, 0xc6, 0xef, 0x57, 0xfe, 0xf8, 0xfd, 0xca, 0x1b, 0xbf,
-	0x5f, 0xd1, 0xf8, 0xfd, 0x8a, 0xc7, 0xef, 0x57, 0x3c, 0x7e, 0xbf, 0xb2, 0xe3, 0xf7, 0x2b, 0x1a, 0xbf, 0x5f, 0x75,
-	0x4e, 0x9e, 0xea, 0x85, 0xe9, 0x0e, 0x5e, 0x19, 0xc7, 0x2a, 0x7e, 0xad, 0x4d, 0xe0, 0x55, 0xe7, 0x4c, 0x35, 0xc4,
-	0xbf, 0x06, 0x17, 0xf3, 0x74, 0xf1, 0x49, 0xdd, 0x7c, 0x95, 0xdc, 0x09, 0x88, 0x16, 0x56, 0x41, 0x19, 0x99, 0xeb,
-	0xbb, 0xe2, 0xc8, 0x3c, 0x21, 0xe1, 0x39, 0x68, 0x71, 0x41, 0xac, 0xd9, 0x05, 0xb6, 0xb6, 0x17, 0xd8, 0x75, 0x80,
-	0x70, 0x8e, 0x17, 0x84, 0xb1, 0xae, 0x10, 0x98, 0xfc, 0x21, 0x38, 0x39, 0x45, 0x70, 0xe3, 0x19, 0x41, 0xad, 0x7b,
-	0x52, 0x63, 0x6b, 0xca, 0x4e, 0x8e, 0xf2, 0x9a, 0x5a, 0x43, 0xa2, 0xcb, 0x52, 0x43, 0x3b, 0xc9, 0x11, 0x74, 0x5e,
-	0x6a, 0x7a, 0x17, 0x06, 0xb1, 0x6e, 0xa4, 0x86, 0xd7, 0x30, 0xd6, 0xa1, 0xf9, 0xda, 0x55, 0x82, 0xc1, 0x1d, 0xe8,
-	0x5a, 0x84, 0xad, 0x7f, 0x91, 0xb3, 0x4e, 0x46, 0xce, 0xf5, 0x34, 0x26, 0x70, 0xdc, 0x8d, 0xb4, 0xf5, 0x39, 0x72,
-	0xe4, 0x78, 0x24, 0xc9, 0xfb, 0x48, 0x9a, 0x10, 0x40, 0xca, 0xc6, 0x41, 0x7e, 0x6c, 0xd6, 0x33, 0x19, 0x45, 0x44,
-	0xf1, 0xd0, 0xac, 0x97, 0x02, 0x63, 0x23, 0x3f, 0x2c, 0x3a, 0x71, 0x60, 0x8c, 0x92, 0xfc, 0x0c, 0xe9, 0xc2, 0x83,
-	0x6d, 0xbc, 0xf8, 0x27, 0x48, 0x3d, 0xda, 0x46, 0x0e, 0x50, 0x14, 0x3e, 0xe9, 0x49, 0x18, 0x3c, 0x0a, 0xda, 0xd0,
-	0x51, 0xc6, 0x06, 0x8e, 0x32, 0x6e, 0xd8, 0x28, 0xed, 0x04, 0x8d, 0x92, 0x36, 0x64, 0x94, 0xa1, 0x80, 0x51, 0x8a,
-	0xc2, 0x45, 0x29, 0x13, 0x2c, 0x4a, 0xd8, 0x50, 0xc1, 0xa3, 0x83, 0x6c, 0x1c, 0x0a, 0x93, 0xc2, 0xc1, 0x41, 0xe6,
-	0x31, 0x44, 0xf0, 0x08, 0xdd, 0x84, 0x40, 0x0c, 0x0f, 0x3c, 0x57, 0xb7, 0x60, 0xd0, 0x86, 0x86, 0x77, 0xaa, 0x8e,
-	0x49, 0x1b, 0x16, 0x89, 0xa0, 0xa0, 0x08, 0x5e, 0xc0, 0x88, 0x10, 0xc4, 0x86, 0x83, 0xc0, 0x36, 0x16, 0x04, 0x76,
-	0x03, 0x41, 0x38, 0x27, 0x0a, 0x84, 0xb1, 0x21, 0x20, 0x30, 0xf9, 0x5f, 0x70, 0x72, 0xbe, 0xe0, 0xc6, 0xf3, 0x82,
-	0x5a, 0xb7, 0xa7, 0xb3, 0x57, 0xa6, 0xec, 0xe4, 0x70, 0xef, 0xe4, 0x95, 0x21, 0xd1, 0xd5, 0xe9, 0x78, 0xd2, 0x24,
-	0x47, 0xd0, 0xc9, 0xe9, 0xc0, 0xd2, 0xc2, 0x20, 0xd6, 0xbd, 0x74, 0x5c, 0xc9, 0x30, 0xd6, 0xb1, 0x01, 0x25, 0xaf,
-	0x66, 0xf3, 0x06, 0xe8, 0xdc, 0x9c, 0xb0, 0x3e, 0xce, 0x59, 0xeb, 0xea, 0x9c, 0x75, 0x3d, 0x9e, 0x27, 0x71, 0x1c,
-	0x9f, 0x27, 0xb0, 0xfe, 0xcf, 0x59, 0x0a, 0x83, 0x9c, 0xa6, 0x68, 0xc8, 0x69, 0x13, 0x14, 0x39, 0x69, 0x63, 0x23,
-	0x63, 0x3f, 0x94, 0x0c, 0x49, 0x91, 0x62, 0x58, 0x37, 0x60, 0xb2, 0x34, 0x18, 0x37, 0x19, 0x81, 0xe1, 0x93, 0x11,
-	0x18, 0x45, 0x19, 0x81, 0xc1, 0x94, 0x13, 0x36, 0xa6, 0x72, 0xd6, 0x09, 0xad, 0x2c, 0x81, 0x8d, 0xb0, 0x8c, 0xa4,
-	0x40, 0x13, 0x1f, 0x61, 0x88, 0x45, 0xc8, 0x06, 0x57, 0xc4, 0x6d, 0x58, 0x45, 0xdc, 0x0d, 0xa8, 0x48, 0x3a, 0xa1,
-	0x14, 0x29, 0x1b, 0x44, 0x11, 0xa7, 0xf0, 0x89, 0x04, 0x05, 0x4e, 0x24, 0x4c, 0xc8, 0x44, 0xd8, 0x06, 0x8b, 0x1e,
-	0xad, 0xb2, 0x66, 0xa0, 0x00, 0x71, 0x0f, 0x56, 0x59, 0x16, 0x83, 0x42, 0x0f, 0x1d, 0x4d, 0x0c, 0x84, 0x81, 0xa0,
-	0xe7, 0x90, 0x16, 0x16, 0xb2, 0xce, 0xe7, 0x53, 0x48, 0x96, 0xb2, 0x0e, 0x17, 0x98, 0x5c, 0x1d, 0x86, 0x76, 0xe8,
-	0x69, 0x41, 0xac, 0xa3, 0x05, 0xb6, 0x7e, 0x16, 0xd8, 0x75, 0xb3, 0x70, 0x8e, 0x97, 0x85, 0xb1, 0x4e, 0x16, 0x98,
-	0x7c, 0x2c, 0x38, 0xb9, 0x58, 0x70, 0xe3, 0x61, 0x41, 0xad, 0x83, 0xd3, 0xe0, 0xde, 0x94, 0x9d, 0xdc, 0xeb, 0x0d,
-	0xed, 0x0d, 0x89, 0xce, 0x4d, 0x03, 0xfb, 0x49, 0x8e, 0xa0, 0x6b, 0xd3, 0x50, 0x7f, 0x61, 0x10, 0xeb, 0x58, 0x1a,
-	0xe8, 0x1b, 0xc6, 0xba, 0x35, 0xa0, 0xe4, 0xd5, 0x50, 0x76, 0xf4, 0xaa, 0x20, 0xd6, 0xab, 0x02, 0x5b, 0xaf, 0x0a,
-	0xec, 0x7a, 0x55, 0x38, 0xc7, 0xab, 0xc2, 0x58, 0xaf, 0x0a, 0x4c, 0x5e, 0x15, 0x9c, 0xbc, 0x2a, 0xb8, 0xf1, 0xaa,
-	0xa0, 0xd6, 0xab, 0x69, 0x9f, 0xaf, 0x29, 0x3b, 0x79, 0xd5, 0xdb, 0xe5, 0x6b, 0x48, 0xf4, 0x6a, 0xda, 0x0a, 0x3b,
-	0xc9, 0x11, 0xf4, 0x6a, 0xda, 0x1c, 0xbb, 0x30, 0x88, 0xf5, 0x2a, 0x6d, 0x8d, 0x35, 0x8c, 0xf5, 0x6a, 0x40, 0xad,
-	0x57, 0xdf, 0x76, 0x0e, 0x4d, 0x1b, 0x93, 0xdf, 0x26, 0x67, 0x22, 0x24, 0x8e, 0x44, 0x28, 0xdb, 0x1a, 0x0a, 0x38,
-	0x4c, 0x26, 0x01, 0x1a, 0x37, 0x87, 0x02, 0x94, 0x36, 0x81, 0x02, 0x96, 0x76, 0x81, 0x02, 0x26, 0xdb, 0x40, 0x01,
-	0x11, 0x67, 0x01, 0xb4, 0xc1, 0xe2, 0xc4, 0x6d, 0x13, 0x80, 0x98, 0x3d, 0x69, 0x6f, 0xf3, 0x6d, 0x13, 0x00, 0xf3,
-	0x82, 0xd4, 0xdb, 0xb4, 0x6d, 0x02, 0x10, 0xbb, 0xac, 0xf4, 0x56, 0xb7, 0x4d, 0x00, 0x94, 0xef, 0x3a, 0x7b, 0x9b,
-	0xb6, 0x4d, 0x28, 0x12, 0x37, 0x1b, 0x2d, 0x13, 0x02, 0x8b, 0x25, 0x6f, 0xd3, 0x62, 0x23, 0x20, 0x12, 0x7f, 0x88,
-	0x38, 0x6b, 0xb0, 0x6f, 0x71, 0x2d, 0x11, 0x41, 0x5d, 0x40, 0x04, 0xd4, 0xac, 0xc1, 0xbe, 0xd5, 0xa5, 0x42, 0x80,
-	0xec, 0x66, 0xaa, 0xb7, 0xdd, 0xa2, 0x20, 0x5c, 0x50, 0x56, 0x6b, 0x3f, 0x63, 0xb5, 0x97, 0xb1, 0x9a, 0xb2, 0x50,
-	0xfb, 0x6b, 0xbf, 0x6f, 0x75, 0x49, 0x0f, 0x20, 0xb3, 0xca, 0xfb, 0x36, 0x2d, 0xde, 0x29, 0x92, 0x36, 0x1b, 0x45,
-	0x53, 0xbf, 0xc3, 0xcd, 0xcf, 0xef, 0x68, 0xf3, 0xf3, 0x3b, 0x7f, 0xf3, 0xf3, 0x3b, 0x6f, 0xf3, 0xf3, 0x3b, 0xda,
-	0xfc, 0xfc, 0xae, 0xb4, 0xf9, 0xf9, 0x1d, 0x6f, 0x7e, 0x7e, 0xc7, 0x9b, 0x9f, 0xdf, 0xd9, 0xcd, 0xcf, 0xef, 0xbb,
-	0xf5, 0xf9, 0xb1, 0x5e, 0x18, 0xbd, 0x7d, 0x9f, 0xaf, 0xc4, 0x03, 0xcc, 0x72, 0xfa, 0x3e, 0xad, 0xb9, 0x03, 0xe2,
-	0xef, 0x9e, 0x79, 0xaf, 0xab, 0xeb, 0x00, 0x89, 0xb1, 0x01, 0x31, 0xe2, 0xf9, 0xbe, 0xd3, 0xcd, 0x89, 0x5e, 0x98,
-	0xfd, 0x71, 0xef, 0x8d, 0x5a, 0x2a, 0xfe, 0x51, 0xab, 0xc6, 0xfb, 0xe4, 0x10, 0x40, 0xbc, 0x3a, 0xfb, 0x1e, 0x1d,
-	0x02, 0xa0, 0xa9, 0xb3, 0xef, 0xad, 0x43, 0x80, 0xb0, 0x95, 0xf9, 0xbd, 0x3a, 0x04, 0xa0, 0xbc, 0x32, 0xbf, 0x47,
-	0x55, 0x7f, 0x8f, 0x82, 0xfe, 0xbe, 0x53, 0x6e, 0x65, 0x3e, 0x99, 0x7a, 0xf1, 0x1e, 0xf5, 0x3a, 0x81, 0x21, 0x11,
-	0xfa, 0x58, 0x10, 0xeb, 0x68, 0x81, 0x5d, 0x6f, 0x0b, 0xe7, 0xb8, 0x5c, 0x18, 0xeb, 0x77, 0x81, 0x0b, 0xce, 0x17,
-	0x96, 0x22, 0x40, 0x70, 0x1b, 0x06, 0x02, 0xdb, 0x58, 0x48, 0x53, 0xae, 0x13, 0x83, 0xd8, 0xa8, 0xf0, 0xa6, 0x5c,
-	0x0d, 0x89, 0xf1, 0x21, 0x88, 0x0d, 0x12, 0x81, 0xdd, 0x48, 0x11, 0xce, 0x09, 0x17, 0x61, 0x6c, 0xcc, 0x08, 0x5c,
-	0x08, 0x1c, 0x61, 0x29, 0x7a, 0x04, 0xa7, 0x10, 0x12, 0xdc, 0xc4, 0x11, 0x4d, 0x26, 0xbf, 0xa7, 0xc9, 0xe4, 0xf7,
-	0x69, 0xea, 0xd8, 0xa4, 0xa1, 0xd8, 0xa2, 0xa9, 0xe3, 0xc4, 0x04, 0x6b, 0x63, 0x80, 0x09, 0x62, 0x03, 0x4c, 0x60,
-	0x37, 0xc0, 0x84, 0x73, 0x02, 0x4c, 0x18, 0x1b, 0x60, 0x02, 0x17, 0x02, 0x4c, 0x58, 0x0a, 0x30, 0xc1, 0x6d, 0x80,
-	0x09, 0x6c, 0x03, 0x2c, 0x2d, 0x07, 0x4f, 0x0c, 0x62, 0x03, 0xcc, 0x5b, 0x0c, 0x36, 0x24, 0x06, 0x98, 0x20, 0x36,
-	0xc0, 0x04, 0x76, 0x03, 0x4c, 0x38, 0x27, 0xc0, 0x84, 0xb1, 0x01, 0x26, 0x70, 0x21, 0xc0, 0x84, 0xa5, 0x00, 0x13,
-	0x9c, 0x02, 0x4c, 0x70, 0x13, 0x60, 0x69, 0x95, 0xdb, 0xc4, 0xc2, 0x9a, 0x4a, 0xff, 0x89, 0xd2, 0x50, 0x80, 0xd1,
-	0x12, 0xb7, 0x32, 0xf9, 0x5e, 0xb2, 0xb1, 0x8b, 0x53, 0xb0, 0x95, 0xf6, 0x92, 0xf9, 0x29, 0xbc, 0xc0, 0x73, 0xf6,
-	0x92, 0xf9, 0x64, 0x29, 0x08, 0xbd, 0xbd, 0x64, 0x3e, 0x4b, 0x01, 0xe9, 0xec, 0x25, 0x73, 0xc9, 0x2c, 0x38, 0x9d,
-	0x25, 0xf7, 0x02, 0xe9, 0x07, 0x2a, 0xa0, 0x59, 0xb8, 0x22, 0x4e, 0x41, 0x8b, 0xa4, 0x1f, 0xba, 0x98, 0xc2, 0x0b,
-	0x60, 0xe4, 0x29, 0x8c, 0x91, 0x2c, 0x05, 0x33, 0xa6, 0xe1, 0x90, 0x46, 0x96, 0x03, 0x1b, 0x59, 0x1b, 0xde, 0xf9,
-	0x06, 0x04, 0x37, 0x1e, 0xd7, 0x05, 0xfb, 0x7d, 0x2a, 0xa4, 0xe7, 0xb0, 0xf7, 0x77, 0x1f, 0x44, 0xfe, 0x0f, 0x7b,
-	0x34, 0xed, 0x0f, 0x3a, 0x9a, 0xf6, 0x47, 0xb6, 0x76, 0x67, 0x50, 0x4a, 0x9c, 0x9d, 0xcf, 0x31, 0x28, 0x27, 0xce,
-	0xcf, 0x9d, 0x11, 0xce, 0x37, 0x40, 0x69, 0xe8, 0x26, 0xe0, 0xec, 0x8d, 0x1f, 0xb2, 0x81, 0xe2, 0x07, 0x1e, 0x28,
-	0x7e, 0xe0, 0x81, 0xe2, 0x87, 0xc2, 0x40, 0xf1, 0x83, 0x3b, 0x50, 0xfc, 0xc0, 0x03, 0xc5, 0x0f, 0xce, 0x40, 0xf1,
-	0x83, 0x33, 0x50, 0xfc, 0x40, 0x03, 0xc5, 0x0f, 0x3c, 0x50, 0xfc, 0xd0, 0x49, 0xd3, 0x54, 0x2f, 0x4c, 0x3d, 0xf9,
-	0x90, 0x8b, 0x10, 0xc0, 0x5c, 0x23, 0x3e, 0x24, 0xb9, 0x01, 0xc4, 0x8f, 0xfd, 0x0f, 0x2a, 0x2c, 0x00, 0x99, 0xbd,
-	0x87, 0x1f, 0x92, 0x84, 0x28, 0xb2, 0xc9, 0xb2, 0xbe, 0x61, 0x73, 0xc7, 0x71, 0xed, 0x5c, 0x91, 0x82, 0xb5, 0x37,
-	0xae, 0xb5, 0x37, 0x6c, 0xed, 0x34, 0xb4, 0x85, 0x67, 0x3a, 0xc6, 0xde, 0x90, 0xb1, 0xe3, 0xe0, 0x56, 0xef, 0xbb,
-	0xad, 0x77, 0x28, 0xa6, 0x1f, 0xd2, 0x68, 0x57, 0x91, 0xfc, 0xdd, 0x15, 0x97, 0x30, 0x8e, 0x77, 0x33, 0xc8, 0x2f,
-	0x62, 0xe5, 0x16, 0x11, 0x87, 0xbc, 0x08, 0x4b, 0xc9, 0x35, 0xb7, 0x15, 0x17, 0xbc, 0x72, 0x0a, 0xfe, 0xe5, 0xf4,
-	0xed, 0x4b, 0xb5, 0x87, 0xad, 0x30, 0x1f, 0xba, 0x71, 0x30, 0x24, 0xa8, 0xb9, 0x10, 0x75, 0x21, 0xc7, 0xb5, 0x9b,
-	0xe3, 0x9a, 0x9d, 0x62, 0x06, 0xc3, 0xc8, 0x70, 0xae, 0xe3, 0x68, 0x18, 0x53, 0x91, 0x6f, 0xd2, 0x70, 0x58, 0x13,
-	0x1d, 0xf2, 0x2b, 0x2e, 0xc6, 0x81, 0x7d, 0x91, 0x1f, 0xbf, 0x01, 0xe2, 0x58, 0x3d, 0x6c, 0xc9, 0xff, 0x4d, 0x96,
-	0xa4, 0xe1, 0x37, 0x34, 0x05, 0x43, 0x35, 0xae, 0xa1, 0x1a, 0x36, 0x54, 0x53, 0x34, 0x54, 0xc3, 0x86, 0x6a, 0x1c,
-	0xf7, 0x36, 0x14, 0xd7, 0xcf, 0xd9, 0xd5, 0x29, 0xbf, 0xe2, 0x22, 0xc0, 0x6e, 0xa6, 0xf4, 0xa6, 0x74, 0x7e, 0x55,
-	0xd3, 0xe5, 0x07, 0x58, 0x09, 0x27, 0x19, 0x75, 0x8e, 0xb0, 0x12, 0xe9, 0x19, 0x29, 0x3f, 0xc4, 0x4a, 0x38, 0x4b,
-	0xab, 0x39, 0xc6, 0x4a, 0x84, 0xb5, 0x4f, 0x7e, 0x90, 0xd5, 0xe2, 0x28, 0xb7, 0xf9, 0x80, 0xc3, 0xc2, 0xae, 0xf0,
-	0xd2, 0x80, 0xc3, 0x32, 0x56, 0x82, 0xdd, 0x01, 0x87, 0x65, 0x49, 0x8c, 0xf3, 0x01, 0x87, 0x85, 0xad, 0x2c, 0x07,
-	0x78, 0xc3, 0x85, 0x65, 0x81, 0x16, 0xdc, 0xaa, 0xb4, 0xc0, 0xe7, 0x9c, 0xe9, 0xea, 0xb5, 0x50, 0x05, 0x67, 0xb2,
-	0x72, 0x0b, 0x5e, 0xf2, 0x25, 0x69, 0xb8, 0xc0, 0x56, 0x2c, 0x62, 0x6f, 0x24, 0xaf, 0xcd, 0x59, 0x1f, 0xc5, 0x3e,
-	0xc3, 0xc9, 0x1e, 0x8b, 0xbb, 0xe0, 0xa4, 0x2a, 0x11, 0x3f, 0x63, 0x1e, 0x57, 0xeb, 0x23, 0xe5, 0x09, 0xbe, 0x70,
-	0x56, 0xf5, 0x05, 0x2e, 0x58, 0xce, 0xd1, 0xff, 0x40, 0x70, 0x23, 0x10, 0xf0, 0x9a, 0x93, 0x72, 0x73, 0x20, 0xf8,
-	0xb9, 0xe2, 0xb9, 0x0d, 0x83, 0x50, 0x05, 0xef, 0x17, 0x9b, 0x08, 0xa1, 0x0b, 0x45, 0xe4, 0xc6, 0x42, 0x70, 0x3f,
-	0x08, 0xb8, 0xd9, 0x08, 0xf8, 0xc1, 0x81, 0x0a, 0x05, 0xe7, 0x56, 0x24, 0xe2, 0x7e, 0x53, 0x12, 0x58, 0xaf, 0x3d,
-	0x09, 0x4c, 0xc3, 0x89, 0xb9, 0x65, 0x11, 0xfc, 0x9c, 0xcd, 0xdd, 0x36, 0x46, 0xa8, 0x82, 0xcd, 0x8b, 0xad, 0x8d,
-	0xd0, 0x05, 0x9b, 0x3b, 0xed, 0x8e, 0x10, 0x7e, 0x85, 0x7c, 0x66, 0xe8, 0xe4, 0x40, 0x85, 0x42, 0xbb, 0x0d, 0x12,
-	0x98, 0x3a, 0x6f, 0x96, 0x90, 0xe0, 0x07, 0x22, 0xcb, 0x4d, 0x14, 0xb2, 0x05, 0x4b, 0x63, 0x12, 0xd7, 0xde, 0x98,
-	0x80, 0xad, 0x8e, 0xac, 0xd3, 0x74, 0x21, 0xed, 0xd8, 0x18, 0x69, 0xb2, 0x34, 0x92, 0xdc, 0x98, 0xe5, 0x93, 0x1b,
-	0x53, 0x17, 0xa7, 0x86, 0xad, 0x34, 0xb9, 0xe1, 0xa7, 0xf0, 0x1a, 0x39, 0x67, 0x72, 0xc3, 0x27, 0x4b, 0x0d, 0x9e,
-	0x37, 0xb9, 0xe1, 0xb3, 0xd4, 0xf8, 0x39, 0x93, 0x1b, 0x2e, 0xb9, 0x29, 0x19, 0xca, 0x69, 0x0e, 0x91, 0xa5, 0x46,
-	0x11, 0xc9, 0x1f, 0x87, 0x8f, 0xdf, 0x40, 0x62, 0x82, 0xb3, 0xe1, 0xe3, 0x34, 0x96, 0xc8, 0x9e, 0x8f, 0x1e, 0x6e,
-	0x38, 0x91, 0x24, 0xe5, 0xcc, 0x86, 0xdb, 0x46, 0xc2, 0x78, 0x28, 0xee, 0x3f, 0xb5, 0x58, 0x10, 0xa7, 0x59, 0x45,
-	0x96, 0xc5, 0x36, 0x63, 0x7f, 0x68, 0x66, 0xbf, 0xa1, 0xcd, 0x12, 0xb8, 0xcd, 0x2d, 0xa6, 0xa0, 0x46, 0x17, 0xc9,
-	0xb3, 0x7e, 0xf0, 0x1a, 0x60, 0xa0, 0x9d, 0x66, 0x18, 0xd8, 0xba, 0x74, 0x9b, 0xd3, 0x24, 0x23, 0xfb, 0x63, 0xa3,
-	0xf8, 0xcd, 0x33, 0x26, 0x38, 0x1b, 0x7b, 0xe5, 0xa6, 0x1a, 0x13, 0x9d, 0x35, 0x8c, 0xd3, 0x6c, 0x23, 0x7b, 0x2e,
-	0x04, 0x9d, 0x26, 0x1c, 0xd8, 0x43, 0x91, 0x38, 0x6b, 0x34, 0xa7, 0x51, 0xcf, 0xd8, 0x42, 0xd3, 0x0e, 0xb0, 0xdb,
-	0xc0, 0x03, 0xdf, 0x94, 0x6e, 0x74, 0x1a, 0x7b, 0x64, 0x7f, 0xec, 0x4d, 0xbf, 0xe1, 0xc7, 0x04, 0x67, 0xbd, 0x59,
-	0xee, 0x04, 0x60, 0xa2, 0xb3, 0xde, 0xf4, 0x3a, 0x04, 0x48, 0x9f, 0x93, 0x9b, 0xe7, 0x12, 0x71, 0x2a, 0x12, 0x67,
-	0x0d, 0xe6, 0x74, 0x17, 0x3e, 0xe2, 0xc7, 0x7f, 0x3e, 0xd2, 0x77, 0x7f, 0x3e, 0xd2, 0x27, 0x7f, 0x3e, 0x0e, 0xdc,
-	0xaf, 0xfd, 0x7c, 0xf4, 0x3e, 0xf4, 0xf3, 0x91, 0xbe, 0xf1, 0xf3, 0x91, 0x3f, 0xef, 0xf3, 0x91, 0xbf, 0xec, 0xf3,
-	0xd1, 0x7e, 0xd4, 0xe7, 0x23, 0x7d, 0xcf, 0xe7, 0xa3, 0xdd, 0x00, 0xf3, 0x91, 0xf6, 0xbe, 0x7c, 0x4c, 0x67, 0x5f,
-	0x2c, 0x62, 0x0b, 0x99, 0x9f, 0x7d, 0xb1, 0xb0, 0x5b, 0x5c, 0x3a, 0xfb, 0x62, 0x19, 0x5b, 0x70, 0x73, 0xf6, 0xc5,
-	0xe2, 0x64, 0x82, 0xec, 0xec, 0x8b, 0x45, 0xad, 0x31, 0xdc, 0xc3, 0x23, 0x1f, 0xfd, 0xc3, 0x23, 0xb8, 0x46, 0xf0,
-	0xaa, 0x00, 0x5b, 0x03, 0x39, 0x87, 0x47, 0x5c, 0xce, 0x35, 0x95, 0x7f, 0x78, 0xc4, 0xa5, 0xad, 0xd1, 0xbc, 0xc3,
-	0x23, 0x2e, 0x49, 0xe6, 0xe3, 0xc3, 0x23, 0x2e, 0x65, 0x0d, 0x59, 0x3e, 0x50, 0x81, 0x14, 0x99, 0x14, 0x0f, 0x54,
-	0x38, 0xa0, 0x35, 0x27, 0x1d, 0xa8, 0x70, 0x18, 0xd7, 0x94, 0xde, 0x81, 0x0a, 0x87, 0xb4, 0x66, 0xe4, 0x03, 0x15,
-	0x0e, 0x45, 0x26, 0xb4, 0x07, 0x2a, 0x1c, 0xc2, 0x9a, 0xaf, 0x74, 0xec, 0x40, 0x09, 0x32, 0x5d, 0x3a, 0x76, 0x60,
-	0x11, 0x6b, 0xb4, 0xfc, 0xd8, 0x81, 0x85, 0x5d, 0x73, 0xd1, 0xb1, 0x03, 0xcb, 0x58, 0x43, 0x99, 0x63, 0x07, 0x16,
-	0x27, 0x13, 0x65, 0xc7, 0x0e, 0x2c, 0x6a, 0x8d, 0xe3, 0xee, 0xdb, 0xff, 0xe8, 0xef, 0xdb, 0xcf, 0x57, 0xda, 0x5e,
-	0x15, 0x09, 0x6b, 0x24, 0x77, 0xdf, 0x7e, 0x81, 0x75, 0x4d, 0x56, 0xda, 0xb7, 0x5f, 0x48, 0x60, 0x0d, 0xe8, 0xef,
-	0xdb, 0x2f, 0xd0, 0x64, 0x4e, 0x6f, 0xdf, 0x7e, 0x81, 0xb4, 0xc6, 0x3d, 0xb7, 0x73, 0xfd, 0xe3, 0xd9, 0x9d, 0xeb,
-	0x71, 0xc1, 0xf2, 0x95, 0x03, 0x59, 0xf3, 0x9a, 0x9d, 0xeb, 0x84, 0xbb, 0x26, 0xe5, 0x9d, 0xeb, 0x44, 0x59, 0x33,
-	0xda, 0x9d, 0xeb, 0x44, 0x90, 0xe9, 0xf2, 0x9d, 0xeb, 0x04, 0x5b, 0x73, 0xf9, 0x3b, 0xbe, 0x23, 0x4c, 0x26, 0x92,
-	0xd7, 0xbd, 0x72, 0x20, 0x6b, 0xa2, 0x88, 0x5b, 0x13, 0x45, 0xdc, 0x35, 0x51, 0x24, 0x1d, 0x13, 0x45, 0xca, 0x9a,
-	0x28, 0xe2, 0x64, 0xa2, 0x48, 0x90, 0x89, 0x22, 0x61, 0x4c, 0x14, 0x61, 0x6b, 0x22, 0xc1, 0xad, 0x89, 0x04, 0x26,
-	0x13, 0xf5, 0x4f, 0x7d, 0x45, 0x80, 0x35, 0x4f, 0x40, 0xad, 0x71, 0x02, 0xea, 0x9a, 0x26, 0x50, 0x8e, 0x61, 0x02,
-	0x61, 0xcd, 0x12, 0x50, 0x32, 0x4a, 0x80, 0xc9, 0x24, 0x01, 0x36, 0x06, 0x09, 0xa0, 0x35, 0x47, 0x8f, 0x5a, 0x63,
-	0xf4, 0xa0, 0x35, 0xc5, 0x35, 0x7e, 0xd6, 0xf0, 0x9a, 0x3e, 0x6b, 0x78, 0x4d, 0x9f, 0x35, 0xbc, 0x1e, 0xb8, 0x9f,
-	0x35, 0xbc, 0xf6, 0x3e, 0x6b, 0x78, 0x4d, 0x9f, 0x35, 0xbc, 0xe6, 0xcf, 0x1a, 0x5e, 0xf3, 0x67, 0x0d, 0xaf, 0xed,
-	0x67, 0x0d, 0xaf, 0xe9, 0xb3, 0x86, 0xd7, 0xdd, 0xc7, 0xb2, 0xb5, 0x10, 0x6f, 0x8c, 0x93, 0xae, 0xcd, 0x27, 0xb2,
-	0x15, 0xbf, 0xca, 0x2e, 0x8c, 0xc7, 0xaf, 0xfd, 0xf9, 0xa1, 0x6b, 0x6f, 0x52, 0xe8, 0x9a, 0x66, 0x82, 0xae, 0x4b,
-	0xd3, 0x3f, 0xd7, 0x3c, 0xe7, 0x73, 0x4d, 0x13, 0x3d, 0xd7, 0x34, 0xbb, 0x73, 0x3d, 0x80, 0xcf, 0x52, 0x5e, 0xa7,
-	0x69, 0x1c, 0x40, 0xa4, 0xd4, 0x80, 0x60, 0xf6, 0x01, 0xe6, 0x9d, 0xe9, 0xd7, 0x69, 0x5e, 0x06, 0x90, 0x98, 0x4b,
-	0x80, 0xa2, 0x6f, 0x00, 0x0a, 0xbe, 0x01, 0x40, 0xf2, 0xad, 0x88, 0x8c, 0x1f, 0xa7, 0x00, 0xc8, 0x94, 0xca, 0x2c,
-	0x22, 0x99, 0x2f, 0x2b, 0x0a, 0xbb, 0x38, 0x5f, 0x82, 0x88, 0x1b, 0x76, 0x95, 0x17, 0x76, 0x38, 0x17, 0x02, 0x28,
-	0x05, 0x63, 0xc5, 0xc1, 0x58, 0x71, 0x30, 0xc6, 0xd9, 0x0d, 0x45, 0xea, 0xec, 0x82, 0x32, 0x5f, 0xfb, 0x59, 0xad,
-	0xbd, 0xac, 0xd6, 0x94, 0x29, 0x33, 0x2b, 0x01, 0x04, 0xe7, 0x36, 0x4e, 0x3f, 0x00, 0x42, 0x15, 0x45, 0xe7, 0x19,
-	0x92, 0xf1, 0x61, 0x8c, 0xaf, 0x3e, 0x6a, 0xd0, 0x83, 0x0d, 0x05, 0x5b, 0xe3, 0x87, 0x56, 0xe3, 0x85, 0x56, 0x43,
-	0xa1, 0x65, 0x06, 0xe7, 0x40, 0x70, 0xcc, 0x35, 0x1c, 0x73, 0x4d, 0x1e, 0x73, 0xeb, 0x4e, 0xb5, 0x66, 0x7a, 0x61,
-	0xb6, 0x09, 0xad, 0x93, 0x6a, 0x01, 0xe2, 0x6d, 0x82, 0x5f, 0xa3, 0x6a, 0x01, 0x68, 0x36, 0xc1, 0xaf, 0x55, 0xb5,
-	0x00, 0xb2, 0xfb, 0xf0, 0xd7, 0x51, 0xb5, 0x00, 0x30, 0xbb, 0xdf, 0xd7, 0xb8, 0x23, 0x6f, 0x4d, 0xdb, 0xf0, 0xd6,
-	0xfe, 0xde, 0xbb, 0xb5, 0xb7, 0xe1, 0x6e, 0x4d, 0xbb, 0xec, 0xd6, 0xa5, 0xad, 0x75, 0x6b, 0xde, 0x4f, 0xb7, 0xa6,
-	0x4d, 0x74, 0x6b, 0xda, 0x39, 0xb7, 0xc6, 0xc3, 0x1c, 0x6b, 0x3a, 0xcc, 0xb1, 0xa6, 0xc3, 0x1c, 0x6b, 0xff, 0x30,
-	0xc7, 0xda, 0x3b, 0xcc, 0xb1, 0xa6, 0xc3, 0x1c, 0x6b, 0x3e, 0xcc, 0xb1, 0xe6, 0xc3, 0x1c, 0x6b, 0x7b, 0x98, 0x63,
-	0x4d, 0x87, 0x39, 0xd6, 0x51, 0x6d, 0x96, 0x09, 0xa8, 0x74, 0xdf, 0xd9, 0x9a, 0x3e, 0x1c, 0xbb, 0xa6, 0x0f, 0xc7,
-	0xae, 0xfd, 0x0f, 0xc7, 0xae, 0xbd, 0x0f, 0xc7, 0xae, 0xdd, 0x0f, 0xc7, 0xae, 0xe9, 0xc3, 0xb1, 0x6b, 0xfe, 0x70,
-	0xec, 0x9a, 0x3f, 0x1c, 0xbb, 0x4e, 0x62, 0xa3, 0xa5, 0xa9, 0x91, 0xb6, 0x9f, 0x92, 0x5d, 0xfb, 0x9f, 0x92, 0x5d,
-	0x7b, 0x9f, 0x92, 0x5d, 0xd3, 0xa7, 0x64, 0xd7, 0xa5, 0x4f, 0xc9, 0xae, 0xf9, 0x53, 0xb2, 0x6b, 0xfa, 0x94, 0xec,
-	0x9a, 0x3e, 0x25, 0xbb, 0x4e, 0x62, 0xa3, 0xb6, 0x6f, 0x90, 0xb6, 0x9f, 0x65, 0x5b, 0xfb, 0xdf, 0x62, 0x5b, 0x7b,
-	0x1f, 0x60, 0x5b, 0xd3, 0x57, 0xd7, 0xd6, 0xa5, 0x4f, 0xad, 0xad, 0xf9, 0xfb, 0x6a, 0x6b, 0xfe, 0xa8, 0xda, 0xda,
-	0x7e, 0x49, 0x6d, 0xdd, 0xcd, 0xd5, 0x69, 0xf8, 0x9f, 0xa8, 0x7a, 0x9e, 0xb8, 0x1e, 0x7e, 0xea, 0xd7, 0xed, 0x46,
-	0x7a, 0x15, 0x27, 0xf5, 0x00, 0x8a, 0x2b, 0x74, 0x00, 0x65, 0xb3, 0xa1, 0x80, 0xc3, 0x14, 0x28, 0xa0, 0x71, 0xde,
-	0x13, 0xa0, 0xb4, 0xea, 0x06, 0x58, 0x9a, 0xbd, 0x04, 0x4c, 0xa6, 0x2c, 0x01, 0x89, 0x8b, 0x6a, 0x0a, 0xb5, 0xa2,
-	0xb4, 0x9c, 0xa5, 0x8b, 0xd8, 0x9c, 0x29, 0x92, 0x35, 0x67, 0x0a, 0x43, 0x73, 0xa6, 0x60, 0x6c, 0xce, 0x14, 0x31,
-	0xcd, 0x99, 0x12, 0xa9, 0x39, 0x53, 0x28, 0x36, 0x67, 0x8a, 0xc4, 0xe6, 0x2c, 0x21, 0x1b, 0x58, 0x66, 0xf8, 0xa4,
-	0x6b, 0x5b, 0x00, 0x99, 0x5e, 0xd1, 0x27, 0xb3, 0x8a, 0x05, 0x29, 0x9d, 0xef, 0x2d, 0x7d, 0xd2, 0xf5, 0x2a, 0x80,
-	0x6c, 0x23, 0xf5, 0x09, 0x56, 0xa6, 0x20, 0x99, 0x18, 0x1b, 0x90, 0x68, 0x6c, 0x85, 0xa4, 0xdd, 0x9d, 0x03, 0x10,
-	0xfa, 0x46, 0x9a, 0x24, 0xbf, 0xa1, 0xe2, 0x22, 0xa6, 0xd5, 0x24, 0x84, 0xfc, 0x32, 0x56, 0x6e, 0x19, 0xb3, 0xc5,
-	0x22, 0x80, 0xb9, 0xe8, 0x15, 0x17, 0xbd, 0x72, 0x8a, 0x4e, 0x2b, 0x40, 0x9f, 0x06, 0x5b, 0xac, 0x24, 0x5b, 0x53,
-	0x97, 0x5a, 0xc4, 0x9e, 0x0b, 0xfd, 0xd4, 0x2f, 0x14, 0xe9, 0xfd, 0x35, 0x97, 0xbb, 0x2e, 0x14, 0xb2, 0x76, 0x0b,
-	0x59, 0x73, 0x69, 0xec, 0x8a, 0x0f, 0x30, 0xa9, 0x42, 0x01, 0x16, 0x17, 0x77, 0x00, 0x62, 0x87, 0xa6, 0xfe, 0x95,
-	0x42, 0xd0, 0xbf, 0x52, 0x3f, 0x37, 0x59, 0x9d, 0x6b, 0x58, 0x27, 0x9a, 0x82, 0x28, 0x34, 0xae, 0x28, 0x34, 0x2c,
-	0x0a, 0x76, 0x05, 0x04, 0x18, 0x47, 0x2e, 0x1a, 0x47, 0x2e, 0x1a, 0x2b, 0x17, 0x69, 0x5a, 0x9e, 0x20, 0xca, 0x7f,
-	0x3e, 0x31, 0x4f, 0xb8, 0x5f, 0x38, 0x9a, 0x9a, 0x27, 0x8a, 0x8a, 0x69, 0x26, 0xe7, 0x89, 0xe0, 0x62, 0x65, 0xd3,
-	0xf3, 0x04, 0x93, 0x1e, 0xa6, 0x33, 0x60, 0x49, 0x74, 0xf2, 0x33, 0x60, 0x16, 0x76, 0xe5, 0x91, 0xce, 0x80, 0x59,
-	0xc6, 0x0a, 0xa5, 0x7b, 0x06, 0xcc, 0xb2, 0x24, 0x99, 0xf9, 0x19, 0x30, 0x0b, 0x5b, 0xf1, 0x0c, 0x70, 0x26, 0x36,
-	0x02, 0x51, 0x5d, 0x13, 0xdc, 0x6a, 0xa9, 0xc0, 0x7e, 0x3d, 0x14, 0xd2, 0xab, 0x8c, 0x42, 0x51, 0x8d, 0x14, 0x9c,
-	0x44, 0x46, 0x70, 0x56, 0x1a, 0x21, 0xac, 0xd2, 0x0a, 0x6c, 0x46, 0xa2, 0x9f, 0xe2, 0x5a, 0x4b, 0x5e, 0x15, 0xb3,
-	0x15, 0x18, 0xfb, 0x0c, 0x27, 0x7b, 0xac, 0xc0, 0x82, 0x93, 0x0c, 0x47, 0xfc, 0x8c, 0x79, 0x5c, 0x41, 0x8e, 0x94,
-	0xa7, 0xca, 0xc2, 0x15, 0x4c, 0xc7, 0xfa, 0x2c, 0x78, 0xc9, 0x74, 0xac, 0xd4, 0x01, 0x47, 0xb9, 0x16, 0xc4, 0x6a,
-	0xb6, 0xc0, 0x24, 0xdc, 0x01, 0xaf, 0xf9, 0x99, 0x2c, 0xe1, 0x82, 0x9f, 0x33, 0x90, 0x2b, 0xe6, 0x42, 0x15, 0x8c,
-	0x50, 0x94, 0x75, 0xa1, 0x0b, 0x36, 0x62, 0x7d, 0x17, 0x9c, 0x44, 0x3e, 0x5f, 0x9d, 0xb3, 0xb8, 0x27, 0xf7, 0x81,
-	0x69, 0x58, 0x57, 0x58, 0xf8, 0x05, 0x3f, 0x27, 0x90, 0x6e, 0x13, 0x20, 0x54, 0x41, 0x20, 0x8b, 0x8d, 0x81, 0xd0,
-	0x25, 0xfd, 0x74, 0x9a, 0x05, 0x21, 0xac, 0x7e, 0xe2, 0x42, 0x9a, 0x87, 0x52, 0x41, 0x69, 0x29, 0xcd, 0xa3, 0x7c,
-	0x33, 0x78, 0x8b, 0x69, 0x1e, 0x4b, 0xc6, 0xe0, 0xe5, 0x34, 0x8f, 0xe3, 0x32, 0xdb, 0x05, 0x35, 0x8f, 0xa1, 0x96,
-	0x23, 0x51, 0xd8, 0x78, 0x28, 0x68, 0xdb, 0x0f, 0x65, 0xdc, 0x26, 0x44, 0x69, 0xa7, 0x15, 0x51, 0xd2, 0x36, 0x24,
-	0xca, 0x14, 0xda, 0x12, 0x4d, 0x40, 0xcd, 0x89, 0x52, 0xb6, 0x45, 0x51, 0xc6, 0x36, 0x2a, 0x89, 0xc9, 0xc4, 0x54,
-	0x51, 0xd2, 0x00, 0xa5, 0x6c, 0xeb, 0xa2, 0x8c, 0x2f, 0x10, 0xca, 0x7b, 0x1a, 0xa1, 0x2c, 0xc9, 0x84, 0x52, 0x24,
-	0x05, 0x4a, 0xb1, 0x62, 0x2a, 0x67, 0xdb, 0x1b, 0x65, 0x6c, 0x93, 0x03, 0xcb, 0xaa, 0xb9, 0x22, 0xd8, 0xf5, 0x56,
-	0xe7, 0x61, 0x7e, 0x9e, 0xb9, 0xf9, 0x51, 0x8a, 0x5a, 0x20, 0xa0, 0xce, 0x9b, 0xd0, 0x6d, 0x87, 0x80, 0xf5, 0x9a,
-	0x22, 0xa5, 0xcb, 0x16, 0xe6, 0x06, 0x49, 0xa9, 0x33, 0x16, 0xe6, 0x66, 0x29, 0x51, 0xd8, 0x32, 0x29, 0x68, 0x1b,
-	0x27, 0x65, 0xa8, 0x7d, 0x4a, 0x54, 0xed, 0x3e, 0x9f, 0x5b, 0x29, 0xa5, 0x7e, 0x60, 0x44, 0xb7, 0xad, 0x52, 0xb6,
-	0x6c, 0xa5, 0x62, 0x8b, 0xa5, 0x29, 0x78, 0x40, 0xa2, 0x1c, 0x35, 0x5c, 0x4a, 0x51, 0xdb, 0x45, 0xcb, 0xf9, 0x0e,
-	0xe5, 0xb5, 0x60, 0x89, 0x6c, 0x5c, 0x89, 0xe3, 0x76, 0x4c, 0xa9, 0x1f, 0x68, 0xb8, 0xdb, 0x9a, 0x29, 0x5b, 0xd6,
-	0xf0, 0x62, 0x9b, 0xa6, 0x29, 0xce, 0xa8, 0xbc, 0xd3, 0xb2, 0x29, 0x67, 0x54, 0x7e, 0xd3, 0xfd, 0xe6, 0xe3, 0x38,
-	0x5d, 0x3c, 0xe3, 0x05, 0x7c, 0x50, 0x79, 0x43, 0xdf, 0x52, 0xde, 0x78, 0x9f, 0x51, 0x16, 0x0d, 0xc4, 0x47, 0x06,
-	0xe4, 0x99, 0x90, 0x13, 0xdd, 0x45, 0x6f, 0x10, 0xd8, 0x79, 0x4d, 0xd0, 0x53, 0x7c, 0x4d, 0x40, 0x9e, 0x09, 0x39,
-	0xd1, 0x5d, 0xf4, 0x1a, 0x81, 0x9d, 0xd7, 0x80, 0x7b, 0xf1, 0x5d, 0x00, 0x3f, 0xfb, 0xf0, 0xc9, 0x7f, 0x08, 0xbd,
-	0x1a, 0x39, 0xe7, 0xfd, 0x09, 0xc2, 0xb7, 0x27, 0xf0, 0xd9, 0x03, 0x4f, 0xde, 0xed, 0xf4, 0x5e, 0x65, 0x9c, 0xb7,
-	0x86, 0xb0, 0xc4, 0x57, 0x06, 0xe4, 0x99, 0x90, 0x13, 0xdd, 0x45, 0x6f, 0x12, 0xd8, 0x79, 0x8d, 0x04, 0x30, 0xbe,
-	0x47, 0xa0, 0x67, 0x86, 0x4e, 0x7c, 0x23, 0xbd, 0x2a, 0xe2, 0xce, 0xbb, 0xf4, 0x47, 0xd6, 0xc7, 0x06, 0x7a, 0x66,
-	0xe8, 0xc4, 0x37, 0xd2, 0xbb, 0xf8, 0x47, 0xd6, 0x13, 0x15, 0x7f, 0x9d, 0x79, 0x9c, 0x01, 0xcf, 0x16, 0x38, 0xd9,
-	0x5b, 0xe8, 0x1d, 0xf6, 0xd7, 0x99, 0x13, 0x91, 0x7e, 0xab, 0x75, 0x9c, 0x23, 0xcf, 0x84, 0x9c, 0xe8, 0x2e, 0x7a,
-	0x0b, 0xfd, 0x56, 0x6b, 0x64, 0x6e, 0xda, 0xff, 0xd2, 0xe7, 0x80, 0x6e, 0xec, 0x2a, 0xfb, 0xcd, 0x60, 0xa7, 0x6f,
-	0x6b, 0x2f, 0x4c, 0x2b, 0xd5, 0x22, 0xd9, 0xba, 0x34, 0xe0, 0x66, 0x3d, 0xe6, 0x86, 0x96, 0xea, 0x6f, 0xf0, 0x87,
-	0xbb, 0x6e, 0xe8, 0x87, 0xbb, 0x6e, 0xfc, 0x1f, 0xee, 0xba, 0xf1, 0x7e, 0xb8, 0xeb, 0x86, 0x7e, 0xb8, 0xeb, 0xa6,
-	0xf4, 0xc3, 0x5d, 0x37, 0xfc, 0xc3, 0x5d, 0x37, 0xfc, 0xc3, 0x5d, 0x37, 0xf6, 0x87, 0xbb, 0x6e, 0xd0, 0x0f, 0x37,
-	0x38, 0xaf, 0x7e, 0x43, 0xf3, 0xea, 0x37, 0xde, 0xbc, 0xfa, 0xad, 0xfe, 0xfe, 0x5f, 0x04, 0xbe, 0x22, 0xfb, 0xd5,
-	0xb5, 0xe3, 0x6d, 0x3e, 0xb4, 0x9f, 0x65, 0xe8, 0x57, 0x4a, 0x57, 0x78, 0x48, 0x7e, 0xa2, 0x6e, 0x96, 0xa1, 0x5f,
-	0x29, 0x5d, 0xe9, 0x21, 0xf9, 0xd7, 0x00, 0xf4, 0x31, 0x82, 0x7f, 0x75, 0xd2, 0x16, 0x1e, 0xd5, 0x37, 0xcc, 0xc7,
-	0x6f, 0x9b, 0x5b, 0x58, 0x4a, 0x0c, 0x8f, 0xb5, 0x3f, 0x0b, 0x30, 0x64, 0xd6, 0x52, 0x64, 0x1d, 0x18, 0xd7, 0x26,
-	0xe4, 0x49, 0xe3, 0x3d, 0xab, 0x3f, 0xd5, 0xe0, 0x05, 0x99, 0x13, 0x32, 0xd6, 0xad, 0x95, 0xe7, 0xd6, 0xca, 0x75,
-	0x50, 0x65, 0xc6, 0xd7, 0x39, 0x8c, 0x99, 0xa1, 0x66, 0x53, 0x90, 0x17, 0x4a, 0x73, 0xa2, 0x34, 0x94, 0x41, 0x6a,
-	0x48, 0x13, 0xe3, 0x46, 0x40, 0x65, 0x8e, 0xde, 0xe5, 0x30, 0xe6, 0x32, 0x1d, 0x17, 0x33, 0x0f, 0x7c, 0xa1, 0x34,
-	0x27, 0x4a, 0x43, 0xb9, 0xa4, 0xd3, 0x63, 0xca, 0xd0, 0x06, 0x58, 0xcd, 0x13, 0x6f, 0x80, 0xf5, 0xb8, 0x2c, 0xd3,
-	0x6e, 0xf3, 0x8d, 0xf0, 0x8b, 0x9f, 0xfa, 0xe4, 0xa7, 0xe6, 0x82, 0xb8, 0xad, 0x7a, 0xa2, 0x69, 0x7c, 0x34, 0xb3,
-	0x04, 0x95, 0x04, 0x3b, 0x02, 0x13, 0x7a, 0xce, 0xb3, 0xf7, 0xf0, 0x17, 0x2f, 0xe5, 0xc9, 0x4b, 0x49, 0xf9, 0xf7,
-	0x7a, 0x07, 0x4a, 0xa6, 0xf1, 0x12, 0x65, 0x3f, 0x31, 0x9c, 0xff, 0x44, 0x65, 0x05, 0x48, 0xe8, 0xb3, 0xfb, 0x82,
-	0x17, 0x37, 0xed, 0xc9, 0x4d, 0xcb, 0x85, 0x50, 0xca, 0x29, 0x45, 0xb6, 0xed, 0x35, 0x65, 0x33, 0xdf, 0xf6, 0x6a,
-	0x60, 0xcc, 0x39, 0x75, 0x88, 0x04, 0x79, 0xa1, 0x34, 0x27, 0x4a, 0x43, 0x39, 0xa5, 0x2e, 0x52, 0x62, 0xf2, 0x0d,
-	0x91, 0x29, 0x3f, 0x66, 0x43, 0xa4, 0xc5, 0x31, 0xa3, 0xdc, 0xa3, 0x8a, 0xd0, 0x0b, 0xa7, 0x3a, 0x71, 0x2a, 0xca,
-	0x2c, 0x77, 0xb2, 0x12, 0x95, 0xef, 0x4d, 0x4c, 0xb9, 0x32, 0x7b, 0x13, 0x2d, 0x8e, 0xb9, 0xe5, 0x3e, 0x59, 0x84,
-	0x5e, 0x38, 0xd5, 0x89, 0x53, 0x51, 0x6e, 0xb9, 0x9b, 0x16, 0xa9, 0xfb, 0x01, 0xfc, 0x78, 0xe8, 0x7d, 0x9a, 0xbc,
-	0x01, 0x44, 0xe6, 0x6c, 0x00, 0xf1, 0x56, 0xf0, 0xef, 0x71, 0x8a, 0x06, 0x40, 0xb3, 0x82, 0x7f, 0xaf, 0x13, 0x32,
-	0x00, 0xd9, 0x85, 0xfa, 0xfb, 0x38, 0xff, 0x02, 0x80, 0xd9, 0x79, 0x70, 0x6f, 0x7f, 0xf8, 0xf4, 0x7e, 0xd0, 0x46,
-	0xfa, 0xae, 0x3a, 0x1e, 0xbb, 0xd9, 0x83, 0x65, 0xc4, 0xb2, 0x3b, 0xec, 0x46, 0x90, 0x7b, 0xda, 0x08, 0x72, 0xef,
-	0x6f, 0x04, 0xb9, 0xf7, 0x36, 0x82, 0xdc, 0xbb, 0x1b, 0x41, 0xee, 0x69, 0x23, 0xc8, 0x3d, 0x6f, 0x04, 0xb9, 0xe7,
-	0x8d, 0x20, 0xf7, 0xb8, 0xed, 0xe3, 0x9e, 0xb6, 0x7d, 0xdc, 0xfb, 0xdb, 0x3e, 0xee, 0xbd, 0x6d, 0x1f, 0xf7, 0xb4,
-	0xed, 0xe3, 0xbe, 0xb4, 0xed, 0xe3, 0x9e, 0xb7, 0x7d, 0xdc, 0xd3, 0xb6, 0x8f, 0x7b, 0xda, 0xf6, 0x71, 0x4f, 0x3f,
-	0x32, 0x7b, 0x6f, 0x7a, 0x26, 0xf3, 0x1c, 0x0f, 0x60, 0xec, 0xca, 0x7c, 0xee, 0x0f, 0xbb, 0xe9, 0x45, 0x9c, 0x58,
-	0x50, 0x24, 0xce, 0x72, 0x01, 0x92, 0x1d, 0x64, 0x8b, 0x78, 0x88, 0xcd, 0x03, 0x23, 0xf6, 0x91, 0x02, 0xdb, 0xe7,
-	0x46, 0xd8, 0x7d, 0xb8, 0x3d, 0x9d, 0xe7, 0xe2, 0xf6, 0x45, 0xee, 0xd9, 0x3c, 0x9f, 0xf4, 0x5e, 0x9a, 0xfd, 0x7a,
-	0x13, 0xff, 0x70, 0x93, 0xfb, 0x9b, 0x4d, 0x5f, 0x07, 0x50, 0xd5, 0xbf, 0xa6, 0x28, 0x07, 0x44, 0xf2, 0x81, 0x88,
-	0x33, 0x72, 0xf8, 0x8a, 0x51, 0x8e, 0xa0, 0x46, 0x39, 0xa0, 0x66, 0x3c, 0xf1, 0x55, 0xa3, 0x1c, 0x20, 0x3b, 0x6c,
-	0xf8, 0xda, 0x45, 0x39, 0x5c, 0x50, 0x56, 0x6b, 0x3f, 0x63, 0xb5, 0x97, 0xb1, 0x9a, 0xb2, 0x50, 0xfb, 0x43, 0x9a,
-	0xaf, 0x1a, 0xe5, 0x00, 0x99, 0xf1, 0xd7, 0xd7, 0x14, 0xe5, 0x09, 0x31, 0xc7, 0x80, 0x7d, 0xdc, 0x16, 0xc1, 0x3b,
-	0x04, 0x5c, 0x20, 0xbd, 0xa2, 0x16, 0x8e, 0x00, 0x17, 0x78, 0xc7, 0x33, 0xde, 0x01, 0x60, 0x9f, 0x24, 0x9b, 0xb8,
-	0x07, 0x80, 0x5d, 0xb6, 0x2e, 0xe1, 0xe7, 0xac, 0xe1, 0xfb, 0xb6, 0x70, 0xbc, 0xd7, 0xe7, 0xcf, 0x95, 0xa7, 0xe4,
-	0x7c, 0xf7, 0x6c, 0xaf, 0xcf, 0xda, 0x90, 0xf0, 0x8e, 0xf6, 0x46, 0xf2, 0xa1, 0x9f, 0x26, 0xd5, 0x0b, 0x23, 0x04,
-	0x0f, 0x66, 0x52, 0x54, 0x61, 0x98, 0x0b, 0x55, 0xd0, 0x7c, 0xc5, 0xf8, 0x81, 0x66, 0x3e, 0x95, 0xb0, 0x5f, 0x31,
-	0x7e, 0x80, 0x79, 0x4e, 0x85, 0xf2, 0xaf, 0x18, 0x3f, 0xf4, 0x87, 0x52, 0x67, 0xe9, 0x22, 0x66, 0x56, 0x11, 0xc8,
-	0x95, 0x80, 0x7b, 0x2c, 0xe0, 0x9e, 0x0a, 0x68, 0x3f, 0xea, 0xa1, 0x30, 0x17, 0x70, 0x4f, 0x05, 0xe4, 0x4f, 0x78,
-	0x28, 0x61, 0x0b, 0xb8, 0xe7, 0x02, 0xee, 0x6d, 0x01, 0xb3, 0xf9, 0xb3, 0x3d, 0x96, 0x76, 0x4f, 0xa5, 0xdd, 0xbb,
-	0xa5, 0xd5, 0xf5, 0xdb, 0x61, 0x8e, 0xd8, 0x72, 0x7b, 0xab, 0xb7, 0x86, 0x73, 0x2c, 0x60, 0xd6, 0x6e, 0x0d, 0x5c,
-	0xb0, 0x85, 0x5d, 0xb9, 0x35, 0x38, 0x59, 0x25, 0x5f, 0xb7, 0xcd, 0x51, 0xb4, 0x4f, 0x1a, 0x30, 0x9b, 0xd2, 0x93,
-	0xa5, 0x68, 0xc0, 0x9c, 0x18, 0xfd, 0x04, 0xcc, 0x30, 0x47, 0xac, 0xb9, 0xbc, 0x0f, 0xc0, 0x18, 0xce, 0x31, 0x97,
-	0xf9, 0xfc, 0x8b, 0x81, 0x0b, 0xe6, 0x32, 0x1f, 0x7f, 0xb1, 0x38, 0x99, 0x2b, 0xff, 0xf6, 0x4b, 0x8e, 0xa2, 0xb9,
-	0xf4, 0xcb, 0x2f, 0x79, 0xe9, 0xc9, 0x5c, 0x34, 0x72, 0x57, 0xc6, 0x1c, 0xa8, 0x1f, 0x7a, 0x38, 0x99, 0xae, 0x78,
-	0x9c, 0xde, 0x4d, 0xe1, 0x99, 0xd1, 0x3b, 0x4c, 0xef, 0x92, 0x25, 0x93, 0x7a, 0x47, 0xe9, 0x7d, 0x96, 0xcd, 0xeb,
-	0x9c, 0xa4, 0xf7, 0xb8, 0xcc, 0xd4, 0xe6, 0x1c, 0xbd, 0x67, 0x3f, 0x36, 0xbb, 0x7f, 0x8a, 0x3e, 0xf1, 0x41, 0xb9,
-	0xd1, 0xec, 0x82, 0x58, 0x83, 0x0b, 0xec, 0x9a, 0x5a, 0x38, 0xc7, 0xc8, 0xc2, 0x58, 0xf3, 0x0a, 0x5c, 0x30, 0xac,
-	0xb0, 0x64, 0x52, 0xc1, 0xc9, 0x98, 0x82, 0x1b, 0x33, 0xd2, 0x0c, 0xf8, 0x3e, 0xcd, 0x77, 0x9b, 0xd2, 0x93, 0xd1,
-	0x68, 0xbe, 0x3b, 0x32, 0xb5, 0x9d, 0xe2, 0xae, 0x69, 0x66, 0xba, 0xee, 0x5e, 0xa9, 0xe9, 0x9f, 0xf1, 0x02, 0x46,
-	0x27, 0x35, 0x76, 0x66, 0x6b, 0xea, 0xcc, 0xd6, 0x5e, 0x67, 0xb6, 0xce, 0xe6, 0x0b, 0xa7, 0x39, 0x4a, 0xf9, 0x48,
-	0xd2, 0x96, 0xde, 0x9f, 0xe6, 0x0b, 0x0d, 0xf2, 0x42, 0xaf, 0x38, 0x31, 0x62, 0x33, 0x58, 0x5c, 0x78, 0xab, 0x79,
-	0x26, 0x6e, 0xea, 0x50, 0x94, 0xdf, 0x7c, 0x26, 0x2e, 0x65, 0x31, 0x9f, 0x89, 0xf3, 0xe0, 0x17, 0xff, 0xdd, 0xa7,
-	0x02, 0x6c, 0x0b, 0x72, 0x7e, 0x7d, 0x4d, 0xbb, 0x5d, 0xb6, 0x2c, 0x34, 0x13, 0xc7, 0x0c, 0x96, 0x03, 0x67, 0xe2,
-	0x18, 0x7c, 0xf1, 0xde, 0x78, 0x72, 0x41, 0x9b, 0xff, 0x73, 0xeb, 0x74, 0xb5, 0x7b, 0x74, 0xbb, 0xf6, 0x8f, 0x6e,
-	0xd7, 0x69, 0x0e, 0x2b, 0xe5, 0x2f, 0xcd, 0x61, 0x19, 0xe4, 0x85, 0x5e, 0x71, 0x62, 0xc4, 0x66, 0xb4, 0xb8, 0xcc,
-	0x57, 0x9f, 0x3b, 0x03, 0x5d, 0x9f, 0x3d, 0x03, 0x9d, 0xb3, 0x98, 0xf5, 0x8c, 0x78, 0x2e, 0x11, 0x2f, 0xa5, 0x5c,
-	0x9c, 0x8a, 0x84, 0x2d, 0x56, 0xce, 0x3a, 0xa5, 0xf3, 0x8f, 0x2c, 0xd7, 0x66, 0x86, 0xce, 0xe2, 0x58, 0x16, 0x9d,
-	0xa1, 0xb3, 0xd0, 0x0b, 0xbf, 0xe7, 0xe4, 0x40, 0x36, 0xcf, 0xe5, 0x65, 0x50, 0xe9, 0xe7, 0xb7, 0x19, 0x9d, 0xcd,
-	0x72, 0x44, 0x9e, 0x61, 0xe1, 0x78, 0xb8, 0xcc, 0xc0, 0xd9, 0x09, 0x33, 0xc3, 0xe9, 0x5b, 0x2d, 0x13, 0xcf, 0x9a,
-	0x19, 0x38, 0x1d, 0x38, 0x33, 0x78, 0x3a, 0x75, 0x66, 0x70, 0x39, 0x7a, 0x66, 0xd0, 0x78, 0xfe, 0x2c, 0x87, 0x6f,
-	0x08, 0xb9, 0x65, 0xc4, 0x2f, 0xbb, 0xac, 0x79, 0x31, 0x2c, 0x2b, 0x58, 0x44, 0x84, 0x08, 0x58, 0xe5, 0xe8, 0x1d,
-	0xa5, 0xbb, 0x6b, 0x4b, 0xbb, 0x79, 0x24, 0x98, 0x33, 0x50, 0xf9, 0xf9, 0xaa, 0xfc, 0x7c, 0x55, 0x67, 0x7c, 0x52,
-	0x15, 0x7d, 0x92, 0xfd, 0x3a, 0x8f, 0xa1, 0x7c, 0x77, 0x55, 0x05, 0x77, 0x55, 0x05, 0x77, 0xdd, 0x13, 0xc2, 0xce,
-	0xfb, 0xec, 0x87, 0x59, 0x36, 0x6b, 0x64, 0xc9, 0x2f, 0x84, 0x6c, 0x19, 0xf1, 0x2d, 0xb8, 0x3d, 0x63, 0xaa, 0x6d,
-	0xd1, 0x54, 0x5b, 0xdf, 0x1e, 0xdb, 0x82, 0x3d, 0xb6, 0x05, 0x7b, 0xfc, 0x37, 0x21, 0x9c, 0xe6, 0xeb, 0xb9, 0x82,
-	0xef, 0x18, 0xf1, 0x8b, 0xb9, 0x3b, 0xfb, 0x94, 0xf8, 0xfb, 0x45, 0x39, 0xfc, 0x40, 0x08, 0x97, 0x6c, 0xef, 0xbf,
-	0x6e, 0xef, 0xc7, 0xe5, 0xfe, 0x5c, 0x2e, 0xf6, 0x7e, 0xad, 0xad, 0x19, 0xf1, 0xdf, 0x59, 0x9f, 0xf1, 0x64, 0x5d,
-	0xf4, 0x64, 0xed, 0x7b, 0xd2, 0xfe, 0xfc, 0x93, 0x61, 0x0b, 0x7e, 0xae, 0x7d, 0x43, 0xd6, 0x7e, 0xc9, 0xbe, 0x31,
-	0x22, 0x2d, 0x84, 0xd1, 0x8d, 0x7f, 0x53, 0xc2, 0x03, 0x23, 0xbe, 0x51, 0x0e, 0xbe, 0x23, 0x0e, 0xe7, 0x1c, 0xc1,
-	0x46, 0x3a, 0xfa, 0x0f, 0x3f, 0xfa, 0x0f, 0x3f, 0x96, 0x54, 0xf1, 0x78, 0xee, 0xad, 0x0e, 0x72, 0x2e, 0x79, 0xc3,
-	0x88, 0x9f, 0xc9, 0xe6, 0x4c, 0x58, 0x34, 0xc5, 0xb0, 0x68, 0xfc, 0xb0, 0x68, 0xce, 0x86, 0x45, 0x53, 0x08, 0x8b,
-	0xa6, 0x50, 0xfd, 0x1b, 0xb7, 0xf5, 0x7a, 0xd2, 0x3d, 0xa4, 0x82, 0x3c, 0x13, 0x02, 0xfb, 0xa5, 0x05, 0x39, 0x51,
-	0x9a, 0xd8, 0x15, 0xb0, 0xb0, 0x96, 0xd9, 0x30, 0xdf, 0x29, 0x2b, 0xdf, 0x7d, 0x93, 0x7e, 0xf7, 0xfd, 0xfe, 0xdd,
-	0x6b, 0x3f, 0xdc, 0x5f, 0x02, 0xac, 0xfd, 0x5f, 0x02, 0xac, 0xd3, 0x40, 0x6e, 0x94, 0xdf, 0xfe, 0x4c, 0x08, 0xf6,
-	0x86, 0x68, 0x73, 0x53, 0xed, 0x6f, 0x6e, 0xaa, 0x8b, 0x9b, 0x9b, 0xbe, 0xa5, 0x65, 0xb4, 0x59, 0x04, 0xd2, 0xd2,
-	0x4e, 0x42, 0x4e, 0x98, 0xde, 0x3e, 0xfb, 0x9b, 0xfb, 0xd8, 0xf0, 0x8c, 0xd2, 0x6e, 0x15, 0xa4, 0x0b, 0x9c, 0xec,
-	0x7e, 0x89, 0xeb, 0x48, 0xf9, 0x93, 0x84, 0x9c, 0x22, 0xb9, 0xab, 0xee, 0x1f, 0xe1, 0xaf, 0x8b, 0xd9, 0x02, 0xc8,
-	0x70, 0xdb, 0x9d, 0xee, 0xa6, 0x41, 0x34, 0xf6, 0x44, 0x98, 0xc2, 0x0c, 0x3a, 0xcf, 0x3b, 0xb8, 0x37, 0x25, 0x3d,
-	0x72, 0xa8, 0x18, 0x3e, 0x1e, 0x95, 0x55, 0x79, 0x4e, 0x70, 0xf4, 0xd1, 0xf2, 0xcb, 0x8e, 0xe5, 0x97, 0x81, 0x4e,
-	0x79, 0xe4, 0x8f, 0x72, 0x12, 0xac, 0x1f, 0xeb, 0xd0, 0xa1, 0x3f, 0x07, 0xa0, 0x17, 0x66, 0x52, 0xe5, 0x90, 0xba,
-	0xcf, 0x80, 0x78, 0x33, 0x2c, 0x87, 0x6c, 0x93, 0xbf, 0x82, 0x66, 0x5e, 0xe5, 0xa0, 0x5d, 0x65, 0x80, 0xec, 0x7c,
-	0xc9, 0x21, 0xed, 0xe0, 0x57, 0x20, 0x6e, 0x94, 0x4e, 0x48, 0xd8, 0x67, 0x35, 0x81, 0xeb, 0xbe, 0x2a, 0xcc, 0x12,
-	0xb0, 0x1d, 0xc4, 0xca, 0x77, 0x88, 0xbd, 0x28, 0x00, 0xa0, 0x10, 0x80, 0xa6, 0x32, 0x00, 0x16, 0x8a, 0x00, 0x80,
-	0x94, 0x00, 0x10, 0x29, 0x80, 0x22, 0xd9, 0xdf, 0xe8, 0x12, 0x85, 0x77, 0xf8, 0xb7, 0xcd, 0xde, 0xae, 0x70, 0x4f,
-	0x50, 0x2c, 0x05, 0x1e, 0x06, 0xe3, 0xf4, 0xf7, 0x1e, 0xff, 0x0e, 0x0f, 0x04, 0x20, 0xc4, 0x13, 0x02, 0xf0, 0x06,
-	0x80, 0x83, 0x9d, 0x15, 0xf8, 0x06, 0x26, 0x8e, 0xe2, 0xa2, 0x36, 0xd6, 0x9d, 0xe8, 0x9a, 0xea, 0x71, 0x30, 0xd5,
-	0xbf, 0xf1, 0x2d, 0x0a, 0x37, 0x50, 0x84, 0xc6, 0x96, 0xbd, 0x71, 0x5d, 0xd3, 0x38, 0xae, 0x69, 0xac, 0x6b, 0xf2,
-	0x76, 0x0e, 0x70, 0x72, 0x59, 0x43, 0x2e, 0x0b, 0xad, 0x9a, 0x5e, 0x3f, 0x41, 0x91, 0x4e, 0xf8, 0x77, 0xc8, 0x2f,
-	0x00, 0x29, 0x67, 0x09, 0x0b, 0x49, 0xb0, 0x66, 0x09, 0x62, 0xab, 0x97, 0xc0, 0xb6, 0x8e, 0x09, 0xec, 0x56, 0x34,
-	0xe1, 0x9c, 0xda, 0x26, 0x8c, 0xad, 0x72, 0x02, 0x53, 0xbd, 0x13, 0x9c, 0x2a, 0x9f, 0xe0, 0xa6, 0x06, 0x0a, 0x6a,
-	0xab, 0x61, 0x9c, 0xf0, 0xcb, 0x42, 0x20, 0x9b, 0x05, 0x9c, 0xe5, 0x28, 0xd4, 0x4a, 0x01, 0x8c, 0xff, 0x05, 0xf5,
-	0x82, 0x40, 0x28, 0x8e, 0x04, 0x21, 0x4c, 0x38, 0x08, 0x6a, 0x7d, 0x2f, 0xb0, 0x0d, 0x80, 0xb8, 0xeb, 0xd4, 0x02,
-	0x6e, 0x4d, 0x0c, 0xdc, 0x8e, 0x00, 0xb7, 0x2c, 0x7e, 0x65, 0x16, 0xce, 0xd4, 0xe8, 0x80, 0x42, 0xb5, 0x0e, 0xc0,
-	0x9e, 0x00, 0x53, 0xc1, 0x05, 0x35, 0xb5, 0x3c, 0xa2, 0x5e, 0x55, 0x17, 0xce, 0xd4, 0x77, 0x99, 0xaa, 0xb5, 0xbe,
-	0xa4, 0x9a, 0x1f, 0x60, 0xa7, 0xfa, 0x07, 0x02, 0x2a, 0xbb, 0x00, 0xae, 0x10, 0xc4, 0x65, 0x3b, 0x53, 0x7c, 0x2b,
-	0x09, 0xbc, 0x68, 0x67, 0xa9, 0x52, 0x48, 0x58, 0x85, 0xf0, 0x56, 0xec, 0x2c, 0xe9, 0xc7, 0x0b, 0x09, 0x06, 0x2e,
-	0xd7, 0x19, 0xf0, 0xc9, 0x9a, 0xe3, 0x44, 0x80, 0x11, 0x11, 0x3b, 0x57, 0x9d, 0x08, 0xfd, 0xd5, 0x14, 0x83, 0x58,
-	0x25, 0xc9, 0x7f, 0x33, 0xc5, 0xc2, 0xae, 0x92, 0xf0, 0x4f, 0xa6, 0x18, 0xc6, 0x2a, 0x89, 0xf9, 0xc1, 0x14, 0x8b,
-	0x93, 0x92, 0xe4, 0xbf, 0x97, 0x62, 0x50, 0xab, 0x24, 0xf8, 0x73, 0x29, 0x13, 0x0b, 0xe6, 0x4a, 0x12, 0x50, 0x50,
-	0x12, 0x01, 0x4c, 0xd8, 0x08, 0xea, 0x85, 0x8d, 0x50, 0x1c, 0x36, 0x42, 0x98, 0xb0, 0x11, 0xd4, 0x46, 0x86, 0xc0,
-	0x36, 0x32, 0xe2, 0xd6, 0x73, 0x0b, 0xb8, 0x32, 0x10, 0xb8, 0x1d, 0x01, 0x6e, 0x59, 0x7c, 0x25, 0x11, 0xce, 0x28,
-	0x49, 0x40, 0x41, 0x49, 0x02, 0xb0, 0x27, 0xc0, 0x28, 0x89, 0xa0, 0x46, 0x49, 0x22, 0xea, 0x29, 0x89, 0x70, 0x46,
-	0x49, 0x64, 0xfb, 0xb5, 0xf5, 0x25, 0x29, 0x89, 0xfd, 0xa1, 0x12, 0x93, 0x1e, 0xd4, 0x42, 0x00, 0x57, 0x49, 0xe2,
-	0x8a, 0xb6, 0x29, 0xbe, 0x55, 0x12, 0x5e, 0xcf, 0xb6, 0x54, 0x29, 0x24, 0xac, 0x92, 0x78, 0x8b, 0xd9, 0x96, 0xf4,
-	0xe3, 0x85, 0x94, 0x04, 0x57, 0xb2, 0x0d, 0xf8, 0x64, 0xcd, 0x71, 0x22, 0xc0, 0x28, 0x89, 0x5d, 0xc5, 0x56, 0x02,
-	0xcc, 0x96, 0xe9, 0x09, 0xe2, 0xa4, 0x2a, 0x48, 0x92, 0xb6, 0x20, 0xe9, 0x2b, 0x0c, 0xa6, 0xf0, 0x74, 0x06, 0x79,
-	0x52, 0x1b, 0x24, 0x59, 0x73, 0x90, 0x65, 0xe5, 0x41, 0xd6, 0xea, 0x0f, 0x72, 0xa4, 0x42, 0x40, 0xda, 0x78, 0xcc,
-	0x28, 0xa3, 0x48, 0xc0, 0xa1, 0x2e, 0x21, 0x6c, 0x43, 0x11, 0x39, 0x37, 0x20, 0x31, 0x81, 0x13, 0x96, 0x48, 0xdb,
-	0xe0, 0x44, 0x8e, 0xa2, 0x10, 0x49, 0x8a, 0x45, 0x20, 0x4b, 0xb0, 0x2f, 0x42, 0x00, 0xee, 0x0a, 0xf0, 0x19, 0x0b,
-	0x14, 0x94, 0x0d, 0x53, 0x58, 0x7d, 0x03, 0x0e, 0x55, 0x0e, 0xe0, 0x7d, 0x01, 0xb6, 0x8a, 0x87, 0x9c, 0xd5, 0xbd,
-	0x8c, 0x73, 0xd5, 0x0f, 0x53, 0x58, 0x0d, 0x04, 0xee, 0x9b, 0x1f, 0x49, 0xac, 0x87, 0x40, 0x7a, 0xaa, 0x08, 0x34,
-	0xea, 0x1f, 0xc2, 0xbe, 0x42, 0x66, 0x9b, 0x58, 0x5c, 0x33, 0x92, 0x5a, 0x16, 0xb6, 0xb0, 0xf8, 0x09, 0xce, 0x87,
-	0x28, 0xe9, 0x67, 0x71, 0xff, 0x8a, 0x9f, 0xe4, 0x5c, 0x14, 0xb3, 0xa2, 0xd2, 0xe6, 0x15, 0x97, 0x7a, 0xf2, 0xcd,
-	0x7a, 0x2a, 0xc0, 0x56, 0x69, 0xdd, 0x8d, 0x2b, 0x91, 0xa6, 0x83, 0x31, 0x7c, 0x20, 0xa6, 0x5f, 0x69, 0x4f, 0xe9,
-	0xb3, 0x41, 0x53, 0x4a, 0x92, 0x77, 0xbf, 0x0d, 0x8c, 0xb7, 0xbb, 0x67, 0xa0, 0x8e, 0xfe, 0x19, 0xa8, 0x63, 0x3a,
-	0xf1, 0xa4, 0xb7, 0xfb, 0xe7, 0xdf, 0x8e, 0xf6, 0xd7, 0x70, 0x89, 0xc8, 0x1e, 0xc2, 0x0a, 0xa9, 0xe9, 0x9d, 0x98,
-	0x77, 0x49, 0x7c, 0x60, 0x0a, 0x7f, 0x73, 0x9c, 0x2e, 0x5c, 0x7e, 0x20, 0xc0, 0x4c, 0x9a, 0x45, 0xd4, 0x9b, 0x12,
-	0x0b, 0xdc, 0xb5, 0x05, 0xd6, 0x3a, 0x31, 0x19, 0x80, 0x4f, 0x83, 0x8b, 0x55, 0x0e, 0x48, 0x1b, 0x69, 0x50, 0x6d,
-	0xdd, 0x72, 0x22, 0xce, 0x7d, 0x86, 0x79, 0xcd, 0x09, 0x73, 0x81, 0x88, 0x53, 0xa5, 0x4f, 0x5d, 0xdb, 0x1c, 0xf5,
-	0xe3, 0x29, 0x35, 0xc8, 0x80, 0x48, 0x2b, 0x0c, 0x48, 0xb6, 0x33, 0x57, 0x61, 0xd8, 0x8e, 0xab, 0x60, 0xdc, 0x83,
-	0xab, 0x48, 0xda, 0x54, 0xab, 0x50, 0xda, 0x3d, 0xac, 0x90, 0x9c, 0x17, 0x55, 0x20, 0x6e, 0xa8, 0x4d, 0x88, 0x38,
-	0x7c, 0x99, 0x0a, 0x92, 0xb1, 0x15, 0x15, 0x24, 0x6d, 0xaf, 0x06, 0xc4, 0x2d, 0x48, 0xe5, 0x15, 0x24, 0xdb, 0x3d,
-	0xad, 0x28, 0x15, 0xaf, 0xe2, 0xe2, 0x55, 0x5c, 0xbc, 0x3a, 0xbb, 0xa0, 0xac, 0xd6, 0x7e, 0xc6, 0x6a, 0x2f, 0x63,
-	0x35, 0x65, 0xc1, 0x6e, 0x6d, 0x56, 0x82, 0xf3, 0x96, 0x36, 0x31, 0x2b, 0x42, 0x86, 0xb6, 0x1f, 0xed, 0x7c, 0x1e,
-	0x40, 0x3d, 0x7b, 0xd6, 0x3e, 0x9c, 0x22, 0xb1, 0xe3, 0xa6, 0x48, 0xd6, 0x5b, 0x53, 0x98, 0xf7, 0x93, 0x3d, 0x6b,
-	0xbf, 0x4c, 0x91, 0xd4, 0x19, 0x53, 0x28, 0xf5, 0xc0, 0x14, 0x92, 0x6e, 0x97, 0x02, 0xb1, 0xaf, 0x95, 0x10, 0x09,
-	0x99, 0x79, 0x2a, 0x08, 0xf4, 0xc4, 0x9e, 0xf5, 0x43, 0x2a, 0x8a, 0x98, 0x23, 0x19, 0xcf, 0xe6, 0xb3, 0x29, 0x0a,
-	0x73, 0x5f, 0xf3, 0x39, 0xff, 0x48, 0x8a, 0xa2, 0xa6, 0xdb, 0xf9, 0xac, 0x21, 0x03, 0x90, 0xed, 0x60, 0x3e, 0xf7,
-	0x1f, 0x27, 0xd1, 0x0b, 0xca, 0x6a, 0xed, 0x67, 0xac, 0xf6, 0x32, 0x56, 0x53, 0x16, 0xec, 0xf7, 0x46, 0x94, 0xe0,
-	0xbc, 0xa5, 0xaf, 0x8b, 0x28, 0x62, 0x3a, 0xb5, 0xcf, 0x29, 0x64, 0xa2, 0xa5, 0x5f, 0xf0, 0x68, 0xd5, 0x0b, 0x1d,
-	0xad, 0x7a, 0xa1, 0xa3, 0x55, 0x2f, 0xfe, 0xd1, 0xaa, 0x17, 0xef, 0x68, 0xd5, 0x8b, 0x7b, 0xb4, 0xea, 0x85, 0x8e,
-	0x56, 0xbd, 0xf0, 0xd1, 0xaa, 0x17, 0x3e, 0x5a, 0x75, 0x1a, 0xc0, 0xef, 0xac, 0x9f, 0x54, 0x10, 0x15, 0x89, 0x82,
-	0xa8, 0x88, 0x77, 0x54, 0xe1, 0x94, 0x09, 0xa2, 0x82, 0xe6, 0x50, 0xc2, 0x09, 0x04, 0x51, 0x21, 0x7b, 0x9c, 0xe2,
-	0x94, 0x04, 0x51, 0x01, 0x73, 0xc2, 0xe0, 0x94, 0x5a, 0xc0, 0x61, 0x42, 0x32, 0xda, 0x9e, 0x3d, 0x39, 0xd1, 0x81,
-	0x93, 0x93, 0x7f, 0xca, 0xe4, 0xe4, 0x1d, 0x2d, 0x39, 0xb9, 0xe7, 0x49, 0x4e, 0x74, 0x88, 0xe4, 0xc4, 0x27, 0x47,
-	0x4e, 0x7c, 0x5c, 0xe4, 0x84, 0x67, 0x44, 0x4e, 0x74, 0x30, 0xe4, 0xe4, 0x9f, 0x06, 0x39, 0x79, 0x47, 0x40, 0x4e,
-	0x74, 0xee, 0xe3, 0x54, 0x3a, 0xec, 0x71, 0xe2, 0x13, 0x1e, 0x27, 0x3a, 0xd6, 0x71, 0xa2, 0xb3, 0x1c, 0x27, 0xed,
-	0x4f, 0x24, 0x53, 0xa7, 0x09, 0xf8, 0xb1, 0x41, 0x6c, 0x49, 0xf2, 0x09, 0x78, 0x0b, 0xbb, 0xa5, 0xa4, 0x09, 0x78,
-	0xcb, 0xd8, 0xf2, 0x9a, 0x09, 0x78, 0x8b, 0x93, 0xf1, 0xb3, 0x09, 0x78, 0x8b, 0xda, 0xc2, 0xe7, 0xdd, 0x46, 0x63,
-	0x00, 0x4e, 0x48, 0x51, 0x27, 0xb0, 0x0d, 0xbd, 0x08, 0x97, 0x0d, 0xe0, 0x05, 0x61, 0x64, 0x9c, 0x48, 0x14, 0xca,
-	0xb7, 0x0d, 0xc7, 0xa4, 0xe0, 0x05, 0xdb, 0xd4, 0x8c, 0xf8, 0xe5, 0xf2, 0xe3, 0x54, 0xb8, 0x62, 0x01, 0x28, 0x62,
-	0x05, 0x2e, 0x84, 0xad, 0xb0, 0x85, 0x32, 0x50, 0x00, 0x0b, 0xec, 0x3b, 0x92, 0x43, 0x39, 0xe5, 0x12, 0xa3, 0x59,
-	0x41, 0x5b, 0x6e, 0x65, 0x6c, 0x4c, 0x2b, 0xe3, 0x1a, 0x45, 0x69, 0xc7, 0x2e, 0x4a, 0x5a, 0xd3, 0x28, 0x43, 0xe5,
-	0x57, 0x8a, 0xdc, 0xa8, 0x94, 0x89, 0x72, 0x25, 0xac, 0x7d, 0xe8, 0x83, 0x03, 0x6c, 0x21, 0x37, 0x39, 0x45, 0xbc,
-	0x32, 0x36, 0xe8, 0x81, 0x39, 0x6b, 0x21, 0x2f, 0xf4, 0x81, 0x74, 0xa2, 0x5f, 0xd9, 0xa2, 0xfd, 0xb8, 0x0e, 0x28,
-	0x55, 0xb6, 0x5f, 0xed, 0x82, 0xc5, 0x22, 0xfb, 0xf5, 0x41, 0xe9, 0x73, 0x05, 0xa3, 0x5a, 0xa1, 0x4c, 0xa1, 0x62,
-	0x68, 0x82, 0x72, 0xd9, 0xa8, 0x7a, 0x28, 0x53, 0x8c, 0x00, 0xaa, 0x24, 0xdf, 0x07, 0xd0, 0xaf, 0xfc, 0xae, 0x3d,
-	0x47, 0x45, 0x62, 0xcf, 0x11, 0x10, 0xa7, 0x0b, 0xfc, 0x3d, 0xeb, 0x39, 0x02, 0x08, 0x3d, 0x47, 0x45, 0x4d, 0xc7,
-	0xf8, 0x3b, 0xf4, 0x1c, 0x15, 0xb2, 0x1d, 0xe3, 0xef, 0x7d, 0xcf, 0x51, 0x2f, 0x28, 0xab, 0xb5, 0x9f, 0xb1, 0xda,
-	0xcb, 0x58, 0x4d, 0x59, 0xb0, 0x3d, 0x47, 0x25, 0x38, 0x6f, 0xa9, 0xe7, 0xa8, 0x88, 0xe9, 0xa2, 0x7f, 0x4f, 0xcd,
-	0x88, 0x45, 0x6c, 0xb6, 0xf3, 0x66, 0x84, 0x60, 0xaf, 0x48, 0xd4, 0x8c, 0x10, 0xe3, 0x58, 0x3d, 0x6f, 0x46, 0x2c,
-	0x4c, 0x65, 0x34, 0xcd, 0x88, 0xc1, 0x6b, 0x46, 0xfc, 0x72, 0xf9, 0x3e, 0xa1, 0x66, 0xc4, 0x32, 0x7e, 0x2e, 0x4b,
-	0x2e, 0x32, 0xcd, 0x88, 0xc5, 0xad, 0xb3, 0xf2, 0x66, 0x24, 0xc1, 0xc1, 0x03, 0x0e, 0x62, 0x4b, 0x26, 0xb0, 0xf5,
-	0x58, 0x84, 0xbd, 0x02, 0x0b, 0xe7, 0x14, 0x38, 0x32, 0x8e, 0xc7, 0x84, 0xb2, 0xb6, 0x10, 0x98, 0x4a, 0x2b, 0x38,
-	0x79, 0x2c, 0xe0, 0x35, 0x23, 0x7e, 0xb9, 0x7c, 0x8f, 0x09, 0x57, 0x2c, 0x00, 0x79, 0x4c, 0xe0, 0x82, 0xc7, 0x84,
-	0x2d, 0x94, 0x81, 0x3c, 0x26, 0xb0, 0xf5, 0x98, 0x1a, 0xad, 0x80, 0xda, 0x12, 0x02, 0x65, 0xbd, 0x87, 0x94, 0x67,
-	0x00, 0xe0, 0x1d, 0x23, 0x20, 0xeb, 0x78, 0x12, 0x68, 0x6b, 0x27, 0xa0, 0xc8, 0x1a, 0xc0, 0x91, 0x57, 0x95, 0xab,
-	0x7d, 0xb4, 0x5c, 0x76, 0xdf, 0xc3, 0xc0, 0x9f, 0x2d, 0x20, 0x79, 0x1a, 0xa8, 0x82, 0xb7, 0x21, 0xc5, 0x99, 0x32,
-	0x92, 0xd7, 0x81, 0x02, 0xcf, 0xff, 0xba, 0xbf, 0xbb, 0xac, 0x0e, 0xfb, 0xb7, 0x9b, 0xed, 0xe1, 0x98, 0xae, 0x7e,
-	0xd9, 0x3c, 0x6e, 0xfa, 0x8b, 0xd7, 0xf5, 0xfe, 0xf1, 0xf7, 0xea, 0xf1, 0xb0, 0xbd, 0x6d, 0xc9, 0xff, 0x01, 0x45,
-	0x11, 0xe6, 0x71 };
@@ -1,693 +0,0 @@
-// helvetica_bold.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_HELVETICA_BOLD[] = { 0x78, 0x9c, 0xb5, 0x7d, 0x5f, 0x73, 0x1b, 0x37, 0xf2, 0xed, 0x7b, 0xaa, 0xf2,
-	0x1d, 0xf8, 0x78, 0x6f, 0xd5, 0xd5, 0x5e, 0x72, 0xf8, 0x7f, 0xf7, 0xc9, 0x59, 0x27, 0xbb, 0x89, 0x9d, 0xc8, 0x76,
-	0x24, 0xca, 0xda, 0x37, 0x5a, 0xa2, 0x64, 0x5e, 0x53, 0xa2, 0x43, 0x8a, 0xa2, 0xc6, 0x9f, 0xfe, 0x37, 0x33, 0x68,
-	0xa0, 0x0f, 0xfa, 0x34, 0xe8, 0x7d, 0xb9, 0x95, 0x8a, 0x4b, 0x73, 0x0e, 0x66, 0x06, 0xe8, 0x6e, 0x1c, 0x00, 0x3d,
-	0x98, 0xe1, 0x9f, 0x4f, 0xcb, 0xdd, 0xd3, 0x2f, 0xdb, 0xc7, 0xa7, 0xdf, 0x57, 0x4f, 0xbb, 0xf5, 0xcd, 0xbe, 0x37,
-	0xfa, 0xdb, 0xe0, 0xc7, 0x1f, 0xfe, 0xb9, 0x7d, 0x78, 0x58, 0x3d, 0x3e, 0xf5, 0xfe, 0xb9, 0xfd, 0x5a, 0xef, 0xd6,
-	0xf7, 0x9f, 0x9f, 0x7a, 0xff, 0xeb, 0xe6, 0x7f, 0xf7, 0x06, 0xf3, 0xd9, 0xf8, 0xff, 0xb4, 0xff, 0x4e, 0xbb, 0x7f,
-	0xe7, 0xed, 0xbf, 0xf3, 0x7e, 0xf7, 0xef, 0xb4, 0xf7, 0xea, 0x76, 0xfb, 0x69, 0xd5, 0xfb, 0xb3, 0xde, 0x3f, 0xad,
-	0x1e, 0xf6, 0xbd, 0x5f, 0x1f, 0x6f, 0xb6, 0xbb, 0xaf, 0xdb, 0xdd, 0xf2, 0x69, 0x75, 0xfb, 0xb7, 0x5e, 0xef, 0xd5,
-	0x66, 0xd3, 0xfb, 0xd0, 0x5e, 0x67, 0xdf, 0xfb, 0xb0, 0xda, 0xaf, 0x76, 0xcf, 0x0d, 0x0a, 0x77, 0xd9, 0xad, 0x96,
-	0x4f, 0xeb, 0xed, 0x63, 0xef, 0x75, 0x53, 0xfc, 0xef, 0xbd, 0x8b, 0xcf, 0x87, 0xde, 0xef, 0xcb, 0xba, 0xd7, 0x1b,
-	0xf4, 0x06, 0xd5, 0xdf, 0x47, 0xc3, 0xbf, 0x8f, 0xab, 0xee, 0x16, 0x7a, 0xc2, 0xe5, 0xe3, 0xfa, 0xaf, 0xc3, 0xea,
-	0xd7, 0xd7, 0xbd, 0xd1, 0xb0, 0x3f, 0xae, 0x14, 0x5f, 0xfc, 0x7e, 0xd8, 0x2f, 0xef, 0x57, 0xbd, 0xe1, 0x74, 0x30,
-	0x99, 0xf7, 0x46, 0xb3, 0xc1, 0x7c, 0xf4, 0xe3, 0x0f, 0x6d, 0xe3, 0xfe, 0x58, 0x3e, 0xac, 0x7a, 0xff, 0x5e, 0x6d,
-	0x9e, 0x57, 0x4f, 0xeb, 0x9b, 0xe5, 0xd9, 0x4f, 0xdb, 0xcd, 0x6d, 0x43, 0x1c, 0x36, 0x9b, 0x9c, 0xe8, 0x09, 0xb1,
-	0x7c, 0x58, 0x6f, 0xea, 0x9c, 0xfa, 0xf1, 0x87, 0xab, 0x55, 0x67, 0x88, 0x50, 0xe4, 0xd7, 0xa7, 0xe5, 0x66, 0x7d,
-	0xf3, 0xea, 0xf1, 0x7e, 0xb3, 0xea, 0xf5, 0x9b, 0xc3, 0xfd, 0x2f, 0xeb, 0x97, 0xd5, 0xed, 0xbb, 0xf5, 0xd3, 0xcd,
-	0xe7, 0xde, 0xdd, 0x72, 0xb3, 0x5f, 0x35, 0x95, 0xfa, 0xbc, 0xdc, 0x2d, 0x6f, 0x9e, 0x56, 0xbb, 0x3f, 0x57, 0x4f,
-	0xbd, 0x9f, 0x5f, 0x9e, 0x56, 0x8f, 0xb7, 0xab, 0xdb, 0x0f, 0xdb, 0x87, 0xe5, 0x63, 0xa8, 0xd3, 0x4f, 0x3f, 0x6d,
-	0x5f, 0x7a, 0x67, 0x83, 0x69, 0xbf, 0x77, 0x56, 0x55, 0xb3, 0xde, 0xa0, 0xdf, 0x1f, 0xf6, 0xe6, 0x93, 0xaa, 0xf7,
-	0xe3, 0x0f, 0x97, 0x4d, 0xc9, 0xdd, 0x66, 0xfd, 0xb8, 0x7a, 0xb7, 0xdd, 0xaf, 0x3b, 0xc3, 0x9c, 0x35, 0x2c, 0xe0,
-	0x17, 0x9f, 0xd7, 0x37, 0x5f, 0x1e, 0x57, 0xfb, 0x7d, 0x6f, 0xdc, 0xc0, 0x8b, 0xd5, 0x6e, 0xdf, 0x16, 0xea, 0xf7,
-	0xab, 0xbf, 0xf5, 0xdb, 0x72, 0x7f, 0x6c, 0x9b, 0x1a, 0xaf, 0xfe, 0xbf, 0x3a, 0x4f, 0x4d, 0xb6, 0xde, 0xf7, 0x96,
-	0xbd, 0xa7, 0xdd, 0xf2, 0x76, 0xf5, 0xb0, 0xdc, 0x7d, 0xe9, 0x6d, 0xef, 0x7a, 0x6f, 0xd7, 0x8f, 0xdb, 0xa7, 0xfa,
-	0xeb, 0xea, 0xac, 0x29, 0xb4, 0xe9, 0xbd, 0xfa, 0x57, 0x6f, 0xf9, 0x78, 0xfb, 0x7f, 0xb7, 0xbb, 0xde, 0xba, 0xb9,
-	0xc0, 0xfe, 0xf0, 0x69, 0xbf, 0xbe, 0x5d, 0x2f, 0x77, 0xeb, 0xd5, 0xbe, 0x89, 0x80, 0x9f, 0x9b, 0x3b, 0xdd, 0xae,
-	0x1f, 0xef, 0xff, 0xbc, 0xf9, 0xbc, 0x6a, 0xac, 0xdd, 0x55, 0xe3, 0xcf, 0xa7, 0xa6, 0xfc, 0x72, 0x77, 0x1b, 0xb9,
-	0xc6, 0x92, 0xcb, 0xaf, 0xff, 0x0e, 0xc6, 0x9f, 0x0e, 0x66, 0x3f, 0xfe, 0xf0, 0x51, 0x0e, 0xc6, 0xc3, 0xc6, 0xf5,
-	0xaf, 0xf6, 0x37, 0xad, 0x61, 0x77, 0x81, 0x7a, 0xbd, 0x8a, 0x87, 0x67, 0x55, 0xbf, 0x09, 0x98, 0x3f, 0x9f, 0x6e,
-	0xff, 0x7d, 0xd5, 0x1b, 0xb4, 0x54, 0xf3, 0xe7, 0xa2, 0xf9, 0x73, 0xd4, 0x6f, 0xff, 0x6c, 0x62, 0xbe, 0x75, 0x4f,
-	0x8c, 0xf9, 0xe1, 0x60, 0xdc, 0xdc, 0xa5, 0x37, 0xac, 0x7a, 0xff, 0xe8, 0x5d, 0x7d, 0xec, 0x55, 0xd3, 0x59, 0xf3,
-	0xc7, 0x1f, 0xbd, 0xfd, 0xd7, 0x65, 0x63, 0xc6, 0x7f, 0xf4, 0x7e, 0xea, 0xf5, 0xe5, 0xbf, 0x7f, 0x74, 0xc5, 0x86,
-	0xa1, 0xd8, 0xb0, 0xfb, 0xe3, 0x8f, 0xde, 0xea, 0xe5, 0x66, 0xb3, 0x7c, 0xe8, 0xca, 0xcd, 0xdb, 0x42, 0xd5, 0x68,
-	0xd4, 0xd6, 0x46, 0x0a, 0x8f, 0x42, 0xe1, 0xd1, 0x74, 0xd4, 0x15, 0xfe, 0xeb, 0xb0, 0x6d, 0xac, 0xfa, 0x69, 0x13,
-	0x8a, 0xcf, 0x7a, 0xa3, 0xd1, 0xb4, 0x09, 0xd7, 0x09, 0x9c, 0x30, 0x0e, 0x27, 0x8c, 0xc7, 0x93, 0xee, 0x84, 0xc7,
-	0xc3, 0xc3, 0xa7, 0xd6, 0xc1, 0xf7, 0x8f, 0xdd, 0x29, 0x4d, 0xb1, 0x7e, 0xd3, 0xf2, 0x59, 0x6f, 0x32, 0x8f, 0x27,
-	0x4c, 0xf2, 0x13, 0x6e, 0xb7, 0x9b, 0xcd, 0x72, 0xd7, 0x15, 0x1e, 0x36, 0xb1, 0x35, 0x18, 0x8c, 0x7b, 0xe3, 0x6a,
-	0xd8, 0x9b, 0x4e, 0xc7, 0x52, 0x7e, 0x1a, 0xca, 0xcf, 0x66, 0xf3, 0xae, 0xfc, 0xd7, 0xd5, 0xee, 0xa6, 0xed, 0x3c,
-	0xed, 0x09, 0x4d, 0x1c, 0x9e, 0x0d, 0xe6, 0xbd, 0xd9, 0x64, 0xd0, 0x54, 0x28, 0x36, 0x77, 0x16, 0xca, 0x4f, 0xab,
-	0xaa, 0x2b, 0xbf, 0x7c, 0x68, 0xce, 0xd8, 0x37, 0x3e, 0xea, 0xce, 0x18, 0x8f, 0xba, 0x33, 0xa6, 0xfd, 0x01, 0x34,
-	0x61, 0x9e, 0xdb, 0xb1, 0x6b, 0x73, 0x88, 0xc4, 0xf6, 0x94, 0xb6, 0x6b, 0x8e, 0xc6, 0xbd, 0xaa, 0x3f, 0xd7, 0x53,
-	0x46, 0xfd, 0xdc, 0xa6, 0x5f, 0x97, 0xbb, 0xd5, 0xe3, 0x66, 0x75, 0x17, 0xce, 0x68, 0x6c, 0xd2, 0xf8, 0x73, 0xd6,
-	0xf8, 0xa9, 0xb1, 0x6c, 0x6b, 0xd1, 0xee, 0x94, 0x81, 0x73, 0x8a, 0xde, 0xa5, 0xa9, 0x54, 0x77, 0x4e, 0xd5, 0xd8,
-	0x49, 0xcf, 0x11, 0x0f, 0x0f, 0xa5, 0xed, 0xcb, 0x7d, 0x5b, 0xb1, 0xfd, 0x97, 0xd0, 0xf8, 0xc6, 0x13, 0xb3, 0xe6,
-	0xff, 0xa6, 0x0f, 0x6a, 0xbd, 0xc4, 0xd7, 0xe3, 0x59, 0x70, 0xdf, 0xd7, 0xcd, 0x61, 0xdf, 0x15, 0x1e, 0xb5, 0x9e,
-	0x1e, 0x37, 0x9e, 0x1e, 0xf7, 0x27, 0x52, 0x74, 0x94, 0xb7, 0xfa, 0xa6, 0x11, 0xa5, 0x65, 0x68, 0x70, 0x6b, 0xa3,
-	0x49, 0x53, 0x95, 0xa6, 0xfa, 0x83, 0x51, 0x2c, 0x3e, 0xce, 0xab, 0xff, 0xb9, 0xfe, 0xfa, 0x79, 0xf5, 0x18, 0x2b,
-	0x52, 0x35, 0x5e, 0x1b, 0x36, 0x57, 0x1e, 0x8e, 0xc4, 0x6b, 0xa3, 0x49, 0x7e, 0xf5, 0xc6, 0x07, 0xeb, 0xed, 0x6d,
-	0xbc, 0x7c, 0xdf, 0x5c, 0x7b, 0x6a, 0x02, 0x79, 0xb3, 0xdc, 0x7f, 0xee, 0xca, 0x9e, 0x35, 0x77, 0x6b, 0xfd, 0x35,
-	0x1c, 0x34, 0xfe, 0x6a, 0x23, 0xa1, 0x2b, 0x3e, 0xcb, 0x23, 0xe8, 0xdb, 0x6a, 0xb7, 0x0d, 0x76, 0xaf, 0xba, 0xc2,
-	0xe3, 0x6a, 0xa4, 0xe1, 0x30, 0x9a, 0xe7, 0x85, 0xb7, 0x8f, 0xab, 0xe8, 0xd5, 0x7e, 0x13, 0x5b, 0x33, 0x2d, 0x39,
-	0xee, 0xe7, 0x25, 0x9f, 0x8e, 0xe1, 0xaa, 0xd5, 0xa4, 0x35, 0xdd, 0x00, 0x42, 0x6c, 0x3c, 0x30, 0x25, 0x3f, 0xef,
-	0x56, 0xab, 0x68, 0x8a, 0xae, 0x06, 0x83, 0x09, 0x94, 0xae, 0xf2, 0xd2, 0x77, 0xdb, 0xc3, 0x2e, 0x16, 0x6e, 0x2e,
-	0x5c, 0x61, 0xd1, 0xa1, 0x29, 0xba, 0x7e, 0xa6, 0xeb, 0xa6, 0x8e, 0x34, 0x1e, 0xe5, 0x85, 0xf7, 0xeb, 0x97, 0x60,
-	0x85, 0x81, 0x58, 0xa1, 0x0f, 0x17, 0x36, 0xbd, 0x74, 0xbf, 0x7a, 0x8e, 0xce, 0x1b, 0x77, 0x95, 0x80, 0x0e, 0x3a,
-	0x36, 0x1d, 0x74, 0x95, 0x62, 0xd4, 0xb3, 0xef, 0x78, 0x6a, 0xfa, 0xff, 0x5a, 0x0c, 0xdc, 0x75, 0xe6, 0xb6, 0x70,
-	0x05, 0x85, 0x67, 0x79, 0x10, 0xdd, 0x6c, 0x37, 0xdb, 0x50, 0x8d, 0x79, 0xd5, 0x29, 0x51, 0xd5, 0x34, 0xb1, 0x92,
-	0xb2, 0xf3, 0xbc, 0xec, 0x7e, 0xf5, 0xb0, 0xce, 0xca, 0x87, 0x18, 0xc5, 0x53, 0x26, 0xd1, 0x83, 0x12, 0xfd, 0x9b,
-	0x76, 0xc8, 0xe9, 0xea, 0xd2, 0xe8, 0xc4, 0xac, 0x31, 0xd8, 0xa4, 0x29, 0x2b, 0x5d, 0x6b, 0x32, 0xc8, 0xcb, 0xae,
-	0xfe, 0x3a, 0x2c, 0x37, 0xb1, 0xab, 0x34, 0xdd, 0xaa, 0xed, 0x2b, 0xa3, 0xa6, 0xfe, 0xa1, 0x70, 0x95, 0x17, 0xbe,
-	0x6f, 0x67, 0x00, 0xab, 0x5d, 0xf1, 0xda, 0xe2, 0xc6, 0xc9, 0x60, 0x20, 0x82, 0xb2, 0xda, 0x77, 0xe3, 0x62, 0x17,
-	0x78, 0x5d, 0x4f, 0x6c, 0xac, 0x35, 0xad, 0x24, 0x9e, 0x27, 0xe2, 0xc8, 0x79, 0x2b, 0x79, 0x6d, 0x2f, 0x17, 0x45,
-	0x18, 0x88, 0xba, 0xb5, 0x65, 0x63, 0xec, 0x4f, 0xc6, 0xb9, 0xba, 0xbd, 0x0a, 0x4e, 0x6c, 0xaf, 0x39, 0xed, 0x83,
-	0x10, 0x4c, 0x26, 0x79, 0xb9, 0x9f, 0xba, 0x72, 0xd3, 0x36, 0x94, 0x27, 0x13, 0x10, 0xb2, 0xc9, 0x34, 0x2f, 0xf7,
-	0xcf, 0x60, 0x82, 0xa0, 0x92, 0x93, 0xd9, 0x08, 0xee, 0x6c, 0x74, 0xf5, 0x35, 0x5c, 0x71, 0x36, 0x86, 0x2b, 0x8a,
-	0xdf, 0x26, 0xdd, 0xa5, 0xff, 0xe8, 0xfd, 0x0c, 0xe5, 0x2a, 0x50, 0xdd, 0x69, 0x3f, 0x37, 0xd2, 0x2f, 0x5a, 0x6e,
-	0xdc, 0xd8, 0x5f, 0xcb, 0x89, 0xa3, 0xa6, 0x22, 0x0e, 0xff, 0xc2, 0x1a, 0x4e, 0x07, 0x43, 0xad, 0xe1, 0xb4, 0xca,
-	0x6b, 0xf8, 0xef, 0x70, 0xc5, 0x41, 0x7b, 0xe7, 0x31, 0xde, 0x79, 0x98, 0xcb, 0xcd, 0xaf, 0xb9, 0x2c, 0x69, 0x39,
-	0xd3, 0xc1, 0x7e, 0x0b, 0xb6, 0x6e, 0x23, 0xaf, 0x19, 0x08, 0x67, 0x58, 0xd2, 0x78, 0xe5, 0x4d, 0x57, 0x72, 0xd6,
-	0xf6, 0xef, 0x69, 0x05, 0x5e, 0x99, 0x4e, 0xf2, 0x36, 0xbf, 0xc5, 0x36, 0x0f, 0xa1, 0x5c, 0x1c, 0xf3, 0x24, 0xf6,
-	0x7f, 0x57, 0xc9, 0x9a, 0x4e, 0xc0, 0xd6, 0x53, 0xe3, 0x93, 0x3f, 0xb4, 0xdc, 0x64, 0x8c, 0xf5, 0x9b, 0xe7, 0x36,
-	0x3c, 0xcf, 0x6c, 0x38, 0x04, 0x2f, 0xcf, 0xa2, 0x57, 0xc4, 0x7b, 0xef, 0xd0, 0x7b, 0xe0, 0x95, 0x99, 0xf1, 0xca,
-	0xfb, 0x74, 0xc5, 0x46, 0xee, 0xda, 0xab, 0xe9, 0x15, 0x8d, 0x57, 0x3e, 0xc0, 0x15, 0xa7, 0x78, 0xc5, 0x61, 0x7e,
-	0xe7, 0x3f, 0x43, 0xef, 0x9a, 0x87, 0x48, 0xac, 0xe6, 0x70, 0xc5, 0x51, 0x6e, 0xc5, 0x8b, 0xd0, 0x5d, 0x5a, 0xff,
-	0x8d, 0xdb, 0xd1, 0x33, 0x5d, 0xd1, 0x78, 0xe5, 0x32, 0xdc, 0x39, 0x88, 0x58, 0x16, 0x11, 0xb3, 0x49, 0x7e, 0xef,
-	0x45, 0x4f, 0x86, 0xe4, 0xa6, 0x8e, 0x23, 0xbc, 0xa2, 0xf8, 0x65, 0x3e, 0x0a, 0x3a, 0x70, 0x15, 0xca, 0xb5, 0x6d,
-	0x99, 0x57, 0xd0, 0xab, 0x66, 0xb3, 0xfc, 0x7a, 0x1f, 0xb5, 0x86, 0x93, 0x31, 0xf8, 0x79, 0x66, 0xfa, 0xca, 0x75,
-	0x28, 0x37, 0xb6, 0xe5, 0xe6, 0xa6, 0xaf, 0xfc, 0x07, 0xa4, 0x7b, 0x06, 0x93, 0xb1, 0xb9, 0x99, 0x63, 0x7c, 0x6a,
-	0x66, 0xf4, 0x5f, 0x56, 0x4f, 0x69, 0x62, 0x32, 0xe9, 0x46, 0xd3, 0x66, 0x98, 0x6e, 0xe7, 0x32, 0x95, 0xa8, 0xe6,
-	0xdc, 0x4c, 0x23, 0x3f, 0x35, 0xe7, 0x7c, 0x67, 0x04, 0x9e, 0x0f, 0xdd, 0xfb, 0xe8, 0x6c, 0xa6, 0x1a, 0x85, 0x1b,
-	0x55, 0xd3, 0x3e, 0xdc, 0x28, 0xf6, 0x27, 0x51, 0xd1, 0xe5, 0xfe, 0x66, 0xbd, 0xbe, 0x59, 0xef, 0x6e, 0x0e, 0x61,
-	0x36, 0xda, 0xa8, 0xec, 0xb0, 0x99, 0xf9, 0xb5, 0x23, 0x46, 0x1a, 0x8c, 0xe6, 0x66, 0xe0, 0x3a, 0xb4, 0xb3, 0xe5,
-	0x7d, 0x33, 0xdf, 0x8f, 0x13, 0xdd, 0xb3, 0x41, 0x63, 0x86, 0x96, 0x3d, 0x8b, 0x13, 0xc6, 0xb9, 0x99, 0x7a, 0x74,
-	0xd3, 0x39, 0x35, 0x41, 0x33, 0x9b, 0x6b, 0xba, 0x46, 0x37, 0x9b, 0x8b, 0x02, 0x3c, 0x37, 0x63, 0x58, 0x98, 0x06,
-	0x55, 0x6d, 0xe8, 0x35, 0x13, 0xa6, 0x6a, 0xda, 0xa9, 0x7b, 0x28, 0x39, 0xcb, 0x1d, 0xf1, 0x29, 0x5c, 0x73, 0x10,
-	0x4a, 0x4e, 0x21, 0x54, 0xe6, 0x66, 0xde, 0x71, 0x13, 0xc2, 0x79, 0x24, 0xd7, 0x1c, 0xe9, 0x35, 0x9b, 0xb5, 0x52,
-	0x7e, 0xd1, 0xdb, 0xac, 0x28, 0xc6, 0xe9, 0xa0, 0x6f, 0x66, 0x1e, 0x32, 0x3b, 0x18, 0xca, 0x55, 0x67, 0x78, 0xd5,
-	0x2a, 0xf7, 0xd1, 0x5d, 0x88, 0xad, 0x76, 0xa4, 0x18, 0x36, 0xd7, 0xeb, 0x1a, 0xdf, 0x08, 0xd0, 0xba, 0x99, 0x64,
-	0x74, 0x7f, 0x6c, 0x7a, 0x77, 0x9b, 0x78, 0xaa, 0x19, 0xbf, 0xee, 0xe3, 0xb8, 0x78, 0x56, 0x0d, 0x1a, 0x63, 0x34,
-	0x91, 0x09, 0xb7, 0x31, 0x9d, 0x31, 0x44, 0xcd, 0xa4, 0x0b, 0xcd, 0xd1, 0x04, 0xab, 0x3e, 0xce, 0xdd, 0xb2, 0x56,
-	0xad, 0x0a, 0xce, 0x18, 0xc7, 0x82, 0xc6, 0x7f, 0xff, 0x2f, 0x98, 0xa3, 0xbd, 0xf9, 0xc8, 0x16, 0x35, 0x8e, 0xfb,
-	0xa2, 0xd7, 0x1c, 0xe3, 0xb4, 0x78, 0xd0, 0x9f, 0xe5, 0xd7, 0xdc, 0x98, 0x9b, 0x6b, 0x41, 0x71, 0x5b, 0x5c, 0x6d,
-	0x3c, 0xe8, 0xd8, 0x30, 0x6b, 0x66, 0x6a, 0xda, 0xee, 0x81, 0x71, 0xda, 0x63, 0xde, 0x6e, 0x28, 0x38, 0xc8, 0x0b,
-	0x6e, 0x33, 0xef, 0x4e, 0xd1, 0x65, 0x83, 0x2a, 0x2f, 0xfa, 0x35, 0x76, 0x8b, 0x76, 0x75, 0x68, 0xcb, 0xda, 0x39,
-	0x46, 0xba, 0x6c, 0x57, 0xb6, 0x51, 0x61, 0x28, 0x2b, 0x3e, 0x8a, 0xcb, 0x88, 0x9d, 0x36, 0x6a, 0x38, 0x45, 0x67,
-	0x0e, 0xec, 0x34, 0xb1, 0x97, 0x66, 0x72, 0x4d, 0x5d, 0xdb, 0xd9, 0x9c, 0x16, 0x9d, 0xe4, 0xe1, 0xf5, 0x14, 0xc3,
-	0xeb, 0x2c, 0xc8, 0xcb, 0x64, 0x9a, 0x4a, 0x4e, 0xf3, 0x9a, 0x1e, 0xc2, 0xdd, 0x27, 0xe1, 0xa2, 0xcd, 0x82, 0x61,
-	0x3c, 0xac, 0x62, 0x51, 0x33, 0xb3, 0x7f, 0x0e, 0x17, 0x1d, 0x76, 0x46, 0x1d, 0x62, 0x41, 0x33, 0xa0, 0x1d, 0x35,
-	0xb8, 0xa7, 0x8d, 0x57, 0xb5, 0x60, 0x65, 0x26, 0xf5, 0x2f, 0xaa, 0xb0, 0xe3, 0x66, 0x45, 0x06, 0x05, 0x4d, 0xcf,
-	0xaa, 0x53, 0x7b, 0xda, 0xb0, 0x1b, 0x0f, 0xb3, 0x8b, 0xc6, 0xe9, 0x60, 0xd7, 0x73, 0x9b, 0x05, 0x48, 0x2f, 0x4d,
-	0xc2, 0x46, 0xb3, 0x3e, 0x16, 0x1c, 0xe6, 0x86, 0x6f, 0x75, 0x52, 0xa5, 0x68, 0x34, 0x13, 0x35, 0x6e, 0x87, 0xf4,
-	0x2a, 0x9d, 0x13, 0xd7, 0x65, 0xb3, 0xbe, 0xc8, 0x71, 0x70, 0xd7, 0xac, 0x75, 0x6d, 0x13, 0xf9, 0xed, 0x19, 0x69,
-	0x71, 0xdc, 0x8a, 0x1f, 0xdf, 0x81, 0x75, 0x78, 0xd8, 0xb4, 0x15, 0x6e, 0x11, 0x67, 0xf8, 0x28, 0xc4, 0x4f, 0xeb,
-	0xcd, 0xed, 0x2a, 0xca, 0xd9, 0x60, 0x32, 0xec, 0x56, 0xe1, 0xc3, 0x76, 0x41, 0xd9, 0x9d, 0x33, 0x31, 0x43, 0x4b,
-	0xc8, 0x22, 0xdc, 0x6e, 0x8f, 0x32, 0x1f, 0x6f, 0x63, 0xa4, 0x19, 0x8a, 0xda, 0x64, 0x82, 0xb6, 0x3f, 0xcd, 0x9b,
-	0xa3, 0x08, 0xc6, 0x85, 0x7b, 0x17, 0xfe, 0x8d, 0xb7, 0x5b, 0x21, 0x9c, 0x54, 0xb1, 0xf3, 0x4d, 0xcc, 0xf2, 0xa7,
-	0x5d, 0xed, 0x6e, 0xd6, 0x8f, 0x41, 0x7e, 0xba, 0xb5, 0xfe, 0xa4, 0xf3, 0x9a, 0x76, 0xd7, 0x38, 0x75, 0x1e, 0xc8,
-	0x00, 0x7a, 0xd7, 0xa6, 0xb0, 0xe2, 0x4c, 0x3b, 0x24, 0xab, 0xda, 0xb1, 0x6b, 0x08, 0x6b, 0xac, 0xc1, 0xc4, 0x04,
-	0x79, 0x2d, 0x2b, 0xa1, 0xb3, 0x20, 0x1b, 0x63, 0x1d, 0x7c, 0x06, 0x71, 0x16, 0x9d, 0xd6, 0x63, 0x9b, 0xed, 0x6e,
-	0x1d, 0x2f, 0xde, 0x85, 0x46, 0x3f, 0xac, 0xf5, 0xe2, 0xc0, 0x38, 0x98, 0x18, 0x45, 0xda, 0xaf, 0xb4, 0x3e, 0x5d,
-	0xa3, 0x67, 0xa3, 0xb0, 0x24, 0xaa, 0xd2, 0x19, 0x26, 0xe6, 0x6f, 0x0e, 0xbb, 0xdd, 0xea, 0xf1, 0xa6, 0x96, 0xd1,
-	0xb7, 0x9d, 0x29, 0x8d, 0x9b, 0xb5, 0xd0, 0x64, 0x18, 0xfb, 0x53, 0x9c, 0x60, 0x57, 0x43, 0x18, 0xdf, 0xf6, 0xeb,
-	0x2e, 0xb7, 0xd7, 0x4d, 0x70, 0xfa, 0x5d, 0x96, 0xa6, 0xbd, 0xb0, 0x1a, 0x2a, 0xce, 0xb6, 0x63, 0xc8, 0xc6, 0xbc,
-	0x8e, 0x8e, 0x8b, 0xa3, 0x6e, 0x5c, 0x1c, 0x0d, 0x61, 0x61, 0x32, 0x98, 0x9a, 0x4e, 0x71, 0x7f, 0x58, 0x37, 0x67,
-	0x3c, 0x6c, 0x75, 0x46, 0xd1, 0xcc, 0x74, 0x9a, 0x0a, 0x8e, 0x26, 0x61, 0x42, 0x2c, 0x67, 0x99, 0x91, 0xa7, 0x3d,
-	0xab, 0xab, 0x9f, 0x9e, 0xd5, 0x35, 0xab, 0x1a, 0xf7, 0xf1, 0xac, 0x61, 0xe1, 0x2c, 0x8d, 0x66, 0xf7, 0x34, 0x33,
-	0xfe, 0xdc, 0xad, 0x55, 0x0a, 0xc6, 0x23, 0x34, 0x74, 0x9c, 0xa4, 0xa7, 0x92, 0x9b, 0x62, 0x49, 0xe3, 0xc4, 0xd5,
-	0xe3, 0x6d, 0x9c, 0x0e, 0x35, 0xe3, 0x45, 0x3b, 0x1f, 0x68, 0x88, 0xae, 0x9e, 0xa1, 0xb8, 0xf1, 0xe0, 0xed, 0xf2,
-	0xfe, 0x3e, 0x2e, 0x0e, 0x5b, 0x95, 0x6b, 0xac, 0x18, 0x16, 0xe3, 0xc9, 0x19, 0x73, 0xef, 0x84, 0x98, 0x65, 0xf3,
-	0xcf, 0x89, 0x13, 0xf3, 0x3c, 0xa1, 0xd2, 0x76, 0xa8, 0xd5, 0x6e, 0x25, 0xb9, 0xad, 0x59, 0x67, 0xfb, 0xaa, 0x39,
-	0x6f, 0x18, 0x33, 0x48, 0x83, 0x99, 0xe9, 0x82, 0x5f, 0x97, 0xbb, 0xe5, 0xfd, 0x6e, 0xf9, 0x55, 0x66, 0x77, 0x9d,
-	0x04, 0x0d, 0x3a, 0x7d, 0x9b, 0xf6, 0x63, 0x0f, 0x89, 0x53, 0xf1, 0xe1, 0x58, 0x24, 0xe8, 0xd0, 0xb8, 0x2e, 0x09,
-	0xfc, 0xa0, 0x99, 0xc7, 0x0d, 0x47, 0xfd, 0xae, 0xef, 0x4a, 0x79, 0x93, 0x4a, 0xd2, 0x88, 0xfc, 0xb4, 0xdc, 0xa7,
-	0x74, 0xcb, 0x59, 0x9b, 0xef, 0x69, 0x47, 0xdb, 0x41, 0x32, 0x74, 0x9c, 0xa1, 0xdb, 0xa8, 0xd4, 0xd3, 0x46, 0xe1,
-	0xb4, 0x36, 0x2c, 0xe1, 0xb4, 0x89, 0x7f, 0x1a, 0xe4, 0xec, 0x46, 0x5d, 0xce, 0xae, 0x8b, 0x66, 0x35, 0xa1, 0x71,
-	0x6b, 0x8a, 0x66, 0x88, 0x30, 0x27, 0x9c, 0xe3, 0x64, 0xbe, 0x99, 0xa7, 0x85, 0xdb, 0xad, 0x36, 0x9b, 0xf5, 0xd7,
-	0xfd, 0x3a, 0x0c, 0x8e, 0x5d, 0xe2, 0x62, 0xde, 0xcc, 0x2f, 0x52, 0x36, 0x6b, 0x10, 0x67, 0xf5, 0xe9, 0x84, 0xc6,
-	0x57, 0x4f, 0x9f, 0xb7, 0x87, 0x94, 0x84, 0x3c, 0x0b, 0x53, 0xea, 0x2e, 0x85, 0xae, 0xba, 0x34, 0x37, 0x13, 0x85,
-	0x98, 0x35, 0x48, 0x1a, 0x3b, 0x1e, 0xb7, 0xa7, 0x8d, 0xbb, 0x29, 0xa1, 0x6a, 0xac, 0x9d, 0x8b, 0x37, 0xce, 0x95,
-	0xa4, 0xd1, 0x59, 0x23, 0xe0, 0x93, 0x66, 0x7e, 0xd6, 0x8e, 0x1a, 0xd3, 0x71, 0xba, 0xcd, 0x28, 0x2f, 0xbf, 0xbc,
-	0x39, 0x3c, 0xad, 0xc4, 0xb7, 0xb3, 0xae, 0xfc, 0xb0, 0x4d, 0x38, 0x68, 0x79, 0x93, 0xf8, 0x0b, 0x13, 0xf6, 0xbb,
-	0xcd, 0xea, 0x25, 0xe9, 0x60, 0x77, 0x52, 0x33, 0x52, 0xc0, 0x49, 0x76, 0x76, 0x90, 0x06, 0x97, 0x26, 0xb4, 0x9b,
-	0x16, 0xf6, 0xbb, 0xd8, 0x52, 0xd9, 0x8c, 0x33, 0xf0, 0x58, 0xfe, 0x61, 0x79, 0xb3, 0x8b, 0x2a, 0x3e, 0x09, 0xd7,
-	0x1f, 0xb6, 0x73, 0x8a, 0xe8, 0xca, 0x38, 0x0f, 0xd7, 0x05, 0xc8, 0x2a, 0x35, 0x5a, 0x8a, 0x67, 0x6d, 0x36, 0xb9,
-	0xa4, 0xdb, 0xed, 0xd3, 0xf2, 0x26, 0x0d, 0x46, 0xed, 0x1c, 0x76, 0xd2, 0xce, 0x2d, 0x87, 0xed, 0x62, 0x45, 0x52,
-	0x3e, 0x55, 0x9c, 0x95, 0xa7, 0x73, 0xd6, 0x4d, 0x47, 0x8b, 0x5e, 0x9f, 0x74, 0x27, 0x0c, 0xdb, 0x15, 0xb1, 0x9e,
-	0x60, 0x64, 0x6f, 0x17, 0x47, 0xae, 0x46, 0xbd, 0xc7, 0x6d, 0xaa, 0xaa, 0x11, 0xa0, 0x69, 0x9c, 0x15, 0x55, 0x7d,
-	0xe3, 0xb6, 0x9b, 0xd5, 0x6d, 0x13, 0x8d, 0x92, 0x80, 0x0d, 0x8f, 0x58, 0xaa, 0xd1, 0x38, 0xe6, 0xf0, 0xab, 0xbe,
-	0x4d, 0xbf, 0x1e, 0x1e, 0xef, 0x97, 0xbb, 0xc3, 0xc3, 0x66, 0x79, 0x08, 0x8d, 0x98, 0x77, 0xcd, 0x1e, 0xcd, 0xc0,
-	0x75, 0x55, 0xdf, 0x78, 0x61, 0x7b, 0xbf, 0x7d, 0x5c, 0x85, 0x39, 0x72, 0xa3, 0x2f, 0xdd, 0x3d, 0x86, 0xfd, 0x91,
-	0xde, 0xc3, 0x38, 0xe1, 0x66, 0x99, 0x7c, 0xe0, 0x39, 0xb9, 0xea, 0x53, 0xc7, 0x78, 0x30, 0x3a, 0xd9, 0x31, 0x49,
-	0x28, 0xab, 0x38, 0x59, 0x49, 0x27, 0xbc, 0x0a, 0xc9, 0xa1, 0xb6, 0x99, 0x73, 0xcc, 0x57, 0x54, 0x55, 0xac, 0xca,
-	0x34, 0x14, 0xdc, 0xee, 0x6e, 0xef, 0x56, 0x0f, 0xeb, 0x94, 0x5c, 0x6c, 0x46, 0xd0, 0x51, 0xb3, 0x16, 0x1a, 0x8e,
-	0x20, 0xd1, 0x50, 0x0d, 0xcd, 0xf4, 0xf9, 0x2d, 0xac, 0x62, 0xbb, 0xc9, 0x59, 0x96, 0x63, 0xa9, 0xe2, 0x73, 0x91,
-	0x94, 0x14, 0xd1, 0xe2, 0xed, 0x9a, 0xb7, 0xf5, 0x6d, 0xfb, 0x64, 0x24, 0x66, 0xb4, 0xab, 0xf8, 0x68, 0x24, 0xd5,
-	0xfe, 0x3c, 0xd4, 0x7e, 0x18, 0x72, 0xb3, 0xf3, 0xc9, 0x00, 0xeb, 0x12, 0xfd, 0x35, 0x19, 0xc7, 0x06, 0x3c, 0x34,
-	0xd3, 0xac, 0xc3, 0x26, 0xb6, 0x60, 0x12, 0x1a, 0x30, 0x81, 0x5e, 0x50, 0xc5, 0x47, 0x04, 0x71, 0xf1, 0xb1, 0x94,
-	0xc6, 0x86, 0x85, 0xe8, 0x6c, 0x0c, 0xf3, 0xff, 0x6a, 0x64, 0x96, 0x53, 0xb7, 0xed, 0xa0, 0xbc, 0xdf, 0x9b, 0x55,
-	0x55, 0x92, 0x89, 0x6a, 0x64, 0x57, 0x40, 0x60, 0x9c, 0xee, 0x21, 0x4d, 0x35, 0x07, 0xad, 0xac, 0x62, 0xda, 0x3c,
-	0xad, 0x5a, 0xb4, 0x78, 0x9b, 0x00, 0x6b, 0xaa, 0x34, 0x9e, 0xb5, 0x61, 0x1d, 0x63, 0x21, 0x26, 0xcf, 0x63, 0x66,
-	0x64, 0x2b, 0x49, 0xe0, 0xb0, 0xcc, 0x99, 0x0f, 0x60, 0x39, 0x52, 0x8d, 0x8d, 0xd0, 0x35, 0x63, 0xdf, 0x43, 0x23,
-	0x8d, 0x9f, 0x36, 0x7b, 0x18, 0x2a, 0x9a, 0xe5, 0x4e, 0x9b, 0xf2, 0x19, 0x84, 0x73, 0xce, 0x06, 0x79, 0xed, 0x7f,
-	0xcd, 0x7a, 0x63, 0x33, 0x0f, 0x6b, 0x97, 0x32, 0x8d, 0x5b, 0xe6, 0x83, 0x71, 0x7e, 0x42, 0x1a, 0xc2, 0x55, 0xe6,
-	0x60, 0xb5, 0x9c, 0x62, 0xd9, 0x16, 0x5f, 0xaa, 0xa0, 0x40, 0x1a, 0x80, 0x8a, 0xa7, 0x25, 0x0d, 0x75, 0x47, 0x59,
-	0xde, 0x4c, 0x50, 0x7a, 0xa9, 0x4e, 0xda, 0xc1, 0x4e, 0xd5, 0x29, 0x25, 0x87, 0xb2, 0x36, 0xa7, 0x24, 0x11, 0x37,
-	0x59, 0x66, 0xf5, 0xb7, 0xeb, 0xe7, 0xb5, 0x88, 0x6e, 0xbb, 0x74, 0x6f, 0x13, 0xe5, 0xed, 0xe4, 0x7c, 0x34, 0x2b,
-	0x5c, 0x1e, 0x06, 0x82, 0x74, 0xed, 0x38, 0xe9, 0x8c, 0x85, 0x53, 0xda, 0xd9, 0x8c, 0x02, 0x29, 0x01, 0x4d, 0x67,
-	0x24, 0x8b, 0x82, 0x03, 0x4e, 0x58, 0x34, 0xe5, 0xea, 0xcc, 0x0d, 0x20, 0x6b, 0x57, 0xbc, 0x45, 0x8d, 0x43, 0x99,
-	0xae, 0xdb, 0x8a, 0xf6, 0xdf, 0x77, 0x8f, 0xbc, 0x60, 0x20, 0x18, 0xca, 0xb3, 0xed, 0x6c, 0xa5, 0xcb, 0x5e, 0x33,
-	0x4d, 0x3f, 0xe1, 0xba, 0xd4, 0x9a, 0x34, 0x16, 0x60, 0x3b, 0x26, 0x55, 0xa1, 0x74, 0xe6, 0x68, 0x3c, 0xa3, 0x14,
-	0xdd, 0x4b, 0x50, 0xf6, 0xd6, 0xba, 0x55, 0x25, 0x2b, 0x6b, 0xdb, 0x88, 0x74, 0x0b, 0x35, 0xd5, 0x29, 0xcb, 0xa6,
-	0xf8, 0x86, 0xeb, 0x4f, 0x64, 0x74, 0xca, 0x56, 0xee, 0x36, 0x98, 0x7e, 0xce, 0x9b, 0x10, 0x93, 0xff, 0xd4, 0x80,
-	0xf4, 0x30, 0xa1, 0x19, 0xee, 0xe5, 0xb1, 0xc7, 0xd9, 0xd8, 0x3e, 0x51, 0x48, 0x9d, 0x5f, 0xa6, 0xa3, 0xd6, 0x6d,
-	0x93, 0x91, 0x6c, 0x49, 0x68, 0x86, 0xf9, 0x33, 0x72, 0xc1, 0x70, 0x2a, 0x27, 0xc5, 0xdd, 0x05, 0x41, 0xf2, 0xc2,
-	0x43, 0xb2, 0xe9, 0x08, 0xf2, 0xca, 0xd4, 0x08, 0x98, 0x85, 0xa4, 0x26, 0xcc, 0x26, 0x23, 0xdf, 0x07, 0x37, 0xda,
-	0x9b, 0x21, 0xcb, 0x57, 0x56, 0x98, 0x14, 0x12, 0xd8, 0x1d, 0xa6, 0x05, 0x7f, 0xfd, 0x41, 0x6d, 0x9e, 0x87, 0x36,
-	0x67, 0x69, 0x7e, 0xab, 0x92, 0x1b, 0xf5, 0x72, 0x78, 0xdc, 0xd9, 0xdc, 0xaa, 0xdc, 0x41, 0x75, 0xe2, 0xf8, 0xdf,
-	0x48, 0xde, 0x85, 0xad, 0xd1, 0x40, 0xbc, 0x90, 0xa5, 0xe0, 0x6d, 0x3b, 0xfe, 0xa9, 0x35, 0x82, 0x67, 0x4c, 0xe5,
-	0x3a, 0xe9, 0xbc, 0x11, 0xeb, 0x54, 0x74, 0x58, 0x3e, 0xaf, 0x2b, 0x87, 0x9d, 0x2a, 0x80, 0xfa, 0x4c, 0x93, 0x5c,
-	0x27, 0x04, 0x03, 0x26, 0x69, 0x27, 0xc5, 0x22, 0x25, 0x39, 0x1d, 0x0f, 0xd0, 0xe5, 0x47, 0x73, 0x79, 0x5c, 0xb9,
-	0xfd, 0xb6, 0x7a, 0xbc, 0x4f, 0x02, 0x16, 0x56, 0xb9, 0x69, 0xfe, 0x61, 0x4d, 0xf9, 0x41, 0xeb, 0x9e, 0x1e, 0xa6,
-	0xb0, 0x5e, 0xc7, 0x87, 0x66, 0xd6, 0x5b, 0x23, 0xf1, 0x56, 0xf6, 0x00, 0x8d, 0xba, 0xbd, 0x91, 0x3a, 0xc8, 0xd9,
-	0x95, 0xe3, 0xda, 0xca, 0xe3, 0x7f, 0x21, 0xf6, 0xaf, 0xa0, 0xa3, 0xa5, 0x91, 0x84, 0x3a, 0x5a, 0xca, 0x5e, 0x6a,
-	0xc3, 0xbb, 0x89, 0x4b, 0x9b, 0xc2, 0x2c, 0x56, 0xe7, 0x26, 0x73, 0x59, 0x0c, 0x51, 0x4c, 0xbf, 0xdb, 0x46, 0xff,
-	0x27, 0x0f, 0xa2, 0xf4, 0x90, 0x85, 0x82, 0x28, 0x46, 0xdd, 0xc5, 0xe7, 0xed, 0x2e, 0x13, 0x89, 0xa9, 0x13, 0xff,
-	0x71, 0x8e, 0x09, 0x2d, 0x85, 0xc7, 0x6f, 0xd4, 0xd6, 0xe4, 0x64, 0xd0, 0xe9, 0xa2, 0x93, 0xd3, 0x13, 0x33, 0x2d,
-	0x0c, 0x8f, 0xcd, 0x38, 0x26, 0x46, 0xb2, 0xa0, 0x21, 0xc1, 0x6a, 0xad, 0x58, 0xec, 0xba, 0x97, 0xa8, 0x86, 0x3a,
-	0x66, 0x50, 0xd5, 0x53, 0xf0, 0x24, 0x81, 0xc3, 0xb0, 0xb1, 0x02, 0x97, 0x16, 0x88, 0xed, 0x16, 0x8a, 0xfd, 0xa1,
-	0xcb, 0x6a, 0x48, 0xbe, 0xb3, 0xe9, 0x44, 0xcd, 0x04, 0x19, 0xb7, 0x47, 0x90, 0x35, 0x55, 0xb2, 0xc0, 0x98, 0xe5,
-	0x49, 0x0b, 0x28, 0x5c, 0x71, 0xbe, 0x92, 0x0a, 0xc3, 0x0c, 0xb0, 0x3c, 0xb9, 0x91, 0xa9, 0xd6, 0xc3, 0x61, 0xf3,
-	0xb4, 0xfe, 0xba, 0x09, 0x39, 0xbb, 0x66, 0xb2, 0x35, 0x08, 0xa3, 0x63, 0xdf, 0x46, 0x4c, 0x34, 0x0d, 0xa8, 0xc2,
-	0x89, 0x2e, 0xa5, 0x52, 0xab, 0x01, 0x1f, 0x1f, 0x72, 0x52, 0x55, 0xa2, 0x88, 0x7c, 0x5d, 0xee, 0x9e, 0xd6, 0xcb,
-	0xcd, 0xed, 0xfa, 0x4e, 0x1e, 0xf8, 0x0c, 0xba, 0xe9, 0x71, 0x4b, 0x17, 0x3b, 0x49, 0x9d, 0xcf, 0x2c, 0x71, 0xee,
-	0x14, 0x57, 0xb7, 0x34, 0x20, 0x19, 0x61, 0x6b, 0xc7, 0x21, 0xaa, 0x53, 0x52, 0x41, 0x9b, 0x33, 0x18, 0x4e, 0xbb,
-	0xa7, 0x50, 0x93, 0xf2, 0x64, 0xf7, 0x67, 0x3b, 0xff, 0x4b, 0x5a, 0x5e, 0x1c, 0x2b, 0xb2, 0x46, 0xa0, 0xec, 0xd8,
-	0x36, 0xa4, 0x99, 0x5c, 0x7e, 0x06, 0xcc, 0xe3, 0x4a, 0x67, 0xdc, 0x40, 0x0f, 0x3b, 0x31, 0xc6, 0xa7, 0x67, 0x42,
-	0x60, 0xa4, 0xf4, 0x40, 0xac, 0xb8, 0x86, 0x80, 0xfe, 0x05, 0x51, 0x91, 0x72, 0x1e, 0x3c, 0x25, 0x48, 0x51, 0xf1,
-	0x7d, 0x0f, 0xfc, 0x0a, 0x35, 0x19, 0x15, 0x67, 0x02, 0xb0, 0x69, 0xac, 0x59, 0x6b, 0x17, 0x77, 0x8e, 0xa5, 0x8b,
-	0xc7, 0x27, 0x14, 0xbb, 0xed, 0x97, 0xd5, 0x23, 0x3e, 0xa7, 0x18, 0x8c, 0xfb, 0xe1, 0x39, 0x45, 0xbf, 0x30, 0x1b,
-	0xdb, 0xad, 0xee, 0xd7, 0x7b, 0xcd, 0x5c, 0xea, 0x74, 0x6c, 0xc6, 0xa3, 0x51, 0x1a, 0xc3, 0xb4, 0x47, 0xc2, 0xee,
-	0x8f, 0x72, 0x93, 0x73, 0x1d, 0x4f, 0xdb, 0x3b, 0x58, 0xc7, 0x65, 0x39, 0xbf, 0x3f, 0x34, 0x43, 0x64, 0x4a, 0xd6,
-	0xb7, 0xd3, 0x99, 0x36, 0xbb, 0xdf, 0x4e, 0x44, 0x6d, 0xc3, 0x53, 0x90, 0xaa, 0xa0, 0x94, 0xe3, 0x33, 0x0d, 0x5b,
-	0xd6, 0x05, 0xb3, 0x13, 0x91, 0xb3, 0x85, 0x60, 0x80, 0x47, 0x85, 0x14, 0x0c, 0x69, 0xd0, 0x82, 0xd5, 0x55, 0x1a,
-	0xb0, 0x4a, 0xb3, 0xf9, 0xff, 0xc0, 0xba, 0xb3, 0x58, 0x78, 0x3c, 0x0a, 0xd5, 0x96, 0xad, 0x4e, 0xba, 0x3d, 0x2a,
-	0x6c, 0x87, 0x6b, 0x77, 0x68, 0xf6, 0x0b, 0x83, 0xd6, 0xcf, 0x4f, 0x92, 0x57, 0x28, 0xce, 0xe4, 0xd3, 0x74, 0x10,
-	0x47, 0xe7, 0x38, 0x25, 0xc9, 0x76, 0x1d, 0xd1, 0x94, 0xb6, 0x34, 0x11, 0xae, 0x06, 0x43, 0xbe, 0x4f, 0xb4, 0xfd,
-	0x13, 0x28, 0x68, 0xf7, 0x84, 0x72, 0xd4, 0xce, 0xe4, 0xad, 0x31, 0x93, 0x2e, 0xe0, 0x6a, 0x6a, 0x18, 0xa7, 0x0c,
-	0xb3, 0x13, 0xab, 0x29, 0x4c, 0xac, 0x55, 0x71, 0x62, 0x3e, 0x28, 0xb7, 0xfb, 0x15, 0xb8, 0xeb, 0xfb, 0x23, 0x51,
-	0x2e, 0x53, 0xa9, 0x7c, 0x31, 0xd5, 0x01, 0xc3, 0xdc, 0xa9, 0x54, 0x47, 0x7c, 0x78, 0x69, 0xea, 0xd2, 0x3e, 0xc1,
-	0xa4, 0xc2, 0x49, 0xc9, 0xa1, 0xa5, 0x83, 0x49, 0x58, 0x68, 0xb6, 0xb9, 0xa2, 0xf4, 0x48, 0x9e, 0x86, 0x68, 0x9a,
-	0xf0, 0xbb, 0x43, 0x74, 0x8a, 0x7b, 0x16, 0xd8, 0xe9, 0xa9, 0x34, 0x0d, 0x4e, 0x1c, 0x55, 0xf1, 0xa9, 0x9b, 0xa4,
-	0x09, 0x3c, 0x5c, 0xfe, 0xc4, 0x7c, 0x3f, 0xb5, 0xb6, 0x90, 0x65, 0xe2, 0x51, 0x31, 0xb6, 0xd6, 0x8c, 0x5a, 0xff,
-	0xcd, 0xac, 0xe4, 0x12, 0x44, 0xe4, 0xe4, 0x52, 0x5c, 0x56, 0xca, 0xab, 0xcd, 0x53, 0xcc, 0x12, 0xb7, 0x49, 0xd9,
-	0xb6, 0xbf, 0x14, 0x44, 0xe1, 0x29, 0x4d, 0x4c, 0xc3, 0x16, 0x82, 0x59, 0xbe, 0x43, 0x85, 0xa6, 0x60, 0xc7, 0x6d,
-	0x36, 0x01, 0x9b, 0x37, 0x02, 0x3f, 0x6c, 0x46, 0x8a, 0xd1, 0x89, 0x09, 0x58, 0x66, 0x20, 0x6c, 0x2d, 0x89, 0xac,
-	0xd4, 0xe9, 0x41, 0x9f, 0xfe, 0x77, 0xfb, 0x14, 0xbc, 0x24, 0x42, 0x32, 0x3f, 0x3c, 0xca, 0x18, 0xf7, 0xe3, 0x56,
-	0x8d, 0xa2, 0x64, 0x52, 0x0e, 0x4e, 0x22, 0xc8, 0xcd, 0xc1, 0x25, 0x09, 0xc7, 0xae, 0x2b, 0x01, 0x3d, 0x19, 0xce,
-	0xd9, 0x4a, 0x69, 0x73, 0x8e, 0x66, 0x2a, 0xe2, 0xf5, 0xbd, 0x59, 0xf3, 0x6c, 0x38, 0xea, 0xa5, 0x79, 0x6d, 0xa3,
-	0x9d, 0xbb, 0x46, 0x43, 0xf7, 0xa9, 0xdb, 0xb4, 0x56, 0x9a, 0xcf, 0xd9, 0xae, 0x69, 0x26, 0x9f, 0xad, 0x5a, 0xe2,
-	0x52, 0xbf, 0x72, 0x72, 0x15, 0x23, 0xe9, 0xc5, 0x1b, 0x33, 0x1b, 0x18, 0xf5, 0x4f, 0xac, 0xc2, 0xdf, 0x58, 0x11,
-	0x9d, 0x4d, 0x65, 0x35, 0x88, 0x9b, 0x15, 0x6d, 0xcb, 0xdf, 0x9a, 0xb5, 0x48, 0x9b, 0x4d, 0xa7, 0x30, 0x4d, 0xc9,
-	0x71, 0x7d, 0xc5, 0x42, 0x42, 0xa3, 0xdd, 0x1e, 0x3e, 0x1f, 0x4f, 0xf8, 0xfa, 0x3a, 0x1d, 0xcb, 0x17, 0x5e, 0x27,
-	0xe6, 0x63, 0x69, 0x8c, 0xa7, 0x08, 0x19, 0x9c, 0x9a, 0x04, 0xe1, 0x53, 0xa5, 0xe1, 0xb0, 0x9b, 0x82, 0x3a, 0xeb,
-	0xcc, 0xd4, 0x5e, 0xb3, 0xc0, 0xce, 0x9e, 0x1e, 0x58, 0x3f, 0x37, 0x41, 0xf4, 0x79, 0xb9, 0xb9, 0x8b, 0x23, 0x64,
-	0xf0, 0xb0, 0xd3, 0x73, 0xe2, 0xb0, 0xda, 0xe6, 0xea, 0x61, 0x4c, 0x9d, 0xc7, 0x9d, 0xe0, 0x76, 0x4c, 0x4d, 0xd1,
-	0x6d, 0x94, 0xe5, 0x94, 0x3a, 0xa6, 0xe9, 0x27, 0x6c, 0xe9, 0x48, 0xd3, 0x4f, 0x9a, 0x5d, 0x45, 0x19, 0xa2, 0xee,
-	0x13, 0xd5, 0x68, 0xe6, 0xa9, 0x51, 0xec, 0x3e, 0x76, 0x7d, 0x7a, 0x6a, 0x86, 0xbe, 0x42, 0xb5, 0x56, 0xef, 0x16,
-	0x27, 0x35, 0xf7, 0x30, 0xe1, 0x83, 0xbd, 0x67, 0xd4, 0x5e, 0xf0, 0x81, 0xf4, 0xb4, 0xcc, 0x0d, 0x13, 0x67, 0x05,
-	0xa9, 0x1d, 0x4d, 0xd7, 0xc0, 0x27, 0x96, 0xcc, 0x5a, 0xdc, 0x66, 0x8c, 0x4f, 0xf5, 0xcd, 0xa4, 0x92, 0x64, 0xda,
-	0x53, 0xe3, 0x42, 0xec, 0xd1, 0xb7, 0xcd, 0x38, 0x2e, 0x6f, 0x15, 0x8c, 0xa7, 0xcd, 0x84, 0x65, 0x12, 0x9e, 0xbe,
-	0x0d, 0x6c, 0xc6, 0x35, 0x06, 0x88, 0x76, 0x85, 0x53, 0xb1, 0xa1, 0x33, 0xaf, 0xa5, 0xc9, 0x43, 0xb8, 0x89, 0xb8,
-	0xb4, 0x38, 0xd1, 0xab, 0x9f, 0x4c, 0x02, 0x8d, 0xe2, 0x5c, 0xf7, 0x76, 0x7d, 0xb3, 0x4c, 0xfb, 0x2b, 0xce, 0xba,
-	0xcd, 0xf1, 0x4d, 0x57, 0x2b, 0xd5, 0xe6, 0xb5, 0xcd, 0x65, 0x35, 0x93, 0xc6, 0xf2, 0x44, 0xba, 0x94, 0xff, 0xcd,
-	0xf6, 0xb2, 0xd1, 0x72, 0x09, 0x3a, 0x43, 0x5a, 0x2e, 0x55, 0xc3, 0x82, 0x31, 0xb5, 0x30, 0x1a, 0xb3, 0xd4, 0x77,
-	0x3e, 0xd8, 0x1a, 0x4d, 0x25, 0x47, 0x9e, 0x6d, 0x70, 0x66, 0x7d, 0x29, 0x9c, 0xe5, 0x0a, 0x4d, 0x9a, 0x0d, 0x42,
-	0x4a, 0x34, 0x4d, 0x05, 0x6d, 0x3b, 0x52, 0x61, 0x9c, 0xc9, 0xf6, 0xc3, 0xe8, 0x36, 0x1d, 0x39, 0x1a, 0x9f, 0x4e,
-	0xd0, 0xac, 0x74, 0xba, 0x38, 0x3d, 0xa6, 0x88, 0x61, 0xad, 0x35, 0xc1, 0x78, 0xb6, 0x75, 0x49, 0xf3, 0x4c, 0x23,
-	0xef, 0x69, 0xae, 0x69, 0xc5, 0x5d, 0x53, 0x00, 0x4b, 0xca, 0xbe, 0x97, 0xb5, 0x1d, 0x5a, 0xda, 0xad, 0x26, 0xbb,
-	0x35, 0x81, 0x37, 0x9c, 0xa5, 0xbd, 0xa2, 0xa5, 0x95, 0x44, 0xb6, 0x73, 0x94, 0x32, 0x3d, 0xb8, 0x2e, 0x6e, 0xb7,
-	0x2d, 0x8c, 0xbb, 0xa1, 0xad, 0x34, 0x3e, 0x15, 0x13, 0x1f, 0xc5, 0x9e, 0xf6, 0x08, 0x03, 0x79, 0x31, 0x67, 0x90,
-	0xa6, 0x6c, 0x94, 0x84, 0xef, 0xc7, 0xc7, 0xfa, 0xb0, 0x03, 0xd3, 0xb6, 0x61, 0xb3, 0xbd, 0x6f, 0x7b, 0xe7, 0xe3,
-	0xf6, 0x29, 0x35, 0xa4, 0x9d, 0x1b, 0xe2, 0x0b, 0x2f, 0xd4, 0x21, 0xb2, 0x89, 0x1e, 0xf6, 0x09, 0xf2, 0x5e, 0x54,
-	0x8c, 0x7c, 0xbf, 0x04, 0x88, 0x06, 0x25, 0x57, 0x44, 0x34, 0x9a, 0xfa, 0xe8, 0x88, 0xd8, 0xcc, 0x1f, 0xcf, 0x46,
-	0x6d, 0x62, 0xbd, 0xb1, 0xc0, 0xb4, 0x30, 0xbe, 0xdd, 0x53, 0x52, 0x1b, 0x46, 0x09, 0xd2, 0x9a, 0x78, 0xd6, 0x4a,
-	0x56, 0xa7, 0xa7, 0x3a, 0x76, 0x8a, 0x59, 0x58, 0x29, 0x17, 0xd7, 0x46, 0xea, 0x39, 0x1b, 0x50, 0xe3, 0xf8, 0xa4,
-	0x6c, 0xc2, 0xba, 0x94, 0xf6, 0x64, 0x3c, 0xe6, 0x69, 0xcf, 0x46, 0xe7, 0xdb, 0x69, 0x77, 0xd5, 0xbe, 0x42, 0x61,
-	0x47, 0xad, 0x34, 0x31, 0xc6, 0x89, 0x4c, 0xf7, 0xec, 0x7e, 0xe6, 0x24, 0x8a, 0x62, 0xa0, 0xff, 0x7c, 0x90, 0xd7,
-	0xe3, 0xe0, 0xad, 0xd0, 0x9f, 0x1f, 0x6f, 0xe1, 0x85, 0x52, 0x79, 0xc5, 0xf4, 0xcd, 0x6a, 0xf7, 0xf8, 0x7a, 0xf9,
-	0xb4, 0x84, 0xc3, 0x77, 0xcb, 0x75, 0x33, 0x6d, 0xad, 0x46, 0xb3, 0xc1, 0x8f, 0x3f, 0xbc, 0x79, 0xf7, 0xb1, 0xf7,
-	0xaa, 0xd7, 0x5c, 0xbf, 0x7d, 0x27, 0x55, 0x0e, 0xc2, 0xf0, 0x8f, 0x48, 0xb0, 0x58, 0x86, 0xc8, 0x5c, 0x16, 0xb0,
-	0x7f, 0xb5, 0xd3, 0xb5, 0x74, 0x10, 0x86, 0x79, 0x44, 0xd0, 0x92, 0x80, 0x9f, 0xe3, 0x35, 0xce, 0xe9, 0xde, 0xb8,
-	0xfa, 0x42, 0x38, 0x45, 0x22, 0x82, 0x61, 0x40, 0x43, 0x24, 0x1b, 0xa5, 0x91, 0x10, 0x6b, 0x23, 0x14, 0x76, 0x43,
-	0x20, 0x12, 0xc4, 0x10, 0x90, 0xf7, 0x78, 0x70, 0xd1, 0x3b, 0x9b, 0xeb, 0x81, 0xd8, 0x08, 0x11, 0x6c, 0xb0, 0xe2,
-	0x97, 0xd8, 0x7a, 0x79, 0x66, 0x8b, 0x08, 0x36, 0x18, 0x60, 0x6d, 0x30, 0x80, 0xd2, 0x60, 0x40, 0xf2, 0x06, 0x03,
-	0x11, 0x1b, 0x0c, 0x90, 0xc8, 0x2b, 0x42, 0xdd, 0x50, 0x01, 0xc0, 0xa2, 0x89, 0xc5, 0x74, 0x70, 0xd5, 0x3b, 0x9b,
-	0xa4, 0x83, 0xeb, 0x56, 0x92, 0xf5, 0x48, 0xda, 0x81, 0x90, 0xd6, 0x18, 0xd0, 0x43, 0xa3, 0x97, 0x7a, 0x20, 0x67,
-	0x01, 0x82, 0xad, 0x07, 0x58, 0xaf, 0x05, 0xa0, 0xb4, 0x1e, 0x90, 0xbc, 0xf5, 0x40, 0xc4, 0xd6, 0x03, 0x14, 0x5b,
-	0x0f, 0x50, 0x68, 0xbd, 0x02, 0xcf, 0xe8, 0xee, 0x23, 0x32, 0x75, 0x76, 0x40, 0xcd, 0xa8, 0x9d, 0xfa, 0x86, 0x42,
-	0xd8, 0xd5, 0x04, 0xb1, 0x31, 0x2f, 0xb0, 0xed, 0x74, 0x11, 0xa6, 0x9e, 0x17, 0x08, 0xec, 0x7e, 0x82, 0xd8, 0x3e,
-	0x28, 0xb0, 0xdf, 0x11, 0x03, 0x79, 0x4e, 0xd7, 0xa5, 0x2e, 0x29, 0xb0, 0xdb, 0x2f, 0x85, 0x73, 0x3a, 0xa7, 0x30,
-	0xb6, 0x87, 0x0a, 0x5c, 0xe8, 0xa6, 0xc2, 0x52, 0x5f, 0x15, 0xdc, 0x76, 0x58, 0x81, 0x6d, 0xaf, 0x0d, 0xf0, 0x7b,
-	0x42, 0xb0, 0xff, 0x0a, 0x62, 0x3b, 0x71, 0x84, 0xdd, 0x9e, 0x1c, 0xc8, 0x4b, 0xb2, 0x21, 0xf5, 0x69, 0x81, 0xdd,
-	0x8e, 0x2d, 0x9c, 0xd3, 0xbb, 0x85, 0xb1, 0x5d, 0x5c, 0xe0, 0x42, 0x3f, 0x17, 0x96, 0x3a, 0xbb, 0xe0, 0xd4, 0xe3,
-	0x05, 0x37, 0xdd, 0x3e, 0xa0, 0xd8, 0xf7, 0x03, 0x82, 0x02, 0x10, 0x90, 0x4c, 0x05, 0x04, 0x22, 0x29, 0x10, 0xdc,
-	0xd3, 0x83, 0x40, 0x1d, 0xa8, 0x9b, 0x90, 0x32, 0x08, 0xec, 0xca, 0x83, 0x70, 0xc5, 0x3e, 0x47, 0x42, 0x21, 0x70,
-	0x41, 0x2d, 0x84, 0x25, 0xc9, 0x10, 0x9c, 0x74, 0x43, 0x70, 0x23, 0x1e, 0x01, 0x7d, 0xa6, 0xa8, 0x3b, 0x52, 0x99,
-	0x9a, 0x11, 0xbf, 0xf5, 0x9e, 0xaa, 0x84, 0x3e, 0x8e, 0xaa, 0x22, 0x88, 0xed, 0xb6, 0x02, 0x5b, 0x55, 0x89, 0x30,
-	0xa9, 0x4a, 0x20, 0x50, 0x55, 0x04, 0xb1, 0xaa, 0x22, 0xb0, 0xaf, 0x2a, 0x81, 0x3c, 0xa7, 0xeb, 0x92, 0xaa, 0x08,
-	0xec, 0xaa, 0x8a, 0x70, 0x8e, 0xaa, 0x08, 0x63, 0x55, 0x45, 0xe0, 0x82, 0xaa, 0x08, 0x4b, 0xaa, 0x22, 0xb8, 0x55,
-	0x15, 0x81, 0xad, 0xaa, 0x04, 0xf8, 0x3d, 0x21, 0xa8, 0x2a, 0x82, 0x58, 0x55, 0x89, 0xb0, 0xab, 0x2a, 0x81, 0xbc,
-	0x24, 0x1b, 0x92, 0xaa, 0x08, 0xec, 0xaa, 0x8a, 0x70, 0x8e, 0xaa, 0x08, 0x63, 0x55, 0x45, 0xe0, 0x82, 0xaa, 0x08,
-	0x4b, 0xaa, 0x22, 0x38, 0xa9, 0x8a, 0xe0, 0x46, 0x55, 0x02, 0x8a, 0xaa, 0x12, 0x10, 0x54, 0x95, 0x80, 0x64, 0xaa,
-	0x22, 0x10, 0xa9, 0x8a, 0xe0, 0x9e, 0xaa, 0x04, 0xea, 0x40, 0xdd, 0x84, 0x54, 0x45, 0x60, 0x57, 0x55, 0x84, 0x2b,
-	0xf6, 0x39, 0x52, 0x15, 0x81, 0x0b, 0xaa, 0x22, 0x2c, 0xa9, 0x8a, 0xe0, 0xa4, 0x2a, 0x82, 0x1b, 0x55, 0x09, 0xe8,
-	0x33, 0x45, 0xdd, 0x91, 0xca, 0xd4, 0x8c, 0xf8, 0xad, 0xf7, 0x54, 0x05, 0x0c, 0x82, 0xd2, 0x82, 0xb0, 0xed, 0xc0,
-	0xc8, 0x59, 0x91, 0xc9, 0x38, 0x52, 0x1a, 0x60, 0x51, 0x6e, 0x10, 0xb6, 0x9a, 0x83, 0x9c, 0x2f, 0x3c, 0x50, 0xe2,
-	0xdc, 0xbf, 0x17, 0x49, 0x10, 0x72, 0xae, 0x0e, 0x61, 0x01, 0x47, 0x8c, 0x90, 0xb6, 0x8a, 0x84, 0x5c, 0x41, 0x96,
-	0xb0, 0x08, 0x69, 0x13, 0x92, 0x56, 0xa0, 0x90, 0xb3, 0x2a, 0x05, 0xdc, 0x7b, 0x1f, 0x46, 0xbd, 0x42, 0xd8, 0x8a,
-	0x56, 0xc6, 0xb9, 0xca, 0x05, 0x25, 0x2e, 0x7d, 0x4f, 0x90, 0x86, 0x21, 0xe7, 0x0a, 0x19, 0x16, 0x70, 0xd4, 0x0c,
-	0x69, 0x2b, 0x69, 0xc8, 0x15, 0x74, 0x0d, 0x8b, 0x90, 0xb8, 0x21, 0x49, 0x0a, 0x87, 0xa4, 0x91, 0x39, 0xa0, 0x50,
-	0xeb, 0x00, 0x46, 0xc1, 0x03, 0x38, 0x53, 0x3d, 0xc4, 0x49, 0xfa, 0x90, 0xf4, 0xf4, 0x0f, 0xf8, 0x83, 0xdf, 0xab,
-	0x49, 0x09, 0x91, 0x73, 0xe5, 0x10, 0x0b, 0x9c, 0x56, 0x0c, 0x12, 0x46, 0xe4, 0x0a, 0xea, 0x88, 0x45, 0x48, 0x22,
-	0x91, 0x24, 0x9d, 0x44, 0xd2, 0x88, 0x25, 0x50, 0xcf, 0x7e, 0xf0, 0x1f, 0xfd, 0xd2, 0x75, 0x01, 0x3e, 0x61, 0x34,
-	0x4f, 0x45, 0x13, 0x84, 0x1a, 0xaa, 0xa0, 0xd5, 0x1f, 0x65, 0xac, 0x7e, 0x02, 0x43, 0xea, 0x99, 0x38, 0xd4, 0x4e,
-	0x05, 0xad, 0x72, 0x2a, 0xe3, 0xeb, 0x66, 0xe2, 0xcf, 0xbd, 0x7b, 0x90, 0x66, 0x2a, 0xe3, 0x2a, 0xa6, 0xd2, 0x8e,
-	0x5e, 0x2a, 0x69, 0xd5, 0x52, 0x99, 0x82, 0x56, 0x6a, 0x01, 0x52, 0x4a, 0xa5, 0xac, 0x4e, 0x2a, 0x63, 0x55, 0x32,
-	0x31, 0xef, 0x3d, 0x10, 0x15, 0x52, 0x41, 0xab, 0x8f, 0xc0, 0xb8, 0xea, 0x98, 0xf8, 0x4b, 0xcf, 0xda, 0xa4, 0x8c,
-	0xca, 0xb8, 0xba, 0xa8, 0xb4, 0xa3, 0x8a, 0x4a, 0x5a, 0x4d, 0x54, 0xa6, 0xa0, 0x88, 0x5a, 0x80, 0xf4, 0x50, 0x29,
-	0x52, 0x43, 0xa5, 0x8c, 0x16, 0x26, 0x02, 0x95, 0x30, 0x81, 0xa8, 0x83, 0x09, 0xcc, 0x54, 0x50, 0x51, 0xd2, 0x40,
-	0xa5, 0x3c, 0x05, 0x4c, 0xd8, 0xc1, 0xeb, 0x8f, 0xa4, 0x7e, 0xca, 0xb8, 0xda, 0xa7, 0xf4, 0xa9, 0x5e, 0x4e, 0xba,
-	0xa7, 0x4c, 0x41, 0xf5, 0xb4, 0x00, 0x69, 0x9e, 0x52, 0xa4, 0x78, 0x4a, 0x19, 0xbd, 0x4b, 0xc4, 0xb3, 0x17, 0xc6,
-	0x47, 0xaf, 0x64, 0xed, 0x82, 0x45, 0xf3, 0x78, 0x2a, 0x17, 0x5a, 0x8d, 0x12, 0x27, 0x88, 0xd5, 0x0a, 0x81, 0xad,
-	0xb8, 0x45, 0x98, 0x94, 0x2d, 0x10, 0x28, 0x6b, 0x82, 0x58, 0x4d, 0x13, 0xd8, 0x17, 0xb4, 0x40, 0x9e, 0xd3, 0x75,
-	0x49, 0xca, 0x04, 0x76, 0x75, 0x4c, 0x38, 0x47, 0xc4, 0x84, 0xb1, 0x0a, 0x26, 0x70, 0x41, 0xbe, 0x84, 0x25, 0xed,
-	0x12, 0xdc, 0x0a, 0x97, 0xc0, 0x56, 0xb5, 0x02, 0xfc, 0x9e, 0x10, 0xd4, 0x2b, 0x41, 0xac, 0x58, 0x45, 0xd8, 0x55,
-	0xaa, 0x40, 0x5e, 0x92, 0x0d, 0x49, 0xa3, 0x04, 0x76, 0x05, 0x4a, 0x38, 0x47, 0x9d, 0x84, 0xb1, 0xd2, 0x24, 0x70,
-	0x41, 0x97, 0x84, 0x25, 0x51, 0x12, 0x9c, 0x14, 0x49, 0x70, 0x23, 0x47, 0x01, 0x45, 0x2d, 0x0a, 0x08, 0x0a, 0x51,
-	0x40, 0x32, 0x15, 0x12, 0x88, 0x24, 0x48, 0x70, 0x4f, 0x7f, 0x02, 0x75, 0xa0, 0x6e, 0x42, 0xca, 0x23, 0xb0, 0x2b,
-	0x3b, 0xc2, 0x15, 0xfb, 0x1c, 0x09, 0x8e, 0xc0, 0x05, 0xb5, 0x11, 0x96, 0xa4, 0x46, 0x70, 0xd2, 0x19, 0xc1, 0x8d,
-	0xc8, 0x04, 0xf4, 0x99, 0xa2, 0xee, 0x48, 0x65, 0x6a, 0x46, 0xfc, 0xd6, 0x7b, 0xaa, 0x22, 0xb5, 0x44, 0x59, 0x89,
-	0x90, 0xed, 0xb8, 0x11, 0xb7, 0xc2, 0x92, 0x70, 0x52, 0x16, 0x61, 0x50, 0x5a, 0x22, 0x64, 0xb5, 0x25, 0xe2, 0xbe,
-	0xb8, 0x08, 0x7b, 0xce, 0xd7, 0x26, 0x79, 0x89, 0xb8, 0xab, 0x2f, 0x91, 0x74, 0x04, 0x26, 0x52, 0x56, 0x61, 0x22,
-	0x5e, 0x90, 0x98, 0x48, 0x93, 0xc6, 0x44, 0xc2, 0x8a, 0x4c, 0xc4, 0xad, 0xca, 0x08, 0xfe, 0x9e, 0x21, 0xd4, 0x99,
-	0x08, 0x59, 0xa1, 0x49, 0xb8, 0xab, 0x34, 0xc2, 0x5e, 0xb2, 0x45, 0x49, 0x6b, 0x22, 0xee, 0x8a, 0x4d, 0x24, 0x1d,
-	0xb5, 0x89, 0x94, 0x95, 0x9b, 0x88, 0x17, 0xf4, 0x26, 0xd2, 0x24, 0x38, 0x91, 0x20, 0xc5, 0x89, 0x84, 0x91, 0x1c,
-	0x81, 0x51, 0x73, 0x04, 0x42, 0xd1, 0x11, 0x28, 0x53, 0x9d, 0x88, 0x91, 0xec, 0x44, 0xc2, 0xd3, 0x1d, 0xe1, 0x0e,
-	0xdc, 0x93, 0x48, 0x79, 0x22, 0xee, 0x4a, 0x4f, 0x24, 0xcb, 0x3d, 0x93, 0xc4, 0x27, 0xe2, 0x05, 0xf5, 0x89, 0x34,
-	0xc9, 0x4f, 0x24, 0x48, 0x7f, 0x22, 0x61, 0x04, 0x48, 0xe0, 0x67, 0x0e, 0xc8, 0x23, 0x97, 0xaa, 0x1d, 0xa8, 0x60,
-	0x08, 0x4f, 0x85, 0xa4, 0x4e, 0xa8, 0x42, 0x11, 0xb2, 0xfd, 0x3b, 0xe2, 0x56, 0x85, 0x12, 0x4e, 0x2a, 0x24, 0x0c,
-	0xaa, 0x50, 0x84, 0xac, 0x0a, 0x45, 0xdc, 0x57, 0x21, 0x61, 0xcf, 0xf9, 0xda, 0xa4, 0x42, 0x11, 0x77, 0x55, 0x28,
-	0x92, 0x8e, 0x0a, 0x45, 0xca, 0xaa, 0x50, 0xc4, 0x0b, 0x2a, 0x14, 0x69, 0x52, 0xa1, 0x48, 0x58, 0x15, 0x8a, 0xb8,
-	0x55, 0x21, 0xc1, 0xdf, 0x33, 0x84, 0x2a, 0x14, 0x21, 0xab, 0x42, 0x09, 0x77, 0x55, 0x48, 0xd8, 0x4b, 0xb6, 0x28,
-	0xa9, 0x50, 0xc4, 0x5d, 0x15, 0x8a, 0xa4, 0xa3, 0x42, 0x91, 0xb2, 0x2a, 0x14, 0xf1, 0x82, 0x0a, 0x45, 0x9a, 0x54,
-	0x28, 0x12, 0xa4, 0x42, 0x91, 0x30, 0x2a, 0x24, 0x30, 0xaa, 0x90, 0x40, 0xa8, 0x42, 0x02, 0x65, 0x2a, 0x14, 0x31,
-	0x52, 0xa1, 0x48, 0x78, 0x2a, 0x24, 0xdc, 0x81, 0x7b, 0x12, 0xa9, 0x50, 0xc4, 0x5d, 0x15, 0x8a, 0x64, 0xb9, 0x67,
-	0x92, 0x0a, 0x45, 0xbc, 0xa0, 0x42, 0x91, 0x26, 0x15, 0x8a, 0x04, 0xa9, 0x50, 0x24, 0x8c, 0x0a, 0x09, 0xfc, 0xcc,
-	0x01, 0x79, 0xe4, 0x52, 0xb5, 0x03, 0x15, 0x0c, 0xe1, 0xa9, 0x50, 0x77, 0x6b, 0xd4, 0xa0, 0x00, 0xd8, 0xbe, 0x1d,
-	0x50, 0xab, 0x3f, 0x82, 0x92, 0xfa, 0x74, 0x38, 0x6a, 0x4f, 0x00, 0xac, 0xf2, 0x04, 0xd4, 0xd7, 0x9d, 0x8e, 0x3b,
-	0xb7, 0xd7, 0x24, 0xcd, 0x09, 0xa8, 0xab, 0x38, 0x81, 0x72, 0xf4, 0x26, 0x10, 0x56, 0x6d, 0x02, 0x5a, 0xd0, 0x9a,
-	0x40, 0x92, 0xd2, 0x04, 0xd8, 0xea, 0x4c, 0x40, 0xad, 0xca, 0x74, 0xe8, 0x7b, 0x0b, 0xa0, 0xc2, 0x04, 0xc0, 0xea,
-	0x8b, 0xa0, 0xae, 0xba, 0x74, 0xdc, 0xa5, 0xb5, 0x1a, 0x29, 0x4b, 0x40, 0x5d, 0x5d, 0x09, 0x94, 0xa3, 0x2a, 0x81,
-	0xb0, 0x9a, 0x12, 0xd0, 0x82, 0xa2, 0x04, 0x92, 0xf4, 0x24, 0xc0, 0xa4, 0x26, 0x01, 0x36, 0x5a, 0xd2, 0x1d, 0xa2,
-	0x92, 0x74, 0x00, 0xea, 0x48, 0x07, 0x64, 0x2a, 0x12, 0x10, 0xd2, 0x90, 0x00, 0x7b, 0x0a, 0xd2, 0x31, 0x07, 0xdb,
-	0x07, 0x48, 0x3d, 0x02, 0xea, 0x6a, 0x47, 0xa0, 0x4a, 0xbd, 0x89, 0x74, 0x23, 0xa0, 0x05, 0xd5, 0x08, 0x24, 0x69,
-	0x46, 0x80, 0x49, 0x31, 0x02, 0x6c, 0xf4, 0xa2, 0x3b, 0x7c, 0xb6, 0xa1, 0x75, 0xb4, 0x25, 0x6a, 0x02, 0xdc, 0x26,
-	0x7b, 0x2a, 0x11, 0x82, 0x19, 0x65, 0x42, 0x10, 0xdb, 0x1f, 0x05, 0xb6, 0x42, 0x11, 0x61, 0x52, 0x8a, 0x40, 0xa0,
-	0x54, 0x08, 0x62, 0xb5, 0x42, 0x60, 0x5f, 0x2c, 0x02, 0x79, 0x4e, 0xd7, 0x25, 0xb9, 0x10, 0xd8, 0xd5, 0x0b, 0xe1,
-	0x1c, 0xc1, 0x10, 0xc6, 0x2a, 0x86, 0xc0, 0x05, 0xc9, 0x10, 0x96, 0x34, 0x43, 0x70, 0x2b, 0x1a, 0x02, 0x5b, 0xd5,
-	0x08, 0xc7, 0xef, 0x09, 0x41, 0xdd, 0x10, 0xc4, 0x0a, 0x47, 0x84, 0x5d, 0xe5, 0x08, 0xe4, 0x25, 0xd9, 0x90, 0xb4,
-	0x43, 0x60, 0x57, 0x3c, 0x84, 0x73, 0xd4, 0x43, 0x18, 0x2b, 0x1f, 0x02, 0x17, 0xf4, 0x43, 0x58, 0x12, 0x10, 0xc1,
-	0x49, 0x41, 0x04, 0x37, 0x12, 0x12, 0x50, 0xd4, 0x90, 0x80, 0xa0, 0x88, 0x04, 0x24, 0x53, 0x11, 0x81, 0x48, 0x46,
-	0x04, 0xf7, 0x74, 0x24, 0x50, 0x07, 0xea, 0x26, 0xa4, 0x24, 0x02, 0xbb, 0x52, 0x22, 0x5c, 0xb1, 0xcf, 0x91, 0x98,
-	0x08, 0x5c, 0x50, 0x13, 0x61, 0x49, 0x4e, 0x04, 0x27, 0x3d, 0x11, 0xdc, 0x08, 0x4a, 0x40, 0x9f, 0x29, 0xea, 0x8e,
-	0x54, 0xa6, 0x66, 0xc4, 0x6f, 0xbd, 0xa3, 0x2a, 0x3f, 0xf5, 0x5e, 0x65, 0x07, 0xe6, 0xc4, 0x9f, 0xe2, 0x26, 0x02,
-	0x44, 0x3c, 0x1b, 0xfe, 0x04, 0x49, 0x64, 0x04, 0x8d, 0xe5, 0x7e, 0x4a, 0xab, 0x31, 0x84, 0xac, 0x45, 0x7e, 0x12,
-	0x15, 0x44, 0x40, 0x3a, 0xa5, 0x22, 0x4d, 0xbf, 0x19, 0xe8, 0x41, 0x8c, 0x19, 0x45, 0xb0, 0x96, 0x00, 0x43, 0x10,
-	0x29, 0x28, 0xb5, 0x04, 0x24, 0x77, 0x2d, 0x10, 0xb1, 0xfa, 0x00, 0xc5, 0xea, 0x03, 0x14, 0xaa, 0x1f, 0x81, 0xd7,
-	0xad, 0x91, 0x47, 0x7a, 0x60, 0x14, 0xf1, 0x75, 0x32, 0x32, 0x20, 0x9e, 0x3c, 0xbe, 0x46, 0x23, 0x03, 0x68, 0x44,
-	0xf1, 0xb5, 0x1a, 0x19, 0xa0, 0x58, 0x4b, 0x80, 0x42, 0x2d, 0x01, 0x30, 0xca, 0xf7, 0xba, 0xed, 0xc2, 0x7a, 0x70,
-	0x85, 0x07, 0x4d, 0xc7, 0x9d, 0xea, 0x81, 0xb4, 0x08, 0x10, 0xad, 0xa8, 0x82, 0xe1, 0xd7, 0x6a, 0x92, 0x0f, 0x5f,
-	0xc7, 0x1f, 0x98, 0x51, 0x24, 0xe8, 0x27, 0x5a, 0x4b, 0x10, 0x6b, 0x32, 0x81, 0xad, 0xdd, 0x04, 0x76, 0x8d, 0x27,
-	0x9c, 0x63, 0x41, 0x61, 0xac, 0x19, 0x05, 0x26, 0x5b, 0x0a, 0x4e, 0x06, 0x15, 0xdc, 0x58, 0x55, 0x50, 0x6b, 0xda,
-	0x00, 0x2f, 0x08, 0xb9, 0x22, 0x04, 0x2d, 0x2d, 0x88, 0x35, 0xb7, 0xc0, 0x8e, 0xcd, 0x03, 0x63, 0x0d, 0x1f, 0x50,
-	0xb6, 0x7e, 0xf7, 0x96, 0x6c, 0x66, 0xfd, 0x80, 0x90, 0xf5, 0x03, 0x4c, 0xd6, 0x0f, 0xb0, 0x6f, 0xfd, 0xc0, 0x79,
-	0xd6, 0x0f, 0x0c, 0x59, 0x3f, 0xc0, 0x6c, 0xfd, 0x80, 0xb3, 0xf5, 0x03, 0x6e, 0xad, 0x1f, 0x50, 0xb2, 0x7e, 0x07,
-	0x2f, 0x08, 0xb9, 0x22, 0x24, 0xb3, 0x7e, 0x40, 0xc8, 0xfa, 0x01, 0xf6, 0xac, 0xdf, 0x31, 0x64, 0xfd, 0x0e, 0xb5,
-	0xd6, 0xff, 0xa5, 0x35, 0xfc, 0x4c, 0x0f, 0xe4, 0x2e, 0x80, 0x88, 0xb9, 0x01, 0x41, 0x4b, 0x03, 0xac, 0x35, 0x01,
-	0x50, 0xec, 0x0b, 0x48, 0x34, 0x2d, 0x40, 0xd1, 0xaa, 0x00, 0x05, 0x83, 0x02, 0x20, 0xb6, 0x54, 0x64, 0xd9, 0xbe,
-	0x16, 0x9e, 0x0e, 0xa4, 0xde, 0x80, 0x48, 0xbd, 0x01, 0xc1, 0x7a, 0x03, 0xac, 0xf5, 0x06, 0x50, 0xea, 0x0d, 0x48,
-	0xac, 0x37, 0x40, 0xb1, 0xde, 0x00, 0x85, 0x7a, 0x03, 0x20, 0xf5, 0x56, 0x44, 0xfc, 0xd2, 0xfd, 0xec, 0x5d, 0x40,
-	0xa2, 0x4f, 0x12, 0xf4, 0x5b, 0xeb, 0x94, 0x4a, 0x0f, 0x4c, 0xe3, 0x7e, 0x4b, 0x4e, 0x01, 0xc4, 0x6b, 0xdc, 0x6f,
-	0xe8, 0x14, 0x00, 0x4d, 0xe3, 0x7e, 0x53, 0xa7, 0x00, 0x64, 0x1b, 0xf7, 0x5b, 0x74, 0x0a, 0x00, 0xa6, 0x71, 0xbf,
-	0xc5, 0xc6, 0x29, 0x10, 0xdb, 0xa6, 0xc8, 0x21, 0x3b, 0xa0, 0xa6, 0x1d, 0xfc, 0x86, 0x1c, 0xbc, 0x86, 0x1c, 0xa8,
-	0x21, 0x66, 0x72, 0x04, 0x04, 0xb7, 0xf0, 0xc0, 0x2d, 0x3c, 0xe4, 0x2d, 0x7c, 0xd3, 0x2e, 0x2c, 0x86, 0x7a, 0x60,
-	0xa6, 0x29, 0x6f, 0xf2, 0xe5, 0x04, 0xc0, 0x3c, 0x29, 0x79, 0x93, 0x16, 0x11, 0x80, 0xf8, 0x33, 0xb9, 0x37, 0xba,
-	0x74, 0x00, 0x48, 0x56, 0x0d, 0x80, 0x98, 0xb9, 0xc9, 0x9b, 0x5e, 0x3b, 0x97, 0x18, 0xa7, 0x83, 0x38, 0x37, 0x51,
-	0x44, 0x96, 0x09, 0x88, 0xe0, 0x6c, 0x45, 0x61, 0x98, 0xad, 0x00, 0x98, 0xde, 0xc9, 0x44, 0x34, 0xce, 0x61, 0x14,
-	0x49, 0x53, 0x15, 0x85, 0xd2, 0x54, 0x25, 0x41, 0xdb, 0xa6, 0xde, 0x7a, 0x10, 0xed, 0xaa, 0x48, 0x66, 0x57, 0x85,
-	0xc1, 0xae, 0x0a, 0x46, 0xbb, 0x2a, 0x62, 0xec, 0xaa, 0x44, 0xb2, 0xab, 0x42, 0xd1, 0xae, 0x8a, 0x44, 0xbb, 0x26,
-	0xe4, 0x80, 0x46, 0xb6, 0x53, 0xfc, 0x37, 0xfe, 0xec, 0xfe, 0x8d, 0x37, 0xb1, 0x7f, 0x43, 0x73, 0xfa, 0x37, 0xa5,
-	0xe9, 0xfc, 0x1b, 0x9e, 0xc9, 0xbf, 0xe1, 0x49, 0xfc, 0x1b, 0x3b, 0x7f, 0x7f, 0xd3, 0x4e, 0xcb, 0x47, 0x7a, 0x60,
-	0x86, 0xd0, 0x37, 0x38, 0x19, 0x4f, 0x20, 0xae, 0x13, 0x31, 0xe0, 0x33, 0xdc, 0x36, 0x3b, 0x23, 0x5d, 0x0b, 0x64,
-	0x25, 0x1c, 0x63, 0x64, 0xbc, 0xb5, 0x4b, 0x46, 0x16, 0x4c, 0x94, 0x95, 0x21, 0x6b, 0x65, 0xac, 0xed, 0x3d, 0x19,
-	0x69, 0x3b, 0x12, 0x92, 0x18, 0xdb, 0x19, 0x6e, 0xbb, 0x57, 0x46, 0xda, 0x9e, 0x96, 0x93, 0x5e, 0xa7, 0xcb, 0x4a,
-	0x38, 0xfd, 0x2f, 0xe7, 0x9d, 0xae, 0x98, 0x15, 0xb0, 0xbd, 0x32, 0x23, 0xa9, 0x83, 0x66, 0x2c, 0xf5, 0x55, 0x64,
-	0xb1, 0xdb, 0x66, 0xb8, 0xed, 0xc1, 0x19, 0xe9, 0x76, 0xe6, 0xac, 0x84, 0xd3, 0xaf, 0x33, 0xde, 0x76, 0xf1, 0x8c,
-	0x2c, 0xf4, 0xf6, 0xac, 0x0c, 0x75, 0xfc, 0x8c, 0xb5, 0x1a, 0x90, 0x91, 0x56, 0x0e, 0x90, 0x3c, 0x14, 0xa2, 0x86,
-	0x44, 0x22, 0x23, 0xbf, 0xdb, 0x5b, 0x3c, 0xe9, 0xc8, 0xf8, 0x53, 0xbd, 0xa5, 0x24, 0x28, 0x59, 0x99, 0x93, 0xbd,
-	0x85, 0x65, 0x26, 0x63, 0x8d, 0xe2, 0x20, 0x57, 0x17, 0x54, 0x85, 0x74, 0x28, 0x23, 0x59, 0x92, 0xde, 0x62, 0x96,
-	0xeb, 0x2d, 0x25, 0xb8, 0xde, 0x16, 0x72, 0x5b, 0x6f, 0xdb, 0xb9, 0x75, 0xca, 0xd2, 0xbc, 0x6d, 0xe7, 0xd5, 0xb3,
-	0x74, 0xd0, 0xe6, 0x7c, 0x2a, 0x3d, 0x8a, 0xfd, 0x17, 0x20, 0xe8, 0x76, 0x8a, 0xe6, 0x3f, 0x18, 0x71, 0x36, 0x18,
-	0xe5, 0x0c, 0xc3, 0x90, 0x17, 0x79, 0x4b, 0x29, 0x91, 0xb7, 0x5e, 0x36, 0xe4, 0x2d, 0xbd, 0x38, 0x18, 0x11, 0xdb,
-	0xee, 0x53, 0x2f, 0x0e, 0xbe, 0x4d, 0xaf, 0xd7, 0xa9, 0x05, 0xd2, 0xfb, 0x75, 0xb3, 0x1c, 0xc9, 0x6c, 0x61, 0xde,
-	0xaf, 0xb3, 0xb8, 0x67, 0x95, 0x40, 0x15, 0x4d, 0x03, 0x74, 0x81, 0xab, 0xa9, 0xf5, 0x64, 0xa9, 0xe2, 0xcb, 0x69,
-	0xd9, 0xc7, 0x30, 0xd0, 0x68, 0x19, 0x6e, 0x4d, 0x97, 0x93, 0xae, 0x01, 0x11, 0xcd, 0xcc, 0x88, 0x04, 0x1a, 0x13,
-	0xf1, 0xcc, 0xa4, 0x19, 0x41, 0x86, 0xcd, 0x58, 0xcf, 0xbc, 0x58, 0xa0, 0x68, 0x64, 0x2a, 0x74, 0xb2, 0x44, 0x5d,
-	0xb0, 0x1f, 0x99, 0xbd, 0xd0, 0x33, 0x13, 0x1f, 0xb4, 0x12, 0xcd, 0x2e, 0x88, 0x35, 0x78, 0x84, 0x5d, 0x53, 0x07,
-	0x32, 0x33, 0x72, 0x80, 0xd0, 0xbc, 0x01, 0xc9, 0x0c, 0x2b, 0x10, 0x99, 0x54, 0x70, 0xcf, 0x98, 0x81, 0x2a, 0x9a,
-	0x11, 0xe8, 0x02, 0x57, 0x53, 0xeb, 0xc9, 0x68, 0x02, 0xb3, 0xb9, 0xce, 0xdb, 0x95, 0xdc, 0x58, 0x0f, 0x4c, 0x8e,
-	0xfd, 0x3c, 0xad, 0xe4, 0x00, 0xf1, 0x12, 0xee, 0xe7, 0xb8, 0x92, 0x03, 0xd0, 0xa4, 0xd9, 0xcf, 0x75, 0x25, 0x07,
-	0x90, 0x4d, 0x9f, 0x9f, 0xc7, 0x95, 0x1c, 0x00, 0x32, 0xca, 0x29, 0x72, 0xa1, 0x6a, 0x7c, 0x9e, 0x9c, 0x8b, 0x08,
-	0xfa, 0x55, 0xf1, 0x05, 0x5e, 0xe3, 0x0a, 0x0f, 0x3e, 0xe2, 0x01, 0xe4, 0x37, 0xce, 0x29, 0xb5, 0x71, 0xee, 0x65,
-	0x35, 0xce, 0xe3, 0xda, 0x52, 0xef, 0x15, 0xd7, 0x96, 0x09, 0x09, 0xd7, 0x41, 0x8b, 0x0b, 0x62, 0xcd, 0x2e, 0xb0,
-	0xb5, 0xbd, 0xc0, 0xae, 0x03, 0x84, 0x73, 0xbc, 0x20, 0x8c, 0x75, 0x85, 0xc0, 0xe4, 0x0f, 0xc1, 0xc9, 0x29, 0x82,
-	0x1b, 0xcf, 0x08, 0x6a, 0xdd, 0x93, 0x46, 0x0c, 0xd3, 0x76, 0x72, 0x94, 0x37, 0x62, 0x18, 0x72, 0x41, 0xd7, 0xbd,
-	0x22, 0xe4, 0x23, 0x21, 0xe8, 0xc1, 0x7c, 0x04, 0xb1, 0xb0, 0xe3, 0xcb, 0xc0, 0x58, 0x87, 0x06, 0x94, 0xbc, 0x0a,
-	0xee, 0x40, 0xd7, 0x22, 0x6c, 0xfd, 0x8b, 0x9c, 0x75, 0x32, 0x72, 0xae, 0xa7, 0xb1, 0x80, 0xe3, 0x6e, 0xa4, 0xad,
-	0xcf, 0x91, 0x23, 0xc7, 0x23, 0x49, 0xde, 0x47, 0xd2, 0x84, 0x00, 0x52, 0x36, 0x0e, 0xf2, 0x37, 0xee, 0x3c, 0x93,
-	0x51, 0x44, 0x14, 0xdf, 0xb8, 0xf3, 0x4a, 0x2c, 0xfc, 0x7b, 0x5d, 0xf9, 0xf0, 0x47, 0x1f, 0xc6, 0x50, 0x71, 0x5e,
-	0x40, 0x73, 0x39, 0x27, 0x68, 0x80, 0xb6, 0x91, 0x03, 0x14, 0x85, 0x4f, 0xba, 0x12, 0x06, 0x8f, 0x82, 0x36, 0x74,
-	0x94, 0xb1, 0x81, 0xa3, 0x8c, 0x1b, 0x36, 0x4a, 0x3b, 0x41, 0xa3, 0xa4, 0x0d, 0x19, 0x65, 0x28, 0x60, 0x94, 0xa2,
-	0x70, 0x51, 0xca, 0x04, 0x8b, 0x12, 0x36, 0x54, 0xf0, 0xc5, 0x23, 0x36, 0x0e, 0x85, 0x49, 0xe1, 0xc5, 0x23, 0xe6,
-	0x17, 0xde, 0x3d, 0xae, 0x3c, 0xf0, 0xa3, 0x07, 0x62, 0x70, 0xd0, 0x7b, 0x39, 0x0e, 0xe3, 0x04, 0x46, 0x82, 0x6c,
-	0x58, 0x24, 0x82, 0x82, 0x22, 0x78, 0x01, 0x23, 0x42, 0x10, 0x1b, 0x0e, 0x02, 0xdb, 0x58, 0x10, 0xd8, 0x0d, 0x04,
-	0xe1, 0x9c, 0x28, 0x10, 0xc6, 0x86, 0x80, 0xc0, 0xe4, 0x7f, 0xc1, 0xc9, 0xf9, 0x82, 0x1b, 0xcf, 0x0b, 0x6a, 0xdd,
-	0x9e, 0x5e, 0xde, 0x30, 0x6d, 0x27, 0x87, 0x7b, 0x2f, 0x6f, 0x18, 0x72, 0x41, 0xd7, 0xbd, 0x22, 0xe4, 0x23, 0x21,
-	0xe8, 0xe1, 0xfc, 0x9d, 0x07, 0x0b, 0x3b, 0xbe, 0x0d, 0x8c, 0x75, 0x6c, 0x40, 0xc9, 0xab, 0xd9, 0xca, 0x17, 0x9d,
-	0x9b, 0x13, 0xd6, 0xc7, 0x39, 0x6b, 0x5d, 0x9d, 0xb3, 0xae, 0xc7, 0xf3, 0x22, 0x8e, 0xe3, 0xf3, 0x02, 0xd6, 0xff,
-	0x39, 0x4b, 0x61, 0x90, 0xd3, 0x14, 0x0d, 0x39, 0x6d, 0x82, 0x22, 0x27, 0x6d, 0x6c, 0x64, 0xec, 0x45, 0xc9, 0x90,
-	0x14, 0x29, 0x86, 0x75, 0x03, 0x26, 0x2b, 0xb3, 0x28, 0xdd, 0xf3, 0xaa, 0x44, 0x7c, 0x2c, 0x11, 0x18, 0x4c, 0x39,
-	0x61, 0x63, 0x2a, 0x67, 0x9d, 0xd0, 0xca, 0x0a, 0xd8, 0x08, 0xcb, 0x48, 0x0a, 0x34, 0xf1, 0x11, 0x86, 0x58, 0x84,
-	0x6c, 0x70, 0x45, 0xdc, 0x86, 0x55, 0xc4, 0xdd, 0x80, 0x8a, 0xa4, 0x13, 0x4a, 0x91, 0xb2, 0x41, 0x14, 0x71, 0x0a,
-	0x9f, 0x48, 0x50, 0xe0, 0x44, 0xc2, 0x84, 0x4c, 0x84, 0x6d, 0xb0, 0xe8, 0xeb, 0x19, 0xd6, 0x0c, 0x14, 0x20, 0xee,
-	0xeb, 0x19, 0x96, 0x5d, 0xf0, 0xb5, 0xaf, 0x18, 0xfa, 0xc8, 0x10, 0x86, 0x80, 0x79, 0x9b, 0x81, 0x70, 0xc7, 0xed,
-	0x42, 0x59, 0x87, 0x0b, 0x4c, 0xae, 0x0e, 0x4b, 0x3b, 0xf4, 0xb4, 0x20, 0xd6, 0xd1, 0x02, 0x5b, 0x3f, 0x0b, 0xec,
-	0xba, 0x59, 0x38, 0xc7, 0xcb, 0xc2, 0x58, 0x27, 0x0b, 0x4c, 0x3e, 0x16, 0x9c, 0x5c, 0x2c, 0xb8, 0xf1, 0xb0, 0xa0,
-	0xd6, 0xc1, 0x69, 0x65, 0x6f, 0xda, 0x4e, 0xee, 0xf5, 0x56, 0xf6, 0x86, 0x5c, 0xd0, 0x75, 0xaf, 0x08, 0xf9, 0x48,
-	0x08, 0x7a, 0x36, 0x5f, 0xe9, 0x5b, 0xd8, 0xf1, 0x6b, 0x60, 0xac, 0x5b, 0x03, 0x4a, 0x5e, 0x0d, 0x6d, 0x47, 0xaf,
-	0x0a, 0x62, 0xbd, 0x2a, 0xb0, 0xf5, 0xaa, 0xc0, 0xae, 0x57, 0x85, 0x73, 0xbc, 0x2a, 0x8c, 0xf5, 0xaa, 0xc0, 0xe4,
-	0x55, 0xc1, 0xc9, 0xab, 0x82, 0x1b, 0xaf, 0x0a, 0x6a, 0xbd, 0x9a, 0x36, 0x0d, 0x9a, 0xb6, 0x93, 0x57, 0xbd, 0x4d,
-	0x83, 0x86, 0x5c, 0xd0, 0x75, 0xaf, 0x08, 0xf9, 0x48, 0x08, 0x7a, 0x35, 0xdf, 0x6b, 0x67, 0x61, 0xc7, 0xab, 0x81,
-	0xb1, 0x5e, 0x0d, 0xa8, 0xf5, 0xea, 0xbb, 0xd6, 0xa1, 0xe9, 0x21, 0xfa, 0xbb, 0xe4, 0x4c, 0x84, 0xc4, 0x91, 0x08,
-	0xe5, 0x5b, 0xb6, 0x14, 0xc7, 0x3d, 0x5b, 0x8a, 0xa6, 0x4d, 0x5b, 0x0a, 0xe9, 0xe6, 0x2c, 0xc5, 0x74, 0x77, 0x96,
-	0x62, 0x71, 0x7b, 0x96, 0x22, 0xe2, 0x2c, 0x80, 0x60, 0xc7, 0xc6, 0xbb, 0xb4, 0xab, 0x01, 0x10, 0xb3, 0x2f, 0xee,
-	0x5d, 0xbe, 0xab, 0x01, 0x60, 0xce, 0x45, 0xbd, 0x4b, 0xbb, 0x1a, 0x00, 0xb1, 0x0f, 0x02, 0xde, 0xe9, 0xae, 0x06,
-	0x80, 0xf2, 0x94, 0xff, 0xbb, 0xb4, 0xab, 0x41, 0x91, 0xb8, 0xab, 0xa1, 0x4a, 0x48, 0x46, 0xaf, 0xa8, 0x25, 0xf1,
-	0x19, 0x19, 0x22, 0x6e, 0x4b, 0x56, 0x5e, 0x4b, 0xf0, 0x11, 0x18, 0xa0, 0xd4, 0xbe, 0x15, 0xb7, 0x6f, 0xc5, 0xed,
-	0xdb, 0x62, 0x0c, 0xc5, 0x67, 0x59, 0x80, 0x78, 0x5b, 0x8b, 0xde, 0xe1, 0x53, 0x2b, 0x00, 0xcd, 0x86, 0xa2, 0x77,
-	0xf6, 0xf9, 0x14, 0x10, 0x76, 0x93, 0xd1, 0xbb, 0xf4, 0x24, 0x0a, 0x10, 0xb3, 0x87, 0xe8, 0x9d, 0xee, 0x16, 0x89,
-	0xa6, 0x7e, 0x8f, 0x9b, 0x12, 0xdf, 0xd3, 0xa6, 0xc4, 0xf7, 0xfe, 0xa6, 0xc4, 0xf7, 0xde, 0xa6, 0xc4, 0xf7, 0xb4,
-	0x29, 0xf1, 0x7d, 0x69, 0x53, 0xe2, 0x7b, 0xde, 0x94, 0xf8, 0x9e, 0x37, 0x25, 0xbe, 0xb7, 0x9b, 0x12, 0xdf, 0x4b,
-	0xa4, 0x68, 0xe5, 0xa5, 0x3d, 0x11, 0xf8, 0xd0, 0x3e, 0x82, 0x86, 0x03, 0xb3, 0x41, 0xe4, 0x43, 0xfe, 0xb0, 0x19,
-	0x60, 0xde, 0x20, 0xf2, 0x21, 0x3d, 0x56, 0x06, 0xc4, 0xdf, 0x20, 0xf2, 0x41, 0x1f, 0x20, 0x03, 0x24, 0xde, 0x00,
-	0xc4, 0x6c, 0x78, 0xf9, 0xd0, 0x0a, 0x2b, 0x1c, 0x48, 0x4c, 0x23, 0x82, 0x72, 0xaa, 0xf8, 0x65, 0x76, 0x40, 0x6d,
-	0xbc, 0xf4, 0xdb, 0x78, 0xe9, 0xb5, 0xf1, 0x92, 0xda, 0x78, 0x59, 0x6a, 0xe3, 0x25, 0xb7, 0xf1, 0xd2, 0x6e, 0x82,
-	0xf9, 0x10, 0x3d, 0xa6, 0x00, 0xc8, 0xfe, 0x07, 0xdc, 0xab, 0xf6, 0xa1, 0x95, 0x76, 0x65, 0xae, 0xcd, 0xd8, 0xf9,
-	0x01, 0x05, 0x3d, 0x81, 0xa1, 0x10, 0xfa, 0x58, 0x10, 0x6b, 0x04, 0x81, 0x5d, 0x4b, 0x08, 0xe7, 0x98, 0x43, 0x18,
-	0x6b, 0x13, 0x81, 0x0b, 0x86, 0x11, 0x96, 0xac, 0x23, 0xb8, 0x0d, 0x03, 0x81, 0x6d, 0x2c, 0xa4, 0x9c, 0xac, 0x45,
-	0x6c, 0x54, 0x78, 0x39, 0x59, 0x43, 0x5e, 0x32, 0xe2, 0xdb, 0xc7, 0x8f, 0x14, 0xe1, 0x8a, 0xf6, 0xa1, 0x98, 0x11,
-	0xf8, 0xa4, 0x7d, 0x38, 0x7a, 0x04, 0xa7, 0x10, 0x12, 0xdc, 0xc4, 0x11, 0x65, 0x9b, 0x3f, 0xa4, 0x6c, 0xf3, 0x28,
-	0x47, 0xae, 0xa9, 0x0c, 0xc5, 0x16, 0xe5, 0x96, 0x13, 0x13, 0xac, 0x8d, 0x01, 0x26, 0x88, 0x35, 0xa0, 0xc0, 0xae,
-	0x01, 0x85, 0x73, 0x0c, 0x28, 0x8c, 0x35, 0xa0, 0xc0, 0x05, 0x03, 0x0a, 0x4b, 0x06, 0x14, 0xdc, 0x06, 0x98, 0xc0,
-	0x36, 0xc0, 0x02, 0x7c, 0xc1, 0x88, 0x0d, 0xb0, 0x08, 0xbb, 0x01, 0x16, 0xc8, 0x4b, 0x46, 0x7c, 0xfb, 0xf8, 0x01,
-	0x26, 0x5c, 0xd1, 0x3e, 0x14, 0x60, 0x02, 0x9f, 0xb4, 0x0f, 0x07, 0x98, 0xe0, 0x14, 0x60, 0x82, 0x9b, 0x00, 0x4b,
-	0x9b, 0x9b, 0x4d, 0x2c, 0x60, 0x80, 0xa5, 0xcd, 0xcd, 0xa6, 0x0c, 0x05, 0x18, 0x6d, 0x6e, 0x56, 0x26, 0xdf, 0x2e,
-	0x55, 0xb9, 0x38, 0x19, 0xb3, 0xb4, 0x5d, 0xca, 0x2f, 0xe1, 0x19, 0xd6, 0xd9, 0x2e, 0xe5, 0x93, 0x25, 0x23, 0x7b,
-	0xdb, 0xa5, 0x7c, 0x96, 0x02, 0xd2, 0xd9, 0x2e, 0xe5, 0x92, 0x17, 0x25, 0x9c, 0x42, 0xb4, 0xf8, 0x38, 0xde, 0x2d,
-	0x72, 0x59, 0xc2, 0x4f, 0xd9, 0xb9, 0x10, 0xba, 0x58, 0xe2, 0x3b, 0x76, 0xe6, 0x30, 0x46, 0xf2, 0xbf, 0xb0, 0xb3,
-	0x13, 0xd2, 0xc8, 0x72, 0x60, 0x23, 0x6b, 0xc3, 0x3b, 0xdf, 0x9e, 0xe0, 0xc6, 0x63, 0x16, 0xea, 0xf9, 0xee, 0x04,
-	0xb7, 0x3c, 0x87, 0xbd, 0xbf, 0x37, 0x21, 0xf2, 0x17, 0xed, 0x12, 0x6b, 0xae, 0x07, 0x72, 0x3a, 0x20, 0xb2, 0x40,
-	0x01, 0x04, 0xbd, 0x00, 0xb0, 0x5e, 0x1c, 0x40, 0xb1, 0x37, 0x20, 0xd1, 0x80, 0x00, 0x45, 0xab, 0x01, 0x14, 0x4c,
-	0x05, 0x80, 0x04, 0xa9, 0x22, 0xf0, 0x8a, 0xe0, 0x05, 0xbd, 0x1d, 0x78, 0xe1, 0xbf, 0x18, 0x78, 0xe1, 0xbd, 0x13,
-	0x78, 0x41, 0xaf, 0x03, 0x5e, 0x94, 0xde, 0x04, 0xbc, 0xe0, 0x97, 0x00, 0x2f, 0xe8, 0xfd, 0xbf, 0x0b, 0x7a, 0xf5,
-	0xef, 0xa2, 0x5d, 0x05, 0xce, 0xf4, 0xc0, 0xec, 0xc9, 0xbf, 0x48, 0xab, 0x40, 0x40, 0xbc, 0x3d, 0xf9, 0x17, 0xb8,
-	0x0a, 0x04, 0xd0, 0xec, 0xc9, 0xbf, 0xd0, 0x55, 0x20, 0x40, 0x76, 0x4f, 0xfe, 0x45, 0x5c, 0x05, 0x02, 0x60, 0xf6,
-	0xe4, 0x5f, 0x34, 0x73, 0xfb, 0x4d, 0xde, 0x58, 0x59, 0x16, 0x6a, 0x89, 0x95, 0xbe, 0x8b, 0x77, 0x91, 0x56, 0x85,
-	0x80, 0x88, 0x4e, 0x20, 0x02, 0x2d, 0x03, 0x58, 0x5b, 0x86, 0xa0, 0xae, 0x0a, 0x01, 0x95, 0xf6, 0x02, 0x12, 0xdb,
-	0x0b, 0x50, 0x6c, 0xaf, 0x42, 0x9f, 0xeb, 0xaf, 0x9f, 0x57, 0x8f, 0xb0, 0xd0, 0xba, 0x68, 0x17, 0x8a, 0xda, 0x94,
-	0x2d, 0xf9, 0x65, 0xeb, 0x7b, 0x61, 0xeb, 0x79, 0x61, 0x4b, 0x5e, 0x30, 0x0b, 0x45, 0x20, 0xd8, 0x3d, 0x71, 0xa1,
-	0x08, 0x08, 0x39, 0x23, 0x2e, 0x14, 0x15, 0xd9, 0x65, 0x07, 0x54, 0xfd, 0xec, 0xd7, 0x92, 0x00, 0xdf, 0xaf, 0x1e,
-	0xd6, 0xe4, 0xd9, 0x03, 0x76, 0xae, 0x03, 0xe9, 0xc0, 0xc1, 0xef, 0xf5, 0x07, 0xaf, 0xd7, 0x1f, 0xa8, 0xd7, 0x9b,
-	0x3d, 0x8c, 0x40, 0xb0, 0x1c, 0x1c, 0x58, 0x0e, 0x0e, 0x56, 0x0e, 0x8e, 0xe8, 0xd7, 0x3a, 0x3b, 0xa0, 0x10, 0xac,
-	0x9d, 0xc8, 0x4a, 0x2f, 0x88, 0xcd, 0x0d, 0x62, 0xdb, 0x9d, 0xbf, 0x20, 0x66, 0x61, 0xd7, 0x26, 0xf4, 0x82, 0x98,
-	0x65, 0xac, 0x75, 0xcc, 0x0b, 0x62, 0x16, 0x27, 0x73, 0x64, 0x2f, 0x88, 0x59, 0xd4, 0xea, 0x64, 0x9a, 0x3d, 0x8f,
-	0x0c, 0x62, 0x15, 0xd3, 0x99, 0x3d, 0x5b, 0xce, 0xd1, 0xce, 0x7c, 0xf6, 0x6c, 0xe1, 0x82, 0x8a, 0x9a, 0xd9, 0xb3,
-	0xc5, 0xad, 0x9e, 0xe6, 0xb3, 0x67, 0x03, 0xa3, 0x18, 0x09, 0x62, 0xfb, 0x81, 0xc0, 0x56, 0x63, 0x05, 0x76, 0xbb,
-	0xb8, 0x70, 0x4e, 0x3f, 0x17, 0xc6, 0x76, 0x76, 0x81, 0xa9, 0x63, 0x0b, 0x4e, 0xe2, 0x2b, 0xb8, 0x51, 0x60, 0x41,
-	0x6d, 0xcf, 0x8f, 0x6f, 0xdf, 0x6d, 0x1c, 0x6b, 0x59, 0x41, 0x0e, 0xe8, 0x8a, 0x62, 0x9d, 0xa4, 0x59, 0x60, 0xab,
-	0xcf, 0x11, 0xf6, 0x44, 0x5a, 0xb8, 0x62, 0x7f, 0x72, 0xe5, 0x5a, 0x28, 0xab, 0xd9, 0x02, 0x93, 0x70, 0x0b, 0x4e,
-	0xea, 0x1d, 0x70, 0x96, 0xf0, 0x80, 0x6f, 0xc9, 0x02, 0x24, 0xe6, 0x02, 0x9f, 0x70, 0xb7, 0x27, 0xeb, 0xc2, 0xf8,
-	0xee, 0x2e, 0x09, 0xbc, 0xb0, 0x85, 0x60, 0x20, 0xa9, 0x17, 0xd8, 0xf7, 0x3a, 0x89, 0x7e, 0x80, 0x77, 0x8c, 0xf8,
-	0x0d, 0x2e, 0x8c, 0x01, 0x81, 0xf4, 0x06, 0x82, 0xc0, 0x1c, 0x48, 0x42, 0x68, 0x48, 0x10, 0xf8, 0x84, 0x06, 0x7a,
-	0x83, 0x83, 0x30, 0xbe, 0x06, 0x96, 0x86, 0x09, 0x61, 0x0b, 0x0a, 0xc9, 0x03, 0x86, 0xe0, 0xae, 0x42, 0x1e, 0x29,
-	0xa8, 0x6a, 0x46, 0xfc, 0xce, 0xe2, 0x8e, 0x24, 0x60, 0xde, 0x6c, 0x3c, 0x41, 0x9c, 0x4c, 0x87, 0x24, 0x8d, 0x2d,
-	0x48, 0xfa, 0xd6, 0xc5, 0x12, 0x9e, 0x8d, 0x91, 0x27, 0x4b, 0x23, 0xc9, 0x16, 0x45, 0x96, 0xed, 0x8a, 0xac, 0xb5,
-	0x2e, 0x72, 0x34, 0x0a, 0xe5, 0x4b, 0xec, 0x91, 0x8b, 0xd3, 0x88, 0x54, 0x5a, 0x62, 0xfb, 0x25, 0xbc, 0xd1, 0xc9,
-	0x59, 0x62, 0xfb, 0x64, 0x69, 0xa4, 0xf2, 0x96, 0xd8, 0x3e, 0x4b, 0xa3, 0x96, 0xb3, 0xc4, 0x76, 0xc9, 0x4c, 0xbd,
-	0x11, 0xa7, 0x0e, 0x8d, 0x24, 0x8d, 0x66, 0x48, 0xfa, 0x22, 0x87, 0x25, 0x3c, 0xa9, 0x43, 0x9e, 0x04, 0x0f, 0x49,
-	0x16, 0x36, 0x64, 0x79, 0xac, 0x43, 0xd6, 0x8e, 0x78, 0xc8, 0x91, 0x02, 0x02, 0x49, 0x32, 0x95, 0x71, 0x66, 0x0c,
-	0xc4, 0xf7, 0x9f, 0x0a, 0x7d, 0x95, 0xc7, 0x43, 0x24, 0x69, 0x54, 0xcc, 0x48, 0x77, 0x6c, 0xc4, 0x12, 0xdf, 0xd1,
-	0x09, 0x7f, 0x9c, 0xc4, 0x02, 0x34, 0x5a, 0x22, 0xc9, 0x63, 0x26, 0xb2, 0x3c, 0x72, 0x02, 0xeb, 0x8c, 0x9f, 0xf8,
-	0x6a, 0x54, 0xc1, 0x86, 0x3c, 0x96, 0x22, 0xf9, 0xdd, 0x60, 0x73, 0xc7, 0x55, 0xe4, 0x4f, 0x05, 0x5b, 0x71, 0x8c,
-	0xc5, 0x32, 0x27, 0x03, 0x92, 0xc7, 0x5b, 0x24, 0x4f, 0xc5, 0x1c, 0x8f, 0xbd, 0x40, 0xee, 0x4a, 0xf8, 0x29, 0x63,
-	0x95, 0x46, 0x63, 0x40, 0xdd, 0x31, 0x19, 0xf8, 0x43, 0x41, 0x56, 0x79, 0x7c, 0x46, 0xf2, 0xbb, 0xe3, 0x88, 0x3b,
-	0x56, 0x23, 0x7f, 0x6a, 0x1c, 0x29, 0x8e, 0xdb, 0x58, 0xe6, 0xe4, 0x58, 0xe3, 0x8c, 0xe1, 0xc8, 0x9e, 0x18, 0x6b,
-	0x8e, 0x85, 0x50, 0xaf, 0x4b, 0xf8, 0xa9, 0x8e, 0xef, 0x8c, 0xf0, 0x97, 0xb8, 0xab, 0xe4, 0x92, 0x36, 0x94, 0x5c,
-	0xd2, 0x5e, 0x92, 0x4b, 0x7f, 0x1b, 0xc9, 0xa5, 0xb7, 0x83, 0xe4, 0x92, 0x36, 0x8f, 0x5c, 0xf2, 0xbe, 0x91, 0x4b,
-	0xde, 0x32, 0x72, 0x69, 0x77, 0x8b, 0x5c, 0xd2, 0x46, 0x91, 0x4b, 0xfb, 0xc1, 0x88, 0x4b, 0xfa, 0x56, 0xc4, 0x25,
-	0xbd, 0x5f, 0x11, 0x11, 0xdb, 0x48, 0xff, 0xfd, 0x8a, 0x08, 0xbb, 0xcd, 0x2d, 0xbe, 0x5f, 0x11, 0x19, 0xdb, 0xf0,
-	0xc2, 0xfb, 0x15, 0x11, 0x27, 0x13, 0xb8, 0xef, 0x57, 0x44, 0xd4, 0x1a, 0x23, 0x7b, 0x41, 0xc1, 0xb4, 0x9f, 0xcc,
-	0xe2, 0xbf, 0xa0, 0x90, 0xc1, 0xd6, 0x40, 0x27, 0x5e, 0x50, 0xc8, 0x38, 0xd7, 0x54, 0xa7, 0x5f, 0x50, 0xc8, 0x68,
-	0x6b, 0xb4, 0x53, 0x2f, 0x28, 0x64, 0x24, 0x99, 0xaf, 0xfc, 0x82, 0x42, 0x46, 0x59, 0x43, 0xf2, 0xa6, 0x7d, 0xcf,
-	0x6c, 0x64, 0x52, 0x6f, 0xd3, 0x3e, 0x80, 0xd6, 0x9c, 0xc5, 0x4d, 0xfb, 0xc0, 0xb8, 0xa6, 0x3c, 0xb5, 0x69, 0x1f,
-	0x48, 0x6b, 0xc6, 0xf2, 0xa6, 0x7d, 0xa0, 0xc8, 0x84, 0xa5, 0x4d, 0xfb, 0x40, 0x58, 0xf3, 0xd9, 0xad, 0xed, 0x6c,
-	0x20, 0x32, 0x1d, 0x6d, 0x6d, 0x8f, 0x88, 0x35, 0x9a, 0xbf, 0xb5, 0x3d, 0xc2, 0xae, 0xb9, 0x8a, 0x5b, 0xdb, 0x23,
-	0x63, 0x0d, 0x55, 0xd8, 0xda, 0x1e, 0x71, 0x32, 0x91, 0xbb, 0xb5, 0x3d, 0xa2, 0xd6, 0x38, 0xd9, 0xde, 0x70, 0xd3,
-	0x7e, 0x32, 0x4b, 0x69, 0x6f, 0xb8, 0x21, 0xac, 0x91, 0x4e, 0xee, 0x0d, 0x37, 0xac, 0x6b, 0xb2, 0xef, 0xed, 0x0d,
-	0x37, 0x05, 0xac, 0x01, 0x4f, 0xef, 0x0d, 0x37, 0x34, 0x99, 0xf3, 0xd4, 0xde, 0x70, 0x43, 0x5a, 0xe3, 0x7a, 0xbb,
-	0xa3, 0x7d, 0x63, 0x92, 0xa9, 0x79, 0x77, 0x74, 0x82, 0xac, 0x79, 0x0b, 0xbb, 0xa3, 0x13, 0xee, 0x9a, 0xb4, 0xbc,
-	0x3b, 0x3a, 0x51, 0xd6, 0x8c, 0xa5, 0xdd, 0xd1, 0x89, 0x20, 0xd3, 0xf9, 0xbb, 0xa3, 0x13, 0x6c, 0xcd, 0x95, 0xef,
-	0x2a, 0xb6, 0xa6, 0x20, 0x13, 0xc9, 0xed, 0xd0, 0x44, 0x11, 0xb2, 0x26, 0x8a, 0xb8, 0x35, 0x51, 0xc4, 0x5d, 0x13,
-	0x45, 0xd2, 0x31, 0x51, 0xa4, 0xac, 0x89, 0x22, 0x4e, 0x26, 0x8a, 0x04, 0x99, 0x28, 0x12, 0xc6, 0x44, 0x11, 0xb6,
-	0x26, 0x12, 0xdc, 0x9a, 0x48, 0x60, 0x32, 0x51, 0x77, 0x55, 0x34, 0x50, 0x00, 0xac, 0x79, 0x02, 0x6a, 0x8d, 0x13,
-	0x50, 0xd7, 0x34, 0x81, 0x72, 0x0c, 0x13, 0x08, 0x6b, 0x96, 0x80, 0x92, 0x51, 0x02, 0x4c, 0x26, 0x09, 0xb0, 0x31,
-	0x48, 0x00, 0xad, 0x39, 0x3a, 0xd4, 0x1a, 0xa3, 0x03, 0xad, 0x29, 0x16, 0xf8, 0x8d, 0xae, 0x05, 0x7d, 0xa3, 0x6b,
-	0x41, 0xdf, 0xe8, 0x5a, 0xf4, 0xdc, 0x6f, 0x74, 0x2d, 0xbc, 0x6f, 0x74, 0x2d, 0xe8, 0x1b, 0x5d, 0x0b, 0xfe, 0x46,
-	0xd7, 0x82, 0xbf, 0xd1, 0xb5, 0xb0, 0xdf, 0xe8, 0x5a, 0xd0, 0x37, 0xba, 0x16, 0xf8, 0x75, 0xd7, 0x05, 0x7d, 0xd8,
-	0x75, 0x51, 0xf8, 0xa6, 0xeb, 0xa2, 0x4d, 0xf9, 0xc0, 0x81, 0xf1, 0xf8, 0x22, 0x4f, 0xee, 0x00, 0xcc, 0x3e, 0x5d,
-	0xa4, 0x34, 0x0e, 0x20, 0xfe, 0x37, 0x48, 0x17, 0x9a, 0xb0, 0x01, 0x48, 0xd6, 0x82, 0x80, 0x18, 0x37, 0x2e, 0xda,
-	0x7c, 0xcc, 0x44, 0x0f, 0xcc, 0x6a, 0x61, 0x91, 0x32, 0x2f, 0x80, 0x78, 0x09, 0x81, 0x05, 0xe6, 0x58, 0x00, 0x34,
-	0x2b, 0xfb, 0x85, 0x66, 0x53, 0x00, 0xb2, 0x6b, 0xf8, 0x45, 0xcc, 0x9b, 0x00, 0x20, 0xf5, 0x56, 0xc4, 0x2c, 0x1a,
-	0x17, 0xb4, 0x85, 0x77, 0xd1, 0xcb, 0xda, 0xb9, 0x22, 0x3f, 0xc4, 0xb4, 0x07, 0x22, 0xae, 0x67, 0x56, 0x9e, 0x67,
-	0x30, 0xab, 0x01, 0x28, 0xf9, 0x6b, 0xc5, 0x6e, 0x59, 0xd9, 0x7e, 0xb7, 0x48, 0x99, 0x0a, 0x8d, 0xbd, 0xad, 0x2e,
-	0x00, 0x17, 0x29, 0x25, 0x01, 0x88, 0xb7, 0xc4, 0x5d, 0x60, 0xf2, 0x01, 0x40, 0xb3, 0x98, 0x5d, 0xd8, 0x34, 0x03,
-	0x10, 0x76, 0xd9, 0xba, 0x48, 0x09, 0x05, 0x40, 0x4c, 0xbe, 0x73, 0xc1, 0x9b, 0x7a, 0x17, 0xde, 0xc2, 0x7e, 0xd1,
-	0xae, 0xe6, 0xd5, 0x83, 0x07, 0x0a, 0xb6, 0x83, 0x1f, 0x5a, 0x07, 0x2f, 0xb4, 0x0e, 0x14, 0x5a, 0x66, 0x59, 0x0e,
-	0x04, 0xc7, 0xdc, 0x81, 0x63, 0xee, 0x90, 0xc7, 0xdc, 0x55, 0xab, 0x5a, 0x70, 0x60, 0x2a, 0x7b, 0x95, 0x54, 0x0b,
-	0x10, 0xaf, 0xfa, 0x57, 0xa8, 0x5a, 0x00, 0x9a, 0xea, 0x5f, 0xa9, 0x6a, 0x01, 0x64, 0x6b, 0x79, 0x15, 0x55, 0x0b,
-	0x00, 0xd3, 0x33, 0xae, 0x70, 0x53, 0xd7, 0x15, 0xed, 0xe4, 0xba, 0xf2, 0xb7, 0x6f, 0x5d, 0x79, 0x7b, 0xb6, 0xae,
-	0x68, 0xa3, 0xd6, 0x55, 0x69, 0x77, 0xd6, 0x15, 0x6f, 0xc9, 0xba, 0xa2, 0x7d, 0x58, 0x57, 0xb4, 0xf9, 0xea, 0xaa,
-	0x07, 0xaf, 0x45, 0x5c, 0x25, 0xf9, 0x01, 0xc4, 0x7c, 0x2d, 0xf3, 0x2a, 0x97, 0x1f, 0x80, 0x39, 0x1f, 0x7e, 0x95,
-	0xe4, 0x07, 0x10, 0x9b, 0xd5, 0xbe, 0x52, 0xf9, 0x01, 0x28, 0xff, 0x1e, 0xe6, 0x55, 0x92, 0x1f, 0x45, 0x24, 0xb4,
-	0x07, 0x00, 0x64, 0x59, 0xd9, 0xab, 0xee, 0x05, 0x82, 0x71, 0x3a, 0x88, 0x2f, 0x10, 0x28, 0x12, 0x5f, 0x20, 0x00,
-	0xc4, 0xf9, 0xd0, 0xd4, 0x55, 0xf6, 0x02, 0x01, 0x80, 0xf0, 0x02, 0x81, 0xa2, 0xe6, 0x43, 0x53, 0x57, 0xf0, 0x02,
-	0x81, 0x42, 0xe9, 0x05, 0x82, 0x04, 0x45, 0xf5, 0xd1, 0xe6, 0x6d, 0x31, 0xa0, 0xb6, 0x14, 0xfb, 0x5b, 0x3f, 0xd2,
-	0xb7, 0x5e, 0xa4, 0x6f, 0x29, 0xd2, 0xb7, 0x7e, 0x47, 0xbd, 0x52, 0xf5, 0x01, 0x48, 0x62, 0x08, 0x10, 0x0a, 0x78,
-	0x9b, 0xb8, 0xbc, 0x42, 0xf1, 0x51, 0x0f, 0x35, 0xe2, 0x33, 0x4a, 0x4d, 0x8e, 0xe2, 0x03, 0x48, 0x16, 0x58, 0x0a,
-	0x43, 0x60, 0x29, 0x18, 0x03, 0x4b, 0x11, 0xf3, 0x48, 0x45, 0x89, 0x14, 0x71, 0x0a, 0xa5, 0x88, 0x53, 0x48, 0x22,
-	0x2e, 0x01, 0x35, 0x76, 0x92, 0x9a, 0x3a, 0x71, 0xcd, 0xbd, 0xf5, 0xba, 0x7b, 0x7d, 0x68, 0xa0, 0x47, 0xf1, 0x45,
-	0x0a, 0x80, 0xe2, 0xeb, 0x43, 0x00, 0x65, 0x2f, 0x57, 0x00, 0x0e, 0x6f, 0x57, 0x00, 0x1a, 0x5f, 0xaf, 0x00, 0x28,
-	0xbd, 0x46, 0x01, 0x58, 0x7a, 0x8f, 0x02, 0x30, 0x79, 0x91, 0x02, 0x90, 0xf8, 0xfa, 0x90, 0x42, 0xe7, 0xfa, 0xea,
-	0xd4, 0x75, 0x92, 0x2e, 0x40, 0xb0, 0xb2, 0x00, 0xf3, 0x8b, 0x57, 0xd7, 0x49, 0xba, 0x00, 0xc9, 0x5d, 0x04, 0x44,
-	0x6c, 0x02, 0x40, 0x12, 0x76, 0x80, 0x48, 0x6d, 0x15, 0x59, 0xea, 0x08, 0x78, 0x9d, 0xa4, 0x0b, 0x10, 0xf3, 0xa4,
-	0xf3, 0x3a, 0x97, 0x2e, 0x80, 0x79, 0xcc, 0xbe, 0x4e, 0xd2, 0x05, 0x88, 0x1d, 0x9a, 0xaf, 0x55, 0xba, 0x00, 0xca,
-	0x73, 0xc7, 0xd7, 0x49, 0xba, 0x14, 0x91, 0x8e, 0x31, 0x06, 0xe0, 0x21, 0xfb, 0xa4, 0xeb, 0x75, 0x0f, 0x66, 0xc1,
-	0xd7, 0x49, 0xbb, 0x00, 0x11, 0xed, 0x42, 0xc4, 0x99, 0xb0, 0x5f, 0xa3, 0x76, 0x21, 0xa8, 0xda, 0x05, 0xa8, 0x99,
-	0xc6, 0x5f, 0xab, 0x76, 0x01, 0x64, 0xa7, 0xf1, 0xd7, 0xad, 0x52, 0x41, 0xc5, 0xa3, 0x54, 0x21, 0xe4, 0xbe, 0x20,
-	0x77, 0x8d, 0x62, 0x85, 0xa8, 0x7d, 0x41, 0xee, 0xda, 0xca, 0x15, 0x32, 0xf4, 0xea, 0xdc, 0x75, 0x12, 0x2c, 0x84,
-	0xec, 0x7b, 0x72, 0xd7, 0xfc, 0xcd, 0xdc, 0x6b, 0xd4, 0x2c, 0x75, 0xcd, 0x21, 0x2b, 0x72, 0xe0, 0xd6, 0x1d, 0x0a,
-	0xad, 0x3b, 0xb8, 0xad, 0x3b, 0x70, 0xeb, 0x0e, 0xc5, 0xd6, 0x1d, 0x9c, 0xd6, 0x25, 0xe9, 0x42, 0xcc, 0xbc, 0x18,
-	0x78, 0x9d, 0xf2, 0xec, 0xda, 0xb3, 0xf3, 0x44, 0x3b, 0xe1, 0xa4, 0x4b, 0x4e, 0xaa, 0x9d, 0x48, 0x4f, 0xa1, 0xf2,
-	0x64, 0x3b, 0xe1, 0xac, 0x55, 0x26, 0xdd, 0x4e, 0x84, 0x55, 0xad, 0x3c, 0xe1, 0x6e, 0x71, 0xd4, 0xaf, 0xfc, 0xbd,
-	0x20, 0x0b, 0xbb, 0x4a, 0x46, 0xef, 0x05, 0x59, 0xc6, 0x6a, 0x9a, 0xfb, 0x5e, 0x90, 0x65, 0x49, 0xdd, 0xf2, 0xf7,
-	0x82, 0x2c, 0x6c, 0x75, 0x2e, 0xc0, 0x28, 0x76, 0x82, 0x58, 0xc5, 0x13, 0xd8, 0xca, 0x9e, 0xc0, 0xae, 0xf6, 0x09,
-	0xe7, 0x08, 0xa0, 0x30, 0x56, 0x05, 0x05, 0x26, 0x29, 0x14, 0x9c, 0xf4, 0x50, 0x70, 0x23, 0x8a, 0x82, 0x5a, 0x65,
-	0x8c, 0x4f, 0x4d, 0xf2, 0x3e, 0x98, 0x3d, 0x4b, 0xb1, 0x41, 0x8e, 0x82, 0x25, 0x88, 0x55, 0x4b, 0x81, 0xad, 0x64,
-	0x46, 0xd8, 0xd3, 0x4d, 0xe1, 0x1c, 0xf1, 0x8c, 0x8c, 0xa3, 0xa0, 0x42, 0x59, 0x19, 0x15, 0x98, 0xb4, 0x54, 0x70,
-	0x12, 0xd4, 0x80, 0x6f, 0xb9, 0xa9, 0x2c, 0xad, 0x82, 0xfb, 0x0a, 0x24, 0xa4, 0x27, 0x43, 0x42, 0x91, 0x16, 0x09,
-	0x5e, 0x12, 0x24, 0xa1, 0x59, 0x95, 0x84, 0x20, 0xe1, 0x15, 0x9c, 0xd4, 0x37, 0x7f, 0x0e, 0x66, 0x71, 0x4f, 0x87,
-	0x03, 0x73, 0xe0, 0xc2, 0xac, 0xc8, 0x82, 0x9f, 0x32, 0x8a, 0xab, 0xcd, 0x42, 0x15, 0x8c, 0x52, 0x54, 0x69, 0xa1,
-	0x4b, 0x46, 0x71, 0xf4, 0x5a, 0x08, 0x2b, 0xda, 0xf8, 0xc8, 0x4a, 0x65, 0x8d, 0x9e, 0x59, 0x79, 0x14, 0xa9, 0xb7,
-	0xff, 0xd4, 0xca, 0xe3, 0x3d, 0x0d, 0xa7, 0xe7, 0x56, 0x1e, 0xc5, 0x4a, 0xce, 0x4f, 0xae, 0x3c, 0xce, 0xea, 0x39,
-	0x3d, 0xbb, 0x72, 0x28, 0x54, 0x75, 0x05, 0xad, 0xb0, 0x2b, 0xe3, 0x6a, 0xbb, 0xd2, 0x8e, 0xbc, 0x2b, 0x69, 0x15,
-	0x5e, 0x99, 0x82, 0xc8, 0x6b, 0x01, 0xd2, 0x79, 0xa5, 0xac, 0xd4, 0x2b, 0x63, 0xd5, 0x3e, 0x31, 0x28, 0xf8, 0x0a,
-	0x5a, 0xcd, 0x57, 0xc6, 0xca, 0xbe, 0x32, 0xae, 0xf2, 0x2b, 0xed, 0x88, 0xbf, 0x92, 0x56, 0xff, 0x95, 0xa1, 0x21,
-	0x40, 0x29, 0x1a, 0x05, 0x94, 0x32, 0x03, 0x81, 0x12, 0x76, 0x2c, 0x80, 0x27, 0x97, 0xb9, 0x14, 0xd8, 0x47, 0x9a,
-	0x4e, 0x0f, 0x42, 0xf9, 0x55, 0xd0, 0x8e, 0x0b, 0xca, 0xd8, 0xa1, 0x01, 0x18, 0x6f, 0x74, 0x50, 0xda, 0x19, 0x20,
-	0x80, 0x74, 0xc6, 0x08, 0x65, 0xed, 0x30, 0xa1, 0x0c, 0x8d, 0x14, 0x4a, 0xd1, 0x60, 0x91, 0xa8, 0xad, 0x6b, 0x08,
-	0x1e, 0x32, 0x94, 0xf2, 0x05, 0x52, 0x79, 0x4f, 0x23, 0x95, 0x25, 0x99, 0x54, 0xaa, 0xa4, 0x94, 0x5a, 0x82, 0xc5,
-	0x52, 0x39, 0x1a, 0x44, 0x94, 0xa2, 0x71, 0x84, 0x1e, 0x62, 0x3b, 0x94, 0x37, 0x9a, 0x24, 0xf2, 0xe0, 0x9e, 0xc2,
-	0x63, 0x8a, 0x52, 0xdf, 0xb1, 0x9a, 0x3b, 0xb2, 0x28, 0x5b, 0xb6, 0x5a, 0x71, 0x7c, 0xd1, 0x12, 0x27, 0xac, 0xe6,
-	0x8c, 0x32, 0xca, 0x99, 0x81, 0x66, 0xd9, 0x83, 0xcf, 0x29, 0x34, 0x07, 0xe9, 0x8b, 0x26, 0x09, 0xc9, 0x9e, 0xaa,
-	0x28, 0xfe, 0xdc, 0x4b, 0x1f, 0x75, 0x5f, 0xb6, 0xdb, 0xa0, 0xf4, 0x00, 0x72, 0x25, 0x4b, 0xca, 0x95, 0x2c, 0xbd,
-	0x5c, 0x89, 0xe8, 0x18, 0xd6, 0x44, 0x10, 0x5b, 0x1d, 0x81, 0xfd, 0x3a, 0x05, 0x12, 0x2b, 0x16, 0x90, 0x23, 0x21,
-	0x35, 0xdd, 0x9b, 0xea, 0x29, 0xb0, 0x53, 0xd9, 0x50, 0x27, 0xac, 0xac, 0x20, 0xb6, 0xb2, 0x02, 0xfb, 0x95, 0x0d,
-	0x24, 0x56, 0x36, 0x20, 0x47, 0x42, 0x6a, 0xba, 0x37, 0x55, 0x56, 0x60, 0xa7, 0xb2, 0x10, 0xa1, 0x58, 0x63, 0x84,
-	0x6d, 0xb5, 0x91, 0xf3, 0xeb, 0x0e, 0x25, 0xb0, 0x01, 0x00, 0x1f, 0x7d, 0xb8, 0xf6, 0x6b, 0x46, 0xed, 0x41, 0xce,
-	0x69, 0x54, 0x82, 0xb0, 0x49, 0x0a, 0xda, 0x06, 0x29, 0xe3, 0x37, 0x27, 0xf1, 0xd8, 0x98, 0x04, 0x1e, 0x3d, 0xb0,
-	0xf6, 0x6a, 0x43, 0xcd, 0x50, 0xc6, 0x69, 0x44, 0xe8, 0xfd, 0xd8, 0x02, 0x41, 0x6c, 0xf5, 0x05, 0xf6, 0xeb, 0x1e,
-	0x48, 0xac, 0x78, 0x40, 0x8e, 0x84, 0xd4, 0x74, 0x6f, 0xaa, 0xaf, 0xc0, 0x4e, 0x65, 0x45, 0x6d, 0xb0, 0xb6, 0x11,
-	0xb2, 0xd5, 0x8d, 0xb8, 0x5f, 0x5f, 0x61, 0xb1, 0xc2, 0x02, 0x1d, 0x19, 0xaa, 0xb9, 0x06, 0x54, 0xe7, 0x88, 0x3b,
-	0x95, 0x16, 0x19, 0xc4, 0x4a, 0x47, 0xc8, 0x56, 0x3a, 0xe2, 0x7e, 0xa5, 0xf5, 0x77, 0x94, 0x53, 0x0d, 0xf5, 0x77,
-	0x94, 0x2d, 0x54, 0x73, 0x0d, 0xa8, 0xd2, 0xfc, 0x3b, 0xca, 0x89, 0xea, 0xf4, 0x19, 0xab, 0x1c, 0x00, 0x5b, 0xe1,
-	0x80, 0xfa, 0xd5, 0x8d, 0x3f, 0xe3, 0x9a, 0x6a, 0x16, 0x7f, 0xc6, 0x35, 0x07, 0x6a, 0x7b, 0x57, 0xaa, 0xa6, 0xfd,
-	0x19, 0xd7, 0x44, 0x84, 0xb1, 0x17, 0x6b, 0x29, 0x88, 0xad, 0xa6, 0xc0, 0x7e, 0x3d, 0xd3, 0xaf, 0x43, 0xa6, 0x7a,
-	0xa5, 0x5f, 0x87, 0x34, 0x48, 0x4d, 0xf7, 0xa6, 0xba, 0xd2, 0xaf, 0x43, 0x46, 0xe6, 0x53, 0x6f, 0xa3, 0xf7, 0x6c,
-	0x0e, 0xd2, 0x70, 0x9e, 0x10, 0xb7, 0x76, 0x0d, 0x9e, 0x26, 0x1f, 0x11, 0x39, 0xe0, 0x55, 0xed, 0x8f, 0x4d, 0x7d,
-	0xf2, 0x7f, 0x6c, 0xea, 0x93, 0xf7, 0x63, 0x53, 0x9f, 0xe8, 0xc7, 0xa6, 0x3e, 0x95, 0x7e, 0x6c, 0xea, 0x13, 0xff,
-	0xd8, 0xd4, 0x27, 0xfe, 0xb1, 0xa9, 0x4f, 0xf6, 0xc7, 0xa6, 0x3e, 0xb5, 0x76, 0xd5, 0x83, 0x3a, 0x3b, 0xa0, 0x9a,
-	0x3b, 0x66, 0xbb, 0xe9, 0x41, 0xd3, 0x6f, 0x7a, 0x5f, 0x90, 0xf9, 0xe2, 0x7e, 0x62, 0xe1, 0xa6, 0x35, 0x34, 0x1c,
-	0x98, 0xbb, 0xdc, 0x18, 0x43, 0x03, 0x6e, 0x1e, 0x4c, 0xde, 0xb4, 0xd5, 0xd5, 0x5b, 0xd7, 0xc6, 0x63, 0x37, 0x58,
-	0xdd, 0x04, 0x86, 0x42, 0x9f, 0x09, 0xc1, 0x8a, 0x0b, 0xe2, 0x57, 0x23, 0x90, 0x1b, 0x46, 0x6c, 0x3b, 0x04, 0x3e,
-	0x79, 0x15, 0xdb, 0xa2, 0x34, 0xed, 0x30, 0xb5, 0xa3, 0xb6, 0xd1, 0xb4, 0x23, 0x31, 0xf2, 0x0e, 0x22, 0x21, 0xd8,
-	0x40, 0x41, 0xfc, 0xaa, 0x05, 0x72, 0xc3, 0x88, 0x6d, 0xa0, 0xc0, 0x27, 0xaf, 0x62, 0x1b, 0x98, 0x5e, 0x66, 0x33,
-	0xb5, 0xa3, 0x06, 0xd2, 0xcb, 0x6c, 0xca, 0xc8, 0x8f, 0x3a, 0x7f, 0x76, 0xb0, 0xac, 0x91, 0x11, 0x2b, 0x54, 0x50,
-	0xe8, 0x8d, 0x87, 0x51, 0x53, 0x23, 0xf1, 0x9d, 0x6b, 0x51, 0x73, 0x85, 0xa8, 0x9d, 0xba, 0x72, 0x93, 0x23, 0xe1,
-	0x34, 0xba, 0x5b, 0x8b, 0xec, 0xbf, 0x2e, 0x6f, 0xe0, 0x71, 0x76, 0x58, 0xca, 0xda, 0xdf, 0x98, 0xa8, 0x98, 0xf5,
-	0x29, 0x73, 0xb5, 0xdb, 0xde, 0xad, 0xde, 0xaf, 0x39, 0xb8, 0xe9, 0x7e, 0xb9, 0x11, 0x10, 0x10, 0xe0, 0x5b, 0xd4,
-	0xde, 0xdb, 0xae, 0x75, 0x7a, 0x10, 0x9b, 0xa5, 0x08, 0xb4, 0x27, 0x82, 0xe1, 0xea, 0x78, 0x47, 0x41, 0xec, 0x6d,
-	0xc3, 0xf1, 0x33, 0x9d, 0x7a, 0x24, 0xa4, 0x66, 0xc4, 0x56, 0x45, 0x60, 0xae, 0x4f, 0xcc, 0x14, 0xc7, 0xdb, 0xae,
-	0xec, 0x07, 0xe2, 0xb2, 0xf1, 0x27, 0x1b, 0x7a, 0x56, 0xbd, 0x17, 0x3c, 0xa8, 0xb3, 0x03, 0x53, 0x81, 0x95, 0x7b,
-	0x6f, 0x4c, 0x55, 0xa7, 0x0a, 0x64, 0xd9, 0xce, 0x2a, 0x47, 0x9f, 0xe9, 0xe4, 0x23, 0x21, 0x2f, 0x84, 0xd4, 0x8c,
-	0xd8, 0xea, 0xb1, 0xaa, 0x44, 0x06, 0xdf, 0xe3, 0x4e, 0x75, 0xcc, 0x5e, 0xfe, 0xad, 0x72, 0xf4, 0x99, 0x4e, 0x3e,
-	0x12, 0xf2, 0x42, 0x48, 0xcd, 0x88, 0xad, 0x23, 0x0b, 0x43, 0x62, 0xec, 0xae, 0x7f, 0xad, 0x28, 0x6d, 0xfa, 0xaf,
-	0x1c, 0xea, 0xd9, 0xbf, 0xd6, 0xd1, 0x87, 0x5f, 0x7c, 0xb8, 0x2e, 0xc0, 0xd4, 0x0c, 0x77, 0xe9, 0x92, 0x68, 0x93,
-	0xaf, 0x4a, 0x2d, 0xb1, 0xc9, 0x8b, 0x8a, 0x88, 0x67, 0xef, 0x2a, 0x47, 0x0f, 0x7c, 0xf1, 0xc0, 0xda, 0x05, 0x6d,
-	0xed, 0xbd, 0x15, 0x8b, 0x92, 0x29, 0x85, 0x65, 0x2b, 0x9f, 0x08, 0xaa, 0x7d, 0x62, 0x9e, 0xdd, 0x0b, 0x1d, 0x5d,
-	0xf4, 0xc5, 0x45, 0x6b, 0x1f, 0xa5, 0x26, 0x28, 0xe5, 0xb4, 0x01, 0x77, 0xf9, 0xa7, 0xfa, 0x67, 0x9b, 0xfc, 0xab,
-	0x1c, 0x7d, 0xa6, 0x93, 0x8f, 0x84, 0xbc, 0x10, 0x52, 0x33, 0x62, 0xeb, 0x49, 0x8b, 0xad, 0xc4, 0x64, 0xbb, 0xbf,
-	0x53, 0x25, 0xf3, 0xcd, 0xdf, 0x95, 0x81, 0x9f, 0xf9, 0xfc, 0x23, 0x43, 0x2f, 0x0c, 0xd5, 0x0e, 0x64, 0xab, 0xca,
-	0x6b, 0xac, 0x44, 0x65, 0xdb, 0xb0, 0x53, 0x5d, 0xf3, 0x5d, 0xd8, 0x95, 0x81, 0x9f, 0xf9, 0xfc, 0x23, 0x43, 0x2f,
-	0x0c, 0xd5, 0x0e, 0x64, 0xeb, 0xca, 0x4b, 0xab, 0x48, 0xdd, 0x69, 0x8e, 0x38, 0x02, 0xab, 0xec, 0xc0, 0x8c, 0xdb,
-	0x77, 0xfa, 0xcb, 0x8b, 0x80, 0x38, 0x1f, 0x3f, 0xbd, 0xcb, 0x7e, 0x63, 0x11, 0x40, 0xf8, 0x61, 0x45, 0x45, 0xcd,
-	0x27, 0x51, 0xef, 0xe0, 0x27, 0x14, 0x15, 0xb2, 0x5f, 0x3e, 0xbd, 0x6b, 0x53, 0xba, 0x95, 0x1e, 0x98, 0x79, 0xcc,
-	0x5d, 0x9e, 0xc0, 0x05, 0x98, 0x27, 0xf6, 0x77, 0x29, 0x5d, 0x0b, 0x88, 0xbf, 0xf6, 0xb8, 0xd3, 0xe4, 0x2c, 0x40,
-	0x66, 0x2e, 0x74, 0x97, 0x52, 0xb1, 0x8a, 0x68, 0x06, 0x36, 0x22, 0xf9, 0x6c, 0x66, 0x98, 0xe3, 0x39, 0x78, 0xdf,
-	0xb8, 0x65, 0xa0, 0x7f, 0x87, 0xa6, 0x02, 0x10, 0x9c, 0x82, 0x80, 0x36, 0x1d, 0xd0, 0xd4, 0x72, 0xc4, 0x92, 0x47,
-	0x00, 0x0c, 0xd6, 0x00, 0x40, 0xda, 0x0c, 0x88, 0xb8, 0x43, 0x11, 0x58, 0xfa, 0xf2, 0xe2, 0xbc, 0xb4, 0x30, 0x97,
-	0x72, 0x70, 0x2f, 0x01, 0x4c, 0x13, 0x05, 0x35, 0xed, 0x8c, 0xa8, 0xd3, 0x58, 0xa1, 0xb8, 0xc5, 0x91, 0xe0, 0x66,
-	0x0b, 0x63, 0xda, 0x2e, 0xa8, 0x35, 0x80, 0xc0, 0xd6, 0x0a, 0x94, 0x08, 0xbd, 0xf7, 0x13, 0xa1, 0xf7, 0xa7, 0x12,
-	0xa1, 0x19, 0x0a, 0x55, 0x71, 0x5e, 0x97, 0xf7, 0x39, 0x63, 0xa6, 0xd2, 0xcb, 0xf2, 0x7e, 0x01, 0x36, 0x59, 0xe1,
-	0x55, 0x79, 0x9f, 0x37, 0xe6, 0xf3, 0x5e, 0x94, 0xf7, 0x49, 0x6b, 0x4a, 0x24, 0xef, 0x0b, 0xc6, 0x21, 0xb3, 0x66,
-	0xa4, 0x6b, 0xdc, 0xcf, 0xb8, 0xf0, 0xff, 0x4c, 0x0b, 0xff, 0xcf, 0xde, 0xc2, 0xff, 0x4b, 0xf7, 0xf4, 0x68, 0x9c,
-	0x0e, 0x8c, 0xc0, 0x7e, 0x31, 0xcf, 0x8a, 0x14, 0x66, 0xc5, 0xfd, 0xa2, 0x4f, 0x86, 0x14, 0x31, 0x8f, 0x36, 0x94,
-	0x48, 0x32, 0xa8, 0x50, 0xcc, 0xc0, 0x28, 0x12, 0x9f, 0xfa, 0x44, 0xc4, 0x7c, 0x41, 0xc0, 0xc7, 0x6d, 0x13, 0x8a,
-	0x5f, 0x10, 0xf0, 0x4b, 0x38, 0x0d, 0xf3, 0xbe, 0x20, 0xe0, 0x93, 0x85, 0xe6, 0xba, 0x5f, 0x10, 0xf0, 0x59, 0x6b,
-	0x04, 0xef, 0x0b, 0x02, 0x91, 0xdc, 0xe0, 0x48, 0xba, 0xc1, 0x01, 0x73, 0x43, 0x43, 0xe5, 0xc6, 0x1b, 0x24, 0x37,
-	0xb4, 0xee, 0xd8, 0xd0, 0x2a, 0x63, 0xe3, 0xaf, 0x32, 0x36, 0xc5, 0x55, 0x46, 0xb6, 0xba, 0x3e, 0x16, 0xf0, 0xba,
-	0x84, 0xdb, 0xdb, 0x14, 0x5e, 0x99, 0x4f, 0x7c, 0xb0, 0xd7, 0x91, 0x90, 0x9a, 0x11, 0x7b, 0x69, 0xfa, 0xe5, 0xc5,
-	0xc8, 0x3c, 0x60, 0xee, 0xef, 0x81, 0x72, 0x7f, 0x0f, 0x7e, 0xee, 0xef, 0xc1, 0xcb, 0xfd, 0x3d, 0x50, 0xee, 0xef,
-	0xa1, 0x94, 0xfb, 0x7b, 0xe0, 0xdc, 0xdf, 0x03, 0xe7, 0xfe, 0x1e, 0x6c, 0xee, 0xef, 0x01, 0x7f, 0x64, 0xf2, 0x81,
-	0x7e, 0x5f, 0xf2, 0xc1, 0xfb, 0x69, 0xc9, 0xc7, 0xf0, 0xf4, 0x33, 0x1d, 0x98, 0xb9, 0xd0, 0xa3, 0x7d, 0xd6, 0x99,
-	0x60, 0x9e, 0xf9, 0x3c, 0xc2, 0x93, 0xcd, 0x84, 0xf8, 0x9f, 0x7d, 0x7f, 0xc4, 0xe7, 0x98, 0x09, 0xb2, 0x93, 0x9f,
-	0x47, 0x7d, 0x6a, 0x19, 0x81, 0x67, 0xcd, 0x6f, 0x64, 0x8f, 0x09, 0xf8, 0x01, 0x81, 0xfb, 0x68, 0xe0, 0x11, 0x76,
-	0x10, 0xe5, 0x88, 0x6d, 0xb7, 0xbb, 0x7f, 0x28, 0xe7, 0x1c, 0x0b, 0xd8, 0xdd, 0x43, 0x39, 0x5c, 0xb0, 0x05, 0xed,
-	0x1d, 0xca, 0x71, 0xb2, 0x8a, 0xd9, 0x39, 0x94, 0xa1, 0x68, 0x1f, 0x7a, 0xe4, 0xf9, 0x98, 0xf7, 0x5f, 0x0b, 0x3b,
-	0xe6, 0x4a, 0x9f, 0xe5, 0x1a, 0x18, 0xc4, 0x9a, 0xcb, 0xf9, 0x2c, 0x97, 0xe5, 0x1c, 0x73, 0xe5, 0x9f, 0xe5, 0xb2,
-	0x70, 0xc1, 0x5c, 0xe6, 0xb3, 0x5c, 0x16, 0x27, 0x73, 0x65, 0x9f, 0xe5, 0x32, 0x28, 0x9a, 0x2b, 0x25, 0x2c, 0x4c,
-	0xeb, 0xc9, 0x5c, 0x94, 0xb0, 0x50, 0x26, 0xff, 0x62, 0xca, 0xc0, 0xc5, 0xc9, 0x74, 0xa5, 0x2f, 0xa6, 0xf8, 0x25,
-	0x3c, 0x33, 0x3a, 0x5f, 0x4c, 0xf1, 0xc9, 0x92, 0x49, 0xbd, 0x2f, 0xa6, 0xf8, 0x2c, 0x9b, 0x97, 0xbf, 0x98, 0xe2,
-	0x72, 0x99, 0xa9, 0x73, 0xf9, 0x77, 0xed, 0xc7, 0x66, 0xf7, 0xe5, 0x3f, 0xf1, 0x61, 0x44, 0x44, 0xb3, 0x0b, 0x62,
-	0x0d, 0x2e, 0xb0, 0x6b, 0x6a, 0xe1, 0x1c, 0x23, 0x0b, 0x63, 0xcd, 0x2b, 0x70, 0xc1, 0xb0, 0xc2, 0x92, 0x49, 0x05,
-	0x27, 0x63, 0x0a, 0x6e, 0xcc, 0x98, 0x9e, 0x97, 0x8d, 0x72, 0xa4, 0xa6, 0xd6, 0x93, 0xd1, 0x8a, 0x4f, 0xc7, 0xb6,
-	0xf8, 0x9c, 0x68, 0x8b, 0xa3, 0xe6, 0xb6, 0x07, 0x3f, 0x9c, 0xb2, 0xc5, 0x9b, 0x6c, 0xe9, 0xfa, 0x5b, 0xf7, 0xd2,
-	0x49, 0x8a, 0x0c, 0x82, 0x37, 0x49, 0x49, 0xcd, 0x61, 0x5e, 0xa6, 0xa6, 0xb3, 0xe8, 0x9e, 0x45, 0xb9, 0xda, 0xe6,
-	0xb9, 0x3f, 0x0f, 0xc6, 0x2a, 0xe4, 0xb9, 0xbf, 0xa1, 0x53, 0xba, 0xf6, 0x2f, 0x42, 0x35, 0x3a, 0xbd, 0x6d, 0x41,
-	0xe7, 0x91, 0xcf, 0x1e, 0x88, 0x55, 0xc2, 0x54, 0xde, 0x90, 0x4a, 0xd6, 0xde, 0xe9, 0x54, 0x99, 0x53, 0x9b, 0x0f,
-	0xb6, 0x29, 0xb7, 0x65, 0x10, 0xac, 0x44, 0xca, 0x6d, 0x0d, 0xf3, 0x32, 0x35, 0x9d, 0x45, 0xf7, 0x2e, 0x6e, 0x24,
-	0xc8, 0xa7, 0xc3, 0xcf, 0x25, 0x02, 0xab, 0x91, 0x11, 0x58, 0x9b, 0x8c, 0xa8, 0x4b, 0x97, 0xa2, 0xba, 0xe5, 0xac,
-	0x53, 0x45, 0xcd, 0xa8, 0x59, 0x08, 0xab, 0xa5, 0x19, 0xb5, 0xa1, 0x29, 0x55, 0xf3, 0x89, 0x54, 0x89, 0xf2, 0xae,
-	0x05, 0x99, 0xee, 0x3f, 0x13, 0x82, 0x37, 0x0f, 0x08, 0xde, 0x3b, 0x4d, 0x71, 0xcd, 0x59, 0x74, 0x67, 0x9a, 0xe2,
-	0x26, 0x26, 0xc9, 0x8b, 0x41, 0xf0, 0xc6, 0x01, 0xc1, 0x1b, 0x93, 0x04, 0x6d, 0x7d, 0x09, 0xda, 0x16, 0x25, 0xe8,
-	0x2b, 0xce, 0xcc, 0xbf, 0xd2, 0xa4, 0xfc, 0xab, 0x37, 0x1f, 0x97, 0x04, 0x53, 0xe9, 0x19, 0x19, 0xd2, 0x05, 0xce,
-	0x3c, 0x25, 0xcb, 0xaf, 0x24, 0xe4, 0x0c, 0xc9, 0xcd, 0xea, 0xee, 0x09, 0xfe, 0x3a, 0x1b, 0x4d, 0x80, 0x0c, 0xa7,
-	0xdd, 0x9a, 0x53, 0x04, 0x95, 0x47, 0x5f, 0x0e, 0x05, 0xcf, 0x28, 0x11, 0x35, 0xa6, 0x43, 0xca, 0x7d, 0x4e, 0x89,
-	0x05, 0x4c, 0x76, 0x0e, 0x28, 0xb4, 0x86, 0x53, 0xf9, 0x9d, 0x31, 0x86, 0xa0, 0x52, 0x17, 0x8f, 0x92, 0xec, 0xa8,
-	0x4b, 0x61, 0x35, 0x9d, 0x02, 0xf0, 0x4a, 0x2a, 0xa2, 0x72, 0x33, 0x8f, 0x32, 0x1f, 0x45, 0xcc, 0x28, 0x79, 0xbe,
-	0xea, 0x93, 0x58, 0x13, 0xaf, 0x80, 0xe3, 0xea, 0xc0, 0x40, 0x4f, 0xd8, 0xf5, 0x6e, 0xb2, 0x03, 0xe3, 0xa0, 0x5d,
-	0x7c, 0xac, 0x9d, 0x21, 0xb1, 0x56, 0x80, 0x85, 0xfc, 0xf3, 0x24, 0x01, 0xb7, 0xc8, 0xc6, 0x38, 0x51, 0xe4, 0x5e,
-	0x03, 0x7e, 0xa7, 0xe9, 0x1f, 0x45, 0xf2, 0x9c, 0x4f, 0xc2, 0xe3, 0xfb, 0xc3, 0x7a, 0xa1, 0x6d, 0x76, 0x40, 0xb5,
-	0x77, 0x93, 0xc7, 0x3b, 0x2f, 0x79, 0xbc, 0xa3, 0xe4, 0xf1, 0xae, 0x94, 0x3c, 0xde, 0x71, 0xf2, 0x78, 0x47, 0xc9,
-	0xe3, 0x1d, 0x25, 0x8f, 0x77, 0x29, 0x79, 0xac, 0x66, 0xfa, 0x0b, 0xe9, 0x3d, 0x36, 0x75, 0x6f, 0xc4, 0x62, 0x97,
-	0x02, 0x05, 0x91, 0xe8, 0x09, 0xc4, 0x7c, 0xd3, 0x3d, 0xf5, 0xf4, 0x46, 0x4f, 0x58, 0x46, 0xe1, 0xe7, 0x94, 0xb5,
-	0xdb, 0x35, 0xc2, 0x05, 0x7f, 0xe7, 0x49, 0xca, 0x1d, 0xc8, 0x56, 0xc2, 0xe4, 0x89, 0x30, 0x34, 0x47, 0x10, 0xeb,
-	0x12, 0x81, 0x6d, 0x54, 0x45, 0x98, 0x42, 0x0b, 0x1f, 0x35, 0xab, 0xe1, 0x02, 0x7a, 0x4b, 0xe5, 0x28, 0xd2, 0x64,
-	0x5b, 0x2d, 0x58, 0x42, 0x10, 0x1b, 0x73, 0x02, 0xfb, 0xd6, 0x93, 0x2d, 0x38, 0x36, 0xfa, 0x02, 0xbc, 0x65, 0xc4,
-	0x6f, 0xb4, 0x1f, 0x8c, 0xc2, 0x39, 0x11, 0x29, 0x8c, 0x0d, 0x4b, 0x81, 0x0b, 0xb1, 0x29, 0x2c, 0x05, 0xa8, 0xe0,
-	0x36, 0x4a, 0x05, 0xb6, 0xa1, 0x9a, 0x3d, 0xcb, 0xb7, 0x66, 0xff, 0x8b, 0x0a, 0xee, 0xc9, 0x56, 0x14, 0xbe, 0x02,
-	0xdb, 0x18, 0x8e, 0x30, 0x05, 0x72, 0x24, 0x4e, 0xf8, 0x03, 0x62, 0x57, 0x00, 0x37, 0xae, 0xe3, 0x64, 0xdd, 0xc4,
-	0x6a, 0x4d, 0x80, 0x09, 0x73, 0x3b, 0x0b, 0x4f, 0x84, 0xec, 0x2c, 0x00, 0x2b, 0x08, 0x62, 0xdd, 0x2e, 0xb0, 0x8d,
-	0xf5, 0x08, 0x53, 0xac, 0x67, 0x9f, 0x9e, 0x9f, 0xe4, 0xe8, 0x2d, 0x95, 0xa3, 0x58, 0x0f, 0x30, 0xc6, 0xba, 0x20,
-	0x36, 0xd6, 0x05, 0xf6, 0x6d, 0x9b, 0x7f, 0x11, 0xde, 0x5c, 0x7c, 0xcb, 0x88, 0xdf, 0x68, 0x3f, 0xd6, 0xe9, 0x83,
-	0xf0, 0x96, 0xb1, 0xb1, 0xee, 0x7e, 0x10, 0xde, 0xb2, 0x14, 0xeb, 0xf9, 0x07, 0xe1, 0x2d, 0x6c, 0x63, 0x3d, 0xff,
-	0x20, 0xbc, 0x31, 0xfb, 0x5f, 0x54, 0x70, 0x4f, 0xb6, 0xa2, 0x58, 0x17, 0xd8, 0xc6, 0x7a, 0x84, 0x29, 0xd6, 0x23,
-	0x71, 0xc2, 0x1f, 0x10, 0xcf, 0x02, 0xb8, 0xb1, 0x1e, 0x93, 0x3e, 0x26, 0x56, 0x6b, 0x02, 0x4c, 0xac, 0xdb, 0x8c,
-	0x8f, 0x12, 0x70, 0x97, 0x2c, 0xe2, 0x11, 0xa7, 0x10, 0x40, 0x92, 0xa2, 0x3f, 0x23, 0xb9, 0x0f, 0x20, 0x6d, 0x7b,
-	0x02, 0x70, 0xb7, 0x85, 0x73, 0xb8, 0x57, 0x98, 0x07, 0x50, 0x63, 0x0f, 0xa7, 0x1e, 0x52, 0x7e, 0x00, 0xe5, 0x15,
-	0xe1, 0xde, 0x92, 0x3f, 0xbc, 0xf1, 0xf1, 0x53, 0x66, 0x2b, 0xf4, 0x1f, 0xff, 0xe1, 0x8d, 0xcf, 0x53, 0x5f, 0x2a,
-	0x3f, 0xbc, 0xf1, 0xcb, 0x70, 0xbf, 0x72, 0x1e, 0xde, 0xf8, 0x24, 0xf5, 0x31, 0x20, 0xb9, 0xa7, 0x01, 0xf9, 0x57,
-	0xe1, 0xa4, 0x7d, 0xc1, 0xf2, 0xdc, 0xf7, 0x90, 0xa4, 0x1e, 0x98, 0x91, 0xdc, 0x0f, 0x33, 0xfa, 0xbb, 0x5e, 0xc7,
-	0x7e, 0x87, 0xb0, 0xdf, 0x33, 0xb3, 0x4c, 0xa1, 0xdb, 0xbf, 0xea, 0x02, 0x6c, 0xfb, 0xaa, 0x9b, 0x26, 0x8c, 0x74,
-	0x96, 0x6e, 0xd9, 0x53, 0x5a, 0x6a, 0x4f, 0x3b, 0xdb, 0x92, 0x1d, 0x32, 0xcc, 0x7f, 0xac, 0xa5, 0x2f, 0x99, 0x99,
-	0x45, 0x66, 0x38, 0xbc, 0xe8, 0xe9, 0xeb, 0x57, 0x82, 0xa4, 0x7d, 0x26, 0x06, 0xce, 0x9f, 0xe9, 0x66, 0xe4, 0x42,
-	0xd7, 0x2c, 0x01, 0xb8, 0xb2, 0xc0, 0x35, 0x2c, 0x7a, 0x05, 0x89, 0x61, 0x60, 0x60, 0x58, 0x5f, 0xe7, 0x4c, 0x5c,
-	0x15, 0x87, 0x15, 0xef, 0x8c, 0xb9, 0x40, 0xc4, 0x18, 0x7d, 0xee, 0x81, 0x46, 0x3d, 0xa7, 0xd7, 0x53, 0x01, 0x11,
-	0x05, 0x01, 0xc4, 0xeb, 0xc1, 0xcf, 0xf8, 0x1a, 0x2a, 0x80, 0xa6, 0xaf, 0x3e, 0xeb, 0x6b, 0xa7, 0x00, 0xd9, 0xc7,
-	0x63, 0xcf, 0xf1, 0x35, 0x53, 0x00, 0x4c, 0xc7, 0x7b, 0xb6, 0x9f, 0x8b, 0x7a, 0x6e, 0xe5, 0x68, 0xa8, 0x07, 0xe6,
-	0x09, 0xda, 0x73, 0x2e, 0x3c, 0x00, 0xf3, 0x83, 0xb5, 0xe7, 0x24, 0x31, 0x80, 0xe4, 0xba, 0x02, 0x84, 0xfd, 0x81,
-	0xe9, 0xe7, 0xa4, 0x20, 0x80, 0x98, 0x9f, 0xcb, 0x7e, 0xa6, 0x2f, 0x2e, 0x1d, 0xed, 0x4f, 0x9c, 0x1f, 0x51, 0x5e,
-	0x8f, 0xa4, 0xa9, 0x47, 0x5f, 0x48, 0x8f, 0x9e, 0x7a, 0x1e, 0x49, 0x32, 0x8f, 0x25, 0x9d, 0x3c, 0xb2, 0x38, 0x1e,
-	0x49, 0x11, 0x8f, 0x24, 0x83, 0x47, 0xfa, 0x29, 0xf6, 0x17, 0xdc, 0xa8, 0xf5, 0x42, 0x1b, 0xb5, 0x5e, 0x68, 0xa3,
-	0xd6, 0x8b, 0xbf, 0x51, 0xeb, 0xc5, 0xdb, 0xa8, 0xf5, 0xe2, 0x6e, 0xd4, 0x7a, 0xa1, 0x8d, 0x5a, 0x2f, 0xbc, 0x51,
-	0xeb, 0x85, 0x37, 0x6a, 0xd5, 0xf8, 0x9b, 0xeb, 0x35, 0xfd, 0xe6, 0x7a, 0x4d, 0xbf, 0xb9, 0x5e, 0xfb, 0xbf, 0xb9,
-	0x5e, 0x7b, 0xbf, 0xb9, 0x5e, 0xd3, 0x6f, 0xae, 0xd7, 0xfc, 0x9b, 0xeb, 0x35, 0xff, 0xe6, 0x7a, 0x6d, 0x7f, 0x73,
-	0xbd, 0xa6, 0xdf, 0x5c, 0xaf, 0x6d, 0x17, 0xa8, 0xd1, 0xe6, 0x35, 0xd9, 0xbc, 0x26, 0x9b, 0xd7, 0xbe, 0xcd, 0x6b,
-	0xcf, 0xe6, 0xb5, 0x6b, 0xf3, 0x9a, 0x6c, 0x5e, 0xb3, 0xcd, 0x6b, 0xcf, 0xe6, 0x6d, 0x74, 0x8f, 0xd3, 0x41, 0x8c,
-	0x6e, 0x45, 0xb2, 0xe8, 0x56, 0x18, 0xa2, 0x5b, 0xc1, 0x18, 0xdd, 0x8a, 0x98, 0xe8, 0x56, 0x22, 0x45, 0xb7, 0x42,
-	0x31, 0xba, 0x15, 0x89, 0xd1, 0x9d, 0x10, 0xdb, 0x5b, 0x65, 0xe4, 0xc2, 0xb8, 0x11, 0xc4, 0x06, 0x8f, 0xc0, 0x36,
-	0x82, 0x04, 0x76, 0xc3, 0x48, 0x38, 0x27, 0x96, 0x84, 0xb1, 0x01, 0x25, 0x30, 0x45, 0x95, 0xe0, 0x14, 0x5a, 0x82,
-	0x9b, 0xf8, 0x12, 0xd4, 0x06, 0x59, 0x96, 0xa6, 0x30, 0xed, 0x47, 0xb7, 0x0b, 0x62, 0x63, 0x4e, 0x60, 0x1b, 0x78,
-	0x11, 0xf6, 0xa2, 0x4f, 0x38, 0x27, 0x04, 0x23, 0xe3, 0xc4, 0xa1, 0x50, 0x36, 0x18, 0x05, 0xa6, 0x88, 0x14, 0x9c,
-	0xc2, 0x52, 0x13, 0x1f, 0xe3, 0x1c, 0xb1, 0x01, 0xea, 0x25, 0x3e, 0x0c, 0xe7, 0x84, 0xaa, 0x49, 0x7c, 0x18, 0xb8,
-	0x10, 0xb4, 0x36, 0xf1, 0x61, 0x70, 0x1b, 0xbe, 0x26, 0xf1, 0x91, 0xc3, 0x14, 0xc8, 0xa9, 0x92, 0x18, 0xcb, 0x0a,
-	0xda, 0x70, 0x56, 0xc6, 0x46, 0xb4, 0x32, 0x6e, 0x50, 0x2b, 0xed, 0xc4, 0xb5, 0x92, 0x36, 0xb4, 0x95, 0xa1, 0xe8,
-	0x56, 0x8a, 0x02, 0x5c, 0x29, 0x13, 0xe3, 0x4a, 0xd8, 0x30, 0x37, 0x9b, 0xfc, 0x1d, 0x03, 0x61, 0x58, 0x29, 0x68,
-	0xe3, 0x5d, 0x19, 0x1b, 0xf2, 0xc0, 0x78, 0x51, 0xaf, 0xb4, 0x13, 0xf8, 0x40, 0x3a, 0xb1, 0xaf, 0xac, 0x0d, 0x7f,
-	0x65, 0xa8, 0x07, 0x28, 0x45, 0x9d, 0x20, 0x51, 0xd8, 0x0f, 0x14, 0xb4, 0x5d, 0x41, 0x19, 0xb7, 0x37, 0x28, 0xed,
-	0x74, 0x08, 0x25, 0x6d, 0x9f, 0x50, 0xa6, 0xd0, 0x2d, 0xb4, 0x00, 0xf5, 0x0c, 0xa5, 0x6c, 0xe7, 0x50, 0xc6, 0xf6,
-	0x0f, 0xfb, 0x36, 0x47, 0x8a, 0x80, 0x6f, 0xb0, 0xc5, 0xf5, 0x9b, 0xdd, 0xd7, 0xfa, 0xcd, 0x6e, 0x66, 0xfd, 0xe6,
-	0xee, 0x60, 0xfd, 0xe6, 0x6c, 0x5b, 0xfd, 0xe6, 0xed, 0x55, 0xfd, 0x66, 0x37, 0xa8, 0x7e, 0xa3, 0x5d, 0xa9, 0xdf,
-	0x68, 0x2b, 0xea, 0xb7, 0xa8, 0xc6, 0x16, 0x30, 0x75, 0xcd, 0xb4, 0x98, 0x50, 0xa7, 0xd6, 0x56, 0x89, 0x89, 0xe0,
-	0xfa, 0x67, 0x3a, 0x6c, 0x51, 0xdb, 0x92, 0x5c, 0x85, 0x13, 0x2c, 0x3f, 0xe9, 0x48, 0x80, 0x69, 0x4e, 0xfc, 0xe5,
-	0xc9, 0xbc, 0x39, 0x11, 0x75, 0x9a, 0x23, 0x14, 0x37, 0x27, 0x12, 0xdc, 0x1c, 0x61, 0x4c, 0x73, 0x04, 0xb5, 0xcd,
-	0x11, 0xd8, 0x36, 0x47, 0x2f, 0xbb, 0x72, 0x41, 0xd3, 0x2c, 0x60, 0x4c, 0xd3, 0x90, 0x71, 0x9a, 0x07, 0x34, 0x37,
-	0x11, 0x49, 0x6e, 0x26, 0xb0, 0xa6, 0xa9, 0xc0, 0xd8, 0xe6, 0x02, 0x05, 0x4d, 0xfe, 0xf9, 0xf1, 0xf6, 0xcd, 0x6a,
-	0xf7, 0xf8, 0x6e, 0xb9, 0xde, 0xed, 0xd3, 0xd1, 0xeb, 0xe5, 0xd3, 0xb2, 0x3b, 0xf8, 0x65, 0xfb, 0xf8, 0xf4, 0xfb,
-	0xea, 0x69, 0xb7, 0xbe, 0x69, 0xc8, 0xff, 0x01, 0x1a, 0xbe, 0xcc, 0xc0 };
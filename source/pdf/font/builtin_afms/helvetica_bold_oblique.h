@@ -1,704 +0,0 @@
-// helvetica_bold_oblique.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_HELVETICA_BOLD_OBLIQUE[] = { 0x78, 0x9c, 0xb5, 0x7d, 0x5d, 0x73, 0x1b, 0x39, 0xb2, 0xec, 0xfb,
-	0x44, 0xcc, 0x7f, 0xe0, 0xe3, 0x3d, 0x11, 0x57, 0x7b, 0xc9, 0xe6, 0xf7, 0xee, 0xd3, 0xcc, 0x7a, 0x76, 0x77, 0xc6,
-	0xde, 0x91, 0xed, 0x91, 0x28, 0x6b, 0xdf, 0x68, 0x89, 0x96, 0x79, 0x4d, 0x89, 0x1e, 0x52, 0x94, 0x44, 0xff, 0xfa,
-	0x83, 0x6e, 0x14, 0x50, 0x89, 0xca, 0x02, 0x7d, 0x5e, 0x4e, 0x4c, 0x8c, 0x43, 0x9d, 0x89, 0xee, 0x06, 0xaa, 0x0a,
-	0x09, 0xa0, 0x1a, 0xdd, 0xfc, 0xe3, 0x71, 0xb9, 0x7b, 0xfc, 0xc7, 0xf6, 0xe1, 0xf1, 0xdf, 0xab, 0xc7, 0xdd, 0xfa,
-	0x66, 0xdf, 0x1b, 0xfd, 0x65, 0xf0, 0xe3, 0x0f, 0x7f, 0xdf, 0xde, 0xdf, 0xaf, 0x1e, 0x1e, 0x7b, 0x7f, 0xdf, 0x7e,
-	0x3d, 0xee, 0xd6, 0x77, 0x9f, 0x1f, 0x7b, 0xff, 0xe7, 0xe6, 0xbf, 0x7a, 0x83, 0xf9, 0x6c, 0xfc, 0x7f, 0xdb, 0x7f,
-	0xa7, 0xdd, 0xbf, 0xf3, 0xf6, 0xdf, 0x79, 0xbf, 0xfb, 0x77, 0xda, 0xfb, 0xe9, 0x76, 0xfb, 0x71, 0xd5, 0xfb, 0xe3,
-	0xb8, 0x7f, 0x5c, 0xdd, 0xef, 0x7b, 0xbf, 0x3e, 0xdc, 0x6c, 0x77, 0x5f, 0xb7, 0xbb, 0xe5, 0xe3, 0xea, 0xf6, 0x2f,
-	0xbd, 0xde, 0x4f, 0x9b, 0x4d, 0xef, 0x7d, 0x7b, 0x9d, 0x7d, 0xef, 0xfd, 0x6a, 0xbf, 0xda, 0x3d, 0x05, 0x14, 0xee,
-	0xb2, 0x5b, 0x2d, 0x1f, 0xd7, 0xdb, 0x87, 0xde, 0xab, 0x50, 0xfc, 0xaf, 0xbd, 0x8b, 0xcf, 0x87, 0xde, 0xbf, 0x97,
-	0xc7, 0x5e, 0x6f, 0xd0, 0x1b, 0x34, 0x7f, 0x1d, 0x8d, 0xff, 0x3a, 0x68, 0xba, 0x5b, 0xe8, 0x09, 0x97, 0x0f, 0xeb,
-	0x3f, 0x0f, 0xab, 0x5f, 0x5f, 0xf5, 0x46, 0xc3, 0xfe, 0x78, 0xa8, 0xf8, 0xe2, 0xdf, 0x87, 0xfd, 0xf2, 0x6e, 0xd5,
-	0x1b, 0x8c, 0x46, 0xb3, 0xa6, 0x37, 0x99, 0x8d, 0x67, 0x93, 0x1f, 0x7f, 0x68, 0x1b, 0xf7, 0xfb, 0xf2, 0x7e, 0xd5,
-	0xfb, 0xd7, 0x6a, 0xf3, 0xb4, 0x7a, 0x5c, 0xdf, 0x2c, 0xcf, 0x7e, 0xde, 0x6e, 0x6e, 0xcf, 0x3f, 0x6e, 0xda, 0x8b,
-	0x04, 0xfe, 0xb0, 0xd9, 0x94, 0x7c, 0xaf, 0xe5, 0x7b, 0x5a, 0x60, 0x79, 0xbf, 0xde, 0x1c, 0xcb, 0x22, 0x3f, 0xfe,
-	0x70, 0xb5, 0xea, 0xec, 0xd2, 0x16, 0xfd, 0xf1, 0x87, 0x5f, 0x1f, 0x97, 0x9b, 0xf5, 0xcd, 0x4f, 0x0f, 0x77, 0x9b,
-	0x55, 0xef, 0x6c, 0xd0, 0x04, 0x60, 0xff, 0x8f, 0xf5, 0xcb, 0xea, 0xf6, 0xed, 0xfa, 0xf1, 0xe6, 0x73, 0xef, 0xd3,
-	0x72, 0xb3, 0x0f, 0xd7, 0xf9, 0xfb, 0xe7, 0xe5, 0x6e, 0x79, 0xf3, 0xb8, 0xda, 0xfd, 0xb1, 0x7a, 0xec, 0xfd, 0xf2,
-	0xf2, 0xb8, 0x7a, 0xb8, 0x5d, 0xdd, 0xbe, 0xdf, 0xde, 0x2f, 0x1f, 0x62, 0x25, 0x7f, 0xfe, 0x79, 0xfb, 0x12, 0xce,
-	0x9e, 0x8e, 0x7a, 0x67, 0x4d, 0x33, 0xeb, 0x0d, 0x06, 0x83, 0x51, 0x6f, 0x3e, 0x69, 0x7a, 0x3f, 0xfe, 0x70, 0x19,
-	0x4a, 0xee, 0x36, 0xeb, 0x87, 0xd5, 0xdb, 0xed, 0x7e, 0xdd, 0x59, 0xea, 0x6c, 0xd0, 0xef, 0x03, 0x7e, 0xf1, 0x79,
-	0x7d, 0xf3, 0xe5, 0x61, 0xb5, 0xdf, 0xf7, 0xc6, 0x01, 0x5e, 0xac, 0x76, 0xfb, 0xb6, 0x50, 0xbf, 0xdf, 0xfc, 0xa5,
-	0xdf, 0x96, 0xfb, 0x7d, 0x1b, 0xea, 0xbc, 0xfa, 0x5f, 0xf5, 0xa6, 0x1a, 0x6f, 0xbd, 0xef, 0x2d, 0x7b, 0x8f, 0xbb,
-	0xe5, 0xed, 0xea, 0x7e, 0xb9, 0xfb, 0xd2, 0xdb, 0x7e, 0xea, 0xbd, 0x59, 0x3f, 0x6c, 0x1f, 0x8f, 0x5f, 0x57, 0x67,
-	0xa1, 0xd0, 0xa6, 0xf7, 0xd3, 0x3f, 0x7b, 0xcb, 0x87, 0xdb, 0xff, 0xb7, 0xdd, 0xf5, 0xd6, 0xe1, 0x02, 0xfb, 0xc3,
-	0xc7, 0xfd, 0xfa, 0x76, 0xbd, 0xdc, 0xad, 0x57, 0xfb, 0x10, 0x12, 0xbf, 0x84, 0x3b, 0xdd, 0xae, 0x1f, 0xee, 0xfe,
-	0xb8, 0xf9, 0xbc, 0x0a, 0xf6, 0xee, 0xaa, 0xf1, 0xc7, 0x63, 0x28, 0xbf, 0xdc, 0xdd, 0x26, 0x2e, 0x58, 0x72, 0xf9,
-	0xf5, 0x5f, 0xd1, 0xfc, 0xd3, 0xc1, 0xec, 0xc7, 0x1f, 0x3e, 0xc8, 0xc1, 0x78, 0x18, 0x2c, 0xff, 0xd3, 0xfe, 0xa6,
-	0x35, 0xec, 0x2e, 0x52, 0xaf, 0x56, 0xe9, 0xf0, 0xac, 0xe9, 0x87, 0x08, 0xfa, 0xe3, 0xf1, 0xf6, 0x5f, 0x57, 0xc1,
-	0xb4, 0xb3, 0xee, 0xcf, 0x45, 0xf8, 0x73, 0xd4, 0x6f, 0xff, 0x0c, 0x9d, 0xa0, 0x75, 0x4f, 0xea, 0x04, 0xc3, 0xc1,
-	0x38, 0xdc, 0xa5, 0x37, 0x6c, 0x7a, 0x7f, 0xeb, 0x5d, 0x7d, 0xe8, 0x35, 0xd3, 0x59, 0xf8, 0xe3, 0xf7, 0xde, 0xfe,
-	0xeb, 0x32, 0x98, 0xf1, 0x6f, 0xbd, 0x9f, 0x7b, 0x7d, 0xf9, 0xef, 0x6f, 0x5d, 0xb1, 0x61, 0x2c, 0x36, 0xec, 0xfe,
-	0xf8, 0xbd, 0xb7, 0x7a, 0xb9, 0xd9, 0x2c, 0xef, 0xbb, 0x72, 0xf3, 0x51, 0x28, 0x34, 0x0c, 0x06, 0x0d, 0xb5, 0x91,
-	0xc2, 0xa3, 0x58, 0x78, 0x34, 0x1d, 0x75, 0x85, 0xff, 0x3c, 0x6c, 0x83, 0x55, 0x3f, 0x6e, 0xba, 0xe2, 0x83, 0xf9,
-	0xb0, 0x37, 0x1a, 0x4d, 0x7b, 0xe3, 0x66, 0x0e, 0x67, 0x8c, 0xe3, 0x19, 0xe3, 0xf1, 0xa4, 0x3b, 0xe3, 0xe1, 0x70,
-	0xff, 0xb1, 0xf5, 0xf0, 0xdd, 0x43, 0x77, 0xce, 0xa4, 0xad, 0xc7, 0x64, 0x34, 0xea, 0x4d, 0xe6, 0xe9, 0x84, 0x49,
-	0x79, 0xc2, 0xed, 0x76, 0xb3, 0x59, 0xee, 0x62, 0xe1, 0x69, 0x08, 0x9d, 0xc1, 0xb8, 0x37, 0x69, 0x9a, 0xde, 0x74,
-	0x3a, 0x96, 0xf2, 0xd3, 0x58, 0x7e, 0x36, 0x9b, 0x77, 0xe5, 0xbf, 0xae, 0x76, 0x37, 0x6d, 0x77, 0xea, 0x6a, 0x14,
-	0x2e, 0x76, 0x36, 0x98, 0xf7, 0xe6, 0xfd, 0x41, 0xa8, 0x51, 0x6a, 0xf0, 0x2c, 0x9e, 0x30, 0x6d, 0x9a, 0xee, 0x84,
-	0xe5, 0x7d, 0x38, 0x65, 0x1f, 0xbc, 0xd4, 0x9d, 0x12, 0xae, 0xd2, 0x9e, 0x31, 0x0d, 0xd6, 0xd3, 0x36, 0xcc, 0x4b,
-	0x4b, 0x76, 0xad, 0x8e, 0xb1, 0xd8, 0xdd, 0x25, 0xd4, 0x6b, 0x34, 0x1a, 0x87, 0x9a, 0xc3, 0x39, 0xa3, 0x7e, 0x69,
-	0xd6, 0xaf, 0xcb, 0xdd, 0xea, 0x61, 0xb3, 0xfa, 0x14, 0x4f, 0x99, 0x4e, 0x5a, 0x97, 0xce, 0x82, 0x1d, 0xfb, 0xe1,
-	0x56, 0x23, 0x39, 0x65, 0xe0, 0x9c, 0xa2, 0xb7, 0x39, 0x6b, 0xc6, 0xf1, 0xa4, 0xe1, 0x64, 0x0e, 0x27, 0x89, 0x97,
-	0x87, 0xd2, 0xfc, 0xe5, 0xbe, 0xad, 0xda, 0xfe, 0x4b, 0xac, 0xd9, 0x68, 0x12, 0x88, 0x50, 0xbb, 0xd9, 0x00, 0x6a,
-	0x26, 0x0e, 0x1f, 0xcf, 0xa2, 0x0f, 0xbf, 0x6e, 0x0e, 0xfb, 0xd8, 0xf4, 0xa6, 0xf5, 0x45, 0x30, 0xd3, 0xb8, 0x3f,
-	0x91, 0xa2, 0xa3, 0xb2, 0xe1, 0x37, 0x41, 0xaa, 0x96, 0x5d, 0xd9, 0xd0, 0xc5, 0xcf, 0x06, 0x93, 0x59, 0xaf, 0x09,
-	0xed, 0x6e, 0xef, 0x12, 0x8b, 0x8f, 0xcb, 0x06, 0x7c, 0x3e, 0x7e, 0xfd, 0xbc, 0x8a, 0x7e, 0x9e, 0x0e, 0x7b, 0x4d,
-	0xf0, 0xdc, 0x70, 0x3a, 0x0f, 0x31, 0x24, 0x9e, 0x1b, 0x4d, 0xca, 0xab, 0x07, 0x37, 0xac, 0xb7, 0xd1, 0x0b, 0x93,
-	0x36, 0xf2, 0xca, 0x6b, 0x4f, 0x4d, 0x34, 0x6f, 0x96, 0xfb, 0xcf, 0xd1, 0x2e, 0xc3, 0x69, 0xe7, 0xb2, 0x51, 0xa8,
-	0xce, 0xb4, 0x8d, 0x86, 0xae, 0xf8, 0xac, 0x8c, 0xa2, 0x6f, 0xab, 0xdd, 0x36, 0x36, 0x32, 0x46, 0xc4, 0x64, 0x30,
-	0xd5, 0x88, 0x18, 0xcd, 0xcb, 0xc2, 0xdb, 0x87, 0xd8, 0x4f, 0x06, 0xa1, 0xd6, 0x7d, 0x09, 0x67, 0x29, 0x3a, 0xee,
-	0x97, 0x45, 0x1f, 0x9f, 0xe3, 0x65, 0x9b, 0x49, 0x67, 0x3b, 0x2c, 0x39, 0x30, 0x25, 0x3f, 0xef, 0x56, 0xf1, 0xb2,
-	0x93, 0x71, 0xac, 0x42, 0x70, 0xa5, 0x96, 0x6e, 0xca, 0xd2, 0x9f, 0xb6, 0x87, 0x9d, 0x76, 0x90, 0xf1, 0x1c, 0x8b,
-	0x0e, 0x4d, 0xd1, 0xf5, 0xd3, 0x2a, 0x19, 0xad, 0xbb, 0x6e, 0x08, 0xfa, 0xdc, 0x9b, 0xc6, 0xa3, 0xb2, 0xf0, 0x7e,
-	0xfd, 0x12, 0xcd, 0x20, 0x75, 0x28, 0x6a, 0x6c, 0xba, 0xea, 0x7e, 0xf5, 0x24, 0xde, 0x1b, 0x84, 0xd0, 0x0b, 0xcd,
-	0x9b, 0xe2, 0x85, 0x4d, 0x37, 0x5d, 0xe5, 0x38, 0x9d, 0xcc, 0xe5, 0xd2, 0x13, 0xb8, 0xf4, 0xd4, 0xa8, 0xc0, 0x5a,
-	0x4c, 0x3c, 0x9d, 0x49, 0xe1, 0x31, 0x14, 0x9e, 0x95, 0x61, 0x74, 0xb3, 0xdd, 0x6c, 0x63, 0x3d, 0xe6, 0x6d, 0x84,
-	0x0e, 0x83, 0x65, 0xc7, 0x61, 0x54, 0x8d, 0x65, 0xe7, 0x65, 0xd9, 0xfd, 0xea, 0x7e, 0xad, 0xe5, 0xc7, 0x93, 0x18,
-	0xa5, 0xc5, 0x29, 0x93, 0xe4, 0x42, 0x89, 0xff, 0x4d, 0x3b, 0xf2, 0x48, 0xfc, 0x9f, 0xcd, 0x82, 0x77, 0xc6, 0xa1,
-	0xac, 0xf4, 0xae, 0xc9, 0xa0, 0x2c, 0xbb, 0xfa, 0xf3, 0xb0, 0x8c, 0x62, 0x17, 0x2a, 0x19, 0x3a, 0xd6, 0x24, 0xdc,
-	0x76, 0x14, 0xea, 0x1f, 0x0b, 0x37, 0x65, 0xe1, 0xbb, 0x76, 0x66, 0xb0, 0x8a, 0x6e, 0x6c, 0x85, 0x28, 0x5c, 0xbb,
-	0x3f, 0x87, 0x6b, 0x8b, 0x1f, 0x27, 0x83, 0x81, 0xa8, 0xca, 0x6a, 0xdf, 0x0d, 0x8f, 0x51, 0x53, 0xa2, 0xc5, 0x43,
-	0xbf, 0x6d, 0x24, 0xa4, 0x27, 0xe2, 0xca, 0x79, 0xab, 0x7c, 0x6d, 0x4f, 0x17, 0xf5, 0x91, 0x88, 0x9e, 0x07, 0x57,
-	0xe7, 0xf0, 0x9f, 0x8c, 0x4b, 0x8d, 0xfb, 0x29, 0x06, 0x69, 0x1b, 0x4b, 0xd3, 0x3e, 0xa8, 0xd4, 0x64, 0x52, 0x96,
-	0xfb, 0x39, 0xa9, 0x53, 0x28, 0x17, 0xee, 0xa7, 0xe5, 0xa6, 0x65, 0xb9, 0xbf, 0xc7, 0x5b, 0xf7, 0x63, 0xcf, 0x9b,
-	0xce, 0xe6, 0x70, 0x6b, 0x23, 0xaf, 0xaf, 0xe0, 0x92, 0x53, 0x18, 0x4a, 0x26, 0xe2, 0xb9, 0x49, 0x77, 0xed, 0xdf,
-	0x7b, 0xbf, 0x40, 0xb9, 0x31, 0x94, 0x9b, 0xf6, 0x4b, 0x33, 0xfd, 0x03, 0xca, 0x05, 0x91, 0xd5, 0x72, 0xe2, 0xaa,
-	0xa9, 0x08, 0xc4, 0x3f, 0xa5, 0x8a, 0x31, 0xc0, 0x66, 0x6d, 0x7f, 0x4f, 0x55, 0x9c, 0x36, 0x65, 0x15, 0xff, 0x15,
-	0x2f, 0x39, 0x08, 0x97, 0x9c, 0xf5, 0xa1, 0xd5, 0xd3, 0x61, 0xa9, 0x39, 0xbf, 0xaa, 0x36, 0x0d, 0x27, 0x58, 0x45,
-	0xd3, 0xc9, 0x7e, 0x4b, 0x3d, 0xf7, 0x2c, 0x94, 0x98, 0x0c, 0xb1, 0xa4, 0xf1, 0xcb, 0xeb, 0x18, 0x78, 0xd3, 0xf6,
-	0xce, 0xe3, 0x19, 0x94, 0x9b, 0x94, 0x8d, 0x7e, 0xa3, 0x8d, 0x6e, 0x21, 0x2d, 0x97, 0x06, 0x3f, 0x09, 0xff, 0x7f,
-	0xa7, 0x1e, 0xd8, 0xef, 0xcd, 0x07, 0x78, 0x3d, 0xe3, 0x94, 0xdf, 0xb5, 0xdc, 0xac, 0x8f, 0xf5, 0x9b, 0x97, 0x46,
-	0x3c, 0x2f, 0xfc, 0x3c, 0x6b, 0x86, 0x6a, 0xc4, 0x59, 0xf2, 0x8b, 0xf8, 0xef, 0x2d, 0xf8, 0x65, 0x08, 0xb7, 0x9e,
-	0x19, 0xbf, 0xbc, 0xd3, 0x4b, 0x06, 0xd1, 0x2b, 0x2f, 0x69, 0xfc, 0xf2, 0x1e, 0x43, 0x07, 0x2f, 0x39, 0x2c, 0x6f,
-	0xfd, 0x47, 0xb4, 0xe2, 0x20, 0x06, 0xe3, 0x00, 0x86, 0x81, 0xd9, 0xa8, 0xb4, 0xe3, 0x85, 0x0c, 0x8b, 0x5d, 0x47,
-	0x18, 0x83, 0x21, 0x67, 0xc6, 0x31, 0x97, 0xb1, 0xe0, 0x20, 0xf6, 0xad, 0x22, 0x2a, 0x66, 0x93, 0xf2, 0xee, 0x0b,
-	0x19, 0x2b, 0x9a, 0xce, 0x98, 0x78, 0x4d, 0x71, 0xce, 0x7c, 0x14, 0xf5, 0xe0, 0x4a, 0x7a, 0x76, 0x6b, 0xf5, 0x10,
-	0x97, 0xd0, 0x0d, 0x67, 0xb3, 0xf2, 0x92, 0x1f, 0xa4, 0x9a, 0x6d, 0x2d, 0xe7, 0x78, 0x45, 0xd3, 0x67, 0xae, 0xe5,
-	0x8a, 0xb3, 0xee, 0xd6, 0x13, 0x2d, 0x38, 0x37, 0x9d, 0xe6, 0x3f, 0xb1, 0xff, 0x8f, 0x3b, 0xe7, 0x80, 0xbf, 0xe7,
-	0x66, 0xca, 0xf1, 0x31, 0xcc, 0xf1, 0xbf, 0xac, 0x1e, 0xf3, 0x3c, 0xa5, 0xe9, 0x6c, 0x3a, 0x09, 0x63, 0x6b, 0x13,
-	0x4d, 0xd3, 0x9d, 0x64, 0x26, 0x96, 0x1f, 0xc3, 0x39, 0x3a, 0x1c, 0x0f, 0x9a, 0x38, 0x0c, 0x0d, 0xfb, 0xd0, 0xe3,
-	0xe6, 0x43, 0xf7, 0x3e, 0x30, 0xb9, 0x19, 0xcc, 0xe4, 0x4e, 0x6d, 0x40, 0xe4, 0x3b, 0xa5, 0x8e, 0x25, 0x8a, 0xba,
-	0xdc, 0xdf, 0xac, 0xd7, 0x37, 0xeb, 0xdd, 0xcd, 0x21, 0x4e, 0x50, 0x07, 0xc3, 0x41, 0x98, 0xe6, 0x0e, 0xc3, 0x28,
-	0x30, 0xd0, 0x91, 0x69, 0x6e, 0x86, 0xb1, 0x43, 0x3b, 0x83, 0xde, 0x87, 0x35, 0x40, 0x1c, 0x71, 0xce, 0x9a, 0x36,
-	0x98, 0x83, 0x29, 0xc6, 0x21, 0x0a, 0xce, 0xd2, 0x2c, 0x72, 0x6e, 0xe6, 0x22, 0xdd, 0x14, 0x2f, 0x9b, 0xa1, 0x55,
-	0xe3, 0x51, 0xd0, 0xd7, 0xe1, 0x04, 0xf4, 0x78, 0x6e, 0xc6, 0xb4, 0x38, 0x31, 0x1a, 0xb7, 0x03, 0xeb, 0x28, 0xd4,
-	0x38, 0xd4, 0x2a, 0xcd, 0x5d, 0xe6, 0xb3, 0xd2, 0x1b, 0x1f, 0x63, 0xef, 0x1b, 0x74, 0x25, 0x27, 0xa3, 0x31, 0xf8,
-	0xc3, 0xcc, 0x44, 0x6e, 0x62, 0x0f, 0x98, 0xc7, 0x6b, 0x06, 0x36, 0x5f, 0x33, 0x2c, 0xa1, 0xca, 0x8b, 0xde, 0xe6,
-	0x31, 0x2c, 0x14, 0x9d, 0x62, 0xc0, 0x0e, 0xfa, 0x66, 0x2a, 0x22, 0x43, 0x6f, 0x5f, 0xae, 0x3a, 0xc4, 0xab, 0x36,
-	0xa5, 0xa3, 0x3e, 0xa9, 0x40, 0x8d, 0xda, 0x69, 0x67, 0xdb, 0xf8, 0xa0, 0x46, 0xeb, 0x30, 0xeb, 0xe8, 0xfe, 0xd8,
-	0xf4, 0x3e, 0x6d, 0xd2, 0xa9, 0x66, 0x3c, 0xbb, 0x8b, 0x03, 0x5f, 0xf0, 0x6b, 0x13, 0xc4, 0x77, 0x12, 0x86, 0x1a,
-	0xb8, 0x8d, 0xe9, 0x97, 0x31, 0x74, 0xe2, 0x98, 0x87, 0xab, 0x87, 0x41, 0x7f, 0x5c, 0xfa, 0x65, 0xad, 0xc2, 0x35,
-	0x9c, 0xb4, 0x91, 0x32, 0x4e, 0x05, 0x8d, 0x03, 0xff, 0x7f, 0x74, 0x76, 0x98, 0x1e, 0x87, 0xdb, 0x8f, 0x6c, 0x61,
-	0xe3, 0xba, 0x2f, 0x7a, 0xd5, 0xc9, 0xb4, 0x8f, 0xb7, 0x9f, 0x95, 0x57, 0xdd, 0xe0, 0xed, 0x1b, 0x2c, 0x28, 0x8e,
-	0x4b, 0xab, 0x90, 0x7b, 0x1d, 0x2a, 0xe6, 0x7d, 0x74, 0xdb, 0xc0, 0xb8, 0xed, 0xa1, 0x6c, 0x39, 0x14, 0x1c, 0x94,
-	0x05, 0xb7, 0xe8, 0xdf, 0xc9, 0x08, 0x9d, 0x36, 0x68, 0xca, 0xa2, 0x5f, 0x63, 0xd0, 0xce, 0xba, 0x65, 0x63, 0x17,
-	0x60, 0x50, 0xd6, 0xce, 0x3a, 0xe2, 0x65, 0xfb, 0x52, 0x76, 0x52, 0x94, 0x15, 0x2f, 0xa5, 0xb5, 0xc5, 0x4e, 0x1b,
-	0x35, 0x9a, 0x15, 0x75, 0xb5, 0x33, 0xc7, 0x58, 0x70, 0x28, 0x5d, 0x61, 0x84, 0x45, 0x27, 0x65, 0x80, 0x49, 0x07,
-	0x0b, 0xd1, 0x7c, 0xd6, 0x76, 0xfe, 0xa6, 0x9b, 0x65, 0x4a, 0xd1, 0x69, 0x59, 0xd5, 0x43, 0x57, 0x74, 0x3e, 0x8b,
-	0x16, 0x08, 0xc3, 0xe5, 0x78, 0xd8, 0xa4, 0xa2, 0x66, 0xba, 0xff, 0x24, 0x52, 0xd4, 0x0d, 0x98, 0x01, 0x83, 0x92,
-	0x66, 0x84, 0x7b, 0x96, 0x92, 0xed, 0x4c, 0x7f, 0x16, 0xac, 0xab, 0x25, 0x1b, 0x33, 0xd5, 0x8f, 0x13, 0xe7, 0x41,
-	0xe7, 0xa9, 0x11, 0xde, 0xbc, 0x31, 0xdd, 0xeb, 0xd8, 0x15, 0x4c, 0x91, 0x37, 0x19, 0x17, 0x17, 0x4d, 0x73, 0xc4,
-	0xae, 0xfb, 0x86, 0x75, 0x49, 0x2f, 0x4f, 0xcc, 0x3a, 0xc9, 0xd0, 0x82, 0xc3, 0xd2, 0xf6, 0xad, 0x62, 0xaa, 0x20,
-	0xcd, 0x47, 0x51, 0x2d, 0xc7, 0xed, 0x60, 0xd7, 0xe4, 0x73, 0xd2, 0x72, 0x6d, 0xd6, 0x17, 0x61, 0xd6, 0xc9, 0x67,
-	0xd3, 0x8c, 0xa3, 0x7c, 0x25, 0xc5, 0x6b, 0x25, 0x90, 0xef, 0xe0, 0x29, 0x72, 0x2b, 0xe4, 0x7a, 0x8f, 0x34, 0xef,
-	0x47, 0x49, 0x7e, 0x5c, 0x6f, 0x6e, 0x65, 0xc9, 0x14, 0xec, 0x33, 0x08, 0x8e, 0x1f, 0x87, 0x99, 0xc9, 0xb0, 0x5d,
-	0x69, 0x76, 0x27, 0x4d, 0xcc, 0x30, 0x13, 0x73, 0x0c, 0xb7, 0xdb, 0x67, 0x99, 0xa6, 0x77, 0x33, 0xa5, 0xb0, 0x54,
-	0x1d, 0xa3, 0x05, 0xf2, 0x74, 0x3a, 0x69, 0x61, 0x5a, 0xd5, 0x77, 0x72, 0x18, 0x6a, 0xd7, 0xea, 0xe1, 0xa4, 0x49,
-	0x3d, 0x70, 0x62, 0x96, 0x45, 0xed, 0x3a, 0x78, 0xb3, 0x7e, 0xb8, 0xd3, 0x3b, 0x84, 0xd5, 0xcb, 0x10, 0xb4, 0x76,
-	0x90, 0x26, 0xd4, 0x03, 0x19, 0x4d, 0x3f, 0xb5, 0x09, 0xae, 0x34, 0x01, 0x8f, 0xa9, 0xac, 0x76, 0x59, 0x39, 0x83,
-	0x95, 0xe2, 0x60, 0x62, 0x22, 0xfd, 0xb8, 0x82, 0x3c, 0xc6, 0x34, 0x74, 0xae, 0x3c, 0x0c, 0x0d, 0xd2, 0xdc, 0x3a,
-	0xaf, 0xd3, 0x36, 0xdb, 0xdd, 0x5a, 0x2e, 0xde, 0xd6, 0xa7, 0x09, 0x17, 0x9d, 0x4c, 0x60, 0xe6, 0x3c, 0x98, 0x18,
-	0x59, 0xda, 0xaf, 0xb4, 0x3e, 0xdd, 0x68, 0xd1, 0xf6, 0xa4, 0x76, 0x29, 0xd8, 0xe4, 0x33, 0x4c, 0xdc, 0xdf, 0x1c,
-	0x76, 0xbb, 0xd5, 0xc3, 0x4d, 0x8c, 0xc0, 0x50, 0xaa, 0x5d, 0xb1, 0x85, 0x60, 0x68, 0x97, 0x84, 0x72, 0x42, 0x4a,
-	0x65, 0x0c, 0x61, 0x9c, 0xdb, 0xaf, 0xbb, 0xdc, 0x5f, 0x1e, 0xe9, 0xc2, 0x5a, 0x7b, 0xd8, 0xc0, 0xb4, 0x63, 0x90,
-	0xe6, 0xe0, 0x29, 0x6a, 0x53, 0xda, 0x07, 0x06, 0xc8, 0x7e, 0x37, 0x40, 0x8e, 0x67, 0x58, 0xbb, 0xa9, 0xe9, 0x18,
-	0x77, 0x87, 0x75, 0x38, 0xe5, 0x7e, 0xab, 0xf3, 0x8b, 0x41, 0xeb, 0x90, 0x10, 0xc6, 0xa1, 0xe4, 0x68, 0x36, 0x4a,
-	0xa7, 0x99, 0x31, 0xa8, 0x3d, 0xad, 0xab, 0x22, 0x9c, 0xd6, 0xae, 0x4f, 0xba, 0x78, 0x81, 0xd3, 0x86, 0x95, 0xd3,
-	0x34, 0xa6, 0x43, 0xc0, 0xb4, 0xa7, 0x85, 0x60, 0x86, 0xd3, 0xcc, 0x50, 0xf4, 0x69, 0xad, 0x43, 0xde, 0x24, 0x84,
-	0x3f, 0x34, 0x67, 0x6c, 0x4a, 0x6e, 0xb0, 0xe4, 0x18, 0x4b, 0x1a, 0x47, 0xae, 0x1e, 0x6e, 0xd3, 0xf4, 0x28, 0x28,
-	0x47, 0x13, 0xca, 0x4d, 0xc2, 0xff, 0x5d, 0x45, 0x63, 0x79, 0xe3, 0xc6, 0xdb, 0xe5, 0xdd, 0x9d, 0x2c, 0x1c, 0x07,
-	0x5d, 0x37, 0x0c, 0xf6, 0x99, 0x34, 0x13, 0xf4, 0xc8, 0xdc, 0x3b, 0x23, 0x65, 0xe2, 0x46, 0x93, 0x74, 0x0e, 0xcc,
-	0x9a, 0x07, 0x69, 0xc6, 0x5e, 0xe6, 0x5b, 0xda, 0x6e, 0xb5, 0xda, 0xad, 0x6e, 0xe5, 0x6e, 0xfd, 0xce, 0xfe, 0x4d,
-	0x6b, 0xa6, 0x94, 0x62, 0x1a, 0xcc, 0x4c, 0x4f, 0xfc, 0xba, 0xdc, 0x2d, 0xef, 0x76, 0xcb, 0xaf, 0x9f, 0x55, 0x90,
-	0xdb, 0x09, 0x58, 0xeb, 0xfb, 0x7e, 0xea, 0x28, 0x69, 0x8e, 0x3e, 0x1c, 0x8b, 0x16, 0x1d, 0x82, 0xfb, 0xa2, 0x17,
-	0x02, 0x35, 0x08, 0x02, 0x36, 0x6a, 0xda, 0xdc, 0x4a, 0xbe, 0x87, 0x49, 0x35, 0x69, 0x60, 0x7e, 0x5c, 0xee, 0x63,
-	0x6c, 0x8e, 0xba, 0x09, 0xd3, 0x24, 0xc4, 0xee, 0x24, 0xe8, 0x50, 0xb2, 0x75, 0x9a, 0xb9, 0xdb, 0xd8, 0xcc, 0xa7,
-	0x75, 0x39, 0xc0, 0x51, 0x3b, 0x87, 0x1d, 0xe2, 0x69, 0x13, 0xff, 0x34, 0x4c, 0xeb, 0x35, 0x5d, 0x5a, 0x6f, 0x3c,
-	0xc3, 0x09, 0xc9, 0xcc, 0xb8, 0x36, 0xc7, 0x34, 0x9c, 0xd8, 0x4e, 0xbe, 0x26, 0xdd, 0xfc, 0x52, 0xc3, 0x2c, 0x4d,
-	0xf1, 0xc3, 0x48, 0x17, 0x6f, 0xb8, 0xda, 0x6c, 0xd6, 0x5f, 0xf7, 0xeb, 0x38, 0x54, 0x76, 0x89, 0x8d, 0xf9, 0x70,
-	0xae, 0xf9, 0xae, 0x41, 0x9a, 0xeb, 0xe7, 0x13, 0x82, 0xbb, 0x1e, 0x3f, 0x6f, 0x0f, 0x39, 0x53, 0x39, 0x8d, 0x6b,
-	0x93, 0x30, 0xef, 0x82, 0xe4, 0xd0, 0x60, 0x6e, 0xa6, 0x0d, 0x29, 0xab, 0xa0, 0x62, 0xdb, 0x8e, 0xca, 0x21, 0x5a,
-	0xc7, 0xe3, 0x39, 0x88, 0xad, 0x9d, 0xa0, 0x07, 0xf7, 0x4a, 0x56, 0xa9, 0xcd, 0xa1, 0x4e, 0x42, 0x8b, 0xda, 0xce,
-	0x36, 0x1d, 0xe7, 0xdb, 0x8c, 0xca, 0xf2, 0xcb, 0x9b, 0xc3, 0x63, 0x2c, 0xdf, 0x48, 0xf9, 0x71, 0x9b, 0xd2, 0xd1,
-	0xf2, 0x26, 0x35, 0x18, 0x27, 0xf1, 0x9f, 0x36, 0xab, 0x97, 0x1c, 0xe5, 0xed, 0x49, 0xa3, 0x36, 0xe1, 0xa1, 0x27,
-	0xd9, 0xb9, 0x02, 0x0c, 0x33, 0x43, 0xc9, 0x54, 0xc2, 0x22, 0x63, 0x90, 0x66, 0xe4, 0xa9, 0xfc, 0xfd, 0xf2, 0x66,
-	0x97, 0xf2, 0x29, 0xed, 0xcc, 0xa2, 0xbd, 0x41, 0x08, 0xbe, 0xc9, 0x34, 0x39, 0x33, 0x4d, 0xcc, 0x75, 0x59, 0xb2,
-	0x4a, 0xad, 0x1e, 0xc7, 0x56, 0x8c, 0x42, 0x43, 0xa1, 0x42, 0x26, 0xdb, 0x74, 0xbb, 0x7d, 0x5c, 0xde, 0xe4, 0x71,
-	0xa9, 0x09, 0x62, 0x36, 0x69, 0xe7, 0x9a, 0xb3, 0x56, 0x0b, 0x24, 0x29, 0xd4, 0xa4, 0x79, 0x7a, 0x3e, 0x67, 0x1d,
-	0x7a, 0x5b, 0xf2, 0xfb, 0x20, 0xd4, 0xbd, 0x3d, 0xa5, 0x7d, 0xe2, 0x03, 0xa7, 0x18, 0x01, 0xdc, 0xa5, 0x61, 0xac,
-	0xbd, 0xd8, 0x38, 0x68, 0x7e, 0xdb, 0x75, 0xa6, 0x69, 0x9e, 0xd4, 0xf4, 0x8d, 0xef, 0x6e, 0x56, 0xb7, 0x21, 0x26,
-	0xe3, 0x72, 0xa4, 0x4b, 0x8e, 0xb6, 0x0f, 0x64, 0x9a, 0x26, 0x67, 0xfc, 0x9b, 0xbe, 0xcd, 0xd3, 0x1e, 0x1e, 0xee,
-	0x96, 0xbb, 0xc3, 0xfd, 0x66, 0x79, 0x78, 0xd4, 0x6a, 0xf5, 0x65, 0x6d, 0x32, 0xce, 0xa7, 0x19, 0x77, 0x6c, 0xef,
-	0xb6, 0x0f, 0xab, 0x2f, 0xb9, 0x6b, 0x76, 0x77, 0xe9, 0x26, 0x87, 0x52, 0xdc, 0x78, 0xe3, 0x66, 0x99, 0x9d, 0x31,
-	0x9a, 0xc7, 0x10, 0x69, 0x53, 0x51, 0x7a, 0x79, 0xea, 0x21, 0xf7, 0x56, 0x35, 0xc3, 0xc4, 0x7d, 0xa0, 0xb2, 0xd9,
-	0xa4, 0x19, 0x4c, 0x3e, 0xe3, 0xa7, 0x98, 0x44, 0x6a, 0xa7, 0x68, 0x83, 0x76, 0x4a, 0x99, 0xbb, 0x6d, 0xd3, 0xa4,
-	0xca, 0x4c, 0x63, 0xc9, 0xed, 0xee, 0xf6, 0xd3, 0xea, 0x7e, 0x9d, 0xf3, 0x90, 0xed, 0x6c, 0x68, 0x14, 0xd6, 0x49,
-	0xa3, 0x30, 0xfe, 0xe5, 0x80, 0x6a, 0x86, 0x66, 0x62, 0xfd, 0x46, 0x97, 0xb9, 0xc3, 0x91, 0xcd, 0xc5, 0x34, 0xe9,
-	0x49, 0x4a, 0x4e, 0x9e, 0x40, 0xe9, 0x71, 0xb7, 0xee, 0x9c, 0xb5, 0xd1, 0x94, 0xd2, 0xdf, 0x4d, 0x7a, 0x98, 0x92,
-	0xab, 0x7f, 0xfe, 0x4b, 0x1a, 0xa5, 0xba, 0x8e, 0xdd, 0xce, 0xbf, 0xa1, 0x2e, 0xc9, 0x69, 0x93, 0x71, 0x6a, 0xc1,
-	0x7d, 0x98, 0x7c, 0x1d, 0x36, 0xda, 0x84, 0x61, 0x6c, 0xc2, 0x0c, 0x9b, 0x90, 0x1e, 0x2a, 0xa4, 0x85, 0xc9, 0x32,
-	0x16, 0xee, 0x32, 0xa3, 0xa3, 0xa0, 0x3b, 0xb0, 0x8e, 0x68, 0x46, 0x66, 0xb1, 0x75, 0xdb, 0x8e, 0xd4, 0xfb, 0x3d,
-	0xae, 0xb9, 0x1a, 0x98, 0xcc, 0x36, 0x23, 0xbb, 0x3a, 0xd2, 0x06, 0x77, 0x19, 0x96, 0x11, 0xa6, 0x96, 0x9a, 0x94,
-	0x65, 0xcf, 0x0b, 0x1a, 0x2d, 0xdd, 0xb4, 0x73, 0xe5, 0xa0, 0xb2, 0xa1, 0xf6, 0xe3, 0x49, 0x8a, 0x87, 0x94, 0x6a,
-	0x4f, 0xe9, 0x93, 0x6d, 0xac, 0xb9, 0xac, 0x80, 0xe6, 0x61, 0x8c, 0xd5, 0x9a, 0x8f, 0x8d, 0xea, 0x85, 0xb1, 0xf0,
-	0x3e, 0xe8, 0xe4, 0xc7, 0xcd, 0x3e, 0xd5, 0x3d, 0xae, 0x19, 0x5a, 0xb5, 0x18, 0xc4, 0x73, 0xce, 0x06, 0x65, 0xe5,
-	0x7f, 0x2d, 0x3a, 0x66, 0x5c, 0xe4, 0x04, 0x77, 0xcd, 0x07, 0xe3, 0xb2, 0x7c, 0x1e, 0xd3, 0x55, 0xf2, 0x64, 0x25,
-	0xdd, 0x8e, 0xe9, 0x39, 0x9c, 0x6d, 0xf1, 0xa5, 0x6a, 0x8b, 0xa4, 0x08, 0x26, 0x6d, 0xc2, 0xc6, 0x16, 0xcf, 0x6b,
-	0x1d, 0xea, 0x93, 0xb2, 0xee, 0x99, 0xce, 0x46, 0xf5, 0x9b, 0xac, 0xb4, 0x8f, 0xa5, 0x3a, 0x0d, 0x9c, 0xe2, 0x39,
-	0x7d, 0x54, 0x6a, 0x51, 0x4e, 0x23, 0x71, 0x9b, 0x65, 0xb2, 0x7f, 0xbb, 0x7e, 0x5a, 0xdf, 0xaa, 0x1b, 0xc2, 0x12,
-	0xa7, 0x13, 0xe1, 0xd1, 0xac, 0x72, 0x7d, 0x35, 0x11, 0x5c, 0x3c, 0xcd, 0x45, 0x53, 0xe9, 0x9c, 0xa3, 0x36, 0x63,
-	0x82, 0x64, 0xab, 0x9d, 0x33, 0xb2, 0x4d, 0xf5, 0xfa, 0xc9, 0xa6, 0x9e, 0x0b, 0x72, 0x4e, 0x8f, 0x06, 0x1d, 0xcd,
-	0xee, 0x55, 0xef, 0x71, 0xd4, 0x7b, 0xe0, 0x8a, 0xae, 0xea, 0x82, 0x7d, 0xf7, 0x8c, 0x0c, 0x46, 0x85, 0x76, 0x15,
-	0xdc, 0x4a, 0x63, 0xb1, 0x0c, 0x66, 0xc7, 0x95, 0x55, 0x83, 0xdc, 0x4c, 0xbd, 0x39, 0x79, 0x58, 0x28, 0x1a, 0x32,
-	0x69, 0x2a, 0xc5, 0x4b, 0x67, 0xe3, 0x29, 0xb5, 0x10, 0x5f, 0x82, 0xc2, 0xb7, 0x06, 0x6e, 0x1a, 0x93, 0xd8, 0xa2,
-	0x7b, 0x80, 0xc3, 0x4f, 0x19, 0x37, 0x47, 0x39, 0xdc, 0xa0, 0x8d, 0xef, 0xd6, 0x4e, 0xc5, 0xc2, 0xde, 0x46, 0xd4,
-	0x2f, 0x45, 0x23, 0xf2, 0xc3, 0x02, 0x6a, 0x41, 0x7e, 0xf8, 0x10, 0x26, 0x00, 0xf2, 0x9c, 0x64, 0xd2, 0xd8, 0x27,
-	0x10, 0x59, 0x01, 0x64, 0x8a, 0x6a, 0x3d, 0x37, 0x98, 0xc8, 0x5e, 0x86, 0x30, 0x77, 0x3b, 0x23, 0x2f, 0x0c, 0xa7,
-	0x72, 0x52, 0xda, 0x96, 0x90, 0x65, 0x35, 0x34, 0x7a, 0x08, 0x12, 0x4c, 0x6d, 0x80, 0x69, 0x49, 0x6e, 0xc1, 0x6c,
-	0x32, 0xf2, 0x7d, 0x70, 0x03, 0x5d, 0x7a, 0x5e, 0xef, 0xd2, 0xd9, 0x65, 0x39, 0x28, 0x20, 0x11, 0x99, 0xa7, 0x0a,
-	0xd6, 0x3c, 0xbf, 0x53, 0xb0, 0xce, 0x63, 0x93, 0x8b, 0x87, 0x02, 0x56, 0x29, 0x37, 0xea, 0xe5, 0x6e, 0x50, 0x18,
-	0x87, 0x13, 0xea, 0x7d, 0x54, 0x67, 0x92, 0x58, 0xa3, 0x9a, 0xee, 0x5d, 0x90, 0x13, 0xda, 0x2c, 0x6d, 0x5b, 0xa5,
-	0x22, 0x5d, 0x6f, 0x1b, 0xf2, 0x77, 0x08, 0x3c, 0x78, 0x28, 0x55, 0xaf, 0x95, 0x4e, 0x25, 0x93, 0x72, 0x0c, 0xe6,
-	0x27, 0x5c, 0x56, 0x4e, 0xf4, 0xea, 0x71, 0xa7, 0x2a, 0x90, 0xbd, 0x26, 0x59, 0xb0, 0x93, 0x5e, 0xdb, 0xe3, 0x94,
-	0xed, 0xa4, 0x60, 0xe4, 0x3c, 0xa8, 0xf1, 0xc1, 0xa8, 0x5d, 0x7c, 0xd9, 0xcb, 0x8f, 0xe6, 0xf2, 0x84, 0x73, 0xfb,
-	0x6d, 0xf5, 0x70, 0x17, 0x4b, 0xcf, 0xbb, 0x54, 0xd3, 0x04, 0xe6, 0x21, 0xd6, 0x96, 0xef, 0x21, 0xe2, 0xd2, 0xa3,
-	0x17, 0x16, 0xed, 0xf4, 0x94, 0x8d, 0xfc, 0xd5, 0x97, 0x7e, 0x5c, 0x3c, 0x71, 0xa3, 0x8e, 0x6f, 0xf4, 0x0e, 0x92,
-	0x7a, 0xf5, 0xd0, 0x36, 0xe7, 0x9c, 0x0a, 0xa7, 0x3c, 0xa6, 0x40, 0x5f, 0x8b, 0xe3, 0x49, 0x88, 0x20, 0xea, 0x6b,
-	0x39, 0xbf, 0x09, 0x5e, 0x6b, 0xc7, 0xff, 0x71, 0x9b, 0x66, 0xa8, 0x55, 0xe7, 0x06, 0x7d, 0x36, 0x95, 0x7e, 0x53,
-	0xa4, 0xe8, 0x6d, 0xa3, 0xff, 0x63, 0x96, 0x0b, 0xe9, 0x69, 0x0c, 0x45, 0x51, 0x0a, 0xbb, 0x8b, 0xcf, 0xdb, 0x1d,
-	0x3a, 0x62, 0x30, 0x71, 0x7a, 0x40, 0x9a, 0x6c, 0xe2, 0x62, 0x07, 0x9e, 0xd7, 0x51, 0x63, 0xb3, 0x9b, 0x61, 0xfe,
-	0x52, 0x75, 0x73, 0x7e, 0xc2, 0xa6, 0x85, 0xd3, 0x63, 0xb6, 0x70, 0x19, 0x8e, 0x8a, 0x91, 0xac, 0x71, 0xd4, 0x90,
-	0x69, 0xba, 0x16, 0x16, 0x29, 0xd5, 0xde, 0x7b, 0x89, 0x75, 0x87, 0x71, 0x83, 0xea, 0x9e, 0xc3, 0x27, 0xab, 0x1c,
-	0x06, 0x8e, 0x55, 0xb9, 0xbc, 0x6c, 0x6c, 0x77, 0x5e, 0xec, 0x0f, 0x5d, 0xba, 0x23, 0x26, 0x55, 0xc2, 0x22, 0xb9,
-	0x69, 0x53, 0x4e, 0x23, 0xd8, 0x16, 0x44, 0x06, 0x85, 0x25, 0x30, 0xd8, 0xb3, 0x3e, 0x7d, 0xd1, 0xf2, 0xf9, 0x39,
-	0x7b, 0xbd, 0xb0, 0xce, 0x06, 0x63, 0xe1, 0xc6, 0x13, 0x2b, 0x99, 0x75, 0xdd, 0x1f, 0x36, 0x8f, 0xeb, 0xaf, 0x9b,
-	0x98, 0xd4, 0x0b, 0xaa, 0x33, 0xe8, 0xf2, 0x98, 0xe3, 0xbe, 0x8d, 0x9a, 0x64, 0x1c, 0xf5, 0xd5, 0xa9, 0x6e, 0xa5,
-	0x8a, 0x0b, 0xeb, 0xb2, 0xf4, 0x5c, 0x94, 0xea, 0x92, 0xa4, 0xe4, 0xeb, 0x72, 0xf7, 0xb8, 0x5e, 0x6e, 0x6e, 0xd7,
-	0x9f, 0xe2, 0x93, 0xa1, 0x51, 0x2b, 0x56, 0x61, 0xd6, 0x3e, 0x1b, 0xd7, 0x7b, 0xca, 0xb1, 0x18, 0xb4, 0x8b, 0x59,
-	0x54, 0x5a, 0xf2, 0xd2, 0xc0, 0x64, 0xe4, 0xad, 0x1d, 0x8f, 0xa8, 0x4e, 0x59, 0x0b, 0x8d, 0x30, 0x44, 0x41, 0x1c,
-	0x9d, 0x98, 0xf8, 0xfe, 0x62, 0xa7, 0x5b, 0x59, 0xd0, 0xab, 0x03, 0x46, 0xd1, 0x86, 0x24, 0x3d, 0xed, 0x72, 0xce,
-	0x36, 0x21, 0x4f, 0xe9, 0xca, 0xa9, 0x4a, 0xff, 0xfb, 0x67, 0xdc, 0x40, 0x8f, 0x9c, 0xd7, 0xa7, 0xb3, 0xf9, 0xc9,
-	0x11, 0xd8, 0xa8, 0x7b, 0x28, 0x31, 0xf6, 0x5a, 0x9c, 0x82, 0x02, 0xba, 0x18, 0x44, 0x45, 0x4e, 0x85, 0xf0, 0xcc,
-	0x40, 0xa5, 0xf0, 0xbb, 0x0e, 0xf8, 0x15, 0x6a, 0x32, 0xaa, 0x4e, 0x08, 0x60, 0xbb, 0x59, 0x58, 0x78, 0xcb, 0x9e,
-	0xb3, 0x2e, 0xe2, 0x26, 0xed, 0xd3, 0xd8, 0xbe, 0xbd, 0x78, 0x7a, 0x88, 0xb1, 0xdb, 0x7e, 0x59, 0x3d, 0xa4, 0x47,
-	0x19, 0xe3, 0x56, 0x4e, 0x42, 0x23, 0xdb, 0x4d, 0x64, 0x39, 0xd9, 0x68, 0xe7, 0x64, 0xbb, 0xd5, 0xdd, 0x7a, 0xaf,
-	0x49, 0xcd, 0xf1, 0x58, 0x26, 0x65, 0x23, 0x1e, 0x90, 0xf2, 0x38, 0x06, 0xa9, 0x1f, 0xd8, 0x32, 0x52, 0x6f, 0x72,
-	0xa9, 0xe5, 0x93, 0xb4, 0x53, 0x92, 0xb5, 0x5c, 0xd6, 0xf6, 0xfb, 0x43, 0x18, 0x27, 0x75, 0x7b, 0x4f, 0xfb, 0x6c,
-	0x41, 0x1e, 0x36, 0xda, 0x86, 0xe7, 0x20, 0x55, 0x41, 0xa9, 0xc7, 0x67, 0x1e, 0xba, 0xac, 0x0b, 0x46, 0x27, 0x26,
-	0x59, 0x5b, 0x08, 0x06, 0x78, 0xa0, 0x48, 0xc1, 0x90, 0x07, 0x2e, 0xc8, 0xee, 0xe5, 0x41, 0xab, 0x36, 0xa7, 0xff,
-	0x8f, 0x46, 0x4e, 0xbd, 0xf0, 0x78, 0x14, 0xab, 0x2d, 0x5b, 0xa4, 0x74, 0x5b, 0x55, 0x7c, 0x62, 0xd7, 0xe5, 0x02,
-	0x2a, 0xe3, 0xd6, 0x2f, 0x8f, 0xf2, 0xb0, 0xb8, 0x3a, 0x9f, 0xcf, 0x93, 0x42, 0x1c, 0xa1, 0x3b, 0x0d, 0xef, 0xe6,
-	0x91, 0x33, 0x67, 0xa2, 0x97, 0xa7, 0xb6, 0x76, 0x3a, 0x33, 0x94, 0xd9, 0x67, 0xf1, 0xb4, 0xd7, 0x1a, 0xff, 0x11,
-	0x24, 0x34, 0x3e, 0xc8, 0x6c, 0xf7, 0xf6, 0xcd, 0xac, 0x39, 0xb3, 0x32, 0xc0, 0xaa, 0x67, 0xda, 0x4f, 0x13, 0x87,
-	0x53, 0xcb, 0x2a, 0x38, 0x61, 0x90, 0x56, 0x25, 0xc5, 0x9e, 0x14, 0x1a, 0x5f, 0xc0, 0x63, 0x51, 0xd3, 0xfb, 0x27,
-	0x06, 0xa3, 0x42, 0xa9, 0x64, 0x9a, 0xe4, 0x65, 0x01, 0x52, 0xfd, 0x21, 0x30, 0x4f, 0xac, 0x53, 0xf3, 0x23, 0x4e,
-	0x53, 0x97, 0x76, 0x8e, 0x44, 0x85, 0xb3, 0x96, 0x43, 0x53, 0xdb, 0x2b, 0x77, 0x6b, 0xce, 0xe2, 0xe1, 0x3d, 0x8d,
-	0xd3, 0x3c, 0xf5, 0x77, 0xc7, 0xe9, 0x1c, 0xfc, 0x30, 0x95, 0x91, 0xd8, 0xf7, 0x84, 0x33, 0x0b, 0x3f, 0xf4, 0x95,
-	0x2c, 0xfb, 0x63, 0xee, 0x2b, 0x79, 0x2a, 0x0f, 0x1d, 0x71, 0x58, 0x17, 0xf1, 0xdc, 0xde, 0x32, 0xeb, 0xd4, 0x8d,
-	0x5c, 0xe3, 0xb1, 0x33, 0x30, 0xa6, 0xd6, 0xda, 0x1c, 0xc6, 0xff, 0x64, 0x6a, 0x72, 0x09, 0x53, 0x99, 0xd3, 0xcb,
-	0x72, 0x59, 0x35, 0xaf, 0x36, 0x8f, 0xb2, 0x16, 0x69, 0x7b, 0x63, 0x88, 0xe5, 0xf6, 0xd9, 0x8e, 0x6b, 0xcd, 0xc7,
-	0x3c, 0x45, 0x8d, 0xdb, 0x0d, 0x66, 0xe5, 0x7e, 0x16, 0x9a, 0x8a, 0x3d, 0x6f, 0x8b, 0x89, 0x58, 0x68, 0x70, 0x33,
-	0x6b, 0x77, 0x8d, 0xcf, 0x4f, 0x4c, 0xc4, 0xca, 0xc4, 0x05, 0x36, 0x98, 0xc4, 0x56, 0x6a, 0x75, 0x1f, 0xb7, 0x0a,
-	0x74, 0x69, 0xc5, 0x76, 0x57, 0x83, 0x97, 0x52, 0xc8, 0x1e, 0x50, 0xe3, 0x48, 0x8a, 0xf3, 0x44, 0x5a, 0x6e, 0x4b,
-	0x69, 0xb9, 0xb4, 0xe1, 0xc6, 0x4b, 0xcb, 0x65, 0x25, 0xc7, 0x0e, 0x3f, 0x89, 0x31, 0x5d, 0xec, 0x71, 0xb4, 0xb7,
-	0xb9, 0xd5, 0xb4, 0x45, 0xbe, 0xfe, 0x9c, 0x8b, 0xcf, 0x86, 0xa3, 0x5e, 0x9e, 0xe0, 0x06, 0x09, 0xdd, 0x05, 0x29,
-	0x95, 0xe7, 0x49, 0x73, 0x19, 0xf2, 0x1c, 0xbb, 0xe6, 0x39, 0x3d, 0xca, 0xe3, 0x4c, 0x12, 0xf8, 0xc5, 0xee, 0xb9,
-	0x3c, 0xf9, 0x93, 0x9e, 0xbc, 0x31, 0x93, 0x82, 0xf1, 0xe4, 0xc4, 0x92, 0xfc, 0xb5, 0x95, 0xd2, 0x99, 0x08, 0x70,
-	0xb1, 0xd1, 0xd1, 0xb6, 0xfc, 0x8d, 0x59, 0x95, 0xb4, 0x38, 0xc5, 0x69, 0x4e, 0x98, 0xeb, 0x8b, 0x1a, 0x5d, 0x68,
-	0xb4, 0x9b, 0xcb, 0xc3, 0x68, 0x3a, 0x68, 0x77, 0xe3, 0xd0, 0x1d, 0x74, 0x5e, 0x56, 0xae, 0xe5, 0x41, 0xc1, 0x6c,
-	0xa7, 0xcb, 0x83, 0x3d, 0x84, 0x48, 0xda, 0xfc, 0x59, 0x9f, 0x19, 0x80, 0x60, 0x48, 0x16, 0x79, 0x52, 0x5f, 0xc9,
-	0xbc, 0x31, 0x8b, 0xed, 0x76, 0x1c, 0xae, 0xfa, 0x39, 0x04, 0xd1, 0xe7, 0xe5, 0x26, 0x4e, 0xbc, 0x07, 0xc3, 0x26,
-	0xba, 0x78, 0x3c, 0x63, 0x17, 0xa7, 0xe1, 0xb5, 0xcd, 0xde, 0xc3, 0xd8, 0x3a, 0x97, 0x4d, 0xdc, 0x34, 0xb6, 0xe6,
-	0xf0, 0x36, 0xea, 0x02, 0x93, 0x83, 0xfa, 0x34, 0x54, 0x53, 0x29, 0x71, 0x1a, 0x1a, 0x46, 0x31, 0x9e, 0x66, 0x25,
-	0x25, 0xe2, 0x47, 0x4d, 0x49, 0x90, 0x66, 0xce, 0x08, 0x95, 0x3b, 0x90, 0x5d, 0xab, 0x9e, 0x9a, 0xaa, 0xaf, 0x30,
-	0xbf, 0x96, 0xbc, 0xeb, 0x28, 0x76, 0x7e, 0x56, 0xa0, 0x53, 0x3f, 0xdc, 0xac, 0x46, 0x0d, 0x06, 0x2f, 0x48, 0x5f,
-	0x2b, 0x1d, 0xd1, 0x9f, 0x9c, 0xea, 0x6b, 0xba, 0x20, 0xd6, 0x6d, 0xaa, 0xf5, 0xe5, 0x36, 0xf5, 0x9d, 0x53, 0xdd,
-	0x33, 0x0b, 0x25, 0x1b, 0x57, 0xc4, 0x72, 0xde, 0x77, 0x6e, 0x96, 0x7a, 0xf5, 0x6d, 0x18, 0xcf, 0x57, 0xe9, 0x85,
-	0x87, 0x71, 0x58, 0x9f, 0xb5, 0x8f, 0xca, 0x5b, 0x71, 0xb2, 0x39, 0xd8, 0x14, 0x24, 0xda, 0x1b, 0x4e, 0xc5, 0x87,
-	0xce, 0xc2, 0x96, 0x36, 0x2f, 0xe1, 0xa6, 0xe6, 0xf2, 0x4a, 0x45, 0x2f, 0x7f, 0x32, 0x2b, 0x34, 0x4a, 0x13, 0xdf,
-	0xdb, 0xf5, 0x8d, 0x04, 0x78, 0xbb, 0x11, 0xee, 0x6c, 0xd4, 0x6e, 0x79, 0x69, 0xfb, 0x45, 0xa5, 0x3e, 0xaf, 0x28,
-	0xbd, 0x75, 0x6a, 0x5a, 0x6d, 0x1d, 0xd1, 0xc8, 0xec, 0xab, 0xd8, 0xff, 0x46, 0x8b, 0x27, 0xe8, 0x12, 0x79, 0xf1,
-	0xd4, 0x0c, 0x2b, 0xe6, 0xd4, 0xc2, 0xd9, 0x9c, 0x27, 0x7a, 0xd0, 0x7b, 0x5b, 0xa3, 0xa9, 0xd4, 0xa8, 0xd8, 0x21,
-	0xcd, 0x32, 0x53, 0x39, 0xab, 0x78, 0x82, 0x49, 0x13, 0x43, 0xad, 0x5a, 0x9c, 0x15, 0x8e, 0x06, 0xdc, 0x8e, 0x5c,
-	0x18, 0x06, 0xb9, 0xa6, 0x2f, 0x83, 0x5c, 0xdf, 0x99, 0x35, 0xe7, 0x13, 0xe0, 0xb1, 0x76, 0xca, 0x97, 0xd0, 0xc3,
-	0x8b, 0x14, 0xda, 0xf0, 0xe8, 0x1f, 0x27, 0x00, 0xb6, 0x32, 0x79, 0xce, 0x69, 0x52, 0x6d, 0x69, 0x7f, 0x1d, 0x49,
-	0xbc, 0x66, 0x04, 0x96, 0x94, 0x93, 0xaf, 0x4b, 0x3c, 0x4e, 0x52, 0xd3, 0xa3, 0xef, 0xe2, 0x8d, 0x00, 0xab, 0x49,
-	0x5f, 0x6a, 0x89, 0xf6, 0x62, 0xbb, 0x29, 0x25, 0x7e, 0xf2, 0x32, 0x79, 0xd6, 0x74, 0xbb, 0x1b, 0xda, 0xa7, 0x6d,
-	0xc3, 0x7e, 0x6d, 0x94, 0xb2, 0x69, 0x90, 0xb8, 0x4f, 0xf3, 0xc4, 0xe3, 0x97, 0x07, 0x18, 0xcf, 0xa3, 0x74, 0x0f,
-	0xb8, 0xa3, 0xe5, 0xa9, 0x9b, 0x6d, 0xc2, 0x58, 0x12, 0xbd, 0xc5, 0xa6, 0x4d, 0xdb, 0x84, 0xcd, 0xf6, 0xae, 0xed,
-	0x9e, 0x0f, 0xdb, 0x24, 0x48, 0xe3, 0x6e, 0x7d, 0x5d, 0xbc, 0x37, 0x43, 0x3d, 0xa2, 0x98, 0xf0, 0xa1, 0xc6, 0x90,
-	0xf7, 0x92, 0x66, 0x14, 0x67, 0xa0, 0x6c, 0x50, 0xae, 0x45, 0x64, 0x23, 0x54, 0x48, 0x07, 0xc6, 0x56, 0xc1, 0xdb,
-	0x2d, 0x09, 0x61, 0xb1, 0x37, 0x9e, 0x56, 0x86, 0xb9, 0x3b, 0x5a, 0x19, 0xc2, 0x58, 0x41, 0x62, 0x93, 0xce, 0x5a,
-	0xc9, 0x62, 0x35, 0x35, 0x62, 0xda, 0xe7, 0x9e, 0x9d, 0x63, 0x16, 0x16, 0xce, 0x31, 0x5e, 0x4f, 0x4c, 0x44, 0x1f,
-	0x28, 0xa0, 0xc6, 0x12, 0x50, 0x8d, 0x23, 0x4c, 0x79, 0xc7, 0xc6, 0x43, 0x99, 0x07, 0x1d, 0x8c, 0x66, 0xdd, 0xfc,
-	0x7b, 0x38, 0x73, 0x26, 0x11, 0x79, 0x82, 0x8c, 0x13, 0x9a, 0x6e, 0x81, 0x12, 0x6e, 0x51, 0x5d, 0xff, 0xfc, 0x72,
-	0x90, 0x17, 0xed, 0xe0, 0x25, 0xd3, 0x5f, 0x1e, 0x6e, 0xe1, 0xfd, 0x54, 0x79, 0x63, 0xf5, 0xf5, 0x6a, 0xf7, 0xf0,
-	0x6a, 0xf9, 0xb8, 0x84, 0xc3, 0xb7, 0xcb, 0x75, 0x98, 0xbf, 0x36, 0xa3, 0xd9, 0xe0, 0xc7, 0x1f, 0x5e, 0xbf, 0xfd,
-	0xd0, 0xfb, 0xa9, 0x17, 0xae, 0xdf, 0xbe, 0xe2, 0x2a, 0x07, 0x71, 0x16, 0x80, 0x48, 0x34, 0x59, 0x81, 0xc8, 0xa4,
-	0x16, 0xb0, 0x7f, 0xb6, 0x4f, 0xef, 0xf2, 0x41, 0x1c, 0xed, 0x11, 0x41, 0x53, 0x02, 0x7e, 0x8e, 0xd7, 0x38, 0xa7,
-	0x7b, 0xe3, 0x4a, 0x0c, 0xe1, 0x1c, 0x8a, 0x08, 0xc6, 0x31, 0x0d, 0x91, 0x62, 0xac, 0x46, 0x42, 0xac, 0x8d, 0x50,
-	0xdc, 0x28, 0x81, 0x48, 0x94, 0x43, 0x40, 0xde, 0xe1, 0xc1, 0x45, 0xef, 0x6c, 0xae, 0x07, 0x62, 0x23, 0x44, 0xb0,
-	0xc1, 0x8a, 0x5f, 0x62, 0xeb, 0xe5, 0x51, 0x2e, 0x22, 0xd8, 0x60, 0x80, 0xb5, 0xc1, 0x00, 0x4a, 0x83, 0x01, 0x29,
-	0x1b, 0x0c, 0x44, 0x6a, 0x30, 0x40, 0xa2, 0xaf, 0x08, 0x75, 0x83, 0x05, 0x00, 0x8b, 0xde, 0xd9, 0x2c, 0x1f, 0x5c,
-	0xf5, 0xce, 0x26, 0xf9, 0xe0, 0x3a, 0xc4, 0xe4, 0x40, 0x8f, 0xa4, 0x1d, 0x08, 0x69, 0x8d, 0x01, 0x3d, 0xf4, 0xce,
-	0x86, 0x7a, 0x20, 0x67, 0x01, 0x82, 0xad, 0x07, 0x58, 0xaf, 0x05, 0xa0, 0xb4, 0x1e, 0x90, 0xb2, 0xf5, 0x40, 0xa4,
-	0xd6, 0x03, 0x94, 0x5a, 0x0f, 0x50, 0x6c, 0xbd, 0x02, 0x4f, 0xe8, 0xee, 0x67, 0x64, 0x8e, 0xc5, 0x01, 0x35, 0xe3,
-	0xe8, 0xd4, 0x37, 0x16, 0xc2, 0xae, 0x26, 0x88, 0x8d, 0x79, 0x81, 0x6d, 0xa7, 0x4b, 0x30, 0xf5, 0xbc, 0x48, 0x60,
-	0xf7, 0x13, 0xc4, 0xf6, 0x41, 0x81, 0xfd, 0x8e, 0x18, 0xc9, 0x73, 0xba, 0x2e, 0x75, 0x49, 0x81, 0xdd, 0x7e, 0x29,
-	0x9c, 0xd3, 0x39, 0x85, 0xb1, 0x3d, 0x54, 0xe0, 0x4a, 0x37, 0x15, 0x96, 0xfa, 0xaa, 0xe0, 0xb6, 0xc3, 0x0a, 0x6c,
-	0x7b, 0x6d, 0x84, 0xdf, 0x11, 0x82, 0xfd, 0x57, 0x10, 0xdb, 0x89, 0x13, 0xec, 0xf6, 0xe4, 0x48, 0x5e, 0x92, 0x0d,
-	0xa9, 0x4f, 0x0b, 0xec, 0x76, 0x6c, 0xe1, 0x9c, 0xde, 0x2d, 0x8c, 0xed, 0xe2, 0x02, 0x57, 0xfa, 0xb9, 0xb0, 0xd4,
-	0xd9, 0x05, 0xa7, 0x1e, 0x2f, 0xb8, 0xe9, 0xf6, 0x11, 0xc5, 0xbe, 0x1f, 0x11, 0x14, 0x80, 0x88, 0x14, 0x2a, 0x20,
-	0x10, 0x49, 0x81, 0xe0, 0x9e, 0x1e, 0x44, 0xea, 0x40, 0xdd, 0x84, 0x94, 0x41, 0x60, 0x57, 0x1e, 0x84, 0xab, 0xf6,
-	0x39, 0x12, 0x0a, 0x81, 0x2b, 0x6a, 0x21, 0x2c, 0x49, 0x86, 0xe0, 0xa4, 0x1b, 0x82, 0x1b, 0xf1, 0x88, 0xe8, 0x13,
-	0x45, 0xdd, 0x33, 0x95, 0x39, 0x32, 0xe2, 0xb7, 0xde, 0x53, 0x95, 0xd8, 0xc7, 0x51, 0x55, 0x04, 0xb1, 0xdd, 0x56,
-	0x60, 0xab, 0x2a, 0x09, 0x26, 0x55, 0x89, 0x04, 0xaa, 0x8a, 0x20, 0x56, 0x55, 0x04, 0xf6, 0x55, 0x25, 0x92, 0xe7,
-	0x74, 0x5d, 0x52, 0x15, 0x81, 0x5d, 0x55, 0x11, 0xce, 0x51, 0x15, 0x61, 0xac, 0xaa, 0x08, 0x5c, 0x51, 0x15, 0x61,
-	0x49, 0x55, 0x04, 0xb7, 0xaa, 0x22, 0xb0, 0x55, 0x95, 0x08, 0xbf, 0x23, 0x04, 0x55, 0x45, 0x10, 0xab, 0x2a, 0x09,
-	0x76, 0x55, 0x25, 0x92, 0x97, 0x64, 0x43, 0x52, 0x15, 0x81, 0x5d, 0x55, 0x11, 0xce, 0x51, 0x15, 0x61, 0xac, 0xaa,
-	0x08, 0x5c, 0x51, 0x15, 0x61, 0x49, 0x55, 0x04, 0x27, 0x55, 0x11, 0xdc, 0xa8, 0x4a, 0x44, 0x51, 0x55, 0x22, 0x82,
-	0xaa, 0x12, 0x91, 0x42, 0x55, 0x04, 0x22, 0x55, 0x11, 0xdc, 0x53, 0x95, 0x48, 0x1d, 0xa8, 0x9b, 0x90, 0xaa, 0x08,
-	0xec, 0xaa, 0x8a, 0x70, 0xd5, 0x3e, 0x47, 0xaa, 0x22, 0x70, 0x45, 0x55, 0x84, 0x25, 0x55, 0x11, 0x9c, 0x54, 0x45,
-	0x70, 0xa3, 0x2a, 0x11, 0x7d, 0xa2, 0xa8, 0x7b, 0xa6, 0x32, 0x47, 0x46, 0xfc, 0xd6, 0x7b, 0xaa, 0x02, 0x06, 0x41,
-	0x69, 0x41, 0xd8, 0x76, 0x60, 0xe4, 0xac, 0xc8, 0x14, 0x1c, 0x29, 0x0d, 0xb0, 0x28, 0x37, 0x08, 0x5b, 0xcd, 0x41,
-	0xce, 0x17, 0x1e, 0x28, 0x71, 0xee, 0xdf, 0x8b, 0x24, 0x08, 0x39, 0x57, 0x87, 0xb0, 0x80, 0x23, 0x46, 0x48, 0x5b,
-	0x45, 0x42, 0xae, 0x22, 0x4b, 0x58, 0x84, 0xb4, 0x09, 0x49, 0x2b, 0x50, 0xc8, 0x59, 0x95, 0x02, 0xee, 0x9d, 0x0f,
-	0xa3, 0x5e, 0x21, 0x6c, 0x45, 0xab, 0xe0, 0x5c, 0xe5, 0x82, 0x12, 0x97, 0xbe, 0x27, 0x48, 0xc3, 0x90, 0x73, 0x85,
-	0x0c, 0x0b, 0x38, 0x6a, 0x86, 0xb4, 0x95, 0x34, 0xe4, 0x2a, 0xba, 0x86, 0x45, 0x48, 0xdc, 0x90, 0x24, 0x85, 0x43,
-	0xd2, 0xc8, 0x1c, 0x50, 0xa8, 0x75, 0x00, 0xa3, 0xe0, 0x01, 0x5c, 0xa8, 0x1e, 0xe2, 0x24, 0x7d, 0x48, 0x7a, 0xfa,
-	0x07, 0xfc, 0xc1, 0xef, 0xd5, 0xa4, 0x84, 0xc8, 0xb9, 0x72, 0x88, 0x05, 0x4e, 0x2b, 0x06, 0x09, 0x23, 0x72, 0x15,
-	0x75, 0xc4, 0x22, 0x24, 0x91, 0x48, 0x92, 0x4e, 0x22, 0x69, 0xc4, 0x12, 0xa8, 0x27, 0x3f, 0xf8, 0x9f, 0xfd, 0xd2,
-	0xc7, 0x0a, 0x7c, 0xc2, 0x68, 0x9e, 0x8a, 0x66, 0x08, 0x35, 0x54, 0x41, 0xab, 0x3f, 0xca, 0x58, 0xfd, 0x04, 0x86,
-	0xd4, 0x33, 0x73, 0xa8, 0x9d, 0x0a, 0x5a, 0xe5, 0x54, 0xc6, 0xd7, 0xcd, 0xcc, 0x9f, 0x7b, 0xf7, 0x20, 0xcd, 0x54,
-	0xc6, 0x55, 0x4c, 0xa5, 0x1d, 0xbd, 0x54, 0xd2, 0xaa, 0xa5, 0x32, 0x15, 0xad, 0xd4, 0x02, 0xa4, 0x94, 0x4a, 0x59,
-	0x9d, 0x54, 0xc6, 0xaa, 0x64, 0x66, 0xde, 0x79, 0x20, 0x2a, 0xa4, 0x82, 0x56, 0x1f, 0x81, 0x71, 0xd5, 0x31, 0xf3,
-	0x97, 0x9e, 0xb5, 0x49, 0x19, 0x95, 0x71, 0x75, 0x51, 0x69, 0x47, 0x15, 0x95, 0xb4, 0x9a, 0xa8, 0x4c, 0x45, 0x11,
-	0xb5, 0x00, 0xe9, 0xa1, 0x52, 0xa4, 0x86, 0x4a, 0x19, 0x2d, 0xcc, 0x04, 0x2a, 0x61, 0x06, 0x51, 0x07, 0x33, 0x58,
-	0xa8, 0xa0, 0xa2, 0xa4, 0x81, 0x4a, 0x79, 0x0a, 0x98, 0xb1, 0x83, 0xd7, 0x1f, 0x49, 0xfd, 0x94, 0x71, 0xb5, 0x4f,
-	0xe9, 0x53, 0xbd, 0x9c, 0x74, 0x4f, 0x99, 0x8a, 0xea, 0x69, 0x01, 0xd2, 0x3c, 0xa5, 0x48, 0xf1, 0x94, 0x32, 0x7a,
-	0x97, 0x89, 0x27, 0x2f, 0x8c, 0x9f, 0xbd, 0x92, 0x47, 0x17, 0xac, 0x9a, 0xc7, 0x53, 0xb9, 0xd8, 0x6a, 0x94, 0x38,
-	0x41, 0xac, 0x56, 0x08, 0x6c, 0xc5, 0x2d, 0xc1, 0xa4, 0x6c, 0x91, 0x40, 0x59, 0x13, 0xc4, 0x6a, 0x9a, 0xc0, 0xbe,
-	0xa0, 0x45, 0xf2, 0x9c, 0xae, 0x4b, 0x52, 0x26, 0xb0, 0xab, 0x63, 0xc2, 0x39, 0x22, 0x26, 0x8c, 0x55, 0x30, 0x81,
-	0x2b, 0xf2, 0x25, 0x2c, 0x69, 0x97, 0xe0, 0x56, 0xb8, 0x04, 0xb6, 0xaa, 0x15, 0xe1, 0x77, 0x84, 0xa0, 0x5e, 0x09,
-	0x62, 0xc5, 0x2a, 0xc1, 0xae, 0x52, 0x45, 0xf2, 0x92, 0x6c, 0x48, 0x1a, 0x25, 0xb0, 0x2b, 0x50, 0xc2, 0x39, 0xea,
-	0x24, 0x8c, 0x95, 0x26, 0x81, 0x2b, 0xba, 0x24, 0x2c, 0x89, 0x92, 0xe0, 0xa4, 0x48, 0x82, 0x1b, 0x39, 0x8a, 0x28,
-	0x6a, 0x51, 0x44, 0x50, 0x88, 0x22, 0x52, 0xa8, 0x90, 0x40, 0x24, 0x41, 0x82, 0x7b, 0xfa, 0x13, 0xa9, 0x03, 0x75,
-	0x13, 0x52, 0x1e, 0x81, 0x5d, 0xd9, 0x11, 0xae, 0xda, 0xe7, 0x48, 0x70, 0x04, 0xae, 0xa8, 0x8d, 0xb0, 0x24, 0x35,
-	0x82, 0x93, 0xce, 0x08, 0x6e, 0x44, 0x26, 0xa2, 0x4f, 0x14, 0x75, 0xcf, 0x54, 0xe6, 0xc8, 0x88, 0xdf, 0x7a, 0x4f,
-	0x55, 0xa4, 0x96, 0x28, 0x2b, 0x09, 0xb2, 0x1d, 0x37, 0xe1, 0x56, 0x58, 0x32, 0x4e, 0xca, 0x22, 0x0c, 0x4a, 0x4b,
-	0x82, 0xac, 0xb6, 0x24, 0xdc, 0x17, 0x17, 0x61, 0xcf, 0xf9, 0xda, 0x24, 0x2f, 0x09, 0x77, 0xf5, 0x25, 0x91, 0x8e,
-	0xc0, 0x24, 0xca, 0x2a, 0x4c, 0xc2, 0x2b, 0x12, 0x93, 0x68, 0xd2, 0x98, 0x44, 0x58, 0x91, 0x49, 0xb8, 0x55, 0x19,
-	0xc1, 0xdf, 0x31, 0x84, 0x3a, 0x93, 0x20, 0x2b, 0x34, 0x19, 0x77, 0x95, 0x46, 0xd8, 0x4b, 0xb6, 0x28, 0x69, 0x4d,
-	0xc2, 0x5d, 0xb1, 0x49, 0xa4, 0xa3, 0x36, 0x89, 0xb2, 0x72, 0x93, 0xf0, 0x8a, 0xde, 0x24, 0x9a, 0x04, 0x27, 0x11,
-	0xa4, 0x38, 0x89, 0x30, 0x92, 0x23, 0x30, 0x6a, 0x8e, 0x40, 0x28, 0x3a, 0x02, 0x15, 0xaa, 0x93, 0x30, 0x92, 0x9d,
-	0x44, 0x78, 0xba, 0x23, 0xdc, 0x81, 0x7b, 0x12, 0x29, 0x4f, 0xc2, 0x5d, 0xe9, 0x49, 0x64, 0xbd, 0x67, 0x92, 0xf8,
-	0x24, 0xbc, 0xa2, 0x3e, 0x89, 0x26, 0xf9, 0x49, 0x04, 0xe9, 0x4f, 0x22, 0x8c, 0x00, 0x09, 0xfc, 0xc4, 0x01, 0xf9,
-	0xcc, 0xa5, 0x8e, 0x0e, 0x54, 0x31, 0x84, 0xa7, 0x42, 0x52, 0x27, 0x54, 0xa1, 0x04, 0xd9, 0xfe, 0x9d, 0x70, 0xab,
-	0x42, 0x19, 0x27, 0x15, 0x12, 0x06, 0x55, 0x28, 0x41, 0x56, 0x85, 0x12, 0xee, 0xab, 0x90, 0xb0, 0xe7, 0x7c, 0x6d,
-	0x52, 0xa1, 0x84, 0xbb, 0x2a, 0x94, 0x48, 0x47, 0x85, 0x12, 0x65, 0x55, 0x28, 0xe1, 0x15, 0x15, 0x4a, 0x34, 0xa9,
-	0x50, 0x22, 0xac, 0x0a, 0x25, 0xdc, 0xaa, 0x90, 0xe0, 0xef, 0x18, 0x42, 0x15, 0x4a, 0x90, 0x55, 0xa1, 0x8c, 0xbb,
-	0x2a, 0x24, 0xec, 0x25, 0x5b, 0x94, 0x54, 0x28, 0xe1, 0xae, 0x0a, 0x25, 0xd2, 0x51, 0xa1, 0x44, 0x59, 0x15, 0x4a,
-	0x78, 0x45, 0x85, 0x12, 0x4d, 0x2a, 0x94, 0x08, 0x52, 0xa1, 0x44, 0x18, 0x15, 0x12, 0x18, 0x55, 0x48, 0x20, 0x54,
-	0x21, 0x81, 0x0a, 0x15, 0x4a, 0x18, 0xa9, 0x50, 0x22, 0x3c, 0x15, 0x12, 0xee, 0xc0, 0x3d, 0x89, 0x54, 0x28, 0xe1,
-	0xae, 0x0a, 0x25, 0xb2, 0xde, 0x33, 0x49, 0x85, 0x12, 0x5e, 0x51, 0xa1, 0x44, 0x93, 0x0a, 0x25, 0x82, 0x54, 0x28,
-	0x11, 0x46, 0x85, 0x04, 0x7e, 0xe2, 0x80, 0x7c, 0xe6, 0x52, 0x47, 0x07, 0xaa, 0x18, 0xc2, 0x53, 0xa1, 0xee, 0xd6,
-	0xa8, 0x41, 0x11, 0xb0, 0x7d, 0x3b, 0xa2, 0x56, 0x7f, 0x04, 0x25, 0xf5, 0xe9, 0x70, 0xd4, 0x9e, 0x08, 0x58, 0xe5,
-	0x89, 0xa8, 0xaf, 0x3b, 0x1d, 0x77, 0x6e, 0xaf, 0x49, 0x9a, 0x13, 0x51, 0x57, 0x71, 0x22, 0xe5, 0xe8, 0x4d, 0x24,
-	0xac, 0xda, 0x44, 0xb4, 0xa2, 0x35, 0x91, 0x24, 0xa5, 0x89, 0xb0, 0xd5, 0x99, 0x88, 0x5a, 0x95, 0xe9, 0xd0, 0x77,
-	0x16, 0x40, 0x85, 0x89, 0x80, 0xd5, 0x17, 0x41, 0x5d, 0x75, 0xe9, 0xb8, 0x4b, 0x6b, 0x35, 0x52, 0x96, 0x88, 0xba,
-	0xba, 0x12, 0x29, 0x47, 0x55, 0x22, 0x61, 0x35, 0x25, 0xa2, 0x15, 0x45, 0x89, 0x24, 0xe9, 0x49, 0x84, 0x49, 0x4d,
-	0x22, 0x6c, 0xb4, 0xa4, 0x3b, 0x44, 0x25, 0xe9, 0x00, 0xd4, 0x91, 0x0e, 0x28, 0x54, 0x24, 0x22, 0xa4, 0x21, 0x11,
-	0xf6, 0x14, 0xa4, 0x63, 0x0e, 0xb6, 0x0f, 0x90, 0x7a, 0x44, 0xd4, 0xd5, 0x8e, 0x48, 0xd5, 0x7a, 0x13, 0xe9, 0x46,
-	0x44, 0x2b, 0xaa, 0x11, 0x49, 0xd2, 0x8c, 0x08, 0x93, 0x62, 0x44, 0xd8, 0xe8, 0x45, 0x77, 0xf8, 0x64, 0x43, 0xeb,
-	0xd9, 0x96, 0x38, 0x12, 0xe0, 0x36, 0xd9, 0x53, 0x89, 0x18, 0xcc, 0x28, 0x13, 0x82, 0xd8, 0xfe, 0x28, 0xb0, 0x15,
-	0x8a, 0x04, 0x93, 0x52, 0x44, 0x02, 0xa5, 0x42, 0x10, 0xab, 0x15, 0x02, 0xfb, 0x62, 0x11, 0xc9, 0x73, 0xba, 0x2e,
-	0xc9, 0x85, 0xc0, 0xae, 0x5e, 0x08, 0xe7, 0x08, 0x86, 0x30, 0x56, 0x31, 0x04, 0xae, 0x48, 0x86, 0xb0, 0xa4, 0x19,
-	0x82, 0x5b, 0xd1, 0x10, 0xd8, 0xaa, 0x46, 0x3c, 0x7e, 0x47, 0x08, 0xea, 0x86, 0x20, 0x56, 0x38, 0x12, 0xec, 0x2a,
-	0x47, 0x24, 0x2f, 0xc9, 0x86, 0xa4, 0x1d, 0x02, 0xbb, 0xe2, 0x21, 0x9c, 0xa3, 0x1e, 0xc2, 0x58, 0xf9, 0x10, 0xb8,
-	0xa2, 0x1f, 0xc2, 0x92, 0x80, 0x08, 0x4e, 0x0a, 0x22, 0xb8, 0x91, 0x90, 0x88, 0xa2, 0x86, 0x44, 0x04, 0x45, 0x24,
-	0x22, 0x85, 0x8a, 0x08, 0x44, 0x32, 0x22, 0xb8, 0xa7, 0x23, 0x91, 0x3a, 0x50, 0x37, 0x21, 0x25, 0x11, 0xd8, 0x95,
-	0x12, 0xe1, 0xaa, 0x7d, 0x8e, 0xc4, 0x44, 0xe0, 0x8a, 0x9a, 0x08, 0x4b, 0x72, 0x22, 0x38, 0xe9, 0x89, 0xe0, 0x46,
-	0x50, 0x22, 0xfa, 0x44, 0x51, 0xf7, 0x4c, 0x65, 0x8e, 0x8c, 0xf8, 0xad, 0x77, 0x54, 0xe5, 0xe7, 0xde, 0x4f, 0xc5,
-	0x81, 0x39, 0xf1, 0xe7, 0xb4, 0x89, 0x00, 0x11, 0xcf, 0x86, 0x3f, 0x43, 0x12, 0x19, 0x41, 0x63, 0xb9, 0x9f, 0xf3,
-	0x6a, 0x0c, 0x21, 0x6b, 0x91, 0x9f, 0x45, 0x05, 0x11, 0x90, 0x4e, 0xa9, 0x48, 0xe8, 0x37, 0x03, 0x3d, 0x48, 0x31,
-	0xa3, 0x08, 0xd6, 0x12, 0x60, 0x08, 0x22, 0x05, 0xa5, 0x96, 0x80, 0x94, 0xae, 0x05, 0x22, 0x55, 0x1f, 0xa0, 0x54,
-	0x7d, 0x80, 0x62, 0xf5, 0x13, 0xf0, 0xaa, 0x35, 0xf2, 0x48, 0x0f, 0x8c, 0x22, 0xbe, 0xca, 0x46, 0x06, 0xc4, 0x93,
-	0xc7, 0x57, 0x68, 0x64, 0x00, 0x8d, 0x28, 0xbe, 0x52, 0x23, 0x03, 0x94, 0x6a, 0x09, 0x50, 0xac, 0x25, 0x00, 0x46,
-	0xf9, 0x5e, 0xb5, 0x5d, 0x58, 0x0f, 0xae, 0xf0, 0x20, 0x74, 0xdc, 0xa9, 0x1e, 0x48, 0x8b, 0x00, 0xd1, 0x8a, 0x2a,
-	0x18, 0x7f, 0xf7, 0x26, 0xfb, 0xf0, 0x55, 0xfa, 0xa9, 0x1a, 0x45, 0xa2, 0x7e, 0xa2, 0xb5, 0x04, 0xb1, 0x26, 0x13,
-	0xd8, 0xda, 0x4d, 0x60, 0xd7, 0x78, 0xc2, 0x39, 0x16, 0x14, 0xc6, 0x9a, 0x51, 0x60, 0xb2, 0xa5, 0xe0, 0x64, 0x50,
-	0xc1, 0x8d, 0x55, 0x05, 0xb5, 0xa6, 0x8d, 0xf0, 0x82, 0x90, 0x2b, 0x42, 0xd0, 0xd2, 0x82, 0x58, 0x73, 0x0b, 0xec,
-	0xd8, 0x3c, 0x32, 0xd6, 0xf0, 0x11, 0x65, 0xeb, 0x77, 0xaf, 0xcb, 0x16, 0xd6, 0x8f, 0x08, 0x59, 0x3f, 0xc2, 0x64,
-	0xfd, 0x08, 0xfb, 0xd6, 0x8f, 0x9c, 0x67, 0xfd, 0xc8, 0x90, 0xf5, 0x23, 0xcc, 0xd6, 0x8f, 0x38, 0x5b, 0x3f, 0xe2,
-	0xd6, 0xfa, 0x11, 0x25, 0xeb, 0x77, 0xf0, 0x82, 0x90, 0x2b, 0x42, 0x0a, 0xeb, 0x47, 0x84, 0xac, 0x1f, 0x61, 0xcf,
-	0xfa, 0x1d, 0x43, 0xd6, 0xef, 0x50, 0x6b, 0xfd, 0x7f, 0xb4, 0x86, 0x9f, 0xe9, 0x81, 0xdc, 0x05, 0x10, 0x31, 0x37,
-	0x20, 0x68, 0x69, 0x80, 0xb5, 0x26, 0x00, 0x8a, 0x7d, 0x01, 0x49, 0xa6, 0x05, 0x28, 0x59, 0x15, 0xa0, 0x68, 0x50,
-	0x00, 0xc4, 0x96, 0x8a, 0x2c, 0xdb, 0xd7, 0xc3, 0xf3, 0x81, 0xd4, 0x1b, 0x10, 0xa9, 0x37, 0x20, 0x58, 0x6f, 0x80,
-	0xb5, 0xde, 0x00, 0x4a, 0xbd, 0x01, 0x49, 0xf5, 0x06, 0x28, 0xd5, 0x1b, 0xa0, 0x58, 0x6f, 0x00, 0xa4, 0xde, 0x8a,
-	0x88, 0x5f, 0xba, 0x5f, 0xd1, 0x8b, 0x48, 0xf2, 0x49, 0x86, 0x7e, 0x6b, 0x9d, 0xd2, 0xe8, 0x81, 0x69, 0xdc, 0x6f,
-	0xd9, 0x29, 0x80, 0x78, 0x8d, 0xfb, 0x0d, 0x9d, 0x02, 0xa0, 0x69, 0xdc, 0x6f, 0xea, 0x14, 0x80, 0x6c, 0xe3, 0x7e,
-	0x4b, 0x4e, 0x01, 0xc0, 0x34, 0xee, 0xb7, 0xd4, 0x38, 0x05, 0x52, 0xdb, 0x14, 0x39, 0x14, 0x07, 0xd4, 0xb4, 0x83,
-	0xdf, 0x90, 0x83, 0xd7, 0x90, 0x03, 0x35, 0xc4, 0x4c, 0x8e, 0x80, 0xe0, 0x16, 0x1e, 0xb8, 0x85, 0x87, 0xb2, 0x85,
-	0xaf, 0xdb, 0x85, 0xc5, 0x50, 0x0f, 0xcc, 0x34, 0xe5, 0x75, 0xb9, 0x9c, 0x00, 0x98, 0x27, 0x25, 0xaf, 0xf3, 0x22,
-	0x02, 0x10, 0x7f, 0x26, 0xf7, 0x5a, 0x97, 0x0e, 0x00, 0xc9, 0xaa, 0x01, 0x10, 0x33, 0x37, 0x79, 0xdd, 0x6b, 0xe7,
-	0x12, 0xe3, 0x7c, 0x90, 0xe6, 0x26, 0x8a, 0xc8, 0x32, 0x01, 0x11, 0x9c, 0xad, 0x28, 0x0c, 0xb3, 0x15, 0x00, 0xf3,
-	0x4b, 0x99, 0x88, 0xa6, 0x39, 0x8c, 0x22, 0x79, 0xaa, 0xa2, 0x50, 0x9e, 0xaa, 0x64, 0x68, 0x1b, 0xea, 0xad, 0x07,
-	0xc9, 0xae, 0x8a, 0x14, 0x76, 0x55, 0x18, 0xec, 0xaa, 0x60, 0xb2, 0xab, 0x22, 0xc6, 0xae, 0x4a, 0x64, 0xbb, 0x2a,
-	0x94, 0xec, 0xaa, 0x48, 0xb2, 0x6b, 0x46, 0x0e, 0x68, 0x64, 0x3b, 0xc5, 0x7f, 0xed, 0xcf, 0xee, 0x5f, 0x7b, 0x13,
-	0xfb, 0xd7, 0x34, 0xa7, 0x7f, 0x5d, 0x9b, 0xce, 0xbf, 0xe6, 0x99, 0xfc, 0x6b, 0x9e, 0xc4, 0xbf, 0xb6, 0xf3, 0xf7,
-	0xd7, 0xed, 0xb4, 0x7c, 0xa4, 0x07, 0x66, 0x08, 0x7d, 0x8d, 0x93, 0xf1, 0x0c, 0xe2, 0x3a, 0x11, 0x03, 0xbe, 0xc0,
-	0x6d, 0xb3, 0x0b, 0xd2, 0xb5, 0x40, 0x51, 0xc2, 0x31, 0x46, 0xc1, 0x5b, 0xbb, 0x14, 0x64, 0xc5, 0x44, 0x45, 0x19,
-	0xb2, 0x56, 0xc1, 0xda, 0xde, 0x53, 0x90, 0xb6, 0x23, 0x21, 0x89, 0xb1, 0x5d, 0xe0, 0xb6, 0x7b, 0x15, 0xa4, 0xed,
-	0x69, 0x25, 0xe9, 0x75, 0xba, 0xa2, 0x84, 0xd3, 0xff, 0x4a, 0xde, 0xe9, 0x8a, 0x45, 0x01, 0xdb, 0x2b, 0x0b, 0x92,
-	0x3a, 0x68, 0xc1, 0x52, 0x5f, 0x45, 0x16, 0xbb, 0x6d, 0x81, 0xdb, 0x1e, 0x5c, 0x90, 0x6e, 0x67, 0x2e, 0x4a, 0x38,
-	0xfd, 0xba, 0xe0, 0x6d, 0x17, 0x2f, 0xc8, 0x4a, 0x6f, 0x2f, 0xca, 0x50, 0xc7, 0x2f, 0x58, 0xab, 0x01, 0x05, 0x69,
-	0xe5, 0x00, 0xc9, 0x43, 0x25, 0x6a, 0x48, 0x24, 0x0a, 0xf2, 0xbb, 0xbd, 0xc5, 0x93, 0x8e, 0x82, 0x3f, 0xd5, 0x5b,
-	0x6a, 0x82, 0x52, 0x94, 0x39, 0xd9, 0x5b, 0x58, 0x66, 0x0a, 0xd6, 0x28, 0x0e, 0x72, 0xc7, 0x8a, 0xaa, 0x90, 0x0e,
-	0x15, 0x24, 0x4b, 0xd2, 0x1b, 0xcc, 0x72, 0xbd, 0xa1, 0x04, 0xd7, 0x9b, 0x4a, 0x6e, 0xeb, 0x4d, 0x3b, 0xb7, 0xce,
-	0x59, 0x9a, 0x37, 0xed, 0xbc, 0x7a, 0x96, 0x0f, 0xda, 0x9c, 0x4f, 0xa3, 0x47, 0xa9, 0xff, 0x02, 0x04, 0xdd, 0x4e,
-	0xd1, 0xf2, 0xa7, 0x25, 0xce, 0x06, 0xa3, 0x92, 0x61, 0x18, 0xf2, 0x22, 0x6f, 0x28, 0x25, 0xf2, 0xc6, 0xcb, 0x86,
-	0xbc, 0xa1, 0x17, 0x07, 0x13, 0x62, 0xdb, 0x7d, 0xea, 0xc5, 0xc1, 0x37, 0xf9, 0xf5, 0x3a, 0xb5, 0x40, 0x7e, 0xbf,
-	0x6e, 0x56, 0x22, 0x85, 0x2d, 0xcc, 0xfb, 0x75, 0x16, 0xf7, 0xac, 0x12, 0xa9, 0xaa, 0x69, 0x80, 0xae, 0x70, 0x47,
-	0x6a, 0x3d, 0x59, 0xaa, 0xfa, 0x72, 0x5a, 0xf1, 0x39, 0x0c, 0x34, 0x5a, 0x81, 0x5b, 0xd3, 0x95, 0xa4, 0x6b, 0x40,
-	0x44, 0x0b, 0x33, 0x22, 0x81, 0xc6, 0x44, 0xbc, 0x30, 0x69, 0x41, 0x90, 0x61, 0x0b, 0xd6, 0x33, 0x2f, 0x16, 0xa8,
-	0x1a, 0x99, 0x0a, 0x9d, 0x2c, 0x71, 0xac, 0xd8, 0x8f, 0xcc, 0x5e, 0xe9, 0x99, 0x99, 0x8f, 0x5a, 0x89, 0x66, 0x17,
-	0xc4, 0x1a, 0x3c, 0xc1, 0xae, 0xa9, 0x23, 0x59, 0x18, 0x39, 0x42, 0x68, 0xde, 0x88, 0x14, 0x86, 0x15, 0x88, 0x4c,
-	0x2a, 0xb8, 0x67, 0xcc, 0x48, 0x55, 0xcd, 0x08, 0x74, 0x85, 0x3b, 0x52, 0xeb, 0xc9, 0x68, 0x02, 0xb3, 0xb9, 0xce,
-	0xdb, 0x95, 0xdc, 0x58, 0x0f, 0x4c, 0x8e, 0xfd, 0x3c, 0xaf, 0xe4, 0x00, 0xf1, 0x12, 0xee, 0xe7, 0xb8, 0x92, 0x03,
-	0xd0, 0xa4, 0xd9, 0xcf, 0x75, 0x25, 0x07, 0x90, 0x4d, 0x9f, 0x9f, 0xa7, 0x95, 0x1c, 0x00, 0x32, 0xca, 0x29, 0x72,
-	0xa1, 0x6a, 0x7c, 0x9e, 0x9d, 0x8b, 0x08, 0xfa, 0x55, 0xf1, 0x05, 0x5e, 0xe3, 0x0a, 0x0f, 0x3e, 0xe0, 0x01, 0xe4,
-	0x37, 0xce, 0x29, 0xb5, 0x71, 0xee, 0x65, 0x35, 0xce, 0xd3, 0xda, 0x52, 0xef, 0x95, 0xd6, 0x96, 0x19, 0x89, 0xd7,
-	0x41, 0x8b, 0x0b, 0x62, 0xcd, 0x2e, 0xb0, 0xb5, 0xbd, 0xc0, 0xae, 0x03, 0x84, 0x73, 0xbc, 0x20, 0x8c, 0x75, 0x85,
-	0xc0, 0xe4, 0x0f, 0xc1, 0xc9, 0x29, 0x82, 0x1b, 0xcf, 0x08, 0x6a, 0xdd, 0x93, 0x47, 0x0c, 0xd3, 0x76, 0x72, 0x94,
-	0x37, 0x62, 0x18, 0x72, 0x41, 0xd7, 0xbd, 0x22, 0xe4, 0x03, 0x21, 0xe8, 0xc1, 0x72, 0x04, 0xb1, 0xb0, 0xe3, 0xcb,
-	0xc8, 0x58, 0x87, 0x46, 0x94, 0xbc, 0x0a, 0xee, 0x40, 0xd7, 0x22, 0x6c, 0xfd, 0x8b, 0x9c, 0x75, 0x32, 0x72, 0xae,
-	0xa7, 0xb1, 0x80, 0xe3, 0x6e, 0xa4, 0xad, 0xcf, 0x91, 0x23, 0xc7, 0x23, 0x49, 0xde, 0x47, 0xd2, 0x84, 0x00, 0x52,
-	0x36, 0x0e, 0xca, 0x37, 0xee, 0x3c, 0x93, 0x51, 0x44, 0x54, 0xdf, 0xb8, 0xf3, 0x4a, 0x2c, 0xfc, 0x7b, 0x5d, 0xf9,
-	0xf0, 0x07, 0x1f, 0xc6, 0x50, 0x71, 0x5e, 0x40, 0x73, 0x39, 0x27, 0x68, 0x80, 0xb6, 0x91, 0x03, 0x14, 0x85, 0x4f,
-	0xbe, 0x12, 0x06, 0x8f, 0x82, 0x36, 0x74, 0x94, 0xb1, 0x81, 0xa3, 0x8c, 0x1b, 0x36, 0x4a, 0x3b, 0x41, 0xa3, 0xa4,
-	0x0d, 0x19, 0x65, 0x28, 0x60, 0x94, 0xa2, 0x70, 0x51, 0xca, 0x04, 0x8b, 0x12, 0x36, 0x54, 0xf0, 0xc5, 0x23, 0x36,
-	0x0e, 0x85, 0x49, 0xe5, 0xc5, 0x23, 0xe6, 0x17, 0xde, 0x3d, 0xae, 0x3c, 0xf0, 0x83, 0x07, 0x62, 0x70, 0xd0, 0x7b,
-	0x39, 0x0e, 0xe3, 0x04, 0x46, 0x86, 0x6c, 0x58, 0x64, 0x82, 0x82, 0x22, 0x7a, 0x01, 0x23, 0x42, 0x10, 0x1b, 0x0e,
-	0x02, 0xdb, 0x58, 0x10, 0xd8, 0x0d, 0x04, 0xe1, 0x9c, 0x28, 0x10, 0xc6, 0x86, 0x80, 0xc0, 0xe4, 0x7f, 0xc1, 0xc9,
-	0xf9, 0x82, 0x1b, 0xcf, 0x0b, 0x6a, 0xdd, 0x9e, 0x5f, 0xde, 0x30, 0x6d, 0x27, 0x87, 0x7b, 0x2f, 0x6f, 0x18, 0x72,
-	0x41, 0xd7, 0xbd, 0x22, 0xe4, 0x03, 0x21, 0xe8, 0xe1, 0xf2, 0x9d, 0x07, 0x0b, 0x3b, 0xbe, 0x8d, 0x8c, 0x75, 0x6c,
-	0x44, 0xc9, 0xab, 0xc5, 0xca, 0x17, 0x9d, 0x5b, 0x12, 0xd6, 0xc7, 0x25, 0x6b, 0x5d, 0x5d, 0xb2, 0xae, 0xc7, 0xcb,
-	0x22, 0x8e, 0xe3, 0xcb, 0x02, 0xd6, 0xff, 0x25, 0x4b, 0x61, 0x50, 0xd2, 0x14, 0x0d, 0x25, 0x6d, 0x82, 0xa2, 0x24,
-	0x6d, 0x6c, 0x14, 0xec, 0x45, 0xcd, 0x90, 0x14, 0x29, 0x86, 0x75, 0x03, 0xa6, 0x28, 0xb3, 0xa8, 0xdd, 0xf3, 0xaa,
-	0x46, 0x7c, 0xa8, 0x11, 0x18, 0x4c, 0x25, 0x61, 0x63, 0xaa, 0x64, 0x9d, 0xd0, 0x2a, 0x0a, 0xd8, 0x08, 0x2b, 0x48,
-	0x0a, 0x34, 0xf1, 0x11, 0x86, 0x58, 0x82, 0x6c, 0x70, 0x25, 0xdc, 0x86, 0x55, 0xc2, 0xdd, 0x80, 0x4a, 0xa4, 0x13,
-	0x4a, 0x89, 0xb2, 0x41, 0x94, 0x70, 0x0a, 0x9f, 0x44, 0x50, 0xe0, 0x24, 0xc2, 0x84, 0x4c, 0x82, 0x6d, 0xb0, 0xe8,
-	0xeb, 0x19, 0xd6, 0x0c, 0x14, 0x20, 0xee, 0xeb, 0x19, 0x96, 0x5d, 0xf0, 0xb5, 0xaf, 0x18, 0xfa, 0xc0, 0x10, 0x86,
-	0x80, 0x79, 0x9b, 0x81, 0x70, 0xc7, 0xed, 0x42, 0x59, 0x87, 0x0b, 0x4c, 0xae, 0x8e, 0x4b, 0x3b, 0xf4, 0xb4, 0x20,
-	0xd6, 0xd1, 0x02, 0x5b, 0x3f, 0x0b, 0xec, 0xba, 0x59, 0x38, 0xc7, 0xcb, 0xc2, 0x58, 0x27, 0x0b, 0x4c, 0x3e, 0x16,
-	0x9c, 0x5c, 0x2c, 0xb8, 0xf1, 0xb0, 0xa0, 0xd6, 0xc1, 0x79, 0x65, 0x6f, 0xda, 0x4e, 0xee, 0xf5, 0x56, 0xf6, 0x86,
-	0x5c, 0xd0, 0x75, 0xaf, 0x08, 0xf9, 0x40, 0x08, 0x7a, 0xb6, 0x5c, 0xe9, 0x5b, 0xd8, 0xf1, 0x6b, 0x64, 0xac, 0x5b,
-	0x23, 0x4a, 0x5e, 0x8d, 0x6d, 0x47, 0xaf, 0x0a, 0x62, 0xbd, 0x2a, 0xb0, 0xf5, 0xaa, 0xc0, 0xae, 0x57, 0x85, 0x73,
-	0xbc, 0x2a, 0x8c, 0xf5, 0xaa, 0xc0, 0xe4, 0x55, 0xc1, 0xc9, 0xab, 0x82, 0x1b, 0xaf, 0x0a, 0x6a, 0xbd, 0x9a, 0x37,
-	0x0d, 0x9a, 0xb6, 0x93, 0x57, 0xbd, 0x4d, 0x83, 0x86, 0x5c, 0xd0, 0x75, 0xaf, 0x08, 0xf9, 0x40, 0x08, 0x7a, 0xb5,
-	0xdc, 0x6b, 0x67, 0x61, 0xc7, 0xab, 0x91, 0xb1, 0x5e, 0x8d, 0xa8, 0xf5, 0xea, 0xdb, 0xd6, 0xa1, 0xf9, 0x21, 0xfa,
-	0xdb, 0xec, 0x4c, 0x84, 0xc4, 0x91, 0x08, 0x95, 0x5b, 0xb6, 0x14, 0xc7, 0x3d, 0x5b, 0x8a, 0xe6, 0x4d, 0x5b, 0x0a,
-	0xe9, 0xe6, 0x2c, 0xc5, 0x74, 0x77, 0x96, 0x62, 0x69, 0x7b, 0x96, 0x22, 0xe2, 0x2c, 0x80, 0x60, 0xc7, 0xc6, 0xdb,
-	0xbc, 0xab, 0x01, 0x10, 0xb3, 0x2f, 0xee, 0x6d, 0xb9, 0xab, 0x01, 0x60, 0xce, 0x45, 0xbd, 0xcd, 0xbb, 0x1a, 0x00,
-	0xb1, 0x0f, 0x02, 0xde, 0xea, 0xae, 0x06, 0x80, 0xca, 0x94, 0xff, 0xdb, 0xbc, 0xab, 0x41, 0x91, 0xb4, 0xab, 0xa1,
-	0xc9, 0x48, 0x41, 0xaf, 0xa8, 0x25, 0xe9, 0x19, 0x19, 0x22, 0x6e, 0x4b, 0x56, 0x5e, 0x4b, 0xf0, 0x11, 0x18, 0xa0,
-	0xd4, 0xbe, 0x15, 0xb7, 0x6f, 0xc5, 0xed, 0xdb, 0x62, 0x0c, 0xa5, 0x67, 0x59, 0x80, 0x78, 0x5b, 0x8b, 0xde, 0xe2,
-	0x53, 0x2b, 0x00, 0xcd, 0x86, 0xa2, 0xb7, 0xf6, 0xf9, 0x14, 0x10, 0x76, 0x93, 0xd1, 0xdb, 0xfc, 0x24, 0x0a, 0x10,
-	0xb3, 0x87, 0xe8, 0xad, 0xee, 0x16, 0x49, 0xa6, 0x7e, 0x87, 0x9b, 0x12, 0xdf, 0xd1, 0xa6, 0xc4, 0x77, 0xfe, 0xa6,
-	0xc4, 0x77, 0xde, 0xa6, 0xc4, 0x77, 0xb4, 0x29, 0xf1, 0x5d, 0x6d, 0x53, 0xe2, 0x3b, 0xde, 0x94, 0xf8, 0x8e, 0x37,
-	0x25, 0xbe, 0xb3, 0x9b, 0x12, 0xdf, 0x49, 0xa4, 0x68, 0xe5, 0xa5, 0x3d, 0x09, 0x78, 0xdf, 0x3e, 0x82, 0x86, 0x03,
-	0xb3, 0x41, 0xe4, 0x7d, 0xf9, 0xb0, 0x19, 0x60, 0xde, 0x20, 0xf2, 0x3e, 0x3f, 0x56, 0x06, 0xc4, 0xdf, 0x20, 0xf2,
-	0x5e, 0x1f, 0x20, 0x03, 0x24, 0xde, 0x00, 0xc4, 0x6c, 0x78, 0x79, 0xdf, 0x0a, 0x2b, 0x1c, 0x48, 0x4c, 0x23, 0x82,
-	0x72, 0xaa, 0xf8, 0x65, 0x71, 0x40, 0x6d, 0xbc, 0xf4, 0xdb, 0x78, 0xe9, 0xb5, 0xf1, 0x92, 0xda, 0x78, 0x59, 0x6b,
-	0xe3, 0x25, 0xb7, 0xf1, 0xd2, 0x6e, 0x82, 0x79, 0x9f, 0x3c, 0xa6, 0x00, 0xc8, 0xfe, 0x7b, 0xdc, 0xab, 0xf6, 0xbe,
-	0x95, 0x76, 0x65, 0xae, 0xcd, 0xd8, 0xf9, 0x1e, 0x05, 0x3d, 0x83, 0xb1, 0x10, 0xfa, 0x58, 0x10, 0x6b, 0x04, 0x81,
-	0x5d, 0x4b, 0x08, 0xe7, 0x98, 0x43, 0x18, 0x6b, 0x13, 0x81, 0x2b, 0x86, 0x11, 0x96, 0xac, 0x23, 0xb8, 0x0d, 0x03,
-	0x81, 0x6d, 0x2c, 0xe4, 0x9c, 0xac, 0x45, 0x6c, 0x54, 0x78, 0x39, 0x59, 0x43, 0x5e, 0x32, 0xe2, 0xdb, 0xc7, 0x8f,
-	0x14, 0xe1, 0xaa, 0xf6, 0xa1, 0x98, 0x11, 0xf8, 0xa4, 0x7d, 0x38, 0x7a, 0x04, 0xa7, 0x10, 0x12, 0xdc, 0xc4, 0x11,
-	0x65, 0x9b, 0xdf, 0xe7, 0x6c, 0xf3, 0xa8, 0x44, 0xae, 0xa9, 0x0c, 0xc5, 0x16, 0xe5, 0x96, 0x33, 0x13, 0xad, 0x8d,
-	0x01, 0x26, 0x88, 0x35, 0xa0, 0xc0, 0xae, 0x01, 0x85, 0x73, 0x0c, 0x28, 0x8c, 0x35, 0xa0, 0xc0, 0x15, 0x03, 0x0a,
-	0x4b, 0x06, 0x14, 0xdc, 0x06, 0x98, 0xc0, 0x36, 0xc0, 0x22, 0x7c, 0xc1, 0x88, 0x0d, 0xb0, 0x04, 0xbb, 0x01, 0x16,
-	0xc9, 0x4b, 0x46, 0x7c, 0xfb, 0xf8, 0x01, 0x26, 0x5c, 0xd5, 0x3e, 0x14, 0x60, 0x02, 0x9f, 0xb4, 0x0f, 0x07, 0x98,
-	0xe0, 0x14, 0x60, 0x82, 0x9b, 0x00, 0xcb, 0x9b, 0x9b, 0x4d, 0x2c, 0x60, 0x80, 0xe5, 0xcd, 0xcd, 0xa6, 0x0c, 0x05,
-	0x18, 0x6d, 0x6e, 0x56, 0xa6, 0xdc, 0x2e, 0xd5, 0xb8, 0x38, 0x19, 0xb3, 0xb6, 0x5d, 0xca, 0x2f, 0xe1, 0x19, 0xd6,
-	0xd9, 0x2e, 0xe5, 0x93, 0x35, 0x23, 0x7b, 0xdb, 0xa5, 0x7c, 0x96, 0x02, 0xd2, 0xd9, 0x2e, 0xe5, 0x92, 0x17, 0x35,
-	0x9c, 0x42, 0xb4, 0xfa, 0x38, 0xde, 0x2d, 0x72, 0x59, 0xc3, 0x4f, 0xd9, 0xb9, 0x12, 0xba, 0x58, 0xe2, 0x3b, 0x76,
-	0xe6, 0x30, 0x46, 0xf2, 0x7f, 0x60, 0x67, 0x27, 0xa4, 0x91, 0xe5, 0xc0, 0x46, 0xd6, 0x86, 0x77, 0xb9, 0x3d, 0xc1,
-	0x8d, 0xc7, 0x22, 0xd4, 0xcb, 0xdd, 0x09, 0x6e, 0x79, 0x0e, 0x7b, 0x7f, 0x6f, 0x42, 0xe2, 0x2f, 0xda, 0x25, 0xd6,
-	0x5c, 0x0f, 0xe4, 0x74, 0x40, 0x64, 0x81, 0x02, 0x08, 0x7a, 0x01, 0x60, 0xbd, 0x38, 0x80, 0x62, 0x6f, 0x40, 0x92,
-	0x01, 0x01, 0x4a, 0x56, 0x03, 0x28, 0x9a, 0x0a, 0x00, 0x09, 0x52, 0x45, 0xe0, 0x15, 0xc1, 0x0b, 0x7a, 0x3b, 0xf0,
-	0xc2, 0x7f, 0x31, 0xf0, 0xc2, 0x7b, 0x27, 0xf0, 0x82, 0x5e, 0x07, 0xbc, 0xa8, 0xbd, 0x09, 0x78, 0xc1, 0x2f, 0x01,
-	0x5e, 0xd0, 0xfb, 0x7f, 0x17, 0xf4, 0xea, 0xdf, 0x45, 0xbb, 0x0a, 0x9c, 0xe9, 0x81, 0xd9, 0x93, 0x7f, 0x91, 0x57,
-	0x81, 0x80, 0x78, 0x7b, 0xf2, 0x2f, 0x70, 0x15, 0x08, 0xa0, 0xd9, 0x93, 0x7f, 0xa1, 0xab, 0x40, 0x80, 0xec, 0x9e,
-	0xfc, 0x8b, 0xb4, 0x0a, 0x04, 0xc0, 0xec, 0xc9, 0xbf, 0x08, 0x73, 0xfb, 0x4d, 0xd9, 0x58, 0x59, 0x16, 0x6a, 0x89,
-	0x95, 0xbe, 0x8b, 0x77, 0x91, 0x57, 0x85, 0x80, 0x88, 0x4e, 0x20, 0x02, 0x2d, 0x03, 0x58, 0x5b, 0x86, 0xa0, 0xae,
-	0x0a, 0x01, 0x95, 0xf6, 0x02, 0x92, 0xda, 0x0b, 0x50, 0x6a, 0xaf, 0x42, 0x9f, 0x8f, 0x5f, 0x3f, 0xaf, 0x1e, 0x60,
-	0xa1, 0x75, 0xd1, 0x2e, 0x14, 0xb5, 0x29, 0x5b, 0xf2, 0xcb, 0xd6, 0xf7, 0xc2, 0xd6, 0xf3, 0xc2, 0x96, 0xbc, 0x60,
-	0x16, 0x8a, 0x40, 0xb0, 0x7b, 0xd2, 0x42, 0x11, 0x10, 0x72, 0x46, 0x5a, 0x28, 0x2a, 0xb2, 0x2b, 0x0e, 0xa8, 0xfa,
-	0xc5, 0xef, 0x25, 0x01, 0xbe, 0x5f, 0xdd, 0xaf, 0xc9, 0xb3, 0x07, 0xec, 0x5c, 0x07, 0xd2, 0x81, 0x83, 0xdf, 0xeb,
-	0x0f, 0x5e, 0xaf, 0x3f, 0x50, 0xaf, 0x37, 0x7b, 0x18, 0x81, 0x60, 0x39, 0x38, 0xb0, 0x1c, 0x1c, 0xac, 0x1c, 0x3c,
-	0xa3, 0x5f, 0x8f, 0xc5, 0x01, 0x85, 0xe0, 0xd1, 0x89, 0xac, 0xfc, 0x82, 0xd8, 0xdc, 0x20, 0xb6, 0xdd, 0xe5, 0x0b,
-	0x62, 0x16, 0x76, 0x6d, 0x42, 0x2f, 0x88, 0x59, 0xc6, 0x5a, 0xc7, 0xbc, 0x20, 0x66, 0x71, 0x32, 0x47, 0xf1, 0x82,
-	0x98, 0x45, 0xad, 0x4e, 0xe6, 0xd9, 0xf3, 0xc8, 0x20, 0x56, 0x31, 0x9d, 0xd9, 0xb3, 0xe5, 0x1c, 0xed, 0x2c, 0x67,
-	0xcf, 0x16, 0xae, 0xa8, 0xa8, 0x99, 0x3d, 0x5b, 0xdc, 0xea, 0x69, 0x39, 0x7b, 0x36, 0x30, 0x8a, 0x91, 0x20, 0xb6,
-	0x1f, 0x08, 0x6c, 0x35, 0x56, 0x60, 0xb7, 0x8b, 0x0b, 0xe7, 0xf4, 0x73, 0x61, 0x6c, 0x67, 0x17, 0x98, 0x3a, 0xb6,
-	0xe0, 0x24, 0xbe, 0x82, 0x1b, 0x05, 0x16, 0xd4, 0xf6, 0xfc, 0xf4, 0xf6, 0xdd, 0xc6, 0xb1, 0x96, 0x15, 0xe4, 0x88,
-	0xae, 0x28, 0xd6, 0x49, 0x9a, 0x05, 0xb6, 0xfa, 0x9c, 0x60, 0x4f, 0xa4, 0x85, 0xab, 0xf6, 0x27, 0x57, 0xae, 0x85,
-	0xb2, 0x9a, 0x2d, 0x30, 0x09, 0xb7, 0xe0, 0xa4, 0xde, 0x11, 0x67, 0x09, 0x8f, 0xf8, 0x96, 0x2c, 0x40, 0x62, 0x2e,
-	0xf0, 0x09, 0x77, 0x7b, 0xb2, 0x2e, 0x8c, 0xef, 0xee, 0x9a, 0xc0, 0x0b, 0x5b, 0x09, 0x06, 0x92, 0x7a, 0x81, 0x7d,
-	0xaf, 0x93, 0xe8, 0x47, 0x78, 0xc7, 0x88, 0xdf, 0xe0, 0xca, 0x18, 0x10, 0x49, 0x6f, 0x20, 0x88, 0xcc, 0x81, 0x24,
-	0x84, 0x86, 0x04, 0x81, 0x4f, 0x68, 0xa0, 0x37, 0x38, 0x08, 0xe3, 0x6b, 0x60, 0x6d, 0x98, 0x10, 0xb6, 0xa2, 0x90,
-	0x3c, 0x60, 0x08, 0xee, 0x2a, 0xe4, 0x33, 0x05, 0xd5, 0x91, 0x11, 0xbf, 0xb3, 0xb8, 0x23, 0x09, 0x98, 0xb7, 0x18,
-	0x4f, 0x10, 0x27, 0xd3, 0x21, 0x49, 0x63, 0x0b, 0x92, 0xbe, 0x75, 0xb1, 0x84, 0x67, 0x63, 0xe4, 0xc9, 0xd2, 0x48,
-	0xb2, 0x45, 0x91, 0x65, 0xbb, 0x22, 0x6b, 0xad, 0x8b, 0x1c, 0x8d, 0x42, 0xe5, 0x12, 0x7b, 0xe4, 0xe2, 0x34, 0x22,
-	0xd5, 0x96, 0xd8, 0x7e, 0x09, 0x6f, 0x74, 0x72, 0x96, 0xd8, 0x3e, 0x59, 0x1b, 0xa9, 0xbc, 0x25, 0xb6, 0xcf, 0xd2,
-	0xa8, 0xe5, 0x2c, 0xb1, 0x5d, 0xb2, 0x50, 0x6f, 0xc4, 0xa9, 0x43, 0x23, 0x49, 0xa3, 0x19, 0x92, 0xbe, 0xc8, 0x61,
-	0x09, 0x4f, 0xea, 0x90, 0x27, 0xc1, 0x43, 0x92, 0x85, 0x0d, 0x59, 0x1e, 0xeb, 0x90, 0xb5, 0x23, 0x1e, 0x72, 0xa4,
-	0x80, 0x40, 0x92, 0x4c, 0x15, 0x9c, 0x19, 0x03, 0xf1, 0xfd, 0xa7, 0x4a, 0x5f, 0xe5, 0xf1, 0x10, 0x49, 0x1a, 0x15,
-	0x0b, 0xd2, 0x1d, 0x1b, 0xb1, 0xc4, 0x77, 0x74, 0xc2, 0x1f, 0x27, 0xb1, 0x00, 0x8d, 0x96, 0x48, 0xf2, 0x98, 0x89,
-	0x2c, 0x8f, 0x9c, 0xc0, 0x3a, 0xe3, 0x27, 0xbe, 0x1a, 0x55, 0xb1, 0x21, 0x8f, 0xa5, 0x48, 0x7e, 0x37, 0xd8, 0xdc,
-	0x71, 0x15, 0xf9, 0x53, 0xc1, 0x56, 0x1d, 0x63, 0xb1, 0xcc, 0xc9, 0x80, 0xe4, 0xf1, 0x16, 0xc9, 0x53, 0x31, 0xc7,
-	0x63, 0x2f, 0x90, 0xbb, 0x1a, 0x7e, 0xca, 0x58, 0xb5, 0xd1, 0x18, 0x50, 0x77, 0x4c, 0x06, 0xfe, 0x50, 0x91, 0x55,
-	0x1e, 0x9f, 0x91, 0xfc, 0xee, 0x38, 0xe2, 0x8e, 0xd5, 0xc8, 0x9f, 0x1a, 0x47, 0xaa, 0xe3, 0x36, 0x96, 0x39, 0x39,
-	0xd6, 0x38, 0x63, 0x38, 0xb2, 0x27, 0xc6, 0x9a, 0xe7, 0x4a, 0xa8, 0x1f, 0x6b, 0xf8, 0xa9, 0x8e, 0xef, 0x8c, 0xf0,
-	0x97, 0xb8, 0xab, 0xe4, 0x92, 0x36, 0x94, 0x5c, 0xd2, 0x5e, 0x92, 0x4b, 0x7f, 0x1b, 0xc9, 0xa5, 0xb7, 0x83, 0xe4,
-	0x92, 0x36, 0x8f, 0x5c, 0xf2, 0xbe, 0x91, 0x4b, 0xde, 0x32, 0x72, 0x69, 0x77, 0x8b, 0x5c, 0xd2, 0x46, 0x91, 0x4b,
-	0xfb, 0xc1, 0x88, 0x4b, 0xfa, 0x56, 0xc4, 0x25, 0xbd, 0x5f, 0x91, 0x10, 0xdb, 0x48, 0xff, 0xfd, 0x8a, 0x04, 0xbb,
-	0xcd, 0xad, 0xbe, 0x5f, 0x91, 0x18, 0xdb, 0xf0, 0xca, 0xfb, 0x15, 0x09, 0x27, 0x13, 0xb8, 0xef, 0x57, 0x24, 0xd4,
-	0x1a, 0xa3, 0x78, 0x41, 0xc1, 0xb4, 0x9f, 0xcc, 0xe2, 0xbf, 0xa0, 0x50, 0xc0, 0xd6, 0x40, 0x27, 0x5e, 0x50, 0x28,
-	0x38, 0xd7, 0x54, 0xa7, 0x5f, 0x50, 0x28, 0x68, 0x6b, 0xb4, 0x53, 0x2f, 0x28, 0x14, 0x24, 0x99, 0xaf, 0xfe, 0x82,
-	0x42, 0x41, 0x59, 0x43, 0xf2, 0xa6, 0x7d, 0xcf, 0x6c, 0x64, 0x52, 0x6f, 0xd3, 0x3e, 0x80, 0xd6, 0x9c, 0xd5, 0x4d,
-	0xfb, 0xc0, 0xb8, 0xa6, 0x3c, 0xb5, 0x69, 0x1f, 0x48, 0x6b, 0xc6, 0xfa, 0xa6, 0x7d, 0xa0, 0xc8, 0x84, 0xb5, 0x4d,
-	0xfb, 0x40, 0x58, 0xf3, 0xd9, 0xad, 0xed, 0x6c, 0x20, 0x32, 0x1d, 0x6d, 0x6d, 0x4f, 0x88, 0x35, 0x9a, 0xbf, 0xb5,
-	0x3d, 0xc1, 0xae, 0xb9, 0xaa, 0x5b, 0xdb, 0x13, 0x63, 0x0d, 0x55, 0xd9, 0xda, 0x9e, 0x70, 0x32, 0x91, 0xbb, 0xb5,
-	0x3d, 0xa1, 0xd6, 0x38, 0xc5, 0xde, 0x70, 0xd3, 0x7e, 0x32, 0x4b, 0x6d, 0x6f, 0xb8, 0x21, 0xac, 0x91, 0x4e, 0xee,
-	0x0d, 0x37, 0xac, 0x6b, 0xb2, 0xef, 0xed, 0x0d, 0x37, 0x05, 0xac, 0x01, 0x4f, 0xef, 0x0d, 0x37, 0x34, 0x99, 0xf3,
-	0xd4, 0xde, 0x70, 0x43, 0x5a, 0xe3, 0x7a, 0xbb, 0xa3, 0x7d, 0x63, 0x92, 0xa9, 0x79, 0x77, 0x74, 0x86, 0xac, 0x79,
-	0x2b, 0xbb, 0xa3, 0x33, 0xee, 0x9a, 0xb4, 0xbe, 0x3b, 0x3a, 0x53, 0xd6, 0x8c, 0xb5, 0xdd, 0xd1, 0x99, 0x20, 0xd3,
-	0xf9, 0xbb, 0xa3, 0x33, 0x6c, 0xcd, 0x55, 0xee, 0x2a, 0xb6, 0xa6, 0x20, 0x13, 0xc9, 0xed, 0xd0, 0x44, 0x09, 0xb2,
-	0x26, 0x4a, 0xb8, 0x35, 0x51, 0xc2, 0x5d, 0x13, 0x25, 0xd2, 0x31, 0x51, 0xa2, 0xac, 0x89, 0x12, 0x4e, 0x26, 0x4a,
-	0x04, 0x99, 0x28, 0x11, 0xc6, 0x44, 0x09, 0xb6, 0x26, 0x12, 0xdc, 0x9a, 0x48, 0x60, 0x32, 0x51, 0x77, 0x55, 0x34,
-	0x50, 0x04, 0xac, 0x79, 0x22, 0x6a, 0x8d, 0x13, 0x51, 0xd7, 0x34, 0x91, 0x72, 0x0c, 0x13, 0x09, 0x6b, 0x96, 0x88,
-	0x92, 0x51, 0x22, 0x4c, 0x26, 0x89, 0xb0, 0x31, 0x48, 0x04, 0xad, 0x39, 0x3a, 0xd4, 0x1a, 0xa3, 0x03, 0xad, 0x29,
-	0x16, 0xf8, 0x8d, 0xae, 0x05, 0x7d, 0xa3, 0x6b, 0x41, 0xdf, 0xe8, 0x5a, 0xf4, 0xdc, 0x6f, 0x74, 0x2d, 0xbc, 0x6f,
-	0x74, 0x2d, 0xe8, 0x1b, 0x5d, 0x0b, 0xfe, 0x46, 0xd7, 0x82, 0xbf, 0xd1, 0xb5, 0xb0, 0xdf, 0xe8, 0x5a, 0xd0, 0x37,
-	0xba, 0x16, 0xf8, 0x75, 0xd7, 0x05, 0x7d, 0xd8, 0x75, 0x51, 0xf9, 0xa6, 0xeb, 0xa2, 0x4d, 0xf9, 0xc0, 0x81, 0xf1,
-	0xf8, 0xa2, 0x4c, 0xee, 0x00, 0xcc, 0x3e, 0x5d, 0xe4, 0x34, 0x0e, 0x20, 0xfe, 0x37, 0x48, 0x17, 0x9a, 0xb0, 0x01,
-	0x48, 0xd6, 0x82, 0x80, 0x18, 0x37, 0x2e, 0xda, 0x7c, 0xcc, 0x44, 0x0f, 0xcc, 0x6a, 0x61, 0x91, 0x33, 0x2f, 0x80,
-	0x78, 0x09, 0x81, 0x05, 0xe6, 0x58, 0x00, 0x34, 0x2b, 0xfb, 0x85, 0x66, 0x53, 0x00, 0xb2, 0x6b, 0xf8, 0x45, 0xca,
-	0x9b, 0x00, 0x20, 0xf5, 0x56, 0xc4, 0x2c, 0x1a, 0x17, 0xb4, 0x85, 0x77, 0xd1, 0x2b, 0xda, 0xb9, 0x22, 0x3f, 0xa4,
-	0xb4, 0x07, 0x22, 0xae, 0x67, 0x56, 0x9e, 0x67, 0x30, 0xab, 0x01, 0x28, 0xf9, 0x6b, 0xc5, 0x6e, 0x59, 0xd9, 0x7e,
-	0xb7, 0xc8, 0x99, 0x0a, 0x8d, 0xbd, 0xad, 0x2e, 0x00, 0x17, 0x39, 0x25, 0x01, 0x88, 0xb7, 0xc4, 0x5d, 0x60, 0xf2,
-	0x01, 0x40, 0xb3, 0x98, 0x5d, 0xd8, 0x34, 0x03, 0x10, 0x76, 0xd9, 0xba, 0xc8, 0x09, 0x05, 0x40, 0x4c, 0xbe, 0x73,
-	0xc1, 0x9b, 0x7a, 0x17, 0xde, 0xc2, 0x7e, 0xd1, 0xae, 0xe6, 0xd5, 0x83, 0x07, 0x0a, 0xb6, 0x83, 0x1f, 0x5a, 0x07,
-	0x2f, 0xb4, 0x0e, 0x14, 0x5a, 0x66, 0x59, 0x0e, 0x04, 0xc7, 0xdc, 0x81, 0x63, 0xee, 0x50, 0xc6, 0xdc, 0x55, 0xab,
-	0x5a, 0x70, 0x60, 0x2a, 0x7b, 0x95, 0x55, 0x0b, 0x10, 0xaf, 0xfa, 0x57, 0xa8, 0x5a, 0x00, 0x9a, 0xea, 0x5f, 0xa9,
-	0x6a, 0x01, 0x64, 0x6b, 0x79, 0x95, 0x54, 0x0b, 0x00, 0xd3, 0x33, 0xae, 0x70, 0x53, 0xd7, 0x15, 0xed, 0xe4, 0xba,
-	0xf2, 0xb7, 0x6f, 0x5d, 0x79, 0x7b, 0xb6, 0xae, 0x68, 0xa3, 0xd6, 0x55, 0x6d, 0x77, 0xd6, 0x15, 0x6f, 0xc9, 0xba,
-	0xa2, 0x7d, 0x58, 0x57, 0xb4, 0xf9, 0xea, 0xaa, 0x07, 0xaf, 0x45, 0x5c, 0x65, 0xf9, 0x01, 0xc4, 0x7c, 0x2d, 0xf3,
-	0xaa, 0x94, 0x1f, 0x80, 0x39, 0x1f, 0x7e, 0x95, 0xe5, 0x07, 0x10, 0x9b, 0xd5, 0xbe, 0x52, 0xf9, 0x01, 0xa8, 0xfc,
-	0x1e, 0xe6, 0x55, 0x96, 0x1f, 0x45, 0x24, 0xb4, 0x07, 0x00, 0x14, 0x59, 0xd9, 0xab, 0xee, 0x05, 0x82, 0x71, 0x3e,
-	0x48, 0x2f, 0x10, 0x28, 0x92, 0x5e, 0x20, 0x00, 0xc4, 0xf9, 0xd0, 0xd4, 0x55, 0xf1, 0x02, 0x01, 0x80, 0xf0, 0x02,
-	0x81, 0xa2, 0xe6, 0x43, 0x53, 0x57, 0xf0, 0x02, 0x81, 0x42, 0xf9, 0x05, 0x82, 0x0c, 0x25, 0xf5, 0xd1, 0xe6, 0x6d,
-	0x31, 0xa0, 0xb6, 0x14, 0xfb, 0x5b, 0x3f, 0xd2, 0xb7, 0x5e, 0xa4, 0x6f, 0x29, 0xd2, 0xb7, 0x7e, 0x47, 0xbd, 0x52,
-	0xf5, 0x01, 0x48, 0x62, 0x08, 0x10, 0x0a, 0x78, 0x9b, 0xb8, 0xbc, 0x42, 0xf1, 0x51, 0x0f, 0x05, 0xf1, 0x19, 0xe5,
-	0x26, 0x27, 0xf1, 0x01, 0xa4, 0x08, 0x2c, 0x85, 0x21, 0xb0, 0x14, 0x4c, 0x81, 0xa5, 0x88, 0x79, 0xa4, 0xa2, 0x44,
-	0x8e, 0x38, 0x85, 0x72, 0xc4, 0x29, 0x24, 0x11, 0x97, 0x81, 0x23, 0x76, 0x92, 0x23, 0x75, 0xe2, 0x23, 0xf7, 0xd6,
-	0xeb, 0xee, 0xf5, 0xa1, 0x81, 0x1e, 0xa5, 0x17, 0x29, 0x00, 0x4a, 0xaf, 0x0f, 0x01, 0x54, 0xbc, 0x5c, 0x01, 0x38,
-	0xbc, 0x5d, 0x01, 0x68, 0x7a, 0xbd, 0x02, 0xa0, 0xfc, 0x1a, 0x05, 0x60, 0xf9, 0x3d, 0x0a, 0xc0, 0xe4, 0x45, 0x0a,
-	0x40, 0xd2, 0xeb, 0x43, 0x0a, 0x9d, 0xeb, 0xab, 0x53, 0xd7, 0x59, 0xba, 0x00, 0xc1, 0xca, 0x02, 0xcc, 0x2f, 0x5e,
-	0x5d, 0x67, 0xe9, 0x02, 0xa4, 0x74, 0x11, 0x10, 0xa9, 0x09, 0x00, 0x49, 0xd8, 0x01, 0x22, 0xb5, 0x55, 0x64, 0xa9,
-	0x23, 0xe0, 0x75, 0x96, 0x2e, 0x40, 0xcc, 0x93, 0xce, 0xeb, 0x52, 0xba, 0x00, 0xe6, 0x31, 0xfb, 0x3a, 0x4b, 0x17,
-	0x20, 0x76, 0x68, 0xbe, 0x56, 0xe9, 0x02, 0xa8, 0xcc, 0x1d, 0x5f, 0x67, 0xe9, 0x52, 0x44, 0x3a, 0xc6, 0x18, 0x80,
-	0xfb, 0xe2, 0x93, 0xae, 0xd7, 0x3d, 0x98, 0x05, 0x5f, 0x67, 0xed, 0x02, 0x44, 0xb4, 0x0b, 0x11, 0x67, 0xc2, 0x7e,
-	0x8d, 0xda, 0x85, 0xa0, 0x6a, 0x17, 0xa0, 0x66, 0x1a, 0x7f, 0xad, 0xda, 0x05, 0x90, 0x9d, 0xc6, 0x5f, 0xb7, 0x4a,
-	0x05, 0x15, 0x4f, 0x52, 0x85, 0x90, 0xfb, 0x82, 0xdc, 0x35, 0x8a, 0x15, 0xa2, 0xf6, 0x05, 0xb9, 0x6b, 0x2b, 0x57,
-	0xc8, 0xd0, 0xab, 0x73, 0xd7, 0x59, 0xb0, 0x10, 0xb2, 0xef, 0xc9, 0x5d, 0xf3, 0x37, 0x73, 0xaf, 0x51, 0xb3, 0xd4,
-	0x35, 0x87, 0xa2, 0xc8, 0x81, 0x5b, 0x77, 0xa8, 0xb4, 0xee, 0xe0, 0xb6, 0xee, 0xc0, 0xad, 0x3b, 0x54, 0x5b, 0x77,
-	0x70, 0x5a, 0x97, 0xa5, 0x0b, 0x31, 0xf3, 0x62, 0xe0, 0x75, 0xce, 0xb3, 0x6b, 0xcf, 0x2e, 0x13, 0xed, 0x84, 0x93,
-	0x2e, 0x39, 0xa9, 0x76, 0x22, 0x3d, 0x85, 0x2a, 0x93, 0xed, 0x84, 0xb3, 0x56, 0x99, 0x74, 0x3b, 0x11, 0x56, 0xb5,
-	0xca, 0x84, 0xbb, 0xc5, 0x51, 0xbf, 0xca, 0xf7, 0x82, 0x2c, 0xec, 0x2a, 0x19, 0xbd, 0x17, 0x64, 0x19, 0xab, 0x69,
-	0xee, 0x7b, 0x41, 0x96, 0x25, 0x75, 0x2b, 0xdf, 0x0b, 0xb2, 0xb0, 0xd5, 0xb9, 0x08, 0xa3, 0xd8, 0x09, 0x62, 0x15,
-	0x4f, 0x60, 0x2b, 0x7b, 0x02, 0xbb, 0xda, 0x27, 0x9c, 0x23, 0x80, 0xc2, 0x58, 0x15, 0x14, 0x98, 0xa4, 0x50, 0x70,
-	0xd2, 0x43, 0xc1, 0x8d, 0x28, 0x0a, 0x6a, 0x95, 0x31, 0x3d, 0x35, 0x29, 0xfb, 0x60, 0xf1, 0x2c, 0xc5, 0x06, 0x39,
-	0x0a, 0x96, 0x20, 0x56, 0x2d, 0x05, 0xb6, 0x92, 0x99, 0x60, 0x4f, 0x37, 0x85, 0x73, 0xc4, 0x33, 0x31, 0x8e, 0x82,
-	0x0a, 0x65, 0x65, 0x54, 0x60, 0xd2, 0x52, 0xc1, 0x49, 0x50, 0x23, 0xbe, 0xe5, 0xa6, 0xb2, 0xb4, 0x0a, 0xee, 0x2b,
-	0x90, 0x90, 0x9e, 0x0c, 0x09, 0x45, 0x5a, 0x24, 0x78, 0x4d, 0x90, 0x84, 0x66, 0x55, 0x12, 0x82, 0x84, 0x57, 0x70,
-	0x52, 0xdf, 0xf2, 0x39, 0x98, 0xc5, 0x3d, 0x1d, 0x8e, 0xcc, 0x81, 0x0b, 0xb3, 0x22, 0x0b, 0x7e, 0xca, 0x28, 0xae,
-	0x36, 0x0b, 0x55, 0x31, 0x4a, 0x55, 0xa5, 0x85, 0xae, 0x19, 0xc5, 0xd1, 0x6b, 0x21, 0xac, 0x68, 0xe3, 0x23, 0x2b,
-	0x95, 0x35, 0x7a, 0x66, 0xe5, 0x51, 0xa4, 0xde, 0xfe, 0x53, 0x2b, 0x8f, 0xf7, 0x34, 0x9c, 0x9e, 0x5b, 0x79, 0x14,
-	0x2b, 0x39, 0x3f, 0xb9, 0xf2, 0x38, 0xab, 0xe7, 0xf4, 0xec, 0xca, 0xa1, 0x50, 0xd5, 0x15, 0xb4, 0xc2, 0xae, 0x8c,
-	0xab, 0xed, 0x4a, 0x3b, 0xf2, 0xae, 0xa4, 0x55, 0x78, 0x65, 0x2a, 0x22, 0xaf, 0x05, 0x48, 0xe7, 0x95, 0xb2, 0x52,
-	0xaf, 0x8c, 0x55, 0xfb, 0xcc, 0xa0, 0xe0, 0x2b, 0x68, 0x35, 0x5f, 0x19, 0x2b, 0xfb, 0xca, 0xb8, 0xca, 0xaf, 0xb4,
-	0x23, 0xfe, 0x4a, 0x5a, 0xfd, 0x57, 0x86, 0x86, 0x00, 0xa5, 0x68, 0x14, 0x50, 0xca, 0x0c, 0x04, 0x4a, 0xd8, 0xb1,
-	0x00, 0x9e, 0x5c, 0x96, 0x52, 0x60, 0x1f, 0x69, 0x3a, 0x3d, 0x08, 0xe5, 0x57, 0x41, 0x3b, 0x2e, 0x28, 0x63, 0x87,
-	0x06, 0x60, 0xbc, 0xd1, 0x41, 0x69, 0x67, 0x80, 0x00, 0xd2, 0x19, 0x23, 0x94, 0xb5, 0xc3, 0x84, 0x32, 0x34, 0x52,
-	0x28, 0x45, 0x83, 0x45, 0xa6, 0xb6, 0xae, 0x21, 0x78, 0xc8, 0x50, 0xca, 0x17, 0x48, 0xe5, 0x3d, 0x8d, 0x54, 0x96,
-	0x64, 0x52, 0xa9, 0x9a, 0x52, 0x6a, 0x09, 0x16, 0x4b, 0xe5, 0x68, 0x10, 0x51, 0x8a, 0xc6, 0x11, 0x7a, 0x88, 0xed,
-	0x50, 0xde, 0x68, 0x92, 0xc9, 0x83, 0x7b, 0x0a, 0x8f, 0x29, 0x4a, 0x7d, 0xc7, 0x6a, 0xee, 0xc8, 0xa2, 0x6c, 0xdd,
-	0x6a, 0xd5, 0xf1, 0x45, 0x4b, 0x9c, 0xb0, 0x9a, 0x33, 0xca, 0x28, 0x67, 0x06, 0x9a, 0x65, 0x0f, 0x3e, 0xa7, 0x10,
-	0x0e, 0xf2, 0x17, 0x4d, 0x32, 0x52, 0x3c, 0x55, 0x51, 0xfc, 0xa9, 0x97, 0x3f, 0xea, 0xbe, 0x6c, 0xb7, 0x41, 0xe9,
-	0x01, 0xe4, 0x4a, 0x96, 0x94, 0x2b, 0x59, 0x7a, 0xb9, 0x12, 0xd1, 0x31, 0xac, 0x89, 0x20, 0xb6, 0x3a, 0x02, 0xfb,
-	0x75, 0x8a, 0x24, 0x56, 0x2c, 0x22, 0xcf, 0x84, 0x1c, 0xe9, 0xde, 0x54, 0x4f, 0x81, 0x9d, 0xca, 0xc6, 0x3a, 0x61,
-	0x65, 0x05, 0xb1, 0x95, 0x15, 0xd8, 0xaf, 0x6c, 0x24, 0xb1, 0xb2, 0x11, 0x79, 0x26, 0xe4, 0x48, 0xf7, 0xa6, 0xca,
-	0x0a, 0xec, 0x54, 0x16, 0x22, 0x14, 0x6b, 0x8c, 0xb0, 0xad, 0x36, 0x72, 0x7e, 0xdd, 0xa1, 0x04, 0x36, 0x00, 0xe0,
-	0x67, 0x1f, 0x3e, 0xfa, 0x35, 0xa3, 0xf6, 0x20, 0xe7, 0x34, 0x2a, 0x43, 0xd8, 0x24, 0x05, 0x6d, 0x83, 0x94, 0xf1,
-	0x9b, 0x93, 0x79, 0x6c, 0x4c, 0x06, 0x9f, 0x3d, 0xf0, 0xe8, 0xd5, 0x86, 0x9a, 0xa1, 0x8c, 0xd3, 0x88, 0xd8, 0xfb,
-	0xb1, 0x05, 0x82, 0xd8, 0xea, 0x0b, 0xec, 0xd7, 0x3d, 0x92, 0x58, 0xf1, 0x88, 0x3c, 0x13, 0x72, 0xa4, 0x7b, 0x53,
-	0x7d, 0x05, 0x76, 0x2a, 0x2b, 0x6a, 0x83, 0xb5, 0x4d, 0x90, 0xad, 0x6e, 0xc2, 0xfd, 0xfa, 0x0a, 0x8b, 0x15, 0x16,
-	0xe8, 0x99, 0xa1, 0x23, 0xd7, 0x80, 0xea, 0x9c, 0x70, 0xa7, 0xd2, 0x22, 0x83, 0x58, 0xe9, 0x04, 0xd9, 0x4a, 0x27,
-	0xdc, 0xaf, 0xb4, 0xfe, 0x8e, 0x72, 0xae, 0xa1, 0xfe, 0x8e, 0xb2, 0x85, 0x8e, 0x5c, 0x03, 0xaa, 0x34, 0xff, 0x8e,
-	0x72, 0xa6, 0x3a, 0x7d, 0xc6, 0x2a, 0x47, 0xc0, 0x56, 0x38, 0xa2, 0x7e, 0x75, 0xd3, 0xcf, 0xb8, 0xe6, 0x9a, 0xa5,
-	0x9f, 0x71, 0x2d, 0x81, 0xa3, 0xbd, 0x2b, 0x55, 0xd3, 0xfe, 0x8c, 0x6b, 0x26, 0xe2, 0xd8, 0x8b, 0xb5, 0x14, 0xc4,
-	0x56, 0x53, 0x60, 0xbf, 0x9e, 0xf9, 0xd7, 0x21, 0x73, 0xbd, 0xf2, 0xaf, 0x43, 0x1a, 0xe4, 0x48, 0xf7, 0xa6, 0xba,
-	0xd2, 0xaf, 0x43, 0x26, 0xe6, 0x63, 0x6f, 0xa3, 0xf7, 0x0c, 0x07, 0x79, 0x38, 0xcf, 0x88, 0x5b, 0xbb, 0x80, 0xe7,
-	0xc9, 0x47, 0x42, 0x0e, 0x78, 0x55, 0xfb, 0x63, 0x53, 0x1f, 0xfd, 0x1f, 0x9b, 0xfa, 0xe8, 0xfd, 0xd8, 0xd4, 0x47,
-	0xfa, 0xb1, 0xa9, 0x8f, 0xb5, 0x1f, 0x9b, 0xfa, 0xc8, 0x3f, 0x36, 0xf5, 0x91, 0x7f, 0x6c, 0xea, 0xa3, 0xfd, 0xb1,
-	0xa9, 0x8f, 0xad, 0x5d, 0xf5, 0xe0, 0x58, 0x1c, 0x50, 0xcd, 0x1d, 0xb3, 0xdd, 0xf4, 0xa0, 0xe9, 0x37, 0xbd, 0x2f,
-	0xc8, 0x7c, 0x71, 0x3f, 0xb1, 0x70, 0xd3, 0x1a, 0x1a, 0x0e, 0xcc, 0x5d, 0x6e, 0x8c, 0xa1, 0x01, 0x37, 0x0f, 0x26,
-	0x6f, 0xda, 0xea, 0xea, 0xad, 0x8f, 0xc6, 0x63, 0x37, 0x58, 0xdd, 0x0c, 0xc6, 0x42, 0x9f, 0x09, 0xc1, 0x8a, 0x0b,
-	0xe2, 0x57, 0x23, 0x92, 0x1b, 0x46, 0x6c, 0x3b, 0x04, 0x3e, 0x79, 0x15, 0xdb, 0xa2, 0x3c, 0xed, 0x30, 0xb5, 0xa3,
-	0xb6, 0xd1, 0xb4, 0x23, 0x33, 0xf2, 0x0e, 0x22, 0x21, 0xd8, 0x40, 0x41, 0xfc, 0xaa, 0x45, 0x72, 0xc3, 0x88, 0x6d,
-	0xa0, 0xc0, 0x27, 0xaf, 0x62, 0x1b, 0x98, 0x5f, 0x66, 0x33, 0xb5, 0xa3, 0x06, 0xd2, 0xcb, 0x6c, 0xca, 0xc8, 0x8f,
-	0x3a, 0x7f, 0x76, 0xb0, 0xa2, 0x91, 0x09, 0xab, 0x54, 0x50, 0xe8, 0x8d, 0x87, 0x51, 0x53, 0x13, 0xf1, 0x9d, 0x6b,
-	0x51, 0x73, 0x85, 0x38, 0x3a, 0x75, 0xe5, 0x26, 0x27, 0xc2, 0x69, 0x74, 0xb7, 0x16, 0xd9, 0x7f, 0x5d, 0xde, 0xc0,
-	0xe3, 0xec, 0xb8, 0x94, 0xb5, 0xbf, 0x31, 0xd1, 0x30, 0xeb, 0x53, 0xe6, 0x6a, 0xb7, 0xbd, 0x5b, 0xbd, 0x5f, 0x38,
-	0xb8, 0xe9, 0x7e, 0xb9, 0x11, 0x10, 0x10, 0xe0, 0x5b, 0xd4, 0xde, 0xdb, 0xae, 0x75, 0x7a, 0x90, 0x9a, 0xa5, 0x08,
-	0xb4, 0x27, 0x81, 0xf1, 0xea, 0x78, 0x47, 0x41, 0xec, 0x6d, 0xe3, 0xf1, 0x13, 0x9d, 0xfa, 0x4c, 0xc8, 0x91, 0x11,
-	0x5b, 0x15, 0x81, 0xb9, 0x3e, 0x29, 0x53, 0x9c, 0x6e, 0xbb, 0xb2, 0x1f, 0x88, 0x2b, 0xc6, 0x9f, 0x62, 0xe8, 0x59,
-	0xf5, 0x5e, 0xf0, 0xe0, 0x58, 0x1c, 0x98, 0x0a, 0xac, 0xdc, 0x7b, 0x63, 0xaa, 0x3a, 0x57, 0xa0, 0xc8, 0x76, 0x36,
-	0x25, 0xfa, 0x44, 0x27, 0x3f, 0x13, 0xf2, 0x42, 0xc8, 0x91, 0x11, 0x5b, 0x3d, 0x56, 0x95, 0xc4, 0xe0, 0x7b, 0xdc,
-	0xb9, 0x8e, 0xc5, 0xcb, 0xbf, 0x4d, 0x89, 0x3e, 0xd1, 0xc9, 0xcf, 0x84, 0xbc, 0x10, 0x72, 0x64, 0xc4, 0xd6, 0x91,
-	0x85, 0x21, 0x33, 0x76, 0xd7, 0xbf, 0x56, 0x94, 0x36, 0xfd, 0x37, 0x0e, 0xf5, 0xe4, 0x5f, 0xeb, 0xd9, 0x87, 0x5f,
-	0x7c, 0xf8, 0x58, 0x81, 0xa9, 0x19, 0xee, 0xd2, 0x25, 0xd3, 0x26, 0x5f, 0x95, 0x5b, 0x62, 0x93, 0x17, 0x0d, 0x11,
-	0x4f, 0xde, 0x55, 0x9e, 0x3d, 0xf0, 0xc5, 0x03, 0x8f, 0x2e, 0x68, 0x6b, 0xef, 0xad, 0x58, 0x94, 0xcc, 0x29, 0x2c,
-	0x5b, 0xf9, 0x4c, 0x50, 0xed, 0x33, 0xf3, 0xe4, 0x5e, 0xe8, 0xd9, 0x45, 0x5f, 0x5c, 0xf4, 0xe8, 0xa3, 0xd4, 0x04,
-	0xa5, 0x9c, 0x36, 0xe0, 0x2e, 0xff, 0x5c, 0xff, 0x62, 0x93, 0x7f, 0x53, 0xa2, 0x4f, 0x74, 0xf2, 0x33, 0x21, 0x2f,
-	0x84, 0x1c, 0x19, 0xb1, 0xf5, 0xa4, 0xc5, 0x56, 0x66, 0x8a, 0xdd, 0xdf, 0xb9, 0x92, 0xe5, 0xe6, 0xef, 0xc6, 0xc0,
-	0x4f, 0x7c, 0xfe, 0x33, 0x43, 0x2f, 0x0c, 0x1d, 0x1d, 0xc8, 0x56, 0x95, 0xd7, 0x58, 0x99, 0x2a, 0xb6, 0x61, 0xe7,
-	0xba, 0x96, 0xbb, 0xb0, 0x1b, 0x03, 0x3f, 0xf1, 0xf9, 0xcf, 0x0c, 0xbd, 0x30, 0x74, 0x74, 0x20, 0x5b, 0x57, 0x5e,
-	0x5a, 0x25, 0xea, 0x93, 0xe6, 0x88, 0x13, 0xb0, 0x2a, 0x0e, 0xcc, 0xb8, 0xfd, 0x49, 0x7f, 0x79, 0x11, 0x10, 0xe7,
-	0xe3, 0xa7, 0x9f, 0x8a, 0xdf, 0x58, 0x04, 0x10, 0x7e, 0x58, 0x51, 0x51, 0xf3, 0x49, 0xd4, 0x4f, 0xf0, 0x13, 0x8a,
-	0x0a, 0xd9, 0x2f, 0x9f, 0x7e, 0x6a, 0x53, 0xba, 0x8d, 0x1e, 0x98, 0x79, 0xcc, 0xa7, 0x32, 0x81, 0x0b, 0x30, 0x4f,
-	0xec, 0x3f, 0xe5, 0x74, 0x2d, 0x20, 0xfe, 0xda, 0xe3, 0x93, 0x26, 0x67, 0x01, 0x32, 0x73, 0xa1, 0x4f, 0x39, 0x15,
-	0xab, 0x88, 0x66, 0x60, 0x13, 0x52, 0xce, 0x66, 0x86, 0x25, 0x5e, 0x82, 0x77, 0xc1, 0x2d, 0x03, 0xfd, 0x3b, 0x36,
-	0x15, 0x80, 0xe8, 0x14, 0x04, 0xb4, 0xe9, 0x80, 0xe6, 0x96, 0x23, 0x96, 0x3d, 0x02, 0x60, 0xb4, 0x06, 0x00, 0xd2,
-	0x66, 0x40, 0xc4, 0x1d, 0x8a, 0xc0, 0xd2, 0x97, 0x17, 0xe7, 0xb5, 0x85, 0xb9, 0x94, 0x83, 0x7b, 0x09, 0x60, 0x9a,
-	0x28, 0xa8, 0x69, 0x67, 0x42, 0x9d, 0xc6, 0x0a, 0xc5, 0x2d, 0x4e, 0x04, 0x37, 0x5b, 0x18, 0xd3, 0x76, 0x41, 0xad,
-	0x01, 0x04, 0xb6, 0x56, 0xa0, 0x44, 0xe8, 0x9d, 0x9f, 0x08, 0xbd, 0x3b, 0x95, 0x08, 0x2d, 0x50, 0xa8, 0x8a, 0xf3,
-	0xba, 0xbc, 0xcf, 0x19, 0x33, 0xd5, 0x5e, 0x96, 0xf7, 0x0b, 0xb0, 0xc9, 0x2a, 0xaf, 0xca, 0xfb, 0xbc, 0x31, 0x9f,
-	0xf7, 0xa2, 0xbc, 0x4f, 0x5a, 0x53, 0x22, 0x79, 0x57, 0x31, 0x0e, 0x99, 0xb5, 0x20, 0x5d, 0xe3, 0x7e, 0xc6, 0x85,
-	0xff, 0x67, 0x5a, 0xf8, 0x7f, 0xf6, 0x16, 0xfe, 0x5f, 0xba, 0xa7, 0x47, 0xe3, 0x7c, 0x60, 0x04, 0xf6, 0x8b, 0x79,
-	0x56, 0xa4, 0x30, 0x2b, 0xee, 0x17, 0x7d, 0x32, 0xa4, 0x88, 0x79, 0xb4, 0xa1, 0x44, 0x96, 0x41, 0x85, 0x52, 0x06,
-	0x46, 0x91, 0xf4, 0xd4, 0x27, 0x21, 0xe6, 0x0b, 0x02, 0x3e, 0x6e, 0x9b, 0x50, 0xfd, 0x82, 0x80, 0x5f, 0xc2, 0x69,
-	0x98, 0xf7, 0x05, 0x01, 0x9f, 0xac, 0x34, 0xd7, 0xfd, 0x82, 0x80, 0xcf, 0x5a, 0x23, 0x78, 0x5f, 0x10, 0x48, 0xe4,
-	0x06, 0x47, 0xd2, 0x0d, 0x0e, 0x98, 0x1b, 0x1a, 0x2a, 0x37, 0xde, 0x20, 0xb9, 0xa1, 0x75, 0xc7, 0x86, 0x56, 0x19,
-	0x1b, 0x7f, 0x95, 0xb1, 0xa9, 0xae, 0x32, 0x8a, 0xd5, 0xf5, 0x73, 0x05, 0x3f, 0xd6, 0x70, 0x7b, 0x9b, 0xca, 0x2b,
-	0xf3, 0x99, 0x8f, 0xf6, 0x7a, 0x26, 0xe4, 0xc8, 0x88, 0xbd, 0x34, 0xfd, 0xf2, 0x62, 0x62, 0xee, 0x31, 0xf7, 0x77,
-	0x4f, 0xb9, 0xbf, 0x7b, 0x3f, 0xf7, 0x77, 0xef, 0xe5, 0xfe, 0xee, 0x29, 0xf7, 0x77, 0x5f, 0xcb, 0xfd, 0xdd, 0x73,
-	0xee, 0xef, 0x9e, 0x73, 0x7f, 0xf7, 0x36, 0xf7, 0x77, 0x8f, 0x3f, 0x32, 0x79, 0x4f, 0xbf, 0x2f, 0x79, 0xef, 0xfd,
-	0xb4, 0xe4, 0x43, 0x7c, 0xfa, 0x99, 0x0f, 0xcc, 0x5c, 0xe8, 0xc1, 0x3e, 0xeb, 0xcc, 0x30, 0xcf, 0x7c, 0x1e, 0xe0,
-	0xc9, 0x66, 0x46, 0xfc, 0xcf, 0xbe, 0x3f, 0xe0, 0x73, 0xcc, 0x0c, 0xd9, 0xc9, 0xcf, 0x83, 0x3e, 0xb5, 0x4c, 0xc0,
-	0x93, 0xe6, 0x37, 0x8a, 0xc7, 0x04, 0xfc, 0x80, 0xc0, 0x7d, 0x34, 0xf0, 0x00, 0x3b, 0x88, 0x4a, 0xc4, 0xb6, 0xdb,
-	0xdd, 0x3f, 0x54, 0x72, 0x8e, 0x05, 0xec, 0xee, 0xa1, 0x12, 0xae, 0xd8, 0x82, 0xf6, 0x0e, 0x95, 0x38, 0x59, 0xc5,
-	0xec, 0x1c, 0x2a, 0x50, 0xb4, 0x0f, 0x3d, 0xf2, 0x7c, 0x28, 0xfb, 0xaf, 0x85, 0x1d, 0x73, 0xe5, 0xcf, 0x72, 0x0d,
-	0x0c, 0x62, 0xcd, 0xe5, 0x7c, 0x96, 0xcb, 0x72, 0x8e, 0xb9, 0xca, 0xcf, 0x72, 0x59, 0xb8, 0x62, 0x2e, 0xf3, 0x59,
-	0x2e, 0x8b, 0x93, 0xb9, 0x8a, 0xcf, 0x72, 0x19, 0x14, 0xcd, 0x95, 0x13, 0x16, 0xa6, 0xf5, 0x64, 0x2e, 0x4a, 0x58,
-	0x28, 0x53, 0x7e, 0x31, 0x65, 0xe0, 0xe2, 0x64, 0xba, 0xda, 0x17, 0x53, 0xfc, 0x12, 0x9e, 0x19, 0x9d, 0x2f, 0xa6,
-	0xf8, 0x64, 0xcd, 0xa4, 0xde, 0x17, 0x53, 0x7c, 0x96, 0xcd, 0xcb, 0x5f, 0x4c, 0x71, 0xb9, 0xc2, 0xd4, 0xa5, 0xfc,
-	0xbb, 0xf6, 0x63, 0xb3, 0xfb, 0xf2, 0x9f, 0xf9, 0x38, 0x22, 0xa2, 0xd9, 0x05, 0xb1, 0x06, 0x17, 0xd8, 0x35, 0xb5,
-	0x70, 0x8e, 0x91, 0x85, 0xb1, 0xe6, 0x15, 0xb8, 0x62, 0x58, 0x61, 0xc9, 0xa4, 0x82, 0x93, 0x31, 0x05, 0x37, 0x66,
-	0xcc, 0xcf, 0xcb, 0x46, 0x25, 0x72, 0xa4, 0xd6, 0x93, 0xd1, 0xaa, 0x4f, 0xc7, 0xb6, 0xf8, 0x9c, 0x68, 0x8b, 0xa3,
-	0xe6, 0xb6, 0x07, 0x3f, 0x9c, 0xb2, 0xc5, 0x9b, 0x6c, 0xe9, 0xfa, 0x5b, 0xf7, 0xd2, 0x59, 0x8a, 0x0c, 0x82, 0x37,
-	0xc9, 0x49, 0xcd, 0x61, 0x59, 0xe6, 0x48, 0x67, 0xd1, 0x3d, 0xab, 0x72, 0xb5, 0x2d, 0x73, 0x7f, 0x1e, 0x8c, 0x55,
-	0x28, 0x73, 0x7f, 0x43, 0xa7, 0xf4, 0xd1, 0xbf, 0x08, 0xd5, 0xe8, 0xf4, 0xb6, 0x05, 0x9d, 0x47, 0x3e, 0x79, 0x20,
-	0x56, 0x09, 0x53, 0x79, 0x43, 0x2a, 0x79, 0xf4, 0x4e, 0xa7, 0xca, 0x9c, 0xda, 0x7c, 0xb0, 0xcd, 0xb9, 0x2d, 0x83,
-	0x60, 0x25, 0x72, 0x6e, 0x6b, 0x58, 0x96, 0x39, 0xd2, 0x59, 0x74, 0xef, 0xea, 0x46, 0x82, 0x72, 0x3a, 0xfc, 0x54,
-	0x23, 0xb0, 0x1a, 0x05, 0x81, 0xb5, 0x29, 0x88, 0x63, 0xed, 0x52, 0x54, 0xb7, 0x92, 0x75, 0xaa, 0xa8, 0x19, 0x35,
-	0x0b, 0x61, 0xb5, 0x34, 0xa3, 0x36, 0x34, 0xa5, 0x8e, 0x7c, 0x22, 0x55, 0xa2, 0xbe, 0x6b, 0x41, 0xa6, 0xfb, 0x4f,
-	0x84, 0xe0, 0xcd, 0x23, 0x82, 0xf7, 0xce, 0x53, 0x5c, 0x73, 0x16, 0xdd, 0x99, 0xa6, 0xb8, 0x99, 0xc9, 0xf2, 0x62,
-	0x10, 0xbc, 0x71, 0x44, 0xf0, 0xc6, 0x24, 0x41, 0x5b, 0x5f, 0x82, 0xb6, 0x55, 0x09, 0xfa, 0x8a, 0x33, 0xf3, 0xaf,
-	0x34, 0x29, 0xff, 0xea, 0xcd, 0xc7, 0x25, 0xc1, 0x54, 0x7b, 0x46, 0x86, 0x74, 0x85, 0x33, 0x4f, 0xc9, 0xca, 0x2b,
-	0x09, 0x39, 0x43, 0x72, 0xb3, 0xfa, 0xf4, 0x08, 0x7f, 0x9d, 0x8d, 0x26, 0x40, 0xc6, 0xd3, 0x6e, 0xcd, 0x29, 0x82,
-	0xca, 0xa3, 0x2f, 0x87, 0x82, 0x67, 0x94, 0x88, 0x1a, 0xd3, 0x21, 0xe5, 0x3e, 0xa7, 0xc4, 0x02, 0x26, 0x3b, 0x07,
-	0x14, 0x5a, 0xc3, 0xa9, 0xfc, 0xce, 0x18, 0x43, 0x50, 0xa9, 0x8b, 0x47, 0x49, 0x76, 0xd4, 0xa5, 0xb0, 0x9a, 0x4e,
-	0x01, 0x78, 0x25, 0x15, 0x51, 0xb9, 0x99, 0x47, 0x99, 0x8f, 0x22, 0x16, 0x94, 0x3c, 0x5f, 0xf5, 0x49, 0xac, 0x89,
-	0x57, 0xc0, 0x71, 0x75, 0x64, 0xa0, 0x27, 0xec, 0x7a, 0x37, 0xc5, 0x81, 0x71, 0xd0, 0x2e, 0x3d, 0xd6, 0x2e, 0x90,
-	0x54, 0x2b, 0xc0, 0x62, 0xfe, 0x79, 0x92, 0x81, 0x5b, 0x64, 0x53, 0x9c, 0x28, 0x72, 0xa7, 0x01, 0xbf, 0xd3, 0xf4,
-	0x8f, 0x22, 0x65, 0xce, 0x27, 0xe3, 0xe9, 0xfd, 0x61, 0xbd, 0xd0, 0xb6, 0x38, 0xa0, 0xda, 0xbb, 0xc9, 0xe3, 0x9d,
-	0x97, 0x3c, 0xde, 0x51, 0xf2, 0x78, 0x57, 0x4b, 0x1e, 0xef, 0x38, 0x79, 0xbc, 0xa3, 0xe4, 0xf1, 0x8e, 0x92, 0xc7,
-	0xbb, 0x9c, 0x3c, 0x56, 0x33, 0xfd, 0x89, 0xf4, 0x1e, 0x9b, 0xba, 0x37, 0x62, 0xb1, 0xcb, 0x81, 0x82, 0x48, 0xf2,
-	0x04, 0x62, 0xbe, 0xe9, 0x1e, 0x7b, 0x7a, 0xa3, 0x47, 0x2c, 0xa3, 0xf0, 0x53, 0xce, 0xda, 0xed, 0x82, 0x70, 0xc1,
-	0xdf, 0x65, 0x92, 0x72, 0x07, 0xb2, 0x95, 0x31, 0x79, 0x22, 0x0c, 0xcd, 0x11, 0xc4, 0xba, 0x44, 0x60, 0x1b, 0x55,
-	0x09, 0xa6, 0xd0, 0xc2, 0x47, 0xcd, 0x6a, 0xb8, 0x88, 0xde, 0x52, 0x39, 0x8a, 0x34, 0xd9, 0x56, 0x0b, 0x96, 0x10,
-	0xc4, 0xc6, 0x9c, 0xc0, 0xbe, 0xf5, 0x64, 0x0b, 0x8e, 0x8d, 0xbe, 0x08, 0x6f, 0x19, 0xf1, 0x1b, 0xed, 0x07, 0xa3,
-	0x70, 0x4e, 0x44, 0x0a, 0x63, 0xc3, 0x52, 0xe0, 0x4a, 0x6c, 0x0a, 0x4b, 0x01, 0x2a, 0xb8, 0x8d, 0x52, 0x81, 0x6d,
-	0xa8, 0x16, 0xcf, 0xf2, 0xad, 0xd9, 0xff, 0xa4, 0x82, 0x7b, 0xb2, 0x15, 0x85, 0xaf, 0xc0, 0x36, 0x86, 0x13, 0x4c,
-	0x81, 0x9c, 0x88, 0x13, 0xfe, 0x80, 0xd8, 0x15, 0xc0, 0x8d, 0xeb, 0x34, 0x59, 0x37, 0xb1, 0x7a, 0x24, 0xc0, 0x84,
-	0xb9, 0x9d, 0x85, 0x67, 0x42, 0x76, 0x16, 0x80, 0x15, 0x04, 0xb1, 0x6e, 0x17, 0xd8, 0xc6, 0x7a, 0x82, 0x29, 0xd6,
-	0x8b, 0x4f, 0xcf, 0x4f, 0x4a, 0xf4, 0x96, 0xca, 0x51, 0xac, 0x47, 0x18, 0x63, 0x5d, 0x10, 0x1b, 0xeb, 0x02, 0xfb,
-	0xb6, 0x2d, 0xbf, 0x08, 0x6f, 0x2e, 0xbe, 0x65, 0xc4, 0x6f, 0xb4, 0x1f, 0xeb, 0xf4, 0x41, 0x78, 0xcb, 0xd8, 0x58,
-	0x77, 0x3f, 0x08, 0x6f, 0x59, 0x8a, 0xf5, 0xf2, 0x83, 0xf0, 0x16, 0xb6, 0xb1, 0x5e, 0x7e, 0x10, 0xde, 0x98, 0xfd,
-	0x4f, 0x2a, 0xb8, 0x27, 0x5b, 0x51, 0xac, 0x0b, 0x6c, 0x63, 0x3d, 0xc1, 0x14, 0xeb, 0x89, 0x38, 0xe1, 0x0f, 0x88,
-	0x67, 0x01, 0xdc, 0x58, 0x4f, 0x49, 0x1f, 0x13, 0xab, 0x47, 0x02, 0x4c, 0xac, 0xdb, 0x8c, 0x8f, 0x12, 0x70, 0x97,
-	0x22, 0xe2, 0x11, 0xa7, 0x10, 0x40, 0x92, 0xa2, 0xbf, 0x20, 0xb9, 0x0f, 0x20, 0x6d, 0x7b, 0x02, 0x70, 0xb7, 0x95,
-	0x73, 0xb8, 0x57, 0x98, 0x07, 0x50, 0x63, 0x0f, 0xa7, 0x1e, 0x52, 0x7f, 0x00, 0xe5, 0x15, 0xe1, 0xde, 0x52, 0x3e,
-	0xbc, 0xf1, 0xf1, 0x53, 0x66, 0xab, 0xf4, 0x1f, 0xff, 0xe1, 0x8d, 0xcf, 0x53, 0x5f, 0xaa, 0x3f, 0xbc, 0xf1, 0xcb,
-	0x70, 0xbf, 0x72, 0x1e, 0xde, 0xf8, 0x24, 0xf5, 0x31, 0x20, 0xb9, 0xa7, 0x01, 0xf9, 0x67, 0xe5, 0xa4, 0x7d, 0xc5,
-	0xf2, 0xdc, 0xf7, 0x90, 0xa4, 0x1e, 0x58, 0x90, 0xdc, 0x0f, 0x0b, 0xfa, 0xbb, 0x5e, 0xc7, 0x7e, 0x87, 0xb0, 0xdf,
-	0x33, 0x8b, 0x4c, 0xa1, 0xdb, 0xbf, 0x8e, 0x15, 0xd8, 0xf6, 0x55, 0x37, 0x4d, 0x98, 0xe8, 0x22, 0xdd, 0xb2, 0xa7,
-	0xb4, 0xd4, 0x9e, 0x76, 0xb6, 0x65, 0x3b, 0x14, 0x98, 0xff, 0x58, 0x4b, 0x5f, 0x32, 0x33, 0x8b, 0xcc, 0x78, 0x78,
-	0xd1, 0xd3, 0xd7, 0xaf, 0x04, 0xc9, 0xfb, 0x4c, 0x0c, 0x5c, 0x3e, 0xd3, 0x2d, 0xc8, 0x85, 0xae, 0x59, 0x22, 0x70,
-	0x65, 0x81, 0x6b, 0x58, 0xf4, 0x0a, 0x92, 0xc2, 0xc0, 0xc0, 0xb0, 0xbe, 0x2e, 0x99, 0xb4, 0x2a, 0x8e, 0x2b, 0xde,
-	0x19, 0x73, 0x91, 0x48, 0x31, 0xfa, 0xd4, 0x03, 0x8d, 0x7a, 0xca, 0xaf, 0xa7, 0x02, 0x22, 0x0a, 0x02, 0x88, 0xd7,
-	0x83, 0x9f, 0xf0, 0x35, 0x54, 0x00, 0x4d, 0x5f, 0x7d, 0xd2, 0xd7, 0x4e, 0x01, 0xb2, 0x8f, 0xc7, 0x9e, 0xd2, 0x6b,
-	0xa6, 0x00, 0x98, 0x8e, 0xf7, 0x64, 0x3f, 0x17, 0xf5, 0xd4, 0xca, 0xd1, 0x50, 0x0f, 0xcc, 0x13, 0xb4, 0xa7, 0x52,
-	0x78, 0x00, 0xe6, 0x07, 0x6b, 0x4f, 0x59, 0x62, 0x00, 0x29, 0x75, 0x05, 0x08, 0xfb, 0x03, 0xd3, 0x4f, 0x59, 0x41,
-	0x00, 0x31, 0x3f, 0x97, 0xfd, 0x44, 0x5f, 0x5c, 0x7a, 0xb6, 0x3f, 0x71, 0xfe, 0x8c, 0xf2, 0xfa, 0x4c, 0x9a, 0xfa,
-	0xec, 0x0b, 0xe9, 0xb3, 0xa7, 0x9e, 0xcf, 0x24, 0x99, 0xcf, 0x35, 0x9d, 0x7c, 0x66, 0x71, 0x7c, 0x26, 0x45, 0x7c,
-	0x26, 0x19, 0x7c, 0xa6, 0x9f, 0x62, 0x7f, 0xc1, 0x8d, 0x5a, 0x2f, 0xb4, 0x51, 0xeb, 0x85, 0x36, 0x6a, 0xbd, 0xf8,
-	0x1b, 0xb5, 0x5e, 0xbc, 0x8d, 0x5a, 0x2f, 0xee, 0x46, 0xad, 0x17, 0xda, 0xa8, 0xf5, 0xc2, 0x1b, 0xb5, 0x5e, 0x78,
-	0xa3, 0xd6, 0x11, 0x7f, 0x73, 0xfd, 0x48, 0xbf, 0xb9, 0x7e, 0xa4, 0xdf, 0x5c, 0x3f, 0xfa, 0xbf, 0xb9, 0x7e, 0xf4,
-	0x7e, 0x73, 0xfd, 0x48, 0xbf, 0xb9, 0x7e, 0xe4, 0xdf, 0x5c, 0x3f, 0xf2, 0x6f, 0xae, 0x1f, 0xed, 0x6f, 0xae, 0x1f,
-	0xe9, 0x37, 0xd7, 0x8f, 0xb6, 0x0b, 0x1c, 0xd1, 0xe6, 0x47, 0xb2, 0xf9, 0x91, 0x6c, 0x7e, 0xf4, 0x6d, 0x7e, 0xf4,
-	0x6c, 0x7e, 0x74, 0x6d, 0x7e, 0x24, 0x9b, 0x1f, 0xd9, 0xe6, 0x47, 0xcf, 0xe6, 0x6d, 0x74, 0x8f, 0xf3, 0x41, 0x8a,
-	0x6e, 0x45, 0x8a, 0xe8, 0x56, 0x18, 0xa2, 0x5b, 0xc1, 0x14, 0xdd, 0x8a, 0x98, 0xe8, 0x56, 0x22, 0x47, 0xb7, 0x42,
-	0x29, 0xba, 0x15, 0x49, 0xd1, 0x9d, 0x11, 0xdb, 0x5b, 0x65, 0xe4, 0xc2, 0xb8, 0x11, 0xc4, 0x06, 0x8f, 0xc0, 0x36,
-	0x82, 0x04, 0x76, 0xc3, 0x48, 0x38, 0x27, 0x96, 0x84, 0xb1, 0x01, 0x25, 0x30, 0x45, 0x95, 0xe0, 0x14, 0x5a, 0x82,
-	0x9b, 0xf8, 0x12, 0xd4, 0x06, 0x59, 0x91, 0xa6, 0x30, 0xed, 0x47, 0xb7, 0x0b, 0x62, 0x63, 0x4e, 0x60, 0x1b, 0x78,
-	0x09, 0xf6, 0xa2, 0x4f, 0x38, 0x27, 0x04, 0x13, 0xe3, 0xc4, 0xa1, 0x50, 0x36, 0x18, 0x05, 0xa6, 0x88, 0x14, 0x9c,
-	0xc2, 0x52, 0x13, 0x1f, 0xe3, 0x12, 0xb1, 0x01, 0xea, 0x25, 0x3e, 0x0c, 0xe7, 0x84, 0xaa, 0x49, 0x7c, 0x18, 0xb8,
-	0x12, 0xb4, 0x36, 0xf1, 0x61, 0x70, 0x1b, 0xbe, 0x26, 0xf1, 0x51, 0xc2, 0x14, 0xc8, 0xb9, 0x92, 0x18, 0xcb, 0x0a,
-	0xda, 0x70, 0x56, 0xc6, 0x46, 0xb4, 0x32, 0x6e, 0x50, 0x2b, 0xed, 0xc4, 0xb5, 0x92, 0x36, 0xb4, 0x95, 0xa1, 0xe8,
-	0x56, 0x8a, 0x02, 0x5c, 0x29, 0x13, 0xe3, 0x4a, 0xd8, 0x30, 0x37, 0x9b, 0xfc, 0x1d, 0x03, 0x61, 0x58, 0x29, 0x68,
-	0xe3, 0x5d, 0x19, 0x1b, 0xf2, 0xc0, 0x78, 0x51, 0xaf, 0xb4, 0x13, 0xf8, 0x40, 0x3a, 0xb1, 0xaf, 0xac, 0x0d, 0x7f,
-	0x65, 0xa8, 0x07, 0x28, 0x45, 0x9d, 0x20, 0x53, 0xd8, 0x0f, 0x14, 0xb4, 0x5d, 0x41, 0x19, 0xb7, 0x37, 0x28, 0xed,
-	0x74, 0x08, 0x25, 0x6d, 0x9f, 0x50, 0xa6, 0xd2, 0x2d, 0xb4, 0x00, 0xf5, 0x0c, 0xa5, 0x6c, 0xe7, 0x50, 0xc6, 0xf6,
-	0x0f, 0xfb, 0x36, 0x47, 0x8e, 0x80, 0x6f, 0xb0, 0xc5, 0xf5, 0x9b, 0xdd, 0xd7, 0xfa, 0xcd, 0x6e, 0x66, 0xfd, 0xe6,
-	0xee, 0x60, 0xfd, 0xe6, 0x6c, 0x5b, 0xfd, 0xe6, 0xed, 0x55, 0xfd, 0x66, 0x37, 0xa8, 0x7e, 0xa3, 0x5d, 0xa9, 0xdf,
-	0x68, 0x2b, 0xea, 0xb7, 0xa4, 0xc6, 0x16, 0x30, 0x75, 0x2d, 0xb4, 0x98, 0x50, 0xa7, 0xd6, 0x56, 0x89, 0x89, 0xe0,
-	0xfa, 0x17, 0x3a, 0x6c, 0x51, 0xdb, 0x92, 0x52, 0x85, 0x33, 0x2c, 0x3f, 0xe9, 0x48, 0x80, 0x69, 0x4e, 0xfa, 0xe5,
-	0xc9, 0xb2, 0x39, 0x09, 0x75, 0x9a, 0x23, 0x14, 0x37, 0x27, 0x11, 0xdc, 0x1c, 0x61, 0x4c, 0x73, 0x04, 0xb5, 0xcd,
-	0x11, 0xd8, 0x36, 0x47, 0x2f, 0xbb, 0x72, 0x41, 0xd3, 0x2c, 0x60, 0x4c, 0xd3, 0x90, 0x71, 0x9a, 0x07, 0x34, 0x37,
-	0x11, 0x49, 0x6e, 0x26, 0xb0, 0xa6, 0xa9, 0xc0, 0xd8, 0xe6, 0x02, 0x05, 0x4d, 0xfe, 0xe5, 0xe1, 0xf6, 0xf5, 0x6a,
-	0xf7, 0xf0, 0x76, 0xb9, 0xde, 0xed, 0xf3, 0xd1, 0xab, 0xe5, 0xe3, 0xb2, 0x3b, 0xf8, 0xc7, 0xf6, 0xe1, 0xf1, 0xdf,
-	0xab, 0xc7, 0xdd, 0xfa, 0x26, 0x90, 0xff, 0x0d, 0xc4, 0x0b, 0xe5, 0xe9 };
@@ -1,738 +0,0 @@
-// helvetica_oblique.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_HELVETICA_OBLIQUE[] = { 0x78, 0x9c, 0xb5, 0x7d, 0x5d, 0x73, 0xdb, 0x48, 0xb2, 0xe5, 0x7b, 0x47,
-	0xf4, 0x7f, 0xe0, 0xe3, 0x6e, 0xc4, 0x7a, 0x96, 0x5f, 0xe0, 0xc7, 0xcc, 0x93, 0xa7, 0xdd, 0xf6, 0xf4, 0xb8, 0x7b,
-	0x64, 0xbb, 0x65, 0x71, 0x7c, 0xdf, 0x28, 0x09, 0xb2, 0x79, 0x4d, 0x11, 0x1e, 0x52, 0x94, 0x44, 0xff, 0xfa, 0x0b,
-	0xa0, 0xb2, 0x2a, 0x4f, 0xe5, 0xc9, 0xa2, 0xf7, 0x65, 0xc3, 0x11, 0x0e, 0xe1, 0x9c, 0x02, 0x50, 0x95, 0x99, 0x75,
-	0xea, 0x1b, 0xfc, 0xf3, 0x61, 0xbd, 0x7f, 0x78, 0xdd, 0xec, 0x1e, 0xfe, 0xa8, 0x1f, 0xf6, 0x9b, 0x9b, 0xc3, 0x60,
-	0xfa, 0x97, 0xd1, 0xcf, 0x3f, 0xfd, 0xd2, 0xdc, 0xdf, 0xd7, 0xbb, 0x87, 0xc1, 0x2f, 0xcd, 0xb7, 0xd3, 0x7e, 0xf3,
-	0xf9, 0xcb, 0xc3, 0xe0, 0x7f, 0xdd, 0xfc, 0xef, 0xc1, 0x68, 0xb9, 0xa8, 0xfe, 0x4f, 0xf7, 0xff, 0xbc, 0xff, 0x7f,
-	0xd9, 0xfd, 0xbf, 0x1c, 0xf6, 0xff, 0xcf, 0x07, 0x2f, 0x6f, 0x9b, 0xeb, 0x7a, 0xf0, 0xe7, 0xe9, 0xf0, 0x50, 0xdf,
-	0x1f, 0x06, 0xbf, 0xed, 0x6e, 0x9a, 0xfd, 0xb7, 0x66, 0xbf, 0x7e, 0xa8, 0x6f, 0xff, 0x32, 0x18, 0xbc, 0xdc, 0x6e,
-	0x07, 0x1f, 0xba, 0xe7, 0x1c, 0x06, 0x1f, 0xea, 0x43, 0xbd, 0x7f, 0x6c, 0x51, 0x78, 0xcb, 0xbe, 0x5e, 0x3f, 0x6c,
-	0x9a, 0xdd, 0xe0, 0x55, 0x9b, 0xfc, 0xaf, 0x83, 0xcb, 0x2f, 0xc7, 0xc1, 0x1f, 0xeb, 0xd3, 0x60, 0x30, 0x1a, 0x8c,
-	0xc6, 0x7f, 0x9d, 0x4e, 0xff, 0x3a, 0x19, 0xf5, 0xaf, 0xd0, 0x1b, 0x3e, 0xee, 0x36, 0xff, 0x39, 0xd6, 0xbf, 0xbd,
-	0x1a, 0x4c, 0x27, 0xc3, 0xaa, 0x52, 0xfc, 0xea, 0x8f, 0xe3, 0x61, 0xfd, 0xb9, 0x1e, 0x8c, 0xa6, 0xcb, 0xd9, 0x70,
-	0x30, 0x5b, 0x4e, 0xa6, 0xb3, 0x9f, 0x7f, 0xea, 0x0a, 0xf7, 0xaf, 0xf5, 0x7d, 0x3d, 0xf8, 0x47, 0xbd, 0x7d, 0xac,
-	0x1f, 0x36, 0x37, 0xeb, 0x17, 0x17, 0xd7, 0xdb, 0xee, 0x01, 0x2d, 0x77, 0xdc, 0x6e, 0x73, 0x6e, 0xa0, 0xdc, 0xfa,
-	0x7e, 0xb3, 0x3d, 0xe5, 0xec, 0xcf, 0x3f, 0xad, 0xea, 0xde, 0x1c, 0x7f, 0xd4, 0xb7, 0x9b, 0xe3, 0xfd, 0xcf, 0x3f,
-	0xfd, 0xf6, 0xb0, 0xde, 0x6e, 0x6e, 0x5e, 0xee, 0x3e, 0x6f, 0xeb, 0xc1, 0x8b, 0xd1, 0xb8, 0x05, 0x0e, 0xaf, 0x37,
-	0xcf, 0xf5, 0xed, 0xbb, 0xcd, 0xc3, 0xcd, 0x97, 0xc1, 0xdd, 0x7a, 0x7b, 0x68, 0x9f, 0xf4, 0xcb, 0x97, 0xf5, 0x7e,
-	0x7d, 0xf3, 0x50, 0xef, 0xff, 0xac, 0x1f, 0x06, 0xbf, 0x3e, 0x3f, 0xd4, 0xbb, 0xdb, 0xfa, 0xf6, 0x43, 0x73, 0xbf,
-	0xde, 0x85, 0xdc, 0xfd, 0xfd, 0xef, 0xcd, 0x73, 0x7b, 0xf7, 0x7c, 0x38, 0x78, 0x31, 0x1e, 0x57, 0x83, 0xd1, 0x68,
-	0x34, 0x1b, 0x2c, 0xdb, 0x42, 0xff, 0xfc, 0xd3, 0xc7, 0x36, 0xe5, 0x7e, 0xbb, 0xd9, 0xd5, 0xef, 0x9a, 0xc3, 0xa6,
-	0x37, 0xd1, 0x8b, 0xd1, 0x70, 0x08, 0xf8, 0xe5, 0x97, 0xcd, 0xcd, 0xd7, 0x5d, 0x7d, 0x38, 0x0c, 0xaa, 0x16, 0xbe,
-	0xaa, 0xf7, 0x87, 0x2e, 0xd1, 0x70, 0x38, 0xfe, 0xcb, 0xb0, 0x4b, 0xf7, 0xaf, 0xa6, 0xcd, 0x75, 0xfd, 0xff, 0xd5,
-	0x8d, 0x6a, 0xb9, 0xcd, 0x61, 0xb0, 0x1e, 0x3c, 0xec, 0xd7, 0xb7, 0xf5, 0xfd, 0x7a, 0xff, 0x75, 0xd0, 0xdc, 0x0d,
-	0x7e, 0xdf, 0xec, 0x9a, 0x87, 0xd3, 0xb7, 0xfa, 0x45, 0x9b, 0x68, 0x3b, 0x78, 0xf9, 0x66, 0xb0, 0xde, 0xdd, 0xfe,
-	0xdf, 0x66, 0x3f, 0xd8, 0xb4, 0x0f, 0x38, 0x1c, 0xaf, 0x0f, 0x9b, 0xdb, 0xcd, 0x7a, 0xbf, 0xa9, 0x0f, 0x6d, 0x2c,
-	0xfc, 0xda, 0xbe, 0xe9, 0x76, 0xb3, 0xfb, 0xfc, 0xe7, 0xcd, 0x97, 0xba, 0xb5, 0x78, 0x9f, 0x8d, 0x3f, 0x1f, 0xda,
-	0xf4, 0xeb, 0xfd, 0x6d, 0xe4, 0x5a, 0x4b, 0xae, 0xbf, 0xfd, 0x23, 0x38, 0x60, 0x3e, 0x5a, 0xfc, 0xfc, 0xd3, 0xbf,
-	0xe5, 0xa2, 0x1a, 0x4f, 0x7e, 0xfe, 0xe9, 0xe5, 0xe1, 0xa6, 0x33, 0xec, 0x3e, 0x50, 0xaf, 0xea, 0x78, 0xf9, 0x62,
-	0x3c, 0x6c, 0x43, 0xe7, 0xcf, 0x87, 0xdb, 0x7f, 0xac, 0x06, 0xf3, 0x59, 0xff, 0xd7, 0xd5, 0x6a, 0xb0, 0x58, 0x74,
-	0x7f, 0xb5, 0xb1, 0xdf, 0x39, 0x27, 0xc6, 0xfe, 0x64, 0xd4, 0x05, 0xd3, 0x60, 0x32, 0x1e, 0xfc, 0x6d, 0xb0, 0xfa,
-	0xf7, 0x60, 0x3c, 0x5f, 0xb4, 0x7f, 0xfc, 0x6b, 0x70, 0xf8, 0xb6, 0x6e, 0x8d, 0xf8, 0xb7, 0xc1, 0xdf, 0x07, 0x43,
-	0xf9, 0xf7, 0xb7, 0x3e, 0xd9, 0x24, 0x4f, 0x56, 0x3f, 0xdf, 0x6c, 0xd7, 0xf7, 0x7d, 0xba, 0x65, 0x97, 0x68, 0x32,
-	0x1d, 0x76, 0x79, 0x91, 0xc4, 0xd3, 0x90, 0x78, 0x52, 0x55, 0x7d, 0xe2, 0xff, 0x1c, 0x9b, 0xd6, 0xa6, 0xd7, 0xdb,
-	0x3e, 0xf9, 0x68, 0xb6, 0x18, 0x4c, 0x67, 0x93, 0x36, 0x9c, 0x17, 0x70, 0x47, 0x15, 0xee, 0xa8, 0xaa, 0x59, 0x7f,
-	0xc7, 0xee, 0x78, 0x7f, 0xdd, 0xf9, 0xf7, 0xf3, 0xae, 0xbf, 0x67, 0x3e, 0x69, 0x5f, 0x31, 0x6b, 0xa3, 0x64, 0xb6,
-	0x88, 0x37, 0xcc, 0xf2, 0x1b, 0x6e, 0x9b, 0xed, 0x76, 0xbd, 0xef, 0x13, 0xcf, 0x96, 0x6d, 0xe0, 0x8c, 0xaa, 0xc1,
-	0x6c, 0x34, 0x1f, 0xcc, 0xe7, 0x95, 0xa4, 0x9f, 0x87, 0xf4, 0x8b, 0xc5, 0xb2, 0x4f, 0xff, 0xad, 0xde, 0xdf, 0x74,
-	0xb5, 0xa8, 0xcf, 0xd1, 0x74, 0xde, 0xde, 0xb1, 0xec, 0xb9, 0xf9, 0x70, 0x22, 0x37, 0x2c, 0xc2, 0x0d, 0xb3, 0xd9,
-	0xbc, 0xbf, 0x61, 0x7d, 0xdf, 0xde, 0x72, 0x68, 0x7d, 0x14, 0x32, 0xd4, 0xdd, 0xd1, 0xbe, 0xa2, 0xbd, 0x53, 0xcb,
-	0xb0, 0x14, 0x13, 0x8d, 0xc7, 0x5a, 0xea, 0x10, 0x89, 0xfd, 0x5b, 0xaa, 0x51, 0x5f, 0xee, 0xc9, 0x08, 0x2c, 0xd5,
-	0x5a, 0x2d, 0x58, 0xaa, 0xb7, 0x6f, 0x9b, 0xad, 0xf5, 0xbe, 0xde, 0x6d, 0xeb, 0x3b, 0xb9, 0x65, 0xb8, 0xe8, 0x3d,
-	0x3a, 0x98, 0x56, 0xd3, 0xd6, 0x06, 0x92, 0xb3, 0xe9, 0xc8, 0xb9, 0x47, 0xdf, 0xf3, 0x62, 0x19, 0xee, 0x99, 0xb4,
-	0x45, 0xd6, 0x7b, 0xc4, 0xcb, 0x13, 0x29, 0xfe, 0xfa, 0xd0, 0x65, 0xed, 0xf0, 0x55, 0x3c, 0x52, 0xb5, 0xde, 0x68,
-	0x73, 0xd7, 0x1a, 0x4b, 0x73, 0x26, 0x0e, 0xaf, 0x16, 0xd3, 0xf0, 0x96, 0xed, 0xf1, 0xd0, 0xa7, 0x5e, 0x54, 0x9d,
-	0x2f, 0x86, 0xb3, 0xb6, 0x12, 0x8a, 0x6d, 0xa7, 0xd3, 0x3c, 0x36, 0x6e, 0x5a, 0x85, 0x5a, 0xf7, 0x69, 0x5b, 0xe7,
-	0xbc, 0xe8, 0xac, 0x3b, 0x1e, 0x4d, 0xdb, 0xc2, 0xcc, 0x24, 0x79, 0x95, 0xe7, 0xff, 0xcb, 0xe9, 0xdb, 0x97, 0x3a,
-	0xf8, 0x79, 0x39, 0x19, 0x8c, 0xdb, 0x80, 0x9c, 0x54, 0x6d, 0xf6, 0x3b, 0x2b, 0xf6, 0xc9, 0x67, 0xf9, 0xd3, 0x5b,
-	0x37, 0x6c, 0x9a, 0xe0, 0x85, 0xc5, 0xbc, 0xcd, 0x4a, 0xfe, 0xec, 0xb9, 0x89, 0xe6, 0xed, 0xfa, 0xf0, 0x25, 0x98,
-	0x65, 0x3c, 0xea, 0x9d, 0x3c, 0xad, 0xc6, 0xad, 0x59, 0xe6, 0x92, 0x7c, 0x91, 0x47, 0xd1, 0xf7, 0x7a, 0xdf, 0xc4,
-	0x8c, 0x74, 0x89, 0x67, 0xad, 0x03, 0x52, 0x44, 0x4c, 0x97, 0x79, 0xe2, 0x66, 0x17, 0xea, 0x49, 0x67, 0xec, 0x61,
-	0x6b, 0x0d, 0x48, 0x5a, 0x0d, 0xf3, 0xa4, 0x0f, 0x4f, 0xe1, 0xb1, 0xe3, 0x59, 0x67, 0xbb, 0x2e, 0x2e, 0x53, 0xca,
-	0x91, 0x49, 0xf9, 0x65, 0x5f, 0x87, 0xc7, 0xb6, 0xce, 0xe8, 0xb3, 0xd0, 0x85, 0x4b, 0x4a, 0x3d, 0xce, 0x53, 0xdf,
-	0x35, 0x47, 0x89, 0xf9, 0x51, 0x97, 0x85, 0xf9, 0x0c, 0x92, 0x4e, 0x4c, 0xd2, 0xcd, 0x63, 0x78, 0x6e, 0x5b, 0xfd,
-	0xfa, 0xe7, 0x8e, 0xa1, 0x36, 0x55, 0xd3, 0x3c, 0xf1, 0x61, 0xf3, 0x1c, 0xcc, 0x30, 0x92, 0x3c, 0x54, 0xf0, 0x60,
-	0x53, 0x55, 0x0f, 0xf5, 0xa3, 0x78, 0x6f, 0x34, 0xe9, 0x0c, 0x31, 0x6b, 0xeb, 0x9f, 0x3e, 0xd8, 0x54, 0xd3, 0x3a,
-	0x85, 0xe9, 0x7c, 0x2a, 0x16, 0x46, 0x63, 0xcc, 0x8d, 0x0a, 0x6c, 0xc4, 0xc4, 0x8b, 0xb1, 0x24, 0x86, 0x0a, 0x5a,
-	0x2d, 0x6c, 0xd4, 0x6d, 0x9b, 0x9d, 0x86, 0xc5, 0x64, 0x38, 0x6a, 0x8d, 0x2b, 0x61, 0x51, 0x2d, 0xf3, 0xb4, 0x87,
-	0xfa, 0x7e, 0xa3, 0xe9, 0x63, 0x94, 0x66, 0xb7, 0xcc, 0xa2, 0x0b, 0x25, 0xfe, 0xb7, 0x5d, 0xbb, 0xd3, 0xdb, 0xa4,
-	0x0d, 0xb7, 0xd6, 0x74, 0x6d, 0x2d, 0x9c, 0x2e, 0xa5, 0x02, 0xcc, 0x46, 0x79, 0xda, 0xfa, 0x3f, 0xc7, 0x75, 0x10,
-	0xbb, 0xb6, 0xbe, 0xf7, 0x52, 0x34, 0x5e, 0xb4, 0xf2, 0x20, 0x52, 0x3a, 0x1b, 0xe7, 0xa9, 0x3f, 0x77, 0x3d, 0x82,
-	0x3a, 0xf8, 0xb1, 0x0d, 0x9c, 0xf6, 0xe1, 0x55, 0xdb, 0x36, 0xe9, 0xc3, 0x8d, 0x23, 0xdb, 0xf6, 0xfa, 0xd0, 0xb7,
-	0x8e, 0xa1, 0xea, 0x8e, 0xfa, 0x88, 0x6a, 0x63, 0x64, 0x2c, 0x31, 0x3d, 0x13, 0x5f, 0x8e, 0x86, 0xa3, 0xa0, 0xbe,
-	0xeb, 0x60, 0xf0, 0xf1, 0x28, 0x04, 0xd4, 0xb2, 0xad, 0xed, 0xa9, 0x02, 0xcc, 0xaa, 0x5c, 0xe5, 0x5e, 0x8a, 0x20,
-	0x76, 0x0f, 0xed, 0x34, 0x27, 0xaa, 0xc1, 0x6c, 0x96, 0xa7, 0xfb, 0x7b, 0xf4, 0x61, 0xa7, 0x65, 0x63, 0x48, 0x27,
-	0x1e, 0x9c, 0x8b, 0x06, 0xfe, 0xa2, 0x3a, 0xd6, 0xbe, 0x7a, 0xbe, 0x80, 0xba, 0x37, 0x5b, 0xe4, 0x49, 0x5f, 0x05,
-	0xdf, 0x75, 0xe5, 0x99, 0xcf, 0xf0, 0xd5, 0xcb, 0xfc, 0xd5, 0xbf, 0x86, 0x74, 0xb3, 0x3e, 0x1d, 0xbc, 0x7a, 0x2e,
-	0x0e, 0x9b, 0x8d, 0x46, 0x7d, 0xba, 0xd7, 0x90, 0xae, 0x6d, 0x2d, 0x34, 0x9d, 0x38, 0x6b, 0x2e, 0xb1, 0xf0, 0x26,
-	0x64, 0x71, 0x14, 0x42, 0x7d, 0xbe, 0x5c, 0x6a, 0x16, 0xe7, 0xe3, 0x3c, 0x8b, 0xff, 0x88, 0xda, 0x3f, 0x0c, 0xe9,
-	0xd2, 0x23, 0x4d, 0xe3, 0xf8, 0x5b, 0xac, 0x3c, 0x5d, 0xbb, 0x38, 0x82, 0x74, 0xb1, 0x9a, 0x0d, 0x87, 0x7d, 0xba,
-	0x7f, 0xf6, 0xe9, 0xa4, 0xf5, 0xa9, 0x16, 0x98, 0xd2, 0xf8, 0xe5, 0x6d, 0x78, 0x73, 0x57, 0x98, 0xc5, 0x10, 0xda,
-	0xcd, 0xb9, 0xa9, 0x5f, 0xbf, 0x6b, 0xba, 0xaa, 0x02, 0x35, 0x9f, 0xc7, 0xe6, 0x4f, 0x34, 0xf7, 0x0f, 0x6d, 0x56,
-	0x97, 0x23, 0x30, 0xf6, 0xdc, 0x38, 0xe5, 0x5f, 0xfa, 0xbc, 0xbc, 0xc4, 0xcb, 0xdc, 0x88, 0x17, 0xe2, 0xe7, 0x10,
-	0x62, 0x8b, 0x56, 0xe7, 0x92, 0x11, 0x17, 0xc3, 0xbc, 0x28, 0xef, 0xd0, 0x2f, 0xd0, 0x7c, 0x2e, 0x8c, 0x5f, 0xde,
-	0xeb, 0x23, 0xdb, 0xc2, 0xe5, 0x8f, 0x34, 0x7e, 0xf9, 0x10, 0x1e, 0xb9, 0xe8, 0x1e, 0xd9, 0x96, 0x49, 0x1f, 0x39,
-	0xc9, 0x5f, 0xfd, 0xe7, 0x40, 0xfa, 0x2b, 0xbd, 0xa7, 0x47, 0x13, 0x78, 0xe2, 0x34, 0x0f, 0x9e, 0x4b, 0xa9, 0x07,
-	0xfd, 0x23, 0x2b, 0x68, 0xb0, 0x17, 0x55, 0xfe, 0xea, 0x8f, 0x21, 0xe1, 0x78, 0x22, 0xd1, 0x83, 0x05, 0x32, 0x75,
-	0xe6, 0x2a, 0x24, 0xed, 0x8d, 0xbe, 0x18, 0xe2, 0x33, 0xc5, 0x39, 0xcb, 0x69, 0x10, 0x84, 0x95, 0x54, 0xed, 0x65,
-	0x9b, 0xb0, 0xad, 0x3a, 0x10, 0x16, 0x0b, 0xd3, 0x29, 0xf9, 0x77, 0x48, 0xb9, 0xec, 0xdd, 0x83, 0x4f, 0x34, 0x75,
-	0xe6, 0x93, 0x3c, 0x71, 0xde, 0xbf, 0x1a, 0x2a, 0xc3, 0xd2, 0x54, 0x9a, 0xff, 0x0a, 0x52, 0xd1, 0x65, 0x71, 0x8e,
-	0x91, 0xbb, 0x1c, 0xe5, 0x11, 0x7e, 0xdd, 0xf6, 0xf1, 0xbf, 0xd6, 0x0f, 0xa9, 0xa7, 0x12, 0x1a, 0xd7, 0x59, 0xdb,
-	0x9f, 0x99, 0x04, 0xd3, 0xf4, 0x37, 0x99, 0xae, 0xe5, 0x75, 0x7b, 0x8f, 0x36, 0xc8, 0xa3, 0x69, 0xf0, 0xc3, 0xb8,
-	0x7d, 0x76, 0xf2, 0xc3, 0x72, 0xe2, 0xbe, 0x07, 0x7a, 0x37, 0xa3, 0x69, 0x78, 0xd3, 0xa4, 0xd5, 0x0f, 0x7d, 0x93,
-	0xb8, 0x6f, 0x3a, 0x8b, 0xdd, 0x9b, 0x9b, 0xcd, 0xe6, 0x66, 0xb3, 0xbf, 0x39, 0x86, 0x2e, 0x6a, 0xdb, 0xfd, 0x19,
-	0xb7, 0x9a, 0x52, 0x4d, 0xa0, 0x69, 0x5a, 0x9a, 0x76, 0xec, 0xd8, 0x75, 0xa0, 0x0f, 0xed, 0x10, 0x20, 0x34, 0x39,
-	0x2f, 0xc6, 0x5d, 0xb5, 0x6c, 0x47, 0x28, 0x55, 0x97, 0xcf, 0xd8, 0x8d, 0x5c, 0xc6, 0xce, 0x08, 0xf6, 0xf1, 0xb4,
-	0xbf, 0xd6, 0x75, 0xa4, 0x5a, 0x1d, 0x9a, 0x8c, 0x3b, 0x2b, 0xc4, 0x5b, 0x4c, 0xa3, 0x16, 0x7a, 0x46, 0xb3, 0x51,
-	0xdf, 0x81, 0xac, 0xda, 0x96, 0xa9, 0x9a, 0xc4, 0x1c, 0x99, 0xde, 0xc8, 0x75, 0x68, 0x12, 0x16, 0x21, 0xe5, 0x02,
-	0xaa, 0xe9, 0x32, 0x76, 0x45, 0x44, 0x48, 0x6e, 0xa2, 0x1c, 0x87, 0x67, 0x4e, 0xf4, 0x99, 0xa3, 0xa1, 0xe9, 0x8a,
-	0x48, 0xcf, 0x29, 0x24, 0x9d, 0x55, 0x20, 0xa0, 0x6d, 0x83, 0x91, 0x27, 0xad, 0x31, 0x69, 0xd5, 0x7a, 0x04, 0x9e,
-	0x6a, 0x5c, 0x7b, 0xa7, 0x95, 0x7a, 0xda, 0xb6, 0xa0, 0xf3, 0x71, 0x07, 0xff, 0x3e, 0xd8, 0xb4, 0xdd, 0x8e, 0xfe,
-	0x8f, 0xed, 0xe0, 0x6e, 0x1b, 0x6f, 0x35, 0xed, 0xd9, 0xe7, 0xe8, 0xa1, 0x76, 0x3c, 0x18, 0x9a, 0x32, 0x78, 0x8d,
-	0xe9, 0x97, 0x84, 0xc8, 0x99, 0x55, 0x7d, 0x67, 0x67, 0x82, 0x59, 0xaf, 0x72, 0xbf, 0x6c, 0x42, 0xc2, 0xd0, 0x11,
-	0x58, 0x60, 0x42, 0xe3, 0xc0, 0xff, 0x0e, 0xce, 0x9e, 0x75, 0xc3, 0xd1, 0x11, 0x25, 0x9e, 0xe7, 0x66, 0xfe, 0xaa,
-	0x4f, 0x9d, 0x61, 0x05, 0xee, 0xda, 0xb7, 0xec, 0xa9, 0xdb, 0xe2, 0xeb, 0x97, 0xb9, 0x0e, 0xdf, 0x6b, 0x81, 0x16,
-	0xad, 0x2f, 0xb4, 0xe4, 0x23, 0xe3, 0xb6, 0x5d, 0x5e, 0x72, 0x48, 0x68, 0x9c, 0x16, 0x3a, 0x9a, 0x8b, 0x49, 0x5f,
-	0x53, 0xaa, 0x56, 0xae, 0x20, 0xa9, 0xe9, 0x3d, 0x7e, 0x93, 0x7a, 0x18, 0xc6, 0x0b, 0x5d, 0x80, 0x41, 0x5a, 0xdb,
-	0xeb, 0x48, 0xb1, 0xd0, 0xa5, 0x9d, 0x0d, 0xb3, 0xe7, 0xc6, 0xe1, 0x9e, 0x14, 0x6a, 0xaf, 0xcd, 0xe4, 0xb4, 0xed,
-	0xbd, 0x43, 0xc2, 0x2a, 0xb7, 0x67, 0xe8, 0x50, 0xcd, 0x26, 0x21, 0xc0, 0xc6, 0x4b, 0x4c, 0x6a, 0x7a, 0xfd, 0x71,
-	0x40, 0xd4, 0x86, 0xc9, 0xbc, 0xaf, 0xfb, 0x5d, 0x37, 0x53, 0x92, 0x9a, 0x0a, 0x76, 0x1c, 0x48, 0x37, 0xad, 0x8f,
-	0xf0, 0xf6, 0x55, 0xed, 0x88, 0x39, 0x26, 0x5d, 0xe4, 0x19, 0x78, 0x0c, 0x4f, 0xed, 0x05, 0x74, 0xd6, 0x06, 0x26,
-	0xa4, 0x8c, 0x0d, 0x9c, 0x78, 0xf4, 0x49, 0x74, 0xbe, 0xf7, 0xd4, 0x18, 0x9f, 0x39, 0x1e, 0xe6, 0xcf, 0x7c, 0x96,
-	0x67, 0x76, 0x9e, 0x6a, 0x33, 0x01, 0x09, 0x47, 0x79, 0xc2, 0x53, 0x48, 0x58, 0x75, 0x91, 0x37, 0x35, 0x19, 0x1d,
-	0x8f, 0xf3, 0xb4, 0xdf, 0xfb, 0xb4, 0x93, 0xd0, 0xcb, 0x1f, 0x61, 0xc2, 0x49, 0xb4, 0xfd, 0x34, 0x09, 0xa6, 0x0a,
-	0xd2, 0x72, 0x2c, 0xb2, 0xdc, 0x8e, 0xb9, 0x92, 0x58, 0x8e, 0xc6, 0x71, 0xbc, 0x36, 0x1b, 0x8a, 0x2e, 0x07, 0x8f,
-	0xb5, 0xbe, 0xea, 0xe7, 0x64, 0x26, 0xed, 0x10, 0x2c, 0x0d, 0x9c, 0xbb, 0x22, 0xf3, 0x1b, 0x54, 0x90, 0x87, 0x22,
-	0xc7, 0x5d, 0x6f, 0x51, 0xdf, 0x10, 0xbb, 0x25, 0xd2, 0xc5, 0xed, 0xf5, 0xf8, 0x61, 0xb3, 0xbd, 0xad, 0x07, 0xb1,
-	0xb3, 0x35, 0x6a, 0xfb, 0x05, 0xd5, 0xa2, 0xd3, 0x4a, 0xe9, 0x70, 0x8f, 0x66, 0x66, 0x5c, 0x1b, 0xa6, 0x18, 0x6e,
-	0x9b, 0xa7, 0x5d, 0x8c, 0xa7, 0xf6, 0x4d, 0x55, 0x7f, 0x83, 0x96, 0x7f, 0x66, 0x62, 0x3a, 0x0d, 0xea, 0x97, 0x55,
-	0x98, 0x05, 0xe8, 0xb2, 0x30, 0xd3, 0xe4, 0x26, 0xac, 0xbb, 0x61, 0xf0, 0x76, 0xb3, 0x13, 0x0d, 0xea, 0x26, 0x0e,
-	0x66, 0x6d, 0x3c, 0x82, 0xd2, 0x8e, 0x52, 0x77, 0x5a, 0x9a, 0xd2, 0xbb, 0x6e, 0x76, 0x2b, 0x76, 0xbf, 0xc3, 0x3c,
-	0x56, 0x37, 0xaa, 0xec, 0x7a, 0xb6, 0xc3, 0xf4, 0x16, 0xd3, 0xb4, 0x9c, 0x64, 0x80, 0xd4, 0x77, 0x6e, 0x67, 0x4b,
-	0x68, 0x84, 0x46, 0x33, 0xd3, 0x81, 0xbb, 0xdb, 0x36, 0xfb, 0x8d, 0x3c, 0xbc, 0x1a, 0x4b, 0x6d, 0xeb, 0x47, 0xff,
-	0xf3, 0x78, 0x87, 0x09, 0xf7, 0x43, 0xad, 0xf9, 0x99, 0x77, 0x23, 0x99, 0xb6, 0x3d, 0xed, 0x1b, 0x0b, 0xbd, 0xc3,
-	0xb4, 0x2b, 0x37, 0xc7, 0xfd, 0xbe, 0xde, 0xdd, 0x84, 0xf8, 0x6b, 0x63, 0xa0, 0xcb, 0x50, 0xeb, 0xfb, 0x99, 0xe6,
-	0x5f, 0x82, 0x7f, 0xb4, 0x1c, 0x69, 0x2b, 0x77, 0xd8, 0xf4, 0x13, 0x7f, 0x21, 0x66, 0xe7, 0xfd, 0x54, 0xc6, 0x78,
-	0x01, 0x5d, 0xcc, 0xd1, 0xdc, 0xcc, 0x65, 0xc4, 0x59, 0x1f, 0x6d, 0x1e, 0xdb, 0xda, 0xdd, 0x35, 0x8f, 0xd3, 0xd6,
-	0xd3, 0xa9, 0x79, 0x1c, 0xcd, 0x8d, 0x80, 0x7d, 0x3e, 0x6e, 0xda, 0x5b, 0xee, 0x1b, 0xed, 0x5c, 0x8c, 0xda, 0xcc,
-	0x75, 0x12, 0x5b, 0xb5, 0x76, 0xe8, 0x04, 0x45, 0xee, 0x1b, 0xe7, 0xaf, 0xeb, 0xee, 0xeb, 0xf3, 0x08, 0xef, 0x9b,
-	0xf7, 0xf7, 0x75, 0x73, 0x53, 0x70, 0xdf, 0xa4, 0x70, 0x1f, 0x4c, 0xd5, 0x74, 0xf1, 0xd9, 0xdd, 0x38, 0xca, 0x5e,
-	0x68, 0x7a, 0xef, 0x77, 0x1b, 0x6d, 0xf4, 0xaa, 0xb6, 0x0f, 0xd7, 0x37, 0x7a, 0x21, 0xa5, 0xd1, 0xb9, 0xbb, 0x2d,
-	0xa6, 0xac, 0x30, 0xa5, 0x71, 0x66, 0xbd, 0xbb, 0x8d, 0xfd, 0xa3, 0x6a, 0x34, 0x18, 0xb7, 0x19, 0xef, 0x62, 0x77,
-	0x32, 0x8a, 0x9e, 0x99, 0x1b, 0x57, 0xde, 0xae, 0x3f, 0x7f, 0x96, 0xa1, 0xe3, 0x68, 0xd2, 0x45, 0x7c, 0xd5, 0x8d,
-	0xec, 0xb1, 0x51, 0x9f, 0x2f, 0xbd, 0x3b, 0xe2, 0x64, 0x5c, 0x17, 0x62, 0xe1, 0x1e, 0x6c, 0x4d, 0x63, 0x97, 0x3d,
-	0x9f, 0x72, 0xe9, 0xaa, 0x56, 0xbd, 0xaf, 0x6f, 0x45, 0x09, 0x97, 0x6d, 0x78, 0x0c, 0x07, 0xe3, 0x6e, 0xaa, 0x66,
-	0x14, 0x7d, 0x19, 0x3b, 0xe6, 0xd5, 0x24, 0x54, 0x96, 0x6f, 0xeb, 0xfd, 0xfa, 0xf3, 0x7e, 0xfd, 0x4d, 0x7a, 0x7c,
-	0xe3, 0x2e, 0x3c, 0x5b, 0xfb, 0xcf, 0xb0, 0x47, 0x3d, 0x8a, 0xbd, 0xf4, 0x49, 0x25, 0x72, 0x74, 0x6c, 0x5d, 0x28,
-	0x95, 0xb8, 0xb5, 0x41, 0x2b, 0xf9, 0xd3, 0xb6, 0xfc, 0xd5, 0x28, 0x86, 0x73, 0xec, 0xab, 0x67, 0x7d, 0xb0, 0xde,
-	0x83, 0xd7, 0xeb, 0x83, 0x4c, 0xc9, 0x74, 0xbd, 0xab, 0xb6, 0x3a, 0x77, 0x25, 0x49, 0x73, 0x43, 0xa3, 0x85, 0x99,
-	0x78, 0x8a, 0x01, 0x9a, 0x6e, 0x7b, 0x31, 0x0b, 0xb7, 0x4d, 0xda, 0xbc, 0xc1, 0x6d, 0x33, 0xff, 0x36, 0x88, 0x97,
-	0x56, 0x51, 0xfb, 0x29, 0xcd, 0x29, 0xb6, 0xf5, 0x0b, 0xe3, 0xdb, 0x14, 0xd8, 0x78, 0xe3, 0x30, 0x44, 0x76, 0x1b,
-	0x10, 0x1a, 0x68, 0xb1, 0x97, 0xdf, 0xf6, 0xdd, 0x82, 0x45, 0xea, 0xed, 0x76, 0xf3, 0xed, 0xb0, 0x39, 0x48, 0x70,
-	0x76, 0x6d, 0xd0, 0x72, 0x98, 0x65, 0x71, 0x69, 0xee, 0x68, 0x3d, 0xf6, 0xf0, 0xa5, 0x39, 0xa6, 0xf9, 0xca, 0x45,
-	0x18, 0x80, 0xb7, 0xed, 0x27, 0xcc, 0xa0, 0x8c, 0x62, 0xaf, 0x3e, 0xf6, 0xfe, 0xe3, 0xd4, 0x42, 0xd2, 0xdc, 0x45,
-	0xd7, 0x38, 0x75, 0xb3, 0x22, 0x93, 0xae, 0x21, 0x8b, 0x5e, 0x5e, 0xda, 0x1a, 0xb4, 0x5f, 0xcb, 0xdc, 0x52, 0xa7,
-	0x01, 0x55, 0x4b, 0x87, 0xb9, 0xc7, 0x69, 0x4c, 0x6f, 0xfa, 0x07, 0xeb, 0x9b, 0xe3, 0x83, 0xf8, 0xa9, 0x35, 0x58,
-	0x97, 0xbe, 0x9f, 0x79, 0xd4, 0xf4, 0xc6, 0x4f, 0xa1, 0x23, 0x7f, 0xb7, 0xad, 0xa5, 0x69, 0x6d, 0x07, 0xcc, 0xfd,
-	0x4d, 0xdd, 0x04, 0xb2, 0xde, 0x64, 0xbc, 0x04, 0xad, 0xcd, 0xb8, 0xea, 0xe7, 0x2b, 0xa7, 0xdd, 0x08, 0x29, 0x35,
-	0x51, 0xb1, 0x5b, 0x1e, 0xd3, 0xdf, 0xaf, 0x6f, 0xf6, 0x71, 0x52, 0x65, 0xda, 0x86, 0xe8, 0xb8, 0x93, 0xb8, 0xb6,
-	0x9b, 0xb1, 0x48, 0x2f, 0x58, 0xe4, 0x37, 0x5c, 0xef, 0xeb, 0x58, 0xea, 0x59, 0x97, 0xa1, 0xae, 0xeb, 0xdf, 0x8d,
-	0x51, 0x47, 0x31, 0xfd, 0x32, 0x4f, 0x7f, 0xdb, 0x3c, 0xac, 0x6f, 0x52, 0xf3, 0x34, 0x9e, 0x76, 0xd3, 0x59, 0xd3,
-	0xb6, 0x2b, 0xd3, 0x35, 0x1c, 0xe2, 0xc7, 0xf1, 0xd0, 0x48, 0xe8, 0xed, 0xa6, 0xad, 0x70, 0xc9, 0xf1, 0x5d, 0x76,
-	0x86, 0x9d, 0x22, 0x4d, 0xf0, 0x16, 0x23, 0x83, 0xfb, 0xd8, 0x9a, 0x75, 0x9d, 0x8a, 0xaa, 0x15, 0xc9, 0x69, 0x9b,
-	0x62, 0x5e, 0xa5, 0xe4, 0xc6, 0x77, 0x37, 0xf5, 0x6d, 0x1b, 0x95, 0x61, 0x4c, 0x32, 0x0e, 0xcd, 0x7f, 0x37, 0x03,
-	0x3b, 0x8c, 0xc9, 0xed, 0x5c, 0xed, 0x71, 0xf7, 0x79, 0xbd, 0x3f, 0xde, 0x6f, 0xd7, 0xc7, 0x38, 0xab, 0x1d, 0x9c,
-	0x51, 0xcd, 0xc0, 0x83, 0xe3, 0xa1, 0x71, 0x46, 0xf3, 0xb9, 0xd9, 0xd5, 0xa1, 0xf7, 0xdc, 0x66, 0x3e, 0xbc, 0x65,
-	0xba, 0xd4, 0xb7, 0x18, 0x5f, 0xdc, 0xac, 0x93, 0x2b, 0xe6, 0xe2, 0xeb, 0xd9, 0x02, 0x1f, 0x4f, 0x15, 0xe4, 0xde,
-	0xca, 0x66, 0x5b, 0x37, 0xe6, 0xaa, 0x9b, 0xe3, 0xd8, 0x89, 0x49, 0x77, 0xbc, 0x94, 0x69, 0xa4, 0x7e, 0x88, 0x8d,
-	0xa3, 0xf6, 0xf1, 0x38, 0x66, 0x66, 0x1e, 0x52, 0x36, 0xfb, 0xdb, 0xbb, 0xfa, 0x7e, 0x93, 0xe6, 0x22, 0x47, 0x5d,
-	0x64, 0xb4, 0x76, 0x99, 0x4e, 0x61, 0xa6, 0x68, 0x3c, 0x31, 0xfd, 0x90, 0xdf, 0x75, 0xa0, 0x3b, 0x1d, 0xd9, 0xd9,
-	0x98, 0x71, 0x5c, 0x4d, 0x49, 0xd3, 0x27, 0x90, 0x3a, 0xcc, 0x24, 0x2c, 0x96, 0x43, 0x7c, 0xfa, 0xd4, 0x64, 0xff,
-	0x22, 0x64, 0x7f, 0x29, 0xd5, 0xba, 0xeb, 0x2e, 0x43, 0xea, 0xe8, 0xb4, 0x59, 0x15, 0x4b, 0x70, 0xdf, 0xf6, 0xc0,
-	0x8e, 0xdb, 0x54, 0x84, 0x6e, 0xf2, 0xb2, 0x2b, 0x42, 0x6f, 0xd5, 0x78, 0x5b, 0x5c, 0x57, 0x88, 0x4b, 0x24, 0x6b,
-	0x99, 0x2f, 0x0e, 0x23, 0xd5, 0xe5, 0x10, 0xba, 0xe7, 0xe3, 0x38, 0x87, 0x1f, 0x5b, 0x88, 0xdb, 0xae, 0xb9, 0x3e,
-	0x1c, 0x42, 0x8b, 0xb8, 0xec, 0x04, 0x6a, 0x8c, 0x7d, 0xdf, 0xae, 0x9e, 0xe7, 0x03, 0x24, 0x63, 0x9e, 0x09, 0x2e,
-	0xa4, 0x8c, 0xe3, 0x4c, 0x7b, 0xd4, 0xa5, 0x46, 0x53, 0x8f, 0xbb, 0xd5, 0x8d, 0x71, 0xbf, 0xf0, 0x52, 0x4d, 0x45,
-	0x90, 0xc6, 0x71, 0xba, 0x3d, 0x4e, 0xa0, 0x34, 0x32, 0x72, 0x0d, 0x03, 0x8b, 0xe5, 0x0c, 0x06, 0x36, 0xe3, 0xca,
-	0x68, 0x5e, 0xdb, 0x18, 0xde, 0xb7, 0x2a, 0x79, 0xbd, 0x95, 0xc1, 0x88, 0x2c, 0xec, 0x54, 0x0b, 0x6d, 0xa5, 0x5f,
-	0x98, 0xc9, 0x8f, 0xdf, 0xb2, 0x6a, 0xd9, 0x4f, 0xf3, 0x4d, 0xdb, 0xf4, 0xcb, 0xe1, 0x28, 0x4f, 0x9f, 0x1a, 0x75,
-	0x15, 0xbc, 0x38, 0x98, 0x5e, 0x80, 0x3e, 0xda, 0xe4, 0x6b, 0x55, 0x96, 0x38, 0x4b, 0x30, 0x5f, 0xa8, 0xb0, 0xd8,
-	0xe4, 0x47, 0xaa, 0x93, 0x71, 0xe8, 0x33, 0x3f, 0xf3, 0x92, 0x5a, 0xeb, 0x58, 0xca, 0xd3, 0x90, 0x93, 0xa7, 0x09,
-	0x24, 0xa3, 0x44, 0x71, 0x22, 0x89, 0xcb, 0x2c, 0x3d, 0xfe, 0xdb, 0xcd, 0xe3, 0x46, 0xf4, 0x77, 0x21, 0x0b, 0x19,
-	0xdd, 0x92, 0xd1, 0xb8, 0xf4, 0x7c, 0x35, 0x11, 0x3c, 0x7c, 0xbc, 0xf4, 0x53, 0xbf, 0xa4, 0x16, 0x41, 0xe6, 0xab,
-	0xe9, 0x8e, 0x64, 0x53, 0x7d, 0x7e, 0xb4, 0xa9, 0xe7, 0x82, 0x34, 0xab, 0x67, 0x5f, 0x00, 0xf3, 0x7b, 0xfc, 0x8e,
-	0x38, 0x9e, 0x83, 0x32, 0xc0, 0xa0, 0x8e, 0x5d, 0x10, 0x47, 0xbf, 0xfd, 0x3a, 0x19, 0xb4, 0x09, 0x33, 0x91, 0xc6,
-	0x6c, 0x24, 0xcc, 0x8e, 0xcb, 0xb3, 0x06, 0xd3, 0x33, 0xe5, 0xe2, 0xa4, 0x46, 0x21, 0x2b, 0x88, 0x8d, 0xa8, 0x94,
-	0x3c, 0x77, 0x36, 0xde, 0x52, 0x0a, 0xf1, 0x35, 0x28, 0x7c, 0x67, 0xe0, 0x6e, 0x2a, 0x27, 0x9b, 0xdb, 0xa2, 0x77,
-	0x80, 0xb1, 0xce, 0x1a, 0x37, 0x46, 0x39, 0xbc, 0xa0, 0x8b, 0xef, 0xf1, 0xd8, 0x8c, 0xed, 0x6d, 0x8c, 0xfc, 0x9a,
-	0x15, 0x22, 0x2d, 0x17, 0x50, 0x09, 0xd2, 0xf2, 0x43, 0xdb, 0xfc, 0xcb, 0x4a, 0x49, 0x3f, 0xf1, 0x9a, 0xad, 0x41,
-	0x24, 0x05, 0x90, 0x2e, 0xaa, 0xf5, 0xdc, 0x64, 0x29, 0xbb, 0x19, 0xda, 0xf6, 0xf6, 0xc5, 0x74, 0x68, 0xde, 0x20,
-	0x9d, 0xe1, 0x9b, 0xb4, 0x31, 0xa1, 0x6f, 0xa7, 0xc2, 0xfa, 0xd7, 0xa2, 0xef, 0x29, 0xcd, 0x0b, 0x65, 0x80, 0x4e,
-	0x49, 0x2a, 0xc1, 0x62, 0x5e, 0x88, 0xbf, 0x1b, 0xad, 0xd2, 0x30, 0x13, 0x58, 0x96, 0x99, 0x14, 0x14, 0x30, 0x17,
-	0x99, 0x3a, 0x0a, 0xd6, 0x3c, 0xff, 0xb2, 0x45, 0x9e, 0xcb, 0x64, 0x41, 0xb6, 0x2c, 0x90, 0xec, 0x14, 0x65, 0x1e,
-	0xaa, 0x5d, 0x3f, 0x1d, 0xd4, 0xbe, 0xaa, 0x5c, 0x47, 0xb5, 0x1f, 0x89, 0x39, 0x22, 0x49, 0x8a, 0x53, 0xf4, 0x36,
-	0x47, 0xdd, 0x6c, 0x7d, 0xc8, 0x12, 0x0e, 0x2f, 0x6c, 0x41, 0x7e, 0x81, 0xc0, 0x83, 0x65, 0xa9, 0x72, 0xae, 0xb4,
-	0x23, 0x19, 0x73, 0xb5, 0x1c, 0x6b, 0x3f, 0x92, 0xc3, 0x2e, 0xeb, 0xe6, 0x95, 0xe3, 0x4e, 0x55, 0x20, 0x79, 0x2d,
-	0x4e, 0x84, 0xf5, 0x2b, 0xd4, 0x45, 0xd1, 0x80, 0x0e, 0xdb, 0x59, 0xc1, 0x88, 0xad, 0xd5, 0x46, 0x0b, 0xdc, 0x37,
-	0xcc, 0xfd, 0x20, 0xc5, 0x3e, 0x7e, 0x3a, 0x0f, 0x46, 0xdd, 0x36, 0xdf, 0xeb, 0xdd, 0x67, 0xd1, 0xed, 0xae, 0x73,
-	0xd4, 0xcd, 0x7e, 0x53, 0x43, 0x98, 0xd6, 0x5d, 0xa0, 0x11, 0x89, 0x8b, 0x2f, 0x64, 0xc8, 0xb4, 0xce, 0x46, 0xfe,
-	0x1a, 0x8d, 0x20, 0x84, 0x6c, 0x1d, 0x48, 0x15, 0xdf, 0xe8, 0x1d, 0xcc, 0xeb, 0x95, 0x43, 0xdb, 0xdc, 0x73, 0x36,
-	0x9c, 0x62, 0x9b, 0x92, 0x0d, 0x00, 0xba, 0xf6, 0xa4, 0x6d, 0x3e, 0xa9, 0xae, 0xa5, 0x5e, 0x36, 0xd4, 0xb5, 0xb4,
-	0xfa, 0x5f, 0xf2, 0xd9, 0x0d, 0xfa, 0x6c, 0x2e, 0xe2, 0x95, 0xcd, 0xd2, 0xdb, 0xd8, 0xfe, 0x2f, 0x33, 0x58, 0x88,
-	0xeb, 0x31, 0x14, 0x45, 0x31, 0xf7, 0x97, 0x5f, 0x9a, 0x3d, 0xea, 0x04, 0xae, 0xc9, 0x5a, 0x47, 0x5c, 0x60, 0x49,
-	0x61, 0xc5, 0x8e, 0x0a, 0x9b, 0xdc, 0x0c, 0xfd, 0x97, 0xa2, 0x9b, 0xd3, 0x1a, 0x1b, 0x84, 0x9b, 0x2e, 0xb4, 0x71,
-	0xf2, 0xa9, 0x8c, 0x70, 0xa8, 0x1f, 0x92, 0xad, 0x6f, 0x52, 0xb3, 0x81, 0x79, 0x87, 0x76, 0x83, 0x45, 0x31, 0x86,
-	0x4f, 0x52, 0x39, 0x0c, 0x1c, 0xab, 0x72, 0x69, 0xd0, 0xd8, 0xed, 0xbe, 0x38, 0x1c, 0xfb, 0xf9, 0x8e, 0x7d, 0x2c,
-	0xc3, 0xb8, 0x9b, 0xb2, 0x9a, 0xc0, 0xd6, 0x0a, 0x32, 0x28, 0x0c, 0x80, 0xc1, 0x9e, 0xe5, 0xee, 0x0b, 0xa4, 0x2f,
-	0xf6, 0x5c, 0x52, 0x62, 0x18, 0x67, 0xf6, 0x89, 0xdb, 0xee, 0xd4, 0x72, 0x6c, 0xf2, 0x1f, 0x7b, 0x5d, 0xf7, 0xc7,
-	0xed, 0xc3, 0xe6, 0xdb, 0x36, 0xcc, 0xec, 0x55, 0xdd, 0xbe, 0xac, 0xd9, 0x74, 0xdc, 0xfe, 0x61, 0x93, 0x47, 0xe3,
-	0x80, 0xaf, 0xce, 0x54, 0x2b, 0x55, 0x5c, 0x1d, 0x97, 0x4d, 0xe3, 0xca, 0x28, 0x65, 0x7c, 0x3a, 0x97, 0xd5, 0x85,
-	0xf5, 0xfe, 0x61, 0xb3, 0xde, 0xde, 0x6e, 0xee, 0xc2, 0xe2, 0x50, 0x1b, 0xbe, 0x2f, 0x26, 0xdd, 0x24, 0x5e, 0x17,
-	0x9e, 0x85, 0x9a, 0x72, 0xca, 0x7b, 0x1e, 0xd8, 0x8b, 0xb2, 0x65, 0x48, 0x0d, 0x93, 0x96, 0x21, 0x2d, 0x53, 0x53,
-	0x9e, 0x92, 0x16, 0x5a, 0x31, 0xe9, 0x05, 0x71, 0x34, 0x2a, 0xcb, 0xc2, 0xaf, 0xb6, 0xbb, 0x95, 0x04, 0xbd, 0xd8,
-	0x60, 0x64, 0x65, 0x40, 0xe9, 0x29, 0xb9, 0xa1, 0xce, 0xbb, 0x2a, 0xd0, 0xa1, 0xa3, 0x3b, 0xa2, 0xa2, 0x40, 0xa1,
-	0xa7, 0x83, 0xa2, 0xb6, 0xa5, 0xc5, 0x23, 0x68, 0x86, 0xab, 0x38, 0x5b, 0x59, 0x4a, 0x7c, 0x84, 0x2a, 0x06, 0x51,
-	0x91, 0x26, 0x42, 0xb8, 0x67, 0xa0, 0x52, 0xf8, 0x43, 0x07, 0xfc, 0x06, 0x11, 0xd7, 0x8f, 0x9b, 0x16, 0x4e, 0x62,
-	0xdc, 0x72, 0xd6, 0x0e, 0xbc, 0x65, 0xdf, 0xd9, 0xa4, 0x5f, 0xa4, 0x69, 0x85, 0x81, 0xc2, 0x39, 0xad, 0x63, 0xec,
-	0x9b, 0xaf, 0xf5, 0x2e, 0xae, 0x66, 0xcc, 0xfa, 0xa9, 0xcd, 0x76, 0x68, 0xd9, 0x8d, 0x8d, 0x87, 0x85, 0x3e, 0xd9,
-	0xbe, 0xfe, 0xbc, 0x39, 0xe8, 0xac, 0xe6, 0xb9, 0x4e, 0x59, 0x6a, 0xc7, 0xa0, 0x42, 0xc2, 0xa6, 0x11, 0xaa, 0x93,
-	0x3a, 0x5a, 0xcc, 0xb4, 0x3c, 0xec, 0x0a, 0x99, 0x3b, 0x7d, 0xe9, 0x59, 0x6c, 0xe2, 0x8f, 0x6d, 0x3b, 0xa9, 0x3b,
-	0x7c, 0x3a, 0x41, 0xe9, 0x5a, 0xa3, 0x11, 0x87, 0x43, 0x0a, 0x52, 0x15, 0x94, 0x72, 0x7c, 0xa6, 0xa6, 0x0b, 0x62,
-	0xa7, 0xef, 0x93, 0xe1, 0xdc, 0x9b, 0x0d, 0x86, 0x06, 0x7b, 0xa0, 0xba, 0xa6, 0x48, 0xc1, 0x90, 0x1a, 0x2e, 0x98,
-	0xdb, 0x4b, 0x8d, 0x16, 0x49, 0x5b, 0x4c, 0xac, 0x91, 0x53, 0x4e, 0x5c, 0x4d, 0xc3, 0x6c, 0x84, 0xec, 0x92, 0xd2,
-	0xad, 0x55, 0x61, 0x2f, 0x5d, 0xb7, 0x64, 0x3c, 0x2f, 0x44, 0xe6, 0xaf, 0x0f, 0xb2, 0x5e, 0x5c, 0xec, 0xcf, 0xa7,
-	0x4e, 0x21, 0xb6, 0xd0, 0x61, 0xd7, 0x65, 0xd7, 0x2f, 0xc1, 0xed, 0x4a, 0xd4, 0xb5, 0xb5, 0xdd, 0x99, 0x71, 0x25,
-	0xab, 0x67, 0x5e, 0xfb, 0x35, 0x19, 0x05, 0x4f, 0x3d, 0x80, 0x84, 0x86, 0xb5, 0xcc, 0xaa, 0x0d, 0x83, 0xae, 0xc9,
-	0xf3, 0x95, 0x01, 0x46, 0x3d, 0x8b, 0xd8, 0x71, 0xc0, 0x85, 0x78, 0x6a, 0x1f, 0xe1, 0x86, 0xbe, 0x7d, 0x0c, 0xfd,
-	0xab, 0x39, 0xe7, 0x28, 0xb5, 0x2f, 0xd0, 0x1f, 0x0e, 0xed, 0xcb, 0x99, 0xc6, 0xfd, 0x65, 0xae, 0xcf, 0xa9, 0xf1,
-	0x2a, 0xce, 0x7c, 0x40, 0x60, 0x9e, 0x19, 0xa7, 0xa6, 0x55, 0x4e, 0xcd, 0x4b, 0x5a, 0xea, 0xa4, 0xc4, 0x69, 0x89,
-	0x1f, 0x8a, 0xfa, 0x62, 0x36, 0x3a, 0x63, 0xfc, 0xd4, 0x4e, 0x63, 0xd7, 0xff, 0x4c, 0x3b, 0x9d, 0x82, 0x1f, 0xfa,
-	0x3d, 0x31, 0xf6, 0xcf, 0xcd, 0xdb, 0x40, 0x5d, 0x49, 0x93, 0x0c, 0x8e, 0x70, 0xa6, 0xae, 0x3c, 0xa8, 0x72, 0xec,
-	0xf9, 0x3b, 0x22, 0x9e, 0xda, 0xae, 0x7c, 0xd6, 0xa9, 0x8a, 0x5b, 0x2d, 0xa8, 0x61, 0x8c, 0xa5, 0xb5, 0x73, 0x18,
-	0xe7, 0x8a, 0x9c, 0xe2, 0x07, 0xba, 0x26, 0xe7, 0x86, 0xe5, 0xb3, 0x91, 0x8c, 0x9a, 0xeb, 0xed, 0x83, 0x8c, 0x45,
-	0xfa, 0x25, 0xf4, 0x85, 0x2e, 0x6d, 0x5a, 0xf3, 0x3c, 0xa4, 0x2e, 0x2a, 0xee, 0x38, 0xe0, 0x9a, 0x12, 0xbb, 0x62,
-	0x4f, 0x4d, 0xd6, 0x11, 0x6b, 0xab, 0xef, 0x78, 0x31, 0x0a, 0xb3, 0xae, 0xc5, 0x8e, 0x58, 0x1e, 0x9e, 0x58, 0xe0,
-	0x52, 0x84, 0xde, 0x87, 0xdd, 0x02, 0xe3, 0xb4, 0xb1, 0xc1, 0x99, 0x52, 0x48, 0x1e, 0x50, 0xe3, 0xf4, 0xe6, 0xef,
-	0x77, 0x72, 0x17, 0x95, 0x93, 0xa6, 0xe5, 0x24, 0x86, 0xdc, 0x69, 0xb9, 0xa4, 0xe4, 0x58, 0xe1, 0x67, 0x61, 0x1e,
-	0x25, 0xdb, 0xe5, 0x68, 0x5f, 0x73, 0xab, 0xd3, 0x16, 0x71, 0x4f, 0xcf, 0xc2, 0x19, 0x90, 0x2f, 0x64, 0xf1, 0xbe,
-	0xef, 0xe0, 0xb6, 0x12, 0xba, 0x6f, 0xa5, 0x54, 0xac, 0x34, 0x09, 0xbd, 0xf4, 0x45, 0xb7, 0x28, 0x6b, 0x0d, 0x9b,
-	0x3a, 0xf5, 0xa8, 0x8f, 0x4b, 0x39, 0xba, 0x91, 0x6d, 0xa0, 0x4b, 0xb6, 0x5a, 0x2e, 0x45, 0x1e, 0x75, 0x58, 0x1b,
-	0x46, 0xfe, 0x8e, 0xaf, 0xd3, 0xee, 0xc6, 0xd2, 0xe4, 0x82, 0x3b, 0x16, 0x48, 0x53, 0xec, 0xa6, 0xe7, 0xd7, 0x4d,
-	0xb1, 0x53, 0xa0, 0xa6, 0x19, 0x73, 0x3d, 0xab, 0xd1, 0x97, 0xba, 0x35, 0xee, 0x64, 0xd8, 0x2d, 0x2b, 0x57, 0xb3,
-	0xf2, 0x1b, 0x6a, 0x33, 0x98, 0x3f, 0xd3, 0x33, 0x4b, 0xad, 0x3d, 0xc4, 0x48, 0xdf, 0xd2, 0x57, 0x4e, 0x9b, 0x96,
-	0x12, 0x63, 0x57, 0x2b, 0x74, 0x87, 0x26, 0xe5, 0xa1, 0xcc, 0xef, 0xa6, 0xa3, 0x55, 0xcd, 0x9d, 0x69, 0x8e, 0xe8,
-	0xe8, 0x36, 0x8a, 0xbe, 0xac, 0xb7, 0xa1, 0xe7, 0x3d, 0x1a, 0xc5, 0x6e, 0x8d, 0x53, 0x77, 0x62, 0xfb, 0xda, 0x4d,
-	0xdf, 0xdb, 0xc6, 0x75, 0x36, 0xe3, 0xc6, 0x35, 0xc5, 0xb7, 0xed, 0x18, 0x6b, 0xef, 0xa0, 0xdc, 0x0f, 0x85, 0xb9,
-	0x94, 0xbe, 0x1f, 0xea, 0xcd, 0xa4, 0x24, 0x29, 0xe2, 0xb5, 0x26, 0x51, 0xa4, 0xc5, 0xd0, 0xeb, 0x54, 0xc4, 0x1a,
-	0x04, 0xa2, 0xfd, 0xc3, 0xbe, 0x7a, 0x8d, 0xdd, 0x1b, 0x9d, 0x06, 0x67, 0xc9, 0x8e, 0x4b, 0xb8, 0xda, 0xf7, 0xc3,
-	0x0d, 0x6b, 0x34, 0x37, 0x0f, 0x5e, 0x90, 0xca, 0x16, 0x0a, 0x50, 0x49, 0x5d, 0x1b, 0x8e, 0xcf, 0xd5, 0xb5, 0xe4,
-	0xe6, 0xb3, 0x03, 0xe8, 0x94, 0xdc, 0xd4, 0x9d, 0xb3, 0xd5, 0x33, 0x29, 0x25, 0x1b, 0x37, 0xa9, 0xa5, 0xd3, 0x23,
-	0x9f, 0x4a, 0x25, 0xba, 0x6d, 0x1b, 0xf4, 0x3a, 0x4e, 0xd3, 0x2f, 0xfb, 0x91, 0x53, 0xbf, 0x86, 0x44, 0x41, 0x15,
-	0x83, 0x04, 0xda, 0xff, 0x33, 0xf1, 0xa1, 0xdd, 0x30, 0xe8, 0x1d, 0xfd, 0x3f, 0xcc, 0xcd, 0x1d, 0xa1, 0xb2, 0x9d,
-	0x19, 0xbf, 0x4e, 0xab, 0xd8, 0xf3, 0xbd, 0xdd, 0xdc, 0x48, 0x80, 0xb7, 0x95, 0xec, 0xc5, 0x42, 0xce, 0x62, 0xcc,
-	0x0a, 0x11, 0xf8, 0x0a, 0xe6, 0x26, 0xe2, 0xb6, 0xf4, 0x72, 0xb7, 0x9a, 0xe6, 0x84, 0xc5, 0x0f, 0xd9, 0x16, 0x38,
-	0x1a, 0x3c, 0x69, 0x8d, 0xd0, 0xc1, 0xd3, 0xa8, 0x30, 0x15, 0xd6, 0x68, 0xe2, 0xd8, 0x96, 0x0c, 0xcf, 0x54, 0xa0,
-	0x0f, 0x36, 0x47, 0x8b, 0xd8, 0xaf, 0xc5, 0xad, 0x93, 0xac, 0x32, 0x05, 0x2d, 0xce, 0x56, 0x30, 0xa9, 0x63, 0x08,
-	0xcb, 0xed, 0x53, 0xd9, 0xe4, 0x44, 0xe5, 0x48, 0x89, 0xb1, 0x93, 0x1a, 0xe7, 0xf2, 0xab, 0x33, 0xed, 0xc3, 0x4b,
-	0x5d, 0xbf, 0x48, 0x5d, 0x4e, 0x5a, 0xbc, 0x88, 0x91, 0x0d, 0x39, 0xc1, 0x0e, 0x00, 0x19, 0x35, 0xf6, 0x39, 0x73,
-	0x8d, 0xd7, 0x7e, 0x67, 0x71, 0xb0, 0x05, 0x51, 0x51, 0x14, 0x98, 0xa4, 0xf0, 0xd8, 0x49, 0x9d, 0x48, 0x7f, 0x3c,
-	0x3b, 0x13, 0x60, 0xf3, 0xf3, 0x95, 0x56, 0x85, 0xe6, 0xba, 0xda, 0xc1, 0x77, 0xc5, 0x89, 0x9f, 0x34, 0x4c, 0x6e,
-	0xeb, 0xd7, 0xb8, 0xdb, 0xc4, 0xd6, 0x66, 0x7f, 0xbc, 0x28, 0xe5, 0xca, 0x4e, 0x83, 0x84, 0x25, 0xcc, 0x33, 0x35,
-	0x6d, 0x07, 0xcd, 0x79, 0x98, 0x41, 0x70, 0xea, 0x59, 0xda, 0xab, 0x59, 0x5a, 0xd8, 0xca, 0xf6, 0x6d, 0xda, 0x22,
-	0x6c, 0x9b, 0xcf, 0x5d, 0xed, 0xdc, 0x35, 0x51, 0x8f, 0xc2, 0xa6, 0xaf, 0xec, 0xe8, 0x0c, 0xd5, 0x88, 0x7c, 0xe6,
-	0x04, 0x24, 0xa6, 0x38, 0xe5, 0x95, 0xf7, 0xa2, 0x41, 0x35, 0xe8, 0x0e, 0x69, 0x18, 0xdb, 0x0c, 0x69, 0xbb, 0xd8,
-	0x16, 0xf9, 0xc5, 0xa4, 0xea, 0xb7, 0x4b, 0x55, 0x55, 0xa1, 0x4b, 0xf9, 0xd9, 0x16, 0x1f, 0x9b, 0x8a, 0x85, 0xad,
-	0xad, 0xa9, 0x29, 0x92, 0xc1, 0xea, 0x22, 0x8c, 0x1c, 0x7a, 0x61, 0xa2, 0x39, 0xf1, 0x18, 0xb3, 0xea, 0x8d, 0xf2,
-	0x38, 0x49, 0x5d, 0x67, 0xbd, 0x51, 0xc5, 0x81, 0xa4, 0x33, 0x03, 0x9d, 0x76, 0x6c, 0xec, 0xf2, 0x79, 0xd0, 0x6e,
-	0xa3, 0x62, 0xd7, 0xff, 0x9e, 0xcc, 0x9d, 0x6e, 0x62, 0xea, 0x20, 0x63, 0x7f, 0x26, 0x0c, 0x50, 0xe6, 0xe5, 0xc6,
-	0xf4, 0xd7, 0xa3, 0x1c, 0xb6, 0x83, 0x83, 0xa6, 0xbf, 0xee, 0x6e, 0xe1, 0x8c, 0xaa, 0x9c, 0x5a, 0x7d, 0x5b, 0xef,
-	0x77, 0xaf, 0xd6, 0x0f, 0x6b, 0xb8, 0x7c, 0xb7, 0xde, 0xb4, 0xfd, 0xd7, 0xf1, 0x7c, 0x58, 0xfd, 0xfc, 0xd3, 0xdb,
-	0x77, 0xff, 0x1e, 0xbc, 0x1c, 0xb4, 0xcf, 0x9f, 0x0c, 0xd3, 0x45, 0xe8, 0x04, 0x20, 0x12, 0x4c, 0x96, 0x21, 0xd2,
-	0xa7, 0x05, 0xec, 0x4d, 0x76, 0x11, 0x1a, 0x7b, 0x44, 0xd0, 0x94, 0x80, 0x5f, 0x64, 0x17, 0xf4, 0x6e, 0x1c, 0x89,
-	0x21, 0x9c, 0x42, 0x11, 0xc1, 0xd0, 0xa4, 0x21, 0x92, 0x35, 0xd5, 0x48, 0x88, 0xb5, 0x11, 0x0a, 0x1b, 0x25, 0x10,
-	0x09, 0x72, 0x08, 0xc8, 0x7b, 0xbc, 0xb8, 0x6c, 0xbd, 0x32, 0xd6, 0x2b, 0x31, 0x52, 0x06, 0x61, 0x91, 0x81, 0xf8,
-	0x38, 0x78, 0x51, 0xe9, 0x85, 0x94, 0x19, 0x10, 0x2c, 0x33, 0xc0, 0x5a, 0x66, 0x00, 0xa5, 0xcc, 0x80, 0xe4, 0x65,
-	0x06, 0x22, 0x96, 0x19, 0x20, 0x91, 0x58, 0x84, 0xfa, 0xf6, 0x02, 0x80, 0xab, 0xc1, 0x8b, 0x79, 0xba, 0x58, 0x21,
-	0xf3, 0x69, 0x10, 0x0e, 0x99, 0xcb, 0x95, 0x94, 0x03, 0x21, 0xcd, 0x31, 0xa0, 0x47, 0x34, 0xe2, 0x91, 0x3c, 0x7e,
-	0xf4, 0x3d, 0x7e, 0xf4, 0x3c, 0x7e, 0x24, 0x8f, 0x1f, 0x4b, 0x1e, 0x3f, 0xb2, 0xc7, 0xe3, 0xba, 0x38, 0x42, 0xa1,
-	0xf4, 0x0a, 0x3c, 0x76, 0x6b, 0xd2, 0xf1, 0xe2, 0x09, 0x2f, 0x4e, 0xd9, 0x85, 0x14, 0x03, 0x10, 0xcd, 0x6f, 0x02,
-	0x43, 0x22, 0xac, 0x6d, 0x82, 0x58, 0x23, 0x08, 0x6c, 0xeb, 0x5d, 0x84, 0xa9, 0xf2, 0x05, 0xe2, 0x0d, 0x23, 0xb6,
-	0x1a, 0x0a, 0xec, 0xd7, 0xc5, 0x40, 0x5e, 0x30, 0xe2, 0x67, 0xcf, 0xaf, 0x9a, 0xc2, 0x39, 0xde, 0x12, 0xc6, 0xba,
-	0x4c, 0xe0, 0x82, 0xdf, 0x84, 0x25, 0xe7, 0x09, 0x6e, 0xeb, 0xac, 0xc0, 0xb6, 0xe2, 0x06, 0xf8, 0x3d, 0x21, 0x59,
-	0x15, 0x16, 0x88, 0xea, 0x71, 0xc4, 0xfd, 0xca, 0x1c, 0x58, 0xac, 0xd1, 0x82, 0xd8, 0x6a, 0x2d, 0xb0, 0x5b, 0xb7,
-	0x85, 0x73, 0x2a, 0xb8, 0x30, 0xb6, 0x96, 0x0b, 0x5c, 0xa8, 0xea, 0xc2, 0x52, 0x7d, 0x17, 0x9c, 0x2a, 0xbd, 0xe0,
-	0xa6, 0xe6, 0x07, 0x14, 0xab, 0x7f, 0x40, 0x56, 0x94, 0x26, 0x13, 0x02, 0x81, 0x48, 0x0d, 0x04, 0xf7, 0x24, 0x21,
-	0x50, 0x47, 0x72, 0x0f, 0x89, 0x83, 0xc0, 0x67, 0x02, 0xcf, 0x93, 0x09, 0x61, 0xfc, 0xc0, 0x2b, 0x09, 0x86, 0xb0,
-	0x85, 0xc0, 0x63, 0xe9, 0x10, 0xdc, 0xe8, 0x47, 0x40, 0x1f, 0x49, 0x03, 0x9e, 0x08, 0x39, 0x31, 0x62, 0x35, 0x45,
-	0x60, 0x47, 0x58, 0x42, 0x35, 0x47, 0x61, 0x11, 0xc4, 0x1a, 0x50, 0x60, 0x2b, 0x2c, 0x11, 0x26, 0x61, 0x09, 0xc4,
-	0x1b, 0x46, 0xac, 0xb0, 0x08, 0xec, 0x0b, 0x4b, 0x20, 0x2f, 0x18, 0xf1, 0xb3, 0xe7, 0x0b, 0x8b, 0x70, 0x8e, 0x7f,
-	0x85, 0xb1, 0xfe, 0x15, 0xb8, 0xe0, 0x5f, 0x61, 0xc9, 0xbf, 0x82, 0x5b, 0x61, 0x11, 0xd8, 0x0a, 0x4b, 0x80, 0xdf,
-	0x13, 0x92, 0x09, 0x8b, 0x40, 0x24, 0x2c, 0x11, 0xf7, 0x85, 0x25, 0xb0, 0x28, 0x2c, 0x82, 0x58, 0x61, 0x11, 0xd8,
-	0x15, 0x16, 0xe1, 0x1c, 0x61, 0x11, 0xc6, 0x0a, 0x8b, 0xc0, 0x05, 0x61, 0x11, 0x96, 0x84, 0x45, 0x70, 0x12, 0x16,
-	0xc1, 0x8d, 0xb0, 0x04, 0x14, 0x85, 0x25, 0x20, 0x2b, 0x4a, 0x93, 0x09, 0x8b, 0x40, 0x24, 0x2c, 0x82, 0x7b, 0xc2,
-	0x12, 0xa8, 0x23, 0xb9, 0x87, 0x84, 0x45, 0xe0, 0x33, 0x81, 0xe7, 0x09, 0x8b, 0x30, 0x7e, 0xe0, 0x95, 0x84, 0x45,
-	0xd8, 0x42, 0xe0, 0xb1, 0xb0, 0x08, 0x6e, 0x84, 0x25, 0xa0, 0x8f, 0xa4, 0x01, 0x4f, 0x84, 0x9c, 0x18, 0xb1, 0xc2,
-	0x22, 0xb0, 0x23, 0x2c, 0x60, 0x10, 0x54, 0x17, 0x84, 0xad, 0x29, 0x91, 0xb3, 0x3a, 0x93, 0x71, 0x24, 0x36, 0xc0,
-	0xbe, 0x29, 0xc0, 0x56, 0x76, 0x90, 0xf3, 0xb5, 0x07, 0x52, 0x5c, 0x14, 0xe0, 0x33, 0x25, 0xf0, 0xa5, 0x08, 0x13,
-	0x38, 0x61, 0x81, 0xb4, 0x8d, 0x0d, 0xe4, 0x0a, 0x01, 0x82, 0x49, 0x28, 0x4a, 0x90, 0xb4, 0x1a, 0x85, 0x9c, 0x15,
-	0x2a, 0xe0, 0xde, 0xfb, 0x70, 0x26, 0x59, 0x88, 0x93, 0x6e, 0x65, 0xa4, 0x2f, 0x5e, 0x90, 0x04, 0x15, 0x0c, 0x61,
-	0x2b, 0x63, 0xc8, 0xb9, 0x5a, 0x86, 0x09, 0x1c, 0x41, 0x43, 0xda, 0xaa, 0x1a, 0x72, 0x05, 0x69, 0xc3, 0x24, 0xa4,
-	0x6f, 0x48, 0x92, 0xc8, 0x21, 0x69, 0x94, 0x0e, 0x28, 0x94, 0x3b, 0x80, 0x57, 0x7e, 0xea, 0x4c, 0xf8, 0x10, 0x27,
-	0xf5, 0x43, 0xd2, 0x93, 0x40, 0xe0, 0x8f, 0xbe, 0xe3, 0x49, 0x0c, 0x91, 0xfb, 0x51, 0xfc, 0x7b, 0xb2, 0x88, 0xf4,
-	0x99, 0xf8, 0x2f, 0x09, 0x24, 0x26, 0x39, 0x17, 0xff, 0x2c, 0x95, 0x48, 0x1a, 0xbd, 0x04, 0xea, 0xd1, 0xd7, 0xb7,
-	0x27, 0x1f, 0x3e, 0x15, 0x60, 0xab, 0xa1, 0xc8, 0x39, 0x42, 0x9a, 0x20, 0x94, 0x51, 0x05, 0xad, 0x0b, 0x94, 0xb1,
-	0x12, 0x0a, 0x0c, 0x09, 0x68, 0xe2, 0xde, 0xb8, 0xa0, 0x15, 0x4f, 0x65, 0x7c, 0xe9, 0x4c, 0xfc, 0x85, 0x0b, 0x16,
-	0xf3, 0xec, 0x8b, 0xa6, 0xd2, 0x4e, 0xc8, 0x28, 0x69, 0x03, 0x46, 0x99, 0x42, 0xb8, 0x68, 0x02, 0x0a, 0x16, 0xa5,
-	0xac, 0x54, 0x2a, 0x63, 0x85, 0x32, 0x31, 0xef, 0x3d, 0x30, 0x13, 0x49, 0x45, 0x49, 0x22, 0x81, 0xf2, 0x05, 0x32,
-	0x25, 0x40, 0x79, 0x54, 0xd0, 0x8a, 0xa3, 0x32, 0xae, 0x34, 0x2a, 0xed, 0x08, 0xa3, 0x92, 0x56, 0x16, 0x95, 0x29,
-	0x88, 0xa2, 0x26, 0x20, 0x49, 0x54, 0x8a, 0x04, 0x51, 0x29, 0x23, 0x87, 0x89, 0x40, 0x31, 0x4c, 0xe0, 0xca, 0x4b,
-	0x99, 0x09, 0xa1, 0xa2, 0x24, 0x83, 0x4a, 0x79, 0x22, 0x98, 0xb0, 0xa3, 0xe7, 0x54, 0x12, 0x40, 0x65, 0xce, 0x47,
-	0xb2, 0x27, 0x7e, 0x4a, 0x16, 0x23, 0xb9, 0x24, 0x7c, 0x9a, 0xa0, 0x1c, 0xc9, 0x2c, 0x7a, 0x4a, 0x19, 0xc9, 0x4b,
-	0xc4, 0xa3, 0xa7, 0x43, 0x4f, 0x1e, 0x78, 0x72, 0x41, 0x2b, 0x75, 0xca, 0x38, 0x42, 0x17, 0x4a, 0x8d, 0x2a, 0x27,
-	0x88, 0x35, 0xb2, 0xc0, 0x56, 0xdf, 0x22, 0x4c, 0xe2, 0x16, 0x88, 0x37, 0x8c, 0x58, 0x59, 0x13, 0xd8, 0xd7, 0xb4,
-	0x40, 0x5e, 0x30, 0xe2, 0x67, 0xcf, 0x97, 0x32, 0xe1, 0x1c, 0xef, 0x0b, 0x63, 0x5d, 0x2f, 0x70, 0xc1, 0xef, 0xc2,
-	0x92, 0xd3, 0x05, 0xb7, 0xda, 0x25, 0xb0, 0x15, 0xae, 0x00, 0xbf, 0x27, 0x24, 0x93, 0x2c, 0x81, 0x48, 0xaf, 0x22,
-	0xee, 0x8b, 0x55, 0x60, 0x51, 0xa9, 0x04, 0xb1, 0x32, 0x25, 0xb0, 0xab, 0x51, 0xc2, 0x39, 0x02, 0x25, 0x8c, 0x55,
-	0x27, 0x81, 0x0b, 0xd2, 0x24, 0x2c, 0xe9, 0x92, 0xe0, 0x24, 0x4a, 0x82, 0x1b, 0x45, 0x0a, 0x28, 0xca, 0x51, 0x40,
-	0x56, 0x94, 0x26, 0x13, 0x22, 0x81, 0x48, 0x85, 0x04, 0xf7, 0x24, 0x28, 0x50, 0x47, 0x72, 0x0f, 0x89, 0x8f, 0xc0,
-	0x67, 0x02, 0xcf, 0x93, 0x1d, 0x61, 0xfc, 0xc0, 0x2b, 0x09, 0x8e, 0xb0, 0x85, 0xc0, 0x63, 0xa9, 0x11, 0xdc, 0xe8,
-	0x4c, 0x40, 0x1f, 0x49, 0x03, 0x9e, 0x08, 0x39, 0x31, 0x62, 0xb5, 0x45, 0x60, 0x47, 0x58, 0x24, 0x97, 0xa8, 0x2c,
-	0x11, 0xb2, 0x26, 0x8c, 0xb8, 0xd5, 0x96, 0x84, 0x93, 0xb8, 0x08, 0xf3, 0xc6, 0x81, 0xac, 0xbc, 0x44, 0xdc, 0xd7,
-	0x17, 0x61, 0x2f, 0x1c, 0xa8, 0x90, 0x4b, 0x5f, 0x62, 0x22, 0xe9, 0xb8, 0x3a, 0x52, 0xd6, 0xd7, 0x11, 0x2f, 0x38,
-	0x3b, 0xd2, 0xe4, 0xed, 0x48, 0x58, 0x9d, 0x89, 0xb8, 0x15, 0x1a, 0xc1, 0xdf, 0x33, 0x94, 0x49, 0x4d, 0xc4, 0x48,
-	0x6b, 0x12, 0xe1, 0x8b, 0x8d, 0xd0, 0xa8, 0x36, 0x11, 0xb2, 0x72, 0x13, 0x71, 0x57, 0x6f, 0x22, 0xe9, 0x08, 0x4e,
-	0xa4, 0xac, 0xe2, 0x44, 0xbc, 0x20, 0x39, 0x91, 0x26, 0xcd, 0x89, 0x04, 0x89, 0x4e, 0x24, 0x8c, 0xea, 0x08, 0x8c,
-	0xb2, 0x23, 0xd0, 0x8a, 0x53, 0x65, 0xc2, 0x13, 0x31, 0x52, 0x9e, 0x48, 0x78, 0xd2, 0x23, 0xdc, 0x91, 0x1d, 0x46,
-	0xe2, 0x13, 0xf1, 0x73, 0x31, 0xe9, 0xc9, 0x4f, 0xa4, 0x0a, 0x31, 0x59, 0x12, 0xa0, 0x48, 0x97, 0x62, 0x92, 0x25,
-	0x28, 0x12, 0x46, 0x83, 0x04, 0x7e, 0x64, 0xbd, 0x78, 0x62, 0xe8, 0xe4, 0x40, 0x56, 0x87, 0x22, 0xee, 0x08, 0x91,
-	0xe4, 0x09, 0x85, 0x28, 0x42, 0xd6, 0x9c, 0x11, 0xb7, 0x42, 0x94, 0x70, 0x12, 0x22, 0x61, 0xde, 0x38, 0x90, 0x15,
-	0xa2, 0x88, 0xfb, 0x42, 0x24, 0xec, 0x85, 0x03, 0x15, 0x72, 0xe9, 0x0b, 0x51, 0x24, 0x1d, 0xa7, 0x47, 0xca, 0x3a,
-	0x3d, 0xe2, 0x05, 0xa7, 0x47, 0x9a, 0x9c, 0x1e, 0x09, 0x2b, 0x44, 0x11, 0xb7, 0x42, 0x24, 0xf8, 0x7b, 0x86, 0x32,
-	0x21, 0x8a, 0x18, 0x09, 0x51, 0x22, 0x7c, 0x21, 0x12, 0x1a, 0x85, 0x28, 0x42, 0x56, 0x88, 0x22, 0xee, 0x0a, 0x51,
-	0x24, 0x1d, 0x21, 0x8a, 0x94, 0x15, 0xa2, 0x88, 0x17, 0x84, 0x28, 0xd2, 0x24, 0x44, 0x91, 0x20, 0x21, 0x8a, 0x84,
-	0x11, 0x22, 0x81, 0x51, 0x88, 0x04, 0x5a, 0x71, 0xaa, 0x4c, 0x88, 0x22, 0x46, 0x42, 0x14, 0x09, 0x4f, 0x88, 0x84,
-	0x3b, 0xb2, 0xc3, 0x48, 0x88, 0x22, 0x7e, 0x2e, 0x26, 0x3d, 0x21, 0x8a, 0x54, 0x21, 0x26, 0x4b, 0x42, 0x14, 0xe9,
-	0x52, 0x4c, 0xb2, 0x10, 0x45, 0xc2, 0x08, 0x91, 0xc0, 0x8f, 0xac, 0x17, 0x4f, 0x0c, 0x9d, 0x1c, 0xc8, 0x0a, 0x51,
-	0xc4, 0x1d, 0x21, 0xea, 0x5f, 0x8d, 0x32, 0x14, 0x00, 0x6b, 0xca, 0x80, 0x5a, 0x09, 0x12, 0x94, 0x04, 0xa8, 0xc7,
-	0xdf, 0x10, 0x60, 0xc5, 0x27, 0xa0, 0xbe, 0xf4, 0xf4, 0xdc, 0x05, 0x01, 0x6e, 0xbe, 0x7c, 0xd1, 0x09, 0x94, 0xe3,
-	0xde, 0x40, 0x58, 0xe7, 0x06, 0xb4, 0xe0, 0xda, 0x40, 0x92, 0x63, 0x03, 0x6c, 0xa5, 0x26, 0xa0, 0x56, 0x68, 0x7a,
-	0xf4, 0xbd, 0x05, 0x32, 0x91, 0x09, 0x08, 0x49, 0x8c, 0xc0, 0xbe, 0xc0, 0xf4, 0x24, 0xca, 0x4b, 0x00, 0xac, 0xb8,
-	0x04, 0xd4, 0x95, 0x96, 0x40, 0x39, 0xc2, 0x12, 0x08, 0x2b, 0x2b, 0x01, 0x2d, 0x88, 0x4a, 0x20, 0x49, 0x52, 0x02,
-	0x4c, 0x82, 0x12, 0x60, 0x23, 0x27, 0xfd, 0x25, 0x8a, 0x49, 0x0f, 0xac, 0x6c, 0x8a, 0x4c, 0x48, 0x02, 0x42, 0x32,
-	0x12, 0x60, 0x4f, 0x44, 0x7a, 0xe6, 0x68, 0x9d, 0x41, 0x02, 0x12, 0xd0, 0x72, 0x74, 0x79, 0xe2, 0x11, 0x08, 0x37,
-	0xba, 0x4a, 0xc2, 0x11, 0x48, 0x3f, 0xba, 0x58, 0x34, 0x02, 0x6c, 0x24, 0xa3, 0xbf, 0x7c, 0xb4, 0xf5, 0xfa, 0xc9,
-	0x02, 0x27, 0x02, 0xac, 0x54, 0x04, 0xd4, 0x11, 0x8a, 0x10, 0xcf, 0xa8, 0x14, 0x82, 0x58, 0xa3, 0x09, 0x6c, 0xb5,
-	0x22, 0xc2, 0x24, 0x16, 0x81, 0x78, 0xc3, 0x88, 0x95, 0x0b, 0x81, 0x7d, 0xbd, 0x08, 0xe4, 0x05, 0x23, 0x7e, 0xf6,
-	0x7c, 0xc9, 0x10, 0xce, 0xf1, 0xaa, 0x30, 0xd6, 0xad, 0x02, 0x17, 0xfc, 0x2a, 0x2c, 0x39, 0x56, 0x70, 0xab, 0x1b,
-	0x02, 0x5b, 0xe1, 0x08, 0xd7, 0xef, 0x09, 0xc9, 0xa4, 0x43, 0x20, 0xd2, 0x8e, 0x88, 0xfb, 0xe2, 0x11, 0x58, 0x54,
-	0x0f, 0x41, 0xac, 0x7c, 0x08, 0xec, 0xea, 0x87, 0x70, 0x8e, 0x80, 0x08, 0x63, 0x15, 0x44, 0xe0, 0x82, 0x84, 0x08,
-	0x4b, 0x1a, 0x22, 0x38, 0x89, 0x88, 0xe0, 0x46, 0x45, 0x02, 0x8a, 0x32, 0x12, 0x90, 0x15, 0xa5, 0xc9, 0x84, 0x44,
-	0x20, 0x52, 0x12, 0xc1, 0x3d, 0x29, 0x09, 0xd4, 0x91, 0xdc, 0x43, 0x62, 0x22, 0xf0, 0x99, 0xc0, 0xf3, 0xe4, 0x44,
-	0x18, 0x3f, 0xf0, 0x4a, 0x82, 0x22, 0x6c, 0x21, 0xf0, 0x58, 0x52, 0x04, 0x37, 0x9a, 0x12, 0xd0, 0x47, 0xd2, 0x80,
-	0x27, 0x42, 0x4e, 0x8c, 0x58, 0x5d, 0x11, 0x98, 0x85, 0xe5, 0xef, 0x5d, 0xfc, 0x8d, 0xf4, 0x22, 0xd9, 0x3e, 0x21,
-	0x68, 0x31, 0x80, 0xd1, 0x19, 0x09, 0x14, 0x3b, 0x01, 0x92, 0x9b, 0x08, 0x88, 0x68, 0x1d, 0x80, 0xa2, 0x61, 0x00,
-	0x0a, 0x36, 0x51, 0x20, 0xfc, 0xb6, 0xca, 0x8b, 0x71, 0x02, 0xe4, 0xe7, 0x50, 0x12, 0xf2, 0x4b, 0x4c, 0x32, 0x49,
-	0x40, 0x4c, 0x92, 0x90, 0x50, 0x46, 0x9b, 0x2e, 0xa0, 0x94, 0x38, 0xd4, 0x69, 0x9b, 0x38, 0xa0, 0x9c, 0x58, 0xe4,
-	0x95, 0x92, 0x0b, 0x6e, 0x6f, 0x78, 0x35, 0x78, 0xa9, 0xae, 0x78, 0x15, 0xb7, 0x87, 0x21, 0x22, 0x2a, 0x0c, 0x08,
-	0xfa, 0x03, 0x60, 0x76, 0xed, 0xab, 0x38, 0x15, 0x87, 0x48, 0x34, 0x3b, 0x40, 0xd1, 0xec, 0x00, 0x05, 0xb3, 0x03,
-	0x20, 0xaa, 0xa8, 0x08, 0xd4, 0xed, 0x57, 0x5d, 0xb5, 0x56, 0xa6, 0xad, 0xd1, 0x4b, 0xbd, 0x90, 0x12, 0x01, 0xa2,
-	0x19, 0x55, 0x50, 0xec, 0xa5, 0x4f, 0x8c, 0x86, 0x4a, 0x48, 0x30, 0x38, 0x5a, 0x4b, 0x10, 0x6b, 0x32, 0x81, 0xad,
-	0xdd, 0x04, 0x76, 0x8d, 0x27, 0x9c, 0x63, 0x41, 0x61, 0xac, 0x19, 0x05, 0x26, 0x5b, 0x0a, 0x4e, 0x06, 0x15, 0xdc,
-	0x58, 0x55, 0x50, 0x6b, 0xda, 0x00, 0x5f, 0x51, 0xd9, 0x57, 0x94, 0x06, 0x2d, 0x2d, 0x88, 0x35, 0xb7, 0xc0, 0x8e,
-	0xcd, 0xb3, 0xb8, 0x36, 0xaf, 0x62, 0xeb, 0xf7, 0xa7, 0x6c, 0x33, 0xeb, 0x07, 0x84, 0xac, 0x1f, 0x60, 0xb2, 0x7e,
-	0x80, 0x7d, 0xeb, 0x07, 0xce, 0xb3, 0x7e, 0x60, 0xc8, 0xfa, 0x01, 0x66, 0xeb, 0x07, 0x9c, 0xad, 0x1f, 0x70, 0x6b,
-	0xfd, 0x80, 0x92, 0xf5, 0x7b, 0xf8, 0x8a, 0xca, 0xbe, 0xa2, 0x34, 0x99, 0xf5, 0x03, 0x42, 0xd6, 0x0f, 0xb0, 0x67,
-	0xfd, 0x9e, 0x21, 0xeb, 0xf7, 0xa8, 0xb5, 0xfe, 0xeb, 0xce, 0xf0, 0x0b, 0xbd, 0x90, 0xb7, 0x00, 0x22, 0xe6, 0x06,
-	0x04, 0x2d, 0x0d, 0xb0, 0xe6, 0x04, 0x40, 0xb1, 0x2f, 0x20, 0xd1, 0xb4, 0x00, 0x45, 0xab, 0x02, 0x14, 0x0c, 0x0a,
-	0x80, 0xd8, 0x52, 0x91, 0xb5, 0x36, 0xf7, 0xaf, 0xe3, 0x37, 0x08, 0x11, 0x91, 0x7c, 0x03, 0xe2, 0x75, 0x71, 0x5e,
-	0xc3, 0x37, 0x65, 0x10, 0x34, 0x1d, 0x9b, 0xd7, 0xe9, 0x0b, 0x04, 0x08, 0xd9, 0x0e, 0xcb, 0x6b, 0xf9, 0xf0, 0x1b,
-	0x02, 0x92, 0x6f, 0x45, 0xc4, 0x2f, 0x23, 0x45, 0xa0, 0xf1, 0x7f, 0x1d, 0x3f, 0x68, 0x89, 0x88, 0xe9, 0x6e, 0xbf,
-	0xce, 0xbe, 0x53, 0x88, 0x30, 0xf7, 0x31, 0x5e, 0xe3, 0x39, 0x6b, 0x44, 0x4d, 0xa7, 0xe3, 0x75, 0x3a, 0xae, 0x8b,
-	0x90, 0xed, 0x4c, 0xbc, 0x1e, 0x34, 0xd9, 0x05, 0x65, 0xb5, 0xf1, 0x33, 0xd6, 0x78, 0x19, 0x6b, 0x28, 0x0b, 0x8d,
-	0xdf, 0xe5, 0x79, 0x9d, 0xbe, 0x94, 0x82, 0x90, 0xe9, 0x61, 0xbf, 0x8e, 0x27, 0x38, 0x01, 0x89, 0xb1, 0x0e, 0xa6,
-	0xde, 0xb7, 0x35, 0xad, 0x4a, 0x17, 0x51, 0x60, 0x14, 0x11, 0x53, 0x23, 0x82, 0xdd, 0xeb, 0x88, 0xff, 0xb3, 0xab,
-	0x35, 0xb1, 0x57, 0xf0, 0xcf, 0x54, 0x6b, 0x00, 0x91, 0xe8, 0x03, 0x04, 0x4d, 0x03, 0xb0, 0x9a, 0x06, 0x40, 0x31,
-	0x0d, 0x20, 0xd1, 0x02, 0x00, 0x45, 0xef, 0x00, 0x14, 0xa2, 0x0f, 0x00, 0xb1, 0x89, 0x22, 0xeb, 0xec, 0x82, 0xf2,
-	0xbd, 0xa6, 0x7c, 0xaf, 0xfd, 0x7c, 0xaf, 0xbd, 0x7c, 0xaf, 0x29, 0xdf, 0x6b, 0xce, 0xf7, 0x9a, 0xf3, 0xbd, 0xb6,
-	0xf9, 0x5e, 0x53, 0xbe, 0x4d, 0xa7, 0xe7, 0x9f, 0xd4, 0xdb, 0xf9, 0x67, 0xd7, 0x4f, 0xd7, 0xf4, 0x47, 0x2a, 0xda,
-	0xd1, 0x2f, 0xc8, 0xd1, 0x2b, 0xc8, 0x91, 0x0a, 0x62, 0xba, 0xe3, 0x40, 0x70, 0x09, 0x8f, 0x5c, 0xc2, 0x63, 0x5e,
-	0xc2, 0xb7, 0xdd, 0x68, 0xb6, 0xd2, 0x0b, 0xa3, 0x5e, 0x6f, 0xf3, 0x31, 0x2c, 0xc0, 0xac, 0x55, 0x6f, 0xd3, 0xc8,
-	0x15, 0x10, 0x7f, 0xfc, 0xf5, 0x56, 0xc7, 0xab, 0x00, 0x49, 0x45, 0x02, 0xc4, 0x48, 0xd6, 0xdb, 0x01, 0xb4, 0x61,
-	0x6f, 0x93, 0x40, 0x01, 0x12, 0x6b, 0x0d, 0x20, 0x4e, 0x63, 0xfc, 0x16, 0x05, 0x0a, 0x41, 0x15, 0x28, 0x40, 0x4d,
-	0xc3, 0xfc, 0x56, 0x05, 0x0a, 0x20, 0xdb, 0x1c, 0xbf, 0xed, 0x04, 0x0a, 0x2e, 0x28, 0xab, 0x8d, 0x9f, 0xb1, 0xc6,
-	0xcb, 0x58, 0x43, 0x59, 0x30, 0x02, 0x05, 0x04, 0xe7, 0x2d, 0x0a, 0x14, 0x20, 0xa6, 0x3b, 0xf0, 0x16, 0x47, 0x96,
-	0x6f, 0x69, 0x50, 0xf9, 0xd6, 0x1f, 0x4f, 0xbe, 0xf5, 0x86, 0x92, 0x6f, 0x69, 0x14, 0xf9, 0xb6, 0x34, 0x80, 0x7c,
-	0xcb, 0x63, 0xc7, 0xb7, 0x3c, 0x6c, 0x7c, 0x6b, 0x47, 0x8c, 0x6f, 0xbb, 0x81, 0xa0, 0x46, 0xc4, 0x89, 0x22, 0xf6,
-	0xe4, 0x84, 0x26, 0x6a, 0xe7, 0x45, 0x09, 0xb7, 0x4f, 0xca, 0x48, 0xb7, 0x1a, 0x64, 0x29, 0x7e, 0xf4, 0x5a, 0x5b,
-	0x39, 0x32, 0xb2, 0x50, 0x4f, 0xb2, 0x34, 0x54, 0x65, 0x32, 0xd6, 0xd6, 0x9e, 0x8c, 0xb4, 0x15, 0x09, 0x49, 0x0c,
-	0x84, 0x0c, 0xb7, 0x31, 0x9b, 0x91, 0xb6, 0xa6, 0xe5, 0xa4, 0x17, 0xdb, 0x59, 0x0a, 0x27, 0xcc, 0x73, 0xde, 0xa9,
-	0x8a, 0x59, 0x02, 0x5b, 0x25, 0x32, 0x92, 0x2a, 0x41, 0xc6, 0x52, 0x5d, 0x45, 0xb6, 0x29, 0xe1, 0xe7, 0xac, 0xe1,
-	0x57, 0xe6, 0x2c, 0xc5, 0x0f, 0x0a, 0x4c, 0x55, 0x3c, 0x23, 0x0b, 0xb5, 0x3d, 0x4b, 0x73, 0xb6, 0xcc, 0xa4, 0x01,
-	0x19, 0x69, 0xe5, 0x00, 0x49, 0x54, 0x86, 0x0c, 0xb7, 0x22, 0x91, 0x91, 0xae, 0x5e, 0x64, 0x29, 0x1c, 0xe9, 0xc8,
-	0x78, 0xab, 0x22, 0x19, 0x59, 0x10, 0x94, 0x2c, 0x0d, 0x69, 0x4b, 0xc6, 0x92, 0xcc, 0x64, 0xac, 0x51, 0x1c, 0xe4,
-	0x4e, 0x85, 0x5a, 0x44, 0x3a, 0x94, 0x91, 0xac, 0x0d, 0xbf, 0xf7, 0x53, 0xab, 0x23, 0xbd, 0x8a, 0xb3, 0xaa, 0x08,
-	0x65, 0x13, 0xaa, 0x4a, 0x5c, 0x65, 0x57, 0x2b, 0x1d, 0x43, 0xfd, 0xde, 0x4f, 0x34, 0x4e, 0xf5, 0x2a, 0xce, 0x73,
-	0x01, 0x04, 0x33, 0x5a, 0x8a, 0xe6, 0xbf, 0x76, 0x42, 0x4c, 0x84, 0x67, 0x09, 0x3e, 0xa9, 0x79, 0x7e, 0x4f, 0x65,
-	0x07, 0x84, 0xdd, 0xfb, 0xbb, 0x1e, 0x64, 0x1d, 0x19, 0x88, 0x8a, 0xee, 0x1e, 0x64, 0x35, 0xec, 0x15, 0x43, 0x68,
-	0x09, 0x3d, 0xef, 0x39, 0x35, 0x10, 0xd9, 0x84, 0xcf, 0x7b, 0x1a, 0xaa, 0x68, 0x1d, 0xa0, 0xc9, 0x44, 0xe9, 0xb0,
-	0xa4, 0x31, 0x00, 0x19, 0x8b, 0x0e, 0x4b, 0x26, 0x26, 0xd8, 0x25, 0xb3, 0x98, 0x40, 0x64, 0xb1, 0x88, 0xfb, 0x16,
-	0x4b, 0x93, 0x2d, 0x16, 0x42, 0x8b, 0xa5, 0xd9, 0x16, 0x2d, 0x5f, 0x3e, 0xdd, 0x42, 0xb8, 0x67, 0xb1, 0x40, 0x15,
-	0x2d, 0x06, 0x34, 0x59, 0x2c, 0x70, 0x27, 0x32, 0x00, 0x59, 0x4c, 0x60, 0xcf, 0x62, 0x50, 0xfe, 0xdc, 0x6e, 0x48,
-	0xb0, 0xf5, 0x32, 0xb6, 0x60, 0x43, 0x80, 0xaf, 0x4a, 0x44, 0x66, 0x4f, 0xc0, 0x73, 0xab, 0x22, 0xc1, 0xb6, 0x45,
-	0xd6, 0xb5, 0x30, 0x24, 0x28, 0xdb, 0xd9, 0x26, 0x62, 0x6b, 0xe7, 0xa2, 0xe6, 0x9a, 0x90, 0x2d, 0xef, 0x8b, 0x5a,
-	0xe2, 0x43, 0x33, 0x93, 0x59, 0x5e, 0x20, 0xb2, 0x79, 0xc4, 0x7d, 0x6b, 0x07, 0xf6, 0x8a, 0x21, 0xb4, 0x70, 0x40,
-	0x32, 0xdb, 0x0a, 0x44, 0x56, 0x15, 0xdc, 0xb3, 0x67, 0xa0, 0x8a, 0x96, 0x04, 0x9a, 0x6c, 0x18, 0xb8, 0x13, 0x19,
-	0x80, 0xec, 0x26, 0x30, 0x5b, 0xec, 0x02, 0xc7, 0xef, 0x17, 0x34, 0x7e, 0xbf, 0xa0, 0xf1, 0xfb, 0x85, 0x3f, 0x7e,
-	0xbf, 0xf0, 0xc6, 0xef, 0x17, 0x34, 0x7e, 0xbf, 0xe0, 0xf1, 0xfb, 0x05, 0x8f, 0xdf, 0x2f, 0xec, 0xf8, 0xfd, 0x82,
-	0xc6, 0xef, 0x17, 0x9d, 0x93, 0xa7, 0x7a, 0x61, 0xba, 0x83, 0x17, 0xc6, 0xb1, 0x8a, 0x5f, 0x69, 0x13, 0x78, 0xd1,
-	0x39, 0x53, 0x0d, 0xf1, 0xef, 0xee, 0x07, 0x3a, 0xe3, 0xc5, 0x27, 0x75, 0xf3, 0x45, 0x72, 0x27, 0x20, 0x5a, 0x58,
-	0x05, 0x65, 0x64, 0xae, 0xef, 0x8a, 0x23, 0xf3, 0x84, 0x84, 0xe7, 0xa0, 0xc5, 0x05, 0xb1, 0x66, 0x17, 0xd8, 0xda,
-	0x5e, 0x60, 0xd7, 0x01, 0xc2, 0x39, 0x5e, 0x10, 0xc6, 0xba, 0x42, 0x60, 0xf2, 0x87, 0xe0, 0xe4, 0x14, 0xc1, 0x8d,
-	0x67, 0x04, 0xb5, 0xee, 0x49, 0x8d, 0xad, 0x29, 0x3b, 0x39, 0xca, 0x6b, 0x6a, 0x0d, 0x89, 0x2e, 0x4b, 0x0d, 0xed,
-	0x24, 0x47, 0xd0, 0x79, 0xa9, 0xe9, 0x9d, 0x1b, 0xc4, 0xba, 0x91, 0x1a, 0x5e, 0xc3, 0x58, 0x87, 0xe6, 0x6b, 0x57,
-	0x09, 0x06, 0x77, 0xa0, 0x6b, 0x11, 0xb6, 0xfe, 0x45, 0xce, 0x3a, 0x19, 0x39, 0xd7, 0xd3, 0x98, 0xc0, 0x71, 0x37,
-	0xd2, 0xd6, 0xe7, 0xc8, 0x91, 0xe3, 0x91, 0x24, 0xef, 0x23, 0x69, 0x42, 0x00, 0x29, 0x1b, 0x07, 0xf9, 0xb1, 0x59,
-	0xcf, 0x64, 0x14, 0x11, 0xc5, 0x43, 0xb3, 0x5e, 0x0a, 0x8c, 0x8d, 0xfc, 0xb0, 0xe8, 0xc4, 0x81, 0x31, 0x4a, 0xf2,
-	0x33, 0xa4, 0x73, 0x0f, 0xb6, 0xf1, 0xe2, 0x9f, 0x20, 0xf5, 0x68, 0x1b, 0x39, 0x40, 0x51, 0xf8, 0xa4, 0x27, 0x61,
-	0xf0, 0x28, 0x68, 0x43, 0x47, 0x19, 0x1b, 0x38, 0xca, 0xb8, 0x61, 0xa3, 0xb4, 0x13, 0x34, 0x4a, 0xda, 0x90, 0x51,
-	0x86, 0x02, 0x46, 0x29, 0x0a, 0x17, 0xa5, 0x4c, 0xb0, 0x28, 0x61, 0x43, 0x05, 0x8f, 0x0e, 0xb2, 0x71, 0x28, 0x4c,
-	0x0a, 0x07, 0x07, 0x99, 0xc7, 0x10, 0xc1, 0x23, 0x74, 0x13, 0x02, 0x31, 0x3c, 0xf0, 0x5c, 0xdd, 0x9c, 0x41, 0x1b,
-	0x1a, 0xde, 0xa9, 0x3a, 0x26, 0x6d, 0x58, 0x24, 0x82, 0x82, 0x22, 0x78, 0x01, 0x23, 0x42, 0x10, 0x1b, 0x0e, 0x02,
-	0xdb, 0x58, 0x10, 0xd8, 0x0d, 0x04, 0xe1, 0x9c, 0x28, 0x10, 0xc6, 0x86, 0x80, 0xc0, 0xe4, 0x7f, 0xc1, 0xc9, 0xf9,
-	0x82, 0x1b, 0xcf, 0x0b, 0x6a, 0xdd, 0x9e, 0xce, 0x5e, 0x99, 0xb2, 0x93, 0xc3, 0xbd, 0x93, 0x57, 0x86, 0x44, 0x57,
-	0xa7, 0xe3, 0x49, 0x93, 0x1c, 0x41, 0x27, 0xa7, 0x03, 0x4b, 0x73, 0x83, 0x58, 0xf7, 0xd2, 0x71, 0x25, 0xc3, 0x58,
-	0xc7, 0x06, 0x94, 0xbc, 0x9a, 0xcd, 0x1b, 0xa0, 0x73, 0x73, 0xc2, 0xfa, 0x38, 0x67, 0xad, 0xab, 0x73, 0xd6, 0xf5,
-	0x78, 0x9e, 0xc4, 0x71, 0x7c, 0x9e, 0xc0, 0xfa, 0x3f, 0x67, 0x29, 0x0c, 0x72, 0x9a, 0xa2, 0x21, 0xa7, 0x4d, 0x50,
-	0xe4, 0xa4, 0x8d, 0x8d, 0x8c, 0xbd, 0x2c, 0x19, 0x92, 0x22, 0xc5, 0xb0, 0x6e, 0xc0, 0x64, 0x69, 0x30, 0x6e, 0x32,
-	0x02, 0xc3, 0x27, 0x23, 0x30, 0x8a, 0x32, 0x02, 0x83, 0x29, 0x27, 0x6c, 0x4c, 0xe5, 0xac, 0x13, 0x5a, 0x59, 0x02,
-	0x1b, 0x61, 0x19, 0x49, 0x81, 0x26, 0x3e, 0xc2, 0x10, 0x8b, 0x90, 0x0d, 0xae, 0x88, 0xdb, 0xb0, 0x8a, 0xb8, 0x1b,
-	0x50, 0x91, 0x74, 0x42, 0x29, 0x52, 0x36, 0x88, 0x22, 0x4e, 0xe1, 0x13, 0x09, 0x0a, 0x9c, 0x48, 0x98, 0x90, 0x89,
-	0xb0, 0x0d, 0x16, 0x3d, 0x5a, 0x65, 0xcd, 0x40, 0x01, 0xe2, 0x1e, 0xac, 0xb2, 0x2c, 0x06, 0x85, 0x1e, 0x3a, 0x9a,
-	0x18, 0x08, 0x03, 0x41, 0xcf, 0x21, 0xcd, 0x2d, 0x64, 0x9d, 0xcf, 0xa7, 0x90, 0x2c, 0x65, 0x1d, 0x2e, 0x30, 0xb9,
-	0x3a, 0x0c, 0xed, 0xd0, 0xd3, 0x82, 0x58, 0x47, 0x0b, 0x6c, 0xfd, 0x2c, 0xb0, 0xeb, 0x66, 0xe1, 0x1c, 0x2f, 0x0b,
-	0x63, 0x9d, 0x2c, 0x30, 0xf9, 0x58, 0x70, 0x72, 0xb1, 0xe0, 0xc6, 0xc3, 0x82, 0x5a, 0x07, 0xa7, 0xc1, 0xbd, 0x29,
-	0x3b, 0xb9, 0xd7, 0x1b, 0xda, 0x1b, 0x12, 0x9d, 0x9b, 0x06, 0xf6, 0x93, 0x1c, 0x41, 0xd7, 0xa6, 0xa1, 0xfe, 0xdc,
-	0x20, 0xd6, 0xb1, 0x34, 0xd0, 0x37, 0x8c, 0x75, 0x6b, 0x40, 0xc9, 0xab, 0xa1, 0xec, 0xe8, 0x55, 0x41, 0xac, 0x57,
-	0x05, 0xb6, 0x5e, 0x15, 0xd8, 0xf5, 0xaa, 0x70, 0x8e, 0x57, 0x85, 0xb1, 0x5e, 0x15, 0x98, 0xbc, 0x2a, 0x38, 0x79,
-	0x55, 0x70, 0xe3, 0x55, 0x41, 0xad, 0x57, 0xd3, 0x3e, 0x5f, 0x53, 0x76, 0xf2, 0xaa, 0xb7, 0xcb, 0xd7, 0x90, 0xe8,
-	0xd5, 0xb4, 0x15, 0x76, 0x92, 0x23, 0xe8, 0xd5, 0xb4, 0x39, 0x76, 0x6e, 0x10, 0xeb, 0x55, 0xda, 0x1a, 0x6b, 0x18,
-	0xeb, 0xd5, 0x80, 0x5a, 0xaf, 0xbe, 0xeb, 0x1c, 0x9a, 0x36, 0x26, 0xbf, 0x4b, 0xce, 0x44, 0x48, 0x1c, 0x89, 0x50,
-	0xb6, 0x35, 0x14, 0x70, 0x98, 0x4c, 0x02, 0x34, 0x6e, 0x0e, 0x05, 0x28, 0x6d, 0x02, 0x05, 0x2c, 0xed, 0x02, 0x05,
-	0x4c, 0xb6, 0x81, 0x02, 0x22, 0xce, 0x02, 0x68, 0x8d, 0xc5, 0x89, 0xdb, 0x26, 0x00, 0x31, 0x7b, 0xd2, 0xde, 0xe5,
-	0xdb, 0x26, 0x00, 0xe6, 0x05, 0xa9, 0x77, 0x69, 0xdb, 0x04, 0x20, 0x76, 0x59, 0xe9, 0x9d, 0x6e, 0x9b, 0x00, 0x28,
-	0xdf, 0x75, 0xf6, 0x2e, 0x6d, 0x9b, 0x50, 0x24, 0x6e, 0x36, 0x5a, 0x24, 0x04, 0x16, 0x4b, 0xde, 0xa5, 0xc5, 0x46,
-	0x40, 0x24, 0xfe, 0x10, 0x71, 0xd6, 0x60, 0xdf, 0xe1, 0x5a, 0x22, 0x82, 0xba, 0x80, 0x08, 0xa8, 0x59, 0x83, 0x7d,
-	0xa7, 0x4b, 0x85, 0x00, 0xd9, 0xcd, 0x54, 0xef, 0xba, 0x45, 0x41, 0xb8, 0xa0, 0xac, 0x36, 0x7e, 0xc6, 0x1a, 0x2f,
-	0x63, 0x0d, 0x65, 0xa1, 0xf1, 0xd7, 0x7e, 0xdf, 0xe9, 0x92, 0x1e, 0x40, 0x66, 0x95, 0xf7, 0x5d, 0x5a, 0xbc, 0x53,
-	0x24, 0x6d, 0x36, 0x8a, 0xa6, 0x7e, 0x8f, 0x9b, 0x9f, 0xdf, 0xd3, 0xe6, 0xe7, 0xf7, 0xfe, 0xe6, 0xe7, 0xf7, 0xde,
-	0xe6, 0xe7, 0xf7, 0xb4, 0xf9, 0xf9, 0x7d, 0x69, 0xf3, 0xf3, 0x7b, 0xde, 0xfc, 0xfc, 0x9e, 0x37, 0x3f, 0xbf, 0xb7,
-	0x9b, 0x9f, 0x3f, 0x74, 0xeb, 0xf3, 0x63, 0xbd, 0x30, 0x7a, 0xfb, 0x21, 0x5f, 0x89, 0x07, 0x98, 0xe5, 0xf4, 0x43,
-	0x5a, 0x73, 0x07, 0xc4, 0xdf, 0x3d, 0xf3, 0x41, 0x57, 0xd7, 0x01, 0x12, 0x63, 0x03, 0x62, 0xc4, 0xf3, 0x43, 0xa7,
-	0x9b, 0x13, 0xbd, 0x30, 0xfb, 0xe3, 0x3e, 0x18, 0xb5, 0x54, 0xfc, 0xa3, 0x56, 0x8d, 0x0f, 0xc9, 0x21, 0x80, 0x78,
-	0x75, 0xf6, 0x03, 0x3a, 0x04, 0x40, 0x53, 0x67, 0x3f, 0x58, 0x87, 0x00, 0x61, 0x2b, 0xf3, 0x07, 0x75, 0x08, 0x40,
-	0x79, 0x65, 0xfe, 0x80, 0xaa, 0xfe, 0x01, 0x05, 0xfd, 0x43, 0xa7, 0xdc, 0xca, 0x7c, 0x32, 0xf5, 0xe2, 0x03, 0xea,
-	0x75, 0x02, 0x43, 0x22, 0xf4, 0xb1, 0x20, 0xd6, 0xd1, 0x02, 0xbb, 0xde, 0x16, 0xce, 0x71, 0xb9, 0x30, 0xd6, 0xef,
-	0x02, 0x17, 0x9c, 0x2f, 0x2c, 0x45, 0x80, 0xe0, 0x36, 0x0c, 0x04, 0xb6, 0xb1, 0x90, 0xa6, 0x5c, 0x27, 0x06, 0xb1,
-	0x51, 0xe1, 0x4d, 0xb9, 0x1a, 0x12, 0xe3, 0x43, 0x10, 0x1b, 0x24, 0x02, 0xbb, 0x91, 0x22, 0x9c, 0x13, 0x2e, 0xc2,
-	0xd8, 0x98, 0x11, 0xb8, 0x10, 0x38, 0xc2, 0x52, 0xf4, 0x08, 0x4e, 0x21, 0x24, 0xb8, 0x89, 0x23, 0x9a, 0x4c, 0xfe,
-	0x40, 0x93, 0xc9, 0x1f, 0xd2, 0xd4, 0xb1, 0x49, 0x43, 0xb1, 0x45, 0x53, 0xc7, 0x89, 0x09, 0xd6, 0xc6, 0x00, 0x13,
-	0xc4, 0x06, 0x98, 0xc0, 0x6e, 0x80, 0x09, 0xe7, 0x04, 0x98, 0x30, 0x36, 0xc0, 0x04, 0x2e, 0x04, 0x98, 0xb0, 0x14,
-	0x60, 0x82, 0xdb, 0x00, 0x13, 0xd8, 0x06, 0x58, 0x5a, 0x0e, 0x9e, 0x18, 0xc4, 0x06, 0x98, 0xb7, 0x18, 0x6c, 0x48,
-	0x0c, 0x30, 0x41, 0x6c, 0x80, 0x09, 0xec, 0x06, 0x98, 0x70, 0x4e, 0x80, 0x09, 0x63, 0x03, 0x4c, 0xe0, 0x42, 0x80,
-	0x09, 0x4b, 0x01, 0x26, 0x38, 0x05, 0x98, 0xe0, 0x26, 0xc0, 0xd2, 0x2a, 0xb7, 0x89, 0x85, 0x15, 0x95, 0xfe, 0x13,
-	0xa5, 0xa1, 0x00, 0xa3, 0x25, 0x6e, 0x65, 0xf2, 0xbd, 0x64, 0x63, 0x17, 0xa7, 0x60, 0x2b, 0xed, 0x25, 0xf3, 0x53,
-	0x78, 0x81, 0xe7, 0xec, 0x25, 0xf3, 0xc9, 0x52, 0x10, 0x7a, 0x7b, 0xc9, 0x7c, 0x96, 0x02, 0xd2, 0xd9, 0x4b, 0xe6,
-	0x92, 0x59, 0x70, 0x3a, 0x4b, 0xee, 0x05, 0xd2, 0x0f, 0x54, 0x40, 0xb3, 0x70, 0x45, 0x9c, 0x82, 0x16, 0x49, 0x3f,
-	0x74, 0x31, 0x85, 0x17, 0xc0, 0xc8, 0x53, 0x18, 0x23, 0x59, 0x0a, 0x66, 0x4c, 0xc3, 0x21, 0x8d, 0x2c, 0x07, 0x36,
-	0xb2, 0x36, 0xbc, 0xf3, 0x0d, 0x08, 0x6e, 0x3c, 0xae, 0x0a, 0xf6, 0xfb, 0x54, 0x48, 0xcf, 0x61, 0xef, 0xef, 0x3e,
-	0x88, 0xfc, 0x9f, 0xf6, 0x68, 0xda, 0x9f, 0x74, 0x34, 0xed, 0xcf, 0x6c, 0xed, 0xce, 0xa0, 0x94, 0x38, 0x3b, 0x9f,
-	0x63, 0x50, 0x4e, 0x9c, 0x9f, 0x3b, 0x23, 0x9c, 0x6f, 0x80, 0xd2, 0xd0, 0x4d, 0xc0, 0xd9, 0x1b, 0x2f, 0xb3, 0x81,
-	0xe2, 0x25, 0x0f, 0x14, 0x2f, 0x79, 0xa0, 0x78, 0x59, 0x18, 0x28, 0x5e, 0xba, 0x03, 0xc5, 0x4b, 0x1e, 0x28, 0x5e,
-	0x3a, 0x03, 0xc5, 0x4b, 0x67, 0xa0, 0x78, 0x49, 0x03, 0xc5, 0x4b, 0x1e, 0x28, 0x5e, 0x76, 0xd2, 0x34, 0xd5, 0x0b,
-	0x53, 0x4f, 0x2e, 0x73, 0x11, 0x02, 0x98, 0x6b, 0xc4, 0x65, 0x92, 0x1b, 0x40, 0xfc, 0xd8, 0xbf, 0x54, 0x61, 0x01,
-	0xc8, 0xec, 0x3d, 0xbc, 0x4c, 0x12, 0xa2, 0xc8, 0x3a, 0xcb, 0xfa, 0x9a, 0xcd, 0x1d, 0xc7, 0xb5, 0x33, 0x45, 0x0a,
-	0xd6, 0x5e, 0xbb, 0xd6, 0x5e, 0xb3, 0xb5, 0xd3, 0xd0, 0x16, 0x9e, 0xe9, 0x18, 0x7b, 0x4d, 0xc6, 0x8e, 0x83, 0x5b,
-	0xbd, 0xef, 0xa6, 0xd9, 0xa2, 0x98, 0x5e, 0xa6, 0xd1, 0xae, 0x22, 0xf9, 0xbb, 0x6b, 0x2e, 0x61, 0x1c, 0xef, 0x66,
-	0x90, 0x5f, 0xc4, 0xda, 0x2d, 0x22, 0x0e, 0x79, 0x11, 0x96, 0x92, 0x6b, 0x6e, 0x6b, 0x2e, 0x78, 0xed, 0x14, 0xfc,
-	0xcb, 0xe9, 0xdb, 0x97, 0x7a, 0x07, 0x5b, 0x61, 0x2e, 0xbb, 0x71, 0x30, 0x24, 0x68, 0xb8, 0x10, 0x4d, 0x21, 0xc7,
-	0x8d, 0x9b, 0xe3, 0x86, 0x9d, 0x62, 0x06, 0xc3, 0xc8, 0x70, 0xae, 0xe3, 0x68, 0x18, 0x53, 0x91, 0x6f, 0xd2, 0x70,
-	0x58, 0x13, 0xed, 0xf3, 0x2b, 0x2e, 0xc6, 0x9e, 0x7d, 0x91, 0x1f, 0xbf, 0x01, 0xe2, 0x50, 0xdf, 0x6f, 0xc8, 0xff,
-	0xc7, 0x2c, 0xc9, 0x91, 0xdf, 0x70, 0x2c, 0x18, 0xea, 0xe8, 0x1a, 0xea, 0xc8, 0x86, 0x3a, 0x16, 0x0d, 0x75, 0x64,
-	0x43, 0x1d, 0x1d, 0xf7, 0x1e, 0x29, 0xae, 0x9f, 0xb2, 0xab, 0x53, 0x7e, 0xc5, 0x45, 0x80, 0xdd, 0x4c, 0xe9, 0x4d,
-	0xe9, 0xfc, 0xaa, 0xa6, 0xcb, 0x0f, 0xb0, 0x12, 0x4e, 0x32, 0xea, 0x1c, 0x61, 0x25, 0xd2, 0x33, 0x52, 0x7e, 0x88,
-	0x95, 0x70, 0x96, 0x56, 0x73, 0x8c, 0x95, 0x08, 0x6b, 0x9f, 0xfc, 0x20, 0xab, 0xc5, 0x51, 0x6e, 0xf3, 0x01, 0x87,
-	0x85, 0x5d, 0xe1, 0xa5, 0x01, 0x87, 0x65, 0xac, 0x04, 0xbb, 0x03, 0x0e, 0xcb, 0x92, 0x18, 0xe7, 0x03, 0x0e, 0x0b,
-	0x5b, 0x59, 0x0e, 0xf0, 0x9a, 0x0b, 0xcb, 0x02, 0x2d, 0xb8, 0x55, 0x69, 0x81, 0xcf, 0x39, 0xd3, 0xd5, 0x6b, 0xa1,
-	0x0a, 0xce, 0x64, 0xe5, 0x16, 0xbc, 0xe4, 0x4b, 0xd2, 0x70, 0x81, 0xad, 0x58, 0xc4, 0xde, 0x48, 0x5e, 0x9b, 0xb3,
-	0x3e, 0x8a, 0x7d, 0x86, 0x93, 0x3d, 0x16, 0x77, 0xc1, 0x49, 0x55, 0x22, 0x7e, 0xc6, 0x3c, 0xae, 0xd6, 0x47, 0xca,
-	0x13, 0x7c, 0xe1, 0xac, 0xea, 0x0b, 0x5c, 0xb0, 0x9c, 0xa3, 0xff, 0x81, 0xe0, 0x46, 0x20, 0xe0, 0x0d, 0x27, 0xe5,
-	0xe6, 0x40, 0xf0, 0x73, 0xc5, 0x73, 0x1b, 0x06, 0xa1, 0x0a, 0xde, 0x2f, 0x36, 0x11, 0x42, 0x17, 0x8a, 0xc8, 0x8d,
-	0x85, 0xe0, 0x7e, 0x10, 0x70, 0xb3, 0x11, 0xf0, 0xbd, 0x03, 0x15, 0x0a, 0xce, 0xad, 0x48, 0xc4, 0xfd, 0xa6, 0x24,
-	0xb0, 0x5e, 0x7b, 0x12, 0x98, 0x23, 0x27, 0xe6, 0x96, 0x45, 0xf0, 0x73, 0x36, 0x77, 0xdb, 0x18, 0xa1, 0x0a, 0x36,
-	0x2f, 0xb6, 0x36, 0x42, 0x17, 0x6c, 0xee, 0xb4, 0x3b, 0x42, 0xf8, 0x15, 0xf2, 0x89, 0xa1, 0x93, 0x03, 0x15, 0x0a,
-	0xed, 0x36, 0x48, 0x60, 0xea, 0xbc, 0x59, 0x42, 0x82, 0x1f, 0x88, 0x2c, 0x37, 0x51, 0xc8, 0x16, 0x2c, 0x8d, 0x49,
-	0x5c, 0x7b, 0x63, 0x02, 0xb6, 0x3a, 0xb2, 0x4e, 0xd3, 0x85, 0xb4, 0x63, 0x63, 0xa4, 0xc9, 0xd2, 0x48, 0x72, 0x63,
-	0x96, 0x4f, 0x6e, 0x4c, 0x5d, 0x9c, 0x1a, 0xb6, 0xd2, 0xe4, 0x86, 0x9f, 0xc2, 0x6b, 0xe4, 0x9c, 0xc9, 0x0d, 0x9f,
-	0x2c, 0x35, 0x78, 0xde, 0xe4, 0x86, 0xcf, 0x52, 0xe3, 0xe7, 0x4c, 0x6e, 0xb8, 0xe4, 0xba, 0x64, 0x28, 0xa7, 0x39,
-	0x44, 0x96, 0x1a, 0x45, 0x24, 0x7f, 0x1c, 0x3e, 0x7e, 0x03, 0x89, 0x09, 0xce, 0x86, 0x8f, 0xd3, 0x58, 0x22, 0x7b,
-	0x3e, 0x7a, 0xb8, 0xe1, 0x44, 0x92, 0x94, 0x33, 0x1b, 0x6e, 0x1b, 0x09, 0xe3, 0xa1, 0xb8, 0xff, 0xd4, 0x62, 0x41,
-	0x9c, 0x66, 0x15, 0x59, 0x16, 0xdb, 0x8c, 0xfd, 0xa1, 0x99, 0xfd, 0x86, 0x36, 0x4b, 0xe0, 0x36, 0xb7, 0x98, 0x82,
-	0x1a, 0x5d, 0x24, 0xcf, 0xfa, 0xc1, 0x6b, 0x80, 0x81, 0x76, 0x9a, 0x61, 0x60, 0x9b, 0xd2, 0x6d, 0x4e, 0x93, 0x8c,
-	0xec, 0x8f, 0x8d, 0xe2, 0x37, 0xcf, 0x98, 0xe0, 0x6c, 0xec, 0x95, 0x9b, 0x6a, 0x4c, 0x74, 0xd6, 0x30, 0x4e, 0xb3,
-	0x8d, 0xec, 0xb9, 0x10, 0x74, 0x9a, 0x70, 0x60, 0xf7, 0x45, 0xe2, 0xac, 0xd1, 0x9c, 0x46, 0x3d, 0x63, 0x0b, 0x4d,
-	0x3b, 0xc0, 0x6e, 0x03, 0x0f, 0xfc, 0xb1, 0x74, 0xa3, 0xd3, 0xd8, 0x23, 0xfb, 0x63, 0x6f, 0xfa, 0x0d, 0x3f, 0x26,
-	0x38, 0xeb, 0xcd, 0x72, 0x27, 0x00, 0x13, 0x9d, 0xf5, 0xa6, 0xd7, 0x21, 0x40, 0xfa, 0x9c, 0xdc, 0x3c, 0x95, 0x88,
-	0x53, 0x91, 0x38, 0x6b, 0x30, 0xa7, 0xbb, 0xf0, 0x11, 0x3f, 0xfe, 0xf3, 0x91, 0xbe, 0xfb, 0xf3, 0x91, 0x3e, 0xf9,
-	0xf3, 0x71, 0xe0, 0x7e, 0xed, 0xe7, 0xa3, 0xf7, 0xa1, 0x9f, 0x8f, 0xf4, 0x8d, 0x9f, 0x8f, 0xfc, 0x79, 0x9f, 0x8f,
-	0xfc, 0x65, 0x9f, 0x8f, 0xf6, 0xa3, 0x3e, 0x1f, 0xe9, 0x7b, 0x3e, 0x1f, 0xed, 0x06, 0x98, 0x8f, 0xb4, 0xf7, 0xe5,
-	0x63, 0x3a, 0xfb, 0x62, 0x11, 0x5b, 0xc8, 0xfc, 0xec, 0x8b, 0x85, 0xdd, 0xe2, 0xd2, 0xd9, 0x17, 0xcb, 0xd8, 0x82,
-	0x9b, 0xb3, 0x2f, 0x16, 0x27, 0x13, 0x64, 0x67, 0x5f, 0x2c, 0x6a, 0x8d, 0xe1, 0x1e, 0x1e, 0xf9, 0xe8, 0x1f, 0x1e,
-	0xc1, 0x35, 0x82, 0x97, 0x05, 0xd8, 0x1a, 0xc8, 0x39, 0x3c, 0xe2, 0x72, 0xae, 0xa9, 0xfc, 0xc3, 0x23, 0x2e, 0x6d,
-	0x8d, 0xe6, 0x1d, 0x1e, 0x71, 0x49, 0x32, 0x1f, 0x1f, 0x1e, 0x71, 0x29, 0x6b, 0xc8, 0xf2, 0x81, 0x0a, 0xa4, 0xc8,
-	0xa4, 0x78, 0xa0, 0xc2, 0x01, 0xad, 0x39, 0xe9, 0x40, 0x85, 0xc3, 0xb8, 0xa6, 0xf4, 0x0e, 0x54, 0x38, 0xa4, 0x35,
-	0x23, 0x1f, 0xa8, 0x70, 0x28, 0x32, 0xa1, 0x3d, 0x50, 0xe1, 0x10, 0xd6, 0x7c, 0xa5, 0x63, 0x07, 0x4a, 0x90, 0xe9,
-	0xd2, 0xb1, 0x03, 0x8b, 0x58, 0xa3, 0xe5, 0xc7, 0x0e, 0x2c, 0xec, 0x9a, 0x8b, 0x8e, 0x1d, 0x58, 0xc6, 0x1a, 0xca,
-	0x1c, 0x3b, 0xb0, 0x38, 0x99, 0x28, 0x3b, 0x76, 0x60, 0x51, 0x6b, 0x1c, 0x77, 0xdf, 0xfe, 0x47, 0x7f, 0xdf, 0x7e,
-	0xbe, 0xd2, 0xf6, 0xb2, 0x48, 0x58, 0x23, 0xb9, 0xfb, 0xf6, 0x0b, 0xac, 0x6b, 0xb2, 0xd2, 0xbe, 0xfd, 0x42, 0x02,
-	0x6b, 0x40, 0x7f, 0xdf, 0x7e, 0x81, 0x26, 0x73, 0x7a, 0xfb, 0xf6, 0x0b, 0xa4, 0x35, 0xee, 0xb9, 0x9d, 0xeb, 0x1f,
-	0xcf, 0xee, 0x5c, 0x8f, 0x0b, 0x96, 0x2f, 0x1d, 0xc8, 0x9a, 0xd7, 0xec, 0x5c, 0x27, 0xdc, 0x35, 0x29, 0xef, 0x5c,
-	0x27, 0xca, 0x9a, 0xd1, 0xee, 0x5c, 0x27, 0x82, 0x4c, 0x97, 0xef, 0x5c, 0x27, 0xd8, 0x9a, 0xcb, 0xdf, 0xf1, 0x1d,
-	0x61, 0x32, 0x91, 0xbc, 0xee, 0xa5, 0x03, 0x59, 0x13, 0x45, 0xdc, 0x9a, 0x28, 0xe2, 0xae, 0x89, 0x22, 0xe9, 0x98,
-	0x28, 0x52, 0xd6, 0x44, 0x11, 0x27, 0x13, 0x45, 0x82, 0x4c, 0x14, 0x09, 0x63, 0xa2, 0x08, 0x5b, 0x13, 0x09, 0x6e,
-	0x4d, 0x24, 0x30, 0x99, 0xa8, 0x7f, 0xea, 0x4b, 0x02, 0xac, 0x79, 0x02, 0x6a, 0x8d, 0x13, 0x50, 0xd7, 0x34, 0x81,
-	0x72, 0x0c, 0x13, 0x08, 0x6b, 0x96, 0x80, 0x92, 0x51, 0x02, 0x4c, 0x26, 0x09, 0xb0, 0x31, 0x48, 0x00, 0xad, 0x39,
-	0x7a, 0xd4, 0x1a, 0xa3, 0x07, 0xad, 0x29, 0xae, 0xf0, 0xb3, 0x86, 0x57, 0xf4, 0x59, 0xc3, 0x2b, 0xfa, 0xac, 0xe1,
-	0xd5, 0xc0, 0xfd, 0xac, 0xe1, 0x95, 0xf7, 0x59, 0xc3, 0x2b, 0xfa, 0xac, 0xe1, 0x15, 0x7f, 0xd6, 0xf0, 0x8a, 0x3f,
-	0x6b, 0x78, 0x65, 0x3f, 0x6b, 0x78, 0x45, 0x9f, 0x35, 0xbc, 0xea, 0x3e, 0x96, 0xad, 0x85, 0x78, 0x63, 0x9c, 0x74,
-	0x65, 0x3e, 0x91, 0xad, 0xf8, 0x45, 0x76, 0x61, 0x3c, 0x7e, 0xe5, 0xcf, 0x0f, 0x5d, 0x79, 0x93, 0x42, 0x57, 0x34,
-	0x13, 0x74, 0x55, 0x9a, 0xfe, 0xb9, 0xe2, 0x39, 0x9f, 0x2b, 0x9a, 0xe8, 0xb9, 0xa2, 0xd9, 0x9d, 0xab, 0x01, 0x7c,
-	0x96, 0xf2, 0x2a, 0x4d, 0xe3, 0x00, 0x22, 0xa5, 0x06, 0x04, 0xb3, 0x0f, 0x30, 0xef, 0x4c, 0xbf, 0x4a, 0xf3, 0x32,
-	0x80, 0xc4, 0x5c, 0x02, 0x14, 0x7d, 0x03, 0x50, 0xf0, 0x0d, 0x00, 0x92, 0x6f, 0x45, 0x64, 0xfc, 0x38, 0x05, 0x40,
-	0xa6, 0x54, 0xaa, 0x88, 0x64, 0xbe, 0xac, 0x29, 0xec, 0xe2, 0x7c, 0x09, 0x22, 0x6e, 0xd8, 0xd5, 0x5e, 0xd8, 0xe1,
-	0x5c, 0x08, 0xa0, 0x14, 0x8c, 0x35, 0x07, 0x63, 0xcd, 0xc1, 0x18, 0x67, 0x37, 0x14, 0x69, 0xb2, 0x0b, 0xca, 0x7c,
-	0xe3, 0x67, 0xb5, 0xf1, 0xb2, 0xda, 0x50, 0xa6, 0xcc, 0xac, 0x04, 0x10, 0x9c, 0xdb, 0x38, 0xfd, 0x00, 0x08, 0x55,
-	0x14, 0x9d, 0x67, 0x48, 0xc6, 0x87, 0x31, 0xbe, 0xfa, 0xe8, 0x88, 0x1e, 0x3c, 0x52, 0xb0, 0x1d, 0xfd, 0xd0, 0x3a,
-	0x7a, 0xa1, 0x75, 0xa4, 0xd0, 0x32, 0x83, 0x73, 0x20, 0x38, 0xe6, 0x8e, 0x1c, 0x73, 0xc7, 0x3c, 0xe6, 0x56, 0x9d,
-	0x6a, 0x55, 0x7a, 0x61, 0xb6, 0x09, 0xad, 0x92, 0x6a, 0x01, 0xe2, 0x6d, 0x82, 0x5f, 0xa1, 0x6a, 0x01, 0x68, 0x36,
-	0xc1, 0xaf, 0x54, 0xb5, 0x00, 0xb2, 0xfb, 0xf0, 0x57, 0x51, 0xb5, 0x00, 0x30, 0xbb, 0xdf, 0x57, 0xb8, 0x23, 0x6f,
-	0x45, 0xdb, 0xf0, 0x56, 0xfe, 0xde, 0xbb, 0x95, 0xb7, 0xe1, 0x6e, 0x45, 0xbb, 0xec, 0x56, 0xa5, 0xad, 0x75, 0x2b,
-	0xde, 0x4f, 0xb7, 0xa2, 0x4d, 0x74, 0x2b, 0xda, 0x39, 0xb7, 0xc2, 0xc3, 0x1c, 0x2b, 0x3a, 0xcc, 0xb1, 0xa2, 0xc3,
-	0x1c, 0x2b, 0xff, 0x30, 0xc7, 0xca, 0x3b, 0xcc, 0xb1, 0xa2, 0xc3, 0x1c, 0x2b, 0x3e, 0xcc, 0xb1, 0xe2, 0xc3, 0x1c,
-	0x2b, 0x7b, 0x98, 0x63, 0x45, 0x87, 0x39, 0x56, 0x51, 0x6d, 0x16, 0x09, 0xa8, 0x75, 0xdf, 0xd9, 0x8a, 0x3e, 0x1c,
-	0xbb, 0xa2, 0x0f, 0xc7, 0xae, 0xfc, 0x0f, 0xc7, 0xae, 0xbc, 0x0f, 0xc7, 0xae, 0xdc, 0x0f, 0xc7, 0xae, 0xe8, 0xc3,
-	0xb1, 0x2b, 0xfe, 0x70, 0xec, 0x8a, 0x3f, 0x1c, 0xbb, 0x4a, 0x62, 0xa3, 0xa5, 0x69, 0x90, 0xb6, 0x9f, 0x92, 0x5d,
-	0xf9, 0x9f, 0x92, 0x5d, 0x79, 0x9f, 0x92, 0x5d, 0xd1, 0xa7, 0x64, 0x57, 0xa5, 0x4f, 0xc9, 0xae, 0xf8, 0x53, 0xb2,
-	0x2b, 0xfa, 0x94, 0xec, 0x8a, 0x3e, 0x25, 0xbb, 0x4a, 0x62, 0xa3, 0xb6, 0x3f, 0x22, 0x6d, 0x3f, 0xcb, 0xb6, 0xf2,
-	0xbf, 0xc5, 0xb6, 0xf2, 0x3e, 0xc0, 0xb6, 0xa2, 0xaf, 0xae, 0xad, 0x4a, 0x9f, 0x5a, 0x5b, 0xf1, 0xf7, 0xd5, 0x56,
-	0xfc, 0x51, 0xb5, 0x95, 0xfd, 0x92, 0xda, 0xaa, 0x9b, 0xab, 0xd3, 0xf0, 0x3f, 0x51, 0xf5, 0x3c, 0x71, 0x3d, 0xfc,
-	0xd4, 0xaf, 0xdb, 0x8d, 0xf4, 0x2a, 0x4e, 0xea, 0x01, 0x14, 0x57, 0xe8, 0x00, 0xca, 0x66, 0x43, 0x01, 0x87, 0x29,
-	0x50, 0x40, 0xe3, 0xbc, 0x27, 0x40, 0x69, 0xd5, 0x0d, 0xb0, 0x34, 0x7b, 0x09, 0x98, 0x4c, 0x59, 0x02, 0x12, 0x17,
-	0xd5, 0x14, 0x6a, 0x45, 0x69, 0x51, 0xa5, 0x8b, 0xd8, 0x9c, 0x29, 0x92, 0x35, 0x67, 0x0a, 0x43, 0x73, 0xa6, 0x60,
-	0x6c, 0xce, 0x14, 0x31, 0xcd, 0x99, 0x12, 0xa9, 0x39, 0x53, 0x28, 0x36, 0x67, 0x8a, 0xc4, 0xe6, 0x2c, 0x21, 0x6b,
-	0x58, 0x66, 0xf8, 0xa4, 0x6b, 0x5b, 0x00, 0x99, 0x5e, 0xd1, 0x27, 0xb3, 0x8a, 0x05, 0x29, 0x9d, 0xef, 0x2d, 0x7d,
-	0xd2, 0xf5, 0x2a, 0x80, 0x6c, 0x23, 0xf5, 0x09, 0x56, 0xa6, 0x20, 0x99, 0x18, 0x1b, 0x90, 0x68, 0x6c, 0x85, 0xa4,
-	0xdd, 0x9d, 0x01, 0x10, 0xfa, 0x46, 0x9a, 0x24, 0xbf, 0xa1, 0xe6, 0x22, 0xa6, 0xd5, 0x24, 0x84, 0xfc, 0x32, 0xd6,
-	0x6e, 0x19, 0xb3, 0xc5, 0x22, 0x80, 0xb9, 0xe8, 0x35, 0x17, 0xbd, 0x76, 0x8a, 0x4e, 0x2b, 0x40, 0x9f, 0x06, 0x1b,
-	0xac, 0x24, 0x1b, 0x53, 0x97, 0x5a, 0xc4, 0x9e, 0x0b, 0xfd, 0xd4, 0x2f, 0x14, 0xe9, 0xfd, 0x0d, 0x97, 0xbb, 0x29,
-	0x14, 0xb2, 0x71, 0x0b, 0xd9, 0x70, 0x69, 0xec, 0x8a, 0x0f, 0x30, 0xa9, 0x42, 0x01, 0x16, 0x17, 0x77, 0x00, 0x62,
-	0x87, 0xa6, 0xfe, 0x95, 0x42, 0xd0, 0xbf, 0x52, 0x3f, 0x1f, 0xb3, 0x3a, 0x77, 0x64, 0x9d, 0x38, 0x16, 0x44, 0xe1,
-	0xe8, 0x8a, 0xc2, 0x91, 0x45, 0xc1, 0xae, 0x80, 0x00, 0xe3, 0xc8, 0xc5, 0xd1, 0x91, 0x8b, 0xa3, 0x95, 0x8b, 0x34,
-	0x2d, 0x4f, 0x10, 0xe5, 0x3f, 0x9f, 0x98, 0x27, 0xdc, 0x2f, 0x1c, 0x4d, 0xcd, 0x13, 0x45, 0xc5, 0x34, 0x93, 0xf3,
-	0x44, 0x70, 0xb1, 0xb2, 0xe9, 0x79, 0x82, 0x49, 0x0f, 0xd3, 0x19, 0xb0, 0x24, 0x3a, 0xf9, 0x19, 0x30, 0x0b, 0xbb,
-	0xf2, 0x48, 0x67, 0xc0, 0x2c, 0x63, 0x85, 0xd2, 0x3d, 0x03, 0x66, 0x59, 0x92, 0xcc, 0xfc, 0x0c, 0x98, 0x85, 0xad,
-	0x78, 0x06, 0x38, 0x13, 0x1b, 0x81, 0xa8, 0xae, 0x09, 0x6e, 0xb5, 0x54, 0x60, 0xbf, 0x1e, 0x0a, 0xe9, 0x55, 0x46,
-	0xa1, 0xa8, 0x46, 0x0a, 0x4e, 0x22, 0x23, 0x38, 0x2b, 0x8d, 0x10, 0x56, 0x69, 0x05, 0x36, 0x23, 0xd1, 0x4f, 0x71,
-	0xad, 0x25, 0xaf, 0x8a, 0xd9, 0x0a, 0x8c, 0x7d, 0x86, 0x93, 0x3d, 0x56, 0x60, 0xc1, 0x49, 0x86, 0x23, 0x7e, 0xc6,
-	0x3c, 0xae, 0x20, 0x47, 0xca, 0x53, 0x65, 0xe1, 0x0a, 0xa6, 0x63, 0x7d, 0x16, 0xbc, 0x64, 0x3a, 0x56, 0xea, 0x80,
-	0xa3, 0x5c, 0x0b, 0x62, 0x35, 0x5b, 0x60, 0x12, 0xee, 0x80, 0x37, 0xfc, 0x4c, 0x96, 0x70, 0xc1, 0xcf, 0x19, 0xc8,
-	0x15, 0x73, 0xa1, 0x0a, 0x46, 0x28, 0xca, 0xba, 0xd0, 0x05, 0x1b, 0xb1, 0xbe, 0x0b, 0x4e, 0x22, 0x9f, 0xaf, 0xce,
-	0x59, 0xdc, 0x93, 0xfb, 0xc0, 0x1c, 0x59, 0x57, 0x58, 0xf8, 0x05, 0x3f, 0x27, 0x90, 0x6e, 0x13, 0x20, 0x54, 0x41,
-	0x20, 0x8b, 0x8d, 0x81, 0xd0, 0x25, 0xfd, 0x74, 0x9a, 0x05, 0x21, 0xac, 0x7e, 0xe2, 0x42, 0x9a, 0x87, 0x52, 0x41,
-	0x69, 0x29, 0xcd, 0xa3, 0x7c, 0x33, 0x78, 0x8b, 0x69, 0x1e, 0x4b, 0xc6, 0xe0, 0xe5, 0x34, 0x8f, 0xe3, 0x32, 0xdb,
-	0x05, 0x35, 0x8f, 0xa1, 0x96, 0x23, 0x51, 0xd8, 0x78, 0x28, 0x68, 0xdb, 0x0f, 0x65, 0xdc, 0x26, 0x44, 0x69, 0xa7,
-	0x15, 0x51, 0xd2, 0x36, 0x24, 0xca, 0x14, 0xda, 0x12, 0x4d, 0x40, 0xcd, 0x89, 0x52, 0xb6, 0x45, 0x51, 0xc6, 0x36,
-	0x2a, 0x89, 0xc9, 0xc4, 0x54, 0x51, 0xd2, 0x00, 0xa5, 0x6c, 0xeb, 0xa2, 0x8c, 0x2f, 0x10, 0xca, 0x7b, 0x1a, 0xa1,
-	0x2c, 0xc9, 0x84, 0x52, 0x24, 0x05, 0x4a, 0xb1, 0x62, 0x2a, 0x67, 0xdb, 0x1b, 0x65, 0x6c, 0x93, 0x03, 0xcb, 0xaa,
-	0xb9, 0x22, 0xd8, 0xf5, 0x56, 0xe7, 0x61, 0x7e, 0x9e, 0xb9, 0xf9, 0x51, 0x8a, 0x5a, 0x20, 0xa0, 0xce, 0x9b, 0xd0,
-	0x6d, 0x87, 0x80, 0xf5, 0x9a, 0x22, 0xa5, 0xcb, 0x16, 0xe6, 0x06, 0x49, 0xa9, 0x33, 0x16, 0xe6, 0x66, 0x29, 0x51,
-	0xd8, 0x32, 0x29, 0x68, 0x1b, 0x27, 0x65, 0xa8, 0x7d, 0x4a, 0x54, 0xe3, 0x3e, 0x9f, 0x5b, 0x29, 0xa5, 0x7e, 0x60,
-	0x44, 0xb7, 0xad, 0x52, 0xb6, 0x6c, 0xa5, 0x62, 0x8b, 0xa5, 0x29, 0x78, 0x40, 0xa2, 0x1c, 0x35, 0x5c, 0x4a, 0x51,
-	0xdb, 0x45, 0xcb, 0xf9, 0x0e, 0xe5, 0xb5, 0x60, 0x89, 0x3c, 0xba, 0x12, 0xc7, 0xed, 0x98, 0x52, 0x3f, 0xd0, 0x70,
-	0xb7, 0x35, 0x53, 0xb6, 0xac, 0xe1, 0xc5, 0x36, 0x4d, 0x53, 0x9c, 0x51, 0x79, 0xa7, 0x65, 0x53, 0xce, 0xa8, 0xfc,
-	0xba, 0xfb, 0xcd, 0xc7, 0x71, 0xba, 0x78, 0xc2, 0x0b, 0xf8, 0xa0, 0xf2, 0x9a, 0xbe, 0xa5, 0xbc, 0xf6, 0x3e, 0xa3,
-	0x2c, 0x1a, 0x88, 0x8f, 0x0c, 0xc8, 0x13, 0x21, 0x27, 0xba, 0x8b, 0xde, 0x20, 0xb0, 0xf3, 0x9a, 0xa0, 0xa7, 0xf8,
-	0x9a, 0x80, 0x3c, 0x11, 0x72, 0xa2, 0xbb, 0xe8, 0x35, 0x02, 0x3b, 0xaf, 0x01, 0xf7, 0xe2, 0xbb, 0x00, 0x7e, 0xf2,
-	0xe1, 0x93, 0xff, 0x10, 0x7a, 0x35, 0x72, 0xce, 0xfb, 0x13, 0x84, 0x6f, 0x4f, 0xe0, 0x93, 0x07, 0x9e, 0xbc, 0xdb,
-	0xe9, 0xbd, 0xca, 0x38, 0x6f, 0x0d, 0x61, 0x89, 0xaf, 0x0c, 0xc8, 0x13, 0x21, 0x27, 0xba, 0x8b, 0xde, 0x24, 0xb0,
-	0xf3, 0x1a, 0x09, 0x60, 0x7c, 0x8f, 0x40, 0x4f, 0x0c, 0x9d, 0xf8, 0x46, 0x7a, 0x55, 0xc4, 0x9d, 0x77, 0xe9, 0x8f,
-	0xac, 0x8f, 0x0d, 0xf4, 0xc4, 0xd0, 0x89, 0x6f, 0xa4, 0x77, 0xf1, 0x8f, 0xac, 0x27, 0x2a, 0xfe, 0x3a, 0xf3, 0x38,
-	0x03, 0x9e, 0x2c, 0x70, 0xb2, 0xb7, 0xd0, 0x3b, 0xec, 0xaf, 0x33, 0x27, 0x22, 0xfd, 0x56, 0xeb, 0x38, 0x47, 0x9e,
-	0x08, 0x39, 0xd1, 0x5d, 0xf4, 0x16, 0xfa, 0xad, 0xd6, 0xc8, 0x5c, 0xb7, 0xff, 0xd2, 0xe7, 0x80, 0xae, 0xed, 0x2a,
-	0xfb, 0xf5, 0x60, 0xab, 0x6f, 0x6b, 0x2f, 0x4c, 0x2b, 0xd5, 0x22, 0xd9, 0xba, 0x34, 0xe0, 0x66, 0x3d, 0xe6, 0x9a,
-	0x96, 0xea, 0xaf, 0xf1, 0x87, 0xbb, 0xae, 0xe9, 0x87, 0xbb, 0xae, 0xfd, 0x1f, 0xee, 0xba, 0xf6, 0x7e, 0xb8, 0xeb,
-	0x9a, 0x7e, 0xb8, 0xeb, 0xba, 0xf4, 0xc3, 0x5d, 0xd7, 0xfc, 0xc3, 0x5d, 0xd7, 0xfc, 0xc3, 0x5d, 0xd7, 0xf6, 0x87,
-	0xbb, 0xae, 0xd1, 0x0f, 0xd7, 0x38, 0xaf, 0x7e, 0x4d, 0xf3, 0xea, 0xd7, 0xde, 0xbc, 0xfa, 0x8d, 0xfe, 0xfe, 0x5f,
-	0x04, 0xbe, 0x22, 0xfb, 0xd5, 0xb5, 0xe3, 0x4d, 0x3e, 0xb4, 0xaf, 0x32, 0xf4, 0x2b, 0xa5, 0x2b, 0x3c, 0x24, 0x3f,
-	0x51, 0x57, 0x65, 0xe8, 0x57, 0x4a, 0x57, 0x7a, 0x48, 0xfe, 0x35, 0x00, 0x7d, 0x8c, 0xe0, 0x5f, 0x9d, 0xb4, 0x85,
-	0x47, 0xf5, 0x0d, 0xf3, 0xe1, 0xdb, 0xfa, 0x06, 0x96, 0x12, 0xc3, 0x63, 0xed, 0xcf, 0x02, 0x0c, 0x99, 0xb5, 0x14,
-	0x59, 0x07, 0xc6, 0xb5, 0x09, 0x79, 0xd4, 0x78, 0xcf, 0xea, 0x4f, 0x3d, 0x78, 0x46, 0xe6, 0x84, 0x8c, 0x75, 0x6b,
-	0xed, 0xb9, 0xb5, 0x76, 0x1d, 0x54, 0x9b, 0xf1, 0x75, 0x0e, 0x63, 0x66, 0xa8, 0xd9, 0x14, 0xe4, 0x99, 0xd2, 0x9c,
-	0x28, 0x0d, 0x65, 0x90, 0x1a, 0xd2, 0xc4, 0xb8, 0x11, 0x50, 0x9b, 0xa3, 0x77, 0x39, 0x8c, 0xb9, 0x4c, 0xc7, 0xc5,
-	0xcc, 0x03, 0x9f, 0x29, 0xcd, 0x89, 0xd2, 0x50, 0x2e, 0xe9, 0xf4, 0x98, 0x32, 0xb4, 0x01, 0x56, 0xf3, 0xc4, 0x1b,
-	0x60, 0x3d, 0x2e, 0xcb, 0xb4, 0xdb, 0x7c, 0x23, 0xfc, 0xec, 0xa7, 0x3e, 0xf9, 0xa9, 0xb9, 0x20, 0x6e, 0xab, 0x9e,
-	0x68, 0x1a, 0x1f, 0x55, 0x96, 0xa0, 0x92, 0x60, 0x47, 0x60, 0x42, 0xcf, 0x79, 0xf2, 0x1e, 0xfe, 0xec, 0xa5, 0x3c,
-	0x79, 0x29, 0x29, 0xff, 0x5e, 0xef, 0x40, 0xc9, 0x34, 0x5e, 0xa2, 0xec, 0x27, 0x86, 0xf3, 0x9f, 0xa8, 0xac, 0x00,
-	0x09, 0x7d, 0x72, 0x5f, 0xf0, 0xec, 0xa6, 0x3d, 0xb9, 0x69, 0xb9, 0x10, 0x4a, 0x39, 0xa5, 0xc8, 0xb6, 0xbd, 0xa6,
-	0x6c, 0xe6, 0xdb, 0x5e, 0x0d, 0x8c, 0x39, 0xa7, 0x0e, 0x91, 0x20, 0xcf, 0x94, 0xe6, 0x44, 0x69, 0x28, 0xa7, 0xd4,
-	0x45, 0x4a, 0x4c, 0xbe, 0x21, 0x32, 0xe5, 0xc7, 0x6c, 0x88, 0xb4, 0x38, 0x66, 0x94, 0x7b, 0x54, 0x11, 0x7a, 0xe6,
-	0x54, 0x27, 0x4e, 0x45, 0x99, 0xe5, 0x4e, 0x56, 0xa2, 0xf2, 0xbd, 0x89, 0x29, 0x57, 0x66, 0x6f, 0xa2, 0xc5, 0x31,
-	0xb7, 0xdc, 0x27, 0x8b, 0xd0, 0x33, 0xa7, 0x3a, 0x71, 0x2a, 0xca, 0x2d, 0x77, 0xd3, 0x22, 0x75, 0x37, 0x80, 0x1f,
-	0x0f, 0xbd, 0x4b, 0x93, 0x37, 0x80, 0xc8, 0x9c, 0x0d, 0x20, 0xde, 0x0a, 0xfe, 0x1d, 0x4e, 0xd1, 0x00, 0x68, 0x56,
-	0xf0, 0xef, 0x74, 0x42, 0x06, 0x20, 0xbb, 0x50, 0x7f, 0x17, 0xe7, 0x5f, 0x00, 0x30, 0x3b, 0x0f, 0xee, 0xec, 0x0f,
-	0x9f, 0xde, 0x0d, 0xda, 0x48, 0xdf, 0xd6, 0x87, 0x43, 0x37, 0x7b, 0xb0, 0x88, 0x58, 0x76, 0x87, 0xdd, 0x08, 0x72,
-	0x47, 0x1b, 0x41, 0xee, 0xfc, 0x8d, 0x20, 0x77, 0xde, 0x46, 0x90, 0x3b, 0x77, 0x23, 0xc8, 0x1d, 0x6d, 0x04, 0xb9,
-	0xe3, 0x8d, 0x20, 0x77, 0xbc, 0x11, 0xe4, 0x0e, 0xb7, 0x7d, 0xdc, 0xd1, 0xb6, 0x8f, 0x3b, 0x7f, 0xdb, 0xc7, 0x9d,
-	0xb7, 0xed, 0xe3, 0x8e, 0xb6, 0x7d, 0xdc, 0x95, 0xb6, 0x7d, 0xdc, 0xf1, 0xb6, 0x8f, 0x3b, 0xda, 0xf6, 0x71, 0x47,
-	0xdb, 0x3e, 0xee, 0xe8, 0x47, 0x66, 0xef, 0x4c, 0xcf, 0x64, 0x96, 0xe3, 0x01, 0x8c, 0x5d, 0x99, 0xcf, 0xfd, 0x61,
-	0x37, 0xbd, 0x88, 0x13, 0x0b, 0x8a, 0xc4, 0x59, 0x2e, 0x40, 0xb2, 0x83, 0x6c, 0x11, 0x0f, 0xb1, 0xb9, 0x67, 0xc4,
-	0x3e, 0x52, 0x60, 0xfb, 0xdc, 0x08, 0xbb, 0x0f, 0xb7, 0xa7, 0xf3, 0x5c, 0xdc, 0xbe, 0xc8, 0x3d, 0x9b, 0xe7, 0x93,
-	0xde, 0x4b, 0xb3, 0x5f, 0x6f, 0xe2, 0x1f, 0x6e, 0x72, 0x7f, 0xb3, 0xe9, 0xeb, 0x00, 0xaa, 0xfa, 0xd7, 0x14, 0xe5,
-	0x80, 0x48, 0x3e, 0x10, 0x71, 0x46, 0x0e, 0x5f, 0x31, 0xca, 0x11, 0xd4, 0x28, 0x07, 0xd4, 0x8c, 0x27, 0xbe, 0x6a,
-	0x94, 0x03, 0x64, 0x87, 0x0d, 0x5f, 0xbb, 0x28, 0x87, 0x0b, 0xca, 0x6a, 0xe3, 0x67, 0xac, 0xf1, 0x32, 0xd6, 0x50,
-	0x16, 0x1a, 0x7f, 0x48, 0xf3, 0x55, 0xa3, 0x1c, 0x20, 0x33, 0xfe, 0xfa, 0x9a, 0xa2, 0x3c, 0x21, 0xe6, 0x18, 0xb0,
-	0x8f, 0xdb, 0x22, 0x78, 0x87, 0x80, 0x0b, 0xa4, 0x57, 0xd4, 0xc2, 0x11, 0xe0, 0x02, 0xef, 0x78, 0xc6, 0x3b, 0x00,
-	0xec, 0x93, 0x64, 0x13, 0xf7, 0x00, 0xb0, 0xcb, 0x36, 0x25, 0xfc, 0x9c, 0x35, 0x7c, 0xdf, 0x16, 0x8e, 0xf7, 0xfa,
-	0xfc, 0xb9, 0xf2, 0x94, 0x9c, 0xef, 0x9e, 0xed, 0xf5, 0x59, 0x1b, 0x12, 0xde, 0xd1, 0xde, 0x48, 0xde, 0xf7, 0xd3,
-	0xa4, 0x7a, 0x61, 0x84, 0xe0, 0xde, 0x4c, 0x8a, 0x2a, 0x0c, 0x73, 0xa1, 0x0a, 0x9a, 0xaf, 0x18, 0xdf, 0xd3, 0xcc,
-	0xa7, 0x12, 0xf6, 0x2b, 0xc6, 0xf7, 0x30, 0xcf, 0xa9, 0x50, 0xfe, 0x15, 0xe3, 0xfb, 0xfe, 0x50, 0x6a, 0x95, 0x2e,
-	0x62, 0x66, 0x15, 0x81, 0x5c, 0x09, 0xb8, 0xc3, 0x02, 0xee, 0xa8, 0x80, 0xf6, 0xa3, 0x1e, 0x0a, 0x73, 0x01, 0x77,
-	0x54, 0x40, 0xfe, 0x84, 0x87, 0x12, 0xb6, 0x80, 0x3b, 0x2e, 0xe0, 0xce, 0x16, 0x30, 0x9b, 0x3f, 0xdb, 0x61, 0x69,
-	0x77, 0x54, 0xda, 0x9d, 0x5b, 0x5a, 0x5d, 0xbf, 0x1d, 0xe6, 0x88, 0x2d, 0xb7, 0xb7, 0x7a, 0x6b, 0x38, 0xc7, 0x02,
-	0x66, 0xed, 0xd6, 0xc0, 0x05, 0x5b, 0xd8, 0x95, 0x5b, 0x83, 0x93, 0x55, 0xf2, 0x75, 0xdb, 0x1c, 0x45, 0xfb, 0xa4,
-	0x01, 0xb3, 0x29, 0x3d, 0x59, 0x8a, 0x06, 0xcc, 0x89, 0xd1, 0x4f, 0xc0, 0x0c, 0x73, 0xc4, 0x9a, 0xcb, 0xfb, 0x00,
-	0x8c, 0xe1, 0x1c, 0x73, 0x99, 0xcf, 0xbf, 0x18, 0xb8, 0x60, 0x2e, 0xf3, 0xf1, 0x17, 0x8b, 0x93, 0xb9, 0xf2, 0x6f,
-	0xbf, 0xe4, 0x28, 0x9a, 0x4b, 0xbf, 0xfc, 0x92, 0x97, 0x9e, 0xcc, 0x45, 0x23, 0x77, 0x65, 0xcc, 0x81, 0xfa, 0xa1,
-	0x87, 0x93, 0xe9, 0x8a, 0xc7, 0xe9, 0xdd, 0x14, 0x9e, 0x19, 0xbd, 0xc3, 0xf4, 0x2e, 0x59, 0x32, 0xa9, 0x77, 0x94,
-	0xde, 0x67, 0xd9, 0xbc, 0xce, 0x49, 0x7a, 0x8f, 0xcb, 0x4c, 0x6d, 0xce, 0xd1, 0x7b, 0xf6, 0x63, 0xb3, 0xfb, 0xa7,
-	0xe8, 0x13, 0x1f, 0x94, 0x1b, 0xcd, 0x2e, 0x88, 0x35, 0xb8, 0xc0, 0xae, 0xa9, 0x85, 0x73, 0x8c, 0x2c, 0x8c, 0x35,
-	0xaf, 0xc0, 0x05, 0xc3, 0x0a, 0x4b, 0x26, 0x15, 0x9c, 0x8c, 0x29, 0xb8, 0x31, 0x23, 0xcd, 0x80, 0xef, 0xd2, 0x7c,
-	0xb7, 0x29, 0x3d, 0x19, 0x8d, 0xe6, 0xbb, 0x23, 0xd3, 0xd8, 0x29, 0xee, 0x86, 0x66, 0xa6, 0x9b, 0xee, 0x95, 0x9a,
-	0xfe, 0x09, 0x2f, 0x60, 0x74, 0xd2, 0x60, 0x67, 0xb6, 0xa1, 0xce, 0x6c, 0xe3, 0x75, 0x66, 0x9b, 0x6c, 0xbe, 0x70,
-	0x9a, 0xa3, 0x94, 0x8f, 0x24, 0x6d, 0xe9, 0xfd, 0x69, 0xbe, 0xd0, 0x20, 0xcf, 0xf4, 0x8a, 0x13, 0x23, 0x36, 0x83,
-	0xc5, 0x85, 0xb7, 0x86, 0x67, 0xe2, 0xa6, 0x0e, 0x45, 0xf9, 0xcd, 0x67, 0xe2, 0x52, 0x16, 0xf3, 0x99, 0x38, 0x0f,
-	0x7e, 0xf6, 0xdf, 0x7d, 0x2a, 0xc0, 0xb6, 0x20, 0xe7, 0xd7, 0xd7, 0xb4, 0xdb, 0x65, 0xcb, 0x42, 0x33, 0x71, 0xcc,
-	0x60, 0x39, 0x70, 0x26, 0x8e, 0xc1, 0x67, 0xef, 0x8d, 0x27, 0x17, 0xb4, 0xf9, 0x3f, 0xb7, 0x4e, 0xd7, 0xb8, 0x47,
-	0xb7, 0x1b, 0xff, 0xe8, 0x76, 0x93, 0xe6, 0xb0, 0x52, 0xfe, 0xd2, 0x1c, 0x96, 0x41, 0x9e, 0xe9, 0x15, 0x27, 0x46,
-	0x6c, 0x46, 0x8b, 0xcb, 0x7c, 0xcd, 0xb9, 0x33, 0xd0, 0xcd, 0xd9, 0x33, 0xd0, 0x39, 0x8b, 0x59, 0xcf, 0x88, 0xa7,
-	0x12, 0xf1, 0x5c, 0xca, 0xc5, 0xa9, 0x48, 0xd8, 0x62, 0xe5, 0xac, 0x53, 0x3a, 0xff, 0xc8, 0x72, 0x63, 0x66, 0xe8,
-	0x2c, 0x8e, 0x65, 0xd1, 0x19, 0x3a, 0x0b, 0x3d, 0xf3, 0x7b, 0x4e, 0x0e, 0x64, 0xf3, 0x5c, 0x5e, 0x06, 0x95, 0x7e,
-	0x7e, 0x9b, 0xd1, 0xaa, 0xca, 0x11, 0x79, 0x86, 0x85, 0xe3, 0xe1, 0x32, 0x03, 0x67, 0x27, 0xcc, 0x0c, 0xa7, 0x6f,
-	0xb5, 0x4c, 0x3c, 0x6b, 0x66, 0xe0, 0x74, 0xe0, 0xcc, 0xe0, 0xe9, 0xd4, 0x99, 0xc1, 0xe5, 0xe8, 0x99, 0x41, 0xe3,
-	0xf9, 0xb3, 0x1c, 0xbe, 0x26, 0xe4, 0x86, 0x11, 0xbf, 0xec, 0xb2, 0xe6, 0xc5, 0xb0, 0xac, 0x60, 0x11, 0x11, 0x22,
-	0x60, 0x99, 0xa3, 0xb7, 0x94, 0xee, 0xb6, 0x2d, 0xed, 0xfa, 0x81, 0x60, 0xce, 0x40, 0xed, 0xe7, 0xab, 0xf6, 0xf3,
-	0x55, 0x9f, 0xf1, 0x49, 0x5d, 0xf4, 0x49, 0xf6, 0xeb, 0x3c, 0x86, 0xf2, 0xdd, 0x55, 0x17, 0xdc, 0x55, 0x17, 0xdc,
-	0x75, 0x47, 0x08, 0x3b, 0xef, 0xb3, 0x1f, 0x66, 0xd9, 0xac, 0x91, 0x25, 0xbf, 0x10, 0xb2, 0x61, 0xc4, 0xb7, 0xe0,
-	0xe6, 0x8c, 0xa9, 0x36, 0x45, 0x53, 0x6d, 0x7c, 0x7b, 0x6c, 0x0a, 0xf6, 0xd8, 0x14, 0xec, 0xf1, 0xdf, 0x84, 0x70,
-	0x9a, 0xaf, 0xe7, 0x0a, 0xbe, 0x65, 0xc4, 0x2f, 0xe6, 0xf6, 0xec, 0x53, 0xe2, 0xef, 0x17, 0xe5, 0xf0, 0x3d, 0x21,
-	0x5c, 0xb2, 0x9d, 0xff, 0xba, 0x9d, 0x1f, 0x97, 0xbb, 0x73, 0xb9, 0xd8, 0xf9, 0xb5, 0xb6, 0x61, 0xc4, 0x7f, 0x67,
-	0x73, 0xc6, 0x93, 0x4d, 0xd1, 0x93, 0x8d, 0xef, 0x49, 0xfb, 0xf3, 0x4f, 0x86, 0x2d, 0xf8, 0xb9, 0xf1, 0x0d, 0xd9,
-	0xf8, 0x25, 0xfb, 0xc6, 0x88, 0xb4, 0x10, 0x46, 0x37, 0xfe, 0x43, 0x09, 0xf7, 0x8c, 0xf8, 0x46, 0xd9, 0xfb, 0x8e,
-	0xd8, 0x9f, 0x73, 0x04, 0x1b, 0xe9, 0xe0, 0x3f, 0xfc, 0xe0, 0x3f, 0xfc, 0x50, 0x52, 0xc5, 0xc3, 0xb9, 0xb7, 0x3a,
-	0xc8, 0xb9, 0xe4, 0x47, 0x46, 0xfc, 0x4c, 0x1e, 0xcf, 0x84, 0xc5, 0xb1, 0x18, 0x16, 0x47, 0x3f, 0x2c, 0x8e, 0x67,
-	0xc3, 0xe2, 0x58, 0x08, 0x8b, 0x63, 0xa1, 0xfa, 0x1f, 0xdd, 0xd6, 0xeb, 0x51, 0xf7, 0x90, 0x0a, 0xf2, 0x44, 0x08,
-	0xec, 0x97, 0x16, 0xe4, 0x44, 0x69, 0x62, 0x57, 0xc0, 0xc2, 0x5a, 0x66, 0xc3, 0x7c, 0xa7, 0xac, 0x7c, 0xf7, 0x4d,
-	0xfa, 0xdd, 0xf7, 0xfb, 0x77, 0xaf, 0xfd, 0x70, 0x7f, 0x09, 0xb0, 0xf1, 0x7f, 0x09, 0xb0, 0x49, 0x03, 0xb9, 0x51,
-	0x7e, 0xfb, 0x13, 0x21, 0xd8, 0x1b, 0xa2, 0xcd, 0x4d, 0x8d, 0xbf, 0xb9, 0xa9, 0x29, 0x6e, 0x6e, 0xfa, 0x96, 0x96,
-	0xd1, 0xaa, 0x08, 0xa4, 0xa5, 0x9d, 0x84, 0x9c, 0x30, 0xbd, 0x7d, 0xf6, 0x37, 0xf7, 0xb1, 0xe1, 0x19, 0xa5, 0xdd,
-	0x2a, 0x48, 0x17, 0x38, 0xd9, 0xfd, 0x12, 0xd7, 0x91, 0xf2, 0x27, 0x09, 0x39, 0x45, 0x72, 0x5b, 0xdf, 0x3d, 0xc0,
-	0x5f, 0x2f, 0xaa, 0x39, 0x90, 0xe1, 0xb6, 0x5b, 0xdd, 0x4d, 0x83, 0x68, 0xec, 0x89, 0x30, 0x85, 0x19, 0x74, 0x9e,
-	0xb7, 0x77, 0x6f, 0x4a, 0x7a, 0xe4, 0x50, 0x31, 0x7c, 0x3c, 0x2a, 0xab, 0xf2, 0x9c, 0xe0, 0xe0, 0xa3, 0xe5, 0x97,
-	0x1d, 0xca, 0x2f, 0x03, 0x9d, 0xf2, 0xc8, 0x1f, 0xe5, 0x24, 0x58, 0x3f, 0xd6, 0xa1, 0x7d, 0x7f, 0x0e, 0x40, 0x2f,
-	0xcc, 0xa4, 0xca, 0x3e, 0x75, 0x9f, 0x01, 0xf1, 0x66, 0x58, 0xf6, 0xd9, 0x26, 0x7f, 0x05, 0xcd, 0xbc, 0xca, 0x5e,
-	0xbb, 0xca, 0x00, 0xd9, 0xf9, 0x92, 0x7d, 0xda, 0xc1, 0xaf, 0x40, 0xdc, 0x28, 0x9d, 0x90, 0xb0, 0xcf, 0x6a, 0x02,
-	0xd7, 0x7d, 0x55, 0xa8, 0x12, 0xb0, 0x19, 0xc4, 0xca, 0xb7, 0x8f, 0xbd, 0x28, 0x00, 0xa0, 0x10, 0x80, 0xa6, 0x32,
-	0x00, 0x16, 0x8a, 0x00, 0x80, 0x94, 0x00, 0x10, 0x29, 0x80, 0x22, 0xd9, 0xdf, 0xe8, 0x12, 0x85, 0xb7, 0xf8, 0xb7,
-	0xcd, 0xde, 0xb6, 0x70, 0x4f, 0x50, 0x2c, 0x05, 0xee, 0x07, 0xe3, 0xf4, 0xf7, 0x0e, 0xff, 0x0e, 0x0f, 0x04, 0x20,
-	0xc4, 0x13, 0x02, 0xf0, 0x06, 0x80, 0x83, 0x9d, 0x15, 0xf8, 0x06, 0x26, 0x8e, 0xe2, 0xa2, 0x36, 0xd6, 0x9d, 0xe8,
-	0x9a, 0xea, 0x61, 0x30, 0xd5, 0xbf, 0xf1, 0x2d, 0x0a, 0x1f, 0xa1, 0x08, 0x47, 0x5b, 0xf6, 0xa3, 0xeb, 0x9a, 0xa3,
-	0xe3, 0x9a, 0xa3, 0x75, 0x4d, 0xde, 0xce, 0x01, 0x4e, 0x2e, 0x3b, 0x92, 0xcb, 0x42, 0xab, 0xa6, 0xd7, 0x8f, 0x50,
-	0xa4, 0x13, 0xfe, 0x1d, 0xf2, 0x0b, 0x40, 0xca, 0x59, 0xc2, 0x42, 0x12, 0xac, 0x59, 0x82, 0xd8, 0xea, 0x25, 0xb0,
-	0xad, 0x63, 0x02, 0xbb, 0x15, 0x4d, 0x38, 0xa7, 0xb6, 0x09, 0x63, 0xab, 0x9c, 0xc0, 0x54, 0xef, 0x04, 0xa7, 0xca,
-	0x27, 0xb8, 0xa9, 0x81, 0x82, 0xda, 0x6a, 0x18, 0x27, 0xfc, 0xb2, 0x10, 0xc8, 0x66, 0x01, 0xab, 0x1c, 0x85, 0x5a,
-	0x29, 0x80, 0xf1, 0xbf, 0xa0, 0x5e, 0x10, 0x08, 0xc5, 0x91, 0x20, 0x84, 0x09, 0x07, 0x41, 0xad, 0xef, 0x05, 0xb6,
-	0x01, 0x10, 0x77, 0x9d, 0x5a, 0xc0, 0xad, 0x89, 0x81, 0xdb, 0x12, 0xe0, 0x96, 0xc5, 0xaf, 0xcc, 0xc2, 0x99, 0x1a,
-	0x1d, 0x50, 0xa8, 0xd6, 0x01, 0xd8, 0x11, 0x60, 0x2a, 0xb8, 0xa0, 0xa6, 0x96, 0x47, 0xd4, 0xab, 0xea, 0xc2, 0x99,
-	0xfa, 0x2e, 0x53, 0xb5, 0xd6, 0x97, 0x54, 0xf3, 0x03, 0xec, 0x54, 0xff, 0x40, 0x40, 0x65, 0x17, 0xc0, 0x15, 0x82,
-	0xb8, 0x6c, 0x67, 0x8a, 0x6f, 0x25, 0x81, 0x17, 0xed, 0x2c, 0x55, 0x0a, 0x09, 0xab, 0x10, 0xde, 0x8a, 0x9d, 0x25,
-	0xfd, 0x78, 0x21, 0xc1, 0xc0, 0xe5, 0x3a, 0x03, 0x3e, 0x5a, 0x73, 0x9c, 0x08, 0x30, 0x22, 0x62, 0xe7, 0xaa, 0x13,
-	0xa1, 0xbf, 0x9a, 0x62, 0x10, 0xab, 0x24, 0xf9, 0x6f, 0xa6, 0x58, 0xd8, 0x55, 0x12, 0xfe, 0xc9, 0x14, 0xc3, 0x58,
-	0x25, 0x31, 0x3f, 0x98, 0x62, 0x71, 0x52, 0x92, 0xfc, 0xf7, 0x52, 0x0c, 0x6a, 0x95, 0x04, 0x7f, 0x2e, 0x65, 0x62,
-	0xc1, 0x5c, 0x49, 0x02, 0x0a, 0x4a, 0x22, 0x80, 0x09, 0x1b, 0x41, 0xbd, 0xb0, 0x11, 0x8a, 0xc3, 0x46, 0x08, 0x13,
-	0x36, 0x82, 0xda, 0xc8, 0x10, 0xd8, 0x46, 0x46, 0xdc, 0x7a, 0x6e, 0x01, 0x57, 0x06, 0x02, 0xb7, 0x25, 0xc0, 0x2d,
-	0x8b, 0xaf, 0x24, 0xc2, 0x19, 0x25, 0x09, 0x28, 0x28, 0x49, 0x00, 0x76, 0x04, 0x18, 0x25, 0x11, 0xd4, 0x28, 0x49,
-	0x44, 0x3d, 0x25, 0x11, 0xce, 0x28, 0x89, 0x6c, 0xbf, 0xb6, 0xbe, 0x24, 0x25, 0xb1, 0x3f, 0x54, 0x62, 0xd2, 0x83,
-	0x5a, 0x08, 0xe0, 0x2a, 0x49, 0x5c, 0xd1, 0x36, 0xc5, 0xb7, 0x4a, 0xc2, 0xeb, 0xd9, 0x96, 0x2a, 0x85, 0x84, 0x55,
-	0x12, 0x6f, 0x31, 0xdb, 0x92, 0x7e, 0xbc, 0x90, 0x92, 0xe0, 0x4a, 0xb6, 0x01, 0x1f, 0xad, 0x39, 0x4e, 0x04, 0x18,
-	0x25, 0xb1, 0xab, 0xd8, 0x4a, 0x80, 0xd9, 0x32, 0x3d, 0x41, 0x9c, 0x54, 0x05, 0x49, 0xd2, 0x16, 0x24, 0x7d, 0x85,
-	0xc1, 0x14, 0x9e, 0xce, 0x20, 0x4f, 0x6a, 0x83, 0x24, 0x6b, 0x0e, 0xb2, 0xac, 0x3c, 0xc8, 0x5a, 0xfd, 0x41, 0x8e,
-	0x54, 0x08, 0x48, 0x1b, 0x8f, 0x19, 0x65, 0x14, 0x09, 0x38, 0xd4, 0x25, 0x84, 0x6d, 0x28, 0x22, 0xe7, 0x06, 0x24,
-	0x26, 0x70, 0xc2, 0x12, 0x69, 0x1b, 0x9c, 0xc8, 0x51, 0x14, 0x22, 0x49, 0xb1, 0x08, 0x64, 0x09, 0xf6, 0x45, 0x08,
-	0xc0, 0x6d, 0x01, 0x3e, 0x63, 0x81, 0x82, 0xb2, 0x61, 0x0a, 0xab, 0x6f, 0xc0, 0xa1, 0xca, 0x01, 0xbc, 0x2b, 0xc0,
-	0x56, 0xf1, 0x90, 0xb3, 0xba, 0x97, 0x71, 0xae, 0xfa, 0x61, 0x0a, 0xab, 0x81, 0xc0, 0x7d, 0xf3, 0x23, 0x89, 0xf5,
-	0x10, 0x48, 0x4f, 0x15, 0x81, 0x46, 0xfd, 0x43, 0xd8, 0x57, 0xc8, 0x6c, 0x13, 0x8b, 0x6b, 0x46, 0x52, 0xcb, 0xc2,
-	0x16, 0x16, 0x3f, 0xc1, 0xf9, 0x10, 0x25, 0xfd, 0x2c, 0xee, 0x5f, 0xf1, 0x93, 0x9c, 0x8b, 0x62, 0x56, 0x54, 0xda,
-	0xbc, 0xe2, 0x52, 0x8f, 0xbe, 0x59, 0x4f, 0x05, 0xd8, 0x2a, 0xad, 0xbb, 0x71, 0x25, 0xd2, 0x74, 0x30, 0x86, 0x0f,
-	0xc4, 0xf4, 0x2b, 0xed, 0x29, 0x7d, 0x36, 0x68, 0x4a, 0x49, 0xf2, 0xee, 0xb7, 0x81, 0xf1, 0x76, 0xf7, 0x0c, 0xd4,
-	0xc1, 0x3f, 0x03, 0x75, 0x48, 0x27, 0x9e, 0xf4, 0x76, 0xff, 0xfc, 0xdb, 0xc1, 0xfe, 0x1a, 0x2e, 0x11, 0xd9, 0x43,
-	0x58, 0x21, 0x35, 0xbd, 0x13, 0xf3, 0x2e, 0x89, 0x0f, 0x4c, 0xe1, 0x6f, 0x8e, 0xd3, 0x85, 0xcb, 0x4b, 0x02, 0xcc,
-	0xa4, 0x59, 0x44, 0xbd, 0x29, 0xb1, 0xc0, 0x5d, 0x59, 0x60, 0xa5, 0x13, 0x93, 0x01, 0xf8, 0x34, 0x78, 0xb1, 0xcc,
-	0x01, 0x69, 0x23, 0x0d, 0xaa, 0xad, 0x5b, 0x4e, 0xc4, 0xb9, 0xcf, 0x30, 0xaf, 0x39, 0x61, 0x2e, 0x10, 0x71, 0xaa,
-	0xf4, 0xb1, 0x6b, 0x9b, 0xa3, 0x7e, 0x3c, 0xa6, 0x06, 0x19, 0x10, 0x69, 0x85, 0x01, 0xc9, 0x76, 0xe6, 0x2a, 0x0c,
-	0xdb, 0x71, 0x15, 0x8c, 0x7b, 0x70, 0x15, 0x49, 0x9b, 0x6a, 0x15, 0x4a, 0xbb, 0x87, 0x15, 0x92, 0xf3, 0xa2, 0x0a,
-	0xc4, 0x0d, 0xb5, 0x09, 0x11, 0x87, 0x2f, 0x52, 0x41, 0x32, 0xb6, 0xa6, 0x82, 0xa4, 0xed, 0xd5, 0x80, 0xb8, 0x05,
-	0xa9, 0xbd, 0x82, 0x64, 0xbb, 0xa7, 0x15, 0xa5, 0xe2, 0xd5, 0x5c, 0xbc, 0x9a, 0x8b, 0xd7, 0x64, 0x17, 0x94, 0xd5,
-	0xc6, 0xcf, 0x58, 0xe3, 0x65, 0xac, 0xa1, 0x2c, 0xd8, 0xad, 0xcd, 0x4a, 0x70, 0xde, 0xd2, 0x26, 0x66, 0x45, 0xc8,
-	0xd0, 0xf6, 0xa3, 0x9d, 0x4f, 0x03, 0xa8, 0x67, 0x4f, 0xda, 0x87, 0x53, 0x24, 0x76, 0xdc, 0x14, 0xc9, 0x7a, 0x6b,
-	0x0a, 0xf3, 0x7e, 0xb2, 0x27, 0xed, 0x97, 0x29, 0x92, 0x3a, 0x63, 0x0a, 0xa5, 0x1e, 0x98, 0x42, 0xd2, 0xed, 0x52,
-	0x20, 0xf6, 0xb5, 0x12, 0x22, 0x21, 0x33, 0x4b, 0x05, 0x81, 0x9e, 0xd8, 0x93, 0x7e, 0x48, 0x45, 0x11, 0x73, 0x24,
-	0xe3, 0xc9, 0x7c, 0x36, 0x45, 0x61, 0xee, 0x6b, 0x3e, 0xe5, 0x1f, 0x49, 0x51, 0xd4, 0x74, 0x3b, 0x9f, 0x34, 0x64,
-	0x00, 0xb2, 0x1d, 0xcc, 0xa7, 0xfe, 0xe3, 0x24, 0x7a, 0x41, 0x59, 0x6d, 0xfc, 0x8c, 0x35, 0x5e, 0xc6, 0x1a, 0xca,
-	0x82, 0xfd, 0xde, 0x88, 0x12, 0x9c, 0xb7, 0xf4, 0x75, 0x11, 0x45, 0x4c, 0xa7, 0xf6, 0x29, 0x85, 0x4c, 0xb4, 0xf4,
-	0x33, 0x1e, 0xad, 0x7a, 0xa6, 0xa3, 0x55, 0xcf, 0x74, 0xb4, 0xea, 0xd9, 0x3f, 0x5a, 0xf5, 0xec, 0x1d, 0xad, 0x7a,
-	0x76, 0x8f, 0x56, 0x3d, 0xd3, 0xd1, 0xaa, 0x67, 0x3e, 0x5a, 0xf5, 0xcc, 0x47, 0xab, 0x4e, 0x03, 0xf8, 0x9d, 0xf5,
-	0x93, 0x0a, 0xa2, 0x22, 0x51, 0x10, 0x15, 0xf1, 0x8e, 0x2a, 0x9c, 0x32, 0x41, 0x54, 0xd0, 0x1c, 0x4a, 0x38, 0x81,
-	0x20, 0x2a, 0x64, 0x8f, 0x53, 0x9c, 0x92, 0x20, 0x2a, 0x60, 0x4e, 0x18, 0x9c, 0x52, 0x0b, 0x38, 0x4c, 0x48, 0x46,
-	0xdb, 0xb3, 0x27, 0x27, 0x3a, 0x70, 0x72, 0xf2, 0x4f, 0x99, 0x9c, 0xbc, 0xa3, 0x25, 0x27, 0xf7, 0x3c, 0xc9, 0x89,
-	0x0e, 0x91, 0x9c, 0xf8, 0xe4, 0xc8, 0x89, 0x8f, 0x8b, 0x9c, 0xf0, 0x8c, 0xc8, 0x89, 0x0e, 0x86, 0x9c, 0xfc, 0xd3,
-	0x20, 0x27, 0xef, 0x08, 0xc8, 0x89, 0xce, 0x7d, 0x9c, 0x4a, 0x87, 0x3d, 0x4e, 0x7c, 0xc2, 0xe3, 0x44, 0xc7, 0x3a,
-	0x4e, 0x74, 0x96, 0xe3, 0xa4, 0xfd, 0x89, 0x64, 0xea, 0x34, 0x01, 0x3f, 0x36, 0x88, 0x2d, 0x49, 0x3e, 0x01, 0x6f,
-	0x61, 0xb7, 0x94, 0x34, 0x01, 0x6f, 0x19, 0x5b, 0x5e, 0x33, 0x01, 0x6f, 0x71, 0x32, 0x7e, 0x36, 0x01, 0x6f, 0x51,
-	0x5b, 0xf8, 0xbc, 0xdb, 0x68, 0x0c, 0xc0, 0x09, 0x29, 0xea, 0x04, 0xb6, 0xa1, 0x17, 0xe1, 0xb2, 0x01, 0xbc, 0x20,
-	0x8c, 0x8c, 0x13, 0x89, 0x42, 0xf9, 0xb6, 0xe1, 0x98, 0x14, 0xbc, 0x60, 0x9b, 0x86, 0x11, 0xbf, 0x5c, 0x7e, 0x9c,
-	0x0a, 0x57, 0x2c, 0x00, 0x45, 0xac, 0xc0, 0x85, 0xb0, 0x15, 0xb6, 0x50, 0x06, 0x0a, 0x60, 0x81, 0x7d, 0x47, 0x72,
-	0x28, 0xa7, 0x5c, 0x62, 0x34, 0x2b, 0x68, 0xcb, 0xad, 0x8c, 0x8d, 0x69, 0x65, 0x5c, 0xa3, 0x28, 0xed, 0xd8, 0x45,
-	0x49, 0x6b, 0x1a, 0x65, 0xa8, 0xfc, 0x4a, 0x91, 0x1b, 0x95, 0x32, 0x51, 0xae, 0x84, 0xb5, 0x0f, 0x7d, 0x70, 0x80,
-	0x2d, 0xe4, 0x26, 0xa7, 0x88, 0x57, 0xc6, 0x06, 0x3d, 0x30, 0x67, 0x2d, 0xe4, 0x85, 0x3e, 0x90, 0x4e, 0xf4, 0x2b,
-	0x5b, 0xb4, 0x1f, 0xd7, 0x01, 0xa5, 0xca, 0xf6, 0x6b, 0x5c, 0xb0, 0x58, 0x64, 0xbf, 0x3e, 0x28, 0x7d, 0xae, 0x60,
-	0x54, 0x2b, 0x94, 0x29, 0x54, 0x0c, 0x4d, 0x50, 0x2e, 0x1b, 0x55, 0x0f, 0x65, 0x8a, 0x11, 0x40, 0x95, 0xe4, 0xfb,
-	0x00, 0xfa, 0x95, 0xdf, 0xb5, 0xe7, 0xa8, 0x48, 0xec, 0x39, 0x02, 0xe2, 0x74, 0x81, 0xbf, 0x67, 0x3d, 0x47, 0x00,
-	0xa1, 0xe7, 0xa8, 0xa8, 0xe9, 0x18, 0x7f, 0x87, 0x9e, 0xa3, 0x42, 0xb6, 0x63, 0xfc, 0xbd, 0xef, 0x39, 0xea, 0x05,
-	0x65, 0xb5, 0xf1, 0x33, 0xd6, 0x78, 0x19, 0x6b, 0x28, 0x0b, 0xb6, 0xe7, 0xa8, 0x04, 0xe7, 0x2d, 0xf5, 0x1c, 0x15,
-	0x31, 0x5d, 0xf4, 0xef, 0xa9, 0x19, 0xb1, 0x88, 0xcd, 0x76, 0xde, 0x8c, 0x10, 0xec, 0x15, 0x89, 0x9a, 0x11, 0x62,
-	0x1c, 0xab, 0xe7, 0xcd, 0x88, 0x85, 0xa9, 0x8c, 0xa6, 0x19, 0x31, 0x78, 0xc3, 0x88, 0x5f, 0x2e, 0xdf, 0x27, 0xd4,
-	0x8c, 0x58, 0xc6, 0xcf, 0x65, 0xc9, 0x45, 0xa6, 0x19, 0xb1, 0xb8, 0x75, 0x56, 0xde, 0x8c, 0x24, 0x38, 0x78, 0xc0,
-	0x41, 0x6c, 0xc9, 0x04, 0xb6, 0x1e, 0x8b, 0xb0, 0x57, 0x60, 0xe1, 0x9c, 0x02, 0x47, 0xc6, 0xf1, 0x98, 0x50, 0xd6,
-	0x16, 0x02, 0x53, 0x69, 0x05, 0x27, 0x8f, 0x05, 0xbc, 0x61, 0xc4, 0x2f, 0x97, 0xef, 0x31, 0xe1, 0x8a, 0x05, 0x20,
-	0x8f, 0x09, 0x5c, 0xf0, 0x98, 0xb0, 0x85, 0x32, 0x90, 0xc7, 0x04, 0xb6, 0x1e, 0x53, 0xa3, 0x15, 0x50, 0x5b, 0x42,
-	0xa0, 0xac, 0xf7, 0x90, 0xf2, 0x0c, 0x00, 0xbc, 0x63, 0x04, 0x64, 0x1d, 0x4f, 0x02, 0x6d, 0xed, 0x04, 0x14, 0x59,
-	0x03, 0x38, 0xf2, 0xaa, 0x72, 0x8d, 0x8f, 0x96, 0xcb, 0xee, 0x7b, 0x18, 0xf8, 0xb3, 0x05, 0x24, 0x4f, 0x03, 0x55,
-	0xf0, 0x36, 0xa4, 0x38, 0x53, 0x46, 0xf2, 0x3a, 0x50, 0xe0, 0xf9, 0x5f, 0x77, 0xb7, 0x6f, 0xeb, 0xfd, 0xee, 0xdd,
-	0x7a, 0xb3, 0x3f, 0xa4, 0xab, 0x57, 0xeb, 0x87, 0x75, 0x7f, 0xf1, 0xba, 0xd9, 0x3d, 0xfc, 0x51, 0x3f, 0xec, 0x37,
-	0x37, 0x2d, 0xf9, 0x3f, 0x93, 0x17, 0xfe, 0x13 };
@@ -1,189 +0,0 @@
-// symbol.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_SYMBOL[] = { 0x78, 0x9c, 0xb5, 0x5a, 0x5d, 0xaf, 0xdc, 0x36, 0x0e, 0x7d, 0x0f, 0x90, 0xff, 0xe0,
-	0xc7, 0x5d, 0x60, 0x27, 0xb0, 0xbe, 0x2c, 0xb9, 0x7d, 0x4a, 0xd2, 0x74, 0x37, 0xd8, 0x4d, 0x1a, 0x34, 0x69, 0x53,
-	0xec, 0x9b, 0x67, 0x46, 0x77, 0xc6, 0x88, 0xc7, 0x9e, 0xda, 0x9e, 0x24, 0x37, 0xbf, 0x7e, 0x49, 0x89, 0x94, 0x65,
-	0xe7, 0xde, 0xbe, 0x2d, 0x0a, 0x0c, 0x26, 0x53, 0x52, 0xa4, 0xc8, 0xc3, 0x23, 0x52, 0xba, 0xef, 0xe7, 0x66, 0x9c,
-	0x7f, 0x1e, 0xfa, 0xf9, 0x8d, 0x9f, 0xc7, 0xf6, 0x30, 0x15, 0xfa, 0x99, 0x78, 0xfa, 0xe4, 0xe5, 0x70, 0xb9, 0xf8,
-	0x7e, 0x2e, 0x5e, 0x0e, 0xd7, 0xfb, 0xb1, 0x3d, 0x9d, 0xe7, 0xe2, 0x6f, 0x87, 0xbf, 0x17, 0xa2, 0x76, 0xe6, 0x1f,
-	0xf8, 0x69, 0xc3, 0x67, 0x8d, 0x9f, 0x75, 0x19, 0x3e, 0x6d, 0xf1, 0xfc, 0x38, 0xec, 0x7d, 0xf1, 0xfe, 0x7e, 0x9a,
-	0xfd, 0x65, 0x2a, 0x5e, 0xf7, 0x87, 0x61, 0xbc, 0x0e, 0x63, 0x33, 0xfb, 0xe3, 0xb3, 0xe2, 0x79, 0xd7, 0x15, 0x61,
-	0x99, 0xa9, 0x18, 0xfd, 0xe4, 0xc7, 0xcf, 0xf0, 0x63, 0x66, 0x64, 0xf4, 0xcd, 0xdc, 0x0e, 0x7d, 0xf1, 0x13, 0x48,
-	0xff, 0x50, 0x7c, 0x38, 0xdf, 0x8a, 0x37, 0xcd, 0x7d, 0x51, 0x88, 0x42, 0x98, 0x1f, 0x84, 0xfc, 0x41, 0x9a, 0x60,
-	0x61, 0x51, 0xf8, 0xad, 0x6f, 0xff, 0xbc, 0xf9, 0xd7, 0x3f, 0x15, 0x5a, 0x95, 0x95, 0x5e, 0x7e, 0xff, 0xfd, 0xcd,
-	0x6d, 0x6a, 0x4e, 0xbe, 0x50, 0xa5, 0x93, 0x65, 0xa1, 0xea, 0xa0, 0x84, 0x7b, 0x7b, 0xdb, 0x5c, 0xd0, 0xb5, 0xcb,
-	0x7e, 0xe8, 0xe0, 0x87, 0x5b, 0xd7, 0xad, 0x7f, 0x68, 0x2e, 0x6d, 0x77, 0xbf, 0xfa, 0xe9, 0xa3, 0x0f, 0x9b, 0x7e,
-	0xe3, 0x8f, 0xed, 0xed, 0xf2, 0xf4, 0xc9, 0xeb, 0xb9, 0xe9, 0xda, 0xc3, 0xf3, 0xfe, 0xd4, 0xf9, 0xa2, 0x84, 0x7f,
-	0x4e, 0x3f, 0xb7, 0x5f, 0xfd, 0xf1, 0x5d, 0x3b, 0x1f, 0xce, 0xc5, 0x5d, 0xd3, 0x4d, 0x1e, 0x7c, 0x38, 0x37, 0x63,
-	0x73, 0x98, 0xfd, 0xf8, 0xde, 0xcf, 0xc5, 0xfb, 0xab, 0x3f, 0xb4, 0x4d, 0x17, 0x8d, 0xbf, 0x78, 0x31, 0x7c, 0x2d,
-	0x76, 0xc2, 0x95, 0xc5, 0x4e, 0xd6, 0xaa, 0x10, 0x65, 0x5d, 0xc2, 0x87, 0x28, 0x8b, 0xa7, 0x4f, 0x7e, 0xeb, 0x8f,
-	0x7e, 0xec, 0xda, 0xde, 0xbf, 0x1b, 0xa6, 0x36, 0x84, 0x60, 0x27, 0xca, 0x32, 0xfb, 0xfd, 0xc3, 0xb9, 0x3d, 0x7c,
-	0xea, 0xfd, 0x34, 0x15, 0x06, 0x7e, 0xfe, 0xdd, 0x8f, 0x13, 0x0a, 0x95, 0xa5, 0x78, 0x56, 0x96, 0xee, 0xe9, 0x93,
-	0xb7, 0xc3, 0xdc, 0x1e, 0xfc, 0xff, 0x37, 0x4b, 0xaf, 0x40, 0xe6, 0xd8, 0xf6, 0xa7, 0xf7, 0x87, 0xb3, 0x87, 0x08,
-	0xe1, 0x8e, 0xc2, 0xf6, 0xee, 0xda, 0xc3, 0xd3, 0x27, 0xef, 0xe7, 0xe3, 0xbf, 0x3e, 0x16, 0xb5, 0x0c, 0xdf, 0x7e,
-	0xff, 0x58, 0x38, 0x83, 0xdf, 0x00, 0x51, 0x18, 0x0e, 0x46, 0x94, 0xa8, 0xc1, 0xf7, 0x97, 0x85, 0x92, 0xc5, 0x8f,
-	0xc5, 0xc7, 0x3f, 0x0a, 0x69, 0x4a, 0xf8, 0xf2, 0xb6, 0x98, 0xae, 0x0d, 0xf8, 0xfe, 0x63, 0xf1, 0xa2, 0x28, 0xe9,
-	0xbf, 0x1f, 0x83, 0x98, 0x8a, 0x62, 0x2a, 0x7c, 0x79, 0x5b, 0xf8, 0xaf, 0x87, 0xae, 0xb9, 0x04, 0x39, 0x21, 0x1d,
-	0x04, 0xc8, 0x16, 0x52, 0x97, 0x45, 0x65, 0x25, 0xc9, 0xeb, 0x28, 0x6f, 0x45, 0x94, 0xbf, 0xf5, 0xed, 0x67, 0x88,
-	0x53, 0xd3, 0x05, 0x15, 0x25, 0x60, 0xdd, 0xca, 0x89, 0xc2, 0x96, 0x86, 0xe4, 0x4d, 0x94, 0x37, 0x65, 0x74, 0xa3,
-	0xbf, 0x5d, 0xf6, 0x18, 0xd7, 0x53, 0x1f, 0x14, 0x00, 0x38, 0x3b, 0x51, 0x15, 0x1a, 0x54, 0x2a, 0xab, 0x48, 0xa5,
-	0x22, 0x15, 0x5d, 0x93, 0x4b, 0x2d, 0xc4, 0xaf, 0x9f, 0x5b, 0x32, 0x02, 0x00, 0x2d, 0x0b, 0x6d, 0x1d, 0x18, 0xb1,
-	0xa4, 0x61, 0xa3, 0x86, 0xa3, 0x4d, 0x5c, 0xfd, 0x78, 0x40, 0x84, 0xa2, 0x74, 0xa5, 0x8a, 0x1d, 0xac, 0x68, 0x2d,
-	0x58, 0x30, 0xec, 0x94, 0xa3, 0x4d, 0x58, 0x17, 0xe4, 0x9b, 0xcb, 0x15, 0xf7, 0xd0, 0x1f, 0x83, 0x86, 0x16, 0x88,
-	0x9f, 0xc2, 0x42, 0xe0, 0xaa, 0x4a, 0x90, 0x46, 0x1d, 0x35, 0xb4, 0x8a, 0x3e, 0x4d, 0xb7, 0xc3, 0x79, 0x3e, 0x37,
-	0xd1, 0x84, 0x8e, 0x71, 0xd2, 0x42, 0xc7, 0x6d, 0xa2, 0x82, 0x2e, 0xd7, 0x71, 0xbd, 0x36, 0xa3, 0xef, 0x3b, 0x7f,
-	0x17, 0x35, 0x0c, 0x38, 0x25, 0x6a, 0x01, 0xa5, 0x53, 0x2e, 0xfb, 0x06, 0xbb, 0xdf, 0xab, 0x44, 0xa0, 0x85, 0xd8,
-	0x96, 0x51, 0x47, 0x5a, 0x9b, 0xe9, 0xc8, 0x75, 0x78, 0x1b, 0x88, 0xd4, 0xd8, 0x4e, 0x9f, 0x2e, 0xcd, 0x7c, 0x8e,
-	0xdb, 0x87, 0x6a, 0x86, 0x9c, 0x69, 0x69, 0x0b, 0x63, 0x68, 0x33, 0x5a, 0xad, 0x03, 0x7c, 0xed, 0x6e, 0x53, 0xcc,
-	0x38, 0xc2, 0xc2, 0xc0, 0x16, 0x8d, 0xe2, 0xf5, 0xf5, 0x1a, 0x45, 0x07, 0xa8, 0xfd, 0x26, 0x6e, 0xa1, 0x02, 0x77,
-	0x8c, 0x04, 0xb8, 0x69, 0xd0, 0xd3, 0x24, 0x6e, 0xd6, 0x2b, 0x5f, 0xda, 0x9e, 0x97, 0x06, 0xc7, 0x61, 0x51, 0x03,
-	0x78, 0x90, 0xce, 0x91, 0x74, 0xb5, 0x5e, 0x1c, 0x92, 0xd0, 0x0e, 0x31, 0x07, 0x55, 0x1d, 0x42, 0x2a, 0x00, 0x17,
-	0x35, 0x25, 0x4d, 0x53, 0x92, 0x25, 0x25, 0x6d, 0xea, 0x9a, 0xe9, 0x4c, 0x80, 0xc6, 0x7c, 0x49, 0xa3, 0x8b, 0x0a,
-	0x97, 0x0c, 0xc2, 0x6e, 0x1d, 0x97, 0x6f, 0x7e, 0x1c, 0x22, 0x78, 0x34, 0x08, 0x43, 0x3c, 0x6c, 0x05, 0x38, 0xe5,
-	0x95, 0xeb, 0xb5, 0xf0, 0xd0, 0x7b, 0xf2, 0xd9, 0x16, 0x48, 0x6c, 0x59, 0x8e, 0x4c, 0xb9, 0x16, 0x9d, 0xbf, 0x0c,
-	0x39, 0x26, 0xcd, 0xb2, 0xa8, 0x11, 0x1b, 0xc9, 0xf3, 0xe8, 0xe3, 0xb2, 0x5a, 0x45, 0x17, 0x54, 0x2e, 0xbd, 0xc9,
-	0xe3, 0xdd, 0x70, 0x1b, 0xa3, 0x0f, 0x61, 0x61, 0x08, 0xc7, 0x22, 0xaa, 0x36, 0xa2, 0x50, 0x80, 0x11, 0x20, 0x32,
-	0xae, 0x0b, 0x49, 0xa8, 0x6a, 0x82, 0xa1, 0xd1, 0x6b, 0xe1, 0xa9, 0xfd, 0x1a, 0x65, 0x29, 0x0c, 0x95, 0xcb, 0x16,
-	0xde, 0x94, 0xea, 0xe4, 0x3f, 0xfb, 0x7e, 0x09, 0x1a, 0x54, 0x29, 0x44, 0x75, 0x89, 0x44, 0xb5, 0x96, 0xf6, 0x09,
-	0xa8, 0x01, 0x19, 0xe4, 0x47, 0x5a, 0xdb, 0x6e, 0x68, 0xa0, 0xa5, 0x18, 0xab, 0x98, 0x3c, 0x6d, 0xf2, 0x1d, 0xba,
-	0x75, 0xa6, 0x0f, 0x43, 0x37, 0x44, 0x47, 0x9c, 0x88, 0xb0, 0x00, 0x62, 0xd7, 0x15, 0x6f, 0xb1, 0xde, 0xe0, 0xc2,
-	0x5f, 0xda, 0x4c, 0x43, 0x45, 0x98, 0x4a, 0x29, 0x16, 0x95, 0x8a, 0xb3, 0x48, 0x30, 0xed, 0x90, 0xf2, 0xc3, 0x46,
-	0x2b, 0x2c, 0x00, 0x09, 0x38, 0x95, 0xc4, 0x77, 0x95, 0x58, 0x8b, 0xfa, 0x3f, 0x6f, 0x44, 0x43, 0x80, 0x68, 0x01,
-	0x25, 0x6b, 0x80, 0x7c, 0x14, 0x87, 0xbb, 0x92, 0x6b, 0xe9, 0x13, 0x9e, 0xb5, 0x7e, 0x7c, 0x6c, 0x6d, 0xca, 0xa4,
-	0x0e, 0x55, 0xf6, 0xb6, 0x80, 0x53, 0x76, 0x0a, 0xc7, 0x12, 0x8a, 0xdb, 0x92, 0x48, 0x45, 0x42, 0x60, 0x08, 0xd5,
-	0x95, 0x5e, 0x2f, 0x7f, 0x18, 0xfa, 0xd3, 0x78, 0x63, 0xa6, 0x13, 0x22, 0x54, 0xaf, 0x0d, 0x38, 0x8c, 0xf2, 0x94,
-	0x51, 0x8b, 0x16, 0x41, 0xfe, 0x79, 0x77, 0x3d, 0xc7, 0xea, 0xd5, 0x81, 0xa7, 0xf5, 0x92, 0xce, 0x8a, 0xd2, 0x59,
-	0x55, 0x36, 0x88, 0xbe, 0xf0, 0x73, 0x94, 0x94, 0x35, 0xae, 0x5a, 0xcb, 0x4c, 0xd4, 0xae, 0x57, 0x7d, 0x79, 0x6e,
-	0x83, 0xe4, 0x0e, 0x25, 0x6d, 0x99, 0x2f, 0x4a, 0x89, 0xac, 0x44, 0x94, 0xfc, 0xc9, 0x77, 0xb4, 0x2a, 0xc6, 0xa2,
-	0x2a, 0x11, 0x7c, 0xc4, 0x05, 0x55, 0xcd, 0xa2, 0x22, 0x88, 0xbe, 0xba, 0x4e, 0x2d, 0xe7, 0x10, 0x80, 0x0d, 0xd2,
-	0x22, 0xa3, 0x3d, 0x4b, 0x09, 0xb4, 0x55, 0xa4, 0xca, 0x77, 0xe4, 0x42, 0x88, 0xb1, 0xd5, 0xd9, 0x61, 0x62, 0x29,
-	0x7f, 0x55, 0x19, 0x25, 0xff, 0xd9, 0x30, 0x81, 0xc9, 0x10, 0x83, 0xb2, 0xce, 0x64, 0xe5, 0x7a, 0x63, 0xaf, 0xc8,
-	0x59, 0x15, 0x36, 0x26, 0x73, 0xc9, 0xcd, 0xa9, 0xf9, 0x7a, 0x60, 0x51, 0x74, 0x55, 0x41, 0xad, 0x2c, 0xa2, 0x94,
-	0xb3, 0x4a, 0x09, 0xe2, 0x01, 0x88, 0xac, 0x88, 0x09, 0x73, 0x01, 0xfb, 0x15, 0x60, 0xa2, 0x72, 0x35, 0x89, 0x6f,
-	0x52, 0xf6, 0xef, 0xe6, 0x7a, 0xa5, 0xa5, 0x4d, 0xf0, 0x22, 0x4b, 0x84, 0xe5, 0x9c, 0x21, 0x3e, 0x40, 0xf6, 0x3f,
-	0xcd, 0x65, 0x7f, 0xcc, 0xe2, 0xeb, 0xca, 0x25, 0xbe, 0x96, 0x8f, 0x48, 0x17, 0xa1, 0xf3, 0xe6, 0x16, 0x83, 0xe0,
-	0x40, 0xd0, 0xb9, 0x3c, 0xb4, 0x6e, 0xed, 0xc0, 0xdb, 0x1b, 0xc3, 0x60, 0x07, 0x67, 0xa2, 0xcc, 0xb8, 0xd0, 0xd6,
-	0x6b, 0xc9, 0x5f, 0xa0, 0xee, 0x46, 0x4a, 0x99, 0x8e, 0x85, 0x6a, 0x45, 0xc6, 0x01, 0x2e, 0x25, 0x2d, 0x16, 0xea,
-	0xbb, 0x76, 0xa1, 0x4e, 0x8b, 0x64, 0xc1, 0x0b, 0x3b, 0xca, 0x99, 0xd5, 0x31, 0x64, 0x1f, 0xce, 0x0c, 0xc6, 0x07,
-	0x97, 0xe5, 0x9a, 0x33, 0x31, 0x0a, 0xbf, 0x9e, 0x87, 0x65, 0x6b, 0x06, 0x00, 0xb2, 0xac, 0xcb, 0xcc, 0x59, 0x47,
-	0x87, 0xdf, 0xb7, 0x27, 0x3e, 0xcc, 0x50, 0xd4, 0x65, 0x09, 0x76, 0x9c, 0x35, 0x82, 0xe3, 0x87, 0x26, 0x86, 0x01,
-	0xf2, 0x8d, 0xa0, 0xc9, 0xe2, 0xe5, 0x28, 0x61, 0x81, 0x72, 0x41, 0xf2, 0xb7, 0x0c, 0xb8, 0x3b, 0x74, 0xa1, 0xaa,
-	0xb3, 0x8a, 0x70, 0x94, 0xb2, 0xd4, 0x47, 0xa0, 0x0b, 0x11, 0x0d, 0x1a, 0x3b, 0x56, 0x58, 0x5f, 0x43, 0xb7, 0x92,
-	0xda, 0x08, 0x67, 0xd7, 0x31, 0xfb, 0xe5, 0xe2, 0x4f, 0x0d, 0x33, 0x38, 0x84, 0x4d, 0x55, 0x4b, 0x8a, 0x1d, 0x57,
-	0x5b, 0x38, 0x85, 0xdf, 0x16, 0x7f, 0xb4, 0xbc, 0x2e, 0x16, 0x70, 0xbe, 0x39, 0x4e, 0x5c, 0x1d, 0x05, 0xdf, 0x4d,
-	0xed, 0x72, 0xd6, 0x58, 0x6c, 0xc5, 0x1c, 0x9d, 0xe7, 0x75, 0xb9, 0x0e, 0xc3, 0x7f, 0x53, 0x22, 0x42, 0xf1, 0xa8,
-	0x0c, 0xe7, 0xf5, 0xa6, 0x7b, 0xd9, 0x43, 0x7f, 0xfe, 0xc9, 0xcf, 0xa9, 0xe5, 0x71, 0xa1, 0x5f, 0x80, 0xd3, 0x3f,
-	0x78, 0xc2, 0xeb, 0x53, 0xee, 0x1c, 0xd5, 0x31, 0x14, 0xc7, 0xe8, 0xef, 0x86, 0x91, 0xce, 0xdf, 0x4a, 0x05, 0x46,
-	0x01, 0xe6, 0x76, 0xd4, 0xe9, 0xd5, 0xea, 0x41, 0x2b, 0x59, 0x97, 0xa4, 0xc8, 0x8c, 0xae, 0x32, 0x33, 0x9c, 0x4d,
-	0x13, 0xa3, 0x08, 0x8d, 0xc6, 0xd5, 0xf7, 0xc7, 0xf6, 0x70, 0xeb, 0x9a, 0xec, 0x98, 0xad, 0x8c, 0xcc, 0x74, 0x36,
-	0xa7, 0xe1, 0x0d, 0x87, 0x84, 0xe9, 0xc0, 0xbe, 0xed, 0xf0, 0xb0, 0x05, 0xe8, 0x9a, 0x12, 0xbe, 0x30, 0xdf, 0xd6,
-	0x9b, 0x33, 0x71, 0x6c, 0xc0, 0x46, 0xd3, 0xf9, 0x78, 0xe6, 0x6a, 0x87, 0xa5, 0x26, 0xe2, 0x48, 0x52, 0x0b, 0xde,
-	0x91, 0x5d, 0xf3, 0x43, 0xb3, 0x70, 0xb4, 0x20, 0x7a, 0x90, 0x0b, 0x1e, 0x6a, 0xee, 0x6b, 0xe8, 0x04, 0xd8, 0x73,
-	0x42, 0xe0, 0x9c, 0xda, 0x49, 0x3c, 0x5c, 0x60, 0x27, 0xa1, 0x6e, 0x82, 0x74, 0xbd, 0x96, 0x3e, 0x10, 0x4d, 0x02,
-	0x1d, 0x03, 0xd4, 0x44, 0x38, 0x89, 0x74, 0x4d, 0xcc, 0x23, 0x4a, 0x4a, 0xb6, 0xae, 0xe3, 0x71, 0x74, 0x4c, 0x6c,
-	0xad, 0x43, 0xeb, 0x19, 0xba, 0x74, 0xab, 0x4b, 0x16, 0x17, 0x6b, 0x28, 0xfb, 0x0c, 0xf8, 0x52, 0x46, 0x05, 0xec,
-	0x3a, 0x4b, 0xc9, 0x0a, 0x5c, 0xa8, 0x32, 0xee, 0xf4, 0xca, 0xa4, 0xed, 0xd0, 0x75, 0x68, 0x18, 0xf2, 0x43, 0x46,
-	0x94, 0x7c, 0x38, 0x12, 0xf4, 0x4e, 0x89, 0xb8, 0x0d, 0x8a, 0x1b, 0xf0, 0x46, 0xe7, 0xce, 0x73, 0x8a, 0x89, 0xe7,
-	0x39, 0x2e, 0x58, 0x54, 0x60, 0xd8, 0xa0, 0x27, 0x42, 0xb3, 0x30, 0xe5, 0x56, 0xc9, 0xe8, 0x7a, 0x3b, 0x2c, 0xd2,
-	0x90, 0x17, 0x05, 0x5b, 0x33, 0x65, 0x72, 0xa4, 0x5a, 0xaf, 0x0c, 0x6e, 0xc7, 0x82, 0x05, 0xf4, 0x07, 0xbf, 0x0d,
-	0x80, 0x33, 0x73, 0xc4, 0xae, 0x63, 0xfe, 0x69, 0x21, 0x70, 0x44, 0xb3, 0x01, 0x08, 0x9a, 0x52, 0xb0, 0xf0, 0x26,
-	0x9d, 0xdd, 0xc2, 0xe0, 0xa1, 0xe7, 0x02, 0xa7, 0xa1, 0xe7, 0xb2, 0x2a, 0x2d, 0xce, 0x09, 0xb5, 0x91, 0xeb, 0x2e,
-	0x89, 0x95, 0x62, 0xf2, 0x2b, 0xbb, 0x40, 0x45, 0x88, 0x72, 0x1d, 0xef, 0x3e, 0x0a, 0xef, 0xea, 0xd8, 0xcc, 0x59,
-	0x04, 0xaf, 0x65, 0xd9, 0x4d, 0x9b, 0x33, 0x64, 0x5c, 0x0e, 0x07, 0x0f, 0x26, 0x13, 0xbd, 0x5e, 0xb6, 0x29, 0x36,
-	0x9d, 0xce, 0x95, 0x90, 0x15, 0x91, 0x62, 0xa0, 0xad, 0x4b, 0x35, 0x2b, 0x84, 0x5a, 0x3b, 0x32, 0x2f, 0x7c, 0xae,
-	0x62, 0x93, 0xe3, 0xb2, 0x96, 0x55, 0x88, 0x4d, 0x97, 0x33, 0x12, 0xa1, 0x9b, 0x40, 0x90, 0xb0, 0x70, 0x5d, 0xe6,
-	0x8e, 0x98, 0x75, 0x7a, 0xa6, 0x44, 0xea, 0xd8, 0x5a, 0x82, 0x45, 0xe3, 0x5c, 0x1e, 0x94, 0x0d, 0x01, 0xcf, 0x44,
-	0xec, 0xe4, 0xb8, 0x16, 0x2b, 0x61, 0xbb, 0x0e, 0xf7, 0x2d, 0x83, 0xb8, 0x0d, 0xc5, 0x89, 0xf3, 0x4c, 0x16, 0x45,
-	0x3e, 0x3b, 0x69, 0x38, 0x1e, 0x90, 0xad, 0x45, 0x2a, 0x39, 0x2c, 0x66, 0x8b, 0x0e, 0x31, 0xb4, 0x04, 0x37, 0x3d,
-	0x74, 0x80, 0x0f, 0x89, 0xdd, 0xb5, 0x0c, 0x81, 0x41, 0x22, 0x5e, 0xdc, 0x91, 0xa9, 0x40, 0xe3, 0xf2, 0x5f, 0xa9,
-	0x7e, 0x2c, 0xd5, 0x0f, 0xf4, 0x50, 0xb6, 0xaa, 0x58, 0x58, 0xac, 0xd7, 0xbe, 0x4e, 0x59, 0xed, 0x4b, 0x17, 0x68,
-	0x35, 0x5b, 0x5a, 0xae, 0x6b, 0xff, 0x5b, 0xe2, 0x95, 0x92, 0xaa, 0x0d, 0xa0, 0x65, 0x4d, 0x5a, 0x9c, 0x8b, 0xd3,
-	0x95, 0x89, 0x86, 0xfd, 0x32, 0xdd, 0x86, 0xbe, 0x46, 0x41, 0xdf, 0x94, 0x9d, 0x93, 0x42, 0xf2, 0x28, 0x49, 0xe4,
-	0xb8, 0x27, 0xea, 0xad, 0x0c, 0xdd, 0xd4, 0x40, 0x28, 0xd3, 0x44, 0x8f, 0xd4, 0xfa, 0xbd, 0x85, 0x85, 0xe6, 0x6d,
-	0x1d, 0x4d, 0x68, 0xe1, 0x72, 0x13, 0x9b, 0x9b, 0x83, 0xa9, 0xbd, 0xb4, 0x89, 0xe1, 0x2d, 0x58, 0xc6, 0xe6, 0xbb,
-	0x06, 0x60, 0xb0, 0x15, 0x1e, 0x04, 0x2c, 0x4d, 0xa0, 0xaf, 0x6e, 0x3c, 0x26, 0x22, 0x1c, 0x24, 0x24, 0x52, 0x2f,
-	0x8d, 0x86, 0xe0, 0x59, 0xa0, 0x92, 0xab, 0xa3, 0x5e, 0xf0, 0x81, 0x80, 0x4d, 0x6a, 0x99, 0xcb, 0xf3, 0x15, 0x8c,
-	0x8e, 0x3d, 0x35, 0x4e, 0xc3, 0xb3, 0xe7, 0x9c, 0xe1, 0xc8, 0x13, 0x12, 0xa1, 0x92, 0xfc, 0x66, 0x2e, 0xc7, 0xb1,
-	0x64, 0x99, 0x37, 0x62, 0x23, 0x0e, 0x5b, 0xac, 0x12, 0x1d, 0xf0, 0x3c, 0x20, 0xa8, 0x69, 0xbf, 0xc3, 0x3b, 0x31,
-	0x1e, 0x20, 0xe2, 0x1d, 0x18, 0x6c, 0x42, 0x85, 0xfb, 0x9b, 0xb4, 0x65, 0x6e, 0x30, 0x09, 0xa3, 0x6d, 0x7f, 0xd7,
-	0xf6, 0xed, 0x7c, 0x5f, 0x50, 0xff, 0x8c, 0x79, 0xc2, 0x96, 0x42, 0xf3, 0x4c, 0x2f, 0xaa, 0xcd, 0xa9, 0x76, 0xd7,
-	0x0d, 0x63, 0x4b, 0x3c, 0x8f, 0x45, 0xa3, 0x02, 0x6a, 0xd2, 0x90, 0x22, 0xd2, 0x7c, 0x60, 0xa2, 0x85, 0x43, 0x77,
-	0xdb, 0x17, 0xdc, 0x02, 0xa0, 0xff, 0x55, 0xb9, 0x5c, 0x30, 0x08, 0x9e, 0x11, 0x58, 0xfa, 0xd8, 0x36, 0x97, 0x81,
-	0x6e, 0x62, 0x04, 0x96, 0x01, 0x36, 0x19, 0x25, 0x12, 0x27, 0x63, 0x95, 0x47, 0x05, 0xd6, 0x38, 0xfb, 0x66, 0xe4,
-	0x09, 0x08, 0x4a, 0x01, 0x56, 0xc6, 0xb3, 0xd4, 0x28, 0x3e, 0x77, 0xd2, 0xb0, 0x40, 0xf2, 0xd3, 0xb5, 0x39, 0xf2,
-	0x80, 0x1f, 0x2f, 0x87, 0x2a, 0x88, 0x2d, 0x12, 0x2d, 0xc9, 0x53, 0x9a, 0xe1, 0x4c, 0x89, 0x7d, 0x62, 0x33, 0x8e,
-	0xc3, 0x97, 0xfd, 0x40, 0x37, 0x2a, 0x81, 0x98, 0x0d, 0x1e, 0x67, 0x50, 0x9b, 0x82, 0x99, 0x9c, 0x67, 0x87, 0xda,
-	0xd9, 0x45, 0x27, 0x55, 0x44, 0x18, 0xcd, 0x0d, 0xf4, 0x21, 0x32, 0x57, 0x51, 0x6b, 0xe6, 0x0a, 0x2a, 0xb7, 0x6b,
-	0xac, 0xff, 0xd0, 0x91, 0x82, 0x27, 0xb5, 0xe0, 0x6d, 0xf3, 0x20, 0xb1, 0xb2, 0xb0, 0x54, 0x84, 0xae, 0xa3, 0x09,
-	0x40, 0x55, 0x66, 0xc2, 0x3c, 0x60, 0xe2, 0x38, 0x7c, 0xe9, 0xd9, 0xc8, 0x0e, 0x9b, 0x0b, 0x30, 0xe3, 0x5c, 0xda,
-	0x3d, 0x13, 0x24, 0x65, 0xfb, 0xe8, 0x4f, 0x7c, 0x71, 0x01, 0x19, 0x50, 0x00, 0x6e, 0x65, 0x72, 0x90, 0xdb, 0xcd,
-	0x79, 0x87, 0x97, 0x49, 0xd9, 0xb5, 0x0f, 0xdf, 0x28, 0x85, 0xa6, 0x34, 0x2a, 0xb8, 0xf5, 0xc1, 0x3e, 0xf9, 0x03,
-	0xe7, 0x1b, 0xea, 0x0a, 0xab, 0x42, 0x43, 0x5a, 0xac, 0x62, 0xc0, 0xda, 0x4d, 0x13, 0x43, 0x33, 0xf5, 0x5f, 0x16,
-	0x86, 0xdb, 0x0c, 0xf8, 0x97, 0x5b, 0x37, 0xb7, 0xd7, 0xee, 0x9e, 0x99, 0xc0, 0x05, 0x00, 0x1a, 0xc9, 0x10, 0x4f,
-	0x13, 0x07, 0x15, 0xc5, 0x75, 0x1c, 0xae, 0xc3, 0x88, 0xa5, 0xc4, 0x36, 0x6c, 0x20, 0x3d, 0xb4, 0xb0, 0x14, 0x86,
-	0xdb, 0x90, 0xe6, 0x15, 0x70, 0xd8, 0x36, 0xdd, 0xb1, 0xbd, 0xbb, 0xe3, 0x6a, 0xda, 0xe1, 0x96, 0x80, 0x07, 0x2c,
-	0x5f, 0x4c, 0x09, 0x1e, 0x42, 0xc2, 0x65, 0x04, 0x12, 0xdb, 0xad, 0xeb, 0xfc, 0xcc, 0xf1, 0x45, 0x44, 0x6a, 0x81,
-	0x57, 0x49, 0x5c, 0x1f, 0x6e, 0x73, 0x1a, 0x1e, 0xdb, 0xcf, 0x2d, 0xc3, 0xb7, 0xc4, 0xf1, 0xd6, 0x00, 0x80, 0x75,
-	0x62, 0x66, 0x1e, 0x47, 0x58, 0xbc, 0x1f, 0xe6, 0xec, 0xca, 0x02, 0x13, 0x0e, 0x07, 0x16, 0x10, 0x42, 0xf8, 0xff,
-	0x51, 0x63, 0x7b, 0xdd, 0xfa, 0xe7, 0xad, 0xfd, 0x0c, 0x4d, 0x6b, 0x4f, 0xd7, 0xc5, 0x40, 0x81, 0xb0, 0x51, 0xa3,
-	0x80, 0x12, 0x74, 0x72, 0x6a, 0x93, 0x74, 0xe8, 0x71, 0xc6, 0xe1, 0x6b, 0x66, 0x48, 0x07, 0x3a, 0xc7, 0xae, 0x4b,
-	0xd5, 0x29, 0x5c, 0x8e, 0xeb, 0x8a, 0xaf, 0x8c, 0xba, 0xae, 0x05, 0x0a, 0xe5, 0x0b, 0xc2, 0x38, 0xdb, 0xe1, 0x80,
-	0xca, 0x57, 0x7e, 0x82, 0x27, 0x95, 0x15, 0x7e, 0x3f, 0xfb, 0x71, 0xa6, 0x96, 0x5a, 0x46, 0x8a, 0x03, 0x5c, 0x42,
-	0x10, 0xc2, 0x2d, 0x7f, 0xd4, 0xe3, 0xb9, 0x25, 0x99, 0x0a, 0x8a, 0x67, 0xe0, 0xad, 0x6f, 0xa4, 0xb9, 0x83, 0xf0,
-	0x4b, 0x89, 0x4f, 0x03, 0x10, 0x75, 0x69, 0x39, 0x7c, 0x3c, 0xc5, 0xf0, 0xa4, 0x70, 0x00, 0xc5, 0xb6, 0x39, 0x01,
-	0xdc, 0xe6, 0xdb, 0xd8, 0xa7, 0x20, 0xe2, 0x80, 0x0f, 0x5d, 0x25, 0xf2, 0x06, 0xe9, 0xf1, 0x20, 0x23, 0xc9, 0xd1,
-	0xce, 0x5f, 0xcf, 0x84, 0x36, 0x13, 0x4f, 0xfe, 0x4a, 0xc4, 0x55, 0xa3, 0x3c, 0xd7, 0x3e, 0x9d, 0xce, 0xaf, 0x81,
-	0xba, 0x3f, 0xcd, 0x7c, 0xe7, 0x07, 0x9b, 0x02, 0xae, 0x32, 0x78, 0xc5, 0x9d, 0xda, 0x6d, 0x9e, 0x61, 0x78, 0x68,
-	0xfb, 0x35, 0xd7, 0x90, 0x61, 0xb8, 0x02, 0x86, 0x83, 0x0e, 0x40, 0x71, 0xbc, 0x79, 0x82, 0x61, 0xc2, 0xf8, 0xe2,
-	0x5b, 0x98, 0x60, 0xe6, 0xb1, 0xa1, 0xcb, 0x2e, 0x01, 0xd2, 0xd0, 0x20, 0x41, 0xf1, 0x5b, 0xe4, 0x1a, 0xce, 0x2d,
-	0x0f, 0x31, 0x3c, 0x72, 0x1e, 0xda, 0xf1, 0xd0, 0xf9, 0x55, 0x05, 0x51, 0xdb, 0x66, 0x55, 0x36, 0x5c, 0x8b, 0xda,
-	0x3e, 0xa4, 0x97, 0xee, 0x96, 0x83, 0x8e, 0x21, 0x1d, 0xce, 0x2f, 0x8f, 0x33, 0x1c, 0x36, 0x7f, 0xb9, 0xce, 0xf7,
-	0x13, 0x95, 0x83, 0x42, 0xf7, 0x74, 0x18, 0x48, 0xad, 0x48, 0x81, 0xae, 0xd7, 0x56, 0xda, 0x1e, 0xb8, 0x00, 0x28,
-	0x24, 0x1d, 0x7b, 0x61, 0xdc, 0xb5, 0x0a, 0x67, 0x26, 0xd2, 0x91, 0x3c, 0xd8, 0xb0, 0xce, 0xad, 0xcf, 0x84, 0xe3,
-	0x46, 0x64, 0x98, 0x3e, 0x48, 0xfc, 0x01, 0x32, 0x00, 0x1b, 0x37, 0xfc, 0x20, 0xd7, 0x24, 0x1a, 0xc1, 0xad, 0x6b,
-	0x5b, 0xb2, 0x96, 0x5c, 0x6b, 0xc1, 0x1c, 0x0b, 0x83, 0xdf, 0x56, 0x2b, 0xcc, 0x8c, 0x1b, 0x45, 0xb5, 0x56, 0x84,
-	0x8a, 0x9d, 0x6e, 0xfb, 0x14, 0x04, 0xc8, 0xac, 0x2d, 0x43, 0x77, 0x6c, 0x74, 0x52, 0xd1, 0x0f, 0x7b, 0xb8, 0x68,
-	0xd9, 0x22, 0xea, 0x64, 0x66, 0xcc, 0xc3, 0xfe, 0xe5, 0x3a, 0xd1, 0xbb, 0xb5, 0x5a, 0xb5, 0x56, 0x83, 0x2e, 0xef,
-	0xc2, 0x17, 0x8e, 0xf1, 0x90, 0x2a, 0x4d, 0xb8, 0x46, 0x26, 0x71, 0xfb, 0xdd, 0x66, 0x36, 0x1a, 0xbb, 0x30, 0x00,
-	0x01, 0x37, 0xf0, 0x63, 0x8c, 0xe4, 0x21, 0x88, 0xd3, 0xd3, 0x84, 0x87, 0xbf, 0xe5, 0x3a, 0x4f, 0x65, 0x2d, 0x9e,
-	0xe4, 0x09, 0x88, 0x0d, 0x9c, 0x70, 0xc6, 0xe6, 0xe5, 0x31, 0x58, 0xa2, 0x8e, 0x0f, 0x50, 0x82, 0x5d, 0xe2, 0x31,
-	0xc8, 0xd2, 0x05, 0xcd, 0xe8, 0x4f, 0xf8, 0x9e, 0x04, 0x59, 0x19, 0xdb, 0x3b, 0xe6, 0xdd, 0x80, 0x02, 0x9d, 0x5d,
-	0x6e, 0x49, 0x9e, 0x88, 0x58, 0xed, 0xc0, 0xaf, 0x7e, 0x99, 0x9e, 0x88, 0x90, 0x0e, 0xf7, 0x8d, 0xbc, 0x1b, 0x1e,
-	0x8c, 0x1c, 0xe9, 0x41, 0xbd, 0x1d, 0xfd, 0xa5, 0x19, 0x3f, 0x2d, 0x7a, 0xf8, 0x58, 0x01, 0x04, 0xe0, 0x8c, 0xc9,
-	0xed, 0xa9, 0x75, 0x29, 0x40, 0x4e, 0x8f, 0xb7, 0x03, 0x01, 0x07, 0x29, 0x04, 0x60, 0xe9, 0x00, 0x2b, 0x96, 0x5f,
-	0x71, 0xe4, 0x77, 0x73, 0x52, 0xbc, 0x6d, 0x48, 0x14, 0x02, 0x71, 0xc3, 0xdb, 0x80, 0x74, 0xd3, 0x20, 0x79, 0x54,
-	0xe2, 0xf7, 0x96, 0xe3, 0x30, 0x2f, 0xef, 0x44, 0x75, 0x88, 0x14, 0x36, 0x57, 0x8a, 0x69, 0x54, 0x8a, 0x4d, 0xf2,
-	0xbb, 0xe1, 0x84, 0x16, 0x20, 0xa9, 0xcc, 0x84, 0xf1, 0x96, 0x31, 0xbd, 0xe8, 0x48, 0x9e, 0x98, 0x98, 0xb0, 0x49,
-	0x83, 0x9f, 0xd6, 0x64, 0x18, 0x81, 0xb1, 0x6f, 0x37, 0x9a, 0x35, 0xdc, 0x83, 0x1a, 0x43, 0x24, 0x36, 0x15, 0xfa,
-	0x07, 0x20, 0x42, 0x6d, 0xd3, 0x2e, 0x6a, 0xe6, 0xf6, 0xbc, 0x3d, 0x3b, 0xee, 0xbb, 0xa5, 0x43, 0xb3, 0xe1, 0xdc,
-	0x85, 0x0e, 0x0d, 0xef, 0x43, 0x78, 0x33, 0x3c, 0x3d, 0xad, 0xfa, 0x27, 0x50, 0x5b, 0x9a, 0xb4, 0x32, 0x76, 0x50,
-	0xf8, 0xfe, 0x25, 0x38, 0x2d, 0x69, 0x8c, 0x5a, 0x75, 0x50, 0xfb, 0x8e, 0xfa, 0x34, 0x90, 0x95, 0x61, 0xec, 0xae,
-	0xb9, 0xe7, 0x92, 0xf2, 0xa1, 0x4e, 0x10, 0x34, 0xb2, 0x56, 0xcd, 0x04, 0xff, 0x6a, 0x83, 0xc3, 0x1d, 0x47, 0x8e,
-	0x47, 0xaa, 0xad, 0xa1, 0xa5, 0x5b, 0xd3, 0x71, 0xb4, 0x86, 0x4e, 0xd3, 0xd5, 0x69, 0x53, 0x7a, 0xdd, 0x82, 0x74,
-	0xc3, 0x37, 0xdf, 0x9f, 0x3c, 0xc3, 0x0c, 0x9b, 0x8f, 0x2a, 0x5c, 0xae, 0x92, 0xf8, 0xe6, 0xe2, 0x23, 0x94, 0x5a,
-	0x0a, 0x40, 0x80, 0x19, 0x50, 0xb2, 0x2a, 0xab, 0xa5, 0x61, 0x91, 0x3c, 0x54, 0x7d, 0x57, 0x3f, 0x4d, 0x3f, 0xa5,
-	0xf2, 0x91, 0x25, 0x95, 0x4f, 0x72, 0xcc, 0x16, 0x8f, 0x94, 0x0f, 0xab, 0x51, 0xc3, 0x8a, 0x97, 0x1b, 0x4b, 0xf5,
-	0x48, 0xe6, 0x02, 0x3a, 0x17, 0x97, 0xea, 0x49, 0xd6, 0x42, 0xed, 0x58, 0x99, 0xd7, 0x8e, 0xdc, 0x90, 0xc2, 0x74,
-	0xbb, 0x5c, 0x9a, 0x74, 0x22, 0x08, 0x0c, 0x1c, 0xbe, 0x35, 0xd4, 0x78, 0x42, 0x32, 0xcb, 0x2b, 0x7e, 0xa0, 0x75,
-	0xa9, 0x79, 0x8b, 0x0f, 0xb4, 0x73, 0xcc, 0x2c, 0xb6, 0xf9, 0x68, 0x09, 0xaf, 0x63, 0x6b, 0xc9, 0xc1, 0x50, 0xe2,
-	0x11, 0x2d, 0x6e, 0x48, 0x40, 0xcb, 0x99, 0x70, 0xb1, 0x53, 0x4b, 0xde, 0x14, 0x3f, 0xc5, 0x7f, 0xa7, 0xb4, 0x9f,
-	0xff, 0xca, 0x94, 0x5a, 0x6b, 0x65, 0x17, 0xaa, 0xe4, 0x22, 0xc4, 0x1d, 0x8a, 0x4f, 0x41, 0x20, 0x33, 0x2d, 0xfd,
-	0xa8, 0x16, 0xb9, 0x08, 0x5a, 0xd0, 0x52, 0x43, 0x39, 0x65, 0x0e, 0x9a, 0x47, 0x95, 0xc8, 0xc5, 0x07, 0x4d, 0xf1,
-	0xa4, 0x50, 0x2f, 0x5a, 0x3e, 0x8f, 0x60, 0x59, 0x87, 0x60, 0xe0, 0x43, 0x60, 0x66, 0xcb, 0x3e, 0xa2, 0x75, 0x69,
-	0xd3, 0x10, 0x80, 0x5a, 0x12, 0x7c, 0xa9, 0x55, 0xd2, 0x72, 0x8f, 0x68, 0x71, 0x08, 0xd1, 0x96, 0x25, 0x5b, 0x8b,
-	0x56, 0xfd, 0x80, 0x16, 0x67, 0x8a, 0xbc, 0x5b, 0xdb, 0x49, 0x6f, 0xf0, 0x79, 0x81, 0x2c, 0x95, 0x2b, 0x05, 0x57,
-	0x48, 0xd6, 0xd2, 0x4b, 0x7e, 0x84, 0x97, 0x56, 0xa7, 0x9e, 0x04, 0xce, 0x25, 0x9a, 0x1c, 0x10, 0x7c, 0x16, 0x40,
-	0x8b, 0xb3, 0x5c, 0xd2, 0xd8, 0xb4, 0x7f, 0xac, 0x41, 0x91, 0x53, 0x00, 0x9f, 0x9d, 0x73, 0xa1, 0x2e, 0x6a, 0xc9,
-	0x25, 0xc5, 0x6f, 0xf1, 0x5b, 0x25, 0xda, 0x10, 0x2b, 0x29, 0x60, 0xcb, 0x3a, 0x15, 0x14, 0xbf, 0xc8, 0x6f, 0x95,
-	0xf6, 0xe9, 0xcd, 0x70, 0x07, 0x3c, 0x15, 0x74, 0x24, 0x33, 0x18, 0xbf, 0xcb, 0xaf, 0xf0, 0x1a, 0x82, 0x40, 0xfe,
-	0x19, 0x06, 0x6c, 0x95, 0x03, 0x96, 0x1f, 0xe8, 0xbf, 0x57, 0x63, 0x0f, 0x61, 0x8e, 0x08, 0x80, 0x08, 0x6a, 0xc9,
-	0x43, 0xf7, 0x98, 0x1a, 0xf9, 0xf8, 0x88, 0xb5, 0xfa, 0x41, 0xcc, 0xe6, 0x6e, 0xe2, 0x2d, 0x34, 0xa2, 0x16, 0xc7,
-	0xe8, 0xa4, 0x67, 0xca, 0xc7, 0xf5, 0x18, 0x1a, 0x00, 0x17, 0xac, 0x91, 0xa8, 0xc8, 0x7e, 0x1a, 0xf1, 0xb8, 0x22,
-	0xa3, 0xf0, 0x41, 0x83, 0x9b, 0x29, 0x71, 0xb9, 0xc9, 0x22, 0x37, 0xb5, 0x5b, 0x80, 0xb8, 0x58, 0x53, 0x8f, 0x69,
-	0x2d, 0x75, 0x42, 0xe5, 0x05, 0x34, 0xb8, 0x00, 0xd8, 0xe8, 0xc7, 0xf4, 0xf6, 0xcb, 0x1f, 0xab, 0xd8, 0x0d, 0xec,
-	0x77, 0x9b, 0x5e, 0x07, 0xc6, 0x39, 0xea, 0xc0, 0xf0, 0x2d, 0x5f, 0x85, 0xa6, 0xdd, 0xc5, 0x93, 0xea, 0x55, 0x7f,
-	0xcc, 0xfe, 0xd8, 0x28, 0xfc, 0x3b, 0xfb, 0x73, 0xb6, 0xa7, 0x4f, 0xfe, 0x07, 0x1e, 0x13, 0xc7, 0x83 };
@@ -1,659 +0,0 @@
-// times_bold.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_TIMES_BOLD[] = { 0x78, 0x9c, 0xbd, 0x7d, 0x5d, 0x77, 0x1b, 0x47, 0x92, 0xe5, 0xbb, 0xcf, 0xf1,
-	0x7f, 0xa8, 0xc7, 0xdd, 0x73, 0x96, 0xbd, 0x40, 0xa1, 0xf0, 0x35, 0xfd, 0x24, 0xb7, 0x6d, 0x75, 0x8b, 0x6e, 0x4b,
-	0xa4, 0x29, 0x40, 0x98, 0x37, 0x88, 0x2c, 0x52, 0x58, 0x82, 0x84, 0x0c, 0x10, 0x94, 0xd1, 0xbf, 0x7e, 0xb3, 0x2a,
-	0x23, 0x32, 0x6e, 0x46, 0x44, 0x42, 0xfb, 0xb4, 0x67, 0x66, 0x3c, 0xc2, 0xbd, 0x59, 0xc5, 0xcc, 0xf8, 0xb8, 0x91,
-	0x99, 0x95, 0x05, 0xfc, 0xf1, 0xb2, 0xde, 0xbf, 0xfc, 0xba, 0x7b, 0x7e, 0xf9, 0x77, 0xfb, 0xb2, 0xdf, 0xdc, 0x1e,
-	0xaa, 0xe6, 0x6f, 0xc3, 0x1f, 0x7f, 0xf8, 0xc7, 0xee, 0xe9, 0xa9, 0x7d, 0x7e, 0xa9, 0xfe, 0xb1, 0xfb, 0x7a, 0xda,
-	0x6f, 0x1e, 0xbe, 0xbc, 0x54, 0xff, 0xe3, 0xf6, 0x7f, 0x56, 0xc3, 0xf9, 0x6c, 0xfc, 0xbf, 0xba, 0xff, 0x4e, 0xfb,
-	0xff, 0xce, 0xbb, 0xff, 0xce, 0x07, 0xfd, 0x7f, 0x47, 0xfd, 0x7f, 0xa7, 0xd5, 0x9b, 0xbb, 0xdd, 0xe7, 0xb6, 0xfa,
-	0xe3, 0x74, 0x78, 0x69, 0x9f, 0x0e, 0xd5, 0xbf, 0x9e, 0x6f, 0x77, 0xfb, 0xaf, 0xbb, 0xfd, 0xfa, 0xa5, 0xbd, 0xfb,
-	0x5b, 0x55, 0xbd, 0xd9, 0x6e, 0xab, 0xeb, 0xee, 0x6e, 0x87, 0xea, 0xba, 0x3d, 0xb4, 0xfb, 0xd7, 0x80, 0xc2, 0xdf,
-	0xda, 0xb7, 0xeb, 0x97, 0xcd, 0xee, 0xb9, 0xfa, 0x39, 0x34, 0xff, 0xaf, 0xea, 0xe6, 0xcb, 0xb1, 0xfa, 0xf7, 0xfa,
-	0x54, 0x55, 0xc3, 0x6a, 0x58, 0xff, 0xd7, 0x38, 0xfc, 0xef, 0xa4, 0xff, 0x13, 0x72, 0xc1, 0xc7, 0xe7, 0xcd, 0x9f,
-	0xc7, 0xf6, 0x5f, 0x3f, 0x57, 0xcd, 0x68, 0x30, 0x19, 0x0b, 0xbe, 0xf8, 0xf7, 0xf1, 0xb0, 0x7e, 0x68, 0xab, 0x66,
-	0x38, 0x19, 0x4d, 0xaa, 0x71, 0x3d, 0x99, 0x84, 0x11, 0x75, 0x43, 0xfc, 0x7d, 0xfd, 0xd4, 0x56, 0x37, 0x9b, 0xa7,
-	0xf6, 0x70, 0xf1, 0xd3, 0x6e, 0x7b, 0x17, 0xc0, 0xe3, 0x76, 0x2b, 0x60, 0x45, 0xe0, 0xfa, 0x69, 0xb3, 0x3d, 0x09,
-	0xfc, 0xe3, 0x0f, 0xcb, 0xb6, 0x37, 0x41, 0xa4, 0xff, 0xf5, 0xb2, 0xde, 0x6e, 0x6e, 0xdf, 0x3c, 0x3f, 0x6c, 0xdb,
-	0x6a, 0x10, 0x3e, 0x1e, 0x7e, 0xdd, 0xfc, 0xd5, 0xde, 0x7d, 0xd8, 0xbc, 0xdc, 0x7e, 0xa9, 0xee, 0xd7, 0xdb, 0x43,
-	0x1b, 0x3a, 0xf2, 0x65, 0xbd, 0x5f, 0xdf, 0xbe, 0xb4, 0xfb, 0x3f, 0xda, 0x97, 0xea, 0x97, 0xbf, 0x5e, 0xda, 0xe7,
-	0xbb, 0xf6, 0xee, 0x7a, 0xf7, 0xb4, 0x7e, 0x8e, 0xfd, 0xf8, 0xe9, 0xa7, 0xdd, 0x5f, 0xd5, 0xc5, 0x70, 0x32, 0xab,
-	0x2e, 0xea, 0xe1, 0xac, 0x1a, 0x0e, 0x06, 0x83, 0x6a, 0x3e, 0x1a, 0x57, 0x3f, 0xfe, 0xf0, 0x31, 0xb4, 0xdc, 0x6f,
-	0x37, 0xcf, 0xed, 0x87, 0xdd, 0x61, 0xd3, 0x1b, 0xe3, 0x22, 0xb0, 0x80, 0xdf, 0x7c, 0xd9, 0xdc, 0x3e, 0x3e, 0xb7,
-	0x87, 0x43, 0x35, 0x0e, 0xf0, 0xa2, 0xdd, 0x1f, 0xba, 0x46, 0x83, 0x41, 0xfd, 0xb7, 0x41, 0xd7, 0xee, 0xf7, 0xdd,
-	0xcb, 0xe6, 0xb6, 0xfd, 0xff, 0xe0, 0xb6, 0x68, 0xb0, 0xcd, 0xa1, 0x5a, 0x57, 0x2f, 0xfb, 0xf5, 0x5d, 0xfb, 0xb4,
-	0xde, 0x3f, 0x56, 0xbb, 0xfb, 0xea, 0xb7, 0xcd, 0xf3, 0xee, 0xe5, 0xf4, 0xb5, 0xbd, 0xf8, 0x67, 0x1b, 0xae, 0x7a,
-	0xf3, 0xb6, 0x5a, 0x3f, 0xdf, 0xfd, 0xef, 0xdd, 0xbe, 0xda, 0x84, 0x8b, 0x0f, 0xc7, 0xcf, 0x87, 0xcd, 0xdd, 0x66,
-	0xbd, 0xdf, 0xb4, 0x87, 0xe0, 0xf7, 0x5f, 0xc2, 0x5f, 0xb9, 0xdb, 0x3c, 0x3f, 0xfc, 0x71, 0xfb, 0xa5, 0x0d, 0xb6,
-	0xee, 0xbb, 0xf0, 0xc7, 0x4b, 0x68, 0xbf, 0xde, 0xdf, 0x31, 0x17, 0x6c, 0xb9, 0xfe, 0xfa, 0xcf, 0x68, 0xfe, 0xc9,
-	0x74, 0xf2, 0xe3, 0x0f, 0x9f, 0xe8, 0x43, 0xd3, 0xf9, 0xf4, 0xcd, 0xe1, 0xb6, 0x33, 0xed, 0xbe, 0x9a, 0xcc, 0x46,
-	0x3f, 0xfe, 0xf0, 0x73, 0xcb, 0x1f, 0x83, 0x55, 0x43, 0x98, 0xfc, 0xf1, 0x72, 0xf7, 0xcf, 0x65, 0xd5, 0x34, 0xfd,
-	0xbf, 0x16, 0xcb, 0x6a, 0x38, 0x9a, 0x77, 0xff, 0x0c, 0xe1, 0xde, 0xf9, 0x87, 0xc3, 0x7d, 0x34, 0xec, 0x22, 0xa7,
-	0x1a, 0xd5, 0xd5, 0xdf, 0xab, 0xe5, 0xa7, 0xaa, 0x1e, 0x0f, 0xc2, 0x3f, 0x7e, 0xaf, 0x0e, 0x5f, 0xd7, 0xc1, 0x8e,
-	0x7f, 0xaf, 0x7e, 0xaa, 0x06, 0xf4, 0x3f, 0x7f, 0xef, 0x9b, 0x8d, 0x62, 0xb3, 0x51, 0xff, 0x8f, 0xdf, 0xab, 0xf6,
-	0xaf, 0xdb, 0xed, 0xfa, 0xa9, 0x6f, 0x37, 0x1b, 0x06, 0x5f, 0x8d, 0xc2, 0x0d, 0x86, 0xd5, 0x64, 0x3e, 0xa4, 0xe6,
-	0x4d, 0x6c, 0x3e, 0x1e, 0x8f, 0xfb, 0xe6, 0x7f, 0x1e, 0x77, 0xc1, 0xa4, 0x9f, 0xb7, 0xf1, 0x82, 0x51, 0xd5, 0x0c,
-	0x9a, 0xaa, 0x99, 0xd6, 0x70, 0xc1, 0x98, 0x2e, 0x18, 0xc4, 0x6e, 0x3c, 0x1f, 0x9f, 0x3e, 0x77, 0x3e, 0x7e, 0x78,
-	0xee, 0x2f, 0x69, 0x42, 0x3f, 0x9a, 0xf9, 0xa4, 0x9a, 0x0e, 0xb8, 0x3f, 0x93, 0xbc, 0xfd, 0xdd, 0x6e, 0xbb, 0x5d,
-	0xef, 0xfb, 0xb6, 0xf5, 0xbc, 0xba, 0x98, 0xcf, 0xfb, 0xdb, 0x4f, 0xc7, 0xdc, 0x7c, 0x1a, 0x9b, 0xf7, 0x11, 0xd7,
-	0xb5, 0xff, 0xda, 0xee, 0x6f, 0xbb, 0x94, 0xe9, 0x2e, 0x18, 0xd6, 0x4d, 0x18, 0x41, 0x53, 0xcd, 0xa6, 0xd3, 0xd0,
-	0xa1, 0x9a, 0xae, 0x98, 0xc5, 0x2b, 0x66, 0x34, 0xe0, 0xf5, 0x53, 0xb8, 0xe4, 0x10, 0x9c, 0xd4, 0x5f, 0x32, 0xa9,
-	0xbb, 0x30, 0xae, 0xa6, 0xb3, 0x29, 0x0c, 0x61, 0x9e, 0x9b, 0xa8, 0x1f, 0x73, 0x0c, 0xc6, 0xee, 0x92, 0xe9, 0x3c,
-	0x0c, 0x72, 0x52, 0xd5, 0x93, 0x91, 0x5c, 0xd2, 0x0c, 0xf2, 0x4b, 0xbe, 0xae, 0xf7, 0xed, 0xf3, 0xb6, 0xbd, 0x8f,
-	0x57, 0x34, 0x93, 0x98, 0x2b, 0x21, 0xc9, 0xc3, 0x25, 0x0d, 0x5d, 0x32, 0x74, 0x2e, 0x91, 0xbf, 0x52, 0x4f, 0xe3,
-	0x35, 0x75, 0xdf, 0x33, 0xbe, 0xa6, 0xce, 0x8d, 0xb5, 0x3e, 0x74, 0x1d, 0x3b, 0x3c, 0xf6, 0x57, 0x74, 0x7d, 0x0a,
-	0x5e, 0x6a, 0x1a, 0x18, 0x4a, 0x43, 0xde, 0x1e, 0x4f, 0xc9, 0x5a, 0xdb, 0xe3, 0xa1, 0x6f, 0x1c, 0xfe, 0xe8, 0xa0,
-	0x1a, 0x07, 0x6b, 0x8e, 0x43, 0x9f, 0x62, 0xd3, 0x26, 0x8f, 0x9f, 0xdb, 0xa0, 0x45, 0xeb, 0xd8, 0x36, 0xf8, 0x61,
-	0x38, 0x1b, 0x54, 0x75, 0x3d, 0xaa, 0x86, 0x5d, 0x1c, 0xf4, 0xcd, 0xc7, 0x79, 0xf7, 0xbf, 0x9c, 0xbe, 0x7e, 0x69,
-	0xc9, 0xc7, 0x4d, 0x35, 0x9c, 0x0e, 0xfb, 0x9e, 0x77, 0xff, 0x17, 0x9b, 0x4f, 0xf2, 0xbb, 0x07, 0x1f, 0x6c, 0x76,
-	0xd1, 0x05, 0x0d, 0x85, 0xdd, 0x70, 0x10, 0xee, 0xce, 0x9d, 0x21, 0x37, 0xd7, 0xd3, 0x59, 0x0c, 0xe6, 0xed, 0xfa,
-	0xf0, 0xa5, 0x6f, 0x7d, 0xd1, 0xfb, 0x38, 0xb8, 0x60, 0x00, 0x41, 0xd7, 0xcc, 0x72, 0xbb, 0xfc, 0xa7, 0xdd, 0xef,
-	0xa2, 0x15, 0x9b, 0xfe, 0xde, 0xcd, 0x34, 0x18, 0x7e, 0x36, 0xa3, 0xc6, 0xf3, 0xbc, 0xf1, 0xee, 0x39, 0xa6, 0xc9,
-	0x64, 0xdc, 0xc5, 0x66, 0x30, 0x71, 0x6a, 0x39, 0x1e, 0xe4, 0x2d, 0x5f, 0xbe, 0xc5, 0xbb, 0x0e, 0xa7, 0x5d, 0xcb,
-	0xd0, 0x35, 0x69, 0x39, 0x54, 0x2d, 0xbf, 0xec, 0xdb, 0x78, 0xd7, 0xe1, 0xa4, 0x0f, 0xc9, 0x66, 0x82, 0xad, 0x95,
-	0x1b, 0xef, 0x77, 0xc7, 0x18, 0xf1, 0x61, 0x5c, 0xdd, 0x8d, 0xc7, 0xd0, 0x74, 0xa4, 0x9a, 0x6e, 0x5e, 0xe3, 0x7d,
-	0xeb, 0x10, 0xb8, 0xb3, 0xd0, 0x76, 0xd0, 0xa9, 0x0a, 0xb5, 0x6d, 0xf2, 0xb6, 0x87, 0xcd, 0x5f, 0xb1, 0xe9, 0x8c,
-	0x8c, 0x80, 0xf7, 0x55, 0x69, 0x7a, 0x68, 0x5f, 0xc9, 0x7b, 0x34, 0xb8, 0x29, 0xdc, 0x57, 0xa5, 0x68, 0x2b, 0x41,
-	0xca, 0x77, 0x46, 0xa3, 0x4d, 0x95, 0x00, 0x6c, 0xc8, 0xbe, 0xf5, 0x84, 0x1a, 0x8f, 0xa0, 0xf1, 0x2c, 0x8f, 0xa2,
-	0xdb, 0xdd, 0x76, 0x17, 0xbb, 0x31, 0xab, 0x93, 0x18, 0x75, 0xb7, 0x8f, 0xad, 0x55, 0x62, 0x1e, 0xda, 0xa7, 0x8d,
-	0xba, 0xa2, 0x0b, 0xd3, 0xc9, 0x44, 0x2e, 0x99, 0xb0, 0x0b, 0x29, 0x01, 0xb6, 0x5d, 0xe1, 0xe9, 0x83, 0x7a, 0xd8,
-	0xd9, 0x6f, 0x1c, 0x62, 0x7b, 0x3c, 0xa4, 0xec, 0x9a, 0x0c, 0xf3, 0xb6, 0xed, 0x9f, 0xc7, 0xf5, 0x96, 0xb3, 0x65,
-	0x38, 0x98, 0xf6, 0xf9, 0x32, 0x0a, 0x8a, 0x14, 0x5b, 0xd7, 0x79, 0xeb, 0x87, 0xae, 0xf8, 0xb7, 0xfb, 0xe2, 0xcd,
-	0x95, 0x23, 0x43, 0xdd, 0x3f, 0xf4, 0xe5, 0xb1, 0x4f, 0xdd, 0x69, 0x34, 0x4d, 0xd3, 0x79, 0x88, 0xef, 0x4f, 0xde,
-	0x9c, 0x8f, 0x28, 0xd7, 0x49, 0xe3, 0x06, 0xb3, 0x3e, 0xfe, 0x67, 0x35, 0xc4, 0xff, 0x84, 0xbc, 0x39, 0xad, 0xeb,
-	0xbe, 0xed, 0x9b, 0xbe, 0x69, 0x17, 0x4c, 0xdd, 0xed, 0x26, 0x73, 0x12, 0xcf, 0x09, 0x39, 0x72, 0x32, 0x99, 0xf6,
-	0xcd, 0x7e, 0xe2, 0x08, 0x0d, 0xed, 0xc2, 0x2d, 0x93, 0xc3, 0x27, 0xd3, 0xfc, 0x76, 0xff, 0x88, 0x79, 0x3a, 0xef,
-	0xff, 0xf0, 0x04, 0xa5, 0x72, 0x32, 0xcb, 0x5b, 0xfe, 0x1c, 0xef, 0xd8, 0xa9, 0x7c, 0xf7, 0x57, 0xe5, 0x8e, 0xf3,
-	0xfc, 0x2f, 0xff, 0x02, 0x7f, 0x39, 0xe4, 0x7f, 0x6a, 0x37, 0x25, 0x77, 0x4d, 0x86, 0xc3, 0xbe, 0xdd, 0xaf, 0xd2,
-	0x6e, 0x1c, 0xaa, 0x8d, 0xb4, 0x23, 0x57, 0x4d, 0x49, 0x1f, 0xde, 0x46, 0xb3, 0x4f, 0xfb, 0x1e, 0x4e, 0x43, 0x70,
-	0xa7, 0x1e, 0x4e, 0xeb, 0xbc, 0xe5, 0x3f, 0x63, 0x2c, 0x0e, 0xc3, 0x1d, 0xa7, 0x63, 0x18, 0xf3, 0x94, 0xeb, 0x62,
-	0x67, 0xff, 0xd0, 0xee, 0x5f, 0xb1, 0x5d, 0x57, 0x37, 0x47, 0x98, 0x64, 0x53, 0x95, 0x64, 0xef, 0xe2, 0x5f, 0x0e,
-	0x95, 0xaa, 0x8b, 0x3a, 0xbc, 0xe1, 0x38, 0xff, 0xc3, 0x97, 0xb1, 0x61, 0x77, 0xc3, 0xe9, 0x04, 0xdb, 0x29, 0xa7,
-	0xfc, 0x26, 0x4a, 0x30, 0x09, 0xb5, 0x4b, 0xda, 0x91, 0x53, 0xe6, 0xbd, 0x50, 0xff, 0x5e, 0xfd, 0x5b, 0x4c, 0x3d,
-	0xaf, 0xd1, 0x84, 0xca, 0x25, 0xbf, 0x8b, 0x0c, 0xcd, 0x82, 0x7d, 0xb1, 0xe5, 0x3c, 0xef, 0xe1, 0xfb, 0xd8, 0xc3,
-	0x71, 0x34, 0x62, 0x03, 0xe5, 0x6d, 0xa6, 0xdc, 0xf2, 0x01, 0xdc, 0x37, 0x00, 0xe3, 0xcc, 0x94, 0x5b, 0xae, 0xe4,
-	0x8e, 0xa1, 0x49, 0x7e, 0xcb, 0x3a, 0xef, 0xe6, 0x35, 0x6b, 0x44, 0x30, 0xcf, 0x70, 0x0c, 0xb7, 0xe4, 0xbc, 0xe9,
-	0x55, 0xe8, 0xf7, 0xea, 0x0f, 0xec, 0xe4, 0x78, 0x38, 0x92, 0x42, 0x3f, 0x6b, 0x72, 0x43, 0xde, 0x70, 0x2a, 0x76,
-	0x86, 0x9c, 0xc0, 0x1d, 0x55, 0xb2, 0x7c, 0x14, 0x03, 0xcd, 0x73, 0x03, 0xcd, 0x26, 0x79, 0xcb, 0x45, 0xd1, 0x94,
-	0x33, 0x3d, 0x2d, 0x59, 0xb2, 0x17, 0x2f, 0xc2, 0x60, 0xe6, 0x33, 0x6c, 0xaa, 0xfc, 0xf3, 0x09, 0x6c, 0x39, 0x87,
-	0xb8, 0x98, 0xcd, 0xf3, 0x76, 0xab, 0xd8, 0x6e, 0xac, 0xdb, 0xcd, 0x07, 0xf9, 0xb0, 0xff, 0x9b, 0x95, 0xb9, 0x1b,
-	0x76, 0x03, 0xed, 0xd4, 0x7c, 0xe3, 0x73, 0x98, 0xe0, 0x3f, 0xb6, 0x2f, 0x69, 0x92, 0x32, 0xe9, 0x92, 0xa7, 0xe9,
-	0x0a, 0x6b, 0xd7, 0x59, 0xd2, 0xe7, 0x39, 0x4f, 0x2a, 0xc9, 0xa1, 0x9f, 0xc3, 0x35, 0x58, 0x8b, 0xc7, 0x54, 0x8b,
-	0xc1, 0xb1, 0xf3, 0x91, 0xfb, 0x77, 0x64, 0x66, 0x33, 0xaa, 0xe3, 0x1f, 0xea, 0x74, 0x5a, 0xfe, 0x10, 0xa7, 0xd5,
-	0x2c, 0x46, 0xd8, 0xfa, 0x70, 0xbb, 0xd9, 0xdc, 0x6e, 0xf6, 0xb7, 0xc7, 0x38, 0x37, 0x0d, 0xe9, 0x39, 0x0a, 0xc1,
-	0x37, 0x1e, 0xe0, 0xc8, 0x55, 0x0d, 0x3b, 0x76, 0x53, 0xe7, 0x43, 0x98, 0xf8, 0xf3, 0xb4, 0xf7, 0x62, 0x18, 0x3a,
-	0xd8, 0xb1, 0x17, 0x53, 0x9a, 0xb5, 0xcc, 0x27, 0x79, 0xe7, 0xfa, 0xa9, 0x5d, 0x32, 0x41, 0xc8, 0xf3, 0x7e, 0x66,
-	0x17, 0x0a, 0xa9, 0x0c, 0x47, 0x95, 0xb3, 0x38, 0x25, 0xea, 0x07, 0x1e, 0xaa, 0xfa, 0x6c, 0xd6, 0xd7, 0xb3, 0xd8,
-	0x92, 0x27, 0x21, 0x14, 0xa9, 0x9f, 0x2b, 0x2a, 0xa7, 0x5d, 0xcb, 0x31, 0xa6, 0xe8, 0x9c, 0x5c, 0xdb, 0x50, 0x2a,
-	0xdf, 0x66, 0xf7, 0x1c, 0x0d, 0xe4, 0x9e, 0xc3, 0xc1, 0x20, 0xbf, 0xe9, 0x1d, 0x36, 0x1d, 0xa3, 0x7f, 0x87, 0x83,
-	0x61, 0x7e, 0xd7, 0x36, 0xbb, 0x6b, 0x3d, 0xc1, 0xbb, 0xd6, 0xb9, 0x19, 0xee, 0x45, 0x4b, 0x46, 0x7d, 0xc1, 0xe8,
-	0x6e, 0xf5, 0x5b, 0xb5, 0x09, 0xd3, 0x8d, 0xfe, 0x1f, 0xdb, 0xea, 0x7e, 0xcb, 0x97, 0xaa, 0x3a, 0xf6, 0xc0, 0xe1,
-	0x76, 0x51, 0x87, 0x99, 0x64, 0x33, 0x1b, 0xe1, 0x9f, 0x69, 0xf2, 0xce, 0x7f, 0x01, 0x35, 0xcf, 0xbb, 0x3e, 0xce,
-	0xc3, 0x6c, 0x23, 0x0d, 0x6b, 0x14, 0xf3, 0xe1, 0x40, 0xf9, 0xef, 0xff, 0xc4, 0x38, 0xec, 0xea, 0x67, 0x1d, 0x7a,
-	0x96, 0xcd, 0xc9, 0xbb, 0x8a, 0x9d, 0xfd, 0xf9, 0x38, 0x4d, 0x0e, 0xe9, 0x14, 0xfe, 0x7c, 0x33, 0xc2, 0x3f, 0x3f,
-	0xcb, 0xff, 0xfc, 0x56, 0xfd, 0x79, 0x69, 0x48, 0x8e, 0xe3, 0xb5, 0xc4, 0x93, 0x34, 0x9c, 0x75, 0x46, 0x4e, 0x23,
-	0x1f, 0x2a, 0xb7, 0x3d, 0x4b, 0xd5, 0xe9, 0x66, 0x05, 0xd0, 0x50, 0x4d, 0x1c, 0x77, 0x99, 0xd3, 0xa6, 0xe8, 0xb4,
-	0x61, 0x9d, 0xdf, 0xf3, 0x6b, 0x92, 0x98, 0x3a, 0xd8, 0x6f, 0x5c, 0x67, 0x7f, 0x5f, 0xa9, 0xe6, 0x9f, 0x31, 0xf3,
-	0x1a, 0x6a, 0x3b, 0xca, 0xee, 0xdb, 0xe4, 0x71, 0x93, 0x16, 0x5f, 0x21, 0x0e, 0x47, 0xd9, 0x4d, 0x79, 0xca, 0x4f,
-	0x25, 0xf2, 0x80, 0x7d, 0x1d, 0x4d, 0x86, 0xd8, 0x54, 0xf9, 0x89, 0xa6, 0x8b, 0x7d, 0x4a, 0x06, 0x30, 0x4c, 0x5d,
-	0x46, 0x03, 0x6e, 0xaa, 0xbc, 0x74, 0x14, 0x91, 0x6d, 0xfa, 0x19, 0x57, 0x33, 0x61, 0x87, 0x0e, 0xd5, 0x34, 0xff,
-	0x95, 0xad, 0x1a, 0x73, 0x71, 0x8c, 0x4d, 0x95, 0x7a, 0x7e, 0x8b, 0x4d, 0x47, 0x7d, 0xd3, 0xe9, 0x00, 0xef, 0x5a,
-	0xab, 0x59, 0x7e, 0x9c, 0x34, 0x0f, 0xbb, 0x30, 0x69, 0x66, 0x0d, 0x36, 0x54, 0xbe, 0x3a, 0xa5, 0x9e, 0x76, 0x46,
-	0x6d, 0x42, 0x91, 0x84, 0xb6, 0x75, 0x6e, 0xd4, 0xff, 0x48, 0x00, 0x34, 0x75, 0xd6, 0x90, 0xe5, 0x72, 0xde, 0x24,
-	0xb9, 0x14, 0x45, 0xea, 0x66, 0xf9, 0xc3, 0x20, 0x5e, 0xa3, 0xa6, 0x53, 0xfd, 0x19, 0x5f, 0xc3, 0x4b, 0xb5, 0x7a,
-	0x40, 0xaa, 0x1c, 0x7d, 0x36, 0x99, 0xd0, 0x76, 0x4c, 0x10, 0xb0, 0xe9, 0xac, 0xe6, 0xd6, 0x63, 0xe7, 0x2f, 0x88,
-	0x1c, 0x8f, 0x1b, 0xfa, 0x13, 0xfd, 0x2a, 0x3e, 0xfd, 0x09, 0x9e, 0xf3, 0xd7, 0xbc, 0xd2, 0x0c, 0x7a, 0xfc, 0xb2,
-	0xd9, 0xde, 0xb5, 0x1c, 0x1d, 0xc3, 0xe0, 0xec, 0x26, 0xe4, 0x5a, 0xef, 0xe2, 0xfe, 0x9a, 0x89, 0xaa, 0x30, 0x71,
-	0x6b, 0xe1, 0x6e, 0xf7, 0x4d, 0xe6, 0xe7, 0x7d, 0x92, 0x86, 0xe5, 0xcf, 0x78, 0xc0, 0xe3, 0x9f, 0xa8, 0xb5, 0x50,
-	0x5a, 0xcc, 0x8f, 0x7b, 0x5f, 0x05, 0x53, 0x85, 0x35, 0xc2, 0x98, 0xd7, 0x0b, 0x43, 0x3d, 0x8d, 0xee, 0x16, 0xc0,
-	0xdb, 0xcd, 0xf3, 0x43, 0x16, 0x09, 0xdd, 0xe2, 0x65, 0xd6, 0xf0, 0x15, 0x64, 0xac, 0x21, 0xd5, 0xc7, 0xfb, 0x6e,
-	0x63, 0x8b, 0x27, 0xde, 0x71, 0x0b, 0xab, 0x8b, 0xc9, 0x7a, 0x2e, 0xab, 0x92, 0xe1, 0x44, 0x55, 0x96, 0x13, 0xad,
-	0x8d, 0x2e, 0x26, 0x4d, 0x2f, 0x1e, 0xb0, 0x38, 0x1a, 0xf2, 0xa4, 0x3a, 0xad, 0xd0, 0xb6, 0xbb, 0xfd, 0xe6, 0x39,
-	0x55, 0xa0, 0x6e, 0x45, 0x3e, 0xef, 0x66, 0x0b, 0xa9, 0xbd, 0x2a, 0x28, 0x87, 0xf6, 0x56, 0xad, 0x03, 0xea, 0x10,
-	0x35, 0xa8, 0x63, 0x13, 0x15, 0xf6, 0xb7, 0xc7, 0xfd, 0xbe, 0x7d, 0xbe, 0x3d, 0x51, 0x0d, 0x9e, 0x74, 0x0b, 0x97,
-	0x71, 0xff, 0xff, 0x92, 0x27, 0xe6, 0xb9, 0xa0, 0xf5, 0x65, 0xee, 0xb0, 0xe9, 0x77, 0xfc, 0xfa, 0x42, 0x37, 0xee,
-	0x37, 0x6e, 0xea, 0x01, 0x14, 0xba, 0xe1, 0x54, 0xe5, 0x01, 0x6f, 0xf5, 0xa4, 0x60, 0x0c, 0x1d, 0xeb, 0xca, 0x63,
-	0x33, 0x9b, 0xe0, 0x55, 0x2a, 0x29, 0x1e, 0x8e, 0x9b, 0x70, 0xc5, 0xd3, 0x4e, 0x26, 0x16, 0x21, 0xc2, 0x49, 0x6f,
-	0x9a, 0xe1, 0x98, 0xaf, 0x52, 0x05, 0xa8, 0xbb, 0xaa, 0xef, 0x5f, 0xba, 0x2a, 0xac, 0xfb, 0xc2, 0x55, 0xa3, 0x2e,
-	0xb1, 0xe4, 0xaa, 0x51, 0xe1, 0xaa, 0x3d, 0xae, 0x48, 0xc3, 0x65, 0x75, 0x88, 0x35, 0xb8, 0x4c, 0x95, 0xa1, 0xfb,
-	0x8d, 0x94, 0xbb, 0x4e, 0x0a, 0x61, 0x30, 0x63, 0xd5, 0x72, 0x5b, 0x6c, 0xa9, 0xbc, 0xd8, 0x3e, 0xdf, 0xf1, 0xac,
-	0x68, 0x50, 0x0d, 0x67, 0xc3, 0x9e, 0xa8, 0xa7, 0xa9, 0xb9, 0x72, 0xe1, 0xdd, 0xfa, 0xe1, 0x81, 0xd6, 0x8a, 0x4d,
-	0xef, 0xf3, 0x10, 0xb5, 0x63, 0xf4, 0xf9, 0x74, 0xee, 0x5d, 0xc0, 0x1b, 0x6f, 0xcd, 0x98, 0xe2, 0x64, 0x8c, 0x7d,
-	0xe2, 0x59, 0x7a, 0xbe, 0xc7, 0xd2, 0x25, 0x54, 0xbb, 0x6f, 0xd3, 0x5e, 0x4b, 0xdd, 0xcc, 0xfa, 0xbd, 0x96, 0x66,
-	0x38, 0xe5, 0xeb, 0x38, 0x05, 0x1b, 0xba, 0x6e, 0xbd, 0x5f, 0x3f, 0xec, 0xd7, 0x5f, 0x79, 0x38, 0x61, 0xb6, 0x3b,
-	0x09, 0xfe, 0x80, 0x99, 0xd7, 0x90, 0x67, 0xe5, 0x23, 0xfa, 0x53, 0x9f, 0x8f, 0xc1, 0x73, 0x14, 0x25, 0xe3, 0x6e,
-	0x8b, 0xb6, 0xdb, 0x95, 0xec, 0xb7, 0x48, 0xa8, 0x7d, 0x93, 0x7b, 0x4e, 0x02, 0xf2, 0xf3, 0xfa, 0x40, 0x31, 0xc9,
-	0xbb, 0x4c, 0x13, 0xd8, 0x65, 0x1a, 0xce, 0x54, 0x26, 0x72, 0x50, 0xa6, 0xcb, 0x86, 0x4d, 0xbc, 0xac, 0xdb, 0x60,
-	0x81, 0xcb, 0x26, 0xfe, 0x65, 0x12, 0x28, 0x5d, 0xc9, 0xea, 0x82, 0xb9, 0xdb, 0x97, 0x11, 0x0b, 0x2a, 0xaf, 0xa6,
-	0x60, 0xce, 0xf6, 0xe5, 0xfa, 0x68, 0x9e, 0x42, 0x80, 0xf1, 0x94, 0x3e, 0xcd, 0xfe, 0xdb, 0xed, 0x76, 0xf3, 0xf5,
-	0xb0, 0x39, 0x24, 0xdd, 0x0b, 0x99, 0x39, 0x0f, 0xf6, 0x4e, 0xfb, 0x5b, 0x43, 0x9e, 0xdd, 0xe3, 0x3e, 0xe6, 0xcb,
-	0x97, 0xdd, 0x31, 0x6d, 0x4c, 0x76, 0x33, 0x9a, 0x79, 0x98, 0x29, 0x8e, 0x41, 0x3a, 0xe6, 0x43, 0x3d, 0xaa, 0xb8,
-	0x87, 0x90, 0x24, 0x36, 0x8c, 0x3f, 0x48, 0xec, 0xb0, 0xd7, 0x0f, 0x91, 0x58, 0x3d, 0x23, 0x0f, 0xbe, 0xa5, 0x4d,
-	0xa4, 0xa0, 0xac, 0x21, 0x61, 0xea, 0x26, 0xac, 0xcd, 0x92, 0x76, 0xcc, 0x95, 0xab, 0xd6, 0xb7, 0xc7, 0x17, 0x6a,
-	0x3d, 0xe9, 0x9b, 0x8f, 0x42, 0xf9, 0x81, 0xe6, 0x6a, 0x1f, 0x30, 0xce, 0xd9, 0xef, 0xb7, 0xed, 0x5f, 0x24, 0x4f,
-	0xf1, 0x9a, 0x51, 0x37, 0x0e, 0x96, 0x64, 0x3d, 0x0b, 0x97, 0xba, 0xd2, 0xed, 0xc5, 0x76, 0xf2, 0x3a, 0x6a, 0xba,
-	0x68, 0x4b, 0xed, 0xa7, 0x79, 0xfb, 0xa7, 0xf5, 0xed, 0x9e, 0x14, 0x33, 0x24, 0x5a, 0x10, 0xeb, 0x51, 0x58, 0xe5,
-	0x4d, 0x46, 0x1c, 0xcf, 0x73, 0xb5, 0xa9, 0xf4, 0x79, 0xdf, 0xd2, 0x78, 0x87, 0xe3, 0xd8, 0x9b, 0x21, 0x3a, 0x7d,
-	0xae, 0x76, 0x95, 0xee, 0x76, 0x2f, 0xeb, 0x5b, 0xd9, 0x53, 0x0e, 0x15, 0xab, 0x4b, 0xfd, 0x7a, 0x0c, 0xd7, 0xd4,
-	0x3c, 0x2d, 0x4f, 0xd7, 0x6c, 0x42, 0x8a, 0xb1, 0xc3, 0xbb, 0x31, 0x77, 0x3b, 0x45, 0x61, 0xcc, 0xfd, 0xa2, 0x2c,
-	0x5e, 0xa1, 0x14, 0x6f, 0xcf, 0x45, 0x6b, 0x12, 0xa4, 0x25, 0x04, 0x55, 0x1d, 0xc4, 0x6d, 0xda, 0x0c, 0xb8, 0xb5,
-	0x72, 0xd9, 0x6d, 0x7b, 0x17, 0x22, 0x31, 0xae, 0x3d, 0xf8, 0xa1, 0x4b, 0x3d, 0x6f, 0xaa, 0xd4, 0x5e, 0xef, 0xc6,
-	0x1e, 0x9f, 0x1f, 0xd6, 0xfb, 0xe3, 0xd3, 0x76, 0x7d, 0x7c, 0x21, 0xc3, 0x8e, 0xfa, 0xa1, 0x37, 0x61, 0x36, 0x90,
-	0x9c, 0x57, 0xeb, 0xe9, 0xf4, 0xee, 0x61, 0xf7, 0xdc, 0xc6, 0x69, 0xf2, 0xbc, 0xcb, 0xfb, 0x79, 0xb7, 0xea, 0x9a,
-	0x77, 0xbb, 0xa8, 0xd4, 0x5e, 0x39, 0xe2, 0x76, 0xcd, 0x7e, 0xf0, 0xfc, 0x5c, 0x0f, 0x4c, 0x5e, 0x3c, 0x29, 0x95,
-	0xec, 0x99, 0x24, 0x93, 0x35, 0x4f, 0x55, 0xd2, 0x05, 0x6f, 0xe2, 0x46, 0x51, 0xbf, 0xc9, 0x31, 0x86, 0x15, 0x54,
-	0x5d, 0x73, 0x4f, 0x78, 0xde, 0xbc, 0xbf, 0xbb, 0x6f, 0x9f, 0x36, 0x69, 0xb3, 0xf1, 0x22, 0x94, 0x8f, 0x10, 0x36,
-	0xfd, 0x62, 0x96, 0xcb, 0x7a, 0xcd, 0x8f, 0x48, 0xd2, 0x56, 0x8b, 0x2c, 0x65, 0xed, 0x7e, 0x4b, 0xcd, 0x4f, 0x4a,
-	0xd2, 0xf6, 0x88, 0xb4, 0xee, 0xb6, 0x1f, 0x42, 0x74, 0x76, 0x1b, 0x1a, 0x53, 0x0e, 0xbb, 0x9a, 0x1f, 0x95, 0xa4,
-	0xce, 0xbf, 0x8f, 0x9d, 0xef, 0xe6, 0x70, 0xb4, 0x07, 0xc0, 0x93, 0x92, 0x7a, 0x94, 0xfc, 0x95, 0xba, 0xff, 0x14,
-	0xa6, 0x58, 0xc7, 0x2d, 0xf7, 0x3f, 0xf8, 0xb7, 0xef, 0xff, 0x10, 0x76, 0x56, 0x6b, 0x7e, 0x64, 0xc0, 0x93, 0xda,
-	0x75, 0x6c, 0x3b, 0x8a, 0xb3, 0xda, 0xc9, 0x1c, 0xd6, 0x5e, 0x75, 0xa3, 0x96, 0x54, 0x77, 0x5d, 0x45, 0x3e, 0x1c,
-	0xd4, 0xca, 0x2a, 0xcd, 0x43, 0xbb, 0xaa, 0x90, 0xaf, 0x81, 0x70, 0x99, 0xdf, 0xcd, 0x85, 0xfb, 0x45, 0x7e, 0x32,
-	0x8e, 0xd9, 0x44, 0x97, 0xe6, 0xdd, 0x82, 0x60, 0x5e, 0xf7, 0x8b, 0x97, 0x71, 0x43, 0x9b, 0x99, 0x35, 0x6f, 0xa5,
-	0x73, 0xd7, 0x77, 0xb2, 0x8b, 0xdd, 0x77, 0x1d, 0x16, 0x24, 0x75, 0xda, 0x4c, 0xa7, 0x2a, 0x1c, 0x0a, 0xdf, 0x53,
-	0x90, 0xc5, 0xcf, 0xdb, 0x03, 0xbb, 0xaa, 0x9b, 0xb1, 0x8d, 0x87, 0xb0, 0x0f, 0x79, 0xc1, 0x53, 0x4f, 0xde, 0xbd,
-	0xcb, 0x12, 0x32, 0xed, 0xe2, 0x75, 0x0f, 0x86, 0xb2, 0xf6, 0x69, 0xad, 0x2c, 0x2a, 0x07, 0x0b, 0xe6, 0x94, 0x28,
-	0x17, 0x4a, 0x78, 0xd7, 0x22, 0x29, 0xb0, 0x13, 0x60, 0x7a, 0x93, 0x96, 0x34, 0x26, 0x1d, 0x79, 0x79, 0x13, 0x26,
-	0x7c, 0xe6, 0x8f, 0xa4, 0x3e, 0x49, 0x76, 0x61, 0x9f, 0x38, 0xbb, 0x2e, 0x54, 0x30, 0xac, 0xb2, 0x21, 0xa7, 0x7d,
-	0x22, 0x33, 0x64, 0xde, 0xaf, 0xbe, 0xdb, 0xbc, 0x6e, 0xee, 0x24, 0x80, 0x82, 0x82, 0xf6, 0x8f, 0x83, 0x46, 0xd3,
-	0xc2, 0xed, 0xc5, 0x42, 0xe9, 0xde, 0xf3, 0x7a, 0xe4, 0x37, 0x7e, 0xa3, 0xaa, 0x00, 0xef, 0x44, 0xcf, 0x87, 0x4d,
-	0xc1, 0xa0, 0xd6, 0xfe, 0xc1, 0xa0, 0xc6, 0x34, 0x69, 0xcb, 0x4e, 0xdd, 0x1f, 0x36, 0xef, 0x8a, 0x7f, 0xe2, 0x04,
-	0x03, 0x80, 0x25, 0x9b, 0xf9, 0x1b, 0x69, 0x75, 0xdb, 0x3f, 0x00, 0x83, 0x4a, 0xd0, 0x75, 0xac, 0xd3, 0xdd, 0x6c,
-	0xa5, 0x6b, 0x9d, 0x96, 0xf7, 0xec, 0xff, 0xc5, 0x73, 0x1f, 0x53, 0x2d, 0xc0, 0x71, 0x8c, 0xc6, 0x85, 0xd6, 0xb9,
-	0x9f, 0xe5, 0x0a, 0xeb, 0x69, 0x36, 0x2e, 0xc8, 0x7a, 0xdc, 0xb1, 0xeb, 0x66, 0x07, 0x8d, 0x1d, 0x44, 0xfa, 0x13,
-	0xb9, 0xa9, 0xb8, 0x47, 0xda, 0xdb, 0x29, 0xbc, 0xe1, 0xfe, 0xb1, 0xfd, 0x28, 0xee, 0x72, 0x4c, 0x54, 0x3e, 0xa4,
-	0xdd, 0x7f, 0x3d, 0x84, 0xf8, 0x14, 0xc0, 0x0c, 0x20, 0x3d, 0x55, 0x08, 0xe5, 0x9e, 0x1e, 0x7f, 0x4c, 0xf4, 0x93,
-	0x05, 0x6e, 0x9b, 0x3d, 0xb6, 0x04, 0xaf, 0x75, 0xd3, 0xeb, 0xbe, 0x5a, 0x06, 0xf9, 0xba, 0xe0, 0xa7, 0xc8, 0xe9,
-	0x0f, 0x34, 0x53, 0xba, 0x88, 0x4f, 0x1b, 0xd0, 0x26, 0x74, 0x3f, 0xe6, 0x7a, 0x68, 0x53, 0x3a, 0x0d, 0x01, 0xe7,
-	0x20, 0x69, 0x00, 0x4d, 0x41, 0x5e, 0x6e, 0x6d, 0x2a, 0x07, 0xe1, 0x37, 0x01, 0x91, 0x1c, 0x96, 0x02, 0x02, 0x93,
-	0xa1, 0xd1, 0x9d, 0xe7, 0x0d, 0x7e, 0x3d, 0xe4, 0xb8, 0x41, 0xad, 0x76, 0xa8, 0x93, 0x9d, 0x58, 0xdf, 0x33, 0x1f,
-	0x87, 0x6a, 0x10, 0xaa, 0x8d, 0xf5, 0x30, 0x77, 0x48, 0xa6, 0x8c, 0xe7, 0xd2, 0x33, 0xed, 0xbc, 0xeb, 0x1e, 0x75,
-	0xcf, 0xc3, 0x3a, 0x27, 0x64, 0xfb, 0xf0, 0x7a, 0x1c, 0xff, 0x90, 0x1e, 0xc1, 0xa3, 0xa6, 0x72, 0x9f, 0x60, 0x37,
-	0x02, 0x34, 0x78, 0xda, 0x94, 0x62, 0x2e, 0x9f, 0xd6, 0xb1, 0xcf, 0xe6, 0x83, 0x61, 0x29, 0xff, 0xb5, 0xcf, 0x46,
-	0x61, 0x65, 0x62, 0x7c, 0x26, 0xcd, 0x61, 0x8a, 0x76, 0x56, 0x2a, 0xd2, 0x26, 0xa7, 0xf6, 0x40, 0xb8, 0x93, 0x2d,
-	0x06, 0xb4, 0x69, 0xb3, 0xdd, 0xfd, 0xa7, 0x7d, 0x7e, 0xa0, 0xd6, 0x03, 0xda, 0x9a, 0x9a, 0x36, 0x05, 0x8d, 0xb8,
-	0x86, 0xbe, 0xf3, 0x13, 0x15, 0x23, 0x8c, 0xe9, 0xd9, 0x99, 0xf1, 0x16, 0xa5, 0x4c, 0xf6, 0x1c, 0xcd, 0x24, 0xbd,
-	0x27, 0xc1, 0x71, 0xc3, 0xae, 0x1c, 0xd7, 0x05, 0x71, 0xec, 0x63, 0xb5, 0x20, 0x8e, 0x6f, 0x20, 0xd1, 0xb8, 0x8c,
-	0x14, 0xf3, 0x6c, 0x0f, 0xe3, 0xe6, 0xfd, 0x4b, 0x73, 0x67, 0x49, 0x4a, 0xc7, 0x63, 0xd9, 0xee, 0xbb, 0x8e, 0xa1,
-	0xff, 0xce, 0x63, 0x28, 0x3d, 0x63, 0x31, 0x31, 0xc4, 0xcf, 0xc9, 0x6e, 0xbe, 0xec, 0xf6, 0xa8, 0x11, 0x03, 0x47,
-	0xb8, 0xd2, 0xf4, 0x12, 0x06, 0x0a, 0xcf, 0xe0, 0xcc, 0x58, 0x93, 0x8f, 0xa1, 0x64, 0x26, 0x1f, 0x97, 0x24, 0xfa,
-	0x0f, 0x69, 0x0c, 0x8f, 0xce, 0x4c, 0xf3, 0xc9, 0x34, 0xde, 0xfb, 0xce, 0xc4, 0xfe, 0xa4, 0x9f, 0xbe, 0xd6, 0x85,
-	0x7a, 0x91, 0x8b, 0x61, 0x2a, 0x48, 0xba, 0xeb, 0x29, 0x76, 0xf2, 0x82, 0x47, 0x51, 0xa3, 0xf5, 0x8d, 0xa7, 0xf6,
-	0xfd, 0x59, 0x8a, 0xc3, 0xb1, 0xdf, 0xcd, 0xa0, 0xc7, 0xeb, 0x61, 0xc4, 0xb3, 0x5e, 0xb1, 0xd2, 0xdc, 0xd8, 0x58,
-	0x53, 0x14, 0x0b, 0x8c, 0x59, 0x9e, 0xb0, 0x48, 0xf3, 0x34, 0x57, 0x29, 0xb6, 0x95, 0xc9, 0x5f, 0x6a, 0xab, 0x03,
-	0x80, 0x27, 0x59, 0x4f, 0xc7, 0xed, 0xcb, 0xe6, 0xeb, 0x36, 0x6e, 0xd5, 0x85, 0x29, 0x76, 0xb7, 0xbc, 0x0d, 0xb7,
-	0x69, 0xe6, 0x83, 0x82, 0x65, 0x54, 0xe5, 0x25, 0xd3, 0x94, 0x85, 0x36, 0xf9, 0x29, 0x3d, 0xe7, 0x34, 0x79, 0xce,
-	0x12, 0xf2, 0x75, 0xbd, 0x7f, 0xd9, 0xac, 0xb7, 0x77, 0x9b, 0x7b, 0x7a, 0xdc, 0xd3, 0x8b, 0x72, 0x4f, 0x4f, 0x75,
-	0x61, 0x4c, 0x93, 0x26, 0x33, 0xd9, 0xe0, 0x79, 0x53, 0x5a, 0xd9, 0x9a, 0x72, 0xa4, 0x86, 0x30, 0xf3, 0x27, 0x0f,
-	0x49, 0x05, 0xf5, 0x86, 0xc1, 0x68, 0xda, 0x2f, 0x36, 0x9c, 0xf2, 0x98, 0xa4, 0xdc, 0x4a, 0x0f, 0x69, 0x79, 0x71,
-	0x7a, 0x99, 0x2f, 0x07, 0xa0, 0x5c, 0xe8, 0x51, 0xa4, 0x79, 0x9c, 0x7b, 0x45, 0xb7, 0xc9, 0x5a, 0xba, 0xe2, 0xd6,
-	0x4e, 0x61, 0x47, 0xce, 0xf4, 0x32, 0x3d, 0x11, 0x82, 0xe6, 0xfc, 0x58, 0xa8, 0xd8, 0xf8, 0xa8, 0x13, 0x2c, 0xc6,
-	0xc5, 0xa4, 0x34, 0x59, 0xff, 0x5d, 0xe2, 0x02, 0x7d, 0xa0, 0xcd, 0x93, 0x56, 0x4b, 0xd0, 0x17, 0x5e, 0x2a, 0x59,
-	0x29, 0x81, 0x23, 0x64, 0x61, 0xa1, 0x5d, 0x3c, 0x47, 0x96, 0x1c, 0xcc, 0x0f, 0x27, 0xf6, 0xbb, 0xc7, 0xf6, 0x19,
-	0x1f, 0x51, 0x0c, 0x9b, 0x51, 0x7c, 0x44, 0x31, 0xd0, 0xdd, 0xa7, 0xe9, 0xd8, 0xbe, 0x7d, 0xd8, 0x1c, 0x64, 0xd3,
-	0xf2, 0xdc, 0x7c, 0x2c, 0x15, 0x31, 0x49, 0x4a, 0x38, 0x05, 0x52, 0x2c, 0xee, 0xff, 0x52, 0x4a, 0x9e, 0x46, 0x6d,
-	0x94, 0x9c, 0x77, 0xe9, 0x8f, 0xa1, 0x46, 0xa6, 0x7d, 0xfa, 0x7e, 0xd3, 0xb1, 0x3b, 0x92, 0x02, 0xbb, 0x73, 0x26,
-	0x4a, 0x45, 0x52, 0x24, 0x40, 0xb5, 0x51, 0x53, 0xe1, 0x02, 0x0f, 0xa4, 0xc2, 0x55, 0x5a, 0x7d, 0xee, 0x20, 0x1a,
-	0xe0, 0x49, 0xa1, 0x89, 0x86, 0x54, 0xb6, 0xe0, 0xe6, 0xa9, 0x64, 0x19, 0xe9, 0xe7, 0xc6, 0x20, 0xfd, 0xa9, 0xb1,
-	0xc9, 0xab, 0x26, 0x9a, 0x91, 0xce, 0x3c, 0xc9, 0x41, 0xa9, 0xbe, 0x12, 0x8d, 0x6b, 0x67, 0x9e, 0xc4, 0xa1, 0xf9,
-	0xcb, 0x4b, 0xdc, 0x25, 0x28, 0x4e, 0xe4, 0xd3, 0x74, 0x10, 0xcb, 0x73, 0x37, 0x21, 0xec, 0x27, 0x90, 0x33, 0x67,
-	0xd1, 0x9f, 0xa6, 0xb4, 0xde, 0x44, 0xb8, 0x9f, 0xfb, 0xe3, 0x43, 0xdc, 0x64, 0xfa, 0x61, 0xcc, 0xad, 0x17, 0x18,
-	0x70, 0x7c, 0x3e, 0xd9, 0xed, 0x91, 0xcd, 0x86, 0xe3, 0x82, 0x30, 0x38, 0x8b, 0xa9, 0xec, 0xe1, 0xba, 0x29, 0x8e,
-	0xce, 0xea, 0xc8, 0x9d, 0x99, 0xa7, 0xfa, 0x22, 0xee, 0xfa, 0x7e, 0x2d, 0xca, 0x64, 0x2a, 0xcd, 0x8f, 0x8a, 0xdb,
-	0x1c, 0x76, 0x1e, 0xef, 0x6d, 0x73, 0xa4, 0x87, 0x96, 0x4a, 0xa3, 0xba, 0x27, 0x97, 0xa6, 0x71, 0x12, 0x72, 0x67,
-	0x9c, 0xf5, 0xb4, 0x29, 0xa7, 0xec, 0x7b, 0x33, 0x27, 0x71, 0x4b, 0x74, 0x8a, 0x7a, 0xab, 0xaf, 0xd3, 0x73, 0x5b,
-	0x34, 0x4e, 0x92, 0x74, 0x82, 0xaf, 0x93, 0x24, 0xcd, 0xdf, 0xcd, 0xed, 0xbb, 0xc9, 0x7b, 0x79, 0xb4, 0xf9, 0x8e,
-	0x6f, 0x2a, 0x5a, 0xb6, 0x2c, 0xf2, 0x68, 0x55, 0xd1, 0xc2, 0x21, 0x9b, 0x99, 0x39, 0x87, 0x4e, 0x26, 0x21, 0xc5,
-	0x75, 0xf8, 0x64, 0x48, 0xcb, 0xe4, 0x76, 0xfb, 0xb2, 0x96, 0xe4, 0x1a, 0xcc, 0xec, 0xf4, 0x88, 0x0b, 0xca, 0x8b,
-	0x4c, 0x4c, 0xe1, 0xfc, 0x80, 0x09, 0xc9, 0x34, 0x05, 0xfb, 0xb6, 0xcb, 0x26, 0x60, 0xdd, 0x9e, 0xed, 0x38, 0x8e,
-	0xb7, 0x38, 0x01, 0xcb, 0x0c, 0x84, 0x13, 0x5a, 0xb3, 0x4d, 0x41, 0x7d, 0x7a, 0x3a, 0x72, 0x45, 0xe9, 0x8f, 0x92,
-	0xf4, 0x87, 0x14, 0xf4, 0x0e, 0x42, 0x32, 0xbf, 0x58, 0xe6, 0xa2, 0x9e, 0xd2, 0x66, 0x66, 0x59, 0x30, 0xcd, 0xfe,
-	0x1b, 0x1f, 0xa0, 0xa9, 0x9d, 0xa2, 0x9b, 0x04, 0xdc, 0x09, 0xe8, 0x49, 0xe3, 0x58, 0x29, 0x9d, 0xcd, 0x91, 0x6d,
-	0x0a, 0xef, 0x80, 0x4e, 0xb2, 0xd0, 0x18, 0xe6, 0xb5, 0x41, 0x39, 0xf7, 0x41, 0x41, 0x69, 0x9a, 0x31, 0xea, 0xf5,
-	0x67, 0x3a, 0x1a, 0x95, 0x3d, 0xf7, 0x07, 0xca, 0xe2, 0x88, 0x56, 0x2d, 0xd9, 0x39, 0xb8, 0xe4, 0x3c, 0x5e, 0x3a,
-	0x66, 0x93, 0x81, 0xee, 0xc1, 0x5f, 0xed, 0x4c, 0xe5, 0xf9, 0x94, 0xa2, 0x59, 0x0c, 0x0e, 0x68, 0x31, 0x88, 0x67,
-	0x16, 0xb5, 0xa9, 0x7e, 0x83, 0x39, 0x1f, 0x6f, 0xa4, 0x9b, 0x30, 0x4d, 0xfb, 0xe2, 0xf2, 0xba, 0x45, 0x3f, 0xe8,
-	0xa6, 0x7f, 0x00, 0x30, 0xc7, 0x13, 0xc7, 0x76, 0x36, 0x96, 0x97, 0x6b, 0x98, 0x8e, 0x15, 0x77, 0x80, 0x41, 0xea,
-	0x8a, 0x73, 0x9a, 0xd4, 0x18, 0xc5, 0x22, 0x6d, 0x16, 0xeb, 0xe5, 0x4b, 0x1a, 0x2d, 0x18, 0xb4, 0x1f, 0xed, 0xd8,
-	0x33, 0xe8, 0x38, 0x9d, 0x2e, 0xff, 0xb2, 0xde, 0xc6, 0x19, 0xf7, 0xc5, 0x34, 0xfa, 0x17, 0x0f, 0x62, 0xeb, 0x92,
-	0xda, 0x6d, 0xd2, 0x43, 0x3d, 0x9d, 0xf7, 0xf5, 0xd4, 0xd9, 0x3c, 0x4c, 0xb1, 0x5d, 0x58, 0x53, 0x4f, 0xbd, 0x6b,
-	0x78, 0xee, 0x09, 0x5b, 0x27, 0x3c, 0xf7, 0x34, 0x1b, 0x27, 0x49, 0x84, 0xfc, 0xcd, 0xeb, 0x92, 0x16, 0x71, 0xf2,
-	0xa8, 0xcd, 0x8d, 0xb3, 0xb3, 0x9f, 0xd6, 0xd1, 0xea, 0xda, 0x99, 0xd0, 0xa4, 0xc7, 0xb2, 0xb0, 0xfd, 0x0e, 0x07,
-	0xcf, 0x6c, 0xa5, 0x11, 0x1f, 0x50, 0x9e, 0xa5, 0x6b, 0x3a, 0x37, 0x34, 0x67, 0xd3, 0x6c, 0xad, 0x16, 0xe3, 0xfd,
-	0x82, 0xd9, 0x4c, 0x84, 0x52, 0x73, 0x9d, 0x36, 0xe7, 0x32, 0x33, 0x69, 0xa4, 0x31, 0xed, 0xb9, 0x42, 0xd8, 0xf0,
-	0x51, 0x80, 0x50, 0xc5, 0xe9, 0xe5, 0x82, 0xf1, 0x34, 0xa0, 0x75, 0x35, 0x72, 0x47, 0xc2, 0x01, 0x62, 0x6b, 0xbe,
-	0x57, 0x37, 0x65, 0xda, 0x95, 0x06, 0x8e, 0xbb, 0x70, 0xa5, 0x81, 0x1f, 0x55, 0x89, 0x2a, 0x2c, 0x58, 0x39, 0xba,
-	0x43, 0xe6, 0x6f, 0x6e, 0x29, 0xb6, 0xc3, 0x04, 0xfa, 0xa2, 0xe9, 0x0e, 0x16, 0xd4, 0xd5, 0xcc, 0x6c, 0xcc, 0xa6,
-	0x9d, 0x5f, 0x49, 0x35, 0x3e, 0x54, 0x6e, 0x17, 0xb8, 0x69, 0xf7, 0x47, 0xef, 0xd8, 0xcf, 0x79, 0x53, 0xe7, 0xcc,
-	0x66, 0xf7, 0xef, 0x92, 0x0c, 0xb0, 0x56, 0x9a, 0xcd, 0x4a, 0xf9, 0x66, 0xb7, 0x1d, 0xbb, 0xb9, 0x77, 0x29, 0x7b,
-	0xae, 0x4d, 0x9f, 0x68, 0x4e, 0x9a, 0x1d, 0x72, 0xb6, 0x0a, 0xa3, 0x67, 0xb2, 0x3c, 0xff, 0xc5, 0x27, 0x94, 0x66,
-	0x32, 0x28, 0x5d, 0x4b, 0x33, 0x41, 0x3d, 0x8c, 0xd4, 0x16, 0x1f, 0xf5, 0x52, 0x6d, 0x9b, 0xc3, 0xab, 0x02, 0xa6,
-	0x7d, 0xda, 0xb2, 0x49, 0x73, 0x52, 0xf3, 0x80, 0x82, 0xa3, 0x5a, 0xba, 0x81, 0x65, 0x5f, 0xf7, 0x24, 0x4d, 0x32,
-	0x95, 0xb6, 0xf3, 0x44, 0xb3, 0xbc, 0xf5, 0xae, 0xea, 0x99, 0xbb, 0xf2, 0x4f, 0xca, 0x8e, 0xd3, 0x75, 0x7e, 0xa4,
-	0x3d, 0x75, 0x96, 0x1d, 0xe9, 0x90, 0xa8, 0x71, 0x58, 0x4d, 0x99, 0x8c, 0x47, 0x46, 0xcd, 0x3e, 0x0f, 0x2e, 0x88,
-	0xeb, 0xc1, 0xbc, 0xcf, 0x82, 0x6e, 0x83, 0xca, 0xef, 0x94, 0xd6, 0xec, 0x54, 0xa0, 0x4a, 0x69, 0xf6, 0x0c, 0x8b,
-	0x94, 0xb4, 0x5b, 0x60, 0xb6, 0xa2, 0xf9, 0x38, 0x85, 0x19, 0x02, 0xd5, 0xf0, 0xec, 0xe0, 0xa5, 0x1e, 0xc2, 0x76,
-	0xf7, 0xd0, 0xa5, 0xe6, 0xf3, 0xee, 0x85, 0xc7, 0xd1, 0x9d, 0x8b, 0xcd, 0x5e, 0x79, 0x31, 0xb9, 0xe0, 0x6e, 0x92,
-	0x4c, 0x9d, 0x4d, 0x92, 0x24, 0x17, 0xf6, 0xe1, 0x15, 0x6d, 0x65, 0x98, 0x2b, 0x48, 0x31, 0x42, 0x7f, 0xa4, 0x1c,
-	0x86, 0x9c, 0xb9, 0x08, 0x78, 0x77, 0x50, 0xa9, 0xef, 0xb6, 0x5b, 0x1c, 0xcc, 0xe8, 0xa1, 0x44, 0xcc, 0xea, 0xc2,
-	0x50, 0xda, 0x97, 0x2f, 0x66, 0x10, 0x3a, 0x00, 0x53, 0xc4, 0x2a, 0x67, 0xf4, 0xcb, 0xa2, 0x62, 0xad, 0x35, 0xdd,
-	0xa1, 0x67, 0x21, 0xd9, 0x39, 0x60, 0x3d, 0xe1, 0x0e, 0x31, 0x9b, 0x4d, 0xb8, 0xbb, 0x53, 0x3a, 0x61, 0xd6, 0x50,
-	0x4f, 0x1d, 0xa1, 0x4f, 0x73, 0x62, 0xa8, 0xa2, 0x17, 0xb3, 0x7e, 0x8e, 0x5e, 0x97, 0x6b, 0xe8, 0x2f, 0x47, 0x7a,
-	0x45, 0x0e, 0xde, 0x0e, 0xfd, 0xe5, 0xf9, 0x0e, 0x5e, 0x2c, 0xa5, 0x57, 0x4d, 0x2f, 0xdb, 0xfd, 0xf3, 0xcf, 0xeb,
-	0x97, 0x35, 0x7c, 0xfc, 0xb0, 0xde, 0x84, 0x19, 0x6b, 0x5d, 0x37, 0xf5, 0x8f, 0x3f, 0x5c, 0x7e, 0xf8, 0x54, 0xbd,
-	0xa9, 0xc2, 0xfd, 0xc7, 0xe3, 0xf4, 0x21, 0xd6, 0x7e, 0x44, 0xa2, 0xc5, 0x32, 0x84, 0xa6, 0xb1, 0x80, 0xbd, 0xcd,
-	0x3e, 0xc4, 0x1a, 0x8f, 0x08, 0x5a, 0x12, 0xf0, 0xf7, 0x21, 0x26, 0xe4, 0x03, 0xfd, 0x6d, 0x40, 0x20, 0xd9, 0x10,
-	0x4e, 0x91, 0x88, 0x60, 0xac, 0x66, 0x88, 0x64, 0x25, 0x1a, 0x09, 0xb2, 0x36, 0x42, 0xf1, 0x0c, 0x04, 0x22, 0x51,
-	0x0a, 0x01, 0xb9, 0xc2, 0x0f, 0x37, 0xd5, 0xc5, 0x5c, 0x3e, 0x90, 0x8d, 0x10, 0xc1, 0x01, 0x0b, 0xfe, 0xb1, 0x7b,
-	0x90, 0x99, 0x3e, 0xb0, 0xb1, 0x05, 0xc1, 0x01, 0x03, 0x2c, 0x03, 0x06, 0x90, 0x06, 0x0c, 0x48, 0x3e, 0x60, 0x20,
-	0x78, 0xc0, 0x00, 0x91, 0xb8, 0x22, 0xd4, 0xd7, 0x09, 0x00, 0x16, 0x5d, 0x3e, 0xa5, 0xae, 0x2f, 0xc3, 0xa7, 0x51,
-	0xe2, 0x56, 0x55, 0x7c, 0x37, 0x9c, 0x3e, 0xd1, 0x48, 0x10, 0x92, 0x3e, 0x03, 0xfa, 0xb5, 0x7b, 0xf1, 0x84, 0x3f,
-	0xc0, 0xcb, 0xb9, 0x17, 0xd3, 0x86, 0xd1, 0x23, 0x76, 0xe1, 0x68, 0x4c, 0x74, 0xf4, 0x4d, 0x74, 0xf4, 0x4c, 0x74,
-	0x34, 0x26, 0x3a, 0x96, 0x4c, 0x74, 0xb4, 0x26, 0x3a, 0x5a, 0x13, 0x1d, 0xb5, 0x89, 0x5e, 0xb3, 0xd1, 0x7d, 0x0b,
-	0xae, 0x4e, 0x1f, 0x4e, 0x38, 0x28, 0x3a, 0xc1, 0x80, 0x88, 0x74, 0x38, 0x81, 0xb1, 0x11, 0x26, 0x24, 0x21, 0x3a,
-	0x2b, 0x09, 0xd6, 0xa9, 0xc9, 0xb0, 0xc9, 0xcf, 0x48, 0xbc, 0xb5, 0x88, 0xce, 0x54, 0x82, 0xfd, 0x74, 0x8d, 0x24,
-	0xe6, 0x2c, 0x21, 0x3a, 0x71, 0x09, 0x76, 0xb3, 0x97, 0x38, 0x27, 0x85, 0x89, 0xd1, 0x79, 0x4c, 0x70, 0x21, 0x99,
-	0x89, 0x35, 0x19, 0x4d, 0xb8, 0x4e, 0x6b, 0x82, 0x75, 0x6e, 0x47, 0xf8, 0xca, 0x20, 0x98, 0xe5, 0x84, 0xe8, 0x54,
-	0x67, 0xd8, 0xcd, 0xf7, 0x48, 0x62, 0xd2, 0x13, 0xa2, 0xc3, 0x9a, 0x60, 0x37, 0xb6, 0x89, 0x73, 0x02, 0x9c, 0x18,
-	0x1d, 0xe5, 0x04, 0x17, 0x42, 0x9d, 0x58, 0x13, 0xef, 0x84, 0x9b, 0xa0, 0x27, 0x5c, 0x45, 0x7e, 0x44, 0x33, 0x85,
-	0x88, 0x50, 0x26, 0x13, 0x11, 0xca, 0xb4, 0x82, 0x20, 0x23, 0x18, 0x84, 0x7b, 0xaa, 0x11, 0x29, 0x94, 0x8e, 0x88,
-	0xb8, 0xfa, 0x11, 0xa9, 0xa3, 0xe9, 0xaa, 0x51, 0x12, 0x82, 0xcf, 0x98, 0xdc, 0xd3, 0x14, 0x62, 0x7c, 0x93, 0x97,
-	0xd4, 0x85, 0xd8, 0x82, 0xc9, 0xad, 0xce, 0x10, 0xee, 0x9a, 0xfc, 0xd5, 0x5a, 0x06, 0x65, 0x27, 0x22, 0x27, 0x63,
-	0x10, 0x23, 0x40, 0x04, 0x3b, 0x2a, 0x14, 0x35, 0x01, 0x55, 0x88, 0x10, 0xad, 0x42, 0x04, 0x6b, 0x15, 0x62, 0xd8,
-	0xa8, 0x50, 0x24, 0xde, 0x5a, 0x44, 0xab, 0x10, 0xc1, 0xbe, 0x0a, 0x45, 0x12, 0x55, 0x88, 0x10, 0xad, 0x42, 0x04,
-	0xbb, 0x2a, 0x44, 0x9c, 0xa3, 0x42, 0xc4, 0x68, 0x15, 0x22, 0xb8, 0xa0, 0x42, 0xc4, 0x1a, 0x15, 0x22, 0x5c, 0xab,
-	0x10, 0xc1, 0x5a, 0x85, 0x22, 0x7c, 0x65, 0x10, 0x54, 0x21, 0x42, 0xb4, 0x0a, 0x31, 0xec, 0xaa, 0x50, 0x24, 0x51,
-	0x85, 0x08, 0xd1, 0x29, 0x41, 0xb0, 0x9b, 0x12, 0xc4, 0x39, 0x29, 0x41, 0x8c, 0x4e, 0x09, 0x82, 0x0b, 0x29, 0x41,
-	0xac, 0x49, 0x09, 0xc2, 0x4d, 0x4a, 0x10, 0xae, 0x52, 0x22, 0xa2, 0x99, 0x0a, 0x45, 0x28, 0x53, 0xa1, 0x08, 0x65,
-	0x2a, 0x44, 0x90, 0x51, 0x21, 0xc2, 0x3d, 0x15, 0x8a, 0x14, 0xaa, 0x50, 0x44, 0x5c, 0x15, 0x8a, 0xd4, 0xd1, 0x74,
-	0xd5, 0xa8, 0x10, 0xc1, 0x67, 0x4c, 0xee, 0xa9, 0x10, 0x31, 0xbe, 0xc9, 0x4b, 0x2a, 0x44, 0x6c, 0xc1, 0xe4, 0x56,
-	0x85, 0x08, 0x77, 0x4d, 0xfe, 0x6a, 0x2d, 0x83, 0x2a, 0x14, 0x91, 0x93, 0x31, 0x88, 0x51, 0x21, 0x82, 0x1d, 0x15,
-	0x02, 0x8b, 0xa0, 0x14, 0x21, 0xac, 0xf5, 0x08, 0x39, 0x2d, 0x4a, 0x19, 0x67, 0x94, 0x09, 0xd8, 0xb7, 0x05, 0x58,
-	0x6b, 0x14, 0x72, 0xbe, 0x50, 0x41, 0x0b, 0x54, 0x2b, 0x84, 0xb5, 0x64, 0x21, 0xe7, 0xea, 0x16, 0x36, 0x70, 0xc4,
-	0x0b, 0x69, 0xad, 0x60, 0xc8, 0x15, 0x64, 0x0c, 0x9b, 0x18, 0x2d, 0x43, 0x52, 0x0b, 0x1a, 0x72, 0x5a, 0xd5, 0x80,
-	0xbb, 0xf2, 0x61, 0xd4, 0x37, 0x84, 0xb5, 0xc8, 0x65, 0x9c, 0xab, 0x74, 0xd0, 0x02, 0xe5, 0x0e, 0x61, 0x9d, 0x80,
-	0xc8, 0xb9, 0x59, 0x88, 0x0d, 0x9c, 0x54, 0x44, 0x5a, 0xe7, 0x23, 0x72, 0x85, 0xa4, 0xc4, 0x26, 0x26, 0x33, 0x91,
-	0x34, 0xe9, 0x89, 0xa4, 0xca, 0x51, 0xa0, 0x32, 0x6d, 0x04, 0x3c, 0x13, 0x48, 0xc0, 0x33, 0x95, 0x44, 0xdc, 0x48,
-	0x25, 0x92, 0x9e, 0x5e, 0x02, 0x8f, 0xa2, 0x09, 0xb0, 0xab, 0x9c, 0xc0, 0x1f, 0xfd, 0x21, 0x19, 0x0d, 0x45, 0xee,
-	0x7b, 0x2e, 0xf4, 0xd4, 0x14, 0xe9, 0x33, 0x2e, 0x2c, 0xe9, 0x2a, 0x36, 0x39, 0xe7, 0x42, 0xab, 0xb0, 0x48, 0x96,
-	0x5d, 0xf8, 0x5a, 0xb0, 0x2a, 0x0a, 0x2e, 0xc0, 0x27, 0xdf, 0x98, 0x46, 0x7a, 0x91, 0x73, 0xf4, 0x37, 0x41, 0xa8,
-	0xbe, 0x02, 0x6a, 0xed, 0x15, 0x46, 0x2b, 0x2f, 0x30, 0x46, 0x77, 0x13, 0xf7, 0xd6, 0x05, 0xb5, 0xe6, 0x0a, 0xe3,
-	0x2b, 0x6e, 0xe2, 0x51, 0x6f, 0x05, 0xd4, 0x6a, 0x2b, 0x8c, 0xab, 0xb5, 0x42, 0x3b, 0x4a, 0x2b, 0xa4, 0xd6, 0x59,
-	0x61, 0x0a, 0x2a, 0x2b, 0x0d, 0x8c, 0xc6, 0x0a, 0xa5, 0x15, 0x56, 0x18, 0xad, 0xaf, 0x89, 0xb9, 0xf2, 0x40, 0xd4,
-	0x56, 0x01, 0xb5, 0xb2, 0x02, 0xe3, 0xea, 0x6a, 0xe2, 0x51, 0x55, 0x05, 0xd4, 0x09, 0x29, 0x8c, 0x9b, 0x8e, 0x42,
-	0x3b, 0xc9, 0x28, 0xa4, 0x4e, 0x45, 0x61, 0x0a, 0x89, 0x28, 0x0d, 0x4c, 0x1a, 0x0a, 0x65, 0x92, 0x50, 0x28, 0x95,
-	0x82, 0x89, 0xc8, 0x34, 0x34, 0xa1, 0x99, 0x82, 0x26, 0x34, 0xd3, 0x4f, 0x41, 0x8d, 0x7a, 0x0a, 0xe5, 0x69, 0x67,
-	0xc2, 0x50, 0x39, 0x13, 0xe8, 0xea, 0x66, 0x62, 0x8f, 0xde, 0x10, 0x8c, 0x66, 0x0a, 0x73, 0xde, 0x45, 0x9e, 0x5e,
-	0x0a, 0x59, 0x74, 0x51, 0x49, 0x2b, 0xa5, 0x41, 0xd9, 0x45, 0x56, 0x27, 0x85, 0x2a, 0xb9, 0xe8, 0xd5, 0xb5, 0x1e,
-	0x2a, 0x64, 0x02, 0x4f, 0x9e, 0xd1, 0x8c, 0x3a, 0x0a, 0xe3, 0x68, 0x63, 0x1c, 0x36, 0x0a, 0x23, 0x21, 0x5a, 0x15,
-	0x09, 0xd6, 0x92, 0xc8, 0xb0, 0xd1, 0xc3, 0x48, 0xbc, 0xb5, 0x88, 0x56, 0x42, 0x82, 0x7d, 0x19, 0x8c, 0x24, 0x6a,
-	0x20, 0x21, 0x5a, 0x00, 0x09, 0x76, 0xd5, 0x8f, 0x38, 0x47, 0xfa, 0x88, 0xd1, 0xba, 0x47, 0x70, 0x41, 0xf4, 0x88,
-	0x35, 0x8a, 0x47, 0xb8, 0x96, 0x3b, 0x82, 0xb5, 0xd6, 0x45, 0xf8, 0xca, 0x20, 0xa8, 0x72, 0x84, 0x68, 0x89, 0x63,
-	0xd8, 0xd5, 0xb7, 0x48, 0xa2, 0xb8, 0x11, 0xa2, 0xd3, 0x86, 0x60, 0x37, 0x67, 0x88, 0x73, 0x12, 0x86, 0x18, 0x9d,
-	0x2d, 0x04, 0x17, 0x52, 0x85, 0x58, 0x93, 0x27, 0x84, 0x9b, 0x24, 0x21, 0x5c, 0x65, 0x48, 0x44, 0x33, 0x05, 0x8b,
-	0x50, 0x26, 0x5f, 0x11, 0xca, 0xb4, 0x8b, 0x20, 0x23, 0x5c, 0x84, 0x7b, 0xaa, 0x15, 0x29, 0x94, 0xac, 0x88, 0xb8,
-	0x7a, 0x15, 0xa9, 0xa3, 0xe9, 0xaa, 0x51, 0x2a, 0x82, 0xcf, 0x98, 0xdc, 0xd3, 0x28, 0x62, 0x7c, 0x93, 0x97, 0xd4,
-	0x89, 0xd8, 0x82, 0xc9, 0xad, 0x2e, 0x11, 0xee, 0x9a, 0xfc, 0xd5, 0x5a, 0x06, 0xe5, 0x28, 0x22, 0x27, 0x63, 0x10,
-	0x23, 0x44, 0x04, 0x3b, 0x2a, 0x44, 0xdd, 0x44, 0x19, 0x62, 0x48, 0xeb, 0x10, 0xe3, 0x5a, 0x88, 0x12, 0x6e, 0x94,
-	0x88, 0x98, 0xb7, 0x0e, 0xa4, 0xb5, 0x88, 0x71, 0x5f, 0x8c, 0x88, 0x45, 0x35, 0x62, 0x48, 0xcb, 0x11, 0xe3, 0xae,
-	0x1e, 0x31, 0xe9, 0x08, 0x12, 0x53, 0x5a, 0x91, 0x18, 0x2f, 0x48, 0x12, 0xd3, 0x46, 0x93, 0x98, 0xd0, 0xa2, 0xc4,
-	0xb8, 0x56, 0x25, 0xc2, 0xaf, 0x2c, 0x84, 0xba, 0xc4, 0x90, 0x16, 0xa6, 0x84, 0xbb, 0xca, 0x44, 0x2c, 0x4a, 0x13,
-	0x43, 0x3a, 0x51, 0x18, 0x77, 0x33, 0x85, 0x49, 0x27, 0x55, 0x98, 0xd2, 0xb9, 0xc2, 0x78, 0x21, 0x59, 0x98, 0x36,
-	0xd9, 0xc2, 0x84, 0x49, 0x17, 0x26, 0x54, 0xbe, 0x10, 0x9c, 0x69, 0x14, 0x61, 0x99, 0x48, 0x11, 0x96, 0xa9, 0x14,
-	0x63, 0x46, 0xa6, 0x98, 0xf0, 0x74, 0x8a, 0x38, 0x14, 0x2a, 0x82, 0x5c, 0xa5, 0x22, 0xee, 0x68, 0xbb, 0x6c, 0xb4,
-	0x8a, 0xf1, 0x73, 0x2e, 0xf0, 0xd4, 0x8a, 0xa9, 0x82, 0x0b, 0x4a, 0x7a, 0xc5, 0x74, 0xc9, 0x05, 0x56, 0xb1, 0x98,
-	0xf0, 0x5d, 0xf0, 0xea, 0x58, 0x09, 0x45, 0x8b, 0xa0, 0x93, 0x35, 0x8e, 0x91, 0x2d, 0xc6, 0x1d, 0xdd, 0xa2, 0x4e,
-	0xa1, 0x6e, 0x31, 0xa4, 0x75, 0x8b, 0x71, 0xad, 0x5b, 0x09, 0x37, 0xba, 0x45, 0xcc, 0x5b, 0x07, 0xd2, 0xba, 0xc5,
-	0xb8, 0xaf, 0x5b, 0xc4, 0xa2, 0x6e, 0x31, 0xa4, 0x75, 0x8b, 0x71, 0x57, 0xb7, 0x98, 0x74, 0x74, 0x8b, 0x29, 0xad,
-	0x5b, 0x8c, 0x17, 0x74, 0x8b, 0x69, 0xa3, 0x5b, 0x4c, 0x68, 0xdd, 0x62, 0x5c, 0xeb, 0x16, 0xe1, 0x57, 0x16, 0x42,
-	0xdd, 0x62, 0x48, 0xeb, 0x56, 0xc2, 0x5d, 0xdd, 0x22, 0x16, 0x75, 0x8b, 0x21, 0x9d, 0x34, 0x8c, 0xbb, 0x49, 0xc3,
-	0xa4, 0x93, 0x34, 0x4c, 0xe9, 0xa4, 0x61, 0xbc, 0x90, 0x34, 0x4c, 0x9b, 0xa4, 0x61, 0xc2, 0x24, 0x0d, 0x13, 0x2a,
-	0x69, 0x08, 0xce, 0x74, 0x8b, 0xb0, 0x4c, 0xb7, 0x08, 0xcb, 0x74, 0x8b, 0x31, 0xa3, 0x5b, 0x4c, 0x78, 0xba, 0x45,
-	0x1c, 0xea, 0x16, 0x41, 0xae, 0x6e, 0x11, 0x77, 0xb4, 0x5d, 0x36, 0xba, 0xc5, 0xf8, 0x39, 0x17, 0x78, 0xba, 0xc5,
-	0x54, 0xc1, 0x05, 0x25, 0xdd, 0x62, 0xba, 0xe4, 0x02, 0xab, 0x5b, 0x4c, 0xf8, 0x2e, 0x78, 0x75, 0xac, 0x84, 0xba,
-	0x45, 0x50, 0xd0, 0xad, 0x91, 0x32, 0x0e, 0xeb, 0x96, 0xc1, 0x65, 0xb0, 0x89, 0xea, 0xff, 0x36, 0xaa, 0x56, 0x04,
-	0xb4, 0x66, 0x45, 0x54, 0x2b, 0x16, 0xa1, 0x46, 0xaf, 0x7a, 0xfc, 0xad, 0x01, 0xb4, 0x56, 0x45, 0xd4, 0x57, 0xaa,
-	0x9e, 0x43, 0x9d, 0x8a, 0x80, 0x56, 0xa9, 0x88, 0xba, 0x1a, 0x15, 0x29, 0x47, 0xa1, 0x22, 0xa1, 0xf5, 0x29, 0xa2,
-	0x05, 0x75, 0x8a, 0xa4, 0xd1, 0xa6, 0x08, 0x6b, 0x65, 0x8a, 0xa8, 0xd6, 0xa5, 0x1e, 0xbd, 0xd2, 0x00, 0x6a, 0x52,
-	0x04, 0xb4, 0x22, 0x11, 0xea, 0xea, 0x51, 0xcf, 0xa1, 0x1a, 0x45, 0x40, 0x27, 0x42, 0x44, 0xdd, 0x34, 0x88, 0x94,
-	0x93, 0x04, 0x91, 0xd0, 0x29, 0x10, 0xd1, 0x42, 0x02, 0x44, 0xd2, 0x84, 0x7f, 0x84, 0x4d, 0xf0, 0x47, 0x58, 0x85,
-	0x7e, 0xff, 0x31, 0xd3, 0x9e, 0x1e, 0xc9, 0x94, 0xa7, 0x47, 0x32, 0xdd, 0x89, 0x88, 0x51, 0x9d, 0x08, 0x7b, 0x9a,
-	0xd3, 0x33, 0xa8, 0x38, 0x3d, 0xe0, 0xea, 0x4d, 0xcf, 0x1c, 0x75, 0x17, 0x8d, 0xd6, 0x44, 0xb4, 0x6c, 0x62, 0x4f,
-	0x67, 0x22, 0xe1, 0x9a, 0xb8, 0xa4, 0x31, 0x91, 0xf4, 0x4d, 0x6c, 0xf5, 0x25, 0xc2, 0x9e, 0x89, 0x5f, 0x8d, 0x35,
-	0x50, 0x59, 0x7a, 0xe0, 0xa4, 0x8d, 0x60, 0x66, 0x43, 0x11, 0x75, 0xe6, 0x42, 0x31, 0xf4, 0x51, 0x54, 0x08, 0xd1,
-	0xaa, 0x42, 0xb0, 0x96, 0x15, 0x86, 0x8d, 0xae, 0x44, 0xe2, 0xad, 0x45, 0xb4, 0xb2, 0x10, 0xec, 0x4b, 0x4b, 0x24,
-	0x51, 0x5b, 0x08, 0xd1, 0xe2, 0x42, 0xb0, 0xab, 0x2e, 0xc4, 0x39, 0xf2, 0x42, 0x8c, 0xd6, 0x17, 0x82, 0x0b, 0x02,
-	0x43, 0xac, 0x51, 0x18, 0xc2, 0xb5, 0xc4, 0x10, 0xac, 0x35, 0x26, 0x7e, 0xbe, 0x32, 0x08, 0xaa, 0x0c, 0x21, 0x5a,
-	0x66, 0x18, 0x76, 0x75, 0x26, 0x92, 0x28, 0x34, 0x84, 0xe8, 0x34, 0x20, 0xd8, 0xcd, 0x03, 0xe2, 0x9c, 0x44, 0x20,
-	0x46, 0x67, 0x02, 0xc1, 0x85, 0x54, 0x20, 0xd6, 0xe4, 0x02, 0xe1, 0x26, 0x19, 0x08, 0x57, 0xd9, 0x10, 0xd1, 0x4c,
-	0x71, 0x22, 0x94, 0x49, 0x4e, 0x84, 0x32, 0xcd, 0x21, 0xc8, 0x88, 0x0e, 0xe1, 0x9e, 0xea, 0x44, 0x0a, 0x65, 0x27,
-	0x22, 0xae, 0xee, 0x44, 0xea, 0x68, 0xba, 0x6a, 0x94, 0x87, 0xe0, 0x33, 0x26, 0xf7, 0xb4, 0x87, 0x18, 0xdf, 0xe4,
-	0x25, 0xf5, 0x21, 0xb6, 0x60, 0x72, 0xab, 0x3f, 0x84, 0xbb, 0x26, 0x7f, 0xb5, 0x96, 0x41, 0x09, 0x8a, 0xc8, 0xc9,
-	0x18, 0xc4, 0x88, 0x10, 0xc1, 0x56, 0x85, 0x7e, 0xaa, 0xde, 0x84, 0x69, 0xce, 0x20, 0x7d, 0xe0, 0x39, 0x91, 0x20,
-	0x24, 0x1a, 0x80, 0xa0, 0x11, 0x01, 0x86, 0x69, 0x93, 0x80, 0x64, 0x3a, 0x40, 0xd8, 0x2e, 0x00, 0xb1, 0x49, 0x00,
-	0x8a, 0xd6, 0x00, 0x80, 0x92, 0x58, 0x90, 0x8f, 0x9d, 0x69, 0xd2, 0x87, 0x14, 0x61, 0x09, 0xc1, 0x5e, 0x02, 0x8c,
-	0x21, 0x97, 0x40, 0xea, 0x25, 0x20, 0xb9, 0x6f, 0x81, 0xe0, 0xee, 0x03, 0xc4, 0xdd, 0x07, 0x28, 0x76, 0x9f, 0x81,
-	0x9f, 0x7b, 0x23, 0x8f, 0xd3, 0x07, 0x36, 0xb2, 0x20, 0x6c, 0x64, 0x41, 0x32, 0x23, 0x0b, 0x0c, 0x46, 0x16, 0x90,
-	0x8d, 0x2c, 0x48, 0x32, 0xb2, 0x40, 0xc9, 0xc8, 0x02, 0x91, 0x91, 0x05, 0x60, 0x23, 0x27, 0x24, 0xa4, 0x7c, 0x93,
-	0x06, 0xb1, 0xc4, 0x0f, 0xab, 0xec, 0x03, 0xd7, 0x04, 0x41, 0x40, 0xf2, 0x13, 0x48, 0xbf, 0x1e, 0x74, 0x51, 0x33,
-	0x12, 0xe5, 0x15, 0x8d, 0x43, 0x88, 0xb6, 0x10, 0xc1, 0xda, 0x4c, 0x04, 0xbb, 0xb6, 0x22, 0xce, 0x31, 0x18, 0x31,
-	0xda, 0x6a, 0x04, 0x1b, 0xd3, 0x11, 0x6e, 0xec, 0x47, 0xb8, 0x32, 0x22, 0xa1, 0xda, 0x92, 0x11, 0x46, 0x73, 0x46,
-	0x64, 0x69, 0x90, 0x95, 0x45, 0xb4, 0x75, 0x09, 0x76, 0x4c, 0x1c, 0x19, 0x6b, 0xe7, 0xfe, 0x0d, 0xe7, 0xcc, 0xce,
-	0x11, 0x31, 0x76, 0x8e, 0xb0, 0xb1, 0x73, 0x84, 0x7d, 0x3b, 0x47, 0xce, 0xb3, 0x73, 0x64, 0x8c, 0x9d, 0x23, 0x6c,
-	0xed, 0x1c, 0x71, 0x6b, 0xe7, 0x88, 0x6b, 0x3b, 0x47, 0xd4, 0xd8, 0xb9, 0x87, 0x33, 0x3b, 0xf7, 0xc8, 0xd2, 0x20,
-	0x2b, 0x8b, 0x18, 0x3b, 0x47, 0xd8, 0xb3, 0x73, 0xcf, 0x68, 0x3b, 0xff, 0xda, 0x99, 0x78, 0x2e, 0x1f, 0xe8, 0x7e,
-	0x80, 0x90, 0x61, 0x01, 0x41, 0x9b, 0x02, 0x2c, 0x7f, 0x13, 0x40, 0xb2, 0x24, 0x20, 0x6c, 0x44, 0x80, 0xd8, 0x7e,
-	0x00, 0x45, 0xd3, 0x01, 0x40, 0x56, 0x13, 0x64, 0x2d, 0xe5, 0xf6, 0x57, 0xfe, 0x56, 0x47, 0x44, 0xa8, 0xdf, 0x80,
-	0x60, 0xbf, 0x01, 0x96, 0x7e, 0x03, 0x48, 0xfd, 0x06, 0x84, 0xfb, 0x0d, 0x10, 0xf7, 0x1b, 0xa0, 0xd8, 0x6f, 0x00,
-	0xa8, 0xdf, 0x82, 0xc4, 0x5f, 0x3b, 0xbb, 0x98, 0xd7, 0x0c, 0x64, 0x6c, 0x6b, 0x06, 0x42, 0x5f, 0xce, 0x99, 0x21,
-	0xee, 0x40, 0x5a, 0x6f, 0x20, 0xf0, 0x3e, 0x3b, 0xa2, 0x66, 0x78, 0xad, 0x1d, 0x5e, 0x6b, 0x87, 0xb7, 0xcb, 0x3e,
-	0x98, 0xae, 0xee, 0xfc, 0x8e, 0xed, 0xbc, 0x8e, 0xed, 0x4c, 0x17, 0xf2, 0xef, 0x4e, 0x40, 0xc2, 0xf6, 0x8d, 0xbe,
-	0x04, 0x16, 0x11, 0x63, 0x68, 0x0e, 0xf5, 0x21, 0xd7, 0xb4, 0x77, 0x38, 0x71, 0x78, 0x67, 0x26, 0x0e, 0xef, 0xcc,
-	0xc4, 0xe1, 0x9d, 0x3f, 0x71, 0x78, 0xe7, 0x4d, 0x1c, 0xde, 0x99, 0x89, 0xc3, 0x3b, 0x3b, 0x71, 0x78, 0x67, 0x27,
-	0x0e, 0xef, 0xf4, 0xc4, 0xe1, 0x9d, 0x99, 0x38, 0xbc, 0xeb, 0x62, 0x7d, 0x38, 0x4e, 0x1f, 0x78, 0xe2, 0x20, 0x08,
-	0xf5, 0x1b, 0x90, 0x6c, 0x2a, 0x21, 0x30, 0x4c, 0x25, 0x04, 0xe4, 0xa9, 0x84, 0x20, 0x69, 0xc6, 0x20, 0x50, 0x9a,
-	0x31, 0x08, 0x44, 0x33, 0x06, 0x01, 0xa8, 0xdf, 0x82, 0xe4, 0x1f, 0x4c, 0xbf, 0x39, 0xb4, 0x11, 0x71, 0xfb, 0xdd,
-	0x7a, 0xfd, 0xc6, 0xd0, 0x06, 0xd4, 0x8c, 0xa6, 0xb5, 0xa3, 0x69, 0xed, 0x68, 0x76, 0xd9, 0x07, 0xd3, 0xd5, 0x9d,
-	0xdf, 0xb1, 0x9d, 0xd7, 0xb1, 0x9d, 0xe9, 0x82, 0x0a, 0x6d, 0x20, 0x6c, 0xdf, 0x38, 0xb4, 0x01, 0x31, 0x76, 0xd5,
-	0x2a, 0xfe, 0xae, 0x5b, 0x4f, 0x08, 0x7d, 0x34, 0xdd, 0x3f, 0xfa, 0xdd, 0x3f, 0x7a, 0xdd, 0x3f, 0x9a, 0xee, 0x1f,
-	0x4b, 0xdd, 0x3f, 0xda, 0xee, 0x1f, 0xad, 0x69, 0x8f, 0x79, 0xa0, 0x5c, 0x76, 0x2b, 0x74, 0x8e, 0xed, 0xcb, 0xb4,
-	0x38, 0x07, 0xc4, 0x4b, 0xba, 0x4b, 0x5c, 0x92, 0x03, 0xa8, 0x92, 0xee, 0x52, 0x2f, 0xc4, 0x81, 0xd0, 0xd9, 0x78,
-	0x99, 0x96, 0xdf, 0x80, 0xa8, 0xdc, 0xbb, 0x44, 0x79, 0xbe, 0x34, 0xf2, 0x7c, 0x69, 0xe4, 0xf9, 0xd2, 0x97, 0xe7,
-	0x4b, 0x4f, 0x9e, 0x2f, 0x5d, 0x79, 0xbe, 0x34, 0xf2, 0x7c, 0x69, 0xe5, 0xf9, 0xd2, 0xca, 0xf3, 0x25, 0xca, 0xf3,
-	0xa5, 0x91, 0xe7, 0x4b, 0x5f, 0x9e, 0x2f, 0x3d, 0x79, 0xbe, 0x34, 0xf2, 0x7c, 0x59, 0x92, 0xe7, 0x4b, 0x2b, 0xcf,
-	0x97, 0x46, 0x9e, 0x2f, 0x8d, 0x3c, 0x5f, 0x62, 0xc4, 0x5e, 0x9a, 0x88, 0xbd, 0xf4, 0x23, 0xf6, 0xd2, 0x8b, 0xd8,
-	0x4b, 0x13, 0xb1, 0x97, 0xa5, 0x88, 0xbd, 0xb4, 0x11, 0x7b, 0x69, 0x23, 0xf6, 0xd2, 0x46, 0xec, 0x49, 0x76, 0x5e,
-	0x2e, 0xd3, 0x52, 0x15, 0x10, 0xbb, 0x5b, 0x94, 0x7d, 0xbd, 0x0d, 0x06, 0x7c, 0x86, 0xeb, 0xd8, 0xcf, 0x48, 0x37,
-	0x0d, 0xb2, 0x16, 0x4e, 0x46, 0x64, 0xbc, 0x4e, 0x8e, 0x8c, 0x2c, 0xe4, 0x49, 0xd6, 0xc6, 0xa4, 0x4c, 0xc6, 0xea,
-	0xec, 0xc9, 0x48, 0x9d, 0x48, 0x48, 0x62, 0x20, 0x64, 0xb8, 0x8e, 0xd9, 0x8c, 0xd4, 0x99, 0x96, 0x93, 0x5e, 0x6c,
-	0x67, 0x2d, 0x9c, 0x30, 0xcf, 0x79, 0x27, 0x15, 0xb3, 0x06, 0x3a, 0x25, 0x32, 0xd2, 0x24, 0x41, 0xc6, 0x9a, 0x5c,
-	0x45, 0x76, 0x57, 0xc2, 0xcf, 0x59, 0xc3, 0x4f, 0xe6, 0xac, 0xc5, 0x77, 0x06, 0x6c, 0x52, 0x3c, 0x23, 0x0b, 0xd9,
-	0x9e, 0xb5, 0x39, 0x3b, 0x66, 0xa3, 0x01, 0x19, 0xa9, 0xe5, 0x00, 0x49, 0x54, 0x86, 0x0c, 0xd7, 0x22, 0x91, 0x91,
-	0xae, 0x5e, 0x64, 0x2d, 0x1c, 0xe9, 0xc8, 0x78, 0xad, 0x22, 0x19, 0x59, 0x10, 0x94, 0xac, 0x8d, 0xd1, 0x96, 0x8c,
-	0x35, 0x32, 0x93, 0xb1, 0x4a, 0x71, 0x90, 0x3b, 0x15, 0x54, 0xc5, 0xe8, 0x50, 0x46, 0x5a, 0x49, 0xfa, 0xad, 0xdf,
-	0x2e, 0xae, 0xd3, 0x07, 0xde, 0x29, 0x06, 0x24, 0xdb, 0x24, 0x4e, 0xf8, 0x02, 0x3f, 0x2c, 0xf1, 0xc3, 0x2a, 0xfb,
-	0xc0, 0x8b, 0x47, 0x41, 0x60, 0x4d, 0x98, 0xc0, 0xfc, 0x17, 0x72, 0xd2, 0x1c, 0xe6, 0xb7, 0x6c, 0xbb, 0x34, 0x4d,
-	0xda, 0x7f, 0xeb, 0x86, 0x3f, 0x4e, 0x23, 0xe0, 0x31, 0x03, 0x02, 0x9b, 0xa0, 0x0c, 0xca, 0xeb, 0xd0, 0x75, 0x8e,
-	0xe8, 0x21, 0xbb, 0xaf, 0x43, 0xe7, 0xe4, 0xc2, 0x20, 0x4b, 0x83, 0xac, 0x2c, 0xa2, 0x6d, 0x61, 0x5e, 0x18, 0x56,
-	0x4c, 0xc9, 0x2a, 0xf6, 0xdd, 0x61, 0x31, 0x4d, 0x7a, 0x7b, 0x56, 0x0d, 0xdc, 0x18, 0xc9, 0xbc, 0x3d, 0x9b, 0x18,
-	0x1c, 0x39, 0xda, 0x2b, 0xc3, 0xb5, 0xd5, 0x72, 0xd2, 0xb5, 0x1d, 0xa2, 0x8b, 0x02, 0xbe, 0x2c, 0xe0, 0xab, 0x12,
-	0xae, 0x6d, 0x9a, 0x91, 0x8e, 0x65, 0x91, 0x2f, 0xd9, 0xd7, 0xb4, 0x31, 0x56, 0x56, 0xa9, 0xe8, 0x9a, 0xce, 0x58,
-	0xbc, 0x90, 0x8a, 0x89, 0x8f, 0xe2, 0x88, 0x16, 0x27, 0x44, 0xdb, 0x9a, 0x61, 0xd7, 0xca, 0x91, 0x5c, 0x18, 0x64,
-	0x69, 0x90, 0x95, 0x45, 0xb4, 0x35, 0x09, 0x76, 0xec, 0x18, 0x99, 0x92, 0x05, 0x81, 0x35, 0xb6, 0x8b, 0xdc, 0xc9,
-	0x0c, 0xdc, 0xd8, 0x8b, 0x60, 0x6b, 0xa9, 0xee, 0x27, 0xa6, 0xd3, 0xdf, 0x4a, 0x5f, 0x59, 0x8a, 0x08, 0x6f, 0xf4,
-	0x08, 0x92, 0x95, 0x46, 0x81, 0xa1, 0x1e, 0x0a, 0xc8, 0x45, 0x50, 0x90, 0x54, 0xd5, 0x04, 0x4a, 0xe5, 0x5b, 0x20,
-	0xda, 0xe8, 0x11, 0x80, 0x2b, 0x1a, 0x23, 0xb1, 0xa3, 0x6f, 0x2c, 0xa2, 0x47, 0x40, 0xb0, 0x1e, 0x06, 0xc1, 0xee,
-	0x58, 0x88, 0x73, 0x06, 0x44, 0x8c, 0x1e, 0x15, 0xc1, 0x66, 0x68, 0x84, 0x9b, 0xf1, 0x11, 0xae, 0x06, 0x49, 0xa8,
-	0x1e, 0x69, 0xda, 0x12, 0xd7, 0x88, 0x1e, 0x69, 0xbe, 0x25, 0xae, 0x61, 0x77, 0xa4, 0x66, 0x4b, 0x5c, 0x33, 0x7a,
-	0xa4, 0x6a, 0x4b, 0x5c, 0xe3, 0x66, 0xa4, 0xd9, 0x96, 0xb8, 0x46, 0xcd, 0x48, 0x21, 0x0b, 0xdf, 0x94, 0x70, 0x33,
-	0x6a, 0x24, 0xcd, 0xd8, 0x91, 0xf4, 0x2d, 0x80, 0x2d, 0x3c, 0x3b, 0x20, 0x6f, 0xac, 0x81, 0xa4, 0xb5, 0x09, 0xb2,
-	0xd6, 0x32, 0xc8, 0x6a, 0xfb, 0x20, 0xa7, 0xad, 0x14, 0x3f, 0xbf, 0xb1, 0x88, 0xb6, 0x0c, 0xc1, 0xda, 0x26, 0x04,
-	0xbb, 0xd6, 0x20, 0xce, 0xb1, 0x03, 0x31, 0xda, 0x02, 0x04, 0x9b, 0xb1, 0x13, 0x6e, 0x46, 0x4d, 0xb8, 0x1a, 0x2f,
-	0xa1, 0x6a, 0xa4, 0xef, 0xbb, 0x41, 0x36, 0xf2, 0x41, 0x6d, 0xc6, 0xbf, 0x4f, 0x43, 0x03, 0x24, 0x3b, 0x73, 0x20,
-	0xb0, 0xdd, 0xb0, 0x7f, 0x9f, 0xc6, 0x02, 0x48, 0x3a, 0x46, 0x20, 0x10, 0x8f, 0x00, 0xa0, 0xd8, 0x79, 0x00, 0xf8,
-	0x38, 0x41, 0x42, 0x6e, 0xb2, 0x0f, 0x54, 0x73, 0x10, 0xc1, 0x72, 0x23, 0xf8, 0x42, 0x9e, 0xf6, 0xbe, 0xef, 0x8a,
-	0x8c, 0x7c, 0xf8, 0x84, 0xcd, 0x56, 0xc8, 0x70, 0x9d, 0x01, 0xc4, 0x3e, 0xb6, 0x7e, 0x9f, 0xd4, 0xb2, 0x51, 0x88,
-	0xb6, 0x69, 0xae, 0x96, 0x1a, 0x76, 0xad, 0x6b, 0xd4, 0x52, 0x33, 0xda, 0xce, 0x4a, 0x2d, 0x35, 0x6e, 0x2c, 0x9e,
-	0xa9, 0xa5, 0x46, 0xb5, 0xed, 0xd3, 0xdc, 0x54, 0x23, 0xda, 0x0b, 0xde, 0xdc, 0x54, 0x91, 0x0b, 0x63, 0xc1, 0xa5,
-	0x41, 0x3e, 0x99, 0xab, 0x56, 0xa6, 0x8d, 0xf1, 0x91, 0x99, 0xad, 0x26, 0x06, 0x2c, 0x8c, 0xde, 0x42, 0x58, 0xbb,
-	0x0c, 0x39, 0xed, 0x37, 0xe4, 0x5c, 0xe7, 0x61, 0x03, 0xc7, 0x83, 0x48, 0x6b, 0x37, 0x22, 0x67, 0x7c, 0x89, 0xa4,
-	0x71, 0x28, 0x92, 0xca, 0xab, 0x48, 0x69, 0xd7, 0xe6, 0x5f, 0x12, 0xe0, 0xc2, 0xda, 0xc9, 0xc5, 0x2f, 0x09, 0xf0,
-	0x5a, 0x2c, 0x7c, 0x3f, 0x2c, 0x7d, 0xf8, 0x93, 0x7f, 0x93, 0x95, 0xdf, 0xda, 0x84, 0x80, 0xff, 0xc2, 0x7c, 0xa2,
-	0x13, 0x84, 0x51, 0x20, 0xa0, 0x8e, 0x01, 0x61, 0x74, 0x04, 0x08, 0xe3, 0xfa, 0x5f, 0x68, 0xc7, 0xfb, 0x42, 0x6a,
-	0xdf, 0x0b, 0x63, 0x3c, 0x2f, 0x94, 0xf1, 0xbb, 0x50, 0xca, 0xeb, 0x42, 0x68, 0x9f, 0xe3, 0xab, 0xcb, 0x0e, 0xa8,
-	0xfd, 0x5d, 0x78, 0x75, 0xd9, 0xf2, 0x0b, 0xcf, 0xd6, 0x4b, 0x0f, 0xfc, 0xe4, 0x5d, 0xbe, 0xf2, 0x5a, 0x1a, 0x1f,
-	0x7b, 0xaf, 0xf5, 0x26, 0x32, 0x9a, 0x14, 0xdd, 0x4b, 0x88, 0xf6, 0x2d, 0xc1, 0xda, 0xb1, 0x04, 0xbb, 0x5e, 0x25,
-	0xce, 0x71, 0x29, 0x31, 0xda, 0x9f, 0x04, 0x1b, 0x67, 0x12, 0x6e, 0x3c, 0x49, 0xb8, 0x72, 0x23, 0xa1, 0xda, 0x87,
-	0xe9, 0xad, 0x4c, 0x8d, 0x68, 0xef, 0x79, 0x6f, 0x65, 0x2a, 0x72, 0x61, 0x2c, 0xb8, 0x34, 0xc8, 0x27, 0x73, 0xd5,
-	0xca, 0xb4, 0x31, 0xbe, 0x32, 0x6f, 0x32, 0x26, 0x26, 0xdb, 0x9a, 0x42, 0x7f, 0xe5, 0x84, 0x76, 0x5b, 0xce, 0x6a,
-	0xef, 0xe5, 0xac, 0xeb, 0xc4, 0xbc, 0x89, 0xe3, 0xcb, 0xbc, 0x81, 0x76, 0x69, 0xce, 0x1a, 0xcf, 0xe6, 0xb4, 0x71,
-	0x70, 0x4e, 0x2b, 0x3f, 0xe7, 0xa4, 0x76, 0x77, 0xc6, 0xde, 0x14, 0x09, 0xed, 0x7c, 0xc5, 0xba, 0x31, 0x90, 0xb5,
-	0x59, 0x94, 0x7c, 0xb4, 0x2c, 0x11, 0x9f, 0x4a, 0xb7, 0x5a, 0x95, 0xae, 0x30, 0x61, 0x92, 0xb3, 0x4e, 0xb4, 0x90,
-	0xa1, 0x31, 0x4e, 0x18, 0xd2, 0x11, 0xc2, 0xb8, 0x8e, 0x0d, 0xc6, 0xdd, 0xa8, 0x60, 0xd2, 0x89, 0x07, 0xa6, 0x74,
-	0x24, 0x30, 0x6e, 0x62, 0x80, 0x09, 0xe3, 0x7d, 0x26, 0x94, 0xdf, 0x19, 0xd6, 0x1e, 0x97, 0xf7, 0x1b, 0x0d, 0xa4,
-	0xbd, 0xec, 0xbe, 0xdf, 0xa8, 0xd9, 0x85, 0xb5, 0xe7, 0xd2, 0x42, 0x9f, 0xec, 0x85, 0x2b, 0xdb, 0xca, 0x78, 0xd0,
-	0xbe, 0x0b, 0x98, 0xa8, 0xb8, 0x4b, 0x82, 0xae, 0x23, 0x44, 0x7b, 0x8e, 0x60, 0xed, 0x38, 0x82, 0x5d, 0xbf, 0x11,
-	0xe7, 0xb8, 0x8d, 0x18, 0xed, 0x35, 0x82, 0x8d, 0xd3, 0x08, 0x37, 0x3e, 0x23, 0x5c, 0xb9, 0x8c, 0x50, 0xed, 0xb1,
-	0xb4, 0x3f, 0xa6, 0x11, 0xed, 0x2f, 0x6f, 0x7f, 0x4c, 0x91, 0x0b, 0x63, 0xc1, 0xa5, 0x41, 0x3e, 0x99, 0xab, 0x56,
-	0xa6, 0x8d, 0xf1, 0x94, 0xd9, 0x31, 0x4b, 0x4c, 0x5a, 0x02, 0x37, 0x0a, 0xd1, 0x8e, 0xca, 0x97, 0xc0, 0x1a, 0x76,
-	0x1d, 0x65, 0x96, 0xc0, 0x9a, 0xd1, 0x8e, 0x52, 0x4b, 0x60, 0x8d, 0x1b, 0x47, 0x65, 0x4b, 0x60, 0x8d, 0x6a, 0x47,
-	0xa5, 0x73, 0xe8, 0x1a, 0xd1, 0x8e, 0xf2, 0xce, 0xa1, 0x2b, 0x72, 0x61, 0x2c, 0xb8, 0x34, 0xc8, 0x27, 0x73, 0xd5,
-	0xca, 0xb4, 0x31, 0x8e, 0x32, 0x67, 0xb7, 0x99, 0xf9, 0xd0, 0xf9, 0x88, 0x0f, 0x16, 0x7f, 0x48, 0xee, 0x01, 0x84,
-	0x3c, 0x03, 0x08, 0x3a, 0x05, 0x60, 0x7b, 0x50, 0xf9, 0x43, 0x72, 0x05, 0x20, 0xec, 0x05, 0x80, 0xd8, 0x01, 0x00,
-	0x45, 0xdb, 0x03, 0x40, 0x66, 0x17, 0x64, 0x2d, 0x67, 0x75, 0x3f, 0xc8, 0x91, 0x20, 0x41, 0xf8, 0x48, 0x90, 0x20,
-	0xde, 0xe9, 0xe2, 0x0f, 0xd9, 0x91, 0x20, 0x01, 0xd5, 0xe9, 0xe2, 0x0f, 0x70, 0x24, 0x48, 0x20, 0x7d, 0x88, 0xf8,
-	0x43, 0x3a, 0x12, 0x24, 0x00, 0x1f, 0x5d, 0x49, 0x88, 0x3a, 0xfe, 0xf6, 0xa1, 0x82, 0xfd, 0x94, 0x0f, 0xf2, 0x00,
-	0x58, 0x10, 0x7e, 0xea, 0x0b, 0x88, 0xb3, 0x31, 0xf4, 0x21, 0x7b, 0xbe, 0x0b, 0x20, 0x3c, 0xd4, 0x15, 0x54, 0x6d,
-	0x12, 0x7d, 0x80, 0xc7, 0xb7, 0x02, 0xe9, 0xad, 0xa1, 0x0f, 0xfd, 0x83, 0x5a, 0xf9, 0x60, 0xba, 0xba, 0xf3, 0x3b,
-	0xb6, 0xf3, 0x3a, 0xb6, 0x33, 0x5d, 0xd0, 0x4f, 0x5c, 0x85, 0xb0, 0x7d, 0x4b, 0xcf, 0x56, 0x05, 0x51, 0x5b, 0x53,
-	0x1f, 0xec, 0xf1, 0xb7, 0x2b, 0x3c, 0x7f, 0x7e, 0x65, 0xce, 0x9f, 0x5f, 0xf9, 0xe7, 0xcf, 0xaf, 0xbc, 0xf3, 0xe7,
-	0x57, 0xe6, 0xfc, 0xf9, 0x55, 0xe9, 0xfc, 0xf9, 0x95, 0x3d, 0x7f, 0x7e, 0x65, 0xcf, 0x9f, 0x5f, 0xe9, 0xf3, 0xe7,
-	0x57, 0xe6, 0x8c, 0xd3, 0x35, 0x9e, 0xa2, 0xb8, 0x36, 0x47, 0x27, 0xae, 0xfd, 0xf3, 0x12, 0xd7, 0xde, 0x21, 0x89,
-	0x6b, 0x73, 0x32, 0xe2, 0xba, 0x74, 0x1c, 0xe2, 0xda, 0x9e, 0x81, 0xb8, 0x36, 0x07, 0x1f, 0xae, 0xcd, 0x69, 0x87,
-	0x6b, 0x54, 0xc4, 0x6b, 0x23, 0x86, 0xd7, 0x05, 0x1d, 0xbc, 0xee, 0x5c, 0x24, 0xf7, 0xf8, 0x68, 0xc6, 0xf8, 0xd1,
-	0x1f, 0xe3, 0x47, 0x6f, 0x8c, 0x1f, 0xcd, 0x18, 0x3f, 0x96, 0xc6, 0xf8, 0xd1, 0x8e, 0xf1, 0xa3, 0x3e, 0xa8, 0x78,
-	0xcd, 0x2e, 0x12, 0x60, 0x21, 0x8f, 0x69, 0xae, 0x3b, 0xa9, 0x1e, 0xa5, 0x0f, 0xab, 0xec, 0x83, 0x3a, 0xb2, 0x7d,
-	0x8d, 0x4a, 0x9c, 0xc0, 0xd8, 0x08, 0x7d, 0x4c, 0x88, 0x36, 0x02, 0xc1, 0xae, 0x25, 0x88, 0x73, 0xcc, 0x41, 0x8c,
-	0xb6, 0x09, 0xc1, 0x05, 0xc3, 0x10, 0x6b, 0xac, 0x43, 0xb8, 0x0e, 0x03, 0x82, 0x75, 0x2c, 0x98, 0x1d, 0x3f, 0x46,
-	0x74, 0x54, 0x9c, 0xdb, 0xf1, 0x23, 0xf2, 0xa3, 0xb9, 0xaf, 0x09, 0x12, 0x82, 0xcf, 0xd8, 0xc7, 0x0b, 0x17, 0x62,
-	0x7c, 0xfb, 0x94, 0x02, 0x87, 0xd8, 0x82, 0x7d, 0x6c, 0x08, 0x11, 0xae, 0xe2, 0x48, 0xf6, 0x32, 0xf3, 0x58, 0x58,
-	0x9a, 0xe8, 0x58, 0x59, 0x44, 0xc7, 0x96, 0xd9, 0xb9, 0x4c, 0x4c, 0xb4, 0x36, 0x06, 0x18, 0x21, 0xda, 0x80, 0x04,
-	0xbb, 0x06, 0x24, 0xce, 0x31, 0x20, 0x31, 0xda, 0x80, 0x04, 0x17, 0x0c, 0x48, 0xac, 0x31, 0x20, 0xe1, 0x3a, 0xc0,
-	0x08, 0xd6, 0x01, 0x16, 0x61, 0x0c, 0x30, 0x42, 0x74, 0x80, 0x31, 0xec, 0x06, 0x58, 0x24, 0x3f, 0x9a, 0xfb, 0x9a,
-	0x00, 0x23, 0xf8, 0x8c, 0x7d, 0xbc, 0x00, 0x23, 0xc6, 0xb7, 0x4f, 0x29, 0xc0, 0x88, 0x2d, 0xd8, 0xc7, 0x06, 0x18,
-	0xe1, 0x2a, 0xc0, 0xd2, 0x9b, 0x2c, 0xe3, 0x3c, 0x16, 0x96, 0x26, 0x3a, 0x56, 0x16, 0xd1, 0x01, 0x66, 0xde, 0x64,
-	0x11, 0xc6, 0x3f, 0xf1, 0x97, 0xe3, 0xc6, 0x98, 0xdf, 0x3b, 0xf1, 0x97, 0xb7, 0xf0, 0x0c, 0x7b, 0xe6, 0xc4, 0x5f,
-	0x4e, 0x96, 0x8c, 0x7c, 0xee, 0xc4, 0x5f, 0xce, 0x9a, 0x80, 0x3c, 0x73, 0xe2, 0x2f, 0x23, 0xb3, 0xe0, 0x74, 0xce,
-	0x96, 0x14, 0x48, 0x3f, 0x50, 0x01, 0xfd, 0x58, 0xf8, 0x7b, 0x36, 0x68, 0x91, 0xfc, 0xae, 0x9d, 0xdd, 0x00, 0x46,
-	0xfe, 0x9c, 0x9d, 0x8b, 0xc1, 0x8c, 0x6d, 0xce, 0xda, 0xd9, 0x09, 0x6c, 0x64, 0x75, 0x78, 0xe7, 0x67, 0x6d, 0xc6,
-	0x5e, 0x3c, 0x2e, 0x0b, 0x71, 0xba, 0x2a, 0xe1, 0x26, 0xec, 0xfd, 0xb3, 0x36, 0xcc, 0xdf, 0xe0, 0x7b, 0x44, 0x37,
-	0xe6, 0x3d, 0xa2, 0x1b, 0xf3, 0x1e, 0xd1, 0x4d, 0xe5, 0xbe, 0x47, 0x74, 0xe3, 0xbd, 0x47, 0x74, 0x63, 0xde, 0x23,
-	0xba, 0xb1, 0xef, 0x11, 0xdd, 0xd8, 0xf7, 0x88, 0x6e, 0xf4, 0x7b, 0x44, 0x37, 0xe6, 0x3d, 0xa2, 0x9b, 0x2e, 0x53,
-	0x87, 0xb3, 0xf4, 0x81, 0x27, 0xc5, 0x82, 0x64, 0x93, 0x62, 0x81, 0x61, 0x52, 0x2c, 0x20, 0x4f, 0x8a, 0x05, 0x51,
-	0x93, 0x62, 0x21, 0xd2, 0xa4, 0x58, 0x20, 0x3e, 0xf8, 0x2f, 0x08, 0xaf, 0x9e, 0x12, 0x02, 0x2b, 0xa7, 0x9b, 0xb4,
-	0xea, 0x03, 0x84, 0x5f, 0x97, 0x17, 0x24, 0x7b, 0x7d, 0x58, 0x60, 0x58, 0x0a, 0x0b, 0xc8, 0x2f, 0x0d, 0x0b, 0x92,
-	0xde, 0x08, 0x16, 0x28, 0x19, 0x59, 0x20, 0x32, 0xb2, 0x00, 0xd4, 0x6f, 0xb9, 0xea, 0x76, 0xb7, 0xc5, 0x45, 0xef,
-	0x0d, 0x2f, 0x03, 0x05, 0xc8, 0xc6, 0xd1, 0x9a, 0x91, 0xf1, 0x32, 0x10, 0x11, 0x0c, 0x1f, 0x81, 0xbd, 0x91, 0xe1,
-	0x32, 0x10, 0x9a, 0x9a, 0xf1, 0xb6, 0x76, 0xbc, 0xad, 0x1d, 0xef, 0x97, 0xd3, 0xd7, 0x2f, 0x6d, 0xd6, 0x97, 0x0d,
-	0xfa, 0x68, 0x63, 0x62, 0x68, 0x93, 0x96, 0x3b, 0x09, 0xda, 0xe1, 0xe5, 0x3b, 0x33, 0xdc, 0x9d, 0x3f, 0x38, 0x58,
-	0x4a, 0x02, 0xc8, 0xb9, 0x21, 0x48, 0x1e, 0x75, 0x40, 0xa4, 0xa4, 0x11, 0x88, 0xa2, 0x0e, 0x10, 0x4e, 0x91, 0x84,
-	0xf0, 0x52, 0x4c, 0x92, 0x66, 0x8f, 0xae, 0xdb, 0xab, 0x5d, 0x93, 0x80, 0x90, 0xb7, 0x10, 0x41, 0x29, 0x17, 0xfc,
-	0xd0, 0x3e, 0x6d, 0x4c, 0x70, 0x1c, 0xf1, 0x8f, 0x1f, 0x8d, 0x71, 0x8e, 0xbe, 0x71, 0x8e, 0x9e, 0x71, 0x8e, 0xc6,
-	0x38, 0xc7, 0x92, 0x71, 0x8e, 0xd6, 0x38, 0x47, 0xeb, 0xfc, 0xa3, 0x0e, 0xf6, 0x6f, 0xd8, 0x73, 0xf8, 0xce, 0x9e,
-	0x1b, 0xf3, 0x6d, 0x3d, 0x37, 0xde, 0xf7, 0xf4, 0xdc, 0xa4, 0xd3, 0x53, 0xc9, 0xba, 0xf9, 0xe9, 0x29, 0x0d, 0x6b,
-	0x1d, 0x75, 0x4e, 0x4f, 0x69, 0xce, 0x51, 0xd4, 0xfc, 0xf4, 0x94, 0x86, 0x8d, 0xb6, 0xaa, 0xd3, 0x53, 0x1a, 0x57,
-	0x2a, 0x9b, 0x9f, 0x9e, 0x52, 0x30, 0xea, 0x6d, 0x3e, 0x01, 0xd7, 0xb0, 0xab, 0xbc, 0x66, 0x02, 0xae, 0x19, 0xad,
-	0xc1, 0xee, 0x04, 0x5c, 0xb3, 0x46, 0x8d, 0xf3, 0x09, 0xb8, 0x86, 0xb5, 0x2e, 0x47, 0x18, 0xc5, 0x99, 0x10, 0x1d,
-	0xbb, 0x04, 0x6b, 0x99, 0x26, 0xd8, 0xd5, 0x6a, 0xe2, 0x1c, 0x59, 0x23, 0x46, 0xab, 0x18, 0xc1, 0x46, 0xca, 0x08,
-	0x37, 0x21, 0x4d, 0xb8, 0x8a, 0x6b, 0x42, 0xb5, 0x92, 0x47, 0x58, 0x67, 0x2c, 0xa3, 0xb9, 0xa6, 0x47, 0xd4, 0x0e,
-	0xdf, 0xa8, 0x3b, 0xc1, 0x5a, 0xe2, 0x19, 0xf6, 0xb2, 0x9d, 0xb8, 0xa2, 0x55, 0x5c, 0xc5, 0x27, 0xca, 0x37, 0x98,
-	0xd5, 0x7e, 0xc2, 0x0b, 0x06, 0x33, 0x55, 0x20, 0xc2, 0x1b, 0x13, 0x16, 0xa6, 0x1e, 0x10, 0x6c, 0x8a, 0x42, 0xc4,
-	0x77, 0xe6, 0x96, 0xa6, 0x3c, 0x10, 0x7c, 0xc6, 0x30, 0x5e, 0xa1, 0x20, 0x46, 0x0b, 0x22, 0xc1, 0x05, 0x55, 0x24,
-	0xd6, 0x48, 0x23, 0xe1, 0xba, 0x78, 0x10, 0xac, 0x2b, 0x48, 0xfe, 0x8e, 0xbf, 0x12, 0x84, 0xbd, 0x09, 0x19, 0x53,
-	0x50, 0x08, 0xd6, 0x55, 0x85, 0x61, 0xb7, 0xb4, 0x44, 0xd2, 0xab, 0x2f, 0x91, 0x39, 0x9a, 0xfe, 0x99, 0x4a, 0x43,
-	0xf0, 0x19, 0x3b, 0x7b, 0x35, 0x87, 0x18, 0xdf, 0xce, 0xa5, 0xea, 0x43, 0x6c, 0xc1, 0xce, 0xb6, 0x0e, 0x11, 0xee,
-	0x26, 0xed, 0x37, 0x33, 0xd6, 0x93, 0xa9, 0x37, 0xa6, 0x36, 0x11, 0xec, 0x15, 0xa8, 0xfc, 0xd0, 0xab, 0x78, 0xcf,
-	0x39, 0xf4, 0xea, 0x93, 0xa6, 0x64, 0x95, 0x0e, 0xbd, 0xfa, 0x2d, 0xbc, 0xf2, 0xe5, 0x1c, 0x7a, 0xf5, 0x49, 0x5b,
-	0xca, 0xbc, 0x43, 0xaf, 0x3e, 0xab, 0xcb, 0x9a, 0x73, 0xe8, 0xd5, 0x25, 0xb3, 0x12, 0xe7, 0x2c, 0xfe, 0x7d, 0xd2,
-	0x2f, 0x77, 0xfe, 0xe2, 0xdf, 0xe7, 0x4d, 0xe9, 0x2b, 0x2f, 0xfe, 0xfd, 0x36, 0xb6, 0x0c, 0x3a, 0x8b, 0x7f, 0x9f,
-	0x34, 0x25, 0x11, 0xc8, 0xac, 0x30, 0x22, 0x6e, 0x12, 0x0e, 0x49, 0x53, 0x24, 0x91, 0xf4, 0x4b, 0x25, 0xb6, 0xf0,
-	0x4a, 0x03, 0xf2, 0xa6, 0x0a, 0x20, 0x69, 0x6b, 0x01, 0xb2, 0x36, 0x1b, 0x91, 0xd5, 0x39, 0x89, 0x9c, 0x29, 0xa7,
-	0x40, 0x1a, 0x99, 0xca, 0x38, 0x55, 0x5a, 0xf1, 0xe5, 0xc2, 0xc2, 0x1f, 0xb3, 0x65, 0x16, 0x49, 0x53, 0x6c, 0x33,
-	0xd2, 0x55, 0x3c, 0x6c, 0xf1, 0x1d, 0xeb, 0xfa, 0xe5, 0x17, 0x1b, 0x9c, 0x33, 0xbf, 0x53, 0x8a, 0x91, 0x3d, 0x6b,
-	0x7e, 0x5b, 0x96, 0x81, 0xdc, 0x14, 0x02, 0xd4, 0x96, 0x68, 0x24, 0x6d, 0xa1, 0x06, 0x76, 0x57, 0xf8, 0x53, 0xb6,
-	0x68, 0x23, 0xf9, 0x5d, 0x03, 0xbb, 0x05, 0x1c, 0x79, 0x53, 0x5e, 0x90, 0x2c, 0x15, 0x19, 0x6c, 0x63, 0x4b, 0x0d,
-	0xb2, 0xa6, 0xb0, 0x23, 0x69, 0xca, 0x3b, 0x90, 0xb6, 0xc8, 0x03, 0xb9, 0x2f, 0x84, 0xb0, 0x2d, 0xf8, 0x48, 0x9a,
-	0xb2, 0x9f, 0x91, 0x7e, 0xf1, 0x07, 0xd4, 0x9d, 0x02, 0x00, 0x7f, 0x2c, 0x8c, 0xc4, 0x4e, 0x07, 0x90, 0xfc, 0xae,
-	0x07, 0xdd, 0xa9, 0x01, 0xf2, 0xe7, 0x3c, 0x58, 0x9c, 0x26, 0x60, 0x9b, 0xb3, 0x1e, 0x74, 0xa6, 0x0c, 0xc8, 0x9e,
-	0x11, 0xa9, 0x6f, 0x05, 0x3b, 0x9d, 0x0a, 0x73, 0x02, 0x3b, 0x95, 0x40, 0xd2, 0x4e, 0x28, 0x3e, 0x76, 0xb3, 0x88,
-	0xc9, 0x20, 0x7d, 0xa0, 0xcb, 0x01, 0x21, 0xe5, 0x07, 0x04, 0xad, 0x0d, 0xb0, 0xdc, 0x1c, 0x40, 0xb2, 0x2b, 0x20,
-	0x6c, 0x28, 0x80, 0xd8, 0x3a, 0x00, 0x45, 0x93, 0x00, 0x40, 0x61, 0x2e, 0x08, 0xa9, 0xf0, 0x38, 0x01, 0x1c, 0xec,
-	0x09, 0x49, 0xaf, 0x31, 0x4c, 0x14, 0xa2, 0x07, 0x99, 0xbf, 0xc6, 0xa0, 0x61, 0x77, 0xb8, 0xe6, 0x35, 0x06, 0xcd,
-	0xe8, 0x81, 0xab, 0xd7, 0x18, 0x34, 0x6e, 0x4c, 0x90, 0xbd, 0xc6, 0xa0, 0x51, 0x6d, 0x8c, 0x08, 0x6b, 0x8b, 0x44,
-	0xd4, 0x98, 0x25, 0x7f, 0x69, 0x60, 0xe2, 0xc1, 0xda, 0x40, 0xce, 0x4b, 0x03, 0x2e, 0xe7, 0x9a, 0xca, 0x7f, 0x69,
-	0xc0, 0xa5, 0xb5, 0xd1, 0xbc, 0x97, 0x06, 0x5c, 0xd2, 0x98, 0xcf, 0xbe, 0x34, 0xe0, 0x52, 0xda, 0x90, 0xc0, 0x69,
-	0x6b, 0x02, 0x65, 0x4c, 0x8a, 0xe7, 0xef, 0x27, 0x16, 0xd4, 0xe6, 0x34, 0xe7, 0xef, 0x1d, 0xc6, 0x35, 0xa5, 0x77,
-	0xfe, 0xde, 0x21, 0xb5, 0x19, 0xed, 0xf9, 0x7b, 0x87, 0x32, 0x26, 0xd4, 0xe7, 0xef, 0x1d, 0x42, 0x9b, 0x2f, 0x31,
-	0xda, 0x78, 0x89, 0x30, 0xa6, 0x4b, 0x07, 0xdb, 0x27, 0x0a, 0xd1, 0x46, 0xcb, 0x0f, 0xb6, 0x6b, 0xd8, 0x35, 0x97,
-	0x39, 0xd8, 0xae, 0x19, 0x6d, 0x28, 0x75, 0xb0, 0x5d, 0xe3, 0xc6, 0x44, 0xd9, 0xc1, 0x76, 0x8d, 0x6a, 0xe3, 0x44,
-	0x58, 0x5b, 0x26, 0xa2, 0xc6, 0x2c, 0xfa, 0x18, 0xf9, 0xc4, 0x27, 0xb4, 0x91, 0xdc, 0x63, 0xe4, 0x05, 0xd6, 0x35,
-	0x59, 0xe9, 0x18, 0x79, 0xa1, 0x81, 0x36, 0xa0, 0x7f, 0x8c, 0xbc, 0x40, 0x1b, 0x73, 0x7a, 0xc7, 0xc8, 0x0b, 0xa4,
-	0x36, 0x6e, 0xc6, 0x6a, 0x1b, 0x67, 0xa4, 0x31, 0xb5, 0x9c, 0xc1, 0x9e, 0x68, 0x48, 0x9b, 0x57, 0x9d, 0xc1, 0x36,
-	0xb8, 0x6b, 0x52, 0x7b, 0x06, 0xdb, 0x50, 0xda, 0x8c, 0xfa, 0x0c, 0xb6, 0x21, 0x8c, 0xe9, 0xf2, 0x33, 0xd8, 0x06,
-	0xd6, 0xe6, 0x22, 0x5c, 0x1b, 0x8a, 0x60, 0x63, 0x22, 0xfa, 0x73, 0x68, 0x22, 0x86, 0xb4, 0x89, 0x18, 0xd7, 0x26,
-	0x62, 0xdc, 0x35, 0x11, 0x93, 0x8e, 0x89, 0x98, 0xd2, 0x26, 0x62, 0xdc, 0x98, 0x88, 0x09, 0x63, 0x22, 0x26, 0x94,
-	0x89, 0x18, 0xd6, 0x26, 0x22, 0x5c, 0x9b, 0x88, 0x7f, 0x48, 0x41, 0x9b, 0xa8, 0xbf, 0x2b, 0x1a, 0x28, 0x02, 0xda,
-	0x3c, 0x11, 0xd5, 0xc6, 0x89, 0xa8, 0x6b, 0x9a, 0x48, 0x39, 0x86, 0x89, 0x84, 0x36, 0x4b, 0x44, 0x8d, 0x51, 0x22,
-	0x6c, 0x4c, 0x12, 0x61, 0x65, 0x90, 0x08, 0x6a, 0x73, 0xf4, 0xa8, 0x36, 0x46, 0xfc, 0x86, 0x77, 0x65, 0x8a, 0x45,
-	0x67, 0x86, 0x21, 0x3f, 0x8b, 0x5e, 0x24, 0x1b, 0x20, 0xc4, 0x07, 0x62, 0x01, 0xca, 0x76, 0x5c, 0x00, 0x87, 0x7d,
-	0x16, 0x40, 0x79, 0x77, 0x05, 0xa0, 0xb4, 0x5f, 0x02, 0x58, 0x5a, 0x2d, 0x02, 0x46, 0x67, 0x1b, 0x01, 0xe1, 0xed,
-	0x12, 0x81, 0xde, 0xca, 0x13, 0xfd, 0x45, 0xfa, 0xde, 0x73, 0x40, 0xb2, 0x85, 0x8e, 0xe0, 0xf0, 0x6d, 0xe7, 0x0b,
-	0xf3, 0x45, 0xe7, 0x0b, 0xff, 0x3b, 0xce, 0x17, 0xde, 0xd7, 0x9b, 0x2f, 0xcc, 0x37, 0x9b, 0x2f, 0x4a, 0x5f, 0x6a,
-	0xbe, 0xb0, 0xdf, 0x67, 0xbe, 0x30, 0x5f, 0x65, 0xbe, 0x30, 0xdf, 0x62, 0xbe, 0xc0, 0x8d, 0xa0, 0x85, 0xd9, 0xfd,
-	0x59, 0xa4, 0x2d, 0x1f, 0x40, 0xbc, 0x65, 0xd6, 0x02, 0x37, 0x77, 0x00, 0x54, 0x0b, 0xaa, 0x85, 0x6c, 0xe3, 0x00,
-	0xa4, 0x97, 0x45, 0x0b, 0xbd, 0x61, 0xb3, 0x48, 0xbb, 0x34, 0x82, 0xd0, 0xf2, 0x11, 0x81, 0x3e, 0x2a, 0x87, 0xf5,
-	0x9c, 0x91, 0xce, 0x99, 0x83, 0xe4, 0x95, 0xf4, 0x5d, 0x87, 0x00, 0xd1, 0x32, 0x36, 0x83, 0xb2, 0x03, 0xb7, 0x82,
-	0xe3, 0x89, 0x5b, 0x40, 0xe1, 0xfb, 0x0e, 0x01, 0x4e, 0x27, 0x71, 0x05, 0x92, 0x13, 0xb7, 0x82, 0xc9, 0x91, 0xdb,
-	0x84, 0xf1, 0x5e, 0x09, 0x2f, 0xf7, 0x16, 0xdd, 0x06, 0xc9, 0x68, 0x9a, 0x3e, 0xf0, 0xc2, 0x4e, 0x90, 0xec, 0xe0,
-	0x8c, 0xc0, 0xb0, 0xc8, 0x13, 0x90, 0x8f, 0xc8, 0x08, 0x92, 0xce, 0xbc, 0x08, 0x94, 0x0e, 0xba, 0x24, 0x68, 0x97,
-	0x75, 0x71, 0x67, 0x0d, 0xb9, 0x2b, 0x58, 0x6d, 0xe7, 0x5a, 0x6d, 0x67, 0xcd, 0xa3, 0xbf, 0x8d, 0x11, 0x18, 0xc7,
-	0x70, 0xe9, 0xfb, 0x18, 0x01, 0x4a, 0xa7, 0xda, 0x13, 0x94, 0x4e, 0x5b, 0x4b, 0xb0, 0xc3, 0xbe, 0x83, 0x04, 0xce,
-	0x31, 0xfb, 0x60, 0x32, 0xc0, 0xdd, 0x56, 0x58, 0x78, 0x7b, 0x09, 0x0b, 0xb3, 0x81, 0xb0, 0x28, 0xed, 0x1a, 0x2c,
-	0xec, 0x56, 0xc1, 0xc2, 0xee, 0x0f, 0x2c, 0xf4, 0xa6, 0xc0, 0xb2, 0x17, 0x55, 0x3e, 0x7e, 0xbd, 0x14, 0x51, 0x05,
-	0x88, 0x45, 0x15, 0xa0, 0xcc, 0x3b, 0x80, 0x83, 0x77, 0x00, 0x65, 0xef, 0x00, 0x94, 0x7c, 0x00, 0x58, 0x0a, 0x5e,
-	0xc0, 0x48, 0x54, 0x01, 0x61, 0xb7, 0x08, 0xf4, 0x5e, 0x4e, 0x94, 0x2f, 0x65, 0xfb, 0x5d, 0x10, 0xef, 0xc4, 0xfb,
-	0x32, 0xdb, 0x68, 0x17, 0x50, 0x9d, 0x78, 0x5f, 0x9a, 0x2d, 0x75, 0x21, 0xf4, 0x89, 0xf7, 0xa5, 0x6c, 0x9e, 0x0b,
-	0xa2, 0x5e, 0x8d, 0x58, 0x76, 0xea, 0x38, 0x19, 0xa7, 0x0f, 0x5c, 0xc6, 0x05, 0xe1, 0x12, 0x2e, 0x48, 0x56, 0xbe,
-	0x05, 0x86, 0xd2, 0x2d, 0x20, 0x97, 0x6d, 0x41, 0x52, 0xc9, 0x16, 0x28, 0x95, 0x6b, 0x81, 0xa8, 0x54, 0x0b, 0xc0,
-	0x65, 0x3a, 0x21, 0x14, 0xe4, 0x63, 0x00, 0xb2, 0x77, 0x3c, 0x96, 0x55, 0xd6, 0xbc, 0x35, 0x23, 0x63, 0x69, 0x44,
-	0xc4, 0x1d, 0x59, 0xeb, 0x8d, 0x0c, 0x75, 0x11, 0x50, 0x33, 0xde, 0xd6, 0x8e, 0xb7, 0xb5, 0xe3, 0x65, 0x4d, 0x64,
-	0x41, 0x5a, 0xe2, 0xa6, 0xf1, 0xd2, 0xec, 0x14, 0x2f, 0xed, 0xf6, 0xf0, 0xb2, 0x93, 0xb0, 0x69, 0xba, 0x21, 0x2b,
-	0x18, 0x20, 0xd9, 0x1b, 0x44, 0x02, 0xc3, 0x1b, 0x44, 0x02, 0xf2, 0x1b, 0x44, 0x82, 0xe4, 0x51, 0x07, 0x44, 0x7a,
-	0xb5, 0x48, 0x20, 0x8a, 0x3a, 0x40, 0xf8, 0x45, 0xa2, 0x84, 0xa4, 0x0d, 0xdb, 0xe4, 0x2d, 0x10, 0x2e, 0xf1, 0x29,
-	0xfc, 0x60, 0xc5, 0xd2, 0xfc, 0x56, 0xc5, 0xd2, 0xff, 0x99, 0x8a, 0xa5, 0xf7, 0x0b, 0x15, 0x4b, 0xf3, 0xe3, 0x14,
-	0xcb, 0xd2, 0xef, 0x52, 0x2c, 0xed, 0x4f, 0x52, 0x2c, 0xed, 0xaf, 0x51, 0x2c, 0xf5, 0x0f, 0x51, 0x2c, 0xbb, 0xad,
-	0xca, 0x89, 0x7c, 0x50, 0x13, 0xe2, 0x25, 0x6e, 0x4a, 0x32, 0xb8, 0xea, 0xc5, 0x6e, 0x28, 0x9f, 0xd8, 0xcf, 0x00,
-	0xb1, 0xd8, 0x01, 0x94, 0xe9, 0x07, 0xe0, 0x20, 0x20, 0x80, 0xb2, 0x82, 0x00, 0x94, 0x94, 0x02, 0xb0, 0x14, 0x50,
-	0x80, 0x91, 0xd8, 0x01, 0xc2, 0xf2, 0x21, 0xd0, 0x7b, 0x39, 0x8e, 0xb9, 0x92, 0x83, 0xc6, 0x82, 0x78, 0xdf, 0x85,
-	0xbf, 0xca, 0x8e, 0x14, 0x0b, 0xa8, 0xbe, 0x01, 0x7f, 0x65, 0x0e, 0x0f, 0x0b, 0xa1, 0xbf, 0x15, 0x7f, 0x25, 0xc7,
-	0x84, 0x05, 0x51, 0x5f, 0x7a, 0xbf, 0xea, 0xc4, 0x6e, 0x26, 0x1f, 0xa8, 0xb3, 0x80, 0x90, 0xb1, 0x01, 0xc1, 0xee,
-	0x03, 0x2c, 0xdd, 0x07, 0x90, 0xba, 0x0f, 0x08, 0xf7, 0x12, 0x20, 0xb6, 0x33, 0x40, 0xd1, 0xcc, 0x00, 0x50, 0xbf,
-	0x05, 0x51, 0x15, 0x7d, 0xa5, 0xc5, 0x6e, 0xd5, 0xcf, 0x04, 0x87, 0xc3, 0xf4, 0x29, 0x05, 0x92, 0x40, 0x3c, 0x13,
-	0x44, 0x28, 0x0b, 0x24, 0xc1, 0x41, 0x13, 0x00, 0x84, 0x89, 0x20, 0xb4, 0x65, 0xa9, 0x10, 0x24, 0x29, 0x82, 0x40,
-	0x12, 0x5c, 0x09, 0xd3, 0x8f, 0xcc, 0x56, 0x38, 0x0d, 0x5c, 0x99, 0x69, 0xe0, 0xca, 0xce, 0xda, 0x56, 0xfd, 0xac,
-	0x4d, 0xee, 0xb8, 0xb3, 0x83, 0xde, 0x15, 0x46, 0x88, 0xb3, 0x36, 0x40, 0x53, 0xaa, 0x08, 0xa4, 0xaa, 0x2d, 0x30,
-	0x92, 0x44, 0x82, 0x71, 0xbd, 0x05, 0x28, 0x65, 0x4c, 0x82, 0xb4, 0xf6, 0xad, 0xbc, 0x49, 0xdb, 0x0a, 0x27, 0x6d,
-	0x2b, 0x33, 0x69, 0x5b, 0xf9, 0x93, 0xb6, 0x95, 0x37, 0x69, 0x5b, 0x99, 0x49, 0xdb, 0xaa, 0x34, 0x69, 0x5b, 0xd9,
-	0x49, 0xdb, 0xca, 0x4e, 0xda, 0x56, 0x7a, 0xd2, 0xb6, 0x4a, 0x4f, 0x20, 0x44, 0x18, 0xf2, 0x47, 0x10, 0x06, 0x37,
-	0xb2, 0xe6, 0x3c, 0x84, 0x30, 0xa4, 0x27, 0x70, 0xf9, 0x63, 0x08, 0x83, 0x5b, 0xa9, 0x53, 0x0f, 0x22, 0x0c, 0xa1,
-	0x45, 0x2f, 0x7f, 0x14, 0xa1, 0x71, 0x94, 0x3f, 0xf5, 0xea, 0x98, 0x82, 0x5d, 0x21, 0xb4, 0xaf, 0x8e, 0x29, 0x46,
-	0x4b, 0xa2, 0xff, 0xea, 0x98, 0x62, 0x8d, 0x38, 0xaa, 0x57, 0xc7, 0x14, 0xac, 0x65, 0x32, 0xc2, 0xa8, 0x95, 0x84,
-	0x68, 0xc1, 0x24, 0x58, 0xab, 0x26, 0xc1, 0xae, 0x74, 0x12, 0xe7, 0xe8, 0x27, 0x31, 0x5a, 0x44, 0x09, 0x36, 0x4a,
-	0x4a, 0xb8, 0x91, 0x53, 0xc2, 0x95, 0xa6, 0x12, 0xaa, 0x85, 0x95, 0x9f, 0x27, 0xe5, 0xa9, 0x97, 0x3d, 0x65, 0x52,
-	0x68, 0x96, 0xca, 0x04, 0x19, 0xdd, 0x21, 0xdc, 0x28, 0x2e, 0xe3, 0xae, 0x28, 0x11, 0xe9, 0x68, 0x2f, 0x33, 0x9e,
-	0x00, 0x13, 0xa7, 0x55, 0x98, 0x60, 0x23, 0xc5, 0x84, 0x5b, 0x3d, 0x8e, 0x84, 0x11, 0xe5, 0x08, 0xa3, 0x32, 0x13,
-	0xa2, 0xe5, 0x99, 0x60, 0xa3, 0xd1, 0x11, 0xdf, 0xd9, 0x3f, 0x65, 0xd5, 0x9a, 0xf0, 0x73, 0xd6, 0x71, 0x75, 0x9b,
-	0x28, 0x23, 0xde, 0x84, 0x97, 0x14, 0x9c, 0x68, 0x2b, 0xe3, 0x44, 0x18, 0x2d, 0x27, 0xdc, 0x08, 0x7a, 0xfe, 0xf8,
-	0x51, 0x99, 0xce, 0x93, 0xf6, 0xc8, 0x1c, 0x2d, 0xa2, 0x45, 0x9e, 0x60, 0x57, 0xe9, 0x89, 0x73, 0xe4, 0x9e, 0x18,
-	0xad, 0xf9, 0x04, 0x17, 0x84, 0x9f, 0x58, 0xa3, 0xfe, 0x84, 0x9b, 0x12, 0x40, 0xb8, 0xaa, 0x03, 0xf8, 0x7c, 0x50,
-	0x94, 0xd2, 0x3c, 0x20, 0xf4, 0x28, 0x53, 0x10, 0xfc, 0x47, 0x84, 0x1e, 0xef, 0x95, 0x05, 0xf3, 0x90, 0xd0, 0xa3,
-	0x6c, 0x71, 0xb0, 0x8f, 0x09, 0x3d, 0x4e, 0x97, 0x08, 0xf3, 0xa0, 0xd0, 0xa1, 0xb0, 0x50, 0x08, 0xa8, 0x6b, 0x85,
-	0x30, 0x6e, 0xb9, 0x10, 0xda, 0xa9, 0x18, 0x42, 0xea, 0xa2, 0x21, 0x4c, 0xa1, 0x6e, 0x48, 0x03, 0x53, 0x3a, 0x84,
-	0xd2, 0xd5, 0x43, 0x18, 0x5d, 0x40, 0x12, 0x83, 0x35, 0x44, 0x40, 0x5d, 0x46, 0x84, 0xd1, 0x95, 0x44, 0x18, 0xb7,
-	0x98, 0x08, 0xed, 0xd4, 0x13, 0x21, 0x75, 0x49, 0x11, 0xc6, 0x54, 0x15, 0xa1, 0x4c, 0x61, 0x11, 0x4a, 0xd5, 0x16,
-	0x21, 0x74, 0x79, 0x81, 0xc7, 0xc4, 0xb9, 0x02, 0xe8, 0xe7, 0xc7, 0x96, 0xc8, 0x14, 0x46, 0x50, 0x23, 0x9a, 0x42,
-	0x99, 0x6a, 0x03, 0x94, 0x2b, 0xa9, 0xc2, 0x3b, 0x35, 0x07, 0x48, 0xaf, 0xec, 0x08, 0xad, 0x2b, 0x8f, 0x30, 0xa6,
-	0xf8, 0x08, 0x65, 0xeb, 0x4f, 0xe2, 0x4c, 0x09, 0x4a, 0x0c, 0x56, 0x21, 0x01, 0x75, 0x21, 0x12, 0xc6, 0xd4, 0xa2,
-	0x44, 0xed, 0xdc, 0xbf, 0x6c, 0x2b, 0x92, 0x50, 0xdf, 0xb1, 0xa0, 0x5b, 0x97, 0x84, 0x35, 0xa5, 0x49, 0xa8, 0x52,
-	0x75, 0x92, 0x16, 0xb6, 0x40, 0x09, 0x67, 0x6a, 0x94, 0x50, 0xa6, 0x4c, 0x99, 0xa3, 0x09, 0xd6, 0xc2, 0x5e, 0xb1,
-	0x4a, 0xe4, 0xd1, 0x05, 0x75, 0xc9, 0x12, 0xc6, 0xad, 0x5a, 0x42, 0x3b, 0x85, 0x4b, 0x48, 0x5d, 0xbb, 0x84, 0x29,
-	0x94, 0x2f, 0x69, 0x60, 0x2a, 0x98, 0x50, 0xa6, 0x88, 0x09, 0x95, 0xd7, 0xb1, 0x75, 0xf7, 0x7b, 0xa2, 0xfc, 0x2b,
-	0x11, 0x24, 0x57, 0x88, 0x44, 0x99, 0x42, 0x04, 0x06, 0x8b, 0x70, 0xfa, 0x03, 0x08, 0xc6, 0xc1, 0x21, 0x42, 0x7d,
-	0x46, 0x48, 0x7e, 0xb5, 0x3d, 0x41, 0xfc, 0x53, 0xcb, 0x09, 0x48, 0x3f, 0x7d, 0xca, 0xc8, 0xe7, 0xf0, 0x3f, 0x69,
-	0x6b, 0xf7, 0x73, 0x72, 0x74, 0x93, 0x90, 0xa3, 0x7c, 0xb3, 0xc9, 0xe7, 0xe4, 0x3b, 0x40, 0xbc, 0xef, 0x92, 0xf9,
-	0x8c, 0xbe, 0x02, 0x50, 0x7d, 0x97, 0xcc, 0x67, 0xed, 0x1b, 0x20, 0xf4, 0x77, 0xc9, 0x7c, 0x16, 0x5f, 0x00, 0x94,
-	0x7f, 0xfb, 0xf1, 0xe7, 0xfe, 0x37, 0x5d, 0x69, 0x60, 0x51, 0x26, 0xd5, 0x77, 0xc1, 0x37, 0x96, 0x24, 0x86, 0x37,
-	0x10, 0xef, 0xba, 0x63, 0x85, 0x7c, 0x8f, 0xbb, 0xdb, 0xfe, 0xb7, 0x08, 0x01, 0x69, 0xf1, 0x4f, 0xb4, 0xc9, 0xcd,
-	0x09, 0x89, 0x8a, 0x9a, 0x21, 0x99, 0x9b, 0x13, 0x8c, 0x6e, 0x16, 0x30, 0xe9, 0x26, 0xa2, 0xc9, 0xf9, 0x09, 0x11,
-	0xe7, 0x27, 0x48, 0x9c, 0xcf, 0xd0, 0x7d, 0x7a, 0xf8, 0x97, 0x80, 0x70, 0xff, 0x6d, 0x7b, 0x38, 0x6c, 0xa4, 0xee,
-	0xde, 0x77, 0x12, 0x59, 0xa7, 0x0f, 0xbb, 0xec, 0x03, 0x3b, 0x5b, 0x10, 0xef, 0xb7, 0x5c, 0xee, 0xbd, 0x1f, 0x70,
-	0xb9, 0x37, 0xbf, 0xda, 0x72, 0x5f, 0xfa, 0xa9, 0x96, 0x7b, 0xfb, 0xfb, 0x2c, 0xf7, 0xe6, 0x47, 0x59, 0xee, 0xcd,
-	0x2f, 0xb1, 0xdc, 0xcb, 0xa3, 0xac, 0x84, 0xe4, 0xde, 0xe6, 0x6d, 0xd6, 0x7b, 0x74, 0x34, 0xfb, 0xf9, 0xc1, 0x5c,
-	0xfe, 0x10, 0x53, 0xd4, 0xc0, 0xde, 0xa1, 0x61, 0x26, 0xfb, 0x9f, 0x0c, 0x80, 0x0f, 0x5c, 0x0e, 0x04, 0x01, 0x95,
-	0x27, 0x70, 0x13, 0x7f, 0x79, 0x98, 0x3e, 0x48, 0x08, 0x31, 0xa2, 0x02, 0x86, 0xe1, 0x2c, 0x60, 0x18, 0x94, 0xd0,
-	0x60, 0x04, 0x42, 0x83, 0x21, 0x08, 0x0d, 0x82, 0x1e, 0xab, 0x36, 0xfb, 0xa0, 0x9e, 0x37, 0x3d, 0xc2, 0x33, 0x60,
-	0x41, 0x9c, 0x27, 0x50, 0x8f, 0xf9, 0x13, 0x60, 0x01, 0xf1, 0x01, 0x70, 0x42, 0xd5, 0x73, 0xa9, 0x47, 0x7c, 0xfc,
-	0x9b, 0x20, 0xfd, 0x85, 0x4b, 0x8f, 0xf8, 0x83, 0x77, 0x8f, 0xe6, 0x07, 0xef, 0x1e, 0xfd, 0x1f, 0xbc, 0x7b, 0xf4,
-	0x7e, 0xf0, 0xee, 0xd1, 0xfc, 0xe0, 0xdd, 0x63, 0xe9, 0x07, 0xef, 0x1e, 0xed, 0x0f, 0xde, 0x3d, 0x9a, 0x1f, 0xbc,
-	0x7b, 0x34, 0x3f, 0x78, 0xf7, 0x88, 0xe1, 0xf0, 0x68, 0xc2, 0xe1, 0xd1, 0x0b, 0x87, 0x47, 0xf5, 0x8a, 0x44, 0x1a,
-	0xb8, 0xf7, 0x8a, 0x84, 0x4f, 0x6a, 0x67, 0x15, 0x5f, 0x91, 0xf0, 0x5b, 0x38, 0x2e, 0x2c, 0xbd, 0x22, 0xe1, 0x37,
-	0xd0, 0x8e, 0x75, 0x5f, 0x91, 0xf0, 0x59, 0xe3, 0x6e, 0xf5, 0xca, 0x82, 0x6b, 0x25, 0x13, 0x04, 0xc5, 0x57, 0x16,
-	0xfc, 0x16, 0xdf, 0x71, 0x82, 0x89, 0x92, 0x33, 0xaf, 0x2c, 0xf8, 0x6d, 0x4c, 0xec, 0x78, 0xaf, 0x2c, 0xf8, 0xa4,
-	0x8e, 0x28, 0x75, 0xb0, 0xdd, 0xc7, 0xcf, 0xd9, 0xc3, 0x09, 0xb9, 0x5e, 0x1e, 0xb8, 0xc2, 0x3f, 0x27, 0x05, 0x4a,
-	0x48, 0x2a, 0x62, 0x82, 0xc0, 0x0d, 0x11, 0x4f, 0xd3, 0x09, 0x46, 0x76, 0x28, 0x33, 0xbb, 0xbe, 0x72, 0xf2, 0x07,
-	0xa3, 0x74, 0x84, 0x60, 0x1b, 0x5f, 0xfb, 0x10, 0xc6, 0xd6, 0x9e, 0x24, 0x0a, 0x88, 0x2d, 0x8d, 0x4e, 0x12, 0x82,
-	0x6d, 0x32, 0xc7, 0xbe, 0x96, 0x08, 0xbc, 0xc2, 0x6a, 0x2d, 0x43, 0xd8, 0x2a, 0xba, 0xfb, 0xd5, 0x20, 0xd8, 0x06,
-	0x7e, 0x91, 0x3e, 0x43, 0xa0, 0x0d, 0x95, 0x1e, 0x35, 0xa1, 0xe1, 0x72, 0x86, 0xac, 0xa2, 0xf8, 0x8a, 0x6d, 0x7b,
-	0xdf, 0x1f, 0x97, 0xe5, 0x1b, 0xe6, 0xb8, 0x12, 0x98, 0x9c, 0x54, 0xdf, 0xd1, 0x98, 0x93, 0x9e, 0xc0, 0xe4, 0x2d,
-	0xac, 0xc0, 0xe4, 0xbc, 0xd2, 0x8f, 0x9c, 0xd4, 0xfa, 0x91, 0xb3, 0x5a, 0x3f, 0x72, 0x36, 0xff, 0xaa, 0xbe, 0x9c,
-	0x53, 0xa7, 0x1a, 0x7a, 0xd2, 0x35, 0x51, 0xd9, 0x3e, 0x65, 0xe3, 0x7c, 0xc7, 0x32, 0x67, 0xcd, 0x52, 0xb6, 0xc9,
-	0x19, 0x83, 0x9c, 0xb1, 0x46, 0xd1, 0x14, 0xdf, 0xb1, 0x83, 0xfc, 0xeb, 0x62, 0x32, 0x02, 0x32, 0x86, 0x17, 0x7c,
-	0xe1, 0x21, 0xa2, 0x71, 0xc2, 0xec, 0x51, 0x18, 0x9a, 0xce, 0xfd, 0xf6, 0xee, 0x45, 0x7b, 0xb5, 0xde, 0x40, 0x4a,
-	0x7d, 0xdf, 0x66, 0x46, 0xe1, 0x11, 0x44, 0xa7, 0x01, 0x9c, 0xff, 0x42, 0x54, 0xed, 0x0b, 0x20, 0x45, 0x7f, 0xcc,
-	0xa5, 0x42, 0x01, 0xdd, 0x6e, 0xd7, 0x05, 0x32, 0x3b, 0x0c, 0xe9, 0x34, 0xf8, 0xba, 0xbe, 0x6d, 0xe5, 0x60, 0x1b,
-	0x30, 0xaf, 0xd2, 0xf3, 0x7d, 0x75, 0x5b, 0xa5, 0x53, 0x1b, 0xe1, 0x83, 0x3a, 0xda, 0x11, 0x10, 0x9e, 0x01, 0x00,
-	0xc2, 0xbd, 0x02, 0x2c, 0xdf, 0x38, 0xda, 0x57, 0xd9, 0x3d, 0x5a, 0x73, 0xd7, 0xd6, 0xdc, 0x35, 0x9f, 0x4c, 0x08,
-	0x0c, 0x91, 0x0c, 0x20, 0x4c, 0x1b, 0x04, 0x55, 0xaf, 0xfe, 0xee, 0x61, 0x82, 0x20, 0x90, 0x3e, 0xa9, 0xb2, 0xaf,
-	0x20, 0x76, 0xf7, 0x3c, 0x53, 0x47, 0x24, 0xb3, 0xb3, 0xe0, 0xfa, 0x90, 0xcc, 0xbe, 0x82, 0xaa, 0xbc, 0xe7, 0xda,
-	0x87, 0x08, 0x8f, 0x19, 0x90, 0xec, 0xd6, 0x82, 0xab, 0x4a, 0xbd, 0xef, 0xa7, 0x2b, 0xa9, 0xc3, 0x3b, 0x63, 0xce,
-	0x9d, 0x6f, 0xbc, 0x9d, 0x67, 0xbc, 0x9d, 0x31, 0x93, 0x9e, 0x77, 0x08, 0x61, 0xed, 0xb7, 0x53, 0x2f, 0x40, 0xef,
-	0x65, 0x5a, 0x91, 0x90, 0xaf, 0x68, 0xa6, 0xb4, 0xac, 0x19, 0x24, 0xe8, 0x4f, 0x6c, 0x0c, 0x85, 0x89, 0x32, 0x12,
-	0x03, 0x92, 0x10, 0x3d, 0x60, 0x82, 0x75, 0x10, 0x31, 0x6c, 0xe2, 0xd3, 0x7d, 0x84, 0xb6, 0x97, 0x47, 0x68, 0x79,
-	0x3b, 0x13, 0xae, 0xea, 0x01, 0x9a, 0x86, 0x3d, 0xdb, 0x9b, 0xc7, 0x67, 0x86, 0x71, 0x42, 0x38, 0x7f, 0x7a, 0xa6,
-	0x61, 0xe3, 0x0c, 0xfd, 0xf4, 0x2c, 0xc7, 0x1f, 0x8c, 0x61, 0x4d, 0x6c, 0x13, 0xec, 0x07, 0x78, 0xfe, 0x08, 0x2e,
-	0x45, 0x79, 0x84, 0x31, 0x8c, 0x09, 0xd1, 0xf1, 0x4e, 0xb0, 0x0e, 0x7a, 0x86, 0xdd, 0xc8, 0x27, 0x52, 0x87, 0xbf,
-	0x3c, 0xb5, 0xcb, 0x87, 0x68, 0x12, 0xc1, 0x7b, 0x66, 0xa7, 0xb8, 0xa2, 0x47, 0x4c, 0x5e, 0xf8, 0x0f, 0xec, 0x14,
-	0x5b, 0x70, 0x8a, 0x49, 0x13, 0xf5, 0xb4, 0x2e, 0x87, 0xbf, 0x1a, 0xb3, 0xdb, 0xac, 0x89, 0xf8, 0x9f, 0xe6, 0x5a,
-	0xcc, 0x1f, 0xfa, 0x0a, 0x1a, 0x68, 0x43, 0x88, 0xb6, 0x13, 0xc1, 0x3a, 0xa0, 0x19, 0x36, 0xf9, 0x93, 0x7d, 0xb7,
-	0x4d, 0xca, 0x9f, 0xf4, 0xdd, 0x36, 0xaa, 0x9d, 0xc9, 0x9f, 0xfc, 0xbb, 0x6d, 0x0c, 0xec, 0x79, 0xcb, 0x7c, 0xb7,
-	0x8d, 0x61, 0x9c, 0xfc, 0xc9, 0xbf, 0xdb, 0x46, 0xc3, 0xc6, 0x55, 0xea, 0xbb, 0x6d, 0x14, 0xfe, 0x60, 0x0c, 0x6b,
-	0xf2, 0x87, 0x60, 0x3f, 0x7f, 0xf2, 0x6f, 0xc8, 0x49, 0xf9, 0x13, 0x61, 0xcc, 0x08, 0x42, 0x74, 0xfe, 0x10, 0xac,
-	0xf3, 0x87, 0x61, 0x37, 0x7f, 0x88, 0xd4, 0xf9, 0x93, 0xbe, 0x54, 0x47, 0x0d, 0xd1, 0xe4, 0x8f, 0xf3, 0xa5, 0x3a,
-	0x9a, 0x2b, 0x7a, 0xc4, 0xe4, 0x8f, 0xfb, 0xa5, 0x3a, 0x9a, 0x2d, 0x38, 0xc5, 0xe4, 0x4f, 0xfe, 0xa5, 0x3a, 0x0a,
-	0xfe, 0x6a, 0xcc, 0x6e, 0xf3, 0x27, 0xe2, 0x7f, 0x9a, 0x6b, 0xb3, 0xfc, 0xc1, 0x6f, 0x9b, 0xc0, 0x96, 0x88, 0x1b,
-	0x9b, 0x21, 0x69, 0x42, 0x3c, 0x23, 0x6d, 0x5e, 0xd9, 0xaf, 0xb7, 0x90, 0xec, 0x52, 0x7b, 0x37, 0xde, 0x35, 0x36,
-	0xd3, 0xbc, 0xbd, 0x1b, 0x9f, 0x74, 0x7d, 0x5c, 0xd8, 0xbb, 0xf1, 0x79, 0x2f, 0x03, 0xbd, 0xbd, 0x1b, 0x97, 0xb4,
-	0x8e, 0x77, 0xf7, 0x6e, 0x3c, 0xf6, 0xa1, 0xe0, 0x32, 0x9b, 0x9f, 0x48, 0x16, 0xb2, 0xd4, 0xf9, 0xda, 0x0c, 0xc9,
-	0x55, 0x20, 0xb3, 0x1c, 0x44, 0xdc, 0xe4, 0x2d, 0x92, 0x26, 0x7b, 0x33, 0xd2, 0xcf, 0x61, 0x6c, 0x62, 0x32, 0x59,
-	0x6d, 0x61, 0x79, 0xe6, 0xb1, 0x59, 0x5d, 0xdc, 0xc2, 0x72, 0x5b, 0x7c, 0xc7, 0xef, 0x36, 0xcf, 0xcf, 0x6c, 0x61,
-	0xb9, 0x6d, 0xce, 0xba, 0xde, 0x66, 0xbe, 0xb7, 0x85, 0xe5, 0x91, 0x5f, 0x0b, 0x6e, 0x75, 0xb4, 0x00, 0xd8, 0x3f,
-	0x0b, 0x77, 0x03, 0x5d, 0x88, 0x0b, 0xa9, 0x37, 0xb2, 0xed, 0x41, 0x00, 0xd9, 0x59, 0xa1, 0xfc, 0x95, 0x3d, 0x39,
-	0x9a, 0x1d, 0x0d, 0xcf, 0x29, 0x38, 0x1e, 0x9e, 0x13, 0x7c, 0x44, 0x3c, 0x47, 0xd3, 0x69, 0xf0, 0x1c, 0x4e, 0x27,
-	0xc2, 0x73, 0x98, 0x4e, 0x85, 0xe7, 0x20, 0x7f, 0x03, 0x4f, 0x86, 0xde, 0xc8, 0x1b, 0x75, 0x04, 0xf0, 0xc2, 0x54,
-	0xa1, 0xde, 0x3b, 0x78, 0x91, 0x5b, 0xc8, 0x53, 0xb0, 0x08, 0x2c, 0x75, 0x8b, 0x95, 0xfe, 0xab, 0x2b, 0xd7, 0x88,
-	0x2b, 0x6b, 0x93, 0x57, 0xfc, 0xb5, 0x8f, 0x57, 0xf3, 0x6b, 0x1f, 0xaf, 0xe6, 0xd7, 0x3e, 0x5e, 0xfd, 0x5f, 0xfb,
-	0x78, 0xf5, 0x7e, 0xed, 0xe3, 0xd5, 0xfc, 0xda, 0xc7, 0xab, 0xfd, 0xb5, 0x8f, 0x57, 0xfb, 0x6b, 0x1f, 0xaf, 0xfa,
-	0xd7, 0x3e, 0x5e, 0xcd, 0xaf, 0x7d, 0xbc, 0xa6, 0xb7, 0x37, 0xd3, 0x40, 0x32, 0x56, 0x6f, 0xbf, 0xbf, 0x9a, 0x3d,
-	0xf7, 0x57, 0x7f, 0xa3, 0xfd, 0xd5, 0xdb, 0x5d, 0x7f, 0x75, 0xb7, 0xd4, 0x5f, 0xcd, 0x3e, 0xfa, 0xab, 0xdd, 0x3c,
-	0x7f, 0xb5, 0x3b, 0xe6, 0xaf, 0xf1, 0x45, 0xb4, 0xf4, 0xc1, 0x74, 0x75, 0xe7, 0x77, 0x6c, 0xe7, 0x75, 0x6c, 0x67,
-	0xba, 0x60, 0xde, 0x41, 0x4b, 0x84, 0xed, 0xdb, 0x4e, 0xbd, 0x3b, 0xf4, 0x0a, 0x2f, 0xa0, 0x31, 0xc2, 0x89, 0x3e,
-	0x25, 0xe4, 0x9b, 0x36, 0xfd, 0x37, 0x1c, 0xcf, 0x37, 0x33, 0x9e, 0x6f, 0xfe, 0x78, 0xbe, 0x79, 0xe3, 0xf9, 0x66,
-	0xc6, 0xf3, 0xad, 0x34, 0x9e, 0x6f, 0x76, 0x3c, 0xdf, 0xcc, 0x78, 0xbe, 0x99, 0xf1, 0x7c, 0x33, 0xe3, 0x39, 0xe9,
-	0xf1, 0x9c, 0x30, 0x94, 0x4e, 0x26, 0x94, 0x4e, 0x26, 0x94, 0x4e, 0x7e, 0x28, 0x9d, 0xbc, 0x50, 0x3a, 0xb9, 0xa1,
-	0x74, 0x32, 0xa1, 0x74, 0xb2, 0xa1, 0x74, 0xb2, 0xa1, 0x74, 0xc2, 0xe7, 0xbf, 0x27, 0xf3, 0xfc, 0xf7, 0xe4, 0x3f,
-	0xff, 0x3d, 0x79, 0xcf, 0x7f, 0x4f, 0xe6, 0xf9, 0xef, 0xa9, 0xf4, 0xfc, 0xf7, 0x64, 0x9f, 0xff, 0x9e, 0xcc, 0xf3,
-	0xdf, 0x93, 0x79, 0xfe, 0x7b, 0xb2, 0xa6, 0xcf, 0x76, 0x10, 0x92, 0xfd, 0x65, 0x07, 0x21, 0x6f, 0x67, 0x3c, 0xa1,
-	0x76, 0x10, 0x34, 0xec, 0xf9, 0xc4, 0xee, 0x20, 0x68, 0xc6, 0xf1, 0x8e, 0xda, 0x41, 0x50, 0xb0, 0xf1, 0x93, 0xde,
-	0x41, 0xc8, 0x71, 0xf4, 0x58, 0xbe, 0xe0, 0xd6, 0xb0, 0xeb, 0x3b, 0xb3, 0xe0, 0xd6, 0x8c, 0xf6, 0xa2, 0xbb, 0xe0,
-	0xd6, 0xac, 0xf1, 0x67, 0xbe, 0xe0, 0xd6, 0xb0, 0xf6, 0x6c, 0xbe, 0xbc, 0x4e, 0xee, 0xd5, 0x27, 0xe0, 0x92, 0x87,
-	0xb3, 0x13, 0x70, 0xa6, 0xb5, 0xf1, 0xb3, 0x3d, 0xff, 0xe6, 0x30, 0x9e, 0xb7, 0xbd, 0xd3, 0x6f, 0x1e, 0xe9, 0xf8,
-	0xdc, 0x1c, 0x7e, 0x73, 0x18, 0xe3, 0x79, 0xe7, 0xf0, 0x9b, 0xa1, 0xd0, 0xff, 0xe6, 0x58, 0x9a, 0xc3, 0xb8, 0x51,
-	0xe0, 0x1d, 0x4a, 0x73, 0x48, 0x1d, 0x0b, 0xa5, 0x23, 0x69, 0x4e, 0x03, 0x13, 0x11, 0xe6, 0x40, 0x9a, 0xc3, 0xe8,
-	0xb8, 0x30, 0xc7, 0xd1, 0xba, 0xd0, 0xf8, 0xe5, 0xf9, 0xee, 0xb2, 0xdd, 0x3f, 0x7f, 0x58, 0x6f, 0xf6, 0x87, 0xf4,
-	0xe9, 0xe7, 0xf5, 0xcb, 0xba, 0xff, 0xf0, 0xeb, 0xee, 0xf9, 0xe5, 0xdf, 0xed, 0xcb, 0x7e, 0x73, 0x1b, 0xc8, 0xff,
-	0x0b, 0x4b, 0x5d, 0x7c, 0xc6 };
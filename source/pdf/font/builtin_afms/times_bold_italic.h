@@ -1,626 +0,0 @@
-// times_bold_italic.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_TIMES_BOLD_ITALIC[] = { 0x78, 0x9c, 0xbd, 0x7d, 0x5d, 0x73, 0x1b, 0x39, 0x92, 0xed, 0x7b, 0x47,
-	0xf4, 0x7f, 0xa8, 0xc7, 0x7b, 0x23, 0xd6, 0xb3, 0xfc, 0x2e, 0x72, 0xe6, 0xc9, 0xdd, 0x6e, 0xcf, 0xb4, 0xdd, 0xdd,
-	0x96, 0xdd, 0x12, 0x69, 0xde, 0x37, 0x4a, 0x2a, 0xdb, 0x5c, 0x51, 0xa2, 0x87, 0x14, 0xf5, 0x31, 0xbf, 0x7e, 0x81,
-	0x42, 0x26, 0xf2, 0x20, 0x33, 0xa1, 0x7e, 0xbb, 0x31, 0xb1, 0xde, 0xe6, 0x39, 0xa8, 0x22, 0x90, 0x1f, 0x27, 0x01,
-	0x14, 0x8a, 0xfa, 0xf3, 0x7e, 0x73, 0xb8, 0x7f, 0xbb, 0xbf, 0xbb, 0xff, 0xbd, 0xbb, 0x3f, 0x6c, 0xaf, 0x8e, 0xcd,
-	0xe4, 0x6f, 0xc3, 0x1f, 0x7f, 0xf8, 0x79, 0x7f, 0x7b, 0xdb, 0xdd, 0xdd, 0x37, 0x3f, 0xef, 0xbf, 0x3f, 0x1f, 0xb6,
-	0x5f, 0xbf, 0xdd, 0x37, 0xff, 0xe7, 0xea, 0xff, 0x36, 0xc3, 0xc5, 0x7c, 0xfa, 0x5f, 0xf1, 0xdf, 0xb6, 0xff, 0x77,
-	0x11, 0xff, 0x5d, 0x0c, 0xfa, 0x7f, 0xc7, 0xfd, 0xbf, 0x6d, 0xf3, 0xfa, 0x7a, 0x7f, 0xd9, 0x35, 0x7f, 0x3e, 0x1f,
-	0xef, 0xbb, 0xdb, 0x63, 0xf3, 0xeb, 0xdd, 0xd5, 0xfe, 0xf0, 0x7d, 0x7f, 0xd8, 0xdc, 0x77, 0xd7, 0x7f, 0x6b, 0x9a,
-	0xd7, 0xbb, 0x5d, 0xf3, 0x29, 0xde, 0xed, 0xd8, 0x7c, 0xea, 0x8e, 0xdd, 0xe1, 0x21, 0xa0, 0xf0, 0x5d, 0x87, 0x6e,
-	0x73, 0xbf, 0xdd, 0xdf, 0x35, 0x6f, 0x42, 0xf3, 0xbf, 0x37, 0xe7, 0xdf, 0x4e, 0xcd, 0xef, 0x9b, 0xe7, 0xa6, 0x19,
-	0x36, 0xc3, 0xf1, 0xdf, 0x07, 0x93, 0xbf, 0x0f, 0x66, 0xfd, 0x57, 0xc8, 0x05, 0x17, 0x77, 0xdb, 0x7f, 0x9f, 0xba,
-	0x5f, 0xdf, 0x34, 0x93, 0xf1, 0x60, 0x36, 0x13, 0x7c, 0xf9, 0xfb, 0xe9, 0xb8, 0xf9, 0xda, 0x35, 0x93, 0xe9, 0xbc,
-	0x9d, 0x34, 0xd3, 0xd9, 0x7c, 0xb1, 0xf8, 0xf1, 0x87, 0x38, 0xc4, 0x3f, 0x36, 0xb7, 0x5d, 0x73, 0xbe, 0xbd, 0xed,
-	0x8e, 0xaf, 0x7e, 0xda, 0xef, 0xae, 0x7f, 0xbd, 0xdf, 0xec, 0xb6, 0x57, 0x81, 0x3a, 0xed, 0x76, 0x42, 0x35, 0x91,
-	0x6a, 0x32, 0xb7, 0xb9, 0xdd, 0xee, 0x9e, 0x85, 0xfd, 0xf1, 0x87, 0x55, 0xd7, 0xdb, 0x23, 0xb6, 0xfa, 0xf1, 0x87,
-	0xd4, 0xec, 0xf5, 0xdd, 0xd7, 0x5d, 0xd7, 0xbc, 0x1a, 0x4e, 0x03, 0x70, 0x7c, 0xbb, 0x7d, 0xea, 0xae, 0xcf, 0xb6,
-	0xf7, 0x57, 0xdf, 0x9a, 0x2f, 0x9b, 0xdd, 0xb1, 0x0b, 0xfd, 0xfa, 0xb6, 0x39, 0x6c, 0xae, 0xee, 0xbb, 0xc3, 0x9f,
-	0xdd, 0x7d, 0xf3, 0xcb, 0xd3, 0x7d, 0x77, 0x77, 0xdd, 0x5d, 0x7f, 0xda, 0xdf, 0x6e, 0xee, 0x52, 0xb7, 0x7e, 0xfa,
-	0x69, 0xff, 0xd4, 0xbc, 0x1a, 0x0d, 0x06, 0xe1, 0x9f, 0xe1, 0xbc, 0x59, 0x2c, 0x66, 0xcd, 0x62, 0x34, 0x6c, 0x7e,
-	0xfc, 0xe1, 0x22, 0x34, 0x3c, 0xec, 0xb6, 0x77, 0xdd, 0xd9, 0xfe, 0xb8, 0xed, 0x4d, 0xf3, 0x6a, 0x38, 0x18, 0x00,
-	0x7e, 0xfe, 0x6d, 0x7b, 0x75, 0x73, 0xd7, 0x1d, 0x8f, 0xcd, 0x34, 0xc0, 0xcb, 0xee, 0x70, 0x8c, 0x8d, 0x06, 0x83,
-	0xd1, 0xdf, 0x06, 0xb1, 0xdd, 0x1f, 0xfb, 0xfb, 0xed, 0x55, 0xf7, 0xff, 0xc1, 0x89, 0xc9, 0x70, 0xdb, 0x63, 0xb3,
-	0x69, 0xee, 0x0f, 0x9b, 0xeb, 0xee, 0x76, 0x73, 0xb8, 0x69, 0xf6, 0x5f, 0x9a, 0xdf, 0xb6, 0x77, 0xfb, 0xfb, 0xe7,
-	0xef, 0xdd, 0xab, 0x7f, 0x75, 0xe1, 0xaa, 0xd7, 0xff, 0x6c, 0x36, 0x77, 0xd7, 0xff, 0xbd, 0x3f, 0x34, 0xdb, 0x70,
-	0xf1, 0xf1, 0x74, 0x79, 0xdc, 0x5e, 0x6f, 0x37, 0x87, 0x6d, 0x77, 0x0c, 0x51, 0xf0, 0x4b, 0xf8, 0x96, 0xeb, 0xed,
-	0xdd, 0xd7, 0x3f, 0xaf, 0xbe, 0x75, 0xc1, 0xd8, 0x7d, 0x17, 0xfe, 0xbc, 0x0f, 0xed, 0x37, 0x87, 0x6b, 0xe6, 0x82,
-	0x29, 0x37, 0xdf, 0xff, 0x95, 0xec, 0x3f, 0x9b, 0x05, 0xa7, 0x7e, 0xa6, 0x0f, 0x93, 0xd9, 0xe8, 0xc7, 0x1f, 0x5e,
-	0x1f, 0xaf, 0xa2, 0x65, 0x0f, 0xcd, 0x6c, 0x3e, 0xfe, 0xf1, 0x87, 0x37, 0x1d, 0x7f, 0x0c, 0x46, 0x0d, 0x41, 0xf3,
-	0xe7, 0xfd, 0xf5, 0xbf, 0x56, 0xcd, 0x64, 0xd4, 0xff, 0xd7, 0x72, 0xd5, 0x0c, 0x47, 0xc3, 0xf8, 0x9f, 0x21, 0xf8,
-	0xa3, 0x7b, 0x38, 0xf8, 0xc7, 0xd1, 0x87, 0x3f, 0x37, 0xe3, 0x51, 0xf3, 0x8f, 0x66, 0xf5, 0xb9, 0x19, 0x4d, 0x07,
-	0xe1, 0x3f, 0xfe, 0x68, 0x8e, 0xdf, 0x37, 0xc1, 0x8e, 0xff, 0x68, 0x7e, 0x6a, 0x06, 0xf4, 0xbf, 0x7f, 0xf4, 0xcd,
-	0xc6, 0xa9, 0xd9, 0x78, 0xbe, 0xe8, 0x9b, 0x75, 0x4f, 0x57, 0xbb, 0xcd, 0x6d, 0xdf, 0x6e, 0xd6, 0x06, 0x5f, 0x8d,
-	0x9b, 0x71, 0x3b, 0x08, 0xdd, 0x99, 0x50, 0xf3, 0x49, 0x6a, 0x3e, 0x9d, 0x4e, 0xfb, 0xe6, 0xff, 0x3e, 0xed, 0x83,
-	0x49, 0x2f, 0x77, 0xfd, 0x05, 0xc3, 0xf1, 0xac, 0x19, 0x2f, 0xe6, 0xcd, 0x34, 0xfc, 0xff, 0xd9, 0x7c, 0x4a, 0x57,
-	0x4c, 0xe9, 0x8a, 0x41, 0xea, 0xc7, 0xdd, 0xe9, 0xf6, 0x32, 0x3a, 0xf9, 0xeb, 0x5d, 0x7f, 0xcd, 0xab, 0xd0, 0x81,
-	0x41, 0xb8, 0x62, 0xdc, 0xb4, 0x03, 0xee, 0xd2, 0xac, 0xbc, 0xe2, 0x7a, 0xbf, 0xdb, 0x6d, 0x0e, 0xa9, 0xf5, 0x68,
-	0xd0, 0xc7, 0x4f, 0x33, 0x09, 0x2e, 0x6e, 0x63, 0xdf, 0xfb, 0x0b, 0xda, 0x74, 0xc1, 0xbc, 0x1f, 0xcc, 0x1f, 0xcd,
-	0xf7, 0xee, 0x70, 0x15, 0x93, 0x28, 0x5e, 0x31, 0x5e, 0xc4, 0x0b, 0x9a, 0x76, 0x31, 0x6e, 0x66, 0x8b, 0x11, 0xb5,
-	0x9f, 0xa7, 0xf6, 0x6d, 0x3b, 0xef, 0xdb, 0x6f, 0x6e, 0xc3, 0x15, 0xc7, 0xe0, 0xa7, 0xfe, 0x8a, 0x69, 0xb8, 0x60,
-	0x11, 0x1a, 0x87, 0xff, 0x9b, 0xf3, 0x05, 0x0b, 0x32, 0x12, 0x7d, 0x41, 0x3f, 0xea, 0x14, 0x8e, 0xf1, 0x8a, 0x30,
-	0xe4, 0xf1, 0x6c, 0xd1, 0x8c, 0x07, 0x23, 0x19, 0xf6, 0x64, 0x50, 0x5e, 0xf2, 0x7d, 0x73, 0xe8, 0xee, 0x76, 0xdd,
-	0x97, 0x74, 0xc5, 0x68, 0x1e, 0xbe, 0xa4, 0x0d, 0x97, 0x4c, 0x26, 0x70, 0xc9, 0xd0, 0xb9, 0x44, 0xbe, 0xe5, 0x55,
-	0x68, 0xdb, 0x5f, 0x34, 0x6a, 0x87, 0x70, 0xd1, 0xa8, 0x34, 0xd6, 0xe6, 0x18, 0x7b, 0x76, 0xbc, 0x49, 0x1e, 0x9c,
-	0x36, 0xa3, 0xc9, 0x22, 0x88, 0x08, 0xf8, 0x63, 0x42, 0x0e, 0x9f, 0xb6, 0xe9, 0x82, 0xef, 0xbb, 0xd3, 0x31, 0x59,
-	0x2a, 0x39, 0xa2, 0x0d, 0xb7, 0x9a, 0x51, 0xd3, 0x49, 0x19, 0x42, 0x57, 0x41, 0x9c, 0x36, 0xa9, 0x2f, 0xb3, 0xe8,
-	0x87, 0x60, 0x9e, 0x61, 0x68, 0x33, 0x1c, 0x53, 0x70, 0x4c, 0xa6, 0xe5, 0x00, 0xbe, 0x3d, 0x7f, 0xff, 0xd6, 0x25,
-	0x37, 0x87, 0x96, 0xb3, 0x59, 0xdf, 0xf3, 0x11, 0x1b, 0x75, 0x32, 0x2b, 0xef, 0x1e, 0x7c, 0xb0, 0xdd, 0x27, 0x17,
-	0xbc, 0x5a, 0xf4, 0x91, 0x37, 0x0c, 0x76, 0x1f, 0x8e, 0xb9, 0xdf, 0xe4, 0xe4, 0x11, 0x39, 0xed, 0xb8, 0xdb, 0x1c,
-	0xbf, 0x51, 0x67, 0xa2, 0x61, 0x82, 0x0f, 0x26, 0x68, 0xff, 0x79, 0x69, 0x97, 0xff, 0x74, 0x87, 0x7d, 0x0a, 0xd2,
-	0x18, 0xd5, 0x93, 0x70, 0xbb, 0x36, 0x26, 0x19, 0x35, 0x5e, 0x94, 0x8d, 0xf7, 0x77, 0x1d, 0x85, 0x42, 0x88, 0xb4,
-	0x18, 0x0c, 0xdc, 0x70, 0x3a, 0x28, 0x1b, 0xde, 0x3f, 0xee, 0x29, 0x2e, 0xdb, 0xd8, 0x74, 0x32, 0x83, 0xa6, 0x43,
-	0xd5, 0xf4, 0xdb, 0xa1, 0x4b, 0x77, 0x0d, 0x22, 0xdb, 0x0f, 0x6f, 0x32, 0x1d, 0x40, 0x73, 0xe5, 0xc7, 0x2f, 0xfb,
-	0xd3, 0x21, 0xb7, 0x0e, 0x7e, 0x19, 0x8c, 0xa1, 0xed, 0x58, 0xb5, 0xdd, 0x3e, 0xf0, 0x9d, 0x87, 0xe9, 0xce, 0xf3,
-	0x36, 0x8a, 0x0b, 0xb5, 0x9e, 0x94, 0xad, 0x8f, 0xdb, 0xa7, 0xe4, 0x92, 0x71, 0x7f, 0xef, 0xe9, 0x20, 0x8c, 0xaf,
-	0xe5, 0xb6, 0x2a, 0x59, 0x8f, 0xdd, 0x03, 0x39, 0x30, 0xf4, 0x2f, 0xf4, 0x62, 0x34, 0x85, 0xfb, 0xaa, 0x34, 0xed,
-	0x72, 0xa4, 0x8e, 0x53, 0x27, 0x5a, 0xb4, 0x46, 0xab, 0x54, 0x60, 0x7b, 0xc7, 0x5d, 0x1e, 0xf5, 0x09, 0x3a, 0x69,
-	0xa7, 0xd0, 0x7a, 0x5e, 0x06, 0xd2, 0xd5, 0x7e, 0xb7, 0xbf, 0x93, 0x4e, 0x8f, 0x9b, 0x51, 0x70, 0xf9, 0x64, 0xca,
-	0x1d, 0x51, 0xd9, 0x79, 0xec, 0x6e, 0xb7, 0x72, 0xc5, 0xab, 0x51, 0xb4, 0xf6, 0x5c, 0x5d, 0x33, 0x63, 0x47, 0x52,
-	0x16, 0xec, 0x62, 0x01, 0xea, 0xfb, 0x1e, 0x2c, 0x18, 0x15, 0x6c, 0x11, 0x1c, 0x48, 0x61, 0x3d, 0x1b, 0x96, 0x6d,
-	0xbb, 0x7f, 0x9f, 0x36, 0x3b, 0x4e, 0x99, 0xe1, 0xa0, 0xed, 0x93, 0x66, 0xbc, 0xe0, 0x3b, 0x8f, 0xca, 0xd6, 0x5f,
-	0xe3, 0x94, 0xa0, 0x3b, 0x54, 0x6f, 0xae, 0x7c, 0x19, 0x66, 0x03, 0xc7, 0xbe, 0x4c, 0xc6, 0xf6, 0xed, 0x82, 0x2c,
-	0x09, 0x0a, 0x3c, 0x9b, 0xb0, 0xd8, 0x8d, 0x52, 0xc2, 0x27, 0x9b, 0xcf, 0xc6, 0x7d, 0x0e, 0xb4, 0x7d, 0x53, 0xca,
-	0x81, 0x19, 0x79, 0x73, 0x36, 0x6b, 0xfb, 0xa6, 0xaf, 0x29, 0x5d, 0x62, 0xac, 0x4e, 0x17, 0x10, 0x50, 0xb3, 0x59,
-	0xd9, 0xf0, 0x27, 0xb2, 0xdc, 0x24, 0x34, 0x9c, 0x85, 0x7f, 0xb3, 0xcf, 0x67, 0x6d, 0xd9, 0xf0, 0xe7, 0x34, 0xac,
-	0x51, 0xff, 0xdd, 0xb3, 0x3e, 0xa5, 0xf8, 0xbb, 0x59, 0x63, 0x47, 0xa9, 0x9b, 0x6f, 0x48, 0xc3, 0x66, 0x4d, 0xea,
-	0xa0, 0xdc, 0x72, 0x51, 0xde, 0xf2, 0x17, 0x48, 0xa8, 0x59, 0x88, 0xf4, 0xdc, 0xb0, 0x1d, 0x94, 0x0d, 0xdf, 0x52,
-	0xfc, 0x44, 0xd9, 0x9a, 0xcd, 0x06, 0xd0, 0x70, 0x58, 0x7e, 0xf5, 0x3f, 0x53, 0xe4, 0x0c, 0x93, 0x81, 0x06, 0xa0,
-	0x85, 0xed, 0xa8, 0x2c, 0x04, 0xff, 0x82, 0x71, 0xb7, 0xb1, 0x00, 0xe4, 0x5b, 0xaa, 0x2a, 0xf9, 0x2b, 0xd5, 0xae,
-	0x98, 0x14, 0x93, 0x78, 0xc7, 0xdc, 0x50, 0x25, 0xdb, 0xbb, 0x3c, 0xec, 0x57, 0xe1, 0x7e, 0x53, 0xb4, 0x65, 0xab,
-	0xbc, 0xf3, 0x9e, 0xbe, 0x7c, 0x18, 0xbf, 0x3c, 0x96, 0x92, 0xdc, 0x90, 0xbd, 0x33, 0x1c, 0xf6, 0x0d, 0x7f, 0xa3,
-	0x86, 0x7d, 0x46, 0x2e, 0x70, 0xe0, 0x5c, 0x07, 0xa9, 0x97, 0xbf, 0x53, 0xc3, 0x45, 0x9f, 0x65, 0x8b, 0x21, 0x88,
-	0x42, 0xab, 0xdc, 0xf3, 0x47, 0xb6, 0x7a, 0xd4, 0x84, 0x36, 0xa8, 0xa7, 0x34, 0x5d, 0x94, 0x4d, 0x3f, 0x24, 0x73,
-	0xb6, 0xc9, 0xe7, 0x0b, 0xa8, 0x45, 0xf3, 0x41, 0xd9, 0xd1, 0x33, 0x74, 0xe5, 0x10, 0x5c, 0x39, 0x57, 0x1e, 0xfa,
-	0x98, 0x6f, 0x39, 0x1a, 0xe8, 0x7b, 0x8e, 0x4a, 0x2b, 0x7d, 0xca, 0x63, 0x8a, 0xa1, 0x89, 0xf7, 0xe4, 0x44, 0xea,
-	0x75, 0xe9, 0x8f, 0xe6, 0x4f, 0xaa, 0x3b, 0xb1, 0x97, 0xd3, 0x11, 0x38, 0x7d, 0x3e, 0x29, 0x7b, 0x79, 0x9e, 0xf4,
-	0x6d, 0xd0, 0xc7, 0x1b, 0x58, 0x73, 0x3e, 0x2d, 0x3b, 0x79, 0xd1, 0xe4, 0x49, 0x51, 0x08, 0xa3, 0x09, 0x78, 0x72,
-	0xae, 0xd2, 0x67, 0xd9, 0x50, 0xf1, 0xed, 0x5b, 0x0e, 0x21, 0xd8, 0xe7, 0xca, 0x43, 0x2b, 0x6c, 0xb9, 0x98, 0xe0,
-	0xb7, 0xcf, 0xcb, 0x7b, 0x7e, 0xc6, 0x94, 0x5c, 0xe0, 0x97, 0x2f, 0xca, 0xe1, 0xac, 0x93, 0x72, 0xf4, 0x59, 0x31,
-	0x85, 0x10, 0x5e, 0x28, 0xe7, 0xfc, 0xbf, 0x5c, 0x31, 0x54, 0x14, 0x2d, 0xd4, 0x34, 0xe4, 0x32, 0x4c, 0xfc, 0x6f,
-	0xba, 0xfb, 0x3c, 0x77, 0x79, 0x35, 0xee, 0x83, 0x24, 0x4c, 0x5e, 0x82, 0xd4, 0xcd, 0x5a, 0x92, 0xa5, 0x05, 0x4f,
-	0x37, 0x29, 0x95, 0x2e, 0xc3, 0x45, 0x50, 0xa2, 0x53, 0xf2, 0x8d, 0xda, 0x85, 0xf8, 0x61, 0x31, 0x76, 0xbf, 0x07,
-	0x26, 0x3c, 0xc1, 0x93, 0xe1, 0x8b, 0x82, 0xb6, 0x86, 0x39, 0x8b, 0x7c, 0x11, 0x67, 0x58, 0xcb, 0x13, 0x9e, 0xab,
-	0xed, 0xf6, 0x6a, 0x7b, 0xb8, 0x3a, 0xe5, 0x59, 0xeb, 0x78, 0x30, 0x49, 0x05, 0x33, 0x0f, 0x49, 0x95, 0xb5, 0x53,
-	0x9c, 0x54, 0x1f, 0xc3, 0x92, 0x80, 0x27, 0xc4, 0x21, 0x3f, 0xa6, 0x3d, 0xfb, 0xaa, 0xe5, 0xde, 0xcd, 0xca, 0xde,
-	0xf5, 0x53, 0xbe, 0x6c, 0x83, 0xe1, 0x88, 0xa6, 0x7c, 0x63, 0x98, 0x72, 0x2c, 0x54, 0x8d, 0xdb, 0xe4, 0x84, 0xee,
-	0x27, 0x1c, 0xa1, 0xb6, 0x4e, 0x66, 0x34, 0xf7, 0x59, 0xa8, 0xd9, 0xc9, 0x25, 0x59, 0x69, 0x92, 0xf4, 0x3e, 0x06,
-	0x17, 0xd7, 0x93, 0x05, 0xf9, 0x77, 0xd2, 0xcf, 0xc6, 0x42, 0x2d, 0x24, 0xdb, 0xa4, 0xb9, 0x79, 0x30, 0x7b, 0xbe,
-	0xe9, 0x70, 0xa0, 0x66, 0x27, 0xd7, 0xd0, 0x81, 0x71, 0x28, 0x39, 0xad, 0xdc, 0x75, 0x38, 0x18, 0x96, 0xb7, 0xe5,
-	0x09, 0x4f, 0xba, 0xeb, 0x1c, 0xef, 0x3a, 0x2a, 0x2d, 0xf1, 0x85, 0xfa, 0x1a, 0x86, 0x1f, 0xd2, 0x75, 0x9a, 0x66,
-	0x3d, 0xfd, 0x80, 0x7e, 0x6b, 0xb6, 0x61, 0x2e, 0xd2, 0xff, 0xc7, 0xae, 0xf9, 0xb2, 0xe3, 0xeb, 0x55, 0x85, 0xfb,
-	0x4a, 0x03, 0x18, 0xc5, 0xcb, 0x63, 0x71, 0x2b, 0xbe, 0x2c, 0xaf, 0x2f, 0x52, 0x16, 0x73, 0xf8, 0x8c, 0xe3, 0x9c,
-	0x70, 0xb2, 0x98, 0xe3, 0x08, 0xa6, 0x65, 0xc4, 0x6d, 0x39, 0xe1, 0xc3, 0x0c, 0x79, 0x36, 0x96, 0x82, 0x39, 0x1c,
-	0xcc, 0xca, 0x86, 0xff, 0x43, 0xf7, 0x9c, 0xf7, 0x03, 0x68, 0x29, 0x2a, 0x73, 0x6b, 0xe5, 0xc5, 0x1b, 0x32, 0xe2,
-	0x38, 0x96, 0xee, 0xc9, 0x7c, 0x8c, 0x3d, 0x98, 0x97, 0x37, 0xde, 0x41, 0x0f, 0x62, 0x46, 0x49, 0x43, 0x96, 0x50,
-	0x6a, 0x78, 0x2b, 0xee, 0x5e, 0xf4, 0xfa, 0x22, 0x06, 0x18, 0x0e, 0x4a, 0x03, 0xd0, 0x24, 0x66, 0x96, 0xc6, 0x3f,
-	0xc6, 0x96, 0x6a, 0x82, 0x49, 0x33, 0x51, 0x9a, 0x7c, 0x85, 0xc5, 0x04, 0x34, 0x55, 0x93, 0xcb, 0xef, 0xf4, 0xfd,
-	0x71, 0x35, 0xc5, 0x2e, 0x84, 0xd6, 0x7a, 0x4a, 0x92, 0x42, 0x9e, 0x9a, 0xb6, 0xc5, 0x8d, 0x27, 0x65, 0x5d, 0xe4,
-	0x55, 0x5a, 0x14, 0x95, 0x88, 0x41, 0xcb, 0x69, 0xd9, 0xf2, 0x48, 0x5d, 0x48, 0x33, 0x9c, 0x18, 0x5b, 0xd0, 0x56,
-	0x39, 0xec, 0x3e, 0x4b, 0x55, 0xb4, 0x6c, 0x28, 0x1e, 0xd3, 0x05, 0x7b, 0x6b, 0xd8, 0x96, 0xe6, 0x3a, 0xa5, 0xbe,
-	0x4e, 0x93, 0xb9, 0x0a, 0xc3, 0xce, 0xcb, 0x80, 0x7f, 0x48, 0x2d, 0x67, 0xc9, 0x5c, 0x83, 0x62, 0x54, 0x6a, 0x4a,
-	0xf2, 0x88, 0x4d, 0x67, 0x31, 0x97, 0x73, 0xd3, 0x91, 0x4a, 0xb9, 0x34, 0xb5, 0xee, 0xeb, 0x7d, 0xbc, 0xed, 0x0c,
-	0x4d, 0x30, 0x52, 0x29, 0xf7, 0x9c, 0xda, 0x86, 0xb1, 0xf4, 0x96, 0x2d, 0x73, 0x79, 0x34, 0x2a, 0xed, 0xf5, 0x1f,
-	0xba, 0x71, 0x70, 0x6f, 0x1b, 0xb5, 0x27, 0xc4, 0xe2, 0x84, 0xc3, 0x6b, 0xc4, 0x4a, 0x3a, 0x99, 0x67, 0x25, 0x15,
-	0xad, 0xea, 0x8b, 0x4b, 0x1b, 0xd6, 0x7d, 0xb1, 0x06, 0xce, 0xf8, 0x12, 0x5e, 0xda, 0x8d, 0x48, 0x80, 0x68, 0x81,
-	0x1d, 0x66, 0x82, 0xfd, 0x06, 0xce, 0x30, 0xac, 0x1a, 0xda, 0x79, 0xee, 0xcc, 0xd4, 0xf9, 0x02, 0x10, 0xea, 0x61,
-	0x3f, 0xc5, 0x98, 0xb7, 0xb4, 0x04, 0xce, 0x5f, 0xc2, 0x2b, 0x04, 0x94, 0xea, 0xfb, 0xed, 0xee, 0x9a, 0xc4, 0x26,
-	0x2c, 0x1d, 0xdb, 0xa8, 0x4b, 0xb3, 0xa4, 0x2d, 0xfd, 0x35, 0x3c, 0xd9, 0x2e, 0xf7, 0x23, 0xae, 0xf7, 0x8f, 0x29,
-	0x11, 0x86, 0x24, 0x3a, 0xe3, 0x98, 0x34, 0xbc, 0x9e, 0x1f, 0xce, 0x54, 0x7c, 0xe7, 0xd5, 0xff, 0x24, 0xd6, 0xff,
-	0x60, 0xb3, 0x49, 0x9c, 0x72, 0xb7, 0xdc, 0x2f, 0x3d, 0xe7, 0x8e, 0x4b, 0xe6, 0xdd, 0xf6, 0x8e, 0x84, 0xa9, 0x9f,
-	0xcd, 0x8e, 0x42, 0xb7, 0x60, 0x75, 0x36, 0xe4, 0x59, 0xf7, 0x90, 0x42, 0xe2, 0x4b, 0xdc, 0x0d, 0xe3, 0x69, 0x7a,
-	0xd2, 0xc2, 0x10, 0x17, 0xe3, 0x38, 0xbf, 0x93, 0x6b, 0x54, 0xd5, 0x79, 0xa6, 0xa5, 0x54, 0xbf, 0xd0, 0x9e, 0x8d,
-	0x60, 0x8a, 0x35, 0x9c, 0xa9, 0xb5, 0xd4, 0x97, 0xdd, 0xfe, 0xb0, 0xa5, 0x9b, 0xcf, 0xfb, 0x72, 0x3b, 0xeb, 0x57,
-	0x19, 0x6d, 0x54, 0xa7, 0x74, 0x85, 0x92, 0xa9, 0x63, 0x27, 0xfd, 0x19, 0xcf, 0x68, 0xd4, 0x53, 0x28, 0xb7, 0xc3,
-	0x99, 0xaa, 0x39, 0x57, 0xa7, 0xc3, 0xa1, 0xbb, 0xbb, 0xa2, 0x28, 0x0c, 0xbe, 0x0a, 0xcb, 0xf8, 0x38, 0x51, 0x9a,
-	0x66, 0xff, 0xf1, 0xd4, 0x9c, 0xf3, 0xb0, 0xaf, 0x81, 0xc7, 0x6d, 0xbf, 0x53, 0x98, 0xab, 0x60, 0xd0, 0xe4, 0x51,
-	0xb8, 0xb5, 0x7c, 0x4f, 0xab, 0x52, 0x82, 0xb7, 0x88, 0x24, 0x20, 0xc7, 0x7d, 0xed, 0x9c, 0xc6, 0x64, 0x92, 0xab,
-	0x94, 0x9a, 0x7d, 0x3d, 0x6d, 0xc3, 0x15, 0xb7, 0xfb, 0x7b, 0xa8, 0xb9, 0x71, 0xa1, 0x31, 0x89, 0x91, 0x3f, 0xcc,
-	0x57, 0xa9, 0xda, 0x14, 0xaf, 0xea, 0x3b, 0x98, 0xaf, 0x1a, 0xf7, 0x57, 0x8d, 0x63, 0xa1, 0x91, 0xab, 0xc6, 0x95,
-	0xab, 0x24, 0xa4, 0x83, 0xf3, 0xc3, 0x65, 0x51, 0x6b, 0xe0, 0x32, 0x55, 0x9b, 0xbe, 0x6c, 0xb9, 0x90, 0xcc, 0x53,
-	0x50, 0xc6, 0x45, 0x5d, 0x3b, 0x60, 0xf7, 0xf3, 0xfc, 0x3e, 0x37, 0xdf, 0x71, 0xf3, 0x19, 0x35, 0x9f, 0xc6, 0x4d,
-	0x2f, 0x56, 0xb2, 0x56, 0x39, 0xb4, 0xbb, 0xbb, 0xce, 0xb3, 0xa7, 0x30, 0x31, 0x1c, 0xc6, 0x32, 0x19, 0xda, 0x8c,
-	0x72, 0xcc, 0xb4, 0xca, 0x9f, 0xd7, 0x9b, 0xaf, 0x5f, 0x69, 0x9d, 0xb9, 0xe8, 0xa7, 0x1c, 0x41, 0xac, 0x17, 0x13,
-	0x34, 0xf1, 0xc2, 0xbb, 0x20, 0x6f, 0xde, 0xc5, 0x59, 0xd0, 0x38, 0x15, 0x19, 0xb9, 0x86, 0xa7, 0xf4, 0xe5, 0x26,
-	0x4d, 0xcc, 0xaf, 0xee, 0xd0, 0xd1, 0x7e, 0xd9, 0x30, 0xb0, 0x6d, 0xdc, 0x75, 0x0d, 0x32, 0x9a, 0xaf, 0xd3, 0x15,
-	0x67, 0x73, 0xd8, 0x7c, 0x3d, 0x6c, 0xbe, 0xd3, 0x80, 0xa6, 0x31, 0xa6, 0xc3, 0x17, 0x4d, 0x67, 0xb0, 0xce, 0x19,
-	0xf2, 0x14, 0x7e, 0x4c, 0x5f, 0x76, 0x79, 0x0a, 0x7e, 0x4c, 0xfe, 0x18, 0xf4, 0xf6, 0x8c, 0x44, 0xdc, 0x83, 0xa0,
-	0xe6, 0x93, 0xd2, 0x8d, 0x12, 0x9e, 0x97, 0x9b, 0x23, 0xed, 0x2e, 0x4c, 0x69, 0x9b, 0x6a, 0xb1, 0x90, 0x6d, 0xaa,
-	0xe1, 0x5c, 0x25, 0x26, 0x47, 0x28, 0x5c, 0xd6, 0xa6, 0xeb, 0x26, 0x83, 0x31, 0x5e, 0x37, 0xf3, 0xaf, 0x93, 0xb0,
-	0x71, 0x43, 0x7b, 0xae, 0x3c, 0x9b, 0x43, 0x1b, 0xc2, 0xcd, 0x89, 0x6d, 0x5e, 0x01, 0x84, 0x69, 0x1d, 0x45, 0xc4,
-	0x6e, 0xb7, 0xfd, 0x7e, 0xdc, 0xa6, 0xca, 0x39, 0xe9, 0xdd, 0x15, 0x16, 0x29, 0x23, 0xd9, 0x22, 0x1b, 0xf2, 0x5a,
-	0x20, 0x5f, 0x12, 0xdc, 0x75, 0xff, 0x6d, 0x7f, 0xca, 0x7b, 0x9b, 0x6d, 0xbf, 0x72, 0x8a, 0xbb, 0xf3, 0x2d, 0x6f,
-	0xf2, 0x0d, 0x17, 0x43, 0x3d, 0xaa, 0xb4, 0x03, 0x91, 0x35, 0x77, 0xcc, 0xb3, 0x84, 0x50, 0xc0, 0x44, 0x73, 0xf5,
-	0xf4, 0x3d, 0x78, 0x97, 0x76, 0xa1, 0xe6, 0xd3, 0x5e, 0xd3, 0x47, 0x8b, 0x38, 0xdf, 0x64, 0xbd, 0x5a, 0x28, 0x67,
-	0x6d, 0xae, 0x4e, 0xf7, 0xa4, 0x22, 0xfd, 0x76, 0x48, 0x90, 0x9f, 0x38, 0x0d, 0x93, 0xf6, 0x6a, 0x2f, 0x31, 0xcd,
-	0xf0, 0xbf, 0xec, 0xba, 0x27, 0x1e, 0x7e, 0x7f, 0xcd, 0x2c, 0x7e, 0xc7, 0x80, 0xaf, 0x51, 0x73, 0x76, 0x29, 0x35,
-	0x93, 0xb4, 0x29, 0x3d, 0x09, 0xf2, 0x39, 0x9b, 0xb2, 0xb5, 0x78, 0xbe, 0xce, 0xcd, 0x6f, 0x37, 0x57, 0x07, 0x52,
-	0xd0, 0x10, 0xd3, 0x31, 0x3b, 0xc7, 0x31, 0x17, 0x46, 0x9c, 0xd0, 0x0b, 0xb5, 0x2b, 0x75, 0x79, 0xe8, 0x68, 0xc4,
-	0x41, 0xbc, 0xfa, 0xde, 0xc4, 0x6d, 0xb7, 0x98, 0x96, 0xa9, 0xb9, 0xda, 0x96, 0xba, 0xde, 0xdf, 0x6f, 0xae, 0x72,
-	0x65, 0x8a, 0x45, 0x68, 0x1a, 0xc2, 0x79, 0x14, 0xe7, 0xb4, 0x3c, 0xf9, 0x1c, 0xf1, 0x0c, 0x3e, 0x5f, 0xb3, 0x0d,
-	0x69, 0xc6, 0x2e, 0x9f, 0x4e, 0xfb, 0x2b, 0x26, 0x7d, 0x8d, 0xcd, 0x57, 0x28, 0x05, 0x3c, 0x70, 0x1d, 0x1b, 0x86,
-	0xe5, 0x74, 0xdf, 0xa9, 0x60, 0xaa, 0x76, 0xb4, 0xe0, 0xe6, 0xca, 0x6b, 0x57, 0xdd, 0x75, 0x08, 0x46, 0x5a, 0xa9,
-	0xcc, 0x07, 0x5c, 0xfc, 0x43, 0x15, 0xe0, 0x0b, 0xf4, 0x9e, 0xee, 0xe9, 0xee, 0xeb, 0xe6, 0x70, 0xba, 0xdd, 0x6d,
-	0x4e, 0xb4, 0xf1, 0x94, 0xbc, 0x97, 0xe6, 0xe6, 0x2d, 0x5f, 0xa5, 0x3c, 0xb1, 0xff, 0xba, 0xbf, 0xeb, 0xd2, 0x4c,
-	0x7a, 0xc8, 0xdb, 0x71, 0x61, 0x16, 0x34, 0xce, 0xa3, 0x50, 0xae, 0xb8, 0xda, 0x1c, 0x64, 0x0b, 0xac, 0xbf, 0x7d,
-	0x98, 0xfc, 0x65, 0x47, 0x8f, 0x06, 0x26, 0x35, 0x6e, 0x8d, 0x58, 0x2e, 0x50, 0x2c, 0x47, 0x3c, 0x83, 0x59, 0xd0,
-	0xdc, 0xeb, 0x35, 0x6d, 0x33, 0xcd, 0xe2, 0x7a, 0x7a, 0x31, 0x84, 0x5a, 0x3c, 0x1a, 0xf1, 0x46, 0xf3, 0x2c, 0xe9,
-	0xf6, 0xfe, 0x70, 0xfd, 0xa5, 0xbb, 0xdd, 0xe6, 0x1d, 0xcb, 0x68, 0xd3, 0x45, 0x5c, 0xfa, 0xc1, 0x4e, 0xdb, 0x88,
-	0x9f, 0xb6, 0xe4, 0x3d, 0x1a, 0x58, 0xfb, 0xda, 0x8d, 0x9a, 0x11, 0x3f, 0x75, 0xc9, 0x7b, 0x2a, 0xd2, 0xbc, 0xdf,
-	0x58, 0x89, 0xfb, 0xac, 0x21, 0x2f, 0xdb, 0x19, 0x1b, 0x88, 0x9f, 0xbb, 0x70, 0xff, 0x3f, 0xa4, 0xfe, 0xa7, 0x55,
-	0xc9, 0x22, 0xae, 0xc0, 0x5a, 0xb6, 0x3d, 0x3f, 0x70, 0x19, 0xf3, 0xba, 0xe0, 0x70, 0x7d, 0x1b, 0x66, 0x5e, 0xa7,
-	0x1d, 0x0f, 0x60, 0x1a, 0x13, 0x21, 0xd4, 0xb7, 0x09, 0x6c, 0xd7, 0x8d, 0x26, 0x6a, 0x4b, 0x66, 0x03, 0x02, 0x1a,
-	0x57, 0xdf, 0x30, 0x3f, 0x1f, 0x4d, 0xd4, 0xca, 0xeb, 0x3a, 0x56, 0xe9, 0xe3, 0x11, 0x17, 0x60, 0xe3, 0x39, 0xb6,
-	0xd7, 0xeb, 0x24, 0x30, 0x4e, 0x1b, 0x9b, 0x8f, 0x07, 0xb0, 0x34, 0x1d, 0x99, 0xdd, 0x78, 0x68, 0x1e, 0x57, 0x37,
-	0x61, 0x0e, 0x18, 0x97, 0x37, 0xd3, 0x19, 0x87, 0x03, 0xef, 0xca, 0x73, 0xdf, 0xf7, 0xa9, 0xef, 0x34, 0x5f, 0x6f,
-	0x61, 0xbe, 0x3e, 0xd2, 0xbb, 0xf2, 0xa1, 0x00, 0xde, 0x06, 0x71, 0xbc, 0xdc, 0xd1, 0x7a, 0x24, 0x3d, 0xc1, 0x8c,
-	0x0f, 0x98, 0xda, 0x58, 0x9c, 0xc9, 0x3a, 0xaf, 0xd4, 0xa4, 0xf4, 0xd7, 0x22, 0x2f, 0x69, 0x1b, 0x30, 0xf4, 0x62,
-	0xce, 0xdf, 0xf3, 0x4a, 0xaf, 0xae, 0x45, 0xee, 0x68, 0xef, 0x7f, 0x3c, 0x95, 0x74, 0x79, 0xa5, 0x3a, 0xb5, 0x11,
-	0x65, 0xc9, 0xbb, 0x07, 0xf1, 0x99, 0x0f, 0x4b, 0x4b, 0x6e, 0xcf, 0x8b, 0x1e, 0x93, 0x94, 0x69, 0x01, 0x34, 0x8b,
-	0x53, 0x58, 0xfd, 0x25, 0xb9, 0x4b, 0x92, 0x63, 0xd4, 0x25, 0xd4, 0x52, 0x6e, 0x9d, 0x77, 0x95, 0x8a, 0x11, 0xe7,
-	0xdd, 0x25, 0x33, 0x60, 0x9e, 0xea, 0x5f, 0x6f, 0x1f, 0xb6, 0xa4, 0xbd, 0x21, 0xd6, 0x63, 0xd1, 0xe9, 0x9f, 0x2c,
-	0x8d, 0xa7, 0x95, 0xdb, 0x8b, 0x7d, 0xf2, 0xbd, 0x17, 0x3c, 0x35, 0xca, 0x8d, 0x79, 0x1b, 0x5b, 0xd5, 0x02, 0xd9,
-	0xd0, 0x9e, 0x57, 0x2d, 0x2a, 0xf7, 0xcf, 0x16, 0x8d, 0x7b, 0x04, 0xba, 0x7d, 0xde, 0xeb, 0x53, 0x5f, 0x01, 0xbb,
-	0x7e, 0xe6, 0x3b, 0xf2, 0x72, 0x0e, 0xbe, 0x83, 0xd7, 0x74, 0xae, 0x9b, 0xf3, 0x12, 0xb8, 0x7f, 0x9e, 0x06, 0x35,
-	0xa1, 0x5f, 0x0d, 0x47, 0x01, 0x2e, 0x96, 0xc3, 0xd6, 0x71, 0x65, 0xdf, 0xc8, 0x7b, 0x71, 0x2f, 0x54, 0x7b, 0x2f,
-	0x0f, 0x27, 0x57, 0x05, 0x18, 0x48, 0x7c, 0x3e, 0xef, 0xb7, 0x2e, 0x7c, 0x8d, 0x43, 0x37, 0xde, 0x66, 0xf3, 0x82,
-	0xbe, 0x27, 0xfb, 0xce, 0xc7, 0xe5, 0x86, 0x97, 0xf9, 0x0e, 0x31, 0x16, 0x76, 0x49, 0xbb, 0x3c, 0x47, 0xb8, 0x53,
-	0x40, 0x8a, 0xe5, 0xbd, 0x8e, 0x91, 0x5f, 0xca, 0x0c, 0xcd, 0x4f, 0x13, 0xcc, 0x10, 0xf2, 0xf3, 0x89, 0x50, 0xfb,
-	0x37, 0xbc, 0xc1, 0x99, 0xb6, 0xe0, 0x41, 0xb0, 0xb9, 0x75, 0xf1, 0x24, 0x14, 0x3d, 0x37, 0xe6, 0x75, 0x73, 0x7c,
-	0xc4, 0x33, 0xd5, 0x6e, 0x98, 0xb4, 0x74, 0x15, 0x1f, 0x62, 0xe0, 0x69, 0x55, 0xbf, 0x3f, 0x0c, 0x8b, 0x27, 0x33,
-	0x0c, 0x98, 0x93, 0xc0, 0x20, 0xc6, 0x03, 0x3f, 0x34, 0xae, 0x24, 0xa7, 0x5f, 0xbd, 0x90, 0xd4, 0xd9, 0x6d, 0x39,
-	0x2c, 0x70, 0x93, 0x32, 0x4f, 0x16, 0xb4, 0x89, 0xfe, 0x30, 0xa3, 0xee, 0x77, 0xec, 0x7b, 0xdf, 0xcd, 0x1d, 0x5b,
-	0xb1, 0xda, 0x8b, 0xab, 0xfb, 0xda, 0x10, 0xf7, 0x39, 0xac, 0xa3, 0xb9, 0x4b, 0x32, 0x8d, 0xc4, 0x3e, 0x99, 0x1c,
-	0xca, 0x9b, 0xf7, 0xba, 0x4f, 0x53, 0x9a, 0xc3, 0x14, 0x5b, 0xf9, 0xda, 0xac, 0x3f, 0x4b, 0x97, 0xe0, 0xd9, 0x55,
-	0xbd, 0x53, 0x32, 0x91, 0xcc, 0x9d, 0x8a, 0xcf, 0x28, 0xa6, 0x35, 0xaf, 0x95, 0x53, 0xbd, 0x17, 0xa2, 0x4f, 0xa4,
-	0x40, 0x1c, 0x47, 0x5b, 0x62, 0x93, 0xb8, 0x97, 0xa0, 0x3d, 0x27, 0xed, 0x71, 0xde, 0xf6, 0xa2, 0x6c, 0xe4, 0xed,
-	0x51, 0xed, 0x86, 0xb0, 0x72, 0xb0, 0xc5, 0x61, 0x91, 0x02, 0x69, 0xb7, 0xff, 0x4f, 0x77, 0xf7, 0x95, 0xe6, 0x3b,
-	0xf1, 0xc9, 0xc8, 0x24, 0x4c, 0x38, 0xdb, 0x49, 0x65, 0xbc, 0x9f, 0xa0, 0xf7, 0xf9, 0xc1, 0x8c, 0xd1, 0xc9, 0xfc,
-	0x38, 0x4e, 0xbb, 0x2c, 0x9a, 0x74, 0xa4, 0x1f, 0xcd, 0x19, 0x05, 0x50, 0xaa, 0x27, 0x5b, 0x7c, 0xf5, 0xf0, 0xd6,
-	0x75, 0xa2, 0x08, 0x28, 0x5d, 0xe8, 0xb8, 0xb8, 0x60, 0xc6, 0x49, 0x61, 0xd1, 0x19, 0x97, 0x37, 0x3c, 0x71, 0xe8,
-	0x51, 0x36, 0x5c, 0xb7, 0x49, 0x7e, 0xa2, 0xdb, 0xa6, 0xe4, 0x35, 0x57, 0xc7, 0xf8, 0x29, 0x8d, 0x0a, 0xa5, 0xfc,
-	0xb8, 0xc6, 0x84, 0x52, 0xce, 0x88, 0x6f, 0xfb, 0x03, 0x0a, 0xc6, 0xb4, 0x1d, 0xdb, 0x44, 0xc8, 0xf3, 0x4e, 0x18,
-	0x2d, 0x3c, 0xd1, 0x33, 0xc3, 0xcd, 0x9e, 0xc6, 0x3a, 0xca, 0x9e, 0xae, 0xaa, 0xf6, 0x9f, 0x45, 0xc8, 0xc5, 0xe7,
-	0x70, 0x41, 0x1d, 0x6d, 0x59, 0x1f, 0xd0, 0x2c, 0xb2, 0x34, 0x65, 0x9a, 0xbb, 0x05, 0x39, 0x1a, 0xcc, 0xfd, 0xbe,
-	0x5f, 0x40, 0xdf, 0xb1, 0x48, 0xe9, 0xbe, 0xe7, 0x08, 0x92, 0xa5, 0x51, 0x8e, 0x1d, 0xa3, 0x75, 0x3c, 0x69, 0xee,
-	0x4f, 0x6b, 0x1c, 0x4f, 0xfd, 0x76, 0x47, 0xda, 0x53, 0x19, 0xc6, 0xe5, 0x44, 0xdc, 0x78, 0x1c, 0xca, 0x16, 0x9f,
-	0x31, 0xa7, 0xa8, 0x17, 0x58, 0xb3, 0x3e, 0x91, 0x01, 0xb1, 0xcb, 0xa1, 0x56, 0x6f, 0x0d, 0xb3, 0x42, 0x09, 0x4c,
-	0x93, 0x2f, 0x34, 0x01, 0xbb, 0x3d, 0xed, 0xee, 0xb7, 0xdf, 0x77, 0x69, 0x77, 0x2f, 0xc8, 0x73, 0x58, 0xb5, 0x4c,
-	0xfb, 0x3d, 0xd3, 0x9a, 0x75, 0x60, 0x41, 0x0e, 0xa9, 0x55, 0x95, 0x5d, 0x99, 0x3c, 0xf2, 0x83, 0x53, 0x3b, 0x31,
-	0x22, 0x31, 0xf9, 0xbe, 0x39, 0xdc, 0x6f, 0x37, 0xbb, 0xeb, 0xed, 0x97, 0xf4, 0xe8, 0x68, 0xd8, 0xe7, 0x7b, 0x4f,
-	0xb7, 0xba, 0x54, 0xe6, 0xc9, 0x54, 0x59, 0xbf, 0xf3, 0x7c, 0x2a, 0x3e, 0x09, 0xd4, 0xb2, 0x9b, 0xeb, 0x13, 0x06,
-	0xa7, 0x3c, 0xc8, 0x36, 0x06, 0xcd, 0x8a, 0xa8, 0xf5, 0xa1, 0x7f, 0xc8, 0x34, 0xf6, 0x12, 0x38, 0x2b, 0xbb, 0x91,
-	0x94, 0x2c, 0xed, 0xd5, 0xa9, 0xa7, 0x9a, 0x89, 0xf0, 0x7c, 0x7e, 0x66, 0x07, 0x92, 0x67, 0x78, 0xe5, 0xb2, 0x9f,
-	0x1e, 0xe8, 0xcc, 0xeb, 0x17, 0x5c, 0xc1, 0xc8, 0x5f, 0x5a, 0x5f, 0xf0, 0x33, 0x25, 0x68, 0x9e, 0x1f, 0x2c, 0x55,
-	0x5b, 0x9f, 0x20, 0xcf, 0x20, 0x34, 0x46, 0x95, 0x1c, 0xf8, 0x03, 0xd3, 0x58, 0xbc, 0x60, 0xec, 0x93, 0xd7, 0x52,
-	0xd0, 0x99, 0xb4, 0x90, 0x1a, 0x7b, 0xf3, 0x03, 0x38, 0xad, 0x16, 0xd6, 0xe2, 0xd5, 0x23, 0x6b, 0xd9, 0xc7, 0xfc,
-	0x5c, 0xe3, 0xb0, 0xbf, 0xe9, 0xee, 0xf0, 0xe9, 0x46, 0xdc, 0x18, 0xef, 0x9f, 0x6e, 0x0c, 0x74, 0x7d, 0xa2, 0x59,
-	0xda, 0xa1, 0xfb, 0xba, 0x3d, 0xca, 0xf6, 0xe6, 0x4b, 0xd3, 0xb4, 0x5c, 0xd2, 0x24, 0x35, 0xe1, 0x98, 0x89, 0xc9,
-	0x4d, 0x59, 0x3e, 0x96, 0xa2, 0x9e, 0x8f, 0x91, 0x58, 0x51, 0xe7, 0xdd, 0xfd, 0x53, 0x28, 0x99, 0x79, 0x7f, 0xbf,
-	0x7f, 0x4c, 0x1c, 0x06, 0x3e, 0x9f, 0xca, 0x36, 0x9e, 0x89, 0x54, 0x9c, 0x48, 0x71, 0x90, 0x1a, 0xb3, 0xe6, 0x32,
-	0x56, 0xae, 0x8f, 0x06, 0x69, 0xa7, 0xac, 0x16, 0xd2, 0x7b, 0xac, 0x91, 0xf4, 0xbc, 0x71, 0xe6, 0x84, 0x44, 0x2e,
-	0x62, 0x70, 0xf7, 0x5c, 0xc0, 0xac, 0xce, 0x71, 0x6b, 0x9c, 0x0b, 0xe5, 0x72, 0x67, 0xfa, 0x32, 0x49, 0x3d, 0xa7,
-	0xe3, 0x55, 0x72, 0x26, 0x6b, 0x34, 0xeb, 0x0f, 0xaa, 0xc1, 0xd6, 0xba, 0xf6, 0xd6, 0x2f, 0xf7, 0xbc, 0x99, 0x50,
-	0x9d, 0xe7, 0xe7, 0x89, 0x22, 0x16, 0xec, 0x38, 0x55, 0x1c, 0xe9, 0x73, 0x4e, 0x66, 0xb6, 0x6b, 0x26, 0xc9, 0x13,
-	0xba, 0xac, 0x78, 0x24, 0x9c, 0x1d, 0x40, 0x9b, 0x4c, 0xf7, 0xe5, 0xa0, 0x63, 0x92, 0x8d, 0xa3, 0x3c, 0x4e, 0x2a,
-	0x0a, 0x01, 0xeb, 0x21, 0x5a, 0x0e, 0x15, 0x0f, 0xed, 0x4d, 0xad, 0x84, 0xf6, 0xa9, 0x56, 0x8e, 0xcb, 0x23, 0x2c,
-	0xa6, 0xd8, 0xa0, 0x44, 0xfc, 0x75, 0x69, 0x2a, 0x35, 0x4e, 0xaa, 0x53, 0x75, 0x0d, 0x2b, 0xd1, 0x29, 0x47, 0x0e,
-	0xaa, 0x0b, 0xe5, 0xff, 0x40, 0x67, 0xe8, 0x01, 0xa8, 0x1b, 0x9f, 0x59, 0xd8, 0x8b, 0xe5, 0xe8, 0xa0, 0xa1, 0xe3,
-	0x7f, 0x70, 0x26, 0xc0, 0x14, 0x6e, 0x98, 0xa9, 0xbc, 0x50, 0xb8, 0x73, 0x02, 0xa0, 0x66, 0x51, 0xfc, 0x7b, 0x0a,
-	0xca, 0x25, 0xa0, 0x58, 0xc5, 0xf1, 0xf6, 0x43, 0x6b, 0x13, 0x26, 0x4f, 0xef, 0x31, 0x61, 0x68, 0x39, 0xf0, 0xe2,
-	0x80, 0x0b, 0xfb, 0xa7, 0xe9, 0xfd, 0x6c, 0x52, 0xaf, 0x94, 0x1f, 0x54, 0x19, 0xc3, 0xa9, 0x5f, 0x75, 0x4b, 0x44,
-	0x5c, 0xf6, 0xd2, 0x8a, 0x7d, 0x36, 0xa4, 0xf5, 0x74, 0xb7, 0xbb, 0x4f, 0x69, 0xd3, 0x9f, 0xf8, 0x8b, 0xc7, 0xba,
-	0xe6, 0x7a, 0xfb, 0x2a, 0xcf, 0xb5, 0xf2, 0x8c, 0xb5, 0x38, 0x91, 0x60, 0x93, 0x45, 0x4e, 0xdd, 0x16, 0x53, 0xb3,
-	0x51, 0x18, 0xc0, 0xa4, 0x19, 0x0f, 0xc7, 0x2f, 0xcc, 0xcc, 0x4a, 0x0b, 0xc1, 0x78, 0xed, 0x0e, 0x56, 0xca, 0xc8,
-	0xdb, 0x13, 0x05, 0xf3, 0x20, 0x9d, 0x12, 0xe9, 0x77, 0xa1, 0x27, 0x95, 0x35, 0xee, 0x16, 0x26, 0x7e, 0xfd, 0xfe,
-	0xe7, 0x74, 0xf1, 0x82, 0x7c, 0x9a, 0xed, 0x3a, 0x0a, 0xa2, 0xe9, 0xdc, 0x9b, 0x72, 0xb1, 0xa0, 0x17, 0x41, 0x4d,
-	0x39, 0x5c, 0x1c, 0x90, 0xd4, 0xdf, 0x73, 0x0d, 0x5b, 0x1a, 0x7c, 0x06, 0xa8, 0x5f, 0xf4, 0xe9, 0xc5, 0xc0, 0x14,
-	0xe6, 0xbc, 0x41, 0x47, 0x0f, 0x41, 0x4f, 0x69, 0x9f, 0xaf, 0x0f, 0xd5, 0x76, 0x34, 0xb3, 0x86, 0xcd, 0x73, 0x7c,
-	0x54, 0x48, 0x52, 0xba, 0xe2, 0xb8, 0x9d, 0xc4, 0xf6, 0x88, 0x04, 0x32, 0x2b, 0x5d, 0x6f, 0xaa, 0x38, 0xb1, 0x31,
-	0x73, 0xfc, 0x7c, 0x26, 0xd2, 0x6e, 0x39, 0xe4, 0xc5, 0xe2, 0xc8, 0x51, 0x2f, 0xde, 0x7d, 0xc7, 0x72, 0x36, 0xaa,
-	0x15, 0x9c, 0xfc, 0xf4, 0x40, 0xde, 0xf7, 0x20, 0x99, 0x8f, 0x5a, 0xb1, 0x98, 0x39, 0x7b, 0x1a, 0x32, 0x43, 0x2b,
-	0x2a, 0x38, 0x68, 0x98, 0x4e, 0xb9, 0x5c, 0xf3, 0xa1, 0x1e, 0xe7, 0x7a, 0x5f, 0xad, 0xc7, 0xbf, 0x16, 0x15, 0xb6,
-	0x6f, 0x3e, 0xf3, 0x96, 0x65, 0x3c, 0x5e, 0x9c, 0x73, 0xc5, 0xd6, 0xb3, 0x76, 0xd8, 0xcf, 0x58, 0x5c, 0x3f, 0x87,
-	0x30, 0xfa, 0xb6, 0xd9, 0xd1, 0x31, 0xae, 0x05, 0xb9, 0xd8, 0xc9, 0x1d, 0x2e, 0xb1, 0x71, 0x6f, 0x1f, 0xea, 0xeb,
-	0xa2, 0xaf, 0xaf, 0x33, 0x5b, 0x5f, 0x73, 0x7c, 0x3b, 0xf3, 0xea, 0xfe, 0xb8, 0xfb, 0xd0, 0x59, 0xab, 0xf3, 0x94,
-	0x14, 0xb6, 0x58, 0xfa, 0x29, 0xe9, 0x74, 0xf0, 0x82, 0x7e, 0x5d, 0xd8, 0xa7, 0x50, 0x2f, 0x49, 0x12, 0x67, 0x50,
-	0xb9, 0x3e, 0xa8, 0x4c, 0x89, 0xb2, 0x8b, 0xf1, 0x71, 0x20, 0xcd, 0xa9, 0x17, 0x56, 0xb2, 0xf3, 0x83, 0x04, 0x58,
-	0x9d, 0xe1, 0xd1, 0x36, 0xb3, 0x69, 0x0f, 0x5e, 0xa0, 0x5c, 0x2b, 0x52, 0xcd, 0x59, 0x5d, 0x4a, 0xaa, 0x61, 0xe6,
-	0xc4, 0x3c, 0x73, 0xd7, 0x1d, 0xb9, 0xb5, 0xde, 0x66, 0x79, 0x21, 0x39, 0xb3, 0x4c, 0x1a, 0xc3, 0x92, 0x54, 0xb6,
-	0xde, 0x3a, 0x7f, 0xc2, 0x42, 0x13, 0xca, 0x39, 0xbd, 0xdb, 0xd0, 0x4f, 0x44, 0xda, 0xfe, 0x21, 0xb8, 0x1d, 0x07,
-	0xc7, 0x07, 0xa6, 0x42, 0xc3, 0xa7, 0xd5, 0xaa, 0xc2, 0xf7, 0xb3, 0x0c, 0x1b, 0x36, 0xeb, 0xaa, 0xe3, 0x3e, 0xc9,
-	0xdd, 0x5f, 0x58, 0xc8, 0x72, 0x6c, 0x87, 0xcc, 0xdf, 0x5e, 0x6d, 0xe4, 0x04, 0x44, 0x28, 0x3b, 0xd3, 0x50, 0xc1,
-	0xe6, 0x66, 0x0b, 0x37, 0x6f, 0x13, 0x4b, 0xa6, 0xe5, 0xb3, 0xec, 0xd5, 0xb5, 0xcd, 0xc1, 0xc8, 0xd7, 0x8c, 0x76,
-	0x4c, 0x8b, 0xc3, 0x71, 0x66, 0x09, 0x85, 0xfb, 0x8d, 0xb0, 0x84, 0xaa, 0x6d, 0xbf, 0xef, 0xa1, 0x3d, 0x19, 0xf4,
-	0xa5, 0xed, 0xc9, 0x4f, 0x56, 0x54, 0x69, 0x03, 0xb1, 0x38, 0x50, 0x6d, 0x45, 0xc6, 0x5c, 0xc6, 0x21, 0xb5, 0x78,
-	0x61, 0x0a, 0xfd, 0x1a, 0x33, 0xbb, 0x3a, 0x31, 0xcc, 0xad, 0xb1, 0xca, 0xf1, 0x4c, 0x75, 0x36, 0x98, 0xd8, 0x68,
-	0xca, 0x57, 0xc8, 0x26, 0xb6, 0x4c, 0x54, 0x6b, 0x8f, 0x36, 0x3e, 0x48, 0x67, 0x5e, 0x9a, 0x03, 0xe4, 0x89, 0xa7,
-	0x5a, 0xa8, 0xc1, 0xe9, 0xbb, 0xfa, 0xe6, 0x6f, 0xb9, 0xfe, 0xad, 0xec, 0x0e, 0x64, 0xa1, 0xc7, 0xf1, 0xa6, 0xf0,
-	0x1e, 0x97, 0x6f, 0x14, 0x68, 0x67, 0xdf, 0x58, 0x37, 0x8c, 0x93, 0x1b, 0x8a, 0xc3, 0xa9, 0xb2, 0x82, 0xa4, 0xe9,
-	0x4c, 0x5e, 0x34, 0xc7, 0xf3, 0x3a, 0x83, 0x45, 0xff, 0x06, 0xdf, 0xa8, 0xda, 0x2d, 0x23, 0xe1, 0xf9, 0x11, 0x67,
-	0x75, 0x53, 0x01, 0xc6, 0x9d, 0x14, 0xdc, 0x7b, 0x22, 0x95, 0x8f, 0x74, 0xda, 0xcc, 0xe0, 0x65, 0x12, 0x9e, 0xef,
-	0xd4, 0xa3, 0xd8, 0xed, 0xbf, 0xc6, 0x74, 0xbd, 0xdb, 0xdf, 0xf3, 0x50, 0xe2, 0x21, 0xdc, 0x38, 0x94, 0xb1, 0x1e,
-	0x78, 0x4e, 0x0e, 0xf5, 0xac, 0x36, 0xe5, 0x47, 0xeb, 0xe4, 0x47, 0x56, 0x90, 0xe2, 0x0a, 0x16, 0x91, 0x85, 0x73,
-	0x01, 0x89, 0x48, 0xe8, 0x8e, 0xd4, 0xc7, 0xd8, 0x3e, 0xe0, 0xd3, 0x78, 0x42, 0xa5, 0xad, 0xec, 0x4c, 0x7f, 0x35,
-	0xa3, 0xc7, 0x92, 0xd1, 0xce, 0x2a, 0x13, 0xc7, 0xee, 0xfe, 0x5b, 0x31, 0x88, 0xe9, 0xc4, 0x99, 0x23, 0x73, 0xe8,
-	0xa2, 0x50, 0xd1, 0x9a, 0xc9, 0xdb, 0xd9, 0x12, 0xf7, 0x19, 0x87, 0x50, 0x54, 0x2d, 0x9c, 0x87, 0x0a, 0xf9, 0x6c,
-	0xc1, 0x5d, 0xb9, 0x49, 0x1a, 0x26, 0x28, 0xfd, 0x54, 0x7c, 0xe0, 0x94, 0xb1, 0x3c, 0x57, 0xc6, 0x3d, 0xe7, 0x74,
-	0x56, 0x7a, 0x52, 0xaf, 0xab, 0xbf, 0x9c, 0xe8, 0xbd, 0x3d, 0x78, 0x6b, 0xf5, 0x97, 0xbb, 0x6b, 0x78, 0xe1, 0x95,
-	0x5e, 0x81, 0x7d, 0xdf, 0x1d, 0xee, 0xde, 0x6c, 0xee, 0x37, 0xf0, 0xf1, 0x6c, 0xb3, 0x0d, 0x13, 0xd9, 0x60, 0xd6,
-	0xf9, 0x8f, 0x3f, 0xbc, 0x3f, 0xfb, 0xdc, 0xbc, 0x6e, 0xc2, 0xfd, 0x67, 0xd3, 0xfc, 0x21, 0xcd, 0x07, 0x10, 0x49,
-	0x46, 0x2b, 0x10, 0x9a, 0xde, 0x02, 0xf6, 0xcf, 0xb8, 0x28, 0xc8, 0x1f, 0x52, 0xdd, 0x47, 0x04, 0x2d, 0x09, 0xf8,
-	0x87, 0xf8, 0x60, 0x30, 0x7f, 0xa0, 0xef, 0x06, 0x04, 0x52, 0x0e, 0xe1, 0x1c, 0x8c, 0x08, 0xa6, 0x1a, 0x87, 0x48,
-	0x51, 0xb8, 0x91, 0x20, 0x6b, 0x23, 0x94, 0xce, 0x53, 0x20, 0x92, 0x64, 0x11, 0x90, 0x8f, 0xe1, 0x43, 0x1e, 0xf0,
-	0x79, 0xf1, 0x81, 0x6c, 0x84, 0x08, 0x0e, 0x58, 0xf0, 0x0b, 0xbc, 0xe1, 0x85, 0x19, 0xf0, 0x85, 0x3f, 0xe0, 0x0b,
-	0x6f, 0xc0, 0x17, 0x66, 0xc0, 0x17, 0xb5, 0x01, 0x5f, 0xd8, 0x01, 0xf3, 0xee, 0x07, 0x42, 0x7d, 0xd5, 0x00, 0x60,
-	0x19, 0x22, 0x31, 0xf7, 0x7c, 0xd5, 0xa4, 0x97, 0xd4, 0xd3, 0xa7, 0x75, 0xc8, 0x1e, 0xf9, 0x40, 0xe3, 0x00, 0x44,
-	0x3a, 0x2c, 0x20, 0xbc, 0x21, 0xfc, 0xaa, 0x9d, 0x30, 0x7a, 0x0a, 0xa9, 0x9b, 0x9b, 0xd0, 0x8e, 0x3b, 0x22, 0x68,
-	0x11, 0x80, 0xe5, 0x0b, 0x00, 0x24, 0x8b, 0x00, 0x52, 0x5a, 0x04, 0x08, 0xb6, 0x08, 0x40, 0x6c, 0x11, 0x80, 0x92,
-	0x45, 0x04, 0x78, 0xc0, 0x9e, 0x3f, 0xe2, 0x87, 0xe7, 0xe2, 0x03, 0x1b, 0x44, 0x10, 0x30, 0x08, 0x83, 0xa9, 0x11,
-	0xa6, 0x1f, 0x21, 0x3a, 0x07, 0x09, 0xd6, 0x89, 0xc8, 0xb0, 0xc9, 0xc6, 0x44, 0x60, 0x4a, 0x12, 0xa2, 0xf3, 0x92,
-	0x60, 0x3f, 0x39, 0x13, 0x89, 0x19, 0x4a, 0x88, 0x8e, 0x5a, 0x82, 0xdd, 0xd0, 0x25, 0xce, 0x89, 0x5f, 0x62, 0x74,
-	0x10, 0x13, 0x5c, 0x89, 0x64, 0x62, 0x4d, 0x38, 0x13, 0xae, 0x93, 0x98, 0x60, 0x9d, 0xc9, 0x09, 0xc6, 0x74, 0x4e,
-	0xc8, 0xb9, 0x45, 0x74, 0x62, 0x33, 0xec, 0x66, 0x77, 0x22, 0x2f, 0xcc, 0x37, 0x99, 0x3c, 0x27, 0xf8, 0x05, 0x8b,
-	0x79, 0x19, 0x4f, 0x8c, 0x6f, 0xb1, 0x5a, 0xee, 0x13, 0x5b, 0xb1, 0x98, 0x55, 0x01, 0xc2, 0x95, 0x14, 0x24, 0x14,
-	0xf5, 0x20, 0x21, 0x85, 0x28, 0x24, 0x08, 0x95, 0x81, 0x10, 0x2d, 0x0f, 0x04, 0x3b, 0x1a, 0x91, 0x18, 0x57, 0x28,
-	0x12, 0x85, 0x6a, 0x41, 0x88, 0x96, 0x0c, 0x82, 0x5d, 0xdd, 0x20, 0xce, 0x11, 0x0f, 0x62, 0xb4, 0x82, 0x10, 0x5c,
-	0x91, 0x11, 0x62, 0x8d, 0x96, 0x10, 0x6e, 0x04, 0x85, 0x70, 0xa5, 0x2a, 0x09, 0x7d, 0x30, 0x63, 0x7d, 0x34, 0xc8,
-	0xb3, 0x45, 0xb4, 0xd2, 0x10, 0xec, 0xc8, 0x4d, 0x4a, 0x7e, 0x94, 0x1b, 0x42, 0xb4, 0xdc, 0x10, 0xac, 0xe5, 0x86,
-	0x61, 0x23, 0x37, 0x89, 0x40, 0xb9, 0x21, 0x44, 0xcb, 0x0d, 0xc1, 0xbe, 0xdc, 0x24, 0x12, 0xe5, 0x86, 0x10, 0x9d,
-	0x3c, 0x04, 0xbb, 0xc9, 0x43, 0x9c, 0x93, 0x3c, 0xc4, 0xe8, 0xe4, 0x21, 0xb8, 0x92, 0x3c, 0xc4, 0x9a, 0xe4, 0x21,
-	0x5c, 0xcb, 0x0d, 0xc1, 0x5a, 0x6e, 0x12, 0x8c, 0x72, 0x93, 0x90, 0x73, 0x8b, 0x68, 0xb9, 0x61, 0xd8, 0x95, 0x9b,
-	0x44, 0x5e, 0x98, 0x6f, 0x32, 0x72, 0x43, 0xf0, 0x0b, 0x16, 0xf3, 0xe4, 0x86, 0x18, 0xdf, 0x62, 0x35, 0xb9, 0x21,
-	0xb6, 0x62, 0x31, 0x2b, 0x37, 0x84, 0x2b, 0xb9, 0x49, 0x28, 0xca, 0x4d, 0x42, 0x0a, 0xb9, 0x49, 0x10, 0xca, 0x0d,
-	0x21, 0x5a, 0x6e, 0x08, 0x76, 0xe4, 0x26, 0x31, 0xae, 0xdc, 0x24, 0x0a, 0xe5, 0x86, 0x10, 0x2d, 0x37, 0x04, 0xbb,
-	0x72, 0x43, 0x9c, 0x23, 0x37, 0xc4, 0x68, 0xb9, 0x21, 0xb8, 0x22, 0x37, 0xc4, 0x1a, 0xb9, 0x21, 0xdc, 0xc8, 0x0d,
-	0xe1, 0x4a, 0x6e, 0x12, 0xfa, 0x60, 0xc6, 0xfa, 0x68, 0x90, 0x67, 0x8b, 0x68, 0xb9, 0x21, 0xd8, 0x91, 0x1b, 0x30,
-	0x08, 0x6a, 0x0e, 0xc2, 0x5a, 0x78, 0x90, 0xd3, 0xea, 0x53, 0x70, 0x46, 0x82, 0x80, 0x45, 0x1d, 0x42, 0x58, 0x8b,
-	0x11, 0x72, 0xbe, 0x22, 0x41, 0x0b, 0x94, 0x25, 0x84, 0x75, 0xa6, 0x21, 0xe7, 0xa6, 0x1b, 0x36, 0x70, 0x72, 0x0e,
-	0x69, 0x9d, 0x78, 0xc8, 0x55, 0xb2, 0x0f, 0x9b, 0x98, 0x14, 0x44, 0x52, 0x2b, 0x17, 0x72, 0x5a, 0xbe, 0x80, 0x43,
-	0x0d, 0x03, 0xf8, 0xbc, 0x02, 0x6b, 0x35, 0x2b, 0x38, 0x57, 0xd2, 0xa0, 0xc5, 0x85, 0xdf, 0x05, 0x23, 0x6e, 0xc8,
-	0xfd, 0x95, 0xc9, 0x3d, 0x99, 0x43, 0xfa, 0x05, 0x93, 0xd7, 0x04, 0x0f, 0x9b, 0xbc, 0x64, 0x72, 0x2b, 0x7d, 0x48,
-	0x2a, 0xfd, 0x03, 0x0a, 0x45, 0x10, 0xe0, 0x42, 0x09, 0x01, 0x47, 0x39, 0x44, 0x58, 0x6b, 0x22, 0x72, 0x8e, 0x30,
-	0x02, 0xed, 0xaa, 0x23, 0xf0, 0x28, 0x91, 0x08, 0x6b, 0x9d, 0x44, 0xce, 0x15, 0x4b, 0x6c, 0xe0, 0x28, 0x26, 0xd2,
-	0x5a, 0x36, 0x91, 0xab, 0x68, 0x27, 0x36, 0x31, 0x02, 0x8a, 0xa4, 0x51, 0x51, 0x24, 0x95, 0x94, 0x02, 0xf5, 0xe0,
-	0x5b, 0xe7, 0xd1, 0x87, 0x9f, 0x2b, 0xb0, 0x96, 0x57, 0xe4, 0x1c, 0x8d, 0xcd, 0x10, 0x2a, 0xac, 0x80, 0x5a, 0x5f,
-	0x85, 0xd1, 0xea, 0x0a, 0x8c, 0xd1, 0xd6, 0xcc, 0xa1, 0xb2, 0x0a, 0xa8, 0x75, 0x55, 0x18, 0x5f, 0x55, 0x33, 0x8f,
-	0x9a, 0x2a, 0xa0, 0x4e, 0x6f, 0x61, 0xdc, 0xe4, 0x16, 0xda, 0x49, 0x6d, 0x21, 0x75, 0x62, 0x0b, 0x53, 0x49, 0x6b,
-	0x69, 0x60, 0x92, 0x5a, 0x28, 0xad, 0xa2, 0xc2, 0x68, 0x0d, 0xcd, 0x0c, 0x2a, 0x68, 0x06, 0xcf, 0x5d, 0x50, 0xab,
-	0x27, 0x30, 0xae, 0x76, 0x66, 0xfe, 0xc2, 0xfb, 0x62, 0xa3, 0x9b, 0xc2, 0xbc, 0x6c, 0x58, 0x4f, 0x33, 0x85, 0xac,
-	0x1a, 0xb6, 0xa6, 0x97, 0xd2, 0xa0, 0x6e, 0x58, 0xab, 0x95, 0x42, 0x29, 0xa5, 0xcc, 0x04, 0xea, 0x64, 0x06, 0x0b,
-	0x95, 0xcc, 0x28, 0x6a, 0xa4, 0x80, 0x5a, 0x21, 0x85, 0x71, 0xf4, 0x31, 0x43, 0xae, 0x3a, 0x66, 0x16, 0xb5, 0x51,
-	0x40, 0xad, 0x8c, 0xc2, 0xb8, 0xba, 0x28, 0xb4, 0xa3, 0x8a, 0x42, 0x6a, 0x4d, 0x14, 0xa6, 0xa2, 0x88, 0xd2, 0xc0,
-	0xe8, 0xa1, 0x50, 0x46, 0x0d, 0x85, 0x52, 0x5a, 0x98, 0x89, 0x07, 0xcf, 0x12, 0x8f, 0x1e, 0xf8, 0xec, 0x82, 0x5a,
-	0x03, 0x85, 0x71, 0x14, 0x30, 0x8d, 0x1a, 0xe5, 0x8f, 0x10, 0xad, 0x7d, 0x04, 0x6b, 0xe1, 0x63, 0xd8, 0xa8, 0x5e,
-	0x22, 0x50, 0xf2, 0x08, 0xd1, 0x7a, 0x47, 0xb0, 0x2f, 0x76, 0x89, 0x44, 0xa5, 0x23, 0x44, 0x67, 0x23, 0xc1, 0x6e,
-	0x2a, 0x12, 0xe7, 0xe4, 0x21, 0x31, 0x3a, 0x09, 0x09, 0xae, 0x64, 0x20, 0xb1, 0x26, 0xfd, 0x08, 0xd7, 0xa2, 0x46,
-	0xb0, 0x56, 0xb4, 0x04, 0xa3, 0x9c, 0x25, 0xe4, 0xdc, 0x22, 0x5a, 0xc8, 0x18, 0x76, 0x55, 0x2c, 0x91, 0x17, 0xe6,
-	0x9b, 0x8c, 0x7e, 0x11, 0xfc, 0x82, 0xc5, 0x3c, 0xe5, 0x22, 0xc6, 0xb7, 0x58, 0x4d, 0xb3, 0x88, 0xad, 0x58, 0xcc,
-	0xaa, 0x15, 0xe1, 0x4a, 0xaa, 0x12, 0x8a, 0x3a, 0x95, 0x90, 0x42, 0xa4, 0x12, 0x84, 0x0a, 0x45, 0x88, 0x96, 0x27,
-	0x82, 0x1d, 0x6d, 0x4a, 0x8c, 0x2b, 0x4c, 0x89, 0x42, 0x55, 0x22, 0x44, 0x4b, 0x12, 0xc1, 0xae, 0x1e, 0x11, 0xe7,
-	0x88, 0x11, 0x31, 0x5a, 0x89, 0x08, 0xae, 0xc8, 0x10, 0xb1, 0x46, 0x83, 0x08, 0x37, 0x02, 0x44, 0xb8, 0x52, 0x9f,
-	0x84, 0x3e, 0x98, 0xb1, 0x3e, 0x1a, 0xe4, 0xd9, 0x22, 0x5a, 0x71, 0x08, 0x76, 0xe4, 0x86, 0x7a, 0x89, 0x7a, 0xc3,
-	0x90, 0x16, 0x1c, 0xc6, 0xb5, 0xe2, 0x64, 0xdc, 0x48, 0x0e, 0x31, 0xa8, 0x39, 0x0c, 0x69, 0xd1, 0x61, 0xdc, 0x57,
-	0x1d, 0x62, 0x51, 0x76, 0x18, 0xd2, 0x59, 0xc4, 0xb8, 0x9b, 0x46, 0x4c, 0x3a, 0x79, 0xc4, 0x94, 0x4e, 0x24, 0xc6,
-	0x2b, 0x99, 0xc4, 0xb4, 0x49, 0x25, 0x26, 0xb4, 0xfa, 0x30, 0xae, 0xe5, 0x87, 0x70, 0xd4, 0x1f, 0x82, 0xce, 0x1d,
-	0x48, 0x2b, 0x50, 0xc6, 0x5d, 0x09, 0x22, 0xf6, 0xc2, 0x7e, 0x9d, 0x11, 0x21, 0xc6, 0x5f, 0x32, 0x9f, 0x27, 0x43,
-	0x4c, 0x55, 0xcc, 0x57, 0x13, 0x22, 0xa6, 0x6b, 0xe6, 0xb3, 0x52, 0xc4, 0x84, 0xd2, 0x22, 0x82, 0x51, 0x8c, 0x08,
-	0x2a, 0xd4, 0x88, 0x30, 0x94, 0x23, 0x86, 0xb4, 0x1e, 0x31, 0xee, 0x08, 0x12, 0x51, 0xae, 0x22, 0x11, 0x87, 0x92,
-	0xc4, 0x90, 0xd6, 0x24, 0xc6, 0x5d, 0x51, 0x62, 0xd2, 0x51, 0x25, 0xa6, 0xb4, 0x2c, 0x31, 0x5e, 0xd1, 0x25, 0xa6,
-	0x8d, 0x30, 0x31, 0x61, 0x94, 0x89, 0x09, 0x25, 0x4d, 0x04, 0x3f, 0xd8, 0x51, 0x3f, 0x5a, 0xe8, 0xd9, 0x81, 0xb4,
-	0x3c, 0x31, 0xee, 0xe8, 0x13, 0xf5, 0x09, 0xf5, 0x89, 0x21, 0xad, 0x4f, 0x8c, 0x6b, 0x7d, 0xca, 0xb8, 0xd1, 0x27,
-	0x62, 0x50, 0x9f, 0x18, 0xd2, 0xfa, 0xc4, 0xb8, 0xaf, 0x4f, 0xc4, 0xa2, 0x3e, 0x31, 0xa4, 0x13, 0x8c, 0x71, 0x37,
-	0xc1, 0x98, 0x74, 0x12, 0x8c, 0x29, 0x9d, 0x60, 0x8c, 0x57, 0x12, 0x8c, 0x69, 0x93, 0x60, 0x4c, 0x68, 0x7d, 0x62,
-	0x5c, 0xeb, 0x13, 0xe1, 0xa8, 0x4f, 0x04, 0x9d, 0x3b, 0x90, 0xd6, 0xa7, 0x8c, 0xbb, 0xfa, 0x44, 0xec, 0x85, 0xfd,
-	0x3a, 0xa3, 0x4f, 0x8c, 0xbf, 0x64, 0x3e, 0x4f, 0x9f, 0x98, 0xaa, 0x98, 0xaf, 0xa6, 0x4f, 0x4c, 0xd7, 0xcc, 0x67,
-	0xf5, 0x89, 0x09, 0xa5, 0x4f, 0x04, 0xa3, 0x3e, 0x11, 0x54, 0xe8, 0x13, 0x61, 0xa8, 0x4f, 0x0c, 0x69, 0x7d, 0x62,
-	0xdc, 0xd1, 0x27, 0xa2, 0x5c, 0x7d, 0x22, 0x0e, 0xf5, 0x89, 0x21, 0xad, 0x4f, 0x8c, 0xbb, 0xfa, 0xc4, 0xa4, 0xa3,
-	0x4f, 0x4c, 0x69, 0x7d, 0x62, 0xbc, 0xa2, 0x4f, 0x4c, 0x1b, 0x7d, 0x62, 0xc2, 0xe8, 0x13, 0x13, 0x4a, 0x9f, 0x08,
-	0x7e, 0xb0, 0xa3, 0x7e, 0xb4, 0x50, 0xd0, 0xa7, 0xb1, 0x86, 0xd8, 0x10, 0x1a, 0x87, 0xb1, 0x32, 0xd5, 0x7f, 0x35,
-	0xaa, 0x53, 0x02, 0xb4, 0x36, 0x25, 0x54, 0x2b, 0x13, 0xa1, 0x46, 0x97, 0x7a, 0x1c, 0x55, 0x29, 0x01, 0x5a, 0x93,
-	0x12, 0xea, 0x2b, 0x52, 0xcf, 0xa1, 0x1e, 0x25, 0x40, 0xa7, 0x53, 0x42, 0xdd, 0x64, 0x4a, 0x94, 0x93, 0x4a, 0x89,
-	0xd0, 0x89, 0x94, 0xd0, 0x4a, 0x1a, 0x25, 0xd2, 0x24, 0x51, 0x82, 0xb5, 0x02, 0x25, 0x54, 0xeb, 0x4f, 0x8f, 0xa2,
-	0xfa, 0xf4, 0xc0, 0xb9, 0x01, 0xb4, 0xf2, 0x10, 0xea, 0xea, 0x4e, 0xcf, 0x5d, 0xe8, 0x2f, 0x31, 0x9a, 0x93, 0xd0,
-	0xba, 0x91, 0x3c, 0xbd, 0x49, 0x84, 0x6b, 0xa4, 0x9a, 0xd6, 0x24, 0xd2, 0x37, 0x92, 0xd5, 0x99, 0x04, 0x2b, 0x95,
-	0xe9, 0x3f, 0xa2, 0xc6, 0xf4, 0x40, 0xa1, 0x30, 0x3d, 0x82, 0xfa, 0x92, 0x00, 0xad, 0x2e, 0x09, 0x75, 0xb4, 0xa5,
-	0x27, 0x5c, 0x65, 0xe9, 0x19, 0xd4, 0x95, 0x04, 0x68, 0x55, 0x49, 0xa8, 0xab, 0x29, 0x89, 0x72, 0x14, 0x25, 0x11,
-	0x5a, 0x4f, 0x12, 0x5a, 0x51, 0x93, 0x44, 0x1a, 0x2d, 0x49, 0xb0, 0x51, 0x92, 0x04, 0x2b, 0x1d, 0xe9, 0x3f, 0x3e,
-	0xe8, 0x11, 0x3e, 0x6a, 0xe0, 0xd9, 0x00, 0x7a, 0x7e, 0x93, 0x50, 0x67, 0x76, 0x93, 0x82, 0x1c, 0xe5, 0x83, 0x10,
-	0xad, 0x1f, 0x04, 0x6b, 0x01, 0x61, 0xd8, 0x28, 0x48, 0x22, 0x50, 0x42, 0x08, 0xd1, 0x1a, 0x42, 0xb0, 0x2f, 0x22,
-	0x89, 0x44, 0x15, 0x21, 0x44, 0x67, 0x08, 0xc1, 0x6e, 0x8a, 0x10, 0xe7, 0xe4, 0x08, 0x31, 0x3a, 0x49, 0x08, 0xae,
-	0x64, 0x09, 0xb1, 0x26, 0x4d, 0x08, 0xd7, 0x62, 0x42, 0xb0, 0x56, 0x93, 0xf4, 0x19, 0xe5, 0x24, 0x21, 0xe7, 0x16,
-	0xd1, 0x82, 0xc2, 0xb0, 0xab, 0x28, 0x89, 0xbc, 0x30, 0xdf, 0x64, 0x34, 0x85, 0xe0, 0x17, 0x2c, 0xe6, 0xa9, 0x0a,
-	0x31, 0xbe, 0xc5, 0x6a, 0xba, 0x42, 0x6c, 0xc5, 0x62, 0x56, 0x59, 0x08, 0x57, 0xd2, 0x92, 0x50, 0xd4, 0x96, 0x84,
-	0x14, 0xe2, 0x92, 0x20, 0x54, 0x17, 0x42, 0xb4, 0xbc, 0x10, 0xec, 0xe8, 0x4b, 0x62, 0x5c, 0x81, 0x49, 0x14, 0x2a,
-	0x0c, 0x21, 0x5a, 0x62, 0x08, 0x76, 0x35, 0x86, 0x38, 0x47, 0x64, 0x88, 0xd1, 0x2a, 0x43, 0x70, 0x45, 0x66, 0x88,
-	0x35, 0x3a, 0x43, 0xb8, 0x11, 0x1a, 0xc2, 0x95, 0xd2, 0x24, 0xf4, 0xc1, 0x8c, 0xf5, 0xd1, 0x20, 0xcf, 0x16, 0xd1,
-	0x6a, 0x43, 0xb0, 0x95, 0x9b, 0x9f, 0x9a, 0xd7, 0xf1, 0x0f, 0x65, 0xe4, 0x0f, 0x74, 0x21, 0x20, 0xa4, 0x0e, 0x80,
-	0xa0, 0x0d, 0x01, 0x96, 0x9b, 0x03, 0x48, 0x96, 0x03, 0x84, 0xcd, 0x02, 0x10, 0x5b, 0x04, 0xa0, 0x64, 0x0c, 0x00,
-	0x28, 0x5b, 0x05, 0xb9, 0x88, 0x41, 0x96, 0x3f, 0x50, 0xbf, 0x01, 0xc1, 0x5e, 0x02, 0x2c, 0xbd, 0x04, 0x90, 0x7a,
-	0x09, 0x48, 0xe9, 0x5a, 0x20, 0xb8, 0xfb, 0x00, 0x71, 0xf7, 0x01, 0x4a, 0xdd, 0x67, 0xe0, 0x0d, 0x1a, 0xf9, 0x8d,
-	0x31, 0xf2, 0x1b, 0x63, 0xe4, 0x37, 0xbe, 0x91, 0xdf, 0x78, 0x46, 0x7e, 0x63, 0x8c, 0xfc, 0xc6, 0x1a, 0xf9, 0x8d,
-	0x35, 0xf2, 0x1b, 0x6d, 0xe4, 0x37, 0xc6, 0xc8, 0x6f, 0x62, 0x6e, 0x4f, 0xf3, 0x20, 0x56, 0xf1, 0x27, 0x16, 0xf9,
-	0xc3, 0x1a, 0x99, 0xb5, 0x92, 0xb2, 0x37, 0x98, 0xc6, 0x19, 0x4c, 0xaa, 0x89, 0xa6, 0x20, 0x44, 0xdb, 0x83, 0x60,
-	0x6d, 0x14, 0x82, 0x5d, 0xcb, 0x10, 0xe7, 0x98, 0x87, 0x18, 0x6d, 0x23, 0x82, 0x8d, 0xa1, 0x08, 0x37, 0xd6, 0x22,
-	0x5c, 0x99, 0x8c, 0x50, 0x6d, 0xb7, 0x04, 0x2f, 0xcd, 0xd8, 0xd1, 0x82, 0x09, 0x59, 0x9b, 0x36, 0xc6, 0x96, 0x04,
-	0x7b, 0x06, 0xed, 0x5f, 0xf3, 0x2d, 0x0c, 0x9a, 0x10, 0x63, 0xd0, 0x04, 0x1b, 0x83, 0x26, 0xd8, 0x37, 0x68, 0xe2,
-	0x3c, 0x83, 0x26, 0xc6, 0x18, 0x34, 0xc1, 0xd6, 0xa0, 0x09, 0xb7, 0x06, 0x4d, 0xb8, 0x36, 0x68, 0x42, 0x8d, 0x41,
-	0x7b, 0x78, 0x69, 0xc6, 0x5e, 0x18, 0xb4, 0x47, 0xd6, 0xa6, 0x8d, 0x35, 0x68, 0x82, 0xad, 0x41, 0xdf, 0x46, 0x5b,
-	0xe6, 0xca, 0xf5, 0x36, 0xdb, 0x11, 0x21, 0xb2, 0x21, 0x42, 0xa5, 0xd2, 0x08, 0x8e, 0x52, 0x23, 0x68, 0xd6, 0x1a,
-	0x81, 0x44, 0x53, 0x04, 0x13, 0x51, 0x11, 0x8c, 0x55, 0x45, 0x10, 0xb2, 0x13, 0x40, 0x1b, 0xa9, 0xc6, 0x6f, 0xf9,
-	0xd7, 0x0f, 0x11, 0xa1, 0xfe, 0x03, 0x82, 0xdd, 0x07, 0x58, 0x7a, 0x0f, 0x20, 0x75, 0x1e, 0x10, 0xee, 0x3b, 0x40,
-	0xdc, 0x75, 0x80, 0x52, 0xcf, 0x01, 0xa0, 0x8e, 0x0b, 0x92, 0xfe, 0xc4, 0x58, 0xfc, 0x41, 0x79, 0x46, 0xca, 0x71,
-	0x75, 0xd6, 0x17, 0xf4, 0x43, 0x96, 0x25, 0xe4, 0xfb, 0xa2, 0x73, 0x7d, 0x01, 0x2f, 0x73, 0x17, 0xb0, 0x75, 0x51,
-	0xe7, 0xb8, 0xa8, 0x73, 0x5c, 0xb4, 0x95, 0x78, 0x7c, 0xcb, 0x3f, 0xbc, 0x86, 0x08, 0x76, 0x0f, 0x60, 0xe9, 0x1d,
-	0x80, 0xd4, 0x0b, 0x40, 0xb8, 0x13, 0x00, 0x71, 0x1f, 0x04, 0xda, 0xcb, 0xc4, 0xe9, 0x2d, 0xff, 0x5e, 0x05, 0x22,
-	0xd8, 0x05, 0x80, 0xed, 0xb4, 0xeb, 0x2d, 0xbf, 0xaf, 0x8b, 0x48, 0x59, 0x17, 0x81, 0xe0, 0xbe, 0x01, 0x44, 0xf3,
-	0x6e, 0x40, 0xc8, 0xeb, 0x82, 0xd0, 0x9f, 0x7e, 0x43, 0xb7, 0x1f, 0x30, 0x1f, 0x0f, 0x2a, 0x77, 0xdf, 0xf2, 0xef,
-	0xae, 0x15, 0x48, 0x31, 0xed, 0x26, 0xfc, 0x1d, 0xea, 0xe2, 0x3b, 0x23, 0x89, 0xef, 0x8c, 0x1a, 0xbe, 0xf3, 0x85,
-	0xf0, 0x9d, 0xa7, 0x81, 0xef, 0x8c, 0xfc, 0xbd, 0xb3, 0xca, 0xf7, 0xce, 0x8a, 0xde, 0x3b, 0xad, 0x77, 0xef, 0x8c,
-	0xd4, 0xbd, 0x8b, 0x19, 0x3c, 0xc9, 0x83, 0xd8, 0xa8, 0x18, 0x7a, 0x97, 0x33, 0x18, 0x10, 0x2f, 0xaa, 0xde, 0x61,
-	0x06, 0x03, 0xa8, 0xa2, 0xea, 0x9d, 0x64, 0x30, 0x40, 0x3a, 0xaa, 0xde, 0x71, 0x06, 0x03, 0x40, 0xfd, 0x16, 0x84,
-	0x33, 0x38, 0x03, 0x05, 0xdb, 0x99, 0x81, 0x70, 0xfa, 0x22, 0xe2, 0x0e, 0xa4, 0xf3, 0x06, 0x82, 0xb9, 0x0b, 0xa8,
-	0x19, 0x5e, 0x67, 0x87, 0xd7, 0xd9, 0xe1, 0xed, 0x8b, 0x0f, 0xa6, 0xab, 0x7b, 0xbf, 0x63, 0x7b, 0xaf, 0x63, 0x7b,
-	0xd3, 0x05, 0x95, 0x34, 0x40, 0xd8, 0xbe, 0x71, 0xd2, 0x00, 0x62, 0x0c, 0x9d, 0x93, 0x26, 0x23, 0x27, 0xa4, 0x4f,
-	0xa6, 0xfb, 0x27, 0xbf, 0xfb, 0x27, 0xaf, 0xfb, 0x27, 0xd3, 0xfd, 0x53, 0xad, 0xfb, 0x27, 0xdb, 0xfd, 0x93, 0x35,
-	0xed, 0xa9, 0x8c, 0x9c, 0xf7, 0x71, 0xef, 0x60, 0x2c, 0x1f, 0xd4, 0x3a, 0xed, 0x7d, 0xb9, 0x63, 0x00, 0xb0, 0x5d,
-	0x9d, 0xbd, 0xcf, 0xfb, 0x04, 0x80, 0xf8, 0x6b, 0xb2, 0xf7, 0xb2, 0x3b, 0x00, 0x10, 0xd9, 0x1a, 0x10, 0xb2, 0xb5,
-	0x20, 0x90, 0x99, 0xef, 0x73, 0x0c, 0x03, 0x42, 0x31, 0x8c, 0x88, 0x23, 0x22, 0xef, 0x31, 0x86, 0x11, 0x94, 0x18,
-	0x06, 0x54, 0x49, 0xcb, 0x7b, 0x89, 0x61, 0x80, 0xb4, 0xb4, 0xbc, 0x8f, 0x31, 0x0c, 0x1f, 0x4c, 0x57, 0xf7, 0x7e,
-	0xc7, 0xf6, 0x5e, 0xc7, 0xf6, 0xa6, 0x0b, 0x2a, 0x86, 0x81, 0xb0, 0x7d, 0xe3, 0x18, 0x06, 0x44, 0x89, 0xdc, 0xfb,
-	0x18, 0xb1, 0xa3, 0x6c, 0x64, 0x8e, 0x58, 0x40, 0x8a, 0xce, 0x0a, 0x0c, 0x9d, 0x15, 0x90, 0x3b, 0x2b, 0x88, 0xea,
-	0xac, 0x10, 0xb9, 0xb3, 0x02, 0x65, 0x43, 0x0a, 0x44, 0x1a, 0x9d, 0x81, 0xe7, 0xe2, 0x83, 0xe9, 0xec, 0xb3, 0xd3,
-	0x2b, 0xac, 0x49, 0x18, 0xf0, 0x05, 0xae, 0x63, 0xbf, 0x20, 0xdd, 0x34, 0x28, 0x5a, 0x38, 0x19, 0x51, 0xf0, 0x3a,
-	0x39, 0x0a, 0xb2, 0x92, 0x27, 0x45, 0x1b, 0x93, 0x32, 0x05, 0xab, 0xb3, 0xa7, 0x20, 0x75, 0x22, 0x21, 0x89, 0x81,
-	0x50, 0xe0, 0x3a, 0x66, 0x0b, 0x52, 0x67, 0x5a, 0x49, 0x7a, 0xb1, 0x5d, 0xb4, 0x70, 0xc2, 0xbc, 0xe4, 0x9d, 0x54,
-	0x2c, 0x1a, 0xe8, 0x94, 0x28, 0x48, 0x93, 0x04, 0x05, 0x6b, 0x72, 0x15, 0xd9, 0x7d, 0x0d, 0x7f, 0xc9, 0x1a, 0x7e,
-	0x32, 0x17, 0x2d, 0xfe, 0x62, 0xc0, 0x26, 0xc5, 0x0b, 0xb2, 0x92, 0xed, 0x45, 0x9b, 0x17, 0xc7, 0x6c, 0x34, 0xa0,
-	0x20, 0xb5, 0x1c, 0x20, 0x79, 0xaa, 0x64, 0x91, 0x11, 0x89, 0x82, 0x74, 0xf5, 0xa2, 0x68, 0xf1, 0x17, 0x49, 0x6a,
-	0x54, 0xa4, 0x20, 0x2b, 0x82, 0x52, 0xb4, 0x31, 0xda, 0x52, 0xb0, 0x46, 0x66, 0x0a, 0x56, 0x29, 0x0e, 0x72, 0xcf,
-	0x35, 0xfc, 0x25, 0x7b, 0x38, 0x92, 0xf4, 0x5b, 0xdc, 0xc8, 0x1e, 0xce, 0xf3, 0x07, 0x5e, 0x3c, 0x01, 0x82, 0xf3,
-	0x68, 0xc1, 0xc3, 0xaa, 0x7b, 0xdc, 0xf2, 0x87, 0x15, 0x7e, 0x58, 0x17, 0x1f, 0x58, 0xcd, 0x04, 0x01, 0x81, 0xca,
-	0x20, 0xee, 0xe2, 0xf2, 0x16, 0xf9, 0x6f, 0xfd, 0x13, 0xd7, 0xdc, 0xe4, 0xd9, 0xdc, 0xe9, 0xd9, 0xb9, 0x53, 0x7e,
-	0x9b, 0x39, 0xf7, 0xb4, 0x7c, 0x9b, 0xd9, 0xc0, 0xee, 0xe8, 0xf2, 0x3b, 0xbf, 0xea, 0xbe, 0x2b, 0x83, 0xac, 0x2d,
-	0xa2, 0xfb, 0x69, 0x5e, 0xf9, 0x55, 0x8c, 0x3b, 0xf6, 0xfc, 0xd2, 0xab, 0x6a, 0x6c, 0xac, 0x60, 0x5e, 0x7a, 0xcd,
-	0x0c, 0x0e, 0x0d, 0x0d, 0x52, 0xe0, 0xda, 0x2c, 0x25, 0xe9, 0x1a, 0x07, 0xd1, 0x65, 0xe5, 0xfb, 0x56, 0x15, 0x7c,
-	0x5d, 0xc3, 0xf5, 0xb0, 0x0a, 0xf2, 0x2f, 0x06, 0xe7, 0x1a, 0x50, 0x25, 0x8b, 0x7b, 0xa1, 0x31, 0x66, 0x25, 0x59,
-	0x32, 0x9f, 0xe4, 0x0b, 0x8d, 0x49, 0x88, 0x36, 0x23, 0xc3, 0xae, 0x01, 0x13, 0xb9, 0x34, 0xf7, 0x5d, 0x19, 0x64,
-	0x6d, 0x11, 0xdd, 0x65, 0x82, 0xab, 0x9d, 0x75, 0x8d, 0x93, 0xa8, 0x67, 0xd3, 0xd8, 0x18, 0x84, 0x60, 0x7b, 0xf7,
-	0xf8, 0xd7, 0xa3, 0x73, 0x1d, 0xcf, 0xbf, 0x0f, 0x8a, 0x08, 0x2d, 0x48, 0x01, 0xf1, 0xe6, 0x2e, 0xf8, 0x63, 0xa1,
-	0x08, 0xaa, 0x59, 0x8a, 0xfc, 0x10, 0x3b, 0x42, 0xfa, 0x99, 0x09, 0xff, 0xfa, 0x13, 0x02, 0x6a, 0xca, 0x41, 0x3f,
-	0x0a, 0xfd, 0xda, 0x22, 0x7a, 0x04, 0x04, 0xeb, 0x61, 0x10, 0xec, 0x8e, 0x85, 0x38, 0x67, 0x40, 0xc4, 0xe8, 0x51,
-	0x11, 0x6c, 0x86, 0x46, 0xb8, 0x19, 0x1f, 0xe1, 0x6a, 0x90, 0x84, 0xea, 0x91, 0xe6, 0x8d, 0x75, 0x8d, 0xe8, 0x91,
-	0x96, 0x1b, 0xeb, 0x1a, 0x76, 0x47, 0x6a, 0x36, 0xd6, 0x35, 0xa3, 0x47, 0xaa, 0x36, 0xd6, 0x35, 0x6e, 0x46, 0x5a,
-	0x6c, 0xac, 0x6b, 0xd4, 0x8c, 0x14, 0xd2, 0xec, 0x75, 0x0d, 0x37, 0xa3, 0x46, 0xd2, 0x8c, 0x1d, 0x49, 0xdf, 0x02,
-	0xd8, 0xc2, 0xb3, 0x03, 0xf2, 0xc6, 0x1a, 0x48, 0x5a, 0x9b, 0x20, 0x6b, 0x2d, 0x83, 0xac, 0xb6, 0x0f, 0x72, 0xda,
-	0x4a, 0xe9, 0xf3, 0x6b, 0x8b, 0x68, 0xcb, 0x10, 0xac, 0x6d, 0x42, 0xb0, 0x6b, 0x0d, 0xe2, 0x1c, 0x3b, 0x10, 0xa3,
-	0x2d, 0x40, 0xb0, 0x19, 0x3b, 0xe1, 0x66, 0xd4, 0x84, 0xab, 0xf1, 0x12, 0xaa, 0x46, 0xfa, 0x21, 0x0e, 0x72, 0x22,
-	0x1f, 0xd4, 0xce, 0xc7, 0x87, 0x3c, 0x34, 0x40, 0xbc, 0xbd, 0x90, 0x0f, 0x38, 0x20, 0x00, 0xd5, 0x5e, 0xc8, 0x07,
-	0x19, 0x06, 0x40, 0x7a, 0xcb, 0xe3, 0x03, 0x77, 0x1e, 0x00, 0xb5, 0x87, 0xf3, 0x21, 0x56, 0x16, 0xf8, 0xa0, 0x76,
-	0xc2, 0x3e, 0xa8, 0x7a, 0x22, 0x38, 0x3c, 0x01, 0xf9, 0x10, 0xab, 0x88, 0x7c, 0xf8, 0x8c, 0xcd, 0xd6, 0xc8, 0xe8,
-	0xe7, 0x1f, 0x1f, 0xbc, 0x47, 0x1f, 0x1f, 0xb2, 0x5a, 0x4e, 0x14, 0xa2, 0x6d, 0x5a, 0xaa, 0xa5, 0x86, 0x5d, 0xeb,
-	0x1a, 0xb5, 0xd4, 0x8c, 0xb6, 0xb3, 0x52, 0x4b, 0x8d, 0x1b, 0x8b, 0x17, 0x6a, 0xa9, 0x51, 0x6d, 0xfb, 0x3c, 0x71,
-	0xd4, 0x88, 0xf6, 0x82, 0x37, 0x71, 0x54, 0xe4, 0xd2, 0x58, 0x70, 0x65, 0x90, 0xcf, 0xe6, 0xaa, 0xb5, 0x69, 0x63,
-	0x7c, 0x64, 0xa6, 0x92, 0x99, 0x01, 0x0b, 0xa3, 0xb7, 0x10, 0xd6, 0x2e, 0x43, 0x4e, 0xfb, 0x0d, 0x39, 0xd7, 0x79,
-	0xd8, 0xc0, 0xf1, 0x20, 0xd2, 0xda, 0x8d, 0xc8, 0x19, 0x5f, 0x22, 0x69, 0x1c, 0x8a, 0xa4, 0xf2, 0x2a, 0x52, 0xda,
-	0xb5, 0xe5, 0xeb, 0xfa, 0x2e, 0xac, 0x9d, 0x5c, 0x7d, 0x5d, 0xdf, 0x6b, 0xb1, 0xf4, 0xfd, 0xb0, 0xf2, 0xe1, 0xcf,
-	0xfe, 0x4d, 0xd6, 0x7e, 0x6b, 0x13, 0x02, 0xfe, 0xdb, 0xeb, 0x99, 0xce, 0x10, 0x46, 0x81, 0x80, 0x3a, 0x06, 0x84,
-	0xd1, 0x11, 0x20, 0x8c, 0xeb, 0x7f, 0xa1, 0x1d, 0xef, 0x0b, 0xa9, 0x7d, 0x2f, 0x8c, 0xf1, 0xbc, 0x50, 0xc6, 0xef,
-	0x42, 0x29, 0xaf, 0x0b, 0xa1, 0x7d, 0x8e, 0x2f, 0x18, 0x3b, 0xa0, 0xf6, 0x77, 0xe5, 0x05, 0x63, 0xcb, 0x2f, 0x3d,
-	0x5b, 0xaf, 0x3c, 0xf0, 0xb3, 0x77, 0xf9, 0xda, 0x6b, 0x69, 0x7c, 0xec, 0xbd, 0x7f, 0x9b, 0xc9, 0x64, 0x52, 0x74,
-	0x2f, 0x21, 0xda, 0xb7, 0x04, 0x6b, 0xc7, 0x12, 0xec, 0x7a, 0x95, 0x38, 0xc7, 0xa5, 0xc4, 0x68, 0x7f, 0x12, 0x6c,
-	0x9c, 0x49, 0xb8, 0xf1, 0x24, 0xe1, 0xca, 0x8d, 0x84, 0x6a, 0x1f, 0xe6, 0xb7, 0x2a, 0x35, 0xa2, 0xbd, 0xe7, 0xbd,
-	0x55, 0xa9, 0xc8, 0xa5, 0xb1, 0xe0, 0xca, 0x20, 0x9f, 0xcd, 0x55, 0x6b, 0xd3, 0xc6, 0xf8, 0xca, 0xbc, 0x8c, 0x98,
-	0x99, 0x62, 0x77, 0x08, 0xfd, 0x55, 0x12, 0xda, 0x6d, 0x25, 0xab, 0xbd, 0x57, 0xb2, 0xae, 0x13, 0xcb, 0x26, 0x8e,
-	0x2f, 0xcb, 0x06, 0xda, 0xa5, 0x25, 0x6b, 0x3c, 0x5b, 0xd2, 0xc6, 0xc1, 0x25, 0xad, 0xfc, 0x5c, 0x92, 0xda, 0xdd,
-	0x05, 0x7b, 0x5e, 0x25, 0xb4, 0xf3, 0x15, 0xeb, 0xc6, 0x40, 0xd1, 0x66, 0x59, 0xf3, 0xd1, 0xaa, 0x46, 0x7c, 0xae,
-	0xdd, 0x6a, 0x5d, 0xbb, 0xc2, 0x84, 0x49, 0xc9, 0x3a, 0xd1, 0x42, 0x86, 0xc6, 0x38, 0x61, 0x48, 0x47, 0x08, 0xe3,
-	0x3a, 0x36, 0x18, 0x77, 0xa3, 0x82, 0x49, 0x27, 0x1e, 0x98, 0xd2, 0x91, 0xc0, 0xb8, 0x89, 0x01, 0x26, 0x8c, 0xf7,
-	0x99, 0x50, 0x7e, 0x67, 0x58, 0x7b, 0x5c, 0x5e, 0x5b, 0x34, 0x90, 0xf6, 0xb2, 0xfb, 0xda, 0xa2, 0x66, 0x97, 0xd6,
-	0x9e, 0x2b, 0x0b, 0x7d, 0xb6, 0x17, 0xae, 0x6d, 0x2b, 0xe3, 0x41, 0xfb, 0x96, 0x5f, 0xa6, 0xd2, 0x2e, 0x09, 0xba,
-	0x8e, 0x10, 0xed, 0x39, 0x82, 0xb5, 0xe3, 0x08, 0x76, 0xfd, 0x46, 0x9c, 0xe3, 0x36, 0x62, 0xb4, 0xd7, 0x08, 0x36,
-	0x4e, 0x23, 0xdc, 0xf8, 0x8c, 0x70, 0xe5, 0x32, 0x42, 0xb5, 0xc7, 0xf2, 0x06, 0x98, 0x46, 0xb4, 0xbf, 0xbc, 0x0d,
-	0x30, 0x45, 0x2e, 0x8d, 0x05, 0x57, 0x06, 0xf9, 0x6c, 0xae, 0x5a, 0x9b, 0x36, 0xc6, 0x53, 0x66, 0x4b, 0x2c, 0x33,
-	0x79, 0x09, 0x3c, 0x51, 0x88, 0x76, 0x54, 0xb9, 0x04, 0xd6, 0xb0, 0xeb, 0x28, 0xb3, 0x04, 0xd6, 0x8c, 0x76, 0x94,
-	0x5a, 0x02, 0x6b, 0xdc, 0x38, 0xaa, 0x58, 0x02, 0x6b, 0x54, 0x3b, 0x2a, 0x1f, 0x52, 0xd7, 0x88, 0x76, 0x94, 0x77,
-	0x48, 0x5d, 0x91, 0x4b, 0x63, 0xc1, 0x95, 0x41, 0x3e, 0x9b, 0xab, 0xd6, 0xa6, 0x8d, 0x71, 0x94, 0x39, 0xdb, 0xcd,
-	0xcc, 0x59, 0xf4, 0xd1, 0x7c, 0x9a, 0x3f, 0xd0, 0x85, 0x80, 0x90, 0x67, 0x00, 0x41, 0xa7, 0x00, 0x2c, 0x37, 0x07,
-	0x90, 0x5c, 0x01, 0x08, 0x7b, 0x01, 0x20, 0x76, 0x00, 0x40, 0xc9, 0xf6, 0x00, 0x90, 0xd9, 0x05, 0x81, 0x63, 0x3a,
-	0x67, 0xe6, 0x98, 0xce, 0x99, 0x39, 0xa6, 0x73, 0xe6, 0x1f, 0xd3, 0x39, 0xf3, 0x8e, 0xe9, 0x9c, 0x99, 0x63, 0x3a,
-	0x67, 0xf6, 0x98, 0xce, 0x99, 0x3d, 0xa6, 0x73, 0xa6, 0x8f, 0xe9, 0x9c, 0x99, 0x63, 0x3a, 0x67, 0xe6, 0xa0, 0xdd,
-	0x59, 0xd3, 0xa1, 0x3b, 0x3a, 0xe5, 0xba, 0xb3, 0xfc, 0xe4, 0x15, 0x11, 0xe7, 0x15, 0x85, 0x33, 0x7c, 0xc6, 0x8a,
-	0xa0, 0x3c, 0x58, 0x05, 0x54, 0xbd, 0xae, 0x70, 0x26, 0x8f, 0x50, 0x01, 0xd2, 0xaf, 0x21, 0x9c, 0xc5, 0x87, 0xa5,
-	0xd3, 0xec, 0x01, 0x7e, 0x42, 0x0a, 0x48, 0xd1, 0x31, 0x81, 0xa1, 0x63, 0x02, 0x72, 0x17, 0x04, 0x51, 0x2f, 0x4b,
-	0x08, 0x91, 0xfb, 0x26, 0x10, 0xbf, 0x54, 0x22, 0x08, 0xbf, 0x4f, 0x92, 0x11, 0x73, 0xb8, 0xed, 0x23, 0x1e, 0x5a,
-	0xff, 0x68, 0x0e, 0xad, 0x7f, 0xf4, 0x0f, 0xad, 0x7f, 0xf4, 0x0e, 0xad, 0x7f, 0x34, 0x87, 0xd6, 0x3f, 0xd6, 0x0e,
-	0xad, 0x7f, 0xb4, 0x87, 0xd6, 0x3f, 0xda, 0x43, 0xeb, 0x1f, 0xf5, 0xa1, 0xf5, 0x4f, 0xf1, 0xdc, 0xc2, 0x44, 0x3e,
-	0xa8, 0x08, 0xff, 0x54, 0x9e, 0x50, 0x00, 0xd8, 0xc6, 0xf3, 0xa7, 0x7c, 0x16, 0x01, 0x10, 0xff, 0x54, 0xd1, 0x27,
-	0x39, 0x75, 0x00, 0x90, 0x3a, 0x14, 0xf5, 0x29, 0x9f, 0x2f, 0x10, 0xe4, 0x5c, 0x76, 0x05, 0x3f, 0x65, 0xed, 0x43,
-	0x04, 0x65, 0x4f, 0xf0, 0x0b, 0xbc, 0xc7, 0x85, 0x19, 0xe3, 0x85, 0x3f, 0xc6, 0x0b, 0x6f, 0x8c, 0x17, 0x66, 0x8c,
-	0x17, 0xb5, 0x31, 0x5e, 0xd8, 0x31, 0x5e, 0xe8, 0x64, 0xfe, 0xc4, 0x0e, 0x11, 0x60, 0x29, 0x8f, 0x96, 0x3e, 0xf5,
-	0x2f, 0xd9, 0xe4, 0x0f, 0xeb, 0xe2, 0x03, 0xc7, 0x95, 0x20, 0x10, 0x40, 0x0c, 0xa6, 0x46, 0xe8, 0x63, 0x42, 0xb4,
-	0x11, 0x08, 0x76, 0x2d, 0x41, 0x9c, 0x63, 0x0e, 0x62, 0xb4, 0x4d, 0x08, 0xae, 0x18, 0x86, 0x58, 0x63, 0x1d, 0xc2,
-	0x75, 0x18, 0x10, 0xac, 0x63, 0x21, 0x6f, 0xf0, 0x8d, 0x15, 0xa2, 0xa3, 0xc2, 0xdb, 0xe0, 0x53, 0xe4, 0x85, 0xb9,
-	0xaf, 0x09, 0x12, 0x82, 0x5f, 0xb0, 0x8f, 0x17, 0x2e, 0xc4, 0xf8, 0xf6, 0xa9, 0x05, 0x0e, 0xb1, 0x15, 0xfb, 0xd8,
-	0x10, 0x22, 0x5c, 0xc5, 0x51, 0xde, 0xba, 0x54, 0xb1, 0xb0, 0x32, 0xc8, 0xda, 0x22, 0x3a, 0xb6, 0xcc, 0x46, 0x65,
-	0x66, 0x92, 0xb5, 0x31, 0xc0, 0x08, 0xd1, 0x06, 0x24, 0xd8, 0x35, 0x20, 0x71, 0x8e, 0x01, 0x89, 0xd1, 0x06, 0x24,
-	0xb8, 0x62, 0x40, 0x62, 0x8d, 0x01, 0x09, 0xd7, 0x01, 0x46, 0xb0, 0x0e, 0xb0, 0x04, 0x63, 0x80, 0x11, 0xa2, 0x03,
-	0x8c, 0x61, 0x37, 0xc0, 0x12, 0x79, 0x61, 0xee, 0x6b, 0x02, 0x8c, 0xe0, 0x17, 0xec, 0xe3, 0x05, 0x18, 0x31, 0xbe,
-	0x7d, 0x6a, 0x01, 0x46, 0x6c, 0xc5, 0x3e, 0x36, 0xc0, 0x08, 0x57, 0x01, 0x96, 0x5f, 0x7f, 0x51, 0xb1, 0xb0, 0x32,
-	0xc8, 0xda, 0x22, 0x3a, 0xc0, 0xcc, 0xeb, 0x2f, 0xc2, 0x94, 0x67, 0xec, 0xe4, 0xeb, 0x9d, 0x33, 0x76, 0x3e, 0xe9,
-	0x9b, 0xd4, 0x3f, 0x63, 0xe7, 0xf3, 0xc6, 0xbc, 0xf5, 0x33, 0x76, 0x7e, 0x1b, 0x6b, 0x6a, 0xe7, 0x8c, 0x9d, 0x4f,
-	0x9a, 0xb0, 0x2c, 0x8f, 0x81, 0x8c, 0x5d, 0xdc, 0x84, 0x68, 0xf5, 0x18, 0x88, 0xdb, 0xe4, 0xa2, 0xf2, 0x7d, 0x36,
-	0x68, 0x91, 0xfc, 0x4b, 0x3b, 0xbb, 0x01, 0x8c, 0xfc, 0x4b, 0x76, 0xae, 0x06, 0x33, 0xb6, 0x79, 0xd1, 0xce, 0x4e,
-	0x60, 0x23, 0xab, 0xc3, 0xbb, 0x3c, 0x16, 0xe3, 0xc6, 0xe3, 0xaa, 0x82, 0xaf, 0x6b, 0xb8, 0x09, 0x7b, 0xff, 0x58,
-	0x0c, 0xf3, 0xe7, 0x71, 0xdd, 0xc4, 0x53, 0xcd, 0xf3, 0xbc, 0x6e, 0x02, 0x84, 0xd6, 0x1f, 0x80, 0x78, 0x93, 0xe3,
-	0x73, 0x5c, 0x37, 0x01, 0xa8, 0x26, 0xc7, 0xe7, 0xb2, 0x6e, 0x02, 0x28, 0xcf, 0xcf, 0x05, 0xa2, 0x37, 0x84, 0x05,
-	0x50, 0xb3, 0xe2, 0xf3, 0x98, 0xa9, 0x32, 0x88, 0x0f, 0x6a, 0xd8, 0xe7, 0x65, 0x4e, 0x02, 0xec, 0x99, 0x80, 0xb3,
-	0x0f, 0x10, 0x35, 0x05, 0x16, 0x22, 0x4f, 0x81, 0x05, 0xa2, 0xe4, 0x02, 0x84, 0x5f, 0xa7, 0xca, 0x48, 0x7c, 0x9b,
-	0x6a, 0x94, 0x3f, 0x50, 0x67, 0x01, 0xe1, 0xb7, 0xa9, 0x04, 0x29, 0xde, 0xa6, 0x12, 0x18, 0xde, 0xa6, 0x12, 0x90,
-	0xdf, 0xa6, 0x12, 0x24, 0xbf, 0x4d, 0x25, 0x50, 0x7e, 0x9b, 0x4a, 0x20, 0x7a, 0x9b, 0x4a, 0x00, 0x7e, 0x9b, 0x2a,
-	0x23, 0x57, 0xfb, 0x5d, 0xff, 0x32, 0xce, 0x44, 0x80, 0x7e, 0xd5, 0x27, 0x2d, 0x8a, 0xe6, 0x9d, 0x19, 0x19, 0x2f,
-	0xfa, 0x10, 0x71, 0x47, 0x86, 0x8b, 0x3e, 0x00, 0x65, 0xd1, 0x07, 0x4d, 0x39, 0xa8, 0x04, 0xc9, 0x41, 0x25, 0x90,
-	0x1d, 0xef, 0xb7, 0xe7, 0xef, 0xdf, 0xba, 0xa2, 0x2f, 0x5b, 0x39, 0x9e, 0x74, 0x9e, 0x5f, 0xb3, 0x02, 0x24, 0x1f,
-	0x2a, 0xc8, 0xd0, 0x5e, 0xde, 0x35, 0x3b, 0xcf, 0x0b, 0x47, 0x40, 0xbc, 0x97, 0xe0, 0xce, 0x71, 0xe1, 0x08, 0xa0,
-	0x7a, 0x09, 0xee, 0x5c, 0x2f, 0x1c, 0x81, 0xd0, 0x6f, 0xc7, 0x9d, 0xe7, 0x85, 0x23, 0x20, 0xea, 0x5d, 0xb8, 0xf3,
-	0xbc, 0x70, 0x94, 0x01, 0x1f, 0x70, 0x2c, 0x07, 0x33, 0x60, 0x7e, 0x29, 0x0a, 0x91, 0x42, 0xca, 0x33, 0x7e, 0xec,
-	0x6e, 0xb7, 0x26, 0x38, 0x4e, 0xd8, 0xe2, 0x64, 0xee, 0x5e, 0xbe, 0x34, 0x2f, 0xb0, 0x3d, 0x2b, 0x76, 0x2e, 0xaf,
-	0xca, 0x0b, 0xa2, 0x4e, 0x9a, 0x0b, 0x91, 0x8f, 0x84, 0x08, 0x64, 0x1d, 0xc7, 0xaf, 0xc5, 0x67, 0xe0, 0x11, 0x3f,
-	0x3c, 0x17, 0x1f, 0x4c, 0xcf, 0x9d, 0xe3, 0x6c, 0xe7, 0xf9, 0xb0, 0x54, 0x96, 0xa4, 0xf2, 0xb0, 0x94, 0x86, 0xb5,
-	0x8e, 0x3a, 0x87, 0xa5, 0x34, 0xe7, 0x28, 0x6a, 0x79, 0x58, 0x4a, 0xc3, 0x46, 0x5b, 0xd5, 0x61, 0x29, 0x8d, 0x2b,
-	0x95, 0x2d, 0x0f, 0x4b, 0x29, 0x18, 0xf5, 0xb6, 0x9c, 0x80, 0x6b, 0xd8, 0x55, 0x5e, 0x33, 0x01, 0xd7, 0x8c, 0xd6,
-	0x60, 0x77, 0x02, 0xae, 0x59, 0xa3, 0xc6, 0xe5, 0x04, 0x5c, 0xc3, 0x5a, 0x97, 0x13, 0x8c, 0x7a, 0x46, 0x88, 0xd6,
-	0x31, 0x82, 0xb5, 0x4c, 0x13, 0xec, 0x2a, 0x1a, 0x71, 0x8e, 0x60, 0x13, 0xa3, 0x55, 0x9b, 0x60, 0x23, 0xdd, 0x84,
-	0x1b, 0x3d, 0x23, 0x5c, 0x89, 0x38, 0xa1, 0x5a, 0xc9, 0x13, 0xac, 0x33, 0x96, 0xd1, 0x52, 0xd3, 0x13, 0x6a, 0xaf,
-	0x36, 0xea, 0x4e, 0xb0, 0x96, 0x78, 0x86, 0xeb, 0x56, 0xf1, 0xc4, 0x9e, 0x19, 0x47, 0xf1, 0x89, 0xd2, 0xb2, 0x4f,
-	0xb0, 0xd1, 0x7e, 0xc2, 0x2b, 0x06, 0x33, 0x55, 0x20, 0xc1, 0x5b, 0x93, 0xda, 0xa6, 0x1e, 0x10, 0x6c, 0xb4, 0x25,
-	0xe1, 0x58, 0x19, 0x08, 0xd1, 0xe5, 0x81, 0x60, 0xb7, 0x46, 0x10, 0xe7, 0x14, 0x0a, 0x62, 0x74, 0xb5, 0x20, 0xb8,
-	0x52, 0x32, 0x88, 0x35, 0x75, 0x83, 0x70, 0x5d, 0x3c, 0x08, 0xd6, 0x15, 0x24, 0xc1, 0xa6, 0x8c, 0x24, 0xf8, 0x60,
-	0x4c, 0x60, 0x0a, 0x0a, 0xc1, 0xba, 0xaa, 0x30, 0xec, 0x96, 0x96, 0x44, 0x7a, 0xf5, 0x25, 0x31, 0x27, 0xd3, 0xd6,
-	0x54, 0x1a, 0x82, 0xdd, 0x72, 0x43, 0x5c, 0x55, 0xd0, 0x4d, 0xe1, 0x21, 0xb8, 0x52, 0x7d, 0x88, 0x35, 0x25, 0x88,
-	0xf0, 0x4a, 0xac, 0xe8, 0x62, 0x94, 0xd0, 0x47, 0x83, 0x3c, 0x5b, 0xc4, 0x1f, 0xab, 0x5b, 0xa0, 0xca, 0x33, 0xae,
-	0x22, 0xe7, 0xce, 0x19, 0x57, 0x9f, 0x34, 0x25, 0xab, 0x76, 0xc6, 0xd5, 0x6f, 0xe1, 0x95, 0x2f, 0xe7, 0x8c, 0xab,
-	0x4f, 0xda, 0x52, 0xe6, 0x9d, 0x71, 0xf5, 0x59, 0x5d, 0xd6, 0x9c, 0x33, 0xae, 0x2e, 0x59, 0x94, 0x38, 0x67, 0xf1,
-	0xef, 0x93, 0x7e, 0xb9, 0xf3, 0x17, 0xff, 0x3e, 0x6f, 0x4a, 0x5f, 0x7d, 0xf1, 0xef, 0xb7, 0xb1, 0x65, 0xd0, 0x59,
-	0xfc, 0xfb, 0xa4, 0x29, 0x89, 0x40, 0x16, 0x45, 0x01, 0x71, 0x53, 0x08, 0x90, 0x34, 0x45, 0x12, 0x49, 0xbf, 0x28,
-	0x60, 0x0b, 0xaf, 0x60, 0x22, 0x6f, 0xca, 0x26, 0x92, 0xb6, 0x78, 0x22, 0x6b, 0x2b, 0x02, 0xb2, 0xba, 0x90, 0x22,
-	0x67, 0xca, 0x29, 0x90, 0x46, 0xa6, 0x0a, 0x4e, 0x95, 0x56, 0x7c, 0x9d, 0xaf, 0x86, 0xbf, 0x64, 0x5d, 0x5b, 0x6c,
-	0x0b, 0xf2, 0xaf, 0xac, 0xeb, 0x16, 0xde, 0x82, 0xf7, 0xca, 0x2f, 0x36, 0x30, 0x45, 0x18, 0x49, 0x5b, 0x8a, 0x91,
-	0x7d, 0xd1, 0xfc, 0xb6, 0x2c, 0x03, 0xb9, 0xad, 0xc8, 0x9a, 0x2d, 0xd1, 0x48, 0x5a, 0xf1, 0xc5, 0x77, 0x07, 0xb1,
-	0xcc, 0x21, 0x6e, 0x8a, 0x36, 0x92, 0x7e, 0xe9, 0xc6, 0x16, 0x5e, 0x01, 0x47, 0xde, 0x94, 0x71, 0x24, 0x6b, 0xc5,
-	0x1c, 0xdb, 0xd8, 0x92, 0x8e, 0xac, 0x29, 0xec, 0x48, 0x9a, 0xf2, 0x0e, 0xa4, 0x2d, 0xf2, 0x40, 0x1e, 0x2a, 0x46,
-	0xb4, 0x05, 0x1f, 0x49, 0x53, 0xf6, 0x0b, 0xd2, 0x2f, 0xfe, 0x80, 0xba, 0x53, 0x00, 0xe0, 0x4f, 0x95, 0xeb, 0xec,
-	0x74, 0x00, 0x49, 0x7f, 0x52, 0x80, 0x2d, 0xfe, 0xa2, 0x94, 0xda, 0x09, 0x02, 0x92, 0xb5, 0x69, 0x02, 0xb6, 0xb1,
-	0x93, 0x05, 0x64, 0x5f, 0x8c, 0x5a, 0x33, 0x71, 0x00, 0xee, 0xb1, 0x82, 0x3f, 0xd7, 0xf0, 0x97, 0xec, 0xe4, 0x4c,
-	0x28, 0x2e, 0xfa, 0x63, 0x30, 0xd3, 0xfc, 0x81, 0x77, 0x6a, 0x05, 0xe1, 0xa3, 0x0a, 0x82, 0x14, 0x1b, 0xb6, 0x02,
-	0xc3, 0x2e, 0xad, 0x80, 0xbc, 0x35, 0x2b, 0x48, 0xde, 0x6b, 0x15, 0x28, 0x6f, 0xb0, 0x0a, 0x44, 0xbb, 0xaa, 0x02,
-	0xf0, 0x7e, 0x36, 0x23, 0xf2, 0x4a, 0x82, 0x42, 0xf4, 0x08, 0xd4, 0x2b, 0x09, 0x0a, 0x76, 0xc7, 0x62, 0x5f, 0x49,
-	0x50, 0x8c, 0x1e, 0x95, 0x7e, 0x25, 0x41, 0xe1, 0x66, 0x7c, 0xe5, 0x2b, 0x09, 0x0a, 0xd5, 0x23, 0x55, 0x67, 0xfa,
-	0x3d, 0x58, 0x8f, 0xd9, 0x3b, 0xd3, 0xef, 0x71, 0xee, 0xe8, 0x2b, 0x67, 0xfa, 0x3d, 0x5a, 0xdb, 0xc1, 0x3d, 0xd3,
-	0xef, 0x91, 0xc6, 0x22, 0xce, 0x99, 0x7e, 0x8f, 0xd2, 0xb6, 0x29, 0xce, 0xb9, 0x5b, 0x50, 0xdb, 0xc5, 0x9e, 0x73,
-	0xb7, 0x8c, 0x6b, 0x13, 0xf7, 0x9c, 0xbb, 0x25, 0xb5, 0x3d, 0x9c, 0x73, 0xee, 0x96, 0x32, 0xb6, 0x30, 0xe7, 0xdc,
-	0x2d, 0xa1, 0xed, 0x20, 0xa7, 0xc1, 0x15, 0xa2, 0x2d, 0xa0, 0x4e, 0x83, 0x2b, 0xd8, 0x1d, 0xbb, 0x3d, 0x0d, 0xae,
-	0x18, 0x3d, 0x6a, 0x7d, 0x1a, 0x5c, 0xe1, 0x66, 0xbc, 0xe5, 0x69, 0x70, 0x85, 0xea, 0x91, 0x9a, 0xe3, 0xd4, 0x3e,
-	0xa1, 0xc7, 0xed, 0x1f, 0xa7, 0xf6, 0x59, 0xd7, 0x0a, 0xd5, 0xe3, 0xd4, 0x7e, 0x03, 0x6d, 0x93, 0xca, 0x71, 0x6a,
-	0x9f, 0x36, 0x16, 0x72, 0x8f, 0x53, 0xfb, 0xa4, 0xb6, 0x17, 0x1c, 0x28, 0xd6, 0x90, 0xb6, 0x91, 0x3e, 0x50, 0xac,
-	0x71, 0xd7, 0x2e, 0xce, 0x81, 0x62, 0x4d, 0x69, 0x5b, 0x98, 0x03, 0xc5, 0x9a, 0x30, 0xe3, 0x57, 0x07, 0x8a, 0x35,
-	0xac, 0xc7, 0x4c, 0xd7, 0xbf, 0x76, 0x20, 0x3d, 0x66, 0xc6, 0xf5, 0x98, 0x19, 0x77, 0xc7, 0xcc, 0xa4, 0x33, 0x66,
-	0xa6, 0xf4, 0x98, 0x19, 0x37, 0x63, 0x66, 0xc2, 0x8c, 0x99, 0x09, 0x35, 0x66, 0x86, 0xf5, 0x98, 0xfb, 0x66, 0xaf,
-	0x0d, 0xa0, 0xc7, 0x9b, 0x50, 0x3d, 0xda, 0x84, 0xba, 0x63, 0x4d, 0x94, 0x33, 0xd2, 0x44, 0xe8, 0x71, 0x26, 0xd4,
-	0x8c, 0x32, 0xc1, 0x66, 0x8c, 0x09, 0x56, 0x23, 0x4c, 0xa0, 0x1a, 0xdf, 0x12, 0x8f, 0x82, 0x2e, 0xcd, 0x51, 0xd0,
-	0xa5, 0x39, 0x0a, 0xba, 0x6c, 0xdc, 0xa3, 0xa0, 0x4b, 0xef, 0x28, 0xe8, 0xd2, 0x1c, 0x05, 0x5d, 0xda, 0xa3, 0xa0,
-	0x4b, 0x7b, 0x14, 0x74, 0xa9, 0x8f, 0x82, 0x2e, 0xcd, 0x51, 0xd0, 0x65, 0xfc, 0x4d, 0x6d, 0x3e, 0x35, 0xb7, 0xcc,
-	0x3f, 0xa7, 0x0d, 0x48, 0x31, 0x67, 0x16, 0x1c, 0x7e, 0x17, 0x68, 0x69, 0x7e, 0x0c, 0x68, 0xe9, 0xff, 0x02, 0xd0,
-	0xd2, 0xfb, 0xd9, 0x9f, 0xa5, 0xf9, 0xad, 0x9f, 0x65, 0xed, 0x07, 0x7e, 0x96, 0xf6, 0x57, 0x7d, 0x96, 0xe6, 0xa7,
-	0x7c, 0x96, 0xe6, 0xf7, 0x7b, 0x96, 0x71, 0x4f, 0x61, 0x38, 0x1c, 0xe6, 0x4f, 0xbc, 0xb3, 0x02, 0x10, 0x8f, 0x1b,
-	0xa0, 0x62, 0x8b, 0x05, 0x70, 0xd8, 0x58, 0x01, 0x94, 0xb7, 0x53, 0x00, 0xca, 0x1b, 0x24, 0x80, 0xe5, 0x93, 0x8b,
-	0x80, 0xd1, 0xd1, 0x45, 0x40, 0x78, 0x7f, 0x44, 0x20, 0xb5, 0x26, 0x59, 0x9a, 0x93, 0xb0, 0xcb, 0xa6, 0xbc, 0xa0,
-	0xb3, 0x83, 0xcc, 0x3f, 0x39, 0x89, 0x90, 0x3f, 0x48, 0x58, 0xb2, 0xb7, 0x00, 0xc2, 0x2f, 0x4e, 0x42, 0x5b, 0xfe,
-	0xa1, 0x45, 0x41, 0xf2, 0xef, 0x29, 0x0a, 0xe4, 0x0c, 0x9c, 0x57, 0xdf, 0x6d, 0xf6, 0xd3, 0x56, 0xf6, 0xc8, 0x96,
-	0x79, 0x9d, 0x0d, 0x88, 0xde, 0x81, 0x5b, 0xc6, 0x15, 0x35, 0xdc, 0x71, 0x6f, 0x07, 0xbd, 0xaf, 0x8c, 0x70, 0xef,
-	0xba, 0x71, 0x6f, 0xdd, 0xa8, 0xd6, 0xc7, 0xc8, 0x38, 0x0e, 0xe6, 0xb5, 0x30, 0x42, 0xd6, 0x9b, 0xe6, 0x70, 0xed,
-	0xd2, 0x5b, 0x78, 0x2e, 0xe3, 0x6a, 0x53, 0x86, 0x7a, 0x32, 0xf6, 0x38, 0x79, 0xdb, 0xa1, 0x4b, 0x5c, 0x4c, 0x02,
-	0xa8, 0x36, 0x3e, 0x97, 0x7a, 0xd9, 0x08, 0x84, 0xde, 0x06, 0x5d, 0xca, 0x02, 0x11, 0xa0, 0x72, 0xc3, 0x73, 0x15,
-	0x05, 0x90, 0x7b, 0xbe, 0xca, 0x02, 0x08, 0x08, 0xa5, 0x18, 0x20, 0xc5, 0xaf, 0x79, 0x0a, 0x0c, 0xb1, 0x27, 0x20,
-	0x07, 0x99, 0x20, 0x39, 0xc8, 0x04, 0xe2, 0x5e, 0x02, 0x94, 0x7a, 0x09, 0x00, 0xff, 0x8c, 0x67, 0x46, 0xe2, 0x06,
-	0x6c, 0x1e, 0x44, 0xde, 0x75, 0x15, 0xa4, 0x08, 0x20, 0x81, 0x21, 0x7e, 0x04, 0xe4, 0xf0, 0x11, 0x44, 0x45, 0x8f,
-	0x10, 0x39, 0x78, 0x04, 0xe2, 0xd8, 0x11, 0x84, 0x43, 0x27, 0x23, 0x1b, 0x91, 0xee, 0x55, 0x16, 0x32, 0x40, 0x54,
-	0x95, 0x59, 0x95, 0x32, 0x06, 0xb0, 0xad, 0x32, 0xab, 0x2c, 0x62, 0x80, 0xe8, 0x2a, 0xb3, 0x12, 0x09, 0x03, 0xa8,
-	0xac, 0x32, 0xab, 0x2c, 0x60, 0x82, 0x50, 0x68, 0x4f, 0x01, 0xe8, 0xf5, 0x4b, 0xdc, 0x10, 0xf7, 0x88, 0x06, 0xf9,
-	0x03, 0x6f, 0x88, 0x09, 0xc2, 0x7b, 0x90, 0x80, 0xe0, 0xbe, 0x98, 0xc0, 0xf6, 0x20, 0xff, 0xaa, 0xdc, 0x62, 0x14,
-	0x54, 0x1d, 0xe4, 0x5f, 0xd9, 0x83, 0xfc, 0x2b, 0xd8, 0x41, 0xcc, 0x10, 0x0b, 0x97, 0x34, 0x82, 0xbd, 0xc2, 0x95,
-	0xd9, 0x20, 0x5c, 0xd9, 0x5d, 0xc1, 0x55, 0x14, 0xae, 0x79, 0xbe, 0x9c, 0x75, 0x0b, 0x90, 0xc2, 0x6d, 0x02, 0x83,
-	0xdb, 0x04, 0x64, 0xb7, 0x09, 0x52, 0x46, 0x1d, 0x10, 0xd9, 0x9f, 0x02, 0x51, 0xd4, 0x01, 0xc2, 0xde, 0xcb, 0x08,
-	0xeb, 0x95, 0x78, 0x0b, 0xe4, 0x4a, 0x7c, 0x7a, 0x2a, 0x3e, 0x28, 0xb9, 0x5a, 0xf9, 0x72, 0xb5, 0xf2, 0xe4, 0x6a,
-	0x65, 0xe4, 0x6a, 0x55, 0x93, 0xab, 0x95, 0x95, 0xab, 0x95, 0x95, 0xab, 0x95, 0x95, 0xab, 0xe7, 0xe2, 0x83, 0xe9,
-	0xec, 0xb3, 0xed, 0xd5, 0x1a, 0x25, 0x6e, 0x6d, 0x24, 0x6e, 0x6d, 0x24, 0x6e, 0xed, 0x4b, 0xdc, 0xda, 0x93, 0xb8,
-	0xb5, 0x91, 0xb8, 0xb5, 0x95, 0xb8, 0xb5, 0x95, 0xb8, 0xb5, 0x96, 0xb8, 0xb5, 0x91, 0xb8, 0x75, 0x94, 0xb8, 0x51,
-	0x1e, 0x04, 0x4b, 0x1c, 0x20, 0xde, 0x0f, 0xf2, 0xad, 0x51, 0xe2, 0x00, 0x54, 0x3f, 0xbd, 0xb7, 0xd6, 0x12, 0x07,
-	0x84, 0xfe, 0x91, 0xbd, 0x75, 0x96, 0x38, 0x40, 0xd4, 0xcf, 0xe9, 0xad, 0xf1, 0x01, 0xd0, 0xda, 0x3c, 0xf5, 0x59,
-	0x9b, 0x47, 0x3d, 0x6b, 0xff, 0xf9, 0xce, 0xda, 0x7b, 0xa8, 0xb3, 0x36, 0x4f, 0x72, 0xd6, 0xf6, 0xf1, 0xcd, 0xda,
-	0x3e, 0xb3, 0x59, 0xeb, 0x07, 0x35, 0x6b, 0xf3, 0x74, 0x66, 0xcd, 0x12, 0x87, 0x40, 0xf1, 0x1c, 0x66, 0x5d, 0xcc,
-	0xd0, 0xd6, 0x76, 0x86, 0xb6, 0xb6, 0x33, 0xb4, 0x75, 0xa9, 0x72, 0xad, 0xc0, 0x76, 0x82, 0xb6, 0xf6, 0x27, 0x68,
-	0x6b, 0x33, 0x41, 0x5b, 0xdb, 0x09, 0xda, 0xda, 0x99, 0xa0, 0xad, 0xcd, 0xe3, 0x91, 0x35, 0x4e, 0xd0, 0xd6, 0x66,
-	0x82, 0xb6, 0xb6, 0x13, 0xb4, 0x75, 0x31, 0x41, 0x5b, 0xdb, 0x09, 0xda, 0xba, 0x32, 0x41, 0x5b, 0xbb, 0x13, 0xb4,
-	0xb5, 0x9d, 0xa0, 0xad, 0xab, 0x13, 0xb4, 0xb5, 0x33, 0x41, 0x5b, 0xdb, 0x09, 0xda, 0xda, 0x4e, 0xd0, 0xd6, 0x46,
-	0xf0, 0xd6, 0x28, 0x78, 0x62, 0x8e, 0x53, 0xf1, 0xc1, 0x84, 0xea, 0xc9, 0x0f, 0xcc, 0x93, 0x17, 0x98, 0x27, 0x13,
-	0x98, 0x4a, 0xf0, 0x80, 0xb0, 0x11, 0x7b, 0xb2, 0x11, 0x7b, 0x52, 0x11, 0x9b, 0x37, 0xa4, 0xf3, 0x98, 0xca, 0x0d,
-	0x69, 0x0d, 0x6b, 0x2d, 0x73, 0x36, 0xa4, 0x35, 0xe7, 0xa8, 0x5a, 0xb9, 0x21, 0xad, 0x61, 0xa3, 0x6f, 0x6a, 0x43,
-	0x5a, 0xe3, 0x4a, 0xe9, 0xca, 0x0d, 0x69, 0x05, 0xa3, 0xe6, 0x95, 0x2f, 0x07, 0x69, 0xd8, 0x55, 0x3f, 0xf3, 0x72,
-	0x90, 0x66, 0xb4, 0x0e, 0xba, 0x2f, 0x07, 0x69, 0xd6, 0x28, 0x62, 0xf9, 0x72, 0x90, 0x86, 0xb5, 0x36, 0x26, 0x78,
-	0x63, 0xbc, 0x6a, 0x54, 0x92, 0x60, 0x2d, 0x95, 0x04, 0xbb, 0x61, 0x49, 0x9c, 0x13, 0x9b, 0xc4, 0xe8, 0x00, 0x25,
-	0xd8, 0x04, 0x23, 0xe1, 0x26, 0x22, 0x09, 0x77, 0xc3, 0xd2, 0xa8, 0x69, 0x82, 0x75, 0xc2, 0x31, 0x5a, 0xea, 0x6a,
-	0x42, 0x8b, 0x04, 0x26, 0xc8, 0xa8, 0x0d, 0xe1, 0x46, 0x66, 0x19, 0xf7, 0xb4, 0x96, 0x38, 0x47, 0x70, 0x99, 0xf1,
-	0x54, 0x97, 0x38, 0x2d, 0xbd, 0x04, 0x1b, 0xfd, 0x25, 0xdc, 0x8a, 0x70, 0x22, 0x8c, 0x12, 0x27, 0x18, 0xe5, 0x98,
-	0x10, 0xad, 0xc9, 0x04, 0x1b, 0x61, 0x4e, 0xf8, 0xde, 0x7e, 0x95, 0x95, 0x68, 0xc2, 0x7d, 0x9d, 0x26, 0xd2, 0x13,
-	0x6b, 0xa2, 0x8c, 0x62, 0x13, 0x5e, 0x93, 0x6d, 0xa2, 0xad, 0x76, 0x13, 0x61, 0x04, 0x9c, 0x70, 0xa3, 0xe2, 0x09,
-	0x37, 0x52, 0x9e, 0x60, 0x4f, 0xcf, 0x13, 0x73, 0xb2, 0x88, 0x9f, 0x5e, 0xbe, 0xbc, 0x13, 0x57, 0xcd, 0x23, 0x23,
-	0xf4, 0x04, 0x57, 0xd4, 0x9e, 0xd8, 0x4a, 0x96, 0x59, 0xdd, 0x27, 0x5c, 0x65, 0x19, 0x3e, 0x87, 0xca, 0x86, 0x30,
-	0xcf, 0xa1, 0x1c, 0x46, 0x57, 0x01, 0xff, 0x39, 0x94, 0x43, 0x3b, 0xb5, 0xc0, 0x3c, 0x87, 0x72, 0x18, 0x53, 0x11,
-	0xec, 0x73, 0x28, 0x87, 0x52, 0x75, 0xc1, 0x3c, 0x87, 0xb2, 0x0c, 0x56, 0x07, 0x01, 0x75, 0x81, 0x10, 0xc6, 0xad,
-	0x11, 0x42, 0x3b, 0x65, 0x42, 0x48, 0x5d, 0x29, 0x84, 0xa9, 0x14, 0x0b, 0x69, 0x60, 0xea, 0x85, 0x50, 0xba, 0x64,
-	0x08, 0xa3, 0xab, 0x46, 0x66, 0x36, 0x5e, 0x44, 0x98, 0xda, 0x21, 0x8c, 0x2e, 0x1f, 0xc2, 0xb8, 0x91, 0x2f, 0xb4,
-	0x13, 0xfc, 0x42, 0xea, 0xf8, 0x17, 0xc6, 0x04, 0xb9, 0x50, 0x26, 0xce, 0x85, 0xaa, 0x85, 0xba, 0xa9, 0x29, 0x99,
-	0xd1, 0x79, 0x0f, 0x44, 0x59, 0x59, 0x32, 0x51, 0xe8, 0x8a, 0xa0, 0x46, 0x2a, 0x85, 0x32, 0x25, 0x06, 0x28, 0xaf,
-	0xca, 0x08, 0xed, 0x14, 0x1a, 0x20, 0xbd, 0x5a, 0x23, 0xb4, 0x2e, 0x37, 0xc2, 0x98, 0x8a, 0x23, 0x94, 0x2d, 0x3a,
-	0x99, 0x33, 0x75, 0x27, 0x33, 0x58, 0x7a, 0x04, 0xd4, 0xd5, 0x47, 0x18, 0x53, 0x80, 0x32, 0xb5, 0x77, 0xbf, 0xd9,
-	0x96, 0x21, 0xa1, 0xfc, 0x4a, 0x24, 0xbc, 0x57, 0x8c, 0x84, 0x35, 0xf5, 0x48, 0xa8, 0x5a, 0x49, 0x92, 0x16, 0xb6,
-	0x2a, 0x09, 0x67, 0x0a, 0x93, 0x50, 0xa6, 0x36, 0x65, 0xca, 0x94, 0xa7, 0xcc, 0x78, 0x15, 0x2a, 0x93, 0x27, 0x17,
-	0xac, 0xa6, 0xb2, 0x5f, 0xaa, 0x84, 0x7e, 0x29, 0x61, 0x4d, 0xc1, 0x12, 0xa6, 0x52, 0xb3, 0xa4, 0x41, 0x3d, 0xa3,
-	0x6d, 0xe5, 0x12, 0xaa, 0xcc, 0xe8, 0xcb, 0xf0, 0xbf, 0xfc, 0xe0, 0xe9, 0x32, 0x1b, 0x6c, 0x92, 0x11, 0xf8, 0xd1,
-	0xfd, 0x4b, 0xf3, 0x4b, 0xfb, 0x97, 0xfe, 0xcf, 0xeb, 0x5f, 0x7a, 0xbf, 0xa9, 0x7f, 0x69, 0x7e, 0x48, 0xff, 0xb2,
-	0xf6, 0xeb, 0xf9, 0x97, 0xf6, 0x27, 0xf3, 0x2f, 0xed, 0xef, 0xe4, 0x5f, 0xea, 0x1f, 0xc7, 0xbf, 0x6a, 0xbe, 0xc9,
-	0x58, 0xae, 0x9a, 0x9b, 0xe2, 0x83, 0xfb, 0xa4, 0xed, 0x8a, 0x26, 0x80, 0x06, 0xb9, 0xb1, 0x88, 0x7f, 0x03, 0x7a,
-	0x03, 0xc1, 0x20, 0x37, 0x16, 0xa9, 0xdc, 0x80, 0xfe, 0x1a, 0xef, 0x37, 0x07, 0xbb, 0xf1, 0x30, 0xff, 0x36, 0xbd,
-	0xb6, 0xf6, 0xbf, 0xf3, 0x7d, 0x7d, 0xb9, 0xa3, 0x9f, 0xfa, 0xe6, 0x53, 0x81, 0x40, 0x2a, 0xa6, 0x43, 0xef, 0x93,
-	0xe0, 0x22, 0x92, 0x7a, 0x5e, 0x20, 0xe2, 0x6e, 0x84, 0xb3, 0xbb, 0x0b, 0x30, 0xcb, 0x29, 0xa2, 0x29, 0x08, 0x10,
-	0x21, 0x5f, 0x23, 0x44, 0xbe, 0x06, 0xe8, 0x8b, 0xfe, 0x2b, 0x52, 0x5f, 0x9a, 0x70, 0xff, 0x5d, 0x77, 0x3c, 0x6e,
-	0xe5, 0x61, 0xe4, 0x97, 0xa6, 0xc3, 0x06, 0xf2, 0x97, 0xe1, 0x32, 0x52, 0xfc, 0x5d, 0xb7, 0x8c, 0xea, 0x9f, 0x3c,
-	0xf9, 0x12, 0xfe, 0x97, 0x0f, 0x50, 0x7f, 0xe9, 0x45, 0x34, 0x33, 0x7b, 0x73, 0xd3, 0x52, 0x32, 0x05, 0x56, 0x3f,
-	0xc3, 0xf2, 0xc5, 0x48, 0xa0, 0x10, 0xac, 0x6e, 0x82, 0xe4, 0xbf, 0xdf, 0xc7, 0x88, 0xfe, 0xdb, 0x4e, 0x5f, 0xd0,
-	0xa3, 0x2c, 0xfc, 0x37, 0x0d, 0x3c, 0x9a, 0xbd, 0xc9, 0x06, 0x00, 0x44, 0xbd, 0xe5, 0x7d, 0x53, 0x56, 0x4c, 0x80,
-	0xed, 0xc3, 0xe4, 0x9b, 0xc2, 0x7c, 0x80, 0xaa, 0x47, 0xcc, 0x37, 0x52, 0x10, 0x01, 0xd2, 0x3f, 0xe7, 0x7c, 0x83,
-	0x66, 0xbd, 0x31, 0x66, 0xbd, 0xf1, 0xcd, 0x7a, 0x53, 0x14, 0x20, 0x01, 0x95, 0xad, 0x6f, 0x6a, 0xb6, 0xbe, 0x81,
-	0x2a, 0x23, 0x90, 0x32, 0xff, 0x8d, 0x31, 0x7f, 0x91, 0x75, 0x38, 0x54, 0xef, 0x98, 0xb7, 0x4f, 0x6a, 0xc3, 0x57,
-	0x8f, 0x79, 0xfb, 0x2d, 0x1c, 0x77, 0xd4, 0x8e, 0x79, 0xfb, 0x0d, 0xb4, 0x93, 0xdc, 0x63, 0xde, 0x3e, 0x6b, 0x5c,
-	0xa7, 0x8e, 0x5d, 0xbb, 0x56, 0x32, 0x0e, 0xad, 0x1e, 0xbb, 0xf6, 0x5b, 0x38, 0x6e, 0xf6, 0x8e, 0x5d, 0xfb, 0x64,
-	0xc5, 0xf9, 0xee, 0xb1, 0x6b, 0x9f, 0xd5, 0x21, 0xe1, 0x1d, 0xbb, 0x66, 0xf2, 0x2e, 0xfe, 0x31, 0x66, 0x2e, 0x99,
-	0x77, 0x69, 0xdc, 0x88, 0x24, 0xd7, 0x17, 0x08, 0xdc, 0x0d, 0xf1, 0xfc, 0xa7, 0x9d, 0x19, 0xd9, 0xc7, 0x0f, 0xfc,
-	0x84, 0x72, 0x1f, 0x4f, 0x04, 0x8f, 0xf2, 0x07, 0x30, 0xdd, 0x3e, 0x3e, 0x71, 0x81, 0x0f, 0xca, 0xf6, 0x7b, 0x7c,
-	0xe2, 0x92, 0xc1, 0xdc, 0xd1, 0x7c, 0xff, 0x84, 0xe0, 0x97, 0x24, 0xe4, 0xc9, 0x5c, 0xf5, 0x6c, 0x11, 0xfd, 0x9d,
-	0x04, 0x3b, 0x5f, 0x0c, 0xce, 0xc7, 0x6f, 0x07, 0x18, 0xbb, 0x00, 0xf0, 0x93, 0x7f, 0x93, 0xe7, 0x0a, 0xac, 0x7b,
-	0x84, 0x9c, 0xd3, 0xad, 0x0c, 0x61, 0xa7, 0x32, 0x88, 0x5d, 0xca, 0xe0, 0x93, 0x77, 0xf9, 0xb3, 0x0b, 0xea, 0xce,
-	0x08, 0xe3, 0x74, 0x25, 0x05, 0x37, 0xf6, 0x23, 0x21, 0xd8, 0x89, 0x84, 0x3c, 0x99, 0xab, 0x9e, 0x2d, 0xa2, 0xbf,
-	0x9b, 0x60, 0xe7, 0x8b, 0x8b, 0xc4, 0xc1, 0xef, 0x2f, 0x08, 0xec, 0x46, 0x41, 0x3c, 0xd5, 0x6e, 0xf5, 0x5c, 0x25,
-	0x74, 0xdf, 0x4a, 0xd6, 0xe9, 0x22, 0xe5, 0x2d, 0x76, 0x8e, 0x20, 0xec, 0x16, 0x41, 0x4f, 0xf6, 0xc2, 0x67, 0x07,
-	0xd2, 0x9d, 0x60, 0xdc, 0xf9, 0xfa, 0x24, 0x0c, 0xf8, 0xed, 0x09, 0xc1, 0x2f, 0x4f, 0xc8, 0x93, 0xb9, 0xea, 0xd9,
-	0x22, 0xfa, 0x9b, 0xcd, 0x5f, 0x5b, 0xc9, 0x4c, 0xd6, 0x86, 0xfc, 0xc5, 0xf9, 0xcf, 0xbe, 0x8f, 0x4a, 0xe4, 0xc9,
-	0x5c, 0xf5, 0x6c, 0x11, 0xfd, 0xc5, 0xe6, 0x0f, 0xc1, 0x33, 0x43, 0x13, 0x8f, 0xca, 0xe4, 0x12, 0x59, 0x45, 0xf5,
-	0xd8, 0xae, 0xfb, 0x72, 0x0f, 0xff, 0x95, 0x97, 0x62, 0x70, 0xc1, 0xb5, 0x0c, 0x09, 0xd1, 0xab, 0xfe, 0x8f, 0x31,
-	0x7b, 0x14, 0x7e, 0x99, 0x73, 0xbf, 0x83, 0x7b, 0x11, 0xbf, 0xd9, 0xe2, 0x51, 0xbc, 0x9f, 0xe0, 0x51, 0xc5, 0x74,
-	0xdb, 0x36, 0x38, 0xba, 0x5d, 0x38, 0xaa, 0x4d, 0x3f, 0xa4, 0xe8, 0xcb, 0x5c, 0x8a, 0x26, 0xf9, 0x3e, 0x89, 0x3d,
-	0xf1, 0x1a, 0x7c, 0xdf, 0x5c, 0xf9, 0x5f, 0x09, 0xef, 0xad, 0x20, 0xea, 0xbe, 0xb0, 0x03, 0x0d, 0x20, 0xd4, 0x0e,
-	0x3c, 0xfb, 0x9e, 0x65, 0x80, 0xe7, 0xa3, 0x19, 0x29, 0x9e, 0x1f, 0x28, 0xd4, 0x34, 0x2e, 0xde, 0x53, 0x57, 0xa8,
-	0x6d, 0x6c, 0xdf, 0xbf, 0x73, 0x39, 0x7d, 0x61, 0xb2, 0xc8, 0x6b, 0x19, 0x1c, 0x01, 0xea, 0x08, 0x09, 0xa1, 0xfc,
-	0xb7, 0x4e, 0x4a, 0xd4, 0x7b, 0xbb, 0x88, 0x28, 0x98, 0x92, 0x95, 0x84, 0x7a, 0x9f, 0x88, 0x50, 0xfd, 0x92, 0x10,
-	0xc1, 0xfa, 0xf4, 0x0a, 0xc1, 0xe5, 0x6b, 0x41, 0x04, 0xf2, 0xd9, 0xcb, 0x02, 0x5d, 0xca, 0x21, 0xbf, 0x04, 0xac,
-	0x34, 0xb0, 0x36, 0x00, 0x87, 0x67, 0x89, 0xc2, 0xe6, 0x18, 0x11, 0x0f, 0x6c, 0x6f, 0xfe, 0xca, 0x87, 0x06, 0x52,
-	0xe8, 0x41, 0x56, 0x58, 0x82, 0xa8, 0x5c, 0x7a, 0x50, 0xc7, 0x20, 0x05, 0xb6, 0x67, 0xbc, 0x1e, 0xca, 0xf5, 0x99,
-	0xa0, 0xea, 0xe4, 0xd7, 0x03, 0xfc, 0xd5, 0x6d, 0x81, 0xf2, 0x22, 0x2e, 0x43, 0xfb, 0xe2, 0x83, 0xe9, 0xea, 0xde,
-	0xef, 0xd8, 0xde, 0xeb, 0xd8, 0xde, 0x74, 0x41, 0xcf, 0x31, 0x85, 0xb0, 0x7d, 0xdb, 0xab, 0xc3, 0x67, 0x0f, 0x32,
-	0x85, 0xcc, 0x08, 0x07, 0x2f, 0x5b, 0xfa, 0xb1, 0x81, 0xc5, 0xee, 0xa3, 0x9c, 0xab, 0x15, 0x44, 0x1d, 0x27, 0x7e,
-	0x54, 0xa7, 0x6a, 0x05, 0xb6, 0x9a, 0xfe, 0x28, 0x67, 0x6a, 0x05, 0xd1, 0x13, 0xe2, 0x47, 0x38, 0x51, 0x2b, 0x50,
-	0xf9, 0x5b, 0xa0, 0x8f, 0x72, 0x9e, 0x36, 0x23, 0x2a, 0x64, 0x1e, 0x9b, 0x82, 0xd5, 0x8b, 0xf2, 0x47, 0xf8, 0x6b,
-	0xed, 0x82, 0xb8, 0x03, 0xe9, 0xbc, 0x81, 0x78, 0x4b, 0xfa, 0x47, 0xf8, 0x4b, 0xed, 0x19, 0xb1, 0xc3, 0x33, 0xeb,
-	0xfe, 0x47, 0x0c, 0x99, 0x47, 0x13, 0x32, 0x8f, 0x7e, 0xc8, 0x3c, 0x7a, 0x21, 0xf3, 0x68, 0x42, 0xe6, 0xb1, 0x16,
-	0x32, 0x8f, 0x36, 0x64, 0x1e, 0x4d, 0xc8, 0x3c, 0x9a, 0x90, 0x79, 0x34, 0x21, 0xf3, 0x84, 0x96, 0x7e, 0x32, 0x96,
-	0x7e, 0x32, 0x96, 0x7e, 0xf2, 0x2d, 0xfd, 0xe4, 0x59, 0xfa, 0xc9, 0xb5, 0xf4, 0x93, 0xb1, 0xf4, 0x93, 0xb5, 0xf4,
-	0x93, 0xb5, 0xf4, 0xb3, 0x8e, 0x92, 0x67, 0x33, 0x9a, 0xe7, 0xa2, 0xa0, 0x28, 0xd4, 0x34, 0xd6, 0x8f, 0x19, 0x2c,
-	0x81, 0x97, 0xfc, 0x72, 0x77, 0xfd, 0xbe, 0x3b, 0xdc, 0x9d, 0x6d, 0xb6, 0x87, 0x63, 0xfe, 0xf4, 0x66, 0x73, 0xbf,
-	0xe9, 0x3f, 0xbc, 0xdd, 0xdf, 0xdd, 0xff, 0xde, 0xdd, 0x1f, 0xb6, 0x57, 0x81, 0xfc, 0x5f, 0x6e, 0xe1, 0xad, 0x43 };
@@ -1,677 +0,0 @@
-// times_italic.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_TIMES_ITALIC[] = { 0x78, 0x9c, 0xbd, 0x7d, 0x5d, 0x77, 0x1b, 0x37, 0xb2, 0xed, 0x7b, 0xd6, 0xca,
-	0x7f, 0xe8, 0xc7, 0x7b, 0xd6, 0xba, 0x9e, 0x4b, 0x36, 0xbf, 0x67, 0x9e, 0x9c, 0x38, 0x99, 0x19, 0x3b, 0x89, 0x63,
-	0x47, 0x12, 0xcd, 0xf3, 0x46, 0x49, 0x6d, 0x99, 0x57, 0x1f, 0xed, 0x90, 0xa2, 0x14, 0xcd, 0xaf, 0x3f, 0x40, 0xa3,
-	0x0a, 0xb5, 0x51, 0x55, 0x60, 0xf2, 0x74, 0xd6, 0xac, 0x95, 0x31, 0xf7, 0x46, 0x37, 0x81, 0x42, 0xd5, 0x2e, 0xa0,
-	0x1a, 0x4d, 0xfd, 0xf6, 0xb8, 0xdd, 0x3f, 0xfe, 0xd8, 0x3f, 0x3c, 0xfe, 0xdc, 0x3d, 0xee, 0x77, 0x57, 0x87, 0x66,
-	0xfa, 0xb7, 0xf1, 0xb7, 0xdf, 0x7c, 0xdf, 0xdf, 0xdf, 0x77, 0x0f, 0x8f, 0xcd, 0xf7, 0xfd, 0xd7, 0x97, 0xfd, 0xee,
-	0xe6, 0xcb, 0x63, 0xf3, 0x7f, 0xae, 0xfe, 0xab, 0x19, 0xaf, 0x96, 0xb3, 0xff, 0x1b, 0xff, 0xbb, 0x18, 0xfe, 0xbb,
-	0x8a, 0xff, 0x5d, 0x8d, 0x86, 0xff, 0x4e, 0x86, 0xff, 0x2e, 0x9a, 0xd7, 0xd7, 0xfd, 0x65, 0xd7, 0xfc, 0xf6, 0x72,
-	0x78, 0xec, 0xee, 0x0f, 0xcd, 0xbf, 0x1f, 0xae, 0xfa, 0xfd, 0xd7, 0x7e, 0xbf, 0x7d, 0xec, 0xae, 0xff, 0xd6, 0x34,
-	0xaf, 0xef, 0xee, 0x9a, 0x8f, 0xf1, 0x6e, 0x87, 0xe6, 0x63, 0x77, 0xe8, 0xf6, 0x4f, 0x01, 0x85, 0xef, 0xda, 0x77,
-	0xdb, 0xc7, 0x5d, 0xff, 0xd0, 0xbc, 0x09, 0xcd, 0xff, 0xde, 0x9c, 0x7d, 0x39, 0x36, 0x3f, 0x6f, 0x5f, 0x9a, 0x66,
-	0xdc, 0x8c, 0xdb, 0xbf, 0xcf, 0xe6, 0x7f, 0x9f, 0xcd, 0x86, 0xaf, 0x90, 0x0b, 0xce, 0x1f, 0x76, 0xbf, 0x1f, 0xbb,
-	0x7f, 0xbf, 0x69, 0xa6, 0x93, 0xd1, 0x1c, 0xf0, 0x8b, 0x9f, 0x8f, 0x87, 0xed, 0x4d, 0xd7, 0x4c, 0x17, 0x8b, 0x76,
-	0xd1, 0xcc, 0x96, 0x8b, 0x59, 0xfb, 0xed, 0x37, 0x71, 0x88, 0xbf, 0x6c, 0xef, 0xbb, 0xe6, 0x6c, 0x77, 0xdf, 0x1d,
-	0x5e, 0xfd, 0xfb, 0x71, 0x7b, 0xb7, 0xbb, 0x0a, 0xf0, 0xf1, 0xee, 0x4e, 0xe0, 0x26, 0xc3, 0xdb, 0xfb, 0xdd, 0xdd,
-	0x8b, 0x10, 0xdf, 0x7e, 0xb3, 0xee, 0x06, 0x33, 0xfc, 0xdc, 0x5d, 0xef, 0x8e, 0xf7, 0xdf, 0x7e, 0x93, 0x1a, 0xbe,
-	0x7e, 0xb8, 0xb9, 0xeb, 0x9a, 0x57, 0xe3, 0xd9, 0xdf, 0x66, 0x01, 0x3a, 0xfc, 0xb8, 0xfb, 0xa3, 0xbb, 0xfe, 0x75,
-	0xf7, 0x78, 0xf5, 0xa5, 0xf9, 0xbc, 0xbd, 0x3b, 0x74, 0xa1, 0x4b, 0x5f, 0xb6, 0xfb, 0xed, 0xd5, 0x63, 0xb7, 0xff,
-	0xad, 0x7b, 0x6c, 0x7e, 0xf8, 0xe3, 0xb1, 0x7b, 0xb8, 0xee, 0xae, 0x3f, 0xf6, 0xf7, 0xdb, 0x87, 0xd4, 0xa3, 0xef,
-	0xbe, 0xeb, 0xff, 0x08, 0xd7, 0xcf, 0x57, 0xcd, 0xab, 0x76, 0xbc, 0x68, 0xc6, 0xa3, 0xf1, 0xa8, 0x59, 0x2e, 0x27,
-	0xcd, 0xb7, 0xdf, 0x9c, 0x87, 0x96, 0xfb, 0xbb, 0xdd, 0x43, 0xf7, 0x6b, 0x7f, 0xd8, 0x0d, 0x66, 0x79, 0x35, 0x1e,
-	0x8d, 0x00, 0x3f, 0xfb, 0xb2, 0xbb, 0xba, 0x7d, 0xe8, 0x0e, 0x87, 0x66, 0x16, 0xe0, 0x8b, 0x6e, 0x7f, 0x88, 0x8d,
-	0x46, 0xa3, 0xf6, 0x6f, 0xa3, 0xd8, 0xee, 0x97, 0xfe, 0x71, 0x77, 0xd5, 0xfd, 0x2f, 0x4c, 0x60, 0x32, 0xdc, 0xee,
-	0xd0, 0x6c, 0x9b, 0xc7, 0xfd, 0xf6, 0xba, 0xbb, 0xdf, 0xee, 0x6f, 0x9b, 0xfe, 0x73, 0xf3, 0xd3, 0xee, 0xa1, 0x7f,
-	0x7c, 0xf9, 0xda, 0xbd, 0xfa, 0x57, 0x17, 0xae, 0x7a, 0xfd, 0xcf, 0x66, 0xfb, 0x70, 0xfd, 0xff, 0xfa, 0x7d, 0xb3,
-	0x0b, 0x17, 0x1f, 0x8e, 0x97, 0x87, 0xdd, 0xf5, 0x6e, 0xbb, 0xdf, 0x75, 0x87, 0xe0, 0x01, 0x3f, 0x84, 0x6f, 0xb9,
-	0xde, 0x3d, 0xdc, 0xfc, 0x76, 0xf5, 0xa5, 0x0b, 0x16, 0x1f, 0xba, 0xf0, 0xdb, 0x63, 0x68, 0xbf, 0xdd, 0x5f, 0x33,
-	0x17, 0x6c, 0xb9, 0xfd, 0xfa, 0xaf, 0x34, 0x09, 0xf3, 0xd9, 0xe4, 0xdb, 0x6f, 0x3e, 0xd1, 0x87, 0xe9, 0x34, 0xf8,
-	0xeb, 0xeb, 0xc3, 0x55, 0x34, 0xed, 0xbe, 0x99, 0x2f, 0x03, 0xf5, 0xa6, 0xe3, 0x8f, 0xd1, 0xaa, 0xdf, 0x7e, 0xf3,
-	0xdb, 0xe3, 0xf5, 0xbf, 0xd6, 0xcd, 0xa4, 0x1d, 0xfe, 0x75, 0xb1, 0x6e, 0x16, 0xf3, 0xf8, 0xaf, 0xe0, 0xf7, 0x71,
-	0x7a, 0xd8, 0xef, 0x27, 0xe3, 0x30, 0x87, 0xdf, 0x87, 0x56, 0xcd, 0x3f, 0x9a, 0xf5, 0xa7, 0xa6, 0x9d, 0x8d, 0xc2,
-	0x3f, 0x7e, 0x69, 0x0e, 0x5f, 0xb7, 0xc1, 0x8c, 0xff, 0x68, 0xbe, 0x6b, 0x46, 0xf4, 0xbf, 0x7f, 0x0c, 0xcd, 0x26,
-	0xa9, 0xd9, 0x64, 0xf8, 0xc7, 0x2f, 0x4d, 0xf7, 0xc7, 0xd5, 0xdd, 0xf6, 0x7e, 0x68, 0x37, 0x09, 0x93, 0x39, 0x1e,
-	0x37, 0x93, 0x51, 0xdb, 0xcc, 0xe7, 0x0b, 0x6a, 0x3e, 0x4d, 0xcd, 0xa7, 0x6d, 0xba, 0xeb, 0xef, 0xc7, 0x3e, 0x58,
-	0xf4, 0xf2, 0x6e, 0xb8, 0x60, 0x3c, 0x9d, 0x06, 0x62, 0x1c, 0xdc, 0x38, 0x5e, 0x31, 0xa7, 0x2b, 0x66, 0xe9, 0x8a,
-	0xd9, 0x28, 0x5d, 0xf1, 0x70, 0xbc, 0xbf, 0x8c, 0x73, 0x7c, 0xf3, 0x30, 0x5c, 0xd3, 0x86, 0x8e, 0xcc, 0xa6, 0xa3,
-	0x66, 0xbe, 0xe0, 0xf6, 0xf3, 0xb2, 0xfd, 0x75, 0x7f, 0x77, 0xb7, 0xdd, 0xa7, 0x0e, 0x8d, 0x9b, 0x57, 0xcb, 0x55,
-	0x33, 0x0d, 0xb3, 0xbb, 0x08, 0xff, 0x4e, 0xcd, 0x17, 0xa9, 0xf9, 0x92, 0xfa, 0xff, 0xb5, 0xdb, 0x5f, 0xc5, 0xd8,
-	0x89, 0xed, 0x17, 0x71, 0x00, 0x93, 0xf0, 0x7f, 0x78, 0xfb, 0x65, 0x6a, 0xbf, 0x58, 0x2c, 0x87, 0xf6, 0xdb, 0xfb,
-	0x70, 0xc5, 0x21, 0x4c, 0x51, 0xba, 0x62, 0x1e, 0xae, 0x58, 0x36, 0x8b, 0x76, 0x02, 0x03, 0x58, 0x95, 0x16, 0x1a,
-	0x86, 0x9c, 0x5c, 0x71, 0x18, 0xf4, 0x2c, 0x0e, 0x78, 0xde, 0xb4, 0xf1, 0x5b, 0xf8, 0x9a, 0xe9, 0xa8, 0xbc, 0xe6,
-	0xeb, 0x76, 0xdf, 0x3d, 0xdc, 0x75, 0x9f, 0xd3, 0x25, 0xd3, 0x36, 0x7e, 0xcb, 0x38, 0xce, 0x54, 0xb8, 0x64, 0x45,
-	0x97, 0x8c, 0x9d, 0x4b, 0xe0, 0x6b, 0x86, 0x9e, 0x8d, 0x9a, 0x36, 0x18, 0x40, 0xae, 0x69, 0x4b, 0x5b, 0x6d, 0x0f,
-	0xb1, 0x67, 0x87, 0xdb, 0x74, 0x45, 0xbb, 0x0c, 0x93, 0x3f, 0x0b, 0xe6, 0x82, 0xd9, 0x98, 0xd2, 0x74, 0xcf, 0x17,
-	0xb3, 0xf4, 0x2d, 0x77, 0xc7, 0xc3, 0xd0, 0x7a, 0x39, 0x8f, 0x13, 0x11, 0xc6, 0x30, 0x1b, 0x71, 0xd3, 0x69, 0xe9,
-	0x40, 0x57, 0x41, 0x95, 0xb6, 0x43, 0xdb, 0x57, 0xd3, 0xd0, 0x97, 0x76, 0xd5, 0x8c, 0xc3, 0xdc, 0x86, 0x48, 0xa7,
-	0xe6, 0xb3, 0xb2, 0xff, 0x5f, 0x5e, 0xbe, 0x7e, 0xe9, 0xd2, 0x1c, 0x4f, 0x43, 0xd3, 0xd0, 0x89, 0x76, 0xd9, 0x0e,
-	0x1d, 0x4a, 0xcd, 0xe7, 0xe5, 0xdd, 0xc3, 0x2c, 0xec, 0xfa, 0x34, 0x09, 0x41, 0xeb, 0xa2, 0xdf, 0x8d, 0xc3, 0x54,
-	0x8d, 0x47, 0xe4, 0xa6, 0x53, 0x9a, 0xe6, 0x96, 0xa6, 0xed, 0x70, 0xb7, 0x3d, 0x7c, 0x49, 0x9d, 0x99, 0xcf, 0x86,
-	0x39, 0x9b, 0x84, 0x11, 0xc8, 0x30, 0x97, 0xa5, 0x61, 0xfe, 0xd3, 0xed, 0xfb, 0xe4, 0x42, 0xc1, 0xf4, 0x8b, 0xc1,
-	0x83, 0xb2, 0x47, 0x4c, 0x57, 0x65, 0xdb, 0xfe, 0xa1, 0xe3, 0x5e, 0x8f, 0xc2, 0x44, 0xae, 0xa4, 0xe5, 0x6c, 0x54,
-	0xb6, 0x7c, 0x7c, 0xee, 0xc9, 0xd2, 0xb1, 0xe5, 0xac, 0x85, 0x96, 0x63, 0xd5, 0xf2, 0xcb, 0xbe, 0xeb, 0xc8, 0x5d,
-	0x86, 0x0e, 0x84, 0x4e, 0x4b, 0x63, 0x35, 0x8b, 0x9f, 0xfb, 0x63, 0xf2, 0xf7, 0x71, 0xbc, 0xed, 0x02, 0x3b, 0x30,
-	0x51, 0x2d, 0x77, 0x4f, 0xc5, 0x5d, 0x57, 0x63, 0x31, 0xc1, 0x6c, 0x5a, 0xb6, 0x3d, 0xec, 0xfe, 0x48, 0x16, 0x18,
-	0xc5, 0xa6, 0xb3, 0x10, 0xa6, 0xf3, 0x25, 0x37, 0x55, 0x21, 0x7a, 0xe8, 0x9e, 0x68, 0xe6, 0x82, 0x97, 0xbc, 0x5a,
-	0x86, 0xaf, 0x5d, 0xc0, 0x7d, 0x55, 0x7c, 0x76, 0xd9, 0x45, 0xd3, 0x9d, 0xa7, 0xab, 0x09, 0x74, 0x78, 0xa1, 0x82,
-	0x7f, 0x47, 0xc6, 0x0d, 0x01, 0xf6, 0x6a, 0xbc, 0x48, 0xbe, 0x99, 0x1b, 0x2f, 0x4b, 0x0f, 0xba, 0xea, 0xef, 0xfa,
-	0xd4, 0x8d, 0x60, 0xf8, 0xe8, 0x11, 0xed, 0x7c, 0x1c, 0x55, 0x92, 0x5a, 0xab, 0xb0, 0x3c, 0x74, 0xf7, 0x3b, 0xb9,
-	0x62, 0xf0, 0xa1, 0xe0, 0xa2, 0xc5, 0x25, 0xf3, 0x51, 0xe9, 0xfc, 0x77, 0x31, 0xe9, 0x0c, 0xce, 0x3f, 0x1d, 0x86,
-	0x19, 0x3a, 0x33, 0x1b, 0x4f, 0xa9, 0xed, 0xb8, 0x6c, 0xdb, 0xfd, 0x7e, 0xdc, 0xde, 0x71, 0xa4, 0x8c, 0xdb, 0x14,
-	0x2b, 0x13, 0xb6, 0xe0, 0xbc, 0x2d, 0x5b, 0xdf, 0xc4, 0x25, 0x40, 0xb7, 0xaf, 0xde, 0x5c, 0xcd, 0x63, 0xc8, 0xfe,
-	0x87, 0x21, 0x35, 0x0e, 0x73, 0x19, 0x7d, 0x34, 0xb8, 0xd4, 0x74, 0x11, 0xe3, 0x96, 0xaf, 0xa0, 0xd9, 0x5c, 0x91,
-	0xee, 0x6e, 0x49, 0x15, 0x82, 0xe3, 0x47, 0xe7, 0x5f, 0x8e, 0xc0, 0xf9, 0xe7, 0x34, 0x9d, 0xf3, 0xf1, 0x78, 0x68,
-	0xfb, 0x3a, 0xc5, 0xc9, 0x2c, 0xba, 0xd3, 0x2c, 0xdc, 0x68, 0x3e, 0x5f, 0x52, 0xc3, 0x79, 0xd9, 0xf0, 0xbb, 0xd4,
-	0x70, 0x19, 0xdb, 0x2d, 0x97, 0x31, 0x3b, 0x51, 0x3b, 0x9a, 0xc5, 0x21, 0x0b, 0x84, 0x76, 0xdf, 0x0f, 0xed, 0xe6,
-	0x49, 0x2b, 0xe7, 0x83, 0x20, 0xf1, 0x57, 0xb3, 0xba, 0xb6, 0xed, 0xd0, 0xf2, 0x8d, 0xdc, 0x71, 0x11, 0xc6, 0x2a,
-	0x77, 0x5c, 0x95, 0xdf, 0xfc, 0x43, 0x6a, 0x17, 0x7b, 0x38, 0x0f, 0x29, 0x26, 0xb7, 0x5b, 0x8c, 0xca, 0x76, 0x3f,
-	0x26, 0x8b, 0xc6, 0x66, 0x41, 0x6f, 0xa4, 0xd9, 0xb8, 0xfc, 0xda, 0x7f, 0x26, 0xaf, 0x69, 0x49, 0xcc, 0x41, 0xff,
-	0x16, 0x6d, 0xd9, 0xf2, 0x5f, 0xd0, 0xc1, 0x30, 0x3a, 0xb9, 0xa3, 0x4a, 0x8b, 0xff, 0x96, 0x76, 0x93, 0x25, 0x76,
-	0x90, 0xf3, 0xe1, 0xa0, 0x96, 0xbf, 0x34, 0x6f, 0x49, 0x93, 0x86, 0x6f, 0x1e, 0xe2, 0x31, 0xb7, 0x9c, 0x95, 0x46,
-	0x7c, 0x97, 0x02, 0x2c, 0x7e, 0x71, 0xec, 0x60, 0x6e, 0xc6, 0xe1, 0x35, 0xc4, 0xd9, 0x2f, 0xcd, 0x4f, 0x30, 0x27,
-	0xc1, 0xe5, 0xa5, 0x9d, 0xca, 0x7b, 0x3f, 0x93, 0x05, 0x63, 0xc3, 0x65, 0xe8, 0xbd, 0x34, 0x5c, 0x96, 0xdf, 0xfb,
-	0x4b, 0x6a, 0xd8, 0xc6, 0x90, 0x9a, 0x35, 0x71, 0x61, 0x29, 0x4d, 0x57, 0xa5, 0x71, 0xde, 0xa7, 0x79, 0x1e, 0xa5,
-	0x79, 0x5e, 0xc1, 0x3c, 0x2f, 0xd5, 0xbc, 0xfc, 0xda, 0xf0, 0xc2, 0x62, 0x3e, 0x82, 0x79, 0x59, 0xaa, 0x79, 0xf9,
-	0x90, 0xe6, 0x25, 0xa6, 0xe5, 0x90, 0x0b, 0xca, 0x3b, 0xb6, 0xe5, 0x1d, 0x3f, 0xd2, 0x78, 0x26, 0xda, 0x19, 0x97,
-	0x2a, 0x76, 0x7e, 0x4b, 0x81, 0xb0, 0x18, 0x3a, 0x39, 0x1b, 0x2d, 0x65, 0xad, 0xb2, 0x9c, 0x96, 0xa6, 0x3c, 0xe3,
-	0x6f, 0x8f, 0x4e, 0x06, 0x16, 0x5a, 0xce, 0xca, 0x5e, 0x9e, 0xa7, 0x3b, 0x8e, 0xc8, 0x7d, 0xe6, 0x38, 0x20, 0x15,
-	0x31, 0x17, 0x0d, 0xac, 0x1a, 0xe6, 0x45, 0x37, 0xd5, 0xfc, 0xac, 0x53, 0xcb, 0xf1, 0xd0, 0x72, 0x15, 0xc3, 0x35,
-	0xb7, 0x5c, 0x96, 0xf7, 0xfc, 0x44, 0x13, 0x34, 0xf4, 0x73, 0x86, 0x5f, 0xbe, 0x2a, 0xc7, 0xb3, 0x49, 0xb7, 0x5c,
-	0xea, 0xf1, 0xac, 0x46, 0x65, 0xbb, 0xff, 0x66, 0x9f, 0x8c, 0xb3, 0x03, 0x5f, 0xbc, 0xe2, 0x15, 0xc7, 0x70, 0xe3,
-	0x5f, 0x9a, 0xcb, 0xb0, 0xc2, 0xbf, 0xed, 0x1e, 0xf3, 0x32, 0xa5, 0x8d, 0x9d, 0x0d, 0x8d, 0x27, 0x43, 0x5a, 0xe1,
-	0x8b, 0x78, 0x59, 0x49, 0x89, 0xf8, 0x32, 0x5c, 0x03, 0xc9, 0x78, 0x9a, 0x06, 0x38, 0x19, 0xc3, 0xd4, 0xae, 0x26,
-	0xee, 0xf7, 0xc0, 0xda, 0xa6, 0xa5, 0x2f, 0x8a, 0x4e, 0x91, 0xbf, 0x28, 0xaf, 0x34, 0xd3, 0xac, 0x6c, 0x0f, 0x57,
-	0xbb, 0xdd, 0xd5, 0x6e, 0x7f, 0x75, 0xbc, 0x27, 0x67, 0x9b, 0x84, 0xa5, 0xc7, 0x14, 0x83, 0x7b, 0xa5, 0xf2, 0xd8,
-	0x31, 0x2e, 0x9d, 0x0f, 0x61, 0xe1, 0xcf, 0xeb, 0xde, 0x20, 0xab, 0xb3, 0x81, 0x7d, 0xb5, 0xa0, 0x65, 0xc8, 0x6a,
-	0x5e, 0xc6, 0xf9, 0xb0, 0xb8, 0xcb, 0x16, 0x18, 0x2f, 0xd2, 0xda, 0x6e, 0x32, 0x86, 0xb5, 0xdd, 0x4a, 0xe5, 0xb4,
-	0xad, 0x38, 0x60, 0x68, 0x1d, 0x7c, 0x21, 0xe7, 0x9b, 0x95, 0x5a, 0x85, 0x5c, 0x4a, 0xea, 0x8b, 0x2d, 0x27, 0x71,
-	0x91, 0x4f, 0x2d, 0x57, 0xa5, 0x8c, 0x5c, 0x35, 0x9c, 0x50, 0x63, 0xcb, 0xd0, 0xe9, 0x7c, 0xcf, 0x61, 0x45, 0x54,
-	0xac, 0x8f, 0x1b, 0x5e, 0x00, 0x84, 0x58, 0x99, 0xc5, 0x70, 0xe6, 0x9b, 0x0e, 0x4b, 0x33, 0xbc, 0x6b, 0x32, 0x43,
-	0x5c, 0x45, 0xc7, 0xbb, 0xc6, 0x14, 0x23, 0x77, 0x55, 0xd3, 0xfa, 0x99, 0xc2, 0x2f, 0xac, 0xbb, 0x82, 0x54, 0x84,
-	0x44, 0xdd, 0x06, 0xd1, 0x1b, 0xb8, 0x9f, 0x9a, 0x5d, 0x58, 0x77, 0x0c, 0xff, 0xb8, 0x6b, 0x3e, 0xdf, 0xf1, 0xf5,
-	0x2a, 0x2a, 0x6f, 0x48, 0xa8, 0xc3, 0xc5, 0xf3, 0x21, 0x93, 0xc1, 0x57, 0xa9, 0x85, 0x49, 0xf2, 0x9c, 0xe0, 0x30,
-	0xaf, 0xc2, 0xd2, 0x7e, 0xb1, 0xc4, 0xfe, 0xcf, 0xca, 0x4e, 0xed, 0x1a, 0x5a, 0x97, 0xa5, 0xc5, 0x40, 0x94, 0xe1,
-	0x29, 0x37, 0x9d, 0x97, 0x4d, 0xff, 0x3f, 0xf5, 0x3f, 0x74, 0x7b, 0xe8, 0x7f, 0xbb, 0x98, 0x63, 0xeb, 0x45, 0x69,
-	0x18, 0x5a, 0x30, 0x4f, 0x93, 0x61, 0xe6, 0x63, 0xec, 0xc3, 0xb2, 0xbc, 0x71, 0x5a, 0x03, 0x4c, 0x93, 0x0d, 0xdb,
-	0xb8, 0x38, 0x93, 0xa6, 0x4a, 0x3e, 0xef, 0xb3, 0x73, 0xaf, 0x42, 0x22, 0x9b, 0x82, 0x09, 0xc6, 0x6a, 0x0e, 0x1f,
-	0xf2, 0xf7, 0x47, 0x13, 0x14, 0x2d, 0xd5, 0x42, 0x32, 0x2d, 0x38, 0x69, 0x85, 0x3c, 0x0d, 0xe9, 0x16, 0x9a, 0xaa,
-	0x65, 0xe4, 0xd7, 0x64, 0x82, 0xb8, 0x84, 0x6b, 0x83, 0x25, 0xa7, 0x21, 0xe7, 0x42, 0x63, 0xbd, 0x02, 0x49, 0xf7,
-	0x1d, 0xda, 0x86, 0x76, 0x61, 0x4c, 0xd0, 0x76, 0x5a, 0xc6, 0x6f, 0x5a, 0xd6, 0x84, 0xfc, 0x3b, 0x52, 0x4e, 0x34,
-	0x9e, 0x95, 0x0d, 0xd3, 0xe2, 0x6a, 0xd8, 0xb9, 0x84, 0xe0, 0x9e, 0xc7, 0xc8, 0x68, 0xb9, 0xa9, 0x9a, 0x2f, 0x5a,
-	0x41, 0xa6, 0x71, 0xb5, 0x21, 0x2a, 0x67, 0xd3, 0x39, 0x37, 0x55, 0xf1, 0x76, 0x6c, 0xf2, 0x1e, 0x2a, 0x46, 0x11,
-	0xc6, 0xc6, 0x78, 0x59, 0xce, 0xeb, 0x93, 0xe8, 0x58, 0xb0, 0x54, 0x3b, 0xc7, 0xa6, 0xbc, 0x02, 0xa1, 0xb4, 0xf8,
-	0x2c, 0x7d, 0x0d, 0x2e, 0x38, 0x45, 0xc3, 0xb6, 0xa3, 0xf2, 0xae, 0x7f, 0x90, 0x40, 0xd3, 0x24, 0x84, 0x10, 0x81,
-	0xb6, 0x2a, 0xe4, 0x5e, 0xa8, 0xed, 0x94, 0x22, 0xa1, 0xe8, 0x43, 0xdb, 0x96, 0xf6, 0xfa, 0x0f, 0x35, 0x0e, 0xe9,
-	0x3e, 0x6c, 0x0e, 0x43, 0x8e, 0x9d, 0xb6, 0x4b, 0x6e, 0x4a, 0xf3, 0x35, 0x65, 0x29, 0x09, 0x1a, 0x2a, 0x3a, 0x35,
-	0x8b, 0x23, 0x0c, 0x2b, 0x82, 0xe9, 0x28, 0x86, 0xff, 0x82, 0xaf, 0xe1, 0x0d, 0x1c, 0x2d, 0x4a, 0x2f, 0x69, 0x1b,
-	0x1d, 0xe3, 0x2a, 0x55, 0x69, 0x82, 0xbc, 0x2d, 0xb2, 0xfb, 0xb6, 0x33, 0xe7, 0x2b, 0x44, 0xa4, 0x5f, 0x2d, 0xd2,
-	0x77, 0x4c, 0xa6, 0x2b, 0xfc, 0x0e, 0x5e, 0xae, 0x4c, 0xc7, 0xa2, 0xd2, 0x8f, 0xbb, 0xbb, 0x6b, 0xda, 0x43, 0x8d,
-	0x9a, 0x71, 0xf8, 0x82, 0x59, 0x90, 0x97, 0x49, 0xcb, 0x5f, 0x34, 0x57, 0x79, 0x27, 0x95, 0x1c, 0xae, 0xfb, 0x67,
-	0x5a, 0xec, 0xaf, 0x92, 0xc3, 0x4e, 0xda, 0x76, 0x10, 0x49, 0xba, 0x48, 0x79, 0xb7, 0x6c, 0xf2, 0x63, 0xbf, 0xc2,
-	0xb6, 0x36, 0x8a, 0xcc, 0x6c, 0x3e, 0xe2, 0xe6, 0xca, 0xbf, 0xe3, 0xc6, 0xf8, 0x6e, 0xf7, 0x70, 0x43, 0x06, 0x88,
-	0xd9, 0x70, 0x36, 0x8e, 0x9b, 0xc0, 0x7c, 0x01, 0x19, 0x6b, 0x4c, 0xfe, 0xf0, 0x39, 0x96, 0xbb, 0x78, 0x49, 0x9e,
-	0x0a, 0x5b, 0xe1, 0xb2, 0xc9, 0x04, 0x36, 0x8e, 0xe3, 0xb9, 0xca, 0x37, 0x2f, 0x5d, 0xde, 0x7c, 0xc4, 0x54, 0x0b,
-	0x29, 0x79, 0x3c, 0x57, 0xbb, 0xa6, 0xcf, 0x77, 0xfd, 0x7e, 0xf7, 0x90, 0x83, 0x2e, 0x2e, 0x87, 0x66, 0xc3, 0xe4,
-	0x71, 0x80, 0xcc, 0x95, 0xd7, 0x1f, 0x3a, 0xe9, 0xce, 0x2c, 0x66, 0x90, 0x60, 0x90, 0x41, 0xa9, 0xe6, 0xb9, 0x37,
-	0x2a, 0xdb, 0x5c, 0x1d, 0xf7, 0xfb, 0xee, 0xe1, 0x8a, 0x3d, 0xb0, 0x8d, 0x97, 0xcd, 0xe2, 0xff, 0xad, 0x78, 0xf2,
-	0x78, 0x15, 0xde, 0x8e, 0xa7, 0x92, 0xfc, 0x0e, 0xbb, 0xa1, 0x16, 0xc8, 0x3b, 0x91, 0x58, 0xcf, 0x69, 0xa7, 0xf8,
-	0x3d, 0x0b, 0xb5, 0xbc, 0xe0, 0x12, 0x90, 0x64, 0xcd, 0x18, 0xe9, 0x93, 0xf9, 0xb0, 0xdd, 0x81, 0xcb, 0x94, 0x92,
-	0xdd, 0x1c, 0x77, 0xe1, 0x92, 0xfb, 0x5e, 0xd6, 0x1b, 0x71, 0x05, 0x10, 0x63, 0x29, 0x44, 0xf4, 0x88, 0xed, 0xc6,
-	0xeb, 0x75, 0xce, 0xcf, 0xf1, 0xaa, 0xa1, 0x87, 0xe8, 0xfb, 0xe1, 0xaa, 0x36, 0x44, 0x0c, 0x5c, 0x35, 0xa9, 0x5c,
-	0x25, 0xee, 0x1c, 0x36, 0x07, 0xc3, 0x65, 0x2d, 0x5e, 0xa6, 0x32, 0xd3, 0xe7, 0x1d, 0x67, 0xc1, 0x31, 0x65, 0xc1,
-	0x65, 0x4c, 0x0d, 0x1c, 0xbe, 0x8b, 0x99, 0x9e, 0xd3, 0xa2, 0xf9, 0x34, 0x74, 0x6d, 0x09, 0x33, 0xba, 0x50, 0x33,
-	0xda, 0x3d, 0x5c, 0x4b, 0x0d, 0x23, 0xe4, 0xbf, 0xb0, 0x29, 0x0f, 0x5e, 0xdf, 0x4e, 0x73, 0x6f, 0xd4, 0x7c, 0x5e,
-	0x6f, 0x6f, 0x6e, 0x3a, 0x8e, 0xe0, 0x61, 0x69, 0x16, 0x85, 0x7a, 0x89, 0x26, 0x5e, 0x79, 0x57, 0x70, 0x75, 0xae,
-	0x6d, 0x29, 0x50, 0xb0, 0x4a, 0x30, 0xe6, 0x95, 0x7c, 0x59, 0x87, 0x89, 0xd1, 0xd5, 0xed, 0x3b, 0x2a, 0x8a, 0x8d,
-	0x62, 0x45, 0xb5, 0x49, 0x15, 0x2b, 0x8e, 0x17, 0x5e, 0xaf, 0xcf, 0xda, 0x5c, 0xae, 0xda, 0xde, 0xec, 0xb7, 0x5f,
-	0xd3, 0x80, 0x66, 0xd1, 0xa7, 0x63, 0x11, 0x6d, 0x0c, 0xeb, 0xcd, 0x31, 0x2f, 0xdd, 0x27, 0xf4, 0x5d, 0x97, 0xc7,
-	0x30, 0x8d, 0x8f, 0x59, 0x28, 0x56, 0xe9, 0xfe, 0xd1, 0xab, 0xa9, 0xfd, 0xb4, 0x9c, 0x46, 0xf1, 0xcf, 0xcb, 0xed,
-	0x81, 0x04, 0x86, 0x4b, 0x51, 0xe1, 0xde, 0xb9, 0x14, 0x35, 0xe6, 0x15, 0xbd, 0x76, 0xd1, 0x7c, 0xd9, 0x8c, 0xca,
-	0x03, 0xd3, 0xd1, 0x0c, 0x2f, 0x9b, 0xfb, 0x97, 0xd9, 0x62, 0xdf, 0x14, 0xb7, 0x2e, 0xe3, 0xa5, 0x9a, 0xd9, 0xec,
-	0xda, 0xe0, 0x6e, 0xb3, 0xe4, 0xdb, 0x0b, 0x70, 0x37, 0x5e, 0xf8, 0x2f, 0x59, 0x07, 0xef, 0xee, 0x76, 0x5f, 0x0f,
-	0xbb, 0x83, 0xf4, 0x30, 0xc8, 0x73, 0x08, 0xf3, 0x5c, 0x04, 0x1b, 0xf3, 0x0e, 0x20, 0x20, 0x79, 0xb6, 0x1e, 0xbf,
-	0xf4, 0xc7, 0x5c, 0xbf, 0x1c, 0xb4, 0x64, 0x95, 0xca, 0xef, 0x0b, 0x2e, 0xe4, 0x8d, 0x57, 0x2a, 0xf4, 0xb8, 0xdc,
-	0x90, 0x25, 0xb7, 0x5d, 0x92, 0xe4, 0xc6, 0x05, 0xc5, 0x82, 0xcd, 0xb1, 0xd2, 0x51, 0xb4, 0xdf, 0x72, 0xb9, 0x29,
-	0x16, 0x79, 0xc3, 0x4e, 0x60, 0x32, 0x1e, 0x4b, 0x89, 0x62, 0xbc, 0x52, 0xd3, 0xb5, 0xbd, 0x3a, 0x3e, 0x52, 0xfb,
-	0x98, 0xcb, 0x02, 0x1d, 0xc7, 0x0e, 0xed, 0x55, 0xc5, 0x30, 0x2d, 0xee, 0x3f, 0xdf, 0x75, 0x29, 0xc1, 0xae, 0xe8,
-	0x3b, 0x96, 0xb1, 0x48, 0x9a, 0xfb, 0xa4, 0xd6, 0xeb, 0x92, 0x6a, 0xa2, 0x95, 0xa2, 0xa4, 0x4f, 0xe3, 0x12, 0xb8,
-	0xcd, 0xdf, 0xb1, 0x28, 0xdb, 0xdf, 0x6f, 0xaf, 0xf6, 0xa4, 0xa2, 0x61, 0x0a, 0x67, 0x51, 0xe0, 0xc2, 0x18, 0x66,
-	0x39, 0x09, 0xae, 0x54, 0x0d, 0xea, 0x72, 0xdf, 0xf1, 0x98, 0xa9, 0x5c, 0x35, 0x8d, 0x41, 0x3d, 0xe3, 0x19, 0x59,
-	0xa9, 0x2a, 0xd4, 0x75, 0xff, 0xb8, 0xbd, 0xca, 0xb9, 0x29, 0x6a, 0xc6, 0x2c, 0xac, 0x25, 0x26, 0x71, 0x53, 0xcc,
-	0x0b, 0x9a, 0x96, 0x57, 0xf0, 0xf9, 0x9a, 0x5d, 0x08, 0x35, 0x9e, 0xf7, 0x31, 0x5d, 0x32, 0x2d, 0x2f, 0x51, 0x32,
-	0xb8, 0xcf, 0xa9, 0x8c, 0x0a, 0xbc, 0x93, 0xb8, 0x51, 0x5c, 0x8d, 0xb9, 0xb9, 0x9a, 0xb9, 0xab, 0xee, 0x3a, 0x78,
-	0x24, 0x15, 0x6f, 0xe3, 0xae, 0x62, 0xc8, 0xfe, 0xcb, 0x96, 0x1f, 0x02, 0xb4, 0x23, 0x5d, 0xbc, 0x3d, 0x3e, 0xdc,
-	0x6c, 0xf7, 0xc7, 0xfb, 0xbb, 0xed, 0x31, 0x8d, 0x64, 0x35, 0x49, 0x13, 0x38, 0x14, 0x59, 0xa7, 0x7c, 0x95, 0x9a,
-	0x8c, 0xfe, 0xa6, 0x7f, 0xe8, 0x6e, 0x69, 0xe4, 0x29, 0x69, 0xc6, 0xae, 0x4c, 0xf3, 0xb7, 0xa8, 0xc9, 0xb8, 0xda,
-	0xf2, 0x5c, 0xb0, 0x43, 0xc5, 0xf5, 0x51, 0x9e, 0xec, 0x76, 0xa4, 0x03, 0xe4, 0x5e, 0x2b, 0xe6, 0x32, 0xf4, 0x29,
-	0x2b, 0x66, 0xcb, 0x2b, 0x18, 0x6e, 0xff, 0x9a, 0xca, 0x4a, 0x43, 0x3e, 0x5e, 0x8d, 0xa1, 0x18, 0xd3, 0xb6, 0xb9,
-	0x9e, 0x9c, 0x42, 0xbd, 0xdf, 0x5f, 0x7f, 0xee, 0xee, 0x77, 0xb9, 0x3e, 0x39, 0x8d, 0x79, 0x21, 0x6c, 0xfc, 0xb0,
-	0xa8, 0xdb, 0xf2, 0x23, 0x95, 0x5c, 0x9b, 0x81, 0x8d, 0xaf, 0x29, 0xd0, 0xb4, 0xfc, 0x64, 0x25, 0x57, 0x53, 0xa4,
-	0xf5, 0x50, 0x52, 0x89, 0x13, 0x1c, 0xdc, 0x67, 0xa0, 0xd3, 0x05, 0x5c, 0xe3, 0xa3, 0xb5, 0xe3, 0xfb, 0xd4, 0xfd,
-	0xb8, 0xdf, 0x59, 0x86, 0x8d, 0x2a, 0x24, 0xd3, 0x96, 0x1f, 0xaa, 0x0c, 0x7a, 0x9c, 0xba, 0x7f, 0x1f, 0x96, 0x5e,
-	0xc7, 0x3b, 0xee, 0xff, 0x7c, 0x91, 0xfa, 0x3f, 0xc7, 0xfe, 0xf3, 0x23, 0x06, 0x5e, 0xf3, 0x6e, 0xa1, 0x16, 0x1b,
-	0x8c, 0x13, 0xe6, 0x29, 0xaf, 0x4d, 0xdb, 0xa9, 0xda, 0x7b, 0x5d, 0xc7, 0x44, 0x7d, 0x38, 0x94, 0x5b, 0xb0, 0xc9,
-	0x0c, 0xaf, 0xd0, 0x3b, 0x25, 0x19, 0x2f, 0x6d, 0x97, 0x26, 0x61, 0xb7, 0x90, 0xb7, 0x4b, 0xad, 0xa9, 0xbb, 0x4b,
-	0xfb, 0xa8, 0x47, 0xf1, 0xe1, 0x42, 0xdc, 0xb3, 0xcc, 0x78, 0xd7, 0xd6, 0x72, 0xf9, 0x9d, 0xbb, 0xdf, 0x77, 0xe2,
-	0x6a, 0xed, 0x10, 0x2c, 0xd2, 0x19, 0x5d, 0x80, 0x0f, 0x79, 0xf0, 0x3e, 0x88, 0xe4, 0xe5, 0xdd, 0x81, 0x72, 0xf4,
-	0x7c, 0x49, 0x29, 0x7d, 0x28, 0x57, 0xd3, 0xf3, 0x94, 0x57, 0xea, 0x19, 0xcc, 0xbf, 0x8b, 0xd0, 0x1c, 0xe6, 0x78,
-	0x1a, 0xba, 0xb5, 0x1c, 0x2f, 0xcb, 0xf6, 0x79, 0x83, 0x2d, 0x92, 0xc7, 0xbb, 0xec, 0xe8, 0x12, 0x1c, 0x30, 0xaf,
-	0x54, 0xa7, 0xb6, 0xa0, 0x2e, 0x49, 0xee, 0xe3, 0x42, 0x39, 0x8b, 0x8b, 0x6e, 0x7e, 0x34, 0x51, 0x49, 0x9b, 0xa0,
-	0xd9, 0x72, 0x64, 0xbf, 0x24, 0xf7, 0x49, 0xa2, 0x8c, 0xfb, 0x34, 0x94, 0x59, 0xc6, 0xea, 0x4b, 0xb8, 0xa8, 0x54,
-	0x0c, 0x39, 0x17, 0x97, 0xcc, 0x90, 0xb9, 0xd2, 0x7d, 0xbd, 0x7b, 0xda, 0x91, 0x02, 0x2f, 0xe7, 0xa9, 0x37, 0xab,
-	0x24, 0xc4, 0xfe, 0xed, 0xc5, 0x42, 0x72, 0x6f, 0x76, 0xd0, 0x7c, 0x6f, 0x2e, 0x5c, 0xab, 0x8c, 0x20, 0x25, 0xec,
-	0x25, 0xef, 0x0b, 0x8c, 0x49, 0x21, 0xe9, 0xd0, 0xfe, 0x6c, 0xb9, 0xb0, 0xc6, 0xc9, 0xa5, 0x3e, 0xf5, 0x0d, 0x58,
-	0xf4, 0x33, 0xdf, 0x91, 0xf7, 0x74, 0xf2, 0x1d, 0xb2, 0xb1, 0xf3, 0xe6, 0x39, 0xef, 0x83, 0x87, 0x47, 0x67, 0x90,
-	0x17, 0xe2, 0x36, 0x33, 0x4a, 0x70, 0xb1, 0x27, 0xb6, 0x13, 0x57, 0xf6, 0x8d, 0x67, 0x6f, 0x58, 0x8c, 0x8f, 0x2b,
-	0xe3, 0x91, 0xc4, 0x80, 0x23, 0x59, 0x4e, 0x2a, 0xcd, 0x55, 0xea, 0x81, 0x4b, 0xf4, 0x7c, 0x67, 0x03, 0x83, 0xc8,
-	0x0f, 0x16, 0x8e, 0x65, 0x05, 0x2c, 0x7a, 0x99, 0xef, 0x80, 0x19, 0x29, 0xac, 0x3b, 0xaf, 0x78, 0x39, 0x7c, 0xc1,
-	0xe0, 0xdf, 0xc3, 0x17, 0x2c, 0xec, 0x17, 0xe4, 0x67, 0x07, 0x65, 0x90, 0xf2, 0x33, 0x04, 0x33, 0x82, 0xfc, 0x4c,
-	0x22, 0xac, 0x00, 0xe8, 0xf1, 0x89, 0x7d, 0x30, 0xc1, 0x8d, 0x8b, 0x87, 0x9e, 0x30, 0x73, 0x4b, 0xca, 0x9d, 0xc1,
-	0x6d, 0x5f, 0xe9, 0x38, 0x5d, 0xcc, 0xf9, 0x1a, 0x3e, 0xaa, 0x90, 0xb5, 0x2f, 0x8c, 0x19, 0x2b, 0xa2, 0x66, 0x08,
-	0xb0, 0x2c, 0xc9, 0x03, 0x58, 0xac, 0x66, 0xbe, 0x63, 0x5c, 0x41, 0x44, 0x8f, 0x4e, 0x44, 0x34, 0xcf, 0x98, 0xf8,
-	0x84, 0xd4, 0x28, 0xf3, 0x5a, 0x21, 0x77, 0x85, 0x1f, 0x0f, 0xe8, 0x11, 0xa7, 0x27, 0x05, 0x21, 0x88, 0x8a, 0x47,
-	0x05, 0xd9, 0x4e, 0x2c, 0xf6, 0x32, 0xcb, 0x2c, 0xf6, 0xab, 0x13, 0x93, 0xbc, 0x85, 0xb5, 0x24, 0x74, 0xca, 0x08,
-	0x25, 0x57, 0xee, 0x75, 0xa7, 0x66, 0x74, 0xce, 0xa4, 0xa8, 0x7b, 0xeb, 0xa1, 0x7c, 0x2f, 0x7d, 0xe2, 0x67, 0x55,
-	0xab, 0xd1, 0x89, 0x3e, 0xc1, 0x5a, 0x92, 0xd4, 0x38, 0x66, 0xc5, 0x76, 0x5a, 0x73, 0xbb, 0x62, 0xa9, 0x57, 0xf7,
-	0x3b, 0x51, 0x01, 0x59, 0xee, 0xa4, 0x92, 0xd8, 0x74, 0x36, 0xb5, 0xd3, 0x26, 0xcd, 0x61, 0xd1, 0x76, 0x52, 0x30,
-	0x72, 0x79, 0x14, 0xe6, 0x80, 0x8e, 0x6e, 0xc4, 0x55, 0xa1, 0x49, 0x0c, 0x8b, 0x34, 0x80, 0xbb, 0xfe, 0x3f, 0xdd,
-	0xc3, 0x0d, 0xef, 0xf4, 0x87, 0x27, 0xd8, 0x71, 0x35, 0x52, 0x19, 0xee, 0x47, 0xe9, 0xbd, 0x3c, 0x94, 0x31, 0x12,
-	0x99, 0x1f, 0xc0, 0x99, 0x09, 0x6b, 0xd3, 0x00, 0x8a, 0x87, 0x71, 0x26, 0xf4, 0x95, 0xe2, 0x41, 0x8d, 0xaf, 0xee,
-	0xdd, 0x5a, 0xc1, 0xd1, 0x9d, 0x2a, 0x8a, 0xf1, 0x1a, 0xc3, 0x2d, 0xe7, 0x14, 0x13, 0x6f, 0xb9, 0xde, 0x29, 0x43,
-	0x4f, 0x45, 0xcf, 0x89, 0x33, 0x6d, 0x12, 0x9c, 0x30, 0x6d, 0xbc, 0xd4, 0x2e, 0x2a, 0xf8, 0xda, 0xb9, 0xff, 0x5b,
-	0x39, 0x12, 0x3f, 0xa7, 0xb1, 0x29, 0x97, 0xba, 0x7f, 0xf6, 0xa5, 0xdf, 0xa7, 0xee, 0x8c, 0x86, 0xae, 0xaf, 0x6c,
-	0x08, 0xe4, 0x35, 0x27, 0x8c, 0x14, 0x9e, 0xe3, 0x99, 0xa1, 0xe6, 0x59, 0x86, 0xd4, 0x06, 0xb3, 0x5c, 0x99, 0xaf,
-	0xdf, 0x54, 0xb2, 0x4d, 0xcf, 0xdf, 0x6c, 0x73, 0x32, 0xcd, 0x35, 0x04, 0x40, 0x7a, 0x5c, 0x31, 0x9f, 0x41, 0xb9,
-	0xdf, 0x24, 0x0e, 0xe8, 0x3b, 0x66, 0x0e, 0xd3, 0xf9, 0xec, 0x3e, 0x59, 0xe8, 0xd0, 0x71, 0xb4, 0xd0, 0x4d, 0xf0,
-	0x48, 0xc6, 0xe1, 0x38, 0xd4, 0x3b, 0xa8, 0xa2, 0x3d, 0x69, 0xda, 0xb0, 0x2c, 0x9c, 0x4c, 0xe0, 0xc4, 0x85, 0x31,
-	0xa8, 0x08, 0x17, 0xd8, 0xb3, 0xbe, 0x82, 0x91, 0xe6, 0xb8, 0x78, 0xa9, 0xb5, 0x96, 0xf5, 0x20, 0xb4, 0x9e, 0xab,
-	0x70, 0xe7, 0x95, 0xd7, 0xfd, 0xf1, 0xee, 0x71, 0xf7, 0xf5, 0x2e, 0xd5, 0xf7, 0xc2, 0x2a, 0x36, 0x58, 0x3f, 0x56,
-	0xb3, 0x56, 0x7a, 0xe5, 0xc5, 0xd6, 0x01, 0x75, 0x60, 0xf3, 0x38, 0x2b, 0x23, 0x91, 0xdc, 0x3c, 0x59, 0xf9, 0x89,
-	0xa9, 0x5d, 0x11, 0xd1, 0xee, 0xe9, 0xeb, 0x76, 0xff, 0xb8, 0xdb, 0xde, 0x5d, 0xef, 0x3e, 0x7f, 0xce, 0xde, 0x30,
-	0x59, 0x26, 0x41, 0x19, 0x8f, 0xfc, 0x40, 0x79, 0x29, 0xd3, 0x76, 0x5e, 0x48, 0xc5, 0xe5, 0xcd, 0x48, 0x1b, 0x88,
-	0x93, 0x13, 0xae, 0xbc, 0xe4, 0x01, 0xb6, 0x31, 0x68, 0x56, 0x44, 0xbd, 0x84, 0x4a, 0x3b, 0x9d, 0x49, 0xcc, 0x64,
-	0x35, 0x71, 0xf8, 0x41, 0x2f, 0x3a, 0xb3, 0xb0, 0x57, 0xd7, 0x9c, 0xe5, 0x2a, 0x8a, 0x97, 0x9d, 0x2b, 0x3b, 0x8e,
-	0xbc, 0xb4, 0x2b, 0xae, 0xc8, 0x5b, 0x05, 0x67, 0xe4, 0x59, 0x56, 0x60, 0x67, 0x31, 0xfa, 0xf3, 0x9d, 0xc5, 0x03,
-	0x44, 0x26, 0x3d, 0x55, 0xf2, 0xe6, 0x9a, 0x5d, 0x03, 0x22, 0x8d, 0x7d, 0x63, 0x39, 0x93, 0xaa, 0x88, 0x5d, 0x23,
-	0x48, 0x2e, 0x28, 0xa6, 0x41, 0xb5, 0xcf, 0xdb, 0x28, 0x98, 0xb6, 0xb4, 0x87, 0xf2, 0x16, 0xfd, 0x70, 0x22, 0x2d,
-	0x6c, 0xc4, 0xab, 0xc7, 0xd2, 0x64, 0x8e, 0xe9, 0xa9, 0xc6, 0xbe, 0xbf, 0xed, 0x1e, 0x8a, 0x67, 0x1b, 0xe3, 0x30,
-	0x88, 0xe1, 0xd9, 0xc6, 0x48, 0x2f, 0x01, 0x69, 0x85, 0xb6, 0xef, 0x6e, 0x76, 0x07, 0x29, 0x70, 0x9e, 0x5a, 0xa2,
-	0xe5, 0x8c, 0x26, 0xb1, 0x09, 0xe7, 0x4a, 0x4c, 0x70, 0xca, 0xce, 0xb1, 0x14, 0x75, 0x3e, 0x38, 0x62, 0x45, 0x9d,
-	0xeb, 0xfb, 0xc7, 0x90, 0x30, 0xe5, 0x0c, 0x50, 0x1c, 0x45, 0x54, 0xdf, 0x99, 0x94, 0xf1, 0x8c, 0xa3, 0x82, 0xb6,
-	0x88, 0x8f, 0xaa, 0xc6, 0x39, 0x87, 0x41, 0xf4, 0xa7, 0x1c, 0x36, 0xae, 0xfb, 0x43, 0x0f, 0xfe, 0xc0, 0x4f, 0xb9,
-	0x56, 0x8e, 0x3f, 0xe4, 0x0c, 0x06, 0xf3, 0x9b, 0xb3, 0x97, 0xc9, 0x02, 0xdc, 0x18, 0x9c, 0x47, 0x1a, 0xeb, 0x3b,
-	0x4f, 0x53, 0xb7, 0xe9, 0x1c, 0x95, 0x1c, 0xbe, 0x6a, 0x07, 0x7f, 0x68, 0x53, 0xea, 0x70, 0x27, 0xea, 0x87, 0x47,
-	0xa8, 0xc8, 0xb8, 0x6b, 0xfb, 0xbc, 0x3e, 0xc4, 0x54, 0x3d, 0xa7, 0x15, 0x56, 0x71, 0x9c, 0xc9, 0xac, 0x72, 0xf5,
-	0xb2, 0xa6, 0xa5, 0x65, 0x4d, 0xf1, 0x20, 0xd8, 0x64, 0x1a, 0x58, 0xaf, 0x93, 0x35, 0x87, 0x47, 0x3d, 0x95, 0x15,
-	0x44, 0x07, 0x1b, 0xa0, 0x41, 0x1a, 0xe2, 0x06, 0x08, 0x9f, 0xb3, 0x9a, 0x44, 0x89, 0x5b, 0xb2, 0x94, 0x28, 0xa7,
-	0xe5, 0xb1, 0x15, 0x93, 0x68, 0x60, 0xc2, 0xfe, 0x42, 0x5a, 0x2a, 0x95, 0x5a, 0x2e, 0xa8, 0x96, 0x41, 0xc4, 0x33,
-	0xe1, 0xb0, 0x41, 0x75, 0x7b, 0xfc, 0x1f, 0x54, 0xf5, 0xe1, 0xd9, 0xa7, 0xeb, 0x9d, 0x59, 0xd4, 0x71, 0x83, 0xb8,
-	0x4a, 0xf6, 0x29, 0x0e, 0x03, 0x98, 0x9c, 0x0d, 0xfb, 0x80, 0x13, 0x39, 0x3b, 0x7b, 0xbf, 0x34, 0x6f, 0x4f, 0x94,
-	0x10, 0xb2, 0xfa, 0xe3, 0x32, 0xe5, 0x44, 0xb0, 0xe4, 0x75, 0x3d, 0x48, 0x33, 0x6d, 0x03, 0x4e, 0x8e, 0xb6, 0x30,
-	0x7e, 0x5e, 0xd7, 0xb7, 0x36, 0x55, 0xe4, 0xe1, 0xaa, 0x04, 0x56, 0x8c, 0xb9, 0xb6, 0xd6, 0x82, 0xfd, 0xd8, 0xa9,
-	0x4d, 0xfa, 0x7c, 0x4c, 0x7b, 0xe8, 0xee, 0xee, 0x91, 0xe2, 0x66, 0x08, 0xe1, 0x74, 0xf8, 0xc9, 0xb5, 0xcf, 0x63,
-	0x5e, 0xad, 0x16, 0x47, 0x11, 0xea, 0xd1, 0xf2, 0xdc, 0x17, 0xab, 0xb2, 0x20, 0xa8, 0xed, 0x22, 0xe6, 0xec, 0xe9,
-	0x89, 0x55, 0x59, 0x61, 0x24, 0x1c, 0x70, 0xad, 0x8c, 0x71, 0x9f, 0x4e, 0x11, 0xa4, 0x62, 0xf8, 0x28, 0x9d, 0x29,
-	0xcf, 0x4f, 0xdb, 0xcd, 0x1c, 0x88, 0x75, 0xb8, 0xf2, 0x19, 0xcf, 0x00, 0x56, 0xe5, 0xd3, 0xd4, 0xe9, 0xc8, 0x8f,
-	0x66, 0x2b, 0xa7, 0x4e, 0x97, 0xe5, 0x1c, 0xdc, 0xfa, 0x15, 0x85, 0x7d, 0x71, 0x16, 0x52, 0x7f, 0xcd, 0xb5, 0xd4,
-	0x31, 0xf8, 0xf4, 0xcf, 0xa2, 0x75, 0x96, 0xd3, 0x33, 0x58, 0xef, 0x06, 0x1d, 0xdd, 0x07, 0x3d, 0x4d, 0x76, 0x1a,
-	0xea, 0xbe, 0x41, 0x23, 0x27, 0x73, 0x6b, 0xd9, 0xbc, 0xc4, 0x2f, 0x76, 0xa1, 0x8b, 0xa4, 0x76, 0xc5, 0x29, 0x3b,
-	0x3d, 0x7f, 0x77, 0xb0, 0x5b, 0x1a, 0x83, 0xda, 0x55, 0x44, 0xf8, 0x9d, 0x96, 0xd4, 0x05, 0x6c, 0x14, 0xcd, 0xd0,
-	0xb9, 0xf0, 0xae, 0x16, 0x14, 0xb1, 0xf0, 0x6e, 0x7c, 0x75, 0xb5, 0xa4, 0x81, 0xe7, 0x97, 0x39, 0x68, 0xf5, 0xd4,
-	0x4e, 0x17, 0xcd, 0x6a, 0xe6, 0x14, 0x33, 0x64, 0x79, 0x56, 0x24, 0x6f, 0xd4, 0x30, 0x1d, 0x74, 0x39, 0xdf, 0x43,
-	0x32, 0xce, 0xb9, 0xde, 0x24, 0x63, 0x6e, 0x8c, 0xfb, 0xcf, 0x61, 0x41, 0x14, 0x2c, 0x55, 0xdd, 0x93, 0xfd, 0x04,
-	0x09, 0x33, 0x1d, 0xcd, 0x9d, 0x3b, 0x1b, 0xbe, 0x59, 0x3e, 0xbc, 0xfe, 0x65, 0x7b, 0x97, 0x56, 0xe1, 0x93, 0x69,
-	0x9a, 0xdf, 0xa9, 0xb3, 0x9f, 0xe1, 0x04, 0x1b, 0x6b, 0xfa, 0x7f, 0x25, 0xbb, 0x66, 0xdf, 0x56, 0xe2, 0x02, 0x27,
-	0x91, 0xaa, 0x5b, 0xf4, 0x07, 0x28, 0xac, 0xd0, 0x62, 0x74, 0x6e, 0xeb, 0x2a, 0x59, 0x8a, 0x4c, 0xf4, 0xfc, 0x89,
-	0x22, 0x51, 0xf8, 0xe0, 0xce, 0xb5, 0xb6, 0x1a, 0xca, 0x13, 0x0c, 0x13, 0x90, 0x57, 0xdf, 0x0b, 0x67, 0x81, 0xc3,
-	0x4f, 0x0f, 0x64, 0xf1, 0xc7, 0x47, 0xda, 0x62, 0x4a, 0x30, 0x05, 0x40, 0x99, 0x04, 0x0a, 0x34, 0x56, 0xb0, 0xbf,
-	0x10, 0x67, 0xdb, 0x22, 0x89, 0x84, 0xcd, 0x5c, 0x3b, 0xaa, 0x6f, 0x39, 0x7e, 0x33, 0x15, 0xe5, 0x53, 0xa1, 0x99,
-	0x65, 0xd2, 0x98, 0xf6, 0x54, 0x3e, 0xe4, 0x73, 0x40, 0xd7, 0x21, 0x9d, 0xf3, 0xcb, 0x0b, 0xa3, 0x58, 0xd7, 0x8b,
-	0xde, 0xbd, 0xa8, 0x0f, 0xa5, 0x97, 0x50, 0x28, 0xbc, 0x43, 0xeb, 0x5e, 0x5e, 0x85, 0xe5, 0x91, 0xc3, 0x89, 0xf2,
-	0xea, 0xc8, 0x8f, 0xa0, 0xc5, 0x58, 0x1e, 0xd2, 0x45, 0xae, 0x19, 0x3d, 0x28, 0x0d, 0x9b, 0xb3, 0x2b, 0xf6, 0xee,
-	0xb0, 0xe0, 0x4c, 0xef, 0x69, 0x2c, 0xe6, 0xd5, 0xda, 0x70, 0x19, 0x6b, 0x71, 0xfd, 0x68, 0xb7, 0x35, 0xb9, 0x2e,
-	0xa4, 0x4b, 0xa5, 0x13, 0x2a, 0xf7, 0x78, 0xab, 0xb5, 0xbc, 0x79, 0x92, 0x68, 0x28, 0x36, 0x4f, 0x93, 0x9a, 0x39,
-	0xa5, 0x7d, 0x5e, 0x8b, 0x3b, 0xe1, 0x23, 0x75, 0x3a, 0xdd, 0xa9, 0x71, 0x74, 0xbf, 0xe5, 0xa2, 0x3c, 0x45, 0x6d,
-	0x14, 0xd5, 0x5c, 0x46, 0x95, 0xee, 0xe2, 0x99, 0xa6, 0x59, 0x19, 0xc2, 0x58, 0x68, 0x59, 0x38, 0xb7, 0x23, 0xc9,
-	0xad, 0x31, 0xc3, 0xcd, 0x28, 0xc5, 0xc5, 0x2b, 0xe6, 0x7a, 0x3a, 0xf2, 0x15, 0xb9, 0xa2, 0x03, 0xab, 0xce, 0x5a,
-	0xbd, 0xe8, 0xbd, 0x74, 0x06, 0xdd, 0x5a, 0xf7, 0x26, 0xaf, 0x3a, 0xd5, 0x0e, 0x4d, 0x4e, 0xdd, 0xd9, 0xf2, 0x43,
-	0x2e, 0x0d, 0x6c, 0x4d, 0x95, 0xbe, 0xbe, 0xe9, 0xc5, 0xd1, 0x2e, 0xd3, 0x60, 0x8b, 0x57, 0x07, 0xb4, 0x28, 0xdd,
-	0x9a, 0x98, 0x9e, 0xa6, 0x89, 0x2b, 0x0e, 0xa4, 0x9a, 0x2a, 0x10, 0x6e, 0x95, 0x5b, 0x7a, 0x2f, 0xa5, 0x5d, 0xd6,
-	0x32, 0x8f, 0x2e, 0x6e, 0x0c, 0xd9, 0xa7, 0x75, 0x1e, 0x76, 0x65, 0xf1, 0x06, 0x61, 0x1a, 0xc4, 0x7b, 0x36, 0x9c,
-	0x85, 0x56, 0xce, 0x9d, 0x8f, 0x71, 0x9a, 0x0d, 0x12, 0xed, 0x8f, 0xf0, 0x44, 0xa7, 0x1e, 0xc2, 0x5d, 0x7f, 0x13,
-	0x63, 0xf4, 0xa1, 0x7f, 0xe4, 0x71, 0xc4, 0x53, 0xb7, 0xc5, 0xfb, 0x35, 0x26, 0x28, 0x8a, 0x05, 0x5f, 0x7b, 0xa2,
-	0xe4, 0x92, 0x75, 0xa3, 0x5c, 0x47, 0xb3, 0x74, 0x78, 0x57, 0x50, 0x6a, 0x0c, 0xfd, 0x91, 0xcc, 0x18, 0x4f, 0xf1,
-	0xb6, 0xab, 0xe1, 0x4d, 0xa8, 0x99, 0x29, 0xe4, 0x72, 0x96, 0xf0, 0x1e, 0x16, 0xd1, 0xf1, 0x67, 0xb3, 0x8b, 0xcf,
-	0xa7, 0xc0, 0x68, 0xbb, 0x9a, 0xc7, 0xe0, 0x2c, 0xe1, 0xb2, 0xcb, 0x62, 0xdd, 0x85, 0x36, 0x4a, 0x4e, 0x29, 0x5a,
-	0xa6, 0xae, 0xe6, 0x50, 0x78, 0xc4, 0x58, 0xaf, 0xdf, 0x82, 0xd3, 0x9a, 0xaa, 0xe8, 0x82, 0x56, 0xbc, 0xd5, 0x3a,
-	0x1b, 0x16, 0x90, 0xd2, 0x53, 0xe0, 0x09, 0x1e, 0xab, 0xd1, 0x3d, 0xfb, 0xe1, 0x48, 0xaf, 0xe3, 0xc1, 0xab, 0xa8,
-	0x3f, 0x3c, 0x5c, 0xc3, 0x5b, 0xac, 0xf4, 0x5e, 0xeb, 0xbb, 0x6e, 0xff, 0xf0, 0x66, 0xfb, 0xb8, 0x85, 0x8f, 0xbf,
-	0x6e, 0x77, 0x61, 0xfd, 0xda, 0x4e, 0xda, 0xf1, 0xb7, 0xdf, 0xbc, 0xfb, 0xf5, 0x53, 0xf3, 0xba, 0xf9, 0x3e, 0x2e,
-	0xe3, 0xf3, 0x87, 0xb4, 0x0e, 0x40, 0x24, 0x59, 0xad, 0x40, 0x68, 0x51, 0x0b, 0xd8, 0x3f, 0xc3, 0x87, 0x59, 0xfe,
-	0x90, 0xf2, 0x3d, 0x22, 0x68, 0x4b, 0xc0, 0xdf, 0x37, 0xaf, 0xa6, 0xf9, 0x1e, 0xb4, 0xd1, 0x44, 0x04, 0xe2, 0x0d,
-	0xe1, 0xec, 0x8c, 0x08, 0xa6, 0xcc, 0x86, 0x48, 0x91, 0xaf, 0x91, 0x20, 0x7b, 0x23, 0x94, 0x4e, 0x4f, 0x20, 0x92,
-	0xf4, 0x10, 0x90, 0x0f, 0xf8, 0xe1, 0x2c, 0x0c, 0x63, 0x91, 0x3f, 0xb0, 0x8d, 0x00, 0x29, 0x06, 0x9c, 0xf1, 0xf3,
-	0xf8, 0xdc, 0x33, 0x7f, 0xa0, 0x01, 0x03, 0x82, 0x03, 0x06, 0x58, 0x06, 0x0c, 0x20, 0x0d, 0x18, 0x90, 0x72, 0xc0,
-	0x40, 0xf0, 0x80, 0x01, 0x22, 0x7d, 0x45, 0x68, 0x48, 0x17, 0x00, 0x5c, 0xc4, 0x85, 0x57, 0x9e, 0xab, 0x75, 0x90,
-	0xaf, 0xfc, 0x61, 0x13, 0xda, 0xc9, 0x07, 0x1e, 0x87, 0x20, 0xd0, 0xe1, 0x0c, 0xc2, 0x9b, 0xbf, 0x60, 0x91, 0x63,
-	0x8c, 0xf2, 0xfc, 0x81, 0xee, 0x04, 0x08, 0x5a, 0x04, 0x60, 0xf9, 0x02, 0x00, 0xc9, 0x22, 0x80, 0x94, 0x16, 0x01,
-	0x82, 0x2d, 0x02, 0x10, 0x5b, 0x04, 0xa0, 0x64, 0x11, 0x01, 0x9e, 0x70, 0x3c, 0xcf, 0xf8, 0xe1, 0xa5, 0xf8, 0x60,
-	0x0c, 0xf2, 0xe2, 0x18, 0x24, 0x35, 0xc2, 0xf0, 0x23, 0x44, 0xc7, 0x20, 0xc1, 0x3a, 0x10, 0x19, 0x36, 0xd1, 0x98,
-	0x08, 0x0c, 0x49, 0x42, 0x74, 0x5c, 0x12, 0xec, 0x07, 0x67, 0x22, 0x31, 0x42, 0x09, 0xd1, 0x61, 0x4a, 0xb0, 0x1b,
-	0xab, 0xc4, 0x39, 0x01, 0x4b, 0x8c, 0x8e, 0x5a, 0x82, 0x2b, 0xa1, 0x4b, 0xac, 0x89, 0x5f, 0xc2, 0x75, 0x10, 0x13,
-	0xac, 0x23, 0x39, 0xc1, 0x1f, 0x0c, 0x82, 0x31, 0x4d, 0x88, 0x0e, 0x6c, 0x86, 0xdd, 0xe8, 0x4e, 0x24, 0x86, 0x38,
-	0x21, 0x3a, 0xce, 0x09, 0x76, 0x83, 0x9d, 0x38, 0x27, 0xe2, 0x89, 0xd1, 0x61, 0x4f, 0x70, 0x25, 0xf6, 0x89, 0x35,
-	0x02, 0x40, 0xb8, 0x51, 0x01, 0xc2, 0x95, 0x14, 0x24, 0xb4, 0xd0, 0x83, 0x04, 0xa1, 0x28, 0x24, 0x64, 0x63, 0x3c,
-	0xdc, 0xc8, 0x03, 0xc1, 0xd5, 0x90, 0x70, 0x85, 0x22, 0x51, 0xa8, 0x16, 0x84, 0x68, 0xc9, 0x20, 0xd8, 0xd5, 0x0d,
-	0xe2, 0x1c, 0xf1, 0x20, 0x46, 0x2b, 0x08, 0xc1, 0x15, 0x19, 0x21, 0xd6, 0x68, 0x09, 0xe1, 0x46, 0x50, 0x08, 0x57,
-	0xaa, 0x92, 0xd0, 0x27, 0x63, 0x86, 0x67, 0x83, 0xbc, 0x58, 0xc4, 0xb7, 0xad, 0x27, 0x37, 0x29, 0xf8, 0x51, 0x6e,
-	0x08, 0xd1, 0x72, 0x43, 0xb0, 0x96, 0x1b, 0x86, 0x8d, 0xdc, 0x24, 0x02, 0xe5, 0x86, 0x10, 0x2d, 0x37, 0x04, 0xfb,
-	0x72, 0x93, 0x48, 0x94, 0x1b, 0x42, 0xb4, 0xdc, 0x10, 0xec, 0xca, 0x0d, 0x71, 0x8e, 0xdc, 0x10, 0xa3, 0xe5, 0x86,
-	0xe0, 0x8a, 0xdc, 0x10, 0x6b, 0xe4, 0x86, 0x70, 0x2d, 0x37, 0x04, 0x6b, 0xb9, 0x49, 0xf0, 0x07, 0x83, 0xa0, 0xdc,
-	0x10, 0xa2, 0xe5, 0x86, 0x61, 0x57, 0x6e, 0x12, 0x89, 0x72, 0x43, 0x88, 0x96, 0x1b, 0x82, 0x5d, 0xb9, 0x21, 0xce,
-	0x91, 0x1b, 0x62, 0xb4, 0xdc, 0x10, 0x5c, 0x91, 0x1b, 0x62, 0x8d, 0xdc, 0x10, 0x6e, 0xe4, 0x86, 0x70, 0x25, 0x37,
-	0x09, 0x2d, 0xe4, 0x26, 0x41, 0x28, 0x37, 0x09, 0xd9, 0x18, 0x0f, 0x37, 0x72, 0x43, 0x70, 0x35, 0x24, 0x5c, 0xb9,
-	0x49, 0x14, 0xca, 0x0d, 0x21, 0x5a, 0x6e, 0x08, 0x76, 0xe5, 0x86, 0x38, 0x47, 0x6e, 0x88, 0xd1, 0x72, 0x43, 0x70,
-	0x45, 0x6e, 0x88, 0x35, 0x72, 0x43, 0xb8, 0x91, 0x1b, 0xc2, 0x95, 0xdc, 0x24, 0xf4, 0xc9, 0x98, 0xe1, 0xd9, 0x20,
-	0x2f, 0x16, 0xf1, 0x6d, 0xeb, 0xc9, 0x0d, 0x18, 0x04, 0x35, 0x07, 0x61, 0x2d, 0x3c, 0xc8, 0x69, 0xf5, 0x29, 0x38,
-	0x23, 0x41, 0xc0, 0xa2, 0x0e, 0x21, 0xac, 0xc5, 0x08, 0x39, 0x5f, 0x91, 0xa0, 0x05, 0xca, 0x12, 0xc2, 0x5a, 0x9b,
-	0x90, 0x73, 0x05, 0x0a, 0x1b, 0x38, 0x2a, 0x85, 0xb4, 0x96, 0x2a, 0xe4, 0x2a, 0x7a, 0x85, 0x4d, 0x8c, 0x68, 0x21,
-	0xa9, 0x95, 0x0b, 0x39, 0x2d, 0x5f, 0xc0, 0x7d, 0xf0, 0x61, 0x14, 0x32, 0x84, 0xb5, 0x9a, 0x15, 0x9c, 0x2b, 0x69,
-	0xd0, 0x02, 0x75, 0x0d, 0x61, 0x2d, 0x6e, 0xc8, 0xb9, 0x0a, 0x87, 0x0d, 0x1c, 0x99, 0x43, 0x5a, 0x6b, 0x1d, 0x72,
-	0x15, 0xc1, 0xc3, 0x26, 0x46, 0xf5, 0x90, 0x34, 0xd2, 0x87, 0xa4, 0xd2, 0x3f, 0xa0, 0x0a, 0x11, 0x04, 0x1c, 0x95,
-	0x10, 0xe0, 0x8d, 0x1f, 0x81, 0x46, 0x13, 0x91, 0x3b, 0x1d, 0xbc, 0xae, 0x3a, 0x02, 0x8f, 0x12, 0x89, 0xb0, 0xd6,
-	0x49, 0xe4, 0x5c, 0xb1, 0xc4, 0x06, 0x8e, 0x62, 0x22, 0xad, 0x65, 0x13, 0xb9, 0x8a, 0x76, 0x62, 0x13, 0x23, 0xa0,
-	0x48, 0x1a, 0x15, 0x45, 0x52, 0x49, 0x29, 0x50, 0x4f, 0xbe, 0xf5, 0x9e, 0x7d, 0xf8, 0xa5, 0x02, 0x9f, 0x98, 0x26,
-	0x4f, 0x63, 0x33, 0x84, 0x0a, 0x2b, 0xa0, 0xd6, 0x57, 0x61, 0xb4, 0xba, 0x02, 0x63, 0xb4, 0x35, 0x73, 0xa8, 0xac,
-	0x02, 0x6a, 0x5d, 0x15, 0xc6, 0x57, 0xd5, 0xcc, 0xa3, 0xa6, 0x0a, 0xa8, 0x15, 0x55, 0x18, 0x57, 0x4f, 0x85, 0x76,
-	0xd4, 0x54, 0x48, 0xad, 0xa5, 0xc2, 0x54, 0x94, 0x54, 0x1a, 0x18, 0x1d, 0x15, 0x4a, 0xab, 0xa8, 0x30, 0x5a, 0x43,
-	0x33, 0xf3, 0xc1, 0x03, 0x51, 0x3f, 0x05, 0xd4, 0xea, 0x09, 0x8c, 0xab, 0x9d, 0x99, 0x47, 0xe5, 0x14, 0x50, 0xeb,
-	0xa6, 0x30, 0xae, 0x6a, 0x0a, 0xed, 0x68, 0xa6, 0x90, 0x5a, 0x31, 0x85, 0xa9, 0xe8, 0xa5, 0x34, 0x30, 0x6a, 0x29,
-	0x94, 0xd1, 0x4a, 0xa1, 0x94, 0x52, 0x66, 0xa2, 0xd0, 0xc9, 0x8c, 0xa2, 0x4a, 0x66, 0x70, 0xe3, 0x45, 0x90, 0x51,
-	0x48, 0x61, 0x4e, 0x05, 0x9e, 0xab, 0x8e, 0x99, 0x45, 0x6d, 0x14, 0x50, 0x2b, 0xa3, 0x30, 0xae, 0x2e, 0x0a, 0xed,
-	0xa8, 0xa2, 0x90, 0x5a, 0x13, 0x85, 0xa9, 0x28, 0xa2, 0x34, 0x30, 0x7a, 0x28, 0x94, 0x51, 0x43, 0xa1, 0x94, 0x16,
-	0x66, 0xe2, 0xc9, 0xb3, 0xd3, 0xb3, 0x07, 0xbe, 0xb8, 0x60, 0x75, 0x22, 0x3c, 0x05, 0x4c, 0xa3, 0x46, 0xf9, 0x23,
-	0x44, 0x6b, 0x1f, 0xc1, 0x5a, 0xf8, 0x18, 0x36, 0xaa, 0x97, 0x08, 0x94, 0x3c, 0x42, 0xb4, 0xde, 0x11, 0xec, 0x8b,
-	0x5d, 0x22, 0x51, 0xe9, 0x08, 0xd1, 0x32, 0x47, 0xb0, 0xab, 0x71, 0xc4, 0x39, 0x02, 0x47, 0x8c, 0x56, 0x37, 0x82,
-	0x2b, 0xd2, 0x46, 0xac, 0xd1, 0x35, 0xc2, 0xb5, 0xa8, 0x11, 0xac, 0x15, 0x2d, 0xc1, 0x1f, 0x0c, 0x82, 0x5a, 0x46,
-	0x88, 0x16, 0x32, 0x86, 0x5d, 0x15, 0x4b, 0x24, 0x4a, 0x18, 0x21, 0x5a, 0xbf, 0x08, 0x76, 0xc5, 0x8b, 0x38, 0x47,
-	0xb9, 0x88, 0xd1, 0xb2, 0x45, 0x70, 0x45, 0xb3, 0x88, 0x35, 0x82, 0x45, 0xb8, 0x51, 0x2b, 0xc2, 0x95, 0x54, 0x25,
-	0xb4, 0xd0, 0xa9, 0x04, 0xa1, 0x48, 0x25, 0x64, 0x63, 0x3c, 0xdc, 0xc8, 0x13, 0xc1, 0xd5, 0x90, 0x70, 0x85, 0x29,
-	0x51, 0xa8, 0x4a, 0x84, 0x68, 0x49, 0x22, 0xd8, 0xd5, 0x23, 0xe2, 0x1c, 0x31, 0x22, 0x46, 0x2b, 0x11, 0xc1, 0x15,
-	0x19, 0x22, 0xd6, 0x68, 0x10, 0xe1, 0x46, 0x80, 0x08, 0x57, 0xea, 0x93, 0xd0, 0x27, 0x63, 0x86, 0x67, 0x83, 0xbc,
-	0x58, 0xc4, 0xb7, 0xad, 0x27, 0x37, 0xd4, 0x4b, 0xd4, 0x1b, 0x86, 0xb4, 0xe0, 0x30, 0xae, 0x15, 0x27, 0xe3, 0x46,
-	0x72, 0x88, 0x41, 0xcd, 0x61, 0x48, 0x8b, 0x0e, 0xe3, 0xbe, 0xea, 0x10, 0x8b, 0xb2, 0xc3, 0x90, 0xd6, 0x1d, 0xc6,
-	0x5d, 0xe1, 0x61, 0xd2, 0x51, 0x1e, 0xa6, 0xb4, 0xf4, 0x30, 0x5e, 0xd1, 0x1e, 0xa6, 0x8d, 0xf8, 0x30, 0xa1, 0xd5,
-	0x87, 0x71, 0x2d, 0x3f, 0x84, 0x7f, 0xb0, 0x10, 0x0a, 0x10, 0x43, 0x5a, 0x81, 0x32, 0xee, 0x4a, 0x10, 0xb1, 0xa8,
-	0x41, 0x0c, 0x69, 0x11, 0x62, 0xdc, 0x55, 0x21, 0x26, 0x1d, 0x19, 0x62, 0x4a, 0xeb, 0x10, 0xe3, 0x15, 0x21, 0x62,
-	0xda, 0x28, 0x11, 0x13, 0x46, 0x8a, 0x98, 0x50, 0x5a, 0x44, 0x70, 0x21, 0x46, 0x84, 0xa1, 0x1a, 0x11, 0xb4, 0xb1,
-	0x11, 0x60, 0xf4, 0x88, 0xf1, 0x7a, 0xd0, 0xb8, 0x8a, 0x44, 0x1c, 0x4a, 0x12, 0x43, 0x5a, 0x93, 0x18, 0x77, 0x45,
-	0x89, 0x49, 0x47, 0x95, 0x98, 0xd2, 0xb2, 0xc4, 0x78, 0x45, 0x97, 0x98, 0x36, 0xc2, 0xc4, 0x84, 0x51, 0x26, 0x26,
-	0x94, 0x34, 0x11, 0xfc, 0x64, 0x2d, 0xf2, 0x6c, 0xa1, 0x17, 0x07, 0xaa, 0x98, 0xda, 0xd3, 0x27, 0xea, 0x13, 0xea,
-	0x13, 0x43, 0x5a, 0x9f, 0x18, 0xd7, 0xfa, 0x94, 0x71, 0xa3, 0x4f, 0xc4, 0xa0, 0x3e, 0x31, 0xa4, 0xf5, 0x89, 0x71,
-	0x5f, 0x9f, 0x88, 0x45, 0x7d, 0x62, 0x48, 0xeb, 0x13, 0xe3, 0xae, 0x3e, 0x31, 0xe9, 0xe8, 0x13, 0x53, 0x5a, 0x9f,
-	0x18, 0xaf, 0xe8, 0x13, 0xd3, 0x46, 0x9f, 0x98, 0xd0, 0xfa, 0xc4, 0xb8, 0xd6, 0x27, 0xc2, 0x3f, 0x58, 0x08, 0xf5,
-	0x89, 0x21, 0xad, 0x4f, 0x19, 0x77, 0xf5, 0x89, 0x58, 0xd4, 0x27, 0x86, 0xb4, 0x3e, 0x31, 0xee, 0xea, 0x13, 0x93,
-	0x8e, 0x3e, 0x31, 0xa5, 0xf5, 0x89, 0xf1, 0x8a, 0x3e, 0x31, 0x6d, 0xf4, 0x89, 0x09, 0xa3, 0x4f, 0x4c, 0x28, 0x7d,
-	0x22, 0xb8, 0xd0, 0x27, 0xc2, 0x50, 0x9f, 0x08, 0xda, 0xd8, 0x08, 0x30, 0xfa, 0xc4, 0x78, 0x3d, 0x68, 0x5c, 0x7d,
-	0x22, 0x0e, 0xf5, 0x89, 0x21, 0xad, 0x4f, 0x8c, 0xbb, 0xfa, 0xc4, 0xa4, 0xa3, 0x4f, 0x4c, 0x69, 0x7d, 0x62, 0xbc,
-	0xa2, 0x4f, 0x4c, 0x1b, 0x7d, 0x62, 0xc2, 0xe8, 0x13, 0x13, 0x4a, 0x9f, 0x08, 0x7e, 0xb2, 0x16, 0x79, 0xb6, 0xd0,
-	0x8b, 0x03, 0x55, 0x4c, 0xed, 0xe9, 0xd3, 0xf0, 0xd5, 0xa8, 0x4e, 0x09, 0xd0, 0xda, 0x94, 0x50, 0xad, 0x4c, 0x84,
-	0x1a, 0x5d, 0x1a, 0x70, 0x54, 0xa5, 0x04, 0x68, 0x4d, 0x4a, 0xa8, 0xaf, 0x48, 0x03, 0x87, 0x7a, 0x94, 0x00, 0xad,
-	0x46, 0x09, 0x75, 0xb5, 0x28, 0x51, 0x8e, 0x12, 0x25, 0x42, 0xeb, 0x50, 0x42, 0x2b, 0x2a, 0x94, 0x48, 0xa3, 0x41,
-	0x09, 0xd6, 0x0a, 0x94, 0x50, 0xad, 0x3f, 0x03, 0xfa, 0x41, 0x03, 0xa8, 0x3d, 0x09, 0xd0, 0xca, 0x43, 0xa8, 0xab,
-	0x3b, 0x03, 0x87, 0xaa, 0x93, 0x00, 0xad, 0x39, 0x09, 0x75, 0x15, 0x27, 0x51, 0x8e, 0xde, 0x24, 0x42, 0xab, 0x4d,
-	0x42, 0x2b, 0x5a, 0x93, 0x48, 0xa3, 0x34, 0x09, 0x36, 0x3a, 0x93, 0x60, 0xa5, 0x32, 0xc3, 0xc7, 0x42, 0x63, 0x06,
-	0x04, 0x15, 0x66, 0x00, 0x36, 0xda, 0x83, 0x8d, 0xba, 0x24, 0xb4, 0xe6, 0xf0, 0xae, 0xb2, 0x0c, 0x0c, 0xea, 0x4a,
-	0x02, 0xb4, 0xaa, 0x24, 0xd4, 0xd5, 0x94, 0x44, 0x39, 0x8a, 0x92, 0x08, 0xad, 0x27, 0x09, 0xad, 0xa8, 0x49, 0x22,
-	0x8d, 0x96, 0x24, 0xd8, 0x28, 0x49, 0x82, 0x95, 0x8e, 0x0c, 0x1f, 0x9f, 0xf4, 0xd8, 0x9f, 0x35, 0xf0, 0x62, 0x00,
-	0xd7, 0x98, 0x9e, 0x7a, 0x24, 0x27, 0x47, 0xf9, 0x20, 0x44, 0xeb, 0x07, 0xc1, 0x5a, 0x40, 0x18, 0x36, 0x0a, 0x92,
-	0x08, 0x94, 0x10, 0x42, 0xb4, 0x86, 0x10, 0xec, 0x8b, 0x48, 0x22, 0x51, 0x45, 0x08, 0xd1, 0x32, 0x42, 0xb0, 0xab,
-	0x23, 0xc4, 0x39, 0x42, 0x42, 0x8c, 0x56, 0x12, 0x82, 0x2b, 0x52, 0x42, 0xac, 0xd1, 0x12, 0xc2, 0xb5, 0x98, 0x10,
-	0xac, 0xd5, 0x24, 0x7d, 0xfe, 0x60, 0x10, 0xd4, 0x13, 0x42, 0xb4, 0xa0, 0x30, 0xec, 0x2a, 0x4a, 0x22, 0x51, 0x52,
-	0x08, 0xd1, 0x9a, 0x42, 0xb0, 0x2b, 0x2a, 0xc4, 0x39, 0xaa, 0x42, 0x8c, 0x96, 0x15, 0x82, 0x2b, 0xba, 0x42, 0xac,
-	0x11, 0x16, 0xc2, 0x8d, 0xb2, 0x10, 0xae, 0xa4, 0x25, 0xa1, 0x85, 0xb6, 0x24, 0x08, 0xc5, 0x25, 0x21, 0x1b, 0xe3,
-	0xe1, 0x46, 0x5e, 0x08, 0xae, 0x86, 0x84, 0x2b, 0x30, 0x89, 0x42, 0x85, 0x21, 0x44, 0x4b, 0x0c, 0xc1, 0xae, 0xc6,
-	0x10, 0xe7, 0x88, 0x0c, 0x31, 0x5a, 0x65, 0x08, 0xae, 0xc8, 0x0c, 0xb1, 0x46, 0x67, 0x08, 0x37, 0x42, 0x43, 0xb8,
-	0x52, 0x9a, 0x84, 0x3e, 0x19, 0x33, 0x3c, 0x1b, 0xe4, 0xc5, 0x22, 0xbe, 0x6d, 0x1d, 0xb9, 0xf9, 0xae, 0x79, 0x1d,
-	0xbe, 0x53, 0x3e, 0xb0, 0xd9, 0x04, 0x21, 0x75, 0x00, 0xa4, 0xb0, 0xa1, 0xc0, 0x60, 0x3e, 0x01, 0xd9, 0x72, 0x82,
-	0x64, 0xb3, 0x08, 0x94, 0x2d, 0x22, 0x10, 0x19, 0x43, 0x00, 0x8a, 0x56, 0x41, 0xce, 0xa3, 0xdb, 0xe5, 0x0f, 0xd4,
-	0x6f, 0x40, 0xb0, 0x97, 0x00, 0x4b, 0x2f, 0x01, 0xa4, 0x5e, 0x02, 0x52, 0x4e, 0x2d, 0x10, 0xdc, 0x7d, 0x80, 0xb8,
-	0xfb, 0x00, 0xa5, 0xee, 0x33, 0xf0, 0x26, 0x1a, 0x99, 0x15, 0xf4, 0x4d, 0x36, 0x32, 0x20, 0x4a, 0x82, 0xdf, 0x94,
-	0x46, 0x06, 0x58, 0xba, 0x0f, 0x20, 0x75, 0x1f, 0x10, 0xee, 0x25, 0x40, 0xdc, 0x4b, 0x80, 0x52, 0x2f, 0x01, 0x20,
-	0x23, 0x0b, 0x72, 0x21, 0x6a, 0xf8, 0x26, 0x46, 0xb5, 0x7c, 0xd8, 0x14, 0x1f, 0x94, 0xf8, 0xbf, 0xc1, 0x30, 0xce,
-	0x60, 0x52, 0x4d, 0x34, 0x05, 0x21, 0xda, 0x1e, 0x04, 0x6b, 0xa3, 0x10, 0xec, 0x5a, 0x86, 0x38, 0xc7, 0x3c, 0xc4,
-	0x68, 0x1b, 0x11, 0x6c, 0x0c, 0x45, 0xb8, 0xb1, 0x16, 0xe1, 0xca, 0x64, 0x84, 0x6a, 0xbb, 0x25, 0xf8, 0xc2, 0x8c,
-	0x7d, 0x6d, 0x90, 0x8d, 0x45, 0xb4, 0x2d, 0x09, 0xf6, 0x0c, 0x3a, 0xbc, 0xdc, 0x5b, 0x18, 0x34, 0x21, 0xc6, 0xa0,
-	0x09, 0x36, 0x06, 0x4d, 0xb0, 0x6f, 0xd0, 0xc4, 0x79, 0x06, 0x4d, 0x8c, 0x31, 0x68, 0x82, 0xad, 0x41, 0x13, 0x6e,
-	0x0d, 0x9a, 0x70, 0x6d, 0xd0, 0x84, 0x1a, 0x83, 0x0e, 0xf0, 0x85, 0x19, 0xfb, 0xda, 0x20, 0x1b, 0x8b, 0x18, 0x83,
-	0x26, 0xd8, 0x1a, 0xf4, 0xc7, 0x68, 0xcb, 0xf1, 0x78, 0x96, 0x3f, 0xb1, 0xaa, 0x00, 0x44, 0x36, 0x44, 0xa8, 0x50,
-	0x1a, 0xc0, 0x41, 0x6a, 0x00, 0x65, 0xad, 0x01, 0x28, 0x6b, 0x0a, 0x60, 0x59, 0x54, 0x00, 0x23, 0x55, 0x01, 0x84,
-	0xec, 0x04, 0xd0, 0x36, 0xbe, 0x42, 0x9f, 0x3f, 0xd0, 0x00, 0x00, 0xa1, 0xfe, 0x03, 0x82, 0xdd, 0x07, 0x58, 0x7a,
-	0x0f, 0x20, 0x75, 0x1e, 0x10, 0xee, 0x3b, 0x40, 0xdc, 0x75, 0x80, 0x52, 0xcf, 0x01, 0xa0, 0x8e, 0x0b, 0x92, 0xfe,
-	0x72, 0x58, 0xfc, 0x45, 0x4f, 0x46, 0x0a, 0xba, 0x33, 0x23, 0xa1, 0xdf, 0xac, 0x2c, 0x10, 0x77, 0x24, 0x9d, 0x37,
-	0x12, 0x78, 0x7d, 0x1b, 0x51, 0x33, 0xbe, 0xce, 0x8e, 0xaf, 0xb3, 0xe3, 0xdb, 0x05, 0x1f, 0x92, 0x0f, 0xec, 0x6f,
-	0x82, 0x14, 0x8b, 0x60, 0x81, 0xc1, 0x03, 0x05, 0xe4, 0xa5, 0xaf, 0x20, 0x79, 0x5d, 0x2b, 0x10, 0x77, 0x41, 0xa0,
-	0x1e, 0x56, 0x61, 0x3f, 0xf2, 0xef, 0x53, 0x14, 0x50, 0x99, 0x10, 0x05, 0xc7, 0x8c, 0x28, 0x68, 0x4e, 0x89, 0x02,
-	0xe9, 0x9c, 0x28, 0x8c, 0x24, 0x45, 0xc1, 0x68, 0xd5, 0x8d, 0x10, 0x7b, 0xab, 0x40, 0xf4, 0x17, 0xdd, 0x70, 0xda,
-	0xf7, 0xb2, 0x38, 0xf9, 0x91, 0x7f, 0x92, 0x06, 0x11, 0x9a, 0x76, 0x44, 0x70, 0xd9, 0xcd, 0xf8, 0xdb, 0x18, 0xcb,
-	0x1c, 0xd8, 0x6f, 0x73, 0x28, 0x03, 0x42, 0x91, 0x00, 0x88, 0xb7, 0x57, 0x79, 0x8b, 0x71, 0x0c, 0xa0, 0xda, 0xa1,
-	0xbc, 0x95, 0x28, 0x06, 0x28, 0x4f, 0x93, 0x40, 0x29, 0x12, 0x00, 0x50, 0xdb, 0x90, 0xb7, 0x31, 0x82, 0x27, 0x79,
-	0x10, 0x5b, 0x25, 0xe5, 0x6f, 0x73, 0x04, 0x03, 0xe2, 0x09, 0xf8, 0x5b, 0x8c, 0x60, 0x00, 0x95, 0x6c, 0xbf, 0x95,
-	0x08, 0x06, 0x48, 0x8b, 0xf5, 0x5b, 0x8e, 0x60, 0x00, 0x94, 0x44, 0xbf, 0xe5, 0x08, 0x6e, 0x33, 0xd0, 0x15, 0x1f,
-	0xd4, 0xca, 0xf2, 0x6d, 0x0e, 0x60, 0x44, 0x9c, 0x95, 0xe5, 0x5b, 0x0c, 0x60, 0x04, 0x25, 0x80, 0x01, 0x55, 0xeb,
-	0xcd, 0xb7, 0x12, 0xc0, 0x00, 0xe9, 0xf5, 0xe6, 0xdb, 0x18, 0x3d, 0xf0, 0xc1, 0x74, 0xb5, 0xf7, 0x3b, 0xd6, 0x7b,
-	0x1d, 0xeb, 0x4d, 0x17, 0x54, 0xe0, 0x00, 0x61, 0xfb, 0xc6, 0x61, 0x03, 0x88, 0x5a, 0xf9, 0xbe, 0xcd, 0x41, 0x23,
-	0xc8, 0x11, 0xe7, 0xe1, 0x68, 0x5c, 0xe6, 0xe8, 0x3b, 0xc8, 0xd1, 0x73, 0x90, 0xa3, 0x71, 0x10, 0xb5, 0xcd, 0x01,
-	0xc2, 0x7a, 0xce, 0xd1, 0x7a, 0xce, 0xb1, 0xf4, 0x9c, 0x77, 0xb1, 0x76, 0xc0, 0x3b, 0xc8, 0x77, 0xb9, 0x6c, 0x00,
-	0x88, 0xb7, 0xff, 0x7d, 0x87, 0xc5, 0x02, 0x00, 0xd5, 0xae, 0xf7, 0x9d, 0x2e, 0x11, 0x00, 0xa1, 0xf7, 0xba, 0xef,
-	0x72, 0x61, 0x00, 0x10, 0xb2, 0xb5, 0x20, 0x1d, 0xf6, 0xbc, 0x53, 0x96, 0x7d, 0x97, 0x7d, 0x18, 0x11, 0xc7, 0xd6,
-	0xef, 0xd0, 0x87, 0x11, 0x14, 0x1f, 0x06, 0x54, 0xcd, 0xc0, 0x3b, 0xf1, 0x61, 0x80, 0xb4, 0xa1, 0xdf, 0x45, 0x1f,
-	0x9e, 0xe6, 0x7e, 0xf7, 0x4a, 0xef, 0xde, 0x95, 0x3e, 0x0c, 0xb0, 0x55, 0xb7, 0x77, 0xd9, 0x87, 0x01, 0xf1, 0x4b,
-	0x2f, 0xef, 0xc4, 0x87, 0x01, 0x52, 0x05, 0x97, 0x77, 0xd9, 0x87, 0x05, 0x39, 0x16, 0x1f, 0x4c, 0x67, 0x8f, 0x7e,
-	0x67, 0x8f, 0x5e, 0x67, 0x8f, 0xa6, 0xb3, 0xc7, 0x5a, 0x67, 0x8f, 0xb6, 0xb3, 0x47, 0xad, 0xd1, 0xef, 0xd8, 0x63,
-	0x05, 0x78, 0x29, 0x3e, 0x98, 0xce, 0xbe, 0x38, 0xbd, 0xc2, 0x9c, 0x84, 0x0e, 0x5f, 0xe0, 0xda, 0xf7, 0x0b, 0xd2,
-	0x0d, 0x83, 0xa2, 0x85, 0x13, 0x11, 0x05, 0xaf, 0x83, 0xa3, 0x20, 0x2b, 0x71, 0x52, 0xb4, 0x31, 0x21, 0x53, 0xb0,
-	0x3a, 0x7a, 0x0a, 0x52, 0x07, 0x12, 0x92, 0xe8, 0xdb, 0x05, 0xae, 0xc3, 0xab, 0x20, 0x75, 0xa4, 0x95, 0xa4, 0x17,
-	0x74, 0x45, 0x0b, 0x27, 0xfe, 0x4a, 0xde, 0x09, 0xc5, 0xa2, 0x81, 0x8e, 0xca, 0x82, 0x34, 0x01, 0x5a, 0xb0, 0x26,
-	0x56, 0x91, 0xed, 0x2b, 0x5e, 0x63, 0x22, 0xb8, 0x20, 0xdd, 0xf8, 0x28, 0x5a, 0xfc, 0x89, 0x53, 0x9a, 0x10, 0x2f,
-	0xc8, 0x4a, 0x00, 0x15, 0x6d, 0x4c, 0x2c, 0x15, 0xac, 0xd6, 0x80, 0x82, 0xd4, 0x72, 0x80, 0xe4, 0xb1, 0x86, 0x9f,
-	0xb2, 0x87, 0xaf, 0x17, 0x45, 0x8b, 0x3f, 0xb1, 0x87, 0x51, 0x91, 0x82, 0xfc, 0x0b, 0xf6, 0xb0, 0xda, 0x52, 0xb0,
-	0x46, 0x66, 0x0a, 0x56, 0x29, 0x0e, 0x72, 0x2f, 0x35, 0xfc, 0x94, 0x3d, 0x1c, 0x49, 0xfa, 0x29, 0x16, 0xb2, 0x5b,
-	0xf9, 0xc0, 0xab, 0x2f, 0x40, 0x70, 0x1d, 0x2d, 0xf8, 0x85, 0x2c, 0xaa, 0x7f, 0x8a, 0x1b, 0x6e, 0xf9, 0xb0, 0xc1,
-	0x66, 0x1b, 0x55, 0x71, 0xfd, 0x09, 0x77, 0xd8, 0x02, 0x7a, 0x55, 0xdc, 0x9f, 0xe2, 0x20, 0x27, 0xb9, 0x09, 0x8f,
-	0x0c, 0x10, 0x88, 0x5e, 0x06, 0xf3, 0xdb, 0xcc, 0xad, 0x42, 0xf4, 0xc0, 0xbc, 0xb7, 0x99, 0x15, 0x89, 0x43, 0xcc,
-	0xaf, 0xfc, 0x2a, 0x64, 0x63, 0xae, 0x32, 0x23, 0x36, 0xaf, 0xfc, 0x2a, 0xc6, 0x1d, 0x7b, 0x7e, 0xe9, 0x55, 0x8d,
-	0xcc, 0x58, 0xc1, 0xbc, 0xf4, 0x9a, 0x19, 0x1c, 0x1a, 0x1a, 0xa4, 0xc0, 0xb5, 0x59, 0x4a, 0xd2, 0x35, 0x0e, 0xa2,
-	0x68, 0x22, 0xc4, 0xd7, 0x15, 0x7c, 0x53, 0xb9, 0x8f, 0x31, 0x5a, 0x41, 0x3a, 0xa6, 0x43, 0xde, 0x35, 0xa0, 0x0a,
-	0x16, 0xd7, 0x2a, 0xc6, 0x98, 0x95, 0x60, 0xc9, 0x7c, 0x92, 0x2f, 0x34, 0x26, 0x21, 0xda, 0x8c, 0x0c, 0xbb, 0x06,
-	0x4c, 0x24, 0x9a, 0x2e, 0x21, 0x6b, 0x83, 0x6c, 0xcc, 0x55, 0xc6, 0x50, 0x04, 0x3b, 0x26, 0x4a, 0x8c, 0x6b, 0x9c,
-	0x44, 0xbd, 0x98, 0x91, 0x19, 0x83, 0x10, 0x6c, 0x4d, 0xf1, 0xcb, 0xf0, 0x84, 0x60, 0x91, 0x3f, 0x70, 0xb7, 0x04,
-	0xe1, 0x27, 0x04, 0x82, 0x14, 0xdb, 0x25, 0x81, 0xa1, 0xeb, 0x02, 0xf2, 0x76, 0x49, 0x90, 0xbc, 0x2b, 0x12, 0x28,
-	0xef, 0xd8, 0x04, 0xa2, 0x27, 0x04, 0x02, 0xf0, 0x3e, 0x89, 0x91, 0xd4, 0xd1, 0xd7, 0x16, 0xd1, 0x23, 0x20, 0x58,
-	0x0f, 0x83, 0x60, 0x77, 0x2c, 0xc4, 0x39, 0x03, 0x22, 0x46, 0x8f, 0x8a, 0x60, 0x33, 0x34, 0xc2, 0xcd, 0xf8, 0x08,
-	0x57, 0x83, 0x24, 0x54, 0x8f, 0x34, 0x17, 0xd6, 0x35, 0xa2, 0x47, 0x5a, 0x16, 0xd6, 0x35, 0xec, 0x8e, 0xd4, 0x14,
-	0xd6, 0x35, 0xa3, 0x47, 0xaa, 0x0a, 0xeb, 0x1a, 0x37, 0x23, 0x2d, 0x0a, 0xeb, 0x1a, 0x35, 0x23, 0x85, 0x30, 0x7b,
-	0x5d, 0xc3, 0xcd, 0xa8, 0x91, 0x34, 0x63, 0x47, 0xd2, 0xb7, 0x00, 0xb6, 0xf0, 0xec, 0x80, 0xbc, 0xb1, 0x06, 0x92,
-	0xd6, 0x26, 0xc8, 0x5a, 0xcb, 0x20, 0xab, 0xed, 0x83, 0x9c, 0xb6, 0x52, 0xfa, 0xfc, 0xda, 0x22, 0xda, 0x32, 0x04,
-	0x6b, 0x9b, 0x10, 0xec, 0x5a, 0x83, 0x38, 0xc7, 0x0e, 0xc4, 0x68, 0x0b, 0x10, 0x6c, 0xc6, 0x4e, 0xb8, 0x19, 0x35,
-	0xe1, 0x6a, 0xbc, 0x84, 0xaa, 0x91, 0xbe, 0x8f, 0x83, 0x64, 0x25, 0x7d, 0x9f, 0xc7, 0x07, 0x08, 0x0d, 0x0d, 0x90,
-	0x62, 0x5f, 0x25, 0xb0, 0x7d, 0x34, 0xfa, 0x3e, 0x8f, 0x05, 0x90, 0xbc, 0x25, 0x12, 0x28, 0x3f, 0x2c, 0x17, 0x88,
-	0x9e, 0x93, 0x0b, 0xc0, 0xdb, 0xa1, 0x8c, 0x9c, 0xc9, 0xc2, 0xec, 0x7d, 0x4e, 0x2a, 0x88, 0x60, 0x3e, 0x11, 0xfc,
-	0x42, 0xb6, 0x54, 0xef, 0x87, 0x2c, 0x92, 0x3f, 0x7c, 0xc2, 0x66, 0x1b, 0x64, 0xf2, 0x83, 0x76, 0x41, 0xec, 0xce,
-	0xf1, 0x7d, 0x56, 0xcb, 0xdc, 0xc7, 0x52, 0x2d, 0x35, 0xac, 0x0d, 0xeb, 0xa8, 0xa5, 0xe6, 0x1c, 0x13, 0x97, 0x6a,
-	0xa9, 0x61, 0x63, 0x6c, 0xa5, 0x96, 0x1a, 0x57, 0x66, 0x2f, 0xd5, 0x52, 0xc1, 0x38, 0x01, 0xe5, 0xc2, 0xd1, 0xc0,
-	0xee, 0x54, 0xc8, 0xc2, 0xb1, 0x44, 0xd6, 0x06, 0xf9, 0x64, 0xae, 0xda, 0x98, 0x36, 0x66, 0x8e, 0xcc, 0x52, 0x32,
-	0x33, 0x60, 0x61, 0x9c, 0x2d, 0x84, 0xf5, 0x94, 0x21, 0xa7, 0xe7, 0x0d, 0x39, 0x77, 0xf2, 0xb0, 0x81, 0x33, 0x83,
-	0x48, 0xeb, 0x69, 0x44, 0xce, 0xcc, 0x25, 0x92, 0x66, 0x42, 0x91, 0x54, 0xb3, 0x8a, 0x94, 0x9e, 0xda, 0xf2, 0x75,
-	0xfd, 0xa9, 0x63, 0x32, 0x33, 0xc9, 0xd5, 0xd7, 0xf5, 0xbd, 0x16, 0x17, 0xfe, 0x3c, 0xac, 0x7d, 0xf8, 0x93, 0x7f,
-	0x93, 0x8d, 0xdf, 0xda, 0xb8, 0x40, 0xe5, 0xed, 0x75, 0xa6, 0x33, 0x84, 0x5e, 0x20, 0xa0, 0xf6, 0x01, 0x61, 0xb4,
-	0x07, 0x08, 0xe3, 0xce, 0xbf, 0xd0, 0xce, 0xec, 0x0b, 0xa9, 0xe7, 0x5e, 0x18, 0x33, 0xf3, 0x42, 0x99, 0x79, 0x17,
-	0x4a, 0xcd, 0xba, 0x10, 0x7a, 0xce, 0xf1, 0x05, 0xe3, 0xa9, 0x31, 0x8e, 0x99, 0xef, 0xca, 0x0b, 0xc6, 0x96, 0xbf,
-	0xf0, 0x6c, 0xbd, 0xf6, 0xc0, 0x4f, 0xde, 0xe5, 0x1b, 0xaf, 0xa5, 0x99, 0x63, 0xf7, 0xfd, 0x5b, 0x26, 0x93, 0x49,
-	0x71, 0x7a, 0x09, 0xd1, 0x73, 0x4b, 0xb0, 0x9e, 0x58, 0x82, 0xdd, 0x59, 0x25, 0xce, 0x99, 0x52, 0x62, 0xf4, 0x7c,
-	0x12, 0x6c, 0x26, 0x93, 0x70, 0x33, 0x93, 0x84, 0xab, 0x69, 0x24, 0x54, 0xcf, 0x61, 0x7e, 0xab, 0x72, 0x5a, 0x8e,
-	0xdd, 0xcc, 0x9e, 0xf7, 0x56, 0xa5, 0x22, 0x2f, 0x8c, 0x05, 0xd7, 0x06, 0xf9, 0x64, 0xae, 0xda, 0x98, 0x36, 0x66,
-	0xae, 0xec, 0xcb, 0x88, 0xcc, 0x14, 0xd5, 0x21, 0x9c, 0xaf, 0x92, 0xd0, 0xd3, 0x56, 0xb2, 0x7a, 0xf6, 0x4a, 0xd6,
-	0x9d, 0xc4, 0xb2, 0x89, 0x33, 0x97, 0x65, 0x03, 0x3d, 0xa5, 0x25, 0x6b, 0x66, 0xb6, 0xa4, 0xcd, 0x04, 0x97, 0xb4,
-	0x9a, 0xe7, 0x92, 0xd4, 0xd3, 0x5d, 0xb0, 0x38, 0xeb, 0x25, 0xa1, 0x27, 0x5f, 0xb1, 0xae, 0x0f, 0x14, 0x6d, 0x2e,
-	0x6a, 0x73, 0xb4, 0xae, 0x11, 0x9f, 0x6a, 0xb7, 0xda, 0xd4, 0xae, 0x30, 0x6e, 0x52, 0xb2, 0x8e, 0xb7, 0x90, 0xa1,
-	0xd1, 0x4f, 0x18, 0xd2, 0x1e, 0xc2, 0xb8, 0xf6, 0x0d, 0xc6, 0x5d, 0xaf, 0x60, 0xd2, 0xf1, 0x07, 0xa6, 0xb4, 0x27,
-	0x30, 0x6e, 0x7c, 0x80, 0x09, 0x33, 0xfb, 0x4c, 0xa8, 0x79, 0x67, 0x58, 0xcf, 0xb8, 0xbc, 0xb6, 0x38, 0x55, 0x66,
-	0x30, 0xb3, 0xec, 0xbe, 0xb6, 0xa8, 0xd9, 0x0b, 0x6b, 0xcf, 0xb5, 0x85, 0x3e, 0xd9, 0x0b, 0x37, 0xb6, 0x95, 0x99,
-	0x41, 0xe7, 0x2d, 0x3f, 0xa6, 0x52, 0x95, 0x04, 0xa7, 0x8e, 0x10, 0x3d, 0x73, 0x04, 0xeb, 0x89, 0x23, 0xd8, 0x9d,
-	0x37, 0xe2, 0x9c, 0x69, 0x23, 0x46, 0xcf, 0x1a, 0xc1, 0x66, 0xd2, 0x08, 0x37, 0x73, 0x46, 0xb8, 0x9a, 0x32, 0x42,
-	0xf5, 0x8c, 0xe5, 0x02, 0xd8, 0xb4, 0x1c, 0xbb, 0x99, 0x2f, 0xaf, 0x00, 0xa6, 0xc8, 0x0b, 0x63, 0xc1, 0xb5, 0x41,
-	0x3e, 0x99, 0xab, 0x36, 0xa6, 0x8d, 0x99, 0x29, 0x53, 0x12, 0xcb, 0x4c, 0xde, 0x02, 0xe7, 0x01, 0x95, 0x5b, 0x60,
-	0x0d, 0xeb, 0x89, 0x72, 0xb6, 0xc0, 0x9a, 0x73, 0x26, 0xaa, 0xdc, 0x02, 0x6b, 0xd8, 0x4c, 0x94, 0xda, 0x02, 0x6b,
-	0x5c, 0x4d, 0x54, 0xb9, 0x05, 0x56, 0x30, 0x4e, 0x54, 0x79, 0x48, 0xdd, 0xc0, 0xee, 0x44, 0xe5, 0xa3, 0xdc, 0xca,
-	0x82, 0x6b, 0x83, 0x7c, 0x32, 0x57, 0x6d, 0x4c, 0x1b, 0x33, 0x51, 0xf6, 0x6c, 0x37, 0x31, 0xbf, 0xc6, 0x39, 0x5a,
-	0xc9, 0x07, 0xba, 0x10, 0x10, 0x9a, 0x19, 0x40, 0x70, 0x52, 0x00, 0x96, 0x9b, 0x03, 0x48, 0x53, 0x01, 0x08, 0xcf,
-	0x02, 0x40, 0x3c, 0x01, 0x00, 0x25, 0xdb, 0x03, 0x40, 0x66, 0x17, 0x64, 0xdb, 0xbc, 0x5a, 0xca, 0x07, 0xea, 0x37,
-	0x20, 0xd4, 0x6f, 0x40, 0xb0, 0xdf, 0x00, 0x4b, 0xbf, 0x01, 0xa4, 0x7e, 0x03, 0xc2, 0xfd, 0x06, 0x88, 0xfb, 0x0d,
-	0x50, 0xea, 0x37, 0x00, 0xd4, 0x6f, 0x41, 0xf4, 0x41, 0xbb, 0x5f, 0x9b, 0x82, 0xee, 0xcc, 0x48, 0xf8, 0xc9, 0x2b,
-	0x22, 0xee, 0x48, 0x3a, 0x6f, 0x24, 0xf8, 0x60, 0x15, 0x50, 0x33, 0xbe, 0xce, 0x8e, 0xaf, 0xb3, 0xe3, 0xeb, 0x8b,
-	0x0f, 0xa6, 0xab, 0xbd, 0xdf, 0xb1, 0xde, 0xeb, 0x58, 0x6f, 0xba, 0xa0, 0x9e, 0x7a, 0x02, 0x61, 0xfb, 0xc6, 0xcf,
-	0x37, 0x01, 0x31, 0x96, 0x36, 0x87, 0xdb, 0x3e, 0xe0, 0xa1, 0xf5, 0x0f, 0xe6, 0xd0, 0xfa, 0x07, 0xff, 0xd0, 0xfa,
-	0x07, 0xef, 0xd0, 0xfa, 0x07, 0x73, 0x68, 0xfd, 0x43, 0xed, 0xd0, 0xfa, 0x07, 0x7b, 0x68, 0xfd, 0x83, 0x3d, 0xb4,
-	0xfe, 0x41, 0x1f, 0x5a, 0xff, 0x88, 0x2f, 0xf9, 0x7c, 0x34, 0xef, 0xf7, 0x7c, 0xf4, 0x5f, 0xed, 0xf9, 0xe8, 0xbd,
-	0xd5, 0xf3, 0xd1, 0xbc, 0xd0, 0xf3, 0xb1, 0xf6, 0x2e, 0xcf, 0x47, 0xfb, 0x1a, 0xcf, 0x47, 0xf3, 0x06, 0xcf, 0x47,
-	0xf3, 0xf2, 0xce, 0xc7, 0x68, 0x59, 0xf8, 0x60, 0x3a, 0x7b, 0xee, 0x77, 0xf6, 0xdc, 0xeb, 0xec, 0xb9, 0xe9, 0xec,
-	0x79, 0xad, 0xb3, 0xe7, 0xb6, 0xb3, 0xe7, 0xfa, 0x49, 0xef, 0x47, 0xb6, 0xac, 0x00, 0xf1, 0x95, 0x99, 0x25, 0x7f,
-	0x58, 0xe3, 0x87, 0x4d, 0xf1, 0x81, 0x1d, 0x44, 0x10, 0xf0, 0x04, 0x06, 0x53, 0x23, 0x9c, 0x2c, 0x42, 0xb4, 0x11,
-	0x08, 0x76, 0x2d, 0x41, 0x9c, 0x63, 0x0e, 0x62, 0xb4, 0x4d, 0x08, 0xae, 0x18, 0x86, 0x58, 0x63, 0x1d, 0xc2, 0xf5,
-	0x7c, 0x12, 0xac, 0x27, 0x35, 0xc1, 0xe7, 0x16, 0xf1, 0x47, 0xe6, 0xcf, 0x31, 0x71, 0xd5, 0x91, 0x99, 0xd9, 0x26,
-	0xf8, 0xe4, 0xc8, 0xec, 0xbc, 0x13, 0x6e, 0x26, 0x9f, 0x70, 0xe5, 0x01, 0xb9, 0x7a, 0xa8, 0x66, 0x71, 0x6d, 0x90,
-	0x8d, 0x45, 0xb4, 0x57, 0x98, 0x5a, 0x61, 0x66, 0x92, 0x72, 0xa3, 0x6b, 0x10, 0xa2, 0x0d, 0x48, 0xb0, 0x6b, 0x40,
-	0xe2, 0x1c, 0x03, 0x12, 0xa3, 0x0d, 0x48, 0x70, 0xc5, 0x80, 0xc4, 0x1a, 0x03, 0x12, 0xae, 0x5d, 0x83, 0x60, 0xed,
-	0x1a, 0x09, 0x3e, 0xb7, 0x88, 0x3f, 0x32, 0xdf, 0x35, 0x88, 0xab, 0x8e, 0xcc, 0xb8, 0x06, 0xc1, 0x27, 0x47, 0x66,
-	0x5d, 0x83, 0x70, 0xe3, 0x1a, 0x84, 0x2b, 0xd7, 0xc8, 0xef, 0x8e, 0xa8, 0x59, 0x5c, 0x1b, 0x64, 0x63, 0x11, 0xed,
-	0x1a, 0xe6, 0xdd, 0x11, 0x61, 0xca, 0x03, 0x6a, 0xf2, 0xf5, 0xce, 0x01, 0x35, 0x9f, 0xf4, 0x4d, 0xea, 0x1f, 0x50,
-	0xf3, 0x79, 0x63, 0xde, 0xfa, 0x01, 0x35, 0xbf, 0x8d, 0x35, 0xb5, 0x73, 0x40, 0xcd, 0x27, 0x8d, 0x43, 0x01, 0x79,
-	0x5e, 0xc3, 0x4f, 0xd9, 0xa3, 0xe2, 0x62, 0xd8, 0xe2, 0x4f, 0xec, 0x61, 0xdd, 0x0d, 0xc9, 0xbf, 0x60, 0x0f, 0xc7,
-	0xf5, 0x90, 0xb5, 0x0e, 0x88, 0xac, 0x76, 0xc3, 0xf2, 0xec, 0x87, 0xeb, 0x37, 0xeb, 0x0a, 0xbe, 0xa9, 0xe1, 0xc6,
-	0x3d, 0xfd, 0xb3, 0x1f, 0xcc, 0x9f, 0x0d, 0x1b, 0xb8, 0x51, 0xfe, 0xa0, 0x76, 0x15, 0x67, 0xb2, 0x6d, 0x13, 0xc4,
-	0x3b, 0x36, 0x79, 0x56, 0x6c, 0xd6, 0x04, 0x54, 0x07, 0x24, 0xcf, 0x60, 0x8b, 0x26, 0x90, 0x7e, 0x17, 0xf6, 0x2c,
-	0x6f, 0xcc, 0x04, 0x50, 0xa7, 0x1d, 0xcf, 0x62, 0x44, 0xc9, 0x20, 0xde, 0xab, 0x61, 0x9f, 0x95, 0xb1, 0x03, 0xb0,
-	0x67, 0x02, 0x8e, 0x12, 0x40, 0xd4, 0x3a, 0x4f, 0x88, 0xbc, 0xce, 0x13, 0x88, 0x5f, 0xc3, 0x10, 0x84, 0xdf, 0xc2,
-	0xc8, 0x48, 0xd8, 0x0d, 0xac, 0xda, 0xfc, 0x81, 0x77, 0x60, 0x82, 0xf0, 0x0e, 0x4c, 0x90, 0x62, 0x07, 0x26, 0x30,
-	0xec, 0xc0, 0x04, 0xe4, 0x1d, 0x98, 0x20, 0x79, 0x07, 0x26, 0x50, 0xde, 0x81, 0x09, 0x44, 0x3b, 0x30, 0x01, 0x78,
-	0x07, 0x96, 0x91, 0xab, 0xfe, 0x0e, 0xb7, 0xd3, 0x67, 0xbc, 0xb5, 0x59, 0x4c, 0x19, 0x28, 0x9a, 0x77, 0x66, 0x64,
-	0xbc, 0xb3, 0x41, 0x04, 0xdd, 0x47, 0x60, 0x70, 0x1f, 0x00, 0x65, 0x67, 0x03, 0x77, 0x60, 0xa7, 0x12, 0x24, 0x3b,
-	0x95, 0x40, 0x76, 0xbc, 0x5f, 0x5e, 0xbe, 0x7e, 0xe9, 0x1e, 0xb0, 0xf3, 0x3b, 0x1c, 0x1a, 0xbf, 0x54, 0x04, 0x88,
-	0x2e, 0x1b, 0x9c, 0xc5, 0xdd, 0x91, 0xdc, 0xb0, 0x37, 0xc3, 0xed, 0xfd, 0x69, 0xeb, 0xbd, 0x69, 0xeb, 0xcd, 0xb4,
-	0xa9, 0xdd, 0x11, 0x10, 0x76, 0x3e, 0x79, 0x77, 0x04, 0x88, 0x99, 0x3d, 0xde, 0x1d, 0xc9, 0x80, 0xf7, 0x38, 0x16,
-	0xfd, 0xe6, 0xcf, 0x99, 0x79, 0xf3, 0xe7, 0xac, 0xf2, 0xe6, 0xcf, 0x59, 0x73, 0xe8, 0xee, 0x77, 0xe4, 0x1c, 0xf3,
-	0x0c, 0x1e, 0xb1, 0xc5, 0xd1, 0xdc, 0xfd, 0xe8, 0x95, 0x7a, 0xce, 0xf0, 0xd8, 0x28, 0x80, 0xaa, 0xc0, 0x73, 0xa6,
-	0x0f, 0x88, 0x02, 0xa1, 0x8b, 0x3e, 0x67, 0x72, 0x14, 0x14, 0xa0, 0xb2, 0xd4, 0x73, 0x16, 0x5f, 0xf2, 0x16, 0xbb,
-	0xbc, 0x14, 0x1f, 0xa8, 0xe7, 0x80, 0xc0, 0x99, 0x2d, 0x06, 0xf3, 0x89, 0xa0, 0x2c, 0x49, 0xe5, 0x89, 0x20, 0x0d,
-	0x6b, 0x1d, 0x75, 0x4e, 0x04, 0x69, 0xce, 0x51, 0xd4, 0xf2, 0x44, 0x90, 0x86, 0x8d, 0xb6, 0xaa, 0x13, 0x41, 0x1a,
-	0x57, 0x2a, 0x5b, 0x9e, 0x08, 0x52, 0x30, 0xea, 0x6d, 0xb9, 0xc4, 0xd5, 0xb0, 0xab, 0xbc, 0x66, 0x89, 0xab, 0x19,
-	0xad, 0xc1, 0xee, 0x12, 0x57, 0xb3, 0x46, 0x8d, 0xcb, 0x25, 0xae, 0x86, 0xb5, 0x2e, 0x27, 0x18, 0xc5, 0x99, 0x10,
-	0x1d, 0xd8, 0x04, 0x6b, 0x99, 0x26, 0xd8, 0x0d, 0x7a, 0xe2, 0x9c, 0xc8, 0x27, 0x46, 0x87, 0x3f, 0xc1, 0x26, 0xd4,
-	0x09, 0x37, 0x7a, 0x46, 0xb8, 0x12, 0x71, 0x42, 0xb5, 0x16, 0x24, 0x58, 0xcb, 0x39, 0xa3, 0xa5, 0xa6, 0x27, 0xd4,
-	0x5e, 0x6d, 0xd4, 0x9d, 0x60, 0x2d, 0xf1, 0x0c, 0x7b, 0x3a, 0x4f, 0x9c, 0x23, 0xf6, 0xcc, 0x38, 0x8a, 0x4f, 0x94,
-	0x96, 0x7d, 0x82, 0x8d, 0xf6, 0x13, 0x5e, 0x31, 0x98, 0xc9, 0x02, 0x09, 0xde, 0x19, 0xb3, 0x98, 0x7c, 0x40, 0xb0,
-	0xd1, 0x96, 0x84, 0xf7, 0xe6, 0x9b, 0x4c, 0x7a, 0x20, 0xf8, 0x84, 0xbb, 0x78, 0x89, 0x82, 0x18, 0xdf, 0x5d, 0x6a,
-	0x29, 0x83, 0xd8, 0x8a, 0x33, 0x99, 0xe4, 0x41, 0xb0, 0xef, 0x35, 0x26, 0x8d, 0x24, 0x78, 0x6f, 0x4c, 0x60, 0x12,
-	0x0a, 0xc1, 0x3a, 0xab, 0x30, 0xec, 0xa6, 0x96, 0x44, 0x7a, 0xf9, 0x25, 0x31, 0x47, 0xd3, 0xd6, 0x64, 0x1a, 0x82,
-	0xdd, 0x74, 0x43, 0x9c, 0x93, 0x73, 0x88, 0xd1, 0x89, 0x87, 0xe0, 0x4a, 0xf6, 0x21, 0xd6, 0xa4, 0x20, 0xc2, 0x2b,
-	0xbe, 0xa2, 0x93, 0x51, 0x42, 0x9f, 0x8d, 0x89, 0x5f, 0x2c, 0xa2, 0x73, 0x13, 0xc1, 0x5e, 0x82, 0x2a, 0x0f, 0x72,
-	0x8a, 0x9c, 0x3b, 0x07, 0x39, 0x7d, 0xd2, 0xa4, 0xac, 0xda, 0x41, 0x4e, 0xbf, 0x85, 0x97, 0xbe, 0x9c, 0x83, 0x9c,
-	0x3e, 0x69, 0x53, 0x99, 0x77, 0x90, 0xd3, 0x67, 0x75, 0x5a, 0x73, 0x0e, 0x72, 0xba, 0x64, 0x91, 0xe2, 0x9c, 0x4d,
-	0xba, 0x4f, 0xfa, 0xe9, 0xce, 0xdf, 0xa4, 0xfb, 0xbc, 0x49, 0x7d, 0xf5, 0x4d, 0xba, 0xdf, 0xc6, 0xa6, 0x41, 0x67,
-	0x93, 0xee, 0x93, 0x26, 0x25, 0x02, 0x59, 0x24, 0x46, 0xc4, 0x8d, 0xb0, 0x21, 0x69, 0x92, 0x24, 0x92, 0xbe, 0xf6,
-	0x61, 0x0b, 0x4f, 0x01, 0x91, 0x37, 0x3a, 0x88, 0xa4, 0xd5, 0x3b, 0x64, 0x6d, 0x46, 0x40, 0x56, 0x27, 0x52, 0xe4,
-	0x8c, 0x30, 0x02, 0x69, 0x92, 0x6a, 0xc1, 0xa9, 0xd4, 0x5a, 0xbe, 0xa3, 0xe7, 0xde, 0xcf, 0xa6, 0x59, 0xe7, 0x1d,
-	0xbd, 0x0a, 0xe9, 0xa6, 0x5c, 0xff, 0x1d, 0xbd, 0x0a, 0xef, 0xa5, 0x5f, 0xe7, 0x1d, 0x3d, 0xff, 0x6a, 0x9b, 0x8a,
-	0xbd, 0x77, 0xf4, 0xdc, 0x1b, 0xdb, 0xb4, 0x0c, 0xe4, 0xae, 0x62, 0x5e, 0x9b, 0xa2, 0x91, 0xb4, 0xe2, 0x8b, 0x2f,
-	0xc8, 0x55, 0xfa, 0x61, 0x93, 0x36, 0x92, 0x7f, 0xea, 0xbe, 0x6e, 0x02, 0x47, 0xfe, 0x94, 0xfb, 0x56, 0x93, 0x39,
-	0xb6, 0x39, 0xe9, 0xe2, 0x36, 0xb1, 0x23, 0x79, 0xca, 0x8b, 0x6d, 0x92, 0x07, 0x72, 0x5f, 0x31, 0xa2, 0x4d, 0xf8,
-	0x48, 0x9a, 0xb4, 0x5f, 0x90, 0x7e, 0xf2, 0x07, 0xd4, 0x5d, 0x02, 0xe0, 0x1b, 0x7d, 0x95, 0xeb, 0xec, 0x72, 0x00,
-	0x49, 0x7f, 0x51, 0x80, 0x2d, 0xbc, 0xa5, 0x01, 0xf2, 0x66, 0x81, 0x80, 0x64, 0x6d, 0x99, 0x80, 0x6d, 0xec, 0x62,
-	0x01, 0xd9, 0x93, 0x5e, 0x6b, 0x16, 0x0e, 0xc0, 0x3d, 0x57, 0x26, 0xef, 0xa5, 0x86, 0x9b, 0xa5, 0x44, 0xe5, 0x85,
-	0x2d, 0xe2, 0xcf, 0xf1, 0xe7, 0x3e, 0xce, 0xcd, 0xcf, 0x7d, 0x9c, 0x9b, 0x9f, 0xfb, 0x38, 0x6f, 0xdc, 0x9f, 0xfb,
-	0x38, 0xf7, 0x7e, 0xee, 0xe3, 0xdc, 0xfc, 0xdc, 0xc7, 0xb9, 0xfd, 0xb9, 0x8f, 0x73, 0xfb, 0x73, 0x1f, 0xe7, 0xfa,
-	0xe7, 0x3e, 0xce, 0xcd, 0xcf, 0x7d, 0x9c, 0xeb, 0x9f, 0xcd, 0x38, 0x37, 0x3f, 0xef, 0x70, 0x9e, 0x8f, 0xe6, 0xe7,
-	0x8b, 0xca, 0xa3, 0xf9, 0x1a, 0xd6, 0x23, 0x75, 0x8e, 0xe6, 0x6b, 0xce, 0x19, 0x73, 0x79, 0x34, 0x5f, 0xc3, 0x66,
-	0xf4, 0xea, 0x68, 0xbe, 0xc6, 0x95, 0x1d, 0xca, 0xa3, 0xf9, 0x0a, 0xd6, 0x16, 0x49, 0xa8, 0x31, 0x4b, 0x79, 0x10,
-	0x3e, 0xdf, 0xc3, 0x39, 0x08, 0xef, 0x72, 0xda, 0x4a, 0xb5, 0x83, 0xf0, 0x6e, 0x03, 0xc7, 0x5e, 0xce, 0x41, 0x78,
-	0x97, 0x33, 0x96, 0xf3, 0x0e, 0xc2, 0xbb, 0xa4, 0xb2, 0xa1, 0x73, 0x10, 0xde, 0xe3, 0xb4, 0x35, 0x81, 0x32, 0x26,
-	0xc5, 0x33, 0xe5, 0xf9, 0x5e, 0xe6, 0x4c, 0xb9, 0xc3, 0x68, 0x63, 0xfa, 0x67, 0xca, 0x1d, 0xda, 0x31, 0xa4, 0x39,
-	0x53, 0xee, 0x30, 0xc6, 0x88, 0xf6, 0x4c, 0xb9, 0x43, 0x29, 0x03, 0x9a, 0x33, 0xe5, 0x96, 0xd1, 0xc6, 0xcb, 0x84,
-	0x31, 0x5d, 0x3e, 0xac, 0x9d, 0x6f, 0x52, 0x1e, 0xd6, 0xd6, 0xb0, 0xb6, 0x98, 0x73, 0x58, 0x5b, 0x73, 0x8e, 0xad,
-	0xca, 0xc3, 0xda, 0x1a, 0x36, 0x56, 0x52, 0x87, 0xb5, 0x35, 0xae, 0xec, 0x53, 0x1e, 0xd6, 0x56, 0xb0, 0xb6, 0x4c,
-	0x42, 0x8d, 0x59, 0xf4, 0xd1, 0xe8, 0x7c, 0x17, 0xf7, 0x68, 0x74, 0x85, 0xd5, 0xb6, 0xaa, 0x1f, 0x8d, 0xae, 0x34,
-	0x71, 0x2c, 0xe7, 0x1e, 0x8d, 0xae, 0xb0, 0xc6, 0x8e, 0xfe, 0xd1, 0xe8, 0x0a, 0xad, 0xac, 0xea, 0x1e, 0x8d, 0xf6,
-	0x59, 0x6d, 0xe3, 0x82, 0x34, 0xa6, 0x96, 0x73, 0xc5, 0xf9, 0x6e, 0xea, 0x5c, 0xb1, 0xc1, 0xb5, 0x61, 0xbd, 0x73,
-	0xc5, 0x86, 0x74, 0x8c, 0xa9, 0xce, 0x15, 0x1b, 0xdc, 0x18, 0x50, 0x9f, 0x2b, 0x36, 0x84, 0x32, 0x9a, 0x3a, 0x57,
-	0xac, 0x71, 0x6d, 0x28, 0x82, 0x8d, 0x89, 0xe8, 0xeb, 0xd0, 0x44, 0x0c, 0x69, 0x13, 0x31, 0xae, 0x4d, 0xc4, 0xb8,
-	0x6b, 0x22, 0x26, 0x1d, 0x13, 0x31, 0xa5, 0x4d, 0xc4, 0xb8, 0x31, 0x11, 0x13, 0xc6, 0x44, 0x4c, 0x28, 0x13, 0x31,
-	0xac, 0x4d, 0x44, 0xb8, 0x36, 0x11, 0xc1, 0xc6, 0x44, 0xc3, 0x5d, 0xd1, 0x40, 0x09, 0xd0, 0xe6, 0x49, 0xa8, 0x36,
-	0x4e, 0x42, 0x5d, 0xd3, 0x24, 0xca, 0x31, 0x4c, 0x22, 0xb4, 0x59, 0x12, 0x6a, 0x8c, 0x92, 0x60, 0x63, 0x92, 0x04,
-	0x2b, 0x83, 0x24, 0x50, 0x9b, 0x63, 0x40, 0xb5, 0x31, 0x06, 0x50, 0x9b, 0xe2, 0x22, 0x9a, 0x61, 0x3e, 0xca, 0x1f,
-	0xc8, 0x04, 0x80, 0xd0, 0xf0, 0x01, 0xc1, 0xa1, 0x03, 0x2c, 0xc3, 0x06, 0x90, 0x86, 0x0c, 0x08, 0x0f, 0x17, 0x20,
-	0x1e, 0x2a, 0x40, 0x69, 0x98, 0x00, 0xd0, 0x10, 0x05, 0x79, 0x2f, 0x6f, 0xef, 0x5f, 0xe4, 0xfa, 0x10, 0x20, 0xc5,
-	0xaf, 0xe5, 0x08, 0x6c, 0xdf, 0xfd, 0xbf, 0xc8, 0xe5, 0x1f, 0x40, 0xd4, 0xcf, 0x81, 0x09, 0x91, 0x7f, 0x04, 0x47,
-	0x20, 0xda, 0xf1, 0x01, 0xc2, 0x3f, 0x1b, 0x97, 0x91, 0x78, 0x16, 0x75, 0x3c, 0xce, 0x9f, 0xb8, 0x9a, 0x05, 0x50,
-	0xfe, 0xc9, 0x4d, 0x81, 0xca, 0x9f, 0xdc, 0x14, 0x1c, 0x8a, 0x59, 0x80, 0xe6, 0x9f, 0xdc, 0x14, 0x48, 0x7e, 0x72,
-	0x53, 0x30, 0xf9, 0xc9, 0x4d, 0xc1, 0xf8, 0x27, 0x37, 0x05, 0xc9, 0x3f, 0xb9, 0x99, 0x21, 0xb5, 0x0f, 0xbc, 0xc8,
-	0x47, 0x6c, 0xdb, 0x15, 0x23, 0xe5, 0x05, 0x9d, 0x1d, 0x24, 0x97, 0x4e, 0x0a, 0xc8, 0x1f, 0x24, 0xfe, 0x9e, 0x25,
-	0x80, 0x52, 0x1b, 0xc1, 0xb6, 0xfc, 0x83, 0x96, 0x82, 0xe4, 0x1f, 0xb4, 0x14, 0xc8, 0x19, 0x38, 0x57, 0x3c, 0x66,
-	0x79, 0x50, 0x3b, 0xd9, 0x8c, 0x5d, 0xe4, 0xda, 0x06, 0x20, 0x85, 0x53, 0x09, 0x6c, 0xb7, 0x6a, 0x17, 0xf9, 0x37,
-	0x2e, 0x01, 0xc9, 0xbe, 0x23, 0x50, 0xfe, 0x99, 0xcd, 0x0c, 0xf5, 0x45, 0x17, 0x7b, 0x6b, 0xc5, 0xbe, 0x62, 0xb2,
-	0xde, 0xf5, 0x8b, 0xde, 0xfa, 0x85, 0xfe, 0x8d, 0x4b, 0x60, 0x1c, 0x8f, 0xc9, 0xbf, 0x71, 0x09, 0x90, 0x75, 0x8f,
-	0x7c, 0x0c, 0x58, 0xdc, 0x01, 0xaa, 0x07, 0x32, 0xba, 0x63, 0xf1, 0xc1, 0x18, 0xb8, 0x28, 0x0e, 0x00, 0x0c, 0xde,
-	0x20, 0x20, 0x4f, 0xbb, 0x20, 0xe5, 0xc0, 0x80, 0xc8, 0xfe, 0x20, 0x90, 0xb5, 0x3c, 0x6d, 0xed, 0x19, 0x58, 0xa3,
-	0x34, 0xae, 0x8d, 0x34, 0xae, 0x8d, 0x34, 0xae, 0x7d, 0x69, 0x5c, 0x7b, 0xd2, 0xb8, 0x36, 0xd2, 0xb8, 0xb6, 0xd2,
-	0xb8, 0xb6, 0xd2, 0xb8, 0xd6, 0xd2, 0xb8, 0x36, 0xd2, 0xb8, 0x8e, 0xd2, 0xc8, 0xfa, 0xbe, 0xce, 0xd2, 0x08, 0x88,
-	0xf7, 0x43, 0x8f, 0x6b, 0x94, 0x46, 0x00, 0xd5, 0x0f, 0x3d, 0xae, 0xb5, 0x34, 0x02, 0xa1, 0x7f, 0xe8, 0x71, 0x9d,
-	0xa5, 0x11, 0x10, 0xf5, 0x43, 0x8f, 0x6b, 0x2c, 0x71, 0xaf, 0x4d, 0x5d, 0x7b, 0x6d, 0x8a, 0xd9, 0x6b, 0xbf, 0x82,
-	0xbd, 0xf6, 0xca, 0xd6, 0x6b, 0x53, 0xab, 0x5e, 0xdb, 0x02, 0xf5, 0xda, 0x56, 0xa5, 0xd7, 0xba, 0x14, 0xbd, 0x36,
-	0xf5, 0xe7, 0xb5, 0x16, 0xc4, 0x35, 0x0b, 0xa2, 0xb4, 0x28, 0x9a, 0xeb, 0x9a, 0xf2, 0xda, 0x14, 0x92, 0xd7, 0xa5,
-	0x18, 0x02, 0x6c, 0x4b, 0xc6, 0x6b, 0xb7, 0x4e, 0xbc, 0x36, 0xc5, 0xe1, 0xb5, 0xad, 0x08, 0xaf, 0x6d, 0x19, 0x78,
-	0x9d, 0x95, 0x90, 0x7f, 0x52, 0x67, 0x8d, 0x05, 0xdf, 0xb5, 0xa9, 0xf2, 0xae, 0x6d, 0x69, 0x77, 0x8d, 0xf5, 0xdc,
-	0xb5, 0x29, 0xe2, 0xae, 0xfd, 0xca, 0xed, 0xda, 0x2b, 0xd7, 0xae, 0x4d, 0x8d, 0x76, 0x5d, 0x2b, 0xcc, 0xae, 0x6d,
-	0x35, 0x76, 0x6d, 0x4a, 0xb0, 0x6b, 0x53, 0x77, 0x5d, 0x67, 0xbd, 0x12, 0xc4, 0x29, 0x76, 0xae, 0xb1, 0xc2, 0xb9,
-	0x36, 0x65, 0xcd, 0xb5, 0x5f, 0xcb, 0x5c, 0x7b, 0x05, 0xcc, 0xb5, 0xa9, 0x5a, 0xae, 0x6b, 0xa5, 0xca, 0xb5, 0xad,
-	0x4f, 0xae, 0x6d, 0x51, 0x72, 0xad, 0x2b, 0x91, 0xeb, 0xa1, 0xcc, 0x98, 0x35, 0x20, 0xd7, 0x16, 0x05, 0x01, 0x11,
-	0x25, 0x70, 0x83, 0x8f, 0x25, 0x37, 0xe6, 0x59, 0xe4, 0xc6, 0x3c, 0x80, 0xdc, 0xf8, 0x4f, 0x1d, 0x37, 0xde, 0xa3,
-	0xc6, 0x8d, 0x79, 0xbe, 0xb8, 0xb1, 0x0f, 0x15, 0x37, 0xf6, 0x49, 0xe2, 0x46, 0x3f, 0x3e, 0xdc, 0x98, 0x67, 0x86,
-	0x9b, 0xe1, 0x41, 0xe1, 0x2c, 0x7f, 0xe0, 0x24, 0x29, 0x48, 0x91, 0x23, 0x05, 0x86, 0x14, 0x29, 0x20, 0x67, 0x48,
-	0x41, 0x54, 0x82, 0x14, 0x22, 0xe7, 0x47, 0x81, 0x38, 0x3d, 0x0a, 0xc2, 0xd9, 0x31, 0x23, 0xa0, 0x0a, 0x1b, 0x23,
-	0x71, 0x1b, 0x23, 0x71, 0x1b, 0x5f, 0xe2, 0x36, 0x9e, 0xc4, 0x6d, 0x8c, 0xc4, 0x6d, 0xac, 0xc4, 0x6d, 0xac, 0xc4,
-	0x6d, 0xb4, 0xc4, 0x6d, 0x8c, 0xc4, 0x6d, 0xb4, 0xc4, 0x6d, 0xb4, 0xc4, 0x6d, 0x9a, 0xa2, 0xb9, 0x96, 0xb8, 0x8d,
-	0x91, 0xb8, 0x8d, 0x2f, 0x71, 0x1b, 0x4f, 0xe2, 0x36, 0xae, 0xc4, 0x6d, 0x8c, 0xc4, 0x6d, 0xac, 0xc4, 0x6d, 0xac,
-	0xc4, 0x6d, 0xcc, 0xe3, 0xad, 0x0d, 0x2e, 0xf6, 0x36, 0x66, 0xb1, 0xb7, 0xf1, 0x17, 0x7b, 0x1b, 0x6f, 0xb1, 0xb7,
-	0x31, 0x8b, 0xbd, 0x8d, 0x5d, 0xec, 0x6d, 0xec, 0x62, 0x6f, 0x83, 0x9a, 0xb9, 0x31, 0x9a, 0xb9, 0xf1, 0x35, 0x73,
-	0xe3, 0x69, 0xe6, 0xc6, 0x68, 0xe6, 0xa6, 0xa6, 0x99, 0x1b, 0xab, 0x99, 0x1b, 0xa3, 0x99, 0x1b, 0xa3, 0x99, 0x1b,
-	0xa3, 0x99, 0x1b, 0x4f, 0x33, 0x37, 0x51, 0x33, 0xa5, 0xc5, 0xd1, 0x8c, 0xe9, 0xe8, 0x8f, 0xe9, 0xe8, 0x8d, 0xe9,
-	0x68, 0xc6, 0x74, 0xac, 0x8d, 0xe9, 0x68, 0xc7, 0x74, 0xb4, 0x4e, 0x70, 0x54, 0x4e, 0x9f, 0x9f, 0x3a, 0x64, 0x65,
-	0x29, 0x9f, 0x3a, 0x68, 0x58, 0xcb, 0xa1, 0xf3, 0xd4, 0x41, 0x73, 0x8e, 0x30, 0x96, 0x4f, 0x1d, 0x34, 0x6c, 0x24,
-	0x52, 0x3d, 0x75, 0xd0, 0xb8, 0x12, 0xcb, 0xf2, 0xa9, 0x83, 0x82, 0x51, 0x36, 0xcb, 0x17, 0xa8, 0x34, 0xec, 0x0a,
-	0xa8, 0x79, 0x81, 0x4a, 0x33, 0x5a, 0x4a, 0xdd, 0x17, 0xa8, 0x34, 0x6b, 0x44, 0xb5, 0x7c, 0x81, 0x4a, 0xc3, 0x5a,
-	0x5e, 0x13, 0xbc, 0x35, 0xb3, 0x6a, 0x84, 0x96, 0x60, 0xad, 0xb6, 0x04, 0xbb, 0x6e, 0x49, 0x9c, 0xe3, 0x9b, 0xc4,
-	0x68, 0x07, 0x25, 0xd8, 0x38, 0x23, 0xe1, 0xc6, 0x23, 0x09, 0x77, 0xdd, 0xd2, 0x08, 0x32, 0x3f, 0x39, 0x2a, 0x03,
-	0xae, 0x78, 0x9e, 0xa4, 0xda, 0xda, 0xab, 0x8d, 0x48, 0x13, 0xac, 0x95, 0x9a, 0xe1, 0xba, 0x55, 0x3c, 0xcd, 0x66,
-	0xc6, 0x11, 0x6e, 0xa2, 0xb4, 0x7a, 0x13, 0x6c, 0x24, 0x9c, 0xf0, 0x8a, 0xc1, 0x8c, 0x98, 0x27, 0x78, 0x67, 0x11,
-	0x2d, 0xeb, 0x04, 0xbb, 0xda, 0x4e, 0x9c, 0x23, 0xf0, 0xc4, 0x68, 0x95, 0x27, 0xd8, 0x48, 0x3d, 0xe1, 0x46, 0xef,
-	0x13, 0xde, 0x9b, 0xe1, 0x18, 0xe5, 0x27, 0xf8, 0x84, 0xf5, 0xbd, 0x1c, 0x40, 0x8c, 0xef, 0x93, 0xb5, 0x6c, 0x40,
-	0x6c, 0xc5, 0x63, 0x4d, 0x5e, 0x20, 0xd8, 0x77, 0x4d, 0x93, 0x21, 0x12, 0xec, 0xa5, 0x89, 0xc4, 0x1c, 0x4d, 0x5b,
-	0x93, 0x30, 0x08, 0x3e, 0x61, 0x0a, 0x2f, 0x75, 0x10, 0xe3, 0x9b, 0xa2, 0x96, 0x44, 0x88, 0xad, 0x98, 0xc2, 0xa6,
-	0x13, 0xc2, 0x55, 0xf0, 0x16, 0xbf, 0x59, 0x35, 0x32, 0xa0, 0xce, 0x2c, 0xf6, 0x37, 0xab, 0x2c, 0xe3, 0xe6, 0x17,
-	0xf7, 0x37, 0xab, 0x2c, 0xa9, 0xb3, 0x8c, 0xf3, 0x9b, 0x55, 0x96, 0x32, 0xb9, 0xc6, 0xfc, 0x66, 0x95, 0x25, 0x74,
-	0xc6, 0xc9, 0x0c, 0x26, 0x1d, 0x01, 0x75, 0xde, 0x11, 0xc6, 0x4d, 0x3d, 0x42, 0x3b, 0xd9, 0x47, 0x48, 0x9d, 0x80,
-	0x84, 0xa9, 0xe4, 0x20, 0x69, 0x60, 0xd2, 0x90, 0x50, 0x3a, 0x13, 0x09, 0xa3, 0x93, 0x51, 0x66, 0xb6, 0x9e, 0x47,
-	0x98, 0x94, 0x24, 0x8c, 0xce, 0x4a, 0xc2, 0xb8, 0x9e, 0x2f, 0xb4, 0xe3, 0xfc, 0x42, 0x6a, 0xff, 0x17, 0xc6, 0x38,
-	0xb9, 0x50, 0xc6, 0xcf, 0x85, 0xaa, 0xb9, 0xba, 0x49, 0x55, 0xf0, 0x70, 0xb9, 0x8c, 0x7b, 0xfd, 0xd4, 0xd9, 0x5e,
-	0xe1, 0xde, 0xc6, 0xa4, 0x2d, 0x61, 0x74, 0xe6, 0x02, 0xe6, 0xa4, 0xe5, 0xbc, 0xfc, 0x05, 0xa4, 0x93, 0xc2, 0x84,
-	0xd5, 0x59, 0x4c, 0x18, 0x93, 0xc8, 0x84, 0xaa, 0xdb, 0xd5, 0xa4, 0xb3, 0xcc, 0xec, 0x5c, 0x50, 0x27, 0x35, 0x61,
-	0xdc, 0xbc, 0x26, 0xb4, 0x93, 0xda, 0x84, 0xd4, 0xd9, 0x4d, 0x18, 0x93, 0xe0, 0x84, 0x32, 0x39, 0x2e, 0x53, 0xbd,
-	0x37, 0x52, 0x93, 0xe9, 0x84, 0x39, 0x3d, 0x5b, 0x5e, 0xbe, 0x13, 0xb2, 0xea, 0xe7, 0xb5, 0xac, 0x27, 0x0d, 0xea,
-	0x81, 0x60, 0x72, 0x9f, 0x30, 0x55, 0x77, 0x37, 0x19, 0x30, 0x33, 0x5e, 0x12, 0xcc, 0xe4, 0xd1, 0xbb, 0xc2, 0xa4,
-	0x42, 0x61, 0x4e, 0xdb, 0xca, 0x4b, 0x88, 0x42, 0x56, 0x6d, 0x55, 0x4b, 0x8b, 0xd2, 0xa0, 0x6e, 0x2b, 0x9b, 0x1c,
-	0x85, 0x2a, 0x45, 0x63, 0xdb, 0xc0, 0xef, 0x6f, 0x84, 0x0f, 0xfc, 0xe0, 0x4b, 0x90, 0xe2, 0x60, 0x62, 0xc6, 0x93,
-	0x31, 0x6e, 0x2c, 0xa2, 0x6f, 0x40, 0xb0, 0x7f, 0x97, 0xd4, 0xf8, 0xc6, 0x22, 0xfa, 0x2e, 0x04, 0xfb, 0x77, 0x01,
-	0xf3, 0xdf, 0x54, 0x60, 0x7d, 0x3f, 0xe4, 0xfc, 0x9b, 0x66, 0x83, 0xdd, 0xb8, 0xa0, 0xbe, 0xa1, 0x30, 0xfe, 0xed,
-	0xd2, 0x34, 0xdf, 0x58, 0x44, 0xdf, 0x88, 0x60, 0xff, 0x2e, 0x34, 0xe3, 0x37, 0x0e, 0xa4, 0xef, 0xc3, 0xb8, 0x7f,
-	0x23, 0xf2, 0x8f, 0x1b, 0x07, 0xd2, 0x37, 0x62, 0xdc, 0xbf, 0xd1, 0xe0, 0x4d, 0x37, 0x06, 0xd0, 0x37, 0x49, 0xa8,
-	0x7f, 0x8b, 0x14, 0xbd, 0x37, 0x16, 0xd1, 0x37, 0x21, 0xd8, 0xbd, 0xcb, 0x65, 0x8e, 0xf5, 0x69, 0x46, 0xe0, 0x4f,
-	0xf4, 0x5e, 0x9a, 0xbf, 0xce, 0x7b, 0xe9, 0xff, 0x61, 0xde, 0x4b, 0xef, 0x6f, 0xf2, 0x5e, 0x9a, 0x3f, 0xc7, 0x7b,
-	0x59, 0xfb, 0x4b, 0xbc, 0x97, 0xf6, 0x8f, 0xf0, 0x5e, 0xda, 0xbf, 0xbf, 0x7b, 0xa9, 0xff, 0xf4, 0xee, 0x55, 0x03,
-	0x0b, 0x9a, 0xab, 0xe6, 0x16, 0x99, 0xdb, 0x62, 0xc0, 0x19, 0xa7, 0xad, 0x17, 0x5c, 0x96, 0x90, 0x5b, 0xd3, 0xa6,
-	0x72, 0x03, 0x7a, 0xfd, 0x0b, 0x6e, 0x90, 0x90, 0x5b, 0xd3, 0xa6, 0x76, 0x03, 0xfa, 0x7b, 0xdf, 0xc5, 0x2d, 0x08,
-	0xbb, 0x75, 0xda, 0x55, 0x6e, 0x33, 0xac, 0x3c, 0x86, 0xbf, 0x24, 0x70, 0x7d, 0x79, 0x47, 0x7f, 0x4c, 0x60, 0x3c,
-	0xb5, 0xac, 0xa6, 0xf2, 0x2e, 0x7b, 0x9c, 0x01, 0x38, 0x8b, 0x21, 0xfe, 0x03, 0x48, 0xd1, 0x01, 0xc1, 0xf3, 0xe3,
-	0xd2, 0x19, 0x23, 0x4f, 0xf8, 0xe1, 0x19, 0x3f, 0x80, 0xaf, 0x14, 0x7f, 0x42, 0xc3, 0xfe, 0xf5, 0x0c, 0xf7, 0x0f,
-	0x67, 0x74, 0x45, 0x7d, 0x60, 0x5c, 0xa2, 0xd8, 0xfd, 0x52, 0x4e, 0x35, 0xec, 0x0f, 0xa4, 0xdc, 0xf6, 0xe5, 0x3e,
-	0x27, 0xf8, 0xc9, 0x20, 0xcf, 0x06, 0xc1, 0xc1, 0x25, 0xe4, 0xc5, 0x74, 0xdd, 0x0c, 0x93, 0x60, 0x67, 0xac, 0xc5,
-	0xeb, 0x94, 0xe3, 0x12, 0xc5, 0xb1, 0x12, 0xa2, 0xc7, 0x4a, 0xb0, 0x3f, 0xd6, 0xf2, 0x55, 0xbc, 0x3c, 0x8e, 0x04,
-	0x3f, 0x19, 0xe4, 0xd9, 0x20, 0x38, 0xd6, 0xfc, 0x76, 0x99, 0xea, 0xba, 0x19, 0xab, 0x7d, 0xbb, 0x2c, 0x33, 0xe6,
-	0xf8, 0xeb, 0xd8, 0xa1, 0x8a, 0x51, 0xdb, 0xfc, 0xe4, 0x72, 0x95, 0xf1, 0xdb, 0x33, 0xb5, 0x32, 0x40, 0xe1, 0x9e,
-	0x7c, 0xf8, 0xd9, 0x87, 0x0b, 0x9b, 0x08, 0xfc, 0xe2, 0x8f, 0xd3, 0x5a, 0x07, 0x38, 0xc7, 0x44, 0x7a, 0xb3, 0x31,
-	0x36, 0x04, 0x9a, 0xc7, 0xe4, 0x5a, 0x87, 0xf1, 0x4d, 0x63, 0x96, 0x7f, 0x79, 0xa8, 0x99, 0x79, 0xf2, 0xc0, 0x67,
-	0x0f, 0x44, 0x93, 0x64, 0xf0, 0xc5, 0x1b, 0x95, 0x31, 0x87, 0x30, 0x9e, 0x31, 0xf2, 0x8e, 0xc6, 0x58, 0x23, 0x33,
-	0x85, 0x39, 0x04, 0x35, 0xf6, 0x10, 0xaa, 0x62, 0x90, 0xdc, 0xc0, 0x5a, 0x24, 0x53, 0x4f, 0x2e, 0xfa, 0xec, 0xa2,
-	0x85, 0x51, 0x32, 0xfa, 0xe2, 0x0e, 0xcf, 0x9a, 0x45, 0x28, 0xc7, 0x2e, 0xc5, 0x51, 0xdf, 0x71, 0x89, 0xa2, 0x3d,
-	0xca, 0xe5, 0x93, 0x86, 0x7d, 0x3b, 0x94, 0x07, 0x86, 0xf3, 0xb8, 0x12, 0xfc, 0x64, 0x90, 0x67, 0x83, 0xe0, 0xb8,
-	0x13, 0xf2, 0x62, 0xba, 0x6e, 0xc6, 0x4b, 0xb0, 0x33, 0xd6, 0xf2, 0x28, 0xe9, 0x58, 0xc1, 0x38, 0x5a, 0xb5, 0xca,
-	0x33, 0xb8, 0x3f, 0x5e, 0x75, 0x26, 0x35, 0x0f, 0x86, 0xf0, 0x27, 0x0b, 0x3d, 0x5b, 0x08, 0xc7, 0x4c, 0xd0, 0x8b,
-	0x1d, 0x83, 0x19, 0x35, 0xe3, 0xce, 0xb0, 0xcb, 0xe3, 0xa1, 0x63, 0x05, 0xe3, 0xb0, 0xd5, 0x9a, 0xd4, 0xe0, 0xfe,
-	0xb0, 0xd5, 0x39, 0xd3, 0x3c, 0x20, 0xc2, 0x9f, 0x2c, 0xf4, 0x6c, 0x21, 0x1c, 0x36, 0x41, 0x2f, 0x76, 0x0c, 0x66,
-	0xd8, 0x8c, 0xdb, 0x61, 0x7f, 0xd6, 0x03, 0xfe, 0xdc, 0x84, 0x48, 0xb8, 0xeb, 0x0e, 0x87, 0x9d, 0x9c, 0x16, 0xfa,
-	0x1c, 0xfe, 0x97, 0xdf, 0x3d, 0xfd, 0x1c, 0xeb, 0x0d, 0x6d, 0x66, 0x76, 0x7a, 0x15, 0xf9, 0xd9, 0x0c, 0xf1, 0x33,
-	0xae, 0x94, 0x78, 0x8b, 0x77, 0xa3, 0xbf, 0xf8, 0xa6, 0xe9, 0x8a, 0x0f, 0x5c, 0xfb, 0x13, 0x84, 0x4f, 0x06, 0x02,
-	0xe2, 0xfc, 0x4a, 0xe4, 0x0d, 0x16, 0x6d, 0x10, 0x84, 0x73, 0x81, 0x82, 0xaa, 0xdf, 0x8e, 0xbc, 0x91, 0xe2, 0x0c,
-	0x40, 0xfa, 0x27, 0x22, 0x8b, 0xbd, 0x85, 0xdd, 0x57, 0xd4, 0xf6, 0x14, 0x37, 0xc6, 0x32, 0x74, 0xa5, 0xb6, 0x44,
-	0x42, 0x3b, 0x8b, 0x68, 0x9b, 0x10, 0xac, 0x0d, 0xc3, 0xb0, 0x67, 0x1d, 0xe2, 0x1c, 0x13, 0x31, 0xe3, 0xd8, 0x89,
-	0x28, 0x6d, 0x2c, 0x82, 0x8d, 0xc5, 0x08, 0x37, 0x66, 0x33, 0x1b, 0xeb, 0x1b, 0x7f, 0x63, 0x7d, 0x73, 0x6a, 0x63,
-	0x4d, 0xa4, 0x31, 0xa5, 0xf3, 0x42, 0x6f, 0xbe, 0x44, 0xbd, 0xd0, 0xeb, 0xe3, 0xda, 0xb8, 0xde, 0x0b, 0xbd, 0x15,
-	0xd2, 0x33, 0x74, 0xe5, 0x85, 0xde, 0x0a, 0xef, 0x18, 0xdd, 0x7b, 0xa1, 0xd7, 0x27, 0xcd, 0x04, 0xb8, 0x2f, 0xf4,
-	0xba, 0xec, 0x4d, 0x0d, 0xd7, 0x53, 0x52, 0x90, 0xfe, 0xc4, 0x78, 0x2f, 0xaa, 0xf2, 0xf4, 0xdc, 0xa2, 0xdd, 0x6f,
-	0x8d, 0xb1, 0x6f, 0x8d, 0x85, 0x6f, 0x7d, 0xb3, 0xde, 0x7a, 0xb6, 0xbc, 0x75, 0x0d, 0x78, 0x6b, 0xac, 0x76, 0x6b,
-	0x4d, 0x75, 0x6b, 0xed, 0x73, 0x9b, 0xfe, 0x84, 0x7c, 0xfe, 0x60, 0xba, 0xda, 0xfb, 0x1d, 0xeb, 0xbd, 0x8e, 0xf5,
-	0xa6, 0x0b, 0xe6, 0xaf, 0xc7, 0x67, 0xc2, 0xf6, 0x4d, 0xfe, 0x76, 0x7c, 0x46, 0xf2, 0x9f, 0x8e, 0x67, 0xe4, 0xa5,
-	0xf8, 0x60, 0x3a, 0xfb, 0xe2, 0xf4, 0xaa, 0x12, 0x0e, 0xb7, 0xa7, 0xc2, 0xe1, 0xf6, 0x54, 0x38, 0xdc, 0xfe, 0x69,
-	0x38, 0xdc, 0xfe, 0x49, 0x38, 0xdc, 0xfe, 0x59, 0x38, 0xdc, 0x9e, 0x0a, 0x87, 0xdb, 0x93, 0xe1, 0x70, 0x7b, 0x32,
-	0x1c, 0x0a, 0xb6, 0xaf, 0xe1, 0xa7, 0xac, 0xe1, 0xfb, 0x43, 0xe5, 0x7d, 0x73, 0x9f, 0x3f, 0x35, 0x9e, 0x9a, 0xc3,
-	0xb8, 0xef, 0x9b, 0xfb, 0xac, 0x76, 0x23, 0xef, 0x7d, 0x73, 0x97, 0x7c, 0xa9, 0xe1, 0xa7, 0xec, 0xe1, 0xb8, 0xdc,
-	0xb0, 0xac, 0xe3, 0xa5, 0xd0, 0x43, 0xde, 0xfa, 0x67, 0x24, 0x6f, 0x90, 0x05, 0x81, 0x1b, 0x22, 0x9e, 0x7a, 0x0b,
-	0x48, 0x8f, 0x1a, 0xd6, 0x1b, 0xe1, 0xea, 0x2b, 0x6a, 0xd5, 0x0f, 0x2b, 0x2e, 0xfe, 0x60, 0x0a, 0xc7, 0x7d, 0x59,
-	0xe9, 0xd0, 0xb0, 0x7f, 0x4b, 0x29, 0x69, 0x30, 0xe2, 0x17, 0x81, 0xfb, 0x13, 0x45, 0xe0, 0xfe, 0x4f, 0x8b, 0xc0,
-	0xbd, 0xda, 0x48, 0x33, 0xec, 0xd5, 0x86, 0x7b, 0xb3, 0x5f, 0x75, 0x18, 0xff, 0x5b, 0x8a, 0x5d, 0x29, 0x83, 0xa6,
-	0x60, 0xdc, 0xfb, 0x05, 0xe3, 0xfe, 0x54, 0xc1, 0xb8, 0x97, 0xad, 0x0d, 0x23, 0x85, 0x8b, 0xdf, 0x54, 0x09, 0xfd,
-	0x2d, 0x25, 0xeb, 0x7f, 0x59, 0xd1, 0x06, 0xbf, 0xd3, 0x96, 0xad, 0xfb, 0x4a, 0xd9, 0xba, 0x3f, 0x59, 0xb6, 0xee,
-	0x61, 0xe3, 0xc2, 0x50, 0x0a, 0xb8, 0x1b, 0x8b, 0xe8, 0x3b, 0x13, 0xec, 0xdf, 0x38, 0x91, 0x78, 0x5f, 0x53, 0x95,
-	0xee, 0xfd, 0xaa, 0x74, 0x7f, 0xaa, 0x2a, 0xdd, 0xe7, 0x18, 0x62, 0x84, 0xb2, 0x75, 0xad, 0xdc, 0x89, 0xb4, 0xe6,
-	0x06, 0xf0, 0xae, 0xfb, 0xfc, 0x08, 0xff, 0x92, 0x97, 0x3e, 0xe0, 0x12, 0x78, 0xa1, 0x0c, 0xd1, 0x60, 0xba, 0xed,
-	0xa3, 0x4b, 0x15, 0x5f, 0xe7, 0xdc, 0x70, 0xef, 0x5e, 0xc5, 0x3f, 0x76, 0xe1, 0x51, 0x94, 0xb5, 0x5c, 0xaa, 0x28,
-	0x02, 0xdb, 0x06, 0xf0, 0xa2, 0x1e, 0xa2, 0xf4, 0x65, 0x1e, 0x45, 0x5f, 0xe6, 0x52, 0x54, 0x7a, 0xf6, 0x49, 0x6f,
-	0xf7, 0x88, 0x0d, 0xbe, 0x6e, 0xaf, 0x3a, 0xdf, 0x22, 0xf0, 0x16, 0x1a, 0xa2, 0xc5, 0x1d, 0x9d, 0x06, 0xe0, 0x08,
-	0xfb, 0xe1, 0x2d, 0xb4, 0x59, 0xfe, 0xa0, 0x0e, 0x60, 0xec, 0xe5, 0x1d, 0x34, 0x41, 0xbc, 0xa3, 0x18, 0xfb, 0xe2,
-	0x0d, 0x34, 0x01, 0xd5, 0xd1, 0x8b, 0x3d, 0xbc, 0x7f, 0x26, 0x50, 0xce, 0xd0, 0x02, 0xd1, 0xdb, 0x67, 0x02, 0xa8,
-	0x33, 0x15, 0xfb, 0xe6, 0x4a, 0x5e, 0x4c, 0xd8, 0xf3, 0x23, 0x06, 0x44, 0x68, 0x3a, 0x10, 0xe1, 0x59, 0x00, 0x8c,
-	0xf6, 0x0d, 0x6c, 0xdb, 0x7d, 0xf4, 0x5a, 0xa1, 0xd9, 0x59, 0x05, 0x29, 0xbe, 0xa3, 0x33, 0xdf, 0xda, 0x99, 0x6f,
-	0x2d, 0x16, 0x47, 0x00, 0xc3, 0xce, 0x1c, 0x40, 0x59, 0x06, 0x01, 0xca, 0x8f, 0xe0, 0x05, 0xc9, 0x8f, 0xde, 0x05,
-	0x62, 0x1b, 0x0a, 0x74, 0x53, 0x7c, 0xa0, 0x69, 0x04, 0xa4, 0xf4, 0x92, 0x8c, 0xf3, 0xb1, 0x83, 0x36, 0x7b, 0x48,
-	0x58, 0x23, 0x4d, 0xb3, 0xd9, 0x79, 0x61, 0x04, 0x48, 0xf1, 0xd6, 0xab, 0xc0, 0x32, 0x42, 0x00, 0xf9, 0x6d, 0x57,
-	0x41, 0xd4, 0xaf, 0x3b, 0x0b, 0x91, 0x5f, 0x81, 0x15, 0x88, 0x7f, 0xd7, 0x5a, 0x10, 0x7e, 0xc9, 0x35, 0x23, 0x79,
-	0x1f, 0x22, 0x53, 0xfa, 0x3b, 0x0e, 0xef, 0x80, 0xbe, 0x7f, 0x50, 0xab, 0x9a, 0x7d, 0x8e, 0x62, 0x44, 0xd8, 0x6d,
-	0x10, 0xf3, 0x64, 0x76, 0x9f, 0x0f, 0x9d, 0x66, 0x2f, 0x2d, 0x0f, 0x9d, 0x6a, 0x58, 0x87, 0x96, 0x73, 0xe8, 0x54,
-	0x73, 0x4e, 0x90, 0x95, 0x87, 0x4e, 0x35, 0x6c, 0xc2, 0x4d, 0x1d, 0x3a, 0xd5, 0xb8, 0x0a, 0xbc, 0xf2, 0xd0, 0xa9,
-	0x82, 0x31, 0x04, 0x09, 0xd1, 0x11, 0x41, 0xb0, 0x0e, 0x0b, 0x86, 0x4d, 0x44, 0x96, 0xcf, 0xa5, 0xf2, 0x1c, 0x26,
-	0xf8, 0xda, 0x34, 0x34, 0x01, 0x9a, 0x4f, 0xb8, 0x6a, 0xc4, 0xef, 0x98, 0x89, 0x57, 0xe7, 0x84, 0xab, 0xe6, 0x9c,
-	0xc8, 0xb5, 0x27, 0x5c, 0x35, 0xa5, 0x63, 0x58, 0x9d, 0x70, 0xd5, 0xb8, 0x89, 0xe6, 0xbc, 0x5e, 0xd5, 0x88, 0x8e,
-	0x6b, 0x6f, 0xbd, 0xaa, 0x48, 0x13, 0xe1, 0xf9, 0x04, 0xea, 0xb4, 0x9c, 0x5f, 0x13, 0xeb, 0xce, 0x09, 0x54, 0xcd,
-	0x39, 0x51, 0x5f, 0x9e, 0x40, 0xd5, 0x70, 0x25, 0xfe, 0xd5, 0x09, 0x54, 0x8d, 0x6b, 0x25, 0x28, 0x4f, 0xa0, 0x2a,
-	0xd8, 0x6a, 0x42, 0xc2, 0x7f, 0x37, 0xa6, 0x39, 0x98, 0x68, 0x36, 0x12, 0x41, 0xb0, 0xd6, 0x09, 0x86, 0x8d, 0x58,
-	0x30, 0xe1, 0x2a, 0x46, 0xfe, 0xa5, 0xdb, 0x1c, 0x59, 0xe5, 0x2f, 0xdd, 0x6a, 0x58, 0x2b, 0x86, 0xf3, 0x4b, 0xb7,
-	0x9a, 0x73, 0x14, 0xa3, 0xfc, 0xa5, 0x5b, 0x0d, 0x1b, 0xc5, 0x50, 0xbf, 0x74, 0xab, 0x71, 0xa5, 0x18, 0xe5, 0x2f,
-	0xdd, 0x2a, 0x18, 0x15, 0x83, 0x10, 0x1d, 0x98, 0x04, 0xeb, 0xc0, 0x64, 0xd8, 0x28, 0x46, 0xf9, 0x74, 0x37, 0xcf,
-	0x70, 0x82, 0xaf, 0x4d, 0x43, 0xa3, 0x18, 0xf9, 0x67, 0x75, 0x35, 0xe2, 0x77, 0xcc, 0x28, 0x86, 0xf3, 0xb3, 0xba,
-	0x9a, 0x73, 0x14, 0xc3, 0xfe, 0xac, 0xae, 0xa6, 0xb4, 0x62, 0xa8, 0x9f, 0xd5, 0xd5, 0xb8, 0x51, 0x8c, 0xfc, 0x7c,
-	0x5b, 0x23, 0x5a, 0x31, 0xbc, 0xe7, 0xdb, 0x8a, 0x34, 0x8a, 0x91, 0x7f, 0x5b, 0x77, 0x5a, 0xce, 0xaf, 0x51, 0x0c,
-	0xe7, 0xb7, 0x75, 0x35, 0xe7, 0x28, 0x46, 0xf9, 0xdb, 0xba, 0x1a, 0xae, 0x28, 0x86, 0xfa, 0x6d, 0x5d, 0x8d, 0x6b,
-	0xc5, 0x28, 0x7f, 0x5b, 0x57, 0xc1, 0x56, 0x31, 0x12, 0xfe, 0xbb, 0x31, 0xcd, 0xc1, 0x44, 0xb3, 0x51, 0x0c, 0x82,
-	0xb5, 0x62, 0x30, 0x6c, 0x14, 0x83, 0x09, 0x5f, 0x31, 0x00, 0x2d, 0x74, 0x03, 0x71, 0xa3, 0x1e, 0x48, 0x1a, 0x0d,
-	0x41, 0xd2, 0x57, 0x12, 0x6c, 0xe1, 0xe9, 0x09, 0xf2, 0x46, 0x55, 0x90, 0xb4, 0xda, 0x82, 0xac, 0x55, 0x18, 0x64,
-	0xb5, 0xce, 0x20, 0x67, 0xd4, 0x06, 0x9f, 0x0d, 0xe0, 0x9c, 0x21, 0x6e, 0x02, 0x1c, 0x49, 0x13, 0xe6, 0x05, 0x69,
-	0x55, 0xc8, 0x79, 0x18, 0x21, 0xbe, 0x03, 0xe4, 0x75, 0xe5, 0x22, 0xab, 0x4b, 0x65, 0xcd, 0xd6, 0xc7, 0x4f, 0x0d,
-	0xc1, 0x2a, 0x55, 0xad, 0x66, 0xeb, 0xb7, 0xf0, 0x54, 0xab, 0x52, 0xb3, 0xf5, 0x1b, 0x18, 0x05, 0xf3, 0x6a, 0xb6,
-	0x3e, 0x6b, 0xd5, 0xac, 0x7c, 0x84, 0xe1, 0xe3, 0x46, 0xd9, 0xaa, 0x8f, 0x30, 0xdc, 0x26, 0x56, 0xe5, 0xca, 0x42,
-	0xf1, 0xd4, 0xf3, 0x2e, 0xab, 0x78, 0xb5, 0x42, 0xb1, 0xdf, 0xc2, 0x53, 0x3f, 0xa7, 0x50, 0xec, 0x93, 0x35, 0x25,
-	0xf4, 0x0a, 0xc5, 0x3e, 0x6b, 0x54, 0xd1, 0x29, 0x14, 0xbb, 0xa4, 0xa3, 0x90, 0xc0, 0xfe, 0x5e, 0x31, 0xf1, 0xa1,
-	0xa2, 0x64, 0x56, 0x33, 0x91, 0x34, 0xca, 0x59, 0x90, 0x56, 0x3f, 0x0b, 0xda, 0x53, 0xd1, 0x54, 0x52, 0x79, 0xdd,
-	0xe4, 0x67, 0xdc, 0x04, 0x70, 0x2f, 0x4a, 0x94, 0x05, 0xb3, 0x44, 0xbd, 0xdf, 0x97, 0x26, 0x0a, 0x24, 0xb2, 0x24,
-	0xd4, 0x2f, 0x4a, 0x13, 0xaa, 0x7f, 0x26, 0x9a, 0xe0, 0xac, 0x86, 0x25, 0x4c, 0x32, 0x58, 0x82, 0xea, 0xe7, 0xa2,
-	0x13, 0x7a, 0x66, 0x00, 0x36, 0xa4, 0x42, 0x0b, 0x13, 0x15, 0xdc, 0x45, 0x98, 0xc7, 0x19, 0x02, 0x6b, 0x29, 0x51,
-	0x25, 0x60, 0xd3, 0xbc, 0x5a, 0x14, 0x2d, 0xf8, 0x4f, 0x1d, 0x29, 0x54, 0x6c, 0xc2, 0xc4, 0x93, 0xfe, 0x19, 0xe6,
-	0x27, 0xf3, 0x6b, 0xb7, 0xcf, 0xba, 0xc9, 0xb3, 0x69, 0xf2, 0xc2, 0x4d, 0xf8, 0x27, 0x0f, 0x5e, 0x72, 0x93, 0x8c,
-	0x14, 0x9b, 0x4a, 0x85, 0x9a, 0xc6, 0xfa, 0x78, 0x98, 0x25, 0xf0, 0x92, 0x1f, 0x1e, 0xae, 0xdf, 0x75, 0xfb, 0x87,
-	0x5f, 0xb7, 0xbb, 0xfd, 0x21, 0x7f, 0x7a, 0xb3, 0x7d, 0xdc, 0x0e, 0x1f, 0x7e, 0xec, 0x1f, 0x1e, 0x7f, 0xee, 0x1e,
-	0xf7, 0xbb, 0xab, 0x40, 0xfe, 0x0f, 0xe4, 0x87, 0x24, 0x1f };
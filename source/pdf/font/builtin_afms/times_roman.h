@@ -1,633 +0,0 @@
-// times_roman.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_TIMES_ROMAN[] = { 0x78, 0x9c, 0xbd, 0x7d, 0x5d, 0x73, 0x1b, 0x47, 0xb2, 0xe5, 0xbb, 0x23, 0xfc,
-	0x1f, 0xf0, 0xb8, 0x1b, 0xb1, 0x9c, 0x05, 0x1a, 0xdf, 0x33, 0x4f, 0xf2, 0x48, 0xd6, 0xf8, 0xca, 0x16, 0x48, 0x59,
-	0x20, 0x84, 0xfb, 0x06, 0x91, 0x4d, 0x0a, 0x2b, 0x10, 0xd0, 0x00, 0xa0, 0x40, 0xf8, 0xd7, 0xdf, 0xea, 0xae, 0xac,
-	0xcc, 0x53, 0x99, 0x59, 0xd0, 0x3c, 0x6d, 0x4c, 0x84, 0x47, 0x38, 0xa7, 0xba, 0xbb, 0x2a, 0xbf, 0x2b, 0xbb, 0x00,
-	0xfe, 0x79, 0x5c, 0xed, 0x8f, 0xbf, 0xee, 0xb6, 0xc7, 0x3f, 0xea, 0xe3, 0x7e, 0x7d, 0x77, 0xe8, 0x0c, 0xfe, 0xd6,
-	0xfb, 0xf9, 0xa7, 0x7f, 0xee, 0x9e, 0x9e, 0xea, 0xed, 0xb1, 0xf3, 0xcf, 0xdd, 0xb7, 0xf3, 0x7e, 0xfd, 0xf8, 0xe5,
-	0xd8, 0xf9, 0x5f, 0x77, 0xff, 0xbb, 0xd3, 0x9b, 0x4e, 0x86, 0xff, 0xa7, 0xf9, 0xef, 0xb8, 0xfd, 0xef, 0xb4, 0xf9,
-	0xef, 0xb4, 0xdb, 0xfe, 0xb7, 0xdf, 0xfe, 0x77, 0xdc, 0x79, 0x75, 0xbf, 0xfb, 0x5c, 0x77, 0xfe, 0x3c, 0x1f, 0x8e,
-	0xf5, 0xd3, 0xa1, 0xf3, 0xdb, 0xf6, 0x6e, 0xb7, 0xff, 0xb6, 0xdb, 0xaf, 0x8e, 0xf5, 0xfd, 0xdf, 0x3a, 0x9d, 0x57,
-	0x9b, 0x4d, 0xe7, 0x43, 0x73, 0xb7, 0x43, 0xe7, 0x43, 0x7d, 0xa8, 0xf7, 0xdf, 0x03, 0x0a, 0xcf, 0xda, 0xd7, 0xab,
-	0xe3, 0x7a, 0xb7, 0xed, 0xbc, 0x0e, 0xc3, 0xff, 0xde, 0xf9, 0xf8, 0xe5, 0xb9, 0xf3, 0xc7, 0xea, 0xdc, 0xe9, 0xf4,
-	0x3a, 0xbd, 0xea, 0xef, 0x83, 0xe9, 0xdf, 0x7b, 0xe3, 0xf6, 0x11, 0x72, 0xc1, 0x7c, 0xbb, 0xfe, 0xf7, 0x73, 0xfd,
-	0xdb, 0xeb, 0xce, 0xa0, 0xdf, 0x1d, 0x4d, 0x04, 0xbf, 0xfd, 0xe3, 0xf9, 0xb0, 0x7a, 0xac, 0x03, 0x3c, 0xed, 0x4e,
-	0x3b, 0xc3, 0xc1, 0xb4, 0x3f, 0xf8, 0xf9, 0xa7, 0x66, 0x89, 0xef, 0x57, 0x4f, 0x75, 0xe7, 0xe3, 0xfa, 0xa9, 0x3e,
-	0x5c, 0x7d, 0xd8, 0x3d, 0xad, 0xb6, 0x01, 0x7d, 0xde, 0x6c, 0x04, 0xed, 0x24, 0x74, 0xf5, 0xb4, 0xde, 0x9c, 0x05,
-	0xff, 0xf9, 0xa7, 0x45, 0xdd, 0x0a, 0x81, 0xf8, 0xdf, 0x8e, 0xab, 0xcd, 0xfa, 0xee, 0xd5, 0xf6, 0x71, 0x53, 0x77,
-	0xba, 0xe1, 0xe3, 0xe1, 0xd7, 0xf5, 0x4b, 0x7d, 0x7f, 0xbd, 0x3e, 0xde, 0x7d, 0xe9, 0x3c, 0xac, 0x36, 0x87, 0x3a,
-	0xcc, 0xe5, 0xcb, 0x6a, 0xbf, 0xba, 0x3b, 0xd6, 0xfb, 0x3f, 0xeb, 0x63, 0xe7, 0xcd, 0xcb, 0xb1, 0xde, 0xde, 0xd7,
-	0xf7, 0xe9, 0xf6, 0x61, 0x2a, 0xbf, 0xfc, 0xb2, 0x7b, 0xe9, 0x5c, 0xf5, 0x46, 0x93, 0xce, 0x55, 0xd5, 0x9b, 0x74,
-	0x7a, 0xdd, 0x6e, 0xb7, 0x33, 0x99, 0x4e, 0x3a, 0x3f, 0xff, 0x34, 0x0f, 0x23, 0xf7, 0x9b, 0xf5, 0xb6, 0xbe, 0xde,
-	0x1d, 0xd6, 0xad, 0x3c, 0xae, 0x02, 0x0b, 0xf8, 0xc7, 0x2f, 0xeb, 0xbb, 0xaf, 0xdb, 0xfa, 0x70, 0xe8, 0x0c, 0x03,
-	0x7c, 0x5b, 0xef, 0x0f, 0xcd, 0xa0, 0x6e, 0xb7, 0xfa, 0x5b, 0xb7, 0x19, 0xf7, 0x7e, 0x77, 0x5c, 0xdf, 0xd5, 0xff,
-	0x1f, 0x34, 0x17, 0x45, 0xb6, 0x3e, 0x74, 0x56, 0x9d, 0xe3, 0x7e, 0x75, 0x5f, 0x3f, 0xad, 0xf6, 0x5f, 0x3b, 0xbb,
-	0x87, 0xce, 0xef, 0xeb, 0xed, 0xee, 0x78, 0xfe, 0x56, 0x5f, 0xfd, 0xab, 0x0e, 0x57, 0xbd, 0x7a, 0xdb, 0x59, 0x6d,
-	0xef, 0xff, 0xef, 0x6e, 0xdf, 0x59, 0x87, 0x8b, 0x0f, 0xcf, 0x9f, 0x0f, 0xeb, 0xfb, 0xf5, 0x6a, 0xbf, 0xae, 0x0f,
-	0x41, 0xf5, 0x6f, 0xc2, 0x53, 0xee, 0xd7, 0xdb, 0xc7, 0x3f, 0xef, 0xbe, 0xd4, 0x41, 0xd8, 0xed, 0x14, 0xfe, 0x3c,
-	0x86, 0xf1, 0xab, 0xfd, 0x7d, 0xe2, 0x82, 0x2c, 0x57, 0xdf, 0xfe, 0x15, 0xe5, 0x3f, 0x1a, 0x55, 0x3f, 0xff, 0xf4,
-	0x89, 0x3e, 0x0c, 0x9a, 0xe5, 0xbf, 0x3a, 0xdc, 0x35, 0xa2, 0xdd, 0x77, 0x46, 0x93, 0xfe, 0xcf, 0x3f, 0xbd, 0xae,
-	0xd3, 0xc7, 0x20, 0xd5, 0x60, 0x29, 0x7f, 0x1e, 0xef, 0xff, 0xb5, 0xe8, 0x54, 0x93, 0xf6, 0x5f, 0xb7, 0x8b, 0xce,
-	0x64, 0xd0, 0xfc, 0x2b, 0x18, 0x7c, 0xa3, 0x9e, 0x64, 0xf0, 0xfd, 0xde, 0x30, 0x3c, 0xa3, 0xd3, 0xaf, 0x3a, 0xff,
-	0xe8, 0x2c, 0x3e, 0x75, 0xaa, 0x61, 0x37, 0xfc, 0xe3, 0x7d, 0xe7, 0xf0, 0x6d, 0x15, 0xc4, 0xf8, 0x8f, 0xce, 0x2f,
-	0x9d, 0x2e, 0xfd, 0xef, 0x1f, 0xed, 0xb0, 0x7e, 0x1c, 0xd6, 0x6f, 0xff, 0xf1, 0xbe, 0x53, 0xbf, 0xdc, 0x6d, 0x56,
-	0x4f, 0xed, 0xb8, 0x5e, 0xbf, 0xdb, 0xb9, 0x9a, 0x76, 0xaa, 0xfe, 0xa4, 0x33, 0x1a, 0x8f, 0x68, 0xf8, 0x20, 0x0e,
-	0x1f, 0x74, 0x27, 0xed, 0xf0, 0x7f, 0x3f, 0xef, 0x82, 0x44, 0x3f, 0x6f, 0xda, 0x0b, 0xc6, 0xe3, 0x60, 0xa3, 0xbd,
-	0x70, 0xab, 0x1e, 0x5c, 0x30, 0x8c, 0x17, 0x0c, 0xbb, 0x71, 0x1a, 0xdb, 0xe7, 0xa7, 0xcf, 0x8d, 0x8a, 0x1f, 0xb7,
-	0xed, 0x25, 0xc3, 0x30, 0x8f, 0xc1, 0x74, 0xd4, 0x48, 0x82, 0xc6, 0x8f, 0xf2, 0xf1, 0xf7, 0xbb, 0xcd, 0x66, 0xb5,
-	0x6f, 0xc7, 0x0e, 0x06, 0x9d, 0xab, 0x49, 0x78, 0xc4, 0x70, 0xdc, 0x19, 0x57, 0x63, 0x1a, 0x3e, 0x8e, 0xc3, 0x27,
-	0x34, 0xfd, 0x6f, 0xf5, 0xfe, 0xae, 0xf1, 0x99, 0x66, 0xfc, 0xa8, 0x17, 0x4c, 0xad, 0x1f, 0x66, 0x55, 0xc1, 0x74,
-	0x26, 0x71, 0xfc, 0x78, 0x1c, 0xe7, 0xbf, 0x7a, 0x0a, 0x57, 0x1c, 0x82, 0x86, 0xe2, 0x13, 0xaa, 0x78, 0x45, 0x10,
-	0x99, 0x5c, 0x31, 0xcd, 0x05, 0xd4, 0xae, 0x38, 0x5a, 0x62, 0xbb, 0xe6, 0x69, 0x58, 0x73, 0xbf, 0xd3, 0x18, 0x3d,
-	0x5f, 0x32, 0xe8, 0xe6, 0x97, 0x7c, 0x5b, 0xed, 0xeb, 0xed, 0xa6, 0x7e, 0x88, 0x57, 0x0c, 0x82, 0x8f, 0xf4, 0x82,
-	0xa8, 0xfa, 0xdd, 0x01, 0x5c, 0xd2, 0x73, 0x2e, 0x91, 0xa7, 0x54, 0xd3, 0x78, 0x4d, 0x35, 0x19, 0xc2, 0x35, 0x55,
-	0x2e, 0xaa, 0xd5, 0xa1, 0x99, 0xd8, 0xe1, 0x6b, 0x5c, 0x7c, 0x50, 0xdc, 0x68, 0x18, 0xe6, 0x06, 0x8b, 0x1f, 0x90,
-	0xae, 0x87, 0xa3, 0x41, 0x7c, 0xc8, 0xe6, 0xf9, 0xd0, 0x0e, 0xee, 0x37, 0xe6, 0x30, 0x0c, 0xba, 0x1d, 0x76, 0xd3,
-	0xd0, 0x41, 0x6e, 0x3d, 0x77, 0x21, 0x16, 0xad, 0xa2, 0xc6, 0x46, 0x61, 0x2a, 0x61, 0xba, 0xbd, 0xe9, 0x30, 0xb8,
-	0x39, 0x69, 0x6d, 0x30, 0xcc, 0xa7, 0xff, 0xe5, 0xfc, 0xed, 0x4b, 0x1d, 0x35, 0x1c, 0xe4, 0xd7, 0x9b, 0x0e, 0xda,
-	0x99, 0x57, 0x43, 0xd2, 0xda, 0x60, 0x94, 0xdf, 0x3d, 0xe8, 0x60, 0xbd, 0x8b, 0x2a, 0x18, 0x07, 0x9b, 0xeb, 0x85,
-	0xbb, 0x4f, 0x7a, 0x4d, 0x10, 0xa1, 0xe1, 0xa4, 0xe4, 0x8a, 0x94, 0x76, 0xd8, 0xac, 0x0e, 0x5f, 0xda, 0xd1, 0x57,
-	0x8d, 0x5c, 0x9a, 0x9b, 0x8f, 0x61, 0x95, 0x93, 0x5c, 0x2c, 0x7f, 0xd5, 0xfb, 0x5d, 0x14, 0xe2, 0xa0, 0x1d, 0x3c,
-	0x08, 0x03, 0x65, 0xf0, 0x34, 0x1f, 0xbc, 0xdb, 0x46, 0x1f, 0xe9, 0x85, 0x39, 0x74, 0xc3, 0xdc, 0x41, 0x45, 0xc3,
-	0x6e, 0x3e, 0xf4, 0x78, 0xda, 0x89, 0xf0, 0x06, 0x63, 0x50, 0xcc, 0xb0, 0xa7, 0x46, 0x7e, 0xd9, 0xd7, 0xf1, 0xb6,
-	0x41, 0x03, 0xed, 0x14, 0xd0, 0x43, 0x86, 0x4a, 0x8d, 0x0f, 0xbb, 0xe7, 0x68, 0xef, 0xbd, 0xaa, 0xbd, 0x31, 0x28,
-	0x70, 0xd8, 0x57, 0x43, 0xd7, 0xdf, 0xe3, 0x7d, 0xfb, 0x15, 0xdd, 0x37, 0x58, 0xe1, 0x64, 0x42, 0x83, 0x07, 0xf9,
-	0xe0, 0xc3, 0xfa, 0x25, 0x8e, 0x25, 0x31, 0x8c, 0x9a, 0xb1, 0x03, 0x1a, 0xab, 0xbc, 0xf4, 0x50, 0x7f, 0x27, 0xf5,
-	0x55, 0x41, 0x1f, 0x93, 0x60, 0x0e, 0x53, 0x71, 0xd1, 0xa1, 0x72, 0xd1, 0x9a, 0xcd, 0x34, 0xda, 0x46, 0x18, 0x8d,
-	0xc2, 0x18, 0xab, 0x00, 0xb0, 0x26, 0x11, 0x37, 0xd1, 0xa5, 0xaa, 0x82, 0xe9, 0x4c, 0x61, 0xf0, 0x24, 0xd7, 0xf4,
-	0xdd, 0x6e, 0xb3, 0x8b, 0xf3, 0x98, 0xf4, 0xa2, 0x5d, 0x4c, 0xe3, 0x15, 0x71, 0xf4, 0x54, 0xd9, 0x45, 0xfd, 0xb4,
-	0x86, 0x2b, 0xba, 0xd1, 0x50, 0xab, 0xde, 0x54, 0x2e, 0x19, 0x25, 0x25, 0x92, 0x0b, 0x6c, 0x9a, 0xbc, 0xd3, 0xae,
-	0x73, 0xd2, 0xac, 0x73, 0x18, 0xc2, 0xcf, 0xb0, 0x47, 0x42, 0x19, 0xf5, 0xf2, 0xb1, 0xf5, 0xbf, 0x9f, 0x57, 0x9b,
-	0x34, 0xf5, 0x5e, 0x15, 0x3d, 0xa6, 0x3f, 0xa1, 0xa9, 0x8f, 0xaa, 0x7c, 0xf4, 0x63, 0x93, 0xfe, 0xeb, 0x7d, 0xf1,
-	0xe6, 0xa4, 0xca, 0xc1, 0x60, 0x40, 0x61, 0xa5, 0x3e, 0xb4, 0xd9, 0xb1, 0x75, 0xde, 0x76, 0xfc, 0xa0, 0x07, 0xd6,
-	0x37, 0x22, 0x6d, 0x4e, 0xab, 0x5e, 0x74, 0xf6, 0x23, 0xd9, 0x69, 0x14, 0xf9, 0xa4, 0x0b, 0x52, 0x1c, 0x91, 0x36,
-	0xc7, 0x55, 0xd5, 0x8e, 0x7d, 0x15, 0x87, 0x36, 0xb1, 0x76, 0xdc, 0x6d, 0x8c, 0x3f, 0xcd, 0x81, 0x14, 0x39, 0x1a,
-	0x8d, 0xdb, 0x71, 0xbf, 0xc4, 0x71, 0xe3, 0x26, 0x18, 0x4c, 0xfb, 0xa2, 0xf0, 0xd1, 0x38, 0x1f, 0xf7, 0x4f, 0x5e,
-	0x54, 0x33, 0xc3, 0xe0, 0xf2, 0xf2, 0xe4, 0x49, 0xfe, 0xe4, 0xd7, 0xf1, 0x8e, 0xa3, 0x70, 0xc7, 0x51, 0x13, 0xba,
-	0xf8, 0x8e, 0xa4, 0xb9, 0x51, 0x2f, 0xae, 0xe6, 0x8d, 0x18, 0xfc, 0x30, 0xe4, 0x6e, 0x1e, 0x37, 0x4e, 0xea, 0x6a,
-	0x6d, 0xee, 0x7d, 0xe7, 0x57, 0x18, 0x37, 0x80, 0xac, 0x31, 0xee, 0xe5, 0xcf, 0x7d, 0x8b, 0x5e, 0x31, 0x46, 0xd9,
-	0x8c, 0xab, 0x7c, 0xe4, 0xbf, 0xe2, 0x1d, 0xa7, 0xad, 0x6c, 0x2a, 0xb8, 0xa3, 0xca, 0x8b, 0xbf, 0xc5, 0x71, 0x93,
-	0x26, 0x2a, 0xf4, 0x60, 0x25, 0x63, 0xd2, 0x4b, 0x7f, 0x32, 0x6d, 0xc7, 0xfd, 0x57, 0x1c, 0xd7, 0xda, 0x5e, 0xc8,
-	0x4e, 0x5d, 0x18, 0xa9, 0xb4, 0xf2, 0x2e, 0x79, 0x63, 0x78, 0x72, 0x05, 0xd2, 0x1e, 0x8f, 0x72, 0xd9, 0xfc, 0x8e,
-	0xb2, 0x99, 0xc0, 0xb8, 0x94, 0xfa, 0xe8, 0xc9, 0x7f, 0xc8, 0xb8, 0xc9, 0x08, 0xef, 0xa7, 0x74, 0xf2, 0x3e, 0x8d,
-	0x6b, 0xfc, 0x69, 0xdc, 0x45, 0x69, 0x4f, 0xf3, 0x91, 0x33, 0x8c, 0x17, 0x4d, 0x5c, 0x61, 0x29, 0x4e, 0x94, 0x5e,
-	0xae, 0x45, 0xcf, 0xc3, 0x01, 0x48, 0x71, 0xa2, 0xf4, 0x72, 0x23, 0x77, 0x0c, 0xd3, 0x1a, 0x77, 0x21, 0x0c, 0x4e,
-	0xaa, 0xdc, 0xc8, 0x3e, 0x88, 0x31, 0x8e, 0x86, 0x10, 0x7d, 0x26, 0xfd, 0xfc, 0xd1, 0x7f, 0x76, 0x38, 0x73, 0x87,
-	0xc8, 0x33, 0xc5, 0x3b, 0x0e, 0x72, 0x41, 0x7e, 0x2c, 0x98, 0xf7, 0x44, 0x29, 0x66, 0x1e, 0xc7, 0x0d, 0xc8, 0x78,
-	0x40, 0xd9, 0x93, 0x51, 0x3e, 0xf2, 0x36, 0x2d, 0xbb, 0x11, 0xe5, 0x08, 0x0d, 0x77, 0x42, 0xca, 0x99, 0x92, 0x7b,
-	0x2f, 0x62, 0x7c, 0x6c, 0x07, 0x4e, 0xfb, 0x28, 0x21, 0xa5, 0x9d, 0x4f, 0xc9, 0x7e, 0x1a, 0x7b, 0x1c, 0xc0, 0x38,
-	0xa5, 0x9b, 0x65, 0xf4, 0xc1, 0xaa, 0x1d, 0x07, 0x8b, 0x99, 0x76, 0xf3, 0x45, 0xff, 0x77, 0x3b, 0x6e, 0xaa, 0x1d,
-	0x6b, 0xaa, 0xea, 0x8d, 0xcf, 0xa1, 0xba, 0xff, 0x5a, 0x1f, 0xb9, 0x48, 0x99, 0x34, 0xce, 0x1d, 0x24, 0x5c, 0x4d,
-	0x41, 0xf4, 0xd3, 0x54, 0x52, 0x52, 0xbc, 0xfd, 0x1c, 0xae, 0xb9, 0x9c, 0x8b, 0xa7, 0x7d, 0xf7, 0x31, 0x52, 0xd8,
-	0xb4, 0xa6, 0xd0, 0x3c, 0x67, 0x00, 0x62, 0x9e, 0xa6, 0x22, 0x73, 0x14, 0x2d, 0x7b, 0x75, 0xb8, 0x5b, 0xaf, 0xef,
-	0xd6, 0xfb, 0xbb, 0xe7, 0x58, 0x98, 0x86, 0x44, 0x5e, 0x85, 0xc5, 0x0c, 0x30, 0x02, 0x4c, 0x55, 0x06, 0x7b, 0x6e,
-	0xca, 0xe6, 0x43, 0x28, 0xfa, 0x53, 0xcd, 0x7b, 0xd5, 0xab, 0x86, 0x2d, 0x7b, 0xd5, 0x38, 0x62, 0x7b, 0xc9, 0x28,
-	0x9f, 0x5c, 0x5b, 0xd9, 0xb1, 0x04, 0x7a, 0xbd, 0x61, 0xac, 0xec, 0x86, 0x10, 0x85, 0xa7, 0xe3, 0x3c, 0x6a, 0xc7,
-	0x92, 0x28, 0x14, 0xa1, 0x61, 0x4f, 0x13, 0xc0, 0x90, 0x9b, 0x46, 0x54, 0xb3, 0x4c, 0x55, 0x15, 0xf2, 0x39, 0x8e,
-	0x8c, 0x03, 0xdb, 0xd4, 0xdb, 0xa7, 0x81, 0xd3, 0xfc, 0x96, 0x77, 0x71, 0x89, 0xc3, 0x38, 0xb2, 0x07, 0xb7, 0x6c,
-	0xeb, 0xa1, 0xac, 0x36, 0x8e, 0x43, 0xe9, 0xe9, 0x8d, 0xe9, 0xa7, 0x9b, 0xf6, 0xba, 0xbd, 0xfc, 0xae, 0x75, 0x76,
-	0xd7, 0x6a, 0x80, 0x77, 0xad, 0x72, 0x31, 0x3c, 0x74, 0x28, 0xef, 0x87, 0x48, 0x17, 0xee, 0xd7, 0xde, 0x33, 0x04,
-	0xa1, 0x75, 0xa8, 0x36, 0xda, 0x7f, 0x6c, 0x3a, 0x0f, 0x9b, 0x74, 0xa9, 0xaa, 0x47, 0x1e, 0x39, 0x31, 0x34, 0xf5,
-	0xf0, 0x60, 0xdc, 0xc5, 0xc7, 0xa8, 0x72, 0xe4, 0x0b, 0x1b, 0xe6, 0xa0, 0xb1, 0x18, 0x99, 0xf9, 0x30, 0x37, 0xb2,
-	0xb5, 0x84, 0x96, 0x6a, 0xd8, 0xc7, 0x81, 0xa3, 0x7c, 0xe0, 0xff, 0x8b, 0x56, 0xd8, 0x14, 0x90, 0xed, 0x16, 0xb4,
-	0xa9, 0xdd, 0x64, 0xb0, 0xaa, 0x42, 0x62, 0x91, 0xdc, 0x86, 0x82, 0xc6, 0xc1, 0x65, 0x9c, 0x2a, 0x40, 0x36, 0x92,
-	0x1e, 0x9a, 0xea, 0x15, 0x06, 0x26, 0x7f, 0xa4, 0x81, 0x4f, 0x32, 0xcd, 0x71, 0x30, 0x30, 0x59, 0x77, 0x4f, 0x29,
-	0x6d, 0x2b, 0x03, 0x07, 0x93, 0x6c, 0xa0, 0xaa, 0x1a, 0xa9, 0x68, 0x9d, 0x46, 0x95, 0x65, 0xb2, 0xec, 0xa9, 0x92,
-	0xf1, 0x5b, 0x8a, 0x2e, 0x61, 0x97, 0xa8, 0x87, 0x2a, 0x15, 0xfd, 0x3b, 0x79, 0x50, 0x1c, 0x1b, 0xfc, 0x1c, 0xc6,
-	0xa6, 0x5c, 0x46, 0x96, 0xb0, 0xef, 0xa4, 0x2d, 0x5a, 0xbf, 0x9f, 0xcd, 0x34, 0x55, 0xfb, 0x94, 0x79, 0x62, 0x05,
-	0x35, 0xec, 0xb5, 0x33, 0xed, 0x0f, 0xb2, 0x5b, 0x2a, 0x25, 0x91, 0x6f, 0x45, 0x3f, 0xa8, 0x42, 0xc2, 0x19, 0x8e,
-	0xa7, 0x69, 0xa8, 0x52, 0xd1, 0x33, 0x19, 0x48, 0x5c, 0x7e, 0x53, 0xc3, 0xf1, 0x4d, 0x95, 0x6f, 0x7d, 0x4f, 0x4a,
-	0x8a, 0xe5, 0xfd, 0x18, 0x87, 0xaa, 0xb0, 0x79, 0x8a, 0xcb, 0xef, 0xc5, 0x94, 0x16, 0x4c, 0x44, 0x86, 0x56, 0x4a,
-	0x51, 0x2f, 0x92, 0x2e, 0xf2, 0xc7, 0x57, 0x4a, 0x51, 0x67, 0xce, 0x17, 0xd1, 0xea, 0x87, 0x38, 0xb6, 0xca, 0xfd,
-	0xf0, 0xaf, 0xe4, 0xb2, 0x8d, 0x6f, 0x4f, 0x70, 0x60, 0xaa, 0x07, 0x27, 0x5d, 0x8e, 0x94, 0x10, 0x8c, 0x9a, 0xb8,
-	0xd5, 0xec, 0x89, 0xfa, 0xcd, 0xd6, 0x74, 0xc2, 0x17, 0xa5, 0x5d, 0x5a, 0x0a, 0x32, 0xb4, 0x53, 0x0e, 0x29, 0x34,
-	0xfa, 0x40, 0x50, 0xe4, 0x78, 0x52, 0xa5, 0xd1, 0x43, 0xe7, 0x11, 0x12, 0x8a, 0xdb, 0xed, 0x7e, 0xfb, 0x8c, 0x49,
-	0xf6, 0x8c, 0x54, 0xed, 0x0f, 0x7a, 0x12, 0x8c, 0x8f, 0xeb, 0xcd, 0x3d, 0xed, 0x68, 0x42, 0x29, 0x1c, 0x9c, 0x62,
-	0x18, 0xa2, 0x48, 0xbf, 0x4a, 0xce, 0x31, 0x52, 0xd9, 0x25, 0x36, 0x15, 0xee, 0x77, 0xa7, 0x68, 0xfc, 0x53, 0x9a,
-	0x5e, 0xd5, 0x6d, 0xac, 0x6a, 0x9c, 0x2e, 0x52, 0x46, 0xcd, 0xfb, 0xf8, 0x61, 0x63, 0x2d, 0xfd, 0x66, 0x13, 0x32,
-	0x01, 0x73, 0x19, 0x29, 0xc3, 0x6e, 0x36, 0xbf, 0x9b, 0xf5, 0x36, 0x86, 0xa0, 0xa6, 0xba, 0x09, 0x17, 0x4c, 0x61,
-	0x1f, 0xdf, 0x4b, 0x15, 0x74, 0x8f, 0x0a, 0x8c, 0x87, 0xa6, 0xa1, 0x95, 0x2a, 0xee, 0xd8, 0xba, 0x6a, 0x4a, 0x36,
-	0xdc, 0x9a, 0xf5, 0x46, 0x2a, 0xab, 0x9c, 0x69, 0x57, 0x74, 0x15, 0xe6, 0x14, 0x42, 0x47, 0x0f, 0x12, 0x79, 0x6f,
-	0xa4, 0xb6, 0x45, 0x0f, 0x9b, 0xdd, 0x7e, 0xbd, 0xa5, 0x38, 0x13, 0x04, 0x3b, 0xd5, 0xf3, 0x51, 0xf6, 0x7e, 0xa8,
-	0x65, 0x3a, 0xed, 0x2e, 0xb8, 0x71, 0xa4, 0x6a, 0x84, 0x57, 0x28, 0xbb, 0xbf, 0x7b, 0xde, 0xef, 0xeb, 0xed, 0x5d,
-	0xb4, 0xbf, 0x66, 0x2f, 0x15, 0xb6, 0x4f, 0xc3, 0xf0, 0x7f, 0xa3, 0x2e, 0xcf, 0x89, 0xcc, 0xbf, 0x47, 0x2a, 0x6f,
-	0x53, 0xdc, 0x61, 0xdd, 0x76, 0xfa, 0xa8, 0x17, 0xd1, 0xec, 0x45, 0x7b, 0x58, 0xc3, 0xf7, 0x52, 0xd1, 0x2d, 0x5b,
-	0x93, 0xd8, 0xe3, 0x91, 0x0e, 0x46, 0xbf, 0xcd, 0x8c, 0xd9, 0xfe, 0xa4, 0x37, 0x56, 0x5e, 0xf1, 0xf8, 0xbc, 0x0e,
-	0x57, 0x3c, 0xed, 0xa4, 0xa6, 0x08, 0xe9, 0xb1, 0xb9, 0x2a, 0x64, 0xfb, 0x41, 0x8f, 0xaf, 0x52, 0xc9, 0xa7, 0xb9,
-	0xaa, 0x9d, 0x1f, 0x5f, 0x15, 0xf4, 0xdc, 0x64, 0xe1, 0x26, 0x54, 0xca, 0x55, 0xfd, 0xc2, 0x55, 0x62, 0xcd, 0x61,
-	0x65, 0xcd, 0x65, 0x4d, 0x2c, 0x94, 0xcb, 0x52, 0x0a, 0xa2, 0xd2, 0xf1, 0x21, 0xe6, 0x96, 0x7e, 0xb3, 0xd5, 0x1f,
-	0x56, 0x98, 0x3e, 0x53, 0xad, 0xce, 0x23, 0x69, 0xdf, 0x57, 0xd9, 0x91, 0x4a, 0x8b, 0xf5, 0xf6, 0x3e, 0x15, 0x44,
-	0x21, 0xc0, 0x85, 0x34, 0xdc, 0x10, 0x15, 0xbb, 0xf9, 0x58, 0xa9, 0xf0, 0x7e, 0xf5, 0xf8, 0x48, 0x9b, 0xc4, 0x61,
-	0x1b, 0xbf, 0xa6, 0x6d, 0x19, 0x01, 0x62, 0x9d, 0x7a, 0x17, 0xa4, 0x8e, 0xdb, 0xb0, 0x2d, 0xd3, 0xfa, 0xea, 0x9a,
-	0x54, 0x9d, 0xe7, 0xed, 0x95, 0xc6, 0x9f, 0xea, 0x7d, 0xcd, 0x6d, 0x96, 0x5e, 0xa8, 0x3c, 0x5a, 0x77, 0xef, 0xa5,
-	0xc9, 0xa5, 0x12, 0x7c, 0x30, 0xe4, 0x26, 0xd4, 0xea, 0x71, 0xbf, 0xfa, 0xf6, 0x85, 0x0d, 0x2c, 0x3c, 0x2c, 0x86,
-	0x4c, 0x31, 0xfb, 0x54, 0x8f, 0xf7, 0xe9, 0x61, 0x9f, 0x9f, 0x83, 0xee, 0x8e, 0x1c, 0x1b, 0x42, 0x91, 0xd5, 0x6f,
-	0x4b, 0x1e, 0x9e, 0x9c, 0x4a, 0x32, 0x62, 0x92, 0x9f, 0x57, 0x87, 0x68, 0x95, 0xe3, 0x69, 0xda, 0xb9, 0x4f, 0xa4,
-	0xc5, 0xd4, 0x4b, 0x65, 0xba, 0x36, 0x4b, 0xbe, 0x6c, 0x30, 0x8c, 0x97, 0x35, 0x0a, 0x87, 0xcb, 0x46, 0xfe, 0x65,
-	0x50, 0x83, 0x76, 0xa3, 0x39, 0xe3, 0x6e, 0xa4, 0x37, 0x51, 0x7a, 0x65, 0x73, 0x06, 0x13, 0x1b, 0x44, 0x7b, 0x9e,
-	0x80, 0x89, 0xa5, 0x72, 0xbe, 0x6d, 0x80, 0xb7, 0xf6, 0xb0, 0xd9, 0xac, 0xbf, 0x1d, 0xd6, 0x31, 0x45, 0x36, 0x39,
-	0xbe, 0xd9, 0x01, 0x4c, 0x26, 0x13, 0xe9, 0x6e, 0xf5, 0x52, 0x69, 0xcf, 0xd7, 0x04, 0x7d, 0x1d, 0xbf, 0xec, 0x9e,
-	0xb9, 0x2d, 0xd9, 0x84, 0x8f, 0x69, 0x28, 0x14, 0x07, 0xed, 0xf6, 0x3d, 0x5e, 0x34, 0xed, 0xe9, 0x65, 0xc5, 0xfe,
-	0x01, 0x07, 0xd9, 0x3e, 0xd5, 0x41, 0xfd, 0xb0, 0x24, 0x91, 0xbe, 0x2e, 0xc8, 0x83, 0x7a, 0xa9, 0x85, 0x14, 0x9e,
-	0x30, 0x0c, 0x55, 0x52, 0xd5, 0x5a, 0xd2, 0x24, 0x0d, 0x57, 0xca, 0x5a, 0xdd, 0x3d, 0x1f, 0xe3, 0xf0, 0x69, 0xbf,
-	0x1d, 0xde, 0xef, 0x8d, 0x71, 0xb8, 0x6a, 0x03, 0xc6, 0x9a, 0xfd, 0x61, 0x53, 0x53, 0x2e, 0xed, 0xc5, 0x6b, 0x9a,
-	0x10, 0x95, 0x7a, 0x10, 0x3d, 0x5d, 0x85, 0x4b, 0x6a, 0x09, 0xa3, 0xfb, 0x55, 0x0c, 0xc8, 0x7d, 0x7e, 0xc2, 0x38,
-	0x1f, 0xfd, 0xb4, 0xba, 0xdb, 0x53, 0xcc, 0x6c, 0xee, 0x3e, 0xa0, 0xbb, 0x37, 0xe5, 0x6f, 0x1c, 0x3f, 0xc9, 0xc7,
-	0x7f, 0xde, 0xd7, 0xb4, 0xde, 0x10, 0x59, 0xdb, 0xc9, 0xb4, 0x1b, 0x60, 0x9e, 0x8c, 0x6a, 0xf6, 0xde, 0xef, 0x8e,
-	0xab, 0x3b, 0x4e, 0x44, 0x4d, 0xe1, 0x31, 0x9c, 0x34, 0x76, 0x19, 0xa2, 0xf2, 0x84, 0x1e, 0x51, 0xa5, 0xaa, 0x9c,
-	0xaf, 0x59, 0x07, 0x2f, 0x63, 0x8d, 0xc7, 0x2b, 0xda, 0x96, 0x81, 0x5c, 0xa1, 0x82, 0xde, 0x3e, 0xa5, 0xad, 0x90,
-	0x12, 0x9a, 0x9c, 0x52, 0x05, 0x75, 0x8d, 0x7b, 0x3c, 0x5a, 0xa9, 0xec, 0xae, 0xbe, 0x0f, 0xa6, 0x48, 0xcd, 0xd8,
-	0xaa, 0x51, 0xf2, 0x30, 0x5c, 0xd1, 0x4b, 0x0d, 0xfd, 0xaa, 0xab, 0x7b, 0xb1, 0xcf, 0xdb, 0xc7, 0xd5, 0xfe, 0xf9,
-	0x69, 0xb3, 0x7a, 0x8e, 0xcb, 0xb8, 0x22, 0xd5, 0x8d, 0x41, 0x75, 0x55, 0x57, 0xa9, 0x61, 0xf7, 0xb8, 0xdb, 0xd6,
-	0xd4, 0x4a, 0x6e, 0xfc, 0x3e, 0x64, 0xc2, 0x6a, 0xd0, 0x97, 0x87, 0x28, 0x3d, 0xdc, 0xad, 0x50, 0x0d, 0x5a, 0xc9,
-	0x55, 0xd7, 0xb8, 0xc5, 0x93, 0x0a, 0x93, 0x2d, 0xc3, 0x71, 0xb2, 0x4a, 0xb5, 0x4a, 0x6a, 0x6e, 0xbc, 0x7a, 0x43,
-	0x63, 0x55, 0x73, 0xa3, 0xaa, 0xb8, 0x37, 0x1c, 0x23, 0xf5, 0x6e, 0x7f, 0xff, 0x50, 0x3f, 0xad, 0xb9, 0xcb, 0x38,
-	0x68, 0x9b, 0xb8, 0x4d, 0x1e, 0x60, 0xdf, 0xae, 0xd2, 0xab, 0x11, 0xee, 0xb0, 0xc8, 0x26, 0xd6, 0xb6, 0x59, 0xaa,
-	0xf4, 0x86, 0x84, 0xbb, 0x22, 0x32, 0xba, 0xd9, 0xbd, 0xb6, 0xc5, 0xd2, 0xa4, 0x33, 0xee, 0xa7, 0xb5, 0xa6, 0x57,
-	0x24, 0x69, 0xea, 0xb3, 0x37, 0xec, 0x8f, 0xa3, 0x00, 0x36, 0xfb, 0xdc, 0x24, 0xf4, 0xf4, 0x72, 0xa4, 0x0d, 0xc1,
-	0x71, 0xf2, 0x4f, 0xa1, 0xbe, 0x7a, 0xde, 0xa4, 0xd9, 0x8f, 0xda, 0xd9, 0x67, 0x6f, 0x0a, 0xaa, 0xf4, 0xaa, 0x20,
-	0x35, 0x4a, 0x56, 0xd4, 0x4e, 0x9d, 0xb4, 0x95, 0xf2, 0xa8, 0x0f, 0x3b, 0xc6, 0x6a, 0xa0, 0x36, 0x53, 0xf7, 0x4d,
-	0x3a, 0x3e, 0x1c, 0xd4, 0x9e, 0x0a, 0xc6, 0xeb, 0xed, 0x0f, 0x48, 0x26, 0xee, 0x81, 0xa6, 0x92, 0xfb, 0x2a, 0xd3,
-	0x3c, 0x97, 0xd1, 0xed, 0xb6, 0xa5, 0xd9, 0xbc, 0x06, 0xc1, 0x0f, 0x87, 0xc9, 0x94, 0x53, 0x0b, 0x3d, 0x89, 0x72,
-	0x27, 0x9d, 0xe0, 0x66, 0xea, 0x53, 0xd8, 0xb8, 0x54, 0xba, 0x89, 0x1e, 0xb2, 0xde, 0x53, 0x08, 0x88, 0x9f, 0x37,
-	0x87, 0xa4, 0xa8, 0xab, 0x69, 0xbe, 0x93, 0xbe, 0x52, 0x55, 0xe7, 0x6f, 0xda, 0x13, 0x63, 0xeb, 0x6e, 0xd2, 0x1f,
-	0xe6, 0xe3, 0x79, 0x8f, 0x2c, 0xd1, 0x0d, 0x36, 0xca, 0xec, 0x22, 0x7a, 0xf8, 0x4a, 0x62, 0x09, 0x34, 0x00, 0x38,
-	0x96, 0x5c, 0xa9, 0xf9, 0x3f, 0x1b, 0x3f, 0x8c, 0x5b, 0x9b, 0x61, 0x9b, 0x76, 0x0a, 0xcf, 0xa8, 0xc5, 0xaf, 0xb2,
-	0x29, 0xa9, 0x67, 0x70, 0x53, 0x28, 0x5b, 0x31, 0x37, 0x87, 0xcc, 0x8a, 0x53, 0x8f, 0xfa, 0x7e, 0xfd, 0x7d, 0x7d,
-	0x9f, 0xe9, 0xa0, 0x7d, 0x09, 0x94, 0xb2, 0x99, 0xb9, 0x3d, 0x08, 0x88, 0xef, 0x3d, 0xed, 0xfa, 0x83, 0x5f, 0xe9,
-	0xe0, 0x9f, 0xda, 0xcf, 0x93, 0xc9, 0xa8, 0x20, 0x50, 0xb9, 0x3d, 0x0a, 0x54, 0xcb, 0x86, 0xdb, 0x74, 0xfa, 0x01,
-	0xd2, 0xb0, 0x33, 0x8f, 0xe0, 0xfa, 0x5d, 0x1e, 0x81, 0xfb, 0x35, 0xf3, 0x0c, 0xde, 0xd9, 0xb6, 0xef, 0xbd, 0x20,
-	0x05, 0x34, 0x9b, 0xdc, 0x36, 0xab, 0xe2, 0x2e, 0xd7, 0x6a, 0x2d, 0x9f, 0xd9, 0x7f, 0xa2, 0xba, 0x39, 0x27, 0x01,
-	0x5c, 0xc7, 0xb4, 0xb4, 0xf6, 0xdc, 0xb4, 0xe1, 0x8a, 0x92, 0x71, 0xaf, 0x20, 0xa0, 0xb7, 0xd2, 0x6d, 0x5e, 0x0e,
-	0x8e, 0xa6, 0x76, 0x11, 0xfc, 0x88, 0x5c, 0x54, 0x3c, 0xa3, 0x6e, 0xc1, 0xbc, 0xe1, 0xfe, 0x8d, 0x61, 0x0f, 0x87,
-	0x6d, 0x5f, 0x87, 0x37, 0xb8, 0x69, 0x3c, 0x77, 0xfc, 0xf3, 0x15, 0xa4, 0xce, 0xbf, 0x99, 0x3f, 0xbf, 0x49, 0x08,
-	0x79, 0x3e, 0xbd, 0xf3, 0x30, 0xaf, 0x13, 0xd2, 0xe0, 0xec, 0x6d, 0x25, 0x6a, 0x6d, 0x4a, 0xfb, 0xe1, 0x50, 0x7c,
-	0x5e, 0xe9, 0x19, 0x8d, 0x47, 0xe9, 0xa2, 0x74, 0xc2, 0x80, 0xc3, 0xe9, 0xa0, 0x7d, 0x3c, 0x87, 0x5e, 0xb3, 0x06,
-	0xac, 0x3e, 0x78, 0x05, 0xbd, 0xbe, 0xaf, 0x81, 0x3b, 0xeb, 0xcb, 0xbd, 0xca, 0x1a, 0x04, 0x2b, 0x8c, 0x0d, 0x02,
-	0x9c, 0x81, 0xab, 0x02, 0x2d, 0x9e, 0xf7, 0x7a, 0xc9, 0x6d, 0x7f, 0x7f, 0x3a, 0xc9, 0x1b, 0xfc, 0x2c, 0xa7, 0x14,
-	0xde, 0x41, 0xc7, 0x6d, 0x78, 0x9f, 0x76, 0xad, 0x86, 0x79, 0x42, 0x52, 0x2b, 0x5e, 0x72, 0x4f, 0xee, 0xb6, 0x9b,
-	0x19, 0xd1, 0xae, 0x3f, 0xeb, 0xbd, 0xf3, 0x55, 0xe9, 0xd5, 0x12, 0x84, 0x18, 0x79, 0xbf, 0x54, 0x9e, 0x93, 0x54,
-	0x8b, 0x38, 0xa7, 0x7e, 0x61, 0x4e, 0x6f, 0x54, 0x3d, 0x57, 0xb4, 0x3a, 0xf1, 0x7f, 0xd6, 0x59, 0x3f, 0x86, 0xeb,
-	0xb6, 0x01, 0xa3, 0x75, 0x26, 0xc3, 0xb1, 0x36, 0xeb, 0xc5, 0xda, 0xcc, 0x0d, 0x15, 0xdc, 0xdd, 0x04, 0x0d, 0x8c,
-	0x48, 0x03, 0x36, 0x1b, 0x8c, 0xe3, 0xf4, 0x37, 0xbb, 0xbf, 0xea, 0xed, 0x23, 0x8d, 0x6e, 0x6a, 0xb1, 0xe6, 0xb5,
-	0xe6, 0xb8, 0x1a, 0xf8, 0xa2, 0xfc, 0x00, 0x35, 0x59, 0x7a, 0x8b, 0x62, 0x02, 0x23, 0xbf, 0x30, 0xd3, 0xda, 0xea,
-	0x57, 0x51, 0x5b, 0xd9, 0xcb, 0x33, 0xe3, 0xf4, 0x2a, 0xd0, 0x49, 0xb3, 0xae, 0x6c, 0xd6, 0xea, 0x92, 0xcc, 0x94,
-	0x0a, 0xb1, 0xf1, 0x15, 0xfa, 0x19, 0xa7, 0x11, 0xed, 0x67, 0x5c, 0x4d, 0xcb, 0xba, 0x53, 0xeb, 0xb2, 0x38, 0x9b,
-	0x3b, 0x54, 0x58, 0x35, 0x8c, 0x0a, 0xcb, 0x9a, 0xee, 0xda, 0x84, 0xfe, 0x3b, 0x37, 0xa1, 0x69, 0xc9, 0x82, 0x52,
-	0xe7, 0xe0, 0xe3, 0x97, 0xdd, 0x1e, 0x5a, 0xbe, 0xd9, 0xdb, 0x31, 0xbd, 0xce, 0x19, 0xac, 0x13, 0xde, 0xba, 0x99,
-	0x95, 0xb2, 0x86, 0xc1, 0x78, 0x58, 0xc3, 0x26, 0x40, 0xa7, 0xf7, 0x64, 0x32, 0x18, 0x5e, 0x96, 0xd9, 0xe1, 0x13,
-	0xaa, 0x14, 0x21, 0x5a, 0x45, 0x15, 0x0d, 0x83, 0x91, 0x8f, 0xa6, 0x85, 0xf0, 0x3c, 0x47, 0x15, 0x41, 0xba, 0xd0,
-	0x53, 0x67, 0xcb, 0xe1, 0xe8, 0x26, 0x36, 0x63, 0x82, 0x5b, 0x1f, 0xcf, 0x4f, 0x1c, 0x9e, 0xdb, 0x36, 0xc6, 0x3e,
-	0x59, 0x41, 0x15, 0xa4, 0x58, 0xe1, 0xeb, 0x3e, 0x23, 0x4d, 0x88, 0x57, 0x20, 0xcc, 0x62, 0xbd, 0x02, 0x5b, 0x61,
-	0xb6, 0xb1, 0xe2, 0x60, 0xa9, 0xfd, 0x64, 0xb0, 0xf1, 0x12, 0xaa, 0xb2, 0x9e, 0x9e, 0x37, 0xc7, 0xf5, 0xb7, 0xcd,
-	0x39, 0xe5, 0x95, 0xa6, 0x49, 0x17, 0x32, 0xe3, 0x74, 0x5c, 0x10, 0x0d, 0x6c, 0xb2, 0xc1, 0x9f, 0x8a, 0x61, 0x36,
-	0xf7, 0xf2, 0x26, 0xba, 0xda, 0x0a, 0x8b, 0x36, 0x47, 0xdf, 0x56, 0xfb, 0xe3, 0x7a, 0xb5, 0xb9, 0x5f, 0x3f, 0x3c,
-	0x70, 0x48, 0x6e, 0x1a, 0xab, 0x4d, 0x18, 0xe9, 0x15, 0x12, 0xfb, 0xd9, 0x94, 0x1a, 0x5c, 0x35, 0x55, 0x7d, 0x5f,
-	0x3a, 0xef, 0xc1, 0x2e, 0xe5, 0x35, 0xb3, 0x11, 0x26, 0xc7, 0x40, 0x15, 0x12, 0xae, 0x28, 0x12, 0x3a, 0x7e, 0xcb,
-	0x81, 0x5c, 0xd7, 0x7e, 0x1c, 0xc9, 0x8b, 0xc5, 0x65, 0xb6, 0x0c, 0x8c, 0x3a, 0x7a, 0x15, 0x5c, 0xc5, 0xe5, 0xc5,
-	0x34, 0xd4, 0x70, 0xa5, 0x2b, 0xee, 0xec, 0x06, 0xa2, 0xd7, 0xb7, 0xaa, 0xe3, 0x37, 0x41, 0x2a, 0xf6, 0x0f, 0x26,
-	0x4e, 0x25, 0xca, 0x56, 0x01, 0x0e, 0x06, 0x66, 0xd1, 0xed, 0x15, 0x54, 0x00, 0x66, 0x01, 0x2a, 0xd0, 0xd2, 0xe1,
-	0xad, 0x12, 0x4c, 0x25, 0xee, 0x93, 0x1c, 0x7d, 0xe1, 0xb1, 0xb1, 0xb0, 0xc3, 0x2e, 0x9e, 0x1d, 0x63, 0xfd, 0xa6,
-	0xb7, 0x12, 0xfb, 0xdd, 0xd7, 0x7a, 0x8b, 0xef, 0x26, 0x7a, 0x83, 0x7e, 0x7c, 0x37, 0xd1, 0x55, 0x3e, 0x90, 0x6a,
-	0xb1, 0x7d, 0xfd, 0xb8, 0x3e, 0x48, 0xb7, 0xf2, 0x52, 0x31, 0xc6, 0x19, 0x0c, 0xb6, 0x63, 0x72, 0xee, 0xc3, 0x38,
-	0xa5, 0x6c, 0x0e, 0xf3, 0x52, 0xa0, 0xb8, 0x3b, 0x1c, 0xa5, 0xf6, 0xfc, 0x73, 0x48, 0x90, 0xdc, 0xa0, 0xef, 0x0d,
-	0x29, 0x26, 0x0e, 0xa5, 0x27, 0x67, 0x8c, 0x14, 0x22, 0x0a, 0xdb, 0xa7, 0x16, 0x2a, 0x67, 0x2d, 0xd1, 0x80, 0x64,
-	0xad, 0x82, 0x2d, 0xec, 0xc0, 0x16, 0xe0, 0xfd, 0xa0, 0x31, 0x06, 0xce, 0x59, 0x18, 0x51, 0x0a, 0xf3, 0xe0, 0xb1,
-	0x62, 0x38, 0xd3, 0x92, 0x4f, 0x0d, 0x07, 0xb1, 0xdc, 0xa1, 0x23, 0x4e, 0x72, 0x2e, 0xaa, 0x6a, 0x53, 0x5c, 0x7b,
-	0x98, 0xa5, 0xa0, 0xa5, 0x37, 0xc7, 0x2f, 0x62, 0xf0, 0x6e, 0x0d, 0xcf, 0x95, 0x60, 0x96, 0x9a, 0x27, 0x31, 0x35,
-	0x67, 0x87, 0x8d, 0x4c, 0x35, 0x6b, 0x2a, 0x4e, 0x2a, 0xfb, 0xb3, 0x37, 0xb7, 0x2c, 0xf8, 0x2a, 0xc6, 0xc4, 0x23,
-	0x78, 0x4a, 0x7c, 0x2d, 0xd9, 0x6f, 0xca, 0x9e, 0xaa, 0x2a, 0x44, 0x05, 0xd8, 0xe7, 0xb4, 0x4e, 0xde, 0xec, 0xa3,
-	0xf0, 0x7d, 0xba, 0xc9, 0x8c, 0x70, 0x41, 0x9b, 0x19, 0x47, 0xc3, 0xfc, 0x50, 0x89, 0xc9, 0x2d, 0xe0, 0x8b, 0x3f,
-	0x4e, 0x44, 0x79, 0x74, 0xe6, 0xf1, 0xc5, 0x1e, 0x87, 0xd8, 0xe4, 0x7f, 0xd2, 0xe3, 0xf8, 0x0b, 0x22, 0x5a, 0x7a,
-	0x67, 0x69, 0x06, 0x73, 0x1c, 0xc7, 0x95, 0x8e, 0xe2, 0x4a, 0x9b, 0x33, 0xa8, 0x46, 0xf4, 0x9c, 0xa1, 0x61, 0xc3,
-	0x7f, 0x21, 0x43, 0xb3, 0xd9, 0xc3, 0x64, 0xc0, 0xea, 0x8b, 0xfd, 0x19, 0xac, 0xa6, 0x20, 0xde, 0x6b, 0x2f, 0xe1,
-	0xe2, 0x1d, 0x3c, 0x50, 0x5e, 0x65, 0x97, 0x57, 0x9b, 0x49, 0xfe, 0xaa, 0xdd, 0x3e, 0x35, 0x47, 0xa4, 0x4a, 0x49,
-	0x71, 0xa6, 0x0b, 0x5f, 0x58, 0x71, 0xa9, 0x2a, 0x9f, 0x43, 0x04, 0xb9, 0xb0, 0x07, 0x1f, 0xf5, 0x68, 0x8f, 0x5c,
-	0x6f, 0x8e, 0xd1, 0x5f, 0x5a, 0xef, 0xea, 0xc2, 0x61, 0x50, 0x2d, 0xcb, 0x23, 0x97, 0xa5, 0x70, 0x6a, 0xc0, 0xfa,
-	0x88, 0x1c, 0x75, 0xcd, 0xcb, 0xaf, 0xb6, 0xa1, 0x5a, 0x4d, 0x47, 0x17, 0xaa, 0xaf, 0x3c, 0xdf, 0xc2, 0x62, 0x4d,
-	0xa5, 0x4c, 0x0f, 0x79, 0x8a, 0x2f, 0xfc, 0xfb, 0x23, 0xda, 0x26, 0x36, 0x55, 0xb8, 0xde, 0xab, 0xb3, 0xf0, 0x45,
-	0x30, 0x57, 0x93, 0x74, 0x32, 0xa4, 0x18, 0x2e, 0x4d, 0xe7, 0x2d, 0x99, 0xcf, 0xd4, 0x69, 0xbd, 0x71, 0xf4, 0x46,
-	0x6b, 0xa6, 0x0e, 0x78, 0x76, 0x84, 0x4a, 0x3f, 0xe6, 0x5e, 0x3a, 0x14, 0xa9, 0x62, 0xee, 0x3a, 0x32, 0x1d, 0x0f,
-	0xa1, 0xa8, 0x0d, 0x91, 0x73, 0x1f, 0x22, 0x28, 0x7b, 0x6f, 0xab, 0x62, 0x3c, 0x4a, 0x6e, 0xaa, 0x78, 0x8c, 0x8a,
-	0x03, 0xea, 0xfe, 0x0f, 0xbc, 0x32, 0xb8, 0x4f, 0x6e, 0xb0, 0x81, 0xf8, 0xd6, 0x18, 0x69, 0x7f, 0x30, 0x2e, 0x97,
-	0xf1, 0xef, 0xcc, 0x36, 0xb0, 0x51, 0x5c, 0xd3, 0x46, 0xa8, 0xbc, 0x4d, 0x7b, 0xea, 0x9f, 0x67, 0xf5, 0x5e, 0xec,
-	0x9f, 0x1b, 0x23, 0x9d, 0xd2, 0x2b, 0x68, 0xf9, 0x6e, 0x05, 0x55, 0x0f, 0x55, 0x58, 0xda, 0x74, 0xe8, 0x08, 0x56,
-	0x0a, 0xb1, 0x2c, 0x55, 0x5f, 0xaa, 0xc4, 0x38, 0xbb, 0x83, 0xe3, 0x70, 0x66, 0x2f, 0xa5, 0xde, 0xdf, 0xf2, 0x97,
-	0x48, 0xdd, 0xf6, 0xdd, 0x85, 0xdd, 0x74, 0xa5, 0xc5, 0x66, 0x95, 0x15, 0xbd, 0x2c, 0x30, 0x5e, 0x40, 0x4a, 0x0e,
-	0x16, 0xf4, 0x65, 0xb5, 0x89, 0xc5, 0x76, 0x3f, 0x1e, 0x3a, 0x19, 0x0f, 0x1c, 0xaf, 0x49, 0x19, 0xb5, 0x69, 0xce,
-	0xff, 0x27, 0xe9, 0x94, 0x4d, 0x5b, 0x77, 0x1a, 0x31, 0x2e, 0x16, 0x1a, 0xd1, 0x5b, 0x78, 0xc3, 0xc6, 0x65, 0xa7,
-	0xee, 0x98, 0x70, 0x04, 0x32, 0xbe, 0x73, 0x39, 0x10, 0x91, 0xef, 0x18, 0x83, 0x70, 0x2a, 0x0e, 0x56, 0x2f, 0x56,
-	0x33, 0xa0, 0x5b, 0x1d, 0xa7, 0xf9, 0x45, 0x00, 0xbc, 0xc3, 0x83, 0x93, 0x66, 0xa6, 0xf1, 0x0e, 0x3a, 0x20, 0x37,
-	0x93, 0x54, 0xf0, 0x43, 0x2f, 0x63, 0x1d, 0xe3, 0x5e, 0xd9, 0xd4, 0x41, 0x3c, 0x5c, 0x79, 0xcd, 0x80, 0x9a, 0x27,
-	0xae, 0x63, 0x72, 0x84, 0x34, 0xa2, 0xbd, 0x94, 0x04, 0x07, 0x29, 0xca, 0x84, 0x0c, 0x4e, 0x5f, 0x26, 0x08, 0x3e,
-	0xd3, 0x9f, 0x36, 0x0e, 0xed, 0xd4, 0x44, 0x6c, 0x20, 0x90, 0xef, 0x2f, 0xe4, 0x4c, 0x29, 0xba, 0x64, 0xd7, 0x0f,
-	0xed, 0xb7, 0x52, 0x3b, 0xfd, 0x59, 0xee, 0x7e, 0x61, 0xab, 0x9a, 0x8e, 0x13, 0x04, 0xc7, 0x5f, 0xdf, 0x25, 0xd3,
-	0xee, 0x5c, 0x8d, 0x9a, 0xfe, 0x55, 0x15, 0x4a, 0xfe, 0x82, 0xe9, 0xbd, 0x06, 0x47, 0x4b, 0xd5, 0x62, 0x71, 0x03,
-	0xb3, 0x37, 0x2d, 0x5f, 0xea, 0xd3, 0xe3, 0xc1, 0x35, 0xb3, 0x49, 0x02, 0x4f, 0x80, 0x4d, 0x92, 0x4e, 0x3a, 0x2c,
-	0x4b, 0x19, 0x8e, 0xb2, 0x34, 0xcd, 0x46, 0xee, 0xbf, 0x39, 0x0d, 0xd0, 0x26, 0x96, 0x66, 0xc7, 0x99, 0x6d, 0x78,
-	0x71, 0x1a, 0xb9, 0xb1, 0x6d, 0x3a, 0xb9, 0x50, 0x33, 0xc2, 0x4a, 0xb8, 0x06, 0x34, 0x8d, 0xee, 0x34, 0x18, 0x33,
-	0x1b, 0x95, 0xb0, 0xe3, 0xf6, 0x4b, 0x5e, 0xa5, 0xfe, 0x9b, 0xbc, 0x9b, 0x90, 0x82, 0xb4, 0xa0, 0xb5, 0x19, 0x74,
-	0x64, 0xc1, 0x9c, 0xf5, 0x5c, 0xb8, 0xc0, 0x54, 0xb1, 0x9d, 0x8b, 0x4c, 0x1d, 0xd9, 0x65, 0xe7, 0xaf, 0xc3, 0xef,
-	0xa5, 0x6d, 0x2d, 0xae, 0x74, 0x12, 0x57, 0x9a, 0x9d, 0xde, 0xd7, 0x2a, 0xfe, 0xaa, 0xa5, 0x9f, 0x7a, 0xd6, 0x5d,
-	0xa7, 0x8c, 0xe5, 0xfe, 0x0e, 0xee, 0x85, 0x2b, 0xfa, 0x5e, 0x48, 0x55, 0x9c, 0x93, 0x3d, 0x14, 0x41, 0x19, 0xa7,
-	0xe4, 0x65, 0x5b, 0xe5, 0x08, 0xb1, 0x4f, 0xa0, 0x74, 0xc5, 0x07, 0x2c, 0x8d, 0xfd, 0xf4, 0x69, 0x13, 0x84, 0x87,
-	0x2d, 0xf5, 0x12, 0x36, 0xbb, 0xc7, 0xc6, 0x35, 0xb7, 0x3b, 0x3e, 0x11, 0xd3, 0x9c, 0x84, 0xcd, 0xbe, 0xdf, 0x62,
-	0xbc, 0x21, 0x6f, 0x8f, 0x80, 0x43, 0x68, 0xd5, 0x71, 0xb4, 0xc8, 0xae, 0x80, 0x80, 0x61, 0x2e, 0xa0, 0x6c, 0x18,
-	0xa6, 0x23, 0xc9, 0xb0, 0xf1, 0x83, 0x7e, 0x73, 0x24, 0x64, 0xdc, 0x1e, 0xf3, 0xf0, 0x53, 0x83, 0x5e, 0x3c, 0x26,
-	0x88, 0xf1, 0x40, 0x2f, 0x3e, 0x9d, 0x45, 0x38, 0x7e, 0xc9, 0xd7, 0xd0, 0x9c, 0xef, 0x2a, 0xb4, 0x91, 0xfe, 0xca,
-	0xda, 0xa2, 0x69, 0x43, 0x54, 0xca, 0xb4, 0x46, 0x17, 0x54, 0xdb, 0x66, 0x07, 0x7f, 0x75, 0xb1, 0x1d, 0x2c, 0x36,
-	0x2b, 0xb6, 0x43, 0x98, 0x6f, 0xab, 0xed, 0x81, 0x93, 0xb0, 0xb8, 0x1e, 0x86, 0x1c, 0xda, 0x36, 0xcf, 0x9a, 0x35,
-	0x94, 0x12, 0xe8, 0x9b, 0x67, 0xfa, 0x42, 0x1c, 0x7c, 0x11, 0xf4, 0xcd, 0xf6, 0x1e, 0xbe, 0x43, 0x4a, 0xdf, 0x2a,
-	0x7d, 0x57, 0xef, 0xb7, 0xaf, 0x57, 0xc7, 0x15, 0x7c, 0xbc, 0x5e, 0xad, 0x43, 0xb5, 0x5a, 0x75, 0xc7, 0xfd, 0x9f,
-	0x7f, 0x7a, 0x77, 0xfd, 0xa9, 0xf3, 0xaa, 0x13, 0xee, 0x3f, 0xe8, 0xf2, 0x87, 0x98, 0xf8, 0x11, 0x89, 0x02, 0xcb,
-	0x10, 0x2a, 0x61, 0x01, 0x7b, 0x9b, 0x7d, 0x88, 0x09, 0x1e, 0x11, 0x14, 0x24, 0xe0, 0xb3, 0xce, 0xd5, 0x70, 0xc8,
-	0x1f, 0xe8, 0xd9, 0x80, 0x80, 0xab, 0x21, 0xcc, 0x76, 0x88, 0x60, 0x4c, 0x65, 0x88, 0x64, 0xf9, 0x19, 0x09, 0x12,
-	0x36, 0x42, 0xf1, 0xe4, 0x03, 0x22, 0x31, 0x0e, 0x02, 0x72, 0x83, 0x1f, 0x3e, 0x36, 0xe9, 0xa6, 0xc7, 0x9f, 0x48,
-	0x48, 0x19, 0x84, 0x4b, 0x06, 0x62, 0x8e, 0xb7, 0x99, 0x9b, 0x35, 0xcf, 0xfd, 0x35, 0xcf, 0xbd, 0x35, 0xcf, 0xcd,
-	0x9a, 0xe7, 0xa5, 0x35, 0xcf, 0xed, 0x9a, 0x53, 0x63, 0x03, 0xa1, 0x36, 0x51, 0x00, 0x70, 0x1b, 0xa6, 0xde, 0xe7,
-	0x4f, 0x8b, 0xb0, 0x4d, 0x66, 0xdd, 0x2d, 0x1b, 0x67, 0x63, 0x8a, 0x8e, 0x16, 0x64, 0x90, 0x4c, 0x19, 0x50, 0xf8,
-	0xfa, 0x2d, 0x4a, 0xe5, 0x7b, 0xe7, 0x6a, 0x3c, 0x48, 0x1f, 0x4e, 0xe1, 0x39, 0x55, 0xfa, 0x70, 0xce, 0x3e, 0xd0,
-	0x63, 0x00, 0x91, 0xa7, 0x30, 0x18, 0x07, 0xa1, 0x61, 0x13, 0xa2, 0xad, 0x9b, 0x60, 0x6d, 0xe2, 0x09, 0x36, 0x76,
-	0x1e, 0x89, 0xb7, 0x16, 0xd1, 0x16, 0x4f, 0xb0, 0x6f, 0xf6, 0x91, 0x44, 0xdb, 0x27, 0x44, 0x1b, 0x03, 0xc1, 0xae,
-	0x45, 0x10, 0xe7, 0x98, 0x05, 0x31, 0xda, 0x36, 0x08, 0x2e, 0x18, 0x08, 0xb1, 0xc6, 0x4a, 0x08, 0xd7, 0xee, 0x41,
-	0xb0, 0xf6, 0x91, 0x08, 0xdf, 0x18, 0x24, 0xf3, 0x16, 0x82, 0x8c, 0xcb, 0x24, 0xdc, 0xf7, 0x9b, 0xc8, 0xce, 0xcd,
-	0xad, 0x8d, 0x07, 0x11, 0x7c, 0x41, 0x68, 0x9e, 0x2f, 0x11, 0xe3, 0x0b, 0xad, 0xe4, 0x55, 0xc4, 0x16, 0x84, 0x66,
-	0xfd, 0x8b, 0x70, 0xe5, 0x64, 0x11, 0xcd, 0x3c, 0x2d, 0x42, 0xe8, 0x6e, 0x11, 0xc9, 0x7c, 0x8e, 0x20, 0xe3, 0x78,
-	0x84, 0x7b, 0xde, 0x17, 0x29, 0xdf, 0x05, 0x23, 0x87, 0x7e, 0x18, 0x91, 0x93, 0x71, 0xac, 0xb3, 0x45, 0xb4, 0x5b,
-	0x12, 0xec, 0xf8, 0x66, 0xf4, 0x14, 0xf4, 0x4d, 0x42, 0xb4, 0x6f, 0x12, 0xac, 0x7d, 0x33, 0xc1, 0xc6, 0x37, 0x23,
-	0xf1, 0xd6, 0x22, 0xda, 0x37, 0x09, 0xf6, 0x7d, 0x33, 0x92, 0xe8, 0x9b, 0x84, 0x68, 0x33, 0x23, 0xd8, 0x35, 0x33,
-	0xe2, 0x1c, 0x33, 0x23, 0x46, 0x9b, 0x19, 0xc1, 0x05, 0x33, 0x23, 0xd6, 0x98, 0x19, 0xe1, 0xda, 0x37, 0x09, 0xd6,
-	0xbe, 0x19, 0xe1, 0x1b, 0x83, 0x64, 0xbe, 0x49, 0x90, 0xf1, 0xcd, 0x84, 0xfb, 0xbe, 0x19, 0xd9, 0xb9, 0xb9, 0xb5,
-	0xf1, 0x4d, 0x82, 0x2f, 0x08, 0xcd, 0xf3, 0x4d, 0x62, 0x7c, 0xa1, 0x95, 0x7c, 0x93, 0xd8, 0x82, 0xd0, 0xac, 0x6f,
-	0x12, 0xae, 0x7c, 0x33, 0xa2, 0x99, 0x6f, 0x46, 0x08, 0x7d, 0x33, 0x22, 0x99, 0x6f, 0x12, 0x64, 0x7c, 0x93, 0x70,
-	0xcf, 0x37, 0x23, 0xe5, 0xfb, 0x66, 0xe4, 0xd0, 0x37, 0x23, 0x72, 0x32, 0x8e, 0x75, 0xb6, 0x88, 0xf6, 0x4d, 0x82,
-	0x1d, 0xdf, 0x04, 0xbd, 0xa0, 0x83, 0x22, 0xac, 0xbd, 0x14, 0x39, 0xed, 0xaa, 0x19, 0x67, 0xfc, 0x15, 0xd8, 0xb7,
-	0x05, 0x58, 0x7b, 0x2e, 0x72, 0xbe, 0xfb, 0xc2, 0x08, 0xf4, 0x61, 0x84, 0xb5, 0x4d, 0x22, 0xe7, 0x1a, 0x26, 0x0e,
-	0x70, 0xac, 0x13, 0x69, 0x6d, 0xa2, 0xc8, 0x15, 0xec, 0x14, 0x87, 0x18, 0x63, 0x45, 0x52, 0xbb, 0x39, 0x72, 0xda,
-	0xd7, 0x81, 0xbb, 0xf1, 0xe1, 0xcc, 0xeb, 0x11, 0x37, 0xae, 0x9f, 0x91, 0xbe, 0xff, 0xc3, 0x90, 0xb9, 0xff, 0x38,
-	0x13, 0x09, 0x90, 0xfb, 0x91, 0xd4, 0xbd, 0x98, 0x80, 0xf4, 0x05, 0xa9, 0x97, 0xa2, 0x03, 0x0e, 0xb9, 0x24, 0x75,
-	0x1b, 0x27, 0x90, 0x54, 0xc1, 0x02, 0xa8, 0x2c, 0x62, 0x00, 0x8e, 0x61, 0x03, 0xe0, 0x2c, 0x76, 0x20, 0x6e, 0x02,
-	0x08, 0x92, 0x5e, 0x14, 0x01, 0xde, 0x0f, 0x25, 0x30, 0x00, 0xe3, 0x09, 0xc0, 0x27, 0x3f, 0x22, 0x9c, 0x0b, 0xb0,
-	0x0e, 0x2f, 0xc8, 0x39, 0x31, 0x86, 0x21, 0x8c, 0x30, 0x02, 0xea, 0xf8, 0x22, 0x8c, 0x8e, 0x2e, 0xc0, 0x98, 0xd8,
-	0xc2, 0xdc, 0x5b, 0x17, 0xd4, 0x71, 0x45, 0x18, 0x3f, 0xaa, 0x30, 0x8f, 0x31, 0x45, 0x40, 0x6d, 0xdb, 0xc2, 0xb8,
-	0x96, 0x2d, 0xb4, 0x63, 0xd7, 0x42, 0x6a, 0xab, 0x16, 0xa6, 0x60, 0xd3, 0x32, 0xc0, 0x58, 0xb4, 0x50, 0x3a, 0x8a,
-	0x08, 0xa3, 0x63, 0x08, 0x33, 0x37, 0x1e, 0x98, 0xc5, 0x0f, 0x41, 0x4d, 0xf4, 0x00, 0xca, 0x8f, 0x1d, 0x3c, 0x60,
-	0xee, 0x3d, 0xc6, 0xc4, 0x0d, 0x61, 0x2e, 0xcb, 0xd6, 0x8b, 0x19, 0x42, 0x16, 0x65, 0x5b, 0x8a, 0x17, 0x32, 0xa0,
-	0x2c, 0x5b, 0x1b, 0x2b, 0x84, 0x52, 0x91, 0x82, 0x89, 0x2c, 0x4e, 0x30, 0x8a, 0x51, 0x82, 0xc1, 0x2c, 0x46, 0x08,
-	0x6a, 0x22, 0x84, 0x50, 0x5e, 0x7c, 0x60, 0xcc, 0x8f, 0x0e, 0x4c, 0x63, 0x6c, 0x60, 0xf0, 0xe4, 0xf9, 0xf1, 0xd9,
-	0x05, 0x75, 0x54, 0x10, 0xc6, 0x89, 0x09, 0x51, 0x1d, 0x18, 0x10, 0x08, 0xd1, 0xd1, 0x80, 0x60, 0x1d, 0x0a, 0x12,
-	0x6c, 0xe2, 0x40, 0x24, 0xde, 0x5a, 0x44, 0x47, 0x00, 0x82, 0x7d, 0xf7, 0x8f, 0x24, 0xfa, 0x3e, 0x21, 0xda, 0x38,
-	0x09, 0x76, 0x2d, 0x93, 0x38, 0xc7, 0x2c, 0x89, 0xd1, 0x36, 0x49, 0x70, 0xc1, 0x20, 0x89, 0x35, 0xd6, 0x48, 0xb8,
-	0x76, 0x73, 0x82, 0xb5, 0x8f, 0x47, 0xf8, 0xc6, 0x20, 0x99, 0x77, 0x13, 0x64, 0x5c, 0x3b, 0xe1, 0xbe, 0x5f, 0x47,
-	0x76, 0x6e, 0x6e, 0x6d, 0x3c, 0x9a, 0xe0, 0x0b, 0x42, 0xf3, 0x7c, 0x99, 0x18, 0x5f, 0x68, 0x25, 0x2f, 0x26, 0xb6,
-	0x20, 0x34, 0xeb, 0xbf, 0x84, 0x2b, 0xe7, 0x8d, 0x68, 0xe6, 0xb9, 0x11, 0x42, 0xb7, 0x8d, 0x48, 0xe6, 0xb3, 0x04,
-	0x19, 0x87, 0x25, 0xdc, 0xf3, 0xd6, 0x48, 0xf9, 0xae, 0x1a, 0x39, 0xf4, 0xd3, 0x88, 0x9c, 0x8c, 0x63, 0x9d, 0x2d,
-	0xa2, 0xdd, 0x93, 0x60, 0xc7, 0x37, 0x49, 0x58, 0xe8, 0x9c, 0x09, 0xd2, 0xde, 0x99, 0x70, 0xed, 0x9e, 0x8c, 0x1b,
-	0xff, 0x24, 0xe6, 0xad, 0x03, 0x69, 0x0f, 0x4d, 0xb8, 0xef, 0xa2, 0xc4, 0xa2, 0x8f, 0x26, 0x48, 0xdb, 0x5b, 0xc2,
-	0x5d, 0x83, 0x4b, 0xa4, 0x63, 0x71, 0x89, 0xd2, 0x26, 0x97, 0xf0, 0x82, 0xcd, 0x25, 0xda, 0x18, 0x5d, 0x22, 0xb4,
-	0xab, 0x26, 0x5c, 0xfb, 0x2a, 0xe1, 0x37, 0x16, 0xca, 0xbc, 0x35, 0x61, 0xc6, 0x5d, 0x99, 0xf0, 0xfd, 0x95, 0xe8,
-	0xb9, 0xbd, 0xbd, 0xf1, 0xd8, 0x84, 0x5f, 0x92, 0xa0, 0xe7, 0xb3, 0x89, 0x2a, 0x48, 0xb0, 0xe4, 0xb5, 0x89, 0x2e,
-	0x49, 0xd0, 0xfa, 0x6d, 0x22, 0x94, 0xe3, 0x12, 0x9c, 0x79, 0x2e, 0x61, 0xe8, 0xba, 0x04, 0x65, 0xbe, 0x9b, 0x30,
-	0xe3, 0xbc, 0x89, 0xf0, 0xbc, 0x97, 0x38, 0xdf, 0x7d, 0x89, 0x44, 0xff, 0x25, 0xe8, 0x64, 0xbd, 0xef, 0xec, 0x40,
-	0xda, 0x85, 0x13, 0xee, 0xf8, 0x30, 0x09, 0x08, 0x7d, 0x38, 0x41, 0xda, 0x87, 0x13, 0xae, 0x7d, 0x98, 0x71, 0xe3,
-	0xc3, 0xc4, 0xbc, 0x75, 0x20, 0xed, 0xc3, 0x09, 0xf7, 0x7d, 0x98, 0x58, 0xf4, 0xe1, 0x04, 0x69, 0x0b, 0x4c, 0xb8,
-	0x6b, 0x81, 0x89, 0x74, 0x2c, 0x30, 0x51, 0xda, 0x02, 0x13, 0x5e, 0xb0, 0xc0, 0x44, 0x1b, 0x0b, 0x4c, 0x84, 0xf6,
-	0xe1, 0x84, 0x6b, 0x1f, 0x26, 0xfc, 0xc6, 0x42, 0x99, 0x0f, 0x27, 0xcc, 0xf8, 0x30, 0x13, 0xbe, 0x0f, 0x13, 0x3d,
-	0xb7, 0xb7, 0x37, 0x3e, 0x9c, 0xf0, 0x4b, 0x12, 0xf4, 0x7c, 0x38, 0x51, 0x05, 0x09, 0x96, 0x7c, 0x38, 0xd1, 0x25,
-	0x09, 0x5a, 0x1f, 0x4e, 0x84, 0xf2, 0x61, 0x82, 0x33, 0x1f, 0x26, 0x0c, 0x7d, 0x98, 0xa0, 0xcc, 0x87, 0x13, 0x66,
-	0x7c, 0x38, 0x11, 0x9e, 0x0f, 0x13, 0xe7, 0xfb, 0x30, 0x91, 0xe8, 0xc3, 0x04, 0x05, 0x1f, 0x1e, 0x2a, 0xef, 0x3b,
-	0x3b, 0x50, 0xd2, 0x8a, 0xc6, 0x41, 0xf0, 0x89, 0x6a, 0xe5, 0x80, 0x1e, 0x1c, 0x01, 0xed, 0xbf, 0x11, 0xd5, 0xde,
-	0x4b, 0xa8, 0xf1, 0xdd, 0x16, 0x7f, 0x6b, 0x00, 0xed, 0xb7, 0x11, 0xf5, 0xbd, 0xb6, 0xe5, 0xd0, 0x67, 0x23, 0xa0,
-	0xed, 0x2d, 0xa2, 0xae, 0xb5, 0x45, 0xca, 0xb1, 0xb5, 0x48, 0x68, 0x4b, 0x8b, 0x68, 0xc1, 0xce, 0x22, 0x69, 0xac,
-	0x2c, 0xc2, 0xda, 0x4b, 0x23, 0xaa, 0x7d, 0xb4, 0x45, 0x6f, 0x34, 0x90, 0xf9, 0x67, 0x44, 0x8c, 0x77, 0x12, 0xec,
-	0xfb, 0x66, 0x4b, 0xce, 0xf5, 0x6d, 0x8d, 0x5f, 0x46, 0xb4, 0x2c, 0x27, 0xcf, 0x27, 0x23, 0xe1, 0xca, 0xa9, 0xe4,
-	0x8f, 0x91, 0xf4, 0xe5, 0x64, 0x7d, 0x31, 0xc2, 0xca, 0x13, 0xdb, 0x8f, 0x99, 0x1f, 0xb6, 0x08, 0x7a, 0x61, 0x0b,
-	0x64, 0x3e, 0x18, 0x11, 0xe3, 0x81, 0x11, 0xf6, 0xfc, 0xaf, 0x65, 0x7c, 0xef, 0x6b, 0x29, 0xf4, 0xbd, 0x16, 0xc0,
-	0xec, 0xd9, 0x02, 0x67, 0x03, 0xe8, 0xcc, 0x19, 0x51, 0x27, 0x6f, 0x46, 0xd3, 0x40, 0xa7, 0x23, 0x44, 0x7b, 0x1d,
-	0xc1, 0xda, 0xed, 0x12, 0x6c, 0xfc, 0x2e, 0x12, 0x6f, 0x2d, 0xa2, 0x3d, 0x8f, 0x60, 0xdf, 0xf5, 0x22, 0x89, 0xbe,
-	0x47, 0x88, 0x36, 0x2a, 0x82, 0x5d, 0xab, 0x22, 0xce, 0x31, 0x2b, 0x62, 0xb4, 0x5d, 0x11, 0x5c, 0x30, 0x2c, 0x62,
-	0x8d, 0x65, 0x11, 0xae, 0x5d, 0x90, 0x60, 0xed, 0x83, 0xf1, 0xf3, 0x8d, 0x41, 0x32, 0x2f, 0x24, 0xc8, 0xb8, 0x61,
-	0xc2, 0x7d, 0x3f, 0x8c, 0xec, 0xdc, 0xdc, 0xda, 0x78, 0x22, 0xc1, 0x17, 0x84, 0xe6, 0xf9, 0x22, 0x31, 0xbe, 0xd0,
-	0x4a, 0xde, 0x48, 0x6c, 0x41, 0x68, 0xd6, 0x1f, 0x09, 0x57, 0x0e, 0x19, 0xd1, 0xcc, 0x23, 0x23, 0x84, 0x2e, 0x19,
-	0x91, 0xcc, 0x27, 0x09, 0x32, 0x4e, 0x49, 0xb8, 0xe7, 0x95, 0x91, 0xf2, 0xdd, 0x32, 0x72, 0xe8, 0x97, 0x11, 0x39,
-	0x19, 0xc7, 0x3a, 0x5b, 0x44, 0xbb, 0x26, 0xc1, 0xd6, 0x37, 0x7f, 0xe9, 0xbc, 0xea, 0x5c, 0xa5, 0x75, 0xfe, 0x92,
-	0x5e, 0x38, 0x23, 0x42, 0xae, 0x04, 0x08, 0xaa, 0x12, 0x60, 0xb9, 0x39, 0x80, 0xa4, 0x40, 0x40, 0x92, 0x76, 0x00,
-	0x4a, 0x8a, 0x01, 0x28, 0xea, 0x04, 0x00, 0x32, 0x6d, 0x41, 0xe6, 0x8d, 0x20, 0xf9, 0x03, 0x4b, 0x9d, 0x11, 0x9c,
-	0x25, 0xc0, 0xa8, 0x06, 0x06, 0x69, 0x96, 0x80, 0xe4, 0x16, 0x06, 0x44, 0x9a, 0x3e, 0x40, 0x69, 0xfa, 0x00, 0xc5,
-	0xe9, 0x27, 0xe0, 0x75, 0x23, 0xe4, 0x81, 0x7c, 0x50, 0x61, 0xef, 0x35, 0x0b, 0x19, 0x10, 0x9c, 0x3e, 0xc0, 0x32,
-	0x7d, 0x00, 0x69, 0xfa, 0x80, 0xa4, 0x59, 0x02, 0x94, 0x66, 0x09, 0x50, 0x9c, 0x25, 0x00, 0x24, 0x64, 0x41, 0x6e,
-	0xf1, 0x43, 0xb0, 0xff, 0x3e, 0x7f, 0x58, 0x8a, 0xc7, 0xbc, 0x66, 0xa3, 0x07, 0xc4, 0xfa, 0x34, 0x9d, 0x63, 0x46,
-	0x51, 0x10, 0xa2, 0xe5, 0x41, 0xb0, 0x16, 0x0a, 0xc1, 0xae, 0x64, 0x88, 0x73, 0xc4, 0x43, 0x8c, 0x96, 0x11, 0xc1,
-	0x46, 0x50, 0x84, 0x1b, 0x69, 0x11, 0xae, 0x44, 0x46, 0xa8, 0x96, 0x5b, 0x84, 0x6f, 0x0d, 0x82, 0x12, 0x8c, 0xc8,
-	0xd2, 0xc8, 0xc7, 0xc8, 0x92, 0x60, 0x4f, 0xa0, 0xed, 0x17, 0x6d, 0x32, 0x81, 0x46, 0xc4, 0x08, 0x34, 0xc2, 0x46,
-	0xa0, 0x11, 0xf6, 0x05, 0x1a, 0x39, 0x4f, 0xa0, 0x91, 0x31, 0x02, 0x8d, 0xb0, 0x15, 0x68, 0xc4, 0xad, 0x40, 0x23,
-	0xae, 0x05, 0x1a, 0x51, 0x23, 0xd0, 0x16, 0xbe, 0x35, 0x48, 0x26, 0xd0, 0x16, 0x59, 0x1a, 0xf9, 0x58, 0x81, 0x46,
-	0xd8, 0x0a, 0xf4, 0xd7, 0x46, 0x96, 0x29, 0xdc, 0xfe, 0xca, 0x62, 0x04, 0x84, 0x24, 0x08, 0x08, 0x0a, 0x0f, 0x60,
-	0xb9, 0x39, 0x80, 0x24, 0x32, 0x40, 0x92, 0xb4, 0x00, 0x4a, 0x82, 0x02, 0x28, 0xca, 0x08, 0x00, 0x12, 0x8f, 0x20,
-	0xa1, 0x28, 0xea, 0xf1, 0x22, 0x56, 0x29, 0x18, 0x0a, 0x42, 0xf3, 0x06, 0x24, 0x0b, 0x8f, 0x02, 0x43, 0x78, 0x14,
-	0x30, 0x85, 0x47, 0x41, 0x38, 0x0a, 0x0a, 0xc4, 0x51, 0x50, 0x20, 0x8a, 0x82, 0x02, 0xd0, 0xbc, 0x05, 0x89, 0x7f,
-	0x4e, 0xe3, 0x6a, 0xd2, 0x4d, 0xc0, 0x0e, 0xd9, 0x9d, 0x59, 0xc8, 0xce, 0x9f, 0xf6, 0xce, 0x9b, 0xf6, 0xce, 0x4c,
-	0x7b, 0xa7, 0xa2, 0xba, 0x10, 0x76, 0x3d, 0xf4, 0x1b, 0x5e, 0x88, 0x98, 0xd9, 0xd3, 0x9f, 0xeb, 0xe0, 0xe9, 0xff,
-	0x57, 0x63, 0x3f, 0x23, 0xf9, 0x40, 0xd3, 0x07, 0x84, 0xf4, 0x00, 0x08, 0x2e, 0x08, 0x60, 0x59, 0x10, 0x80, 0xb4,
-	0x20, 0x40, 0xd2, 0xbc, 0x01, 0x4a, 0x7a, 0x00, 0x28, 0xea, 0x01, 0x00, 0x5a, 0x49, 0x42, 0xde, 0x35, 0xc5, 0x6f,
-	0x5f, 0x3e, 0xa4, 0x22, 0x40, 0x90, 0x2c, 0xe5, 0x0b, 0x0c, 0x29, 0x5f, 0xc0, 0x94, 0xf2, 0x05, 0xc9, 0xc5, 0x0e,
-	0x04, 0xd7, 0x02, 0x02, 0x91, 0xd8, 0x01, 0x49, 0x99, 0x9f, 0x91, 0xf0, 0xa1, 0x1a, 0xf2, 0x07, 0x9a, 0x2c, 0x20,
-	0x54, 0xc9, 0x22, 0x02, 0xd3, 0x07, 0x58, 0xa6, 0x8f, 0x20, 0x7f, 0x11, 0x03, 0x51, 0x5a, 0x14, 0x20, 0x69, 0xee,
-	0x00, 0x25, 0xd1, 0x0b, 0xb4, 0x93, 0x8a, 0xe5, 0x1d, 0x9b, 0x33, 0x20, 0x5e, 0x29, 0xf5, 0x0e, 0xcd, 0x19, 0x40,
-	0x55, 0x4a, 0xbd, 0xd3, 0xe6, 0x0c, 0x84, 0xae, 0xb1, 0xde, 0xb1, 0x39, 0x03, 0xa2, 0x2a, 0xaa, 0x77, 0x9d, 0x67,
-	0xb1, 0xed, 0x77, 0xe9, 0xd7, 0x37, 0x10, 0xf1, 0x7c, 0xef, 0x1d, 0x7c, 0x9b, 0x01, 0x41, 0xe5, 0x7b, 0xef, 0xd4,
-	0xcf, 0xbe, 0x21, 0xa1, 0x7d, 0xef, 0x1d, 0xff, 0x86, 0x16, 0x42, 0x79, 0x2c, 0x79, 0xd7, 0x14, 0xbd, 0x22, 0xe6,
-	0xb3, 0x31, 0x82, 0xb3, 0xa3, 0x5b, 0xdc, 0xc9, 0xa0, 0xc1, 0x67, 0xb8, 0xb6, 0xfd, 0x8c, 0x74, 0xdd, 0x20, 0x1b,
-	0xe1, 0x78, 0x44, 0xc6, 0x6b, 0xe7, 0xc8, 0xc8, 0x82, 0x9f, 0x64, 0x63, 0x8c, 0xcb, 0x64, 0xac, 0xf6, 0x9e, 0x8c,
-	0xd4, 0x8e, 0x84, 0x64, 0x5d, 0x90, 0x93, 0x71, 0xaf, 0x8c, 0xd4, 0x9e, 0x96, 0x93, 0x9e, 0xd3, 0x65, 0x23, 0x7e,
-	0xa0, 0x23, 0xd7, 0x15, 0xb3, 0x01, 0xda, 0x2b, 0x33, 0xd2, 0x38, 0x68, 0xc6, 0x1a, 0x5f, 0x45, 0x16, 0xdd, 0x36,
-	0xc3, 0xb5, 0x07, 0x67, 0xa4, 0xeb, 0xcc, 0xd9, 0x08, 0xc7, 0xaf, 0x33, 0x5e, 0xbb, 0x78, 0x46, 0x16, 0xbc, 0x3d,
-	0x1b, 0x63, 0x1c, 0x3f, 0x63, 0x75, 0x0c, 0xc8, 0x48, 0x1d, 0x0e, 0x90, 0xc4, 0xc8, 0x90, 0xe1, 0x3a, 0x48, 0x64,
-	0xa4, 0x1b, 0x2f, 0xb2, 0x11, 0x4e, 0xe8, 0xc8, 0x78, 0x1d, 0x45, 0x32, 0xb2, 0x10, 0x50, 0xb2, 0x31, 0x26, 0xb6,
-	0x64, 0xac, 0x09, 0x33, 0x19, 0xab, 0x22, 0x0e, 0x72, 0xe7, 0x82, 0xdd, 0x98, 0x38, 0x94, 0x91, 0xd6, 0xdc, 0x7f,
-	0x6f, 0x3a, 0x31, 0x69, 0x2b, 0xfe, 0x3b, 0xf7, 0x60, 0x10, 0xc1, 0xee, 0x8b, 0xe0, 0x4d, 0x77, 0xa2, 0xdb, 0x4d,
-	0x9f, 0x16, 0x52, 0x0a, 0xfe, 0x1e, 0x7b, 0x12, 0x4c, 0x49, 0x3b, 0x42, 0x20, 0xdc, 0x02, 0x33, 0x8a, 0x4d, 0x08,
-	0x79, 0xce, 0x59, 0x8a, 0xe3, 0xdf, 0xa5, 0xcd, 0x2e, 0x88, 0xad, 0xa1, 0x7f, 0xe7, 0x6f, 0x2a, 0xf0, 0x5d, 0xf2,
-	0x2f, 0x2a, 0x18, 0xd8, 0x5d, 0xa1, 0x1c, 0xe6, 0xe7, 0x29, 0xf2, 0x61, 0x7e, 0x5e, 0x2b, 0x1c, 0xe6, 0xcf, 0x07,
-	0xd9, 0x55, 0x3b, 0x87, 0xf9, 0x73, 0xca, 0x5d, 0x3f, 0x9f, 0xd3, 0x57, 0xab, 0x33, 0x92, 0x30, 0xe7, 0xf4, 0x99,
-	0x89, 0xab, 0x76, 0xef, 0x1e, 0xa9, 0xb3, 0x19, 0x6c, 0xee, 0x4e, 0xb0, 0x77, 0x77, 0x10, 0x1e, 0x8a, 0x3c, 0xc3,
-	0xb5, 0xe0, 0x73, 0xd2, 0x15, 0x3f, 0xa2, 0x99, 0x12, 0x90, 0x40, 0x55, 0x20, 0xbe, 0x2c, 0x5d, 0x60, 0xd5, 0x92,
-	0xb1, 0x9e, 0x72, 0x70, 0x80, 0x2f, 0xc4, 0xdc, 0x2d, 0x5d, 0xc9, 0x58, 0x81, 0xfa, 0x6e, 0xc9, 0x7c, 0x0c, 0x94,
-	0x28, 0x50, 0x42, 0xb4, 0x28, 0x13, 0xec, 0x0a, 0x31, 0x92, 0x99, 0xf8, 0x22, 0x84, 0x82, 0x8b, 0xc8, 0xd2, 0x0e,
-	0xb2, 0xc2, 0x22, 0xdc, 0x13, 0x53, 0xa4, 0x5c, 0x01, 0x45, 0xea, 0x6c, 0x56, 0x67, 0x84, 0x42, 0xb0, 0x15, 0xc7,
-	0x7b, 0xec, 0x11, 0xbe, 0x37, 0x3d, 0xc2, 0xf7, 0xa6, 0x47, 0x98, 0xff, 0xe8, 0x2d, 0xc2, 0x36, 0x01, 0xbe, 0x37,
-	0x3d, 0xc2, 0xf7, 0xb6, 0x47, 0xf8, 0xde, 0xf6, 0x08, 0xdf, 0xeb, 0x1e, 0xe1, 0x7b, 0xd3, 0x23, 0xa4, 0x9f, 0x5f,
-	0x7b, 0x65, 0x11, 0xbd, 0x02, 0x82, 0xf5, 0x32, 0x08, 0x76, 0xd7, 0x42, 0x9c, 0xb3, 0x20, 0x62, 0xf4, 0xaa, 0x08,
-	0x36, 0x4b, 0x23, 0xdc, 0xac, 0x8f, 0x70, 0xb5, 0x48, 0x42, 0xf5, 0x4a, 0xb9, 0xb5, 0xa6, 0x11, 0xbd, 0xd2, 0xbc,
-	0xb5, 0xa6, 0x61, 0x77, 0xa5, 0xa6, 0xb5, 0xa6, 0x19, 0xbd, 0x52, 0xd5, 0x5a, 0xd3, 0xb8, 0x59, 0x69, 0xd6, 0x5a,
-	0xd3, 0xa8, 0x59, 0x29, 0xb8, 0xda, 0xab, 0x12, 0x6e, 0x56, 0x8d, 0xa4, 0x59, 0x3b, 0x92, 0xbe, 0x04, 0x70, 0x84,
-	0x27, 0x07, 0xe4, 0x8d, 0x34, 0x90, 0xb4, 0x32, 0x41, 0xd6, 0x4a, 0x06, 0x59, 0x2d, 0x1f, 0xe4, 0xb4, 0x94, 0xe2,
-	0xe7, 0x57, 0x16, 0xd1, 0x92, 0x21, 0x58, 0xcb, 0x84, 0x60, 0x57, 0x1a, 0xc4, 0x39, 0x72, 0x20, 0x46, 0x4b, 0x80,
-	0x60, 0xb3, 0x76, 0xc2, 0xcd, 0xaa, 0x09, 0x57, 0xeb, 0x25, 0x54, 0xad, 0x74, 0x86, 0x8b, 0x9c, 0x99, 0xf5, 0xcd,
-	0xcc, 0xd2, 0x66, 0xfe, 0xaa, 0x66, 0xde, 0x82, 0x66, 0x66, 0x2d, 0x33, 0xbb, 0x8c, 0x99, 0x5d, 0xc1, 0x4c, 0x4f,
-	0x7e, 0xe6, 0xcc, 0xfb, 0xa3, 0x34, 0x33, 0x67, 0x9c, 0x58, 0x10, 0xf1, 0xde, 0x55, 0xce, 0x9a, 0x74, 0x32, 0xe4,
-	0x0f, 0x0b, 0xbc, 0xe1, 0x27, 0x1c, 0xb6, 0xc4, 0x61, 0xdc, 0x01, 0x15, 0x04, 0xa2, 0x7c, 0x02, 0x4d, 0xb4, 0x9c,
-	0xf9, 0xd1, 0x72, 0xe6, 0x47, 0xcb, 0xd9, 0x85, 0x68, 0x39, 0x2b, 0x46, 0xcb, 0x99, 0x1f, 0x2d, 0x67, 0x85, 0x68,
-	0x39, 0x2b, 0x44, 0xcb, 0x99, 0x1b, 0x2d, 0x67, 0x7e, 0xb4, 0x9c, 0x71, 0x89, 0x3a, 0xc8, 0xd7, 0x6e, 0xb4, 0xe0,
-	0x95, 0xa8, 0x8a, 0xbc, 0x35, 0x12, 0x5c, 0x98, 0x27, 0x7d, 0x32, 0x57, 0x2d, 0xcd, 0x55, 0x46, 0x47, 0xa6, 0x62,
-	0x65, 0x06, 0x24, 0x8c, 0xda, 0x42, 0x58, 0xab, 0x0c, 0x39, 0xad, 0x37, 0xe4, 0x5c, 0xe5, 0xe1, 0x00, 0x47, 0x83,
-	0x48, 0x6b, 0x35, 0x22, 0x67, 0x74, 0x89, 0xa4, 0x51, 0x28, 0x92, 0x4a, 0xab, 0x48, 0x69, 0xd5, 0xe6, 0x5f, 0xcd,
-	0x1a, 0x38, 0x22, 0x33, 0x4a, 0x2e, 0x7e, 0x31, 0xcb, 0x1b, 0x71, 0xeb, 0xeb, 0x61, 0xe1, 0x4f, 0xe1, 0x93, 0x7f,
-	0x93, 0xa5, 0x7f, 0x13, 0x63, 0x02, 0xfe, 0x97, 0x94, 0x98, 0x66, 0x08, 0xad, 0x40, 0x40, 0x6d, 0x03, 0xc2, 0x68,
-	0x0b, 0x10, 0xc6, 0xd5, 0xbf, 0xd0, 0x8e, 0xf6, 0x85, 0xd4, 0xba, 0x17, 0xc6, 0x68, 0x5e, 0x28, 0xa3, 0x77, 0xa1,
-	0x94, 0xd6, 0x85, 0xd0, 0x3a, 0xc7, 0x2f, 0xd3, 0x0c, 0x8c, 0x70, 0x8c, 0xbe, 0x0b, 0x5f, 0xa5, 0xb1, 0xfc, 0xad,
-	0x27, 0xeb, 0x85, 0xf7, 0xe0, 0x4f, 0xde, 0xe5, 0x4b, 0xef, 0x72, 0xa3, 0x63, 0xef, 0x6b, 0x26, 0x4c, 0x46, 0x91,
-	0xa2, 0x7a, 0x09, 0xd1, 0xba, 0x25, 0x58, 0x2b, 0x96, 0x60, 0x57, 0xab, 0xc4, 0x39, 0x2a, 0x25, 0x46, 0xeb, 0x93,
-	0x60, 0xa3, 0x4c, 0xc2, 0x8d, 0x26, 0x09, 0x57, 0x6a, 0x24, 0x54, 0xeb, 0x90, 0xbf, 0x2f, 0x31, 0xc8, 0xd7, 0x6e,
-	0xb4, 0xe7, 0x7d, 0x5b, 0x42, 0x91, 0xb7, 0x46, 0x82, 0x0b, 0xf3, 0xa4, 0x4f, 0xe6, 0xaa, 0xa5, 0xb9, 0xca, 0xe8,
-	0xca, 0x7c, 0xc3, 0x80, 0x99, 0xac, 0x17, 0x85, 0xfa, 0xca, 0x09, 0xad, 0xb6, 0x9c, 0xd5, 0xda, 0xcb, 0x59, 0x57,
-	0x89, 0xf9, 0x10, 0x47, 0x97, 0xf9, 0x00, 0xad, 0xd2, 0x9c, 0x35, 0x9a, 0xcd, 0x69, 0xa3, 0xe0, 0x9c, 0x56, 0x7a,
-	0xce, 0x49, 0xad, 0xee, 0x8c, 0x45, 0xad, 0xe7, 0x84, 0x56, 0xbe, 0x62, 0x5d, 0x1b, 0xc8, 0xc6, 0xdc, 0x96, 0x74,
-	0xb4, 0x28, 0x4d, 0xe6, 0x53, 0xe9, 0x56, 0xcb, 0xd2, 0xad, 0x8c, 0x99, 0xe4, 0xac, 0x63, 0x2d, 0x24, 0x68, 0xb4,
-	0x93, 0x04, 0x69, 0x0b, 0x49, 0xb8, 0xb6, 0x8d, 0x84, 0xbb, 0x56, 0x91, 0x48, 0xc7, 0x1e, 0x12, 0xa5, 0x2d, 0x21,
-	0xe1, 0xc6, 0x06, 0x12, 0x61, 0xb4, 0x9f, 0x08, 0xa5, 0xf7, 0x04, 0x6b, 0x8d, 0xcb, 0x77, 0x2c, 0x06, 0x4a, 0x0c,
-	0x46, 0xcb, 0xee, 0x37, 0x2c, 0x34, 0x7b, 0x6b, 0xe5, 0xb9, 0xb0, 0x8f, 0xfb, 0x64, 0x2f, 0x5c, 0xda, 0x0b, 0x8d,
-	0x06, 0xed, 0xb7, 0x11, 0x98, 0x8a, 0x5d, 0x12, 0x54, 0x1d, 0x21, 0x5a, 0x73, 0x04, 0x6b, 0xc5, 0x11, 0xec, 0xea,
-	0x8d, 0x38, 0x47, 0x6d, 0xc4, 0x68, 0xad, 0x11, 0x6c, 0x94, 0x46, 0xb8, 0xd1, 0x19, 0xe1, 0x4a, 0x65, 0x84, 0x6a,
-	0x8d, 0x71, 0x13, 0x6c, 0x90, 0xaf, 0xdd, 0xe8, 0xcb, 0x6b, 0x82, 0x29, 0xf2, 0xd6, 0x48, 0x70, 0x61, 0x9e, 0xf4,
-	0xc9, 0x5c, 0xb5, 0x34, 0x57, 0x19, 0x4d, 0x99, 0x9e, 0x18, 0x33, 0x66, 0x0b, 0x3c, 0xf3, 0xb7, 0xc0, 0x33, 0x7f,
-	0x0b, 0x3c, 0xbb, 0xb0, 0x05, 0x9e, 0x15, 0xb7, 0xc0, 0x33, 0x7f, 0x0b, 0x3c, 0x2b, 0x6c, 0x81, 0x67, 0x85, 0x2d,
-	0xf0, 0xcc, 0xdd, 0x02, 0xcf, 0x0a, 0x5b, 0x60, 0x3e, 0xd3, 0x39, 0xc8, 0xd7, 0x6e, 0x14, 0xe5, 0x9d, 0xe8, 0x54,
-	0xe4, 0xad, 0x91, 0xe0, 0xc2, 0x3c, 0xe9, 0x93, 0xb9, 0x6a, 0x69, 0xae, 0x32, 0x8a, 0x32, 0xa7, 0x20, 0x13, 0x73,
-	0xdd, 0xe8, 0x28, 0x75, 0x2b, 0xaf, 0x59, 0x3d, 0x80, 0x90, 0x66, 0x00, 0x41, 0xa5, 0x00, 0x6c, 0x8f, 0x37, 0x5e,
-	0xb3, 0x2a, 0x00, 0x49, 0x5a, 0x00, 0x28, 0x29, 0x00, 0xa0, 0x28, 0x7b, 0x00, 0x48, 0xec, 0x82, 0xc0, 0xa1, 0x9b,
-	0x6b, 0x73, 0xe8, 0xe6, 0xda, 0x1c, 0xba, 0xb9, 0xf6, 0x0f, 0xdd, 0x5c, 0x7b, 0x87, 0x6e, 0xae, 0xcd, 0xa1, 0x9b,
-	0x6b, 0x7b, 0xe8, 0xe6, 0xda, 0x1e, 0xba, 0xb9, 0xd6, 0x87, 0x6e, 0xae, 0xcd, 0xa1, 0x9b, 0xeb, 0x74, 0xe8, 0x86,
-	0x8f, 0x9a, 0x5e, 0xf3, 0x41, 0x16, 0x86, 0x6e, 0xf0, 0x78, 0xe5, 0x8d, 0x39, 0x5e, 0x79, 0xe3, 0x1f, 0xaf, 0xbc,
-	0xf1, 0x8e, 0x57, 0xde, 0x98, 0xe3, 0x95, 0x37, 0xa5, 0xe3, 0x95, 0x37, 0xf6, 0x78, 0xe5, 0x8d, 0x3d, 0x5e, 0x79,
-	0xa3, 0x8f, 0x57, 0x7e, 0x68, 0xde, 0xe6, 0x0f, 0xe4, 0x83, 0x3a, 0xfd, 0xf6, 0x21, 0x7f, 0x6f, 0x0f, 0xb0, 0x3d,
-	0xdc, 0xf6, 0x81, 0xdf, 0xd0, 0x03, 0x92, 0x4f, 0x16, 0x08, 0x7d, 0xd6, 0xed, 0x03, 0xbf, 0x80, 0x07, 0x44, 0x1d,
-	0x65, 0xfb, 0xd0, 0x38, 0xea, 0x48, 0x3e, 0x90, 0x8f, 0x22, 0x82, 0xee, 0x29, 0xf8, 0x1c, 0xef, 0x31, 0x37, 0x6b,
-	0x9c, 0xfb, 0x6b, 0x9c, 0x7b, 0x6b, 0x9c, 0x9b, 0x35, 0xce, 0x4b, 0x6b, 0x9c, 0xdb, 0x35, 0xce, 0xf5, 0x51, 0xbe,
-	0x0f, 0x49, 0x21, 0x02, 0xdc, 0xca, 0xa1, 0xa8, 0x0f, 0x4d, 0x04, 0x49, 0xaf, 0x12, 0x3e, 0x34, 0xa1, 0x62, 0x24,
-	0x1f, 0xd2, 0x09, 0x29, 0x41, 0xe0, 0xe0, 0x53, 0x02, 0xe3, 0x20, 0xd4, 0x31, 0x21, 0x5a, 0x08, 0x04, 0xbb, 0x92,
-	0x20, 0xce, 0x11, 0x07, 0x31, 0x5a, 0x26, 0x04, 0x17, 0x04, 0x43, 0xac, 0x91, 0x0e, 0xe1, 0xda, 0x0c, 0x08, 0xd6,
-	0xb6, 0xc0, 0x8d, 0xa8, 0x91, 0x42, 0xb4, 0x55, 0x78, 0x8d, 0x28, 0x45, 0xce, 0xcd, 0x7d, 0x8d, 0x91, 0x10, 0x7c,
-	0x41, 0x3e, 0x9e, 0xb9, 0x10, 0xe3, 0xcb, 0xa7, 0x64, 0x38, 0xc4, 0x16, 0xe4, 0x63, 0x4d, 0x88, 0x70, 0x65, 0x47,
-	0xdc, 0x62, 0x9b, 0xe4, 0x08, 0x5a, 0x14, 0x37, 0xd4, 0x94, 0xbd, 0x18, 0xdb, 0x32, 0x0d, 0x35, 0x66, 0xa2, 0xb4,
-	0xd1, 0xc0, 0x08, 0xd1, 0x02, 0x24, 0xd8, 0x15, 0x20, 0x71, 0x8e, 0x00, 0x89, 0xd1, 0x02, 0x24, 0xb8, 0x20, 0x40,
-	0x62, 0x8d, 0x00, 0x09, 0xd7, 0x06, 0x46, 0xb0, 0x36, 0xb0, 0x08, 0xa3, 0x81, 0x11, 0xa2, 0x0d, 0x2c, 0xc1, 0xae,
-	0x81, 0x45, 0x72, 0x6e, 0xee, 0x6b, 0x0c, 0x8c, 0xe0, 0x0b, 0xf2, 0xf1, 0x0c, 0x8c, 0x18, 0x5f, 0x3e, 0x25, 0x03,
-	0x23, 0xb6, 0x20, 0x1f, 0x6b, 0x60, 0x84, 0x2b, 0x03, 0xe3, 0x83, 0xda, 0x93, 0x1c, 0x41, 0x03, 0xe3, 0x83, 0xda,
-	0xca, 0x5e, 0x8c, 0x81, 0x99, 0x83, 0xda, 0xc2, 0xe4, 0x27, 0xcf, 0xe4, 0xf1, 0xce, 0xc9, 0x33, 0x9f, 0xf4, 0x45,
-	0xea, 0x9f, 0x3c, 0xf3, 0x79, 0x23, 0xde, 0xf2, 0xc9, 0x33, 0x7f, 0x8c, 0x15, 0xb5, 0x73, 0xf2, 0xcc, 0x27, 0x8d,
-	0x59, 0xe6, 0xc7, 0x16, 0x46, 0x2e, 0x6e, 0x4c, 0xb4, 0x78, 0x6c, 0xc1, 0x1d, 0x32, 0x2f, 0x3c, 0xcf, 0x1a, 0x2d,
-	0x92, 0x3f, 0x94, 0xb3, 0x6b, 0xc0, 0xc8, 0x5f, 0x92, 0x73, 0xd1, 0x98, 0x71, 0xcc, 0x45, 0x39, 0x3b, 0x86, 0x8d,
-	0xac, 0x36, 0xef, 0xfc, 0x18, 0xc7, 0xc4, 0xc3, 0x33, 0x53, 0xcf, 0x4f, 0x71, 0xb8, 0xf6, 0x6b, 0xcd, 0xde, 0x3f,
-	0xc3, 0x91, 0xf8, 0x8f, 0x6d, 0x7d, 0xdf, 0xe7, 0x0f, 0xa9, 0xbe, 0x17, 0x24, 0xd5, 0xf7, 0x82, 0x64, 0xf5, 0xbd,
-	0xc0, 0x50, 0xdf, 0x0b, 0x98, 0xea, 0x7b, 0x41, 0xb8, 0xbe, 0x17, 0x88, 0xeb, 0x7b, 0x81, 0xa8, 0xbe, 0x17, 0x20,
-	0xd5, 0xf7, 0x8c, 0x04, 0x4f, 0xed, 0x4d, 0xf8, 0x43, 0x2a, 0x81, 0x05, 0xc9, 0x4a, 0x60, 0x81, 0xa1, 0x04, 0x16,
-	0x30, 0x95, 0xc0, 0x82, 0xa8, 0x12, 0x58, 0x08, 0x2e, 0x81, 0x05, 0x4a, 0x67, 0xd1, 0x05, 0x49, 0x45, 0x3d, 0x23,
-	0x70, 0x8a, 0xfe, 0x23, 0x6f, 0x46, 0x00, 0x21, 0x21, 0x03, 0x82, 0xd3, 0x07, 0xd8, 0xda, 0xf7, 0x47, 0xde, 0x8c,
-	0x00, 0xa2, 0xad, 0xf4, 0xa3, 0x6c, 0x46, 0xe0, 0x66, 0x51, 0xc8, 0x00, 0xa8, 0x48, 0xf0, 0x31, 0x6c, 0x46, 0x36,
-	0xcd, 0x6d, 0x86, 0x00, 0xb4, 0xbb, 0x93, 0x74, 0x40, 0xe6, 0x63, 0x73, 0x34, 0x75, 0xcc, 0x6c, 0x3a, 0x8f, 0x0a,
-	0x08, 0xc5, 0x09, 0x44, 0xf0, 0x3b, 0x19, 0x02, 0xdb, 0xb3, 0xb9, 0x1f, 0xb3, 0x33, 0xa6, 0x30, 0x34, 0x7d, 0x53,
-	0x43, 0x10, 0x7d, 0xee, 0xf6, 0xa3, 0x1c, 0x21, 0x95, 0x51, 0x5f, 0xce, 0xdf, 0xbe, 0xd4, 0xb0, 0xb3, 0xfc, 0xd8,
-	0x59, 0xcb, 0xee, 0xf9, 0x63, 0xfa, 0x23, 0xa7, 0x88, 0xe8, 0x9d, 0xff, 0xc7, 0xe6, 0xec, 0xa9, 0xc8, 0x6b, 0x67,
-	0x14, 0xb9, 0xf3, 0xd5, 0x06, 0x47, 0x4b, 0x01, 0xa4, 0x65, 0x00, 0x92, 0x5b, 0x1d, 0x10, 0x69, 0x7d, 0x00, 0x91,
-	0xd5, 0x01, 0x42, 0xda, 0x13, 0x24, 0x6d, 0x1c, 0x45, 0x5b, 0x7b, 0x5c, 0xcb, 0xde, 0x2c, 0x98, 0xfe, 0x28, 0x69,
-	0x86, 0x60, 0x28, 0x17, 0xfc, 0x50, 0x3f, 0xad, 0x93, 0x71, 0x30, 0xf8, 0x1c, 0x4c, 0x47, 0x3e, 0xa4, 0x48, 0x2e,
-	0x48, 0x16, 0xbe, 0x05, 0x06, 0x9b, 0x16, 0x30, 0xd9, 0xb4, 0x20, 0x2a, 0x3a, 0x0b, 0xc1, 0xc6, 0x2e, 0x10, 0xc7,
-	0x61, 0x81, 0x28, 0xf8, 0x32, 0x70, 0x42, 0x49, 0x9d, 0xb3, 0x0f, 0x46, 0xad, 0x67, 0x47, 0x7f, 0x7c, 0xa8, 0x87,
-	0x43, 0x52, 0x7e, 0xa8, 0x47, 0xc3, 0x3a, 0x8e, 0x3a, 0x87, 0x7a, 0x34, 0xe7, 0x44, 0xd4, 0xfc, 0x50, 0x8f, 0x86,
-	0x4d, 0x6c, 0x55, 0x87, 0x7a, 0x34, 0xae, 0xa2, 0x6c, 0x7e, 0xa8, 0x47, 0xc1, 0x18, 0x6f, 0xf3, 0x02, 0x5c, 0xc3,
-	0x6e, 0xe4, 0x35, 0x05, 0xb8, 0x66, 0x74, 0x0c, 0x76, 0x0b, 0x70, 0xcd, 0x9a, 0x68, 0x9c, 0x17, 0xe0, 0x1a, 0xd6,
-	0x71, 0x39, 0xc2, 0x2b, 0xa3, 0x55, 0x13, 0xa1, 0x09, 0xd6, 0x61, 0x9a, 0x60, 0xd7, 0xe9, 0x89, 0x73, 0x02, 0x36,
-	0x31, 0x3a, 0x6a, 0x13, 0x6c, 0x42, 0x37, 0xe1, 0x26, 0x7e, 0x13, 0xae, 0x82, 0x38, 0xa1, 0x3a, 0x92, 0x47, 0x58,
-	0x87, 0xf3, 0x84, 0xe6, 0x31, 0x3d, 0xa2, 0x18, 0x60, 0x09, 0xd1, 0xd1, 0x9d, 0x60, 0x1d, 0xe2, 0x13, 0xec, 0x7c,
-	0x1d, 0x23, 0x71, 0x4e, 0xb0, 0x4f, 0x8c, 0x13, 0xf1, 0x89, 0xd2, 0x61, 0x9f, 0x60, 0x13, 0xfb, 0x09, 0x37, 0x09,
-	0x20, 0xe2, 0x26, 0x0b, 0x44, 0x18, 0x53, 0x01, 0x21, 0x3a, 0x3c, 0x12, 0x6c, 0x92, 0x42, 0xc4, 0x77, 0x46, 0x09,
-	0x26, 0x3d, 0x10, 0x7c, 0xc1, 0x5c, 0xbc, 0x44, 0x41, 0x8c, 0xce, 0x16, 0x04, 0x17, 0x52, 0x06, 0xb1, 0x26, 0x6f,
-	0x10, 0xae, 0x93, 0x07, 0xc1, 0x3a, 0x83, 0x44, 0xd8, 0xa4, 0x91, 0x08, 0xef, 0x8d, 0x08, 0x4c, 0x42, 0x21, 0x58,
-	0x67, 0x95, 0x04, 0xbb, 0xa9, 0x25, 0x92, 0x5e, 0x7e, 0x89, 0x0c, 0x26, 0x19, 0x42, 0x74, 0xa6, 0x21, 0xd8, 0x4d,
-	0x37, 0xc4, 0x39, 0x39, 0x87, 0x18, 0x9d, 0x78, 0x08, 0x2e, 0x64, 0x1f, 0x62, 0x4d, 0x0a, 0x22, 0xdc, 0xe4, 0x21,
-	0xc2, 0x55, 0x32, 0x8a, 0xe8, 0xc9, 0x48, 0xfe, 0x6c, 0x11, 0xdf, 0xa6, 0xdc, 0x04, 0x95, 0x9f, 0xc5, 0x94, 0x70,
-	0xee, 0x9c, 0xc5, 0xf4, 0x49, 0x93, 0xb2, 0x4a, 0x67, 0x31, 0xfd, 0x11, 0x5e, 0xfa, 0x72, 0xce, 0x62, 0xfa, 0xa4,
-	0x4d, 0x65, 0xde, 0x59, 0x4c, 0x9f, 0xd5, 0x69, 0xcd, 0x39, 0x8b, 0xe9, 0x92, 0x59, 0x8a, 0x73, 0x36, 0xff, 0x3e,
-	0xe9, 0xa7, 0x3b, 0x7f, 0xf3, 0xef, 0xf3, 0x26, 0xf5, 0x95, 0x37, 0xff, 0xfe, 0x18, 0x9b, 0x06, 0x9d, 0xcd, 0xbf,
-	0x4f, 0x9a, 0x94, 0x08, 0xe4, 0xaa, 0x60, 0x4d, 0x36, 0x3d, 0x22, 0x69, 0x92, 0x24, 0x92, 0x7e, 0xec, 0xc3, 0x11,
-	0x5e, 0xc2, 0x44, 0xde, 0xa4, 0x4d, 0x24, 0x6d, 0xf2, 0x44, 0xd6, 0xa6, 0x50, 0x64, 0x75, 0x22, 0x45, 0xce, 0xa4,
-	0x53, 0x20, 0x4d, 0x52, 0xcd, 0x38, 0x95, 0x5a, 0xf1, 0x4b, 0x6e, 0x98, 0x9a, 0x10, 0x37, 0x69, 0x16, 0x49, 0x93,
-	0x6c, 0x33, 0xd2, 0x4d, 0xb9, 0x38, 0xc2, 0x4b, 0xbc, 0x19, 0xef, 0xa5, 0x5f, 0x1c, 0xa0, 0xbe, 0x22, 0x99, 0x93,
-	0xfc, 0x85, 0x79, 0x97, 0xb5, 0x09, 0x19, 0x58, 0x9b, 0x96, 0x81, 0xcc, 0x92, 0x33, 0xe2, 0x26, 0xe1, 0x20, 0x69,
-	0x13, 0x35, 0x7e, 0xa3, 0xae, 0xa0, 0x6a, 0x9b, 0xb4, 0x91, 0xfc, 0xa1, 0xf9, 0xba, 0x09, 0x1c, 0x79, 0x93, 0xc6,
-	0x91, 0x2c, 0x25, 0x73, 0x1c, 0x63, 0x53, 0x3a, 0xb2, 0x26, 0xb1, 0x23, 0x69, 0xd2, 0x3b, 0x90, 0x36, 0xc9, 0x03,
-	0xb9, 0x2f, 0x08, 0xd1, 0x26, 0x7c, 0x24, 0x4d, 0xda, 0xcf, 0x48, 0x3f, 0xf9, 0x03, 0xea, 0x96, 0x00, 0xc0, 0x67,
-	0x85, 0x00, 0xe2, 0xa6, 0x1c, 0x40, 0xd2, 0x2f, 0x0a, 0x70, 0x84, 0x57, 0x1a, 0x20, 0x6f, 0x0a, 0x04, 0x24, 0x4b,
-	0x65, 0x02, 0x8e, 0xb1, 0xc5, 0x02, 0xb2, 0xb6, 0x64, 0x40, 0x56, 0x17, 0x0e, 0xc0, 0x9d, 0x0a, 0x9a, 0x3d, 0x97,
-	0xf0, 0x4b, 0x96, 0xee, 0x14, 0x14, 0x73, 0xfc, 0x2d, 0x93, 0xb9, 0xf9, 0x19, 0x93, 0xb9, 0xf9, 0x05, 0x93, 0x79,
-	0xc7, 0xfd, 0xf1, 0x92, 0xb9, 0xf7, 0xbb, 0x25, 0x73, 0xf3, 0x93, 0x25, 0x73, 0xfb, 0x6b, 0x25, 0x73, 0xfb, 0x43,
-	0x25, 0x73, 0xfd, 0x1b, 0x25, 0x73, 0xf3, 0xf3, 0x24, 0x73, 0x3e, 0x3a, 0xaf, 0x11, 0xbd, 0x82, 0xfc, 0xe8, 0xbc,
-	0x86, 0xdd, 0xb5, 0x98, 0xa3, 0xf3, 0x9a, 0xd1, 0xab, 0x52, 0x47, 0xe7, 0x35, 0x6e, 0xd6, 0x97, 0x1d, 0x9d, 0xd7,
-	0xa8, 0x5e, 0x69, 0x7e, 0xf6, 0xdc, 0x85, 0xf5, 0x9a, 0x9d, 0xb3, 0xe7, 0x2e, 0xe7, 0xae, 0xde, 0x3f, 0x7b, 0xee,
-	0xd2, 0x5a, 0x0e, 0xde, 0xd9, 0x73, 0x97, 0x34, 0x12, 0xb1, 0x67, 0xcf, 0x5d, 0x4a, 0xcb, 0x06, 0xcf, 0x63, 0x3b,
-	0xa0, 0x96, 0x8b, 0x39, 0x8f, 0xed, 0x30, 0xae, 0x4c, 0xbc, 0xf3, 0xd8, 0x0e, 0xa9, 0xe5, 0x61, 0xcf, 0x63, 0x3b,
-	0x94, 0x91, 0x85, 0x3e, 0x8f, 0xed, 0x10, 0x5a, 0x0e, 0x7c, 0x6a, 0x59, 0x23, 0x5a, 0x02, 0xf9, 0xa9, 0x65, 0x0d,
-	0xbb, 0x6b, 0x37, 0xa7, 0x96, 0x35, 0xa3, 0x57, 0xad, 0x4e, 0x2d, 0x6b, 0xdc, 0xac, 0x37, 0x3b, 0xb5, 0xac, 0x51,
-	0xbd, 0x52, 0x7d, 0xec, 0xb7, 0x40, 0xe8, 0x75, 0xbb, 0xc7, 0x7e, 0x0b, 0xac, 0x2b, 0x85, 0xd2, 0xb1, 0xdf, 0xc2,
-	0x00, 0x2d, 0x13, 0xff, 0xd8, 0x6f, 0x81, 0x36, 0x12, 0xf2, 0x8e, 0xfd, 0x16, 0x48, 0x2d, 0x2f, 0x39, 0xf8, 0x6a,
-	0x20, 0x2d, 0x23, 0x75, 0xf0, 0xd5, 0xe0, 0xae, 0x5c, 0xec, 0xc1, 0x57, 0x43, 0x69, 0x59, 0xe8, 0x83, 0xaf, 0x86,
-	0x30, 0xeb, 0xcf, 0x0f, 0xbe, 0x1a, 0x58, 0xaf, 0x99, 0xae, 0x7f, 0xe5, 0x40, 0x7a, 0xcd, 0x09, 0xd7, 0x6b, 0x4e,
-	0xb8, 0xbb, 0xe6, 0x44, 0x3a, 0x6b, 0x4e, 0x94, 0x5e, 0x73, 0xc2, 0xcd, 0x9a, 0x13, 0x61, 0xd6, 0x9c, 0x08, 0xb5,
-	0xe6, 0x04, 0xeb, 0x35, 0xb7, 0xc3, 0x5e, 0x19, 0x40, 0xaf, 0x37, 0xa2, 0x7a, 0xb5, 0x11, 0x75, 0xd7, 0x1a, 0x29,
-	0x67, 0xa5, 0x91, 0xd0, 0xeb, 0x8c, 0xa8, 0x59, 0x65, 0x84, 0xcd, 0x1a, 0x23, 0xac, 0x56, 0x18, 0x41, 0xb5, 0xbe,
-	0xdb, 0x66, 0x6d, 0xfc, 0xeb, 0x90, 0xb7, 0xbc, 0x30, 0x84, 0xd2, 0xe1, 0x3f, 0x80, 0xb2, 0x6d, 0x3c, 0xe0, 0xb0,
-	0x79, 0x07, 0x34, 0x6d, 0xd9, 0x01, 0xe2, 0x4d, 0x38, 0x60, 0x7c, 0x3a, 0x0e, 0x30, 0x3a, 0x1e, 0x07, 0x48, 0xda,
-	0x83, 0x0b, 0xf4, 0x56, 0x4e, 0x04, 0xde, 0xf2, 0xef, 0xa5, 0x02, 0x92, 0x55, 0xcf, 0x82, 0xcf, 0x50, 0x0a, 0xfa,
-	0xc8, 0xc2, 0xad, 0x7f, 0x4e, 0xe1, 0xd6, 0x3b, 0x9c, 0x70, 0x6b, 0x4e, 0x24, 0xdc, 0x96, 0x8e, 0x21, 0xdc, 0xda,
-	0xb3, 0x07, 0xb7, 0xe6, 0xc0, 0xc1, 0xad, 0x39, 0x65, 0x70, 0xdb, 0xc1, 0x43, 0x8e, 0xb7, 0x72, 0x42, 0x13, 0xa0,
-	0xb4, 0x6e, 0x80, 0xb2, 0x97, 0x87, 0x02, 0xc3, 0x0f, 0xba, 0x09, 0x98, 0xfa, 0xc5, 0x82, 0xf0, 0xfe, 0x54, 0x20,
-	0xd6, 0x10, 0x3c, 0x84, 0x34, 0x04, 0x48, 0xfa, 0x49, 0x37, 0x46, 0x68, 0x63, 0x92, 0x76, 0x4b, 0xb7, 0x7c, 0x6c,
-	0xb3, 0x9a, 0x26, 0x24, 0x9f, 0x79, 0x6d, 0xd7, 0xc7, 0x7b, 0x79, 0x40, 0xdc, 0xe5, 0xd5, 0xde, 0xf2, 0x70, 0xab,
-	0x8e, 0x37, 0x35, 0xab, 0xae, 0xed, 0xaa, 0x6b, 0x67, 0xd5, 0x69, 0x03, 0xce, 0x3f, 0x5b, 0x70, 0xdb, 0x6c, 0xbb,
-	0x47, 0xf2, 0x21, 0x9d, 0x2c, 0x10, 0x24, 0xfb, 0x0d, 0x21, 0x81, 0xe1, 0x97, 0x54, 0x04, 0x4c, 0x3f, 0x06, 0x24,
-	0x08, 0xff, 0x02, 0x90, 0x40, 0xfa, 0xd7, 0xd1, 0x6e, 0xdb, 0x5f, 0x9c, 0x13, 0x91, 0xf2, 0x4f, 0xce, 0x01, 0x94,
-	0xf9, 0x2d, 0xe0, 0xb0, 0x81, 0x11, 0x30, 0xed, 0xbe, 0x05, 0x51, 0xed, 0x35, 0xb8, 0x01, 0x6f, 0xb4, 0x05, 0x4a,
-	0x9d, 0x34, 0x18, 0x95, 0xf6, 0xd4, 0x8c, 0xf0, 0x69, 0x5d, 0x19, 0x04, 0x3b, 0x59, 0x31, 0x98, 0xb0, 0x7d, 0x1d,
-	0xb3, 0xe3, 0xa6, 0x3d, 0x2b, 0x20, 0x99, 0x29, 0x08, 0x0c, 0xa6, 0x20, 0x60, 0xd2, 0xb9, 0x20, 0xf9, 0xb2, 0x80,
-	0x60, 0x63, 0x10, 0x88, 0xfb, 0x32, 0x02, 0xd1, 0x6f, 0x1a, 0x12, 0xb0, 0x68, 0x23, 0x6a, 0xd2, 0xd3, 0x42, 0x22,
-	0x2a, 0x40, 0xc9, 0x57, 0x01, 0xca, 0x35, 0x23, 0x38, 0x44, 0x54, 0x40, 0x53, 0x44, 0x05, 0x88, 0x23, 0x2a, 0x60,
-	0x6c, 0xb9, 0x80, 0x91, 0xbf, 0x02, 0x92, 0x22, 0xaa, 0x40, 0x33, 0x39, 0x91, 0xbc, 0x90, 0x86, 0xae, 0x20, 0xde,
-	0x89, 0xe9, 0x45, 0xd6, 0xba, 0x15, 0x50, 0x9d, 0x98, 0x5e, 0x98, 0x26, 0xad, 0x10, 0xfa, 0xc4, 0xf4, 0x42, 0xda,
-	0xb1, 0x82, 0xa4, 0xd9, 0x32, 0x02, 0x8d, 0xd7, 0x85, 0xe9, 0xb6, 0x2e, 0x4c, 0x8b, 0x75, 0xe1, 0xf7, 0x55, 0x17,
-	0x18, 0x17, 0x01, 0x54, 0x2d, 0xa8, 0x85, 0xc4, 0x45, 0x80, 0x74, 0xaf, 0x74, 0xa1, 0x1b, 0xa4, 0x0b, 0x8e, 0x8a,
-	0x82, 0x90, 0x91, 0xf7, 0xc7, 0x02, 0xb4, 0x51, 0x31, 0x35, 0xf5, 0x16, 0x9d, 0x6c, 0x78, 0x6d, 0x56, 0x96, 0x42,
-	0x22, 0x22, 0xee, 0xca, 0x6a, 0x9b, 0xb3, 0x16, 0x59, 0x48, 0x84, 0xa1, 0x2a, 0x93, 0x2d, 0x24, 0x22, 0x02, 0x64,
-	0xd7, 0x9b, 0x02, 0xe2, 0x88, 0xbd, 0x60, 0x8d, 0x57, 0xac, 0x55, 0x7a, 0x5d, 0x48, 0xf8, 0x12, 0x68, 0x87, 0x37,
-	0xd4, 0xad, 0xc5, 0x85, 0xdf, 0x4f, 0x5c, 0x78, 0x4d, 0xc4, 0x85, 0xe9, 0x1c, 0x2e, 0x4a, 0xed, 0xc2, 0x85, 0xed,
-	0x11, 0x2e, 0x4c, 0x63, 0x70, 0x61, 0xba, 0x81, 0x0b, 0x8e, 0x5c, 0xa2, 0x2d, 0x08, 0x5c, 0xa2, 0xd3, 0x67, 0xe9,
-	0x75, 0x2f, 0x38, 0x70, 0x01, 0x92, 0xfd, 0x96, 0xb8, 0xc0, 0xf6, 0xbb, 0x25, 0x0b, 0x0e, 0x5c, 0x80, 0xa8, 0x1f,
-	0x0f, 0x17, 0x82, 0x7f, 0x37, 0x5c, 0x20, 0xfe, 0xc9, 0x70, 0x81, 0xe8, 0xd7, 0xc2, 0x19, 0x38, 0x87, 0x28, 0xd6,
-	0xe7, 0x0f, 0x29, 0xca, 0x0a, 0x02, 0xe1, 0x94, 0xc0, 0x65, 0x16, 0xec, 0x96, 0x36, 0xd8, 0x2d, 0x6d, 0xb0, 0x5b,
-	0x16, 0x82, 0xdd, 0xd2, 0x0d, 0x76, 0x4b, 0x1b, 0xec, 0x96, 0x4e, 0xb0, 0x5b, 0x3a, 0xc1, 0x6e, 0x69, 0x82, 0xdd,
-	0xd2, 0x06, 0xbb, 0x25, 0xfe, 0x7e, 0xe2, 0xd2, 0xfc, 0x68, 0xe2, 0xd2, 0xff, 0xa5, 0xc4, 0xa5, 0xf7, 0xf3, 0x88,
-	0x4b, 0xf3, 0x9b, 0x88, 0xcb, 0xd2, 0x0f, 0x21, 0x2e, 0xed, 0xaf, 0x1f, 0x2e, 0xcd, 0x4f, 0x1e, 0x2e, 0xcd, 0xef,
-	0x1c, 0x2e, 0xdb, 0x3a, 0xb0, 0x2b, 0x9f, 0x38, 0x34, 0x0b, 0x94, 0xc4, 0x0d, 0x50, 0x1e, 0xae, 0x05, 0x87, 0x13,
-	0x8e, 0x02, 0xaa, 0x5f, 0x66, 0x5d, 0x4a, 0xc0, 0x03, 0x48, 0xbe, 0xc8, 0x22, 0x58, 0xfa, 0x26, 0x8b, 0x20, 0xea,
-	0xb7, 0x59, 0x97, 0x29, 0xe4, 0x25, 0x9f, 0x59, 0x9a, 0x42, 0x70, 0xd9, 0xc9, 0xa7, 0x5e, 0xdb, 0x05, 0xa6, 0xa8,
-	0x97, 0x41, 0xfe, 0x02, 0x6b, 0x6f, 0x81, 0x59, 0x29, 0x08, 0x63, 0xcd, 0xba, 0x6b, 0xbb, 0xee, 0xda, 0x59, 0x37,
-	0x97, 0x82, 0xa9, 0x3a, 0x5c, 0x36, 0xa1, 0x2f, 0x35, 0xe1, 0x97, 0x1c, 0xfa, 0x00, 0xd1, 0xbf, 0xde, 0xbf, 0x6c,
-	0x2b, 0xb7, 0x1e, 0xdf, 0x92, 0x2b, 0x37, 0x80, 0xb2, 0x25, 0x02, 0x0e, 0x3e, 0x29, 0xa0, 0x3a, 0xfc, 0xb1, 0x34,
-	0x95, 0x1b, 0xdc, 0x40, 0xbf, 0x86, 0x5a, 0x4a, 0xe5, 0x06, 0xa3, 0x52, 0x4d, 0xcf, 0x88, 0xa9, 0xdc, 0x96, 0x18,
-	0x00, 0x45, 0xc3, 0xcf, 0x99, 0x64, 0x9e, 0x75, 0x61, 0xbf, 0x54, 0xbf, 0xad, 0x08, 0xb8, 0xad, 0xe3, 0x97, 0x52,
-	0xbc, 0x09, 0xa2, 0x57, 0x26, 0x8c, 0x2e, 0xe5, 0x97, 0xf0, 0x33, 0x89, 0x30, 0x4c, 0x6d, 0x60, 0x96, 0xdc, 0x01,
-	0x97, 0x18, 0x91, 0xb7, 0xc0, 0x0d, 0x6e, 0x22, 0x9c, 0xd3, 0x04, 0x37, 0xa4, 0x17, 0xeb, 0xf2, 0x36, 0xb8, 0xc1,
-	0x6d, 0xd4, 0x53, 0x8d, 0x70, 0x43, 0xe8, 0xf8, 0x97, 0xb7, 0xc2, 0x35, 0x8e, 0x91, 0x30, 0xff, 0x5e, 0x92, 0x86,
-	0xdd, 0x98, 0x68, 0xbe, 0x97, 0xa4, 0x19, 0x1d, 0x1d, 0xdd, 0xef, 0x25, 0x69, 0xd6, 0xc4, 0xc9, 0xfc, 0x7b, 0x49,
-	0x1a, 0xd6, 0x11, 0x33, 0xc2, 0x59, 0xd8, 0x24, 0xc8, 0x84, 0x16, 0xc2, 0x4d, 0x00, 0x25, 0xdc, 0x0f, 0x32, 0x44,
-	0x3a, 0x91, 0x86, 0x18, 0x1d, 0x57, 0x08, 0x36, 0xc1, 0x85, 0x70, 0x1b, 0x61, 0x88, 0xd0, 0xe1, 0x95, 0x60, 0x1d,
-	0x63, 0x23, 0xac, 0xdd, 0x30, 0xa1, 0x2a, 0xda, 0x46, 0xd8, 0x59, 0xac, 0x8d, 0xbb, 0x84, 0x9b, 0xe0, 0x9b, 0xf0,
-	0x0b, 0xc2, 0xf1, 0xc2, 0x70, 0x62, 0xbc, 0x58, 0x4c, 0x9c, 0x2f, 0x38, 0x1b, 0x95, 0x09, 0x2f, 0x09, 0xce, 0xc6,
-	0xe7, 0x88, 0x63, 0x90, 0x26, 0x44, 0x47, 0x6a, 0x82, 0x4d, 0xb8, 0x8e, 0x78, 0x16, 0xb3, 0x09, 0x32, 0x81, 0x9b,
-	0x70, 0x3f, 0x7a, 0x13, 0xe9, 0x84, 0x70, 0x62, 0x74, 0x1c, 0x27, 0xb8, 0x14, 0xcc, 0x89, 0x36, 0x11, 0x9d, 0x70,
-	0x13, 0xd6, 0x09, 0xd7, 0xb1, 0x3d, 0xc2, 0x36, 0xc0, 0x47, 0xdc, 0x8b, 0xf2, 0x91, 0x79, 0xb6, 0x42, 0xb6, 0xf1,
-	0x9e, 0x70, 0x3f, 0xe8, 0x13, 0xe9, 0x44, 0x7e, 0x62, 0x74, 0xf8, 0x27, 0xb8, 0x94, 0x03, 0x88, 0x36, 0x89, 0x80,
-	0x70, 0x9b, 0x0d, 0x88, 0xd0, 0x29, 0x01, 0x5f, 0x87, 0x49, 0xd0, 0x34, 0xef, 0xc3, 0x3c, 0xca, 0xe4, 0x06, 0xff,
-	0x8d, 0x98, 0xc7, 0x7b, 0x19, 0xc2, 0xbc, 0x13, 0xf3, 0x28, 0x9b, 0x27, 0xec, 0x5b, 0x31, 0x8f, 0xd3, 0xd9, 0xc2,
-	0xbc, 0x17, 0x73, 0x28, 0xcc, 0x19, 0x02, 0xea, 0xb4, 0x21, 0x8c, 0x9b, 0x39, 0x84, 0x76, 0x92, 0x87, 0x90, 0x3a,
-	0x7f, 0x08, 0x53, 0x48, 0x21, 0x32, 0xc0, 0x64, 0x11, 0xa1, 0x74, 0x22, 0x11, 0x46, 0xe7, 0x12, 0x66, 0xb2, 0x74,
-	0x22, 0xa8, 0x09, 0x9a, 0x42, 0x99, 0xa4, 0x22, 0x94, 0x1f, 0x3a, 0x85, 0x77, 0xa2, 0xa7, 0x90, 0x3a, 0x48, 0x0a,
-	0x63, 0xe2, 0xa4, 0x50, 0x36, 0x54, 0x0a, 0xa7, 0xd3, 0x8c, 0x30, 0xdc, 0x78, 0x31, 0x94, 0x0e, 0x07, 0x40, 0xa8,
-	0x84, 0xc3, 0x8c, 0x7f, 0x23, 0x9b, 0x76, 0x84, 0x32, 0x99, 0x07, 0xa8, 0xcb, 0x12, 0xf4, 0xf2, 0x0f, 0x90, 0x5e,
-	0x0a, 0x12, 0xba, 0x28, 0x60, 0x9b, 0x88, 0x84, 0xba, 0x20, 0x60, 0x9b, 0x8e, 0x98, 0xc2, 0x8c, 0x24, 0xa0, 0x4e,
-	0x4a, 0xc2, 0x98, 0xbc, 0xc4, 0x54, 0x96, 0x9a, 0x04, 0x35, 0xd9, 0x49, 0x28, 0x3f, 0x41, 0x09, 0xef, 0xe4, 0x28,
-	0x21, 0x75, 0x9a, 0x12, 0xa6, 0x94, 0xa9, 0x64, 0x84, 0x49, 0x56, 0x42, 0x99, 0x7c, 0x25, 0x94, 0x4e, 0x59, 0xcc,
-	0xd8, 0xac, 0xc5, 0x94, 0x97, 0xb8, 0x98, 0x7c, 0x76, 0x35, 0x62, 0xd3, 0x97, 0x50, 0x7e, 0x06, 0x13, 0xde, 0x49,
-	0x62, 0x42, 0xea, 0x3c, 0x26, 0x4c, 0x29, 0x95, 0xc9, 0x08, 0x93, 0xcd, 0x84, 0xb2, 0x09, 0x4d, 0x38, 0x95, 0xd3,
-	0x56, 0xcd, 0xdf, 0x63, 0x4b, 0xe1, 0x7c, 0xd5, 0x9c, 0x87, 0x4a, 0x6f, 0xc6, 0x28, 0x8c, 0x21, 0x1d, 0x11, 0x1c,
-	0x13, 0xe3, 0x19, 0x8e, 0x89, 0x08, 0x8e, 0x01, 0x09, 0xe1, 0x40, 0x80, 0x71, 0x34, 0xcf, 0x14, 0xc7, 0x32, 0x88,
-	0x23, 0xa3, 0xf0, 0x70, 0x58, 0x44, 0x70, 0x0c, 0x09, 0x09, 0x07, 0x11, 0x84, 0xa3, 0xe4, 0xaf, 0xb5, 0xf2, 0x28,
-	0xf9, 0x6b, 0xad, 0x3c, 0x2a, 0xfd, 0x55, 0x49, 0x1e, 0x93, 0xfe, 0xaa, 0x24, 0x8f, 0xe0, 0x3f, 0x70, 0xc7, 0x43,
-	0xf8, 0x0f, 0xdc, 0xa5, 0x31, 0x9f, 0xd9, 0x34, 0x53, 0xc3, 0xf3, 0x73, 0x63, 0x74, 0x95, 0x7c, 0x20, 0x5b, 0x03,
-	0xc4, 0x7b, 0x65, 0xf4, 0x19, 0x2d, 0x0b, 0x40, 0xf5, 0xca, 0xe8, 0xb3, 0xb6, 0x24, 0x20, 0xf4, 0xbb, 0xa4, 0xcf,
-	0x62, 0x38, 0x00, 0x45, 0x7b, 0x11, 0xe0, 0xbb, 0xac, 0xe5, 0xae, 0xe9, 0x14, 0xc2, 0x87, 0xe4, 0x25, 0x82, 0x40,
-	0xe9, 0x92, 0xc0, 0x38, 0xe8, 0x6c, 0x11, 0x7d, 0x35, 0xc1, 0xce, 0x2d, 0xf8, 0x9c, 0xbf, 0x46, 0xf4, 0x2d, 0xcc,
-	0x39, 0x7f, 0x61, 0xe8, 0x0f, 0x6f, 0x9e, 0x3d, 0xcc, 0xdc, 0x26, 0x11, 0xce, 0x8d, 0xda, 0xcc, 0xd6, 0xfe, 0x4a,
-	0xf9, 0xfd, 0xe7, 0x0d, 0xfd, 0x50, 0x79, 0x0a, 0x47, 0x40, 0x2a, 0xa6, 0xee, 0xc0, 0x0f, 0xda, 0x84, 0x0f, 0xea,
-	0x65, 0x75, 0x40, 0xdc, 0x97, 0xd5, 0xd1, 0xb6, 0xf8, 0xc3, 0x09, 0x3f, 0xbc, 0xe0, 0xb0, 0x73, 0xf6, 0x41, 0xad,
-	0xc7, 0x15, 0x2a, 0xa5, 0xdc, 0x47, 0x8b, 0xe8, 0xb9, 0x11, 0xec, 0x4f, 0x50, 0x62, 0x46, 0x8e, 0x9c, 0x0c, 0xf2,
-	0x62, 0xae, 0x3a, 0x5b, 0x44, 0xcf, 0xbc, 0x68, 0x13, 0x54, 0x16, 0x3c, 0x5a, 0x44, 0x4f, 0x9f, 0x60, 0x7f, 0xfa,
-	0x91, 0xc4, 0xe9, 0xf3, 0xb7, 0x4c, 0x14, 0xf2, 0x62, 0xae, 0x3a, 0x5b, 0x44, 0x4f, 0xbf, 0x68, 0x8f, 0x58, 0xba,
-	0x3c, 0x16, 0x60, 0xb3, 0x10, 0xe0, 0x0a, 0xab, 0xc9, 0x03, 0xaf, 0x03, 0x9f, 0x7c, 0xf8, 0xc5, 0xbf, 0xc9, 0xb9,
-	0x00, 0x9b, 0x65, 0x02, 0xe7, 0xac, 0x95, 0xa1, 0x47, 0x17, 0xd4, 0xeb, 0x14, 0xc6, 0x5f, 0x65, 0x96, 0x30, 0x0c,
-	0x78, 0xf2, 0xc0, 0x17, 0xef, 0xf2, 0xb3, 0x0b, 0xea, 0xb5, 0x09, 0xe3, 0xad, 0x8c, 0x6b, 0xc8, 0x47, 0x1f, 0x35,
-	0x6b, 0x13, 0xaa, 0xb0, 0x38, 0x1e, 0x90, 0xad, 0x8e, 0xd1, 0x93, 0x8b, 0xbe, 0xb8, 0x77, 0x38, 0xfb, 0xa8, 0x59,
-	0xa1, 0x50, 0xce, 0x12, 0x63, 0x7e, 0x79, 0xb4, 0x88, 0x5e, 0x1a, 0xc1, 0xfe, 0xb2, 0x24, 0x75, 0xe7, 0xc8, 0xc9,
-	0x20, 0x2f, 0xe6, 0xaa, 0xb3, 0x45, 0xf4, 0x12, 0x08, 0x76, 0xa6, 0x4f, 0x39, 0xef, 0xd1, 0x81, 0xf4, 0x02, 0x12,
-	0xee, 0xaf, 0x00, 0x0a, 0x0b, 0x05, 0x9d, 0x2c, 0xf4, 0x62, 0x2f, 0x3c, 0x3b, 0x90, 0x5e, 0x46, 0xc2, 0x9d, 0x75,
-	0x50, 0xa2, 0x7e, 0x74, 0x20, 0xbd, 0x8e, 0x84, 0xfb, 0xeb, 0x80, 0xd2, 0x47, 0x41, 0x27, 0x0b, 0xbd, 0xd8, 0x0b,
-	0xcf, 0x0e, 0xa4, 0xd7, 0x61, 0xff, 0x76, 0x7d, 0xa2, 0x1e, 0xe2, 0x16, 0x9a, 0x3f, 0xa8, 0x23, 0x06, 0x0f, 0xb0,
-	0x61, 0x66, 0xc4, 0x3b, 0x74, 0xf0, 0x90, 0xfd, 0xe2, 0x9c, 0x80, 0xea, 0xd0, 0xc1, 0x03, 0xfc, 0xe2, 0x9c, 0x40,
-	0xfa, 0xd7, 0xd8, 0x1e, 0x64, 0xf7, 0xcb, 0x80, 0x3a, 0x6d, 0xf0, 0xd0, 0x09, 0x5e, 0xb2, 0xa9, 0x0f, 0x87, 0xb5,
-	0xbc, 0x37, 0x7d, 0x08, 0xff, 0x63, 0x89, 0x3d, 0x34, 0xbb, 0xb8, 0x8a, 0x99, 0xb5, 0x2a, 0xea, 0x1e, 0xb0, 0x2a,
-	0x48, 0xfb, 0xb6, 0xc7, 0x46, 0x18, 0xf2, 0xef, 0xb4, 0xe1, 0x63, 0x80, 0x44, 0x21, 0x40, 0xf6, 0xd2, 0x98, 0x51,
-	0x78, 0x67, 0xcc, 0x58, 0x7a, 0x65, 0xcc, 0x00, 0xbf, 0x18, 0x66, 0x84, 0x77, 0x91, 0x8c, 0xd0, 0x6b, 0x61, 0xfe,
-	0x4c, 0x32, 0x48, 0x40, 0x9c, 0xce, 0xca, 0x00, 0x6a, 0xde, 0x84, 0xaa, 0xc9, 0x13, 0xea, 0xad, 0x80, 0x28, 0xbb,
-	0x0c, 0x22, 0xd4, 0x5a, 0x08, 0xd5, 0x0b, 0x22, 0x58, 0xaf, 0x8a, 0xe0, 0x7c, 0x69, 0x04, 0xaa, 0xf5, 0xa9, 0x2f,
-	0xf5, 0xb9, 0xb0, 0x5a, 0xab, 0xf7, 0x95, 0x3e, 0x97, 0xf3, 0xd6, 0x5d, 0xf8, 0x42, 0x9f, 0x4b, 0x2b, 0x19, 0xb8,
-	0x5f, 0xe7, 0x73, 0x49, 0x2d, 0x0f, 0xe7, 0xcb, 0x7c, 0x2e, 0x95, 0xcb, 0x26, 0xfe, 0xf1, 0x1d, 0xfe, 0x77, 0x2e,
-	0x85, 0xfc, 0x0f, 0xee, 0x44, 0x6c, 0x8d, 0x01, 0x66, 0x6d, 0x8a, 0xc4, 0xb5, 0x5f, 0xa9, 0xac, 0xbd, 0xd4, 0xbe,
-	0x36, 0xb9, 0x63, 0x6d, 0x63, 0xf1, 0xda, 0x86, 0xb5, 0xaf, 0x1d, 0xf0, 0xdf, 0xaf, 0xd0, 0x62, 0x62, 0x84, 0x3b,
-	0x4b, 0x82, 0x38, 0xa1, 0xe6, 0x2b, 0xf6, 0x91, 0x10, 0xc4, 0xfe, 0x11, 0xa3, 0x2a, 0x00, 0x7d, 0x95, 0x76, 0x11,
-	0x40, 0x3a, 0x00, 0x7d, 0x6d, 0x1b, 0x37, 0xf2, 0xc1, 0x4c, 0x75, 0xe7, 0x4f, 0x6c, 0xe7, 0x4d, 0x6c, 0x67, 0xa6,
-	0xa0, 0xbb, 0x31, 0x42, 0xd8, 0xb9, 0xed, 0xd4, 0xc1, 0xab, 0xaf, 0xf2, 0x37, 0x63, 0x19, 0x81, 0x14, 0x60, 0x83,
-	0xbf, 0x1b, 0xf6, 0xbf, 0xaa, 0xaf, 0x74, 0xf2, 0xbd, 0xbc, 0xaf, 0x74, 0xfa, 0xa4, 0x56, 0x56, 0xf1, 0x2b, 0x9d,
-	0xfe, 0x08, 0x47, 0x52, 0xa5, 0xaf, 0x74, 0xfa, 0x03, 0xb4, 0x54, 0xdd, 0xaf, 0x74, 0xfa, 0xac, 0x51, 0xb7, 0xfa,
-	0x8a, 0xa5, 0x8f, 0x5f, 0x92, 0x86, 0x6f, 0x0f, 0x85, 0xaf, 0x58, 0xfa, 0xfc, 0xa5, 0xf5, 0x94, 0x0c, 0xc6, 0xfd,
-	0x8a, 0xa5, 0xcf, 0x6a, 0x33, 0xf2, 0xbe, 0x62, 0xe9, 0x92, 0xe7, 0x82, 0xd5, 0x18, 0x3b, 0x2b, 0x7c, 0x11, 0x2f,
-	0xf1, 0x9b, 0xb6, 0x09, 0x43, 0x4f, 0xd8, 0x48, 0x23, 0x2b, 0x21, 0xea, 0x4b, 0x81, 0x8c, 0xc7, 0x89, 0x03, 0xd2,
-	0xc6, 0x99, 0x01, 0x7f, 0x80, 0xf9, 0xd9, 0x0a, 0xce, 0xad, 0xdd, 0xb6, 0x1c, 0xfe, 0xf8, 0x2e, 0x66, 0xff, 0xbb,
-	0xf5, 0xf7, 0xbf, 0xdb, 0xe2, 0xfe, 0x77, 0xcb, 0x3b, 0x57, 0xbe, 0xa9, 0xd9, 0x95, 0x6e, 0xfd, 0x5d, 0xe9, 0xb6,
-	0xb8, 0x2b, 0xdd, 0xa2, 0x50, 0xb2, 0x5b, 0xfb, 0x0a, 0xda, 0x5e, 0x52, 0xd0, 0xf6, 0x07, 0x0a, 0xda, 0x72, 0xf3,
-	0x8c, 0x1f, 0x13, 0x91, 0xb3, 0x19, 0x63, 0x6e, 0x4d, 0xb0, 0xbd, 0xe9, 0x0e, 0xdb, 0x55, 0x3b, 0x2c, 0x69, 0x77,
-	0xed, 0x7d, 0xbb, 0xfc, 0x41, 0xb9, 0xd7, 0x2e, 0xbb, 0x5b, 0x02, 0x59, 0x73, 0x7c, 0x4b, 0xd3, 0xdd, 0xd8, 0x89,
-	0x2e, 0xf3, 0xab, 0xcc, 0x13, 0xac, 0x2e, 0x13, 0x93, 0x67, 0x43, 0x7e, 0x96, 0xbf, 0x6f, 0xdf, 0xa9, 0x0d, 0xba,
-	0x73, 0x13, 0xf3, 0xe8, 0xc2, 0x06, 0x3d, 0xd1, 0x98, 0x76, 0xf9, 0xe9, 0xde, 0x8e, 0x7a, 0x97, 0x6d, 0x9e, 0xcd,
-	0xe5, 0xe6, 0xb9, 0xee, 0xe6, 0x39, 0x91, 0x9c, 0xd7, 0xf9, 0x91, 0x66, 0x4f, 0xb8, 0x93, 0x1d, 0x60, 0x7e, 0x95,
-	0x79, 0x92, 0xdd, 0x01, 0x26, 0x26, 0x8b, 0x65, 0xf8, 0xb4, 0x8c, 0xc0, 0x87, 0x66, 0xc4, 0xb9, 0x74, 0x2b, 0x33,
-	0x85, 0x9c, 0x75, 0x66, 0x22, 0x65, 0x0b, 0xcf, 0xc1, 0x6e, 0x21, 0x77, 0xb0, 0x5f, 0x54, 0x17, 0x9a, 0x27, 0x3a,
-	0xfb, 0xc5, 0x44, 0xc5, 0x30, 0x86, 0x8f, 0xe2, 0xc0, 0x56, 0xe5, 0xc8, 0xd9, 0x5c, 0x65, 0x9e, 0x63, 0xfe, 0xac,
-	0x22, 0x33, 0xec, 0xc3, 0xfc, 0x18, 0x6e, 0x80, 0x57, 0x39, 0x72, 0x36, 0x57, 0x99, 0xc7, 0x58, 0xaf, 0x26, 0xe6,
-	0x1b, 0x5e, 0xfd, 0xcd, 0x5c, 0xf8, 0xcd, 0xbd, 0x26, 0x76, 0xdd, 0x0b, 0x9d, 0x5a, 0x64, 0x15, 0x95, 0xae, 0xd8,
-	0xd4, 0x0f, 0xed, 0x17, 0x22, 0x27, 0x2e, 0x4e, 0x53, 0xf0, 0x49, 0x75, 0xf2, 0x3c, 0x27, 0xbd, 0xd3, 0xcc, 0xf9,
-	0x08, 0x59, 0x8c, 0xcf, 0xab, 0x33, 0xce, 0x39, 0xa9, 0x4f, 0x35, 0xe7, 0xac, 0x3e, 0xc0, 0x9d, 0xb3, 0xf9, 0xd9,
-	0xf5, 0x9c, 0x53, 0x07, 0xa1, 0x5b, 0xd2, 0x15, 0x51, 0x59, 0x3e, 0x65, 0xe1, 0xfc, 0x40, 0x32, 0x17, 0xc5, 0x52,
-	0x96, 0xc9, 0x05, 0x81, 0x5c, 0x90, 0x46, 0x51, 0x14, 0x3f, 0x90, 0x83, 0xfc, 0x8b, 0xbf, 0xbf, 0x02, 0xe6, 0x75,
-	0x2f, 0x7d, 0x03, 0x44, 0xc3, 0xd4, 0x56, 0x47, 0x97, 0xda, 0x88, 0x29, 0x23, 0xaa, 0x4c, 0x1f, 0xa9, 0xbc, 0xdf,
-	0xe3, 0x0c, 0x50, 0x35, 0x19, 0x50, 0x99, 0x1f, 0xd8, 0xc9, 0xef, 0xdd, 0x19, 0xa6, 0xdf, 0xb5, 0xf0, 0x28, 0xaa,
-	0xd6, 0x5d, 0x0a, 0xa7, 0xe9, 0x0c, 0x38, 0xc8, 0x8b, 0x6d, 0x44, 0xd5, 0xeb, 0x70, 0xa4, 0xd2, 0xc3, 0x3c, 0x8a,
-	0xde, 0xe4, 0xf8, 0x64, 0x36, 0x13, 0x67, 0xc0, 0xb7, 0xd5, 0x5d, 0xed, 0x0a, 0x04, 0x7e, 0x63, 0x08, 0xd1, 0x5c,
-	0x03, 0x76, 0xc0, 0x77, 0x59, 0xf0, 0x3e, 0x9d, 0x91, 0x18, 0x30, 0xf0, 0x28, 0xd7, 0xec, 0xa5, 0xab, 0x27, 0x88,
-	0x7b, 0xf7, 0x3d, 0x1f, 0x2c, 0xa8, 0xf8, 0x46, 0xe9, 0x85, 0x63, 0x5a, 0xd2, 0x3e, 0x3b, 0x05, 0xc8, 0x0f, 0x94,
-	0x17, 0x40, 0x93, 0x1c, 0xd1, 0x8f, 0x76, 0x5f, 0x00, 0xe5, 0xa4, 0x99, 0x44, 0x7e, 0x96, 0x8c, 0x67, 0x92, 0xfd,
-	0x96, 0x1e, 0xcf, 0x44, 0xde, 0xe5, 0x4c, 0x72, 0x44, 0xcf, 0xc4, 0x7d, 0x97, 0x93, 0x93, 0x66, 0x26, 0xf9, 0xcf,
-	0xb3, 0xc9, 0x4c, 0xec, 0x0f, 0x10, 0xc9, 0x7c, 0x80, 0xcb, 0x66, 0x85, 0xb8, 0x99, 0x1b, 0x92, 0x85, 0x19, 0x3a,
-	0x3f, 0xe5, 0x53, 0x79, 0x0f, 0xd5, 0xb3, 0x8d, 0x96, 0xf8, 0xca, 0x00, 0xca, 0x29, 0x08, 0x4d, 0x8d, 0xa8, 0x1c,
-	0xcd, 0x5a, 0x50, 0x39, 0x05, 0xed, 0x9b, 0x9c, 0x48, 0x6d, 0xa7, 0x1c, 0xe5, 0x86, 0x53, 0x0e, 0xeb, 0x63, 0x29,
-	0x04, 0x53, 0x93, 0x29, 0x07, 0x53, 0x7b, 0x29, 0x43, 0x3f, 0x8a, 0xa8, 0x08, 0x48, 0x9b, 0x7e, 0x85, 0x7a, 0xc2,
-	0x8d, 0x1c, 0xfc, 0xed, 0x97, 0x08, 0x2c, 0xe4, 0x18, 0x57, 0x04, 0x96, 0x9d, 0xab, 0x69, 0x0e, 0x90, 0x10, 0x15,
-	0x2a, 0x32, 0x49, 0xc4, 0xf7, 0xa6, 0x2b, 0x98, 0xaa, 0x9a, 0xef, 0xdc, 0x0b, 0x04, 0x84, 0x04, 0x0f, 0x48, 0xf6,
-	0x26, 0x5f, 0x60, 0x78, 0x93, 0x2f, 0x60, 0x7a, 0x93, 0x2f, 0x08, 0xbf, 0xb0, 0x17, 0x88, 0x5f, 0xd8, 0x0b, 0x44,
-	0x2f, 0xec, 0x05, 0x20, 0xe1, 0x0a, 0x42, 0xf6, 0x3d, 0x62, 0x00, 0xf6, 0x52, 0xdf, 0xa5, 0xef, 0x22, 0x48, 0x92,
-	0x3b, 0x20, 0xce, 0x9f, 0x7d, 0xf9, 0x9e, 0xb5, 0x55, 0x00, 0x84, 0x5e, 0x8a, 0xa0, 0xea, 0x8f, 0xc1, 0x7c, 0x87,
-	0xae, 0x89, 0x40, 0xfa, 0x8f, 0xc1, 0x7c, 0x6f, 0xfa, 0x23, 0x15, 0x2b, 0x20, 0x35, 0x45, 0x00, 0xf1, 0xce, 0x4a,
-	0x7c, 0xc7, 0xf6, 0x07, 0x80, 0xea, 0xac, 0xc4, 0x77, 0xdd, 0xe8, 0x00, 0x42, 0x9f, 0x95, 0xf8, 0xce, 0x2d, 0x0d,
-	0x40, 0x92, 0xa0, 0x19, 0x49, 0x7e, 0x9b, 0x24, 0x7d, 0xc2, 0xd7, 0x1d, 0x27, 0xf3, 0xba, 0xe3, 0x64, 0x5e, 0x77,
-	0x9c, 0xfc, 0xd7, 0x1d, 0x27, 0xef, 0x75, 0xc7, 0xc9, 0xbc, 0xee, 0x38, 0xd9, 0xd7, 0x1d, 0x27, 0xfb, 0xba, 0xe3,
-	0xa4, 0x5f, 0x77, 0x9c, 0xcc, 0xeb, 0x8e, 0x93, 0x36, 0x99, 0x13, 0xf6, 0xa9, 0x4e, 0xa6, 0x39, 0x75, 0xf2, 0x3b,
-	0x52, 0x27, 0xaf, 0x0d, 0x75, 0x32, 0xbd, 0xa7, 0x53, 0xa9, 0xe1, 0x74, 0xb2, 0x5d, 0xa6, 0x93, 0x69, 0x2d, 0x9d,
-	0x4c, 0x3f, 0xe9, 0x64, 0xf4, 0xf0, 0x82, 0x16, 0xff, 0x62, 0x2c, 0xfe, 0xc5, 0x58, 0xfc, 0x8b, 0x6f, 0xf1, 0x2f,
-	0x9e, 0xc5, 0xbf, 0xb8, 0x16, 0xff, 0x62, 0x2c, 0xfe, 0xc5, 0x5a, 0xfc, 0x8b, 0xb5, 0xf8, 0xb3, 0x16, 0xfd, 0xd9,
-	0xac, 0xe6, 0x9c, 0xe5, 0x73, 0x85, 0x9a, 0xc1, 0xfa, 0x50, 0xa6, 0x25, 0xf0, 0x92, 0x37, 0xdb, 0xfb, 0x77, 0xf5,
-	0x7e, 0x7b, 0xbd, 0x5a, 0xef, 0x0f, 0xfc, 0xe9, 0xf5, 0xea, 0xb8, 0x6a, 0x3f, 0xfc, 0xba, 0xdb, 0x1e, 0xff, 0xa8,
-	0x8f, 0xfb, 0xf5, 0x5d, 0x20, 0xff, 0x07, 0xf2, 0x1b, 0xce, 0xcd };
@@ -1,143 +0,0 @@
-// zapf_dingbats.h
-// Copyright (c) 2022, yuki
-// SPDX-License-Identifier: Apache-2.0
-
-#pragma once
-
-constexpr uint8_t AFM_ZAPF_DINGBATS[] = { 0x78, 0x9c, 0xb5, 0x9a, 0x4d, 0x8f, 0x1b, 0x37, 0x12, 0x86, 0xef, 0x03, 0xcc,
-	0x7f, 0xe0, 0x31, 0x0b, 0xac, 0x0d, 0x7e, 0x7f, 0xd8, 0x27, 0x7f, 0x24, 0x58, 0x1f, 0x6c, 0x04, 0x19, 0xc7, 0x5e,
-	0xe4, 0xa6, 0x68, 0xda, 0x1e, 0x21, 0x1a, 0x69, 0x56, 0x92, 0x17, 0xf1, 0xbf, 0x5f, 0xb2, 0x55, 0x2f, 0x59, 0xec,
-	0x76, 0xf7, 0x6d, 0x91, 0x60, 0x30, 0x96, 0x1f, 0xb3, 0xab, 0xeb, 0xad, 0x2a, 0xb2, 0x8a, 0xba, 0xbb, 0x6c, 0x4e,
-	0x97, 0x5f, 0x8e, 0x87, 0xcb, 0xfb, 0xe1, 0x72, 0xda, 0x6d, 0xcf, 0xc2, 0x3e, 0x57, 0xb7, 0x37, 0x6f, 0x8e, 0x8f,
-	0x8f, 0xc3, 0xe1, 0x22, 0xde, 0x1c, 0x9f, 0xbe, 0x9f, 0x76, 0x5f, 0x1f, 0x2e, 0xe2, 0xa7, 0xed, 0x3f, 0x84, 0x4a,
-	0xd1, 0xfd, 0xb3, 0xfc, 0x0c, 0xe3, 0xcf, 0x38, 0xfe, 0x4c, 0xe5, 0x67, 0x0a, 0xe2, 0xd5, 0xfd, 0xf1, 0xcf, 0x41,
-	0xdc, 0x7d, 0x3f, 0x5f, 0x86, 0xc7, 0xb3, 0x78, 0x77, 0xd8, 0x1e, 0x4f, 0x4f, 0xc7, 0xd3, 0xe6, 0x32, 0xdc, 0x3f,
-	0x17, 0xaf, 0xf6, 0x7b, 0xf1, 0x5b, 0x59, 0xe6, 0x2c, 0x7e, 0x1b, 0xce, 0xc3, 0xe9, 0xbf, 0xf9, 0x43, 0xf6, 0x90,
-	0xd3, 0xb0, 0xb9, 0xec, 0x8e, 0x07, 0xf1, 0x36, 0xd3, 0x2f, 0xc4, 0xc7, 0x87, 0x6f, 0xe2, 0xfd, 0xe6, 0xbb, 0x10,
-	0x4a, 0x28, 0xf7, 0x42, 0xd9, 0x17, 0xca, 0x8c, 0x4f, 0x68, 0xff, 0xe0, 0xf7, 0xc3, 0xee, 0x3f, 0xdf, 0x86, 0x77,
-	0x6f, 0x85, 0x35, 0x32, 0xea, 0xf6, 0xf9, 0xa7, 0xf7, 0xdf, 0xce, 0x9b, 0xaf, 0x83, 0xb0, 0x2e, 0x04, 0x27, 0x9c,
-	0x73, 0xc6, 0xdd, 0xde, 0x94, 0x77, 0xfb, 0xb0, 0x79, 0x1c, 0xc4, 0x1f, 0x9b, 0xa7, 0x2f, 0x6f, 0x77, 0x87, 0xaf,
-	0x7f, 0x6e, 0x2e, 0xe7, 0xfc, 0xf1, 0xb7, 0xfd, 0x7e, 0xfc, 0xf8, 0xdd, 0xc7, 0x37, 0xe3, 0x5f, 0x09, 0xf6, 0x77,
-	0x9b, 0xc7, 0xdd, 0xfe, 0xfb, 0x0f, 0xfe, 0xd1, 0xe7, 0x61, 0xf4, 0xc5, 0xfb, 0xe1, 0x7e, 0xf7, 0xed, 0xf1, 0xf6,
-	0xe6, 0xdd, 0x65, 0xb3, 0xdf, 0x6d, 0x5f, 0x1d, 0xbe, 0xee, 0x07, 0x21, 0xf3, 0x1f, 0xcf, 0xbf, 0xec, 0xfe, 0x1e,
-	0xee, 0x7f, 0xdd, 0x5d, 0xb6, 0x0f, 0xe2, 0xcb, 0x66, 0x7f, 0x1e, 0xb2, 0x69, 0x0f, 0x9b, 0xd3, 0x66, 0x7b, 0x19,
-	0x4e, 0x77, 0xc3, 0x45, 0xdc, 0x3d, 0x0d, 0xdb, 0xdd, 0x66, 0x7f, 0xb5, 0xe9, 0xf5, 0xeb, 0xe3, 0xdf, 0xe2, 0x99,
-	0xca, 0xff, 0x5b, 0x23, 0x52, 0x54, 0x22, 0x6a, 0x29, 0x6e, 0x6f, 0x7e, 0x3f, 0xdc, 0x0f, 0xa7, 0xfd, 0xee, 0x30,
-	0xfc, 0x7a, 0x3c, 0xef, 0x46, 0xaf, 0x3c, 0x53, 0x52, 0xb2, 0xcf, 0x3f, 0x3e, 0xec, 0xb6, 0x7f, 0x1d, 0x86, 0xf3,
-	0x59, 0xb8, 0xfc, 0xf1, 0xa7, 0xe1, 0x74, 0x2e, 0x90, 0x94, 0xfa, 0xb9, 0x2c, 0xdc, 0x87, 0xe3, 0x65, 0xb7, 0x1d,
-	0xfe, 0x9f, 0xc2, 0xcd, 0x1c, 0x26, 0x76, 0x67, 0xb1, 0x11, 0xa7, 0xe1, 0xeb, 0x2e, 0x2f, 0x71, 0x1a, 0xee, 0xc5,
-	0xe5, 0xb4, 0xb9, 0x1f, 0x1e, 0x37, 0xa7, 0xbf, 0xc4, 0xf1, 0x4b, 0x5e, 0x30, 0x7f, 0x78, 0x18, 0x05, 0xde, 0xec,
-	0xc5, 0xc7, 0xef, 0x4f, 0xc3, 0x97, 0xcd, 0x68, 0xe0, 0xf5, 0x29, 0xf9, 0xe3, 0x1c, 0x0a, 0x3f, 0xe7, 0xa7, 0xde,
-	0xe7, 0xe5, 0xee, 0xb6, 0x0f, 0x43, 0xf6, 0x7a, 0xf1, 0xcf, 0xe8, 0xac, 0x2f, 0xbb, 0xed, 0xed, 0xcd, 0xdd, 0xe5,
-	0xfe, 0x5f, 0x9f, 0x85, 0x8e, 0xe3, 0x6f, 0x9f, 0x3e, 0x8b, 0x24, 0xcb, 0x6f, 0x39, 0x6c, 0x8b, 0x73, 0x11, 0xb6,
-	0x5a, 0x96, 0x40, 0x10, 0x46, 0x8b, 0x97, 0xe2, 0xf3, 0xbf, 0x85, 0x0e, 0x31, 0xff, 0xf2, 0x41, 0x9c, 0x9f, 0xca,
-	0xc3, 0x5e, 0x8a, 0xd7, 0x42, 0xd2, 0x7f, 0x2f, 0x47, 0xcc, 0x5c, 0xb1, 0x14, 0xec, 0x88, 0x6d, 0xd4, 0xc8, 0x18,
-	0x27, 0x82, 0x16, 0xc9, 0x24, 0xe1, 0xb5, 0x22, 0xd2, 0x12, 0xe9, 0xd5, 0x95, 0xd4, 0x20, 0xb3, 0x64, 0x49, 0x07,
-	0xe1, 0x15, 0x48, 0x37, 0x59, 0x33, 0x9b, 0xb4, 0xb8, 0xaa, 0x27, 0x36, 0xca, 0x2b, 0x6b, 0x40, 0x4a, 0x91, 0xac,
-	0x13, 0x3e, 0x69, 0x02, 0xc3, 0x15, 0x0c, 0x2a, 0x5d, 0x41, 0x7b, 0x05, 0xad, 0x50, 0x65, 0xbd, 0x98, 0xc3, 0xdc,
-	0x7b, 0x42, 0x23, 0xa1, 0x91, 0x50, 0x87, 0x35, 0x73, 0x88, 0x89, 0xe0, 0xb2, 0x15, 0xd2, 0x11, 0x9a, 0x08, 0x4d,
-	0xf4, 0x78, 0x35, 0x2e, 0xff, 0x63, 0xd8, 0x4a, 0xc0, 0x0a, 0x70, 0x6c, 0xb0, 0x11, 0x21, 0x7b, 0xa6, 0xc1, 0xea,
-	0x0a, 0xfb, 0xb6, 0x72, 0x68, 0x16, 0x47, 0xe1, 0x5d, 0x49, 0x4c, 0x43, 0xb0, 0x86, 0x6f, 0x2b, 0x8c, 0x85, 0x95,
-	0xce, 0x49, 0xa1, 0xcb, 0xdb, 0x45, 0x62, 0xa1, 0x98, 0xa1, 0xb7, 0x53, 0xd5, 0xb9, 0x2a, 0xaf, 0x9d, 0xa4, 0xcd,
-	0xeb, 0x26, 0x62, 0x49, 0x33, 0x67, 0xc1, 0x5e, 0xdd, 0xab, 0x53, 0x36, 0x58, 0x09, 0xa7, 0x3c, 0x33, 0x98, 0x54,
-	0x8b, 0xce, 0x11, 0x5b, 0x3d, 0x9c, 0x97, 0x2b, 0x39, 0xe9, 0x0d, 0x69, 0x61, 0x21, 0x9a, 0x82, 0x23, 0xaa, 0x87,
-	0x9d, 0x14, 0x31, 0x78, 0xe1, 0x2d, 0xd0, 0x00, 0x6b, 0x0d, 0xa1, 0xbe, 0x59, 0x9b, 0x97, 0x4d, 0x29, 0x5b, 0x4b,
-	0xb1, 0x68, 0xe3, 0x74, 0x59, 0xb9, 0xbc, 0x2e, 0x09, 0x97, 0x2c, 0xac, 0x0d, 0x7c, 0xdd, 0x24, 0x53, 0xf3, 0xae,
-	0x93, 0xd3, 0x18, 0xaf, 0xb2, 0xa9, 0xec, 0xad, 0x94, 0xd5, 0x70, 0x31, 0x10, 0x4b, 0xb2, 0x85, 0xea, 0x85, 0x04,
-	0x2f, 0x8c, 0x12, 0x6b, 0x26, 0xb1, 0x23, 0xd5, 0xe2, 0xe8, 0x8f, 0x31, 0xce, 0xaf, 0xac, 0x1f, 0x63, 0x27, 0x2a,
-	0xce, 0x92, 0x6a, 0xc1, 0x6b, 0x62, 0xab, 0xc2, 0x32, 0xaf, 0x1a, 0x5a, 0xa0, 0x3b, 0x0b, 0x12, 0x79, 0xa6, 0x97,
-	0x48, 0x52, 0xcc, 0x05, 0x90, 0x57, 0x75, 0x4b, 0x2d, 0xcd, 0xd1, 0x52, 0x3e, 0xf6, 0x9e, 0xf2, 0xcc, 0x91, 0x64,
-	0x3e, 0x04, 0x62, 0x6d, 0xb3, 0xd5, 0x8c, 0x7e, 0x6d, 0xb6, 0x22, 0xd5, 0x3c, 0x69, 0xa6, 0x1d, 0xb7, 0x20, 0x32,
-	0x0b, 0x90, 0x69, 0x88, 0x5b, 0xed, 0x39, 0xe9, 0x19, 0x89, 0x44, 0x73, 0x14, 0x89, 0x3a, 0x70, 0x92, 0x25, 0xba,
-	0x47, 0x96, 0x39, 0x54, 0x8f, 0xc8, 0x49, 0xc9, 0x48, 0xd2, 0xca, 0x26, 0x22, 0xd9, 0xc3, 0xad, 0xe7, 0x20, 0x09,
-	0xe5, 0x1c, 0x39, 0x9f, 0x3d, 0xdb, 0x29, 0xe6, 0x51, 0x4f, 0x2a, 0x39, 0x43, 0x5e, 0x62, 0x8f, 0x76, 0xd2, 0x30,
-	0x10, 0x89, 0x05, 0x77, 0xd6, 0xaa, 0x91, 0x7c, 0x56, 0x50, 0xe7, 0xf7, 0xa5, 0x62, 0xe4, 0x1d, 0xea, 0x80, 0x46,
-	0x50, 0xf3, 0x02, 0xe3, 0xb3, 0xb3, 0xab, 0xe3, 0xbd, 0x47, 0xe1, 0x42, 0x40, 0x4d, 0x8a, 0x11, 0x0b, 0x28, 0x0f,
-	0x91, 0x62, 0xa4, 0xc2, 0x29, 0x7b, 0x96, 0x09, 0xea, 0xe3, 0x94, 0x55, 0x3d, 0x6b, 0x18, 0x3b, 0xad, 0x88, 0x46,
-	0xf7, 0x2c, 0x2b, 0x19, 0xa1, 0x16, 0x44, 0x0a, 0x14, 0x63, 0x04, 0xaf, 0x87, 0x59, 0xeb, 0xc6, 0x22, 0xb1, 0x20,
-	0x96, 0xb1, 0xcb, 0x2c, 0x12, 0x4b, 0x91, 0x1f, 0x4c, 0x5f, 0xc1, 0x23, 0x7b, 0xb7, 0x40, 0x92, 0x45, 0x0d, 0x1b,
-	0x7c, 0xcf, 0x32, 0xff, 0x06, 0xa4, 0x16, 0x36, 0x06, 0x13, 0xfa, 0x77, 0xb3, 0x8c, 0x45, 0x39, 0xb4, 0x94, 0x5c,
-	0x26, 0x72, 0x36, 0x4a, 0xbe, 0xae, 0x9f, 0xda, 0xd0, 0xeb, 0x16, 0xf9, 0xbb, 0x91, 0x6e, 0x11, 0x05, 0xd1, 0xf6,
-	0xba, 0xa5, 0xc8, 0xd8, 0x38, 0xf1, 0x83, 0x55, 0x9d, 0xcf, 0x3a, 0x3f, 0x24, 0xac, 0x4b, 0xf6, 0xda, 0x5e, 0xb7,
-	0xc4, 0x74, 0x8b, 0x28, 0x88, 0xb0, 0xd7, 0x9a, 0xee, 0xdd, 0x22, 0xb3, 0x21, 0x42, 0x37, 0x4b, 0xba, 0xd9, 0xaa,
-	0x5b, 0x4e, 0x47, 0xc5, 0xb2, 0x2c, 0x92, 0x6a, 0xa1, 0xae, 0xca, 0xca, 0x86, 0x8f, 0xac, 0x6c, 0x44, 0x14, 0x43,
-	0x6c, 0x4b, 0x96, 0x97, 0x8d, 0x92, 0x15, 0x95, 0x84, 0x62, 0x88, 0x46, 0x5b, 0x37, 0xd1, 0x59, 0x34, 0x46, 0x07,
-	0x96, 0x32, 0xcd, 0x76, 0x8a, 0x05, 0xc7, 0xdf, 0x0a, 0xe5, 0x30, 0x51, 0x99, 0xb7, 0x9d, 0x62, 0x7e, 0xdc, 0xc9,
-	0x29, 0x83, 0x23, 0x32, 0x2d, 0x90, 0x0a, 0xae, 0x29, 0x96, 0x1f, 0x9f, 0x35, 0xf1, 0x89, 0xf6, 0xdb, 0x58, 0xeb,
-	0x21, 0x25, 0x9a, 0x6b, 0x82, 0xe5, 0x78, 0x31, 0x96, 0xa1, 0x69, 0x62, 0xad, 0x9b, 0xe4, 0x19, 0x8b, 0xaf, 0x54,
-	0x4b, 0x22, 0x0e, 0x34, 0xec, 0x94, 0xd4, 0x15, 0xcf, 0x04, 0xb5, 0x24, 0xd5, 0x25, 0xd7, 0x65, 0x99, 0x0f, 0x25,
-	0x62, 0x2c, 0xb1, 0xd0, 0x4b, 0xc2, 0xd8, 0x2e, 0xcb, 0xae, 0x2c, 0x2c, 0x20, 0xc5, 0x7c, 0x84, 0xb5, 0x5d, 0x96,
-	0x79, 0xcb, 0xad, 0x85, 0x66, 0x92, 0x22, 0xd1, 0x85, 0xde, 0xb7, 0x4c, 0xb3, 0x84, 0x2c, 0xd3, 0xf0, 0x6d, 0xaf,
-	0x59, 0x62, 0x15, 0x2f, 0x21, 0xcb, 0x14, 0x69, 0xe6, 0x26, 0x59, 0x26, 0x19, 0x5b, 0xab, 0x23, 0x79, 0xcc, 0x4f,
-	0xaa, 0x23, 0xcb, 0xf4, 0x34, 0x3d, 0x2e, 0x7a, 0xb5, 0xcc, 0xa6, 0x89, 0x7f, 0xbd, 0xe6, 0xf1, 0xe8, 0x03, 0xab,
-	0xa4, 0xb9, 0x5b, 0x81, 0xd3, 0x00, 0x93, 0x6c, 0xbe, 0x24, 0x84, 0x53, 0x4d, 0x36, 0x25, 0xeb, 0x69, 0x91, 0xfc,
-	0xe0, 0x59, 0x96, 0x95, 0x68, 0xf4, 0x49, 0x01, 0xd5, 0x58, 0x15, 0xe6, 0xf2, 0x34, 0x73, 0x8e, 0xaf, 0x8a, 0x3c,
-	0xc3, 0x7e, 0xe2, 0x7d, 0x9f, 0x3d, 0x8a, 0x5b, 0x5b, 0x8b, 0x23, 0xac, 0x9d, 0x14, 0x47, 0xcd, 0x61, 0xe4, 0x9a,
-	0xa2, 0x5c, 0xf7, 0x9d, 0x6e, 0x3e, 0x44, 0x0e, 0x63, 0x5b, 0xc3, 0xb9, 0xd9, 0x4f, 0xb6, 0x35, 0xcf, 0xe1, 0xaa,
-	0x1c, 0xa9, 0x1c, 0xba, 0x43, 0xd5, 0xc4, 0xe6, 0x38, 0x59, 0x39, 0x4c, 0xa4, 0x0b, 0x1c, 0x46, 0x85, 0x0c, 0x64,
-	0x73, 0xe8, 0x32, 0x2e, 0x1a, 0x6e, 0xb3, 0x42, 0xca, 0xe1, 0x14, 0x16, 0xba, 0x94, 0x63, 0x27, 0x1b, 0xa5, 0x90,
-	0x73, 0x38, 0xda, 0x05, 0x5e, 0x21, 0xf9, 0x81, 0x4d, 0x29, 0x3d, 0x41, 0xb5, 0x34, 0x8b, 0x2c, 0xc4, 0x43, 0xd2,
-	0x87, 0xee, 0x14, 0xc6, 0x75, 0x56, 0x76, 0x82, 0x6a, 0x69, 0x17, 0x59, 0x64, 0x1c, 0xea, 0x4e, 0x60, 0xb5, 0x37,
-	0xba, 0xce, 0x07, 0x7e, 0x8a, 0x76, 0x11, 0x51, 0x60, 0xb6, 0xee, 0xf4, 0x3c, 0x12, 0x26, 0xd5, 0xd7, 0xf2, 0x95,
-	0x6b, 0xca, 0xd1, 0xa6, 0x12, 0xfa, 0x88, 0xb0, 0x89, 0xc3, 0xa4, 0x9b, 0x35, 0xb4, 0x72, 0xec, 0x44, 0xb6, 0x92,
-	0xe7, 0x9c, 0x26, 0xdd, 0x54, 0x85, 0xd9, 0xe9, 0xb9, 0xc4, 0x78, 0xb3, 0x58, 0x93, 0x6e, 0x1a, 0x67, 0xb8, 0xc8,
-	0xb4, 0xd0, 0x79, 0xfb, 0x64, 0x28, 0xe9, 0x66, 0x51, 0x7a, 0x22, 0xf3, 0xaf, 0x89, 0x92, 0xa3, 0x24, 0x9b, 0x81,
-	0xd3, 0x52, 0x75, 0x9a, 0xce, 0xf9, 0x6f, 0xba, 0x90, 0xd4, 0x76, 0x0a, 0x47, 0x24, 0xe8, 0x0f, 0x60, 0x9c, 0x24,
-	0xb1, 0xb9, 0xa4, 0xc4, 0x57, 0xf6, 0xa6, 0xf3, 0x83, 0x9f, 0xc0, 0xd7, 0x6a, 0x34, 0xe6, 0xd1, 0x95, 0xe6, 0x7a,
-	0xe8, 0x08, 0x3b, 0x68, 0x9b, 0x8d, 0x9d, 0x1e, 0xa6, 0xcb, 0x50, 0x9d, 0x26, 0x70, 0x92, 0x3d, 0xcc, 0x5a, 0x66,
-	0x65, 0x48, 0x0f, 0xa3, 0x70, 0x50, 0xe6, 0x4e, 0x8e, 0xec, 0x48, 0xad, 0x8c, 0x9a, 0xa2, 0x76, 0x11, 0xad, 0xc3,
-	0x0d, 0x2a, 0x6c, 0x49, 0x2d, 0x49, 0x87, 0x01, 0x47, 0x43, 0xf5, 0x22, 0x8a, 0x43, 0xbd, 0xac, 0x69, 0xc4, 0x52,
-	0xce, 0x06, 0x9e, 0x46, 0x98, 0x71, 0x54, 0x36, 0x2e, 0xa3, 0x1e, 0xc1, 0x83, 0x26, 0x49, 0xb2, 0x94, 0x33, 0x3d,
-	0x1b, 0x26, 0x6c, 0x5c, 0x46, 0x49, 0x33, 0x6d, 0x28, 0x87, 0x62, 0x97, 0x9d, 0x2a, 0xf1, 0x1c, 0xc2, 0x9c, 0xa3,
-	0xc1, 0x71, 0x19, 0xc6, 0x9c, 0xc3, 0x00, 0x4e, 0xec, 0xdd, 0x74, 0x46, 0x9b, 0x11, 0x98, 0x72, 0x34, 0xd4, 0x2f,
-	0xa1, 0xe8, 0xd6, 0x82, 0xa9, 0x8d, 0x10, 0xcf, 0xe3, 0x22, 0x6f, 0xc8, 0x27, 0x53, 0x0f, 0x1c, 0x3d, 0x1b, 0xce,
-	0x9d, 0x8a, 0x86, 0x48, 0xee, 0xba, 0x11, 0xd8, 0xf1, 0x90, 0x5a, 0x69, 0x33, 0xa3, 0x0d, 0xdf, 0xea, 0x9c, 0xe4,
-	0x85, 0x0d, 0xdd, 0x5b, 0x82, 0x97, 0x55, 0xab, 0x97, 0xb6, 0x0c, 0x1a, 0xdc, 0xb8, 0x3d, 0x13, 0x5c, 0xd3, 0x2e,
-	0x00, 0xee, 0xcf, 0x3e, 0x5d, 0xde, 0xd5, 0x16, 0xae, 0x4e, 0x72, 0x64, 0xbf, 0x8d, 0x6a, 0x9e, 0x4a, 0xb5, 0x89,
-	0x6b, 0xf4, 0x55, 0x17, 0x39, 0x96, 0xa7, 0x72, 0x64, 0x75, 0x3e, 0x01, 0x46, 0xd1, 0x44, 0x24, 0x2b, 0xc5, 0x42,
-	0xb9, 0x9c, 0x43, 0xd9, 0xc2, 0xa4, 0xb7, 0xc3, 0xf9, 0x56, 0x61, 0xa2, 0x44, 0xfe, 0xf0, 0xec, 0xb0, 0xa4, 0xd0,
-	0xc7, 0x79, 0xf4, 0x66, 0x6a, 0xda, 0xa4, 0xf2, 0xf0, 0x40, 0x27, 0xe7, 0x71, 0x66, 0xbb, 0xee, 0xac, 0xe3, 0xda,
-	0xb9, 0x4d, 0xe6, 0x47, 0x36, 0x85, 0x4e, 0xae, 0xee, 0x0a, 0x4a, 0x2f, 0x1f, 0xc4, 0x54, 0x30, 0x33, 0x7a, 0xf9,
-	0x28, 0xa6, 0x5a, 0x37, 0x57, 0x69, 0xbd, 0x42, 0xbb, 0x19, 0x6d, 0x56, 0x68, 0x3f, 0xa3, 0xed, 0x0a, 0x3d, 0xdd,
-	0xfb, 0x54, 0x9b, 0x98, 0xfc, 0x80, 0x9e, 0x76, 0xe3, 0x4a, 0xfb, 0x15, 0x3a, 0xcd, 0xe8, 0xe5, 0xa6, 0x55, 0xa1,
-	0xb3, 0x63, 0xf4, 0xca, 0x36, 0x5c, 0x7b, 0xbb, 0x46, 0xa7, 0x15, 0x7a, 0xa6, 0xe5, 0x74, 0xe4, 0xd0, 0xd1, 0x33,
-	0x2d, 0xa7, 0x43, 0x87, 0x8e, 0x9e, 0x69, 0x39, 0x1d, 0x3b, 0x74, 0xf4, 0x4c, 0x4b, 0xb3, 0xa2, 0x65, 0x9c, 0x69,
-	0x69, 0x56, 0xb4, 0x8c, 0x33, 0x2d, 0xcd, 0x8a, 0x96, 0x71, 0xa6, 0xa5, 0x59, 0xd1, 0x32, 0xce, 0xb4, 0x5c, 0x19,
-	0x40, 0xa8, 0x34, 0xd3, 0xd2, 0xac, 0x68, 0x99, 0x66, 0x5a, 0x9a, 0x15, 0x2d, 0xd3, 0x4c, 0x4b, 0xbb, 0xa2, 0x65,
-	0x9a, 0x69, 0x69, 0x57, 0xb4, 0x4c, 0x33, 0x2d, 0xed, 0x8a, 0x96, 0x69, 0xa6, 0xa5, 0x5d, 0xd1, 0x32, 0xcd, 0xb4,
-	0xb4, 0x2b, 0x5a, 0xa6, 0x99, 0x96, 0x76, 0x45, 0xcb, 0x34, 0xd3, 0xd2, 0xae, 0x68, 0x99, 0x66, 0x5a, 0xda, 0x65,
-	0x2d, 0xb5, 0x9c, 0x69, 0x39, 0x1d, 0x4e, 0x74, 0xf4, 0x4c, 0x4b, 0xbb, 0xac, 0xa5, 0x96, 0x33, 0x2d, 0xdd, 0xb2,
-	0x96, 0x5a, 0xce, 0xb4, 0x74, 0xcb, 0x5a, 0x6a, 0x39, 0xd3, 0x72, 0x3a, 0xa6, 0xe8, 0xe8, 0x99, 0x96, 0x6e, 0x59,
-	0x4b, 0x2d, 0x67, 0x5a, 0xba, 0x65, 0x2d, 0xb5, 0x9c, 0x69, 0xe9, 0x96, 0xb5, 0xd4, 0x72, 0xa6, 0xa5, 0x5b, 0xd6,
-	0x52, 0xcb, 0x99, 0x96, 0x6e, 0x45, 0x4b, 0x35, 0xd3, 0xd2, 0xad, 0x68, 0xa9, 0x66, 0x5a, 0xba, 0x15, 0x2d, 0xd1,
-	0x20, 0xc6, 0xba, 0x13, 0xb7, 0xc1, 0x45, 0x7e, 0x4a, 0x2c, 0x53, 0x6d, 0x63, 0x01, 0x63, 0xf4, 0x89, 0x5e, 0x47,
-	0xb5, 0xc9, 0x45, 0xd1, 0x29, 0x66, 0xad, 0x9d, 0x95, 0xa0, 0x49, 0xca, 0x7c, 0xec, 0xc2, 0xbe, 0xed, 0xeb, 0x19,
-	0xa9, 0xe0, 0xe5, 0xea, 0x95, 0xe1, 0xa4, 0xa5, 0x75, 0x75, 0x71, 0xa6, 0x4e, 0xde, 0x83, 0x6c, 0xde, 0x6d, 0xcb,
-	0xad, 0x10, 0xe1, 0x10, 0xd3, 0x02, 0x6f, 0x27, 0xc1, 0x54, 0xba, 0xae, 0x7c, 0x92, 0x49, 0x01, 0x30, 0x2e, 0x85,
-	0x74, 0x7d, 0xcb, 0xaa, 0x65, 0x29, 0x44, 0x31, 0x97, 0xbe, 0x71, 0x56, 0x7f, 0xa5, 0xe3, 0x6c, 0x69, 0xbd, 0xbc,
-	0x34, 0xee, 0x85, 0x54, 0x35, 0xbb, 0x5d, 0x38, 0xe5, 0x5f, 0x63, 0xde, 0x69, 0x9c, 0xa6, 0x63, 0xa3, 0x46, 0xb7,
-	0x98, 0x34, 0xce, 0x76, 0x6d, 0xe8, 0x91, 0x37, 0xa0, 0xd2, 0xf8, 0x7a, 0x8f, 0x57, 0x44, 0xbf, 0x98, 0x74, 0x5d,
-	0xba, 0xdd, 0x23, 0xe9, 0x72, 0x97, 0x95, 0xfd, 0xe7, 0x61, 0x35, 0x5a, 0x46, 0x46, 0xa7, 0x46, 0x67, 0x29, 0x73,
-	0x51, 0x75, 0xde, 0x80, 0xae, 0x52, 0xc2, 0x23, 0x41, 0x36, 0x29, 0x73, 0x43, 0x55, 0xee, 0xc9, 0x0c, 0x5e, 0x12,
-	0x6d, 0x63, 0x9d, 0x64, 0xa8, 0x36, 0xf7, 0xc8, 0xcb, 0x96, 0x78, 0x70, 0x98, 0x33, 0x6a, 0xb4, 0x8d, 0xb1, 0x1a,
-	0xd2, 0xe6, 0x1e, 0xe5, 0xdc, 0x5b, 0x66, 0x27, 0x2e, 0x46, 0xd0, 0x7e, 0x2a, 0x4d, 0x1b, 0x7c, 0x64, 0x47, 0xc7,
-	0xbc, 0x85, 0xb9, 0x84, 0x00, 0xd4, 0x73, 0x1d, 0xf5, 0x32, 0x5c, 0x6f, 0xf7, 0xe0, 0x6b, 0x3e, 0x27, 0x89, 0x91,
-	0x75, 0x62, 0x1a, 0x2d, 0x66, 0x32, 0x38, 0x17, 0xb7, 0xe1, 0x47, 0x16, 0x30, 0xe6, 0xd8, 0xf2, 0x12, 0x26, 0xa3,
-	0xc5, 0x4c, 0x98, 0x7c, 0xab, 0x36, 0xd2, 0x98, 0xc3, 0xb8, 0x33, 0xf2, 0xd5, 0x75, 0x2d, 0xd5, 0xb3, 0xcf, 0x6c,
-	0x7e, 0x74, 0xc0, 0xac, 0x4d, 0xa3, 0xcf, 0x8c, 0xb1, 0xd2, 0x55, 0xf2, 0xec, 0xf2, 0x98, 0x23, 0xd2, 0x6b, 0x68,
-	0x68, 0xaa, 0x86, 0xc8, 0xaf, 0x36, 0xd5, 0xb0, 0xe5, 0xc6, 0x20, 0xbf, 0xa1, 0xad, 0x76, 0xd8, 0x29, 0xdc, 0x1a,
-	0xe3, 0x39, 0x0c, 0x09, 0x6b, 0x0b, 0x12, 0x5b, 0x74, 0xe4, 0xcd, 0x22, 0x1a, 0x3d, 0x9e, 0xbb, 0x89, 0xf6, 0x53,
-	0xba, 0x0d, 0x0a, 0x7e, 0x40, 0x93, 0x86, 0x75, 0xf2, 0xa8, 0xda, 0x78, 0xc5, 0x5e, 0x27, 0xe1, 0xcc, 0x90, 0x38,
-	0x81, 0xb5, 0x94, 0xcb, 0x70, 0x9d, 0xb7, 0xd5, 0x6b, 0xd7, 0xf6, 0x35, 0x80, 0xdc, 0xea, 0xe5, 0x44, 0xf7, 0x0a,
-	0x51, 0x8a, 0x46, 0x32, 0xb6, 0xef, 0x0c, 0xb4, 0x6f, 0x22, 0x18, 0x82, 0x51, 0x25, 0x71, 0x5d, 0xde, 0xda, 0xa6,
-	0xd8, 0x8d, 0xd1, 0x58, 0x9b, 0xac, 0xeb, 0x75, 0xb9, 0xad, 0xef, 0x57, 0xc3, 0xae, 0x14, 0xd7, 0x72, 0xd9, 0xec,
-	0x0c, 0x34, 0xc4, 0x85, 0x79, 0xc0, 0x95, 0xaa, 0xc2, 0xf8, 0xc6, 0x96, 0x6f, 0x20, 0x84, 0xec, 0xdb, 0x32, 0x62,
-	0x25, 0xb8, 0xca, 0x82, 0x26, 0xab, 0x0d, 0x01, 0xca, 0x7e, 0x15, 0x73, 0x64, 0xda, 0x08, 0x47, 0xe3, 0xd2, 0x9c,
-	0x2d, 0x6d, 0x97, 0x97, 0xc6, 0x2d, 0x51, 0xdd, 0x35, 0xda, 0x64, 0xe8, 0x59, 0x76, 0x5a, 0x2c, 0x57, 0x76, 0xaa,
-	0xbe, 0x23, 0x52, 0xab, 0xc5, 0x47, 0x2b, 0x7a, 0xba, 0xdc, 0x70, 0xeb, 0xf6, 0xfd, 0x01, 0x8d, 0xab, 0x73, 0xb6,
-	0xb6, 0x5b, 0x5e, 0x1b, 0x97, 0xe7, 0xf5, 0x5e, 0x49, 0xb5, 0x39, 0x43, 0x99, 0x51, 0x96, 0x8b, 0x25, 0x17, 0x20,
-	0xa3, 0xab, 0x32, 0x22, 0x61, 0x30, 0x68, 0xf0, 0xe3, 0xd4, 0x6f, 0x2c, 0x4d, 0x01, 0x96, 0xb8, 0x5a, 0x23, 0xab,
-	0xdd, 0x2d, 0x52, 0xcb, 0x8d, 0x7f, 0x29, 0x4d, 0xb6, 0x5a, 0x52, 0xbf, 0xaa, 0x02, 0xd5, 0xdb, 0xe0, 0x29, 0x67,
-	0x7c, 0x49, 0x7f, 0xaf, 0x50, 0xd9, 0x5d, 0x6d, 0xf1, 0xeb, 0x4b, 0xd6, 0x06, 0x38, 0xa7, 0xc3, 0xb8, 0x0d, 0xa4,
-	0x51, 0xf5, 0x9f, 0x0f, 0xf7, 0xec, 0xeb, 0x33, 0xe3, 0x9f, 0xd9, 0xb7, 0xc0, 0x6e, 0x6f, 0xfe, 0x07, 0xf0, 0xd2,
-	0x97, 0x84 };
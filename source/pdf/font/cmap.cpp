@@ -42,6 +42,18 @@ namespace pdf
 
 
 
+	std::vector<GlyphId> PdfFont::sorted_extra_mapping_glyphs() const
+	{
+		std::vector<GlyphId> ret {};
+		ret.reserve(m_extra_unicode_mappings.size());
+
+		for(auto& [gid, _] : m_extra_unicode_mappings)
+			ret.push_back(gid);
+
+		std::sort(ret.begin(), ret.end());
+		return ret;
+	}
+
 	void PdfFont::writeUTF8CMap() const
 	{
 		if(m_utf8_cmap == nullptr)
@@ -100,7 +112,7 @@ namespace pdf
 		             "endcodespacerange\n");
 
 		assert(m_source != nullptr);
-		auto& mapping = font_file->characterMapping().forward;
+		auto& mapping = font_file->characterMapping();
 
 		size_t current_cmap_entry = 0;
 		auto do_mapping = [cmap, &current_cmap_entry](size_t num_glyphs, GlyphId glyph, char32_t codepoint) {
@@ -116,22 +128,27 @@ namespace pdf
 		};
 
 		auto num_used_glyphs = font_file->usedGlyphs().size();
-		for(auto& [cp, glyph] : mapping)
-		{
-			if(not font_file->isGlyphUsed(glyph))
-				continue;
-
-			do_mapping(num_used_glyphs, glyph, cp);
-		}
+		mapping.forEachMapping([&](char32_t cp, GlyphId glyph) {
+			if(font_file->isGlyphUsed(glyph))
+				do_mapping(num_used_glyphs, glyph, cp);
+		});
 
 		// reset.
 		cmap->append("endcidchar\n");
 		current_cmap_entry = 0;
 
-		// now for the extra bois.
+		// now for the extra bois. give them codepoints in glyph order, so that the output doesn't depend on the
+		// order in which things were shaped.
+		for(auto gid : this->sorted_extra_mapping_glyphs())
+			this->assign_private_use_codepoint(gid);
+
 		if(auto num_extras = m_extra_glyph_to_private_use_mapping.size(); num_extras > 0)
 		{
-			for(auto [glyph, cp] : m_extra_glyph_to_private_use_mapping)
+			std::vector<std::pair<GlyphId, char32_t>> extras(m_extra_glyph_to_private_use_mapping.begin(),
+			    m_extra_glyph_to_private_use_mapping.end());
+			std::sort(extras.begin(), extras.end());
+
+			for(auto [glyph, cp] : extras)
 				do_mapping(num_extras, glyph, cp);
 
 			cmap->append("endcidchar\n");
@@ -194,15 +211,14 @@ namespace pdf
 		             "endcodespacerange\n");
 
 		assert(m_source != nullptr);
-		auto& mapping = font_file->characterMapping().forward;
+		auto& mapping = font_file->characterMapping();
 
 		size_t current_cmap_entry = 0;
 
 		auto num_used_glyphs = font_file->usedGlyphs().size();
-		for(auto& [cp, glyph] : mapping)
-		{
+		mapping.forEachMapping([&](char32_t cp, GlyphId glyph) {
 			if(not font_file->isGlyphUsed(glyph))
-				continue;
+				return;
 
 			auto codepoint = static_cast<uint32_t>(cp);
 			if(codepoint <= 0xFFFF)
@@ -216,7 +232,7 @@ namespace pdf
 				add_cmap_entry(cmap, "bf", num_used_glyphs, &current_cmap_entry,
 				    zpr::sprint("<{04x}> <{04x}{04x}>\n", glyph, high, low));
 			}
-		}
+		});
 
 		// reset.
 		cmap->append("endbfchar\n");
@@ -226,8 +242,10 @@ namespace pdf
 		// now for the ligatures.
 		if(auto num_entries = m_extra_unicode_mappings.size(); num_entries > 0)
 		{
-			for(auto& [gid, cps] : m_extra_unicode_mappings)
+			for(auto gid : this->sorted_extra_mapping_glyphs())
 			{
+				auto& cps = m_extra_unicode_mappings.find(gid)->second;
+
 				std::string s {};
 				{
 					auto app = zpr::detail::string_appender(s);
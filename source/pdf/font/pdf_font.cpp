@@ -267,29 +267,22 @@ namespace pdf
 
 
 
-	Size2d_YDown PdfFont::getWordSize(zst::wstr_view text, PdfScalar font_size) const
+	Size2d_YDown PdfFont::getWordSize(zst::wstr_view text, PdfScalar font_size, font::FeatureSetId features) const
 	{
+		auto lk = std::unique_lock(m_lock);
 		auto make_vec = [this, font_size](font::FontVector2d vec) -> Size2d_YDown {
 			return Size2d_YDown(                                  //
 			    this->scaleMetricForFontSize(vec.x(), font_size), //
 			    this->scaleMetricForFontSize(vec.y(), font_size));
 		};
 
-		if(auto it = m_word_size_cache.find(text); it != m_word_size_cache.end())
-			return make_vec(it->second);
-
-		font::FontScalar width = 0;
-		for(auto& g : this->getGlyphInfosForString(text))
-			width += g.metrics.horz_advance + g.adjustments.horz_advance;
-
-		auto size = font::FontVector2d(width, this->getFontMetrics().default_line_spacing);
-
-		m_word_size_cache.emplace(text.str(), size);
-		return make_vec(size);
+		auto width = this->get_shaped_string(text, features)->width;
+		return make_vec(font::FontVector2d(width, this->getFontMetrics().default_line_spacing));
 	}
 
 	void PdfFont::addGlyphUnicodeMapping(GlyphId glyph, std::vector<char32_t> codepoints) const
 	{
+		auto lk = std::unique_lock(m_lock);
 		if(auto it = m_extra_unicode_mappings.find(glyph);
 		    it != m_extra_unicode_mappings.end() && it->second != codepoints)
 		{
@@ -298,54 +291,192 @@ namespace pdf
 		}
 
 		m_extra_unicode_mappings[glyph] = std::move(codepoints);
+	}
+
+	char32_t PdfFont::assign_private_use_codepoint(GlyphId glyph) const
+	{
+		if(auto it = m_extra_glyph_to_private_use_mapping.find(glyph); it != m_extra_glyph_to_private_use_mapping.end())
+			return it->second;
 
 		// the PUA we use has this many glyphs... we should never run out.
 		if(m_extra_glyph_to_private_use_mapping.size() == 65534)
 			sap::internal_error("out of space in the unicode private use!");
 
-		m_extra_glyph_to_private_use_mapping[glyph] = m_cur_unicode_private_use_codepoint++;
+		auto cp = m_cur_unicode_private_use_codepoint++;
+		m_extra_glyph_to_private_use_mapping[glyph] = cp;
+		return cp;
 	}
 
 	char32_t PdfFont::getOutputCodepointForGlyph(GlyphId glyph) const
 	{
-		if(auto it = m_source->characterMapping().reverse.find(glyph); it != m_source->characterMapping().reverse.end())
-			return it->second;
-
-		if(auto it = m_extra_glyph_to_private_use_mapping.find(glyph); it != m_extra_glyph_to_private_use_mapping.end())
-			return it->second;
+		auto lk = std::unique_lock(m_lock);
+		if(auto cp = m_source->characterMapping().codepointForGlyph(glyph); cp.has_value())
+			return *cp;
+
+		// note: the private use codepoints are handed out when they are first needed (rather than when the
+		// mapping is added), since shaping can happen on several threads in no particular order.
+		if(m_extra_unicode_mappings.contains(glyph))
+			return this->assign_private_use_codepoint(glyph);
 		else
 			sap::internal_error("no output codepoint for glyph {}", glyph);
 	}
 
-	const std::vector<font::GlyphInfo>& PdfFont::getGlyphInfosForString(zst::wstr_view text) const
+	std::shared_ptr<const std::vector<font::GlyphInfo>> PdfFont::getGlyphInfosForString(zst::wstr_view text,
+	    font::FeatureSetId features) const
 	{
-		if(auto it = m_glyph_infos_cache.find(text); it != m_glyph_infos_cache.end())
-			return it->second;
+		auto lk = std::unique_lock(m_lock);
+		auto entry = this->get_shaped_string(text, features);
+		return std::shared_ptr<const std::vector<font::GlyphInfo>>(entry, &entry->glyphs);
+	}
+
+	const font::CodepointCoverage& PdfFont::coverage() const
+	{
+		auto lk = std::unique_lock(m_lock);
+		return m_source->coverage();
+	}
+
+	std::string PdfFont::name() const
+	{
+		auto lk = std::unique_lock(m_lock);
+		return m_source->name();
+	}
+
+	static uint64_t hash_feature_set(const font::FeatureSet& features)
+	{
+		auto sorted_tags = [](const util::hashset<font::Tag>& tags) {
+			std::vector<uint32_t> ret {};
+			for(auto& tag : tags)
+				ret.push_back(tag.value);
+
+			std::sort(ret.begin(), ret.end());
+			return ret;
+		};
 
-		using font::Tag;
-		font::FeatureSet features {};
+		std::vector<uint32_t> values { features.script.value, features.language.value };
 
-		// REMOVE: this is just for testing!
-		features.script = Tag("latn");
-		features.language = Tag("dflt");
-		features.enabled_features = { Tag("kern"), Tag("liga"), Tag("locl") };
+		auto enabled = sorted_tags(features.enabled_features);
+		auto disabled = sorted_tags(features.disabled_features);
+
+		values.push_back(static_cast<uint32_t>(enabled.size()));
+		values.insert(values.end(), enabled.begin(), enabled.end());
+		values.push_back(static_cast<uint32_t>(disabled.size()));
+		values.insert(values.end(), disabled.begin(), disabled.end());
+
+		return XXH64(values.data(), values.size() * sizeof(uint32_t), 0);
+	}
+
+	PersistentShapingCache* PdfFont::get_persistent_shaping_cache(font::FeatureSetId features) const
+	{
+		if(auto it = m_persistent_shaping_caches.find(features); it != m_persistent_shaping_caches.end())
+			return it->second.get();
+
+		if(not m_font_hash.has_value())
+		{
+			// note: faces in a collection share the same bytes, so mix in the name as well.
+			auto name = m_source->name();
+			m_font_hash = XXH64(name.data(), name.size(), 0);
+
+			if(auto file = dynamic_cast<const font::FontFile*>(m_source.get()); file != nullptr)
+				m_font_hash = XXH64(file->bytes().data(), file->bytes().size(), *m_font_hash);
+		}
+
+		// builtin fonts don't have a glyph count, but their glyph ids are just character codes.
+		auto num_glyphs = m_source->numGlyphs();
+		if(auto builtin = dynamic_cast<const BuiltinFont*>(m_source.get()); builtin != nullptr)
+			num_glyphs = static_cast<size_t>(builtin->getLastGlyphId()) + 1;
+
+		auto features_hash = hash_feature_set(font::getFeatureSet(features));
+		auto cache = PersistentShapingCache::open(*m_font_hash, features_hash, num_glyphs);
+		auto ret = cache.get();
+
+		m_persistent_shaping_caches[features] = std::move(cache);
+		return ret;
+	}
+
+	std::pair<size_t, size_t> PdfFont::persistentShapingCacheStats() const
+	{
+		auto lk = std::unique_lock(m_lock);
+		size_t hits = 0;
+		size_t misses = 0;
+		for(auto& [_, cache] : m_persistent_shaping_caches)
+		{
+			if(cache == nullptr)
+				continue;
+
+			hits += cache->hits();
+			misses += cache->misses();
+		}
+
+		return { hits, misses };
+	}
+
+	void PdfFont::savePersistentShapingCaches() const
+	{
+		auto lk = std::unique_lock(m_lock);
+		for(auto& [_, cache] : m_persistent_shaping_caches)
+		{
+			if(cache != nullptr)
+				cache->save();
+		}
+	}
+
+	std::shared_ptr<const ShapingCache::Entry> PdfFont::get_shaped_string(zst::wstr_view text,
+	    font::FeatureSetId features_id) const
+	{
+		if(auto entry = m_shaping_cache.find(features_id, text); entry != nullptr)
+			return entry;
+
+		auto& features = font::getFeatureSet(features_id);
 
 		std::vector<GlyphId> glyphs {};
 		glyphs.reserve(text.size());
 
+		// note: always do the cmap lookup, since that marks the glyphs as used.
 		for(char32_t cp : text)
 			glyphs.push_back(this->getGlyphIdFromCodepoint(cp));
 
+		auto persistent_cache = this->get_persistent_shaping_cache(features_id);
+		if(persistent_cache != nullptr)
+		{
+			if(auto cached = persistent_cache->find(text); cached.has_value())
+			{
+				// replay the side effects of shaping, in the same order.
+				for(auto g : cached->used_glyphs)
+					m_source->markGlyphAsUsed(g);
+
+				for(auto& [gid, cps] : cached->unicode_mappings)
+					this->addGlyphUnicodeMapping(gid, std::move(cps));
+
+				auto glyph_infos = this->make_glyph_infos(zst::span<GlyphId>(cached->glyphs.data(),
+				                                              cached->glyphs.size()),
+				    zst::span<font::GlyphAdjustment>(cached->adjustments.data(), cached->adjustments.size()));
+
+				return m_shaping_cache.insert(features_id, text, std::move(glyph_infos));
+			}
+		}
+
+		PersistentShapingCache::Entry record {};
 		auto glyph_span = zst::span<GlyphId>(glyphs.data(), glyphs.size());
 
 		// run substitution
-		if(auto subst = this->performSubstitutionsForGlyphSequence(glyph_span, features); subst.has_value())
+		if(auto subst = this->perform_substitutions(glyph_span, features, persistent_cache ? &record : nullptr);
+		    subst.has_value())
 			glyphs = std::move(*subst);
 
 		glyph_span = zst::span<GlyphId>(glyphs.data(), glyphs.size());
 
-		auto glyph_infos = this->getGlyphInfosForSubstitutedString(glyph_span, features);
-		return m_glyph_infos_cache.emplace(text.str(), std::move(glyph_infos)).first->second;
+		auto adjustments = m_source->getPositioningAdjustmentsForGlyphSequence(glyph_span, features);
+		auto glyph_infos = this->make_glyph_infos(glyph_span,
+		    zst::span<font::GlyphAdjustment>(adjustments.data(), adjustments.size()));
+
+		if(persistent_cache != nullptr)
+		{
+			record.glyphs = std::move(glyphs);
+			record.adjustments = std::move(adjustments);
+			persistent_cache->insert(text, std::move(record));
+		}
+
+		return m_shaping_cache.insert(features_id, text, std::move(glyph_infos));
 	}
 
 
@@ -361,7 +492,15 @@ namespace pdf
 	std::vector<font::GlyphInfo> PdfFont::getGlyphInfosForSubstitutedString(zst::span<GlyphId> glyphs,
 	    const font::FeatureSet& features) const
 	{
-		// next, get base metrics for each glyph.
+		auto lk = std::unique_lock(m_lock);
+		auto adjustments = m_source->getPositioningAdjustmentsForGlyphSequence(glyphs, features);
+		return this->make_glyph_infos(glyphs, zst::span<font::GlyphAdjustment>(adjustments.data(), adjustments.size()));
+	}
+
+	std::vector<font::GlyphInfo> PdfFont::make_glyph_infos(zst::span<GlyphId> glyphs,
+	    zst::span<font::GlyphAdjustment> gpos_adjustments) const
+	{
+		// first, get base metrics for each glyph.
 		std::vector<font::GlyphInfo> glyph_infos {};
 		for(auto g : glyphs)
 		{
@@ -371,10 +510,10 @@ namespace pdf
 			});
 		}
 
-		// finally, use GPOS
-		auto adjustment_map = m_source->getPositioningAdjustmentsForGlyphSequence(glyphs, features);
-		for(auto& [i, adj] : adjustment_map)
+		// then, apply the GPOS adjustments
+		for(size_t i = 0; i < gpos_adjustments.size(); i++)
 		{
+			auto adj = gpos_adjustments[i];
 			auto& info = glyph_infos[i];
 			info.adjustments.horz_advance += adj.horz_advance;
 			info.adjustments.vert_advance += adj.vert_advance;
@@ -412,6 +551,28 @@ namespace pdf
 	std::optional<std::vector<GlyphId>> PdfFont::performSubstitutionsForGlyphSequence(zst::span<GlyphId> glyphs,
 	    const font::FeatureSet& features) const
 	{
+		auto lk = std::unique_lock(m_lock);
+		return this->perform_substitutions(glyphs, features, nullptr);
+	}
+
+	std::optional<std::vector<GlyphId>> PdfFont::perform_substitutions(zst::span<GlyphId> glyphs,
+	    const font::FeatureSet& features,
+	    PersistentShapingCache::Entry* record) const
+	{
+		// if we are recording for the persistent cache, note down everything that we do to the font.
+		auto mark_used = [this, record](GlyphId gid) {
+			m_source->markGlyphAsUsed(gid);
+			if(record != nullptr)
+				record->used_glyphs.push_back(gid);
+		};
+
+		auto add_mapping = [this, record](GlyphId gid, std::vector<char32_t> cps) {
+			if(record != nullptr)
+				record->unicode_mappings.emplace_back(gid, cps);
+
+			this->addGlyphUnicodeMapping(gid, std::move(cps));
+		};
+
 		auto subst = m_source->performSubstitutionsForGlyphSequence(glyphs, features);
 		if(not subst.has_value())
 			return std::nullopt;
@@ -419,21 +580,20 @@ namespace pdf
 		auto& cmap = m_source->characterMapping();
 		for(auto& [out, in] : subst->mapping.replacements)
 		{
-			m_source->markGlyphAsUsed(out);
+			mark_used(out);
 
 			// if the out is mapped, then we actually don't need to do anything special
-			if(auto m = cmap.reverse.find(out); m == cmap.reverse.end())
+			if(not cmap.codepointForGlyph(out).has_value())
 			{
 				// get the codepoint for the input
-				if(auto it = cmap.reverse.find(in); it == cmap.reverse.end())
+				if(auto in_cp = cmap.codepointForGlyph(in); not in_cp.has_value())
 				{
 					sap::warn("font/off", "could not find unicode codepoint for {}", in);
 					continue;
 				}
 				else
 				{
-					auto in_cp = it->second;
-					this->addGlyphUnicodeMapping(out, { in_cp });
+					add_mapping(out, { *in_cp });
 				}
 			}
 		}
@@ -442,9 +602,9 @@ namespace pdf
 			// if it is in the reverse cmap, all is well. if it is not, then we hope that
 			// it was a single-replacement (eg. a ligature of replaced glyphs). otherwise,
 			// that's a big oof.
-			if(auto x = cmap.reverse.find(gid); x != cmap.reverse.end())
+			if(auto x = cmap.codepointForGlyph(gid); x.has_value())
 			{
-				return { x->second };
+				return { *x };
 			}
 			else if(auto y = m_extra_unicode_mappings.find(gid); y != m_extra_unicode_mappings.end())
 			{
@@ -459,7 +619,7 @@ namespace pdf
 
 		for(auto& [out, ins] : subst->mapping.contractions)
 		{
-			m_source->markGlyphAsUsed(out);
+			mark_used(out);
 			std::vector<char32_t> in_cps {};
 			for(auto& in_gid : ins)
 			{
@@ -467,15 +627,15 @@ namespace pdf
 				in_cps.insert(in_cps.end(), tmp.begin(), tmp.end());
 			}
 
-			this->addGlyphUnicodeMapping(out, std::move(in_cps));
+			add_mapping(out, std::move(in_cps));
 		}
 
 		for(auto& g : subst->mapping.extra_glyphs)
 		{
-			m_source->markGlyphAsUsed(g);
+			mark_used(g);
 
-			if(cmap.reverse.find(g) == cmap.reverse.end())
-				this->addGlyphUnicodeMapping(g, find_codepoint_for_gid(g));
+			if(not cmap.codepointForGlyph(g).has_value())
+				add_mapping(g, find_codepoint_for_gid(g));
 		}
 
 		return std::move(subst->glyphs);
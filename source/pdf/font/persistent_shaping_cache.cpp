@@ -0,0 +1,396 @@
+// persistent_shaping_cache.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pdf/shaping_cache.h"
+
+namespace pdf
+{
+	/*
+	    file layout (all integers are native-endian):
+
+	    header:
+	        char[8]     magic ("sapshape")
+	        u32         format version
+	        u32         reserved (0)
+	        u64         font hash
+	        u64         feature set hash
+
+	    followed by any number of records:
+	        u32         size of the record in bytes, including this field
+	        u32         number of characters in the text
+	        u32         number of glyphs
+	        u32         number of adjustments (either 0, or the number of glyphs)
+	        u32         number of used glyphs
+	        u32         number of unicode mappings
+	        u32         total number of codepoints in the unicode mappings
+	        u32[]       the text
+	        u32[]       the glyphs
+	        f64[4][]    the adjustments: (horz_placement, vert_placement, horz_advance, vert_advance)
+	        u32[]       the used glyphs
+	        (u32, u32, u32[])[]
+	                    the unicode mappings: glyph, number of codepoints, codepoints
+
+	    since everything is a multiple of 4 bytes, the text of each record is suitably aligned to be
+	    used directly from the mapped file.
+	*/
+	static constexpr char CACHE_MAGIC[8] = { 's', 'a', 'p', 's', 'h', 'a', 'p', 'e' };
+	static constexpr uint32_t CACHE_FORMAT_VERSION = 1;
+
+	static constexpr size_t HEADER_SIZE = 32;
+	static constexpr size_t RECORD_HEADER_SIZE = 7 * sizeof(uint32_t);
+
+	static std::optional<std::string> g_cache_directory = std::nullopt;
+
+	void PersistentShapingCache::setDirectory(std::optional<std::string> dir)
+	{
+		g_cache_directory = std::move(dir);
+	}
+
+	std::unique_ptr<PersistentShapingCache> PersistentShapingCache::open(uint64_t font_hash,
+	    uint64_t features_hash,
+	    size_t num_glyphs)
+	{
+		if(not g_cache_directory.has_value())
+			return nullptr;
+
+		auto path = stdfs::path(*g_cache_directory) / zpr::sprint("{016x}-{016x}.shc", font_hash, features_hash);
+
+		auto cache = std::unique_ptr<PersistentShapingCache>(
+		    new PersistentShapingCache(path.string(), font_hash, features_hash, num_glyphs));
+
+		cache->load();
+		return cache;
+	}
+
+	PersistentShapingCache::PersistentShapingCache(std::string path,
+	    uint64_t font_hash,
+	    uint64_t features_hash,
+	    size_t num_glyphs)
+	    : m_path(std::move(path)), m_font_hash(font_hash), m_features_hash(features_hash), m_num_glyphs(num_glyphs)
+	{
+	}
+
+	/*
+	    Check the parts of a record that `find` trusts, beyond its size: every glyph id must be in the font, and
+	    the unicode mappings must account for exactly `num_cps` codepoints (so they don't run past the record).
+	*/
+	static bool is_valid_record(const uint8_t* record, const uint32_t (&fields)[7], size_t num_glyphs)
+	{
+		const auto [record_size, text_len, num_glyphs_in_record, num_adjs, num_used, num_mappings, num_cps] = fields;
+
+		auto ptr = record + RECORD_HEADER_SIZE + sizeof(uint32_t) * size_t(text_len);
+		auto read_u32 = [&ptr]() -> uint32_t {
+			uint32_t ret = 0;
+			memcpy(&ret, ptr, sizeof(uint32_t));
+			ptr += sizeof(uint32_t);
+			return ret;
+		};
+
+		for(uint32_t i = 0; i < num_glyphs_in_record; i++)
+		{
+			if(read_u32() >= num_glyphs)
+				return false;
+		}
+
+		ptr += sizeof(double) * 4 * size_t(num_adjs);
+		for(uint32_t i = 0; i < num_used; i++)
+		{
+			if(read_u32() >= num_glyphs)
+				return false;
+		}
+
+		size_t remaining_cps = num_cps;
+		for(uint32_t i = 0; i < num_mappings; i++)
+		{
+			auto gid = read_u32();
+			auto count = read_u32();
+			if(gid >= num_glyphs || count > remaining_cps)
+				return false;
+
+			remaining_cps -= count;
+			ptr += sizeof(uint32_t) * size_t(count);
+		}
+
+		return remaining_cps == 0;
+	}
+
+	void PersistentShapingCache::load()
+	{
+		std::error_code ec {};
+		if(not stdfs::is_regular_file(m_path, ec) || stdfs::file_size(m_path, ec) == 0)
+		{
+			m_needs_rewrite = true;
+			return;
+		}
+
+		m_file = util::readEntireFile(m_path);
+
+		auto bytes = zst::byte_span(m_file.get(), m_file.size());
+		if(bytes.size() < HEADER_SIZE || memcmp(bytes.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0)
+		{
+			m_needs_rewrite = true;
+			return;
+		}
+
+		uint32_t version = 0;
+		uint64_t hashes[2] {};
+		memcpy(&version, bytes.data() + 8, sizeof(uint32_t));
+		memcpy(&hashes[0], bytes.data() + 16, sizeof(hashes));
+
+		if(version != CACHE_FORMAT_VERSION || hashes[0] != m_font_hash || hashes[1] != m_features_hash)
+		{
+			m_needs_rewrite = true;
+			return;
+		}
+
+		// index the records. if the file ends with a partial or corrupt record (eg. if we crashed while
+		// writing it, or the file was tampered with), stop there, and rewrite the whole file when saving.
+		size_t offset = HEADER_SIZE;
+		while(offset < bytes.size())
+		{
+			if(bytes.size() - offset < RECORD_HEADER_SIZE)
+				break;
+
+			uint32_t fields[7] {};
+			memcpy(&fields[0], bytes.data() + offset, sizeof(fields));
+
+			const auto [record_size, text_len, num_glyphs, num_adjs, num_used, num_mappings, num_cps] = fields;
+			const size_t expected_size = RECORD_HEADER_SIZE
+			                           + sizeof(uint32_t) * (size_t(text_len) + num_glyphs + num_used)
+			                           + sizeof(double) * 4 * size_t(num_adjs)
+			                           + sizeof(uint32_t) * (2 * size_t(num_mappings) + num_cps);
+
+			if(record_size != expected_size || record_size > bytes.size() - offset
+			    || (num_adjs != 0 && num_adjs != num_glyphs)
+			    || not is_valid_record(bytes.data() + offset, fields, m_num_glyphs))
+				break;
+
+			auto text = reinterpret_cast<const char32_t*>(bytes.data() + offset + RECORD_HEADER_SIZE);
+			m_offsets[std::u32string_view(text, text_len)] = offset;
+
+			offset += record_size;
+		}
+
+		m_valid_size = offset;
+		if(m_valid_size != bytes.size())
+		{
+			sap::warn("font", "shaping cache '{}' is corrupt; ignoring the end of the file", m_path);
+			m_needs_rewrite = true;
+		}
+	}
+
+	std::optional<PersistentShapingCache::Entry> PersistentShapingCache::find(zst::wstr_view text)
+	{
+		if(auto it = m_new_entries.find(text.sv()); it != m_new_entries.end())
+		{
+			m_hits++;
+			return it->second;
+		}
+
+		auto it = m_offsets.find(text.sv());
+		if(it == m_offsets.end())
+		{
+			m_misses++;
+			return std::nullopt;
+		}
+
+		m_hits++;
+
+		// note: the record was validated by `load`, so we don't need to check anything here.
+		auto ptr = m_file.get() + it->second;
+		auto read_u32 = [&ptr]() -> uint32_t {
+			uint32_t ret = 0;
+			memcpy(&ret, ptr, sizeof(uint32_t));
+			ptr += sizeof(uint32_t);
+			return ret;
+		};
+
+		auto read_f64 = [&ptr]() -> double {
+			double ret = 0;
+			memcpy(&ret, ptr, sizeof(double));
+			ptr += sizeof(double);
+			return ret;
+		};
+
+		read_u32();
+		const auto text_len = read_u32();
+		const auto num_glyphs = read_u32();
+		const auto num_adjs = read_u32();
+		const auto num_used = read_u32();
+		const auto num_mappings = read_u32();
+		read_u32();
+
+		ptr += sizeof(uint32_t) * text_len;
+
+		Entry entry {};
+		entry.glyphs.reserve(num_glyphs);
+		for(uint32_t i = 0; i < num_glyphs; i++)
+			entry.glyphs.push_back(GlyphId(read_u32()));
+
+		entry.adjustments.reserve(num_adjs);
+		for(uint32_t i = 0; i < num_adjs; i++)
+		{
+			auto& adj = entry.adjustments.emplace_back();
+			adj.horz_placement = font::FontScalar(read_f64());
+			adj.vert_placement = font::FontScalar(read_f64());
+			adj.horz_advance = font::FontScalar(read_f64());
+			adj.vert_advance = font::FontScalar(read_f64());
+		}
+
+		entry.used_glyphs.reserve(num_used);
+		for(uint32_t i = 0; i < num_used; i++)
+			entry.used_glyphs.push_back(GlyphId(read_u32()));
+
+		entry.unicode_mappings.reserve(num_mappings);
+		for(uint32_t i = 0; i < num_mappings; i++)
+		{
+			auto gid = GlyphId(read_u32());
+			auto num_cps = read_u32();
+
+			std::vector<char32_t> cps {};
+			cps.reserve(num_cps);
+			for(uint32_t k = 0; k < num_cps; k++)
+				cps.push_back(static_cast<char32_t>(read_u32()));
+
+			entry.unicode_mappings.emplace_back(gid, std::move(cps));
+		}
+
+		return entry;
+	}
+
+	void PersistentShapingCache::insert(zst::wstr_view text, Entry entry)
+	{
+		if(m_offsets.contains(text.sv()))
+			return;
+
+		m_new_entries.emplace(text.str(), std::move(entry));
+	}
+
+	static void serialise_entry(std::vector<uint8_t>& buf,
+	    std::u32string_view text,
+	    const PersistentShapingCache::Entry& e)
+	{
+		auto write_u32 = [&buf](uint32_t x) {
+			auto p = reinterpret_cast<const uint8_t*>(&x);
+			buf.insert(buf.end(), p, p + sizeof(uint32_t));
+		};
+
+		auto write_f64 = [&buf](double x) {
+			auto p = reinterpret_cast<const uint8_t*>(&x);
+			buf.insert(buf.end(), p, p + sizeof(double));
+		};
+
+		size_t num_cps = 0;
+		for(auto& [_, cps] : e.unicode_mappings)
+			num_cps += cps.size();
+
+		const auto record_size = RECORD_HEADER_SIZE
+		                       + sizeof(uint32_t) * (text.size() + e.glyphs.size() + e.used_glyphs.size())
+		                       + sizeof(double) * 4 * e.adjustments.size()
+		                       + sizeof(uint32_t) * (2 * e.unicode_mappings.size() + num_cps);
+
+		write_u32(checked_cast<uint32_t>(record_size));
+		write_u32(checked_cast<uint32_t>(text.size()));
+		write_u32(checked_cast<uint32_t>(e.glyphs.size()));
+		write_u32(checked_cast<uint32_t>(e.adjustments.size()));
+		write_u32(checked_cast<uint32_t>(e.used_glyphs.size()));
+		write_u32(checked_cast<uint32_t>(e.unicode_mappings.size()));
+		write_u32(checked_cast<uint32_t>(num_cps));
+
+		for(auto c : text)
+			write_u32(static_cast<uint32_t>(c));
+
+		for(auto g : e.glyphs)
+			write_u32(static_cast<uint32_t>(g));
+
+		for(auto& adj : e.adjustments)
+		{
+			write_f64(adj.horz_placement.value());
+			write_f64(adj.vert_placement.value());
+			write_f64(adj.horz_advance.value());
+			write_f64(adj.vert_advance.value());
+		}
+
+		for(auto g : e.used_glyphs)
+			write_u32(static_cast<uint32_t>(g));
+
+		for(auto& [gid, cps] : e.unicode_mappings)
+		{
+			write_u32(static_cast<uint32_t>(gid));
+			write_u32(checked_cast<uint32_t>(cps.size()));
+			for(auto c : cps)
+				write_u32(static_cast<uint32_t>(c));
+		}
+	}
+
+	void PersistentShapingCache::save()
+	{
+		if(m_new_entries.empty() && not m_needs_rewrite)
+			return;
+
+		std::vector<uint8_t> buf {};
+
+		// if we need to rewrite the file, write the header and all the (valid) existing records to a new file,
+		// then rename it over the old one. otherwise, we can just append.
+		if(m_needs_rewrite)
+		{
+			buf.insert(buf.end(), std::begin(CACHE_MAGIC), std::end(CACHE_MAGIC));
+
+			uint32_t version_and_reserved[2] = { CACHE_FORMAT_VERSION, 0 };
+			buf.insert(buf.end(), reinterpret_cast<const uint8_t*>(&version_and_reserved[0]),
+			    reinterpret_cast<const uint8_t*>(&version_and_reserved[0]) + sizeof(version_and_reserved));
+
+			uint64_t hashes[2] = { m_font_hash, m_features_hash };
+			buf.insert(buf.end(), reinterpret_cast<const uint8_t*>(&hashes[0]),
+			    reinterpret_cast<const uint8_t*>(&hashes[0]) + sizeof(hashes));
+
+			if(m_valid_size > HEADER_SIZE)
+				buf.insert(buf.end(), m_file.get() + HEADER_SIZE, m_file.get() + m_valid_size);
+		}
+
+		for(auto& [text, entry] : m_new_entries)
+			serialise_entry(buf, text, entry);
+
+		// unmap the file before we write to it.
+		m_file = zst::unique_span<uint8_t[]>();
+		m_offsets.clear();
+
+		std::error_code ec {};
+		stdfs::create_directories(stdfs::path(m_path).parent_path(), ec);
+
+		auto write_to = [&buf](const std::string& path, const char* mode) -> bool {
+			auto f = fopen(path.c_str(), mode);
+			if(f == nullptr)
+				return false;
+
+			// do it in one write, so that concurrent appends (mostly) don't interleave.
+			bool ok = fwrite(buf.data(), 1, buf.size(), f) == buf.size();
+			ok &= (fclose(f) == 0);
+			return ok;
+		};
+
+		bool ok = false;
+		if(m_needs_rewrite)
+		{
+			auto tmp_path = zpr::sprint("{}.tmp{}", m_path, reinterpret_cast<uintptr_t>(this));
+			ok = write_to(tmp_path, "wb");
+			if(ok)
+			{
+				stdfs::rename(tmp_path, m_path, ec);
+				ok = not ec;
+			}
+		}
+		else
+		{
+			ok = write_to(m_path, "ab");
+		}
+
+		if(not ok)
+			sap::warn("font", "failed to write shaping cache '{}'", m_path);
+
+		m_new_entries.clear();
+		m_valid_size = 0;
+		m_needs_rewrite = false;
+	}
+}
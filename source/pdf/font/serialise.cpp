@@ -16,6 +16,34 @@
 
 namespace pdf
 {
+	void PdfFont::prepareForSerialisation() const
+	{
+		if(m_did_prepare_serialisation || m_source->isBuiltin())
+			return;
+
+		m_did_prepare_serialisation = true;
+
+		auto source_file = dynamic_cast<font::FontFile*>(m_source.get());
+
+		// make a font subset based on the glyphs that we use.
+		assert(m_embedded_contents != nullptr);
+
+		source_file->writeSubset(m_pdf_font_name, m_embedded_contents);
+
+		// write the cmap we'll use for /ToUnicode.
+		this->writeUnicodeCMap();
+		this->writeUTF8CMap();
+
+		// and the cidset
+		this->writeCIDSet();
+
+		// compressing the font file (and the cmaps) is most of the cost of writing them out, so do it here too.
+		m_embedded_contents->compressEarly();
+		m_tounicode_cmap->compressEarly();
+		if(m_utf8_cmap != nullptr)
+			m_utf8_cmap->compressEarly();
+	}
+
 	void PdfFont::serialise() const
 	{
 		assert(m_font_dictionary->isIndirect());
@@ -47,7 +75,7 @@ namespace pdf
 			auto source_file = dynamic_cast<font::FontFile*>(m_source.get());
 
 			std::vector<std::pair<GlyphId, double>> widths {};
-			for(auto& gid : source_file->usedGlyphs())
+			for(auto gid : source_file->usedGlyphs())
 			{
 				auto width = this->getMetricsForGlyph(gid).horz_advance;
 				widths.emplace_back(gid, this->scaleMetricForPDFTextSpace(width).value());
@@ -84,17 +112,8 @@ namespace pdf
 				m_glyph_widths_array->append(Array::create(std::move(ws)));
 			}
 
-			// finally, make a font subset based on the glyphs that we use.
-			assert(m_embedded_contents != nullptr);
-
-			source_file->writeSubset(m_pdf_font_name, m_embedded_contents);
-
-			// write the cmap we'll use for /ToUnicode.
-			this->writeUnicodeCMap();
-			this->writeUTF8CMap();
-
-			// and the cidset
-			this->writeCIDSet();
+			// finally, the subset and the cmaps (usually, this was already done by the parallel prepare phase)
+			this->prepareForSerialisation();
 		}
 	}
 }
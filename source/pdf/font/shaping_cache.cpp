@@ -0,0 +1,155 @@
+// shaping_cache.cpp
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pdf/shaping_cache.h"
+
+namespace pdf
+{
+	static constexpr size_t ARENA_CHUNK_SIZE = 4096;
+
+	ShapingCache::ShapingCache(size_t budget_bytes) : m_budget_bytes(budget_bytes)
+	{
+	}
+
+	std::shared_ptr<const ShapingCache::Entry> ShapingCache::find(font::FeatureSetId features, zst::wstr_view text)
+	{
+		if(auto it = m_index.find(Key { features, text.sv() }); it != m_index.end())
+		{
+			m_hits++;
+
+			auto& slot = m_slots[it->second];
+			slot.referenced = true;
+			return slot.entry;
+		}
+
+		m_misses++;
+		return nullptr;
+	}
+
+	std::shared_ptr<const ShapingCache::Entry> ShapingCache::insert(font::FeatureSetId features,
+	    zst::wstr_view text,
+	    std::vector<font::GlyphInfo> glyphs)
+	{
+		assert(not m_index.contains(Key { features, text.sv() }));
+
+		const auto bytes = sizeof(Slot) + text.size() * sizeof(char32_t) + glyphs.size() * sizeof(font::GlyphInfo);
+
+		// always keep at least the entry we're inserting, even if it alone is over budget.
+		while(m_used_bytes + bytes > m_budget_bytes && m_index.size() > 0)
+			this->evict_one();
+
+		font::FontScalar width = 0;
+		for(auto& g : glyphs)
+			width += g.metrics.horz_advance + g.adjustments.horz_advance;
+
+		size_t idx = 0;
+		if(not m_free_slots.empty())
+		{
+			idx = m_free_slots.back();
+			m_free_slots.pop_back();
+		}
+		else
+		{
+			idx = m_slots.size();
+			m_slots.emplace_back();
+		}
+
+		auto& slot = m_slots[idx];
+		slot.key = Key { features, this->copy_key(text) };
+		slot.entry = std::make_shared<const Entry>(Entry { .glyphs = std::move(glyphs), .width = width });
+		slot.bytes = bytes;
+		slot.live = true;
+		slot.referenced = false;
+
+		m_used_bytes += bytes;
+		m_index.emplace(slot.key, idx);
+
+		return slot.entry;
+	}
+
+	void ShapingCache::evict_one()
+	{
+		assert(not m_slots.empty());
+		while(true)
+		{
+			if(m_clock_hand >= m_slots.size())
+				m_clock_hand = 0;
+
+			auto& slot = m_slots[m_clock_hand++];
+			if(not slot.live)
+				continue;
+
+			if(slot.referenced)
+			{
+				slot.referenced = false;
+				continue;
+			}
+
+			m_index.erase(slot.key);
+			m_used_bytes -= slot.bytes;
+			m_arena_garbage += slot.key.text.size();
+			m_evictions++;
+
+			slot.live = false;
+			slot.key = {};
+			slot.entry = nullptr;
+			m_free_slots.push_back(m_clock_hand - 1);
+			break;
+		}
+
+		if(m_arena_garbage > ARENA_CHUNK_SIZE && m_arena_garbage > m_arena_total / 2)
+			this->compact_arena();
+	}
+
+	std::u32string_view ShapingCache::copy_key(zst::wstr_view text)
+	{
+		if(m_arena.empty() || m_arena_chunk_used + text.size() > m_arena_chunk_size)
+		{
+			m_arena_chunk_size = std::max(ARENA_CHUNK_SIZE, text.size());
+			m_arena_chunk_used = 0;
+			m_arena.push_back(std::make_unique<char32_t[]>(m_arena_chunk_size));
+		}
+
+		auto ptr = m_arena.back().get() + m_arena_chunk_used;
+		std::copy(text.begin(), text.end(), ptr);
+
+		m_arena_chunk_used += text.size();
+		m_arena_total += text.size();
+
+		return std::u32string_view(ptr, text.size());
+	}
+
+	void ShapingCache::compact_arena()
+	{
+		auto old_arena = std::move(m_arena);
+
+		m_arena.clear();
+		m_arena_chunk_used = 0;
+		m_arena_chunk_size = 0;
+		m_arena_total = 0;
+		m_arena_garbage = 0;
+
+		m_index.clear();
+		for(size_t i = 0; i < m_slots.size(); i++)
+		{
+			auto& slot = m_slots[i];
+			if(not slot.live)
+				continue;
+
+			slot.key.text = this->copy_key(slot.key.text);
+			m_index.emplace(slot.key, i);
+		}
+	}
+
+	ShapingCache::Stats ShapingCache::stats() const
+	{
+		return Stats {
+			.hits = m_hits,
+			.misses = m_misses,
+			.evictions = m_evictions,
+			.entries = m_index.size(),
+			.bytes = m_used_bytes,
+		};
+	}
+}
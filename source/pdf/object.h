@@ -226,6 +226,10 @@ namespace pdf
 		bool isCompressed() const { return m_compressed; }
 		void setCompressed(bool compressed);
 
+		// compress the contents now rather than when the stream is written, so that it can be done off the
+		// main thread. this doesn't create any objects, so it is safe to call concurrently for different streams.
+		void compressEarly();
+
 		void append(zst::str_view xs);
 		void append(zst::byte_span xs);
 		void append(const uint8_t* arr, size_t num);
@@ -255,6 +259,7 @@ namespace pdf
 	private:
 		zst::byte_buffer m_bytes;
 		bool m_compressed = false;
+		std::optional<std::vector<uint8_t>> m_compressed_bytes {};
 		Dictionary* m_dict = nullptr;
 	};
 
@@ -32,6 +32,7 @@ namespace pdf
 		void addAnnotation(const Annotation* annotation);
 
 		Dictionary* dictionary() const { return m_dictionary; }
+		const util::hashset<const Resource*>& resources() const { return m_resources; }
 
 	private:
 		Dictionary* m_dictionary;
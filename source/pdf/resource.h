@@ -22,6 +22,13 @@ namespace pdf
 		virtual void serialise() const = 0;
 		virtual Object* resourceObject() const = 0;
 
+		/*
+		    Does the expensive part of serialisation that does not need to create any pdf objects (which are not
+		    thread-safe). This is called (once) for all resources concurrently, before any of them are serialised;
+		    implementations must only touch state that is owned by the resource itself.
+		*/
+		virtual void prepareForSerialisation() const { }
+
 	protected:
 		enum Kind
 		{
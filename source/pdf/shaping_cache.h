@@ -0,0 +1,163 @@
+// shaping_cache.h
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "util.h"
+#include "types.h"
+
+#include "font/metrics.h"
+#include "font/features.h"
+#include "font/font_scalar.h"
+
+namespace pdf
+{
+	/*
+	    A cache from (feature set, string) to the shaped glyphs (and total advance), with a fixed memory budget.
+	    Once the budget is exceeded, entries are evicted using the CLOCK algorithm -- an approximation of LRU,
+	    where each entry has a "referenced" bit that is set on every hit and cleared by the clock hand as it
+	    sweeps past; the first entry that the hand finds with a cleared bit is evicted.
+
+	    The keys are copied into an arena (rather than each being its own std::u32string); the arena is
+	    compacted once most of it is taken up by the keys of evicted entries.
+
+	    Entries are handed out as shared pointers, so an entry that is still being used (eg. while a word is
+	    rendered) stays alive even if a later `insert` evicts it.
+	*/
+	struct ShapingCache
+	{
+		struct Entry
+		{
+			std::vector<font::GlyphInfo> glyphs;
+			font::FontScalar width;
+		};
+
+		struct Stats
+		{
+			size_t hits;
+			size_t misses;
+			size_t evictions;
+
+			size_t entries;
+			size_t bytes;
+		};
+
+		explicit ShapingCache(size_t budget_bytes = DEFAULT_BUDGET_BYTES);
+
+		ShapingCache(ShapingCache&&) = default;
+		ShapingCache& operator=(ShapingCache&&) = default;
+
+		std::shared_ptr<const Entry> find(font::FeatureSetId features, zst::wstr_view text);
+		std::shared_ptr<const Entry> insert(font::FeatureSetId features,
+		    zst::wstr_view text,
+		    std::vector<font::GlyphInfo> glyphs);
+
+		Stats stats() const;
+
+		static constexpr size_t DEFAULT_BUDGET_BYTES = 16 * 1024 * 1024;
+
+	private:
+		struct Key
+		{
+			font::FeatureSetId features;
+			std::u32string_view text;
+
+			bool operator==(const Key&) const = default;
+			size_t hash() const { return XXH64(text.data(), text.size() * sizeof(char32_t), features.value); }
+		};
+
+		struct Slot
+		{
+			Key key;
+			std::shared_ptr<const Entry> entry;
+
+			size_t bytes;
+			bool live;
+			bool referenced;
+		};
+
+		void evict_one();
+		std::u32string_view copy_key(zst::wstr_view text);
+		void compact_arena();
+
+		size_t m_budget_bytes;
+		size_t m_used_bytes = 0;
+
+		std::vector<Slot> m_slots {};
+		std::vector<size_t> m_free_slots {};
+		size_t m_clock_hand = 0;
+
+		util::hashmap<Key, size_t> m_index {};
+
+		// the arena is a list of chunks that are never reallocated, so the keys (and the index) stay valid.
+		std::vector<std::unique_ptr<char32_t[]>> m_arena {};
+		size_t m_arena_chunk_used = 0;
+		size_t m_arena_chunk_size = 0;
+		size_t m_arena_total = 0;
+		size_t m_arena_garbage = 0;
+
+		size_t m_hits = 0;
+		size_t m_misses = 0;
+		size_t m_evictions = 0;
+	};
+
+	/*
+	    An on-disk cache of shaped words that persists across runs, for one font (identified by a hash of the
+	    font file) and one feature set. It is disabled unless a cache directory is set.
+
+	    Each entry stores the glyphs after substitution and their GPOS adjustments, together with the side
+	    effects that shaping has on the font -- glyphs that were marked as used, and extra unicode mappings for
+	    ligatures and the like -- so that they can be replayed exactly. Glyph metrics and custom (script-defined)
+	    adjustments are not stored, since they are cheap to recompute.
+
+	    The file is mapped in (read-only) when the cache is opened, and new entries are appended by `save`. The
+	    file format is native-endian and unversioned beyond the header, so it should not be shared between
+	    machines.
+	*/
+	struct PersistentShapingCache
+	{
+		struct Entry
+		{
+			std::vector<GlyphId> glyphs;
+			std::vector<font::GlyphAdjustment> adjustments;
+
+			std::vector<GlyphId> used_glyphs;
+			std::vector<std::pair<GlyphId, std::vector<char32_t>>> unicode_mappings;
+		};
+
+		std::optional<Entry> find(zst::wstr_view text);
+		void insert(zst::wstr_view text, Entry entry);
+
+		// note: this should only be called once, when we're done with the cache.
+		void save();
+
+		size_t hits() const { return m_hits; }
+		size_t misses() const { return m_misses; }
+
+		// returns null if there is no cache directory. records with glyph ids >= `num_glyphs` are treated as corrupt.
+		static std::unique_ptr<PersistentShapingCache> open(uint64_t font_hash,
+		    uint64_t features_hash,
+		    size_t num_glyphs);
+		static void setDirectory(std::optional<std::string> dir);
+
+	private:
+		PersistentShapingCache(std::string path, uint64_t font_hash, uint64_t features_hash, size_t num_glyphs);
+		void load();
+
+		std::string m_path;
+		uint64_t m_font_hash;
+		uint64_t m_features_hash;
+		size_t m_num_glyphs;
+
+		zst::unique_span<uint8_t[]> m_file {};
+		size_t m_valid_size = 0;
+		bool m_needs_rewrite = false;
+
+		util::hashmap<std::u32string_view, size_t> m_offsets {};
+		util::hashmap<std::u32string, Entry> m_new_entries {};
+
+		size_t m_hits = 0;
+		size_t m_misses = 0;
+	};
+}
@@ -32,6 +32,7 @@ namespace pdf
 	void Stream::clear()
 	{
 		m_bytes.clear();
+		m_compressed_bytes.reset();
 	}
 
 	void Stream::setCompressed(bool compressed)
@@ -39,6 +40,32 @@ namespace pdf
 		m_compressed = compressed;
 	}
 
+	static std::optional<std::vector<uint8_t>> compress_bytes(zst::byte_span bytes)
+	{
+		auto compressor = libdeflate_alloc_compressor(6);
+		assert(compressor != nullptr);
+
+		auto _ = util::Defer([&]() { libdeflate_free_compressor(compressor); });
+
+		// needs slack space
+		auto compressed = std::vector<uint8_t>(bytes.size() + 10);
+
+		auto compressed_len = libdeflate_zlib_compress(compressor, bytes.data(), bytes.size(), compressed.data(),
+		    compressed.size());
+
+		if(compressed_len == 0)
+			return std::nullopt;
+
+		compressed.resize(compressed_len);
+		return compressed;
+	}
+
+	void Stream::compressEarly()
+	{
+		if(m_compressed && not m_compressed_bytes.has_value())
+			m_compressed_bytes = compress_bytes(m_bytes.span());
+	}
+
 	void Stream::writeFull(Writer* w) const
 	{
 		if(not this->isIndirect())
@@ -59,35 +86,22 @@ namespace pdf
 		};
 
 
-		bool did_compress = false;
-		while(m_compressed)
-		{
-			// needs slack space
-			auto buf_size = m_bytes.size() + 10;
-			auto compressed_bytes = new uint8_t[buf_size];
-			auto _ = util::Defer([&]() { delete[] compressed_bytes; });
-
-			auto compressor = libdeflate_alloc_compressor(6);
-			assert(compressor != nullptr);
-
-			auto compressed_len = libdeflate_zlib_compress(compressor, m_bytes.data(), m_bytes.size(), compressed_bytes,
-			    buf_size);
-
-			if(compressed_len == 0)
-				break;
-
-			libdeflate_free_compressor(compressor);
+		// use the bytes from compressEarly if we have them.
+		std::optional<std::vector<uint8_t>> compressed {};
+		if(m_compressed && not m_compressed_bytes.has_value())
+			compressed = compress_bytes(m_bytes.span());
 
+		const auto& compressed_bytes = m_compressed_bytes.has_value() ? m_compressed_bytes : compressed;
+		if(m_compressed && compressed_bytes.has_value())
+		{
+			auto len = compressed_bytes->size();
 			m_dict->addOrReplace(names::Length1, Integer::create(util::checked_cast<int64_t>(m_bytes.size())));
-			m_dict->addOrReplace(names::Length, Integer::create(util::checked_cast<int64_t>(compressed_len)));
+			m_dict->addOrReplace(names::Length, Integer::create(util::checked_cast<int64_t>(len)));
 			m_dict->addOrReplace(names::Filter, names::FlateDecode.ptr());
 
-			write_the_thing(w, m_dict, zst::byte_span(compressed_bytes, compressed_len));
-			did_compress = true;
-			break;
+			write_the_thing(w, m_dict, zst::byte_span(compressed_bytes->data(), len));
 		}
-
-		if(not did_compress)
+		else
 		{
 			m_dict->addOrReplace(names::Length, Integer::create(util::checked_cast<int64_t>(m_bytes.size())));
 			write_the_thing(w, m_dict, m_bytes.span());
@@ -107,6 +121,7 @@ namespace pdf
 	void Stream::append(const uint8_t* arr, size_t num)
 	{
 		m_bytes.append(arr, num);
+		m_compressed_bytes.reset();
 	}
 
 	void Stream::setContents(zst::byte_span bytes)
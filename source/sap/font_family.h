@@ -51,4 +51,11 @@ namespace sap
 		pdf::PdfFont* m_bold_font;
 		pdf::PdfFont* m_bold_italic_font;
 	};
+
+	/*
+	    The font families to try (in order) for characters that the main font of a style does not have
+	    glyphs for. Styles only refer to these by pointer, so that they stay trivially copyable; the
+	    chains themselves are owned (and deduplicated) by the interpreter.
+	*/
+	using FontFallbackChain = std::vector<FontFamily>;
 }
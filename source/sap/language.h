@@ -0,0 +1,33 @@
+// language.h
+// Copyright (c) 2022, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+namespace sap
+{
+	/*
+	    The language of some text, which (for now) only decides which hyphenation patterns are used for it.
+	    Languages are named by their tag, eg. "en-gb" or "de"; the names are normalised (lowercase, with
+	    '-' instead of '_') and interned, so that a style can hold its language by value.
+
+	    like FeatureSetIds, the id of a language depends on the order in which they were interned, except
+	    for the default language (British English), which is always `DEFAULT_LANGUAGE`.
+	*/
+	struct Language
+	{
+		uint32_t value;
+
+		static Language named(std::string_view name);
+		const std::string& name() const;
+
+		bool operator==(const Language&) const = default;
+		size_t hash() const { return std::hash<uint32_t>()(value); }
+	};
+
+	inline constexpr auto DEFAULT_LANGUAGE = Language { 0 };
+}
@@ -4,13 +4,18 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "util.h"
 #include "units.h"
 
 #include "sap/units.h"
 #include "sap/colour.h"
+#include "sap/language.h"
 #include "sap/font_family.h"
 
+#include "font/features.h"
+
 namespace sap
 {
 	enum class Alignment
@@ -36,6 +41,8 @@ namespace sap
 	}
 
 		DEFINE_ACCESSOR(FontFamily, m_font_family, font_family, have_font_family);
+		DEFINE_ACCESSOR(const FontFallbackChain*, m_font_fallbacks, font_fallbacks, have_font_fallbacks);
+		DEFINE_ACCESSOR(font::FeatureSetId, m_font_features, font_features, have_font_features);
 		DEFINE_ACCESSOR(FontStyle, m_font_style, font_style, have_font_style);
 		DEFINE_ACCESSOR(Length, m_font_size, font_size, have_font_size);
 		DEFINE_ACCESSOR(Length, m_root_font_size, root_font_size, have_root_font_size);
@@ -45,6 +52,7 @@ namespace sap
 		DEFINE_ACCESSOR(Alignment, m_horz_alignment, horz_alignment, have_horz_alignment);
 		DEFINE_ACCESSOR(Colour, m_colour, colour, have_colour);
 		DEFINE_ACCESSOR(bool, m_enable_smart_quotes, smart_quotes_enabled, have_smart_quotes_enablement);
+		DEFINE_ACCESSOR(Language, m_language, language, have_language);
 #undef DEFINE_ACCESSOR
 
 
@@ -56,6 +64,7 @@ namespace sap
 		{                                                                \
 			field_name.set(std::move(*new_value));                       \
 			m_present_styles |= STY_##field_name;                        \
+			m_interned = {};                                             \
 		}                                                                \
 		return *this;                                                    \
 	}                                                                    \
@@ -68,6 +77,8 @@ namespace sap
 	}
 
 		DEFINE_SETTER(FontFamily, m_font_family, set_font_family, with_font_family);
+		DEFINE_SETTER(const FontFallbackChain*, m_font_fallbacks, set_font_fallbacks, with_font_fallbacks);
+		DEFINE_SETTER(font::FeatureSetId, m_font_features, set_font_features, with_font_features);
 		DEFINE_SETTER(FontStyle, m_font_style, set_font_style, with_font_style);
 		DEFINE_SETTER(Length, m_font_size, set_font_size, with_font_size);
 		DEFINE_SETTER(Length, m_root_font_size, set_root_font_size, with_root_font_size);
@@ -77,73 +88,78 @@ namespace sap
 		DEFINE_SETTER(Alignment, m_horz_alignment, set_horz_alignment, with_horz_alignment);
 		DEFINE_SETTER(Colour, m_colour, set_colour, with_colour);
 		DEFINE_SETTER(bool, m_enable_smart_quotes, enable_smart_quotes, with_smart_quotes_enabled);
+		DEFINE_SETTER(Language, m_language, set_language, with_language);
 
 #undef DEFINE_SETTER
 
-#define NONE
-
-#define VALUE_OR_ELSE(field_name, left, right)                             \
-	[&]() {                                                                \
-		std::optional<typename decltype(field_name)::value_type> __ret {}; \
-		if((left).m_present_styles & (STY_##field_name))                   \
-			__ret = *(left).field_name;                                    \
-		else if((right).m_present_styles & (STY_##field_name))             \
-			__ret = *(right).field_name;                                   \
-		return __ret;                                                      \
-	}()
-
 		/*
 		    with the current style as the reference, change all of our fields to those that `main` has.
+
+		    The result is interned (see below), and memoised per pair of styles, so this is cheap enough to
+		    call for every word.
 		*/
-		Style extendWith(const Style& main) const
-		{
-			auto style = Style();
-			style.set_font_family(VALUE_OR_ELSE(m_font_family, main, *this))
-			    .set_font_style(VALUE_OR_ELSE(m_font_style, main, *this))
-			    .set_font_size(VALUE_OR_ELSE(m_font_size, main, *this))
-			    .set_line_spacing(VALUE_OR_ELSE(m_line_spacing, main, *this))
-			    .set_sentence_space_stretch(VALUE_OR_ELSE(m_sentence_space_stretch, main, *this))
-			    .set_paragraph_spacing(VALUE_OR_ELSE(m_paragraph_spacing, main, *this))
-			    .set_horz_alignment(VALUE_OR_ELSE(m_horz_alignment, main, *this))
-			    .set_root_font_size(VALUE_OR_ELSE(m_root_font_size, main, *this))
-			    .set_colour(VALUE_OR_ELSE(m_colour, main, *this))
-			    .enable_smart_quotes(VALUE_OR_ELSE(m_enable_smart_quotes, main, *this)) //
-			    ;
-
-			return style;
-		}
+		const Style& extendWith(const Style& main) const;
 
 		/*
 		    use `fallback` to fill in any fields that the current style does not have.
 		*/
-		Style useDefaultsFrom(const Style& fallback) const
-		{
-			auto style = Style();
-			style.set_font_family(VALUE_OR_ELSE(m_font_family, *this, fallback))
-			    .set_font_style(VALUE_OR_ELSE(m_font_style, *this, fallback))
-			    .set_font_size(VALUE_OR_ELSE(m_font_size, *this, fallback))
-			    .set_line_spacing(VALUE_OR_ELSE(m_line_spacing, *this, fallback))
-			    .set_sentence_space_stretch(VALUE_OR_ELSE(m_sentence_space_stretch, *this, fallback))
-			    .set_paragraph_spacing(VALUE_OR_ELSE(m_paragraph_spacing, *this, fallback))
-			    .set_horz_alignment(VALUE_OR_ELSE(m_horz_alignment, *this, fallback))
-			    .set_root_font_size(VALUE_OR_ELSE(m_root_font_size, *this, fallback))
-			    .set_colour(VALUE_OR_ELSE(m_colour, *this, fallback))
-			    .enable_smart_quotes(VALUE_OR_ELSE(m_enable_smart_quotes, *this, fallback)) //
-			    ;
-
-			return style;
-		}
-#undef NONE
-#undef VALUE_OR_ELSE
+		const Style& useDefaultsFrom(const Style& fallback) const { return fallback.extendWith(*this); }
+
+		/*
+		    Styles are interned: for every distinct style, there is one immutable copy that lives for the rest
+		    of the program, and two interned styles are equal exactly when they are the same object. Every style
+		    remembers its interned copy once it is known (so copies of an interned style are also cheap to
+		    compare and extend), and forgets it when it is modified.
+		*/
+		const Style& interned() const;
+		size_t hash() const;
+
+		/*
+		    forget every interned style (except the empty one), and everything that `extendWith` memoised. this
+		    is done at the start of every compile, since the styles of the previous one refer to its fonts, which
+		    are gone by then; no style (or Stylable) from before may be used afterwards.
+		*/
+		static void forgetInternedStyles();
 
 
 		bool operator!=(const Style& other) const = default;
 		bool operator==(const Style& other) const
+		{
+			auto a = m_interned.get();
+			auto b = other.m_interned.get();
+			if(a != nullptr && b != nullptr)
+				return a == b;
+
+			return this->equal_fields(other);
+		}
+
+		static const Style& empty();
+		const pdf::PdfFont* font() const { return this->font_family().getFontForStyle(this->font_style()); }
+
+
+		static constexpr uint32_t STY_m_font_family = (1u << 0);
+		static constexpr uint32_t STY_m_font_style = (1u << 1);
+		static constexpr uint32_t STY_m_font_size = (1u << 2);
+		static constexpr uint32_t STY_m_root_font_size = (1u << 3);
+		static constexpr uint32_t STY_m_line_spacing = (1u << 4);
+		static constexpr uint32_t STY_m_sentence_space_stretch = (1u << 5);
+		static constexpr uint32_t STY_m_paragraph_spacing = (1u << 6);
+		static constexpr uint32_t STY_m_horz_alignment = (1u << 7);
+		static constexpr uint32_t STY_m_colour = (1u << 8);
+		static constexpr uint32_t STY_m_enable_smart_quotes = (1u << 9);
+		static constexpr uint32_t STY_m_font_fallbacks = (1u << 10);
+		static constexpr uint32_t STY_m_font_features = (1u << 11);
+		static constexpr uint32_t STY_m_language = (1u << 12);
+
+	private:
+		bool equal_fields(const Style& other) const
 		{
 			if(m_present_styles != other.m_present_styles)
 				return false;
 
 			return (not(m_present_styles & STY_m_font_family) || *m_font_family == *other.m_font_family)
+			    && (not(m_present_styles & STY_m_font_fallbacks) || *m_font_fallbacks == *other.m_font_fallbacks)
+			    && (not(m_present_styles & STY_m_font_features) || *m_font_features == *other.m_font_features)
 			    && (not(m_present_styles & STY_m_font_style) || *m_font_style == *other.m_font_style)
 			    && (not(m_present_styles & STY_m_font_size) || *m_font_size == *other.m_font_size)
 			    && (not(m_present_styles & STY_m_root_font_size) || *m_root_font_size == *other.m_root_font_size)
@@ -155,28 +171,33 @@ namespace sap
 			    && (not(m_present_styles & STY_m_horz_alignment) || *m_horz_alignment == *other.m_horz_alignment)
 			    && (not(m_present_styles & STY_m_colour) || *m_colour == *other.m_colour)
 			    && (not(m_present_styles & STY_m_enable_smart_quotes)
-			        || *m_enable_smart_quotes == *other.m_enable_smart_quotes);
+			        || *m_enable_smart_quotes == *other.m_enable_smart_quotes)
+			    && (not(m_present_styles & STY_m_language) || *m_language == *other.m_language);
 		}
 
-		static const Style& empty();
-		const pdf::PdfFont* font() const { return this->font_family().getFontForStyle(this->font_style()); }
+		// an atomic, since a style that is shared between layout threads might be interned by several of them.
+		struct InternedPtr
+		{
+			InternedPtr() = default;
+			InternedPtr(const InternedPtr& other) : ptr(other.get()) { }
+			InternedPtr& operator=(const InternedPtr& other)
+			{
+				ptr.store(other.get(), std::memory_order_release);
+				return *this;
+			}
 
+			const Style* get() const { return ptr.load(std::memory_order_acquire); }
+			void set(const Style* style) const { ptr.store(style, std::memory_order_release); }
 
-		static constexpr uint32_t STY_m_font_family = (1u << 0);
-		static constexpr uint32_t STY_m_font_style = (1u << 1);
-		static constexpr uint32_t STY_m_font_size = (1u << 2);
-		static constexpr uint32_t STY_m_root_font_size = (1u << 3);
-		static constexpr uint32_t STY_m_line_spacing = (1u << 4);
-		static constexpr uint32_t STY_m_sentence_space_stretch = (1u << 5);
-		static constexpr uint32_t STY_m_paragraph_spacing = (1u << 6);
-		static constexpr uint32_t STY_m_horz_alignment = (1u << 7);
-		static constexpr uint32_t STY_m_colour = (1u << 8);
-		static constexpr uint32_t STY_m_enable_smart_quotes = (1u << 9);
+			mutable std::atomic<const Style*> ptr = nullptr;
+		};
 
-	private:
+		InternedPtr m_interned {};
 		uint32_t m_present_styles = 0;
 
 		Uninitialised<FontFamily> m_font_family;
+		Uninitialised<const FontFallbackChain*> m_font_fallbacks;
+		Uninitialised<font::FeatureSetId> m_font_features;
 		Uninitialised<FontStyle> m_font_style;
 		Uninitialised<Length> m_font_size;
 		Uninitialised<Length> m_root_font_size;
@@ -187,18 +208,19 @@ namespace sap
 		Uninitialised<Colour> m_colour;
 
 		Uninitialised<bool> m_enable_smart_quotes;
+		Uninitialised<Language> m_language;
 	};
 
 
 
 	struct Stylable
 	{
-		explicit inline Stylable(const Style& style = Style::empty()) : m_style(style) { }
+		explicit inline Stylable(const Style& style = Style::empty()) : m_style(&style.interned()) { }
 
-		const Style& style() const { return m_style; }
-		void setStyle(const Style& s) { m_style = s; }
+		const Style& style() const { return *m_style; }
+		void setStyle(const Style& s) { m_style = &s.interned(); }
 
 	protected:
-		Style m_style;
+		const Style* m_style;
 	};
 }
@@ -127,6 +127,7 @@ namespace sap::tree
 		m_raise_height = obj.m_raise_height;
 		m_link_destination = obj.m_link_destination;
 		m_parent_span = obj.m_parent_span;
+		m_copied_from = obj.m_copied_from != nullptr ? obj.m_copied_from : &obj;
 
 		if(m_kind == Kind::Span && obj.m_kind == Kind::Span)
 		{
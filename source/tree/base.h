@@ -89,6 +89,11 @@ namespace sap::tree
 		InlineSpan* parentSpan() const { return m_parent_span; }
 		void setParentSpan(InlineSpan* span) { m_parent_span = span; }
 
+		// the object that this one was (ultimately) made from with `copyAttributesFrom`, if any. this is only
+		// used to remember how a paragraph's objects were processed, so it is only valid while that object is.
+		const InlineObject* copiedFrom() const { return m_copied_from; }
+		void clearCopiedFrom() { m_copied_from = nullptr; }
+
 		bool isSpan() const { return m_kind == Kind::Span; }
 		bool isText() const { return m_kind == Kind::Text; }
 		bool isSeparator() const { return m_kind == Kind::Separator; }
@@ -125,6 +130,7 @@ namespace sap::tree
 		Length m_raise_height = 0;
 		LinkDestination m_link_destination {};
 		InlineSpan* m_parent_span = nullptr;
+		const InlineObject* m_copied_from = nullptr;
 	};
 
 	struct InlineSpan : InlineObject
@@ -309,4 +315,18 @@ namespace sap::tree
 
 	ErrorOr<std::vector<zst::SharedPtr<InlineObject>>> performReplacements(const Style& parent_style,
 	    std::vector<zst::SharedPtr<InlineObject>> vec);
+
+	/*
+	    Split words at their hyphenation points, using the patterns for the language of each word's style.
+	    This expects the words to have been separated already (by `processWordSeparators`).
+	*/
+	ErrorOr<std::vector<zst::SharedPtr<InlineObject>>> insertHyphenationPoints(const Style& parent_style,
+	    std::vector<zst::SharedPtr<InlineObject>> vec);
+
+	/*
+	    Split texts into runs of characters that use the same font, for styles that have a font fallback
+	    chain; runs that need a fallback font get a style with that font family.
+	*/
+	ErrorOr<std::vector<zst::SharedPtr<InlineObject>>> applyFontFallbacks(const Style& parent_style,
+	    std::vector<zst::SharedPtr<InlineObject>> vec);
 }
@@ -4,6 +4,9 @@
 
 
 #include "tree/container.h"
+#include "tree/paragraph.h"
+
+#include "misc/thread_pool.h"
 
 #include "interp/interp.h"
 #include "interp/evaluator.h"
@@ -18,7 +21,7 @@ namespace sap::tree
 	Container::Container(Direction direction, bool glued)
 	    : BlockObject(Kind::Container), m_glued(glued), m_direction(direction)
 	{
-		this->setStyle(m_style.with_horz_alignment(Alignment::Left));
+		this->setStyle(m_style->with_horz_alignment(Alignment::Left));
 	}
 
 	zst::SharedPtr<Container> Container::makeVertBox()
@@ -51,7 +54,7 @@ namespace sap::tree
 	{
 		auto _ = cs->evaluator().pushBlockContext(this);
 
-		auto cur_style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto cur_style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 		std::vector<std::unique_ptr<layout::LayoutObject>> objects;
 
 		bool have_top_border = false;
@@ -93,12 +96,39 @@ namespace sap::tree
 		available_space.x() -= extra_border_width;
 		available_space.y() -= extra_border_height;
 
+		// paragraphs that don't run any scripts only need the available width, so (unless we are a horizontal
+		// container, where each child takes width away from the next) their width is known up front. break
+		// those into lines on the thread pool first; everything else (and positioning) stays sequential.
+		std::vector<std::optional<ErrorOr<LayoutResult>>> precomputed(m_objects.size());
+		if(m_direction != Direction::Horizontal)
+		{
+			std::vector<size_t> para_idxs {};
+			for(size_t i = 0; i < m_objects.size(); i++)
+			{
+				if(auto para = m_objects[i]->castToParagraph(); para != nullptr && not para->hasScriptCalls())
+					para_idxs.push_back(i);
+			}
+
+			if(para_idxs.size() > 1)
+			{
+				util::ThreadPool::get().forEach(para_idxs.size(), [&](size_t k) {
+					auto i = para_idxs[k];
+					precomputed[i].emplace(m_objects[i]->createLayoutObject(cs, cur_style, available_space));
+				});
+			}
+		}
+
 		auto max_size = total_size;
 		for(size_t i = 0, obj_idx = 0; i < m_objects.size(); i++)
 		{
 			if(have_left_border)
 				zpr::println("available space: {}", available_space);
-			auto obj = TRY(m_objects[i].get()->createLayoutObject(cs, cur_style, available_space));
+
+			auto result = precomputed[i].has_value()
+			                ? std::move(*precomputed[i])
+			                : m_objects[i].get()->createLayoutObject(cs, cur_style, available_space);
+
+			auto obj = TRY(std::move(result));
 			if(not obj.object.has_value())
 				continue;
 
@@ -29,7 +29,7 @@ namespace sap::tree
 		if(iscr->runPhase() != ProcessingPhase::Layout)
 			return ErrMsg(iscr->call->loc(), "inline script calls must run at layout time");
 
-		auto result = TRY(iscr->evaluate_script(cs, m_style, available_space));
+		auto result = TRY(iscr->evaluate_script(cs, *m_style, available_space));
 		if(not result.has_value())
 			return Ok(std::nullopt);
 
@@ -44,6 +44,11 @@ namespace sap::tree
 	}
 
 
+	bool Paragraph::hasScriptCalls() const
+	{
+		return std::any_of(m_contents.begin(), m_contents.end(), [](auto& obj) { return obj->isScriptCall(); });
+	}
+
 	auto Paragraph::evaluate_scripts(interp::Interpreter* cs, Size2d available_space) const
 	    -> ErrorOr<std::optional<EvalScriptResult>>
 	{
@@ -85,6 +85,23 @@ namespace sap::tree
 		std::vector<zst::SharedPtr<InlineObject>>& contents() { return m_contents; }
 		const std::vector<zst::SharedPtr<InlineObject>>& contents() const { return m_contents; }
 
+		/*
+		    Paragraphs without any script calls don't need the interpreter to be laid out (except to read the
+		    microtype settings), so a Container can lay them out on other threads.
+		*/
+		bool hasScriptCalls() const;
+
+		/*
+		    For watch mode: keep the line breaks of script-free paragraphs from one compile to the next, so that
+		    paragraphs that were not edited don't need to be broken again. `startNewCompile` must be called at the
+		    start of every compile; it drops whatever the previous compile did not use.
+		*/
+		static void setKeepLineBreaksAcrossCompiles(bool keep);
+		static void startNewCompile();
+
+		// (reused, total) number of paragraphs that were broken into lines in this compile
+		static std::pair<size_t, size_t> lineBreakReuseStats();
+
 		using EvalScriptResult = zst::Either<zst::SharedPtr<InlineSpan>, std::unique_ptr<layout::LayoutObject>>;
 		ErrorOr<std::optional<EvalScriptResult>> evaluate_scripts(interp::Interpreter* cs,
 		    Size2d available_space) const;
@@ -99,7 +116,24 @@ namespace sap::tree
 		    const Style& parent_style,
 		    Size2d available_space) const override;
 
+		struct BrokenParagraph;
+
+		ErrorOr<BrokenParagraph> break_into_lines(interp::Interpreter* cs,
+		    const Style& style,
+		    std::vector<zst::SharedPtr<InlineObject>> objs,
+		    Length available_width,
+		    std::optional<uint64_t> fingerprint) const;
+
+		ErrorOr<LayoutResult> make_lines(interp::Interpreter* cs,
+		    const Style& style,
+		    const BrokenParagraph& broken,
+		    Size2d available_space) const;
+
 	private:
 		std::vector<zst::SharedPtr<InlineObject>> m_contents {};
+
+		// only for paragraphs without scripts; see layout/paragraph.cpp. (this is a shared_ptr only because
+		// BrokenParagraph is incomplete here)
+		mutable std::shared_ptr<BrokenParagraph> m_layout_cache {};
 	};
 }
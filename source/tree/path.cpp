@@ -404,7 +404,7 @@ namespace sap::tree
 	    const Style& parent_style,
 	    Size2d available_space) const
 	{
-		auto style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 		return Ok(LayoutResult::make(std::make_unique<
 		    layout::Path>(TRY(this->createLayoutObjectWithoutInterp(style)))));
 	}
@@ -74,7 +74,7 @@ namespace sap::tree
 		(void) available_space;
 
 		auto _ = cs->evaluator().pushBlockContext(this);
-		auto style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 
 		std::vector<std::unique_ptr<layout::LayoutObject>> lines {};
 
@@ -4,7 +4,8 @@
 
 #include <utf8proc/utf8proc.h>
 
-#include "sap/config.h"
+#include "sap/style.h"
+#include "pdf/font.h"
 #include "tree/base.h"
 #include "tree/paragraph.h"
 #include "misc/hyphenator.h"
@@ -29,16 +30,6 @@ namespace sap::tree
 
 	static void make_separators_for_word(std::vector<zst::SharedPtr<InlineObject>>& vec, zst::SharedPtr<Text> text)
 	{
-		static auto hyphenator = []() {
-			auto resolved = paths::resolveLibrary(Location::builtin(), "data/hyphenation/hyph-en-gb.tex");
-			if(resolved.is_err())
-				resolved.error().showAndExit();
-
-			return hyph::Hyphenator::parseFromFile(resolved.unwrap());
-		}();
-
-		// TODO: maybe cache at this level as well
-
 		auto word = std::move(text->contents());
 		auto orig_span = zst::wstr_view(word);
 
@@ -87,36 +78,9 @@ namespace sap::tree
 		}
 		else if(not orig_span.empty())
 		{
-			std::u32string lowercased;
-			lowercased.reserve(orig_span.size());
-			for(auto c : orig_span)
-				lowercased.push_back((char32_t) utf8proc_tolower((utf8proc_int32_t) c));
-
-			auto lower_span = zst::wstr_view(lowercased);
-			auto& points = hyphenator.computeHyphenationPoints(lower_span);
-
-			// ignore hyphenations at the first index and last index, since
-			// those imply inserting a hyphen before the first character or after the last character
-			for(size_t i = 1, k = 1; i < points.size() - 1; i++)
-			{
-				if(points[i] % 2 == 0)
-				{
-					k++;
-				}
-				else
-				{
-					// hyphenation preference increases from 1 to 3 to 5, so 5 has the lowest cost, and 1 the
-					// highest.
-					auto part = orig_span.take_prefix(k);
-					vec.push_back(new_thing_from_existing<Text>(text, part.str()));
-					vec.push_back(new_thing_from_existing<Separator>(text, Separator::HYPHENATION_POINT,
-					    /* cost: */ 6 - points[i]));
-					k = 1;
-				}
-			}
-
-			if(orig_span.size() > 0)
-				vec.push_back(new_thing_from_existing<Text>(text, orig_span.str()));
+			// note: automatic hyphenation points are inserted later (by `insertHyphenationPoints`), once we know
+			// the style -- and so the language -- of the word.
+			vec.push_back(new_thing_from_existing<Text>(text, orig_span.str()));
 		}
 
 
@@ -142,7 +106,7 @@ namespace sap::tree
 			}
 			else if(auto text = input[i]->castToText())
 			{
-				auto style = parent_style.extendWith(text->style());
+				auto& style = parent_style.extendWith(text->style());
 				if(not style.smart_quotes_enabled())
 				{
 					ret.push_back(std::move(input[i]));
@@ -212,6 +176,207 @@ namespace sap::tree
 
 
 
+	static void insert_hyphenation_points(InlineObjVec& vec,
+	    const zst::SharedPtr<InlineObject>& orig,
+	    const Text* text,
+	    const hyph::Hyphenator& hyphenator)
+	{
+		auto orig_span = zst::wstr_view(text->contents());
+
+		std::u32string lowercased;
+		lowercased.reserve(orig_span.size());
+		for(auto c : orig_span)
+			lowercased.push_back((char32_t) utf8proc_tolower((utf8proc_int32_t) c));
+
+		auto lower_span = zst::wstr_view(lowercased);
+		auto points = hyphenator.computeHyphenationPoints(lower_span);
+
+		// ignore hyphenations at the first index and last index, since
+		// those imply inserting a hyphen before the first character or after the last character
+		bool split = false;
+		for(size_t i = 1, k = 1; i < points.size() - 1; i++)
+		{
+			if(points[i] % 2 == 0)
+			{
+				k++;
+			}
+			else
+			{
+				// hyphenation preference increases from 1 to 3 to 5, so 5 has the lowest cost, and 1 the
+				// highest.
+				auto part = orig_span.take_prefix(k);
+				vec.push_back(new_thing_from_existing<Text>(orig, part.str()));
+				vec.push_back(new_thing_from_existing<Separator>(orig, Separator::HYPHENATION_POINT,
+				    /* cost: */ 6 - points[i]));
+				k = 1;
+				split = true;
+			}
+		}
+
+		if(not split)
+			vec.push_back(orig);
+		else if(orig_span.size() > 0)
+			vec.push_back(new_thing_from_existing<Text>(orig, orig_span.str()));
+	}
+
+	ErrorOr<InlineObjVec> insertHyphenationPoints(const Style& parent_style, InlineObjVec input)
+	{
+		std::vector<zst::SharedPtr<InlineObject>> ret {};
+		ret.reserve(input.size());
+
+		for(size_t i = 0; i < input.size(); i++)
+		{
+			auto& obj = input[i];
+			if(auto text = obj->castToText())
+			{
+				// only hyphenate whole words; not the punctuation around them (which `processWordSeparators`
+				// splits off), nor words that were already broken at a '-' or '/'.
+				auto is_break_point = [](const InlineObjVec& objs, size_t k) {
+					auto sep = k < objs.size() ? objs[k]->castToSeparator() : nullptr;
+					return sep != nullptr && sep->isExplicitBreakPoint();
+				};
+
+				// (the previous object was already moved into `ret`)
+				auto& contents = text->contents();
+				if(contents.empty() || not std::all_of(contents.begin(), contents.end(), is_letter)
+				    || (not ret.empty() && is_break_point(ret, ret.size() - 1)) || is_break_point(input, i + 1))
+				{
+					ret.push_back(std::move(obj));
+					continue;
+				}
+
+				auto& style = parent_style.extendWith(text->style());
+				auto hyphenator = hyph::Hyphenator::forLanguage(style.have_language() ? style.language()
+				                                                                      : DEFAULT_LANGUAGE);
+
+				if(hyphenator == nullptr)
+					ret.push_back(std::move(obj));
+				else
+					insert_hyphenation_points(ret, obj, text, *hyphenator);
+			}
+			else if(auto span = obj->castToSpan())
+			{
+				span->objects() = TRY(insertHyphenationPoints(parent_style.extendWith(span->style()),
+				    std::move(span->objects())));
+
+				ret.push_back(std::move(obj));
+			}
+			else
+			{
+				ret.push_back(std::move(obj));
+			}
+		}
+
+		return OkMove(ret);
+	}
+
+
+
+	static bool is_combining_mark(char32_t c)
+	{
+		auto category = utf8proc_category((utf8proc_int32_t) c);
+		return util::is_one_of(category, UTF8PROC_CATEGORY_MN, UTF8PROC_CATEGORY_MC, UTF8PROC_CATEGORY_ME);
+	}
+
+	static void split_text_into_font_runs(InlineObjVec& vec,
+	    const zst::SharedPtr<InlineObject>& orig,
+	    const Text* text,
+	    const Style& style)
+	{
+		const auto font_style = style.font_style();
+		const auto& fallbacks = *style.font_fallbacks();
+
+		const auto& contents = text->contents();
+		auto text_view = zst::wstr_view(contents);
+
+		// the common case is that the main font has everything, so check that first.
+		auto& main_coverage = style.font()->coverage();
+		auto covered = main_coverage.coveredPrefixLength(text_view);
+		if(covered == contents.size())
+		{
+			vec.push_back(orig);
+			return;
+		}
+
+		// index 0 is the main font, and i > 0 is fallbacks[i - 1]. if nobody has the glyph, use the main font
+		// (which gives .notdef). combining marks stay with their base character if possible.
+		std::vector<const font::CodepointCoverage*> coverages { &main_coverage };
+		for(auto& family : fallbacks)
+			coverages.push_back(&family.getFontForStyle(font_style)->coverage());
+
+		auto font_for_char = [&coverages](char32_t ch, size_t prev_font) -> size_t {
+			if(is_combining_mark(ch) && coverages[prev_font]->contains(ch))
+				return prev_font;
+
+			for(size_t i = 0; i < coverages.size(); i++)
+			{
+				if(coverages[i]->contains(ch))
+					return i;
+			}
+
+			return 0;
+		};
+
+		auto flush_run = [&](size_t begin, size_t end, size_t font_idx) {
+			auto run = new_thing_from_existing<Text>(orig, text_view.drop(begin).take(end - begin).str());
+			if(font_idx > 0)
+				run->setStyle(run->style().with_font_family(fallbacks[font_idx - 1]));
+
+			vec.push_back(std::move(run));
+		};
+
+		size_t run_begin = 0;
+		size_t run_font = 0;
+
+		for(size_t i = covered; i < contents.size(); i++)
+		{
+			auto font_idx = font_for_char(contents[i], run_font);
+			if(font_idx == run_font)
+				continue;
+
+			if(i > run_begin)
+				flush_run(run_begin, i, run_font);
+
+			run_begin = i;
+			run_font = font_idx;
+		}
+
+		flush_run(run_begin, contents.size(), run_font);
+	}
+
+	ErrorOr<InlineObjVec> applyFontFallbacks(const Style& parent_style, InlineObjVec input)
+	{
+		std::vector<zst::SharedPtr<InlineObject>> ret {};
+		ret.reserve(input.size());
+
+		for(auto& obj : input)
+		{
+			if(auto text = obj->castToText())
+			{
+				auto& style = parent_style.extendWith(text->style());
+				if(style.have_font_fallbacks() && not style.font_fallbacks()->empty() && not text->contents().empty())
+					split_text_into_font_runs(ret, obj, text, style);
+				else
+					ret.push_back(std::move(obj));
+			}
+			else if(auto span = obj->castToSpan())
+			{
+				span->objects() = TRY(applyFontFallbacks(parent_style.extendWith(span->style()),
+				    std::move(span->objects())));
+
+				ret.push_back(std::move(obj));
+			}
+			else
+			{
+				ret.push_back(std::move(obj));
+			}
+		}
+
+		return OkMove(ret);
+	}
+
+
+
 	ErrorOr<InlineObjVec> processWordSeparators(InlineObjVec input)
 	{
 		std::vector<zst::SharedPtr<InlineObject>> ret {};
@@ -23,7 +23,7 @@ namespace sap::tree
 	{
 		auto _ = cs->evaluator().pushBlockContext(this);
 
-		auto cur_style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto cur_style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 		auto size = m_size.resolve(cur_style);
 
 		auto layout_size = LayoutSize {
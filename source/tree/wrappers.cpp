@@ -31,7 +31,7 @@ namespace sap::tree
 	    Size2d available_space) const -> ErrorOr<LayoutResult>
 	{
 		auto _ = cs->evaluator().pushBlockContext(this);
-		auto cur_style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto cur_style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 
 		auto objs = TRY(tree::processWordSeparators(m_objects));
 		objs = TRY(tree::performReplacements(cur_style, std::move(objs)));
@@ -54,7 +54,7 @@ namespace sap::tree
 	    Size2d available_space) const -> ErrorOr<LayoutResult>
 	{
 		auto _ = cs->evaluator().pushBlockContext(this);
-		auto cur_style = m_style.useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
+		auto cur_style = m_style->useDefaultsFrom(parent_style).useDefaultsFrom(cs->evaluator().currentStyle());
 
 		// call the callback and pass in the things.
 		auto tbo = m_callback(&cs->evaluator(), m_context, m_function);
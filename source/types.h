@@ -6,7 +6,9 @@
 
 #include <bit>
 #include <string>
+#include <vector>
 #include <cstdint>
+#include <optional>
 #include <type_traits>
 
 #include <zpr.h>
@@ -94,6 +96,39 @@ namespace sap
 		double right;
 	};
 
+	/*
+	    The protrusions for every character of one font, indexed directly by codepoint. The characters with
+	    protrusions are all fairly near the start of unicode, so the index stays small; it only stores a slot
+	    number, and the (much fewer) protrusions themselves are stored separately.
+	*/
+	struct ProtrusionTable
+	{
+		std::optional<CharacterProtrusion> get(char32_t ch) const
+		{
+			if(static_cast<size_t>(ch) >= m_index.size() || m_index[static_cast<size_t>(ch)] == 0)
+				return std::nullopt;
+
+			return m_protrusions[m_index[static_cast<size_t>(ch)] - 1];
+		}
+
+		// does nothing if `ch` already has a protrusion
+		void add(char32_t ch, CharacterProtrusion protrusion)
+		{
+			auto idx = static_cast<size_t>(ch);
+			if(idx >= m_index.size())
+				m_index.resize(idx + 1, 0);
+			else if(m_index[idx] != 0)
+				return;
+
+			m_protrusions.push_back(protrusion);
+			m_index[idx] = static_cast<uint16_t>(m_protrusions.size());
+		}
+
+	private:
+		std::vector<uint16_t> m_index;
+		std::vector<CharacterProtrusion> m_protrusions;
+	};
+
 
 	template <typename T>
 	struct Uninitialised
@@ -8,6 +8,7 @@
 #include <numeric>
 #include <variant>
 #include <concepts>
+#include <filesystem>
 #include <optional>
 #include <string_view>
 #include <unordered_map>
@@ -71,6 +72,9 @@ namespace util
 
 	zst::unique_span<uint8_t[]> readEntireFile(const std::string& path);
 
+	/* the absolute path of the running executable, if the platform can tell us */
+	std::optional<std::filesystem::path> getExecutablePath();
+
 
 
 	uint16_t convertBEU16(uint16_t x);
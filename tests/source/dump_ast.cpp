@@ -29,6 +29,7 @@ namespace sap::interp::ast
 			case Finalise: return "Finalise";
 			case Render: return "Render";
 		}
+		util::unreachable();
 	}
 }
 
@@ -483,7 +484,7 @@ namespace test
 	{
 		pj::array indices {};
 		for(auto& i : x->indices)
-			indices.push_back(dumpExpr(i.get()));
+			indices.push_back(dumpExpr(i.value.get()));
 
 		return V(O {
 		    { "ast", V("SubscriptOp") },
@@ -0,0 +1,94 @@
+// test-hyphenation.cpp
+// Copyright (c) 2024, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tester.h"
+
+#include "misc/hyphenator.h"
+
+namespace test
+{
+	// the word with a '-' at every odd hyphenation point, like TeX's \showhyphens.
+	static std::string show_hyphens(std::string_view word, const std::vector<uint8_t>& points)
+	{
+		std::string ret {};
+		for(size_t i = 0; i < word.size(); i++)
+		{
+			if(i > 0 && i < points.size() && points[i] % 2 != 0)
+				ret += '-';
+
+			ret += word[i];
+		}
+
+		return ret;
+	}
+
+	static void check_word(Context& ctx,
+	    const sap::hyph::Hyphenator& hyph,
+	    std::string_view word,
+	    std::string_view expected,
+	    const std::vector<uint8_t>* expected_points = nullptr)
+	{
+		auto u32_word = std::u32string(word.begin(), word.end());
+		auto points = hyph.computeHyphenationPoints(u32_word);
+
+		auto got = show_hyphens(word, points);
+		if(got != expected || (expected_points != nullptr && points != *expected_points))
+		{
+			zpr::println("hyphenation: '{}' was hyphenated as '{}' (points {}), expected '{}'", word, got, points,
+			    expected);
+			ctx.failed++;
+		}
+		else
+		{
+			ctx.passed++;
+		}
+	}
+
+	void test_hyphenation(Context& ctx, const stdfs::path& test_dir)
+	{
+		{
+			auto hyph = sap::hyph::Hyphenator::parseFromFile((test_dir / "hyphenation" / "liang.tex").string());
+
+			// the example from Liang's thesis, where the patterns overlap: the points are the highest value from
+			// any pattern, and only odd ones allow a hyphen.
+			auto hyphenation_points = std::vector<uint8_t> { 0, 0, 3, 0, 0, 2, 5, 4, 2, 0, 0, 0 };
+			check_word(ctx, hyph, "hyphenation", "hy-phen-ation", &hyphenation_points);
+
+			// '.' anchors a pattern to the start or end of the word; elsewhere, it doesn't match.
+			check_word(ctx, hyph, "prefix", "pre-fix");
+			check_word(ctx, hyph, "apprehend", "apprehend");
+			check_word(ctx, hyph, "kindness", "kind-ness");
+			check_word(ctx, hyph, "nessie", "nessie");
+
+			// at least 2 characters must stay at the start of the line, and 3 must go to the next one.
+			check_word(ctx, hyph, "oxen", "oxen");
+			check_word(ctx, hyph, "quickly", "quickly");
+
+			// words from the exception list are hyphenated exactly as given.
+			check_word(ctx, hyph, "table", "ta-ble");
+		}
+
+		{
+			auto path = test_dir.parent_path() / "lib" / "sap" / "data" / "hyphenation" / "hyph-en-gb.tex";
+			if(not stdfs::exists(path))
+			{
+				ctx.skipped++;
+				return;
+			}
+
+			auto hyph = sap::hyph::Hyphenator::parseFromFile(path.string());
+
+			// these were checked against a straightforward implementation of Liang's algorithm.
+			check_word(ctx, hyph, "hyphenation", "hy-phen-a-tion");
+			check_word(ctx, hyph, "typesetting", "type-set-ting");
+			check_word(ctx, hyph, "incomprehensible", "in-com-pre-hens-ible");
+			check_word(ctx, hyph, "extraordinarily", "ex-traordin-ar-ily");
+			check_word(ctx, hyph, "mathematics", "math-em-at-ics");
+			check_word(ctx, hyph, "association", "as-so-ci-ation");
+			check_word(ctx, hyph, "encyclopaedia", "en-cyc-lo-pae-dia");
+			check_word(ctx, hyph, "quickly", "quickly");
+			check_word(ctx, hyph, "university", "uni-ver-sity");
+		}
+	}
+}
@@ -0,0 +1,222 @@
+// test-linebreak.cpp
+// Copyright (c) 2024, yuki
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tester.h"
+
+#include "misc/dijkstra.h"
+
+#include "pdf/font.h"
+
+#include "sap/style.h"
+#include "sap/font_family.h"
+
+#include "tree/paragraph.h"
+#include "interp/interp.h"
+#include "layout/linebreak.h"
+
+namespace test
+{
+	using InlineObjVec = std::vector<zst::SharedPtr<sap::tree::InlineObject>>;
+
+	/*
+	    The reference line breaker: a shortest-path search over the breakpoints of the paragraph, using the
+	    same cost model (`LineCandidate`) as `breakLines`. The two must always find equally cheap breaks; the
+	    breaks themselves can differ when two ways of breaking the paragraph cost exactly the same.
+	*/
+	struct ReferenceNode
+	{
+		using Distance = double;
+
+		sap::interp::Interpreter* cs;
+		const sap::Style* parent_style;
+		const InlineObjVec* contents;
+		const sap::layout::linebreak::ParagraphWidths* widths;
+		sap::Length preferred_line_length;
+
+		size_t position;
+
+		std::vector<std::pair<ReferenceNode, Distance>> neighbours() const
+		{
+			std::vector<std::pair<ReferenceNode, Distance>> ret {};
+
+			auto candidate = sap::layout::linebreak::LineCandidate(cs, *parent_style, *contents, *widths, position,
+			    preferred_line_length);
+
+			while(not candidate.finished())
+			{
+				if(auto brk = candidate.advance(); brk.has_value())
+				{
+					auto node = *this;
+					node.position = brk->end;
+					ret.emplace_back(std::move(node), brk->cost);
+				}
+			}
+
+			return ret;
+		}
+
+		size_t hash() const { return position; }
+		bool operator==(const ReferenceNode& other) const { return position == other.position; }
+	};
+
+	static std::vector<size_t> reference_breaks(sap::interp::Interpreter* cs,
+	    const sap::Style& style,
+	    const InlineObjVec& contents,
+	    const sap::layout::linebreak::ParagraphWidths& widths,
+	    sap::Length line_length)
+	{
+		auto start = ReferenceNode {
+			.cs = cs,
+			.parent_style = &style,
+			.contents = &contents,
+			.widths = &widths,
+			.preferred_line_length = line_length,
+			.position = 0,
+		};
+
+		auto end = start;
+		end.position = contents.size();
+
+		std::vector<size_t> ret {};
+		for(auto& node : util::dijkstra_shortest_path(start, end))
+			ret.push_back(node.position);
+
+		return ret;
+	}
+
+	static std::vector<size_t> active_list_breaks(sap::interp::Interpreter* cs,
+	    const sap::Style& style,
+	    const InlineObjVec& contents,
+	    const sap::layout::linebreak::ParagraphWidths& widths,
+	    sap::Length line_length)
+	{
+		std::vector<size_t> ret {};
+
+		size_t position = 0;
+		for(auto& line : sap::layout::linebreak::breakLines(cs, style, contents, widths, line_length))
+			ret.push_back(position += line.numParts());
+
+		return ret;
+	}
+
+	static double total_cost(sap::interp::Interpreter* cs,
+	    const sap::Style& style,
+	    const InlineObjVec& contents,
+	    const sap::layout::linebreak::ParagraphWidths& widths,
+	    sap::Length line_length,
+	    const std::vector<size_t>& breaks)
+	{
+		double total = 0;
+
+		size_t start = 0;
+		for(auto end : breaks)
+		{
+			auto candidate = sap::layout::linebreak::LineCandidate(cs, style, contents, widths, start, line_length);
+			while(true)
+			{
+				if(candidate.finished())
+					return std::numeric_limits<double>::infinity();
+
+				if(auto brk = candidate.advance(); brk.has_value() && brk->end == end)
+				{
+					total += brk->cost;
+					break;
+				}
+			}
+
+			start = end;
+		}
+
+		return start == contents.size() ? total : std::numeric_limits<double>::infinity();
+	}
+
+	static InlineObjVec make_paragraph(uint32_t seed, size_t num_words)
+	{
+		static constexpr const char32_t* words[] = {
+			U"a",
+			U"of",
+			U"the",
+			U"line",
+			U"breaking",
+			U"paragraph",
+			U"typesetting",
+			U"into",
+			U"incomprehensibilities",
+			U"is",
+			U"quite",
+			U"hard",
+		};
+
+		// a small LCG, so that every run breaks the same paragraphs.
+		auto next = [&seed]() -> uint32_t {
+			seed = seed * 1664525 + 1013904223;
+			return seed >> 16;
+		};
+
+		InlineObjVec ret {};
+		for(size_t i = 0; i < num_words; i++)
+		{
+			if(i > 0)
+			{
+				auto r = next() % 16;
+				if(r == 0)
+					ret.push_back(zst::make_shared<sap::tree::Separator>(sap::tree::Separator::HYPHENATION_POINT, 1));
+				else if(r == 1)
+					ret.push_back(zst::make_shared<sap::tree::Separator>(sap::tree::Separator::BREAK_POINT));
+				else
+					ret.push_back(zst::make_shared<sap::tree::Separator>(sap::tree::Separator::SPACE));
+			}
+
+			ret.push_back(zst::make_shared<sap::tree::Text>(words[next() % std::size(words)]));
+		}
+
+		return ret;
+	}
+
+	void test_linebreak(Context& ctx, const stdfs::path& test_dir)
+	{
+		(void) test_dir;
+
+		auto font = pdf::PdfFont::fromBuiltin(pdf::BuiltinFont::TimesRoman);
+		auto cs = sap::interp::Interpreter();
+
+		auto style = sap::Style();
+		style.set_font_family(sap::FontFamily(font.get(), font.get(), font.get(), font.get()))
+		    .set_font_style(sap::FontStyle::Regular)
+		    .set_font_features(font::DEFAULT_FEATURE_SET)
+		    .set_font_size(pdf::PdfScalar(10).into())
+		    .set_root_font_size(pdf::PdfScalar(10).into())
+		    .set_line_spacing(1.0)
+		    .set_sentence_space_stretch(1.5);
+
+		for(uint32_t seed = 1; seed <= 8; seed++)
+		{
+			auto para = make_paragraph(seed, 40 * seed);
+			auto widths = sap::layout::linebreak::ParagraphWidths(style, para);
+
+			for(double width : { 40.0, 90.0, 150.0 })
+			{
+				auto line_length = sap::Length(width);
+
+				auto expected = reference_breaks(&cs, style, para, widths, line_length);
+				auto got = active_list_breaks(&cs, style, para, widths, line_length);
+
+				auto expected_cost = total_cost(&cs, style, para, widths, line_length, expected);
+				auto got_cost = total_cost(&cs, style, para, widths, line_length, got);
+
+				if(got == expected || std::abs(got_cost - expected_cost) <= 1e-9 * expected_cost)
+				{
+					ctx.passed++;
+				}
+				else
+				{
+					zpr::println("linebreak: paragraph {} at {}mm: breaks {} (cost {}) differ from the reference {} "
+					             "(cost {})",
+					    seed, width, got, got_cost, expected, expected_cost);
+					ctx.failed++;
+				}
+			}
+		}
+	}
+}
@@ -4,6 +4,15 @@
 
 #include "tester.h"
 
+namespace sap
+{
+	// normally defined in main.cpp
+	stdfs::path getInvocationCWD()
+	{
+		return stdfs::current_path();
+	}
+}
+
 int main(int argc, char** argv)
 {
 	if(argc != 2)
@@ -17,4 +26,9 @@ int main(int argc, char** argv)
 	test::Context context {};
 
 	test::test_parser(context, test_dir);
+	test::test_linebreak(context, test_dir);
+	test::test_hyphenation(context, test_dir);
+
+	zpr::println("{} passed, {} failed, {} skipped", context.passed, context.failed, context.skipped);
+	return context.failed == 0 ? 0 : 1;
 }
@@ -28,6 +28,8 @@ namespace test
 	pj::value dumpExpr(const sap::interp::ast::Expr* x);
 
 	void test_parser(Context& ctx, const stdfs::path& test_dir);
+	void test_linebreak(Context& ctx, const stdfs::path& test_dir);
+	void test_hyphenation(Context& ctx, const stdfs::path& test_dir);
 
 
 
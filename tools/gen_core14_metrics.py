@@ -0,0 +1,360 @@
+#!/usr/bin/env python3
+# gen_core14_metrics.py
+# Copyright (c) 2022, yuki
+# SPDX-License-Identifier: Apache-2.0
+
+# Generates the constexpr metric tables for the 14 standard PDF fonts from their AFM files, so that the
+# builtin fonts don't need to parse anything at runtime. The build runs this on the AFMs in
+# source/pdf/font/builtin_afms/, and puts the headers in the build directory.
+#
+# usage: tools/gen_core14_metrics.py <afm-dir> <output-dir>
+#
+# <afm-dir> should contain the Adobe Core14 AFMs, named like the outputs (times_roman.afm, courier_bold.afm, ...).
+
+import os
+import sys
+
+FONTS = [
+	("times_roman", "TIMES_ROMAN"),
+	("times_bold", "TIMES_BOLD"),
+	("times_italic", "TIMES_ITALIC"),
+	("times_bold_italic", "TIMES_BOLD_ITALIC"),
+	("courier", "COURIER"),
+	("courier_bold", "COURIER_BOLD"),
+	("courier_oblique", "COURIER_OBLIQUE"),
+	("courier_bold_oblique", "COURIER_BOLD_OBLIQUE"),
+	("helvetica", "HELVETICA"),
+	("helvetica_bold", "HELVETICA_BOLD"),
+	("helvetica_oblique", "HELVETICA_OBLIQUE"),
+	("helvetica_bold_oblique", "HELVETICA_BOLD_OBLIQUE"),
+	("symbol", "SYMBOL"),
+	("zapf_dingbats", "ZAPF_DINGBATS"),
+]
+
+# glyph names that don't map to a codepoint here get codepoint 0.
+GLYPH_NAMES = {
+	"space": 0x0020,
+	"exclam": 0x0021,
+	"quotedbl": 0x0022,
+	"numbersign": 0x0023,
+	"dollar": 0x0024,
+	"percent": 0x0025,
+	"ampersand": 0x0026,
+	"quoteright": 0x0027,
+	"parenleft": 0x0028,
+	"parenright": 0x0029,
+	"asterisk": 0x002A,
+	"plus": 0x002B,
+	"comma": 0x002C,
+	"hyphen": 0x002D,
+	"period": 0x002E,
+	"slash": 0x002F,
+	"zero": 0x0030,
+	"one": 0x0031,
+	"two": 0x0032,
+	"three": 0x0033,
+	"four": 0x0034,
+	"five": 0x0035,
+	"six": 0x0036,
+	"seven": 0x0037,
+	"eight": 0x0038,
+	"nine": 0x0039,
+	"colon": 0x003A,
+	"semicolon": 0x003B,
+	"less": 0x003C,
+	"equal": 0x003D,
+	"greater": 0x003E,
+	"question": 0x003F,
+	"at": 0x0040,
+	"A": 0x0041,
+	"B": 0x0042,
+	"C": 0x0043,
+	"D": 0x0044,
+	"E": 0x0045,
+	"F": 0x0046,
+	"G": 0x0047,
+	"H": 0x0048,
+	"I": 0x0049,
+	"J": 0x004A,
+	"K": 0x004B,
+	"L": 0x004C,
+	"M": 0x004D,
+	"N": 0x004E,
+	"O": 0x004F,
+	"P": 0x0050,
+	"Q": 0x0051,
+	"R": 0x0052,
+	"S": 0x0053,
+	"T": 0x0054,
+	"U": 0x0055,
+	"V": 0x0056,
+	"W": 0x0057,
+	"X": 0x0058,
+	"Y": 0x0059,
+	"Z": 0x005A,
+	"bracketleft": 0x005B,
+	"backslash": 0x005C,
+	"bracketright": 0x005D,
+	"asciicircum": 0x005E,
+	"underscore": 0x005F,
+	"quoteleft": 0x0060,
+	"a": 0x0061,
+	"b": 0x0062,
+	"c": 0x0063,
+	"d": 0x0064,
+	"e": 0x0065,
+	"f": 0x0066,
+	"g": 0x0067,
+	"h": 0x0068,
+	"i": 0x0069,
+	"j": 0x006A,
+	"k": 0x006B,
+	"l": 0x006C,
+	"m": 0x006D,
+	"n": 0x006E,
+	"o": 0x006F,
+	"p": 0x0070,
+	"q": 0x0071,
+	"r": 0x0072,
+	"s": 0x0073,
+	"t": 0x0074,
+	"u": 0x0075,
+	"v": 0x0076,
+	"w": 0x0077,
+	"x": 0x0078,
+	"y": 0x0079,
+	"z": 0x007A,
+	"braceleft": 0x007B,
+	"bar": 0x007C,
+	"braceright": 0x007D,
+	"asciitilde": 0x007E,
+	"exclamdown": 0x00A1,
+	"cent": 0x00A2,
+	"sterling": 0x00A3,
+	"fraction": 0x2044,
+	"yen": 0x00A5,
+	"florin": 0x0192,
+	"section": 0x00A7,
+	"currency": 0x00A4,
+	"quotesingle": 0x0027,
+	"quotedblleft": 0x201C,
+	"guillemotleft": 0x00AB,
+	"guilsinglleft": 0x2039,
+	"guilsinglright": 0x203A,
+	"fi": 0xFB01,
+	"fl": 0xFB02,
+	"endash": 0x2013,
+	"dagger": 0x2020,
+	"daggerdbl": 0x2021,
+	"periodcentered": 0x00B7,
+	"paragraph": 0x00B6,
+	"bullet": 0x2022,
+	"quotesinglbase": 0x201A,
+	"quotedblbase": 0x201E,
+	"quotedblright": 0x201D,
+	"guillemotright": 0x00BB,
+	"ellipsis": 0x2026,
+	"perthousand": 0x2030,
+	"questiondown": 0x00BF,
+	"grave": 0x0060,
+	"acute": 0x00B4,
+	"circumflex": 0x02C6,
+	"tilde": 0x02DC,
+	"macron": 0x00AF,
+	"breve": 0x02D8,
+	"dotaccent": 0x02D9,
+	"dieresis": 0x00A8,
+	"ring": 0x02DA,
+	"cedilla": 0x00B8,
+	"hungarumlaut": 0x02DD,
+	"ogonek": 0x02DB,
+	"caron": 0x02C7,
+	"emdash": 0x2014,
+	"AE": 0x00C6,
+	"ordfeminine": 0x00AA,
+	"Lslash": 0x0141,
+	"Oslash": 0x00D8,
+	"OE": 0x0152,
+	"ordmasculine": 0x00BA,
+	"ae": 0x00E6,
+	"dotlessi": 0x0131,
+	"lslash": 0x0142,
+	"oslash": 0x00F8,
+	"oe": 0x0153,
+	"germandbls": 0x00DF,
+}
+
+
+def parse_afm(path):
+	font = {
+		"name": "",
+		"bbox": [0, 0, 0, 0],
+		"italic_angle": "0",
+		"cap_height": 0,
+		"x_height": 0,
+		"ascent": 0,
+		"descent": 0,
+		"stem_v": 0,
+		"stem_h": 0,
+	}
+
+	glyphs = {}
+	kerns = {}
+	name_to_code = {}
+	ligatures = []
+
+	expected_glyphs = 0
+	expected_kerns = 0
+
+	with open(path, "r", encoding="latin-1") as f:
+		lines = [line.strip() for line in f if line.strip()]
+
+	if not lines[0].startswith("StartFontMetrics"):
+		sys.exit(f"{path}: malformed AFM file")
+
+	for line in lines:
+		key, _, value = line.partition(" ")
+		value = value.strip()
+
+		if key == "FontName":
+			font["name"] = value
+		elif key == "FontBBox":
+			font["bbox"] = [int(x) for x in value.split()]
+		elif key == "ItalicAngle":
+			font["italic_angle"] = value
+		elif key == "CapHeight":
+			font["cap_height"] = int(value)
+		elif key == "XHeight":
+			font["x_height"] = int(value)
+		elif key == "Ascender":
+			font["ascent"] = int(value)
+		elif key == "Descender":
+			font["descent"] = int(value)
+		elif key == "StdVW":
+			font["stem_v"] = int(value)
+		elif key == "StdHW":
+			font["stem_h"] = int(value)
+		elif key == "StartCharMetrics":
+			expected_glyphs = int(value)
+		elif key == "StartKernPairs":
+			expected_kerns = int(value)
+		elif key == "C" and expected_glyphs > 0:
+			expected_glyphs -= 1
+
+			parts = [p.strip() for p in value.split(";")]
+			code = int(parts[0])
+
+			# unencoded glyphs can't be used, so skip them.
+			if code == -1:
+				continue
+
+			glyph = { "code": code, "name": "", "width": 0, "bbox": [0, 0, 0, 0] }
+			for part in parts[1:]:
+				k, _, v = part.partition(" ")
+				if k == "B":
+					glyph["bbox"] = [int(x) for x in v.split()]
+				elif k == "WX":
+					glyph["width"] = int(v)
+				elif k == "N":
+					glyph["name"] = v.strip()
+				elif k == "L":
+					right, lig = v.split()
+					ligatures.append((code, right, lig))
+
+			if not glyph["name"]:
+				sys.exit(f"{path}: glyph {code} has no name")
+
+			glyphs[code] = glyph
+			name_to_code[glyph["name"]] = code
+		elif key == "KPX" and expected_kerns > 0:
+			expected_kerns -= 1
+
+			left, right, adjust = value.split()
+			if left in name_to_code and right in name_to_code:
+				kerns[(name_to_code[left], name_to_code[right])] = int(adjust)
+
+	ligs = {}
+	for left, right, lig in ligatures:
+		if right in name_to_code and lig in name_to_code:
+			ligs[(left, name_to_code[right])] = name_to_code[lig]
+
+	return font, glyphs, kerns, ligs
+
+
+def emit_array(out, type_name, array_name, rows):
+	out.append(f"\tconstexpr {type_name} {array_name}[] = {{")
+	for row in rows:
+		out.append(f"\t\t{{ {', '.join(str(x) for x in row)} }},")
+	out.append("\t};")
+	out.append("")
+
+
+def generate(afm_dir, out_dir, filename, ident):
+	font, glyphs, kerns, ligs = parse_afm(os.path.join(afm_dir, filename + ".afm"))
+
+	out = []
+	out.append(f"// {filename}.h")
+	out.append("// Copyright (c) 2022, yuki")
+	out.append("// SPDX-License-Identifier: Apache-2.0")
+	out.append("")
+	out.append("// generated by tools/gen_core14_metrics.py -- do not edit.")
+	out.append("")
+	out.append("#pragma once")
+	out.append("")
+	out.append("namespace pdf::core14")
+	out.append("{")
+
+	glyph_rows = []
+	for code in sorted(glyphs):
+		g = glyphs[code]
+		glyph_rows.append([code, f"0x{GLYPH_NAMES.get(g['name'], 0):04X}", g["width"], *g["bbox"]])
+
+	emit_array(out, "Glyph", f"{ident}_GLYPHS", glyph_rows)
+
+	if kerns:
+		emit_array(out, "KernPair", f"{ident}_KERNS", [[l, r, a] for (l, r), a in sorted(kerns.items())])
+
+	if ligs:
+		emit_array(out, "Ligature", f"{ident}_LIGATURES", [[l, r, g] for (l, r), g in sorted(ligs.items())])
+
+	def span(name, present):
+		return f"{name}, std::size({name})" if present else "nullptr, 0"
+
+	out.append(f"\tconstexpr FontData {ident} = {{")
+	out.append(f"\t\t.name = \"{font['name']}\",")
+	out.append(f"\t\t.xmin = {font['bbox'][0]},")
+	out.append(f"\t\t.ymin = {font['bbox'][1]},")
+	out.append(f"\t\t.xmax = {font['bbox'][2]},")
+	out.append(f"\t\t.ymax = {font['bbox'][3]},")
+	out.append(f"\t\t.italic_angle = {float(font['italic_angle'])},")
+	out.append(f"\t\t.cap_height = {font['cap_height']},")
+	out.append(f"\t\t.x_height = {font['x_height']},")
+	out.append(f"\t\t.ascent = {font['ascent']},")
+	out.append(f"\t\t.descent = {font['descent']},")
+	out.append(f"\t\t.stem_v = {font['stem_v']},")
+	out.append(f"\t\t.stem_h = {font['stem_h']},")
+	out.append(f"\t\t.glyphs = {{ {span(ident + '_GLYPHS', True)} }},")
+	out.append(f"\t\t.kerning_pairs = {{ {span(ident + '_KERNS', bool(kerns))} }},")
+	out.append(f"\t\t.ligatures = {{ {span(ident + '_LIGATURES', bool(ligs))} }},")
+	out.append("\t};")
+	out.append("}")
+	out.append("")
+
+	with open(os.path.join(out_dir, filename + ".h"), "w") as f:
+		f.write("\n".join(out))
+
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit("usage: gen_core14_metrics.py <afm-dir> <output-dir>")
+
+	afm_dir = sys.argv[1]
+	out_dir = sys.argv[2]
+	os.makedirs(out_dir, exist_ok=True)
+
+	for filename, ident in FONTS:
+		generate(afm_dir, out_dir, filename, ident)
+
+
+if __name__ == "__main__":
+	main()